@@ -143,6 +143,20 @@ static void BM_concatenate_tables(benchmark::State& state)
 CONCAT_TABLES_BENCHMARK_DEFINE(concat_tables_int64_non_null, int64_t, false)
 CONCAT_TABLES_BENCHMARK_DEFINE(concat_tables_int64_nullable, int64_t, true)
 
+// Many small batches of wide tables, where launching one kernel per column is the bottleneck
+#define CONCAT_MANY_TABLES_BENCHMARK_DEFINE(name, type, nullable)                \
+  BENCHMARK_TEMPLATE_DEFINE_F(Concatenate, name, type, nullable)                 \
+  (::benchmark::State & state) { BM_concatenate_tables<type, nullable>(state); } \
+  BENCHMARK_REGISTER_F(Concatenate, name)                                        \
+    ->Args({64, 100, 1000})                                                      \
+    ->Args({1024, 100, 1000})                                                    \
+    ->Args({64, 100, 100})                                                       \
+    ->Unit(benchmark::kMillisecond)                                              \
+    ->UseManualTime();
+
+CONCAT_MANY_TABLES_BENCHMARK_DEFINE(concat_many_tables_int64_non_null, int64_t, false)
+CONCAT_MANY_TABLES_BENCHMARK_DEFINE(concat_many_tables_int64_nullable, int64_t, true)
+
 template <bool Nullable>
 class ConcatenateStrings : public cudf::benchmark {
 };
@@ -164,6 +164,11 @@ CSBM_BENCHMARK_DEFINE(1Gb512ColsValidity, (int64_t)1 * 1024 * 1024 * 1024, 512,
 CSBM_BENCHMARK_DEFINE(1Gb10ColsNoValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 256, 0);
 CSBM_BENCHMARK_DEFINE(1Gb10ColsValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 256, 1);
 
+// many splits, where the per split and per column overhead dominates
+CSBM_BENCHMARK_DEFINE(1Gb50ColsManySplitsNoValidity, (int64_t)1 * 1024 * 1024 * 1024, 50, 1000, 0);
+CSBM_BENCHMARK_DEFINE(1Gb50ColsManySplitsValidity, (int64_t)1 * 1024 * 1024 * 1024, 50, 1000, 1);
+CSBM_BENCHMARK_DEFINE(64Mb50ColsManySplitsValidity, (int64_t)64 * 1024 * 1024, 50, 1000, 1);
+
 #define CSBM_STRINGS_BENCHMARK_DEFINE(name, size, num_columns, num_splits, validity) \
   BENCHMARK_DEFINE_F(ContiguousSplitStrings, name)(::benchmark::State & state)       \
   {                                                                                  \
@@ -184,3 +189,14 @@ CSBM_STRINGS_BENCHMARK_DEFINE(1Gb512ColsNoValidity, (int64_t)1 * 1024 * 1024 * 1
 CSBM_STRINGS_BENCHMARK_DEFINE(1Gb512ColsValidity, (int64_t)1 * 1024 * 1024 * 1024, 512, 256, 1);
 CSBM_STRINGS_BENCHMARK_DEFINE(1Gb10ColsNoValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 256, 0);
 CSBM_STRINGS_BENCHMARK_DEFINE(1Gb10ColsValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 256, 1);
+
+CSBM_STRINGS_BENCHMARK_DEFINE(1Gb50ColsManySplitsNoValidity,
+                              (int64_t)1 * 1024 * 1024 * 1024,
+                              50,
+                              1000,
+                              0);
+CSBM_STRINGS_BENCHMARK_DEFINE(1Gb50ColsManySplitsValidity,
+                              (int64_t)1 * 1024 * 1024 * 1024,
+                              50,
+                              1000,
+                              1);
@@ -27,7 +27,9 @@
 #include <cudf/types.hpp>
 
 #include <algorithm>
+#include <numeric>
 #include <random>
+#include <string>
 
 #include "../fixture/benchmark_fixture.hpp"
 #include "../synchronization/synchronization.hpp"
@@ -90,3 +92,57 @@ void BM_gather(benchmark::State& state)
 
 GBM_BENCHMARK_DEFINE(double_coalesce_x, double, true);
 GBM_BENCHMARK_DEFINE(double_coalesce_o, double, false);
+
+// Wide tables, where launching per-column kernels and re-reading the gather map dominate
+#define GBM_WIDE_BENCHMARK_DEFINE(name, type, coalesce)        \
+  BENCHMARK_DEFINE_F(Gather, name)(::benchmark::State & state) \
+  {                                                            \
+    BM_gather<type, coalesce>(state);                          \
+  }                                                            \
+  BENCHMARK_REGISTER_F(Gather, name)                           \
+    ->RangeMultiplier(4)                                       \
+    ->Ranges({{1 << 10, 1 << 16}, {128, 512}})                 \
+    ->UseManualTime();
+
+GBM_WIDE_BENCHMARK_DEFINE(wide_int32_coalesce_x, int32_t, true);
+GBM_WIDE_BENCHMARK_DEFINE(wide_int32_coalesce_o, int32_t, false);
+
+// Strings with lengths spread between 0 and a maximum, so a few long strings dominate the bytes
+void BM_gather_strings(benchmark::State& state)
+{
+  const cudf::size_type source_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type max_length{(cudf::size_type)state.range(1)};
+
+  std::default_random_engine generator;
+  std::uniform_int_distribution<cudf::size_type> lengths(0, max_length);
+  std::vector<std::string> host_strings(source_size);
+  std::generate(host_strings.begin(), host_strings.end(), [&]() {
+    return std::string(lengths(generator), 'x');
+  });
+  cudf::test::strings_column_wrapper source(host_strings.begin(), host_strings.end());
+  size_t const chars_size = std::accumulate(
+    host_strings.begin(), host_strings.end(), size_t{0}, [](auto size, auto const& str) {
+      return size + str.size();
+    });
+
+  std::vector<cudf::size_type> host_map_data(source_size);
+  std::iota(host_map_data.begin(), host_map_data.end(), 0);
+  std::shuffle(host_map_data.begin(), host_map_data.end(), generator);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> gather_map(host_map_data.begin(),
+                                                                     host_map_data.end());
+
+  cudf::table_view source_table{{source}};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::gather(source_table, gather_map);
+  }
+
+  state.SetBytesProcessed(state.iterations() * chars_size * 2);
+}
+
+BENCHMARK_DEFINE_F(Gather, strings)(::benchmark::State& state) { BM_gather_strings(state); }
+BENCHMARK_REGISTER_F(Gather, strings)
+  ->RangeMultiplier(8)
+  ->Ranges({{1 << 12, 1 << 20}, {8, 512}})
+  ->UseManualTime();
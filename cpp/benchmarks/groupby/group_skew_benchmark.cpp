@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/table/table.hpp>
+#include <fixture/benchmark_fixture.hpp>
+#include <synchronization/synchronization.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+class GroupbySkew : public cudf::benchmark {
+};
+
+namespace {
+// Shape of the groupby keys
+enum class key_kind {
+  SINGLE,  ///< one int64 key
+  MULTI,   ///< two int64 keys
+  STRING   ///< one strings key
+};
+
+// Groupby implementation to exercise
+enum class groupby_path { HASH, SORT };
+
+/**
+ * @brief Draws group indices in [0, cardinality) from a Zipfian distribution of exponent `skew`
+ *
+ * Uses the inverse CDF of the continuous approximation; a `skew` of 0 gives uniform indices.
+ */
+struct zipf_generator {
+  zipf_generator(int64_t cardinality, double skew) : cardinality{cardinality}, skew{skew} {}
+
+  int64_t operator()(std::mt19937& engine)
+  {
+    auto const x    = uniform(engine);
+    auto const size = static_cast<double>(cardinality);
+    double rank     = x * size + 1;
+    if (std::abs(skew - 1.0) < 1e-9) {
+      rank = std::pow(size, x);
+    } else if (skew != 0) {
+      rank = std::pow((std::pow(size, 1.0 - skew) - 1.0) * x + 1.0, 1.0 / (1.0 - skew));
+    }
+    return std::min(std::max<int64_t>(static_cast<int64_t>(rank) - 1, 0), cardinality - 1);
+  }
+
+  int64_t cardinality;
+  double skew;
+  std::uniform_real_distribution<double> uniform{0, 1};
+};
+
+/**
+ * @brief Returns the key columns of `num_rows` rows with `cardinality` distinct keys drawn with
+ * a Zipfian `skew`, where each row is null with probability `null_ratio`
+ */
+std::vector<std::unique_ptr<cudf::column>> create_keys(cudf::size_type num_rows,
+                                                       int64_t cardinality,
+                                                       key_kind kind,
+                                                       double skew,
+                                                       double null_ratio)
+{
+  std::mt19937 engine{13377331};
+  zipf_generator group(cardinality, skew);
+  std::bernoulli_distribution is_null(null_ratio);
+  // Scatter the group indices so that the most frequent keys are not the smallest ones
+  std::vector<int64_t> keys(num_rows);
+  std::vector<bool> validity(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    keys[i]     = (group(engine) * 2654435761ll) % (cardinality * 16);
+    validity[i] = !is_null(engine);
+  }
+
+  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  if (kind == key_kind::MULTI) {
+    std::vector<int64_t> high(num_rows);
+    std::vector<int64_t> low(num_rows);
+    for (cudf::size_type i = 0; i < num_rows; ++i) {
+      high[i] = keys[i] >> 4;
+      low[i]  = keys[i] & 15;
+    }
+    columns.push_back(wrapper(high.begin(), high.end(), validity.begin()).release());
+    columns.push_back(wrapper(low.begin(), low.end(), validity.begin()).release());
+  } else {
+    columns.push_back(wrapper(keys.begin(), keys.end(), validity.begin()).release());
+    if (kind == key_kind::STRING) {
+      columns.front() = cudf::strings::from_integers(columns.front()->view());
+    }
+  }
+  return columns;
+}
+
+}  // namespace
+
+/**
+ * @brief Aggregates a double column grouped by skewed keys
+ *
+ * `compound` requests mean, variance and standard deviation, which are computed from sum, count
+ * and sum of squares, rather than a single sum. The sort path is forced by adding an
+ * `nth_element` aggregation, which the hash groupby does not support; it only gathers one value
+ * per group on top of the sort-based aggregations.
+ */
+void BM_groupby_skew(benchmark::State& state,
+                     key_kind kind,
+                     double skew,
+                     double null_ratio,
+                     groupby_path path,
+                     bool compound)
+{
+  auto const num_rows    = static_cast<cudf::size_type>(state.range(0));
+  auto const cardinality = static_cast<int64_t>(state.range(1));
+  auto const keys        = create_keys(num_rows, cardinality, kind, skew, null_ratio);
+
+  std::vector<cudf::column_view> key_views;
+  for (auto const& key : keys) { key_views.push_back(key->view()); }
+  cudf::table_view const keys_table(key_views);
+
+  auto values_it = cudf::test::make_counting_transform_iterator(
+    0, [](cudf::size_type row) { return static_cast<double>(row % 1000); });
+  cudf::test::fixed_width_column_wrapper<double> values(values_it, values_it + num_rows);
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  if (compound) {
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation());
+    requests[0].aggregations.push_back(cudf::make_variance_aggregation());
+    requests[0].aggregations.push_back(cudf::make_std_aggregation());
+  } else {
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  }
+  if (path == groupby_path::SORT) {
+    requests[0].aggregations.push_back(cudf::make_nth_element_aggregation(0));
+  }
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+
+    // A new groupby object each time so that no sort order or hash table is reused
+    cudf::groupby::groupby gb_obj(keys_table);
+    auto result = gb_obj.aggregate(requests);
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+static void skew_args(benchmark::internal::Benchmark* b)
+{
+  for (int cardinality : {100, 100'000}) {
+    for (int rows : {1'000'000, 10'000'000}) { b->Args({rows, cardinality}); }
+  }
+}
+
+#define GROUPBY_SKEW_BENCHMARK_DEFINE(name, kind, skew, nulls, path, compound)        \
+  BENCHMARK_DEFINE_F(GroupbySkew, name)                                               \
+  (::benchmark::State & st)                                                           \
+  {                                                                                   \
+    BM_groupby_skew(st, key_kind::kind, skew, nulls, groupby_path::path, compound);   \
+  }                                                                                   \
+  BENCHMARK_REGISTER_F(GroupbySkew, name)                                             \
+    ->Apply(skew_args)                                                                \
+    ->UseManualTime()                                                                 \
+    ->Unit(benchmark::kMillisecond);
+
+// Uniform against Zipfian keys on both paths
+GROUPBY_SKEW_BENCHMARK_DEFINE(hash_uniform, SINGLE, 0, 0, HASH, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(sort_uniform, SINGLE, 0, 0, SORT, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(hash_zipf, SINGLE, 0.99, 0, HASH, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(sort_zipf, SINGLE, 0.99, 0, SORT, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(hash_zipf_1_5, SINGLE, 1.5, 0, HASH, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(sort_zipf_1_5, SINGLE, 1.5, 0, SORT, false)
+
+// Compound aggregations
+GROUPBY_SKEW_BENCHMARK_DEFINE(hash_compound, SINGLE, 0.99, 0, HASH, true)
+GROUPBY_SKEW_BENCHMARK_DEFINE(sort_compound, SINGLE, 0.99, 0, SORT, true)
+
+// Multi-column, string and nullable keys
+GROUPBY_SKEW_BENCHMARK_DEFINE(hash_multi_key, MULTI, 0.99, 0, HASH, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(sort_multi_key, MULTI, 0.99, 0, SORT, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(hash_string_key, STRING, 0.99, 0, HASH, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(sort_string_key, STRING, 0.99, 0, SORT, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(hash_nulls, SINGLE, 0.99, 0.1, HASH, false)
+GROUPBY_SKEW_BENCHMARK_DEFINE(sort_nulls, SINGLE, 0.99, 0.1, SORT, false)
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class AvroRead : public cudf::benchmark {
+};
+
+void AVRO_read(benchmark::State& state)
+{
+  auto const tbl = create_random_table({get_type(state)}, num_cols, data_size, get_profile(state));
+
+  auto const encoded = encode_avro(tbl->view());
+
+  cudf_io::read_avro_args read_args{cudf_io::source_info(encoded.data(), encoded.size())};
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_avro(read_args);
+  }
+
+  set_io_counters(state, data_size, encoded.size());
+}
+
+BENCHMARK_DEFINE_F(AvroRead, Profiles)(::benchmark::State& state) { AVRO_read(state); }
+BENCHMARK_REGISTER_F(AvroRead, Profiles)
+  ->Apply(text_format_args)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
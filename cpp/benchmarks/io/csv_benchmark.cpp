@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class CsvRead : public cudf::benchmark {
+};
+class CsvWrite : public cudf::benchmark {
+};
+
+namespace {
+constexpr int csv_rows_per_chunk = 1 << 20;
+
+std::vector<char> encode_csv(cudf::table_view const& view)
+{
+  std::vector<char> encoded;
+  cudf_io::write_csv_args write_args{
+    cudf_io::sink_info(&encoded), view, "null", true, csv_rows_per_chunk};
+  cudf_io::write_csv(write_args);
+  return encoded;
+}
+
+}  // namespace
+
+void CSV_read(benchmark::State& state)
+{
+  auto const tbl = create_random_table({get_type(state)}, num_cols, data_size, get_profile(state));
+
+  auto const encoded = encode_csv(tbl->view());
+
+  cudf_io::read_csv_args read_args{cudf_io::source_info(encoded.data(), encoded.size())};
+  read_args.na_values = {"null"};
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_csv(read_args);
+  }
+
+  set_io_counters(state, data_size, encoded.size());
+}
+
+void CSV_write(benchmark::State& state)
+{
+  auto const tbl  = create_random_table({get_type(state)}, num_cols, data_size, get_profile(state));
+  auto const view = tbl->view();
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::write_csv_args write_args{
+      cudf_io::sink_info(), view, "null", true, csv_rows_per_chunk};
+    cudf_io::write_csv(write_args);
+  }
+
+  set_io_counters(state, data_size, encode_csv(view).size());
+}
+
+BENCHMARK_DEFINE_F(CsvRead, Profiles)(::benchmark::State& state) { CSV_read(state); }
+BENCHMARK_REGISTER_F(CsvRead, Profiles)
+  ->Apply(text_format_args)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
+
+BENCHMARK_DEFINE_F(CsvWrite, Profiles)(::benchmark::State& state) { CSV_write(state); }
+BENCHMARK_REGISTER_F(CsvWrite, Profiles)
+  ->Apply(text_format_args)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
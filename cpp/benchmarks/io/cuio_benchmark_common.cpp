@@ -0,0 +1,512 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+
+namespace {
+/**
+ * @brief Returns a pseudo-random value derived from `key` (splitmix64 finalizer)
+ */
+uint64_t mix(uint64_t key)
+{
+  key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+  key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+  return key ^ (key >> 31);
+}
+
+template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+T value_from_key(uint64_t key)
+{
+  return mix(key) & 1;
+}
+
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>* = nullptr>
+T value_from_key(uint64_t key)
+{
+  return static_cast<T>(mix(key));
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+T value_from_key(uint64_t key)
+{
+  // Exactly representable values, so that the text formats round-trip them
+  return static_cast<T>(static_cast<int64_t>(mix(key) % 2000000) - 1000000) / 64;
+}
+
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+T value_from_key(uint64_t key)
+{
+  return T{typename T::duration{static_cast<typename T::rep>(mix(key) % (1u << 30))}};
+}
+
+/**
+ * @brief Returns a lowercase string of 0 to `2 * avg_length` characters derived from `key`
+ */
+std::string string_from_key(uint64_t key, cudf::size_type avg_length)
+{
+  auto hash         = mix(key);
+  auto const length = hash % (2 * static_cast<uint64_t>(avg_length) + 1);
+  std::string str(length, 'a');
+  for (size_t i = 0; i < length; ++i) {
+    if (i % 12 == 0) { hash = mix(hash); }
+    str[i] = static_cast<char>('a' + ((hash >> (5 * (i % 12))) & 31) % 26);
+  }
+  return str;
+}
+
+/**
+ * @brief Creates a column of a given type from the keys of its elements
+ */
+struct random_column_generator {
+  template <typename T,
+            std::enable_if_t<cudf::is_numeric<T>() || cudf::is_timestamp<T>()>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(std::vector<uint64_t> const& keys,
+                                           std::vector<bool> const& valids,
+                                           data_profile const&)
+  {
+    std::vector<T> values(keys.size());
+    std::transform(keys.begin(), keys.end(), values.begin(), value_from_key<T>);
+    if (valids.empty()) {
+      return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end()).release();
+    }
+    return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end(), valids.begin())
+      .release();
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::string_view>::value>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(std::vector<uint64_t> const& keys,
+                                           std::vector<bool> const& valids,
+                                           data_profile const& profile)
+  {
+    std::vector<std::string> values(keys.size());
+    std::transform(keys.begin(), keys.end(), values.begin(), [&profile](auto key) {
+      return string_from_key(key, profile.avg_string_length);
+    });
+    if (valids.empty()) {
+      return cudf::test::strings_column_wrapper(values.begin(), values.end()).release();
+    }
+    return cudf::test::strings_column_wrapper(values.begin(), values.end(), valids.begin())
+      .release();
+  }
+
+  template <typename T,
+            std::enable_if_t<!cudf::is_numeric<T>() && !cudf::is_timestamp<T>() &&
+                             !std::is_same<T, cudf::string_view>::value>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(std::vector<uint64_t> const&,
+                                           std::vector<bool> const&,
+                                           data_profile const&)
+  {
+    CUDF_FAIL("Unsupported type for the benchmark data");
+  }
+};
+
+/**
+ * @brief Returns the approximate device memory size of an element
+ */
+size_t element_size(cudf::type_id id, data_profile const& profile)
+{
+  if (id == cudf::type_id::STRING) {
+    return profile.avg_string_length + sizeof(cudf::size_type);
+  }
+  return cudf::size_of(cudf::data_type{id});
+}
+
+/**
+ * @brief Host storage of the elements of type `T`, bytes for booleans
+ */
+template <typename T>
+using host_element = std::conditional_t<std::is_same<T, bool>::value, uint8_t, T>;
+
+/**
+ * @brief Copies the elements of a fixed-width column to the host
+ */
+template <typename T>
+std::shared_ptr<std::vector<host_element<T>>> host_values(cudf::column_view const& col)
+{
+  auto values = std::make_shared<std::vector<host_element<T>>>(col.size());
+  CUDA_TRY(cudaMemcpy(values->data(),
+                      col.data<host_element<T>>(),
+                      col.size() * sizeof(host_element<T>),
+                      cudaMemcpyDeviceToHost));
+  return values;
+}
+
+/**
+ * @brief Copies the elements of a strings column to the host
+ */
+std::shared_ptr<std::vector<std::string>> host_strings(cudf::column_view const& col)
+{
+  cudf::strings_column_view const strings(col);
+  auto const offsets = host_values<int32_t>(strings.offsets());
+  auto const chars   = host_values<char>(strings.chars());
+  auto values        = std::make_shared<std::vector<std::string>>(col.size());
+  for (cudf::size_type i = 0; i < col.size(); ++i) {
+    auto const begin = (*offsets)[col.offset() + i];
+    auto const end   = (*offsets)[col.offset() + i + 1];
+    (*values)[i]     = std::string(chars->data() + begin, end - begin);
+  }
+  return values;
+}
+
+/**
+ * @brief Appends the text of element `row` of a column to a JSON record
+ */
+using json_printer = std::function<void(cudf::size_type row, std::string& out)>;
+
+/**
+ * @brief Appends the Avro binary encoding of element `row` of a column
+ */
+using avro_encoder = std::function<void(cudf::size_type row, std::vector<char>& out)>;
+
+/**
+ * @brief Returns a function telling whether an element of `col` is valid, from host copies of
+ * its null mask
+ */
+std::function<bool(cudf::size_type)> host_validity(cudf::column_view const& col)
+{
+  if (!col.nullable()) {
+    return [](cudf::size_type) { return true; };
+  }
+  auto mask = std::make_shared<std::vector<cudf::bitmask_type>>(
+    cudf::num_bitmask_words(col.offset() + col.size()));
+  CUDA_TRY(cudaMemcpy(mask->data(),
+                      col.null_mask(),
+                      mask->size() * sizeof(cudf::bitmask_type),
+                      cudaMemcpyDeviceToHost));
+  auto const offset = col.offset();
+  return [mask, offset](cudf::size_type row) {
+    return cudf::bit_is_set(mask->data(), offset + row);
+  };
+}
+
+void append_varint(int64_t value, std::vector<char>& out)
+{
+  // Zigzag encoding
+  auto bits = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (bits >= 0x80) {
+    out.push_back(static_cast<char>((bits & 0x7f) | 0x80));
+    bits >>= 7;
+  }
+  out.push_back(static_cast<char>(bits));
+}
+
+void append_avro_string(std::string const& str, std::vector<char>& out)
+{
+  append_varint(str.size(), out);
+  out.insert(out.end(), str.begin(), str.end());
+}
+
+struct json_printer_factory {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  json_printer operator()(cudf::column_view const& col)
+  {
+    auto const values = host_values<T>(col);
+    return [values](cudf::size_type row, std::string& out) {
+      auto const value = (*values)[row];
+      if (std::is_same<T, bool>::value) {
+        out += value ? "true" : "false";
+      } else if (std::is_floating_point<T>::value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(value));
+        out += buffer;
+      } else {
+        out += std::to_string(value);
+      }
+    };
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::string_view>::value>* = nullptr>
+  json_printer operator()(cudf::column_view const& col)
+  {
+    auto const values = host_strings(col);
+    return [values](cudf::size_type row, std::string& out) {
+      out += '"';
+      out += (*values)[row];
+      out += '"';
+    };
+  }
+
+  template <typename T,
+            std::enable_if_t<!cudf::is_numeric<T>() &&
+                             !std::is_same<T, cudf::string_view>::value>* = nullptr>
+  json_printer operator()(cudf::column_view const&)
+  {
+    CUDF_FAIL("Unsupported type for the JSON benchmark data");
+  }
+};
+
+struct avro_encoder_factory {
+  /**
+   * @brief Returns the name of the Avro type of `T` and the encoder of the column
+   */
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  std::pair<std::string, avro_encoder> operator()(cudf::column_view const& col)
+  {
+    CUDF_EXPECTS((std::is_same<T, bool>::value || std::is_same<T, int32_t>::value ||
+                  std::is_same<T, int64_t>::value || std::is_floating_point<T>::value),
+                 "Unsupported type for the Avro benchmark data");
+    auto const values = host_values<T>(col);
+    std::string const type = std::is_same<T, bool>::value      ? "boolean"
+                             : std::is_same<T, int32_t>::value ? "int"
+                             : std::is_same<T, int64_t>::value ? "long"
+                             : std::is_same<T, float>::value   ? "float"
+                                                               : "double";
+    return {type, [values](cudf::size_type row, std::vector<char>& out) {
+              auto const value = (*values)[row];
+              if (std::is_floating_point<T>::value) {
+                // Little-endian IEEE 754
+                char bytes[sizeof(T)];
+                std::memcpy(bytes, &value, sizeof(T));
+                out.insert(out.end(), bytes, bytes + sizeof(T));
+              } else if (std::is_same<T, bool>::value) {
+                out.push_back(value ? 1 : 0);
+              } else {
+                append_varint(static_cast<int64_t>(value), out);
+              }
+            }};
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::string_view>::value>* = nullptr>
+  std::pair<std::string, avro_encoder> operator()(cudf::column_view const& col)
+  {
+    auto const values = host_strings(col);
+    return {"string", [values](cudf::size_type row, std::vector<char>& out) {
+              append_avro_string((*values)[row], out);
+            }};
+  }
+
+  template <typename T,
+            std::enable_if_t<!cudf::is_numeric<T>() &&
+                             !std::is_same<T, cudf::string_view>::value>* = nullptr>
+  std::pair<std::string, avro_encoder> operator()(cudf::column_view const&)
+  {
+    CUDF_FAIL("Unsupported type for the Avro benchmark data");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> const& types,
+                                                 cudf::size_type num_columns,
+                                                 size_t table_bytes,
+                                                 data_profile const& profile)
+{
+  CUDF_EXPECTS(!types.empty() && num_columns > 0, "No column to generate");
+  size_t row_bytes = 0;
+  for (cudf::size_type i = 0; i < num_columns; ++i) {
+    row_bytes += element_size(types[i % types.size()], profile);
+  }
+  auto const num_rows = static_cast<cudf::size_type>(std::max<size_t>(table_bytes / row_bytes, 1));
+
+  std::mt19937_64 engine{31337};
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (cudf::size_type i = 0; i < num_columns; ++i) {
+    // Keys select the distinct values, salted per column
+    std::vector<uint64_t> keys(num_rows);
+    if (profile.cardinality > 0) {
+      std::uniform_int_distribution<uint64_t> dist(0, profile.cardinality - 1);
+      std::generate(keys.begin(), keys.end(), [&]() { return dist(engine); });
+    } else {
+      std::iota(keys.begin(), keys.end(), 0);
+    }
+    auto const salt = static_cast<uint64_t>(i) << 40;
+    std::transform(keys.begin(), keys.end(), keys.begin(), [salt](auto key) { return key + salt; });
+
+    std::vector<bool> valids;
+    if (profile.null_probability > 0) {
+      std::bernoulli_distribution is_valid(1 - profile.null_probability);
+      valids.resize(num_rows);
+      std::generate(valids.begin(), valids.end(), [&]() { return is_valid(engine); });
+    }
+    columns.push_back(cudf::type_dispatcher(cudf::data_type{types[i % types.size()]},
+                                            random_column_generator{},
+                                            keys,
+                                            valids,
+                                            profile));
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+std::vector<char> encode_json_lines(cudf::table_view const& table)
+{
+  std::vector<json_printer> printers;
+  std::vector<std::function<bool(cudf::size_type)>> validity;
+  for (auto const& col : table) {
+    printers.push_back(cudf::type_dispatcher(col.type(), json_printer_factory{}, col));
+    validity.push_back(host_validity(col));
+  }
+
+  std::vector<char> out;
+  std::string record;
+  for (cudf::size_type row = 0; row < table.num_rows(); ++row) {
+    record = "{";
+    for (size_t c = 0; c < printers.size(); ++c) {
+      if (c > 0) { record += ','; }
+      record += "\"c" + std::to_string(c) + "\":";
+      if (validity[c](row)) {
+        printers[c](row, record);
+      } else {
+        record += "null";
+      }
+    }
+    record += "}\n";
+    out.insert(out.end(), record.begin(), record.end());
+  }
+  return out;
+}
+
+std::vector<char> encode_avro(cudf::table_view const& table)
+{
+  constexpr cudf::size_type rows_per_block = 64 * 1024;
+
+  std::vector<avro_encoder> encoders;
+  std::vector<std::function<bool(cudf::size_type)>> validity;
+  std::string schema = R"({"type":"record","name":"benchmark","fields":[)";
+  for (auto const& col : table) {
+    auto type_and_encoder = cudf::type_dispatcher(col.type(), avro_encoder_factory{}, col);
+    if (!encoders.empty()) { schema += ','; }
+    schema += R"({"name":"c)" + std::to_string(encoders.size()) + R"(","type":["null",")" +
+              type_and_encoder.first + R"("]})";
+    encoders.push_back(std::move(type_and_encoder.second));
+    validity.push_back(host_validity(col));
+  }
+  schema += "]}";
+
+  std::vector<char> out{'O', 'b', 'j', 1};
+  append_varint(2, out);
+  append_avro_string("avro.codec", out);
+  append_avro_string("null", out);
+  append_avro_string("avro.schema", out);
+  append_avro_string(schema, out);
+  append_varint(0, out);
+  std::string const sync_marker = "cudf-benchmark-1";  // 16 bytes
+  out.insert(out.end(), sync_marker.begin(), sync_marker.end());
+
+  std::vector<char> block;
+  for (cudf::size_type begin = 0; begin < table.num_rows(); begin += rows_per_block) {
+    auto const end = std::min(begin + rows_per_block, table.num_rows());
+    block.clear();
+    for (auto row = begin; row < end; ++row) {
+      for (size_t c = 0; c < encoders.size(); ++c) {
+        // Union branch 0 is null, branch 1 the value
+        if (validity[c](row)) {
+          append_varint(1, block);
+          encoders[c](row, block);
+        } else {
+          append_varint(0, block);
+        }
+      }
+    }
+    append_varint(end - begin, out);
+    append_varint(block.size(), out);
+    out.insert(out.end(), block.begin(), block.end());
+    out.insert(out.end(), sync_marker.begin(), sync_marker.end());
+  }
+  return out;
+}
+
+namespace {
+void add_format_args(benchmark::internal::Benchmark* b,
+                     std::vector<cudf::type_id> const& types,
+                     std::vector<int64_t> const& compressions)
+{
+  for (auto const type : types) {
+    for (int64_t const cardinality : {0, 1000}) {
+      for (auto const compression : compressions) {
+        b->Args({static_cast<int64_t>(type), cardinality, 10, 16, compression});
+      }
+    }
+  }
+  // Null density and string length sweeps
+  for (int64_t const null_percent : {0, 50}) {
+    b->Args({static_cast<int64_t>(cudf::type_id::INT64), 0, null_percent, 16, compressions.back()});
+  }
+  for (int64_t const length : {4, 128}) {
+    b->Args({static_cast<int64_t>(cudf::type_id::STRING), 0, 10, length, compressions.back()});
+  }
+}
+
+}  // namespace
+
+void binary_format_args(benchmark::internal::Benchmark* b)
+{
+  add_format_args(b,
+                  {cudf::type_id::BOOL8,
+                   cudf::type_id::INT32,
+                   cudf::type_id::INT64,
+                   cudf::type_id::FLOAT64,
+                   cudf::type_id::TIMESTAMP_MILLISECONDS,
+                   cudf::type_id::STRING},
+                  {0, 1});
+}
+
+void text_format_args(benchmark::internal::Benchmark* b)
+{
+  add_format_args(b,
+                  {cudf::type_id::BOOL8,
+                   cudf::type_id::INT32,
+                   cudf::type_id::INT64,
+                   cudf::type_id::FLOAT64,
+                   cudf::type_id::STRING},
+                  {0});
+}
+
+cudf::type_id get_type(benchmark::State const& state)
+{
+  return static_cast<cudf::type_id>(state.range(0));
+}
+
+data_profile get_profile(benchmark::State const& state)
+{
+  data_profile profile;
+  profile.cardinality       = state.range(1);
+  profile.null_probability  = state.range(2) / 100.0;
+  profile.avg_string_length = state.range(3);
+  return profile;
+}
+
+cudf_io::compression_type get_compression(benchmark::State const& state)
+{
+  return state.range(4) == 0 ? cudf_io::compression_type::NONE
+                             : cudf_io::compression_type::SNAPPY;
+}
+
+void set_io_counters(benchmark::State& state, size_t table_bytes, size_t encoded_bytes)
+{
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * table_bytes);
+  state.counters["encoded_file_size"] = encoded_bytes;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+/**
+ * @brief Size of the synthetic tables used by the IO benchmarks, in bytes of device memory
+ */
+constexpr size_t data_size = 512 << 20;
+
+/**
+ * @brief Number of columns of the synthetic tables used by the IO benchmarks
+ */
+constexpr cudf::size_type num_cols = 64;
+
+/**
+ * @brief Parameters of the synthetic data
+ */
+struct data_profile {
+  cudf::size_type cardinality       = 0;     ///< Distinct values per column; 0 for all unique
+  double null_probability           = 0.01;  ///< Probability of a null; 0 for no null mask
+  cudf::size_type avg_string_length = 16;    ///< Mean length of the strings
+};
+
+/**
+ * @brief Returns a table of pseudo-random values of roughly `table_bytes` bytes.
+ *
+ * The columns cycle through `types`. The values are reproducible from one run to the next.
+ * Supported types are booleans, integers, floating point, timestamps and strings.
+ *
+ * @param types Types of the columns
+ * @param num_columns Number of columns
+ * @param table_bytes Approximate size of the table in device memory
+ * @param profile Cardinality, null density and string lengths of the values
+ */
+std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> const& types,
+                                                 cudf::size_type num_columns,
+                                                 size_t table_bytes,
+                                                 data_profile const& profile = {});
+
+/**
+ * @brief Encodes a table as JSON lines with the columns named `c0`, `c1`, etc.
+ *
+ * Null elements are written as `null`. Strings are not escaped, which is valid for
+ * the generated strings.
+ */
+std::vector<char> encode_json_lines(cudf::table_view const& table);
+
+/**
+ * @brief Encodes a table as an uncompressed Avro object container file with the columns named
+ * `c0`, `c1`, etc.
+ *
+ * Supports booleans, 32 and 64-bit integers, floating point and strings, as nullable unions.
+ */
+std::vector<char> encode_avro(cudf::table_view const& table);
+
+/**
+ * @brief Registers the arguments of the benchmarks of the binary formats.
+ *
+ * The arguments are the type id of the columns, the cardinality, the percentage of nulls, the
+ * average string length and the compression (0 for none, 1 for Snappy), over all the supported
+ * types.
+ */
+void binary_format_args(benchmark::internal::Benchmark* b);
+
+/**
+ * @brief Registers the arguments of the benchmarks of the text formats and Avro.
+ *
+ * Same arguments as `binary_format_args`, over the types all the text formats support and
+ * without compression.
+ */
+void text_format_args(benchmark::internal::Benchmark* b);
+
+/**
+ * @brief Returns the column type selected by the arguments of a benchmark
+ */
+cudf::type_id get_type(benchmark::State const& state);
+
+/**
+ * @brief Returns the data profile selected by the arguments of a benchmark
+ */
+data_profile get_profile(benchmark::State const& state);
+
+/**
+ * @brief Returns the compression selected by the arguments of a benchmark
+ */
+cudf_io::compression_type get_compression(benchmark::State const& state);
+
+/**
+ * @brief Reports the throughput of a benchmark from the size of the table in device memory
+ * and the size of its encoded form.
+ */
+void set_io_counters(benchmark::State& state, size_t table_bytes, size_t encoded_bytes);
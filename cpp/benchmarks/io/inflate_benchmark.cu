@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <io/comp/gpuinflate.h>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <rmm/device_buffer.hpp>
+
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class Inflate : public cudf::benchmark {
+};
+
+/**
+ * @brief Compresses the input into a raw DEFLATE stream
+ **/
+std::vector<uint8_t> deflate_raw(const uint8_t* input, size_t size)
+{
+  z_stream strm{};
+  deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+  std::vector<uint8_t> output(deflateBound(&strm, size));
+  strm.next_in   = const_cast<Bytef*>(input);
+  strm.avail_in  = size;
+  strm.next_out  = output.data();
+  strm.avail_out = output.size();
+  deflate(&strm, Z_FINISH);
+  output.resize(strm.total_out);
+  deflateEnd(&strm);
+  return output;
+}
+
+/**
+ * @brief Decompresses a batch of blocks of two sizes
+ *
+ * Each block is a large block with probability large_percent, a small block otherwise.
+ **/
+void BM_inflate(benchmark::State& state)
+{
+  constexpr size_t total_size = 64 << 20;
+  const size_t small_size     = state.range(0);
+  const size_t large_size     = state.range(1);
+  const int large_percent     = state.range(2);
+
+  // Rows of random digits, compressing to about half their size
+  srand(31337);
+  std::string text;
+  while (text.size() < total_size) {
+    text += std::to_string(rand() % 1000000) + "," + std::to_string(rand() % 100) + "\n";
+  }
+  std::vector<size_t> block_offsets{0};
+  while (block_offsets.back() < total_size) {
+    const size_t size = (rand() % 100 < large_percent) ? large_size : small_size;
+    block_offsets.push_back(std::min(block_offsets.back() + size, total_size));
+  }
+  const size_t num_blocks = block_offsets.size() - 1;
+
+  std::vector<uint8_t> h_compressed;
+  std::vector<size_t> comp_offsets{0};
+  for (size_t i = 0; i < num_blocks; i++) {
+    auto block = deflate_raw(reinterpret_cast<const uint8_t*>(text.data()) + block_offsets[i],
+                             block_offsets[i + 1] - block_offsets[i]);
+    h_compressed.insert(h_compressed.end(), block.begin(), block.end());
+    comp_offsets.push_back(h_compressed.size());
+  }
+
+  rmm::device_buffer compressed(h_compressed.data(), h_compressed.size());
+  rmm::device_buffer uncompressed(total_size);
+  std::vector<cudf::io::gpu_inflate_input_s> h_inputs(num_blocks);
+  for (size_t i = 0; i < num_blocks; i++) {
+    h_inputs[i].srcDevice = static_cast<const uint8_t*>(compressed.data()) + comp_offsets[i];
+    h_inputs[i].srcSize   = comp_offsets[i + 1] - comp_offsets[i];
+    h_inputs[i].dstDevice = static_cast<uint8_t*>(uncompressed.data()) + block_offsets[i];
+    h_inputs[i].dstSize   = block_offsets[i + 1] - block_offsets[i];
+  }
+  rmm::device_vector<cudf::io::gpu_inflate_input_s> inputs(h_inputs);
+  rmm::device_vector<cudf::io::gpu_inflate_status_s> statuses(num_blocks);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::io::gpuinflate(inputs.data().get(), statuses.data().get(), num_blocks, 0, 0);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * total_size);
+}
+
+#define INFLATE_BENCHMARK_DEFINE(name, small_size, large_size, large_percent)          \
+  BENCHMARK_DEFINE_F(Inflate, name)(::benchmark::State & state) { BM_inflate(state); } \
+  BENCHMARK_REGISTER_F(Inflate, name)                                                  \
+    ->Args({small_size, large_size, large_percent})                                    \
+    ->Unit(benchmark::kMillisecond)                                                    \
+    ->UseManualTime()
+
+INFLATE_BENCHMARK_DEFINE(Blocks4KB, 4 << 10, 4 << 10, 0);
+INFLATE_BENCHMARK_DEFINE(Blocks64KB, 64 << 10, 64 << 10, 0);
+INFLATE_BENCHMARK_DEFINE(Blocks256KB, 256 << 10, 256 << 10, 0);
+INFLATE_BENCHMARK_DEFINE(Blocks1MB, 1 << 20, 1 << 20, 0);
+INFLATE_BENCHMARK_DEFINE(Blocks4KB_1MB_1Pct, 4 << 10, 1 << 20, 1);
+INFLATE_BENCHMARK_DEFINE(Blocks64KB_1MB_10Pct, 64 << 10, 1 << 20, 10);
+INFLATE_BENCHMARK_DEFINE(Blocks256KB_1MB_50Pct, 256 << 10, 1 << 20, 50);
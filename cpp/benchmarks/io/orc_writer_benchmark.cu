@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class OrcWrite : public cudf::benchmark {
+};
+
+template <typename T>
+void ORC_write(benchmark::State& state)
+{
+  int64_t total_desired_bytes = state.range(0);
+  cudf::size_type num_cols    = state.range(1);
+
+  // Strings of 8 characters on average, half of the columns with 1000 distinct values to use
+  // both dictionary and direct encoding
+  auto const dict_cols   = num_cols / 2;
+  auto const direct_cols = num_cols - dict_cols;
+  auto const col_bytes   = total_desired_bytes / num_cols;
+  auto dict_tbl          = create_random_table(
+    {cudf::type_to_id<T>()}, dict_cols, col_bytes * dict_cols, data_profile{1000, 0.5, 8});
+  auto direct_tbl = create_random_table(
+    {cudf::type_to_id<T>()}, direct_cols, col_bytes * direct_cols, data_profile{0, 0.5, 8});
+
+  auto columns = dict_tbl->release();
+  for (auto& col : direct_tbl->release()) { columns.push_back(std::move(col)); }
+  auto tbl              = std::make_unique<cudf::table>(std::move(columns));
+  cudf::table_view view = tbl->view();
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::write_orc_args args{cudf_io::sink_info(), view};
+    cudf_io::write_orc(args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void ORC_write_profile(benchmark::State& state)
+{
+  auto const tbl  = create_random_table({get_type(state)}, num_cols, data_size, get_profile(state));
+  auto const view = tbl->view();
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::write_orc_args args{cudf_io::sink_info(), view, nullptr, get_compression(state)};
+    cudf_io::write_orc(args);
+  }
+
+  std::vector<char> encoded;
+  cudf_io::write_orc_args args{cudf_io::sink_info(&encoded), view, nullptr, get_compression(state)};
+  cudf_io::write_orc(args);
+  set_io_counters(state, data_size, encoded.size());
+}
+
+#define OWBM_BENCHMARK_DEFINE(name, type, size, num_columns)                                  \
+  BENCHMARK_DEFINE_F(OrcWrite, name)(::benchmark::State & state) { ORC_write<type>(state); } \
+  BENCHMARK_REGISTER_F(OrcWrite, name)                                                        \
+    ->Args({size, num_columns})                                                               \
+    ->Unit(benchmark::kMillisecond)                                                           \
+    ->UseManualTime()                                                                         \
+    ->Iterations(4)
+
+OWBM_BENCHMARK_DEFINE(Bool1Gb8Cols, bool, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(Int8_1Gb8Cols, int8_t, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(Int16_1Gb8Cols, int16_t, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(Int32_1Gb8Cols, int32_t, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(Int64_1Gb8Cols, int64_t, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(Float32_1Gb8Cols, float, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(Float64_1Gb8Cols, double, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(TimestampD1Gb8Cols, cudf::timestamp_D, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(TimestampS1Gb8Cols, cudf::timestamp_s, (int64_t)1 * 1024 * 1024 * 1024, 8);
+OWBM_BENCHMARK_DEFINE(TimestampMs1Gb8Cols,
+                      cudf::timestamp_ms,
+                      (int64_t)1 * 1024 * 1024 * 1024,
+                      8);
+OWBM_BENCHMARK_DEFINE(TimestampNs1Gb8Cols,
+                      cudf::timestamp_ns,
+                      (int64_t)1 * 1024 * 1024 * 1024,
+                      8);
+OWBM_BENCHMARK_DEFINE(String1Gb8Cols, cudf::string_view, (int64_t)1 * 1024 * 1024 * 1024, 8);
+
+BENCHMARK_DEFINE_F(OrcWrite, Profiles)(::benchmark::State& state) { ORC_write_profile(state); }
+BENCHMARK_REGISTER_F(OrcWrite, Profiles)
+  ->Apply(binary_format_args)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
@@ -83,6 +83,23 @@ __global__ static void init_build_tbl(key_type* const build_tbl,
   state[start_idx] = localState;
 }
 
+/**
+ * @brief Maps a uniform random number in (0, 1] to an index in [0, size) drawn from a Zipfian
+ * distribution of exponent `skew`, using the inverse CDF of its continuous approximation.
+ *
+ * Index 0 is the most frequent; a `skew` of 0 gives uniform indices.
+ */
+template <typename size_type>
+__device__ size_type zipf_index(double x, size_type size, double skew)
+{
+  double const rank = (fabs(skew - 1.0) < 1e-9)
+                        ? pow(static_cast<double>(size), x)
+                        : pow((pow(static_cast<double>(size), 1.0 - skew) - 1.0) * x + 1.0,
+                              1.0 / (1.0 - skew));
+  auto const idx = static_cast<size_type>(rank) - 1;
+  return idx < 0 ? 0 : (idx >= size ? size - 1 : idx);
+}
+
 template <typename key_type, typename size_type>
 __global__ void init_probe_tbl(key_type* const probe_tbl,
                                const size_type probe_tbl_size,
@@ -91,6 +108,7 @@ __global__ void init_probe_tbl(key_type* const probe_tbl,
                                const key_type* const lottery,
                                const size_type lottery_size,
                                const double selectivity,
+                               const double skew,
                                curandState* state,
                                const int num_states)
 {
@@ -107,8 +125,9 @@ __global__ void init_probe_tbl(key_type* const probe_tbl,
     if (x <= selectivity) {
       // x <= selectivity means this key in the probe table should be present in the build table, so
       // we pick a key from build_tbl
-      x                       = curand_uniform_double(&localState);
-      size_type build_tbl_idx = x * build_tbl_size;
+      x = curand_uniform_double(&localState);
+      size_type build_tbl_idx = (skew > 0) ? zipf_index(x, build_tbl_size, skew)
+                                           : static_cast<size_type>(x * build_tbl_size);
 
       if (build_tbl_idx >= build_tbl_size) { build_tbl_idx = build_tbl_size - 1; }
 
@@ -139,7 +158,9 @@ __global__ void init_probe_tbl(key_type* const probe_tbl,
  * will be from [0,rand_max] and if uniq_build_tbl_keys is true it is ensured that each value
  * will be uniq in the build table. Each value in the probe table will be also in the build
  * table with a propability of selectivity and a random number from
- * [0,rand_max] \setminus \{build_tbl\} otherwise.
+ * [0,rand_max] \setminus \{build_tbl\} otherwise. If skew is positive, the probe table keys
+ * drawn from the build table follow a Zipfian distribution of that exponent over the build table
+ * rows, so that a few build keys match most of the probe rows.
  *
  * @param[out] build_tbl            The build table to generate. Usually the smaller table used to
  *                                  "build" the hash table in a hash based join implementation.
@@ -152,6 +173,8 @@ __global__ void init_probe_tbl(key_type* const probe_tbl,
  * @param[in] rand_max              maximum random number to generate. I.e. random numbers are
  *                                  integers from [0,rand_max].
  * @param[in] uniq_build_tbl_keys   if each key in the build table should appear exactly once.
+ * @param[in] skew                  exponent of the Zipfian distribution of the matching probe
+ *                                  keys, 0 for uniformly distributed keys.
  */
 template <typename key_type, typename size_type>
 void generate_input_tables(key_type* const build_tbl,
@@ -160,7 +183,8 @@ void generate_input_tables(key_type* const build_tbl,
                            const size_type probe_tbl_size,
                            const double selectivity,
                            const key_type rand_max,
-                           const bool uniq_build_tbl_keys)
+                           const bool uniq_build_tbl_keys,
+                           const double skew = 0)
 {
   // With large values of rand_max the a lot of temporary storage is needed for the lottery. At the
   // expense of not being that accurate with applying the selectivity an especially more memory
@@ -243,6 +267,7 @@ void generate_input_tables(key_type* const build_tbl,
                                                           lottery.data().get(),
                                                           lottery_size,
                                                           selectivity,
+                                                          skew,
                                                           devStates.data().get(),
                                                           num_states);
 
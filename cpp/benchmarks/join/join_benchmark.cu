@@ -18,16 +18,23 @@
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+
 #include <cudf/column/column_factories.hpp>
 #include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
 
+#include <random>
 #include <vector>
 
 #include "generate_input_tables.cuh"
@@ -36,13 +43,69 @@ template <typename key_type, typename payload_type>
 class Join : public cudf::benchmark {
 };
 
+// Shape of the join keys generated from the integer keys of `generate_input_tables`
+enum class key_kind {
+  SINGLE,  ///< the integer key
+  MULTI,   ///< the integer key split in two integer columns
+  STRING   ///< the string representation of the integer key
+};
+
+// Returns a null mask where each row is null with probability `null_ratio`
+rmm::device_buffer random_null_mask(cudf::size_type size, double null_ratio)
+{
+  std::mt19937 engine{13377331};
+  std::bernoulli_distribution is_null(null_ratio);
+  std::vector<cudf::bitmask_type> mask(cudf::num_bitmask_words(size), 0);
+  for (cudf::size_type i = 0; i < size; ++i) {
+    if (!is_null(engine)) { cudf::set_bit_unsafe(mask.data(), i); }
+  }
+  return rmm::device_buffer(mask.data(), mask.size() * sizeof(cudf::bitmask_type));
+}
+
+// Builds the key columns of the requested shape from a generated integer key column
+template <typename key_type>
+std::vector<std::unique_ptr<cudf::column>> make_key_columns(std::unique_ptr<cudf::column> keys,
+                                                             key_kind kind,
+                                                             double null_ratio)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  auto const size = keys->size();
+  if (kind == key_kind::MULTI) {
+    auto const type = keys->type();
+    auto high       = cudf::make_numeric_column(type, size);
+    auto low        = cudf::make_numeric_column(type, size);
+    auto const split = thrust::make_zip_iterator(thrust::make_tuple(
+      high->mutable_view().begin<key_type>(), low->mutable_view().begin<key_type>()));
+    thrust::transform(thrust::device,
+                      keys->view().begin<key_type>(),
+                      keys->view().end<key_type>(),
+                      split,
+                      [] __device__(key_type key) {
+                        return thrust::make_tuple<key_type, key_type>(key >> 4, key & 15);
+                      });
+    columns.push_back(std::move(high));
+    columns.push_back(std::move(low));
+  } else if (kind == key_kind::STRING) {
+    columns.push_back(cudf::strings::from_integers(keys->view()));
+  } else {
+    columns.push_back(std::move(keys));
+  }
+  if (null_ratio > 0) {
+    for (auto& col : columns) { col->set_null_mask(random_null_mask(size, null_ratio)); }
+  }
+  return columns;
+}
+
 template <typename key_type, typename payload_type>
-static void BM_join(benchmark::State &state)
+static void BM_join(benchmark::State &state,
+                    key_kind kind      = key_kind::SINGLE,
+                    double null_ratio  = 0,
+                    double skew        = 0,
+                    double selectivity = 0.3)
 {
   const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
   const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
   const cudf::size_type rand_max_val{build_table_size * 2};
-  const double selectivity             = 0.3;
   const bool is_build_table_key_unique = true;
 
   // Generate build and probe tables
@@ -59,7 +122,11 @@ static void BM_join(benchmark::State &state)
     probe_table_size,
     selectivity,
     rand_max_val,
-    is_build_table_key_unique);
+    is_build_table_key_unique,
+    skew);
+
+  auto build_keys = make_key_columns<key_type>(std::move(build_key_column), kind, null_ratio);
+  auto probe_keys = make_key_columns<key_type>(std::move(probe_key_column), kind, null_ratio);
 
   auto payload_data_it = thrust::make_counting_iterator(0);
   cudf::test::fixed_width_column_wrapper<payload_type> build_payload_column(
@@ -70,27 +137,32 @@ static void BM_join(benchmark::State &state)
 
   CHECK_CUDA(0);
 
-  cudf::table_view build_table({build_key_column->view(), build_payload_column});
-  cudf::table_view probe_table({probe_key_column->view(), probe_payload_column});
-
-  // Setup join parameters and result table
+  std::vector<cudf::column_view> build_columns;
+  std::vector<cudf::column_view> probe_columns;
+  std::vector<cudf::size_type> columns_to_join;
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> columns_in_common;
+  for (size_t i = 0; i < build_keys.size(); ++i) {
+    build_columns.push_back(build_keys[i]->view());
+    probe_columns.push_back(probe_keys[i]->view());
+    columns_to_join.push_back(i);
+    columns_in_common.emplace_back(i, i);
+  }
+  build_columns.push_back(build_payload_column);
+  probe_columns.push_back(probe_payload_column);
 
-  std::vector<cudf::size_type> columns_to_join = {0};
+  cudf::table_view build_table(build_columns);
+  cudf::table_view probe_table(probe_columns);
 
   // Benchmark the inner join operation
 
   for (auto _ : state) {
     cuda_event_timer raii(state, true, 0);
 
-    auto result =
-      cudf::inner_join(probe_table, build_table, columns_to_join, columns_to_join, {{0, 0}});
+    auto result = cudf::inner_join(
+      probe_table, build_table, columns_to_join, columns_to_join, columns_in_common);
   }
 }
 
-#define JOIN_BENCHMARK_DEFINE(name, key_type, payload_type)       \
-  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type) \
-  (::benchmark::State & st) { BM_join<key_type, payload_type>(st); }
-
 JOIN_BENCHMARK_DEFINE(join_32bit, int32_t, int32_t);
 JOIN_BENCHMARK_DEFINE(join_64bit, int64_t, int64_t);
 
@@ -111,3 +183,32 @@ BENCHMARK_REGISTER_F(Join, join_64bit)
   ->Args({50'000'000, 50'000'000})
   ->Args({40'000'000, 120'000'000})
   ->UseManualTime();
+
+// Variants with skewed, multi-column, string and nullable keys, and with a varying match rate
+#define JOIN_VARIANT_BENCHMARK_DEFINE(name, key_type, payload_type, kind, nulls, skew, sel) \
+  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type)                           \
+  (::benchmark::State & st) { BM_join<key_type, payload_type>(st, kind, nulls, skew, sel); }
+
+JOIN_VARIANT_BENCHMARK_DEFINE(join_32bit_zipf, int32_t, int32_t, key_kind::SINGLE, 0, 0.99, 0.3);
+JOIN_VARIANT_BENCHMARK_DEFINE(join_32bit_zipf_1_5, int32_t, int32_t, key_kind::SINGLE, 0, 1.5, 0.3);
+JOIN_VARIANT_BENCHMARK_DEFINE(join_32bit_multi_key, int32_t, int32_t, key_kind::MULTI, 0, 0, 0.3);
+JOIN_VARIANT_BENCHMARK_DEFINE(join_32bit_string_key, int32_t, int32_t, key_kind::STRING, 0, 0, 0.3);
+JOIN_VARIANT_BENCHMARK_DEFINE(join_32bit_nulls, int32_t, int32_t, key_kind::SINGLE, 0.1, 0, 0.3);
+JOIN_VARIANT_BENCHMARK_DEFINE(join_32bit_match_all, int32_t, int32_t, key_kind::SINGLE, 0, 0, 1.0);
+JOIN_VARIANT_BENCHMARK_DEFINE(join_32bit_match_few, int32_t, int32_t, key_kind::SINGLE, 0, 0, 0.01);
+
+#define JOIN_VARIANT_BENCHMARK_REGISTER(name) \
+  BENCHMARK_REGISTER_F(Join, name)            \
+    ->Unit(benchmark::kMillisecond)           \
+    ->Args({100'000, 1'000'000})              \
+    ->Args({10'000'000, 10'000'000})          \
+    ->Args({10'000'000, 40'000'000})          \
+    ->UseManualTime();
+
+JOIN_VARIANT_BENCHMARK_REGISTER(join_32bit_zipf)
+JOIN_VARIANT_BENCHMARK_REGISTER(join_32bit_zipf_1_5)
+JOIN_VARIANT_BENCHMARK_REGISTER(join_32bit_multi_key)
+JOIN_VARIANT_BENCHMARK_REGISTER(join_32bit_string_key)
+JOIN_VARIANT_BENCHMARK_REGISTER(join_32bit_nulls)
+JOIN_VARIANT_BENCHMARK_REGISTER(join_32bit_match_all)
+JOIN_VARIANT_BENCHMARK_REGISTER(join_32bit_match_few)
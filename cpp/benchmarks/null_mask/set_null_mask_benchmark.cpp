@@ -18,8 +18,11 @@
 #include "../fixture/benchmark_fixture.hpp"
 #include "../synchronization/synchronization.hpp"
 
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/null_mask.hpp>
 
+#include <vector>
+
 class SetNullmask : public cudf::benchmark {
 };
 
@@ -44,4 +47,98 @@ void BM_setnullmask(benchmark::State& state)
     ->Range(1 << 10, 1 << 30)                                                                  \
     ->UseManualTime();
 
-NBM_BENCHMARK_DEFINE(SetNullMaskKernel);
\ No newline at end of file
+NBM_BENCHMARK_DEFINE(SetNullMaskKernel);
+
+// Masks are read from an unaligned bit offset to exercise the word shifts
+constexpr cudf::size_type mask_offset{5};
+
+void BM_bitmask_binop(benchmark::State& state, bool is_and)
+{
+  const cudf::size_type size{(cudf::size_type)state.range(0)};
+  const cudf::size_type num_masks{(cudf::size_type)state.range(1)};
+  std::vector<rmm::device_buffer> buffers;
+  std::vector<cudf::bitmask_type const*> masks;
+  for (cudf::size_type i = 0; i < num_masks; ++i) {
+    buffers.push_back(cudf::create_null_mask(size + mask_offset, cudf::mask_state::ALL_VALID));
+    masks.push_back(static_cast<cudf::bitmask_type const*>(buffers.back().data()));
+  }
+  std::vector<cudf::size_type> begin_bits(num_masks, mask_offset);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto result = is_and ? cudf::detail::bitmask_and(
+                             masks, begin_bits, size, 0, rmm::mr::get_default_resource())
+                         : cudf::detail::bitmask_or(
+                             masks, begin_bits, size, 0, rmm::mr::get_default_resource());
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * size / 8 * (num_masks + 1));
+}
+
+void BM_count_set_bits(benchmark::State& state)
+{
+  const cudf::size_type size{(cudf::size_type)state.range(0)};
+  rmm::device_buffer mask = cudf::create_null_mask(size + mask_offset, cudf::mask_state::ALL_VALID);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    cudf::count_set_bits(
+      static_cast<cudf::bitmask_type const*>(mask.data()), mask_offset, size + mask_offset);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * size / 8);
+}
+
+void BM_copy_offset_bitmask(benchmark::State& state)
+{
+  const cudf::size_type size{(cudf::size_type)state.range(0)};
+  rmm::device_buffer mask = cudf::create_null_mask(size + mask_offset, cudf::mask_state::ALL_VALID);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    cudf::copy_bitmask(
+      static_cast<cudf::bitmask_type const*>(mask.data()), mask_offset, size + mask_offset);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * size / 8 * 2);
+}
+
+BENCHMARK_DEFINE_F(SetNullmask, BitmaskAnd)(::benchmark::State& state)
+{
+  BM_bitmask_binop(state, true);
+}
+BENCHMARK_REGISTER_F(SetNullmask, BitmaskAnd)
+  ->Args({1 << 10, 2})
+  ->Args({1 << 20, 2})
+  ->Args({1 << 30, 2})
+  ->Args({1 << 20, 8})
+  ->UseManualTime();
+
+BENCHMARK_DEFINE_F(SetNullmask, BitmaskOr)(::benchmark::State& state)
+{
+  BM_bitmask_binop(state, false);
+}
+BENCHMARK_REGISTER_F(SetNullmask, BitmaskOr)
+  ->Args({1 << 10, 2})
+  ->Args({1 << 20, 2})
+  ->Args({1 << 30, 2})
+  ->Args({1 << 20, 8})
+  ->UseManualTime();
+
+BENCHMARK_DEFINE_F(SetNullmask, CountSetBits)(::benchmark::State& state)
+{
+  BM_count_set_bits(state);
+}
+BENCHMARK_REGISTER_F(SetNullmask, CountSetBits)
+  ->RangeMultiplier(1 << 10)
+  ->Range(1 << 10, 1 << 30)
+  ->UseManualTime();
+
+BENCHMARK_DEFINE_F(SetNullmask, CopyOffsetBitmask)(::benchmark::State& state)
+{
+  BM_copy_offset_bitmask(state);
+}
+BENCHMARK_REGISTER_F(SetNullmask, CopyOffsetBitmask)
+  ->RangeMultiplier(1 << 10)
+  ->Range(1 << 10, 1 << 30)
+  ->UseManualTime();
\ No newline at end of file
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_generator.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <random>
+#include <vector>
+
+class Sort : public cudf::benchmark {
+};
+
+/**
+ * @brief Returns `num_columns` int64 key columns with `cardinality` distinct values each
+ *
+ * A low cardinality makes the leading keys tie often, so that the later keys are compared.
+ */
+std::vector<std::unique_ptr<cudf::column>> create_key_columns(cudf::size_type num_rows,
+                                                              cudf::size_type num_columns,
+                                                              int64_t cardinality,
+                                                              bool nulls)
+{
+  std::mt19937 engine{13377331};
+  std::uniform_int_distribution<int64_t> key(0, cardinality - 1);
+  std::bernoulli_distribution is_valid(nulls ? 0.9 : 1.0);
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (cudf::size_type c = 0; c < num_columns; ++c) {
+    std::vector<int64_t> values(num_rows);
+    std::vector<bool> validity(num_rows);
+    for (cudf::size_type i = 0; i < num_rows; ++i) {
+      values[i]   = key(engine);
+      validity[i] = is_valid(engine);
+    }
+    columns.push_back(
+      nulls ? cudf::test::fixed_width_column_wrapper<int64_t>(
+                values.begin(), values.end(), validity.begin())
+                .release()
+            : cudf::test::fixed_width_column_wrapper<int64_t>(values.begin(), values.end())
+                .release());
+  }
+  return columns;
+}
+
+template <bool stable>
+static void BM_sort(benchmark::State& state, bool nulls)
+{
+  auto const num_rows    = static_cast<cudf::size_type>(state.range(0));
+  auto const num_columns = static_cast<cudf::size_type>(state.range(1));
+  auto const columns     = create_key_columns(num_rows, num_columns, num_rows / 4, nulls);
+
+  std::vector<cudf::column_view> views;
+  for (auto const& col : columns) { views.push_back(col->view()); }
+  cudf::table_view const input(views);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto result = stable ? cudf::stable_sorted_order(input) : cudf::sorted_order(input);
+  }
+
+  state.SetBytesProcessed(state.iterations() * num_rows * num_columns * sizeof(int64_t));
+}
+
+template <bool stable>
+static void BM_sort_strings(benchmark::State& state)
+{
+  auto const column = create_strings_column(state);
+  cudf::table_view const input({column->view()});
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto result = stable ? cudf::stable_sorted_order(input) : cudf::sorted_order(input);
+  }
+
+  state.SetItemsProcessed(state.iterations() * input.num_rows());
+}
+
+static void BM_rank(benchmark::State& state, cudf::rank_method method)
+{
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  auto const columns  = create_key_columns(num_rows, 1, num_rows / 4, true);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto result = cudf::rank(columns.front()->view(),
+                             method,
+                             cudf::order::ASCENDING,
+                             cudf::null_policy::INCLUDE,
+                             cudf::null_order::AFTER,
+                             false);
+  }
+
+  state.SetBytesProcessed(state.iterations() * num_rows * sizeof(int64_t));
+}
+
+static void sort_args(benchmark::internal::Benchmark* b)
+{
+  for (int columns : {1, 2, 8}) {
+    for (int rows = 1 << 16; rows <= 1 << 24; rows <<= 2) { b->Args({rows, columns}); }
+  }
+}
+
+#define SORT_BENCHMARK_DEFINE(name, stable, nulls)                          \
+  BENCHMARK_DEFINE_F(Sort, name)                                            \
+  (::benchmark::State & st) { BM_sort<stable>(st, nulls); }                 \
+  BENCHMARK_REGISTER_F(Sort, name)                                          \
+    ->Apply(sort_args)                                                      \
+    ->UseManualTime()                                                       \
+    ->Unit(benchmark::kMillisecond);
+
+SORT_BENCHMARK_DEFINE(unstable, false, false)
+SORT_BENCHMARK_DEFINE(stable, true, false)
+SORT_BENCHMARK_DEFINE(unstable_nulls, false, true)
+SORT_BENCHMARK_DEFINE(stable_nulls, true, true)
+
+#define SORT_STRINGS_BENCHMARK_DEFINE(name, stable)                         \
+  BENCHMARK_DEFINE_F(Sort, name)                                            \
+  (::benchmark::State & st) { BM_sort_strings<stable>(st); }                \
+  BENCHMARK_REGISTER_F(Sort, name)                                          \
+    ->Apply(string_length_args)                                             \
+    ->UseManualTime()                                                       \
+    ->Unit(benchmark::kMillisecond);
+
+SORT_STRINGS_BENCHMARK_DEFINE(strings_unstable, false)
+SORT_STRINGS_BENCHMARK_DEFINE(strings_stable, true)
+
+#define RANK_BENCHMARK_DEFINE(name, method)                                 \
+  BENCHMARK_DEFINE_F(Sort, name)                                            \
+  (::benchmark::State & st) { BM_rank(st, method); }                        \
+  BENCHMARK_REGISTER_F(Sort, name)                                          \
+    ->RangeMultiplier(4)                                                    \
+    ->Range(1 << 16, 1 << 24)                                               \
+    ->UseManualTime()                                                       \
+    ->Unit(benchmark::kMillisecond);
+
+RANK_BENCHMARK_DEFINE(rank_first, cudf::rank_method::FIRST)
+RANK_BENCHMARK_DEFINE(rank_average, cudf::rank_method::AVERAGE)
+RANK_BENCHMARK_DEFINE(rank_dense, cudf::rank_method::DENSE)
@@ -17,11 +17,14 @@
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
 
+#include <cudf/binaryop.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
 #include <benchmark/benchmark.h>
+#include <algorithm>
 #include <chrono>
 #include <random>
 
@@ -44,6 +47,13 @@ void size_range(benchmark::internal::Benchmark* b)
   for (int size = tenK; size <= hundredM; size *= 10) b->Args({size, fifty_percent});
 }
 
+// selectivities in per mille, from 0.1% to 99%
+void selectivity_range(benchmark::internal::Benchmark* b)
+{
+  b->Unit(benchmark::kMillisecond);
+  for (int per_mille : {1, 10, 100, 250, 500, 750, 900, 990}) b->Args({tenM, per_mille});
+}
+
 template <typename T>
 T random_int(T min, T max)
 {
@@ -123,6 +133,51 @@ void BM_apply_boolean_mask(benchmark::State& state, cudf::size_type num_columns)
   calculate_bandwidth<T>(state, num_columns);
 }
 
+// Filters a table by `column(0) < threshold`, where column 0 holds a permutation of the row indices
+// so that the threshold sets the selectivity. The comparison is either fused in the filtering
+// kernels by `apply_predicates`, or materialized by `binary_operation` for `apply_boolean_mask`.
+template <class T>
+void BM_apply_predicate(benchmark::State& state, cudf::size_type num_columns, bool fused)
+{
+  using wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+  const cudf::size_type column_size{static_cast<cudf::size_type>(state.range(0))};
+  const cudf::size_type per_mille{static_cast<cudf::size_type>(state.range(1))};
+
+  std::vector<T> data(column_size);
+  std::iota(data.begin(), data.end(), 0);
+  std::vector<T> keys(data);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937{13377331});
+
+  std::vector<wrapper> columns;
+  columns.emplace_back(keys.cbegin(), keys.cend());
+  for (int i = 1; i < num_columns; i++) { columns.emplace_back(data.cbegin(), data.cend()); }
+
+  std::vector<cudf::column_view> column_views(num_columns);
+  std::transform(columns.begin(), columns.end(), column_views.begin(), [](auto const& col) {
+    return static_cast<cudf::column_view>(col);
+  });
+  cudf::table_view source_table{column_views};
+  auto const threshold_value = static_cast<int64_t>(column_size) * per_mille / 1000;
+  cudf::numeric_scalar<T> threshold(static_cast<T>(threshold_value));
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    if (fused) {
+      auto result =
+        cudf::apply_predicates(source_table, {{0, cudf::binary_operator::LESS, threshold}});
+    } else {
+      auto mask   = cudf::binary_operation(source_table.column(0),
+                                         threshold,
+                                         cudf::binary_operator::LESS,
+                                         cudf::data_type{cudf::BOOL8});
+      auto result = cudf::apply_boolean_mask(source_table, *mask);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * column_size * num_columns);
+}
+
 template <class T>
 class ApplyBooleanMask : public cudf::benchmark {
  public:
@@ -160,3 +215,19 @@ BENCHMARK_REGISTER_F(ApplyBooleanMask, int16_1_col)->Args({tenM, fifty_percent})
 BENCHMARK_REGISTER_F(ApplyBooleanMask, int32_1_col)->Args({tenM, fifty_percent});
 BENCHMARK_REGISTER_F(ApplyBooleanMask, int64_1_col)->Args({tenM, fifty_percent});
 BENCHMARK_REGISTER_F(ApplyBooleanMask, double_1_col)->Args({tenM, fifty_percent});
+
+// fused predicate against materialized boolean mask across selectivities on wide tables
+#define PREDICATE_BENCHMARK_DEFINE(name, type, n_columns, fused)                      \
+  BENCHMARK_TEMPLATE_DEFINE_F(ApplyBooleanMask, name, type)(::benchmark::State & st) \
+  {                                                                                  \
+    BM_apply_predicate<TypeParam>(st, n_columns, fused);                             \
+  }
+
+PREDICATE_BENCHMARK_DEFINE(int32_predicate_fused_1_col, int32_t, 1, true);
+PREDICATE_BENCHMARK_DEFINE(int32_predicate_mask_1_col, int32_t, 1, false);
+PREDICATE_BENCHMARK_DEFINE(int32_predicate_fused_16_col, int32_t, 16, true);
+PREDICATE_BENCHMARK_DEFINE(int32_predicate_mask_16_col, int32_t, 16, false);
+BENCHMARK_REGISTER_F(ApplyBooleanMask, int32_predicate_fused_1_col)->Apply(selectivity_range);
+BENCHMARK_REGISTER_F(ApplyBooleanMask, int32_predicate_mask_1_col)->Apply(selectivity_range);
+BENCHMARK_REGISTER_F(ApplyBooleanMask, int32_predicate_fused_16_col)->Apply(selectivity_range);
+BENCHMARK_REGISTER_F(ApplyBooleanMask, int32_predicate_mask_16_col)->Apply(selectivity_range);
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class DropDuplicates : public cudf::benchmark {
+};
+
+// Drops the duplicates of the int64 key column of a {key, payload} table, where the key has
+// `num_rows * unique_percent / 100` distinct values
+static void BM_drop_duplicates(benchmark::State& state, cudf::duplicate_keep_option keep)
+{
+  auto const num_rows       = static_cast<cudf::size_type>(state.range(0));
+  auto const unique_percent = state.range(1);
+  auto const cardinality    = std::max<int64_t>(1, num_rows * unique_percent / 100);
+
+  std::mt19937 engine{13377331};
+  std::uniform_int_distribution<int64_t> key(0, cardinality - 1);
+  std::vector<int64_t> keys(num_rows);
+  for (auto& k : keys) { k = key(engine); }
+  cudf::test::fixed_width_column_wrapper<int64_t> key_column(keys.begin(), keys.end());
+  auto const iter = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> payload_column(iter, iter + num_rows);
+  cudf::table_view const input({key_column, payload_column});
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto result = cudf::drop_duplicates(input, {0}, keep);
+  }
+
+  state.SetBytesProcessed(state.iterations() * num_rows * (sizeof(int64_t) + sizeof(int32_t)));
+}
+
+static void drop_duplicates_args(benchmark::internal::Benchmark* b)
+{
+  for (int unique_percent : {1, 50, 100}) {
+    for (int rows = 1 << 16; rows <= 1 << 26; rows <<= 2) { b->Args({rows, unique_percent}); }
+  }
+}
+
+#define DROP_DUPLICATES_BENCHMARK_DEFINE(name, keep)                        \
+  BENCHMARK_DEFINE_F(DropDuplicates, name)                                  \
+  (::benchmark::State & st) { BM_drop_duplicates(st, keep); }               \
+  BENCHMARK_REGISTER_F(DropDuplicates, name)                                \
+    ->Apply(drop_duplicates_args)                                           \
+    ->UseManualTime()                                                       \
+    ->Unit(benchmark::kMillisecond);
+
+DROP_DUPLICATES_BENCHMARK_DEFINE(keep_first, cudf::duplicate_keep_option::KEEP_FIRST)
+DROP_DUPLICATES_BENCHMARK_DEFINE(keep_last, cudf::duplicate_keep_option::KEEP_LAST)
+DROP_DUPLICATES_BENCHMARK_DEFINE(keep_none, cudf::duplicate_keep_option::KEEP_NONE)
+DROP_DUPLICATES_BENCHMARK_DEFINE(keep_any, cudf::duplicate_keep_option::KEEP_ANY)
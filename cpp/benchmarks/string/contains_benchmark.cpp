@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_generator.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/find.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+class StringContains : public cudf::benchmark {
+};
+
+enum contains_type { contains, contains_re, matches_re };
+
+static void BM_contains(benchmark::State& state, contains_type ct)
+{
+  auto const column = create_strings_column(state);
+  cudf::strings_column_view const input(column->view());
+  cudf::string_scalar const target("abc");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    switch (ct) {
+      case contains: cudf::strings::contains(input, target); break;
+      case contains_re: cudf::strings::contains_re(input, "[0-9]+ [a-z]"); break;
+      case matches_re: cudf::strings::matches_re(input, "[a-z]+"); break;
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+#define STRINGS_CONTAINS_BENCHMARK_DEFINE(name)                         \
+  BENCHMARK_DEFINE_F(StringContains, name)                              \
+  (::benchmark::State & st) { BM_contains(st, name); }                  \
+  BENCHMARK_REGISTER_F(StringContains, name)                            \
+    ->Apply(string_length_args)                                         \
+    ->UseManualTime()                                                   \
+    ->Unit(benchmark::kMillisecond);
+
+STRINGS_CONTAINS_BENCHMARK_DEFINE(contains)
+STRINGS_CONTAINS_BENCHMARK_DEFINE(contains_re)
+STRINGS_CONTAINS_BENCHMARK_DEFINE(matches_re)
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+class StringConvert : public cudf::benchmark {
+};
+
+enum convert_type { to_integers, from_integers, to_floats, from_floats };
+
+/**
+ * @brief Returns random numbers whose magnitudes span `num_digits` decimal digits, so that the
+ * lengths of their string representations vary accordingly
+ */
+template <typename T>
+std::unique_ptr<cudf::column> create_numeric_column(cudf::size_type num_rows, int num_digits)
+{
+  std::mt19937 engine{13377331};
+  std::uniform_real_distribution<double> exponent(0, num_digits);
+  std::bernoulli_distribution negative(0.5);
+  std::vector<T> values(num_rows);
+  for (auto& value : values) {
+    auto const magnitude = std::pow(10.0, exponent(engine));
+    value                = static_cast<T>(negative(engine) ? -magnitude : magnitude);
+  }
+  return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end()).release();
+}
+
+static void BM_convert(benchmark::State& state, convert_type ct)
+{
+  auto const num_rows        = static_cast<cudf::size_type>(state.range(0));
+  auto const num_digits      = static_cast<int>(state.range(1));
+  auto const integers        = create_numeric_column<int64_t>(num_rows, num_digits);
+  auto const floats          = create_numeric_column<double>(num_rows, num_digits);
+  auto const integer_strings = cudf::strings::from_integers(integers->view());
+  auto const float_strings   = cudf::strings::from_floats(floats->view());
+  cudf::data_type const integer_type{cudf::INT64};
+  cudf::data_type const float_type{cudf::FLOAT64};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    switch (ct) {
+      case to_integers: cudf::strings::to_integers(integer_strings->view(), integer_type); break;
+      case from_integers: cudf::strings::from_integers(integers->view()); break;
+      case to_floats: cudf::strings::to_floats(float_strings->view(), float_type); break;
+      case from_floats: cudf::strings::from_floats(floats->view()); break;
+    }
+  }
+
+  auto const chars_size = (ct == to_integers || ct == from_integers)
+                            ? cudf::strings_column_view(integer_strings->view()).chars_size()
+                            : cudf::strings_column_view(float_strings->view()).chars_size();
+  state.SetBytesProcessed(state.iterations() * (chars_size + num_rows * sizeof(int64_t)));
+}
+
+static void convert_args(benchmark::internal::Benchmark* b)
+{
+  for (int num_digits : {2, 8, 16}) {
+    for (int rows = 1 << 16; rows <= 1 << 24; rows <<= 2) { b->Args({rows, num_digits}); }
+  }
+}
+
+#define STRINGS_CONVERT_BENCHMARK_DEFINE(name)                          \
+  BENCHMARK_DEFINE_F(StringConvert, name)                               \
+  (::benchmark::State & st) { BM_convert(st, name); }                   \
+  BENCHMARK_REGISTER_F(StringConvert, name)                             \
+    ->Apply(convert_args)                                               \
+    ->UseManualTime()                                                   \
+    ->Unit(benchmark::kMillisecond);
+
+STRINGS_CONVERT_BENCHMARK_DEFINE(to_integers)
+STRINGS_CONVERT_BENCHMARK_DEFINE(from_integers)
+STRINGS_CONVERT_BENCHMARK_DEFINE(to_floats)
+STRINGS_CONVERT_BENCHMARK_DEFINE(from_floats)
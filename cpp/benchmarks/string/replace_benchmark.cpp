@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_generator.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/replace.hpp>
+#include <cudf/strings/replace_re.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+class StringReplace : public cudf::benchmark {
+};
+
+enum replace_type { replace, replace_re, replace_with_backrefs };
+
+static void BM_replace(benchmark::State& state, replace_type rt)
+{
+  auto const column = create_strings_column(state);
+  cudf::strings_column_view const input(column->view());
+  cudf::string_scalar const target("a");
+  cudf::string_scalar const repl("XYZ");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    switch (rt) {
+      case replace: cudf::strings::replace(input, target, repl); break;
+      case replace_re: cudf::strings::replace_re(input, "[0-9]+", repl); break;
+      case replace_with_backrefs:
+        cudf::strings::replace_with_backrefs(input, "([a-z])([0-9])", "\\2\\1");
+        break;
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+#define STRINGS_REPLACE_BENCHMARK_DEFINE(name)                          \
+  BENCHMARK_DEFINE_F(StringReplace, name)                               \
+  (::benchmark::State & st) { BM_replace(st, name); }                   \
+  BENCHMARK_REGISTER_F(StringReplace, name)                             \
+    ->Apply(string_length_args)                                         \
+    ->UseManualTime()                                                   \
+    ->Unit(benchmark::kMillisecond);
+
+STRINGS_REPLACE_BENCHMARK_DEFINE(replace)
+STRINGS_REPLACE_BENCHMARK_DEFINE(replace_re)
+STRINGS_REPLACE_BENCHMARK_DEFINE(replace_with_backrefs)
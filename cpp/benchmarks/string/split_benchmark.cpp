@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_generator.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/split/split.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+
+class StringSplit : public cudf::benchmark {
+};
+
+enum split_type { split, rsplit, split_record };
+
+static void BM_split(benchmark::State& state, split_type st)
+{
+  auto const column = create_strings_column(state);
+  cudf::strings_column_view const input(column->view());
+  cudf::string_scalar const delimiter(" ");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    switch (st) {
+      case split: cudf::strings::split(input, delimiter); break;
+      case rsplit: cudf::strings::rsplit(input, delimiter); break;
+      case split_record: cudf::strings::split_record(input, delimiter); break;
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+#define STRINGS_SPLIT_BENCHMARK_DEFINE(name)                            \
+  BENCHMARK_DEFINE_F(StringSplit, name)                                 \
+  (::benchmark::State & st) { BM_split(st, name); }                     \
+  BENCHMARK_REGISTER_F(StringSplit, name)                               \
+    ->Apply(string_length_args)                                         \
+    ->UseManualTime()                                                   \
+    ->Unit(benchmark::kMillisecond);
+
+STRINGS_SPLIT_BENCHMARK_DEFINE(split)
+STRINGS_SPLIT_BENCHMARK_DEFINE(rsplit)
+STRINGS_SPLIT_BENCHMARK_DEFINE(split_record)
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Distribution of the lengths of generated strings
+ */
+enum class length_distribution : int {
+  UNIFORM = 0,  ///< Lengths are uniform in [0, max_length]
+  SKEWED        ///< Most strings are at most 16 characters, one percent are up to max_length
+};
+
+/**
+ * @brief Returns a strings column of `num_rows` random strings
+ *
+ * The strings are made of lowercase letters, digits and spaces so that the benchmarked patterns
+ * also match within them. Generation is seeded so runs are reproducible.
+ *
+ * @param num_rows Number of strings
+ * @param max_length Longest generated string
+ * @param lengths Distribution of the string lengths
+ * @param null_probability Probability of a row to be null
+ */
+inline std::unique_ptr<cudf::column> create_strings_column(cudf::size_type num_rows,
+                                                           cudf::size_type max_length,
+                                                           length_distribution lengths,
+                                                           double null_probability = 0)
+{
+  static char const alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789     ";
+  std::mt19937 engine{13377331};
+  std::uniform_int_distribution<int> character(0, sizeof(alphabet) - 2);
+  std::uniform_int_distribution<cudf::size_type> any_length(0, max_length);
+  std::uniform_int_distribution<cudf::size_type> short_length(0, std::min(max_length, 16));
+  std::bernoulli_distribution is_long(0.01);
+  std::bernoulli_distribution is_null(null_probability);
+
+  std::vector<std::string> strings(num_rows);
+  std::vector<bool> validity(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    auto const length = (lengths == length_distribution::UNIFORM || is_long(engine))
+                          ? any_length(engine)
+                          : short_length(engine);
+    auto& str = strings[i];
+    str.resize(length);
+    std::generate(str.begin(), str.end(), [&] { return alphabet[character(engine)]; });
+    validity[i] = !is_null(engine);
+  }
+  return cudf::test::strings_column_wrapper(strings.begin(), strings.end(), validity.begin())
+    .release();
+}
+
+/**
+ * @brief Registers {num_rows, max_length, length_distribution} arguments on a strings benchmark
+ */
+inline void string_length_args(::benchmark::internal::Benchmark* b)
+{
+  for (auto const lengths : {length_distribution::UNIFORM, length_distribution::SKEWED}) {
+    for (int max_length : {32, 256, 2048}) {
+      for (int rows = 1 << 16; rows <= 1 << 22; rows <<= 3) {
+        b->Args({rows, max_length, static_cast<int>(lengths)});
+      }
+    }
+  }
+}
+
+/**
+ * @brief Returns the strings column described by the arguments of `string_length_args`
+ */
+inline std::unique_ptr<cudf::column> create_strings_column(::benchmark::State const& state)
+{
+  return create_strings_column(static_cast<cudf::size_type>(state.range(0)),
+                               static_cast<cudf::size_type>(state.range(1)),
+                               static_cast<length_distribution>(state.range(2)));
+}
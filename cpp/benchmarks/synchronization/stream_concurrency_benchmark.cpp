@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "../fixture/benchmark_fixture.hpp"
+
+class StreamConcurrency : public cudf::benchmark {
+};
+
+// Number of gathers issued by each host thread in every iteration
+constexpr int gathers_per_thread = 16;
+
+/**
+ * @brief Runs the same gathers from several host threads, either all on the default stream or
+ * each one on its own stream, to measure how the throughput scales with the number of threads.
+ *
+ * With the legacy default stream the work of all the threads is serialized; building with
+ * `PER_THREAD_DEFAULT_STREAM` or passing a stream per thread lets it overlap.
+ */
+void BM_concurrent_gather(benchmark::State& state)
+{
+  auto const num_rows    = static_cast<cudf::size_type>(state.range(0));
+  auto const num_threads = static_cast<int>(state.range(1));
+  bool const own_streams = state.range(2) != 0;
+
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int64_t> source(data, data + num_rows);
+  std::vector<cudf::size_type> host_map(num_rows);
+  std::iota(host_map.rbegin(), host_map.rend(), 0);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> gather_map(host_map.begin(),
+                                                                     host_map.end());
+  cudf::table_view const source_table{{source}};
+
+  std::vector<cudaStream_t> streams(num_threads, 0);
+  if (own_streams) {
+    for (auto& stream : streams) {
+      CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+    }
+  }
+
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (auto stream : streams) {
+      threads.emplace_back([&source_table, &gather_map, stream]() {
+        for (int i = 0; i < gathers_per_thread; ++i) {
+          cudf::gather(source_table, gather_map, false, rmm::mr::get_default_resource(), stream);
+        }
+        CUDA_TRY(cudaStreamSynchronize(stream));
+      });
+    }
+    std::for_each(threads.begin(), threads.end(), [](auto& thread) { thread.join(); });
+  }
+
+  if (own_streams) {
+    for (auto stream : streams) { CUDA_TRY(cudaStreamDestroy(stream)); }
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_threads * gathers_per_thread * num_rows);
+}
+
+static void concurrency_args(benchmark::internal::Benchmark* b)
+{
+  for (int own_streams : {0, 1}) {
+    for (int num_threads : {1, 2, 4, 8}) { b->Args({1 << 20, num_threads, own_streams}); }
+  }
+}
+
+BENCHMARK_DEFINE_F(StreamConcurrency, gather)(::benchmark::State& state)
+{
+  BM_concurrent_gather(state);
+}
+BENCHMARK_REGISTER_F(StreamConcurrency, gather)
+  ->Apply(concurrency_args)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
@@ -26,17 +26,19 @@ using cudf::test::fixed_width_column_wrapper;
 
 static void BM_transpose(benchmark::State& state)
 {
-  auto count = state.range(0);
+  auto num_columns = state.range(0);
+  auto num_rows    = state.range(1);
 
-  auto data     = std::vector<int>(count, 0);
-  auto validity = std::vector<bool>(count, 1);
+  auto data     = std::vector<int>(num_rows, 0);
+  auto validity = std::vector<bool>(num_rows, 1);
 
   auto fwcw_iter = thrust::make_transform_iterator(
     thrust::make_counting_iterator(0), [&data, &validity](auto idx) {
       return fixed_width_column_wrapper<int>(data.begin(), data.end(), validity.begin());
     });
 
-  auto input_columns = std::vector<fixed_width_column_wrapper<int>>(fwcw_iter, fwcw_iter + count);
+  auto input_columns =
+    std::vector<fixed_width_column_wrapper<int>>(fwcw_iter, fwcw_iter + num_columns);
 
   auto input_column_views =
     std::vector<cudf::column_view>(input_columns.begin(), input_columns.end());
@@ -47,17 +49,33 @@ static void BM_transpose(benchmark::State& state)
     cuda_event_timer raii(state, true);
     auto output = cudf::transpose(input);
   }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_columns * num_rows *
+                          sizeof(int) * 2);
 }
 
 class Transpose : public cudf::benchmark {
 };
 
-#define TRANSPOSE_BM_BENCHMARK_DEFINE(name)                                                \
+#define TRANSPOSE_BM_BENCHMARK_DEFINE(name, ...)                                           \
   BENCHMARK_DEFINE_F(Transpose, name)(::benchmark::State & state) { BM_transpose(state); } \
   BENCHMARK_REGISTER_F(Transpose, name)                                                    \
-    ->RangeMultiplier(4)                                                                   \
-    ->Range(4, 4 << 13)                                                                    \
+    ->__VA_ARGS__                                                                          \
     ->UseManualTime()                                                                      \
     ->Unit(benchmark::kMillisecond);
 
-TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_simple);
+// Square tables
+static void square_sizes(benchmark::internal::Benchmark* b)
+{
+  for (int size = 4; size <= 4 << 13; size *= 4) { b->Args({size, size}); }
+}
+
+TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_simple, Apply(square_sizes));
+
+// Many rows and few columns, a batch of feature vectors
+TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_tall_skinny,
+                              Args({4, 1 << 20})->Args({16, 1 << 20})->Args({64, 1 << 18}));
+
+// Few rows and many columns
+TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_short_wide,
+                              Args({1 << 12, 16})->Args({1 << 14, 16})->Args({1 << 14, 64}));
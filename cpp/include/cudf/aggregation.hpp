@@ -69,6 +69,12 @@ class aggregation {
     NUNIQUE,         ///< count number of unique elements
     NTH_ELEMENT,     ///< get the nth element
     ROW_NUMBER,      ///< get row-number of element
+    RANK,            ///< get rank of element within its group
+    DENSE_RANK,      ///< get rank of element within its group, without gaps between ranks
+    APPROX_NUNIQUE,  ///< estimate the number of unique elements
+    APPROX_QUANTILE, ///< estimate quantile(s) from a t-digest
+    LEAD,            ///< window function, accesses row at specified offset following current row
+    LAG,             ///< window function, accesses row at specified offset preceding current row
     PTX,             ///< PTX UDF based reduction
     CUDA             ///< CUDA UDf based reduction
   };
@@ -173,6 +179,39 @@ std::unique_ptr<aggregation> make_argmin_aggregation();
 std::unique_ptr<aggregation> make_nunique_aggregation(
   null_policy null_handling = null_policy::EXCLUDE);
 
+/**
+ * @brief Factory to create an `approx_nunique` aggregation
+ *
+ * `approx_nunique` returns an estimate of the number of unique elements from a
+ * HyperLogLog sketch of `2^precision` registers, without sorting the values.
+ * The relative standard error of the estimate is about `1.04 / 2^(precision/2)`,
+ * e.g. 3.3% for the default precision.
+ *
+ * @throws cudf::logic_error if `precision` is not within `[4, 16]`.
+ *
+ * @param precision Number of bits of the element hashes used to select a register
+ * @param null_handling Indicates if null values will be counted.
+ */
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(
+  int precision = 10, null_policy null_handling = null_policy::EXCLUDE);
+
+/**
+ * @brief Factory to create an `approx_quantile` aggregation
+ *
+ * `approx_quantile` estimates quantiles from a t-digest of the values, see
+ * `cudf::tdigest`. Null and NaN values are ignored. The estimates interpolate
+ * linearly between the centroids of the t-digest, whose size is bounded by
+ * `compression`, whatever the number of values.
+ *
+ * @throws cudf::logic_error if `compression` is not positive.
+ *
+ * @param quantiles The desired quantiles in range [0, 1]
+ * @param compression Bound on the size of the t-digests. Higher values trade
+ * memory for accuracy.
+ */
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& q,
+                                                              double compression = 100);
+
 /**
  * @brief Factory to create a `nth_element` aggregation
  *
@@ -192,6 +231,53 @@ std::unique_ptr<aggregation> make_nth_element_aggregation(
 /// Factory to create a ROW_NUMBER aggregation
 std::unique_ptr<aggregation> make_row_number_aggregation();
 
+/**
+ * @brief Factory to create a LEAD aggregation
+ *
+ * `LEAD` is only supported by rolling windows, and returns the value `offset`
+ * rows after the current row, or null if that row is outside the window.
+ *
+ * @throws cudf::logic_error if `offset` is negative.
+ *
+ * @param offset Number of rows following the current row
+ */
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset);
+
+/**
+ * @brief Factory to create a LAG aggregation
+ *
+ * `LAG` is only supported by rolling windows, and returns the value `offset`
+ * rows before the current row, or null if that row is outside the window.
+ *
+ * @throws cudf::logic_error if `offset` is negative.
+ *
+ * @param offset Number of rows preceding the current row
+ */
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset);
+
+/**
+ * @brief Factory to create a RANK aggregation
+ *
+ * `RANK` is supported by `groupby::scan`, and returns the rank of each
+ * element among the values of its group in ascending order. Equal elements get
+ * the same rank, the rank of the first of them, and nulls rank after all other
+ * values.
+ *
+ * `RANK` is also supported by `scan` and `segmented_scan` on a column already
+ * sorted within every segment, which avoids the sort of `cudf::rank`.
+ */
+std::unique_ptr<aggregation> make_rank_aggregation();
+
+/**
+ * @brief Factory to create a DENSE_RANK aggregation
+ *
+ * `DENSE_RANK` is only supported by `scan` and `segmented_scan` on a column
+ * already sorted within every segment. Equal consecutive elements get the same
+ * rank, and the rank increases by one at every change of value, so that
+ * `{1, 1, 2, 3, 3}` is ranked `{1, 1, 2, 3, 3}` instead of `{1, 1, 3, 4, 4}`.
+ */
+std::unique_ptr<aggregation> make_dense_rank_aggregation();
+
 /**
  * @brief Factory to create an aggregation base on UDF for PTX or CUDA
  *
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// The structures of the Arrow C data and C device data interfaces, which are meant to be
+// copied as they are. The guards let them coexist with the definitions of other libraries.
+extern "C" {
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+#endif  // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+#define ARROW_DEVICE_CUDA_MANAGED 13
+
+struct ArrowDeviceArray {
+  // The Arrow array whose buffers are on the device
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  // A pointer to a cudaEvent_t the consumer waits on before reading the buffers, or null
+  void* sync_event;
+  int64_t reserved[3];
+};
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+}
+
+namespace cudf {
+/**
+ * @addtogroup interop_arrow
+ * @{
+ */
+
+/// An `ArrowSchema` that is released and freed when the pointer goes out of scope
+using unique_schema_t = std::unique_ptr<ArrowSchema, void (*)(ArrowSchema*)>;
+
+/// An `ArrowDeviceArray` that is released and freed when the pointer goes out of scope
+using unique_device_array_t = std::unique_ptr<ArrowDeviceArray, void (*)(ArrowDeviceArray*)>;
+
+/// A `table_view` that frees the memory it owns when the pointer goes out of scope
+using unique_table_view_t = std::unique_ptr<table_view, std::function<void(table_view*)>>;
+
+/**
+ * @brief Describes the columns of a table as an Arrow struct schema.
+ *
+ * | cuDF type | Arrow format |
+ * | --------- | ------------ |
+ * | INT8..INT64, UINT8..UINT64, FLOAT32, FLOAT64 | `c s i l C S I L f g` |
+ * | BOOL8 | `b` |
+ * | TIMESTAMP_DAYS | `tdD` (date32) |
+ * | TIMESTAMP_SECONDS..TIMESTAMP_NANOSECONDS | `tss:` `tsm:` `tsu:` `tsn:` |
+ * | DURATION_SECONDS..DURATION_NANOSECONDS | `tDs` `tDm` `tDu` `tDn` |
+ * | DECIMAL32, DECIMAL64 | `d:9,s,32` `d:18,s,64` with `s` the negated cuDF scale |
+ * | STRING | `u` |
+ * | LIST | `+l` |
+ * | DICTIONARY32 | `i` indices with the schema of the keys as dictionary |
+ *
+ * @throw cudf::logic_error if a column has a type without an Arrow equivalent
+ * @throw cudf::logic_error if @p column_names is neither empty nor one name per column
+ *
+ * @param input The table to describe
+ * @param column_names The names of the columns, or empty for unnamed columns
+ * @return The schema, released when the returned pointer is destroyed
+ */
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<std::string> const& column_names = {});
+
+/**
+ * @brief Exports a table as an Arrow device array without copying its data.
+ *
+ * The array is a struct with a child array per column: the null masks, data, string
+ * offsets and chars, list offsets and dictionary indices are shared with the table.
+ * BOOL8 data is the only exception since Arrow booleans are bit-packed; it is packed into
+ * a new buffer. The table is owned by the array and freed by its release callback, which
+ * the returned pointer calls when it is destroyed unless the consumer released it.
+ *
+ * `sync_event` points to an event recorded on @p stream after the export.
+ *
+ * @throw cudf::logic_error if a column has a type without an Arrow equivalent
+ *
+ * @param input The table to export
+ * @param mr Device memory resource used to allocate the packed booleans
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The device array
+ */
+unique_device_array_t to_arrow_device(
+  table&& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc to_arrow_device(table&&, rmm::mr::device_memory_resource*, cudaStream_t)
+ *
+ * This overload does not own the data of @p input, which must outlive the array.
+ */
+unique_device_array_t to_arrow_device(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Views an Arrow device array of the struct @p schema as a table without copying.
+ *
+ * Each child array of the struct becomes a column of the table, which shares the
+ * validity, data, offsets and dictionary buffers of the array. Arrow booleans are unpacked
+ * into BOOL8 columns owned by the returned view. If the array has a `sync_event`,
+ * @p stream waits on it first. The array must not be released while the view is in use.
+ *
+ * @throw cudf::logic_error if the array is not on a CUDA device or not on the current device
+ * @throw cudf::logic_error if the schema is not a struct or has an unsupported format
+ *
+ * @param schema The schema of the array
+ * @param input The device array
+ * @param mr Device memory resource used to allocate the unpacked booleans
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The table view, which frees the unpacked booleans when it is destroyed
+ */
+unique_table_view_t from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @brief Expression trees evaluated row-wise over the columns of a table.
+ */
+namespace ast {
+/**
+ * @addtogroup transformation_transform
+ * @{
+ */
+
+/**
+ * @brief Operators of expression operation nodes
+ *
+ * Unless noted, the result of an operation on a null operand is null.
+ */
+enum class ast_operator : int32_t {
+  // Binary operators
+  ADD,            ///< operator +
+  SUB,            ///< operator -
+  MUL,            ///< operator *
+  DIV,            ///< operator / using the common type of the operands
+  TRUE_DIV,       ///< operator / after promoting the operands to floating point
+  MOD,            ///< operator %
+  EQUAL,          ///< operator ==
+  NOT_EQUAL,      ///< operator !=
+  LESS,           ///< operator <
+  GREATER,        ///< operator >
+  LESS_EQUAL,     ///< operator <=
+  GREATER_EQUAL,  ///< operator >=
+  BITWISE_AND,    ///< operator &
+  BITWISE_OR,     ///< operator |
+  BITWISE_XOR,    ///< operator ^
+  LOGICAL_AND,    ///< operator &&
+  LOGICAL_OR,     ///< operator ||
+  NULL_EQUALS,    ///< true when both operands are null, false when only one is null, else ==
+  COALESCE,       ///< lhs if it is not null, otherwise rhs
+  // Unary operators
+  NOT,      ///< operator !
+  NEGATE,   ///< operator -
+  IS_NULL,  ///< true when the operand is null, never null itself
+};
+
+/**
+ * @brief How `cudf::compute_column` evaluates an expression
+ */
+enum class evaluation_strategy : int8_t {
+  AUTO,        ///< Interpret small tables unless the compiled kernel is already cached
+  JIT,         ///< Compile the expression into a kernel, cached by the expression's shape
+  INTERPRETER  ///< Run the expression in a precompiled interpreter kernel, with no compilation
+};
+
+/**
+ * @brief A node of an expression tree
+ *
+ * An expression is a reference to a column of the evaluated table, a literal scalar
+ * or an operator applied to one or two child expressions. Expressions are created
+ * with `column_reference`, `literal` and `operation` and are cheap to copy, as
+ * children are shared between copies.
+ *
+ * @code{.pseudo}
+ * // a * b + c > d, with a, b, c, d the columns 0 to 3 of the table
+ * auto a = ast::column_reference(0);
+ * auto b = ast::column_reference(1);
+ * auto c = ast::column_reference(2);
+ * auto d = ast::column_reference(3);
+ * auto expr = ast::operation(ast::ast_operator::GREATER,
+ *                            ast::operation(ast::ast_operator::ADD,
+ *                                           ast::operation(ast::ast_operator::MUL, a, b),
+ *                                           c),
+ *                            d);
+ * @endcode
+ */
+class expression {
+ public:
+  /**
+   * @brief Kinds of expression nodes
+   */
+  enum class node_kind : int8_t {
+    COLUMN_REFERENCE,  ///< A column of the evaluated table
+    LITERAL,           ///< A scalar value used for every row
+    OPERATION          ///< An operator applied to child expressions
+  };
+
+  /**
+   * @brief Returns the kind of this node
+   */
+  node_kind kind() const noexcept { return _kind; }
+
+  /**
+   * @brief Returns the index of the referenced column in the evaluated table
+   *
+   * Only meaningful for `COLUMN_REFERENCE` nodes.
+   */
+  size_type column_index() const noexcept { return _column_index; }
+
+  /**
+   * @brief Returns the literal value
+   *
+   * @throw cudf::logic_error if this is not a `LITERAL` node
+   */
+  scalar const& literal_value() const;
+
+  /**
+   * @brief Returns the operator of this node
+   *
+   * Only meaningful for `OPERATION` nodes.
+   */
+  ast_operator op() const noexcept { return _op; }
+
+  /**
+   * @brief Returns the number of children of this node
+   */
+  size_type num_children() const noexcept { return static_cast<size_type>(_children.size()); }
+
+  /**
+   * @brief Returns the child at the given index
+   *
+   * @param index Index of the child, the lhs of a binary operation is 0
+   */
+  expression const& child(size_type index) const { return *_children.at(index); }
+
+ private:
+  friend expression column_reference(size_type column_index);
+  friend expression literal(scalar const& value);
+  friend expression operation(ast_operator op, expression const& input);
+  friend expression operation(ast_operator op, expression const& lhs, expression const& rhs);
+
+  explicit expression(node_kind kind) : _kind{kind} {}
+
+  node_kind _kind;
+  size_type _column_index{-1};
+  scalar const* _literal{nullptr};
+  ast_operator _op{};
+  std::vector<std::shared_ptr<expression const>> _children;
+};
+
+/**
+ * @brief Creates an expression referring to a column of the evaluated table
+ *
+ * @throw cudf::logic_error if `column_index` is negative
+ *
+ * @param column_index Index of the column in the table the expression is evaluated on
+ * @return The column reference expression
+ */
+expression column_reference(size_type column_index);
+
+/**
+ * @brief Creates an expression with the same value for every row
+ *
+ * The expression refers to `value`, which must outlive every evaluation of the
+ * expression. A null literal is null in every row.
+ *
+ * @throw cudf::logic_error if `value` is not of a numeric type
+ *
+ * @param value The literal value
+ * @return The literal expression
+ */
+expression literal(scalar const& value);
+
+/**
+ * @brief Creates an expression applying a unary operator
+ *
+ * @throw cudf::logic_error if `op` is not `NOT`, `NEGATE` or `IS_NULL`
+ *
+ * @param op The unary operator
+ * @param input The operand
+ * @return The operation expression
+ */
+expression operation(ast_operator op, expression const& input);
+
+/**
+ * @brief Creates an expression applying a binary operator
+ *
+ * @throw cudf::logic_error if `op` is a unary operator
+ *
+ * @param op The binary operator
+ * @param lhs The left operand
+ * @param rhs The right operand
+ * @return The operation expression
+ */
+expression operation(ast_operator op, expression const& lhs, expression const& rhs);
+
+/** @} */  // end of group
+}  // namespace ast
+}  // namespace cudf
@@ -18,8 +18,10 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -147,6 +149,32 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Performs a binary operation between two chunked columns without
+ * concatenating their chunks.
+ *
+ * The chunks of both operands are sliced, without copying, at the union of
+ * their chunk boundaries, and the operation is applied to each pair of
+ * slices. The result is chunked the same way: concatenating the returned
+ * columns gives `binary_operation(concatenate(lhs), concatenate(rhs), op,
+ * output_type)`. Empty slices are skipped.
+ *
+ * @param lhs         The left operand chunked column
+ * @param rhs         The right operand chunked column
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output columns
+ * @param mr          Device memory resource used to allocate the returned columns' device memory
+ * @return            Output columns of `output_type` type, one per slice, in row order
+ * @throw cudf::logic_error if @p lhs and @p rhs are different sizes
+ * @throw cudf::logic_error if @p output_type dtype isn't fixed-width
+ */
+std::vector<std::unique_ptr<column>> binary_operation(
+  chunked_column_view const& lhs,
+  chunked_column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Performs a binary operation between two columns using a
  * user-defined PTX function.
@@ -176,5 +204,105 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Performs a binary operation between a scalar and a column into a preallocated
+ * output column.
+ *
+ * Same as `binary_operation(scalar const&, column_view const&, binary_operator, data_type,
+ * rmm::mr::device_memory_resource*)` with `out.type()` as the output type, but writes the
+ * result into @p out instead of allocating a new column. @p out may be @p rhs itself.
+ * The null mask of @p out, if any, is overwritten and its null count updated.
+ *
+ * @param out         The output column, of the size of @p rhs
+ * @param lhs         The left operand scalar
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @throw cudf::logic_error if @p out is not of the size of @p rhs
+ * @throw cudf::logic_error if the output or operand dtypes aren't fixed-width or are fixed-point
+ * @throw cudf::logic_error if the result has nulls and @p out isn't nullable
+ * @throw cudf::logic_error if @p out is nullable and has a non-zero offset
+ */
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op);
+
+/**
+ * @brief Performs a binary operation between a column and a scalar into a preallocated
+ * output column.
+ *
+ * @p out may be @p lhs itself.
+ *
+ * @copydetails binary_operation(mutable_column_view&, scalar const&, column_view const&,
+ * binary_operator)
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op);
+
+/**
+ * @brief Performs a binary operation between two columns into a preallocated output column.
+ *
+ * @p out may be @p lhs or @p rhs itself.
+ *
+ * @copydetails binary_operation(mutable_column_view&, scalar const&, column_view const&,
+ * binary_operator)
+ * @throw cudf::logic_error if @p lhs and @p rhs are different sizes
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op);
+
+/**
+ * @brief Returns the scale of the result of a binary operation between fixed-point operands.
+ *
+ * `MUL` adds the scales and `DIV` subtracts the right scale from the left one. `ADD`,
+ * `SUB`, `NULL_MAX`, `NULL_MIN` and the comparisons rescale both operands to the smaller
+ * of the two scales, which comparisons report although their output is `BOOL8`. A
+ * fixed-point `output_type` passed to `binary_operation` must have this scale.
+ *
+ * @throw cudf::logic_error if @p op is not supported for fixed-point operands
+ *
+ * @param op The binary operator
+ * @param left_scale The scale of the left operand
+ * @param right_scale The scale of the right operand
+ * @return The scale of the result
+ */
+int32_t binary_operation_fixed_point_scale(binary_operator op,
+                                           int32_t left_scale,
+                                           int32_t right_scale);
+
+/**
+ * @brief The operator and types of a binary operation whose JIT kernels are compiled
+ * ahead of time by `precompile_binary_operations`.
+ */
+struct binary_operation_signature {
+  binary_operator op;     ///< The binary operator
+  data_type lhs_type;     ///< Type of the left operand
+  data_type rhs_type;     ///< Type of the right operand
+  data_type output_type;  ///< Type of the output column
+};
+
+/**
+ * @brief Compiles the JIT kernels of the given binary operations before they are first used.
+ *
+ * For each signature the kernels for column-column, column-scalar and scalar-column
+ * operands are loaded from the on-disk kernel cache, or compiled and written to it,
+ * and kept in memory for the current CUDA context. A later `binary_operation` with the
+ * same operator and types then launches without compiling.
+ *
+ * Running this with `LIBCUDF_KERNEL_CACHE_PATH` set to an empty directory generates a
+ * kernel bundle that can be shipped with the application and used through
+ * `LIBCUDF_KERNEL_BUNDLE_PATH`.
+ *
+ * @throw cudf::logic_error if any operand or output type is not fixed-width
+ * @throw cudf::logic_error if any operator is `GENERIC_BINARY`
+ *
+ * @param signatures The binary operations to compile
+ */
+void precompile_binary_operations(std::vector<binary_operation_signature> const& signatures);
+
 /** @} */  // end of group
 }  // namespace cudf
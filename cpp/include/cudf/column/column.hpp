@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/column/column_statistics.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include "column_view.hpp"
@@ -22,6 +23,7 @@
 #include <rmm/device_buffer.hpp>
 
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -143,6 +145,8 @@ class column {
   /**
    * @brief Sets the column's null value indicator bitmask to `new_null_mask`.
    *
+   * Clears the cached `statistics()`.
+   *
    * @throws cudf::logic_error if new_null_count is larger than 0 and the size
    * of `new_null_mask` does not match the size of this column.
    *
@@ -159,6 +163,8 @@ class column {
   /**
    * @brief Sets the column's null value indicator bitmask to `new_null_mask`.
    *
+   * Clears the cached `statistics()`.
+   *
    * @throws cudf::logic_error if new_null_count is larger than 0 and the size
    * of `new_null_mask` does not match the size of this column.
    *
@@ -218,7 +224,12 @@ class column {
    * @param child_index Index of the desired child
    * @return column& Reference to the desired child
    */
-  column& child(size_type child_index) noexcept { return *_children[child_index]; };
+  column& child(size_type child_index) noexcept
+  {
+    // The child could be modified through the returned reference
+    clear_statistics();
+    return *_children[child_index];
+  };
 
   /**
    * @brief Returns a const reference to the specified child
@@ -228,6 +239,25 @@ class column {
    */
   column const& child(size_type child_index) const noexcept { return *_children[child_index]; };
 
+  /**
+   * @brief Returns a copy of the statistics cached on the column.
+   *
+   * @see column_statistics
+   */
+  column_statistics statistics() const;
+
+  /**
+   * @brief Caches known statistics of the elements of the column, e.g. from the metadata of the
+   * file the column was read from.
+   *
+   * The statistics are not verified against the elements.
+   *
+   * @throws cudf::logic_error if the type of `min` or `max` is not the type of the column
+   *
+   * @param new_statistics The statistics of the column
+   */
+  void set_statistics(column_statistics new_statistics);
+
   /**
    * @brief Wrapper for the contents of a column.
    *
@@ -282,7 +312,7 @@ class column {
    * `null_count()` by setting it to `UNKNOWN_NULL_COUNT`. The user can
    * either explicitly update the null count with `set_null_count()`, or
    * if not, the null count will be recomputed on the next invocation of
-   *`null_count()`.
+   *`null_count()`. It also clears the cached `statistics()`.
    *
    * @return mutable_column_view The mutable, non-owning view
    */
@@ -305,6 +335,21 @@ class column {
   operator mutable_column_view() { return this->mutable_view(); };
 
  private:
+  friend class table;  // counts the unknown null counts of its columns together
+  friend std::pair<std::shared_ptr<scalar const>, std::shared_ptr<scalar const>> column_min_max(
+    column const& col);
+  friend bool column_is_sorted(column const& col, order, null_order);
+  friend size_type column_approx_distinct(column const& col);
+
+  /**
+   * @brief Forgets the cached statistics.
+   */
+  void clear_statistics()
+  {
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    _statistics.clear();
+  }
+
   data_type _type{EMPTY};           ///< Logical type of elements in the column
   cudf::size_type _size{};          ///< The number of elements in the column
   rmm::device_buffer _data{};       ///< Dense, contiguous, type erased device memory
@@ -314,6 +359,9 @@ class column {
   mutable size_type _null_count{UNKNOWN_NULL_COUNT};  ///< The number of null elements
   std::vector<std::unique_ptr<column>> _children{};   ///< Depending on element type, child
                                                       ///< columns may contain additional data
+  mutable column_statistics _statistics{};            ///< Cached statistics of the elements
+  mutable std::mutex _statistics_mutex;               ///< Guards `_statistics`, which is
+                                                      ///< filled by const functions
 };
 
 /** @} */  // end of group
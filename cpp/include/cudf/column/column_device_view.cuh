@@ -691,7 +691,8 @@ __device__ inline string_view const column_device_view::element<string_view>(
  * dictionary column.
  *
  * `dictionary32` is a strongly typed wrapper around an `int32_t` value that holds the
- * offset into the dictionary keys for the specified element.
+ * offset into the dictionary keys for the specified element. The value is widened from
+ * the UINT8 or UINT16 indices of a narrow dictionary column.
  *
  * For example, given a dictionary column `d` with:
  * ```c++
@@ -715,7 +716,12 @@ __device__ inline dictionary32 const column_device_view::element<dictionary32>(
   size_type element_index) const noexcept
 {
   size_type index = element_index + offset();  // account for this view's _offset
-  return dictionary32{d_children[0].element<int32_t>(index)};
+  auto const& indices = d_children[0];
+  switch (indices.type().id()) {
+    case type_id::UINT8: return dictionary32{indices.element<uint8_t>(index)};
+    case type_id::UINT16: return dictionary32{indices.element<uint16_t>(index)};
+    default: return dictionary32{indices.element<int32_t>(index)};
+  }
 }
 
 namespace detail {
@@ -437,6 +437,34 @@ std::unique_ptr<column> make_strings_column(
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Constructs a LIST type column given offsets column, child column,
+ * and null mask and null count. The columns and mask are moved into the
+ * resulting lists column.
+ *
+ * Row `i` holds the child elements `[offsets[i], offsets[i+1])`.
+ *
+ * @throw cudf::logic_error if `offsets_column` is not an INT32 column without nulls
+ *        and with `num_rows + 1` elements.
+ *
+ * @param num_rows The number of lists the column represents.
+ * @param offsets_column The column of offset values into the child column.
+ * @param child_column The column of all the list elements.
+ * @param null_count The number of null list entries.
+ * @param null_mask The bits specifying the null lists in device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used for allocation of the column's `null_mask` and children
+ * columns' device memory.
+ */
+std::unique_ptr<column> make_lists_column(
+  size_type num_rows,
+  std::unique_ptr<column> offsets_column,
+  std::unique_ptr<column> child_column,
+  size_type null_count,
+  rmm::device_buffer&& null_mask,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Return a column with size elements that are all equal to the
  * given scalar.
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace cudf {
+
+class column;
+class scalar;
+
+/**
+ * @ingroup column_classes Column
+ * @{
+ */
+
+/**
+ * @brief Statistics of the elements of a `column`, cached on the column.
+ *
+ * Every statistic is optional. A column fills its statistics lazily, on the first call to
+ * `column_min_max`, `column_is_sorted` or `column_approx_distinct`, or eagerly through
+ * `column::set_statistics`, e.g. by a reader from the statistics of a file. Any operation that
+ * may modify the elements or the null mask of the column clears the statistics. The statistics
+ * of a column may be filled from several threads at once.
+ *
+ * The null count of a column is cached by `column::null_count()` and is not repeated here.
+ */
+struct column_statistics {
+  std::shared_ptr<scalar const> min{};  ///< Smallest non-null element, nullptr if unknown
+  std::shared_ptr<scalar const> max{};  ///< Largest non-null element, nullptr if unknown
+  std::map<std::pair<order, null_order>, bool> is_sorted{};  ///< Known results of
+                                                             ///< `column_is_sorted` by order
+  size_type approx_distinct{-1};  ///< Estimated count of distinct non-null elements,
+                                  ///< negative if unknown
+
+  /**
+   * @brief Forgets every statistic.
+   */
+  void clear() noexcept
+  {
+    min.reset();
+    max.reset();
+    is_sorted.clear();
+    approx_distinct = -1;
+  }
+};
+
+/**
+ * @brief Returns the smallest and largest non-null elements of a column.
+ *
+ * The values are computed with `min` and `max` reductions only if they are not cached on
+ * `col`, and are cached on `col` otherwise.
+ *
+ * @note The cache of `col` is guarded by a mutex, which is held while the value is computed.
+ *
+ * @throws cudf::logic_error if the type of `col` does not support `min` and `max` reductions.
+ *
+ * @param col The column
+ * @return The smallest and largest elements, invalid scalars if every element is null
+ */
+std::pair<std::shared_ptr<scalar const>, std::shared_ptr<scalar const>> column_min_max(
+  column const& col);
+
+/**
+ * @brief Checks whether the elements of a column are sorted in the given order.
+ *
+ * Equivalent to `is_sorted(table_view{{col}}, {column_order}, {null_precedence})`, which is
+ * only computed if the result is not cached on `col`.
+ *
+ * @note The cache of `col` is guarded by a mutex, which is held while the value is computed.
+ *
+ * @param col The column
+ * @param column_order The expected order of the elements
+ * @param null_precedence The expected order of the null elements compared to other elements
+ * @return true if the elements are sorted as expected
+ */
+bool column_is_sorted(column const& col,
+                      order column_order         = order::ASCENDING,
+                      null_order null_precedence   = null_order::BEFORE);
+
+/**
+ * @brief Returns an estimate of the number of distinct non-null elements of a column.
+ *
+ * The estimate is computed with an `approx_nunique` reduction of the default precision only if
+ * it is not cached on `col`. It may be passed as the `num_distinct_keys` of
+ * `estimate_join_memory` when `col` is the join key.
+ *
+ * @note The cache of `col` is guarded by a mutex, which is held while the value is computed.
+ *
+ * @param col The column
+ * @return The estimated number of distinct non-null elements
+ */
+size_type column_approx_distinct(column const& col);
+
+/** @} */  // end of group
+}  // namespace cudf
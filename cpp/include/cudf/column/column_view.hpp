@@ -139,6 +139,12 @@ class column_view_base {
    **/
   size_type null_count() const;
 
+  /**
+   * @brief Indicates if the count of null elements is known, i.e., if
+   * `null_count()` returns without counting the `null_mask`
+   **/
+  bool has_known_null_count() const noexcept { return _null_count > UNKNOWN_NULL_COUNT; }
+
   /**
    * @brief Returns the count of null elements in the range [begin, end)
    *
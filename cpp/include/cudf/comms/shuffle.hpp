@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace comms {
+/**
+ * @addtogroup copy_split
+ * @{
+ */
+
+/**
+ * @brief Point-to-point transport between the GPUs of a group of ranks, one GPU per rank.
+ *
+ * libcudf does not link any transport: an implementation wraps e.g. an NCCL communicator,
+ * with `isend`/`irecv` issuing `ncclSend`/`ncclRecv` inside a group ended by `waitall`, or a
+ * UCX worker, with tagged sends and receives progressed until complete by `waitall`.
+ *
+ * Every buffer is device memory of the GPU of the rank. Messages sent from one rank to
+ * another must be received in the order they were sent.
+ */
+class communicator {
+ public:
+  virtual ~communicator() = default;
+
+  /**
+   * @brief Returns the rank of this process in the group, in `[0, size())`
+   */
+  virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of ranks in the group
+   */
+  virtual int size() const = 0;
+
+  /**
+   * @brief Starts sending `size` bytes at `data` to rank `peer`.
+   *
+   * `data` must stay valid until the next `waitall` returns.
+   */
+  virtual void isend(void const* data, std::size_t size, int peer, cudaStream_t stream) = 0;
+
+  /**
+   * @brief Starts receiving `size` bytes from rank `peer` into `data`.
+   *
+   * `data` holds the message once the next `waitall` returns.
+   */
+  virtual void irecv(void* data, std::size_t size, int peer, cudaStream_t stream) = 0;
+
+  /**
+   * @brief Waits until every send and receive started since the last `waitall` is complete.
+   */
+  virtual void waitall(cudaStream_t stream) = 0;
+};
+
+/**
+ * @brief Hash partitions the rows of a table distributed over a group of ranks so that
+ * every rank receives the rows whose keys hash to it.
+ *
+ * Every rank of `comm` calls this collective with its part of the table. The rows of `input`
+ * are hash partitioned on `columns_to_hash` into `comm.size()` partitions, exactly like
+ * `hash_partition`, directly into one contiguous buffer per partition. Partition `p` is sent
+ * to rank `p` with its packed metadata while the partitions of the other ranks are received,
+ * every transfer being started before waiting for any of them. The received partitions are
+ * concatenated in rank order.
+ *
+ * After the shuffle, equal keys of all the ranks are on the same rank, so joins and groupbys
+ * on the keys can run locally on every rank.
+ *
+ * Only fixed-width and strings columns are supported.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw cudf::logic_error if `input` has a column that is neither fixed-width nor strings
+ *
+ * @param input The part of the table held by this rank
+ * @param columns_to_hash Indices of input columns to hash
+ * @param comm The communicator of the group of ranks
+ * @param hash_function The hash function used to hash the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for the copies, kernels and transfers of the shuffle
+ *
+ * @returns The rows of all the ranks assigned to this rank
+ */
+std::unique_ptr<table> all_to_all_shuffle(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  communicator& comm,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/** @} */  // end of group
+}  // namespace comms
+}  // namespace cudf
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <memory>
@@ -90,5 +91,27 @@ std::unique_ptr<table> concatenate(
   std::vector<table_view> const& tables_to_concat,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Materializes a chunked column into a single column holding the rows of all chunks
+ *
+ * @param column The chunked column to materialize
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return The concatenation of the chunks of `column`
+ */
+std::unique_ptr<column> concatenate(
+  chunked_column_view const& column,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Materializes a chunked table into a single table holding the rows of all chunks
+ *
+ * @param table The chunked table to materialize
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return The concatenation of the chunks of `table`
+ */
+std::unique_ptr<table> concatenate(
+  chunked_table_view const& table,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
@@ -57,13 +58,47 @@ namespace cudf {
  * @param[in] check_bounds Optionally perform bounds checking on the values
  * of `gather_map` and throw an error if any of its values are out of bounds.
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  * @return std::unique_ptr<table> Result of the gather
  */
 std::unique_ptr<table> gather(
   table_view const& source_table,
   column_view const& gather_map,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Gathers the specified rows of a chunked table without concatenating its chunks.
+ *
+ * @ingroup copy_gather
+ *
+ * Equivalent to `gather(concatenate(source_table), gather_map, check_bounds)`. The indices of
+ * `gather_map` refer to the rows of the chunked table; a negative value `i` is interpreted as
+ * `i+n`, where `n` is `source_table.num_rows()`.
+ *
+ * Fixed-width columns are gathered directly from their chunks. Other columns are materialized
+ * one at a time into temporary memory before being gathered.
+ *
+ * @throws cudf::logic_error if `check_bounds == true` and an index exists in
+ * `gather_map` outside the range `[-n, n)`. If `check_bounds == false`, the rows of such
+ * indices are null.
+ *
+ * @param[in] source_table The chunked table whose rows will be gathered
+ * @param[in] gather_map View into a non-nullable column of integral indices that maps the
+ * rows in the chunked table to rows in the destination columns.
+ * @param[in] check_bounds Optionally perform bounds checking on the values
+ * of `gather_map` and throw an error if any of its values are out of bounds.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return std::unique_ptr<table> Result of the gather
+ */
+std::unique_ptr<table> gather(
+  chunked_table_view const& source_table,
+  column_view const& gather_map,
+  bool check_bounds                   = false,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
@@ -100,6 +135,7 @@ std::unique_ptr<table> gather(
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
  * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Result of scattering values from source to target
  */
 std::unique_ptr<table> scatter(
@@ -107,7 +143,8 @@ std::unique_ptr<table> scatter(
   column_view const& scatter_map,
   table_view const& target,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Scatters a row of scalar values into a copy of the target table
@@ -140,6 +177,7 @@ std::unique_ptr<table> scatter(
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
  * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Result of scattering values from source to target
  */
 std::unique_ptr<table> scatter(
@@ -147,7 +185,8 @@ std::unique_ptr<table> scatter(
   column_view const& indices,
   table_view const& target,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Indicates when to allocate a mask, based on an existing mask.
@@ -173,13 +212,15 @@ std::unique_ptr<column> empty_like(column_view const& input);
  * @param[in] input Immutable view of input column to emulate
  * @param[in] mask_alloc Optional, Policy for allocating null mask. Defaults to RETAIN.
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  * @return A column with sufficient uninitialized capacity to hold the same
  * number of elements as `input` of the same type as `input.type()`
  */
 std::unique_ptr<column> allocate_like(
   column_view const& input,
   mask_allocation_policy mask_alloc   = mask_allocation_policy::RETAIN,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Creates an uninitialized new column of the specified size and same type as the `input`.
@@ -189,6 +230,7 @@ std::unique_ptr<column> allocate_like(
  * @param[in] size The desired number of elements that the new column should have capacity for
  * @param[in] mask_alloc Optional, Policy for allocating null mask. Defaults to RETAIN.
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  * @return A column with sufficient uninitialized capacity to hold the specified number of elements
  * as `input` of the same type as `input.type()`
  */
@@ -196,7 +238,8 @@ std::unique_ptr<column> allocate_like(
   column_view const& input,
   size_type size,
   mask_allocation_policy mask_alloc   = mask_allocation_policy::RETAIN,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Creates a table of empty columns with the same types as the `input_table`
@@ -240,12 +283,14 @@ std::unique_ptr<table> empty_like(table_view const& input_table);
  * @param source_end The index of the last element in the source range
  * (exclusive)
  * @param target_begin The starting index of the target range (inclusive)
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
 void copy_range_in_place(column_view const& source,
                          mutable_column_view& target,
                          size_type source_begin,
                          size_type source_end,
-                         size_type target_begin);
+                         size_type target_begin,
+                         cudaStream_t stream = 0);
 
 /**
  * @brief Copies a range of elements out-of-place from one column to another.
@@ -274,6 +319,7 @@ void copy_range_in_place(column_view const& source,
  * (exclusive)
  * @param target_begin The starting index of the target range (inclusive)
  * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return std::unique_ptr<column> The result target column
  */
 std::unique_ptr<column> copy_range(
@@ -282,7 +328,8 @@ std::unique_ptr<column> copy_range(
   size_type source_begin,
   size_type source_end,
   size_type target_begin,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Slices a `column_view` into a set of `column_view`s according to a set of indices.
@@ -478,13 +525,102 @@ struct contiguous_split_result {
  * @param splits A vector of indices where the view will be split
  * @param[in] mr Device memory resource used to allocate the returned result's device memory
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  * @return The set of requested views of `input` indicated by the `splits` and the viewed memory
  * buffer.
  */
 std::vector<contiguous_split_result> contiguous_split(
   cudf::table_view const& input,
   std::vector<size_type> const& splits,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief A table packed into one contiguous device buffer plus a small host blob of metadata
+ *
+ * @ingroup copy_split
+ *
+ * The device buffer holds the data of every column in the layout of `contiguous_split`. The
+ * metadata describes the type, size, null count and children of every column, with the
+ * location of its data and null mask stored as byte offsets into the device buffer. Both can
+ * be moved across process or spill boundaries as is and turned back into a `table_view`
+ * with `unpack` without copying the device data.
+ */
+struct packed_columns {
+  /**
+   * @brief Host-side metadata of a packed table
+   */
+  struct metadata {
+    metadata() = default;
+    metadata(std::vector<uint8_t>&& v) : data_(std::move(v)) {}
+
+    uint8_t const* data() const { return data_.data(); }
+    size_t size() const { return data_.size(); }
+
+   private:
+    std::vector<uint8_t> data_;
+  };
+
+  packed_columns()
+    : metadata_(std::make_unique<metadata>()), gpu_data(std::make_unique<rmm::device_buffer>())
+  {
+  }
+  packed_columns(std::unique_ptr<metadata>&& md, std::unique_ptr<rmm::device_buffer>&& gd)
+    : metadata_(std::move(md)), gpu_data(std::move(gd))
+  {
+  }
+
+  std::unique_ptr<metadata> metadata_;
+  std::unique_ptr<rmm::device_buffer> gpu_data;
+};
+
+/**
+ * @brief Deep-copies a `table_view` into a single contiguous device buffer and serializes
+ * its metadata into a host buffer.
+ *
+ * @ingroup copy_split
+ *
+ * Supports the same column types as `contiguous_split`.
+ *
+ * @param input View of the table to pack
+ * @param[in] mr Device memory resource used to allocate the returned device buffer
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The packed table data and metadata
+ */
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream                 = 0);
+
+/**
+ * @brief Deserializes the result of `pack` into a `table_view` pointing into its device
+ * buffer.
+ *
+ * @ingroup copy_split
+ *
+ * No device memory is copied or allocated. It is the caller's responsibility to ensure that
+ * the returned view does not outlive `input.gpu_data`.
+ *
+ * @param input The packed table to unpack
+ * @return View of the packed table
+ */
+table_view unpack(packed_columns const& input);
+
+/**
+ * @brief Deserializes packed metadata and device data, e.g. received separately from another
+ * process, into a `table_view` pointing into `gpu_data`.
+ *
+ * @ingroup copy_split
+ *
+ * No device memory is copied or allocated. It is the caller's responsibility to ensure that
+ * the returned view does not outlive the device memory at `gpu_data`.
+ *
+ * @throws cudf::logic_error if `metadata` is not packed metadata
+ *
+ * @param metadata Pointer to the host metadata returned by `packed_columns::metadata::data()`
+ * @param gpu_data Pointer to the device data of the packed table
+ * @return View of the packed table
+ */
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
@@ -502,6 +638,7 @@ std::vector<contiguous_split_result> contiguous_split(
  * @param[in] boolean_mask column of `BOOL8` representing "left (true) / right (false)" boolean for
  * each element. Null element represents false.
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns new column with the selected elements
  */
@@ -509,7 +646,8 @@ std::unique_ptr<column> copy_if_else(
   column_view const& lhs,
   column_view const& rhs,
   column_view const& boolean_mask,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Creates a new column by shifting all values by an offset.
@@ -565,6 +703,7 @@ std::unique_ptr<column> shift(column_view const& input,
  * @param[in] boolean_mask column of `BOOL8` representing "left (true) / right (false)" boolean for
  * each element. Null element represents false.
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns new column with the selected elements
  */
@@ -572,7 +711,8 @@ std::unique_ptr<column> copy_if_else(
   scalar const& lhs,
   column_view const& rhs,
   column_view const& boolean_mask,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
@@ -589,6 +729,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] boolean_mask column of `BOOL8` representing "left (true) / right (false)" boolean for
  * each element. Null element represents false.
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns new column with the selected elements
  */
@@ -596,7 +737,8 @@ std::unique_ptr<column> copy_if_else(
   column_view const& lhs,
   scalar const& rhs,
   column_view const& boolean_mask,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
@@ -611,6 +753,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] boolean_mask column of `BOOL8` representing "left (true) / right (false)" boolean for
  * each element. null element represents false.
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns new column with the selected elements
  */
@@ -618,7 +761,85 @@ std::unique_ptr<column> copy_if_else(
   scalar const& lhs,
   scalar const& rhs,
   column_view const& boolean_mask,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief   Returns a new column, where each element is selected from either @p lhs or
+ *          @p rhs based on the corresponding bit of the bitmask @p condition
+ *
+ * Selects each element i in the output column from either @p rhs or @p lhs using the following
+ * rule: `output[i] = bit_is_set(condition, i) ? lhs[i] : rhs[i]`
+ *
+ * A bitmask condition avoids reading and testing a `BOOL8` element per row: the rows of a
+ * mask word are selected together. A `BOOL8` column can be converted once with
+ * `bools_to_mask` and reused for several selections.
+ *
+ * @throws cudf::logic_error if lhs and rhs are not of the same type
+ * @throws cudf::logic_error if lhs and rhs are not of the same length
+ * @param[in] lhs left-hand column_view
+ * @param[in] rhs right-hand column_view
+ * @param[in] condition device bitmask with at least `lhs.size()` bits, starting at bit 0, whose
+ * set bits select `lhs` and unset bits select `rhs`
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  column_view const& rhs,
+  bitmask_type const* condition,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief   Returns a new column, where each element is selected from either @p lhs or
+ *          @p rhs based on the corresponding bit of the bitmask @p condition
+ *
+ * Selects each element i in the output column from either @p rhs or @p lhs using the following
+ * rule: `output[i] = bit_is_set(condition, i) ? lhs : rhs[i]`
+ *
+ * @throws cudf::logic_error if lhs and rhs are not of the same type
+ * @param[in] lhs left-hand scalar
+ * @param[in] rhs right-hand column_view
+ * @param[in] condition device bitmask with at least `rhs.size()` bits, starting at bit 0, whose
+ * set bits select `lhs` and unset bits select `rhs`
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> copy_if_else(
+  scalar const& lhs,
+  column_view const& rhs,
+  bitmask_type const* condition,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief   Returns a new column, where each element is selected from either @p lhs or
+ *          @p rhs based on the corresponding bit of the bitmask @p condition
+ *
+ * Selects each element i in the output column from either @p rhs or @p lhs using the following
+ * rule: `output[i] = bit_is_set(condition, i) ? lhs[i] : rhs`
+ *
+ * @throws cudf::logic_error if lhs and rhs are not of the same type
+ * @param[in] lhs left-hand column_view
+ * @param[in] rhs right-hand scalar
+ * @param[in] condition device bitmask with at least `lhs.size()` bits, starting at bit 0, whose
+ * set bits select `lhs` and unset bits select `rhs`
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  scalar const& rhs,
+  bitmask_type const* condition,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Scatters rows from the input table to rows of the output corresponding
@@ -653,6 +874,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask.
  * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
  */
@@ -660,7 +882,8 @@ std::unique_ptr<table> boolean_mask_scatter(
   table_view const& input,
   table_view const& target,
   column_view const& boolean_mask,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Scatters scalar values to rows of the output corresponding
@@ -690,6 +913,7 @@ std::unique_ptr<table> boolean_mask_scatter(
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask.
  * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
  */
@@ -697,7 +921,8 @@ std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<scalar>> const& input,
   table_view const& target,
   column_view const& boolean_mask,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Get the element at specified index from a column
@@ -710,12 +935,14 @@ std::unique_ptr<table> boolean_mask_scatter(
  * @param input Column view to get the element from
  * @param index Index into `input` to get the element at
  * @param mr Device memory resource used to allocate the returned scalar's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return std::unique_ptr<scalar> Scalar containing the single value
  */
 std::unique_ptr<scalar> get_element(
   column_view const& input,
   size_type index,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /** @} */
 }  // namespace cudf
@@ -19,6 +19,8 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -27,7 +29,11 @@
 
 namespace cudf {
 namespace datetime {
-namespace detail {
+/**
+ * @brief Fields of a timestamp that can be extracted or truncated to
+ *
+ * @ingroup datetime_extract
+ */
 enum class datetime_component {
   INVALID = 0,
   YEAR,
@@ -39,6 +45,8 @@ enum class datetime_component {
   SECOND,
 };
 
+namespace detail {
+
 /**
  * @brief  Extracts the supplied datetime component from any date time type
  * and returns an int16_t cudf::column.
@@ -151,6 +159,26 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Extracts several datetime components from any date time type in a single pass and
+ * returns a table of int16_t columns.
+ *
+ * Each component has the values of the corresponding `extract_*` function, e.g. `YEAR` those
+ * of `extract_year`. The calendar date of each timestamp is computed once for all components.
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] components The components to extract, in the order of the output columns
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns cudf::table with one int16_t column per component
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if a component is `INVALID`
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -183,6 +211,50 @@ std::unique_ptr<cudf::column> day_of_year(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Converts wall clock timestamps from one timezone to another and returns a column of
+ * the input type.
+ *
+ * Timezones are named as in the IANA timezone database, e.g. "America/Los_Angeles", and read
+ * from `/usr/share/zoneinfo` like the ORC reader does. "UTC" or an empty name is UTC. Local times
+ * skipped or repeated by a daylight savings transition in `from_tz` resolve to one of the
+ * offsets around the transition.
+ *
+ * @param[in] timestamps cudf::column_view of the input datetime values, in `from_tz`
+ * @param[in] from_tz The timezone of the input timestamps
+ * @param[in] to_tz The timezone of the output timestamps
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns cudf::column of the input datatype containing the timestamps in `to_tz`
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if a timezone cannot be found or parsed
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& from_tz,
+  std::string const& to_tz,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Truncates every timestamp to the start of its year, month, day, hour, minute or
+ * second, e.g. to bucket timestamps, and returns a column of the input type.
+ *
+ * Timestamps before the epoch are rounded down, so `1969-12-31 23:30` truncated to `DAY` is
+ * `1969-12-31`. Truncating to a unit finer than the input type returns the input values.
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] component The finest component kept in the output; not `WEEKDAY` or `INVALID`
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns cudf::column of the input datatype containing the truncated timestamps
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if `component` is `WEEKDAY` or `INVALID`
+ */
+std::unique_ptr<cudf::column> truncate_timestamps(
+  cudf::column_view const& column,
+  datetime_component component,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace datetime
 }  // namespace cudf
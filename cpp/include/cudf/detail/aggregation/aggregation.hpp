@@ -128,6 +128,62 @@ struct nunique_aggregation final : derived_aggregation<nunique_aggregation> {
   size_t hash_impl() const { return std::hash<int>{}(static_cast<int>(_null_handling)); }
 };
 
+/**
+ * @brief Derived class for specifying an approx_nunique aggregation
+ */
+struct approx_nunique_aggregation final : derived_aggregation<approx_nunique_aggregation> {
+  approx_nunique_aggregation(aggregation::Kind k, int precision, null_policy null_handling)
+    : derived_aggregation{k}, _precision{precision}, _null_handling{null_handling}
+  {
+  }
+  int _precision;              ///< log2 of the number of HyperLogLog registers
+  null_policy _null_handling;  ///< include or exclude nulls
+
+ protected:
+  friend class derived_aggregation<approx_nunique_aggregation>;
+
+  bool operator==(approx_nunique_aggregation const& other) const
+  {
+    return _precision == other._precision and _null_handling == other._null_handling;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(_precision) ^ std::hash<int>{}(static_cast<int>(_null_handling));
+  }
+};
+
+/**
+ * @brief Derived class for specifying an approx_quantile aggregation
+ */
+struct approx_quantile_aggregation final : derived_aggregation<approx_quantile_aggregation> {
+  approx_quantile_aggregation(std::vector<double> const& q, double compression)
+    : derived_aggregation{APPROX_QUANTILE}, _quantiles{q}, _compression{compression}
+  {
+  }
+  std::vector<double> _quantiles;  ///< Desired quantile(s)
+  double _compression;             ///< Bound on the size of the t-digests
+
+ protected:
+  friend class derived_aggregation<approx_quantile_aggregation>;
+
+  bool operator==(approx_quantile_aggregation const& other) const
+  {
+    return _compression == other._compression and
+           _quantiles.size() == other._quantiles.size() and
+           std::equal(_quantiles.begin(), _quantiles.end(), other._quantiles.begin());
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<double>{}(_compression) ^
+           std::accumulate(
+             _quantiles.cbegin(), _quantiles.cend(), size_t{0}, [](size_t a, double b) {
+               return a ^ std::hash<double>{}(b);
+             });
+  }
+};
+
 /**
  * @brief Derived class for specifying a nth element aggregation
  */
@@ -153,6 +209,27 @@ struct nth_element_aggregation final : derived_aggregation<nth_element_aggregati
   }
 };
 
+/**
+ * @brief Derived class for specifying a lead/lag aggregation
+ */
+struct lead_lag_aggregation final : derived_aggregation<lead_lag_aggregation> {
+  lead_lag_aggregation(aggregation::Kind k, size_type offset)
+    : derived_aggregation{k}, _row_offset{offset}
+  {
+  }
+  size_type _row_offset;  ///< number of rows from the current row
+
+ protected:
+  friend class derived_aggregation<lead_lag_aggregation>;
+
+  bool operator==(lead_lag_aggregation const& other) const
+  {
+    return _row_offset == other._row_offset;
+  }
+
+  size_t hash_impl() const { return std::hash<size_type>{}(_row_offset); }
+};
+
 /**
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
@@ -342,18 +419,54 @@ struct target_type_impl<Source, aggregation::NUNIQUE> {
   using type = cudf::size_type;
 };
 
+// Always use size_type for APPROX_NUNIQUE
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_NUNIQUE> {
+  using type = cudf::size_type;
+};
+
+// Always use `double` for APPROX_QUANTILE
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_QUANTILE> {
+  using type = double;
+};
+
 // Always use Source for NTH_ELEMENT
 template <typename Source>
 struct target_type_impl<Source, aggregation::NTH_ELEMENT> {
   using type = Source;
 };
 
+// Always use Source for LEAD
+template <typename Source>
+struct target_type_impl<Source, aggregation::LEAD> {
+  using type = Source;
+};
+
+// Always use Source for LAG
+template <typename Source>
+struct target_type_impl<Source, aggregation::LAG> {
+  using type = Source;
+};
+
 // Always use size_type accumulator for ROW_NUMBER
 template <typename Source>
 struct target_type_impl<Source, aggregation::ROW_NUMBER> {
   using type = cudf::size_type;
 };
 
+// Always use size_type for RANK
+template <typename Source>
+struct target_type_impl<Source, aggregation::RANK> {
+  using type = cudf::size_type;
+};
+
+// Always use size_type for DENSE_RANK
+template <typename Source>
+struct target_type_impl<Source, aggregation::DENSE_RANK> {
+  using type = cudf::size_type;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -381,6 +494,7 @@ using kind_to_type = typename kind_to_type_impl<k>::type;
 #endif
 
 AGG_KIND_MAPPING(aggregation::QUANTILE, quantile_aggregation);
+AGG_KIND_MAPPING(aggregation::APPROX_QUANTILE, approx_quantile_aggregation);
 AGG_KIND_MAPPING(aggregation::STD, std_var_aggregation);
 AGG_KIND_MAPPING(aggregation::VARIANCE, std_var_aggregation);
 
@@ -439,6 +553,18 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::NTH_ELEMENT>(std::forward<Ts>(args)...);
     case aggregation::ROW_NUMBER:
       return f.template operator()<aggregation::ROW_NUMBER>(std::forward<Ts>(args)...);
+    case aggregation::RANK:
+      return f.template operator()<aggregation::RANK>(std::forward<Ts>(args)...);
+    case aggregation::DENSE_RANK:
+      return f.template operator()<aggregation::DENSE_RANK>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_QUANTILE:
+      return f.template operator()<aggregation::APPROX_QUANTILE>(std::forward<Ts>(args)...);
+    case aggregation::LEAD:
+      return f.template operator()<aggregation::LEAD>(std::forward<Ts>(args)...);
+    case aggregation::LAG:
+      return f.template operator()<aggregation::LAG>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
@@ -77,5 +77,55 @@ std::unique_ptr<column> binary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::binary_operation(chunked_column_view const&, chunked_column_view const&,
+ * binary_operator, data_type, rmm::mr::device_memory_resource *)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> binary_operation(
+  chunked_column_view const& lhs,
+  chunked_column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::binary_operation(mutable_column_view&, scalar const&, column_view const&,
+ * binary_operator)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::binary_operation(mutable_column_view&, column_view const&, scalar const&,
+ * binary_operator)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::binary_operation(mutable_column_view&, column_view const&,
+ * column_view const&, binary_operator)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace cudf
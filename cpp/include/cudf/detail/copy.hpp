@@ -84,6 +84,28 @@ std::vector<contiguous_split_result> contiguous_split(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::pack
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream                 = 0);
+
+/**
+ * @brief Serializes the metadata of `table`, whose device memory is a single buffer starting
+ * at `base`, in the format read by `unpack`.
+ *
+ * Used to pack the results of `contiguous_split` without copying them again.
+ */
+std::vector<uint8_t> pack_metadata(table_view const& table, uint8_t const* base);
+
+/**
+ * @copydoc cudf::unpack(uint8_t const*, uint8_t const*)
+ */
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
+
 /**
  * @copydoc cudf::allocate_like(column_view const&, size_type, mask_allocation_policy,
  * rmm::mr::device_memory_resource*)
@@ -149,5 +171,38 @@ std::unique_ptr<column> copy_if_else(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::copy_if_else( column_view const&, column_view const&,
+ * bitmask_type const*, rmm::mr::device_memory_resource*, cudaStream_t)
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  column_view const& rhs,
+  bitmask_type const* condition,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::copy_if_else( scalar const&, column_view const&,
+ * bitmask_type const*, rmm::mr::device_memory_resource*, cudaStream_t)
+ */
+std::unique_ptr<column> copy_if_else(
+  scalar const& lhs,
+  column_view const& rhs,
+  bitmask_type const* condition,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::copy_if_else( column_view const&, scalar const&,
+ * bitmask_type const*, rmm::mr::device_memory_resource*, cudaStream_t)
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  scalar const& rhs,
+  bitmask_type const* condition,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -24,6 +24,7 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/strings/detail/copy_if_else.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -113,6 +114,18 @@ __launch_bounds__(block_size) __global__
 
 }  // anonymous namespace
 
+/**
+ * @brief Filter of `copy_if_else` selecting `lhs[i]` where bit `i` of a bitmask is set.
+ *
+ * The 32 lanes of a warp of `copy_if_else_kernel` process the 32 rows of one bitmask word,
+ * so they all test their bit in the same word, read with a single broadcast transaction.
+ */
+struct bitmask_filter {
+  bitmask_type const* condition;
+
+  __device__ bool operator()(size_type i) const { return bit_is_set(condition, i); }
+};
+
 /**
  * @brief Returns a new column, where each element is selected from either of two input ranges based
  * on a filter
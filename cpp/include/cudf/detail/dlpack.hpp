@@ -39,5 +39,24 @@ DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                            cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::from_dlpack_view
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
+/**
+ * @copydoc cudf::to_dlpack_view
+ */
+DLManagedTensor* to_dlpack_view(table_view const& input);
+
+/**
+ * @copydoc cudf::to_dlpack(contiguous_split_result&&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+DLManagedTensor* to_dlpack(contiguous_split_result&& input,
+                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                           cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -21,6 +21,7 @@
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/lists/detail/gather.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/gather.cuh>
 #include <cudf/table/table.hpp>
@@ -191,6 +192,41 @@ struct column_gatherer_impl<string_view, MapItType> {
   }
 };
 
+/*
+ * @brief Function object for gathering a type-erased
+ * column. To be used with the cudf::type_dispatcher.
+ *
+ */
+struct column_gatherer {
+  /*
+   * @brief Type-dispatched function to gather from one column to another based
+   * on a `gather_map`.
+   *
+   * @tparam Element Dispatched type for the column being gathered
+   * @tparam MapIterator Iterator type for the gather map
+   * @param source_column View into the column to gather from
+   * @param gather_map_begin Beginning of iterator range of integral values representing the gather
+   * map
+   * @param gather_map_end End of iterator range of integral values representing the gather map
+   * @param nullify_out_of_bounds Nullify values in `gather_map` that are out of bounds
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  template <typename Element, typename MapIterator>
+  std::unique_ptr<column> operator()(column_view const& source_column,
+                                     MapIterator gather_map_begin,
+                                     MapIterator gather_map_end,
+                                     bool nullify_out_of_bounds,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    column_gatherer_impl<Element, MapIterator> gatherer{};
+
+    return gatherer(
+      source_column, gather_map_begin, gather_map_end, nullify_out_of_bounds, mr, stream);
+  }
+};
+
 /**
  * @brief Column gather specialization for dictionary column type.
  */
@@ -229,20 +265,20 @@ struct column_gatherer_impl<dictionary32, MapItType> {
     auto keys_copy = std::make_unique<column>(dictionary.keys(), stream, mr);
     // create view of the indices column combined with the null mask
     // in order to call gather on it
-    column_view indices(data_type{INT32},
-                        dictionary.size(),
-                        dictionary.indices().data<int32_t>(),
-                        dictionary.null_mask(),
-                        dictionary.null_count(),
-                        dictionary.offset());
-    column_gatherer_impl<int32_t, MapItType> index_gatherer;
-    auto new_indices =
-      index_gatherer(indices, gather_map_begin, gather_map_end, nullify_out_of_bounds, mr, stream);
+    column_view indices = dictionary.get_indices_annotated();
+    auto new_indices    = type_dispatcher(indices.type(),
+                                          column_gatherer{},
+                                          indices,
+                                          gather_map_begin,
+                                          gather_map_end,
+                                          nullify_out_of_bounds,
+                                          mr,
+                                          stream);
     // dissect the column's contents
     auto null_count = new_indices->null_count();  // get this before it goes away
     auto contents   = new_indices->release();     // new_indices will now be empty
     // build the output indices column from the contents' data component
-    auto indices_column = std::make_unique<column>(data_type{INT32},
+    auto indices_column = std::make_unique<column>(indices.type(),
                                                    static_cast<size_type>(output_count),
                                                    std::move(*(contents.data.release())),
                                                    rmm::device_buffer{0, stream, mr},
@@ -255,41 +291,6 @@ struct column_gatherer_impl<dictionary32, MapItType> {
   }
 };
 
-/*
- * @brief Function object for gathering a type-erased
- * column. To be used with the cudf::type_dispatcher.
- *
- */
-struct column_gatherer {
-  /*
-   * @brief Type-dispatched function to gather from one column to another based
-   * on a `gather_map`.
-   *
-   * @tparam Element Dispatched type for the column being gathered
-   * @tparam MapIterator Iterator type for the gather map
-   * @param source_column View into the column to gather from
-   * @param gather_map_begin Beginning of iterator range of integral values representing the gather
-   * map
-   * @param gather_map_end End of iterator range of integral values representing the gather map
-   * @param nullify_out_of_bounds Nullify values in `gather_map` that are out of bounds
-   * @param mr Device memory resource used to allocate the returned column's device memory
-   * @param stream CUDA stream used for device memory operations and kernel launches.
-   */
-  template <typename Element, typename MapIterator>
-  std::unique_ptr<column> operator()(column_view const& source_column,
-                                     MapIterator gather_map_begin,
-                                     MapIterator gather_map_end,
-                                     bool nullify_out_of_bounds,
-                                     rmm::mr::device_memory_resource* mr,
-                                     cudaStream_t stream)
-  {
-    column_gatherer_impl<Element, MapIterator> gatherer{};
-
-    return gatherer(
-      source_column, gather_map_begin, gather_map_end, nullify_out_of_bounds, mr, stream);
-  }
-};
-
 /**
  * @brief Function object for applying a transformation on the gathermap
  * that converts negative indices to positive indices
@@ -402,6 +403,141 @@ void gather_bitmask(table_view const& source,
   }
 }
 
+/**
+ * @brief Device description of one fixed-width column gathered by `fused_gather_kernel`
+ */
+struct fused_gather_column {
+  void const* source;                // Source data, already adjusted for the offset
+  bitmask_type const* source_mask;   // Source null mask, `nullptr` if not nullable
+  size_type source_offset;           // Offset of the source column in bits of `source_mask`
+  void* target;                      // Output data
+  bitmask_type* target_mask;         // Output null mask, `nullptr` if the output has none
+  int32_t element_size;              // Size in bytes of the column elements
+};
+
+/**
+ * @brief Gathers the data and validity of all `columns` in a single pass over the gather map.
+ *
+ * Each thread handles one output row: it reads its gather map element once and copies that row
+ * of every column. The validity bits of a warp are combined with a ballot into one output word,
+ * so the null masks are written without atomics and the valid counts are accumulated per warp.
+ *
+ * The grid-stride loop keeps whole warps iterating while any of their rows is in range so that
+ * every lane of a warp takes part in each ballot.
+ *
+ * @tparam NullifyOutOfBounds Nullify, rather than read, rows with out of bounds map elements
+ * @tparam MapIterator Iterator type for the gather map
+ * @param columns Description of the columns to gather
+ * @param num_columns Number of columns in `columns`
+ * @param gather_map_begin Beginning of the gather map
+ * @param num_rows Number of output rows
+ * @param source_rows Number of rows of the source columns
+ * @param valid_counts Per-column counts of valid output rows, must be zero initialized
+ */
+template <bool NullifyOutOfBounds, typename MapIterator>
+__global__ void fused_gather_kernel(fused_gather_column const* columns,
+                                    size_type num_columns,
+                                    MapIterator gather_map_begin,
+                                    size_type num_rows,
+                                    size_type source_rows,
+                                    size_type* valid_counts)
+{
+  auto const lane   = static_cast<size_type>(threadIdx.x % warp_size);
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row - lane < num_rows;
+       row += stride) {
+    bool const active = row < num_rows;
+    auto const index  = active ? static_cast<size_type>(gather_map_begin[row]) : 0;
+    bool const in_bounds = active && (!NullifyOutOfBounds || (index >= 0 && index < source_rows));
+
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col = columns[c];
+      if (in_bounds) {
+        copy_fixed_width_element(col.source, col.target, index, row, col.element_size);
+      }
+      if (col.target_mask != nullptr) {
+        bool const valid =
+          in_bounds &&
+          (col.source_mask == nullptr || bit_is_set(col.source_mask, col.source_offset + index));
+        auto const word = __ballot_sync(0xffffffff, valid);
+        if (lane == 0) {
+          col.target_mask[word_index(row)] = word;
+          atomicAdd(valid_counts + c, __popc(word));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Gathers fixed-width columns with one kernel launch for all of them.
+ *
+ * Equivalent to gathering every column with `column_gatherer` followed by `gather_bitmask`, but
+ * reads the gather map once for the whole table instead of once per column and once more for the
+ * null masks. The source columns must all be fixed-width.
+ *
+ * @tparam MapIterator Iterator type for the gather map
+ * @param source_columns Fixed-width columns to gather from
+ * @param gather_map_begin Beginning of iterator range of integer indices
+ * @param gather_map_end End of iterator range of integer indices
+ * @param nullify_out_of_bounds Nullify values in `gather_map` that are out of bounds
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The gathered columns in the order of `source_columns`
+ */
+template <typename MapIterator>
+std::vector<std::unique_ptr<column>> gather_fixed_width_columns(
+  std::vector<column_view> const& source_columns,
+  MapIterator gather_map_begin,
+  MapIterator gather_map_end,
+  bool nullify_out_of_bounds,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  size_type const num_rows = std::distance(gather_map_begin, gather_map_end);
+
+  std::vector<std::unique_ptr<column>> targets;
+  thrust::host_vector<fused_gather_column> columns;
+  for (auto const& source : source_columns) {
+    auto target = allocate_like(source, num_rows, mask_allocation_policy::NEVER, mr, stream);
+    if (source.nullable() or nullify_out_of_bounds) {
+      target->set_null_mask(create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr), 0);
+    }
+    auto const element_size = static_cast<int32_t>(size_of(source.type()));
+    columns.push_back(fused_gather_column{
+      static_cast<int8_t const*>(source.head()) + source.offset() * element_size,
+      source.null_mask(),
+      source.offset(),
+      target->mutable_view().head(),
+      target->mutable_view().null_mask(),
+      element_size});
+    targets.push_back(std::move(target));
+  }
+  if (targets.empty() or num_rows == 0) { return targets; }
+
+  rmm::device_vector<fused_gather_column> d_columns(columns);
+  rmm::device_vector<size_type> d_valid_counts(columns.size(), 0);
+
+  constexpr size_type block_size = 256;
+  cudf::detail::grid_1d grid{num_rows, block_size};
+  auto const kernel = nullify_out_of_bounds ? fused_gather_kernel<true, MapIterator>
+                                            : fused_gather_kernel<false, MapIterator>;
+  kernel<<<grid.num_blocks, block_size, 0, stream>>>(d_columns.data().get(),
+                                                     static_cast<size_type>(columns.size()),
+                                                     gather_map_begin,
+                                                     num_rows,
+                                                     source_columns.front().size(),
+                                                     d_valid_counts.data().get());
+  CHECK_CUDA(stream);
+
+  auto const valid_counts = thrust::host_vector<size_type>(d_valid_counts);
+  for (size_t i = 0; i < targets.size(); ++i) {
+    if (targets[i]->nullable()) { targets[i]->set_null_count(num_rows - valid_counts[i]); }
+  }
+  return targets;
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -433,30 +569,100 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                               cudaStream_t stream                 = 0)
 {
-  auto num_destination_rows = std::distance(gather_map_begin, gather_map_end);
-
-  std::vector<std::unique_ptr<column>> destination_columns;
-
-  // TODO: Could be beneficial to use streams internally here
-
+  // Fixed-width columns are gathered together with one pass over the gather map; the others
+  // are gathered one column at a time and get their null masks from `gather_bitmask`
+  std::vector<column_view> fixed_width_columns;
+  std::vector<column_view> other_columns;
   for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(cudf::type_dispatcher(source_column.type(),
-                                                        column_gatherer{},
-                                                        source_column,
-                                                        gather_map_begin,
-                                                        gather_map_end,
-                                                        nullify_out_of_bounds,
-                                                        mr,
-                                                        stream));
+    (is_fixed_width(source_column.type()) ? fixed_width_columns : other_columns)
+      .push_back(source_column);
+  }
+
+  auto fixed_width_results = gather_fixed_width_columns(
+    fixed_width_columns, gather_map_begin, gather_map_end, nullify_out_of_bounds, mr, stream);
+
+  std::vector<std::unique_ptr<column>> other_results;
+  for (auto const& source_column : other_columns) {
+    other_results.push_back(cudf::type_dispatcher(source_column.type(),
+                                                  column_gatherer{},
+                                                  source_column,
+                                                  gather_map_begin,
+                                                  gather_map_end,
+                                                  nullify_out_of_bounds,
+                                                  mr,
+                                                  stream));
   }
 
   auto const op =
     nullify_out_of_bounds ? gather_bitmask_op::NULLIFY : gather_bitmask_op::DONT_CHECK;
-  gather_bitmask(source_table, gather_map_begin, destination_columns, op, mr, stream);
+  gather_bitmask(table_view{other_columns}, gather_map_begin, other_results, op, mr, stream);
+
+  // Restore the column order of the source table
+  std::vector<std::unique_ptr<column>> destination_columns;
+  auto fixed_width_it = fixed_width_results.begin();
+  auto other_it       = other_results.begin();
+  for (auto const& source_column : source_table) {
+    auto& result = is_fixed_width(source_column.type()) ? *fixed_width_it++ : *other_it++;
+    destination_columns.push_back(std::move(result));
+  }
 
   return std::make_unique<table>(std::move(destination_columns));
 }
 
+/**
+ * @brief Column gather specialization for lists column type.
+ *
+ * The offsets are rebased and the elements of all the gathered lists are then gathered with a
+ * single call to `gather` on the child column, which recurses into this specialization for
+ * nested lists.
+ */
+template <typename MapItType>
+struct column_gatherer_impl<list_view, MapItType> {
+  /**
+   * @brief Type-dispatched function to gather from one column to another based
+   * on a `gather_map`.
+   *
+   * @param source_column View into the column to gather from
+   * @param gather_map_begin Beginning of iterator range of integral values representing the gather
+   * map
+   * @param gather_map_end End of iterator range of integral values representing the gather map
+   * @param nullify_out_of_bounds Nullify values in `gather_map` that are out of bounds
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return New lists column with gathered rows, without a null mask.
+   */
+  std::unique_ptr<column> operator()(column_view const& source_column,
+                                     MapItType gather_map_begin,
+                                     MapItType gather_map_end,
+                                     bool nullify_out_of_bounds,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    size_type const output_count = std::distance(gather_map_begin, gather_map_end);
+    if (output_count == 0) { return make_empty_column(data_type{type_id::LIST}); }
+
+    lists_column_view const lists(source_column);
+    auto data = nullify_out_of_bounds
+                  ? lists::detail::make_gather_data<true>(
+                      lists, gather_map_begin, output_count, mr, stream)
+                  : lists::detail::make_gather_data<false>(
+                      lists, gather_map_begin, output_count, mr, stream);
+    auto child = gather(table_view{{lists.child()}},
+                        data.child_map.begin(),
+                        data.child_map.end(),
+                        false,
+                        mr,
+                        stream)
+                   ->release();
+    return make_lists_column(output_count,
+                             std::move(data.offsets),
+                             std::move(child.front()),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <cudf/table/table.hpp>
@@ -49,5 +50,17 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               negative_index_policy neg_indices,
                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                               cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::gather(chunked_table_view const&,column_view const&,bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> gather(chunked_table_view const& source_table,
+                              column_view const& gather_map,
+                              bool check_bounds,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream                 = 0);
 }  // namespace detail
 }  // namespace cudf
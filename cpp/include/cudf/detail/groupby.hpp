@@ -17,6 +17,10 @@
 #include <cudf/groupby.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/pair.h>
+
 #include <memory>
 #include <utility>
 
@@ -24,6 +28,22 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 namespace hash {
+/**
+ * @brief Groups of the rows of a table of keys found by a hash-based groupby
+ *
+ * A `groupby` object keeps the groups found by its first hash-based
+ * aggregation, so that later aggregations on the same keys find the group of
+ * every row without hashing the keys again, and return the groups in the same
+ * order.
+ */
+struct hash_groups {
+  /// Hash map entry of the group of each row; both members are
+  /// `std::numeric_limits<size_type>::max()` for the rows that are skipped
+  rmm::device_vector<thrust::pair<size_type, size_type>> row_groups;
+  /// Row of each group, indexing its results in the sparse result columns
+  rmm::device_vector<size_type> unique_rows;
+};
+
 /**
  * @brief Indicates if a set of aggregation requests can be satisfied with a
  * hash-based groupby implementation.
@@ -36,11 +56,24 @@ namespace hash {
  */
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests);
 
-// Hash-based groupby
+/**
+ * @brief Hash-based groupby
+ *
+ * @param keys The table of keys
+ * @param requests The set of columns to aggregate and the aggregations to
+ * perform
+ * @param include_null_keys Indicates whether rows in `keys` that contain
+ * NULL values should be included
+ * @param groups Groups of `keys` found by a previous call, or `nullptr`, in
+ * which case it is set to the groups found by this call
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ */
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
+  std::unique_ptr<hash_groups>& groups,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr);
 }  // namespace hash
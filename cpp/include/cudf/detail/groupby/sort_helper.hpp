@@ -18,11 +18,15 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/scratch_arena.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
@@ -54,22 +58,21 @@ struct sort_groupby_helper {
    *
    * @param keys table to group by
    * @param include_null_keys Include rows in keys with nulls
-   * @param keys_pre_sorted Indicate if the keys are already sorted. Enables
-   *                        optimizations to help skip re-sorting keys.
+   * @param keys_pre_sorted Indicate if the keys are already sorted, or at
+   *                        least grouped. Skips sorting the keys, and gathering
+   *                        the keys and values when no row is discarded.
    */
   sort_groupby_helper(table_view const& keys,
                       null_policy include_null_keys = null_policy::EXCLUDE,
                       sorted keys_pre_sorted        = sorted::NO)
-    : _keys(keys),
+    : _scratch(std::make_unique<cudf::detail::scratch_arena>(
+        scratch_size(keys, include_null_keys))),
+      _keys(keys),
       _num_keys(-1),
       _include_null_keys(include_null_keys),
       _keys_pre_sorted(keys_pre_sorted)
   {
-    if (keys_pre_sorted == sorted::YES and include_null_keys == null_policy::EXCLUDE and
-        has_nulls(keys)) {
-      _keys_pre_sorted = sorted::NO;
-    }
-  };
+  }
 
   ~sort_groupby_helper()                          = default;
   sort_groupby_helper(sort_groupby_helper const&) = delete;
@@ -144,6 +147,8 @@ struct sort_groupby_helper {
    * @brief Get the sorted order of `keys`.
    *
    * Gathering `keys` by sort order indices will produce the sorted key table.
+   * The sort is stable: rows with equivalent keys keep their relative order,
+   * which groupby scans rely on.
    *
    * When ignore_null_keys = true, the result will not include indices
    * for null keys.
@@ -200,6 +205,14 @@ struct sort_groupby_helper {
    */
   column_view unsorted_keys_labels(cudaStream_t stream = 0);
 
+  /**
+   * @brief Whether the sort order of `keys` is the order of their rows
+   *
+   * True if the keys are pre-sorted and no row is discarded, in which case
+   * the keys and values are already grouped and need no gather.
+   */
+  bool is_identity_sort_order(cudaStream_t stream = 0);
+
   /**
    * @brief Get the column representing the row bitmask for the `keys`
    *
@@ -215,6 +228,24 @@ struct sort_groupby_helper {
   column_view keys_bitmask_column(cudaStream_t stream = 0);
 
  private:
+  /**
+   * @brief Estimates the workspace size of the key sort order and of the row bitmask of `keys`
+   */
+  static std::size_t scratch_size(table_view const& keys, null_policy include_null_keys)
+  {
+    using cudf::detail::scratch_arena;
+    auto const num_rows = static_cast<std::size_t>(keys.num_rows());
+    auto size           = scratch_arena::aligned_size(num_rows * sizeof(size_type));
+    if (include_null_keys == null_policy::EXCLUDE &&
+        std::any_of(keys.begin(), keys.end(), [](auto const& col) { return col.nullable(); })) {
+      size += scratch_arena::aligned_size(num_rows) +
+              scratch_arena::aligned_size(bitmask_allocation_size_bytes(keys.num_rows()));
+    }
+    return size;
+  }
+
+  /// Workspace of the cached columns below, declared first so that it outlives them
+  std::unique_ptr<cudf::detail::scratch_arena> _scratch;
   column_ptr _key_sorted_order;      ///< Indices to produce _keys in sorted order
   column_ptr _unsorted_keys_labels;  ///< Group labels for unsorted _keys
   column_ptr _keys_bitmask_column;   ///< Column representing rows with one or more nulls values
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/hashing.hpp>
+#include <cudf/partitioning.hpp>
 
 namespace cudf {
 namespace detail {
@@ -31,6 +32,19 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::hash_partition_to_buffers
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<contiguous_split_result> hash_partition_to_buffers(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::hash
  *
@@ -38,6 +52,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
  */
 std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash = {},
+                             hash_id hash_function                     = hash_id::HASH_MURMUR3,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                              cudaStream_t stream                 = 0);
 
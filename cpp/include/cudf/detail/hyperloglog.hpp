@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Builds the HyperLogLog sketches of groups of values.
+ *
+ * The sketch of a group is a list of `2^precision` one-byte registers. Sketches
+ * are merged by keeping the largest value of every register.
+ *
+ * @throws cudf::logic_error if the registers of all groups do not fit in a column
+ *
+ * @param values Values to build the sketches of
+ * @param row_order Rows of `values` to add to the sketches, or `nullptr` to add
+ * every row in order
+ * @param row_groups Group of each row of `row_order`, or `nullptr` if all rows
+ * belong to a single group
+ * @param num_rows Number of rows to add
+ * @param num_groups Number of groups
+ * @param precision log2 of the number of registers per group
+ * @param null_handling Indicates if null values are added
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return `LIST<INT8>` column of the sketch of every group
+ */
+std::unique_ptr<column> hyperloglog_sketches(
+  column_view const& values,
+  size_type const* row_order,
+  size_type const* row_groups,
+  size_type num_rows,
+  size_type num_groups,
+  int precision,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Merges groups of HyperLogLog sketches.
+ *
+ * The rows of group `g` are `row_order[group_offsets[g]]` to
+ * `row_order[group_offsets[g + 1] - 1]`, e.g. the key sort order and the group
+ * offsets of a sort groupby.
+ *
+ * @throws cudf::logic_error if `sketches` are not sketches of `2^precision`
+ * registers without nulls
+ *
+ * @param sketches `LIST<INT8>` column of sketches, as built by `hyperloglog_sketches`
+ * @param row_order Rows of `sketches` in group order
+ * @param group_offsets Offsets of the groups in `row_order`, of size `num_groups + 1`
+ * @param num_groups Number of groups
+ * @param precision log2 of the number of registers per sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return `LIST<INT8>` column of the merged sketch of every group
+ */
+std::unique_ptr<column> merge_hyperloglog_sketches(
+  column_view const& sketches,
+  size_type const* row_order,
+  size_type const* group_offsets,
+  size_type num_groups,
+  int precision,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Estimates the number of unique values summarized by every HyperLogLog sketch.
+ *
+ * @throws cudf::logic_error if `sketches` are not sketches of `2^precision`
+ * registers without nulls
+ *
+ * @param sketches `LIST<INT8>` column of sketches, as built by `hyperloglog_sketches`
+ * @param precision log2 of the number of registers per sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return `size_type` column of the estimates
+ */
+std::unique_ptr<column> hyperloglog_estimate(
+  column_view const& sketches,
+  int precision,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Returns the word `destination_word_index` of the bits of `source` starting
+ * at `source_begin_bit`
+ *
+ * Bit `i` of the returned word is bit `source_begin_bit + destination_word_index * 32 + i` of
+ * `source`. Bits at or past `source_end_bit` are undefined.
+ *
+ * @param source The mask to read from
+ * @param destination_word_index The index of the word to return
+ * @param source_begin_bit The offset into `source` of the first bit of word 0
+ * @param source_end_bit The offset into `source` past the last bit to read
+ */
+__device__ inline bitmask_type get_mask_offset_word(bitmask_type const* __restrict__ source,
+                                                    size_type destination_word_index,
+                                                    size_type source_begin_bit,
+                                                    size_type source_end_bit)
+{
+  size_type source_word_index = destination_word_index + word_index(source_begin_bit);
+  bitmask_type curr_word      = source[source_word_index];
+  bitmask_type next_word      = 0;
+  if (word_index(source_end_bit - 1) >
+      word_index(source_begin_bit +
+                 destination_word_index * detail::size_in_bits<bitmask_type>())) {
+    next_word = source[source_word_index + 1];
+  }
+  return __funnelshift_r(curr_word, next_word, source_begin_bit);
+}
+
+/**
+ * @brief Computes a bitwise binary operation over an array of bitmasks, one word per
+ * thread
+ *
+ * @param op The bitwise operator combining two words
+ * @param destination The bitmask to write result into
+ * @param source Array of source mask pointers. All masks must be of same size
+ * @param begin_bit Array of offsets into corresponding @p source masks.
+ *                  Must be same size as source array
+ * @param num_sources Number of masks in @p source array
+ * @param source_size Number of bits in each mask in @p source
+ * @param number_of_mask_words The number of words of type bitmask_type to write
+ */
+template <typename Binop>
+__global__ void offset_bitmask_binop(Binop op,
+                                     bitmask_type* __restrict__ destination,
+                                     bitmask_type const* const* __restrict__ source,
+                                     size_type const* __restrict__ begin_bit,
+                                     size_type num_sources,
+                                     size_type source_size,
+                                     size_type number_of_mask_words)
+{
+  for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
+       destination_word_index < number_of_mask_words;
+       destination_word_index += blockDim.x * gridDim.x) {
+    bitmask_type destination_word = get_mask_offset_word(
+      source[0], destination_word_index, begin_bit[0], begin_bit[0] + source_size);
+    for (size_type i = 1; i < num_sources; i++) {
+      destination_word = op(destination_word,
+                            get_mask_offset_word(source[i],
+                                                 destination_word_index,
+                                                 begin_bit[i],
+                                                 begin_bit[i] + source_size));
+    }
+
+    destination[destination_word_index] = destination_word;
+  }
+}
+
+/**
+ * @brief Returns the bitwise binary operation `op` over the bits
+ * `[begin_bits[i], begin_bits[i] + mask_size)` of each of the bitmasks `masks[i]`
+ *
+ * @throw cudf::logic_error if `masks` is empty or contains a null pointer
+ *
+ * @param op The bitwise operator, e.g. `thrust::bit_and<bitmask_type>`
+ * @param masks The bitmasks to combine
+ * @param begin_bits The offset of the first bit of each mask
+ * @param mask_size The number of bits of the output
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return rmm::device_buffer Output bitmask
+ */
+template <typename Binop>
+rmm::device_buffer bitmask_binop(Binop op,
+                                 std::vector<bitmask_type const*> const& masks,
+                                 std::vector<size_type> const& begin_bits,
+                                 size_type mask_size,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(std::all_of(begin_bits.begin(), begin_bits.end(), [](auto b) { return b >= 0; }),
+               "Invalid range.");
+  CUDF_EXPECTS(mask_size > 0, "Invalid bit range.");
+  CUDF_EXPECTS(!masks.empty() && masks.size() == begin_bits.size(), "Invalid number of masks.");
+  CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
+               "Mask pointer cannot be null");
+
+  auto number_of_mask_words = num_bitmask_words(mask_size);
+
+  rmm::device_buffer dest_mask{bitmask_allocation_size_bytes(mask_size), stream, mr};
+
+  rmm::device_vector<bitmask_type const*> d_masks(masks);
+  rmm::device_vector<size_type> d_begin_bits(begin_bits);
+
+  cudf::detail::grid_1d config(number_of_mask_words, 256);
+  offset_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+    op,
+    static_cast<bitmask_type*>(dest_mask.data()),
+    d_masks.data().get(),
+    d_begin_bits.data().get(),
+    d_masks.size(),
+    mask_size,
+    number_of_mask_words);
+
+  CHECK_CUDA(stream);
+
+  return dest_mask;
+}
+
+}  // namespace detail
+}  // namespace cudf
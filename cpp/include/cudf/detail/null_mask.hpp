@@ -17,6 +17,8 @@
 
 #include <cudf/types.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 #include <vector>
 
 namespace cudf {
@@ -39,6 +41,63 @@ std::vector<size_type> segmented_count_unset_bits(bitmask_type const* bitmask,
                                                   std::vector<size_type> const& indices,
                                                   cudaStream_t stream = 0);
 
+/**
+ * @brief Counts the unset bits in the range `[begin_bits[i], end_bits[i])` of each bitmask
+ * `masks[i]`
+ *
+ * All the ranges are counted by a single kernel launch. A null mask has no unset bits.
+ *
+ * @throw cudf::logic_error if the numbers of masks and ranges differ or if a range is invalid
+ *
+ * @param masks The bitmasks to count
+ * @param begin_bits The index (inclusive) of the first bit to count in each mask
+ * @param end_bits The index (exclusive) of the last bit to count in each mask
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The number of unset bits in each range
+ */
+std::vector<size_type> batch_count_unset_bits(std::vector<bitmask_type const*> const& masks,
+                                              std::vector<size_type> const& begin_bits,
+                                              std::vector<size_type> const& end_bits,
+                                              cudaStream_t stream = 0);
+
+/**
+ * @brief Returns the bitwise AND of the bits `[begin_bits[i], begin_bits[i] + mask_size)` of
+ * each of the bitmasks `masks[i]`
+ *
+ * @throw cudf::logic_error if `masks` is empty or contains a null pointer
+ *
+ * @param masks The bitmasks to combine
+ * @param begin_bits The offset of the first bit of each mask
+ * @param mask_size The number of bits of the output
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return rmm::device_buffer Output bitmask
+ */
+rmm::device_buffer bitmask_and(std::vector<bitmask_type const*> const& masks,
+                               std::vector<size_type> const& begin_bits,
+                               size_type mask_size,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Returns the bitwise OR of the bits `[begin_bits[i], begin_bits[i] + mask_size)` of
+ * each of the bitmasks `masks[i]`
+ *
+ * @throw cudf::logic_error if `masks` is empty or contains a null pointer
+ *
+ * @param masks The bitmasks to combine
+ * @param begin_bits The offset of the first bit of each mask
+ * @param mask_size The number of bits of the output
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return rmm::device_buffer Output bitmask
+ */
+rmm::device_buffer bitmask_or(std::vector<bitmask_type const*> const& masks,
+                              std::vector<size_type> const& begin_bits,
+                              size_type mask_size,
+                              cudaStream_t stream,
+                              rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 
 }  // namespace cudf
@@ -18,6 +18,14 @@
 
 #include "nvtx3.hpp"
 
+#include <cudf/detail/utilities/device_view_cache.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+
 namespace cudf {
 /**
  * @brief Tag type for libcudf's NVTX domain.
@@ -28,10 +36,62 @@ struct libcudf_domain {
 };
 
 /**
- * @brief Alias for an NVTX range in the libcudf domain.
+ * @brief Returns whether libcudf emits NVTX ranges.
  *
+ * Ranges are emitted unless the `LIBCUDF_NVTX` environment variable is set to `OFF`. The
+ * variable is read once; afterwards a disabled range costs a single branch.
  */
-using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
+inline bool nvtx_enabled()
+{
+  static bool const enabled = [] {
+    auto const policy = std::getenv("LIBCUDF_NVTX");
+    return policy == nullptr || std::string(policy) != "OFF";
+  }();
+  return enabled;
+}
+
+/**
+ * @brief An NVTX range in the libcudf domain that is only emitted when `nvtx_enabled()`.
+ *
+ * Accepts the same arguments as `nvtx3::event_attributes`, e.g. a message and a payload:
+ * ```
+ * cudf::thread_range r{"decode", nvtx3::payload{num_rows}};
+ * ```
+ */
+class thread_range {
+ public:
+  explicit thread_range(::nvtx3::event_attributes const& attr) noexcept
+    : active_{nvtx_enabled()}
+  {
+    if (active_) { nvtxDomainRangePushEx(::nvtx3::domain::get<libcudf_domain>(), attr.get()); }
+  }
+
+  template <typename First,
+            typename... Args,
+            typename = std::enable_if_t<
+              not std::is_same<::nvtx3::event_attributes, std::decay_t<First>>::value>>
+  explicit thread_range(First const& first, Args const&... args) noexcept
+    : active_{nvtx_enabled()}
+  {
+    if (active_) {
+      nvtxDomainRangePushEx(::nvtx3::domain::get<libcudf_domain>(),
+                            ::nvtx3::event_attributes{first, args...}.get());
+    }
+  }
+
+  thread_range(thread_range const&) = delete;
+  thread_range& operator=(thread_range const&) = delete;
+  thread_range(thread_range&&)                 = delete;
+  thread_range& operator=(thread_range&&) = delete;
+
+  ~thread_range() noexcept
+  {
+    if (active_) { nvtxDomainRangePop(::nvtx3::domain::get<libcudf_domain>()); }
+  }
+
+ private:
+  bool const active_;
+};
 
 }  // namespace cudf
 
@@ -40,7 +100,9 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The range is skipped when `cudf::nvtx_enabled()` is false.
+ *
+ * The function is also measured while `cudf::metrics::is_enabled()`.
  *
  * Example:
  * ```
@@ -51,4 +113,56 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * ```
  *
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                                                                     \
+  static ::nvtx3::registered_message<cudf::libcudf_domain> const nvtx3_func_name__{__func__}; \
+  static ::nvtx3::event_attributes const nvtx3_func_attr__{nvtx3_func_name__};                \
+  cudf::thread_range const nvtx3_range__{nvtx3_func_attr__};                                  \
+  cudf::detail::operation_scope const cudf_operation_scope__{__func__};                       \
+  cudf::detail::device_view_cache_scope const cudf_device_view_cache_scope__;
+
+#define CUDF_NVTX_CONCAT_IMPL(a, b) a##b
+#define CUDF_NVTX_CONCAT(a, b) CUDF_NVTX_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Convenience macro for generating a named NVTX range in the `libcudf`
+ * domain from the remaining lifetime of the enclosing scope.
+ *
+ * Used to mark the phases of an API, e.g. the decompression and decoding steps
+ * of a reader. `name` must be a string literal.
+ *
+ * Example:
+ * ```
+ * {
+ *    CUDF_SCOPED_RANGE("decode");
+ *    ...
+ * }
+ * ```
+ *
+ */
+#define CUDF_SCOPED_RANGE(name)                                                    \
+  static ::nvtx3::registered_message<cudf::libcudf_domain> const CUDF_NVTX_CONCAT( \
+    nvtx3_scope_name__, __LINE__){name};                                           \
+  cudf::thread_range const CUDF_NVTX_CONCAT(nvtx3_scope_range__, __LINE__)         \
+  {                                                                                \
+    CUDF_NVTX_CONCAT(nvtx3_scope_name__, __LINE__)                                 \
+  }
+
+/**
+ * @brief Like `CUDF_SCOPED_RANGE`, with an integral payload attached to the range.
+ *
+ * The payload makes per-call sizes, e.g. row counts, visible in the profile.
+ *
+ * Example:
+ * ```
+ * CUDF_SCOPED_RANGE_PAYLOAD("join_build", build.num_rows());
+ * ```
+ *
+ */
+#define CUDF_SCOPED_RANGE_PAYLOAD(name, value)                                     \
+  static ::nvtx3::registered_message<cudf::libcudf_domain> const CUDF_NVTX_CONCAT( \
+    nvtx3_scope_name__, __LINE__){name};                                           \
+  cudf::thread_range const CUDF_NVTX_CONCAT(nvtx3_scope_range__, __LINE__)         \
+  {                                                                                \
+    CUDF_NVTX_CONCAT(nvtx3_scope_name__, __LINE__),                                \
+      ::nvtx3::payload { static_cast<int64_t>(value) }                             \
+  }
@@ -151,7 +151,9 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
  * @param[in] valid_count   the intermediate operator argument 1
  * @param[in] ddof      the intermediate operator argument 2
  * @param[in] stream    CUDA stream used for device memory operations and kernel launches.
- * @returns   Output scalar in device memory
+ * @returns   Output scalar in device memory, valid if `valid_count > 0`
+ *
+ * No stream synchronization is performed; the result may be consumed on `stream` directly.
  *
  * The reduction operator must have `intermediate::compute_result()` method.
  * This method performs reduction using binary operator `Op::Op` and transforms the
@@ -200,15 +202,19 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
                             identity,
                             stream);
 
-  // compute the result value from intermediate value in device
+  // compute the result value and its validity from intermediate value in device, so the
+  // intermediate value is never copied back to the host
   using ScalarType = cudf::scalar_type_t<OutputType>;
   auto result      = new ScalarType(OutputType{0}, true, stream, mr);
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     intermediate_result.data(),
-                     1,
-                     [dres = result->data(), cop, valid_count, ddof] __device__(auto i) {
-                       *dres = cop.template compute_result<OutputType>(i, valid_count, ddof);
-                     });
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    intermediate_result.data(),
+    1,
+    [dres = result->data(), dvalid = result->validity_data(), cop, valid_count, ddof] __device__(
+      auto i) {
+      *dres   = cop.template compute_result<OutputType>(i, valid_count, ddof);
+      *dvalid = valid_count > 0;
+    });
   return std::unique_ptr<scalar>(result);
 }
 
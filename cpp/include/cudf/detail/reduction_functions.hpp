@@ -16,8 +16,14 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
 
 namespace cudf {
 namespace reduction {
@@ -210,5 +216,43 @@ std::unique_ptr<scalar> standard_deviation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Computes the reduction of the values in each segment of a column
+ *
+ * The segments with no valid element are null.
+ *
+ * @throw cudf::logic_error if `kind` is not `SUM`, `PRODUCT`, `MIN`, `MAX`, `ANY`
+ * or `ALL`, or if input and output column types are not arithmetic types
+ *
+ * @param col input column to reduce the segments of.
+ * @param offsets `INT32` offsets of the segments, including the end offset of the last segment.
+ * @param kind aggregation applied by the reduction.
+ * @param output_dtype data type of return type and typecast elements of input column.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of the reduction of every segment, of type `output_dtype`.
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& col,
+  column_view const& offsets,
+  aggregation::Kind kind,
+  data_type const output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Computes several reductions of every column of a table
+ *
+ * @copydetails cudf::reduce(table_view const&, std::vector<std::unique_ptr<aggregation>> const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> reduce_columns(
+  table_view const& input,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace reduction
 }  // namespace cudf
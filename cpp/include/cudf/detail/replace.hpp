@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <cudf/replace.hpp>
 #include <cudf/types.hpp>
+
+#include <functional>
 #include <memory>
+#include <vector>
 
 // Forward declaration
 
@@ -47,6 +51,39 @@ std::unique_ptr<column> replace_nulls(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::replace_nulls_in_place(mutable_column_view&, scalar const&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void replace_nulls_in_place(mutable_column_view& in_out,
+                            scalar const& replacement,
+                            cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::replace_nulls(table_view const&,
+ * std::vector<std::reference_wrapper<scalar const>> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::replace_nulls(table_view const&, replace_policy,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  replace_policy policy,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::replace_nans(column_view const&, column_view const&,
  * rmm::mr::device_memory_resource*)
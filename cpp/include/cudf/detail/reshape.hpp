@@ -31,5 +31,18 @@ std::unique_ptr<table> tile(table_view const& input,
                             size_type count,
                             cudaStream_t stream                 = 0,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::explode
+ *
+ * @param include_position Whether to add the position of every element within its list
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<table> explode(
+  table_view const& input_table,
+  size_type explode_column_idx,
+  bool include_position,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 }  // namespace detail
 }  // namespace cudf
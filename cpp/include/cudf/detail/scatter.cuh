@@ -23,10 +23,13 @@
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/lists/detail/concatenate.hpp>
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/traits.hpp>
 
+#include <thrust/sequence.h>
+
 namespace cudf {
 namespace detail {
 
@@ -115,6 +118,41 @@ struct column_scatterer_impl<string_view, MapIterator> {
   }
 };
 
+template <typename MapIterator>
+struct column_scatterer_impl<list_view, MapIterator> {
+  std::unique_ptr<column> operator()(column_view const& source,
+                                     MapIterator scatter_map_begin,
+                                     MapIterator scatter_map_end,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const
+  {
+    if (target.size() == 0) { return make_empty_column(data_type{type_id::LIST}); }
+
+    // The scattered rows are gathered from the source and all the other rows from the target
+    // out of the concatenation of both, so the elements are copied by one gather per level
+    size_type const scatter_rows = std::distance(scatter_map_begin, scatter_map_end);
+    auto const combined          = lists::detail::concatenate(
+      {cudf::slice(source, {0, scatter_rows}).front(), target},
+      rmm::mr::get_default_resource(),
+      stream);
+    rmm::device_vector<size_type> gather_map(target.size());
+    thrust::sequence(
+      rmm::exec_policy(stream)->on(stream), gather_map.begin(), gather_map.end(), scatter_rows);
+    thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(scatter_rows),
+                    scatter_map_begin,
+                    gather_map.begin());
+    auto result = gather(
+      table_view{{combined->view()}}, gather_map.begin(), gather_map.end(), false, mr, stream);
+    return std::move(result->release().front());
+  }
+};
+
+template <typename MapIterator>
+struct column_scatterer;
+
 template <typename MapIterator>
 struct column_scatterer_impl<dictionary32, MapIterator> {
   std::unique_ptr<column> operator()(column_view const& source_in,
@@ -145,13 +183,19 @@ struct column_scatterer_impl<dictionary32, MapIterator> {
     // now build the new indices by doing a scatter on just the matched indices
     column_view const source_indices = source_view.get_indices_annotated();
     column_view const target_indices = target_view.get_indices_annotated();
-    column_scatterer_impl<int32_t, MapIterator> index_scatterer;
-    auto new_indices = index_scatterer(
-      source_indices, scatter_map_begin, scatter_map_end, target_indices, mr, stream);
+    // both key sets are the same so the indices have the same type
+    auto new_indices = type_dispatcher(source_indices.type(),
+                                       column_scatterer<MapIterator>{},
+                                       source_indices,
+                                       scatter_map_begin,
+                                       scatter_map_end,
+                                       target_indices,
+                                       mr,
+                                       stream);
     auto const output_size = new_indices->size();        // record these
     auto const null_count  = new_indices->null_count();  // before the release
     auto contents          = new_indices->release();
-    auto indices_column    = std::make_unique<column>(data_type{INT32},
+    auto indices_column    = std::make_unique<column>(target_indices.type(),
                                                    static_cast<size_type>(output_size),
                                                    std::move(*(contents.data.release())),
                                                    rmm::device_buffer{0, stream, mr},
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/selection.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief A column_view of the rows of a column with its unselected rows masked as nulls, along
+ * with the null mask it views
+ */
+struct selected_column {
+  rmm::device_buffer null_mask;  ///< Null mask of `view`
+  column_view view;              ///< Data of the input column, with the null mask `null_mask`
+};
+
+/**
+ * @brief Masks as nulls the rows of `input` that are not selected by `rows`.
+ *
+ * The data of `input` is not copied: only a new null mask, valid for the selected non-null rows
+ * of `input`, is allocated.
+ *
+ * @throws cudf::logic_error if a `BOOLEAN_MASK` selection does not have as many rows as `input`.
+ *
+ * @param input The column to mask
+ * @param rows The selected rows of `input`
+ * @param mr Device memory resource used to allocate the returned null mask
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+selected_column mask_unselected_rows(
+  column_view const& input,
+  selection const& rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::apply_selection
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> apply_selection(
+  table_view const& input,
+  selection const& rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -46,6 +46,17 @@ std::unique_ptr<table> apply_boolean_mask(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::apply_predicates
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> apply_predicates(
+  table_view const& input,
+  std::vector<column_predicate> const& predicates,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::drop_duplicates
  *
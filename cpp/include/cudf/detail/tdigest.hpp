@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Builds the t-digests of groups of values.
+ *
+ * The t-digest of a group is held by a table of four columns, in order:
+ * - the means of its centroids, as a `LIST<FLOAT64>` sorted in ascending order
+ * - the weights of its centroids, as a `LIST<FLOAT64>`
+ * - the minimum and the maximum of its values, as `FLOAT64`
+ *
+ * The lists of a group without valid values are empty, and its minimum and
+ * maximum are null. Null and NaN values are ignored.
+ *
+ * @throws cudf::logic_error if `values` is not numeric
+ *
+ * @param values Values to build the t-digests of
+ * @param row_order Rows of `values` to add to the t-digests, or `nullptr` to
+ * add every row in order
+ * @param row_groups Group of each row of `row_order`, or `nullptr` if all rows
+ * belong to a single group
+ * @param num_rows Number of rows to add
+ * @param num_groups Number of groups
+ * @param compression Compression of the t-digests
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Table of the t-digest of every group
+ */
+std::unique_ptr<table> group_tdigests(
+  column_view const& values,
+  size_type const* row_order,
+  size_type const* row_groups,
+  size_type num_rows,
+  size_type num_groups,
+  double compression,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Merges groups of t-digests.
+ *
+ * The rows of group `g` are `row_order[group_offsets[g]]` to
+ * `row_order[group_offsets[g + 1] - 1]`, e.g. the key sort order and the group
+ * offsets of a sort groupby.
+ *
+ * @throws cudf::logic_error if `digests` is not a table of t-digests, as built
+ * by `group_tdigests`
+ *
+ * @param digests Table of the t-digests to merge
+ * @param row_order Rows of `digests` in group order
+ * @param group_offsets Offsets of the groups in `row_order`, of size `num_groups + 1`
+ * @param num_groups Number of groups
+ * @param compression Compression of the t-digests
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Table of the merged t-digest of every group
+ */
+std::unique_ptr<table> merge_tdigests(
+  table_view const& digests,
+  size_type const* row_order,
+  size_type const* group_offsets,
+  size_type num_groups,
+  double compression,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Estimates quantiles of the values summarized by every t-digest.
+ *
+ * Element `i * quantiles.size() + j` of the result is quantile `j` of
+ * t-digest `i`, as for the `QUANTILE` groupby aggregation. The estimates of
+ * empty t-digests are null.
+ *
+ * @throws cudf::logic_error if `digests` is not a table of t-digests, as built
+ * by `group_tdigests`
+ *
+ * @param digests Table of the t-digests
+ * @param quantiles Quantiles in range [0, 1]
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return `FLOAT64` column of the estimates
+ */
+std::unique_ptr<column> tdigest_quantiles(
+  table_view const& digests,
+  std::vector<double> const& quantiles,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -66,6 +66,15 @@ std::unique_ptr<cudf::column> unary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::unary_operation_in_place
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void unary_operation_in_place(cudf::mutable_column_view& in_out,
+                              cudf::unary_op op,
+                              cudaStream_t stream = 0);
+
 /**
  * @copydoc cudf::cast
  *
@@ -107,6 +107,28 @@ __device__ T single_lane_block_sum_reduce(T lane_value)
   return result;
 }
 
+/**
+ * @brief Copies one element of `element_size` bytes from `source[from]` to `target[to]`
+ */
+__device__ inline void copy_fixed_width_element(
+  void const* source, void* target, size_type from, size_type to, int32_t element_size)
+{
+  switch (element_size) {
+    case 1:
+      static_cast<int8_t*>(target)[to] = static_cast<int8_t const*>(source)[from];
+      break;
+    case 2:
+      static_cast<int16_t*>(target)[to] = static_cast<int16_t const*>(source)[from];
+      break;
+    case 4:
+      static_cast<int32_t*>(target)[to] = static_cast<int32_t const*>(source)[from];
+      break;
+    default:
+      static_cast<int64_t*>(target)[to] = static_cast<int64_t const*>(source)[from];
+      break;
+  }
+}
+
 /**
  * @brief Get the number of elements that can be processed per thread.
  *
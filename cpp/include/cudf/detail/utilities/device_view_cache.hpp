@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Identifies the device descriptors of a table or column view: the type and scale, size,
+ * data, null mask and offset of every column and child column, and the stream and device they
+ * are on.
+ *
+ * Two views with equal keys have byte-identical descriptors, so the descriptors can be shared.
+ */
+using device_view_key = std::vector<int64_t>;
+
+/**
+ * @brief Returns the key of the descriptors of a table made of `columns`, or of the children
+ * of a column when `is_table` is false
+ */
+device_view_key make_device_view_key(std::vector<column_view> const& columns,
+                                     bool is_table,
+                                     cudaStream_t stream);
+
+/**
+ * @brief Whether descriptors are cached on the calling thread, that is whether a
+ * `device_view_cache_scope` is alive.
+ */
+bool device_view_cache_active() noexcept;
+
+/**
+ * @brief Returns the descriptors cached for `key` on the calling thread, or null.
+ */
+std::shared_ptr<rmm::device_buffer> find_cached_device_view(device_view_key const& key);
+
+/**
+ * @brief Caches the descriptors of `key` until the outermost `device_view_cache_scope` of the
+ * calling thread ends. Does nothing outside of a scope or when the cache is full.
+ */
+void cache_device_view(device_view_key key, std::shared_ptr<rmm::device_buffer> storage);
+
+void enter_device_view_cache() noexcept;
+
+void exit_device_view_cache() noexcept;
+
+/**
+ * @brief Shares the device descriptors created by `table_device_view::create` and
+ * `column_device_view::create` for the same views during the lifetime of the object.
+ *
+ * An API call often views the same tables several times; their descriptors are then allocated
+ * and copied to the device once. The cache is per thread and is cleared, freeing the
+ * descriptors on their streams, when the outermost scope ends, so cached memory never outlives
+ * an API call. `CUDF_FUNC_RANGE` opens a scope.
+ */
+class device_view_cache_scope {
+ public:
+  device_view_cache_scope() noexcept { enter_device_view_cache(); }
+
+  device_view_cache_scope(device_view_cache_scope const&) = delete;
+  device_view_cache_scope& operator=(device_view_cache_scope const&) = delete;
+
+  ~device_view_cache_scope() noexcept { exit_device_view_cache(); }
+};
+
+}  // namespace detail
+}  // namespace cudf
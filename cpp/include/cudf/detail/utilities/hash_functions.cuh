@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/traits.hpp>
 
 using hash_value_type = uint32_t;
 
@@ -35,6 +36,7 @@ struct MurmurHash3_32 {
   using result_type   = hash_value_type;
 
   CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32() : m_seed(0) {}
+  CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32(uint32_t seed) : m_seed(seed) {}
 
   CUDA_HOST_DEVICE_CALLABLE uint32_t rotl32(uint32_t x, int8_t r) const
   {
@@ -211,6 +213,362 @@ MurmurHash3_32<double>::operator()(double const& key) const
   return this->compute_floating_point(key);
 }
 
+/**
+ * @brief 64-bit hash function implementing xxHash64.
+ *
+ * Follows the XXH64 algorithm of https://github.com/Cyan4973/xxHash, which is distributed under
+ * the BSD 2-Clause license. Inputs of 32 bytes or more are consumed in stripes of four
+ * independent 8-byte lanes, so the multiplications of a stripe can be issued back to back. The
+ * bytes are assembled individually, so the input does not need to be aligned.
+ *
+ * The 64-bit hash values collide much less often than the 32-bit values of `MurmurHash3_32` on
+ * tables of billions of rows.
+ */
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64() : m_seed(0) {}
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  /**
+   * @brief Combines two hash values into a new single hash value.
+   *
+   * 64-bit variant of the Boost hash_combine function
+   * https://www.boost.org/doc/libs/1_35_0/doc/html/boost/hash_combine_id241013.html
+   *
+   * @param lhs The first hash value to combine
+   * @param rhs The second hash value to combine
+   *
+   * @returns A hash value that intelligently combines the lhs and rhs hash values
+   */
+  CUDA_HOST_DEVICE_CALLABLE result_type hash_combine(result_type lhs, result_type rhs) const
+  {
+    result_type combined{lhs};
+
+    combined ^= rhs + 0x9e3779b97f4a7c15ull + (combined << 6) + (combined >> 2);
+
+    return combined;
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  // compute wrapper for floating point types
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_floating_point(T const& key) const
+  {
+    if (key == T{0.0}) {
+      // -0.0 and 0.0 hash the same
+      return compute(T{0.0});
+    } else if (isnan(key)) {
+      T nan = std::numeric_limits<T>::quiet_NaN();
+      return compute(nan);
+    } else {
+      return compute(key);
+    }
+  }
+
+  template <typename TKey>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+  /**
+   * @brief Computes the hash value of `len` bytes starting at `data`.
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(uint8_t const* data, uint64_t len) const
+  {
+    uint64_t offset = 0;
+    uint64_t h64;
+    //----------
+    // stripes of 32 bytes
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      for (; offset + 32 <= len; offset += 32) {
+        v1 = round(v1, load64(data + offset));
+        v2 = round(v2, load64(data + offset + 8));
+        v3 = round(v3, load64(data + offset + 16));
+        v4 = round(v4, load64(data + offset + 24));
+      }
+      h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h64 = merge_round(h64, v1);
+      h64 = merge_round(h64, v2);
+      h64 = merge_round(h64, v3);
+      h64 = merge_round(h64, v4);
+    } else {
+      h64 = m_seed + prime5;
+    }
+    h64 += len;
+    //----------
+    // tail
+    for (; offset + 8 <= len; offset += 8) {
+      h64 ^= round(0, load64(data + offset));
+      h64 = rotl64(h64, 27) * prime1 + prime4;
+    }
+    if (offset + 4 <= len) {
+      h64 ^= static_cast<uint64_t>(load32(data + offset)) * prime1;
+      h64 = rotl64(h64, 23) * prime2 + prime3;
+      offset += 4;
+    }
+    for (; offset < len; ++offset) {
+      h64 ^= data[offset] * prime5;
+      h64 = rotl64(h64, 11) * prime1;
+    }
+    //----------
+    // finalization
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+
+ private:
+  static constexpr uint64_t prime1 = 0x9e3779b185ebca87ull;
+  static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4full;
+  static constexpr uint64_t prime3 = 0x165667b19e3779f9ull;
+  static constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ull;
+  static constexpr uint64_t prime5 = 0x27d4eb2f165667c5ull;
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t round(uint64_t acc, uint64_t input) const
+  {
+    acc += input * prime2;
+    acc = rotl64(acc, 31);
+    return acc * prime1;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t merge_round(uint64_t acc, uint64_t val) const
+  {
+    acc ^= round(0, val);
+    return acc * prime1 + prime4;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t load32(uint8_t const* p) const
+  {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t load64(uint8_t const* p) const
+  {
+    return static_cast<uint64_t>(load32(p)) | (static_cast<uint64_t>(load32(p + 4)) << 32);
+  }
+
+  uint64_t m_seed;
+};
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<bool>::operator()(bool const& key) const
+{
+  return this->compute(static_cast<uint8_t>(key));
+}
+
+/**
+ * @brief Specialization of XXHash_64 operator for strings.
+ */
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE
+XXHash_64<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<float>::operator()(float const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<double>::operator()(double const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+/**
+ * @brief MurmurHash3_32 hash function producing the hash values of Spark's `Murmur3Hash`.
+ *
+ * Follows `org.apache.spark.unsafe.hash.Murmur3_x86_32`: integers of up to 4 bytes are hashed
+ * as a sign-extended 4-byte int and 8-byte integers as a long, floating point values are hashed
+ * as their bits after turning -0.0 into 0.0 and every NaN into the canonical NaN, and the
+ * trailing bytes of strings are each mixed in as a signed byte. Timestamps and durations are
+ * hashed as their tick count, which matches Spark for `TIMESTAMP_DAYS` (`DateType`) and
+ * `TIMESTAMP_MICROSECONDS` (`TimestampType`).
+ *
+ * Spark chains the columns of a row by using the hash value of the previous columns as the seed
+ * of the next one, see the `row_hasher` specialization for this hash function.
+ */
+template <typename Key>
+struct SparkMurmurHash3_32 {
+  using argument_type = Key;
+  using result_type   = hash_value_type;
+
+  /// Seed of Spark's `Murmur3Hash` expression and `HashPartitioning`
+  static constexpr uint32_t default_seed = 42;
+
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32() : m_seed(default_seed) {}
+
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32(uint32_t seed) : m_seed(seed) {}
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t rotl32(uint32_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (32 - r));
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_k1(uint32_t k1) const
+  {
+    k1 *= 0xcc9e2d51;
+    k1 = rotl32(k1, 15);
+    return k1 * 0x1b873593;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_h1(uint32_t h1, uint32_t k1) const
+  {
+    h1 ^= k1;
+    h1 = rotl32(h1, 13);
+    return h1 * 5 + 0xe6546b64;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t fmix32(uint32_t h1, uint32_t len) const
+  {
+    h1 ^= len;
+    h1 ^= h1 >> 16;
+    h1 *= 0x85ebca6b;
+    h1 ^= h1 >> 13;
+    h1 *= 0xc2b2ae35;
+    h1 ^= h1 >> 16;
+    return h1;
+  }
+
+  /**
+   * @brief Combines two hash values into a new single hash value.
+   *
+   * Taken from the Boost hash_combine function
+   * https://www.boost.org/doc/libs/1_35_0/doc/html/boost/hash_combine_id241013.html
+   *
+   * @note Spark does not combine hash values, it chains them through the seed.
+   */
+  CUDA_HOST_DEVICE_CALLABLE result_type hash_combine(result_type lhs, result_type rhs) const
+  {
+    result_type combined{lhs};
+
+    combined ^= rhs + 0x9e3779b9 + (combined << 6) + (combined >> 2);
+
+    return combined;
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  /// Spark's `hashInt`
+  result_type CUDA_HOST_DEVICE_CALLABLE hash_int(uint32_t key) const
+  {
+    return fmix32(mix_h1(m_seed, mix_k1(key)), 4);
+  }
+
+  /// Spark's `hashLong`
+  result_type CUDA_HOST_DEVICE_CALLABLE hash_long(uint64_t key) const
+  {
+    auto const h1 = mix_h1(m_seed, mix_k1(static_cast<uint32_t>(key)));
+    return fmix32(mix_h1(h1, mix_k1(static_cast<uint32_t>(key >> 32))), 8);
+  }
+
+  /// Spark's `hashUnsafeBytes`
+  result_type CUDA_HOST_DEVICE_CALLABLE hash_bytes(uint8_t const* data, uint32_t len) const
+  {
+    uint32_t h1 = m_seed;
+    uint32_t i  = 0;
+    for (; i + 4 <= len; i += 4) {
+      uint32_t const k1 = static_cast<uint32_t>(data[i]) |
+                          (static_cast<uint32_t>(data[i + 1]) << 8) |
+                          (static_cast<uint32_t>(data[i + 2]) << 16) |
+                          (static_cast<uint32_t>(data[i + 3]) << 24);
+      h1 = mix_h1(h1, mix_k1(k1));
+    }
+    for (; i < len; ++i) {
+      h1 = mix_h1(h1, mix_k1(static_cast<uint32_t>(static_cast<int8_t>(data[i]))));
+    }
+    return fmix32(h1, len);
+  }
+
+  template <typename TKey, std::enable_if_t<std::is_integral<TKey>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return sizeof(TKey) == 8 ? hash_long(static_cast<uint64_t>(key))
+                             : hash_int(static_cast<uint32_t>(static_cast<int32_t>(key)));
+  }
+
+  template <typename TKey, std::enable_if_t<cudf::is_timestamp<TKey>()>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute(key.time_since_epoch().count());
+  }
+
+  template <typename TKey, std::enable_if_t<cudf::is_duration<TKey>()>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute(key.count());
+  }
+
+  template <typename TKey,
+            std::enable_if_t<not std::is_integral<TKey>::value and not cudf::is_chrono<TKey>()>* =
+              nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return hash_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+ private:
+  uint32_t m_seed;
+};
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<float>::operator()(float const& key) const
+{
+  // Java's floatToIntBits turns every NaN into the canonical NaN
+  float const normalized = key == 0.0f   ? 0.0f
+                           : isnan(key) ? std::numeric_limits<float>::quiet_NaN()
+                                        : key;
+  uint32_t bits;
+  memcpy(&bits, &normalized, sizeof(bits));
+  return this->hash_int(bits);
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<double>::operator()(double const& key) const
+{
+  // Java's doubleToLongBits turns every NaN into the canonical NaN
+  double const normalized = key == 0.0   ? 0.0
+                            : isnan(key) ? std::numeric_limits<double>::quiet_NaN()
+                                         : key;
+  uint64_t bits;
+  memcpy(&bits, &normalized, sizeof(bits));
+  return this->hash_long(bits);
+}
+
+/**
+ * @brief Specialization of SparkMurmurHash3_32 operator for strings.
+ */
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+  return this->hash_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Estimates the device memory of a column made of `num_rows` rows gathered from `input`.
+ *
+ * Only the sizes and types of `input` and its children are used. Fixed-width data and null masks
+ * are sized exactly; variable-width children, such as the characters of strings or the elements
+ * of lists, are scaled from the average size of the rows of `input`. The keys of a dictionary
+ * column are shared by the gathered rows and counted once.
+ *
+ * @param input Column the rows are gathered from
+ * @param num_rows Number of gathered rows
+ * @param nullable Whether the gathered column has a null mask even if `input` has none
+ * @return Estimated number of bytes of the gathered column
+ */
+std::size_t estimate_gathered_size(column_view const& input,
+                                   size_type num_rows,
+                                   bool nullable = false);
+
+/**
+ * @copydoc cudf::detail::estimate_gathered_size(column_view const&, size_type, bool)
+ *
+ * @return Estimated number of bytes of all the gathered columns
+ */
+std::size_t estimate_gathered_size(table_view const& input,
+                                   size_type num_rows,
+                                   bool nullable = false);
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Whether `cudf::metrics::enable()` is in effect
+ */
+extern std::atomic<bool> metrics_enabled;
+
+/**
+ * @brief Starts measuring an API call on the calling thread, unless an outer call is measured.
+ */
+void begin_operation(char const* name) noexcept;
+
+/**
+ * @brief Ends the API call started by the matching `begin_operation` and records it if it is
+ * the outermost one.
+ */
+void end_operation() noexcept;
+
+/**
+ * @brief Attributes an allocation, or a deallocation when `bytes` is negative, to the API call
+ * measured on the calling thread.
+ */
+void track_allocation(int64_t bytes) noexcept;
+
+/**
+ * @brief Measures an API call from the lifetime of the object.
+ *
+ * When metrics are disabled, costs a relaxed atomic load.
+ */
+class operation_scope {
+ public:
+  explicit operation_scope(char const* name) noexcept
+    : _measured{metrics_enabled.load(std::memory_order_relaxed)}
+  {
+    if (_measured) { begin_operation(name); }
+  }
+
+  operation_scope(operation_scope const&) = delete;
+  operation_scope& operator=(operation_scope const&) = delete;
+
+  ~operation_scope() noexcept
+  {
+    if (_measured) { end_operation(); }
+  }
+
+ private:
+  bool const _measured;
+};
+
+}  // namespace detail
+}  // namespace cudf
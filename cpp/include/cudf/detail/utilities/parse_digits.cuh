@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+/**
+ * @file Device utilities for parsing base-10 digits
+ *
+ * Runs of digits are parsed eight characters at a time: the characters are loaded as a single
+ * 64-bit word, checked to be all digits and converted with a few multiplies instead of one
+ * multiply-add per digit.
+ */
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Loads the eight characters starting at `ptr` into a 64-bit word.
+ *
+ * The first character is in the lowest byte. The load uses the aligned words containing the
+ * first and last characters so no byte outside those words is read.
+ *
+ * @param ptr Pointer to at least eight readable characters.
+ * @return The characters as a little-endian 64-bit word.
+ */
+__device__ inline uint64_t load_eight_chars(const char* ptr)
+{
+  auto const address = reinterpret_cast<uintptr_t>(ptr);
+  auto const aligned = reinterpret_cast<const uint64_t*>(address & ~uintptr_t{7});
+  auto const shift   = static_cast<uint32_t>(address & 7) * 8;
+  if (shift == 0) return aligned[0];
+  return (aligned[0] >> shift) | (aligned[1] << (64 - shift));
+}
+
+/**
+ * @brief Returns true if all eight characters in the word are in [0-9].
+ */
+__device__ inline bool is_eight_digits(uint64_t chars)
+{
+  return ((chars & 0xF0F0F0F0F0F0F0F0) |
+          (((chars + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+/**
+ * @brief Returns the value of the eight digit characters in the word.
+ *
+ * Adjacent digits are combined into 2, 4 and then 8 digit values with one multiply each.
+ */
+__device__ inline uint32_t parse_eight_digits(uint64_t chars)
+{
+  chars = ((chars & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+  chars = ((chars & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+  return static_cast<uint32_t>(((chars & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+/**
+ * @brief Accumulates the base-10 digits at the beginning of `[begin,end)` into `value`.
+ *
+ * Parsing stops at the first character that is not in [0-9]. Overflow is not detected;
+ * the result wraps the same as `value = value * 10 + digit` for each digit.
+ *
+ * @tparam T An integer type.
+ * @param begin First character to parse.
+ * @param end End of the characters to parse.
+ * @param[in,out] value The value to accumulate the digits into.
+ * @return Pointer to the first character that was not parsed.
+ */
+template <typename T>
+__device__ inline const char* parse_digits(const char* begin, const char* end, T& value)
+{
+  auto result = static_cast<uint64_t>(value);
+  while (end - begin >= 8) {
+    auto const chars = load_eight_chars(begin);
+    if (!is_eight_digits(chars)) break;
+    result = (result * 100000000) + parse_eight_digits(chars);
+    begin += 8;
+  }
+  while ((begin < end) && (*begin >= '0') && (*begin <= '9')) {
+    result = (result * 10) + static_cast<uint64_t>(*begin - '0');
+    ++begin;
+  }
+  value = static_cast<T>(result);
+  return begin;
+}
+
+/**
+ * @brief Returns the value of exactly `count` digit characters.
+ *
+ * This is used to read fields at fixed positions such as the components of an
+ * ISO-8601 timestamp.
+ *
+ * @param ptr First character of the field.
+ * @param count Number of characters in the field; at most 9.
+ * @return The value of the field or -1 if any of its characters is not in [0-9].
+ */
+__device__ inline int32_t parse_fixed_digits(const char* ptr, int32_t count)
+{
+  int32_t value = 0;
+  for (int32_t idx = 0; idx < count; ++idx) {
+    auto const chr = ptr[idx];
+    if (chr < '0' || chr > '9') return -1;
+    value = (value * 10) + (chr - '0');
+  }
+  return value;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Device memory resource that carves the temporary buffers of an operation out of a
+ * single workspace.
+ *
+ * The workspace is allocated from the upstream resource on the first allocation, with a
+ * capacity estimated upfront by the operation. Buffers are carved out of it like a stack: the
+ * memory of a buffer is reused once it and all the buffers carved after it are released.
+ * Allocations that do not fit in the rest of the workspace are forwarded to the upstream
+ * resource.
+ *
+ * An arena serves a single operation on a single stream and is not thread safe. It must outlive
+ * the buffers allocated from it.
+ */
+class scratch_arena final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Alignment of the buffers carved out of the workspace
+   */
+  static constexpr std::size_t alignment = 256;
+
+  /**
+   * @brief Returns the workspace bytes used by a buffer of `bytes` bytes
+   */
+  static constexpr std::size_t aligned_size(std::size_t bytes)
+  {
+    return (bytes + alignment - 1) / alignment * alignment;
+  }
+
+  /**
+   * @brief Constructs an arena whose workspace is not allocated yet.
+   *
+   * @param capacity Size in bytes of the workspace, usually the sum of the `aligned_size` of the
+   * expected temporaries
+   * @param upstream Resource used to allocate the workspace and the buffers that do not fit in it
+   */
+  explicit scratch_arena(
+    std::size_t capacity,
+    rmm::mr::device_memory_resource* upstream = rmm::mr::get_default_resource());
+
+  ~scratch_arena() override;
+
+  scratch_arena(scratch_arena const&) = delete;
+  scratch_arena& operator=(scratch_arena const&) = delete;
+
+  /**
+   * @brief Returns the size in bytes of the workspace
+   */
+  std::size_t capacity() const noexcept { return _capacity; }
+
+  /**
+   * @brief Returns the number of workspace bytes used by the buffers that are not reclaimed yet
+   */
+  std::size_t used() const noexcept { return _top; }
+
+  bool supports_streams() const noexcept override { return false; }
+
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override;
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override;
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t) const override
+  {
+    return std::make_pair(0, 0);
+  }
+
+  rmm::mr::device_memory_resource* _upstream;
+  std::size_t _capacity;
+  char* _workspace{nullptr};
+  cudaStream_t _stream{0};  ///< Stream the workspace was allocated on
+  std::size_t _top{0};      ///< Offset of the first free workspace byte
+  std::vector<std::pair<std::size_t, bool>> _buffers;  ///< Offset and liveness of carved buffers
+};
+
+}  // namespace detail
+}  // namespace cudf
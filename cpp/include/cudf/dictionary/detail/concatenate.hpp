@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+/**
+ * @brief Returns a single column by vertically concatenating the given vector of
+ * dictionary columns.
+ *
+ * The keys of the output column are the sorted, unique union of the keys of all the
+ * input columns. The indices of each input are remapped to the new keys with a single
+ * gather before they are copied into the output.
+ *
+ * ```
+ * c1 = {[a, c, d], [2, 0, 1, 1]}
+ * c2 = {[b, c], [0, 1, 0]}
+ * concatenate({c1, c2}) is {[a, b, c, d], [3, 0, 2, 2, 1, 2, 1]}
+ * ```
+ *
+ * @throw cudf::logic_error if the keys of the input columns are not all the same type.
+ *
+ * @param columns Vector of dictionary columns to concatenate.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New dictionary column.
+ */
+std::unique_ptr<column> concatenate(
+  std::vector<column_view> const& columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace dictionary
+}  // namespace cudf
@@ -19,6 +19,8 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 
+#include <type_traits>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -34,7 +36,8 @@ namespace detail {
  *
  * The null_mask and null count are copied from the input column to the output column.
  *
- * @throw cudf::logic_error if indices_type is not INT32
+ * @throw cudf::logic_error if indices_type is not EMPTY, UINT8, UINT16 or INT32
+ * @throw cudf::logic_error if the keys do not fit in indices_type
  *
  * ```
  * c = [429,111,213,111,213,429,213]
@@ -44,13 +47,14 @@ namespace detail {
  *
  * @param column The column to dictionary encode.
  * @param indices_type The integer type to use for the indices.
+ *        The narrowest type that can index all the keys is used if this is EMPTY.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return Returns a dictionary column.
  */
 std::unique_ptr<column> encode(
   column_view const& column,
-  data_type indices_type              = data_type{INT32},
+  data_type indices_type              = data_type{EMPTY},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
@@ -74,6 +78,34 @@ std::unique_ptr<column> decode(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns the narrowest integer type that can index `keys_size` keys.
+ *
+ * This is UINT8 for up to 256 keys, UINT16 for up to 65536 keys and INT32 otherwise.
+ *
+ * @param keys_size Number of keys in the dictionary.
+ * @return Type to use for the indices column of the dictionary.
+ */
+data_type get_indices_type_for_size(size_type keys_size);
+
+/**
+ * @brief Returns true if `T` can be the element type of a dictionary's indices column.
+ */
+template <typename T>
+constexpr inline bool is_index_type()
+{
+  return std::is_same<T, uint8_t>::value || std::is_same<T, uint16_t>::value ||
+         std::is_same<T, int32_t>::value;
+}
+
+/**
+ * @brief Returns true if `type` can be the type of a dictionary's indices column.
+ */
+inline bool is_index_type(data_type type)
+{
+  return type.id() == UINT8 || type.id() == UINT16 || type.id() == INT32;
+}
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
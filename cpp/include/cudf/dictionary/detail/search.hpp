@@ -33,6 +33,25 @@ std::unique_ptr<numeric_scalar<int32_t>> get_index(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns the index of `key` in the dictionary's keys as a scalar of the same
+ * type as the dictionary's indices.
+ *
+ * The result can be compared with or filled into the indices column directly.
+ * The returned scalar is invalid if the key is not found.
+ *
+ * @param dictionary The dictionary to search for the key.
+ * @param key The value to search for in the dictionary keyset.
+ * @param mr Device memory resource used to allocate the returned scalar's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Scalar containing the index of the key in the dictionary's indices type.
+ */
+std::unique_ptr<scalar> get_typed_index(
+  dictionary_column_view const& dictionary,
+  scalar const& key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
@@ -51,6 +51,8 @@ class dictionary_column_view : private column_view {
 
   /**
    * @brief Returns the column of indices
+   *
+   * The indices are UINT8, UINT16 or INT32 depending on the number of keys.
    */
   column_view indices() const noexcept;
 
@@ -46,7 +46,7 @@ namespace cudf {
  * The null_mask and null count for the output column are copied from the indices column.
  *
  * @throw cudf::logic_error if keys_column contains nulls
- * @throw cudf::logic_error if indices_column type is not INT32
+ * @throw cudf::logic_error if indices_column type is not UINT8, UINT16 or INT32
  *
  * @param keys_column Column of unique, ordered values to use as the new dictionary column's keys.
  * @param indices_column Indices to use for the new dictionary column.
@@ -74,7 +74,7 @@ std::unique_ptr<column> make_dictionary_column(
  * The indices values must be in the range [0,keys_column.size()).
  *
  * @throw cudf::logic_error if keys_column or indices_column contains nulls
- * @throw cudf::logic_error if indices_column type is not INT32
+ * @throw cudf::logic_error if indices_column type is not UINT8, UINT16 or INT32
  *
  * @param keys_column Column of unique, ordered values to use as the new dictionary column's keys.
  * @param indices_column Indices to use for the new dictionary column.
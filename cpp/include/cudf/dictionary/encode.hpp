@@ -43,7 +43,8 @@ namespace dictionary {
  *
  * The null_mask and null count are copied from the input column to the output column.
  *
- * @throw cudf::logic_error if indices type is not INT32
+ * @throw cudf::logic_error if indices type is not EMPTY, UINT8, UINT16 or INT32
+ * @throw cudf::logic_error if the keys do not fit in the indices type
  * @throw cudf::logic_error if the column to encode is already a DICTIONARY type.
  *
  * @code{.pseudo}
@@ -54,12 +55,13 @@ namespace dictionary {
  *
  * @param column The column to dictionary encode.
  * @param indices_type The integer type to use for the indices.
+ *        The narrowest type that can index all the keys is used if this is EMPTY.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return Returns a dictionary column.
  */
 std::unique_ptr<column> encode(
   column_view const& column,
-  data_type indices_type              = data_type{INT32},
+  data_type indices_type              = data_type{EMPTY},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
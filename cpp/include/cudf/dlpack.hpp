@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -68,5 +69,64 @@ std::unique_ptr<table> from_dlpack(
 DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief View a DLPack DLTensor as a table without copying its data
+ *
+ * Each column of the table aliases a column of the tensor, which must stay alive and
+ * unchanged while the table is in use. The tensor must be on the current GPU, and the
+ * elements of each of its columns must be contiguous.
+ *
+ * @note The managed tensor is not deleted by this function.
+ *
+ * @throw cudf::logic_error if the any of the DLTensor fields are unsupported
+ * @throw cudf::logic_error if the tensor is not on the GPU or its columns are strided
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ *
+ * @return Table view of the tensor data
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
+/**
+ * @brief View a cudf table as a DLPack DLTensor without copying its data
+ *
+ * The columns must meet the requirements of `to_dlpack` and, for more than one column,
+ * lie evenly spaced in a single allocation so that a column-major tensor with a column
+ * stride can describe them. This is the case for a single column and for the equally
+ * sized columns of a table from `contiguous_split`. The tensor does not own the data, so
+ * the table must outlive it.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the tensor, which leaves the table's memory alone.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * or if any of columns have non-zero null count
+ * @throw cudf::logic_error if the columns are not evenly spaced in memory
+ *
+ * @param input Table to view as a DLPack tensor
+ *
+ * @return 1D or 2D DLPack tensor aliasing the table data, or nullptr for zero rows
+ */
+DLManagedTensor* to_dlpack_view(table_view const& input);
+
+/**
+ * @brief Convert a table from `contiguous_split` into a DLPack DLTensor which owns it
+ *
+ * The tensor takes over the memory of @p input. When its columns are evenly spaced in
+ * that memory, as they are when they have the same size and nullability, the tensor
+ * aliases them without a copy and the memory is freed by the tensor's `deleter`.
+ * Otherwise the data is copied as by `to_dlpack` and the memory is freed immediately.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * or if any of columns have non-zero null count
+ *
+ * @param input The result of `contiguous_split` to convert
+ * @param mr Device memory resource used to allocate a copy of the data if one is needed
+ *
+ * @return 1D or 2D DLPack tensor of the table data, or nullptr for zero rows
+ */
+DLManagedTensor* to_dlpack(contiguous_split_result&& input,
+                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -20,6 +20,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -31,6 +32,12 @@ namespace sort {
 class sort_groupby_helper;
 
 }  // namespace sort
+namespace hash {
+struct hash_groups;
+
+}  // namespace hash
+struct host_table;
+
 }  // namespace detail
 
 /**
@@ -66,6 +73,8 @@ struct aggregation_result {
   std::vector<std::unique_ptr<column>> results{};
 };
 
+struct partial_aggregation_request;
+
 /**
  * @brief Groups values by keys and computes aggregations on those groups.
  */
@@ -84,7 +93,9 @@ class groupby {
    * If the `keys` are already sorted, better performance may be achieved by
    * passing `keys_are_sorted == true` and indicating the  ascending/descending
    * order of each column and null order in  `column_order` and
-   * `null_precedence`, respectively.
+   * `null_precedence`, respectively. Keys that are only grouped, i.e. whose
+   * equivalent rows are contiguous, may also be passed as sorted: the groups
+   * are then found in a single pass over the keys, without sorting them.
    *
    * @note This object does *not* maintain the lifetime of `keys`. It is the
    * user's responsibility to ensure the `groupby` object does not outlive the
@@ -156,13 +167,132 @@ class groupby {
    * @param requests The set of columns to aggregate and the aggregations to
    * perform
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    * @return Pair containing the table with each group's unique key and
    * a vector of aggregation_results for each request in the same order as
    * specified in `requests`.
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
     std::vector<aggregation_request> const& requests,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Estimates the peak device memory used by `aggregate(requests)`,
+   * including the returned table and results.
+   *
+   * Only the sizes and types of the keys and values are used; no data is read
+   * and nothing is allocated, so that a scheduler can split the work before it
+   * runs out of memory. The estimate follows the implementation `aggregate`
+   * selects: a hash-based groupby holds a hash map of the key rows and the
+   * sparse results of every key row, and a sort-based groupby holds the
+   * sorted order and the group labels of the key rows and the sorted values
+   * of a request.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()`.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param num_groups Estimated number of groups, e.g. from column statistics
+   * or `approx_nunique`; `-1` if every row of the keys is distinct
+   * @return Estimated peak number of bytes allocated by `aggregate(requests)`
+   */
+  std::size_t estimate_aggregate_memory(std::vector<aggregation_request> const& requests,
+                                        size_type num_groups = -1) const;
+
+  /**
+   * @brief Computes mergeable partial states of grouped aggregations on the
+   * specified values.
+   *
+   * Partial states of the same keys computed on several batches of rows, e.g.
+   * on different devices, are combined with `merge_partials` after
+   * concatenating them, and turned into the results of the aggregations with
+   * `finalize_partials`.
+   *
+   * For every `aggregation_request` an `aggregation_result` holding the
+   * partial state columns of its aggregations, in order, is returned:
+   * - `SUM`, `MIN`, `MAX`: the aggregation result
+   * - `COUNT_VALID`, `COUNT_ALL`: the count
+   * - `MEAN`: the count of valid values and their sum
+   * - `VARIANCE`, `STD`: the count of valid values, and the sum and the sum of
+   *   squares of the values as `FLOAT64`
+   * - `APPROX_NUNIQUE`: the HyperLogLog sketch, as a `LIST<INT8>` of its
+   *   `2^precision` registers
+   * - `APPROX_QUANTILE`: the t-digest, as the `LIST<FLOAT64>` means and weights
+   *   of its centroids, and the `FLOAT64` minimum and maximum of the values
+   *
+   * As with `aggregate`, the returned `table` contains the unique keys and
+   * element `i` of the partial states belongs to the group at row `i`.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()`.
+   * @throws cudf::logic_error If an aggregation has no mergeable partial
+   * state, e.g. `MEDIAN` or `NUNIQUE`.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results holding the partial states for each
+   * request in the same order as specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate_partials(
+    std::vector<aggregation_request> const& requests,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Performs grouped scans on the specified values.
+   *
+   * The values to scan and the aggregations to perform are specifed in an
+   * `aggregation_request`. For each `aggregation` in a request, element `i` of
+   * the result is the inclusive scan of `values[i]` with all the preceding
+   * elements `values[j]`, `j < i`, where rows `i` and `j` in `keys` are
+   * equivalent. `RANK` instead ranks `values[i]` among all the values of its
+   * group.
+   *
+   * Supported aggregations are `SUM`, `MIN`, `MAX`, `COUNT_VALID`,
+   * `COUNT_ALL` and `RANK`.
+   *
+   * Results are in the order of the rows of `keys`, and the returned `table` is
+   * a copy of `keys`. Null values are skipped by the scans and give null
+   * results, except for the counts and ranks. If null keys are excluded, the
+   * results of the rows with null keys are null.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()`.
+   * @throws cudf::logic_error If an aggregation is not supported by scans.
+   *
+   * Example:
+   * ```
+   * Input:
+   * keys:     {1 2 1 3 1}
+   * request:
+   *   values: {3 1 4 9 2}
+   *   aggregations: {{SUM}, {MAX}, {RANK}}
+   *
+   * result:
+   *
+   * keys:  {1 2 1 3 1}
+   * values:
+   *   SUM:  {3 1 7 9 9}
+   *   MAX:  {3 1 4 9 4}
+   *   RANK: {2 1 3 1 1}
+   * ```
+   *
+   * @param requests The set of columns to scan and the scans to perform
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return Pair containing the table of keys and a vector of
+   * aggregation_results for each request in the same order as specified in
+   * `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
+    std::vector<aggregation_request> const& requests,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
 
   /**
    * @brief The grouped data corresponding to a groupby operation on a set of values.
@@ -188,10 +318,12 @@ class groupby {
    * @param values Table representing values on which a groupby operation is to be performed
    * @param mr Device memory resource used to allocate the returned tables's device memory in the
    * returned groups
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    * @return A `groups` object representing grouped keys and values
    */
   groups get_groups(cudf::table_view values             = {},
-                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream                 = 0);
 
  private:
   table_view _keys;                                      ///< Keys that determine grouping
@@ -206,6 +338,17 @@ class groupby {
   std::unique_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
+  std::unique_ptr<detail::hash::hash_groups>
+    _hash_groups;  ///< Groups found by the hash based
+                   ///< implementation, reused by later calls
+
+  // Merges sketches through the sort helper, in the order of the groups of `aggregate`
+  friend std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> merge_partials(
+    table_view const& keys,
+    std::vector<partial_aggregation_request> const& requests,
+    null_policy include_null_keys,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream);
 
   /**
    * @brief Get the sort helper object
@@ -229,6 +372,185 @@ class groupby {
     std::vector<aggregation_request> const& requests,
     cudaStream_t stream,
     rmm::mr::device_memory_resource* mr);
+
+  // Sort-based groupby scan
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> sort_scan(
+    std::vector<aggregation_request> const& requests,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr);
+};
+
+/**
+ * @brief Partial states of aggregations, as computed by
+ * `groupby::aggregate_partials`, to merge or finalize.
+ */
+struct partial_aggregation_request {
+  std::vector<column_view> partials;  ///< Partial state columns of all the aggregations, in order
+  std::vector<std::unique_ptr<aggregation>> aggregations;  ///< Aggregations of the partial states
+};
+
+/**
+ * @brief Merges the partial states of grouped aggregations.
+ *
+ * The rows of `keys` and of the partial states are typically the
+ * concatenation of the results of `groupby::aggregate_partials` on several
+ * batches of rows. The partial states of equivalent keys are combined into the
+ * partial states of the union of the batches, which may be merged again or
+ * finalized by `finalize_partials`.
+ *
+ * @throws cudf::logic_error If the number of partial state columns of a
+ * request does not match its aggregations, or their size is not
+ * `keys.num_rows()`.
+ *
+ * Example:
+ * ```
+ * Input:
+ * keys:       {1 2 1}
+ * request:
+ *   partials: {2 1 3}   // count of valid values
+ *             {7 4 5}   // sum
+ *   aggregations: {{MEAN}}
+ *
+ * result:
+ *
+ * keys:       {1 2}
+ * partials:   {5 1}
+ *             {12 4}
+ * ```
+ *
+ * @param keys Table whose rows act as the groupby keys of the partial states
+ * @param requests The partial states to merge and their aggregations
+ * @param include_null_keys Indicates whether rows in `keys` that contain NULL
+ * values should be included
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Pair containing the table with each group's unique key and a vector
+ * of aggregation_results holding the merged partial states for each request in
+ * the same order as specified in `requests`.
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> merge_partials(
+  table_view const& keys,
+  std::vector<partial_aggregation_request> const& requests,
+  null_policy include_null_keys       = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Computes the results of aggregations from their partial states.
+ *
+ * Element `i` of each result is computed from element `i` of the partial
+ * states, with the types of the results of `groupby::aggregate`.
+ *
+ * @throws cudf::logic_error If the number of partial state columns of a
+ * request does not match its aggregations.
+ *
+ * @param requests The partial states and their aggregations
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return A vector of aggregation_results for each request in the same order
+ * as specified in `requests`
+ */
+std::vector<aggregation_result> finalize_partials(
+  std::vector<partial_aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Request for aggregation(s) of a column of the batches of a
+ * `partitioned_groupby`.
+ */
+struct partitioned_aggregation_request {
+  size_type values_column{};  ///< Index of the column to aggregate in the batches
+  std::vector<std::unique_ptr<aggregation>> aggregations;  ///< Desired aggregations
+};
+
+/**
+ * @brief Groups values by keys and computes aggregations on tables that do
+ * not fit in device memory.
+ *
+ * The rows are appended in batches. Every batch is hash-partitioned on its key
+ * columns into `num_partitions` partitions, which are copied to host memory.
+ * `aggregate` then groups and aggregates the partitions one at a time. All the
+ * rows of a group are in the same partition, so only the rows of one partition
+ * and their hash map or sort buffers need to fit in device memory at a time.
+ */
+class partitioned_groupby {
+ public:
+  partitioned_groupby() = delete;
+  ~partitioned_groupby();
+  partitioned_groupby(partitioned_groupby const&) = delete;
+  partitioned_groupby(partitioned_groupby&&)      = delete;
+  partitioned_groupby& operator=(partitioned_groupby const&) = delete;
+  partitioned_groupby& operator=(partitioned_groupby&&) = delete;
+
+  /**
+   * @brief Construct a partitioned groupby object
+   *
+   * @throws cudf::logic_error If `key_columns` is empty or `num_partitions < 1`.
+   *
+   * @param key_columns Indices of the columns of the batches whose rows act as
+   * the groupby keys
+   * @param num_partitions Number of partitions of the rows. More partitions
+   * use less device memory in `aggregate`.
+   * @param include_null_keys Indicates whether rows in keys that contain NULL
+   * values should be included
+   */
+  partitioned_groupby(std::vector<size_type> const& key_columns,
+                      size_type num_partitions,
+                      null_policy include_null_keys = null_policy::EXCLUDE);
+
+  /**
+   * @brief Partitions the rows of a batch and copies the partitions to host
+   * memory.
+   *
+   * Only fixed-width and string columns are supported.
+   *
+   * @throws cudf::logic_error If the column types of `batch` differ from the
+   * ones of the previous batches.
+   *
+   * @param batch Table of the rows to append
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void append(table_view const& batch, cudaStream_t stream = 0);
+
+  /**
+   * @brief Performs grouped aggregations on the columns of the appended
+   * batches.
+   *
+   * Each partition is copied back to device memory and aggregated as with
+   * `groupby::aggregate`, then the results of all the partitions are
+   * concatenated. The appended rows are kept in host memory, so `aggregate`
+   * may be called again, and more batches may be appended in between.
+   *
+   * The returned `table` contains the unique keys. Element `i` across all
+   * aggregation results belongs to the group at row `i` of the keys table.
+   * The order of the groups is arbitrary.
+   *
+   * @throws cudf::logic_error If no batch was appended, or a request's column
+   * index is out of range.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
+    std::vector<partitioned_aggregation_request> const& requests,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+ private:
+  std::vector<size_type> _key_columns;                   ///< Indices of the key columns
+  size_type _num_partitions;                             ///< Number of partitions
+  null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys
+                                                         ///< with NULLs
+  std::vector<data_type> _column_types;                  ///< Column types of the batches
+  std::vector<std::vector<std::unique_ptr<detail::host_table>>>
+    _partitions;  ///< Host copies of the rows of each
+                  ///< partition, one per batch
 };
 /** @} */
 }  // namespace groupby
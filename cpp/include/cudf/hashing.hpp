@@ -27,15 +27,25 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * `hash_id::HASH_MURMUR3` produces an `INT32` column of 32-bit hash values and
+ * `hash_id::HASH_XXHASH64` an `INT64` column of 64-bit hash values, which collide much less
+ * often on large tables. `hash_id::HASH_SPARK_MURMUR3` produces the `INT32` values of Spark's
+ * `Murmur3Hash` expression with its default seed of 42: each column is hashed with the hash of
+ * the previous columns as seed, and null elements are skipped.
+ *
+ * @throw cudf::logic_error if `initial_hash` is not empty with `hash_id::HASH_SPARK_MURMUR3`
+ *
  * @param input The table of columns to hash
  * @param initial_hash Optional vector of initial hash values for each column.
  * If this vector is empty then each element will be hashed as-is.
+ * @param hash_function The hash function to use
  * @param mr Device memory resource used to allocate the returned column's device memory.
  *
  * @returns A column where each row is the hash of a column from the input
  */
 std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash = {},
+                             hash_id hash_function                     = hash_id::HASH_MURMUR3,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /** @} */  // end of group
@@ -45,6 +45,27 @@ class data_sink {
    **/
   static std::unique_ptr<data_sink> create(std::vector<char>* buffer);
 
+  /**
+   * @brief Create a sink from a device buffer
+   *
+   * The data is appended to the buffer, which grows as needed. Device writes copy the data
+   * within device memory, without transfers through the host.
+   *
+   * @param[in,out] buffer Pointer to the output device buffer
+   **/
+  static std::unique_ptr<data_sink> create(rmm::device_buffer* buffer);
+
+  /**
+   * @brief Create a sink from preallocated host memory
+   *
+   * The data is written from the start of the memory, and writes past its end fail. Device
+   * writes copy straight into the memory, which transfers fastest when it is pinned.
+   *
+   * @param[in,out] buffer Address of the output memory
+   * @param[in] size Size of the output memory in bytes
+   **/
+  static std::unique_ptr<data_sink> create(void* buffer, size_t size);
+
   /**
    * @brief Create a void sink (one that does no actual io)
    *
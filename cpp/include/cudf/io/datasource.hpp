@@ -21,7 +21,9 @@
 #include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 
+#include <future>
 #include <memory>
+#include <string>
 
 #include <cudf/utilities/error.hpp>
 
@@ -71,6 +73,9 @@ class datasource {
   /**
    * @brief Creates a source from a memory buffer.
    *
+   * The buffer is read in place, without copies, and must outlive the source. Device reads
+   * transfer straight from the buffer, which is fastest when it is pinned memory.
+   *
    * @param[in] data Pointer to the input data host buffer
    * @param[in] size Size of the buffer in bytes
    */
@@ -117,6 +122,39 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Asynchronously reads a subset of data from the source.
+   *
+   * Allows the readers to issue many reads at once and to overlap them with other work. The
+   * default implementation calls host_read() on a separate thread; data source implementations
+   * backed by higher latency storage should override this function to issue the read without
+   * blocking a thread.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   *
+   * @return Future of the data buffer
+   */
+  virtual std::future<std::unique_ptr<datasource::buffer>> host_read_async(size_t offset,
+                                                                           size_t size)
+  {
+    return std::async(std::launch::async, [this, offset, size]() {
+      return host_read(offset, size);
+    });
+  }
+
+  /**
+   * @brief Hints that a selected range will be read soon.
+   *
+   * Readers call this function for the ranges they intend to read, before issuing the reads, so
+   * that the source can start fetching the data in the background. The hint does not need to be
+   * followed; the default implementation ignores it.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes that will be read
+   */
+  virtual void prefetch(size_t offset, size_t size) {}
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -177,6 +215,16 @@ class datasource {
    * @return bool True if there is data, False otherwise
    */
   virtual bool is_empty() const { return size() == 0; }
+
+  /**
+   * @brief Returns a key identifying the contents of the source, so that data read from the
+   * source can be cached and shared between reads.
+   *
+   * Sources whose contents may change without the key changing must return an empty key.
+   *
+   * @return std::string The key, or an empty string if the data must not be cached
+   */
+  virtual std::string cache_key() const { return {}; }
 };
 
 }  // namespace io
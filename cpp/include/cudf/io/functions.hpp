@@ -23,6 +23,7 @@
 
 #include "types.hpp"
 
+#include <cudf/column/column.hpp>
 #include <cudf/io/writers.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -30,6 +31,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 //! cuDF interfaces
@@ -74,13 +76,15 @@ struct read_avro_args {
  *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * table_with_metadata
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_avro(
   read_avro_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Input arguments to the `read_json` interface
@@ -127,6 +131,15 @@ struct read_json_args {
   /// Whether to parse dates as DD/MM versus MM/DD
   bool dayfirst = false;
 
+  /// Records sampled at even intervals to infer the types; -1 is all records. The types are
+  /// inferred from all records instead if a value does not fit the types inferred from the sample.
+  size_type infer_sample_rows = -1;
+
+  /// Names of the columns to read, in any order; empty is all. The columns are returned in their
+  /// order in the data, and `dtype` only lists the types of the columns to read. Values of the
+  /// other columns are skipped without being parsed.
+  std::vector<std::string> use_cols;
+
   read_json_args() = default;
 
   explicit read_json_args(const source_info& src) : source(src) {}
@@ -148,13 +161,15 @@ struct read_json_args {
  *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * table_with_metadata
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_json(
   read_json_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Settings to use for `read_csv()`
@@ -229,6 +244,9 @@ struct read_csv_args {
 
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Rows sampled at even intervals to infer the types; -1 is all rows. The types are inferred
+  /// from all rows instead if a value does not fit the types inferred from the sample.
+  size_type infer_sample_rows = -1;
   /// Additional values to recognize as boolean true values
   std::vector<std::string> true_values;
   /// Additional values to recognize as boolean false values
@@ -244,6 +262,13 @@ struct read_csv_args {
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
 
+  // Filtering settings
+
+  /// Predicates that must all hold for a row to be returned. The filtered columns are decoded
+  /// first, and the other columns are only decoded for the matching rows. Null values never match.
+  /// The filtered columns must be read; literals are compared with the values of the column type.
+  std::vector<column_filter> filters;
+
   read_csv_args() = default;
   explicit read_csv_args(source_info const& src) : source(src) {}
 };
@@ -265,12 +290,92 @@ struct read_csv_args {
  *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * table_with_metadata
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_csv(read_csv_args const& args,
-                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
+
+namespace detail {
+namespace csv {
+/**
+ * @brief Forward declaration of the CSV reader class.
+ */
+class reader;
+}  // namespace csv
+}  // namespace detail
+
+/**
+ * @brief Reads a CSV dataset as a series of tables, one per chunk of the input data.
+ *
+ * @ingroup io_readers
+ *
+ * Each chunk holds the rows that start within the next `chunk_size` bytes of the input. The next
+ * chunk starts at the row following the last row of the previous one, so every row is parsed
+ * once, including rows with quoted line terminators. The header is only parsed with the first
+ * chunk, and the column names and types found with the first chunk are used for all tables.
+ *
+ * The following code snippet demonstrates how to read a dataset from a file in chunks:
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.csv";
+ *  cudf::io::read_csv_args args{cudf::io::source_info(filepath)};
+ *  cudf::io::chunked_csv_reader reader(args, 256 * 1024 * 1024);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Constructor from reader settings and a chunk size.
+   *
+   * @param args Settings for controlling reading behavior; byte ranges, `nrows` and `skipfooter`
+   * are not supported, and rows skipped with `skiprows` must start within the first chunk
+   * @param chunk_size Bytes of input data parsed for each chunk; `0` to read all data at once
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   *
+   * @throw cudf::logic_error if `args` selects a byte range, `nrows` or `skipfooter`
+   */
+  explicit chunked_csv_reader(
+    read_csv_args const& args,
+    size_t chunk_size,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Returns whether there are chunks of the dataset left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of rows.
+   *
+   * The first call always returns a table, even if the dataset is empty.
+   *
+   * @return The set of columns along with metadata
+   *
+   * @throw cudf::logic_error if there are no chunks left to read
+   * @throw cudf::logic_error if a row does not start within the chunk
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<detail::csv::reader> _reader;
+  size_t _chunk_size   = 0;
+  size_type _skip_rows = 0;
+  size_t _next_offset  = 0;
+  bool _has_next       = true;
+};
 
 /**
  * @brief Settings to use for `write_csv()`
@@ -337,9 +442,40 @@ struct write_csv_args : detail::csv::writer_options {
  *
  * @param args Settings for controlling writing behavior
  * @param mr Device memory resource to use for device memory allocation
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 void write_csv(write_csv_args const& args,
-               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+               cudaStream_t stream                 = 0);
+
+/**
+ * @brief Writes a set of columns to several CSV files in parallel, one per sink
+ *
+ * The rows are split into contiguous parts of equal size, in order, and each part is written to
+ * its sink as an independent CSV file, including the header if requested. The sink in `args` is
+ * ignored.
+ *
+ * The following code snippet demonstrates how to write columns to four files:
+ * @code
+ *  #include <cudf/io/functions.hpp>
+ *  ...
+ *  std::vector<cudf::io::sink_info> sinks;
+ *  for (int i = 0; i < 4; ++i) {
+ *    sinks.emplace_back("dataset_" + std::to_string(i) + ".csv");
+ *  }
+ *  cudf::io::write_csv_args args{cudf::io::sink_info{}, table->view(), na, include_header,
+ * rows_per_chunk};
+ *  ...
+ *  cudf::io::write_csv_parts(args, sinks);
+ * @endcode
+ *
+ * @param args Settings for controlling writing behavior
+ * @param sinks Sinks to write the parts to
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_csv_parts(write_csv_args const& args,
+                     std::vector<sink_info> const& sinks,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
  * @brief Settings to use for `read_orc()`
@@ -371,12 +507,29 @@ struct read_orc_args {
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
 
-  /// Whether to convert decimals to float64
+  /// Whether to convert decimals to float64, otherwise they are read as DECIMAL64
   bool decimals_as_float = true;
-  /// For decimals as int, optional forced decimal scale;
+  /// For decimals as DECIMAL64, optional forced decimal scale;
   /// -1 is auto (column scale), >=0: number of fractional digits
   int forced_decimals_scale = -1;
 
+  /// Whether to return string columns as DICTIONARY32 columns. Dictionary-encoded stripes are
+  /// decoded to indices into their stripe dictionaries, without materializing the strings
+  bool strings_to_dictionary = false;
+
+  /// Predicates that must all hold; stripes whose statistics show that none of their rows can
+  /// match are skipped. Filtering is done at stripe granularity, so the rows of the remaining
+  /// stripes are all returned, and `skip_rows`/`num_rows` count only the remaining rows.
+  std::vector<column_filter> filters;
+  /// Whether to evaluate `filters` on every row of the remaining stripes and only return the
+  /// matching rows. The filtered columns are decoded first, and the other columns only for the
+  /// stripes that contain matching rows. Row ranges (`skip_rows`/`num_rows`) are not supported
+  bool late_materialization = false;
+
+  /// Whether to keep the parsed file metadata, including all stripe footers, in a process-wide
+  /// cache. Reopening a file path with an unchanged modification time then skips the parsing
+  bool cache_metadata = false;
+
   read_orc_args() = default;
 
   explicit read_orc_args(source_info const& src) : source(src) {}
@@ -398,12 +551,107 @@ struct read_orc_args {
  *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * table_with_metadata
  *
  * @return The set of columns
  */
 table_with_metadata read_orc(read_orc_args const& args,
-                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
+
+/**
+ * @brief Reads the footer metadata of ORC files without reading any column data
+ *
+ * @ingroup io_readers
+ *
+ * Only the postscript, the file footer and the stripe statistics of each file are read, on
+ * several host threads, so that a large dataset can be planned (e.g. split between workers or
+ * pruned with stripe statistics) without a full read. Column compressed sizes are not reported,
+ * since they are stored in the stripe footers.
+ *
+ * @param sources Sources to read; a source made of several files adds one entry per file
+ *
+ * @return Metadata of each file, in source order
+ */
+std::vector<source_metadata> read_orc_metadata(std::vector<source_info> const& sources);
+
+namespace detail {
+namespace orc {
+/**
+ * @brief Forward declaration of the ORC reader class.
+ */
+class reader;
+}  // namespace orc
+}  // namespace detail
+
+/**
+ * @brief Reads an ORC dataset as a series of tables, bounding the device memory used by each
+ * read.
+ *
+ * @ingroup io_readers
+ *
+ * The selected rows are divided into consecutive ranges of whole stripes, using the stream sizes
+ * found in the stripe footers and the string lengths found in the stripe statistics. The limit
+ * covers the compressed and decompressed stream data as well as the output columns; a stripe
+ * that does not fit within the limit by itself is read on its own.
+ *
+ * The following code snippet demonstrates how to read a dataset from a file in chunks:
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.orc";
+ *  cudf::io::read_orc_args args{cudf::io::source_info(filepath)};
+ *  cudf::io::chunked_orc_reader reader(args, 1024 * 1024 * 1024);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Constructor from reader settings and a device memory limit.
+   *
+   * @param args Settings for controlling reading behavior; selecting rows by stripe is not
+   * supported, use `skip_rows` and `num_rows` instead
+   * @param chunk_read_limit Limit on the device memory in bytes used to read each chunk; `0` for
+   * no limit
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   *
+   * @throw cudf::logic_error if `args` selects stripes
+   */
+  explicit chunked_orc_reader(
+    read_orc_args const& args,
+    size_t chunk_read_limit,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Returns whether there are chunks of the dataset left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of rows.
+   *
+   * The first call always returns a table, even if the dataset is empty.
+   *
+   * @return The set of columns along with metadata
+   *
+   * @throw cudf::logic_error if there are no chunks left to read
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<detail::orc::reader> _reader;
+  std::vector<std::pair<size_type, size_type>> _row_splits;
+  size_t _next_split = 0;
+};
 
 /**
  * @brief Settings to use for `read_parquet()`
@@ -414,7 +662,8 @@ struct read_parquet_args {
   /// Names of column to read; empty is all
   std::vector<std::string> columns;
 
-  /// Row group to read; -1 is all
+  /// Row group to read; -1 is all. When reading several files, row group indices are global
+  /// across the files, in source order
   size_type row_group = -1;
   /// Number of row groups to read starting from row_group; default is one if row_group >= 0
   size_type row_group_count = -1;
@@ -427,10 +676,29 @@ struct read_parquet_args {
 
   /// Whether to store string data as categorical type
   bool strings_to_categorical = false;
+  /// Whether to return string columns as DICTIONARY32 columns. Dictionary-encoded column chunks
+  /// are decoded to indices into their dictionary pages, without materializing the strings
+  bool strings_to_dictionary = false;
   /// Whether to use PANDAS metadata to load columns
   bool use_pandas_metadata = true;
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
+  /// Whether to convert decimals to float64, otherwise INT32 and INT64 decimals are read as
+  /// DECIMAL32 and DECIMAL64. Converted decimals of scale 0 are read as integers
+  bool decimals_as_float = true;
+
+  /// Predicates that must all hold; row groups whose statistics show that none of their rows can
+  /// match are skipped. Filtering is done at row group granularity, so the rows of the remaining
+  /// row groups are all returned, and `skip_rows`/`num_rows` count only the remaining rows.
+  std::vector<column_filter> filters;
+  /// Whether to evaluate `filters` on every row of the remaining row groups and only return the
+  /// matching rows. The filtered columns are decoded first, and the other columns only for the
+  /// row groups that contain matching rows. Row ranges (`skip_rows`/`num_rows`) are not supported
+  bool late_materialization = false;
+
+  /// Max number of unused bytes between column chunks that are fetched in a single read. Larger
+  /// values trade extra IO volume for fewer requests, which suits high-latency storage
+  size_t max_read_gap = 64 * 1024;
 
   explicit read_parquet_args() = default;
 
@@ -453,13 +721,124 @@ struct read_parquet_args {
  *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * table_with_metadata
  *
  * @return The set of columns along with metadata
  */
 table_with_metadata read_parquet(
   read_parquet_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Reads the footer metadata of Parquet files without reading any column data
+ *
+ * @ingroup io_readers
+ *
+ * Only the footer of each file is read, on several host threads, so that a large dataset can be
+ * planned (e.g. split between workers or pruned with row group statistics) without a full read.
+ *
+ * @param sources Sources to read; a source made of several files adds one entry per file
+ *
+ * @return Metadata of each file, in source order
+ */
+std::vector<source_metadata> read_parquet_metadata(std::vector<source_info> const& sources);
+
+/**
+ * @brief Estimates the peak device memory used by `read_parquet(args)` from the footer metadata
+ * only, without reading any column data
+ *
+ * @ingroup io_readers
+ *
+ * The row groups are selected like `read_parquet` does, including the row groups skipped with
+ * the statistics of `filters`. The estimate adds the compressed data, the decompressed pages and
+ * the decoded output column of every column chunk that is read. With `late_materialization`, all
+ * the remaining row groups are counted, which bounds the estimate from above.
+ *
+ * @param args Settings for controlling reading behavior
+ *
+ * @return Estimated peak number of bytes of device memory allocated by `read_parquet(args)`
+ */
+size_t estimate_read_parquet_memory(read_parquet_args const& args);
+
+namespace detail {
+namespace parquet {
+/**
+ * @brief Forward declaration of the Parquet reader class.
+ */
+class reader;
+}  // namespace parquet
+}  // namespace detail
+
+/**
+ * @brief Reads a Parquet dataset as a series of tables, bounding the device memory used by each
+ * read.
+ *
+ * @ingroup io_readers
+ *
+ * The selected rows are divided into consecutive ranges using the column chunk sizes found in the
+ * file metadata. Ranges are made of whole row groups where possible; a row group that does not
+ * fit within the limit by itself is divided further, and only the pages overlapping each range
+ * are decompressed and decoded. The limit covers the compressed and decompressed page data as
+ * well as the output columns.
+ *
+ * The following code snippet demonstrates how to read a dataset from a file in chunks:
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.parquet";
+ *  cudf::io::read_parquet_args args{cudf::io::source_info(filepath)};
+ *  cudf::io::chunked_parquet_reader reader(args, 1024 * 1024 * 1024);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Constructor from reader settings and a device memory limit.
+   *
+   * @param args Settings for controlling reading behavior; selecting rows by row group is not
+   * supported, use `skip_rows` and `num_rows` instead
+   * @param chunk_read_limit Limit on the device memory in bytes used to read each chunk; `0` for
+   * no limit
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   *
+   * @throw cudf::logic_error if `args` selects row groups
+   */
+  explicit chunked_parquet_reader(
+    read_parquet_args const& args,
+    size_t chunk_read_limit,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Returns whether there are chunks of the dataset left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of rows.
+   *
+   * The first call always returns a table, even if the dataset is empty.
+   *
+   * @return The set of columns along with metadata
+   *
+   * @throw cudf::logic_error if there are no chunks left to read
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<detail::parquet::reader> _reader;
+  std::vector<std::pair<size_type, size_type>> _row_splits;
+  size_t _next_split = 0;
+};
 
 /**
  * @brief Settings to use for `write_orc()`
@@ -471,12 +850,20 @@ struct write_orc_args {
   sink_info sink;
   /// Specify the compression format to use
   compression_type compression;
+  /// Compression level of DEFLATE and ZSTD, from 1 (fastest) to 9; 0 for the codec default
+  int compression_level = 0;
   /// Enable writing column statistics
   bool enable_statistics;
   /// Set of columns to output
   table_view table;
   /// Optional associated metadata
   const table_metadata* metadata;
+  /// Maximum uncompressed size of a stripe, in bytes; at least 64KB
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe; -1 is 1M rows with string columns, 5M rows otherwise
+  size_type stripe_size_rows = -1;
+  /// Number of rows in each row group of the row index; a multiple of 8, at least 512
+  size_type row_index_stride = 10000;
 
   write_orc_args() = default;
 
@@ -510,9 +897,11 @@ struct write_orc_args {
  *
  * @param args Settings for controlling reading behavior
  * @param mr Device memory resource to use for device memory allocation
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 void write_orc(write_orc_args const& args,
-               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+               cudaStream_t stream                 = 0);
 
 /**
  * @brief Settings to use for `write_orc_chunked()`
@@ -524,10 +913,22 @@ struct write_orc_chunked_args {
   sink_info sink;
   /// Specify the compression format to use
   compression_type compression;
+  /// Compression level of DEFLATE and ZSTD, from 1 (fastest) to 9; 0 for the codec default
+  int compression_level = 0;
   /// Enable writing column statistics
   bool enable_statistics;
   /// Optional associated metadata
   const table_metadata_with_nullability* metadata;
+  /// Maximum uncompressed size of a stripe, in bytes; at least 64KB
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe; -1 is 1M rows with string columns, 5M rows otherwise
+  size_type stripe_size_rows = -1;
+  /// Number of rows in each row group of the row index; a multiple of 8, at least 512
+  size_type row_index_stride = 10000;
+  /// Whether to buffer the tables on the device until they fill a stripe, instead of writing
+  /// each table as separate stripes. Buffered tables are copied, and the remaining rows are
+  /// written by `write_orc_chunked_end`
+  bool buffer_tables = false;
 
   explicit write_orc_chunked_args(sink_info const& sink_,
                                   const table_metadata_with_nullability* metadata_ = nullptr,
@@ -571,6 +972,7 @@ struct orc_chunked_state;
  *
  * @param[in] args Settings for controlling writing behavior
  * @param[in] mr Device memory resource to use for device memory allocation
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns pointer to an anonymous state structure storing information about the chunked write.
  * this pointer must be passed to all subsequent write_orc_chunked() and write_orc_chunked_end()
@@ -578,7 +980,8 @@ struct orc_chunked_state;
  */
 std::shared_ptr<detail::orc::orc_chunked_state> write_orc_chunked_begin(
   write_orc_chunked_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Write a single table as a subtable of a larger logical orc file/table.
@@ -615,6 +1018,8 @@ struct write_parquet_args {
   sink_info sink;
   /// Specify the compression format to use
   compression_type compression = compression_type::AUTO;
+  /// Compression level of GZIP and ZSTD, from 1 (fastest) to 9; 0 for the codec default
+  int compression_level = 0;
   /// Specify the level of statistics in the output file
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
   /// Set of columns to output
@@ -625,6 +1030,17 @@ struct write_parquet_args {
   bool return_filemetadata = false;
   /// Column chunks file path to be set in the raw output metadata
   std::string metadata_out_file_path;
+  /// Dictionary encoding policy of each column; columns past the end use `ADAPTIVE`
+  std::vector<dictionary_policy> column_dictionary_policy;
+  /// Use DELTA_BINARY_PACKED / DELTA_LENGTH_BYTE_ARRAY for integer and string pages without a
+  /// dictionary instead of PLAIN
+  bool use_delta_encoding = false;
+  /// Write a split-block bloom filter for each column chunk
+  bool write_bloom_filters = false;
+  /// Maximum size in bytes of the pages of a batch of row groups encoded at once, which bounds
+  /// the device memory used by the writer; 0 for the default of 512MB. A batch holds at least
+  /// one row group.
+  size_t max_batch_size = 0;
 
   write_parquet_args() = default;
 
@@ -658,13 +1074,15 @@ struct write_parquet_args {
  *
  * @param args Settings for controlling writing behavior
  * @param mr Device memory resource to use for device memory allocation
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return A blob that contains the file metadata (parquet FileMetadata thrift message) if
  *         requested in write_parquet_args (empty blob otherwise)
  */
 std::unique_ptr<std::vector<uint8_t>> write_parquet(
   write_parquet_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Merges multiple raw metadata blobs that were previously created by write_parquet
@@ -688,10 +1106,23 @@ struct write_parquet_chunked_args {
   sink_info sink;
   /// Specify the compression format to use
   compression_type compression = compression_type::AUTO;
+  /// Compression level of GZIP and ZSTD, from 1 (fastest) to 9; 0 for the codec default
+  int compression_level = 0;
   /// Specify the level of statistics in the output file
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
   /// Optional associated metadata.
   const table_metadata_with_nullability* metadata;
+  /// Dictionary encoding policy of each column; columns past the end use `ADAPTIVE`
+  std::vector<dictionary_policy> column_dictionary_policy;
+  /// Use DELTA_BINARY_PACKED / DELTA_LENGTH_BYTE_ARRAY for integer and string pages without a
+  /// dictionary instead of PLAIN
+  bool use_delta_encoding = false;
+  /// Write a split-block bloom filter for each column chunk
+  bool write_bloom_filters = false;
+  /// Maximum size in bytes of the pages of a batch of row groups encoded at once, which bounds
+  /// the device memory used by the writer; 0 for the default of 512MB. A batch holds at least
+  /// one row group.
+  size_t max_batch_size = 0;
 
   write_parquet_chunked_args() = default;
 
@@ -739,6 +1170,7 @@ struct pq_chunked_state;
  *
  * @param[in] args Settings for controlling writing behavior
  * @param[in] mr Device memory resource to use for device memory allocation
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns pointer to an anonymous state structure storing information about the chunked write.
  * this pointer must be passed to all subsequent write_parquet_chunked() and
@@ -746,7 +1178,8 @@ struct pq_chunked_state;
  */
 std::shared_ptr<detail::parquet::pq_chunked_state> write_parquet_chunked_begin(
   write_parquet_chunked_args const& args,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 /**
  * @brief Write a single table as a subtable of a larger logical parquet file/table.
  *
@@ -772,5 +1205,42 @@ void write_parquet_chunked(table_view const& table,
  */
 void write_parquet_chunked_end(std::shared_ptr<detail::parquet::pq_chunked_state>& state);
 
+/**
+ * @brief Chunk-level statistics of a column, with one row per chunk of rows.
+ */
+struct column_statistics {
+  std::unique_ptr<column> null_count;  ///< INT32 null count of each chunk
+  /// Minimum value of each chunk, of the column type and null if the chunk has no valid values;
+  /// not set if the column type has no statistics
+  std::unique_ptr<column> min;
+  /// Maximum value of each chunk, of the column type and null if the chunk has no valid values;
+  /// not set if the column type has no statistics
+  std::unique_ptr<column> max;
+  /// FLOAT64 sum for floating-point columns, INT64 sum for integer columns of up to 32 bits and
+  /// INT64 total string length for string columns; null where no sum is available
+  std::unique_ptr<column> sum;
+};
+
+/**
+ * @brief Computes the statistics that the writers store for each chunk of rows of each column.
+ *
+ * @ingroup io_writers
+ *
+ * Minimum and maximum values are computed for boolean, signed integer, floating-point,
+ * timestamp, duration and string columns. Timestamps and durations keep the column units.
+ *
+ * @param[in] table The table whose columns are summarized
+ * @param[in] rows_per_chunk Number of rows in each chunk; the last chunk may be smaller
+ * @param[in] mr Device memory resource to use for device memory allocation
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns The statistics of each column of the table
+ */
+std::vector<column_statistics> compute_column_statistics(
+  table_view const& table,
+  size_type rows_per_chunk,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace io
 }  // namespace cudf
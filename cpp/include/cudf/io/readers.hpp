@@ -133,6 +133,10 @@ struct reader_options {
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
   bool dayfirst = false;
+  /// Records sampled at even intervals to deduce the types; -1 is all records
+  size_type infer_sample_rows = -1;
+  /// Names of the columns to read; empty is all
+  std::vector<std::string> use_cols;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -143,12 +147,22 @@ struct reader_options {
    * @param[in] lines Restrict to `JSON Lines` format rather than full JSON
    * @param[in] compression Compression type: "none", "infer", "gzip", "zip"
    * @param[in] dtype Ordered list of data types; deduced from dataset if empty
+   * @param[in] dayfirst Whether to parse dates as DD/MM versus MM/DD
+   * @param[in] infer_sample_rows Records sampled to deduce the data types; -1 is all records
+   * @param[in] use_cols Names of the columns to read; empty is all
    *---------------------------------------------------------------------------**/
   reader_options(bool lines,
                  compression_type compression,
                  std::vector<std::string> dtype,
-                 bool dayfirst)
-    : lines(lines), compression(compression), dtype(std::move(dtype)), dayfirst(dayfirst)
+                 bool dayfirst,
+                 size_type infer_sample_rows       = -1,
+                 std::vector<std::string> use_cols = {})
+    : lines(lines),
+      compression(compression),
+      dtype(std::move(dtype)),
+      dayfirst(dayfirst),
+      infer_sample_rows(infer_sample_rows),
+      use_cols(std::move(use_cols))
   {
   }
 };
@@ -273,6 +287,9 @@ struct reader_options {
 
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Rows sampled at even intervals to infer the types; -1 is all rows. The types are inferred
+  /// from all rows instead if a value does not fit the types inferred from the sample.
+  size_type infer_sample_rows = -1;
   /// User-extensible list of values to recognize as boolean true values
   std::vector<std::string> true_values{"True", "TRUE", "true"};
   /// User-extensible list of values to recognize as boolean false values
@@ -297,6 +314,11 @@ struct reader_options {
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
 
+  // Filtering settings
+
+  /// Predicates that must all hold for a row to be decoded and returned
+  std::vector<column_filter> filters;
+
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
 };
@@ -361,6 +383,30 @@ class reader {
    */
   table_with_metadata read_byte_range(size_t offset, size_t size, cudaStream_t stream = 0);
 
+  /**
+   * @brief Reads all the rows starting within a byte range that begins at a row.
+   *
+   * Unlike `read_byte_range()`, the first row of the range is read, so that the ranges of
+   * consecutive calls cover the dataset without the rows that straddle them being parsed twice.
+   * The first call must start at offset zero; the column names and types it finds, including the
+   * header, are reused by all subsequent calls.
+   *
+   * @param offset Byte offset of a row from the start; zero or the `next_offset` of the
+   * previous call
+   * @param size Number of bytes from the offset; set to 0 for all remaining
+   * @param skip_rows Number of rows to skip from the offset
+   * @param[out] next_offset Byte offset of the first row after the range, or zero if the range
+   * includes the last row
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(size_t offset,
+                                 size_t size,
+                                 size_type skip_rows,
+                                 size_t &next_offset,
+                                 cudaStream_t stream = 0);
+
   /**
    * @brief Reads a range of rows.
    *
@@ -390,6 +436,9 @@ struct reader_options {
   data_type timestamp_type{EMPTY};
   bool decimals_as_float    = true;
   int forced_decimals_scale = -1;
+  std::vector<column_filter> filters;
+  bool strings_to_dictionary = false;
+  bool cache_metadata        = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -401,19 +450,31 @@ struct reader_options {
    * @param use_index_lookup Whether to use row index for faster scanning
    * @param np_compat Whether to use numpy-compatible dtypes
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param decimals_as_float_ Whether to convert decimals to float64
+   * @param forced_decimals_scale_ Fractional digits of decimals returned as DECIMAL64; -1 is
+   * the column scale
+   * @param filters_ Predicates used to skip stripes based on their statistics
+   * @param strings_to_dictionary_ Whether to return strings as dictionary columns
+   * @param cache_metadata_ Whether to cache the parsed metadata of file sources
    */
   reader_options(std::vector<std::string> columns,
                  bool use_index_lookup,
                  bool np_compat,
                  data_type timestamp_type,
-                 bool decimals_as_float_    = true,
-                 int forced_decimals_scale_ = -1)
+                 bool decimals_as_float_             = true,
+                 int forced_decimals_scale_          = -1,
+                 std::vector<column_filter> filters_ = {},
+                 bool strings_to_dictionary_         = false,
+                 bool cache_metadata_                = false)
     : columns(std::move(columns)),
       use_index(use_index_lookup),
       use_np_dtypes(np_compat),
       timestamp_type(timestamp_type),
       decimals_as_float(decimals_as_float_),
-      forced_decimals_scale(forced_decimals_scale_)
+      forced_decimals_scale(forced_decimals_scale_),
+      filters(std::move(filters_)),
+      strings_to_dictionary(strings_to_dictionary_),
+      cache_metadata(cache_metadata_)
   {
   }
 };
@@ -491,6 +552,20 @@ class reader {
   table_with_metadata read_stripes(const std::vector<size_type> &stripe_list,
                                    cudaStream_t stream = 0);
 
+  /**
+   * @brief Returns the stripes whose statistics allow some of their rows to satisfy the filters.
+   *
+   * Only the file metadata and row indexes are read; no column data is decoded.
+   *
+   * @param stripe_list Indices of the stripes to check; empty for all stripes
+   *
+   * @return Index and number of rows of each remaining stripe, in list order
+   *
+   * @throw cudf::logic_error if stripe index is out of range
+   */
+  std::vector<std::pair<size_type, size_type>> filter_stripes(
+    const std::vector<size_type> &stripe_list);
+
   /**
    * @brief Reads and returns a range of rows.
    *
@@ -501,8 +576,31 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Splits a range of rows into consecutive row ranges of whole stripes that can each be
+   * read within a device memory budget.
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each range; `0` for no limit
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; use `0` for all remaining data
+   *
+   * @return List of row ranges, as pairs of (skip_rows, num_rows), to pass to `read_rows()`
+   */
+  std::vector<std::pair<size_type, size_type>> compute_row_splits(size_t chunk_read_limit,
+                                                                  size_type skip_rows,
+                                                                  size_type num_rows);
 };
 
+/**
+ * @brief Reads the schema and the stripes metadata of a source from its footer only.
+ *
+ * @param source Dataset source
+ *
+ * @return The file-level metadata
+ */
+source_metadata read_metadata(datasource *source);
+
 }  // namespace orc
 
 namespace parquet {
@@ -514,6 +612,10 @@ struct reader_options {
   bool strings_to_categorical = false;
   bool use_pandas_metadata    = false;
   data_type timestamp_type{EMPTY};
+  std::vector<column_filter> filters;
+  size_t max_read_gap         = 64 * 1024;
+  bool strings_to_dictionary = false;
+  bool decimals_as_float     = true;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -525,15 +627,28 @@ struct reader_options {
    * @param strings_to_categorical Whether to return strings as category
    * @param use_pandas_metadata Whether to always load PANDAS index columns
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filters Predicates used to skip row groups based on their statistics
+   * @param max_read_gap Max number of unused bytes between column chunks fetched in a single read
+   * @param strings_to_dictionary Whether to return strings as dictionary columns
+   * @param decimals_as_float Whether to convert decimals to float64, otherwise INT32 and INT64
+   * decimals are read as DECIMAL32 and DECIMAL64
    */
   reader_options(std::vector<std::string> columns,
                  bool strings_to_categorical,
                  bool use_pandas_metadata,
-                 data_type timestamp_type)
+                 data_type timestamp_type,
+                 std::vector<column_filter> filters = {},
+                 size_t max_read_gap                = 64 * 1024,
+                 bool strings_to_dictionary         = false,
+                 bool decimals_as_float             = true)
     : columns(std::move(columns)),
       strings_to_categorical(strings_to_categorical),
       use_pandas_metadata(use_pandas_metadata),
-      timestamp_type(timestamp_type)
+      timestamp_type(timestamp_type),
+      filters(std::move(filters)),
+      max_read_gap(max_read_gap),
+      strings_to_dictionary(strings_to_dictionary),
+      decimals_as_float(decimals_as_float)
   {
   }
 };
@@ -569,6 +684,31 @@ class reader {
                   reader_options const &options,
                   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Constructor from a list of file paths
+   *
+   * The files are read as a single dataset: their row groups are concatenated in file order, so
+   * row group indices are global across the files. All the files must share the same schema.
+   *
+   * @param filepaths Paths to the files containing the dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit reader(std::vector<std::string> const &filepaths,
+                  reader_options const &options,
+                  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Constructor from a list of datasources
+   *
+   * @param sources Input datasource objects to read the dataset from, in order
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit reader(std::vector<std::unique_ptr<cudf::io::datasource>> sources,
+                  reader_options const &options,
+                  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
   /**
    * @brief Destructor explicitly-declared to avoid inlined in header
    */
@@ -611,6 +751,21 @@ class reader {
   table_with_metadata read_row_groups(const std::vector<size_type> &row_group_list,
                                       cudaStream_t stream = 0);
 
+  /**
+   * @brief Returns the row groups whose statistics allow some of their rows to satisfy the
+   * filters.
+   *
+   * Only the file metadata and page indexes are read; no column data is decoded.
+   *
+   * @param row_group_list Indices of the row groups to check; empty for all row groups
+   *
+   * @return Index and number of rows of each remaining row group, in list order
+   *
+   * @throw cudf::logic_error if row group index is out of range
+   */
+  std::vector<std::pair<size_type, size_type>> filter_row_groups(
+    const std::vector<size_type> &row_group_list);
+
   /**
    * @brief Reads a range of rows.
    *
@@ -621,8 +776,54 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Splits a range of rows into consecutive row ranges that can each be read within a
+   * device memory budget.
+   *
+   * @param chunk_read_limit Limit on the device memory used to read each range; `0` for no limit
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; use `0` for all remaining data
+   *
+   * @return List of row ranges, as pairs of (skip_rows, num_rows), to pass to `read_rows()`
+   */
+  std::vector<std::pair<size_type, size_type>> compute_row_splits(size_t chunk_read_limit,
+                                                                  size_type skip_rows,
+                                                                  size_type num_rows);
+
+  /**
+   * @brief Estimates the peak device memory used to read a selection of rows, from the file
+   * metadata only.
+   *
+   * The rows are selected like `read_row_groups()`, `read_row_group()` or `read_rows()` do, in
+   * this order of precedence.
+   *
+   * @param row_group_list Indices of the row groups to read; empty to select rows otherwise
+   * @param row_group Index of the first row group to read; `-1` to select rows by range
+   * @param row_group_count Number of row groups to read from `row_group`
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; use `0` for all remaining data
+   *
+   * @return Estimated number of bytes of device memory
+   *
+   * @throw cudf::logic_error if row group index is out of range
+   */
+  size_t estimate_read_memory(const std::vector<size_type> &row_group_list,
+                              size_type row_group,
+                              size_type row_group_count,
+                              size_type skip_rows,
+                              size_type num_rows);
 };
 
+/**
+ * @brief Reads the schema and the row groups metadata of a source from its footer only.
+ *
+ * @param source Dataset source
+ *
+ * @return The file-level metadata
+ */
+source_metadata read_metadata(datasource *source);
+
 }  // namespace parquet
 
 }  // namespace detail
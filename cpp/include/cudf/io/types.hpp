@@ -25,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // Forward declarations
@@ -57,7 +58,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< ZSTD format, using LZ77 + Huffman + FSE entropy coding
+  DEFLATE  ///< DEFLATE format, as used by the ZLIB codec of ORC
 };
 
 /**
@@ -69,6 +72,7 @@ enum class io_type {
   ARROW_RANDOM_ACCESS_FILE,  ///< Input/output is an arrow::io::RandomAccessFile
   VOID,                      ///< Input/output is nothing. No work is done. Useful for benchmarking
   USER_IMPLEMENTED,          ///< Input/output is handled by a custom user class
+  DEVICE_BUFFER,             ///< Output is a buffer in device memory
 };
 
 /**
@@ -90,6 +94,106 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
 };
 
+/**
+ * @brief Dictionary encoding policy of a parquet writer column
+ */
+enum class dictionary_policy {
+  ADAPTIVE,  ///< Use a dictionary if it makes the column chunk smaller than PLAIN encoding
+  ALWAYS,    ///< Use a dictionary whenever the column type supports it
+  NEVER      ///< Always use PLAIN encoding
+};
+
+/**
+ * @brief Comparison operators used by reader filter predicates
+ */
+enum class filter_op : int32_t {
+  EQUAL,          ///< Column value is equal to the literal
+  LESS,           ///< Column value is less than the literal
+  LESS_EQUAL,     ///< Column value is less than or equal to the literal
+  GREATER,        ///< Column value is greater than the literal
+  GREATER_EQUAL,  ///< Column value is greater than or equal to the literal
+  IN              ///< Column value is equal to any of the literals
+};
+
+/**
+ * @brief Constant value that a column is compared against in a filter predicate
+ *
+ * Integral, boolean and timestamp literals are held in `int_value` (timestamps as the number of
+ * ticks since the UNIX epoch), floating-point literals in `float_value` and string literals in
+ * `string_value`.
+ */
+struct filter_literal {
+  data_type type{EMPTY};     ///< Type of the literal
+  int64_t int_value  = 0;    ///< Value of integral, boolean and timestamp literals
+  double float_value = 0.0;  ///< Value of floating-point literals
+  std::string string_value;  ///< Value of string literals
+
+  filter_literal() = default;
+
+  explicit filter_literal(int32_t value) : type(INT32), int_value(value) {}
+
+  explicit filter_literal(int64_t value, data_type type_ = data_type{INT64})
+    : type(type_), int_value(value)
+  {
+  }
+
+  explicit filter_literal(double value) : type(FLOAT64), float_value(value) {}
+
+  explicit filter_literal(std::string value) : type(STRING), string_value(std::move(value)) {}
+};
+
+/**
+ * @brief Predicate comparing one column against one or more literals
+ *
+ * Readers evaluate predicates against the statistics stored in the file metadata to skip
+ * sections of the file that cannot contain any matching row.
+ */
+struct column_filter {
+  std::string column_name;             ///< Name of the column to compare
+  filter_op op = filter_op::EQUAL;     ///< Comparison operator
+  std::vector<filter_literal> values;  ///< Literals; exactly one unless `op` is `IN`
+
+  column_filter() = default;
+
+  column_filter(std::string name, filter_op op_, std::vector<filter_literal> values_)
+    : column_name(std::move(name)), op(op_), values(std::move(values_))
+  {
+  }
+};
+
+/**
+ * @brief Metadata of a column within a row group (Parquet) or a stripe (ORC)
+ *
+ * Minimum and maximum values use the representation of filter literals, in the units stored in
+ * the file (e.g. milliseconds for ORC timestamps).
+ */
+struct column_chunk_metadata {
+  int64_t null_count      = -1;     ///< Number of nulls, or -1 if unknown
+  int64_t compressed_size = -1;     ///< Size of the column data in the file, or -1 if unknown
+  bool has_minmax         = false;  ///< Whether `min_value` and `max_value` are set
+  filter_literal min_value;         ///< Minimum non-null value
+  filter_literal max_value;         ///< Maximum non-null value
+};
+
+/**
+ * @brief Metadata of a row group (Parquet) or a stripe (ORC)
+ */
+struct row_group_metadata {
+  int64_t num_rows  = 0;  ///< Number of rows
+  int64_t byte_size = 0;  ///< Uncompressed data size (Parquet) or stripe size in the file (ORC)
+  std::vector<column_chunk_metadata> columns;  ///< Metadata of each leaf column, in file order
+};
+
+/**
+ * @brief File-level metadata of a source, read from its footer only
+ */
+struct source_metadata {
+  int64_t num_rows = 0;                        ///< Total number of rows
+  std::vector<std::string> column_names;       ///< Names of the leaf columns, in file order
+  std::vector<data_type> column_types;         ///< Column types when read with default options
+  std::vector<row_group_metadata> row_groups;  ///< Row groups or stripes, in file order
+};
+
 /**
  * @brief Table metadata for io readers/writers (primarily column names)
  * For nested types (structs, maps, unions), the ordering of names in the column_names vector
@@ -143,13 +247,27 @@ struct table_with_metadata {
 struct source_info {
   io_type type = io_type::FILEPATH;
   std::string filepath;
+  std::vector<std::string> filepaths;
   std::pair<const char*, size_t> buffer;
   std::shared_ptr<arrow::io::RandomAccessFile> file;
   cudf::io::datasource* user_source = nullptr;
 
   source_info() = default;
 
-  explicit source_info(const std::string& file_path) : type(io_type::FILEPATH), filepath(file_path)
+  explicit source_info(const std::string& file_path)
+    : type(io_type::FILEPATH), filepath(file_path), filepaths{file_path}
+  {
+  }
+
+  /**
+   * @brief Source made of several files read as one dataset; only supported by Parquet readers
+   *
+   * @param file_paths Paths of the files, in dataset order; `filepath` is set to the first one
+   */
+  explicit source_info(const std::vector<std::string>& file_paths)
+    : type(io_type::FILEPATH),
+      filepath(file_paths.empty() ? std::string{} : file_paths.front()),
+      filepaths(file_paths)
   {
   }
 
@@ -175,8 +293,9 @@ struct source_info {
 struct sink_info {
   io_type type = io_type::VOID;
   std::string filepath;
-  std::vector<char>* buffer      = nullptr;
-  cudf::io::data_sink* user_sink = nullptr;
+  std::vector<char>* buffer         = nullptr;
+  rmm::device_buffer* device_buffer = nullptr;
+  cudf::io::data_sink* user_sink    = nullptr;
 
   sink_info() = default;
 
@@ -184,6 +303,11 @@ struct sink_info {
 
   explicit sink_info(std::vector<char>* buffer) : type(io_type::HOST_BUFFER), buffer(buffer) {}
 
+  explicit sink_info(rmm::device_buffer* device_buffer)
+    : type(io_type::DEVICE_BUFFER), device_buffer(device_buffer)
+  {
+  }
+
   explicit sink_info(class cudf::io::data_sink* user_sink_)
     : type(io_type::USER_IMPLEMENTED), user_sink(user_sink_)
   {
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 //! cuDF interfaces
 namespace cudf {
@@ -44,8 +45,18 @@ namespace orc {
 struct writer_options {
   /// Selects the compression format to use in the ORC file
   compression_type compression = compression_type::AUTO;
+  /// Compression level of DEFLATE and ZSTD; 0 for the codec default
+  int compression_level = 0;
   /// Enables writing column statistics in the ORC file
   bool enable_statistics = true;
+  /// Maximum uncompressed size of a stripe, in bytes
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe; -1 is 1M rows with string columns, 5M rows otherwise
+  size_type stripe_size_rows = -1;
+  /// Number of rows in each row group of the row index
+  size_type row_index_stride = 10000;
+  /// Buffer the tables of chunked writes on the device until they fill a stripe
+  bool buffer_tables = false;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -130,8 +141,21 @@ namespace parquet {
 struct writer_options {
   /// Selects the compressor to use in parquet file
   compression_type compression = compression_type::AUTO;
+  /// Compression level of GZIP and ZSTD; 0 for the codec default
+  int compression_level = 0;
   /// Select the statistics level to generate in the parquet file
   statistics_freq stats_granularity = statistics_freq::STATISTICS_ROWGROUP;
+  /// Dictionary encoding policy of each column; columns past the end use `ADAPTIVE`
+  std::vector<dictionary_policy> column_dictionary_policy;
+  /// Use DELTA_BINARY_PACKED / DELTA_LENGTH_BYTE_ARRAY for integer and string pages without a
+  /// dictionary instead of PLAIN
+  bool use_delta_encoding = false;
+  /// Write a split-block bloom filter for each column chunk
+  bool write_bloom_filters = false;
+  /// Maximum size in bytes of the pages of a batch of row groups encoded at once, which bounds
+  /// the device memory used by the writer; 0 for the default of 512MB. A batch holds at least
+  /// one row group.
+  size_t max_batch_size = 0;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
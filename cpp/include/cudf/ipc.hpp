@@ -16,3 +16,91 @@ class CudaMessageReader : arrow::ipc::MessageReader {
   arrow::io::BufferReader* host_schema_reader_ = nullptr;
   std::shared_ptr<arrow::cuda::CudaBufferReader> owned_stream_;
 };
+
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup copy_split
+ * @{
+ */
+
+/**
+ * @brief A table packed into one device buffer and exported for CUDA IPC.
+ *
+ * `handle` is a host blob that can be sent to any other process using the same GPU and passed
+ * to `import_ipc` there. The exporting process owns the device memory: `gpu_data` must stay
+ * alive until every process that imported the table has released it.
+ */
+struct ipc_exported_table {
+  std::vector<uint8_t> handle;                   ///< IPC handle and metadata of the table
+  std::shared_ptr<rmm::device_buffer> gpu_data;  ///< Packed device data of the table
+};
+
+/**
+ * @brief A table imported from another process with `import_ipc`.
+ *
+ * The device memory of the exporting process stays mapped into this process while any
+ * `ipc_imported_table` of the same handle is alive.
+ */
+class ipc_imported_table {
+ public:
+  struct mapping;
+
+  ipc_imported_table(std::shared_ptr<mapping> mapping, table_view view)
+    : _mapping(std::move(mapping)), _view(std::move(view))
+  {
+  }
+
+  /**
+   * @brief Returns a view of the imported table, valid while this object is alive
+   */
+  table_view const& view() const { return _view; }
+
+ private:
+  std::shared_ptr<mapping> _mapping;
+  table_view _view;
+};
+
+/**
+ * @brief Packs a copy of `input` into one device buffer and exports it for CUDA IPC.
+ *
+ * The data is packed with `cudf::pack` and `stream` is synchronized, so the data is complete
+ * when the handle is received. If `mr` suballocates from a larger allocation, the whole
+ * allocation is mapped into the importing processes.
+ *
+ * @param input The table to export
+ * @param mr Device memory resource used to allocate the exported device buffer
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The IPC handle of the table and the device buffer it refers to
+ */
+ipc_exported_table export_ipc(table_view const& input,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream                 = 0);
+
+/**
+ * @brief Imports a table exported by another process with `export_ipc`.
+ *
+ * No device memory is copied or allocated. Importing the same handle several times in one
+ * process maps the exported memory once, and it is unmapped when the last returned
+ * `ipc_imported_table` is destroyed. A handle cannot be imported by the process that exported
+ * it.
+ *
+ * @throws cudf::logic_error if `handle` is not an IPC handle of a table
+ * @throws cudf::cuda_error if the exported memory cannot be mapped
+ *
+ * @param handle The `handle` of an `ipc_exported_table`
+ * @return The imported table
+ */
+std::shared_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& handle);
+
+/** @} */  // end of group
+}  // namespace cudf
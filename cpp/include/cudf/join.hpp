@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/binaryop.hpp>
+
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -77,6 +79,7 @@ namespace cudf {
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -88,7 +91,8 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief  Performs a left join (also known as left outer join) on the
@@ -142,6 +146,7 @@ std::unique_ptr<cudf::table> inner_join(
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -153,7 +158,8 @@ std::unique_ptr<cudf::table> left_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief  Performs a full join (also known as full outer join) on the
@@ -207,6 +213,7 @@ std::unique_ptr<cudf::table> left_join(
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -218,7 +225,432 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Algorithm used to compute the row indices of an equality join
+ */
+enum class join_algorithm {
+  HASH,              ///< Build a hash table on the right table and probe it with the left table
+  SORT_MERGE,        ///< Binary search the left rows in the right rows sorted on the join columns
+  PARTITIONED_HASH,  ///< Hash partition both tables and hash join each pair of partitions, so
+                     ///< that the hash table of every partition stays cache resident
+};
+
+/**
+ * @brief Returns the row indices of an inner join on the specified columns of two tables
+ * (`left`, `right`), without gathering the joined table.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ *          left_on: {0}
+ *          right_on: {0}
+ * Result: { {1, 2}, {0, 1} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` and `right_on` are not equal
+ * @throws cudf::logic_error if the types of the joined columns do not match
+ *
+ * @param[in] left             The left table
+ * @param[in] right            The right table
+ * @param[in] left_on          The column indices from `left` to join on.
+ *                             The column from `left` indicated by `left_on[i]`
+ *                             will be compared against the column from `right`
+ *                             indicated by `right_on[i]`.
+ * @param[in] right_on         The column indices from `right` to join on.
+ * @param[in] algorithm        Algorithm used to compute the join. `SORT_MERGE` avoids building a
+ *                             hash table and skips sorting when `right` is already ordered.
+ * @param[in] mr               Device memory resource used to allocate the returned columns' device
+ *                             memory
+ * @param[in] stream           CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns                    Pair of INT32 columns of row indices into `left` and `right`
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  join_algorithm algorithm            = join_algorithm::HASH,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a left join on the specified columns of two tables
+ * (`left`, `right`), without gathering the joined table.
+ *
+ * Rows of `left` without a match in `right` are paired with the right index -1.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ *          left_on: {0}
+ *          right_on: {0}
+ * Result: { {0, 1, 2}, {-1, 0, 1} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` and `right_on` are not equal
+ * @throws cudf::logic_error if the types of the joined columns do not match
+ *
+ * @param[in] left             The left table
+ * @param[in] right            The right table
+ * @param[in] left_on          The column indices from `left` to join on.
+ * @param[in] right_on         The column indices from `right` to join on.
+ * @param[in] algorithm        Algorithm used to compute the join. `SORT_MERGE` avoids building a
+ *                             hash table and skips sorting when `right` is already ordered.
+ * @param[in] mr               Device memory resource used to allocate the returned columns' device
+ *                             memory
+ * @param[in] stream           CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns                    Pair of INT32 columns of row indices into `left` and `right`
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  join_algorithm algorithm            = join_algorithm::HASH,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a full join on the specified columns of two tables
+ * (`left`, `right`), without gathering the joined table.
+ *
+ * Rows of either table without a match in the other are paired with the index -1.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ *          left_on: {0}
+ *          right_on: {0}
+ * Result: { {-1, 0, 1, 2}, {2, -1, 0, 1} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` and `right_on` are not equal
+ * @throws cudf::logic_error if the types of the joined columns do not match
+ *
+ * @param[in] left             The left table
+ * @param[in] right            The right table
+ * @param[in] left_on          The column indices from `left` to join on.
+ * @param[in] right_on         The column indices from `right` to join on.
+ * @param[in] algorithm        Algorithm used to compute the join. `SORT_MERGE` avoids building a
+ *                             hash table and skips sorting when `right` is already ordered.
+ * @param[in] mr               Device memory resource used to allocate the returned columns' device
+ *                             memory
+ * @param[in] stream           CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns                    Pair of INT32 columns of row indices into `left` and `right`
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  join_algorithm algorithm            = join_algorithm::HASH,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Comparison between a column of the left table and a column of the right table that
+ * the rows joined by a conditional join must satisfy
+ */
+struct join_condition {
+  size_type left_column;   ///< Index of the compared column in the left table
+  binary_operator op;      ///< Comparison operator, e.g. `binary_operator::LESS_EQUAL`
+  size_type right_column;  ///< Index of the compared column in the right table
+};
+
+/**
+ * @brief Returns the row indices of an inner join of two tables (`left`, `right`) on arbitrary
+ * comparisons of their columns.
+ *
+ * A pair of rows is joined when `left[c.left_column] c.op right[c.right_column]` is true for
+ * every condition `c`; comparisons with null values are not satisfied. The conditions are
+ * evaluated with binary operations on blocks of candidate pairs, so the work is proportional to
+ * `left.num_rows() * right.num_rows()` but the product is never materialized at once.
+ *
+ * @code{.pseudo}
+ *          Left ts: {1, 5, 9}
+ *          Right start: {0, 4}, end: {6, 8}
+ *          conditions: {{0, GREATER_EQUAL, 0}, {0, LESS_EQUAL, 1}}
+ * Result: { {0, 1, 1}, {0, 0, 1} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `conditions` is empty
+ * @throws std::out_of_range if a condition column does not exist
+ *
+ * @param[in] left             The left table
+ * @param[in] right            The right table
+ * @param[in] conditions       Comparisons that joined rows must all satisfy
+ * @param[in] mr               Device memory resource used to allocate the returned columns' device
+ *                             memory
+ * @param[in] stream           CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns                    Pair of INT32 columns of row indices into `left` and `right`
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+conditional_inner_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<join_condition> const& conditions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a band join of two columns (`left`, `right`).
+ *
+ * Row `i` of `left` is joined with row `j` of `right` when
+ * `right[j] + lower <= left[i] <= right[j] + upper`. `right` is sorted and the band of every
+ * left value is located by binary search, which avoids evaluating every pair of rows. Null values
+ * do not match anything.
+ *
+ * @code{.pseudo}
+ *          Left ts: {1, 5, 9}
+ *          Right ts: {4, 8}
+ *          lower: -1, upper: 2
+ * Result: { {1, 2}, {0, 1} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `lower` or `upper` is null
+ *
+ * @param[in] left             The left column
+ * @param[in] right            The right column
+ * @param[in] lower            Lower bound of `left - right`; `left - lower` must be of the type
+ *                             of `right`, e.g. a duration for timestamp columns
+ * @param[in] upper            Upper bound of `left - right`, of the same type as `lower`
+ * @param[in] mr               Device memory resource used to allocate the returned columns' device
+ *                             memory
+ * @param[in] stream           CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns                    Pair of INT32 columns of row indices into `left` and `right`
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> band_inner_join_indices(
+  cudf::column_view const& left,
+  cudf::column_view const& right,
+  cudf::scalar const& lower,
+  cudf::scalar const& upper,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Hash join that builds the hash table once from a `build` table and probes it with
+ * any number of `probe` tables.
+ *
+ * Each probe returns a pair of INT32 gather maps (probe row indices, build row indices). Rows
+ * without a match are paired with the index -1.
+ *
+ * @code{.pseudo}
+ *          build b: {1, 2, 3}
+ *          probe a: {0, 1, 2}
+ *          hash_join(build, {0}).inner_join(probe, {0})
+ * Result: { {1, 2}, {0, 1} }
+ *          hash_join(build, {0}).left_join(probe, {0})
+ * Result: { {0, 1, 2}, {-1, 0, 1} }
+ * @endcode
+ *
+ * The `build` table must outlive the `hash_join` object.
+ */
+class hash_join {
+ public:
+  hash_join() = delete;
+  ~hash_join();
+  hash_join(hash_join const&) = delete;
+  hash_join(hash_join&&)      = delete;
+  hash_join& operator=(hash_join const&) = delete;
+  hash_join& operator=(hash_join&&) = delete;
+
+  /**
+   * @brief Constructs a hash join object from the `build_on` columns of the `build` table.
+   *
+   * @throws cudf::logic_error if `build_on` is empty or `build` has too many rows
+   *
+   * @param build The build table, whose rows are inserted into the hash table
+   * @param build_on The column indices from `build` to join on
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  hash_join(cudf::table_view const& build,
+            std::vector<size_type> const& build_on,
+            cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the row indices of an inner join between the `probe_on` columns of `probe`
+   * and the build table.
+   *
+   * @throws cudf::logic_error if the number or the types of the `probe_on` columns do not match
+   * the build columns
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on. Column `probe_on[i]` is
+   *                 compared with the i-th build column
+   * @param mr Device memory resource used to allocate the returned columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @returns Pair of INT32 columns of row indices into `probe` and into the build table
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the row indices of a left join between the `probe_on` columns of `probe`
+   * and the build table.
+   *
+   * Every row of `probe` appears at least once; probe rows without a match are paired with the
+   * build index -1.
+   *
+   * @throws cudf::logic_error if the number or the types of the `probe_on` columns do not match
+   * the build columns
+   *
+   * @param probe The probe (left) table
+   * @param probe_on The column indices from `probe` to join on
+   * @param mr Device memory resource used to allocate the returned columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @returns Pair of INT32 columns of row indices into `probe` and into the build table
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the row indices of a full join between the `probe_on` columns of `probe`
+   * and the build table.
+   *
+   * In addition to the left join indices, build rows not matched by any probe row are paired
+   * with the probe index -1 at the beginning of the result.
+   *
+   * @throws cudf::logic_error if the number or the types of the `probe_on` columns do not match
+   * the build columns
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param mr Device memory resource used to allocate the returned columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @returns Pair of INT32 columns of row indices into `probe` and into the build table
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the exact number of rows of the inner join between the `probe_on` columns of
+   * `probe` and the build table, without materializing the join indices.
+   *
+   * @throws cudf::logic_error if the number or the types of the `probe_on` columns do not match
+   * the build columns
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @returns Number of rows returned by `inner_join(probe, probe_on)`
+   */
+  size_type inner_join_size(cudf::table_view const& probe,
+                            std::vector<size_type> const& probe_on,
+                            cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Returns the exact number of rows of the left join between the `probe_on` columns of
+   * `probe` and the build table, without materializing the join indices.
+   *
+   * @throws cudf::logic_error if the number or the types of the `probe_on` columns do not match
+   * the build columns
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @returns Number of rows returned by `left_join(probe, probe_on)`
+   */
+  size_type left_join_size(cudf::table_view const& probe,
+                           std::vector<size_type> const& probe_on,
+                           cudaStream_t stream = 0) const;
+
+ private:
+  class impl;
+  std::unique_ptr<const impl> _impl;
+};
+
+/**
+ * @brief Bloom filter of the rows of a key table, used to drop the rows of a probe table that
+ * cannot match any key before they are joined, shuffled or read.
+ *
+ * The filter never rejects a row equal to a key; other rows are accepted with a probability
+ * close to the false positive rate requested on construction. Rows are hashed like the hash
+ * join does, so null keys are equal to each other.
+ */
+class bloom_filter {
+ public:
+  /**
+   * @brief Builds a bloom filter of the rows of `keys`.
+   *
+   * @throws cudf::logic_error if `keys` has no column or `false_positive_rate` is not in (0, 1)
+   *
+   * @param keys Table of the key columns
+   * @param false_positive_rate Target probability of accepting a row that is not a key
+   * @param mr Device memory resource used to allocate the filter bits
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  bloom_filter(cudf::table_view const& keys,
+               double false_positive_rate          = 0.01,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+               cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Returns the filter bits, as an array of `num_bits() / 32` 32-bit words
+   */
+  rmm::device_buffer const& bits() const { return _bits; }
+
+  /**
+   * @brief Returns the number of bits of the filter, a multiple of 32
+   */
+  std::size_t num_bits() const { return _bits.size() * 8; }
+
+  /**
+   * @brief Returns the number of bits set for each key
+   */
+  int num_hashes() const { return _num_hashes; }
+
+  /**
+   * @brief Returns the types of the key columns
+   */
+  std::vector<data_type> const& key_types() const { return _key_types; }
+
+ private:
+  std::vector<data_type> _key_types;
+  int _num_hashes;
+  rmm::device_buffer _bits;
+};
+
+/**
+ * @brief Returns whether each row of `probe` may be one of the keys of a bloom filter.
+ *
+ * @throws cudf::logic_error if the column types of `probe` do not match the key types
+ *
+ * @param filter The bloom filter
+ * @param probe Table of the columns compared with the keys
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns BOOL8 column that is false for the rows that are not keys, and true for the keys and
+ * the false positives
+ */
+std::unique_ptr<cudf::column> bloom_filter_contains(
+  bloom_filter const& filter,
+  cudf::table_view const& probe,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @brief  Performs a left semi join on the specified columns of two
  * tables (`left`, `right`)
@@ -260,6 +692,7 @@ std::unique_ptr<cudf::table> full_join(
  *                             include in the returned table.
  * @param[in] mr               Device memory resource used to allocate the returned table's device
  *                             memory
+ * @param[in] stream           CUDA stream used for device memory operations and kernel launches.
  *
  * @returns                    Result of joining `left` and `right` tables on the columns
  *                             specified by `left_on` and `right_on`. The resulting table
@@ -271,7 +704,8 @@ std::unique_ptr<cudf::table> left_semi_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<cudf::size_type> const& return_columns,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief  Performs a left anti join on the specified columns of two
@@ -314,6 +748,7 @@ std::unique_ptr<cudf::table> left_semi_join(
  *                             include in the returned table.
  * @param[in] mr               Device memory resource used to allocate the returned table's device
  *                             memory
+ * @param[in] stream           CUDA stream used for device memory operations and kernel launches.
  *
  * @returns                    Result of joining `left` and `right` tables on the columns
  *                             specified by `left_on` and `right_on`. The resulting table
@@ -325,7 +760,8 @@ std::unique_ptr<cudf::table> left_anti_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<cudf::size_type> const& return_columns,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a cross join on two tables (`left`, `right`)
@@ -346,13 +782,69 @@ std::unique_ptr<cudf::table> left_anti_join(
  * @param left  The left table
  * @param right The right table
  * @param mr    Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns     Result of cross joining `left` and `right` tables
  */
 std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Type of the equality join whose device memory is estimated by `estimate_join_memory`
+ */
+enum class join_type {
+  INNER,  ///< `inner_join`
+  LEFT,   ///< `left_join`
+  FULL,   ///< `full_join`
+};
+
+/**
+ * @brief Estimates the peak device memory used by a hash join of two tables (`left`, `right`),
+ * including the returned table, so that work can be split before it runs out of memory.
+ *
+ * Only the sizes and types of the columns are used; no data is read and nothing is allocated.
+ * The number of joined rows is estimated from the number of distinct join keys, assuming that
+ * the rows of both tables are spread uniformly over them: an inner join then returns
+ * `left.num_rows() * right.num_rows() / num_distinct_keys` rows. A left join returns at least
+ * every row of `left`, and a full join also counts every row of `right`, which bounds its size
+ * from above. Variable-width output columns, such as strings, are sized from the average size of
+ * their input rows.
+ *
+ * @code{.pseudo}
+ *          left: 1000 rows of {INT32, INT32}
+ *          right: 100 rows of {INT32, INT64}
+ *          left_on: {0}, right_on: {0}, columns_in_common: { {0, 0} }
+ *          num_distinct_keys: 100
+ * Result: hash table of `right` and 1000 pairs of row indices while probing, then 1000 pairs of
+ *         row indices and 1000 rows of {INT32, INT32, INT64} while gathering
+ * @endcode
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` and `right_on` are not equal
+ *
+ * @param[in] left              The left table
+ * @param[in] right             The right table
+ * @param[in] left_on           The column indices from `left` to join on
+ * @param[in] right_on          The column indices from `right` to join on
+ * @param[in] columns_in_common Pairs of column indices into `left` and `right` that are returned
+ *                              once, as passed to `inner_join`
+ * @param[in] type              Type of the join
+ * @param[in] num_distinct_keys Estimated number of distinct join keys, e.g. from column
+ *                              statistics or `approx_nunique`; `-1` if the keys of `right` are
+ *                              unique
+ *
+ * @returns                     Estimated peak number of bytes allocated by the join
+ */
+std::size_t estimate_join_memory(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  join_type type                    = join_type::INNER,
+  cudf::size_type num_distinct_keys = -1);
 
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+namespace cudf {
+//! Lists column APIs
+namespace lists {
+/**
+ * @addtogroup lists_apis
+ * @{
+ */
+
+/**
+ * @brief Returns a BOOL8 column indicating whether each list contains the
+ * search key.
+ *
+ * Null elements never match the key. Any null list results in a null entry
+ * for that row in the output column, and all the entries are null if the
+ * search key is null.
+ *
+ * @code{.pseudo}
+ * lists = { {1, 2, 3}, {}, null, {4, 2} }
+ * contains(lists, 2) = { true, false, null, true }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the type of `search_key` is not the type of the
+ * list elements, or the elements are nested or dictionary columns.
+ *
+ * @param lists Lists instance for this operation.
+ * @param search_key The value to look for in every list.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New BOOL8 column with one entry per list.
+ */
+std::unique_ptr<column> contains(
+  lists_column_view const& lists,
+  scalar const& search_key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of lists_apis group
+
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+//! Lists column APIs
+namespace lists {
+/**
+ * @addtogroup lists_apis
+ * @{
+ */
+
+/**
+ * @brief Returns an INT32 column of the number of elements of each list.
+ *
+ * The counts are the differences of consecutive offsets, so nested elements
+ * count as one element each. Any null list results in a null entry for that
+ * row in the output column.
+ *
+ * @code{.pseudo}
+ * lists = { {1, 2, 3}, {}, null, {4} }
+ * count_elements(lists) = { 3, 0, null, 1 }
+ * @endcode
+ *
+ * @param lists Lists instance for this operation.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column with the number of elements of each list.
+ */
+std::unique_ptr<column> count_elements(
+  lists_column_view const& lists,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of lists_apis group
+
+}  // namespace lists
+}  // namespace cudf
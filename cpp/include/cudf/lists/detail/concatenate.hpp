@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+/**
+ * @brief Returns a single column by vertically concatenating the given vector of
+ * lists columns.
+ *
+ * The offsets of every input are shifted to follow the elements of the previous inputs and
+ * the children are concatenated with a single call, which recurses for nested lists.
+ *
+ * ```
+ * l1 = { {1, 2}, {3} }
+ * l2 = { {}, {4, 5} }
+ * concatenate({l1, l2}) is { {1, 2}, {3}, {}, {4, 5} }
+ * ```
+ *
+ * @throw cudf::logic_error if the children of the input columns are not all the same type.
+ *
+ * @param columns Vector of lists columns to concatenate.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New lists column.
+ */
+std::unique_ptr<column> concatenate(
+  std::vector<column_view> const& columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+/**
+ * @brief The offsets of a gathered lists column and the gather map of its elements.
+ */
+struct gather_data {
+  std::unique_ptr<column> offsets;          ///< Offsets of the gathered lists
+  rmm::device_vector<size_type> child_map;  ///< Child row of every element of the gathered lists
+};
+
+/**
+ * @brief Computes the offsets of the lists gathered from `source` and the gather map of
+ * their elements.
+ *
+ * The child of the lists is then gathered with `child_map` in a single call, whatever the
+ * number of lists, and nested lists repeat this once per level of nesting.
+ *
+ * ```
+ * source = { {1, 2}, {3}, {4, 5, 6} }
+ * map    = {2, 0}
+ * make_gather_data(source, map) is { offsets = {0, 3, 5}, child_map = {3, 4, 5, 0, 1} }
+ * ```
+ *
+ * @tparam NullifyOutOfBounds If true, indices outside the column's range gather empty lists.
+ * @tparam MapIterator Iterator for retrieving integer indices of the column.
+ *
+ * @param source Lists instance for this operation.
+ * @param gather_map_begin Start of the gather map.
+ * @param num_rows Number of rows in the gather map.
+ * @param mr Device memory resource used to allocate the returned offsets' device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The gathered offsets and the gather map of the child column.
+ */
+template <bool NullifyOutOfBounds, typename MapIterator>
+gather_data make_gather_data(lists_column_view const& source,
+                             MapIterator gather_map_begin,
+                             size_type num_rows,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  auto const execpol      = rmm::exec_policy(stream);
+  auto const source_count = source.size();
+  auto const d_source     = source.offsets().data<size_type>() + source.offset();
+
+  // The size of every gathered list, scanned into the output offsets
+  auto offsets = make_numeric_column(
+    data_type{INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = offsets->mutable_view().data<size_type>();
+  thrust::transform(execpol->on(stream),
+                    gather_map_begin,
+                    gather_map_begin + num_rows,
+                    d_offsets,
+                    [d_source, source_count] __device__(size_type index) {
+                      if (NullifyOutOfBounds && ((index < 0) || (index >= source_count))) {
+                        return size_type{0};
+                      }
+                      return d_source[index + 1] - d_source[index];
+                    });
+  thrust::exclusive_scan(
+    execpol->on(stream), d_offsets, d_offsets + num_rows + 1, d_offsets, size_type{0});
+  auto const num_elements = cudf::detail::get_value<size_type>(offsets->view(), num_rows, stream);
+
+  // Each element finds its output list in the new offsets and then its source row
+  rmm::device_vector<size_type> child_map(num_elements);
+  auto const d_child_map = child_map.data().get();
+  thrust::upper_bound(execpol->on(stream),
+                      d_offsets + 1,
+                      d_offsets + num_rows + 1,
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_elements),
+                      d_child_map);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_elements),
+                    d_child_map,
+                    d_child_map,
+                    [d_source, d_offsets, gather_map_begin] __device__(size_type element,
+                                                                        size_type row) {
+                      auto const index = static_cast<size_type>(gather_map_begin[row]);
+                      return d_source[index] + (element - d_offsets[row]);
+                    });
+
+  return gather_data{std::move(offsets), std::move(child_map)};
+}
+
+}  // namespace detail
+}  // namespace lists
+}  // namespace cudf
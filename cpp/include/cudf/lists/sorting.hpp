@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/types.hpp>
+
+namespace cudf {
+//! Lists column APIs
+namespace lists {
+/**
+ * @addtogroup lists_apis
+ * @{
+ */
+
+/**
+ * @brief Sorts the elements within each list.
+ *
+ * All the lists are sorted together by a single sort of the child elements on
+ * the pair (row, element), so the number of lists does not affect the number
+ * of kernels launched. The offsets, and so the size of every list, are
+ * unchanged; null lists stay null.
+ *
+ * @code{.pseudo}
+ * lists = { {3, 1, 2}, {}, null, {5, null, 4} }
+ * sort_lists(lists, ASCENDING, AFTER) = { {1, 2, 3}, {}, null, {4, 5, null} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the list elements are nested columns.
+ *
+ * @param lists Lists instance for this operation.
+ * @param column_order The order of the elements within each list.
+ * @param null_precedence The position of the null elements within each list.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column with the sorted elements.
+ */
+std::unique_ptr<column> sort_lists(
+  lists_column_view const& lists,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of lists_apis group
+
+}  // namespace lists
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 #include <memory>
 #include <vector>
@@ -73,11 +74,18 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
  * the same bin are grouped consecutively in the output table. Returns a vector
  * of row offsets to the start of each partition in the output table.
  *
+ * With `hash_id::HASH_XXHASH64` the partitions are assigned from 64-bit row hashes, which are
+ * slower to compute than the 32-bit `hash_id::HASH_MURMUR3` hashes but collide much less often.
+ * With `hash_id::HASH_SPARK_MURMUR3` every row goes to the partition Spark's `HashPartitioning`
+ * assigns it, the positive modulo of its `Murmur3Hash` value, so the output is co-partitioned
+ * with Spark data hashed on the same columns.
+ *
  * @throw std::out_of_range if index is `columns_to_hash` is invalid
  *
  * @param input The table to partition
  * @param columns_to_hash Indices of input columns to hash
  * @param num_partitions The number of partitions to use
+ * @param hash_function The hash function used to hash the rows
  * @param mr Device memory resource used to allocate the returned table's device memory.
  *
  * @returns An output table and a vector of row offsets to each partition
@@ -86,8 +94,89 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Hash partitions the rows of the input table directly into one contiguous buffer
+ * per partition.
+ *
+ * Rows are assigned to partitions exactly like `hash_partition`, but instead of a single
+ * partitioned table followed by a `contiguous_split`, every row is copied once from `input`
+ * into the buffer of its partition. Each result holds the rows of one partition, in the same
+ * order as the matching slice of the `hash_partition` output, laid out like the results of
+ * `contiguous_split` so it can be sent as is during a shuffle.
+ *
+ * Only fixed-width and strings columns are supported.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw cudf::logic_error if `input` has a column that is neither fixed-width nor strings
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function The hash function used to hash the rows
+ * @param mr Device memory resource used to allocate the returned buffers' device memory.
+ *
+ * @returns One packed table per partition, or no table if `num_partitions <= 0`
+ */
+std::vector<contiguous_split_result> hash_partition_to_buffers(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions rows from the input table into multiple output tables by ranges of
+ * the key columns.
+ *
+ * Evenly spaced rows of the keys selected by `key_columns` are sampled and sorted, and
+ * `num_partitions - 1` of them, at every `1 / num_partitions` quantile of the sample, are
+ * chosen as splitters. Every row is then assigned to the partition given by the
+ * `upper_bound` of its keys among the splitters, so rows with keys equal to a splitter go
+ * to the partition that starts at that splitter. Rows are then grouped into partitions
+ * exactly like `partition`, and the order of the rows within a partition is unspecified.
+ *
+ * Every row of partition `i` sorts before or equal to every row of partition `i + 1`
+ * according to `column_order` and `null_precedence`. Partitions can be empty when the keys
+ * have many duplicates.
+ *
+ * ```
+ * Example:
+ * input:
+ * table => col 1 {5, 1, 8, 3, 9, 2, 7, 4, 6, 0}
+ * key_columns = {0}
+ * num_partitions = 2
+ *
+ * output: pair<table, partition_offsets>
+ * table => col 1 {1, 3, 2, 4, 0, 5, 8, 9, 7, 6}
+ * partition_offsets => {0, 5, 10}
+ * ```
+ *
+ * @throw std::out_of_range if an index of `key_columns` is invalid
+ * @throw cudf::logic_error if `column_order` or `null_precedence` are not empty and their
+ * size differs from the size of `key_columns`
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of input columns to partition by
+ * @param num_partitions The number of partitions to use
+ * @param column_order The desired order of each key column. If empty, all key columns are
+ * sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements of
+ * each key column. If empty, null elements come before other elements.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @returns An output table and a vector of row offsets to each partition
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  size_type num_partitions,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
 /**
  * @brief Round-robin partition.
  *
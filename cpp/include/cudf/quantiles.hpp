@@ -20,6 +20,8 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 namespace cudf {
 /**
  * @addtogroup column_quantiles
@@ -73,6 +75,11 @@ std::unique_ptr<column> quantile(
  * quantiles `<= 0` correspond to row `0`. (first)
  * quantiles `>= 1` correspond to row `input.size() - 1`. (last)
  *
+ * Unsorted input is not sorted when at most 8 quantiles are requested and
+ * the rows pack into 64-bit sort keys, e.g. a single numeric column without
+ * nulls or a few narrow columns: the rows are then found by radix select, in
+ * a fixed number of passes over the keys.
+ *
  * @param input           Table used to compute quantile rows.
  * @param q               Desired quantiles in range [0, 1].
  * @param interp          Strategy used to select between the two rows on either
@@ -93,5 +100,101 @@ std::unique_ptr<table> quantiles(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
 
+/**
+ * @brief Bounded-memory, mergeable sketch of a stream of values that estimates
+ * their quantiles without sorting them.
+ *
+ * The sketch is a t-digest: values are summarized by weighted centroids, the
+ * weight of a centroid being the number of values it stands for. Centroids near
+ * the extreme quantiles are kept small and centroids near the median are
+ * allowed to grow, so that the relative error is lowest on the tails. A t-digest
+ * has at most `compression / 2 + 1` centroids, whatever the number of values
+ * added.
+ *
+ * Values are added batch by batch with `add`, and sketches built separately,
+ * e.g. over partitions of the data, are combined with `merge`.
+ *
+ * ```
+ * tdigest digest;
+ * digest.add(batch1);  // [1, 2, null, 3]
+ * digest.add(batch2);  // [4, 5]
+ * digest.quantile({0, 0.5, 1});  // [1, 3, 5]
+ * ```
+ */
+class tdigest {
+ public:
+  /**
+   * @brief Creates an empty t-digest.
+   *
+   * @throws cudf::logic_error if `compression` is not positive
+   *
+   * @param compression Bound on the size of the sketch. Higher values trade
+   * memory for accuracy.
+   */
+  explicit tdigest(double compression = 100);
+
+  tdigest(tdigest&&) = default;
+  tdigest& operator=(tdigest&&) = default;
+
+  /**
+   * @brief Adds the values of a numeric column to the sketch.
+   *
+   * Null and NaN values are ignored.
+   *
+   * @throws cudf::logic_error if `values` is not numeric
+   *
+   * @param values Values to add
+   */
+  void add(column_view const& values);
+
+  /**
+   * @brief Adds the values summarized by another sketch to this sketch.
+   *
+   * @throws cudf::logic_error if the sketches do not have the same compression
+   *
+   * @param other Sketch to merge into this sketch
+   */
+  void merge(tdigest const& other);
+
+  /**
+   * @brief Estimates quantiles of the values added to the sketch.
+   *
+   * The estimates interpolate linearly between the centroids, and between the
+   * minimum and maximum values and the first and last centroids.
+   *
+   * @param q Quantiles in range [0, 1]
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @returns `FLOAT64` column of the estimates, all null if no value was added
+   */
+  std::unique_ptr<column> quantile(
+    std::vector<double> const& q,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Returns the number of values added to the sketch.
+   */
+  double count() const noexcept { return _count; }
+
+  /**
+   * @brief Returns the compression the sketch was created with.
+   */
+  double compression() const noexcept { return _compression; }
+
+  /**
+   * @brief Returns the centroids of the sketch, as a table of `FLOAT64` means
+   * sorted in ascending order and of their `FLOAT64` weights.
+   */
+  table_view centroids() const;
+
+ private:
+  double _compression;
+  double _count{0};
+  double _min;
+  double _max;
+  size_type _num_centroids{0};
+  rmm::device_buffer _means{};
+  rmm::device_buffer _weights{};
+};
+
 /** @} */  // end of group
 }  // namespace cudf
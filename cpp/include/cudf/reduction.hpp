@@ -18,6 +18,12 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/selection.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
 
 namespace cudf {
 /**
@@ -39,6 +45,13 @@ enum class scan_type : bool { INCLUSIVE, EXCLUSIVE };
  * If the column is empty, the member `is_valid()` of the output scalar
  * will contain `false`.
  *
+ * Fixed-width `sum`, `product`, `min`, `max`, `any`, `all`, `sum_of_squares`,
+ * `mean`, `var` and `std` reductions are computed entirely on the device: the
+ * value and validity of the returned scalar are written by kernels enqueued on
+ * the stream, and can be consumed on the device (e.g. by a binary operation
+ * with the scalar) without synchronizing. String `min` and `max` copy the
+ * result string and therefore synchronize.
+ *
  * @throws cudf::logic_error if reduction is called for non-arithmetic output
  * type and operator other than `min` and `max`.
  * @throws cudf::logic_error if input column data type is not convertible to
@@ -62,6 +75,121 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Computes several reductions of every column of a table.
+ *
+ * The result has a single row and `input.num_columns() * aggs.size()`
+ * columns: column `i * aggs.size() + j` holds the reduction of column `i` by
+ * `aggs[j]`. On arithmetic columns, `sum`, `product`, `sum_of_squares`,
+ * `min`, `max`, `any`, `all`, `mean`, `count_valid` and `count_all` are all
+ * computed by a single traversal of the column, and the results of all
+ * columns are copied to the host once. Other aggregations, and other column
+ * types, are reduced one at a time with `reduce`.
+ *
+ * The output types are:
+ * - `sum`, `product`, `sum_of_squares`: `INT64` for integral and boolean
+ *   columns, `FLOAT64` for floating-point columns
+ * - `min`, `max`: the type of the column
+ * - `any`, `all`: `BOOL8`
+ * - `count_valid`, `count_all`, `nunique`: `INT32`
+ * - any other aggregation: `FLOAT64`
+ *
+ * As for `reduce`, null values are skipped and a reduction of a column
+ * without valid values is null, except for the counts.
+ *
+ * @throws cudf::logic_error if an aggregation is not supported on the type of
+ * a column.
+ *
+ * @param[in] input Input table
+ * @param[in] aggs The aggregations applied to every column
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @returns  Table of a single row holding the result of every reduction
+ */
+std::unique_ptr<table> reduce(
+  table_view const &input,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the values in all rows of a chunked column
+ * without concatenating its chunks.
+ *
+ * Equivalent to `reduce(concatenate(col), agg, output_dtype)`. `sum`,
+ * `product`, `min`, `max`, `any`, `all` and `sum_of_squares` reduce every
+ * chunk and then combine the partial results. Other aggregations materialize
+ * the chunked column first.
+ *
+ * @throws cudf::logic_error in the same cases as `reduce` on a column.
+ *
+ * @param[in] col Input chunked column view
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned scalar's device memory
+ * @returns  cudf::scalar the result value
+ */
+std::unique_ptr<scalar> reduce(
+  chunked_column_view const &col,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the values in the selected rows of a
+ * column without materializing them.
+ *
+ * Equivalent to `reduce(apply_selection(table_view{{col}}, rows)->get_column(0),
+ * agg, output_dtype)`. The unselected rows are masked as nulls, which the
+ * reduction skips, so only a null mask is allocated. `nunique` and
+ * `approx_nunique` including nulls materialize the selected rows first.
+ *
+ * @throws cudf::logic_error in the same cases as `reduce` on a column.
+ * @throws cudf::logic_error if a `BOOLEAN_MASK` selection does not have as
+ * many rows as `col`.
+ *
+ * @param[in] col Input column view
+ * @param[in] rows The selected rows of `col`
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned scalar's device memory
+ * @returns  cudf::scalar the result value
+ */
+std::unique_ptr<scalar> reduce(
+  column_view const &col,
+  selection const &rows,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the reduction of the values in each segment of a column.
+ *
+ * Segment `i` is made of the rows `[offsets[i], offsets[i+1])` of `col`, and
+ * the result has one row per segment. Only `sum`, `product`, `min`, `max`,
+ * `any` and `all` are supported, on columns of arithmetic types. The null
+ * values are skipped for the operation; the result of a segment without any
+ * valid value is null.
+ *
+ * @throws cudf::logic_error if `offsets` is not a non-empty `INT32` column
+ * without nulls.
+ * @throws cudf::logic_error if the aggregation is not supported, or input
+ * column data type is not convertible to output data type.
+ * @throws cudf::logic_error if the output type of `any` or `all` is not `BOOL8`.
+ *
+ * @param[in] col Input column view
+ * @param[in] offsets Ascending offsets of the segments in `col`, including the
+ * end offset of the last segment
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns  Column of the reduction of every segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const &col,
+  column_view const &offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
@@ -86,5 +214,44 @@ std::unique_ptr<column> scan(const column_view &input,
                              null_policy null_handling           = null_policy::EXCLUDE,
                              rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Computes the scan of every segment of a column.
+ *
+ * Segment `i` is made of the rows `[offsets[i], offsets[i+1])` of `input`, and
+ * the scan restarts at the first row of every segment. With a single segment
+ * spanning `input`, the result is the same as `scan`. `sum`, `product`, `min`
+ * and `max` are supported on columns of arithmetic types, with the same null
+ * handling as `scan`.
+ *
+ * `rank` and `dense_rank` are supported as inclusive scans of fixed-width and
+ * string columns sorted within every segment: they rank every row among the
+ * rows of its segment, consecutive equal values (nulls included) getting the
+ * same rank. The result is an `INT32` column, with the nulls of `input` if
+ * `null_handling` is `null_policy::EXCLUDE`. `scan` supports them as well.
+ *
+ * @throws cudf::logic_error if `offsets` is not a non-empty `INT32` column
+ * without nulls.
+ * @throws cudf::logic_error if the aggregation is not supported for the type
+ * of `input`, or if a rank scan is exclusive.
+ *
+ * @param[in] input The input column view for the scan
+ * @param[in] offsets Ascending offsets of the segments in `input`, starting
+ * with 0 and ending with the size of `input`
+ * @param[in] agg unique_ptr to aggregation operator applied by the scan
+ * @param[in] inclusive The flag for applying an inclusive scan if
+ *            scan_type::INCLUSIVE, an exclusive scan if scan_type::EXCLUSIVE.
+ * @param[in] null_handling Exclude null values when computing the result if
+ * null_policy::EXCLUDE. Include nulls if null_policy::INCLUDE.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @returns unique pointer to new output column
+ */
+std::unique_ptr<column> segmented_scan(
+  column_view const &input,
+  column_view const &offsets,
+  std::unique_ptr<aggregation> const &agg,
+  scan_type inclusive,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
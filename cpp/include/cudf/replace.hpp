@@ -17,7 +17,10 @@
 #pragma once
 
 #include <cudf/types.hpp>
+
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -25,6 +28,14 @@ namespace cudf {
  * @{
  */
 
+/**
+ * @brief Policy to replace null values with the closest non-null value in a column
+ */
+enum class replace_policy : bool {
+  PRECEDING,  ///< Replace with the closest preceding non-null value (forward-fill)
+  FOLLOWING   ///< Replace with the closest following non-null value (backward-fill)
+};
+
 /**
  * @brief Replaces all null values in a column with corresponding values of another column
  *
@@ -60,6 +71,78 @@ std::unique_ptr<column> replace_nulls(
   scalar const& replacement,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Replaces, in place, all null values in a fixed-width column with a scalar.
+ *
+ * The data of the null elements of `in_out` is overwritten with `replacement` and all the
+ * elements are marked valid. Nothing is done if `in_out` has no nulls or `replacement` is
+ * invalid.
+ *
+ * @throws cudf::logic_error if `in_out` is not a fixed-width column
+ * @throws cudf::logic_error if `replacement` does not have the type of `in_out`
+ *
+ * @param[in,out] in_out A column whose null values will be replaced
+ * @param[in] replacement Scalar used to replace null values in `in_out`.
+ */
+void replace_nulls_in_place(mutable_column_view& in_out, scalar const& replacement);
+
+/**
+ * @brief Replaces all null values in every column of a table with a scalar per column.
+ *
+ * If `input.column(j)[i]` is NULL, then `output.column(j)[i]` will contain `replacements[j]`.
+ * The fixed-width columns are processed together in a single kernel launch.
+ *
+ * @throws cudf::logic_error if the number of replacements does not match the number of columns
+ * @throws cudf::logic_error if a replacement does not have the type of its column
+ *
+ * @param[in] input A table whose null values will be replaced
+ * @param[in] replacements Scalars used to replace null values in each column of `input`
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Copy of `input` with null values replaced by `replacements`.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Replaces all null values in every column of a table with the closest preceding or
+ * following non-null value of the column.
+ *
+ * Also known as forward-fill (`PRECEDING`) and backward-fill (`FOLLOWING`). Values without a
+ * non-null value before (resp. after) them remain null. The closest non-null rows of all the
+ * columns are found with a single scan, and the fixed-width columns are copied in a single
+ * kernel launch.
+ *
+ * @code{.pseudo}
+ * input:     {{1, null, null, 4, null}, {null, 'b', null, null, 'e'}}
+ * PRECEDING: {{1, 1, 1, 4, 4}, {null, 'b', 'b', 'b', 'e'}}
+ * FOLLOWING: {{1, 4, 4, 4, null}, {'b', 'b', 'e', 'e', 'e'}}
+ * @endcode
+ *
+ * @param[in] input A table whose null values will be replaced
+ * @param[in] policy Whether to replace nulls with the preceding or following non-null value
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Copy of `input` with null values replaced.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  replace_policy policy,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Replaces all null values in a column with the closest preceding or following
+ * non-null value.
+ *
+ * @copydetails replace_nulls(table_view const&, replace_policy, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> replace_nulls(
+  column_view const& input,
+  replace_policy policy,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
@@ -225,6 +308,45 @@ std::unique_ptr<column> clamp(
   scalar const& hi,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Replaces, in place, values less than `lo` in `in_out` with `lo_replace`,
+ * and values greater than `hi` with `hi_replace`.
+ *
+ * This is the in-place counterpart of `clamp` for fixed-width columns; the null mask
+ * of `in_out` is unchanged.
+ *
+ * @throws cudf::logic_error if `in_out` is not a fixed-width column
+ * @throws cudf::logic_error if `lo.type() != hi.type()`
+ * @throws cudf::logic_error if `lo_replace.type() != hi_replace.type()`
+ * @throws cudf::logic_error if `lo.type() != lo_replace.type()`
+ * @throws cudf::logic_error if `lo.type() != in_out.type()`
+ *
+ * @param[in,out] in_out Column whose elements will be clamped
+ * @param[in] lo Minimum clamp value. Ignored if null.
+ * @param[in] lo_replace All elements less than `lo` will be replaced by `lo_replace`.
+ * @param[in] hi Maximum clamp value. Ignored if null.
+ * @param[in] hi_replace All elements greater than `hi` will be replaced by `hi_replace`.
+ */
+void clamp_in_place(mutable_column_view& in_out,
+                    scalar const& lo,
+                    scalar const& lo_replace,
+                    scalar const& hi,
+                    scalar const& hi_replace);
+
+/**
+ * @brief Replaces, in place, values less than `lo` in `in_out` with `lo`,
+ * and values greater than `hi` with `hi`.
+ *
+ * @throws cudf::logic_error if `in_out` is not a fixed-width column
+ * @throws cudf::logic_error if `lo.type() != hi.type()`
+ * @throws cudf::logic_error if `lo.type() != in_out.type()`
+ *
+ * @param[in,out] in_out Column whose elements will be clamped
+ * @param[in] lo Minimum clamp value. Ignored if null.
+ * @param[in] hi Maximum clamp value. Ignored if null.
+ */
+void clamp_in_place(mutable_column_view& in_out, scalar const& lo, scalar const& hi);
+
 /** @} */  // end of group
 /**
  * @addtogroup transformation_replace
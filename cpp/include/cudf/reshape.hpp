@@ -68,5 +68,59 @@ std::unique_ptr<table> tile(table_view const& input,
                             size_type count,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Explodes a lists column, so that every element of its lists becomes a row.
+ *
+ * The lists column at `explode_column_idx` is replaced by a column of its
+ * elements, and the rows of the other columns are repeated once for every
+ * element of their list. Null and empty lists produce no row.
+ *
+ * ```
+ * input  = [[{5, 10, 15}, {20, 25}, {}, {30}], [100, 200, 300, 400]]
+ * explode(input, 0)
+ * return = [[5, 10, 15, 20, 25, 30], [100, 100, 100, 200, 200, 400]]
+ * ```
+ *
+ * The rows of every element are found with a binary search in the offsets of
+ * the lists, so the work is spread over the elements instead of the rows.
+ *
+ * @throws cudf::logic_error if the column at `explode_column_idx` is not a LIST
+ * column.
+ *
+ * @param[in] input_table Table holding the lists column to explode.
+ * @param[in] explode_column_idx Index of the lists column to explode.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @return The table with one row per element of the exploded lists.
+ */
+std::unique_ptr<table> explode(
+  table_view const& input_table,
+  size_type explode_column_idx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Explodes a lists column like `explode`, and adds an INT32 column of
+ * the position of every element within its list before the exploded column.
+ *
+ * ```
+ * input  = [[{5, 10, 15}, {20, 25}, {}, {30}], [100, 200, 300, 400]]
+ * explode_position(input, 0)
+ * return = [[0, 1, 2, 0, 1, 0], [5, 10, 15, 20, 25, 30], [100, 100, 100, 200, 200, 400]]
+ * ```
+ *
+ * @throws cudf::logic_error if the column at `explode_column_idx` is not a LIST
+ * column.
+ *
+ * @param[in] input_table Table holding the lists column to explode.
+ * @param[in] explode_column_idx Index of the lists column to explode.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @return The table with one row per element of the exploded lists.
+ */
+std::unique_ptr<table> explode_position(
+  table_view const& input_table,
+  size_type explode_column_idx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
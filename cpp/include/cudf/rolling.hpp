@@ -19,6 +19,8 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 /**
@@ -43,6 +45,10 @@ namespace cudf {
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
  *
+ * `VARIANCE` and `STD` return a `FLOAT64` column, null where the window has no more valid
+ * elements than the delta degrees of freedom. `NTH_ELEMENT`, `LEAD` and `LAG` return the selected
+ * element of each window, null where it falls outside of the window.
+ *
  * @param[in] input_col The input column
  * @param[in] preceding_window The static rolling window size in the backward direction.
  * @param[in] following_window The static rolling window size in the forward direction.
@@ -233,6 +239,38 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Computes the window sizes of a grouped time-range rolling window.
+ *
+ * The bounds of each window are found with a binary search over the timestamps of its group.
+ * The returned `preceding_window` and `following_window` columns are meant for the variable-size
+ * `rolling_window()`, so that several aggregations over the same time-range windows compute the
+ * windows only once:
+ *
+ * @code{.pseudo}
+ * sizes = grouped_time_range_window_sizes(keys, timestamps, order, preceding, following)
+ * rolling_window(input, sizes.first, sizes.second, min_periods, aggr)
+ *   == grouped_time_range_rolling_window(keys, timestamps, order, input, preceding, following,
+ *                                        min_periods, aggr)
+ * @endcode
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] timestamp_column The (pre-sorted) timestamps for each row
+ * @param[in] timestamp_order  The order (ASCENDING/DESCENDING) in which the timestamps are sorted
+ * @param[in] preceding_window_in_days The rolling window time-interval in the backward direction.
+ * @param[in] following_window_in_days The rolling window time-interval in the forward direction.
+ * @param[in] mr Device memory resource used to allocate the returned columns
+ *
+ * @returns   The INT32 preceding and following window sizes of each row
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_time_range_window_sizes(
+  table_view const& group_keys,
+  column_view const& timestamp_column,
+  cudf::order const& timestamp_order,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
@@ -275,5 +313,57 @@ std::unique_ptr<column> rolling_window(
   std::unique_ptr<aggregation> const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies several fixed-size rolling window functions to the values in a column.
+ *
+ * The results are those of `rolling_window()` for each aggregation of `aggs`. The `SUM`, `MIN`,
+ * `MAX`, `COUNT` and `MEAN` aggregations of a numeric column are computed together, in a single
+ * pass over each window.
+ *
+ * @param[in] input_col The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types
+ *
+ * @returns   The nullable output columns of each aggregation, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies several variable-size rolling window functions to the values in a column.
+ *
+ * The results are those of `rolling_window()` for each aggregation of `aggs`. The `SUM`, `MIN`,
+ * `MAX`, `COUNT` and `MEAN` aggregations of a numeric column are computed together, in a single
+ * pass over each window.
+ *
+ * @throws cudf::logic_error if window column type is not INT32
+ *
+ * @param[in] input_col The input column
+ * @param[in] preceding_window A non-nullable column of INT32 window sizes in the backward
+ *                             direction.
+ * @param[in] following_window A non-nullable column of INT32 window sizes in the forward
+ *                             direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregation types
+ *
+ * @returns   The nullable output columns of each aggregation, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup interop_rows
+ * @{
+ */
+
+/**
+ * @brief Converts the fixed-width columns of a table into rows.
+ *
+ * Every row of the result is a list of INT8 holding the bytes of one row of @p input:
+ * each value at an offset aligned to its size, in column order, followed by the
+ * validity of the columns as one bit per column, least significant bit first, with a
+ * set bit for a valid value. Rows are padded with zeros to a multiple of 8 bytes and
+ * all have the same size.
+ *
+ * As the offsets of a lists column are `size_type`, the rows are split into as many
+ * lists columns as needed to stay within its range of bytes.
+ *
+ * Example:
+ * ```
+ * input = [{1, 2}, {3.0, NULL}] as INT8 and FLOAT64 columns
+ * row 0 = [1, pad x 7, 3.0 as 8 bytes, 0b11, pad x 7]
+ * row 1 = [2, pad x 7, undefined x 8,  0b01, pad x 7]
+ * ```
+ *
+ * @throw cudf::logic_error if a column is not fixed-width
+ * @throw cudf::logic_error if a row does not fit in the shared memory of a block
+ *
+ * @param input The table to convert
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Lists columns of the rows, in row order
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts rows made by `convert_to_rows` back into columns.
+ *
+ * @throw cudf::logic_error if a type of @p schema is not fixed-width
+ * @throw cudf::logic_error if the child of @p input is not INT8 or its size does not fit
+ * the rows of @p schema
+ *
+ * @param input A lists column of rows as returned by `convert_to_rows`
+ * @param schema The types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The table of the rows
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
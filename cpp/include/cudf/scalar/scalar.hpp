@@ -245,6 +245,52 @@ class numeric_scalar : public detail::fixed_width_scalar<T> {
   }
 };
 
+/**
+ * @brief An owning class to represent a fixed-point decimal value in device memory
+ *
+ * The scalar holds the integer representation of the value, which is
+ * `representation * 10^scale` with the scale of the scalar's `data_type`. As
+ * fixed-point types are dispatched as their representation type, the scalar is a
+ * `numeric_scalar` of that type.
+ *
+ * @ingroup scalar_classes
+ *
+ * @tparam Rep The representation type, `int32_t` for DECIMAL32 or `int64_t` for DECIMAL64
+ */
+template <typename Rep>
+class fixed_point_scalar : public numeric_scalar<Rep> {
+  static_assert(std::is_same<Rep, int32_t>::value || std::is_same<Rep, int64_t>::value,
+                "Unexpected fixed-point representation type.");
+
+ public:
+  fixed_point_scalar()                                = delete;
+  ~fixed_point_scalar()                               = default;
+  fixed_point_scalar(fixed_point_scalar&& other)      = default;
+  fixed_point_scalar(fixed_point_scalar const& other) = default;
+  fixed_point_scalar& operator=(fixed_point_scalar const& other) = delete;
+  fixed_point_scalar& operator=(fixed_point_scalar&& other) = delete;
+
+  /**
+   * @brief Construct a new fixed-point scalar object
+   *
+   * @param value The integer representation of the value
+   * @param scale The decimal scale of the value
+   * @param is_valid Whether the value held by the scalar is valid
+   * @param stream CUDA stream used for device memory operations.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  fixed_point_scalar(Rep value,
+                     int32_t scale,
+                     bool is_valid                       = true,
+                     cudaStream_t stream                 = 0,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : numeric_scalar<Rep>(value, is_valid, stream, mr)
+  {
+    this->_type = data_type{
+      std::is_same<Rep, int32_t>::value ? type_id::DECIMAL32 : type_id::DECIMAL64, scale};
+  }
+};
+
 /**
  * @brief An owning class to represent a string in device memory
  *
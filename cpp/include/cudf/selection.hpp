@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+
+namespace cudf {
+/**
+ * @addtogroup reorder_compact
+ * @{
+ */
+
+/**
+ * @brief Non-owning view of the rows of a table selected by a filter.
+ *
+ * A selection is either the column of the indices of the selected rows, or a boolean mask
+ * whose non-null `true` rows are selected. Operations accepting a selection, such as `reduce`
+ * and `groupby`, only process the selected rows of their input without materializing the
+ * filtered table, e.g. by masking the unselected rows as nulls.
+ *
+ * @note This object does *not* maintain the lifetime of the viewed column.
+ */
+class selection {
+ public:
+  /**
+   * @brief The representation of the selected rows
+   */
+  enum class kind : bool {
+    INDICES,      ///< `INT32` column of the indices of the selected rows
+    BOOLEAN_MASK  ///< `BOOL8` column, `true` for the selected rows
+  };
+
+  selection() = delete;
+
+  /**
+   * @brief Construct a selection of the rows given by `rows`.
+   *
+   * An `INT32` column is a selection of the rows whose index it holds: the indices must be in the
+   * range of the filtered table, and a row is selected at most once. A `BOOL8` column is a
+   * selection of the rows that are non-null and `true` in it, and must have as many rows as the
+   * filtered table.
+   *
+   * @throws cudf::logic_error if `rows` is neither `INT32` nor `BOOL8`, or is an `INT32` column
+   * with nulls.
+   *
+   * @param rows Indices or boolean mask of the selected rows
+   */
+  explicit selection(column_view const& rows);
+
+  /**
+   * @brief Returns the representation of the selected rows
+   */
+  kind type() const noexcept { return _kind; }
+
+  /**
+   * @brief Returns the indices or boolean mask of the selected rows
+   */
+  column_view const& rows() const noexcept { return _rows; }
+
+ private:
+  column_view _rows;
+  kind _kind;
+};
+
+/**
+ * @brief Materializes the selected rows of a table.
+ *
+ * The rows are gathered in the order of the indices of an `INDICES` selection, and in their
+ * order in `input` for a `BOOLEAN_MASK` selection, as by `apply_boolean_mask`.
+ *
+ * @throws cudf::logic_error if a `BOOLEAN_MASK` selection does not have as many rows as `input`.
+ *
+ * @param input The table to filter
+ * @param rows The selected rows of `input`
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of the selected rows
+ */
+std::unique_ptr<table> apply_selection(
+  table_view const& input,
+  selection const& rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -142,6 +142,116 @@ std::unique_ptr<table> sort_by_key(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the row indices that would sort each segment of `keys` independently.
+ *
+ * Segment `i` is made of the rows `[segment_offsets[i], segment_offsets[i+1])` of `keys`
+ * and the rows of every segment are sorted lexicographically without moving them to
+ * another segment. The order of equivalent rows within a segment is preserved.
+ *
+ * @code{.pseudo}
+ * keys            = { 3, 1, 2, 9, 7, 8 }
+ * segment_offsets = { 0, 3, 6 }
+ * result          = { 1, 2, 0, 4, 5, 3 }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is not a non-empty `INT32` column without
+ * nulls, or if it does not start with 0 and end with `keys.num_rows()`.
+ *
+ * @param keys The table that determines the ordering within each segment
+ * @param segment_offsets Ascending offsets of the segments in `keys`, including the end
+ * offset of the last segment
+ * @param column_order The desired order for each column in `keys`. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the permuted row indices of
+ * `keys` if each segment were sorted
+ */
+std::unique_ptr<column> segmented_sorted_order(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a lexicographic sort of the rows within each segment of a table.
+ *
+ * @copydetails cudf::segmented_sorted_order
+ *
+ * @param values The table to sort
+ * @return New table containing the rows of `values` with each segment sorted
+ */
+std::unique_ptr<table> segmented_sort(
+  table_view const& values,
+  column_view const& segment_offsets,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the row indices of the first `k` rows of `keys` in lexicographic order,
+ * without sorting all the rows.
+ *
+ * The result is the first `k` rows of `stable_sorted_order(keys, column_order,
+ * null_precedence)`: the `k` smallest rows, or the `k` largest for descending columns.
+ * If `k` is larger than the number of rows, all rows are returned.
+ *
+ * @throws cudf::logic_error if `k` is negative.
+ *
+ * @param keys The table that determines the ordering
+ * @param k The number of rows to return
+ * @param column_order The desired order for each column in `keys`. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the indices of the
+ * first `k` rows of `keys` in sorted order
+ */
+std::unique_ptr<column> top_k_order(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the rows of `values` at the first `k` rows of `keys` in lexicographic
+ * order, without sorting all the rows.
+ *
+ * @throws cudf::logic_error if `values.num_rows() != keys.num_rows()`.
+ * @throws cudf::logic_error if `k` is negative.
+ *
+ * @param values The table to select rows from
+ * @param keys The table that determines the ordering
+ * @param k The number of rows to return
+ * @param column_order The desired order for each column in `keys`. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The first `k` rows of `values` in the order determined by `keys`
+ */
+std::unique_ptr<table> top_k(
+  table_view const& values,
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
 /**
  * @brief Computes the ranks of input column in sorted order.
  *
@@ -180,5 +290,35 @@ std::unique_ptr<column> rank(column_view const& input,
                              bool percentage,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the ranks of input column from its already computed sorted order.
+ *
+ * Equivalent to `rank(input, method, column_order, null_handling, null_precedence, percentage)`
+ * when `sorted_order` is `sorted_order(table_view{{input}}, {column_order}, {null_precedence})`,
+ * or `stable_sorted_order` of the same arguments for `rank_method::FIRST`. Ranking a column by
+ * several methods, or reusing the order of an earlier sort, then sorts the column only once.
+ *
+ * @throws cudf::logic_error if `sorted_order` is not a `size_type` column of `input.size()`
+ * row indices without nulls
+ *
+ * @param input The column to rank
+ * @param sorted_order The row indices of `input` in the desired sorted order
+ * @param method The ranking method used for tie breaking (same values).
+ * @param null_handling  flag to include nulls during ranking. If nulls are not
+ * included, corresponding rank will be null.
+ * @param percentage flag to convert ranks to percentage in range (0,1}
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return std::unique_ptr<column> A column of containing the rank of the each
+ * element of the column of `input`. The output column type will be `size_type`
+ * column by default or else `double` when `method=rank_method::AVERAGE` or
+ *`percentage=True`
+ */
+std::unique_ptr<column> rank(column_view const& input,
+                             column_view const& sorted_order,
+                             rank_method method,
+                             null_policy null_handling,
+                             bool percentage,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
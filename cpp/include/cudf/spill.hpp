@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace cudf {
+/**
+ * @addtogroup copy_split
+ * @{
+ */
+
+/**
+ * @brief Identifies a table tracked by a `spill_manager`
+ */
+using spill_handle = uint64_t;
+
+/**
+ * @brief Tracks packed tables and moves them between device and host memory.
+ *
+ * Tables are packed into a single device buffer with `cudf::pack` when they are added. A
+ * spilled table has its device buffer copied to host memory through pinned staging buffers
+ * on a stream owned by the manager and then freed. It is copied back to the device the next
+ * time it is acquired.
+ *
+ * A table is acquired to use its `table_view` and cannot be spilled until every
+ * corresponding `release`. When more device memory is needed, the least recently acquired
+ * tables that are not acquired are spilled first, either explicitly with
+ * `spill_least_recently_used` or automatically by allocating through `spilling_resource()`.
+ *
+ * All member functions are thread-safe.
+ */
+class spill_manager {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param mr Device memory resource used to allocate the device buffers of the tables. It
+   * must not be the resource returned by `spilling_resource()`.
+   */
+  explicit spill_manager(rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~spill_manager();
+
+  spill_manager(spill_manager const&) = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+
+  /**
+   * @brief Packs a copy of `input` and starts tracking it.
+   *
+   * @param input The table to copy
+   * @return The handle of the table
+   */
+  spill_handle add(table_view const& input);
+
+  /**
+   * @brief Starts tracking an already packed table.
+   *
+   * @param input The packed table, whose device buffer must be allocated with a resource that
+   * is not `spilling_resource()`
+   * @return The handle of the table
+   */
+  spill_handle add(packed_columns&& input);
+
+  /**
+   * @brief Returns a view of a table, copying it back to the device if it was spilled.
+   *
+   * The table cannot be spilled until a matching call to `release`. The view is valid until
+   * then.
+   *
+   * @throws cudf::logic_error if `handle` is not tracked
+   *
+   * @param handle The handle of the table
+   * @return View of the table in device memory
+   */
+  table_view acquire(spill_handle handle);
+
+  /**
+   * @brief Allows a table acquired with `acquire` to be spilled again.
+   *
+   * @throws cudf::logic_error if `handle` is not tracked or not acquired
+   *
+   * @param handle The handle of the table
+   */
+  void release(spill_handle handle);
+
+  /**
+   * @brief Stops tracking a table and returns it in device memory.
+   *
+   * @throws cudf::logic_error if `handle` is not tracked or is acquired
+   *
+   * @param handle The handle of the table
+   * @return The packed table
+   */
+  packed_columns remove(spill_handle handle);
+
+  /**
+   * @brief Returns whether a table is currently held in host memory.
+   *
+   * @throws cudf::logic_error if `handle` is not tracked
+   */
+  bool is_spilled(spill_handle handle) const;
+
+  /**
+   * @brief Moves a table to host memory.
+   *
+   * Does nothing if the table is already spilled.
+   *
+   * @throws cudf::logic_error if `handle` is not tracked or is acquired
+   *
+   * @param handle The handle of the table
+   */
+  void spill(spill_handle handle);
+
+  /**
+   * @brief Spills the least recently used tables that are not acquired until at least
+   * `bytes` of device memory are freed or no table can be spilled.
+   *
+   * @param bytes The amount of device memory to free
+   * @return The amount of device memory freed
+   */
+  size_t spill_least_recently_used(size_t bytes);
+
+  /**
+   * @brief Returns the total size of the tables in device memory.
+   */
+  size_t device_bytes() const;
+
+  /**
+   * @brief Returns the total size of the spilled tables.
+   */
+  size_t host_bytes() const;
+
+  /**
+   * @brief Returns a device memory resource that allocates from the resource of the manager
+   * and, when an allocation fails, spills the least recently used table and retries until
+   * the allocation succeeds or no table can be spilled.
+   *
+   * The resource is owned by the manager, e.g. for use with `rmm::mr::set_default_resource`
+   * for the lifetime of the manager.
+   */
+  rmm::mr::device_memory_resource* spilling_resource();
+};
+
+/** @} */  // end of group
+}  // namespace cudf
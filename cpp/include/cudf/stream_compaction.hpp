@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/binaryop.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
@@ -127,13 +129,49 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Comparison of the rows of a column with a scalar value, used by `apply_predicates`
+ */
+struct column_predicate {
+  size_type column_index;  ///< Index of the compared column in the filtered table
+  binary_operator op;      ///< `EQUAL`, `NOT_EQUAL`, `LESS`, `GREATER`, `LESS_EQUAL` or
+                           ///< `GREATER_EQUAL`
+  scalar const& value;     ///< Value compared with every row, of the type of the column
+};
+
+/**
+ * @brief Filters `input` by a conjunction of comparisons of its columns with scalars.
+ *
+ * Row `i` of `input` is copied to the output table if, for every predicate, the element `i` of
+ * column `input.column(column_index)` is non-null and compares `true` with the valid scalar
+ * `value` through `op`. The result is the same as `apply_boolean_mask` with the `AND` of the
+ * `binary_operation` of every predicate, but the predicates are evaluated inside the filtering
+ * kernels, so no boolean column is materialized. This operation is stable: the input order is
+ * preserved.
+ *
+ * @throws cudf::logic_error if `predicates` is empty.
+ * @throws cudf::logic_error if a `column_index` is out of range, or if `op` is not a comparison.
+ * @throws cudf::logic_error if a `value` does not have the type of its column, or if that type is
+ * neither fixed-width nor `STRING`.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] predicates Comparisons that all must be `true` for a row to be copied
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input satisfying every predicate.
+ */
+std::unique_ptr<table> apply_predicates(
+  table_view const& input,
+  std::vector<column_predicate> const& predicates,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
 enum class duplicate_keep_option {
   KEEP_FIRST = 0,  ///< Keeps first duplicate row and unique rows
   KEEP_LAST,       ///< Keeps last  duplicate row and unique rows
-  KEEP_NONE        ///< Keeps only unique rows are kept
+  KEEP_NONE,       ///< Keeps only unique rows are kept
+  KEEP_ANY         ///< Keeps any one duplicate row and unique rows
 };
 
 /**
@@ -144,12 +182,18 @@ enum class duplicate_keep_option {
  * - KEEP_FIRST: only the first of a sequence of duplicate rows is copied
  * - KEEP_LAST: only the last of a sequence of duplicate rows is copied
  * - KEEP_NONE: no duplicate rows are copied
+ * - KEEP_ANY: any one of a sequence of duplicate rows is copied
+ *
+ * The rows are deduplicated by sorting them, and the output rows are in the sorted order of the
+ * keys, except for KEEP_ANY: the rows are inserted in a hash table instead, which is faster, and
+ * the output rows keep their relative order in `input`.
  *
  * @throws cudf::logic_error if The `input` row size mismatches with `keys`.
  *
  * @param[in] input           input table_view to copy only unique rows
  * @param[in] keys            vector of indices representing key columns from `input`
- * @param[in] keep            keep first entry, last entry, or no entries if duplicates found
+ * @param[in] keep            keep first entry, last entry, any entry or no entries if duplicates
+ * found
  * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL,
  * nulls are not equal if null_equality::UNEQUAL
  * @param[in] mr              Device memory resource used to allocate the returned table's device
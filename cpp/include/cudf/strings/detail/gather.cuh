@@ -23,6 +23,10 @@
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 
 template <typename Iterator>
@@ -90,20 +94,42 @@ std::unique_ptr<cudf::column> gather(
   auto chars_view   = chars_column->mutable_view();
   auto d_chars      = chars_view.template data<char>();
   // fill in chars
-  auto gather_chars =
-    [d_strings, begin, strings_count, d_offsets, d_chars] __device__(size_type idx) {
-      auto index = begin[idx];
-      if (NullifyOutOfBounds) {
-        if (is_signed_iterator<MapIterator>() ? ((index < 0) || (index >= strings_count))
-                                              : (index >= strings_count))
-          return;
-      }
-      if (d_strings.is_null(index)) return;
-      string_view d_str = d_strings.element<string_view>(index);
-      memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
+  // -- short strings are copied with one thread per string; when the strings are long on
+  //    average, each thread copies one output byte so that skewed lengths are spread evenly,
+  //    and finds its output row by searching the new offsets
+  constexpr int64_t bytes_per_thread_threshold = 64;
+  if (static_cast<int64_t>(bytes) < bytes_per_thread_threshold * output_count) {
+    auto gather_strings =
+      [d_strings, begin, strings_count, d_offsets, d_chars] __device__(size_type idx) {
+        auto index = begin[idx];
+        if (NullifyOutOfBounds) {
+          if (is_signed_iterator<MapIterator>() ? ((index < 0) || (index >= strings_count))
+                                                : (index >= strings_count))
+            return;
+        }
+        if (d_strings.is_null(index)) return;
+        string_view d_str = d_strings.element<string_view>(index);
+        memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
+      };
+    thrust::for_each_n(execpol->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       output_count,
+                       gather_strings);
+  } else {
+    auto gather_chars = [d_strings, begin, output_count, d_offsets] __device__(size_type idx) {
+      auto const itr =
+        thrust::upper_bound(thrust::seq, d_offsets, d_offsets + output_count + 1, idx);
+      auto const row = static_cast<size_type>(thrust::distance(d_offsets, itr)) - 1;
+      // null and out-of-bounds rows have no bytes so cannot be found here
+      auto const d_str = d_strings.element<string_view>(begin[row]);
+      return d_str.data()[idx - d_offsets[row]];
     };
-  thrust::for_each_n(
-    execpol->on(stream), thrust::make_counting_iterator<size_type>(0), output_count, gather_chars);
+    thrust::transform(execpol->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(bytes),
+                      d_chars,
+                      gather_chars);
+  }
 
   return make_strings_column(output_count,
                              std::move(offsets_column),
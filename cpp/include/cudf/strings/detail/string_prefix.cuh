@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Fixed 16-byte record of a string holding its length and its first bytes inline.
+ *
+ * Comparing two strings through `string_view` loads their offsets and then their characters.
+ * Most comparisons are settled by the first bytes and the lengths alone, which a single load
+ * of the records of both strings provides.
+ *
+ * The first bytes are packed most significant first and zero padded, so that comparing the
+ * packed integers orders the strings like comparing their bytes as `unsigned char`.
+ */
+struct alignas(16) string_prefix {
+  static constexpr size_type inline_bytes = 12;  ///< Number of bytes stored in the record
+
+  uint64_t head;     ///< Bytes 0 to 7 of the string
+  uint32_t tail;     ///< Bytes 8 to 11 of the string
+  size_type length;  ///< Number of bytes of the string
+
+  /**
+   * @brief Creates the record of a string.
+   */
+  __device__ static string_prefix create(string_view const& str)
+  {
+    auto const data  = reinterpret_cast<unsigned char const*>(str.data());
+    auto const bytes = str.size_bytes() < inline_bytes ? str.size_bytes() : inline_bytes;
+    string_prefix result{0, 0, str.size_bytes()};
+    for (size_type i = 0; i < bytes and i < 8; ++i) {
+      result.head |= static_cast<uint64_t>(data[i]) << (56 - 8 * i);
+    }
+    for (size_type i = 8; i < bytes; ++i) {
+      result.tail |= static_cast<uint32_t>(data[i]) << (24 - 8 * (i - 8));
+    }
+    return result;
+  }
+
+  /**
+   * @brief Compares the strings of two records, when their records are enough to order them.
+   *
+   * The strings are ordered by their records when their first bytes differ, or when one of them
+   * is stored whole, being then a prefix of the other if their first bytes are equal.
+   *
+   * @return The sign of the comparison like `string_view::compare`, and whether it is settled.
+   * If not, the full strings must be compared.
+   */
+  __device__ thrust::pair<int, bool> compare(string_prefix const& rhs) const
+  {
+    if (head != rhs.head) { return thrust::make_pair(head < rhs.head ? -1 : 1, true); }
+    if (tail != rhs.tail) { return thrust::make_pair(tail < rhs.tail ? -1 : 1, true); }
+    if (length <= inline_bytes or rhs.length <= inline_bytes) {
+      return thrust::make_pair((length > rhs.length) - (length < rhs.length), true);
+    }
+    return thrust::make_pair(0, false);
+  }
+};
+
+static_assert(sizeof(string_prefix) == 16, "string_prefix must be a 16-byte record");
+
+/**
+ * @brief Functor creating the `string_prefix` of a row of a strings column, null rows having
+ * the record of an empty string.
+ */
+struct create_string_prefix_fn {
+  column_device_view const d_strings;
+
+  __device__ string_prefix operator()(size_type row) const
+  {
+    if (d_strings.is_null(row)) { return string_prefix{0, 0, 0}; }
+    return string_prefix::create(d_strings.element<string_view>(row));
+  }
+};
+
+/**
+ * @brief Creates the `string_prefix` records of the rows of a strings column.
+ *
+ * @param d_strings Device view of the strings column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The record of every row
+ */
+inline rmm::device_vector<string_prefix> create_string_prefixes(
+  column_device_view const& d_strings, cudaStream_t stream = 0)
+{
+  rmm::device_vector<string_prefix> prefixes(d_strings.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(d_strings.size()),
+                    prefixes.begin(),
+                    create_string_prefix_fn{d_strings});
+  return prefixes;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -91,6 +91,27 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns whether all the characters of a strings column are ASCII.
+ *
+ * The character positions of ASCII strings are their byte offsets, which
+ * functions working on characters can use instead of decoding UTF-8.
+ *
+ * @param strings Strings column instance.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return true if no byte of the strings is above 0x7F
+ */
+bool is_ascii(strings_column_view const& strings, cudaStream_t stream = 0);
+
+/**
+ * @brief Returns the average number of bytes of the rows of a strings column.
+ *
+ * @param strings Strings column instance.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Number of bytes of the strings divided by the number of rows, or 0 if there are none
+ */
+size_type average_string_bytes(strings_column_view const& strings, cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
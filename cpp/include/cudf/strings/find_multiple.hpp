@@ -53,6 +53,39 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a column with the index of the first of the target strings
+ * found in each string.
+ *
+ * All the targets are searched with a single pass over each string using an
+ * Aho-Corasick automaton, so the cost does not grow with the number of targets.
+ * The first target found is the one whose occurrence ends earliest in the
+ * string; of the targets ending there, the longest one is returned and
+ * duplicate targets return the smallest index.
+ *
+ * Strings where none of the targets is found return -1 and null strings
+ * return null entries.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abcd", "xbc", "", "bcd"]
+ * t = ["cd", "abc", "bc"]
+ * r = contains_multiple(s,t)
+ * r is now [1, 2, -1, 2]
+ * @endcode
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column with target indices.
+ */
+std::unique_ptr<column> contains_multiple(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
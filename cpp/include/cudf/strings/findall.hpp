@@ -56,6 +56,34 @@ std::unique_ptr<table> findall_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a LIST column of the strings matching the regex pattern within
+ * each string.
+ *
+ * Each output row holds only the matches found in the corresponding input string
+ * so no nulls are added to pad the rows with fewer matches.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["bunny","rabbit"]
+ * r = findall_record(s, "[ab]"")
+ * r is now [["b"], ["a","b","b"]]
+ * @endcode
+ *
+ * Any null string entries return corresponding null output rows.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by this API.
+ *
+ * @param strings Strings instance for this operation.
+ * @param pattern Regex pattern to match within each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of strings.
+ */
+std::unique_ptr<column> findall_record(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
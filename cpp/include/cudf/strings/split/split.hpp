@@ -163,6 +163,68 @@ contiguous_split_record_result contiguous_rsplit_record(
   size_type maxsplit                  = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Splits each element of the input column into a list of tokens.
+ *
+ * The output is a LIST column with one row per input string. Each row holds
+ * only the tokens found in that string, so rows with many tokens do not
+ * make every other row pad out with nulls as in `split()`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["a b c", "d e", null, "f"]
+ * r = split_record(s)
+ * r is now [["a", "b", "c"], ["d", "e"], null, ["f"]]
+ * @endcode
+ *
+ * Null string elements produce null list rows.
+ *
+ * @throws cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings A column of string elements to be split.
+ * @param delimiter UTF-8 encoded string indicating the split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of strings.
+ */
+std::unique_ptr<column> split_record(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Splits each element of the input column from the end into a list of tokens.
+ *
+ * This is the same as `split_record()` except the `maxsplit` splits are located
+ * starting from the end of each string. The tokens in each row remain in the
+ * order they appear in the string.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["a b c", "d e", null, "f"]
+ * r = rsplit_record(s, "", 1)
+ * r is now [["a b", "c"], ["d", "e"], null, ["f"]]
+ * @endcode
+ *
+ * @throws cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings A column of string elements to be split.
+ * @param delimiter UTF-8 encoded string indicating the split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of strings.
+ */
+std::unique_ptr<column> rsplit_record(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
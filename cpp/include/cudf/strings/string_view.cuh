@@ -55,6 +55,17 @@ class string_view {
    */
   __host__ __device__ string_view(const char* data, size_type bytes);
 
+  /**
+   * @brief Create instance from existing device char array of ASCII characters.
+   *
+   * The character positions of an ASCII string are its byte offsets, so its
+   * length and its characters are found without decoding the bytes.
+   *
+   * @param data Device char array of ASCII characters.
+   * @param bytes Number of bytes in data array.
+   */
+  __host__ __device__ static string_view from_ascii(const char* data, size_type bytes);
+
   string_view(const string_view&) = default;
   string_view(string_view&&)      = default;
   ~string_view()                  = default;
@@ -78,6 +78,14 @@ __host__ __device__ inline string_view::string_view(const char* data, size_type
 {
 }
 
+__host__ __device__ inline string_view string_view::from_ascii(const char* data, size_type bytes)
+{
+  string_view result(data, bytes);
+  result._length     = bytes;
+  result._char_width = bytes > 0 ? 1 : 0;
+  return result;
+}
+
 //
 __host__ __device__ inline size_type string_view::size_bytes() const { return _bytes; }
 
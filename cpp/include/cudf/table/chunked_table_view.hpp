@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+/**
+ * @file chunked_table_view.hpp
+ * @brief A `chunked_(column|table)_view` is a sequence of `(column|table)_view`s that is
+ * treated as the single column or table obtained by concatenating them, without copying them.
+ *
+ * Operations that accept chunked views process the chunks in place. `cudf::concatenate` of a
+ * chunked view materializes it when a contiguous column or table is needed.
+ *
+ * Chunked views are non-owning: the chunks must outlive them.
+ **/
+
+namespace cudf {
+
+/**
+ * @brief A non-owning view of a list of columns of the same type that are treated as one column
+ * made of their rows, in order.
+ */
+class chunked_column_view {
+ public:
+  chunked_column_view()                            = default;
+  ~chunked_column_view()                           = default;
+  chunked_column_view(chunked_column_view const&)  = default;
+  chunked_column_view(chunked_column_view&&)       = default;
+  chunked_column_view& operator=(chunked_column_view const&) = default;
+  chunked_column_view& operator=(chunked_column_view&&) = default;
+
+  /**
+   * @brief Construct a chunked view of `chunks`
+   *
+   * @throws cudf::logic_error if the chunks do not all have the same type
+   * @throws cudf::logic_error if the total number of rows exceeds the size_type range
+   *
+   * @param chunks The columns whose rows, in order, make up the chunked column
+   */
+  explicit chunked_column_view(std::vector<column_view> const& chunks);
+
+  /**
+   * @brief Returns the total number of rows of all chunks
+   */
+  size_type size() const noexcept { return _offsets.back(); }
+
+  /**
+   * @brief Returns the type of the elements, `EMPTY` if there are no chunks
+   */
+  data_type type() const noexcept { return _type; }
+
+  /**
+   * @brief Returns the total number of nulls of all chunks
+   */
+  size_type null_count() const;
+
+  /**
+   * @brief Indicates whether any of the chunks contains nulls
+   */
+  bool has_nulls() const { return null_count() > 0; }
+
+  /**
+   * @brief Returns the number of chunks
+   */
+  size_type num_chunks() const noexcept { return static_cast<size_type>(_chunks.size()); }
+
+  /**
+   * @brief Returns the chunk at index `i`
+   */
+  column_view const& chunk(size_type i) const { return _chunks.at(i); }
+
+  /**
+   * @brief Returns the chunks
+   */
+  std::vector<column_view> const& chunks() const noexcept { return _chunks; }
+
+  /**
+   * @brief Returns the row offset of every chunk followed by the total number of rows
+   *
+   * Chunk `i` holds the rows `[chunk_offsets()[i], chunk_offsets()[i + 1])` of the chunked
+   * column.
+   */
+  std::vector<size_type> const& chunk_offsets() const noexcept { return _offsets; }
+
+ private:
+  std::vector<column_view> _chunks{};
+  std::vector<size_type> _offsets{0};
+  data_type _type{EMPTY};
+};
+
+/**
+ * @brief A non-owning view of a list of tables with the same column types that are treated as
+ * one table made of their rows, in order.
+ */
+class chunked_table_view {
+ public:
+  chunked_table_view()                           = default;
+  ~chunked_table_view()                          = default;
+  chunked_table_view(chunked_table_view const&)  = default;
+  chunked_table_view(chunked_table_view&&)       = default;
+  chunked_table_view& operator=(chunked_table_view const&) = default;
+  chunked_table_view& operator=(chunked_table_view&&) = default;
+
+  /**
+   * @brief Construct a chunked view of `chunks`
+   *
+   * @throws cudf::logic_error if the chunks do not all have the same number of columns and
+   * the same column types
+   * @throws cudf::logic_error if the total number of rows exceeds the size_type range
+   *
+   * @param chunks The tables whose rows, in order, make up the chunked table
+   */
+  explicit chunked_table_view(std::vector<table_view> const& chunks);
+
+  /**
+   * @brief Returns the total number of rows of all chunks
+   */
+  size_type num_rows() const noexcept { return _offsets.back(); }
+
+  /**
+   * @brief Returns the number of columns, 0 if there are no chunks
+   */
+  size_type num_columns() const noexcept
+  {
+    return _chunks.empty() ? 0 : _chunks.front().num_columns();
+  }
+
+  /**
+   * @brief Returns the number of chunks
+   */
+  size_type num_chunks() const noexcept { return static_cast<size_type>(_chunks.size()); }
+
+  /**
+   * @brief Returns the chunk at index `i`
+   */
+  table_view const& chunk(size_type i) const { return _chunks.at(i); }
+
+  /**
+   * @brief Returns the chunks
+   */
+  std::vector<table_view> const& chunks() const noexcept { return _chunks; }
+
+  /**
+   * @copydoc chunked_column_view::chunk_offsets
+   */
+  std::vector<size_type> const& chunk_offsets() const noexcept { return _offsets; }
+
+  /**
+   * @brief Returns a chunked view of the column at index `column_index` of every chunk
+   */
+  chunked_column_view column(size_type column_index) const;
+
+ private:
+  std::vector<table_view> _chunks{};
+  std::vector<size_type> _offsets{0};
+};
+
+}  // namespace cudf
@@ -24,6 +24,8 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 #include <thrust/equal.h>
 #include <thrust/swap.h>
 #include <thrust/transform_reduce.h>
@@ -383,6 +385,262 @@ class row_lexicographic_comparator {
   order const* _column_order{};
 };  // class row_lexicographic_comparator
 
+/**
+ * @brief Performs an equality comparison between the rows of two single-column tables whose
+ * element type is known at compile time.
+ *
+ * Compares like `row_equality_comparator`, without the loop over the columns and the type
+ * dispatch of each element comparison.
+ *
+ * @tparam Element The type of the elements of both columns
+ * @tparam has_nulls Indicates the potential for null values in either column.
+ **/
+template <typename Element, bool has_nulls = true>
+class single_column_equality_comparator {
+ public:
+  __host__ __device__ single_column_equality_comparator(column_device_view lhs,
+                                                        column_device_view rhs,
+                                                        bool nulls_are_equal = true)
+    : comparator{lhs, rhs, nulls_are_equal}
+  {
+  }
+
+  __device__ bool operator()(size_type lhs_row_index, size_type rhs_row_index) const noexcept
+  {
+    return comparator.template operator()<Element>(lhs_row_index, rhs_row_index);
+  }
+
+ private:
+  element_equality_comparator<has_nulls> comparator;
+};
+
+/**
+ * @brief Computes whether a row of a single-column table whose element type is known at compile
+ * time is *less* than a row of another.
+ *
+ * Orders like `row_lexicographic_comparator`, without the loop over the columns and the type
+ * dispatch of each element comparison.
+ *
+ * @tparam Element The type of the elements of both columns
+ * @tparam has_nulls Indicates the potential for null values in either column.
+ **/
+template <typename Element, bool has_nulls = true>
+class single_column_lexicographic_comparator {
+ public:
+  __host__ __device__ single_column_lexicographic_comparator(
+    column_device_view lhs,
+    column_device_view rhs,
+    order column_order         = order::ASCENDING,
+    null_order null_precedence = null_order::BEFORE)
+    : comparator{lhs, rhs, null_precedence},
+      less{column_order == order::ASCENDING ? weak_ordering::LESS : weak_ordering::GREATER}
+  {
+  }
+
+  __device__ bool operator()(size_type lhs_index, size_type rhs_index) const noexcept
+  {
+    return comparator.template operator()<Element>(lhs_index, rhs_index) == less;
+  }
+
+ private:
+  element_relational_comparator<has_nulls> comparator;
+  weak_ordering less;
+};
+
+namespace detail {
+/**
+ * @brief Calls a function with a `single_column_equality_comparator` of the dispatched element
+ * type, or with a `row_equality_comparator` for the types that cannot be compared for equality.
+ */
+template <bool has_nulls>
+struct single_column_equality_dispatch {
+  template <typename Element,
+            typename Function,
+            std::enable_if_t<cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+  decltype(auto) operator()(table_device_view const&,
+                            table_device_view const&,
+                            column_device_view const& lhs,
+                            column_device_view const& rhs,
+                            bool nulls_are_equal,
+                            Function&& f)
+  {
+    return f(single_column_equality_comparator<Element, has_nulls>{lhs, rhs, nulls_are_equal});
+  }
+
+  template <typename Element,
+            typename Function,
+            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+  decltype(auto) operator()(table_device_view const& lhs,
+                            table_device_view const& rhs,
+                            column_device_view const&,
+                            column_device_view const&,
+                            bool nulls_are_equal,
+                            Function&& f)
+  {
+    return f(row_equality_comparator<has_nulls>{lhs, rhs, nulls_are_equal});
+  }
+};
+
+/**
+ * @brief Calls a function with a `single_column_lexicographic_comparator` of the dispatched
+ * element type, or with a `row_lexicographic_comparator` for the types that cannot be ordered.
+ */
+template <bool has_nulls>
+struct single_column_lexicographic_dispatch {
+  template <typename Element,
+            typename Function,
+            std::enable_if_t<cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+  decltype(auto) operator()(table_device_view const&,
+                            table_device_view const&,
+                            column_device_view const& lhs,
+                            column_device_view const& rhs,
+                            order const*,
+                            null_order const*,
+                            order column_order,
+                            null_order null_precedence,
+                            Function&& f)
+  {
+    return f(single_column_lexicographic_comparator<Element, has_nulls>{
+      lhs, rhs, column_order, null_precedence});
+  }
+
+  template <typename Element,
+            typename Function,
+            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+  decltype(auto) operator()(table_device_view const& lhs,
+                            table_device_view const& rhs,
+                            column_device_view const&,
+                            column_device_view const&,
+                            order const* d_column_order,
+                            null_order const* d_null_precedence,
+                            order,
+                            null_order,
+                            Function&& f)
+  {
+    return f(row_lexicographic_comparator<has_nulls>{lhs, rhs, d_column_order, d_null_precedence});
+  }
+};
+}  // namespace detail
+
+/**
+ * @brief Calls `f` with the most specialized equality comparator of the rows of `lhs` and `rhs`.
+ *
+ * The comparator is chosen once: the null checks are compiled out when neither table has nulls,
+ * and single-column tables are compared with a `single_column_equality_comparator` of their
+ * element type. Other tables are compared with a `row_equality_comparator`. `f` is instantiated
+ * for every comparator type and must return the same type for all of them.
+ *
+ * @param lhs The first table
+ * @param rhs The second table (may be the same table as `lhs`)
+ * @param nulls_are_equal Indicates if two null elements are treated as equivalent
+ * @param f The function called with the comparator
+ * @param stream CUDA stream used for the device views of the tables
+ * @return The result of `f`
+ */
+template <typename Function>
+decltype(auto) dispatch_row_equality_comparator(table_view const& lhs,
+                                                table_view const& rhs,
+                                                bool nulls_are_equal,
+                                                Function&& f,
+                                                cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(), "Mismatched number of columns.");
+  auto const d_lhs    = table_device_view::create(lhs, stream);
+  auto const d_rhs    = table_device_view::create(rhs, stream);
+  auto const nullable = has_nulls(lhs) or has_nulls(rhs);
+  if (lhs.num_columns() == 1 and lhs.column(0).type() == rhs.column(0).type()) {
+    auto const d_lhs_column = column_device_view::create(lhs.column(0), stream);
+    auto const d_rhs_column = column_device_view::create(rhs.column(0), stream);
+    return nullable ? type_dispatcher(lhs.column(0).type(),
+                                      detail::single_column_equality_dispatch<true>{},
+                                      *d_lhs,
+                                      *d_rhs,
+                                      *d_lhs_column,
+                                      *d_rhs_column,
+                                      nulls_are_equal,
+                                      f)
+                    : type_dispatcher(lhs.column(0).type(),
+                                      detail::single_column_equality_dispatch<false>{},
+                                      *d_lhs,
+                                      *d_rhs,
+                                      *d_lhs_column,
+                                      *d_rhs_column,
+                                      nulls_are_equal,
+                                      f);
+  }
+  return nullable ? f(row_equality_comparator<true>{*d_lhs, *d_rhs, nulls_are_equal})
+                  : f(row_equality_comparator<false>{*d_lhs, *d_rhs, nulls_are_equal});
+}
+
+/**
+ * @brief Calls `f` with the most specialized lexicographic comparator of the rows of `lhs` and
+ * `rhs`.
+ *
+ * The comparator is chosen like in `dispatch_row_equality_comparator`: single-column tables are
+ * compared with a `single_column_lexicographic_comparator` of their element type, other tables
+ * with a `row_lexicographic_comparator`.
+ *
+ * @param lhs The first table
+ * @param rhs The second table (may be the same table as `lhs`)
+ * @param column_order The order of each column, all ascending if empty
+ * @param null_precedence The order of the nulls of each column, all `null_order::BEFORE` if empty
+ * @param f The function called with the comparator
+ * @param stream CUDA stream used for the device views of the tables
+ * @return The result of `f`
+ */
+template <typename Function>
+decltype(auto) dispatch_row_lexicographic_comparator(
+  table_view const& lhs,
+  table_view const& rhs,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  Function&& f,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(), "Mismatched number of columns.");
+  auto const d_lhs    = table_device_view::create(lhs, stream);
+  auto const d_rhs    = table_device_view::create(rhs, stream);
+  auto const nullable = has_nulls(lhs) or has_nulls(rhs);
+  rmm::device_vector<order> d_column_order(column_order);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+  auto const column_order_ptr    = column_order.empty() ? nullptr : d_column_order.data().get();
+  auto const null_precedence_ptr =
+    null_precedence.empty() ? nullptr : d_null_precedence.data().get();
+  if (lhs.num_columns() == 1 and lhs.column(0).type() == rhs.column(0).type()) {
+    auto const d_lhs_column = column_device_view::create(lhs.column(0), stream);
+    auto const d_rhs_column = column_device_view::create(rhs.column(0), stream);
+    auto const first_order  = column_order.empty() ? order::ASCENDING : column_order.front();
+    auto const first_null_precedence =
+      null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
+    return nullable ? type_dispatcher(lhs.column(0).type(),
+                                      detail::single_column_lexicographic_dispatch<true>{},
+                                      *d_lhs,
+                                      *d_rhs,
+                                      *d_lhs_column,
+                                      *d_rhs_column,
+                                      column_order_ptr,
+                                      null_precedence_ptr,
+                                      first_order,
+                                      first_null_precedence,
+                                      f)
+                    : type_dispatcher(lhs.column(0).type(),
+                                      detail::single_column_lexicographic_dispatch<false>{},
+                                      *d_lhs,
+                                      *d_rhs,
+                                      *d_lhs_column,
+                                      *d_rhs_column,
+                                      column_order_ptr,
+                                      null_precedence_ptr,
+                                      first_order,
+                                      first_null_precedence,
+                                      f);
+  }
+  return nullable ? f(row_lexicographic_comparator<true>{
+                      *d_lhs, *d_rhs, column_order_ptr, null_precedence_ptr})
+                  : f(row_lexicographic_comparator<false>{
+                      *d_lhs, *d_rhs, column_order_ptr, null_precedence_ptr});
+}
+
 /**
  * @brief Computes the hash value of an element in the given column.
  *
@@ -392,10 +650,12 @@ class row_lexicographic_comparator {
 template <template <typename> class hash_function, bool has_nulls = true>
 class element_hasher {
  public:
+  using result_type = typename hash_function<hash_value_type>::result_type;
+
   template <typename T>
-  __device__ inline hash_value_type operator()(column_device_view col, size_type row_index)
+  __device__ inline result_type operator()(column_device_view col, size_type row_index)
   {
-    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<result_type>::max(); }
 
     return hash_function<T>{}(col.element<T>(row_index));
   }
@@ -410,12 +670,14 @@ class element_hasher {
 template <template <typename> class hash_function, bool has_nulls = true>
 class row_hasher {
  public:
+  using result_type = typename element_hasher<hash_function, has_nulls>::result_type;
+
   row_hasher() = delete;
   row_hasher(table_device_view t) : _table{t} {}
 
   __device__ auto operator()(size_type row_index) const
   {
-    auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
+    auto hash_combiner = [](result_type lhs, result_type rhs) {
       return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
     };
 
@@ -432,7 +694,7 @@ class row_hasher {
                                     thrust::make_counting_iterator(0),
                                     thrust::make_counting_iterator(_table.num_columns()),
                                     hasher,
-                                    hash_value_type{0},
+                                    result_type{0},
                                     hash_combiner);
   }
 
@@ -440,6 +702,60 @@ class row_hasher {
   table_device_view _table;
 };
 
+/**
+ * @brief Computes the hash value of an element with a seed, the way Spark does.
+ */
+struct spark_element_hasher {
+  template <typename T>
+  __device__ inline hash_value_type operator()(column_device_view col,
+                                               size_type row_index,
+                                               hash_value_type seed) const
+  {
+    return SparkMurmurHash3_32<T>{seed}(col.element<T>(row_index));
+  }
+};
+
+/**
+ * @brief Computes the hash value of a row in the given table the way Spark's `Murmur3Hash`
+ * expression does.
+ *
+ * Each element is hashed with the hash value of the previous columns as its seed, starting from
+ * `seed` for the first column, and null elements leave the hash value unchanged. The hash values
+ * are signed like those of Spark, so that partitions can be assigned by their positive modulo
+ * like Spark's `HashPartitioning`.
+ *
+ * @tparam has_nulls Indicates the potential for null values in the table.
+ **/
+template <bool has_nulls>
+class row_hasher<SparkMurmurHash3_32, has_nulls> {
+ public:
+  using result_type = int32_t;
+
+  row_hasher() = delete;
+  row_hasher(table_device_view t,
+             hash_value_type seed = SparkMurmurHash3_32<hash_value_type>::default_seed)
+    : _table{t}, _seed{seed}
+  {
+  }
+
+  __device__ result_type operator()(size_type row_index) const
+  {
+    hash_value_type hash = _seed;
+    for (size_type column_index = 0; column_index < _table.num_columns(); ++column_index) {
+      auto const column = _table.column(column_index);
+      if (not has_nulls or column.is_valid(row_index)) {
+        hash = cudf::type_dispatcher(
+          column.type(), spark_element_hasher{}, column, row_index, hash);
+      }
+    }
+    return static_cast<result_type>(hash);
+  }
+
+ private:
+  table_device_view _table;
+  hash_value_type _seed;
+};
+
 /**
  * @brief Computes the hash value of a row in the given table, combined with an
  * initial hash value for each column.
@@ -450,15 +766,17 @@ class row_hasher {
 template <template <typename> class hash_function, bool has_nulls = true>
 class row_hasher_initial_values {
  public:
+  using result_type = typename element_hasher<hash_function, has_nulls>::result_type;
+
   row_hasher_initial_values() = delete;
-  row_hasher_initial_values(table_device_view t, hash_value_type* initial_hash)
+  row_hasher_initial_values(table_device_view t, result_type* initial_hash)
     : _table{t}, _initial_hash(initial_hash)
   {
   }
 
   __device__ auto operator()(size_type row_index) const
   {
-    auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
+    auto hash_combiner = [](result_type lhs, result_type rhs) {
       return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
     };
 
@@ -477,13 +795,13 @@ class row_hasher_initial_values {
                                     thrust::make_counting_iterator(0),
                                     thrust::make_counting_iterator(_table.num_columns()),
                                     hasher,
-                                    hash_value_type{0},
+                                    result_type{0},
                                     hash_combiner);
   }
 
  private:
   table_device_view _table;
-  hash_value_type* _initial_hash;
+  result_type* _initial_hash;
 };
 
 }  // namespace cudf
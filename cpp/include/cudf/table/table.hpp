@@ -138,6 +138,15 @@ class table {
   column const& get_column(cudf::size_type i) const { return *(_columns.at(i)); }
 
  private:
+  /**
+   * @brief Computes the unknown null counts of the columns and their descendants
+   * with a single kernel launch and stores them in the columns
+   *
+   * Creating the view of a column computes its unknown null count and those of its
+   * descendants, one kernel launch each.
+   **/
+  void update_null_counts() const;
+
   std::vector<std::unique_ptr<column>> _columns{};
   size_type _num_rows{};
 };
@@ -231,6 +231,17 @@ class mutable_table_view : public detail::table_view_base<mutable_column_view> {
   mutable_table_view(std::vector<mutable_table_view> const& views);
 };
 
+/**
+ * @brief Returns the count of null elements of each column of a table
+ *
+ * The counts that are not known yet are computed together, by a single kernel
+ * launch and a single synchronization, instead of one per column.
+ *
+ * @param view The table of columns
+ * @return The null count of each column of `view`
+ */
+std::vector<size_type> null_count(table_view const& view);
+
 inline bool has_nulls(table_view view)
 {
   return std::any_of(view.begin(), view.end(), [](column_view col) { return col.has_nulls(); });
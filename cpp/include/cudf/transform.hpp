@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
@@ -51,6 +52,38 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates a new column by applying a function against every row of the
+ * input columns, reading and writing validity.
+ *
+ * Computes:
+ * `out[i] = F(inputs[0][i], inputs[1][i], ...)`
+ *
+ * The UDF takes a pointer to the output value and a pointer to the output
+ * validity, followed by the value and the validity of each input, e.g. for two
+ * `int32_t` inputs and a `double` output:
+ * `void F(double* out, bool* out_valid, int a, bool a_valid, int b, bool b_valid)`
+ *
+ * The output validity is initialized to the logical AND of the validities of the
+ * inputs; the UDF may overwrite it. Values of null inputs are undefined.
+ *
+ * @throws cudf::logic_error if `inputs` has no column
+ * @throws cudf::logic_error if any input or the output is of a non-fixed-width type
+ *
+ * @param inputs        The input columns, in the order of the UDF parameters
+ * @param udf           The PTX/CUDA string of the function to apply
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ * @return              The column resulting from applying the function to every row of `inputs`
+ **/
+std::unique_ptr<column> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
@@ -83,5 +116,39 @@ std::pair<std::unique_ptr<rmm::device_buffer>, size_type> nans_to_nulls(
 std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> bools_to_mask(
   column_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates a new column by evaluating an expression tree on every row of a table.
+ *
+ * With the `JIT` strategy the whole expression is compiled into a single kernel that
+ * reads each referenced column once and writes only the output, without materializing
+ * the intermediate results. The kernel is cached by the structure and types of the
+ * expression, so evaluating an expression of the same shape on other data does not
+ * compile again. The `INTERPRETER` strategy evaluates the same expression with a
+ * precompiled stack-based kernel, avoiding the compilation at the cost of a slower
+ * evaluation per row. `AUTO` interprets small tables unless the compiled kernel is
+ * already cached.
+ *
+ * The type of each operation follows the usual arithmetic conversions of its operands,
+ * without promoting integers smaller than `int`. Comparison and logical operators return
+ * `BOOL8`. Nulls propagate through operations as in `binary_operation`.
+ *
+ * @throws cudf::logic_error if an expression column references a column outside of `table`
+ * @throws cudf::logic_error if a referenced column is not of a numeric type
+ * @throws cudf::logic_error if a bitwise operator is applied to floating-point operands
+ * @throws cudf::logic_error if `strategy` is `INTERPRETER` and the expression is nested too
+ * deeply for the interpreter's stack
+ *
+ * @param table    The table whose columns the expression references
+ * @param expr     The expression to evaluate
+ * @param strategy Whether to compile or interpret the expression
+ * @param mr       Device memory resource used to allocate the returned column's device memory
+ * @return         The column of the expression's value in each row of `table`
+ **/
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  ast::expression const& expr,
+  ast::evaluation_strategy strategy   = ast::evaluation_strategy::AUTO,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
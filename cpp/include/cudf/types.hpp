@@ -132,6 +132,15 @@ enum class null_equality : bool {
   UNEQUAL  ///< nulls compare unequal
 };
 
+/**
+ * @brief Identifies the hash function used to hash the rows of a table
+ */
+enum class hash_id {
+  HASH_MURMUR3,       ///< 32-bit MurmurHash3_32
+  HASH_XXHASH64,      ///< 64-bit xxHash64
+  HASH_SPARK_MURMUR3  ///< 32-bit MurmurHash3_32 matching Spark's `Murmur3Hash`
+};
+
 /**
  * @brief Indicates how null values compare against all other values.
  **/
@@ -207,6 +216,8 @@ enum type_id {
   DICTIONARY32,            ///< Dictionary type using int32 indices
   STRING,                  ///< String elements
   LIST,                    ///< List elements
+  DECIMAL32,               ///< Fixed-point decimal held as an int32 with a base 10 scale
+  DECIMAL64,               ///< Fixed-point decimal held as an int64 with a base 10 scale
   // `NUM_TYPE_IDS` must be last!
   NUM_TYPE_IDS  ///< Total number of type ids
 };
@@ -233,30 +244,50 @@ class data_type {
    **/
   explicit constexpr data_type(type_id id) : _id{id} {}
 
+  /**
+   * @brief Construct a new fixed-point `data_type` object
+   *
+   * A value of the type is `representation * 10^scale`, so a negative scale is the
+   * number of fractional decimal digits.
+   *
+   * @param id The type's identifier, `DECIMAL32` or `DECIMAL64`
+   * @param scale The decimal scale of the values
+   **/
+  explicit constexpr data_type(type_id id, int32_t scale) : _id{id}, _fixed_point_scale{scale} {}
+
   /**
    * @brief Returns the type identifier
    **/
   CUDA_HOST_DEVICE_CALLABLE type_id id() const noexcept { return _id; }
 
+  /**
+   * @brief Returns the decimal scale of a fixed-point type, 0 for the other types
+   **/
+  CUDA_HOST_DEVICE_CALLABLE int32_t scale() const noexcept { return _fixed_point_scale; }
+
  private:
   type_id _id{EMPTY};
-  // Store additional type specific metadata, timezone, decimal precision and
-  // scale, etc.
+  int32_t _fixed_point_scale{};  // Scale of the fixed-point types
+  // Store additional type specific metadata, timezone, decimal precision, etc.
 };
 
 /**
  * @brief Compares two `data_type` objects for equality.
  *
+ * Fixed-point types are only equal when their scales are equal too.
+ *
  * // TODO Define exactly what it means for two `data_type`s to be equal. e.g.,
- * are two timestamps with different resolutions equal? How about decimals with
- * different scale/precision?
+ * are two timestamps with different resolutions equal?
  *
  * @param lhs The first `data_type` to compare
  * @param rhs The second `data_type` to compare
  * @return true `lhs` is equal to `rhs`
  * @return false `lhs` is not equal to `rhs`
  */
-inline bool operator==(data_type const& lhs, data_type const& rhs) { return lhs.id() == rhs.id(); }
+inline bool operator==(data_type const& lhs, data_type const& rhs)
+{
+  return lhs.id() == rhs.id() && lhs.scale() == rhs.scale();
+}
 
 /**
  * @brief Returns the size in bytes of elements of the specified `data_type`
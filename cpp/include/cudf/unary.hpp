@@ -64,6 +64,19 @@ std::unique_ptr<cudf::column> unary_operation(
   cudf::unary_op op,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Performs unary op on all values in column in-place
+ *
+ * The null mask of `in_out` is unchanged. Every op except `NOT` keeps the type of its input;
+ * `NOT` can only be performed in-place on a `BOOL8` column.
+ *
+ * @throws cudf::logic_error if `op` is not supported for the type of `in_out`
+ *
+ * @param in_out A `mutable_column_view` whose values are replaced by the result
+ * @param op operation to perform
+ */
+void unary_operation_in_place(cudf::mutable_column_view& in_out, cudf::unary_op op);
+
 /**
  * @brief Creates a column of `BOOL8` elements where for every element in `input` `true`
  * indicates the value is null and `false` indicates the value is valid.
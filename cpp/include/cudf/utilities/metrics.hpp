@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace metrics {
+/**
+ * @brief Measurements of one call of a libcudf API.
+ *
+ * Calls are the functions annotated with `CUDF_FUNC_RANGE()`. A call made by another annotated
+ * call is attributed to the outermost one.
+ */
+struct operation_metrics {
+  std::string name;              ///< Name of the API function
+  double wall_time_ms;           ///< Host time from the entry to the return of the call
+  float gpu_time_ms;             ///< Time between default stream events at entry and exit
+  int64_t output_bytes;          ///< Net bytes allocated by the call, e.g. for its result
+  int64_t peak_temporary_bytes;  ///< Peak bytes allocated beyond `output_bytes`
+};
+
+/**
+ * @brief Starts recording the metrics of the API calls made from any thread.
+ *
+ * Allocations are only measured when they are made through a `metrics_resource_adaptor`.
+ */
+void enable();
+
+/**
+ * @brief Stops recording the metrics of API calls.
+ *
+ * The metrics recorded so far are kept until the next `collect`.
+ */
+void disable();
+
+/**
+ * @brief Returns whether the metrics of API calls are recorded.
+ */
+bool is_enabled();
+
+/**
+ * @brief Returns the metrics recorded since the last call and clears them.
+ *
+ * Synchronizes with the recorded GPU events to compute the GPU times.
+ *
+ * @return The metrics of the completed API calls in completion order
+ */
+std::vector<operation_metrics> collect();
+
+/**
+ * @brief Device memory resource that forwards to an upstream resource and attributes the
+ * allocations to the API call running on the allocating thread.
+ *
+ * Allocations made outside of a recorded API call are not attributed.
+ */
+class metrics_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param upstream Resource that performs the allocations, which must outlive the adaptor
+   */
+  explicit metrics_resource_adaptor(rmm::mr::device_memory_resource* upstream)
+    : _upstream{upstream}
+  {
+  }
+
+  /**
+   * @brief Returns the upstream resource
+   */
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return _upstream; }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override;
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override;
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* _upstream;
+};
+
+}  // namespace metrics
+}  // namespace cudf
@@ -426,5 +426,21 @@ constexpr inline bool is_nested(data_type type)
   return cudf::type_dispatcher(type, is_nested_impl{});
 }
 
+/**
+ * @brief Indicates whether `type` is a fixed-point decimal type
+ *
+ * Fixed-point columns hold the integer representation of their values and are
+ * dispatched as that integer type; the values are `representation * 10^scale`
+ * with the scale of the `data_type`.
+ *
+ * @param type The `data_type` to verify
+ * @return true `type` is a fixed-point type
+ * @return false `type` is not a fixed-point type
+ **/
+constexpr inline bool is_fixed_point(data_type type)
+{
+  return type.id() == type_id::DECIMAL32 || type.id() == type_id::DECIMAL64;
+}
+
 /** @} */
 }  // namespace cudf
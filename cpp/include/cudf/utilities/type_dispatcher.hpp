@@ -133,6 +133,22 @@ CUDF_TYPE_MAPPING(cudf::duration_ns, type_id::DURATION_NANOSECONDS);
 CUDF_TYPE_MAPPING(dictionary32, type_id::DICTIONARY32);
 CUDF_TYPE_MAPPING(cudf::list_view, type_id::LIST);
 
+/**
+ * @brief Fixed-point types are dispatched as their integer representation.
+ *
+ * The scale of a fixed-point column is part of its `data_type`, so the operations that keep
+ * the scale of the values, like copying, sorting, hashing, comparing, sums and extrema, run
+ * on the representation unchanged.
+ **/
+template <>
+struct id_to_type_impl<type_id::DECIMAL32> {
+  using type = int32_t;
+};
+template <>
+struct id_to_type_impl<type_id::DECIMAL64> {
+  using type = int64_t;
+};
+
 template <typename T>
 struct type_to_scalar_type_impl {
   using ScalarType = cudf::scalar;
@@ -387,6 +403,12 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
         std::forward<Ts>(args)...);
     case LIST:
       return f.template operator()<typename IdTypeMap<LIST>::type>(std::forward<Ts>(args)...);
+    case DECIMAL32:
+      return f.template operator()<typename IdTypeMap<DECIMAL32>::type>(
+        std::forward<Ts>(args)...);
+    case DECIMAL64:
+      return f.template operator()<typename IdTypeMap<DECIMAL64>::type>(
+        std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported type_id.");
@@ -85,6 +85,8 @@
  *   @defgroup column_interop Interop
  *   @{
  *     @defgroup interop_dlpack DLPack
+ *     @defgroup interop_arrow Arrow C Device Data Interface
+ *     @defgroup interop_rows Row Format
  *   @}
  * @}
  * @defgroup datetime_apis DateTime
@@ -111,6 +113,7 @@
  *   @defgroup dictionary_search Searching
  *   @defgroup dictionary_update Updating Keys
  * @}
+ * @defgroup lists_apis Lists
  * @defgroup io_apis IO
  * @{
  *   @defgroup io_readers Readers
@@ -121,6 +124,7 @@
  *   @defgroup nvtext_ngrams NGrams
  *   @defgroup nvtext_normalize Normalizing
  *   @defgroup nvtext_tokenize Tokenizing
+ *   @defgroup nvtext_minhash MinHashing
  * @}
  * @defgroup utility_apis Utilities
  * @{
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+namespace detail {
+/**
+ * @copydoc nvtext::normalize_spaces(strings_column_view const&,rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to normalize.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New strings columns of normalized strings.
+ */
+std::unique_ptr<cudf::column> normalize_spaces(
+  cudf::strings_column_view const& strings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc nvtext::normalize_characters(strings_column_view const&,bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to normalize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New strings columns of normalized strings.
+ */
+std::unique_ptr<cudf::column> normalize_characters(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc nvtext::normalize_tokenize(strings_column_view const&,bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to normalize and tokenize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New strings columns of tokens.
+ */
+std::unique_ptr<cudf::column> normalize_tokenize(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc nvtext::normalize_count_tokens(strings_column_view const&,bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to normalize and tokenize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New INT32 column of token counts.
+ */
+std::unique_ptr<cudf::column> normalize_count_tokens(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc nvtext::normalize_hash_tokens(strings_column_view const&,bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to normalize and tokenize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New LIST column of UINT32 token hashes.
+ */
+std::unique_ptr<cudf::column> normalize_hash_tokens(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace nvtext
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <nvtext/subword_tokenize.hpp>
+
+namespace nvtext {
+namespace detail {
+/**
+ * @copydoc nvtext::load_vocabulary(cudf::strings_column_view const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param vocabulary Strings column of the vocabulary tokens in token id order.
+ * @param mr Device memory resource used to allocate the vocabulary's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The vocabulary and its hash table.
+ */
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary(
+  cudf::strings_column_view const& vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc nvtext::load_vocabulary_file(std::string const&,rmm::mr::device_memory_resource*)
+ *
+ * @param filename Path of the vocabulary file.
+ * @param mr Device memory resource used to allocate the vocabulary's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The vocabulary and its hash table.
+ */
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary_file(
+  std::string const& filename,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc nvtext::subword_tokenize(cudf::strings_column_view const&,wordpiece_vocabulary
+ * const&,uint32_t,uint32_t,bool,bool,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+tokenizer_result subword_tokenize(
+  cudf::strings_column_view const& strings,
+  wordpiece_vocabulary const& vocabulary,
+  uint32_t max_sequence_length,
+  uint32_t stride,
+  bool do_lower_case,
+  bool do_truncate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace nvtext
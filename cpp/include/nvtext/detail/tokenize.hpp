@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/tokenize.hpp>
 
 namespace nvtext {
 namespace detail {
@@ -54,6 +55,39 @@ std::unique_ptr<cudf::column> tokenize(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc nvtext::tokenize_record(strings_column_view const&,string_scalar
+ * const&,rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column tokenize.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New LIST column of strings.
+ */
+std::unique_ptr<cudf::column> tokenize_record(
+  cudf::strings_column_view const& strings,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource(),
+  cudaStream_t stream                  = 0);
+
+/**
+ * @copydoc nvtext::tokenize_record(strings_column_view const&,strings_column_view
+ * const&,rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to tokenize.
+ * @param delimiters Strings used to separate individual strings into tokens.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New LIST column of strings.
+ */
+std::unique_ptr<cudf::column> tokenize_record(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& delimiters,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc nvtext::count_tokens(strings_column_view const&, string_scalar
  * const&,rmm::mr::device_memory_resource*)
@@ -87,5 +121,33 @@ std::unique_ptr<cudf::column> count_tokens(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc nvtext::load_token_vocabulary(strings_column_view const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param vocabulary Strings column of the vocabulary tokens in id order.
+ * @param mr Device memory resource used to allocate the vocabulary's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The vocabulary and its hash table.
+ */
+std::unique_ptr<token_vocabulary> load_token_vocabulary(
+  cudf::strings_column_view const& vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc nvtext::tokenize_with_vocabulary(strings_column_view const&,token_vocabulary
+ * const&,string_scalar const&,size_type,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(
+  cudf::strings_column_view const& strings,
+  token_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::size_type default_id           = -1,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource(),
+  cudaStream_t stream                  = 0);
+
 }  // namespace detail
 }  // namespace nvtext
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ */
+
+/**
+ * @brief Returns the hash values of the character ngrams of each string.
+ *
+ * The MurmurHash3_32 value of each window of `ngrams` adjacent characters is
+ * computed directly from the string data without building ngram strings.
+ * Non-empty strings with fewer than `ngrams` characters produce a single hash
+ * of the whole string.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "doc", ""]
+ * t = hash_character_ngrams(s, 3)
+ * t is now [[hash("hel"), hash("ell"), hash("llo")], [hash("doc")], []]
+ * @endcode
+ *
+ * A null input element at row `i` produces a corresponding null entry
+ * for row `i` in the output column.
+ *
+ * @throw cudf::logic_error if `ngrams` is less than 2.
+ *
+ * @param strings Strings column to hash.
+ * @param ngrams The number of characters in each ngram.
+ *               Default is 5.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of UINT32 hash values.
+ */
+std::unique_ptr<cudf::column> hash_character_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 5,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the minhash values of each string for each seed.
+ *
+ * For each seed, the minhash value of a string is the minimum MurmurHash3_32
+ * value, hashed with that seed, of the string's character ngrams of `width`
+ * characters. Strings whose minhash values mostly agree have similar sets of
+ * ngrams, which makes these values useful for near-duplicate detection.
+ *
+ * Each output row holds one value per seed. Empty strings produce the maximum
+ * UINT32 value for each seed.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "doc"]
+ * t = minhash(s, [0, 7], 3)
+ * t is now [[min(hash0("hel"), hash0("ell"), hash0("llo")), min(hash7("hel"), ...)],
+ *           [hash0("doc"), hash7("doc")]]
+ * @endcode
+ *
+ * A null input element at row `i` produces a corresponding null entry
+ * for row `i` in the output column.
+ *
+ * @throw cudf::logic_error if `seeds` is empty, is not UINT32 or contains nulls.
+ * @throw cudf::logic_error if `width` is less than 2.
+ *
+ * @param strings Strings column to hash.
+ * @param seeds UINT32 column of the seeds for the hash functions.
+ * @param width The number of characters in each ngram.
+ *              Default is 4.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of UINT32 minhash values.
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
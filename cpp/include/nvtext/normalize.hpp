@@ -51,5 +51,117 @@ std::unique_ptr<cudf::column> normalize_spaces(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a new strings column by normalizing the characters of each
+ * string for subword tokenizing.
+ *
+ * This follows the basic tokenizer used by BERT models:
+ * - control characters are removed
+ * - whitespace characters are replaced with a single space ' '
+ * - spaces are added around punctuation and CJK ideographs
+ *   so they become separate words
+ * - if `do_lower_case` is true, upper-case characters are converted to lower-case
+ *   and the accents of Latin characters are removed
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["Héllo,", "Wörld!"]
+ * t = normalize_characters(s, true)
+ * t is now ["hello , ","world ! "]
+ * @endcode
+ *
+ * A null input element at row `i` produces a corresponding null entry
+ * for row `i` in the output column.
+ *
+ * @param strings Strings column to normalize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings columns of normalized strings.
+ */
+std::unique_ptr<cudf::column> normalize_characters(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the tokens of the strings normalized as in `normalize_characters()`.
+ *
+ * The normalized strings are split on their spaces into tokens in a single pass,
+ * without creating the normalized strings.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["Héllo,", null, "Wörld!"]
+ * t = normalize_tokenize(s, true)
+ * t is now ["hello", ",", "world", "!"]
+ * @endcode
+ *
+ * All null row entries are ignored and the output contains all valid rows.
+ *
+ * @param strings Strings column to normalize and tokenize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings columns of tokens.
+ */
+std::unique_ptr<cudf::column> normalize_tokenize(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the number of tokens of each string normalized as in
+ * `normalize_characters()`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["Héllo,", null, "Wörld!"]
+ * t = normalize_count_tokens(s, true)
+ * t is now [2, 0, 2]
+ * @endcode
+ *
+ * The number of tokens for a null element is set to 0 in the output column.
+ *
+ * @param strings Strings column to normalize and tokenize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of token counts.
+ */
+std::unique_ptr<cudf::column> normalize_count_tokens(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the MurmurHash3_32 values of the tokens of each string normalized
+ * as in `normalize_characters()`.
+ *
+ * The hashes are computed as the tokens are normalized, without creating
+ * any strings. They can be reduced modulo a number of features and counted to
+ * build hashed token-frequency vectors, for example for TF-IDF.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["Héllo,", null, "Wörld!"]
+ * t = normalize_hash_tokens(s, true)
+ * t is now [[hash("hello"), hash(",")], null, [hash("world"), hash("!")]]
+ * @endcode
+ *
+ * A null input element at row `i` produces a corresponding null entry
+ * for row `i` in the output column.
+ *
+ * @param strings Strings column to normalize and tokenize.
+ * @param do_lower_case If true, upper-case characters are converted to lower-case
+ *                      and accents are removed.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of UINT32 token hashes.
+ */
+std::unique_ptr<cudf::column> normalize_hash_tokens(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <string>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_tokenize
+ * @{
+ */
+
+/**
+ * @brief A WordPiece vocabulary loaded into device memory.
+ *
+ * The token id of each vocabulary entry is its row in `tokens`. Entries starting
+ * with `##` are continuation pieces which only match after the start of a word.
+ *
+ * Create it once with `load_vocabulary()` and use it for any number of
+ * `subword_tokenize()` calls.
+ */
+struct wordpiece_vocabulary {
+  std::unique_ptr<cudf::column> tokens;  ///< Vocabulary strings
+  rmm::device_buffer table;              ///< Hash table of the int32 vocabulary rows
+  cudf::size_type table_size{};          ///< Number of slots in `table`, a power of 2
+  uint32_t unknown_token_id{};           ///< Id of the `[UNK]` token
+};
+
+/**
+ * @brief Loads a WordPiece vocabulary into device memory.
+ *
+ * @throw cudf::logic_error if `vocabulary` has nulls or does not contain `[UNK]`.
+ *
+ * @param vocabulary Strings column of the vocabulary tokens in token id order.
+ * @param mr Device memory resource used to allocate the vocabulary's device memory.
+ * @return The vocabulary and its hash table.
+ */
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary(
+  cudf::strings_column_view const& vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Loads a WordPiece vocabulary file with one token per line, like the
+ * `vocab.txt` files of BERT models.
+ *
+ * @throw cudf::logic_error if the file cannot be read or does not contain `[UNK]`.
+ *
+ * @param filename Path of the vocabulary file.
+ * @param mr Device memory resource used to allocate the vocabulary's device memory.
+ * @return The vocabulary and its hash table.
+ */
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary_file(
+  std::string const& filename,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief The tensors produced by `subword_tokenize()`.
+ *
+ * The token ids and attention mask are row-major matrices of `nrows_tensor`
+ * rows and `sequence_length` columns.
+ */
+struct tokenizer_result {
+  uint32_t nrows_tensor{};     ///< Number of rows in the output tensors
+  uint32_t sequence_length{};  ///< Number of token ids in each row
+  /// UINT32 token ids padded with 0
+  std::unique_ptr<cudf::column> tensor_token_ids;
+  /// UINT32 values of 1 for the token ids and 0 for the padding
+  std::unique_ptr<cudf::column> tensor_attention_mask;
+  /// UINT32 triples of the input string row and the first and last token in each row
+  std::unique_ptr<cudf::column> tensor_metadata;
+};
+
+/**
+ * @brief Creates BERT input tensors by tokenizing each string into WordPiece token ids.
+ *
+ * Each string is normalized with `normalize_characters()` and split on whitespace
+ * into words. Each word is then split into the longest vocabulary pieces, from its
+ * start, using `##` pieces after the first one. Words that cannot be split into
+ * vocabulary pieces produce the `[UNK]` token id.
+ *
+ * The token ids of each string fill one row of `max_sequence_length` ids, padded
+ * with 0. Strings with more tokens are truncated if `do_truncate` is true. Otherwise
+ * they continue on more rows, each row starting `stride` tokens after the previous.
+ * Null strings produce a row of padding.
+ *
+ * @code{.pseudo}
+ * Example:
+ * vocabulary = ["[PAD]", "[UNK]", "un", "##aff", "##able", "hello"]
+ * s = ["Hello unaffable", "bye"]
+ * t = subword_tokenize(s, vocabulary, 4, 4, true, true)
+ * t.tensor_token_ids is now [5, 2, 3, 4, 1, 0, 0, 0]
+ * t.tensor_attention_mask is now [1, 1, 1, 1, 1, 0, 0, 0]
+ * t.tensor_metadata is now [0, 0, 3, 1, 0, 0]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `max_sequence_length` is 0 or `stride` is 0 or
+ *        larger than `max_sequence_length`.
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Vocabulary created by `load_vocabulary()`.
+ * @param max_sequence_length Number of token ids in each output row.
+ * @param stride Number of tokens between the starts of consecutive rows of a string.
+ * @param do_lower_case If true, the strings are converted to lower-case
+ *                      and accents are removed before tokenizing.
+ * @param do_truncate If true, only the first `max_sequence_length` tokens of each string
+ *                    are kept.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return The token ids, attention mask and metadata tensors.
+ */
+tokenizer_result subword_tokenize(
+  cudf::strings_column_view const& strings,
+  wordpiece_vocabulary const& vocabulary,
+  uint32_t max_sequence_length,
+  uint32_t stride,
+  bool do_lower_case,
+  bool do_truncate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
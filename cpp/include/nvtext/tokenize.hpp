@@ -19,6 +19,8 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 namespace nvtext {
 /**
  * @addtogroup nvtext_tokenize
@@ -93,6 +95,59 @@ std::unique_ptr<cudf::column> tokenize(
   cudf::strings_column_view const& delimiters,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a LIST column of the tokens found in each string using the
+ * provided characters as delimiters.
+ *
+ * This is the same as `tokenize()` except the tokens of each input row are
+ * kept together as one row of the output LIST column. Rows with no tokens
+ * produce empty lists and null rows produce null lists.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["a", "b c", null, "d  e f "]
+ * t = tokenize_record(s)
+ * t is now [["a"], ["b", "c"], null, ["d", "e", "f"]]
+ * @endcode
+ *
+ * @param strings Strings column tokenize.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of strings.
+ */
+std::unique_ptr<cudf::column> tokenize_record(
+  cudf::strings_column_view const& strings,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a LIST column of the tokens found in each string using
+ * multiple strings as delimiters.
+ *
+ * This is the same as `tokenize()` except the tokens of each input row are
+ * kept together as one row of the output LIST column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["a", "b c", "d.e:f;"]
+ * d = [".", ":", ";"]
+ * t = tokenize_record(s,d)
+ * t is now [["a"], ["b c"], ["d", "e", "f"]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if the delimiters column is empty or contains nulls.
+ *
+ * @param strings Strings column to tokenize.
+ * @param delimiters Strings used to separate individual strings into tokens.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of strings.
+ */
+std::unique_ptr<cudf::column> tokenize_record(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& delimiters,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns the number of tokens in each string of a strings column.
  *
@@ -175,5 +230,68 @@ std::unique_ptr<cudf::column> character_tokenize(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief A vocabulary of tokens loaded into a device hash table.
+ *
+ * The id of each token is its row in `tokens`. Create it once with
+ * `load_token_vocabulary()` and use it for any number of
+ * `tokenize_with_vocabulary()` calls.
+ */
+struct token_vocabulary {
+  std::unique_ptr<cudf::column> tokens;  ///< Vocabulary strings
+  rmm::device_buffer table;              ///< Hash table of the int32 vocabulary rows
+  cudf::size_type table_size{};          ///< Number of slots in `table`, a power of 2
+};
+
+/**
+ * @brief Loads a vocabulary of tokens into a device hash table.
+ *
+ * The id of a token repeated in the vocabulary is its first row.
+ *
+ * @throw cudf::logic_error if `vocabulary` contains nulls.
+ *
+ * @param vocabulary Strings column of the vocabulary tokens in id order.
+ * @param mr Device memory resource used to allocate the vocabulary's device memory.
+ * @return The vocabulary and its hash table.
+ */
+std::unique_ptr<token_vocabulary> load_token_vocabulary(
+  cudf::strings_column_view const& vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the vocabulary ids of the tokens of each string.
+ *
+ * Each string is split into tokens as in `tokenize_record()` and each token is
+ * looked up in the vocabulary without building the token strings.
+ *
+ * @code{.pseudo}
+ * Example:
+ * vocabulary = ["the", "fox", "dog"]
+ * s = ["the fox jumped", null, "the dog"]
+ * t = tokenize_with_vocabulary(s, vocabulary)
+ * t is now [[0, 1, -1], null, [0, 2]]
+ * @endcode
+ *
+ * A null input element at row `i` produces a corresponding null entry
+ * for row `i` in the output column.
+ *
+ * @throw cudf::logic_error if the delimiter is invalid.
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Vocabulary created by `load_token_vocabulary()`.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param default_id Id of the tokens not found in the vocabulary.
+ *                   Default is -1.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of INT32 token ids.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(
+  cudf::strings_column_view const& strings,
+  token_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::size_type default_id           = -1,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
+
 /** @} */  // end of tokenize group
 }  // namespace nvtext
@@ -16,6 +16,7 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
@@ -105,6 +106,21 @@ std::unique_ptr<aggregation> make_nunique_aggregation(null_policy null_handling)
 {
   return std::make_unique<detail::nunique_aggregation>(aggregation::NUNIQUE, null_handling);
 }
+/// Factory to create an APPROX_NUNIQUE aggregation
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(int precision,
+                                                             null_policy null_handling)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 16, "Precision must be within [4, 16]");
+  return std::make_unique<detail::approx_nunique_aggregation>(
+    aggregation::APPROX_NUNIQUE, precision, null_handling);
+}
+/// Factory to create an APPROX_QUANTILE aggregation
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& q,
+                                                              double compression)
+{
+  CUDF_EXPECTS(compression > 0, "The compression must be positive");
+  return std::make_unique<detail::approx_quantile_aggregation>(q, compression);
+}
 /// Factory to create a NTH_ELEMENT aggregation
 std::unique_ptr<aggregation> make_nth_element_aggregation(size_type n, null_policy null_handling)
 {
@@ -116,6 +132,28 @@ std::unique_ptr<aggregation> make_row_number_aggregation()
 {
   return std::make_unique<aggregation>(aggregation::ROW_NUMBER);
 }
+/// Factory to create a LEAD aggregation
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset)
+{
+  CUDF_EXPECTS(offset >= 0, "LEAD offset must be non-negative");
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LEAD, offset);
+}
+/// Factory to create a LAG aggregation
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset)
+{
+  CUDF_EXPECTS(offset >= 0, "LAG offset must be non-negative");
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LAG, offset);
+}
+/// Factory to create a RANK aggregation
+std::unique_ptr<aggregation> make_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::RANK);
+}
+/// Factory to create a DENSE_RANK aggregation
+std::unique_ptr<aggregation> make_dense_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::DENSE_RANK);
+}
 /// Factory to create a UDF aggregation
 std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
                                                   std::string const& user_defined_aggregator,
@@ -145,17 +183,51 @@ struct is_valid_aggregation_impl {
     return is_valid_aggregation<Source, k>();
   }
 };
+
+// Fixed-point types are dispatched as their representation, which only the aggregations
+// listed here compute in a way that keeps a meaningful scale
+bool is_valid_fixed_point_aggregation(aggregation::Kind k)
+{
+  switch (k) {
+    case aggregation::PRODUCT:
+    case aggregation::ANY:
+    case aggregation::ALL:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+    case aggregation::MEDIAN:
+    case aggregation::QUANTILE:
+    case aggregation::APPROX_QUANTILE:
+    case aggregation::PTX:
+    case aggregation::CUDA: return false;
+    default: return true;
+  }
+}
 }  // namespace
 
 // Return target data_type for the given source_type and aggregation
 data_type target_type(data_type source, aggregation::Kind k)
 {
+  if (is_fixed_point(source)) {
+    switch (k) {
+      // The sum accumulates the int64_t representation at the source scale
+      case aggregation::SUM: return data_type{type_id::DECIMAL64, source.scale()};
+      case aggregation::MIN:
+      case aggregation::MAX:
+      case aggregation::NTH_ELEMENT:
+      case aggregation::LEAD:
+      case aggregation::LAG: return source;
+      default: break;
+    }
+  }
   return dispatch_type_and_aggregation(source, k, target_type_functor{});
 }
 
 // Verifies the aggregation `k` is valid on the type `source`
 bool is_valid_aggregation(data_type source, aggregation::Kind k)
 {
+  if (is_fixed_point(source) && !is_valid_fixed_point_aggregation(k)) { return false; }
   return dispatch_type_and_aggregation(source, k, is_valid_aggregation_impl{});
 }
 }  // namespace detail
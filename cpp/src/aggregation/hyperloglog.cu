@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/sequence.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Raises the register at `index` to `rank`, if it is lower.
+ *
+ * Registers are single bytes, updated with a compare-and-swap of their 4-byte word.
+ */
+__device__ void atomic_max_register(uint8_t* registers, size_t index, uint8_t rank)
+{
+  auto const word  = reinterpret_cast<unsigned int*>(registers + (index & ~size_t{3}));
+  auto const shift = static_cast<unsigned int>(index & 3) * 8;
+  auto old         = *word;
+  while (((old >> shift) & 0xffu) < rank) {
+    auto const assumed = old;
+    old = atomicCAS(word, assumed, (assumed & ~(0xffu << shift)) | (unsigned int{rank} << shift));
+    if (old == assumed) { break; }
+  }
+}
+
+/**
+ * @brief Makes a column of sketches of `num_registers` zero registers for `num_groups` groups.
+ *
+ * The registers of group `g` are bytes `[g * num_registers, (g + 1) * num_registers)` of the
+ * child column.
+ */
+std::unique_ptr<column> make_empty_sketches(size_type num_groups,
+                                            size_type num_registers,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  CUDF_EXPECTS(static_cast<size_t>(num_groups) * num_registers <=
+                 static_cast<size_t>(std::numeric_limits<size_type>::max()),
+               "Too many groups for the HyperLogLog registers to fit in a column");
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = offsets->mutable_view().data<size_type>();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   d_offsets,
+                   d_offsets + num_groups + 1,
+                   size_type{0},
+                   num_registers);
+  auto registers = make_numeric_column(
+    data_type{type_id::INT8}, num_groups * num_registers, mask_state::UNALLOCATED, stream, mr);
+  if (registers->size() > 0) {
+    CUDA_TRY(cudaMemsetAsync(
+      registers->mutable_view().data<int8_t>(), 0, registers->size(), stream));
+  }
+  return make_lists_column(
+    num_groups, std::move(offsets), std::move(registers), 0, rmm::device_buffer{}, stream, mr);
+}
+
+/**
+ * @brief Verifies that every row of `sketches` is a sketch of `num_registers` registers.
+ */
+void verify_sketches(lists_column_view const& sketches,
+                     size_type num_registers,
+                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(not sketches.has_nulls(), "HyperLogLog sketches must not be null");
+  if (sketches.size() == 0) { return; }
+  CUDF_EXPECTS(sketches.child().type().id() == type_id::INT8,
+               "HyperLogLog sketches must be lists of INT8 registers");
+  auto const d_offsets = sketches.offsets().data<size_type>() + sketches.offset();
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream)->on(stream),
+                              thrust::make_counting_iterator<size_type>(0),
+                              thrust::make_counting_iterator<size_type>(sketches.size()),
+                              [d_offsets, num_registers] __device__(size_type i) {
+                                return d_offsets[i + 1] - d_offsets[i] == num_registers;
+                              }),
+               "HyperLogLog sketches must have 2^precision registers");
+}
+
+}  // namespace
+
+std::unique_ptr<column> hyperloglog_sketches(column_view const& values,
+                                             size_type const* row_order,
+                                             size_type const* row_groups,
+                                             size_type num_rows,
+                                             size_type num_groups,
+                                             int precision,
+                                             null_policy null_handling,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  auto const num_registers = size_type{1} << precision;
+  auto sketches            = make_empty_sketches(num_groups, num_registers, mr, stream);
+  if (num_rows == 0 or num_groups == 0) { return sketches; }
+
+  // The registers are contiguous and a multiple of 4 bytes, suitable for the 4-byte atomics
+  auto const d_registers =
+    sketches->child(lists_column_view::child_column_index).mutable_view().data<int8_t>();
+  auto const d_values = column_device_view::create(values, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [d_values      = *d_values,
+     row_order,
+     row_groups,
+     num_registers,
+     precision,
+     include_nulls = null_handling == null_policy::INCLUDE,
+     d_registers   = reinterpret_cast<uint8_t*>(d_registers)] __device__(size_type i) {
+      auto const row = row_order != nullptr ? row_order[i] : i;
+      if (not include_nulls and d_values.is_null(row)) { return; }
+      hash_value_type const hash = type_dispatcher(
+        d_values.type(), element_hasher<MurmurHash3_32, true>{}, d_values, row);
+      // The leading bits of the hash select the register, which keeps the largest position of
+      // the leading one among the remaining bits
+      auto const index     = hash >> (32 - precision);
+      auto const remaining = hash << precision;
+      auto const rank      = static_cast<uint8_t>(
+        remaining == 0 ? 32 - precision + 1 : __clz(static_cast<int>(remaining)) + 1);
+      auto const group = row_groups != nullptr ? row_groups[i] : 0;
+      atomic_max_register(d_registers, static_cast<size_t>(group) * num_registers + index, rank);
+    });
+
+  return sketches;
+}
+
+std::unique_ptr<column> merge_hyperloglog_sketches(column_view const& sketches,
+                                                   size_type const* row_order,
+                                                   size_type const* group_offsets,
+                                                   size_type num_groups,
+                                                   int precision,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  auto const num_registers = size_type{1} << precision;
+  lists_column_view const input(sketches);
+  verify_sketches(input, num_registers, stream);
+  auto merged = make_empty_sketches(num_groups, num_registers, mr, stream);
+  if (sketches.size() == 0 or num_groups == 0) { return merged; }
+
+  // One thread per register of every group keeps the largest register of the group's rows, so
+  // that the threads of a warp read consecutive registers of the same row
+  auto const d_merged =
+    merged->child(lists_column_view::child_column_index).mutable_view().data<int8_t>();
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_t>(0),
+    static_cast<size_t>(num_groups) * num_registers,
+    [d_offsets = input.offsets().data<size_type>() + input.offset(),
+     d_input   = input.child().data<int8_t>(),
+     d_merged,
+     row_order,
+     group_offsets,
+     num_registers] __device__(size_t i) {
+      auto const group    = static_cast<size_type>(i / num_registers);
+      auto const index    = static_cast<size_type>(i % num_registers);
+      int8_t max_register = 0;
+      for (auto j = group_offsets[group]; j < group_offsets[group + 1]; ++j) {
+        auto const reg = d_input[d_offsets[row_order[j]] + index];
+        max_register   = reg > max_register ? reg : max_register;
+      }
+      d_merged[i] = max_register;
+    });
+
+  return merged;
+}
+
+std::unique_ptr<column> hyperloglog_estimate(column_view const& sketches,
+                                             int precision,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  auto const num_registers = size_type{1} << precision;
+  lists_column_view const input(sketches);
+  verify_sketches(input, num_registers, stream);
+  auto const num_groups = sketches.size();
+  auto result           = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_groups, mask_state::UNALLOCATED, stream, mr);
+  if (num_groups == 0) { return result; }
+
+  auto const alpha = num_registers == 16   ? 0.673
+                     : num_registers == 32 ? 0.697
+                     : num_registers == 64 ? 0.709
+                                           : 0.7213 / (1.0 + 1.079 / num_registers);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_groups,
+    [d_offsets   = input.offsets().data<size_type>() + input.offset(),
+     d_registers = reinterpret_cast<uint8_t const*>(input.child().data<int8_t>()),
+     d_result    = result->mutable_view().data<size_type>(),
+     num_registers,
+     alpha] __device__(size_type group) {
+      double sum           = 0;
+      size_type num_zeros  = 0;
+      auto const registers = d_registers + d_offsets[group];
+      for (size_type r = 0; r < num_registers; ++r) {
+        auto const rank = registers[r];
+        sum += ldexp(1.0, -static_cast<int>(rank));
+        num_zeros += (rank == 0);
+      }
+      double const m = num_registers;
+      auto estimate  = alpha * m * m / sum;
+      // Linear counting is more accurate for small cardinalities, and the estimate must be
+      // corrected for hash collisions of 32-bit hashes for very large ones
+      double const hash_space = 4294967296.0;
+      if (estimate <= 2.5 * m and num_zeros > 0) {
+        estimate = m * log(m / num_zeros);
+      } else if (estimate > hash_space / 30) {
+        estimate = -hash_space * log1p(-estimate / hash_space);
+      }
+      d_result[group] = static_cast<size_type>(estimate + 0.5);
+    });
+
+  return result;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+namespace cudf {
+namespace ast {
+namespace {
+bool is_unary_operator(ast_operator op)
+{
+  return op == ast_operator::NOT || op == ast_operator::NEGATE || op == ast_operator::IS_NULL;
+}
+
+}  // namespace
+
+scalar const& expression::literal_value() const
+{
+  CUDF_EXPECTS(_kind == node_kind::LITERAL, "Expression is not a literal");
+  return *_literal;
+}
+
+expression column_reference(size_type column_index)
+{
+  CUDF_EXPECTS(column_index >= 0, "Negative column index");
+  expression expr{expression::node_kind::COLUMN_REFERENCE};
+  expr._column_index = column_index;
+  return expr;
+}
+
+expression literal(scalar const& value)
+{
+  CUDF_EXPECTS(is_numeric(value.type()), "Literal must be of a numeric type");
+  expression expr{expression::node_kind::LITERAL};
+  expr._literal = &value;
+  return expr;
+}
+
+expression operation(ast_operator op, expression const& input)
+{
+  CUDF_EXPECTS(is_unary_operator(op), "Operator is not unary");
+  expression expr{expression::node_kind::OPERATION};
+  expr._op = op;
+  expr._children.push_back(std::make_shared<expression const>(input));
+  return expr;
+}
+
+expression operation(ast_operator op, expression const& lhs, expression const& rhs)
+{
+  CUDF_EXPECTS(not is_unary_operator(op), "Operator is not binary");
+  expression expr{expression::node_kind::OPERATION};
+  expr._op = op;
+  expr._children.push_back(std::make_shared<expression const>(lhs));
+  expr._children.push_back(std::make_shared<expression const>(rhs));
+  return expr;
+}
+
+}  // namespace ast
+}  // namespace cudf
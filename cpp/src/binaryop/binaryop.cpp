@@ -18,8 +18,11 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/search.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
@@ -34,9 +37,12 @@
 #include <cudf/datetime.hpp>  // replace eventually
 
 #include "compiled/binary_ops.hpp"
+#include "fixed_point.hpp"
 
 #include <bit.hpp.jit>
 #include <jit/common_headers.hpp>
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <timestamps.hpp.jit>
 #include <types.hpp.jit>
@@ -63,6 +69,41 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col,
     return rmm::device_buffer{0, stream, mr};
   }
 }
+
+/**
+ * @brief Computes output valid mask for a null-aware op between a column and a scalar
+ *
+ * `NULL_EQUALS` is valid for every row, `NULL_MIN` and `NULL_MAX` where either operand is.
+ */
+rmm::device_buffer null_aware_valid_mask(column_view const& col,
+                                         scalar const& s,
+                                         binary_operator op,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  if (op != binary_operator::NULL_EQUALS && not s.is_valid() && col.nullable()) {
+    return copy_bitmask(col, stream, mr);
+  }
+  return create_null_mask(col.size(), mask_state::ALL_VALID, stream, mr);
+}
+
+/**
+ * @brief Computes output valid mask for a null-aware op between two columns
+ *
+ * `NULL_EQUALS` is valid for every row, `NULL_MIN` and `NULL_MAX` where either operand is.
+ */
+rmm::device_buffer null_aware_valid_mask(column_view const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  if (op != binary_operator::NULL_EQUALS) {
+    auto mask = bitmask_or(table_view({lhs, rhs}), mr, stream);
+    if (mask.size() > 0) { return mask; }
+  }
+  return create_null_mask(lhs.size(), mask_state::ALL_VALID, stream, mr);
+}
 }  // namespace detail
 
 namespace jit {
@@ -235,11 +276,185 @@ void binary_operation(mutable_column_view& out,
             cudf::jit::get_data_ptr(rhs));
 }
 
+void precompile(binary_operation_signature const& signature)
+{
+  auto const op            = signature.op;
+  auto const out_type_name = cudf::jit::get_type_name(signature.output_type);
+  auto const lhs_type_name = cudf::jit::get_type_name(signature.lhs_type);
+  auto const rhs_type_name = cudf::jit::get_type_name(signature.rhs_type);
+  auto const vector_vector = null_using_binop(op) ? "kernel_v_v_with_validity" : "kernel_v_v";
+  auto const vector_scalar = null_using_binop(op) ? "kernel_v_s_with_validity" : "kernel_v_s";
+  cudf::jit::launcher launcher(
+    hash, code::kernel, header_names, cudf::jit::compiler_flags, headers_code);
+  // the same instantiations as the column-column, column-scalar and scalar-column launches
+  launcher.set_kernel_inst(
+    vector_vector,
+    {out_type_name, lhs_type_name, rhs_type_name, get_operator_name(op, OperatorType::Direct)});
+  launcher.set_kernel_inst(
+    vector_scalar,
+    {out_type_name, lhs_type_name, rhs_type_name, get_operator_name(op, OperatorType::Direct)});
+  launcher.set_kernel_inst(
+    vector_scalar,
+    {out_type_name, rhs_type_name, lhs_type_name, get_operator_name(op, OperatorType::Reverse)});
+}
+
 }  // namespace jit
+
+/**
+ * @brief Returns whether a column and scalar comparison can be done directly on the
+ * indices of a dictionary column.
+ */
+bool is_dictionary_equality(column_view const& col, binary_operator op)
+{
+  return col.type().id() == type_id::DICTIONARY32 &&
+         (op == binary_operator::EQUAL || op == binary_operator::NOT_EQUAL);
+}
+
+/**
+ * @brief Returns the index of a key in a dictionary as a scalar which can be compared
+ * with the dictionary's indices.
+ *
+ * A key not in the dictionary gets the index -1, which no row has. The scalar stays INT32
+ * for the narrow UINT8 and UINT16 indices too so that -1 cannot match any of them.
+ */
+numeric_scalar<int32_t> dictionary_key_index(dictionary_column_view const& dictionary,
+                                             scalar const& key,
+                                             cudaStream_t stream)
+{
+  if (!key.is_valid()) { return numeric_scalar<int32_t>(-1, false, stream); }
+  auto const index = dictionary::detail::get_index(
+    dictionary, key, rmm::mr::get_default_resource(), stream);
+  return numeric_scalar<int32_t>(index->is_valid() ? index->value(stream) : -1, true, stream);
+}
+
+/**
+ * @brief Writes `op(lhs, rhs)` into the new column `out`, whose valid mask is already computed.
+ *
+ * The valid mask of the null-aware ops is final, so their kernels get a view of `out` without
+ * it and need not clear bits.
+ */
+template <typename Lhs, typename Rhs>
+void fixed_width_binary_operation(
+  column& out, Lhs const& lhs, Rhs const& rhs, binary_operator op, cudaStream_t stream)
+{
+  auto out_view = null_using_binop(op)
+                    ? mutable_column_view{out.type(), out.size(), out.mutable_view().head()}
+                    : out.mutable_view();
+  if (compiled::is_supported_fixed_width_operation(out.type(), lhs.type(), rhs.type(), op)) {
+    compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
+}
+
+/**
+ * @brief Writes `op(lhs, rhs)` and the valid mask `new_mask` into the preallocated `out`.
+ *
+ * The kernel runs before the valid mask is written, so `out` may alias either operand.
+ */
+template <typename Lhs, typename Rhs>
+void binary_operation_into(mutable_column_view& out,
+                           Lhs const& lhs,
+                           Rhs const& rhs,
+                           binary_operator op,
+                           rmm::device_buffer const& new_mask,
+                           cudaStream_t stream)
+{
+  auto const new_mask_data = static_cast<bitmask_type const*>(new_mask.data());
+  auto const null_count =
+    new_mask.size() > 0 ? count_unset_bits(new_mask_data, 0, out.size()) : 0;
+  CUDF_EXPECTS(null_count == 0 || out.nullable(), "Output column must be nullable");
+  CUDF_EXPECTS(!out.nullable() || out.offset() == 0, "Nullable output column must not be offset");
+
+  // The valid mask is written below, so the kernels need not clear bits
+  auto out_view = mutable_column_view{out.type(), out.size(), out.head(), nullptr, 0, out.offset()};
+  if (compiled::is_supported_fixed_width_operation(
+        out.type(), lhs.type(), rhs.type(), op)) {
+    compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
+
+  if (!out.nullable()) { return; }
+  if (new_mask.size() > 0) {
+    CUDA_TRY(cudaMemcpyAsync(out.null_mask(),
+                             new_mask_data,
+                             num_bitmask_words(out.size()) * sizeof(bitmask_type),
+                             cudaMemcpyDeviceToDevice,
+                             stream));
+  } else {
+    set_null_mask(out.null_mask(), 0, out.size(), true, stream);
+  }
+  out.set_null_count(null_count);
+}
+
+/**
+ * @brief Checks that a preallocated output column can hold the result of a fixed-width
+ * binary operation over `size` rows.
+ */
+void expects_fixed_width_output(mutable_column_view const& out,
+                                data_type lhs_type,
+                                data_type rhs_type,
+                                size_type size)
+{
+  CUDF_EXPECTS(out.size() == size, "Output column size doesn't match the operands");
+  CUDF_EXPECTS(is_fixed_width(out.type()) && !is_fixed_point(out.type()),
+               "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_fixed_width(lhs_type) && !is_fixed_point(lhs_type),
+               "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_fixed_width(rhs_type) && !is_fixed_point(rhs_type),
+               "Invalid/Unsupported rhs datatype");
+}
 }  // namespace binops
 
 namespace detail {
 
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  binops::expects_fixed_width_output(out, lhs.type(), rhs.type(), rhs.size());
+  if (rhs.size() == 0) { return; }
+  auto const mr       = rmm::mr::get_default_resource();
+  auto const new_mask = binops::null_using_binop(op)
+                          ? binops::detail::null_aware_valid_mask(rhs, lhs, op, stream, mr)
+                          : binops::detail::scalar_col_valid_mask_and(rhs, lhs, stream, mr);
+  binops::binary_operation_into(out, lhs, rhs, op, new_mask, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  binops::expects_fixed_width_output(out, lhs.type(), rhs.type(), lhs.size());
+  if (lhs.size() == 0) { return; }
+  auto const mr       = rmm::mr::get_default_resource();
+  auto const new_mask = binops::null_using_binop(op)
+                          ? binops::detail::null_aware_valid_mask(lhs, rhs, op, stream, mr)
+                          : binops::detail::scalar_col_valid_mask_and(lhs, rhs, stream, mr);
+  binops::binary_operation_into(out, lhs, rhs, op, new_mask, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
+  binops::expects_fixed_width_output(out, lhs.type(), rhs.type(), lhs.size());
+  if (lhs.size() == 0) { return; }
+  auto const mr       = rmm::mr::get_default_resource();
+  auto const new_mask = binops::null_using_binop(op)
+                          ? binops::detail::null_aware_valid_mask(lhs, rhs, op, stream, mr)
+                          : bitmask_and(table_view({lhs, rhs}), mr, stream);
+  binops::binary_operation_into(out, lhs, rhs, op, new_mask, stream);
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
@@ -247,6 +462,21 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          rmm::mr::device_memory_resource* mr,
                                          cudaStream_t stream)
 {
+  if (binops::is_dictionary_equality(rhs, op)) {
+    if (rhs.size() == 0) { return make_empty_column(output_type); }
+    dictionary_column_view dictionary(rhs);
+    return binary_operation(binops::dictionary_key_index(dictionary, lhs, stream),
+                            dictionary.get_indices_annotated(),
+                            op,
+                            output_type,
+                            mr,
+                            stream);
+  }
+
+  if (is_fixed_point(lhs.type()) || is_fixed_point(rhs.type())) {
+    return binops::detail::fixed_point_binary_operation(lhs, rhs, op, output_type, mr, stream);
+  }
+
   if ((lhs.type().id() == type_id::STRING) && (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
@@ -259,7 +489,9 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
 
   std::unique_ptr<column> out;
   if (binops::null_using_binop(op)) {
-    out = make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
+    auto new_mask = binops::detail::null_aware_valid_mask(rhs, lhs, op, stream, mr);
+    out           = make_fixed_width_column(
+      output_type, rhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
   } else {
     auto new_mask = binops::detail::scalar_col_valid_mask_and(rhs, lhs, stream, mr);
     out           = make_fixed_width_column(
@@ -268,8 +500,7 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
 
   if (rhs.size() == 0) { return out; }
 
-  auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  binops::fixed_width_binary_operation(*out, lhs, rhs, op, stream);
   return out;
 }
 
@@ -280,6 +511,21 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::mr::device_memory_resource* mr,
                                          cudaStream_t stream)
 {
+  if (binops::is_dictionary_equality(lhs, op)) {
+    if (lhs.size() == 0) { return make_empty_column(output_type); }
+    dictionary_column_view dictionary(lhs);
+    return binary_operation(dictionary.get_indices_annotated(),
+                            binops::dictionary_key_index(dictionary, rhs, stream),
+                            op,
+                            output_type,
+                            mr,
+                            stream);
+  }
+
+  if (is_fixed_point(lhs.type()) || is_fixed_point(rhs.type())) {
+    return binops::detail::fixed_point_binary_operation(lhs, rhs, op, output_type, mr, stream);
+  }
+
   if ((lhs.type().id() == type_id::STRING) && (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
@@ -292,7 +538,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   std::unique_ptr<column> out;
   if (binops::null_using_binop(op)) {
-    out = make_fixed_width_column(output_type, lhs.size(), mask_state::ALL_VALID, stream, mr);
+    auto new_mask = binops::detail::null_aware_valid_mask(lhs, rhs, op, stream, mr);
+    out           = make_fixed_width_column(
+      output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
   } else {
     auto new_mask = binops::detail::scalar_col_valid_mask_and(lhs, rhs, stream, mr);
     out           = make_fixed_width_column(
@@ -301,8 +549,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   if (lhs.size() == 0) { return out; }
 
-  auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  binops::fixed_width_binary_operation(*out, lhs, rhs, op, stream);
   return out;
 }
 
@@ -315,6 +562,10 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 {
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
+  if (is_fixed_point(lhs.type()) || is_fixed_point(rhs.type())) {
+    return binops::detail::fixed_point_binary_operation(lhs, rhs, op, output_type, mr, stream);
+  }
+
   if ((lhs.type().id() == type_id::STRING) && (rhs.type().id() == type_id::STRING)) {
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
@@ -327,7 +578,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   std::unique_ptr<column> out;
   if (binops::null_using_binop(op)) {
-    out = make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
+    auto new_mask = binops::detail::null_aware_valid_mask(lhs, rhs, op, stream, mr);
+    out           = make_fixed_width_column(
+      output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
   } else {
     auto new_mask = bitmask_and(table_view({lhs, rhs}), mr, stream);
     out           = make_fixed_width_column(
@@ -337,8 +590,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   // Check for 0 sized data
   if (lhs.size() == 0 || rhs.size() == 0) { return out; }
 
-  auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  binops::fixed_width_binary_operation(*out, lhs, rhs, op, stream);
   return out;
 }
 
@@ -372,8 +624,69 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return out;
 }
 
+namespace {
+/**
+ * @brief Returns the rows `[begin, end)` of a chunked column, which must lie in a single chunk
+ */
+column_view slice_chunks(chunked_column_view const& col, size_type begin, size_type end)
+{
+  auto const& offsets = col.chunk_offsets();
+  // The chunk holding `begin` is the last one starting at or before it, skipping empty chunks
+  auto const chunk = std::distance(offsets.begin(),
+                                   std::upper_bound(offsets.begin(), offsets.end(), begin)) -
+                     1;
+  auto const chunk_begin = offsets[chunk];
+  return cudf::slice(col.chunk(chunk), {begin - chunk_begin, end - chunk_begin}).front();
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> binary_operation(chunked_column_view const& lhs,
+                                                      chunked_column_view const& rhs,
+                                                      binary_operator op,
+                                                      data_type output_type,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match");
+
+  std::vector<size_type> boundaries;
+  std::set_union(lhs.chunk_offsets().begin(),
+                 lhs.chunk_offsets().end(),
+                 rhs.chunk_offsets().begin(),
+                 rhs.chunk_offsets().end(),
+                 std::back_inserter(boundaries));
+  boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+  std::vector<std::unique_ptr<column>> results;
+  for (size_t i = 0; i + 1 < boundaries.size(); ++i) {
+    auto const begin = boundaries[i];
+    auto const end   = boundaries[i + 1];
+    results.push_back(binary_operation(slice_chunks(lhs, begin, end),
+                                       slice_chunks(rhs, begin, end),
+                                       op,
+                                       output_type,
+                                       mr,
+                                       stream));
+  }
+  return results;
+}
+
 }  // namespace detail
 
+void precompile_binary_operations(std::vector<binary_operation_signature> const& signatures)
+{
+  CUDF_FUNC_RANGE();
+  for (auto const& signature : signatures) {
+    CUDF_EXPECTS(signature.op != binary_operator::GENERIC_BINARY,
+                 "GENERIC_BINARY kernels are compiled from their PTX");
+    CUDF_EXPECTS(is_fixed_width(signature.output_type), "Invalid/Unsupported output datatype");
+    CUDF_EXPECTS(is_fixed_width(signature.lhs_type), "Invalid/Unsupported lhs datatype");
+    CUDF_EXPECTS(is_fixed_width(signature.rhs_type), "Invalid/Unsupported rhs datatype");
+    binops::jit::precompile(signature);
+  }
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
@@ -414,4 +727,41 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, ptx, output_type, mr);
 }
 
+std::vector<std::unique_ptr<column>> binary_operation(chunked_column_view const& lhs,
+                                                      chunked_column_view const& rhs,
+                                                      binary_operator op,
+                                                      data_type output_type,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::binary_operation(lhs, rhs, op, output_type, mr);
+}
+
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(out, lhs, rhs, op);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(out, lhs, rhs, op);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(out, lhs, rhs, op);
+}
+
 }  // namespace cudf
@@ -121,6 +121,82 @@ std::unique_ptr<column> binary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns whether a binary operation between fixed-width operands has a
+ * compiled implementation
+ *
+ * The compiled operations cover the arithmetic, comparison and logical operators
+ * between operands of the same numeric, timestamp or duration type, returning the
+ * natural output type of the operator. Other combinations are JIT compiled.
+ *
+ * @param out Output data type
+ * @param lhs Left operand data type
+ * @param rhs Right operand data type
+ * @param op  The binary operator
+ * @return true if `binary_operation` into a preallocated column supports the operation
+ */
+bool is_supported_fixed_width_operation(data_type out,
+                                        data_type lhs,
+                                        data_type rhs,
+                                        binary_operator op);
+
+/**
+ * @brief Computes `out[i] = op(lhs, rhs[i])` into a preallocated fixed-width column
+ *
+ * The null mask of @p out is left unchanged.
+ *
+ * @throw cudf::logic_error if `is_supported_fixed_width_operation` is false for the operands
+ *
+ * @param out    Output column, sized as @p rhs
+ * @param lhs    The left operand scalar
+ * @param rhs    The right operand column
+ * @param op     The binary operator
+ * @param stream CUDA stream used for kernel launches
+ */
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream);
+
+/**
+ * @brief Computes `out[i] = op(lhs[i], rhs)` into a preallocated fixed-width column
+ *
+ * The null mask of @p out is left unchanged.
+ *
+ * @throw cudf::logic_error if `is_supported_fixed_width_operation` is false for the operands
+ *
+ * @param out    Output column, sized as @p lhs
+ * @param lhs    The left operand column
+ * @param rhs    The right operand scalar
+ * @param op     The binary operator
+ * @param stream CUDA stream used for kernel launches
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream);
+
+/**
+ * @brief Computes `out[i] = op(lhs[i], rhs[i])` into a preallocated fixed-width column
+ *
+ * The null mask of @p out is left unchanged.
+ *
+ * @throw cudf::logic_error if `is_supported_fixed_width_operation` is false for the operands
+ *
+ * @param out    Output column, sized as @p lhs
+ * @param lhs    The left operand column
+ * @param rhs    The right operand column
+ * @param op     The binary operator
+ * @param stream CUDA stream used for kernel launches
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream);
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
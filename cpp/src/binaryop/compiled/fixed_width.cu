@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/transform.h>
+
+#include <cmath>
+#include <type_traits>
+
+#include "binary_ops.hpp"
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace {
+template <typename T>
+constexpr bool is_arithmetic_type()
+{
+  return is_numeric<T>() && !std::is_same<T, bool>::value;
+}
+
+/**
+ * @brief Operators of the compiled binary operations
+ *
+ * Each operator states the operand types it is instantiated for, all operands being
+ * of the same type, and the type of its result. The results match the JIT operators
+ * of `binaryop/jit/code/operation.cpp` for these types.
+ */
+namespace ops {
+struct add {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return is_arithmetic_type<T>() || is_duration<T>();
+  }
+  template <typename T>
+  using result = T;
+  template <typename T>
+  __device__ T operator()(T x, T y) const
+  {
+    return static_cast<T>(x + y);
+  }
+};
+
+struct sub {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return is_arithmetic_type<T>() || is_duration<T>();
+  }
+  template <typename T>
+  using result = T;
+  template <typename T>
+  __device__ T operator()(T x, T y) const
+  {
+    return static_cast<T>(x - y);
+  }
+};
+
+struct mul {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return is_arithmetic_type<T>();
+  }
+  template <typename T>
+  using result = T;
+  template <typename T>
+  __device__ T operator()(T x, T y) const
+  {
+    return static_cast<T>(x * y);
+  }
+};
+
+struct div {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return is_arithmetic_type<T>();
+  }
+  template <typename T>
+  using result = T;
+  template <typename T>
+  __device__ T operator()(T x, T y) const
+  {
+    return static_cast<T>(x / y);
+  }
+};
+
+struct true_div {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return is_arithmetic_type<T>();
+  }
+  template <typename T>
+  using result = double;
+  template <typename T>
+  __device__ double operator()(T x, T y) const
+  {
+    return static_cast<double>(x) / static_cast<double>(y);
+  }
+};
+
+struct mod {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return is_arithmetic_type<T>();
+  }
+  template <typename T>
+  using result = T;
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  __device__ T operator()(T x, T y) const
+  {
+    return static_cast<T>(x % y);
+  }
+  template <typename T, std::enable_if_t<std::is_same<T, float>::value>* = nullptr>
+  __device__ T operator()(T x, T y) const
+  {
+    return fmodf(x, y);
+  }
+  template <typename T, std::enable_if_t<std::is_same<T, double>::value>* = nullptr>
+  __device__ T operator()(T x, T y) const
+  {
+    return fmod(x, y);
+  }
+};
+
+/**
+ * @brief Base of the comparison operators, defined for every ordered fixed-width type
+ */
+struct comparison {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return is_numeric<T>() || is_timestamp<T>() || is_duration<T>();
+  }
+  template <typename T>
+  using result = bool;
+};
+
+struct equal : comparison {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x == y;
+  }
+};
+
+struct not_equal : comparison {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x != y;
+  }
+};
+
+struct less : comparison {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x < y;
+  }
+};
+
+struct greater : comparison {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x > y;
+  }
+};
+
+struct less_equal : comparison {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x <= y;
+  }
+};
+
+struct greater_equal : comparison {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x >= y;
+  }
+};
+
+/**
+ * @brief Base of the logical operators, defined for booleans
+ */
+struct logical {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return std::is_same<T, bool>::value;
+  }
+  template <typename T>
+  using result = bool;
+};
+
+struct logical_and : logical {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x && y;
+  }
+};
+
+struct logical_or : logical {
+  template <typename T>
+  __device__ bool operator()(T x, T y) const
+  {
+    return x || y;
+  }
+};
+
+/**
+ * @brief Any operator without a compiled implementation
+ */
+struct unsupported {
+  template <typename T>
+  static constexpr bool supports()
+  {
+    return false;
+  }
+  template <typename T>
+  using result = void;
+};
+
+}  // namespace ops
+
+/**
+ * @brief Calls `F{}.operator()<Op, T>` with the operator type `Op` of `op`
+ *
+ * Used with `type_dispatcher` to dispatch on both the operand type and the operator.
+ */
+template <typename F>
+struct operator_dispatcher {
+  template <typename T, typename... Args>
+  decltype(auto) operator()(binary_operator op, Args&&... args)
+  {
+    F f{};
+    switch (op) {
+      case binary_operator::ADD: return f.template operator()<ops::add, T>(args...);
+      case binary_operator::SUB: return f.template operator()<ops::sub, T>(args...);
+      case binary_operator::MUL: return f.template operator()<ops::mul, T>(args...);
+      case binary_operator::DIV: return f.template operator()<ops::div, T>(args...);
+      case binary_operator::TRUE_DIV: return f.template operator()<ops::true_div, T>(args...);
+      case binary_operator::MOD: return f.template operator()<ops::mod, T>(args...);
+      case binary_operator::EQUAL: return f.template operator()<ops::equal, T>(args...);
+      case binary_operator::NOT_EQUAL: return f.template operator()<ops::not_equal, T>(args...);
+      case binary_operator::LESS: return f.template operator()<ops::less, T>(args...);
+      case binary_operator::GREATER: return f.template operator()<ops::greater, T>(args...);
+      case binary_operator::LESS_EQUAL:
+        return f.template operator()<ops::less_equal, T>(args...);
+      case binary_operator::GREATER_EQUAL:
+        return f.template operator()<ops::greater_equal, T>(args...);
+      case binary_operator::LOGICAL_AND:
+        return f.template operator()<ops::logical_and, T>(args...);
+      case binary_operator::LOGICAL_OR: return f.template operator()<ops::logical_or, T>(args...);
+      default: return f.template operator()<ops::unsupported, T>(args...);
+    }
+  }
+};
+
+struct is_supported_fn {
+  template <typename Op, typename T, std::enable_if_t<Op::template supports<T>()>* = nullptr>
+  bool operator()(data_type output_type)
+  {
+    return output_type == data_type{type_to_id<typename Op::template result<T>>()};
+  }
+
+  template <typename Op, typename T, std::enable_if_t<!Op::template supports<T>()>* = nullptr>
+  bool operator()(data_type)
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Applies an operator to a column and a scalar, in either order
+ */
+template <typename Op, typename T, bool scalar_is_lhs>
+struct scalar_operation {
+  T const* value;
+  __device__ typename Op::template result<T> operator()(T x) const
+  {
+    return scalar_is_lhs ? Op{}(*value, x) : Op{}(x, *value);
+  }
+};
+
+struct launch_fn {
+  template <typename Op, typename T, std::enable_if_t<Op::template supports<T>()>* = nullptr>
+  void operator()(mutable_column_view& out,
+                  column_view const& lhs,
+                  column_view const& rhs,
+                  cudaStream_t stream)
+  {
+    // Null rows are computed too, their values are ignored
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      lhs.begin<T>(),
+                      lhs.end<T>(),
+                      rhs.begin<T>(),
+                      out.begin<typename Op::template result<T>>(),
+                      Op{});
+  }
+
+  template <typename Op, typename T, std::enable_if_t<Op::template supports<T>()>* = nullptr>
+  void operator()(mutable_column_view& out,
+                  column_view const& col,
+                  scalar const& value,
+                  bool scalar_is_lhs,
+                  cudaStream_t stream)
+  {
+    auto const scalar_data = static_cast<scalar_type_t<T> const&>(value).data();
+    auto const out_begin   = out.begin<typename Op::template result<T>>();
+    if (scalar_is_lhs) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        col.begin<T>(),
+                        col.end<T>(),
+                        out_begin,
+                        scalar_operation<Op, T, true>{scalar_data});
+    } else {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        col.begin<T>(),
+                        col.end<T>(),
+                        out_begin,
+                        scalar_operation<Op, T, false>{scalar_data});
+    }
+  }
+
+  template <typename Op,
+            typename T,
+            typename... Args,
+            std::enable_if_t<!Op::template supports<T>()>* = nullptr>
+  void operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported compiled binary operation");
+  }
+};
+
+}  // namespace
+
+bool is_supported_fixed_width_operation(data_type out,
+                                        data_type lhs,
+                                        data_type rhs,
+                                        binary_operator op)
+{
+  return lhs == rhs &&
+         type_dispatcher(lhs, operator_dispatcher<is_supported_fn>{}, op, out);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  type_dispatcher(lhs.type(), operator_dispatcher<launch_fn>{}, op, out, lhs, rhs, stream);
+  CHECK_CUDA(stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  type_dispatcher(rhs.type(), operator_dispatcher<launch_fn>{}, op, out, rhs, lhs, true, stream);
+  CHECK_CUDA(stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream)
+{
+  type_dispatcher(lhs.type(), operator_dispatcher<launch_fn>{}, op, out, lhs, rhs, false, stream);
+  CHECK_CUDA(stream);
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
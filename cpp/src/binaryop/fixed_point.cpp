@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <binaryop/fixed_point.hpp>
+
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace binops {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the type of the integer representation of a fixed-point type
+ */
+data_type storage_type(data_type type)
+{
+  return data_type{type.id() == type_id::DECIMAL32 ? type_id::INT32 : type_id::INT64};
+}
+
+bool is_comparison(binary_operator op)
+{
+  return op == binary_operator::EQUAL || op == binary_operator::NOT_EQUAL ||
+         op == binary_operator::LESS || op == binary_operator::GREATER ||
+         op == binary_operator::LESS_EQUAL || op == binary_operator::GREATER_EQUAL ||
+         op == binary_operator::NULL_EQUALS;
+}
+
+template <typename Rep>
+Rep power_of_ten(int32_t exponent)
+{
+  Rep result = 1;
+  for (int32_t i = 0; i < exponent; ++i) { result *= 10; }
+  return result;
+}
+
+template <typename Rep>
+std::unique_ptr<scalar> make_power_of_ten(int32_t exponent, cudaStream_t stream)
+{
+  return std::make_unique<numeric_scalar<Rep>>(power_of_ten<Rep>(exponent), true, stream);
+}
+
+/**
+ * @brief The integer representation of a fixed-point column at a given scale
+ */
+struct column_storage {
+  std::unique_ptr<column> rescaled;  ///< Owns the representation when it had to be rescaled
+  column_view view;                  ///< The representation at the requested scale
+};
+
+/**
+ * @brief Returns the representation of a fixed-point column at @p scale, which must not
+ * be greater than the column's own scale.
+ */
+column_storage to_storage(column_view const& col, int32_t scale, cudaStream_t stream)
+{
+  auto const type = storage_type(col.type());
+  column_view const storage{
+    type, col.size(), col.head(), col.null_mask(), col.null_count(), col.offset()};
+  auto const exponent = col.type().scale() - scale;
+  if (exponent == 0) { return {nullptr, storage}; }
+
+  auto const factor = type.id() == type_id::INT32 ? make_power_of_ten<int32_t>(exponent, stream)
+                                                  : make_power_of_ten<int64_t>(exponent, stream);
+  auto rescaled = cudf::detail::binary_operation(
+    storage, *factor, binary_operator::MUL, type, rmm::mr::get_default_resource(), stream);
+  auto const view = rescaled->view();
+  return {std::move(rescaled), view};
+}
+
+template <typename Rep>
+std::unique_ptr<scalar> scalar_storage(scalar const& s, int32_t scale, cudaStream_t stream)
+{
+  // fixed_point_scalar<Rep> is a numeric_scalar of its representation
+  auto const value = static_cast<numeric_scalar<Rep> const&>(s).value(stream) *
+                     power_of_ten<Rep>(s.type().scale() - scale);
+  return std::make_unique<numeric_scalar<Rep>>(value, s.is_valid(stream), stream);
+}
+
+/**
+ * @brief Returns the representation of a fixed-point scalar at @p scale, which must not
+ * be greater than the scalar's own scale.
+ */
+std::unique_ptr<scalar> to_storage(scalar const& s, int32_t scale, cudaStream_t stream)
+{
+  return s.type().id() == type_id::DECIMAL32 ? scalar_storage<int32_t>(s, scale, stream)
+                                             : scalar_storage<int64_t>(s, scale, stream);
+}
+
+column_view const& operand(column_storage const& storage) { return storage.view; }
+
+scalar const& operand(std::unique_ptr<scalar> const& storage) { return *storage; }
+
+template <typename Lhs, typename Rhs>
+std::unique_ptr<column> fixed_point_operation(Lhs const& lhs,
+                                              Rhs const& rhs,
+                                              binary_operator op,
+                                              data_type output_type,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_fixed_point(lhs.type()) && lhs.type().id() == rhs.type().id(),
+               "Fixed-point operands must both be DECIMAL32 or both DECIMAL64");
+  auto const scale =
+    binary_operation_fixed_point_scale(op, lhs.type().scale(), rhs.type().scale());
+  if (is_comparison(op)) {
+    CUDF_EXPECTS(!is_fixed_point(output_type), "Invalid/Unsupported output datatype");
+  } else {
+    CUDF_EXPECTS(output_type == data_type(lhs.type().id(), scale),
+                 "Output type does not match the scale of the fixed-point result");
+  }
+
+  // MUL and DIV combine the scales, every other operator needs a common scale
+  auto const keep_scales = op == binary_operator::MUL || op == binary_operator::DIV;
+  auto const l           = to_storage(lhs, keep_scales ? lhs.type().scale() : scale, stream);
+  auto const r           = to_storage(rhs, keep_scales ? rhs.type().scale() : scale, stream);
+  if (!is_fixed_point(output_type)) {
+    return cudf::detail::binary_operation(operand(l), operand(r), op, output_type, mr, stream);
+  }
+
+  auto result = cudf::detail::binary_operation(
+    operand(l), operand(r), op, storage_type(output_type), mr, stream);
+  auto const size       = result->size();
+  auto const null_count = result->null_count();
+  auto contents         = result->release();
+  return std::make_unique<column>(
+    output_type, size, std::move(*contents.data), std::move(*contents.null_mask), null_count);
+}
+
+}  // namespace
+
+std::unique_ptr<column> fixed_point_binary_operation(scalar const& lhs,
+                                                     column_view const& rhs,
+                                                     binary_operator op,
+                                                     data_type output_type,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  return fixed_point_operation(lhs, rhs, op, output_type, mr, stream);
+}
+
+std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
+                                                     scalar const& rhs,
+                                                     binary_operator op,
+                                                     data_type output_type,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  return fixed_point_operation(lhs, rhs, op, output_type, mr, stream);
+}
+
+std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
+                                                     column_view const& rhs,
+                                                     binary_operator op,
+                                                     data_type output_type,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  return fixed_point_operation(lhs, rhs, op, output_type, mr, stream);
+}
+
+}  // namespace detail
+}  // namespace binops
+
+int32_t binary_operation_fixed_point_scale(binary_operator op,
+                                           int32_t left_scale,
+                                           int32_t right_scale)
+{
+  switch (op) {
+    case binary_operator::MUL: return left_scale + right_scale;
+    case binary_operator::DIV: return left_scale - right_scale;
+    case binary_operator::ADD:
+    case binary_operator::SUB:
+    case binary_operator::NULL_MAX:
+    case binary_operator::NULL_MIN: return std::min(left_scale, right_scale);
+    default:
+      CUDF_EXPECTS(binops::detail::is_comparison(op),
+                   "Unsupported binary operator for fixed-point operands");
+      return std::min(left_scale, right_scale);
+  }
+}
+
+}  // namespace cudf
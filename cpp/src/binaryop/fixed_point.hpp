@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+namespace cudf {
+namespace binops {
+namespace detail {
+/**
+ * @brief Performs a binary operation between a fixed-point scalar and a fixed-point column.
+ *
+ * The operands are rescaled to a common scale where the operator needs one and the
+ * operation runs on their integer representations.
+ *
+ * @throw cudf::logic_error if the operands are not both DECIMAL32 or both DECIMAL64
+ * @throw cudf::logic_error if @p op is not supported for fixed-point operands
+ * @throw cudf::logic_error if @p output_type does not match the scale of the result
+ */
+std::unique_ptr<column> fixed_point_binary_operation(scalar const& lhs,
+                                                     column_view const& rhs,
+                                                     binary_operator op,
+                                                     data_type output_type,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream);
+
+/**
+ * @copydoc fixed_point_binary_operation(scalar const&, column_view const&, binary_operator,
+ * data_type, rmm::mr::device_memory_resource*, cudaStream_t)
+ */
+std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
+                                                     scalar const& rhs,
+                                                     binary_operator op,
+                                                     data_type output_type,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream);
+
+/**
+ * @copydoc fixed_point_binary_operation(scalar const&, column_view const&, binary_operator,
+ * data_type, rmm::mr::device_memory_resource*, cudaStream_t)
+ */
+std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
+                                                     column_view const& rhs,
+                                                     binary_operator op,
+                                                     data_type output_type,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace binops
+}  // namespace cudf
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/null_mask.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
@@ -29,6 +30,7 @@
 #include <thrust/copy.h>
 #include <thrust/device_ptr.h>
 #include <thrust/extrema.h>
+#include <thrust/functional.h>
 #include <cub/cub.cuh>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
@@ -198,26 +200,53 @@ __global__ void count_set_bits_kernel(bitmask_type const *bitmask,
 }
 
 /**
- * @brief Convenience function to get offset word from a bitmask
+ * @brief Counts the number of non-zero bits in the range `[begin_bits[m], end_bits[m])` of each
+ * bitmask `masks[m]`.
  *
- * @see copy_offset_bitmask
- * @see offset_bitmask_and
- */
-__device__ bitmask_type get_mask_offset_word(bitmask_type const *__restrict__ source,
-                                             size_type destination_word_index,
-                                             size_type source_begin_bit,
-                                             size_type source_end_bit)
+ * The mask `m` is counted by the blocks `(*, m)` of the grid.
+ *
+ * @param[in] masks The bitmasks whose non-zero bits will be counted.
+ * @param[in] begin_bits The index (inclusive) of the first bit to count in each mask
+ * @param[in] end_bits The index (exclusive) of the last bit to count in each mask
+ * @param[out] counts The number of non-zero bits in each range, initialized to zero
+ **/
+template <size_type block_size>
+__global__ void batch_count_set_bits_kernel(bitmask_type const *const *masks,
+                                            size_type const *begin_bits,
+                                            size_type const *end_bits,
+                                            size_type *counts)
 {
-  size_type source_word_index = destination_word_index + word_index(source_begin_bit);
-  bitmask_type curr_word      = source[source_word_index];
-  bitmask_type next_word      = 0;
-  if ((word_index(source_begin_bit) != 0) &&
-      (word_index(source_end_bit) >
-       word_index(source_begin_bit +
-                  destination_word_index * detail::size_in_bits<bitmask_type>()))) {
-    next_word = source[source_word_index + 1];
+  auto const m         = blockIdx.y;
+  auto const bitmask   = masks[m];
+  auto const begin_bit = begin_bits[m];
+  auto const end_bit   = end_bits[m];
+  size_type thread_count{0};
+
+  if (begin_bit < end_bit) {
+    auto const first_word_index{word_index(begin_bit)};
+    auto const last_word_index{word_index(end_bit - 1)};
+    for (size_type thread_word_index = first_word_index + threadIdx.x + blockIdx.x * blockDim.x;
+         thread_word_index <= last_word_index;
+         thread_word_index += blockDim.x * gridDim.x) {
+      bitmask_type word = bitmask[thread_word_index];
+      // Drop the bits outside the range from the boundary words
+      if (thread_word_index == first_word_index) {
+        word &= ~set_least_significant_bits(intra_word_index(begin_bit));
+      }
+      auto const last_bits = intra_word_index(end_bit - 1) + 1;
+      if (thread_word_index == last_word_index &&
+          last_bits < static_cast<size_type>(detail::size_in_bits<bitmask_type>())) {
+        word &= set_least_significant_bits(last_bits);
+      }
+      thread_count += __popc(word);
+    }
   }
-  return __funnelshift_r(curr_word, next_word, source_begin_bit);
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type block_count{BlockReduce(temp_storage).Sum(thread_count)};
+
+  if (threadIdx.x == 0) { atomicAdd(&counts[m], block_count); }
 }
 
 /**
@@ -306,79 +335,11 @@ __global__ void copy_offset_bitmask(bitmask_type *__restrict__ destination,
   for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
        destination_word_index < number_of_mask_words;
        destination_word_index += blockDim.x * gridDim.x) {
-    destination[destination_word_index] =
-      get_mask_offset_word(source, destination_word_index, source_begin_bit, source_end_bit);
+    destination[destination_word_index] = detail::get_mask_offset_word(
+      source, destination_word_index, source_begin_bit, source_end_bit);
   }
 }
 
-/**
- * @brief Computes the bitwise AND of an array of bitmasks
- *
- * @param destination The bitmask to write result into
- * @param source Array of source mask pointers. All masks must be of same size
- * @param begin_bit Array of offsets into corresponding @p source masks.
- *                  Must be same size as source array
- * @param num_sources Number of masks in @p source array
- * @param source_size Number of bits in each mask in @p source
- * @param number_of_mask_words The number of words of type bitmask_type to copy
- */
-__global__ void offset_bitmask_and(bitmask_type *__restrict__ destination,
-                                   bitmask_type const *const *__restrict__ source,
-                                   size_type const *__restrict__ begin_bit,
-                                   size_type num_sources,
-                                   size_type source_size,
-                                   size_type number_of_mask_words)
-{
-  for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
-       destination_word_index < number_of_mask_words;
-       destination_word_index += blockDim.x * gridDim.x) {
-    bitmask_type destination_word = ~bitmask_type{0};  // All bits 1
-    for (size_type i = 0; i < num_sources; i++) {
-      destination_word &= get_mask_offset_word(
-        source[i], destination_word_index, begin_bit[i], begin_bit[i] + source_size);
-    }
-
-    destination[destination_word_index] = destination_word;
-  }
-}
-
-// Bitwise AND of the masks
-rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
-                               std::vector<size_type> const &begin_bits,
-                               size_type mask_size,
-                               cudaStream_t stream,
-                               rmm::mr::device_memory_resource *mr)
-{
-  CUDF_EXPECTS(std::all_of(begin_bits.begin(), begin_bits.end(), [](auto b) { return b >= 0; }),
-               "Invalid range.");
-  CUDF_EXPECTS(mask_size > 0, "Invalid bit range.");
-  CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
-               "Mask pointer cannot be null");
-
-  rmm::device_buffer dest_mask{};
-  auto num_bytes = bitmask_allocation_size_bytes(mask_size);
-
-  auto number_of_mask_words = num_bitmask_words(mask_size);
-
-  dest_mask = rmm::device_buffer{num_bytes, stream, mr};
-
-  rmm::device_vector<bitmask_type const *> d_masks(masks);
-  rmm::device_vector<size_type> d_begin_bits(begin_bits);
-
-  cudf::detail::grid_1d config(number_of_mask_words, 256);
-  offset_bitmask_and<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-    static_cast<bitmask_type *>(dest_mask.data()),
-    d_masks.data().get(),
-    d_begin_bits.data().get(),
-    d_masks.size(),
-    mask_size,
-    number_of_mask_words);
-
-  CHECK_CUDA(stream);
-
-  return dest_mask;
-}
-
 // convert [first_bit_index,last_bit_index) to
 // [first_word_index,last_word_index)
 struct to_word_index : public thrust::unary_function<size_type, size_type> {
@@ -550,6 +511,93 @@ std::vector<size_type> segmented_count_set_bits(bitmask_type const *bitmask,
   return ret;
 }
 
+// Count zero bits in the range of each mask with a single kernel launch per batch of masks
+std::vector<size_type> batch_count_unset_bits(std::vector<bitmask_type const *> const &masks,
+                                              std::vector<size_type> const &begin_bits,
+                                              std::vector<size_type> const &end_bits,
+                                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(masks.size() == begin_bits.size() && masks.size() == end_bits.size(),
+               "Expected a range for each mask.");
+  std::vector<size_type> counts(masks.size(), 0);
+  std::vector<size_type> masked;  // indices of the masks that need counting
+  size_type max_words = 0;
+  for (size_type m = 0; m < static_cast<size_type>(masks.size()); ++m) {
+    CUDF_EXPECTS(begin_bits[m] >= 0 && begin_bits[m] <= end_bits[m], "Invalid bit range.");
+    if (masks[m] != nullptr && begin_bits[m] < end_bits[m]) {
+      masked.push_back(m);
+      max_words = std::max(
+        max_words, word_index(end_bits[m] - 1) - word_index(begin_bits[m]) + size_type{1});
+    }
+  }
+  if (masked.empty()) { return counts; }
+
+  std::vector<bitmask_type const *> h_masks;
+  std::vector<size_type> h_begin_bits, h_end_bits;
+  for (auto m : masked) {
+    h_masks.push_back(masks[m]);
+    h_begin_bits.push_back(begin_bits[m]);
+    h_end_bits.push_back(end_bits[m]);
+  }
+  rmm::device_vector<bitmask_type const *> d_masks(h_masks);
+  rmm::device_vector<size_type> d_begin_bits(h_begin_bits);
+  rmm::device_vector<size_type> d_end_bits(h_end_bits);
+  rmm::device_vector<size_type> d_counts(masked.size(), 0);
+
+  // The blocks counting a mask stride through it, the grid's y dimension spans the masks
+  constexpr size_type block_size{256};
+  constexpr size_type max_blocks_per_mask{256};
+  constexpr size_type max_masks_per_launch{65535};
+  cudf::detail::grid_1d config(max_words, block_size);
+  auto const blocks_per_mask = std::min(config.num_blocks, max_blocks_per_mask);
+  for (size_type first = 0; first < static_cast<size_type>(masked.size());
+       first += max_masks_per_launch) {
+    auto const num_masks = std::min(static_cast<size_type>(masked.size()) - first,
+                                    max_masks_per_launch);
+    dim3 const grid(blocks_per_mask, num_masks);
+    batch_count_set_bits_kernel<block_size><<<grid, block_size, 0, stream>>>(
+      d_masks.data().get() + first,
+      d_begin_bits.data().get() + first,
+      d_end_bits.data().get() + first,
+      d_counts.data().get() + first);
+  }
+  CHECK_CUDA(stream);
+
+  std::vector<size_type> h_counts(masked.size());
+  CUDA_TRY(cudaMemcpyAsync(h_counts.data(),
+                           d_counts.data().get(),
+                           masked.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  for (std::size_t i = 0; i < masked.size(); ++i) {
+    auto const m = masked[i];
+    counts[m]    = (end_bits[m] - begin_bits[m]) - h_counts[i];
+  }
+  return counts;
+}
+
+// Bitwise AND of the masks
+rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
+                               std::vector<size_type> const &begin_bits,
+                               size_type mask_size,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource *mr)
+{
+  return bitmask_binop(thrust::bit_and<bitmask_type>{}, masks, begin_bits, mask_size, stream, mr);
+}
+
+// Bitwise OR of the masks
+rmm::device_buffer bitmask_or(std::vector<bitmask_type const *> const &masks,
+                              std::vector<size_type> const &begin_bits,
+                              size_type mask_size,
+                              cudaStream_t stream,
+                              rmm::mr::device_memory_resource *mr)
+{
+  return bitmask_binop(thrust::bit_or<bitmask_type>{}, masks, begin_bits, mask_size, stream, mr);
+}
+
 std::vector<size_type> segmented_count_unset_bits(bitmask_type const *bitmask,
                                                   std::vector<size_type> const &indices,
                                                   cudaStream_t stream)
@@ -663,9 +711,32 @@ rmm::device_buffer bitmask_and(table_view const &view,
     }
   }
 
-  if (masks.size() > 0) { return bitmask_and(masks, offsets, view.num_rows(), stream, mr); }
+  if (masks.size() > 0) {
+    return detail::bitmask_and(masks, offsets, view.num_rows(), stream, mr);
+  }
 
   return null_mask;
 }
 
+// Returns the bitwise OR of the null masks of all columns in the table view
+rmm::device_buffer bitmask_or(table_view const &view,
+                              rmm::mr::device_memory_resource *mr,
+                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  rmm::device_buffer null_mask{};
+  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+
+  // A column without a mask makes every row valid
+  std::vector<bitmask_type const *> masks;
+  std::vector<size_type> offsets;
+  for (auto &&col : view) {
+    if (not col.nullable()) { return null_mask; }
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+
+  return detail::bitmask_or(masks, offsets, view.num_rows(), stream, mr);
+}
+
 }  // namespace cudf
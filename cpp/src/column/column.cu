@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/copying.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -38,7 +39,8 @@ column::column(column const &other)
     _size{other._size},
     _data{other._data},
     _null_mask{other._null_mask},
-    _null_count{other._null_count}
+    _null_count{other._null_count},
+    _statistics{other.statistics()}
 {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) { _children.emplace_back(std::make_unique<column>(*c)); }
@@ -50,7 +52,8 @@ column::column(column const &other, cudaStream_t stream, rmm::mr::device_memory_
     _size{other._size},
     _data{other._data, stream, mr},
     _null_mask{other._null_mask, stream, mr},
-    _null_count{other._null_count}
+    _null_count{other._null_count},
+    _statistics{other.statistics()}
 {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) {
@@ -65,11 +68,13 @@ column::column(column &&other) noexcept
     _data{std::move(other._data)},
     _null_mask{std::move(other._null_mask)},
     _null_count{other._null_count},
-    _children{std::move(other._children)}
+    _children{std::move(other._children)},
+    _statistics{std::move(other._statistics)}
 {
   other._size       = 0;
   other._null_count = 0;
   other._type       = data_type{EMPTY};
+  other._statistics.clear();
 }
 
 // Release contents
@@ -78,6 +83,7 @@ column::contents column::release() noexcept
   _size       = 0;
   _null_count = 0;
   _type       = data_type{EMPTY};
+  clear_statistics();
   return column::contents{std::make_unique<rmm::device_buffer>(std::move(_data)),
                           std::make_unique<rmm::device_buffer>(std::move(_null_mask)),
                           std::move(_children)};
@@ -120,6 +126,7 @@ mutable_column_view column::mutable_view()
   // existing `null_count` is no longer valid. Reset it to `UNKNOWN_NULL_COUNT` forcing it to be
   // recomputed on the next invocation of `null_count()`.
   set_null_count(cudf::UNKNOWN_NULL_COUNT);
+  clear_statistics();
 
   return mutable_column_view{type(),
                              size(),
@@ -150,6 +157,7 @@ void column::set_null_mask(rmm::device_buffer &&new_null_mask, size_type new_nul
   }
   _null_mask  = std::move(new_null_mask);  // move
   _null_count = new_null_count;
+  clear_statistics();
 }
 
 void column::set_null_mask(rmm::device_buffer const &new_null_mask, size_type new_null_count)
@@ -161,6 +169,7 @@ void column::set_null_mask(rmm::device_buffer const &new_null_mask, size_type ne
   }
   _null_mask  = new_null_mask;  // copy
   _null_count = new_null_count;
+  clear_statistics();
 }
 
 void column::set_null_count(size_type new_null_count)
@@ -169,6 +178,22 @@ void column::set_null_count(size_type new_null_count)
   _null_count = new_null_count;
 }
 
+void column::set_statistics(column_statistics new_statistics)
+{
+  CUDF_EXPECTS(!new_statistics.min or new_statistics.min->type() == type(),
+               "Minimum type does not match the column type");
+  CUDF_EXPECTS(!new_statistics.max or new_statistics.max->type() == type(),
+               "Maximum type does not match the column type");
+  std::lock_guard<std::mutex> lock(_statistics_mutex);
+  _statistics = std::move(new_statistics);
+}
+
+column_statistics column::statistics() const
+{
+  std::lock_guard<std::mutex> lock(_statistics_mutex);
+  return _statistics;
+}
+
 namespace {
 struct create_column_from_view {
   cudf::column_view view;
@@ -15,9 +15,14 @@
  */
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/device_view_cache.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+
+#include <memory>
 #include <numeric>
+#include <type_traits>
+#include <vector>
 
 #include <rmm/rmm_api.h>
 #include <rmm/thrust_rmm_allocator.h>
@@ -106,6 +111,19 @@ create_device_view_from_view(ColumnView const& source, cudaStream_t stream)
   auto const descendant_storage_bytes =
     std::accumulate(get_extent, get_extent + num_children, std::size_t{0});
 
+  // The descriptors of immutable views are shared by the columns viewed several times by an
+  // API call
+  bool const cacheable =
+    std::is_same<ColumnView, column_view>::value and device_view_cache_active();
+  device_view_key key;
+  std::shared_ptr<rmm::device_buffer> descendant_storage;
+  if (cacheable) {
+    std::vector<column_view> children;
+    for (size_type i = 0; i < num_children; ++i) { children.push_back(source.child(i)); }
+    key                = make_device_view_key(children, false, stream);
+    descendant_storage = find_cached_device_view(key);
+  }
+
   // A buffer of CPU memory is allocated to hold the ColumnDeviceView
   // objects. Once filled, the CPU memory is copied to device memory
   // and then set into the d_children member pointer.
@@ -114,16 +132,16 @@ create_device_view_from_view(ColumnView const& source, cudaStream_t stream)
   // Each ColumnDeviceView instance may have child objects that
   // require setting some internal device pointers before being copied
   // from CPU to device.
-  rmm::device_buffer* const descendant_storage =
-    new rmm::device_buffer(descendant_storage_bytes, stream);
+  bool const cached = descendant_storage != nullptr;
+  if (not cached) {
+    descendant_storage = std::make_shared<rmm::device_buffer>(descendant_storage_bytes, stream);
+  }
 
-  auto deleter = [descendant_storage](ColumnDeviceView* v) {
-    v->destroy();
-    delete descendant_storage;
-  };
+  auto deleter = [descendant_storage](ColumnDeviceView* v) { v->destroy(); };
 
   std::unique_ptr<ColumnDeviceView, decltype(deleter)> result{
     new ColumnDeviceView(source, staging_buffer.data(), descendant_storage->data()), deleter};
+  if (cached) { return result; }
 
   // copy the CPU memory with all the children into device memory
   CUDA_TRY(cudaMemcpyAsync(descendant_storage->data(),
@@ -133,6 +151,7 @@ create_device_view_from_view(ColumnView const& source, cudaStream_t stream)
                            stream));
 
   CUDA_TRY(cudaStreamSynchronize(stream));
+  if (cacheable) { cache_device_view(std::move(key), descendant_storage); }
 
   return result;
 }
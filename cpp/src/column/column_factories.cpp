@@ -190,6 +190,30 @@ std::unique_ptr<cudf::column> column_from_scalar_dispatch::operator()<cudf::list
   CUDF_FAIL("TODO");
 }
 
+// Lists column from offsets and child columns
+std::unique_ptr<column> make_lists_column(size_type num_rows,
+                                          std::unique_ptr<column> offsets_column,
+                                          std::unique_ptr<column> child_column,
+                                          size_type null_count,
+                                          rmm::device_buffer&& null_mask,
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(offsets_column->type().id() == type_id::INT32, "Offsets must be INT32");
+  CUDF_EXPECTS(offsets_column->size() == num_rows + 1, "Offsets must have num_rows + 1 elements");
+  CUDF_EXPECTS(!offsets_column->has_nulls(), "Offsets must not have nulls");
+  CUDF_EXPECTS(null_count == 0 || null_mask.size() > 0, "Null mask required for null lists");
+  std::vector<std::unique_ptr<column>> children;
+  children.emplace_back(std::move(offsets_column));
+  children.emplace_back(std::move(child_column));
+  return std::make_unique<column>(data_type{type_id::LIST},
+                                  num_rows,
+                                  rmm::device_buffer{0, stream, mr},
+                                  std::move(null_mask),
+                                  null_count,
+                                  std::move(children));
+}
+
 std::unique_ptr<column> make_column_from_scalar(scalar const& s,
                                                 size_type size,
                                                 rmm::mr::device_memory_resource* mr,
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_statistics.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <mutex>
+
+namespace cudf {
+
+std::pair<std::shared_ptr<scalar const>, std::shared_ptr<scalar const>> column_min_max(
+  column const& col)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(col._statistics_mutex);
+  auto& statistics = col._statistics;
+  if (!statistics.min) { statistics.min = reduce(col.view(), make_min_aggregation(), col.type()); }
+  if (!statistics.max) { statistics.max = reduce(col.view(), make_max_aggregation(), col.type()); }
+  return {statistics.min, statistics.max};
+}
+
+bool column_is_sorted(column const& col, order column_order, null_order null_precedence)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(col._statistics_mutex);
+  auto& known    = col._statistics.is_sorted;
+  auto const key = std::make_pair(column_order, null_precedence);
+  auto const it  = known.find(key);
+  if (it != known.end()) { return it->second; }
+  auto const sorted = is_sorted(table_view{{col.view()}}, {column_order}, {null_precedence});
+  known.emplace(key, sorted);
+  return sorted;
+}
+
+size_type column_approx_distinct(column const& col)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(col._statistics_mutex);
+  auto& statistics = col._statistics;
+  if (statistics.approx_distinct < 0) {
+    auto const estimate = reduce(
+      col.view(), make_approx_nunique_aggregation(), data_type{type_to_id<size_type>()});
+    statistics.approx_distinct =
+      static_cast<numeric_scalar<size_type> const*>(estimate.get())->value();
+  }
+  return statistics.approx_distinct;
+}
+
+}  // namespace cudf
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/ipc.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+/**
+ * @brief Device memory of another process mapped into this one, unmapped on destruction.
+ */
+struct ipc_imported_table::mapping {
+  explicit mapping(cudaIpcMemHandle_t handle)
+  {
+    CUDA_TRY(cudaIpcOpenMemHandle(&base, handle, cudaIpcMemLazyEnablePeerAccess));
+  }
+  ~mapping() { cudaIpcCloseMemHandle(base); }
+
+  mapping(mapping const&) = delete;
+  mapping& operator=(mapping const&) = delete;
+
+  void* base{nullptr};
+};
+
+namespace detail {
+namespace {
+// Marks the start of an exported table handle ("cipc" in ASCII)
+constexpr uint32_t ipc_handle_magic = 0x63706963;
+
+/**
+ * @brief The start of an exported table handle, followed by the packed metadata.
+ *
+ * The packed data starts `data_offset` bytes into the allocation of `memory`. Tables without
+ * device data have no `memory`.
+ */
+struct ipc_header {
+  uint32_t magic;
+  uint32_t has_data;
+  cudaIpcMemHandle_t memory;
+  int64_t data_offset;
+};
+
+/**
+ * @brief Maps the exported allocations imported by this process.
+ *
+ * An allocation can be opened only once per process, so every import of the same allocation
+ * shares one mapping. Entries are removed on the next import after their mapping is released.
+ */
+class ipc_mapping_registry {
+ public:
+  std::shared_ptr<ipc_imported_table::mapping> open(cudaIpcMemHandle_t const& handle)
+  {
+    std::string const key(reinterpret_cast<char const*>(&handle), sizeof(handle));
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _mappings.begin(); it != _mappings.end();) {
+      it = it->second.expired() ? _mappings.erase(it) : std::next(it);
+    }
+    auto& entry = _mappings[key];
+    auto result = entry.lock();
+    if (result == nullptr) {
+      result = std::make_shared<ipc_imported_table::mapping>(handle);
+      entry  = result;
+    }
+    return result;
+  }
+
+ private:
+  std::mutex _mutex;
+  std::map<std::string, std::weak_ptr<ipc_imported_table::mapping>> _mappings;
+};
+
+ipc_mapping_registry& get_ipc_mapping_registry()
+{
+  static ipc_mapping_registry registry;
+  return registry;
+}
+
+}  // anonymous namespace
+
+ipc_exported_table export_ipc(table_view const& input,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  auto packed   = pack(input, mr, stream);
+  auto gpu_data = std::shared_ptr<rmm::device_buffer>(std::move(packed.gpu_data));
+
+  ipc_header header{};
+  header.magic = ipc_handle_magic;
+  if (gpu_data->size() > 0) {
+    // The buffer may be suballocated, so export its whole allocation
+    CUdeviceptr base{};
+    size_t size{};
+    auto const data = reinterpret_cast<CUdeviceptr>(gpu_data->data());
+    CUDF_EXPECTS(cuMemGetAddressRange(&base, &size, data) == CUDA_SUCCESS,
+                 "Failed to find the allocation of the exported buffer");
+    CUDA_TRY(cudaIpcGetMemHandle(&header.memory, reinterpret_cast<void*>(base)));
+    header.has_data    = 1;
+    header.data_offset = static_cast<int64_t>(data - base);
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  auto const& metadata = *packed.metadata_;
+  std::vector<uint8_t> handle(sizeof(ipc_header) + metadata.size());
+  std::memcpy(handle.data(), &header, sizeof(ipc_header));
+  std::memcpy(handle.data() + sizeof(ipc_header), metadata.data(), metadata.size());
+  return ipc_exported_table{std::move(handle), std::move(gpu_data)};
+}
+
+std::shared_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& handle)
+{
+  CUDF_EXPECTS(handle.size() > sizeof(ipc_header), "Invalid IPC table handle");
+  ipc_header header;
+  std::memcpy(&header, handle.data(), sizeof(ipc_header));
+  CUDF_EXPECTS(header.magic == ipc_handle_magic, "Invalid IPC table handle");
+
+  std::shared_ptr<ipc_imported_table::mapping> mapping;
+  uint8_t const* gpu_data = nullptr;
+  if (header.has_data != 0) {
+    mapping  = get_ipc_mapping_registry().open(header.memory);
+    gpu_data = static_cast<uint8_t const*>(mapping->base) + header.data_offset;
+  }
+  auto view = unpack(handle.data() + sizeof(ipc_header), gpu_data);
+  return std::make_shared<ipc_imported_table>(std::move(mapping), std::move(view));
+}
+
+}  // namespace detail
+
+ipc_exported_table export_ipc(table_view const& input,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::export_ipc(input, mr, stream);
+}
+
+std::shared_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& handle)
+{
+  CUDF_FUNC_RANGE();
+  return detail::import_ipc(handle);
+}
+
+}  // namespace cudf
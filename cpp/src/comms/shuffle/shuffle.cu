@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/comms/shuffle.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstdint>
+#include <numeric>
+
+namespace cudf {
+namespace comms {
+namespace {
+/**
+ * @brief Sizes of the packed partition exchanged between two ranks
+ */
+struct partition_sizes {
+  uint64_t metadata_size;
+  uint64_t data_size;
+};
+
+}  // anonymous namespace
+
+std::unique_ptr<table> all_to_all_shuffle(table_view const& input,
+                                          std::vector<size_type> const& columns_to_hash,
+                                          communicator& comm,
+                                          hash_id hash_function,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const num_ranks = comm.size();
+  auto const self      = comm.rank();
+  CUDF_EXPECTS(num_ranks > 0 and self >= 0 and self < num_ranks, "Invalid communicator rank");
+
+  auto partitions = cudf::detail::hash_partition_to_buffers(
+    input, columns_to_hash, num_ranks, hash_function, rmm::mr::get_default_resource(), stream);
+
+  // Pack the metadata of every partition next to its sizes
+  std::vector<partition_sizes> send_sizes(num_ranks);
+  std::vector<size_t> metadata_offsets(num_ranks + 1, 0);
+  std::vector<uint8_t> send_metadata;
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    auto const& data = partitions[peer].all_data;
+    auto const base  = data ? static_cast<uint8_t const*>(data->data()) : nullptr;
+    auto metadata    = cudf::detail::pack_metadata(partitions[peer].table, base);
+    send_sizes[peer] = partition_sizes{metadata.size(), data ? data->size() : 0};
+    send_metadata.insert(send_metadata.end(), metadata.begin(), metadata.end());
+    metadata_offsets[peer + 1] = send_metadata.size();
+  }
+
+  // Exchange the sizes so that every rank can allocate its receive buffers
+  rmm::device_buffer d_send_sizes(
+    send_sizes.data(), num_ranks * sizeof(partition_sizes), stream);
+  rmm::device_buffer d_recv_sizes(num_ranks * sizeof(partition_sizes), stream);
+  auto const d_send_sizes_ptr = static_cast<partition_sizes const*>(d_send_sizes.data());
+  auto const d_recv_sizes_ptr = static_cast<partition_sizes*>(d_recv_sizes.data());
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer == self) { continue; }
+    comm.isend(d_send_sizes_ptr + peer, sizeof(partition_sizes), peer, stream);
+    comm.irecv(d_recv_sizes_ptr + peer, sizeof(partition_sizes), peer, stream);
+  }
+  comm.waitall(stream);
+
+  std::vector<partition_sizes> recv_sizes(num_ranks);
+  CUDA_TRY(cudaMemcpyAsync(recv_sizes.data(),
+                           d_recv_sizes_ptr,
+                           num_ranks * sizeof(partition_sizes),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Start every send and receive of the partitions before waiting for any of them
+  rmm::device_buffer d_send_metadata(send_metadata.data(), send_metadata.size(), stream);
+  auto const d_send_metadata_ptr = static_cast<uint8_t const*>(d_send_metadata.data());
+  std::vector<rmm::device_buffer> recv_metadata;
+  std::vector<rmm::device_buffer> recv_data;
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    auto const sizes = peer == self ? partition_sizes{0, 0} : recv_sizes[peer];
+    recv_metadata.emplace_back(sizes.metadata_size, stream);
+    recv_data.emplace_back(sizes.data_size, stream);
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer == self) { continue; }
+    auto const& sent = send_sizes[peer];
+    comm.isend(d_send_metadata_ptr + metadata_offsets[peer], sent.metadata_size, peer, stream);
+    if (sent.data_size > 0) {
+      comm.isend(partitions[peer].all_data->data(), sent.data_size, peer, stream);
+    }
+    comm.irecv(recv_metadata[peer].data(), recv_metadata[peer].size(), peer, stream);
+    if (recv_data[peer].size() > 0) {
+      comm.irecv(recv_data[peer].data(), recv_data[peer].size(), peer, stream);
+    }
+  }
+  comm.waitall(stream);
+
+  // Unpack the received partitions, and the partition of this rank, in rank order
+  std::vector<std::vector<uint8_t>> metadata(num_ranks);
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer == self) { continue; }
+    metadata[peer].resize(recv_metadata[peer].size());
+    CUDA_TRY(cudaMemcpyAsync(metadata[peer].data(),
+                             recv_metadata[peer].data(),
+                             metadata[peer].size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<table_view> received;
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    received.push_back(
+      peer == self ? partitions[peer].table
+                   : cudf::detail::unpack(metadata[peer].data(),
+                                          static_cast<uint8_t const*>(recv_data[peer].data())));
+  }
+  return cudf::detail::concatenate(received, mr, stream);
+}
+
+}  // namespace comms
+}  // namespace cudf
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief One chunk of a fixed-width column gathered by `chunked_gather_kernel`
+ */
+struct chunk_source {
+  void const* data;          // Chunk data, already adjusted for the offset
+  bitmask_type const* mask;  // Chunk null mask, `nullptr` if not nullable
+  size_type offset;          // Offset of the chunk in bits of `mask`
+};
+
+/**
+ * @brief Output of one fixed-width column gathered by `chunked_gather_kernel`
+ */
+struct chunked_gather_target {
+  void* data;            // Output data
+  bitmask_type* mask;    // Output null mask, `nullptr` if the output has none
+  int32_t element_size;  // Size in bytes of the column elements
+};
+
+/**
+ * @brief Gathers fixed-width chunked columns in a single pass over the gather map.
+ *
+ * Like `fused_gather_kernel`, but each thread also locates the chunk holding its row, once for
+ * all columns, with a binary search of the chunk offsets. Out of bounds indices produce nulls.
+ *
+ * @param sources Chunks of the columns, `num_chunks` consecutive entries per column
+ * @param targets Outputs of the columns
+ * @param num_columns Number of columns
+ * @param chunk_offsets Row offsets of the chunks followed by the total number of rows
+ * @param num_chunks Number of chunks
+ * @param indices Gather map with negative indices already converted
+ * @param num_rows Number of output rows
+ * @param valid_counts Per-column counts of valid output rows, must be zero initialized
+ */
+__global__ void chunked_gather_kernel(chunk_source const* sources,
+                                      chunked_gather_target const* targets,
+                                      size_type num_columns,
+                                      size_type const* chunk_offsets,
+                                      size_type num_chunks,
+                                      size_type const* indices,
+                                      size_type num_rows,
+                                      size_type* valid_counts)
+{
+  auto const lane   = static_cast<size_type>(threadIdx.x % warp_size);
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  auto const total  = chunk_offsets[num_chunks];
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row - lane < num_rows;
+       row += stride) {
+    auto const index     = row < num_rows ? indices[row] : -1;
+    bool const in_bounds = index >= 0 && index < total;
+    auto const chunk     = in_bounds ? static_cast<size_type>(
+                                     thrust::upper_bound(thrust::seq,
+                                                         chunk_offsets,
+                                                         chunk_offsets + num_chunks + 1,
+                                                         index) -
+                                     chunk_offsets - 1)
+                                 : 0;
+    auto const local = index - chunk_offsets[chunk];
+
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& source = sources[c * num_chunks + chunk];
+      auto const& target = targets[c];
+      if (in_bounds) {
+        copy_fixed_width_element(source.data, target.data, local, row, target.element_size);
+      }
+      if (target.mask != nullptr) {
+        bool const valid =
+          in_bounds && (source.mask == nullptr || bit_is_set(source.mask, source.offset + local));
+        auto const word = __ballot_sync(0xffffffff, valid);
+        if (lane == 0) {
+          target.mask[word_index(row)] = word;
+          atomicAdd(valid_counts + c, __popc(word));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Converts a gather map of any integral type to `size_type` indices, wrapping negative
+ * indices and leaving out of bounds indices out of bounds
+ */
+struct normalize_gather_map {
+  template <typename map_type,
+            std::enable_if_t<std::is_integral<map_type>::value and
+                             not std::is_same<map_type, bool>::value>* = nullptr>
+  rmm::device_vector<size_type> operator()(column_view const& gather_map,
+                                           size_type num_rows,
+                                           bool check_bounds,
+                                           cudaStream_t stream)
+  {
+    if (check_bounds) {
+      CUDF_EXPECTS(gather_map.size() ==
+                     thrust::count_if(rmm::exec_policy(stream)->on(stream),
+                                      gather_map.begin<map_type>(),
+                                      gather_map.end<map_type>(),
+                                      bounds_checker<map_type>{-num_rows, num_rows}),
+                   "Index out of bounds.");
+    }
+    rmm::device_vector<size_type> indices(gather_map.size());
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      gather_map.begin<map_type>(),
+                      gather_map.end<map_type>(),
+                      indices.begin(),
+                      [num_rows] __device__(map_type index) {
+                        return static_cast<size_type>(index < 0 ? index + num_rows : index);
+                      });
+    return indices;
+  }
+
+  template <typename map_type,
+            typename... Args,
+            std::enable_if_t<not std::is_integral<map_type>::value or
+                             std::is_same<map_type, bool>::value>* = nullptr>
+  rmm::device_vector<size_type> operator()(Args&&... args)
+  {
+    CUDF_FAIL("Gather map must be an integral type.");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> gather(chunked_table_view const& source_table,
+                              column_view const& gather_map,
+                              bool check_bounds,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+
+  auto const indices = type_dispatcher(gather_map.type(),
+                                       normalize_gather_map{},
+                                       gather_map,
+                                       source_table.num_rows(),
+                                       check_bounds,
+                                       stream);
+  auto const num_rows   = gather_map.size();
+  auto const num_chunks = source_table.num_chunks();
+  // Without bounds checking, out of bounds rows are nullified as in `cudf::gather`
+  bool const nullify = not check_bounds;
+
+  std::vector<std::unique_ptr<column>> columns(source_table.num_columns());
+  std::vector<size_type> fixed_width_columns;
+  thrust::host_vector<chunk_source> sources;
+  thrust::host_vector<chunked_gather_target> targets;
+  for (size_type c = 0; c < source_table.num_columns(); ++c) {
+    auto const chunked = source_table.column(c);
+    if (not is_fixed_width(chunked.type())) {
+      // Only this column is materialized, and only for the duration of its gather
+      auto const materialized =
+        concatenate(chunked.chunks(), rmm::mr::get_default_resource(), stream);
+      auto gathered = gather(
+        table_view{{materialized->view()}}, indices.begin(), indices.end(), nullify, mr, stream);
+      columns[c] = std::move(gathered->release().front());
+      continue;
+    }
+
+    auto const element_size = static_cast<int32_t>(size_of(chunked.type()));
+    bool nullable           = nullify;
+    for (auto const& chunk : chunked.chunks()) {
+      sources.push_back(chunk_source{
+        static_cast<int8_t const*>(chunk.head()) + chunk.offset() * element_size,
+        chunk.null_mask(),
+        chunk.offset()});
+      nullable = nullable or chunk.nullable();
+    }
+    columns[c] =
+      make_fixed_width_column(chunked.type(), num_rows, mask_state::UNALLOCATED, stream, mr);
+    if (nullable) {
+      columns[c]->set_null_mask(create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr),
+                                0);
+    }
+    targets.push_back(chunked_gather_target{
+      columns[c]->mutable_view().head(), columns[c]->mutable_view().null_mask(), element_size});
+    fixed_width_columns.push_back(c);
+  }
+
+  if (not targets.empty() and num_rows > 0) {
+    rmm::device_vector<chunk_source> d_sources(sources);
+    rmm::device_vector<chunked_gather_target> d_targets(targets);
+    rmm::device_vector<size_type> d_offsets(source_table.chunk_offsets());
+    rmm::device_vector<size_type> d_valid_counts(targets.size(), 0);
+
+    constexpr size_type block_size = 256;
+    cudf::detail::grid_1d grid{num_rows, block_size};
+    chunked_gather_kernel<<<grid.num_blocks, block_size, 0, stream>>>(
+      d_sources.data().get(),
+      d_targets.data().get(),
+      static_cast<size_type>(targets.size()),
+      d_offsets.data().get(),
+      num_chunks,
+      indices.data().get(),
+      num_rows,
+      d_valid_counts.data().get());
+    CHECK_CUDA(stream);
+
+    auto const valid_counts = thrust::host_vector<size_type>(d_valid_counts);
+    for (size_t i = 0; i < fixed_width_columns.size(); ++i) {
+      auto& column = columns[fixed_width_columns[i]];
+      if (column->nullable()) { column->set_null_count(num_rows - valid_counts[i]); }
+    }
+  }
+
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> gather(chunked_table_view const& source_table,
+                              column_view const& gather_map,
+                              bool check_bounds,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::gather(source_table, gather_map, check_bounds, mr, stream);
+}
+
+}  // namespace cudf
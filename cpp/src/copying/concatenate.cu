@@ -18,13 +18,18 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/dictionary/detail/concatenate.hpp>
+#include <cudf/lists/detail/concatenate.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/extrema.h>
 #include <thrust/transform_scan.h>
 
 #include <algorithm>
@@ -87,6 +92,9 @@ auto create_device_views(std::vector<column_view> const& views, cudaStream_t str
  * @brief Concatenates the null mask bits of all the column device views in the
  * `views` array to the destination bitmask.
  *
+ * Each thread assembles whole words of the destination from the shifted words of
+ * the one or more views overlapping them.
+ *
  * @param views Array of column_device_view
  * @param output_offsets Prefix sum of sizes of elements of `views`
  * @param number_of_views Size of `views` array
@@ -100,26 +108,35 @@ __global__ void concatenate_masks_kernel(column_device_view const* views,
                                          bitmask_type* dest_mask,
                                          size_type number_of_mask_bits)
 {
-  size_type mask_index = threadIdx.x + blockIdx.x * blockDim.x;
+  constexpr size_type word_size{detail::size_in_bits<bitmask_type>()};
+  size_type const number_of_mask_words = (number_of_mask_bits + word_size - 1) / word_size;
 
-  auto active_mask = __ballot_sync(0xFFFF'FFFF, mask_index < number_of_mask_bits);
+  for (size_type word = threadIdx.x + blockIdx.x * blockDim.x; word < number_of_mask_words;
+       word += blockDim.x * gridDim.x) {
+    size_type const word_begin = word * word_size;
+    size_type const word_end   = thrust::min(word_begin + word_size, number_of_mask_bits);
 
-  while (mask_index < number_of_mask_bits) {
-    size_type const source_view_index =
+    size_type view_index =
       thrust::upper_bound(
-        thrust::seq, output_offsets, output_offsets + number_of_views, mask_index) -
+        thrust::seq, output_offsets, output_offsets + number_of_views, word_begin) -
       output_offsets - 1;
-    bool bit_is_set = 1;
-    if (source_view_index < number_of_views) {
-      size_type const column_element_index = mask_index - output_offsets[source_view_index];
-      bit_is_set = views[source_view_index].is_valid(column_element_index);
+    bitmask_type new_word = 0;
+    for (size_type bit = word_begin; bit < word_end; ++view_index) {
+      auto const& view           = views[view_index];
+      size_type const view_begin = output_offsets[view_index];
+      size_type const view_end   = thrust::min<size_type>(output_offsets[view_index + 1], word_end);
+      size_type const count      = view_end - bit;
+      if (count == 0) { continue; }  // Empty view
+      bitmask_type bits = ~bitmask_type{0};
+      if (view.nullable()) {
+        bits = get_mask_offset_word(
+          view.null_mask(), 0, view.offset() + bit - view_begin, view.offset() + view.size());
+      }
+      if (count < word_size) { bits &= set_least_significant_bits(count); }
+      new_word |= bits << (bit - word_begin);
+      bit = view_end;
     }
-    bitmask_type const new_word = __ballot_sync(active_mask, bit_is_set);
-
-    if (threadIdx.x % detail::warp_size == 0) { dest_mask[word_index(mask_index)] = new_word; }
-
-    mask_index += blockDim.x * gridDim.x;
-    active_mask = __ballot_sync(active_mask, mask_index < number_of_mask_bits);
+    dest_mask[word] = new_word;
   }
 }
 
@@ -130,7 +147,7 @@ void concatenate_masks(rmm::device_vector<column_device_view> const& d_views,
                        cudaStream_t stream)
 {
   constexpr size_type block_size{256};
-  cudf::detail::grid_1d config(output_size, block_size);
+  cudf::detail::grid_1d config(num_bitmask_words(output_size), block_size);
   concatenate_masks_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
     d_views.data().get(),
     d_offsets.data().get(),
@@ -247,6 +264,158 @@ std::unique_ptr<column> fused_concatenate(std::vector<column_view> const& views,
   return out_col;
 }
 
+/**
+ * @brief One input of a fixed-width column concatenated by `fused_table_concatenate_kernel`
+ */
+struct concatenate_source {
+  void const* data;          // Input data, already adjusted for the offset
+  bitmask_type const* mask;  // Input null mask, `nullptr` if not nullable
+  size_type offset;          // Offset of the input in bits of `mask`
+};
+
+/**
+ * @brief Output of one fixed-width column concatenated by `fused_table_concatenate_kernel`
+ */
+struct concatenate_target {
+  void* data;            // Output data
+  bitmask_type* mask;    // Output null mask, `nullptr` if no input has nulls
+  int32_t element_size;  // Size in bytes of the column elements
+};
+
+/**
+ * @brief Concatenates the data and null masks of many fixed-width columns of many tables with
+ * a single launch.
+ *
+ * The `y` dimension of the grid strides over the columns and the `x` dimension over the output
+ * rows. Whole warps iterate while any of their rows is in range so that every lane takes part
+ * in the ballot building a null mask word.
+ *
+ * @param sources Inputs of the columns, `num_inputs` consecutive entries per column
+ * @param targets Outputs of the columns
+ * @param num_columns Number of columns
+ * @param input_offsets Row offsets of the inputs followed by the number of output rows
+ * @param num_inputs Number of input tables
+ * @param valid_counts Per-column counts of valid output rows, must be zero initialized
+ */
+template <size_type block_size>
+__global__ void fused_table_concatenate_kernel(concatenate_source const* sources,
+                                               concatenate_target const* targets,
+                                               size_type num_columns,
+                                               size_type const* input_offsets,
+                                               size_type num_inputs,
+                                               size_type* valid_counts)
+{
+  auto const lane     = static_cast<size_type>(threadIdx.x % detail::warp_size);
+  auto const stride   = static_cast<size_type>(blockDim.x * gridDim.x);
+  auto const num_rows = input_offsets[num_inputs];
+
+  for (size_type c = blockIdx.y; c < num_columns; c += gridDim.y) {
+    auto const& target         = targets[c];
+    size_type warp_valid_count = 0;
+
+    for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row - lane < num_rows;
+         row += stride) {
+      bool const active = row < num_rows;
+      size_type const input =
+        active ? thrust::upper_bound(
+                   thrust::seq, input_offsets, input_offsets + num_inputs + 1, row) -
+                   input_offsets - 1
+               : 0;
+      auto const local   = row - input_offsets[input];
+      auto const& source = sources[c * num_inputs + input];
+      if (active) {
+        copy_fixed_width_element(source.data, target.data, local, row, target.element_size);
+      }
+      if (target.mask != nullptr) {
+        bool const valid =
+          active && (source.mask == nullptr || bit_is_set(source.mask, source.offset + local));
+        bitmask_type const new_word = __ballot_sync(0xFFFF'FFFF, valid);
+        if (lane == 0) { target.mask[word_index(row)] = new_word; }
+        warp_valid_count += __popc(new_word);
+      }
+    }
+
+    if (target.mask != nullptr) {
+      auto block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+      if (threadIdx.x == 0) { atomicAdd(valid_counts + c, block_valid_count); }
+      // The shared memory of the reduction is reused for the next column
+      __syncthreads();
+    }
+  }
+}
+
+/**
+ * @brief Concatenates the fixed-width columns `column_indices` of `tables` with
+ * `fused_table_concatenate_kernel`
+ *
+ * @return The concatenated columns in the order of `column_indices`
+ */
+std::vector<std::unique_ptr<column>> fused_table_concatenate(
+  std::vector<table_view> const& tables,
+  std::vector<size_type> const& column_indices,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  thrust::host_vector<size_type> offsets(tables.size() + 1, 0);
+  int64_t total_rows = 0;
+  for (size_t i = 0; i < tables.size(); ++i) {
+    total_rows += tables[i].num_rows();
+    CUDF_EXPECTS(total_rows < std::numeric_limits<size_type>::max(),
+                 "Total number of concatenated rows exceeds size_type range");
+    offsets[i + 1] = static_cast<size_type>(total_rows);
+  }
+  auto const output_size = offsets.back();
+
+  std::vector<std::unique_ptr<column>> columns;
+  thrust::host_vector<concatenate_source> sources;
+  thrust::host_vector<concatenate_target> targets;
+  for (auto const c : column_indices) {
+    auto const& first       = tables.front().column(c);
+    auto const element_size = static_cast<int32_t>(size_of(first.type()));
+    bool has_nulls          = false;
+    for (auto const& t : tables) {
+      auto const& input = t.column(c);
+      sources.push_back(concatenate_source{
+        static_cast<int8_t const*>(input.head()) + input.offset() * element_size,
+        input.null_mask(),
+        input.offset()});
+      has_nulls = has_nulls or input.has_nulls();
+    }
+
+    auto const policy = has_nulls ? mask_allocation_policy::ALWAYS : mask_allocation_policy::NEVER;
+    auto out_col      = detail::allocate_like(first, output_size, policy, mr, stream);
+    out_col->set_null_count(0);  // prevent null count from being materialized
+    auto out_view = out_col->mutable_view();
+    targets.push_back(concatenate_target{out_view.head(), out_view.null_mask(), element_size});
+    columns.push_back(std::move(out_col));
+  }
+  if (output_size == 0 or columns.empty()) { return columns; }
+
+  rmm::device_vector<concatenate_source> d_sources(sources);
+  rmm::device_vector<concatenate_target> d_targets(targets);
+  rmm::device_vector<size_type> d_offsets(offsets);
+  rmm::device_vector<size_type> d_valid_counts(columns.size(), 0);
+
+  constexpr size_type block_size{256};
+  constexpr size_type max_grid_columns{65535};
+  cudf::detail::grid_1d config(output_size, block_size);
+  dim3 const grid(config.num_blocks,
+                  std::min(static_cast<size_type>(columns.size()), max_grid_columns));
+  fused_table_concatenate_kernel<block_size>
+    <<<grid, config.num_threads_per_block, 0, stream>>>(d_sources.data().get(),
+                                                         d_targets.data().get(),
+                                                         static_cast<size_type>(columns.size()),
+                                                         d_offsets.data().get(),
+                                                         static_cast<size_type>(tables.size()),
+                                                         d_valid_counts.data().get());
+
+  thrust::host_vector<size_type> const valid_counts(d_valid_counts);
+  for (size_t i = 0; i < columns.size(); ++i) {
+    if (columns[i]->nullable()) { columns[i]->set_null_count(output_size - valid_counts[i]); }
+  }
+  return columns;
+}
+
 template <typename T>
 std::unique_ptr<column> for_each_concatenate(std::vector<column_view> const& views,
                                              bool const has_nulls,
@@ -304,7 +473,7 @@ struct concatenate_dispatch {
 template <>
 std::unique_ptr<column> concatenate_dispatch::operator()<cudf::dictionary32>()
 {
-  CUDF_FAIL("dictionary concatenate not yet supported");
+  return cudf::dictionary::detail::concatenate(views, mr, stream);
 }
 
 template <>
@@ -316,7 +485,7 @@ std::unique_ptr<column> concatenate_dispatch::operator()<cudf::string_view>()
 template <>
 std::unique_ptr<column> concatenate_dispatch::operator()<cudf::list_view>()
 {
-  CUDF_FAIL("list_view concatenate not yet supported");
+  return cudf::lists::detail::concatenate(views, mr, stream);
 }
 
 // Concatenates the elements from a vector of column_views
@@ -356,8 +525,22 @@ std::unique_ptr<table> concatenate(std::vector<table_view> const& tables_to_conc
                            }),
                "Mismatch in table columns to concatenate.");
 
+  // All fixed-width columns of all tables are copied by one kernel launch when there is more
+  // than one of them; the other columns are concatenated one at a time
+  std::vector<size_type> fixed_width_indices;
+  for (size_type i = 0; i < first_table.num_columns(); ++i) {
+    if (is_fixed_width(first_table.column(i).type())) { fixed_width_indices.push_back(i); }
+  }
+  if (fixed_width_indices.size() < 2) { fixed_width_indices.clear(); }
+  auto fused_columns = fused_table_concatenate(tables_to_concat, fixed_width_indices, mr, stream);
+
   std::vector<std::unique_ptr<column>> concat_columns;
+  size_t next_fused = 0;
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
+    if (next_fused < fixed_width_indices.size() and fixed_width_indices[next_fused] == i) {
+      concat_columns.push_back(std::move(fused_columns[next_fused++]));
+      continue;
+    }
     std::vector<column_view> cols;
     std::transform(tables_to_concat.cbegin(),
                    tables_to_concat.cend(),
@@ -407,4 +590,18 @@ std::unique_ptr<table> concatenate(std::vector<table_view> const& tables_to_conc
   return detail::concatenate(tables_to_concat, mr, 0);
 }
 
+std::unique_ptr<column> concatenate(chunked_column_view const& column,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate(column.chunks(), mr, 0);
+}
+
+std::unique_ptr<table> concatenate(chunked_table_view const& table,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate(table.chunks(), mr, 0);
+}
+
 }  // namespace cudf
@@ -14,435 +14,409 @@
  * limitations under the License.
  */
 
-#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
-#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
 
-#include <numeric>
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/pair.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 
 namespace cudf {
 namespace detail {
 namespace {
+// align all column size allocations to this boundary so that all output column buffers
+// start at that alignment.
+static constexpr size_t split_align = 64;
+
+// copies larger than this are split into several operations so that a single large buffer
+// is copied by several thread blocks
+static constexpr size_type copy_chunk_bytes = 64 * 1024;
+
+static constexpr size_type bits_per_word = size_in_bits<bitmask_type>();
+
+/**
+ * @brief The kinds of buffers copied by `copy_partitions_kernel`
+ */
+enum class copy_kind : int32_t {
+  BYTES,     ///< Plain bytes: fixed-width data or string characters
+  OFFSETS,   ///< String or list offsets, shifted down to start at zero in the output
+  VALIDITY,  ///< Bits of a null mask, starting at any bit of the source mask
+};
+
 /**
- * @brief Copies contents of `in` to `out`.  Copies validity if present
- * but does not compute null count.
+ * @brief One copy of a contiguous range of a source buffer into an output buffer.
  *
- * @param in column_view to copy from
- * @param out mutable_column_view to copy to.
+ * Every buffer of every column of every split is described by one or more `copy_op`s so
+ * that all of them are copied by a single kernel launch.
  */
-template <size_type block_size, typename T, bool has_validity>
-__launch_bounds__(block_size) __global__
-  void copy_in_place_kernel(column_device_view const in, mutable_column_device_view out)
+struct copy_op {
+  copy_kind kind;
+  void const* src;
+  void* dst;
+  size_type num_elements;  ///< Bytes, offsets or bits to copy
+  size_type src_bit;       ///< (validity only) first bit of `src` to copy
+  size_type src_end_bit;   ///< (validity only) end of the valid bits of `src`
+  size_type shift;         ///< (offsets only) value subtracted from every offset
+};
+
+__device__ void copy_bytes(copy_op const& op)
 {
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
-
-  // begin/end indices for the column data
-  size_type begin = 0;
-  size_type end   = in.size();
-  // warp indices.  since 1 warp == 32 threads == sizeof(bit_mask_t) * 8,
-  // each warp will process one (32 bit) of the validity mask via
-  // __ballot_sync()
-  size_type warp_begin = cudf::word_index(begin);
-  size_type warp_end   = cudf::word_index(end - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  // current warp.
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    bool in_range = (index >= begin && index < end);
-
-    bool valid = true;
-    if (has_validity) { valid = in_range && in.is_valid(index); }
-    if (in_range) { out.element<T>(index) = in.element<T>(index); }
-
-    // update validity
-    if (has_validity) {
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid && in_range);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { out.set_mask_word(warp_cur, warp_mask); }
+  auto src = static_cast<uint8_t const*>(op.src);
+  auto dst = static_cast<uint8_t*>(op.dst);
+  size_type start = 0;
+
+  // Copy 8 bytes at a time when both buffers allow it
+  if (reinterpret_cast<uintptr_t>(src) % sizeof(uint64_t) == 0 and
+      reinterpret_cast<uintptr_t>(dst) % sizeof(uint64_t) == 0) {
+    auto const num_words = op.num_elements / static_cast<size_type>(sizeof(uint64_t));
+    auto src_words       = reinterpret_cast<uint64_t const*>(src);
+    auto dst_words       = reinterpret_cast<uint64_t*>(dst);
+    for (size_type i = threadIdx.x; i < num_words; i += blockDim.x) {
+      dst_words[i] = src_words[i];
     }
+    start = num_words * sizeof(uint64_t);
+  }
+  for (size_type i = start + threadIdx.x; i < op.num_elements; i += blockDim.x) {
+    dst[i] = src[i];
+  }
+}
 
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
+__device__ void copy_offsets(copy_op const& op)
+{
+  auto src = static_cast<size_type const*>(op.src);
+  auto dst = static_cast<size_type*>(op.dst);
+  for (size_type i = threadIdx.x; i < op.num_elements; i += blockDim.x) {
+    dst[i] = src[i] - op.shift;
+  }
+}
+
+__device__ void copy_validity(copy_op const& op)
+{
+  auto src             = static_cast<bitmask_type const*>(op.src);
+  auto dst             = static_cast<bitmask_type*>(op.dst);
+  auto const num_words = (op.num_elements + bits_per_word - 1) / bits_per_word;
+  for (size_type i = threadIdx.x; i < num_words; i += blockDim.x) {
+    auto const bit   = op.src_bit + i * bits_per_word;
+    auto const word  = word_index(bit);
+    auto const shift = intra_word_index(bit);
+    // Only read the next source word if the bits of this output word reach into it
+    auto const next_needed = shift != 0 and (word + 1) * bits_per_word < op.src_end_bit;
+    bitmask_type value     = __funnelshift_r(src[word], next_needed ? src[word + 1] : 0, shift);
+    // Clear the bits past the end of the copied range
+    auto const remaining = op.num_elements - i * bits_per_word;
+    if (remaining < bits_per_word) { value &= (bitmask_type{1} << remaining) - 1; }
+    dst[i] = value;
   }
 }
 
 /**
- * @brief Copies contents of one string column to another.  Copies validity if present
- * but does not compute null count.
- *
- * The purpose of this kernel is to reduce the number of
- * kernel calls for copying a string column from 2 to 1, since number of kernel calls is the
- * dominant factor in large scale contiguous_split() calls.  To do this, the kernel is
- * invoked with using max(num_chars, num_offsets) threads and then doing separate
- * bounds checking on offset, chars and validity indices.
- *
- * Outgoing offset values are shifted down to account for the new base address
- * each column gets as a result of the contiguous_split() process.
- *
- * @param in num_strings number of strings (rows) in the column
- * @param in offsets_in pointer to incoming offsets to be copied
- * @param out offsets_out pointer to output offsets
- * @param in validity_in_offset offset into validity buffer to add to element indices
- * @param in validity_in pointer to incoming validity vector to be copied
- * @param out validity_out pointer to output validity vector
- * @param in offset_shift value to shift copied offsets down by
- * @param in num_chars number of chars to copy
- * @param in chars_in input chars to be copied
- * @param out chars_out output chars to be copied.
+ * @brief Performs every copy of `ops`, one thread block per operation at a time.
  */
-template <size_type block_size, bool has_validity>
-__launch_bounds__(block_size) __global__
-  void copy_in_place_strings_kernel(size_type num_strings,
-                                    size_type const* __restrict__ offsets_in,
-                                    size_type* __restrict__ offsets_out,
-                                    size_type validity_in_offset,
-                                    bitmask_type const* __restrict__ validity_in,
-                                    bitmask_type* __restrict__ validity_out,
-                                    size_type offset_shift,
-                                    size_type num_chars,
-                                    char const* __restrict__ chars_in,
-                                    char* __restrict__ chars_out)
+__global__ void copy_partitions_kernel(copy_op const* __restrict__ ops, size_type num_ops)
 {
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
-
-  // how many warps we'll be processing. with strings, the chars and offsets
-  // lengths may be different.  so we'll just march the worst case.
-  size_type warp_begin = cudf::word_index(0);
-  size_type warp_end   = cudf::word_index(std::max(num_chars, num_strings + 1) - 1);
-
-  // end indices for chars
-  size_type chars_end = num_chars;
-  // end indices for offsets
-  size_type offsets_end = num_strings + 1;
-  // end indices for validity and the last warp that actually should
-  // be updated
-  size_type validity_end      = num_strings;
-  size_type validity_warp_end = cudf::word_index(num_strings - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    if (index < chars_end) { chars_out[index] = chars_in[index]; }
-
-    if (index < offsets_end) {
-      // each output column starts at a new base pointer. so we have to
-      // shift every offset down by the point (in chars) at which it was split.
-      offsets_out[index] = offsets_in[index] - offset_shift;
-    }
-
-    // if we're still in range of validity at all
-    if (has_validity && warp_cur <= validity_warp_end) {
-      bool valid = (index < validity_end) && bit_is_set(validity_in, validity_in_offset + index);
-
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { validity_out[warp_cur] = warp_mask; }
+  for (size_type i = blockIdx.x; i < num_ops; i += gridDim.x) {
+    auto const op = ops[i];
+    switch (op.kind) {
+      case copy_kind::BYTES: copy_bytes(op); break;
+      case copy_kind::OFFSETS: copy_offsets(op); break;
+      case copy_kind::VALIDITY: copy_validity(op); break;
     }
+  }
+}
 
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
+/**
+ * @brief Appends the operations copying `num_elements` elements of `element_size` bytes from
+ * `src` to `dst`, split into chunks of at most `copy_chunk_bytes`.
+ */
+void add_copy_ops(std::vector<copy_op>& ops,
+                  copy_kind kind,
+                  void const* src,
+                  void* dst,
+                  size_t num_elements,
+                  size_t element_size,
+                  size_type shift = 0)
+{
+  size_t const chunk_size = copy_chunk_bytes / element_size;
+  for (size_t begin = 0; begin < num_elements; begin += chunk_size) {
+    ops.push_back(copy_op{kind,
+                          static_cast<char const*>(src) + begin * element_size,
+                          static_cast<char*>(dst) + begin * element_size,
+                          static_cast<size_type>(std::min(chunk_size, num_elements - begin)),
+                          0,
+                          0,
+                          shift});
   }
 }
 
-// align all column size allocations to this boundary so that all output column buffers
-// start at that alignment.
-static constexpr size_t split_align = 64;
+/**
+ * @brief Appends the operations copying the null mask bits `[begin_bit, end_bit)` of `src`
+ * to the start of `dst`, split into chunks of whole output words.
+ */
+void add_validity_copy_ops(std::vector<copy_op>& ops,
+                           bitmask_type const* src,
+                           bitmask_type* dst,
+                           size_type begin_bit,
+                           size_type end_bit)
+{
+  auto const chunk_bits =
+    static_cast<size_type>(copy_chunk_bytes / sizeof(bitmask_type)) * bits_per_word;
+  for (size_type begin = begin_bit; begin < end_bit; begin += chunk_bits) {
+    ops.push_back(copy_op{copy_kind::VALIDITY,
+                          src,
+                          dst + (begin - begin_bit) / bits_per_word,
+                          std::min(chunk_bits, end_bit - begin),
+                          begin,
+                          end_bit,
+                          0});
+  }
+}
 
 /**
- * @brief Information about the split for a given column. Bundled together
- *        into a struct because tuples were getting pretty unreadable.
+ * @brief Returns whether `col` is a strings or lists column with an offsets child
  */
-struct column_split_info {
-  size_t data_buf_size;      // size of the data (including padding)
-  size_t validity_buf_size;  // validity vector size (including padding)
+bool has_offsets(column_view const& col)
+{
+  return col.num_children() > 0 and
+         (col.type().id() == STRING or (col.type().id() == LIST and col.size() > 0));
+}
 
-  size_t offsets_buf_size;  // (strings only) size of offset column (including padding)
-  size_type num_chars;      // (strings only) number of chars in the column
-  size_type chars_offset;   // (strings only) offset from head of chars data
+/**
+ * @brief The row range of a strings or lists column of one split in its offsets column
+ */
+struct offsets_split_info {
+  size_type index;  ///< Index of the column in the resulting ranges
+  size_type begin;
+  size_type end;
+  size_type const* offsets;
 };
 
 /**
- * @brief Functor called by the `type_dispatcher` to incrementally compute total
- * memory buffer size needed to allocate a contiguous copy of all columns within
- * a source table.
+ * @brief The columns of all the splits, followed by the sliced children of their lists
+ * columns, one level of nesting after the other.
  */
-struct column_buffer_size_functor {
-  template <typename T>
-  size_t operator()(column_view const& c, column_split_info& split_info)
-  {
-    split_info.data_buf_size = cudf::util::round_up_safe(c.size() * sizeof(T), split_align);
-    split_info.validity_buf_size =
-      (c.has_nulls() ? cudf::bitmask_allocation_size_bytes(c.size(), split_align) : 0);
-    return split_info.data_buf_size + split_info.validity_buf_size;
-  }
+struct split_columns {
+  std::vector<column_view> columns;
+  std::vector<size_type> children;  ///< Index of the child of a lists column, -1 if none
+  thrust::host_vector<thrust::pair<size_type, size_type>> ranges;  ///< Child rows of a column
 };
-template <>
-size_t column_buffer_size_functor::operator()<string_view>(column_view const& c,
-                                                           column_split_info& split_info)
-{
-  // this has already been precomputed in an earlier step. return the sum.
-  return split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size;
-}
 
 /**
- * @brief Functor called by the `type_dispatcher` to copy a column into a contiguous
- * buffer of output memory.
+ * @brief Computes the range of characters or elements of the strings and lists columns of
+ * `columns` starting at `begin` in a single pass on the device.
  *
- * Used for copying each column in a source table into one contiguous buffer of memory.
+ * @return The first and end child row of every column, `{0, 0}` for the other columns
  */
-struct column_copy_functor {
-  template <typename T>
-  void operator()(column_view const& in,
-                  column_split_info const& split_info,
-                  char*& dst,
-                  std::vector<column_view>& out_cols)
-  {
-    // outgoing pointers
-    char* data             = dst;
-    bitmask_type* validity = split_info.validity_buf_size == 0
-                               ? nullptr
-                               : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-
-    // increment working buffer
-    dst += (split_info.data_buf_size + split_info.validity_buf_size);
-
-    // no work to do
-    if (in.size() == 0) {
-      out_cols.push_back(column_view{in.type(), 0, nullptr});
-      return;
-    }
-
-    // custom copy kernel (which could probably just be an in-place copy() function in cudf).
-    cudf::size_type num_els  = cudf::util::round_up_safe(in.size(), cudf::detail::warp_size);
-    constexpr int block_size = 256;
-    cudf::detail::grid_1d grid{num_els, block_size, 1};
-
-    // output copied column
-    mutable_column_view mcv{in.type(), in.size(), data, validity, in.null_count()};
-    if (in.has_nulls()) {
-      copy_in_place_kernel<block_size, T, true><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
-    } else {
-      copy_in_place_kernel<block_size, T, false><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
-    }
-
-    out_cols.push_back(mcv);
-  }
-};
-template <>
-void column_copy_functor::operator()<string_view>(column_view const& in,
-                                                  column_split_info const& split_info,
-                                                  char*& dst,
-                                                  std::vector<column_view>& out_cols)
+thrust::host_vector<thrust::pair<size_type, size_type>> compute_child_ranges(
+  std::vector<column_view> const& columns, size_t begin, cudaStream_t stream)
 {
-  // outgoing pointers
-  char* chars_buf            = dst;
-  bitmask_type* validity_buf = split_info.validity_buf_size == 0
-                                 ? nullptr
-                                 : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-  size_type* offsets_buf =
-    reinterpret_cast<size_type*>(dst + split_info.data_buf_size + split_info.validity_buf_size);
-
-  // increment working buffer
-  dst += (split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size);
-
-  // offsets column.
-  strings_column_view strings_c(in);
-  column_view in_offsets = strings_c.offsets();
-  // note, incoming columns are sliced, so their size is fundamentally different from their child
-  // offset columns, which are unsliced.
-  size_type num_offsets = in.size() + 1;
-  cudf::size_type num_threads =
-    cudf::util::round_up_safe(std::max(split_info.num_chars, num_offsets), cudf::detail::warp_size);
-  column_view in_chars = strings_c.chars();
-
-  // a column with no strings will still have a single offset.
-  CUDF_EXPECTS(num_offsets > 0, "Invalid offsets child column");
-
-  // 1 combined kernel call that copies chars, offsets and validity in one pass. see notes on why
-  // this exists in the kernel brief.
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d grid{num_threads, block_size, 1};
-  if (in.has_nulls()) {
-    copy_in_place_strings_kernel<block_size, true><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      in.offset(),                                      // validity_in_offset
-      in.null_mask(),                                   // validity_in
-      validity_buf,                                     // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
-  } else {
-    copy_in_place_strings_kernel<block_size, false><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      0,                                                // validity_in_offset
-      nullptr,                                          // validity_in
-      nullptr,                                          // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
+  thrust::host_vector<offsets_split_info> offsets_info;
+  for (size_t i = begin; i < columns.size(); ++i) {
+    auto const& col = columns[i];
+    if (not has_offsets(col)) { continue; }
+    offsets_info.push_back(offsets_split_info{static_cast<size_type>(i - begin),
+                                              col.offset(),
+                                              col.offset() + col.size(),
+                                              col.child(0).data<size_type>()});
   }
 
-  // output child columns
-  column_view out_offsets{in_offsets.type(), num_offsets, offsets_buf};
-  column_view out_chars{in_chars.type(), static_cast<size_type>(split_info.num_chars), chars_buf};
-
-  // result
-  out_cols.push_back(column_view(
-    in.type(), in.size(), nullptr, validity_buf, in.null_count(), 0, {out_offsets, out_chars}));
+  rmm::device_vector<thrust::pair<size_type, size_type>> d_ranges(
+    columns.size() - begin, thrust::make_pair(size_type{0}, size_type{0}));
+  rmm::device_vector<offsets_split_info> d_offsets_info = offsets_info;
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   d_offsets_info.begin(),
+                   d_offsets_info.end(),
+                   [ranges = d_ranges.data().get()] __device__(offsets_split_info const& info) {
+                     ranges[info.index] =
+                       thrust::make_pair(info.offsets[info.begin], info.offsets[info.end]);
+                   });
+  return d_ranges;
 }
 
 /**
- * @brief Information about a string column in a table view.
+ * @brief Collects the columns of all `splits` and the child ranges of their strings and lists
+ * columns.
  *
- * Used internally by preprocess_string_column_info as part of a device-accessible
- * vector for computing final string information in a single kernel call.
+ * The ranges of every level of nesting are computed by a single pass on the device, so the
+ * number of passes depends on the depth of the lists rather than on the number of columns.
+ * Column `c` of split `s` is at `s * num_columns + c`.
  */
-struct column_preprocess_info {
-  size_type index;
-  size_type offset;
-  size_type size;
-  bool has_nulls;
-  cudf::column_device_view offsets;
-};
+split_columns collect_split_columns(std::vector<table_view> const& splits, cudaStream_t stream)
+{
+  split_columns result;
+  for (auto const& split : splits) {
+    result.columns.insert(result.columns.end(), split.begin(), split.end());
+  }
+
+  size_t level_begin = 0;
+  while (level_begin < result.columns.size()) {
+    auto const level_end = result.columns.size();
+    auto const ranges    = compute_child_ranges(result.columns, level_begin, stream);
+    result.ranges.insert(result.ranges.end(), ranges.begin(), ranges.end());
+    result.children.resize(level_end, -1);
+    for (size_t i = level_begin; i < level_end; ++i) {
+      auto const col = result.columns[i];
+      if (col.type().id() != LIST or not has_offsets(col)) { continue; }
+      // Slice the child without counting its nulls, which the output does not need
+      auto const child = lists_column_view(col).child();
+      auto const range = result.ranges[i];
+      std::vector<column_view> grandchildren;
+      for (size_type c = 0; c < child.num_children(); ++c) {
+        grandchildren.push_back(child.child(c));
+      }
+      result.children[i] = static_cast<size_type>(result.columns.size());
+      result.columns.emplace_back(child.type(),
+                                  range.second - range.first,
+                                  child.head(),
+                                  child.null_mask(),
+                                  UNKNOWN_NULL_COUNT,
+                                  child.offset() + range.first,
+                                  grandchildren);
+    }
+    level_begin = level_end;
+  }
+  return result;
+}
 
 /**
- * @brief Preprocess information about all strings columns in a table view.
+ * @brief Lays out column `index` of `columns` at `buf` and records the operations copying it.
  *
- * In order to minimize how often we touch the gpu, we need to preprocess various pieces of
- * information about the string columns in a table as a batch process.  This function builds a list
- * of the offset columns for all input string columns and computes this information with a single
- * thrust call.  In addition, the vector returned is allocated for -all- columns in the table so
- * further processing of non-string columns can happen afterwards.
+ * Every column gets its data, or characters, then its null mask when the input column has
+ * one and then the offsets of a strings or lists column, each padded to `split_align` bytes.
+ * The child of a lists column follows its offsets.
  *
- * The key things this function avoids
- * - avoiding reaching into gpu memory on the cpu to retrieve offsets to compute string sizes.
- * - creating column_device_views on the base string_column_view itself as that causes gpu memory
- * allocation.
+ * @param[in] columns The columns of the splits
+ * @param[in] index Index of the column to lay out
+ * @param[in,out] buf The output buffer, advanced past the column when `ops` is not null
+ * @param[out] ops The copy operations, or null to only compute the size of the column
+ * @return The size of the column and its children in the output buffer, and its output view
  */
-thrust::host_vector<column_split_info> preprocess_string_column_info(
-  cudf::table_view const& t,
-  rmm::device_vector<column_split_info>& device_split_info,
-  cudaStream_t stream)
+std::pair<size_t, column_view> layout_column(split_columns const& columns,
+                                             size_type index,
+                                             char*& buf,
+                                             std::vector<copy_op>* ops)
 {
-  // build a list of all the offset columns and their indices for all input string columns and put
-  // them on the gpu
-  thrust::host_vector<column_preprocess_info> offset_columns;
-  offset_columns.reserve(t.num_columns());  // worst case
-
-  // collect only string columns
-  size_type column_index = 0;
-  std::for_each(t.begin(), t.end(), [&offset_columns, &column_index](cudf::column_view const& c) {
-    if (c.type().id() == STRING) {
-      cudf::column_device_view cdv((strings_column_view(c)).offsets(), 0, 0);
-      offset_columns.push_back(
-        column_preprocess_info{column_index, c.offset(), c.size(), c.has_nulls(), cdv});
-    }
-    column_index++;
-  });
-  rmm::device_vector<column_preprocess_info> device_offset_columns = offset_columns;
+  auto const& col  = columns.columns[index];
+  auto const range = columns.ranges[index];
+  auto const type  = col.type().id();
+
+  size_t const num_bytes =
+    type == STRING ? static_cast<size_t>(range.second - range.first)
+                   : type == LIST ? 0 : col.size() * size_of(col.type());
+  auto const padded_bytes   = util::round_up_safe(num_bytes, split_align);
+  auto const validity_bytes =
+    col.nullable() ? bitmask_allocation_size_bytes(col.size(), split_align) : 0;
+  auto const offsets_bytes =
+    has_offsets(col) ? util::round_up_safe((col.size() + 1) * sizeof(size_type), split_align)
+                     : 0;
+
+  char* data = buf;
+  bitmask_type* validity =
+    validity_bytes == 0 ? nullptr : reinterpret_cast<bitmask_type*>(buf + padded_bytes);
+  auto offsets = reinterpret_cast<size_type*>(buf + padded_bytes + validity_bytes);
+  size_t size  = padded_bytes + validity_bytes + offsets_bytes;
+  if (ops != nullptr) { buf += size; }
+
+  // an empty strings or lists column may have no children at all
+  if ((type == STRING or type == LIST) and not has_offsets(col)) {
+    return {size, column_view{col.type(), 0, nullptr}};
+  }
+  std::pair<size_t, column_view> child;
+  if (type == LIST) {
+    child = layout_column(columns, columns.children[index], buf, ops);
+    size += child.first;
+  }
+  if (ops == nullptr) { return {size, column_view{}}; }
 
-  // compute column split information
-  rmm::device_vector<thrust::pair<size_type, size_type>> device_offsets(t.num_columns());
-  auto* offsets_p = device_offsets.data().get();
-  thrust::for_each(rmm::exec_policy(stream)->on(stream),
-                   device_offset_columns.begin(),
-                   device_offset_columns.end(),
-                   [offsets_p] __device__(column_preprocess_info const& cpi) {
-                     offsets_p[cpi.index] =
-                       thrust::make_pair(cpi.offsets.head<int32_t>()[cpi.offset],
-                                         cpi.offsets.head<int32_t>()[cpi.offset + cpi.size]);
-                   });
-  thrust::host_vector<thrust::pair<size_type, size_type>> host_offsets(device_offsets);
-  thrust::host_vector<column_split_info> split_info(t.num_columns());
-  std::for_each(offset_columns.begin(),
-                offset_columns.end(),
-                [&split_info, &host_offsets](column_preprocess_info const& cpi) {
-                  int32_t offset_start = host_offsets[cpi.index].first;
-                  int32_t offset_end   = host_offsets[cpi.index].second;
-                  auto num_chars       = offset_end - offset_start;
-                  split_info[cpi.index].data_buf_size =
-                    cudf::util::round_up_safe(static_cast<size_t>(num_chars), split_align);
-                  split_info[cpi.index].validity_buf_size =
-                    cpi.has_nulls ? cudf::bitmask_allocation_size_bytes(cpi.size, split_align) : 0;
-                  split_info[cpi.index].offsets_buf_size =
-                    cudf::util::round_up_safe((cpi.size + 1) * sizeof(size_type), split_align);
-                  split_info[cpi.index].num_chars    = num_chars;
-                  split_info[cpi.index].chars_offset = offset_start;
-                });
-  return split_info;
+  auto const null_count = validity == nullptr ? 0 : UNKNOWN_NULL_COUNT;
+  if (validity != nullptr) {
+    add_validity_copy_ops(
+      *ops, col.null_mask(), validity, col.offset(), col.offset() + col.size());
+  }
+
+  if (type == STRING or type == LIST) {
+    auto const col_offsets = col.child(0);
+    add_copy_ops(*ops,
+                 copy_kind::OFFSETS,
+                 col_offsets.data<size_type>() + col.offset(),
+                 offsets,
+                 col.size() + 1,
+                 sizeof(size_type),
+                 range.first);
+    column_view out_offsets{col_offsets.type(), col.size() + 1, offsets};
+    if (type == STRING) {
+      strings_column_view strings_c(col);
+      add_copy_ops(*ops,
+                   copy_kind::BYTES,
+                   strings_c.chars().data<char>() + range.first,
+                   data,
+                   num_bytes,
+                   1);
+      child.second =
+        column_view{strings_c.chars().type(), static_cast<size_type>(num_bytes), data};
+    }
+    return {size,
+            column_view(col.type(),
+                        col.size(),
+                        nullptr,
+                        validity,
+                        null_count,
+                        0,
+                        {out_offsets, child.second})};
+  }
+  if (col.size() == 0) { return {size, column_view{col.type(), 0, nullptr}}; }
+
+  add_copy_ops(*ops,
+               copy_kind::BYTES,
+               col.head<char>() + col.offset() * size_of(col.type()),
+               data,
+               num_bytes,
+               1);
+  return {size, column_view{col.type(), col.size(), data, validity, null_count}};
 }
 
 /**
- * @brief Creates a contiguous_split_result object which contains a deep-copy of the input
- * table_view into a single contiguous block of memory.
+ * @brief Lays out a split in its output buffer and records the operations copying it.
  *
- * The table_view contained within the contiguous_split_result will pass an expect_tables_equal()
- * call with the input table.  The memory referenced by the table_view and its internal column_views
- * is entirely contained in single block of memory.
+ * @param columns The columns of the splits
+ * @param first Index of the first column of the split in `columns`
+ * @param num_columns Number of columns of the split
  */
-contiguous_split_result alloc_and_copy(cudf::table_view const& t,
-                                       rmm::device_vector<column_split_info>& device_split_info,
-                                       rmm::mr::device_memory_resource* mr,
-                                       cudaStream_t stream)
+contiguous_split_result alloc_split(split_columns const& columns,
+                                    size_type first,
+                                    size_type num_columns,
+                                    std::vector<copy_op>& ops,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
 {
-  // preprocess column split information for string columns.
-  thrust::host_vector<column_split_info> split_info =
-    preprocess_string_column_info(t, device_split_info, stream);
-
-  // compute the rest of the column sizes (non-string columns, and total buffer size)
-  size_t total_size      = 0;
-  size_type column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&total_size, &column_index, &split_info](cudf::column_view const& c) {
-      total_size +=
-        cudf::type_dispatcher(c.type(), column_buffer_size_functor{}, c, split_info[column_index]);
-      column_index++;
-    });
-
-  // allocate
+  size_t total_size = 0;
+  char* buf         = nullptr;
+  for (size_type c = 0; c < num_columns; ++c) {
+    total_size += layout_column(columns, first + c, buf, nullptr).first;
+  }
+
   auto device_buf = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
-  char* buf       = static_cast<char*>(device_buf->data());
+  buf             = static_cast<char*>(device_buf->data());
 
-  // copy (this would be cleaner with a std::transform, but there's an nvcc compiler issue in the
-  // way)
   std::vector<column_view> out_cols;
-  out_cols.reserve(t.num_columns());
-
-  column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&out_cols, &buf, &column_index, &split_info](cudf::column_view const& c) {
-      cudf::type_dispatcher(
-        c.type(), column_copy_functor{}, c, split_info[column_index], buf, out_cols);
-      column_index++;
-    });
+  out_cols.reserve(num_columns);
+  for (size_type c = 0; c < num_columns; ++c) {
+    out_cols.push_back(layout_column(columns, first + c, buf, &ops).second);
+  }
 
   return contiguous_split_result{cudf::table_view{out_cols}, std::move(device_buf)};
 }
@@ -456,22 +430,28 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
 {
   auto subtables = cudf::split(input, splits);
 
-  // optimization : for large numbers of splits this allocation can dominate total time
-  //                spent if done inside alloc_and_copy().  so we'll allocate it once
-  //                and reuse it.
-  //
-  //                benchmark:        1 GB data, 10 columns, 256 splits.
-  //                no optimization:  106 ms (8 GB/s)
-  //                optimization:     20 ms (48 GB/s)
-  rmm::device_vector<column_split_info> device_split_info(input.num_columns());
+  // The sizes of all strings and lists columns of all splits are computed in a single pass
+  // per level of nesting, and every buffer of every split is then copied by a single kernel
+  // launch, since the number of kernel launches dominates the time of a contiguous_split
+  // with many splits and columns
+  auto const num_columns = input.num_columns();
+  auto const columns     = collect_split_columns(subtables, stream);
 
+  std::vector<copy_op> ops;
   std::vector<contiguous_split_result> result;
-  std::transform(subtables.begin(),
-                 subtables.end(),
-                 std::back_inserter(result),
-                 [mr, stream, &device_split_info](table_view const& t) {
-                   return alloc_and_copy(t, device_split_info, mr, stream);
-                 });
+  result.reserve(subtables.size());
+  for (size_t s = 0; s < subtables.size(); ++s) {
+    result.push_back(alloc_split(columns, s * num_columns, num_columns, ops, mr, stream));
+  }
+
+  if (not ops.empty()) {
+    rmm::device_vector<copy_op> d_ops(ops);
+    constexpr int block_size = 256;
+    auto const num_blocks    = std::min<size_t>(ops.size(), 65535);
+    copy_partitions_kernel<<<num_blocks, block_size, 0, stream>>>(
+      d_ops.data().get(), static_cast<size_type>(ops.size()));
+    CHECK_CUDA(stream);
+  }
 
   return result;
 }
@@ -480,10 +460,11 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
 
 std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& input,
                                                       std::vector<size_type> const& splits,
-                                                      rmm::mr::device_memory_resource* mr)
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return cudf::detail::contiguous_split(input, splits, mr, (cudaStream_t)0);
+  return cudf::detail::contiguous_split(input, splits, mr, stream);
 }
 
 };  // namespace cudf
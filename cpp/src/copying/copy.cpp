@@ -95,19 +95,21 @@ std::unique_ptr<table> empty_like(table_view const& input_table)
 
 std::unique_ptr<column> allocate_like(column_view const& input,
                                       mask_allocation_policy mask_alloc,
-                                      rmm::mr::device_memory_resource* mr)
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::allocate_like(input, input.size(), mask_alloc, mr);
+  return detail::allocate_like(input, input.size(), mask_alloc, mr, stream);
 }
 
 std::unique_ptr<column> allocate_like(column_view const& input,
                                       size_type size,
                                       mask_allocation_policy mask_alloc,
-                                      rmm::mr::device_memory_resource* mr)
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::allocate_like(input, size, mask_alloc, mr);
+  return detail::allocate_like(input, size, mask_alloc, mr, stream);
 }
 
 }  // namespace cudf
@@ -135,6 +135,33 @@ struct copy_if_else_functor {
   }
 };
 
+// dispatch copy_if_else over the type of the inputs
+template <typename Left, typename Right, typename Filter>
+std::unique_ptr<column> copy_if_else(Left const& lhs,
+                                     Right const& rhs,
+                                     size_type size,
+                                     bool left_nullable,
+                                     bool right_nullable,
+                                     Filter filter,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.type() == rhs.type(), "Both inputs must be of the same type");
+
+  if (size == 0) { return cudf::make_empty_column(lhs.type()); }
+
+  return cudf::type_dispatcher(lhs.type(),
+                               copy_if_else_functor{},
+                               lhs,
+                               rhs,
+                               size,
+                               left_nullable,
+                               right_nullable,
+                               filter,
+                               mr,
+                               stream);
+}
+
 // wrap up boolean_mask into a filter lambda
 template <typename Left, typename Right>
 std::unique_ptr<column> copy_if_else(Left const& lhs,
@@ -158,30 +185,14 @@ std::unique_ptr<column> copy_if_else(Left const& lhs,
     auto filter = [bool_mask_device] __device__(cudf::size_type i) {
       return bool_mask_device.is_valid_nocheck(i) and bool_mask_device.element<bool>(i);
     };
-    return cudf::type_dispatcher(lhs.type(),
-                                 copy_if_else_functor{},
-                                 lhs,
-                                 rhs,
-                                 boolean_mask.size(),
-                                 left_nullable,
-                                 right_nullable,
-                                 filter,
-                                 mr,
-                                 stream);
+    return copy_if_else(
+      lhs, rhs, boolean_mask.size(), left_nullable, right_nullable, filter, mr, stream);
   } else {
     auto filter = [bool_mask_device] __device__(cudf::size_type i) {
       return bool_mask_device.element<bool>(i);
     };
-    return cudf::type_dispatcher(lhs.type(),
-                                 copy_if_else_functor{},
-                                 lhs,
-                                 rhs,
-                                 boolean_mask.size(),
-                                 left_nullable,
-                                 right_nullable,
-                                 filter,
-                                 mr,
-                                 stream);
+    return copy_if_else(
+      lhs, rhs, boolean_mask.size(), left_nullable, right_nullable, filter, mr, stream);
   }
 }
 
@@ -248,42 +259,125 @@ std::unique_ptr<column> copy_if_else(scalar const& lhs,
   return copy_if_else(lhs, rhs, !lhs.is_valid(), !rhs.is_valid(), boolean_mask, mr, stream);
 }
 
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* condition,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Both columns must be of the size");
+  return copy_if_else(*column_device_view::create(lhs),
+                      *column_device_view::create(rhs),
+                      lhs.size(),
+                      lhs.has_nulls(),
+                      rhs.has_nulls(),
+                      bitmask_filter{condition},
+                      mr,
+                      stream);
+}
+
+std::unique_ptr<column> copy_if_else(scalar const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* condition,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  return copy_if_else(lhs,
+                      *column_device_view::create(rhs),
+                      rhs.size(),
+                      !lhs.is_valid(),
+                      rhs.has_nulls(),
+                      bitmask_filter{condition},
+                      mr,
+                      stream);
+}
+
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     scalar const& rhs,
+                                     bitmask_type const* condition,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  return copy_if_else(*column_device_view::create(lhs),
+                      rhs,
+                      lhs.size(),
+                      lhs.has_nulls(),
+                      !rhs.is_valid(),
+                      bitmask_filter{condition},
+                      mr,
+                      stream);
+}
+
 };  // namespace detail
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
                                      column_view const& rhs,
                                      column_view const& boolean_mask,
-                                     rmm::mr::device_memory_resource* mr)
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
 }
 
 std::unique_ptr<column> copy_if_else(scalar const& lhs,
                                      column_view const& rhs,
                                      column_view const& boolean_mask,
-                                     rmm::mr::device_memory_resource* mr)
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
 }
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
                                      scalar const& rhs,
                                      column_view const& boolean_mask,
-                                     rmm::mr::device_memory_resource* mr)
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
 }
 
 std::unique_ptr<column> copy_if_else(scalar const& lhs,
                                      scalar const& rhs,
                                      column_view const& boolean_mask,
-                                     rmm::mr::device_memory_resource* mr)
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, mr, stream);
+}
+
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* condition,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, condition, mr, stream);
+}
+
+std::unique_ptr<column> copy_if_else(scalar const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* condition,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, condition, mr, stream);
+}
+
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     scalar const& rhs,
+                                     bitmask_type const* condition,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, mr);
+  return detail::copy_if_else(lhs, rhs, condition, mr, stream);
 }
 
 }  // namespace cudf
@@ -227,10 +227,12 @@ void copy_range_in_place(column_view const& source,
                          mutable_column_view& target,
                          size_type source_begin,
                          size_type source_end,
-                         size_type target_begin)
+                         size_type target_begin,
+                         cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_range_in_place(source, target, source_begin, source_end, target_begin, 0);
+  return detail::copy_range_in_place(
+    source, target, source_begin, source_end, target_begin, stream);
 }
 
 std::unique_ptr<column> copy_range(column_view const& source,
@@ -238,10 +240,11 @@ std::unique_ptr<column> copy_range(column_view const& source,
                                    size_type source_begin,
                                    size_type source_end,
                                    size_type target_begin,
-                                   rmm::mr::device_memory_resource* mr)
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_range(source, target, source_begin, source_end, target_begin, mr, 0);
+  return detail::copy_range(source, target, source_begin, source_end, target_begin, mr, stream);
 }
 
 }  // namespace cudf
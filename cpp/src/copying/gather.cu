@@ -95,7 +95,8 @@ std::unique_ptr<table> gather(table_view const& source_table,
 std::unique_ptr<table> gather(table_view const& source_table,
                               column_view const& gather_map,
                               bool check_bounds,
-                              rmm::mr::device_memory_resource* mr)
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::gather(
@@ -103,7 +104,8 @@ std::unique_ptr<table> gather(table_view const& source_table,
     gather_map,
     check_bounds ? detail::out_of_bounds_policy::FAIL : detail::out_of_bounds_policy::NULLIFY,
     detail::negative_index_policy::ALLOWED,
-    mr);
+    mr,
+    stream);
 }
 
 }  // namespace cudf
@@ -16,12 +16,15 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
 
+#include <rmm/device_scalar.hpp>
+
 namespace cudf {
 namespace detail {
 
@@ -84,17 +87,23 @@ struct get_element_functor {
     cudaStream_t stream                 = 0,
     rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource())
   {
-    auto dict_view = dictionary_column_view(input);
-    auto key_index_scalar =
-      get_element_functor{}.operator()<int32_t>(dict_view.indices(), index, stream);
+    auto dict_view  = dictionary_column_view(input);
+    auto device_col = column_device_view::create(input, stream);
 
-    size_type key_index =
-      static_cast<numeric_scalar<int32_t> const *>(key_index_scalar.get())->value(stream);
-    auto result = type_dispatcher(
+    // the indices may be any of the dictionary index types so read the key index as int32;
+    // the index of a null row may be out of range and is replaced with the first key
+    rmm::device_scalar<size_type> key_index_scalar(stream);
+    device_single_thread(
+      [d_key_index = key_index_scalar.data(), d_col = *device_col, index] __device__() mutable {
+        *d_key_index =
+          d_col.is_valid(index) ? static_cast<size_type>(d_col.element<dictionary32>(index)) : 0;
+      },
+      stream);
+    size_type key_index = key_index_scalar.value(stream);
+    auto result         = type_dispatcher(
       dict_view.keys().type(), get_element_functor{}, dict_view.keys(), key_index, stream, mr);
 
     auto result_validity = result->validity_data();
-    auto device_col      = column_device_view::create(input, stream);
 
     device_single_thread(
       [result_validity, d_col = *device_col, index] __device__() mutable {
@@ -131,9 +140,11 @@ std::unique_ptr<scalar> get_element(column_view const &input,
 
 std::unique_ptr<scalar> get_element(column_view const &input,
                                     size_type index,
-                                    rmm::mr::device_memory_resource *mr)
+                                    rmm::mr::device_memory_resource *mr,
+                                    cudaStream_t stream)
 {
-  return detail::get_element(input, index, 0, mr);
+  CUDF_FUNC_RANGE();
+  return detail::get_element(input, index, stream, mr);
 }
 
 }  // namespace cudf
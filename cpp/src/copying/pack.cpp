@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+// Marks the start of packed metadata ("cudf" in ASCII)
+constexpr uint32_t packed_metadata_magic = 0x66647563;
+
+/**
+ * @brief The start of packed metadata, followed by one `serialized_column` per column
+ */
+struct serialized_header {
+  uint32_t magic;
+  size_type num_columns;
+};
+
+/**
+ * @brief A `column_view` stored in packed metadata.
+ *
+ * Its data and null mask are stored as byte offsets into the packed device buffer, `-1` for
+ * null pointers. The children of a column follow it, depth first.
+ */
+struct serialized_column {
+  type_id id;
+  size_type size;
+  size_type null_count;
+  size_type offset;
+  int64_t data_offset;
+  int64_t null_mask_offset;
+  size_type num_children;
+};
+
+template <typename T>
+void write(std::vector<uint8_t>& buffer, T const& value)
+{
+  auto const bytes = reinterpret_cast<uint8_t const*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+// Metadata is a byte stream that may not be aligned
+template <typename T>
+T read(uint8_t const*& buffer)
+{
+  T value;
+  std::memcpy(&value, buffer, sizeof(T));
+  buffer += sizeof(T);
+  return value;
+}
+
+void serialize_column(column_view const& col, uint8_t const* base, std::vector<uint8_t>& buffer)
+{
+  auto const offset_of = [base](void const* ptr) {
+    return ptr == nullptr ? int64_t{-1}
+                          : static_cast<int64_t>(static_cast<uint8_t const*>(ptr) - base);
+  };
+  write(buffer,
+        serialized_column{col.type().id(),
+                          col.size(),
+                          col.null_count(),
+                          col.offset(),
+                          offset_of(col.head()),
+                          offset_of(col.null_mask()),
+                          col.num_children()});
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    serialize_column(col.child(i), base, buffer);
+  }
+}
+
+column_view deserialize_column(uint8_t const*& metadata, uint8_t const* gpu_data)
+{
+  auto const col = read<serialized_column>(metadata);
+  std::vector<column_view> children;
+  for (size_type i = 0; i < col.num_children; ++i) {
+    children.push_back(deserialize_column(metadata, gpu_data));
+  }
+  auto const pointer_at = [gpu_data](int64_t offset) {
+    return offset < 0 ? nullptr : gpu_data + offset;
+  };
+  return column_view{data_type{col.id},
+                     col.size,
+                     pointer_at(col.data_offset),
+                     reinterpret_cast<bitmask_type const*>(pointer_at(col.null_mask_offset)),
+                     col.null_count,
+                     col.offset,
+                     children};
+}
+
+}  // anonymous namespace
+
+std::vector<uint8_t> pack_metadata(table_view const& table, uint8_t const* base)
+{
+  std::vector<uint8_t> buffer;
+  write(buffer, serialized_header{packed_metadata_magic, table.num_columns()});
+  for (auto const& col : table) { serialize_column(col, base, buffer); }
+  return buffer;
+}
+
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream)
+{
+  // A table without columns is not split into any table
+  if (input.num_columns() == 0) {
+    return packed_columns{
+      std::make_unique<packed_columns::metadata>(pack_metadata(input, nullptr)),
+      std::make_unique<rmm::device_buffer>(0, stream, mr)};
+  }
+
+  auto contiguous = contiguous_split(input, {}, mr, stream);
+  auto& result    = contiguous.front();
+  auto const base = static_cast<uint8_t const*>(result.all_data->data());
+  auto metadata   = std::make_unique<packed_columns::metadata>(pack_metadata(result.table, base));
+  return packed_columns{std::move(metadata), std::move(result.all_data)};
+}
+
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
+{
+  CUDF_EXPECTS(metadata != nullptr, "Invalid packed metadata");
+  auto const header = read<serialized_header>(metadata);
+  CUDF_EXPECTS(header.magic == packed_metadata_magic, "Invalid packed metadata");
+
+  std::vector<column_view> columns;
+  for (size_type i = 0; i < header.num_columns; ++i) {
+    columns.push_back(deserialize_column(metadata, gpu_data));
+  }
+  return table_view{columns};
+}
+
+}  // namespace detail
+
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack(input, mr, stream);
+}
+
+table_view unpack(packed_columns const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unpack(input.metadata_->data(),
+                        static_cast<uint8_t const*>(input.gpu_data->data()));
+}
+
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unpack(metadata, gpu_data);
+}
+
+}  // namespace cudf
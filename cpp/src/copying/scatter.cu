@@ -23,6 +23,7 @@
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/lists/list_view.cuh>
 #include <cudf/stream_compaction.hpp>
@@ -354,15 +355,6 @@ std::unique_ptr<column> boolean_mask_scatter(column_view const& input,
   return std::make_unique<column>(std::move(output_table->get_column(0)));
 }
 
-std::unique_ptr<column> boolean_mask_scatter(scalar const& input,
-                                             column_view const& target,
-                                             column_view const& boolean_mask,
-                                             rmm::mr::device_memory_resource* mr,
-                                             cudaStream_t stream)
-{
-  return detail::copy_if_else(input, target, boolean_mask, mr, stream);
-}
-
 std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                                             table_view const& target,
                                             column_view const& boolean_mask,
@@ -423,14 +415,18 @@ std::unique_ptr<table> boolean_mask_scatter(
     "Type mismatch in input scalar and target column");
 
   if (target.num_rows() != 0) {
+    // The boolean mask is converted once to a bitmask shared by all the columns
+    auto const condition =
+      detail::bools_to_mask(boolean_mask, rmm::mr::get_default_resource(), stream);
+    auto const condition_data = static_cast<bitmask_type const*>(condition.first->data());
     std::vector<std::unique_ptr<column>> out_columns(target.num_columns());
     std::transform(input.begin(),
                    input.end(),
                    target.begin(),
                    out_columns.begin(),
-                   [&boolean_mask, mr, stream](auto const& scalar, auto const& target_column) {
-                     return boolean_mask_scatter(
-                       scalar.get(), target_column, boolean_mask, mr, stream);
+                   [condition_data, mr, stream](auto const& scalar, auto const& target_column) {
+                     return detail::copy_if_else(
+                       scalar.get(), target_column, condition_data, mr, stream);
                    });
 
     return std::make_unique<table>(std::move(out_columns));
@@ -445,39 +441,43 @@ std::unique_ptr<table> scatter(table_view const& source,
                                column_view const& scatter_map,
                                table_view const& target,
                                bool check_bounds,
-                               rmm::mr::device_memory_resource* mr)
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, scatter_map, target, check_bounds, mr);
+  return detail::scatter(source, scatter_map, target, check_bounds, mr, stream);
 }
 
 std::unique_ptr<table> scatter(std::vector<std::unique_ptr<scalar>> const& source,
                                column_view const& indices,
                                table_view const& target,
                                bool check_bounds,
-                               rmm::mr::device_memory_resource* mr)
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, indices, target, check_bounds, mr);
+  return detail::scatter(source, indices, target, check_bounds, mr, stream);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                                             table_view const& target,
                                             column_view const& boolean_mask,
-                                            rmm::mr::device_memory_resource* mr)
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::boolean_mask_scatter(input, target, boolean_mask, mr);
+  return detail::boolean_mask_scatter(input, target, boolean_mask, mr, stream);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<scalar>> const& input,
   table_view const& target,
   column_view const& boolean_mask,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::boolean_mask_scatter(input, target, boolean_mask, mr);
+  return detail::boolean_mask_scatter(input, target, boolean_mask, mr, stream);
 }
 
 }  // namespace cudf
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <io/utilities/pinned_host_pool.hpp>
+
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace cudf {
+namespace {
+/**
+ * @brief A table tracked by a `spill_manager`
+ */
+struct tracked_table {
+  std::unique_ptr<packed_columns::metadata> metadata;
+  std::unique_ptr<rmm::device_buffer> device_data;  ///< Null while spilled
+  std::vector<uint8_t> host_data;                   ///< Data of the table while spilled
+  size_t size;
+  int acquire_count;
+  uint64_t last_use;
+};
+
+}  // namespace
+
+class spill_manager::impl {
+ public:
+  explicit impl(rmm::mr::device_memory_resource* mr) : mr(mr), resource(this)
+  {
+    // A blocking stream, synchronized with the legacy default stream on which the tables are
+    // usually produced and consumed
+    CUDA_TRY(cudaStreamCreate(&stream));
+  }
+
+  ~impl() { cudaStreamDestroy(stream); }
+
+  spill_handle add(packed_columns&& input)
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto const size   = input.gpu_data->size();
+    auto const handle = next_handle++;
+    tables.emplace(handle,
+                   tracked_table{std::move(input.metadata_),
+                                 std::move(input.gpu_data),
+                                 {},
+                                 size,
+                                 0,
+                                 use_counter++});
+    on_device_bytes += size;
+    return handle;
+  }
+
+  table_view acquire(spill_handle handle)
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto& table = find(handle);
+    unspill_table(table);
+    ++table.acquire_count;
+    table.last_use = use_counter++;
+    return unpack(table.metadata->data(), static_cast<uint8_t const*>(table.device_data->data()));
+  }
+
+  void release(spill_handle handle)
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto& table = find(handle);
+    CUDF_EXPECTS(table.acquire_count > 0, "Table is not acquired");
+    --table.acquire_count;
+  }
+
+  packed_columns remove(spill_handle handle)
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto& table = find(handle);
+    CUDF_EXPECTS(table.acquire_count == 0, "Cannot remove an acquired table");
+    unspill_table(table);
+    on_device_bytes -= table.size;
+    packed_columns result{std::move(table.metadata), std::move(table.device_data)};
+    tables.erase(handle);
+    return result;
+  }
+
+  bool is_spilled(spill_handle handle) const
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto const it = tables.find(handle);
+    CUDF_EXPECTS(it != tables.end(), "Unknown spill handle");
+    return it->second.device_data == nullptr;
+  }
+
+  void spill(spill_handle handle)
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto& table = find(handle);
+    CUDF_EXPECTS(table.acquire_count == 0, "Cannot spill an acquired table");
+    spill_table(table);
+  }
+
+  size_t spill_least_recently_used(size_t bytes)
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    std::vector<tracked_table*> candidates;
+    for (auto& entry : tables) {
+      auto& table = entry.second;
+      if (table.device_data != nullptr and table.acquire_count == 0) {
+        candidates.push_back(&table);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](auto lhs, auto rhs) {
+      return lhs->last_use < rhs->last_use;
+    });
+
+    size_t freed = 0;
+    for (auto table : candidates) {
+      if (freed >= bytes) { break; }
+      freed += spill_table(*table);
+    }
+    return freed;
+  }
+
+  size_t device_bytes() const
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return on_device_bytes;
+  }
+
+  size_t host_bytes() const
+  {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return on_host_bytes;
+  }
+
+  rmm::mr::device_memory_resource* spilling_resource() { return &resource; }
+
+  rmm::mr::device_memory_resource* memory_resource() const { return mr; }
+
+ private:
+  /**
+   * @brief Device memory resource that spills tables and retries when an allocation fails.
+   */
+  class spilling_resource_adaptor final : public rmm::mr::device_memory_resource {
+   public:
+    explicit spilling_resource_adaptor(impl* manager) : manager(manager) {}
+
+    bool supports_streams() const noexcept override { return manager->mr->supports_streams(); }
+
+    bool supports_get_mem_info() const noexcept override
+    {
+      return manager->mr->supports_get_mem_info();
+    }
+
+   private:
+    void* do_allocate(size_t bytes, cudaStream_t stream) override
+    {
+      for (;;) {
+        try {
+          return manager->mr->allocate(bytes, stream);
+        } catch (std::bad_alloc const&) {
+          // Spill one table at a time to spill no more than needed
+          if (manager->spill_least_recently_used(1) == 0) { throw; }
+        }
+      }
+    }
+
+    void do_deallocate(void* p, size_t bytes, cudaStream_t stream) override
+    {
+      manager->mr->deallocate(p, bytes, stream);
+    }
+
+    std::pair<size_t, size_t> do_get_mem_info(cudaStream_t stream) const override
+    {
+      return manager->mr->get_mem_info(stream);
+    }
+
+    impl* manager;
+  };
+
+  tracked_table& find(spill_handle handle)
+  {
+    auto const it = tables.find(handle);
+    CUDF_EXPECTS(it != tables.end(), "Unknown spill handle");
+    return it->second;
+  }
+
+  /**
+   * @brief Copies the device data of a table to host memory and frees it.
+   *
+   * @return The amount of device memory freed
+   */
+  size_t spill_table(tracked_table& table)
+  {
+    if (table.device_data == nullptr) { return 0; }
+    table.host_data.resize(table.size);
+    io::detail::copy_device_to_host(
+      table.host_data.data(), table.device_data->data(), table.size, stream);
+    table.device_data.reset();
+    on_device_bytes -= table.size;
+    on_host_bytes += table.size;
+    return table.size;
+  }
+
+  /**
+   * @brief Copies the host data of a spilled table back to device memory.
+   */
+  void unspill_table(tracked_table& table)
+  {
+    if (table.device_data != nullptr) { return; }
+    table.device_data = std::make_unique<rmm::device_buffer>(
+      io::detail::upload_to_device(table.host_data.data(), table.size, stream, mr));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    table.host_data = std::vector<uint8_t>{};
+    on_host_bytes -= table.size;
+    on_device_bytes += table.size;
+  }
+
+  rmm::mr::device_memory_resource* mr;
+  spilling_resource_adaptor resource;
+  cudaStream_t stream;
+  mutable std::recursive_mutex mutex;
+  std::map<spill_handle, tracked_table> tables;
+  spill_handle next_handle = 0;
+  uint64_t use_counter     = 0;
+  size_t on_device_bytes   = 0;
+  size_t on_host_bytes     = 0;
+};
+
+spill_manager::spill_manager(rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(mr))
+{
+}
+
+spill_manager::~spill_manager() = default;
+
+spill_handle spill_manager::add(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->add(detail::pack(input, _impl->memory_resource()));
+}
+
+spill_handle spill_manager::add(packed_columns&& input) { return _impl->add(std::move(input)); }
+
+table_view spill_manager::acquire(spill_handle handle)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->acquire(handle);
+}
+
+void spill_manager::release(spill_handle handle) { _impl->release(handle); }
+
+packed_columns spill_manager::remove(spill_handle handle)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->remove(handle);
+}
+
+bool spill_manager::is_spilled(spill_handle handle) const { return _impl->is_spilled(handle); }
+
+void spill_manager::spill(spill_handle handle)
+{
+  CUDF_FUNC_RANGE();
+  _impl->spill(handle);
+}
+
+size_t spill_manager::spill_least_recently_used(size_t bytes)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->spill_least_recently_used(bytes);
+}
+
+size_t spill_manager::device_bytes() const { return _impl->device_bytes(); }
+
+size_t spill_manager::host_bytes() const { return _impl->host_bytes(); }
+
+rmm::mr::device_memory_resource* spill_manager::spilling_resource()
+{
+  return _impl->spilling_resource();
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,11 +20,17 @@
 #include <cudf/datetime.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
@@ -180,13 +186,193 @@ std::unique_ptr<column> apply_datetime_op(column_view const& column,
   return output;
 }
 
+// Extract several components of every timestamp, computing its calendar date only once
+struct extract_components_launcher {
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    column_view const&, datetime_component const*, int16_t* const*, size_type, cudaStream_t) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& input,
+    datetime_component const* d_components,
+    int16_t* const* d_outputs,
+    size_type num_components,
+    cudaStream_t stream) const
+  {
+    auto const d_input = input.begin<Timestamp>();
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [d_input, d_components, d_outputs, num_components] __device__(size_type row) {
+        using namespace simt::std::chrono;
+
+        auto const ts               = d_input[row];
+        auto const days_since_epoch = floor<days>(ts);
+
+        auto time_since_midnight = ts - days_since_epoch;
+
+        if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+        auto const hrs_  = duration_cast<hours>(time_since_midnight);
+        auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+        auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+        auto const ymd   = year_month_day(days_since_epoch);
+
+        for (size_type i = 0; i < num_components; ++i) {
+          int16_t value = 0;
+          switch (d_components[i]) {
+            case datetime_component::YEAR: value = static_cast<int>(ymd.year()); break;
+            case datetime_component::MONTH: value = static_cast<unsigned>(ymd.month()); break;
+            case datetime_component::DAY: value = static_cast<unsigned>(ymd.day()); break;
+            case datetime_component::WEEKDAY:
+              value = weekday(days_since_epoch).iso_encoding();
+              break;
+            case datetime_component::HOUR: value = hrs_.count(); break;
+            case datetime_component::MINUTE: value = mins_.count(); break;
+            case datetime_component::SECOND: value = secs_.count(); break;
+            default: break;
+          }
+          d_outputs[i][row] = value;
+        }
+      });
+  }
+};
+
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(
+    std::none_of(components.begin(),
+                 components.end(),
+                 [](auto component) { return component == datetime_component::INVALID; }),
+    "Invalid datetime component");
+
+  auto const output_col_type = data_type{INT16};
+  std::vector<std::unique_ptr<column>> outputs;
+
+  // Return empty columns if source column is empty
+  if (column.size() == 0) {
+    for (size_t i = 0; i < components.size(); ++i) {
+      outputs.push_back(make_empty_column(output_col_type));
+    }
+    return std::make_unique<table>(std::move(outputs));
+  }
+
+  std::vector<int16_t*> output_ptrs;
+  for (size_t i = 0; i < components.size(); ++i) {
+    outputs.push_back(make_fixed_width_column(output_col_type,
+                                              column.size(),
+                                              copy_bitmask(column, stream, mr),
+                                              column.null_count(),
+                                              stream,
+                                              mr));
+    output_ptrs.push_back(outputs.back()->mutable_view().data<int16_t>());
+  }
+
+  if (not components.empty()) {
+    rmm::device_vector<datetime_component> d_components(components);
+    rmm::device_vector<int16_t*> d_outputs(output_ptrs);
+    type_dispatcher(column.type(),
+                    extract_components_launcher{},
+                    column,
+                    d_components.data().get(),
+                    d_outputs.data().get(),
+                    static_cast<size_type>(components.size()),
+                    stream);
+  }
+  return std::make_unique<table>(std::move(outputs));
+}
+
+// Round a timestamp down to the start of its year, month, day, hour, minute or second
+struct truncate_timestamp_functor {
+  datetime_component component;
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const
+  {
+    using namespace simt::std::chrono;
+
+    switch (component) {
+      case datetime_component::YEAR:
+      case datetime_component::MONTH: {
+        auto const date  = year_month_day(floor<days>(ts));
+        auto const month = component == datetime_component::YEAR ? January : date.month();
+        return Timestamp{sys_days(year_month_day(date.year(), month, day{1}))};
+      }
+      case datetime_component::DAY: return Timestamp{floor<days>(ts)};
+      case datetime_component::HOUR: return Timestamp{floor<hours>(ts)};
+      case datetime_component::MINUTE: return Timestamp{floor<minutes>(ts)};
+      case datetime_component::SECOND: return Timestamp{floor<seconds>(ts)};
+      default: return ts;
+    }
+  }
+};
+
+struct truncate_timestamps_launcher {
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, std::unique_ptr<column>>
+  operator()(column_view const&,
+             datetime_component,
+             cudaStream_t,
+             rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("Cannot truncate non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, std::unique_ptr<column>>
+  operator()(column_view const& input,
+             datetime_component component,
+             cudaStream_t stream,
+             rmm::mr::device_memory_resource* mr) const
+  {
+    auto output = make_fixed_width_column(input.type(),
+                                          input.size(),
+                                          copy_bitmask(input, stream, mr),
+                                          input.null_count(),
+                                          stream,
+                                          mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.begin<Timestamp>(),
+                      input.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      truncate_timestamp_functor{component});
+    return output;
+  }
+};
+
+std::unique_ptr<column> truncate_timestamps(column_view const& column,
+                                            datetime_component component,
+                                            cudaStream_t stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(component != datetime_component::INVALID && component != datetime_component::WEEKDAY,
+               "Timestamps can only be truncated to a year, month, day, hour, minute or second");
+
+  // Return an empty column if source column is empty
+  if (column.size() == 0) return make_empty_column(column.type());
+
+  return type_dispatcher(
+    column.type(), truncate_timestamps_launcher{}, column, component, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> extract_year(column_view const& column, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -196,7 +382,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
   CUDF_FUNC_RANGE();
 
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -204,7 +390,7 @@ std::unique_ptr<column> extract_day(column_view const& column, rmm::mr::device_m
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -213,7 +399,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -221,7 +407,7 @@ std::unique_ptr<column> extract_hour(column_view const& column, rmm::mr::device_
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -230,7 +416,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -239,7 +425,7 @@ std::unique_ptr<column> extract_second(column_view const& column,
 {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -257,5 +443,22 @@ std::unique_ptr<column> day_of_year(column_view const& column, rmm::mr::device_m
   return detail::apply_datetime_op<detail::extract_day_num_of_year, cudf::INT16>(column, 0, mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, 0, mr);
+}
+
+std::unique_ptr<column> truncate_timestamps(column_view const& column,
+                                            datetime_component component,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::truncate_timestamps(column, component, 0, mr);
+}
+
 }  // namespace datetime
 }  // namespace cudf
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <io/orc/timezone.cuh>
+#include <io/orc/timezone.h>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the UTC time of the local time `local` in the timezone `tz`.
+ *
+ * The offset is looked up by UTC time, so it is first guessed from `local` itself and then
+ * looked up again at the guessed UTC time. Local times skipped or repeated by a transition
+ * resolve to one of the offsets around it.
+ */
+__device__ int64_t local_to_utc(io::timezone_table_view const& tz, int64_t local)
+{
+  auto const guess = local - io::GetGmtOffset(tz, local);
+  return local - io::GetGmtOffset(tz, guess);
+}
+
+// Convert the wall clock time of a timestamp from one timezone to another
+struct convert_timezone_functor {
+  io::timezone_table_view from_tz;
+  io::timezone_table_view to_tz;
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const
+  {
+    using namespace simt::std::chrono;
+
+    auto const secs      = floor<seconds>(ts);
+    auto const subsecond = ts - secs;
+    auto const utc       = local_to_utc(from_tz, secs.time_since_epoch().count());
+    auto const local     = utc + io::GetGmtOffset(to_tz, utc);
+    auto const converted = decltype(secs){seconds(local)} + subsecond;
+    return Timestamp{floor<typename Timestamp::duration>(converted)};
+  }
+};
+
+struct convert_timezone_launcher {
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, std::unique_ptr<column>>
+  operator()(column_view const&,
+             convert_timezone_functor,
+             cudaStream_t,
+             rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("Cannot convert the timezone of a non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, std::unique_ptr<column>>
+  operator()(column_view const& input,
+             convert_timezone_functor convert,
+             cudaStream_t stream,
+             rmm::mr::device_memory_resource* mr) const
+  {
+    auto output = make_fixed_width_column(input.type(),
+                                          input.size(),
+                                          copy_bitmask(input, stream, mr),
+                                          input.null_count(),
+                                          stream,
+                                          mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.begin<Timestamp>(),
+                      input.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      convert);
+    return output;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string const& from_tz,
+                                         std::string const& to_tz,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(timestamps.type()), "Column type should be timestamp");
+
+  std::vector<int64_t> from_table;
+  std::vector<int64_t> to_table;
+  CUDF_EXPECTS(io::BuildTimezoneTransitionTable(from_table, from_tz),
+               "Cannot setup timezone LUT for the source timezone");
+  CUDF_EXPECTS(io::BuildTimezoneTransitionTable(to_table, to_tz),
+               "Cannot setup timezone LUT for the target timezone");
+
+  // Return an empty column if source column is empty
+  if (timestamps.size() == 0) return make_empty_column(timestamps.type());
+
+  rmm::device_vector<int64_t> d_from_table = from_table;
+  rmm::device_vector<int64_t> d_to_table   = to_table;
+  convert_timezone_functor const convert{
+    io::timezone_table_view{d_from_table.data().get(), d_from_table.size()},
+    io::timezone_table_view{d_to_table.data().get(), d_to_table.size()}};
+  return type_dispatcher(
+    timestamps.type(), convert_timezone_launcher{}, timestamps, convert, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string const& from_tz,
+                                         std::string const& to_tz,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(timestamps, from_tz, to_tz, 0, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
@@ -16,8 +16,11 @@
 
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/update_keys.hpp>
 #include <cudf/stream_compaction.hpp>
@@ -71,17 +74,22 @@ std::unique_ptr<column> add_keys(
     table_view{{old_keys}},
     std::vector<order>{order::ASCENDING},
     std::vector<null_order>{null_order::AFTER},  // should be no nulls here
-    mr,
+    rmm::mr::get_default_resource(),
     stream);
   // now create the indices column -- map old values to the new ones
   // gather([4,0,3,1,2,2,2,4,0],[0,1,2,3,5]) = [5,0,3,1,2,2,2,5,0]
-  column_view indices_view(data_type{INT32},
+  // the map is cast first so the gather writes the narrowest indices type for the new keys
+  auto const typed_map = cudf::detail::cast(map_indices->view(),
+                                            get_indices_type_for_size(keys_column->size()),
+                                            rmm::mr::get_default_resource(),
+                                            stream);
+  column_view indices_view(dictionary_column.indices().type(),
                            dictionary_column.size(),
-                           dictionary_column.indices().data<int32_t>(),
+                           dictionary_column.indices().head(),
                            nullptr,
                            0,
                            dictionary_column.offset());
-  auto table_indices = cudf::detail::gather(table_view{{map_indices->view()}},
+  auto table_indices = cudf::detail::gather(table_view{{typed_map->view()}},
                                             indices_view,
                                             cudf::detail::out_of_bounds_policy::IGNORE,
                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
@@ -91,7 +99,7 @@ std::unique_ptr<column> add_keys(
   // the result may contain nulls if the input contains nulls and the corresponding index is
   // therefore invalid
   auto contents       = table_indices.front()->release();
-  auto indices_column = std::make_unique<column>(data_type{INT32},
+  auto indices_column = std::make_unique<column>(typed_map->type(),
                                                  dictionary_column.size(),
                                                  std::move(*(contents.data.release())),
                                                  rmm::device_buffer{0, stream, mr},
@@ -110,6 +118,7 @@ std::unique_ptr<column> add_keys(dictionary_column_view const& dictionary_column
                                  column_view const& keys,
                                  rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::add_keys(dictionary_column, keys, mr);
 }
 
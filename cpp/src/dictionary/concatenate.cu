@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/dictionary/detail/concatenate.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+namespace {
+/**
+ * @brief Maps the index of each row of a dictionary to the position of its key in the
+ * combined keys.
+ *
+ * Indices of null rows may be out of range. They are mapped to 0 since the output
+ * null mask hides them.
+ */
+template <typename IndexType>
+struct remap_indices_fn {
+  column_device_view const d_dictionary;
+  int32_t const* d_map;  // position of each old key in the combined keys
+  size_type const keys_size;
+
+  __device__ IndexType operator()(size_type idx) const
+  {
+    auto const index = static_cast<int32_t>(d_dictionary.element<dictionary32>(idx));
+    return static_cast<IndexType>((index >= 0 && index < keys_size) ? d_map[index] : 0);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  // empty columns contribute no keys and no rows
+  std::vector<dictionary_column_view> dictionaries;
+  for (auto const& col : columns) {
+    if (!col.is_empty()) { dictionaries.emplace_back(col); }
+  }
+  CUDF_EXPECTS(!dictionaries.empty(), "Unexpected empty list of columns to concatenate.");
+  auto const keys_type = dictionaries.front().keys().type();
+  CUDF_EXPECTS(std::all_of(dictionaries.begin(),
+                           dictionaries.end(),
+                           [keys_type](auto const& d) { return d.keys().type() == keys_type; }),
+               "Keys must be the same type");
+
+  // build the sorted union of all the keys
+  // [a,c,d] + [b,c] = [a,b,c,d]
+  std::vector<column_view> keys_views;
+  std::transform(dictionaries.begin(),
+                 dictionaries.end(),
+                 std::back_inserter(keys_views),
+                 [](auto const& d) { return d.keys(); });
+  auto combined_keys =
+    cudf::detail::concatenate(keys_views, rmm::mr::get_default_resource(), stream);
+  auto table_keys = cudf::detail::drop_duplicates(table_view{{combined_keys->view()}},
+                                                  std::vector<size_type>{0},
+                                                  duplicate_keep_option::KEEP_FIRST,
+                                                  null_equality::EQUAL,
+                                                  mr,
+                                                  stream)
+                      ->release();
+  std::unique_ptr<column> keys_column(std::move(table_keys.front()));
+
+  // remap the indices of each input directly into the output indices column
+  // in the narrowest type for the new keys
+  std::vector<column_view> indices_views;
+  std::transform(dictionaries.begin(),
+                 dictionaries.end(),
+                 std::back_inserter(indices_views),
+                 [](auto const& d) { return d.get_indices_annotated(); });
+  size_type const output_size =
+    std::accumulate(indices_views.begin(), indices_views.end(), 0, [](auto count, auto const& v) {
+      return count + v.size();
+    });
+  auto const indices_type = get_indices_type_for_size(keys_column->size());
+  auto indices_column =
+    make_numeric_column(indices_type, output_size, mask_state::UNALLOCATED, stream, mr);
+  auto output_view = indices_column->mutable_view();
+  size_type offset = 0;
+  for (auto const& dictionary : dictionaries) {
+    auto const old_keys = dictionary.keys();
+    // lower_bound([a,b,c,d],[b,c]) = [1,2]
+    auto map_indices = cudf::detail::lower_bound(table_view{{keys_column->view()}},
+                                                 table_view{{old_keys}},
+                                                 std::vector<order>{order::ASCENDING},
+                                                 std::vector<null_order>{null_order::AFTER},
+                                                 rmm::mr::get_default_resource(),
+                                                 stream);
+    auto const d_map     = map_indices->view().data<int32_t>();
+    auto const keys_size = old_keys.size();
+    auto const d_input   = column_device_view::create(dictionary.parent(), stream);
+    auto remap           = [&](auto d_output) {
+      using IndexType = std::remove_pointer_t<decltype(d_output)>;
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(dictionary.size()),
+                        d_output + offset,
+                        remap_indices_fn<IndexType>{*d_input, d_map, keys_size});
+    };
+    switch (indices_type.id()) {
+      case UINT8: remap(output_view.data<uint8_t>()); break;
+      case UINT16: remap(output_view.data<uint16_t>()); break;
+      default: remap(output_view.data<int32_t>()); break;
+    }
+    offset += dictionary.size();
+  }
+
+  // the nulls are not changed, only moved into a single mask
+  bool const has_nulls = std::any_of(
+    indices_views.begin(), indices_views.end(), [](auto const& v) { return v.has_nulls(); });
+  rmm::device_buffer null_mask{0, stream, mr};
+  size_type null_count = 0;
+  if (has_nulls) {
+    null_mask = create_null_mask(output_size, mask_state::UNINITIALIZED, stream, mr);
+    cudf::detail::concatenate_masks(
+      indices_views, static_cast<bitmask_type*>(null_mask.data()), stream);
+    null_count = std::accumulate(
+      indices_views.begin(), indices_views.end(), 0, [](auto count, auto const& v) {
+        return count + v.null_count();
+      });
+  }
+
+  return make_dictionary_column(
+    std::move(keys_column), std::move(indices_column), std::move(null_mask), null_count);
+}
+
+}  // namespace detail
+}  // namespace dictionary
+}  // namespace cudf
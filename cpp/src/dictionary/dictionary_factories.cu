@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 
 namespace cudf {
@@ -26,12 +27,13 @@ std::unique_ptr<column> make_dictionary_column(column_view const& keys_column,
 {
   CUDF_EXPECTS(!keys_column.has_nulls(), "keys column must not have nulls");
   if (keys_column.size() == 0) return make_empty_column(data_type{DICTIONARY32});
-  CUDF_EXPECTS(indices_column.type().id() == cudf::type_id::INT32, "indices column must be INT32");
+  CUDF_EXPECTS(dictionary::detail::is_index_type(indices_column.type()),
+               "indices column must be UINT8, UINT16 or INT32");
 
   auto keys_copy = std::make_unique<column>(keys_column, stream, mr);
   column_view indices_view{indices_column.type(),
                            indices_column.size(),
-                           indices_column.data<int32_t>(),
+                           indices_column.head(),
                            nullptr,
                            0,
                            indices_column.offset()};
@@ -58,7 +60,8 @@ std::unique_ptr<column> make_dictionary_column(std::unique_ptr<column> keys_colu
 {
   CUDF_EXPECTS(!keys_column->has_nulls(), "keys column must not have nulls");
   CUDF_EXPECTS(!indices_column->has_nulls(), "indices column must not have nulls");
-  CUDF_EXPECTS(indices_column->type().id() == cudf::type_id::INT32, "indices must be type INT32");
+  CUDF_EXPECTS(dictionary::detail::is_index_type(indices_column->type()),
+               "indices must be type UINT8, UINT16 or INT32");
 
   auto count = indices_column->size();
   std::vector<std::unique_ptr<column>> children;
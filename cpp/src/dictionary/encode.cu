@@ -15,64 +15,167 @@
  */
 
 #include <cudf/column/column.hpp>
-#include <cudf/copying.hpp>
-#include <cudf/detail/search.hpp>
-#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
-#include <cudf/stream_compaction.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <hash/concurrent_unordered_row_set.cuh>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+#include <limits>
 
 namespace cudf {
 namespace dictionary {
 namespace detail {
+namespace {
+/**
+ * @brief Type-dispatch functor for writing the index of each row in the indices type.
+ *
+ * Valid rows take the position of their value in the keys. Null rows are placed after
+ * all the keys.
+ */
+struct dispatch_write_indices {
+  template <typename IndexType, std::enable_if_t<is_index_type<IndexType>()>* = nullptr>
+  void operator()(rmm::device_vector<size_type> const& set_rows,
+                  rmm::device_vector<size_type> const& key_positions,
+                  size_type keys_size,
+                  mutable_column_view indices,
+                  cudaStream_t stream)
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      set_rows.begin(),
+                      set_rows.end(),
+                      indices.begin<IndexType>(),
+                      [d_key_positions = key_positions.data().get(), keys_size] __device__(
+                        size_type set_row) {
+                        return static_cast<IndexType>(set_row < 0 ? keys_size
+                                                                  : d_key_positions[set_row]);
+                      });
+  }
+
+  template <typename IndexType, std::enable_if_t<!is_index_type<IndexType>()>* = nullptr>
+  void operator()(rmm::device_vector<size_type> const&,
+                  rmm::device_vector<size_type> const&,
+                  size_type,
+                  mutable_column_view,
+                  cudaStream_t)
+  {
+    CUDF_FAIL("indices must be type UINT8, UINT16 or INT32");
+  }
+};
+
+}  // namespace
+
+data_type get_indices_type_for_size(size_type keys_size)
+{
+  if (keys_size <= std::numeric_limits<uint8_t>::max() + 1) return data_type{UINT8};
+  if (keys_size <= std::numeric_limits<uint16_t>::max() + 1) return data_type{UINT16};
+  return data_type{INT32};
+}
+
 /**
  * @brief Create a new dictionary column from a column_view.
  *
+ * The distinct values are found with a hash set of the input rows in a single pass.
+ * Only the distinct values are then sorted to create the keys.
  */
 std::unique_ptr<column> encode(column_view const& input_column,
                                data_type indices_type,
                                rmm::mr::device_memory_resource* mr,
                                cudaStream_t stream)
 {
-  CUDF_EXPECTS(indices_type.id() == INT32, "only INT32 type for indices");
+  CUDF_EXPECTS(indices_type.id() == EMPTY || is_index_type(indices_type),
+               "indices must be type UINT8, UINT16 or INT32");
   CUDF_EXPECTS(input_column.type().id() != DICTIONARY32,
                "cannot encode a dictionary from a dictionary");
 
-  // side effects of this function were are now dependent on:
-  // - resulting column elements are sorted ascending
-  // - nulls are sorted to the beginning
-  auto table_keys = cudf::detail::drop_duplicates(table_view{{input_column}},
-                                                  std::vector<size_type>{0},
-                                                  duplicate_keep_option::KEEP_FIRST,
-                                                  null_equality::EQUAL,
-                                                  mr,
-                                                  stream)
-                      ->release();  // true == nulls are equal
+  auto const num_rows = input_column.size();
+  auto execpol        = rmm::exec_policy(stream);
+  auto const input    = table_view{{input_column}};
+  auto d_input        = table_device_view::create(input, stream);
+
+  // map each valid row to the row in the set with the same value; null rows are not inserted
+  using hasher_type   = row_hasher<default_hash, false>;
+  using equality_type = row_equality_comparator<false>;
+  cudf::detail::concurrent_unordered_row_set<hasher_type, equality_type> distinct_rows(
+    num_rows, hasher_type{*d_input}, equality_type{*d_input, *d_input}, stream);
+  rmm::device_vector<size_type> set_rows(num_rows);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    set_rows.begin(),
+                    [set = distinct_rows.view(), d_column = d_input->column(0)] __device__(
+                      size_type row) {
+                      return d_column.is_valid(row) ? set.insert_or_find(row) : -1;
+                    });
+
+  // gather the distinct values and sort them into the keys
+  rmm::device_vector<size_type> key_rows(num_rows);
+  auto const d_set_rows = set_rows.data().get();
+  auto const key_rows_end =
+    thrust::copy_if(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    key_rows.begin(),
+                    [d_set_rows] __device__(size_type row) { return d_set_rows[row] == row; });
+  auto const keys_size = static_cast<size_type>(thrust::distance(key_rows.begin(), key_rows_end));
+  auto const unsorted_keys = cudf::detail::gather(
+    input,
+    column_view(data_type{INT32}, keys_size, key_rows.data().get()),
+    cudf::detail::out_of_bounds_policy::IGNORE,
+    cudf::detail::negative_index_policy::NOT_ALLOWED,
+    rmm::mr::get_default_resource(),
+    stream);
+  auto const keys_order = cudf::detail::sorted_order(
+    unsorted_keys->view(), {}, {}, rmm::mr::get_default_resource(), stream);
+  auto table_keys = cudf::detail::gather(unsorted_keys->view(),
+                                         keys_order->view(),
+                                         cudf::detail::out_of_bounds_policy::IGNORE,
+                                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                         mr,
+                                         stream)
+                      ->release();
   std::unique_ptr<column> keys_column(std::move(table_keys.front()));
+  keys_column->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);  // remove the null-mask
 
-  if (input_column.has_nulls()) {
-    // the single null entry should be at the beginning -- side effect from drop_duplicates
-    // copy the column without the null entry
-    keys_column = std::make_unique<column>(
-      slice(keys_column->view(), std::vector<size_type>{1, keys_column->size()}).front(),
-      stream,
-      mr);
-    keys_column->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);  // remove the null-mask
+  // the index of each set row is the position of its value in the keys
+  rmm::device_vector<size_type> key_positions(num_rows);
+  auto const d_keys_order = keys_order->view().data<size_type>();
+  thrust::scatter(execpol->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(keys_size),
+                  thrust::make_permutation_iterator(key_rows.begin(), d_keys_order),
+                  key_positions.begin());
+  // null rows are indexed one past the keys, so that index must also fit
+  auto const narrowest_type =
+    get_indices_type_for_size(input_column.has_nulls() ? keys_size + 1 : keys_size);
+  if (indices_type.id() == EMPTY) {
+    indices_type = narrowest_type;
+  } else {
+    CUDF_EXPECTS(size_of(narrowest_type) <= size_of(indices_type),
+                 "too many keys for the indices type");
   }
-
-  // this returns a column with no null entries
-  // - it appears to ignore the null entries in the input and tries to place the value regardless
-  auto indices_column = cudf::detail::lower_bound(table_view{{keys_column->view()}},
-                                                  table_view{{input_column}},
-                                                  std::vector<order>{order::ASCENDING},
-                                                  std::vector<null_order>{null_order::AFTER},
-                                                  mr,
-                                                  stream);
-  // we should probably copy/cast to INT32 type if different
-  CUDF_EXPECTS(indices_column->type() == indices_type, "expecting INT32 indices type");
+  auto indices_column =
+    make_numeric_column(indices_type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  type_dispatcher(indices_type,
+                  dispatch_write_indices{},
+                  set_rows,
+                  key_positions,
+                  keys_size,
+                  indices_column->mutable_view(),
+                  stream);
 
   // create column with keys_column and indices_column
   return make_dictionary_column(std::move(keys_column),
@@ -89,6 +192,7 @@ std::unique_ptr<column> encode(column_view const& input_column,
                                data_type indices_type,
                                rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::encode(input_column, indices_type, mr);
 }
 
@@ -14,10 +14,14 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/update_keys.hpp>
@@ -77,37 +81,47 @@ std::unique_ptr<column> remove_keys_fn(
     return std::move(table_keys.front());
   }();  // frees up the temporary table_keys objects
 
-  column_view indices_view(data_type{INT32},
+  // compute new nulls -- merge the existing nulls with the removed keys (map value<0)
+  auto d_dictionary  = column_device_view::create(dictionary_column.parent(), stream);
+  auto d_map_indices = map_indices.data().get();
+  auto new_nulls     = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(dictionary_column.size()),
+    [d_dictionary = *d_dictionary, d_map_indices] __device__(size_type idx) {
+      if (d_dictionary.is_null(idx)) return false;
+      return d_map_indices[static_cast<int32_t>(d_dictionary.element<dictionary32>(idx))] >= 0;
+    },
+    stream,
+    mr);
+
+  // create new indices column in the narrowest type for the remaining keys
+  // Example: gather([4,0,3,1,2,2,2,4,0],[0,-1,1,-1,2]) => [2,0,-1,-1,1,1,1,2,0]
+  column_view map_indices_view(data_type{INT32}, keys_view.size(), map_indices.data().get());
+  auto const typed_map = cudf::detail::cast(map_indices_view,
+                                            get_indices_type_for_size(keys_column->size()),
+                                            rmm::mr::get_default_resource(),
+                                            stream);
+  column_view indices_view(dictionary_column.indices().type(),
                            dictionary_column.size(),
-                           dictionary_column.indices().data<int32_t>(),
+                           dictionary_column.indices().head(),
                            nullptr,
                            0,
                            dictionary_column.offset());
-  // create new indices column
-  // Example: gather([4,0,3,1,2,2,2,4,0],[0,-1,1,-1,2]) => [2,0,-1,-1,1,1,1,2,0]
-  column_view map_indices_view(data_type{INT32}, keys_view.size(), map_indices.data().get());
-  auto table_indices = cudf::detail::gather(table_view{{map_indices_view}},
+  auto table_indices = cudf::detail::gather(table_view{{typed_map->view()}},
                                             indices_view,
-                                            cudf::detail::out_of_bounds_policy::NULLIFY,
+                                            cudf::detail::out_of_bounds_policy::IGNORE,
                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
                                             mr,
                                             stream)
                          ->release();
-  std::unique_ptr<column> indices_column(std::move(table_indices.front()));
-
-  // compute new nulls -- merge the existing nulls with the newly created ones (value<0)
-  auto d_null_mask = dictionary_column.null_mask();
-  auto d_indices   = indices_column->view().data<int32_t>();
-  auto new_nulls   = cudf::detail::valid_if(
-    thrust::make_counting_iterator<size_type>(dictionary_column.offset()),
-    thrust::make_counting_iterator<size_type>(dictionary_column.offset() +
-                                              dictionary_column.size()),
-    [d_null_mask, d_indices] __device__(size_type idx) {
-      if (d_null_mask && !bit_is_set(d_null_mask, idx)) return false;
-      return (d_indices[idx] >= 0);  // new nulls have negative values
-    },
-    stream,
-    mr);
+  // the rows of removed keys are nulls now so their wrapped index values are never read
+  auto contents       = table_indices.front()->release();
+  auto indices_column = std::make_unique<column>(typed_map->type(),
+                                                 dictionary_column.size(),
+                                                 std::move(*(contents.data.release())),
+                                                 rmm::device_buffer{0, stream, mr},
+                                                 0);
+
   rmm::device_buffer new_null_mask =
     (new_nulls.second > 0) ? std::move(new_nulls.first) : rmm::device_buffer{0, stream, mr};
 
@@ -152,15 +166,18 @@ std::unique_ptr<column> remove_unused_keys(
 
   // wrap the indices for comparison with column_views
   column_view keys_positions_view(data_type{INT32}, keys.size(), keys_positions.data().get());
-  column_view indices_view(data_type{INT32},
+  column_view indices_view(indices.type(),
                            dictionary_column.size(),
-                           indices.data<int32_t>(),
+                           indices.head(),
                            dictionary_column.null_mask(),
                            dictionary_column.null_count(),
                            dictionary_column.offset());
 
   // search the indices values with key indices to look for any holes
-  auto const matches = cudf::detail::contains(keys_positions_view, indices_view, mr, stream);
+  auto const typed_positions = cudf::detail::cast(
+    keys_positions_view, indices.type(), rmm::mr::get_default_resource(), stream);
+  auto const matches =
+    cudf::detail::contains(typed_positions->view(), indices_view, mr, stream);
   auto d_matches     = matches->view().data<bool>();
 
   // call common utility method to keep the keys that match
@@ -176,12 +193,14 @@ std::unique_ptr<column> remove_keys(dictionary_column_view const& dictionary_col
                                     column_view const& keys_to_remove,
                                     rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::remove_keys(dictionary_column, keys_to_remove, mr);
 }
 
 std::unique_ptr<column> remove_unused_keys(dictionary_column_view const& dictionary_column,
                                            rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::remove_unused_keys(dictionary_column, mr);
 }
 
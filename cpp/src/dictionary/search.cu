@@ -15,6 +15,8 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/dictionary/search.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -87,6 +89,39 @@ std::unique_ptr<numeric_scalar<int32_t>> get_index(dictionary_column_view const&
   return type_dispatcher(dictionary.keys().type(), find_index_fn(), dictionary, key, mr, stream);
 }
 
+/**
+ * @brief Converts a key index into a scalar of the dictionary's indices type.
+ */
+struct typed_index_fn {
+  template <typename IndexType, std::enable_if_t<is_index_type<IndexType>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(numeric_scalar<int32_t> const& index,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const
+  {
+    return std::make_unique<numeric_scalar<IndexType>>(
+      static_cast<IndexType>(index.value(stream)), index.is_valid(stream), stream, mr);
+  }
+
+  template <typename IndexType, std::enable_if_t<!is_index_type<IndexType>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(numeric_scalar<int32_t> const&,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t) const
+  {
+    CUDF_FAIL("indices must be type UINT8, UINT16 or INT32");
+  }
+};
+
+std::unique_ptr<scalar> get_typed_index(dictionary_column_view const& dictionary,
+                                        scalar const& key,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  auto const index = get_index(dictionary, key, rmm::mr::get_default_resource(), stream);
+  auto const indices_type =
+    dictionary.size() > 0 ? dictionary.indices().type() : data_type{INT32};
+  return type_dispatcher(indices_type, typed_index_fn{}, *index, mr, stream);
+}
+
 }  // namespace detail
 
 // external API
@@ -95,6 +130,7 @@ std::unique_ptr<numeric_scalar<int32_t>> get_index(dictionary_column_view const&
                                                    scalar const& key,
                                                    rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::get_index(dictionary, key, mr);
 }
 
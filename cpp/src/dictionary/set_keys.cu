@@ -16,9 +16,11 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/stream_compaction.hpp>
@@ -61,17 +63,26 @@ struct dispatch_compute_indices {
       thrust::make_counting_iterator<size_type>(0),
       [d_new_keys] __device__(size_type idx) { return d_new_keys.template element<Element>(idx); });
 
+    auto const indices_type = get_indices_type_for_size(new_keys.size());
     auto result =
-      make_numeric_column(data_type{INT32}, input.size(), mask_state::UNALLOCATED, stream, mr);
-    auto d_result = result->mutable_view().data<int32_t>();
-    auto execpol  = rmm::exec_policy(stream);
-    thrust::lower_bound(execpol->on(stream),
-                        keys_itr,
-                        keys_itr + new_keys.size(),
-                        dictionary_itr,
-                        dictionary_itr + input.size(),
-                        d_result,
-                        thrust::less<Element>());
+      make_numeric_column(indices_type, input.size(), mask_state::UNALLOCATED, stream, mr);
+    auto const execpol = rmm::exec_policy(stream);
+    auto lower_bound   = [&](auto d_result) {
+      thrust::lower_bound(execpol->on(stream),
+                          keys_itr,
+                          keys_itr + new_keys.size(),
+                          dictionary_itr,
+                          dictionary_itr + input.size(),
+                          d_result,
+                          thrust::less<Element>());
+    };
+    // the positions are written directly in the narrowest type for the new keys
+    auto result_view = result->mutable_view();
+    switch (indices_type.id()) {
+      case UINT8: lower_bound(result_view.data<uint8_t>()); break;
+      case UINT16: lower_bound(result_view.data<uint16_t>()); break;
+      default: lower_bound(result_view.data<int32_t>()); break;
+    }
     result->set_null_count(0);
     return result;
   }
@@ -112,17 +123,15 @@ std::unique_ptr<column> set_keys(
   std::unique_ptr<column> keys_column(std::move(table_keys.front()));
 
   // compute the new nulls
-  auto matches     = cudf::detail::contains(keys, keys_column->view(), mr, stream);
-  auto d_matches   = matches->view().data<bool>();
-  auto d_indices   = dictionary_column.indices().data<int32_t>();
-  auto d_null_mask = dictionary_column.null_mask();
-  auto new_nulls   = cudf::detail::valid_if(
-    thrust::make_counting_iterator<size_type>(dictionary_column.offset()),
-    thrust::make_counting_iterator<size_type>(dictionary_column.offset() +
-                                              dictionary_column.size()),
-    [d_null_mask, d_indices, d_matches] __device__(size_type idx) {
-      if (d_null_mask && !bit_is_set(d_null_mask, idx)) return false;
-      return d_matches[d_indices[idx]];
+  auto matches      = cudf::detail::contains(keys, keys_column->view(), mr, stream);
+  auto d_matches    = matches->view().data<bool>();
+  auto d_dictionary = column_device_view::create(dictionary_column.parent(), stream);
+  auto new_nulls    = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(dictionary_column.size()),
+    [d_dictionary = *d_dictionary, d_matches] __device__(size_type idx) {
+      if (d_dictionary.is_null(idx)) return false;
+      return d_matches[static_cast<int32_t>(d_dictionary.element<dictionary32>(idx))];
     },
     stream,
     mr);
@@ -149,6 +158,7 @@ std::unique_ptr<column> set_keys(dictionary_column_view const& dictionary_column
                                  column_view const& keys,
                                  rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::set_keys(dictionary_column, keys, mr);
 }
 
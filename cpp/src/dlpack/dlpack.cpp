@@ -15,6 +15,7 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/dlpack.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -97,6 +98,7 @@ struct dltensor_context {
   int64_t shape[2];
   int64_t strides[2];
   rmm::device_buffer buffer;
+  std::unique_ptr<rmm::device_buffer> shared_data;  ///< Memory the tensor aliases, if owned
 
   static void deleter(DLManagedTensor* arg)
   {
@@ -106,12 +108,16 @@ struct dltensor_context {
   }
 };
 
-}  // namespace
+/**
+ * @brief The columns of a validated DLPack tensor
+ */
+struct tensor_columns {
+  data_type type;                 ///< Type of the elements
+  size_type num_rows;             ///< Number of elements per column
+  std::vector<void const*> data;  ///< Address of each column in the tensor's memory
+};
 
-namespace detail {
-std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
-                                   rmm::mr::device_memory_resource* mr,
-                                   cudaStream_t stream)
+tensor_columns get_tensor_columns(DLManagedTensor const* managed_tensor)
 {
   CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
   auto const& tensor = managed_tensor->dl_tensor;
@@ -149,7 +155,6 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
 
   size_t const byte_width = size_of(dtype);
   size_t const num_rows   = static_cast<size_t>(tensor.shape[0]);
-  size_t const bytes      = num_rows * byte_width;
 
   // For 2D tensors, if the strides pointer is not null, then strides[1] is the
   // number of elements (not bytes) between the start of each column
@@ -158,32 +163,20 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                               : byte_width * num_rows;
 
   auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
-
-  // Allocate columns and copy data from tensor
-  std::vector<std::unique_ptr<column>> columns(num_columns);
+  std::vector<void const*> columns(num_columns);
   for (auto& col : columns) {
-    col = make_numeric_column(dtype, num_rows, mask_state::UNALLOCATED, stream, mr);
-
-    CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
-                             reinterpret_cast<void*>(tensor_data),
-                             bytes,
-                             cudaMemcpyDefault,
-                             stream));
-
+    col = reinterpret_cast<void const*>(tensor_data);
     tensor_data += col_stride;
   }
-
-  return std::make_unique<table>(std::move(columns));
+  return tensor_columns{dtype, static_cast<size_type>(num_rows), std::move(columns)};
 }
 
-DLManagedTensor* to_dlpack(table_view const& input,
-                           rmm::mr::device_memory_resource* mr,
-                           cudaStream_t stream)
+/**
+ * @brief Returns the DLPack type of the columns of @p input, which must all have the same
+ * numeric type and no nulls.
+ */
+DLDataType get_table_DLDataType(table_view const& input)
 {
-  auto const num_rows = input.num_rows();
-  auto const num_cols = input.num_columns();
-  if (num_rows == 0) { return nullptr; }
-
   // Ensure that type is convertible to DLDataType
   data_type const type    = input.column(0).type();
   DLDataType const dltype = data_type_to_DLDataType(type);
@@ -197,25 +190,120 @@ DLManagedTensor* to_dlpack(table_view const& input,
   CUDF_EXPECTS(
     std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
     "Input required to have null count zero");
+  return dltype;
+}
+
+/**
+ * @brief Returns the number of elements between the starts of consecutive columns of
+ * @p input when they lie evenly spaced in one allocation, or 0 when they do not.
+ *
+ * A tensor can alias the columns of such a table, for example one from `contiguous_split`
+ * whose columns have the same size and nullability.
+ */
+int64_t get_column_stride(table_view const& input)
+{
+  auto const num_rows   = static_cast<uintptr_t>(input.num_rows());
+  auto const byte_width = static_cast<uintptr_t>(size_of(input.column(0).type()));
+  if (input.num_columns() == 1) { return num_rows; }
+
+  auto const first  = reinterpret_cast<uintptr_t>(get_column_data(input.column(0)));
+  auto const second = reinterpret_cast<uintptr_t>(get_column_data(input.column(1)));
+  if (second < first + num_rows * byte_width || (second - first) % byte_width != 0) { return 0; }
+  auto const stride_bytes = second - first;
+  for (size_type i = 2; i < input.num_columns(); ++i) {
+    if (reinterpret_cast<uintptr_t>(get_column_data(input.column(i))) !=
+        first + i * stride_bytes) {
+      return 0;
+    }
+  }
+  return static_cast<int64_t>(stride_bytes / byte_width);
+}
 
+/**
+ * @brief Makes a column-major tensor of the columns of @p input whose elements start at
+ * @p data with @p stride elements between the columns.
+ */
+DLManagedTensor* make_managed_tensor(table_view const& input,
+                                     DLDataType dltype,
+                                     std::unique_ptr<dltensor_context>&& context,
+                                     void const* data,
+                                     int64_t stride)
+{
   auto managed_tensor = std::make_unique<DLManagedTensor>();
-  auto context        = std::make_unique<dltensor_context>();
 
   DLTensor& tensor = managed_tensor->dl_tensor;
   tensor.dtype     = dltype;
 
-  tensor.ndim     = (num_cols > 1) ? 2 : 1;
+  tensor.ndim     = (input.num_columns() > 1) ? 2 : 1;
   tensor.shape    = context->shape;
-  tensor.shape[0] = num_rows;
+  tensor.shape[0] = input.num_rows();
   if (tensor.ndim > 1) {
-    tensor.shape[1]   = num_cols;
+    tensor.shape[1]   = input.num_columns();
     tensor.strides    = context->strides;
     tensor.strides[0] = 1;
-    tensor.strides[1] = num_rows;
+    tensor.strides[1] = stride;
   }
 
   CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
   tensor.ctx.device_type = kDLGPU;
+  tensor.data            = const_cast<void*>(data);
+
+  // Defer ownership of managed tensor to caller
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+}  // namespace
+
+namespace detail {
+std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  auto const tensor  = get_tensor_columns(managed_tensor);
+  size_t const bytes = tensor.num_rows * size_of(tensor.type);
+
+  // Allocate columns and copy data from tensor
+  std::vector<std::unique_ptr<column>> columns(tensor.data.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    columns[i] =
+      make_numeric_column(tensor.type, tensor.num_rows, mask_state::UNALLOCATED, stream, mr);
+    CUDA_TRY(cudaMemcpyAsync(columns[i]->mutable_view().head<void>(),
+                             tensor.data[i],
+                             bytes,
+                             cudaMemcpyDefault,
+                             stream));
+  }
+
+  return std::make_unique<table>(std::move(columns));
+}
+
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  auto const tensor     = get_tensor_columns(managed_tensor);
+  auto const& dl_tensor = managed_tensor->dl_tensor;
+  CUDF_EXPECTS(dl_tensor.ctx.device_type == kDLGPU, "DLTensor must be on the GPU to be viewed");
+  CUDF_EXPECTS(dl_tensor.ndim == 1 || dl_tensor.strides == nullptr || dl_tensor.strides[0] == 1,
+               "DLTensor columns must be contiguous to be viewed");
+
+  std::vector<column_view> columns;
+  for (auto const data : tensor.data) {
+    columns.emplace_back(tensor.type, tensor.num_rows, data);
+  }
+  return table_view{columns};
+}
+
+DLManagedTensor* to_dlpack(table_view const& input,
+                           rmm::mr::device_memory_resource* mr,
+                           cudaStream_t stream)
+{
+  auto const num_rows = input.num_rows();
+  auto const num_cols = input.num_columns();
+  if (num_rows == 0) { return nullptr; }
+
+  DLDataType const dltype = get_table_DLDataType(input);
+  data_type const type    = input.column(0).type();
 
   // If there is only one column, then a 1D tensor can just copy the pointer
   // to the data in the column, and the deleter should not delete the original
@@ -223,16 +311,16 @@ DLManagedTensor* to_dlpack(table_view const& input,
   // copy of each column's data into the dense tensor array. Also, if we don't
   // copy, then the original column data could be changed, which would change
   // the contents of the tensor, which might be surprising or cause issues.
-  // Therefore, for now we ALWAYS do a copy of the data. If this becomes
-  // a performance issue we can reevaluate in the future.
+  // Therefore this function ALWAYS copies the data; `to_dlpack_view` and the
+  // `contiguous_split_result` overload share it instead.
 
   size_t const stride_bytes = num_rows * size_of(type);
   size_t const total_bytes  = stride_bytes * num_cols;
 
+  auto context    = std::make_unique<dltensor_context>();
   context->buffer = rmm::device_buffer(total_bytes, stream, mr);
-  tensor.data     = context->buffer.data();
 
-  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data);
+  auto tensor_data = reinterpret_cast<uintptr_t>(context->buffer.data());
   for (auto const& col : input) {
     CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<void*>(tensor_data),
                              get_column_data(col),
@@ -242,10 +330,41 @@ DLManagedTensor* to_dlpack(table_view const& input,
     tensor_data += stride_bytes;
   }
 
-  // Defer ownership of managed tensor to caller
-  managed_tensor->deleter     = dltensor_context::deleter;
-  managed_tensor->manager_ctx = context.release();
-  return managed_tensor.release();
+  auto const data = context->buffer.data();
+  return make_managed_tensor(input, dltype, std::move(context), data, num_rows);
+}
+
+DLManagedTensor* to_dlpack_view(table_view const& input)
+{
+  if (input.num_rows() == 0) { return nullptr; }
+  DLDataType const dltype = get_table_DLDataType(input);
+  auto const stride       = get_column_stride(input);
+  CUDF_EXPECTS(stride > 0, "Columns must be evenly spaced in memory to be viewed as a tensor");
+  return make_managed_tensor(input,
+                             dltype,
+                             std::make_unique<dltensor_context>(),
+                             get_column_data(input.column(0)),
+                             stride);
+}
+
+DLManagedTensor* to_dlpack(contiguous_split_result&& input,
+                           rmm::mr::device_memory_resource* mr,
+                           cudaStream_t stream)
+{
+  auto const& view = input.table;
+  if (view.num_rows() == 0) { return nullptr; }
+  DLDataType const dltype = get_table_DLDataType(view);
+  auto const stride       = get_column_stride(view);
+  if (stride == 0) {
+    auto tensor = to_dlpack(view, mr, stream);
+    input.all_data.reset();
+    return tensor;
+  }
+
+  auto context         = std::make_unique<dltensor_context>();
+  context->shared_data = std::move(input.all_data);
+  return make_managed_tensor(
+    view, dltype, std::move(context), get_column_data(view.column(0)), stride);
 }
 
 }  // namespace detail
@@ -253,12 +372,32 @@ DLManagedTensor* to_dlpack(table_view const& input,
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                    rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::from_dlpack(managed_tensor, mr);
 }
 
 DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::to_dlpack(input, mr);
 }
 
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_dlpack_view(managed_tensor);
+}
+
+DLManagedTensor* to_dlpack_view(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack_view(input);
+}
+
+DLManagedTensor* to_dlpack(contiguous_split_result&& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack(std::move(input), mr);
+}
+
 }  // namespace cudf
@@ -30,6 +30,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cuda_runtime.h>
 
@@ -157,16 +158,17 @@ std::unique_ptr<cudf::column> out_of_place_fill_range_dispatch::operator()<cudf:
     cudf::dictionary_column_view(target_matched->view()).get_indices_annotated();
 
   // get the index of the key just added
-  auto index_of_value = cudf::dictionary::detail::get_index(
+  auto index_of_value = cudf::dictionary::detail::get_typed_index(
     target_matched->view(), value, rmm::mr::get_default_resource(), stream);
   // now call fill using just the indices column and the new index
   out_of_place_fill_range_dispatch filler{*index_of_value, target_indices};
-  auto new_indices       = filler.template operator()<int32_t>(begin, end, mr, stream);
+  auto new_indices =
+    cudf::type_dispatcher(target_indices.type(), filler, begin, end, mr, stream);
   auto const output_size = new_indices->size();        // record these
   auto const null_count  = new_indices->null_count();  // before the release()
   auto contents          = new_indices->release();
   // create the new indices column from the result
-  auto indices_column = std::make_unique<cudf::column>(cudf::data_type{cudf::INT32},
+  auto indices_column = std::make_unique<cudf::column>(target_indices.type(),
                                                        static_cast<cudf::size_type>(output_size),
                                                        std::move(*(contents.data.release())),
                                                        rmm::device_buffer{0, stream, mr},
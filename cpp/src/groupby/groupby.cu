@@ -23,14 +23,22 @@
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/memory_estimate.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <hash/helper_functions.cuh>
 
 #include <thrust/copy.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -50,6 +58,52 @@ groupby::groupby(table_view const& keys,
 {
 }
 
+namespace {
+/**
+ * @brief Replaces the dictionary columns of the keys with their indices.
+ *
+ * Equal dictionary rows have equal indices, so the indices can be grouped at the
+ * cost of integers.
+ */
+table_view dictionary_indices(table_view const& keys)
+{
+  std::vector<column_view> columns;
+  std::transform(
+    keys.begin(), keys.end(), std::back_inserter(columns), [](column_view const& col) {
+      return col.type().id() == type_id::DICTIONARY32
+               ? dictionary_column_view(col).get_indices_annotated()
+               : col;
+    });
+  return table_view(columns);
+}
+
+/**
+ * @brief Converts the grouped indices back into dictionary columns with the keys'
+ * dictionary keys.
+ */
+std::unique_ptr<table> restore_dictionaries(std::unique_ptr<table>&& grouped_keys,
+                                            table_view const& keys,
+                                            cudaStream_t stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto columns = grouped_keys->release();
+  for (size_type i = 0; i < keys.num_columns(); ++i) {
+    if (keys.column(i).type().id() != type_id::DICTIONARY32) continue;
+    auto const type       = columns[i]->type();
+    auto const size       = columns[i]->size();
+    auto const null_count = columns[i]->null_count();
+    auto contents         = columns[i]->release();
+    auto indices          = std::make_unique<column>(type, size, std::move(*contents.data));
+    columns[i]   = make_dictionary_column(
+      std::make_unique<column>(dictionary_column_view(keys.column(i)).keys(), stream, mr),
+      std::move(indices),
+      std::move(*contents.null_mask),
+      null_count);
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+}  // namespace
+
 // Select hash vs. sort groupby implementation
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::dispatch_aggregation(
   std::vector<aggregation_request> const& requests,
@@ -64,7 +118,16 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // satisfied with a hash implementation
   if (_keys_are_sorted == sorted::NO and not _helper and
       detail::hash::can_use_hash_groupby(_keys, requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+    auto const has_dictionary = std::any_of(_keys.begin(), _keys.end(), [](column_view const& col) {
+      return col.type().id() == type_id::DICTIONARY32;
+    });
+    if (not has_dictionary) {
+      return detail::hash::groupby(_keys, requests, _include_null_keys, _hash_groups, stream, mr);
+    }
+    auto result = detail::hash::groupby(
+      dictionary_indices(_keys), requests, _include_null_keys, _hash_groups, stream, mr);
+    result.first = restore_dictionaries(std::move(result.first), _keys, stream, mr);
+    return result;
   } else {
     return sort_aggregate(requests, stream, mr);
   }
@@ -118,7 +181,85 @@ void verify_valid_requests(std::vector<aggregation_request> const& requests)
 
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
-  std::vector<aggregation_request> const& requests, rmm::mr::device_memory_resource* mr)
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  verify_valid_requests(requests);
+
+  if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
+
+  return dispatch_aggregation(requests, stream, mr);
+}
+
+// Estimate the peak memory of aggregation requests
+std::size_t groupby::estimate_aggregate_memory(std::vector<aggregation_request> const& requests,
+                                               size_type num_groups) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  auto const num_rows = _keys.num_rows();
+  if (num_rows == 0) { return 0; }
+  num_groups = (num_groups > 0) ? std::min(num_groups, num_rows) : num_rows;
+
+  // Size of the results of all the aggregations on `rows` rows
+  auto const results_size = [&requests](size_type rows) {
+    std::size_t size = 0;
+    for (auto const& request : requests) {
+      for (auto const& agg : request.aggregations) {
+        auto const target = cudf::detail::target_type(request.values.type(), agg->kind);
+        size += is_fixed_width(target)
+                  ? size_of(target) * rows + bitmask_allocation_size_bytes(rows)
+                  : cudf::detail::estimate_gathered_size(request.values, rows, true);
+      }
+    }
+    return size;
+  };
+  auto const output_size = cudf::detail::estimate_gathered_size(_keys, num_groups) +
+                           results_size(num_groups);
+
+  if (_keys_are_sorted == sorted::NO and not _helper and
+      detail::hash::can_use_hash_groupby(_keys, requests)) {
+    // Hash map and hash map entry of every row, sparse results of every row and the dense results
+    auto const entry_size = sizeof(thrust::pair<size_type, size_type>);
+    return (compute_hash_table_size(num_rows) + num_rows) * entry_size + results_size(num_rows) +
+           output_size;
+  }
+
+  // Sort order, group labels and group offsets of the keys, and the row bitmask of the keys when
+  // rows with nulls are excluded
+  std::size_t helper_size =
+    (2 * static_cast<std::size_t>(num_rows) + num_groups + 1) * sizeof(size_type);
+  if (_include_null_keys == null_policy::EXCLUDE &&
+      std::any_of(_keys.begin(), _keys.end(), [](auto const& col) { return col.nullable(); })) {
+    helper_size += num_rows + bitmask_allocation_size_bytes(num_rows);
+  }
+  // Values of one request at a time are sorted
+  std::size_t sorted_values_size = 0;
+  for (auto const& request : requests) {
+    sorted_values_size = std::max(sorted_values_size,
+                                  cudf::detail::estimate_gathered_size(request.values, num_rows));
+  }
+  return helper_size + sorted_values_size + output_size;
+}
+
+// Compute scan requests
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(
@@ -131,15 +272,17 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return dispatch_aggregation(requests, 0, mr);
+  return sort_scan(requests, stream, mr);
 }
 
-groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr)
+groupby::groups groupby::get_groups(table_view values,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  auto grouped_keys = helper().sorted_keys(mr, 0);
+  auto grouped_keys = helper().sorted_keys(mr, stream);
 
-  auto group_offsets = helper().group_offsets(0);
+  auto group_offsets = helper().group_offsets(stream);
   std::vector<size_type> group_offsets_vector(group_offsets.size());
   thrust::copy(group_offsets.begin(), group_offsets.end(), group_offsets_vector.begin());
 
@@ -149,7 +292,8 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
                                           helper().key_sort_order(),
                                           cudf::detail::out_of_bounds_policy::NULLIFY,
                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                          mr);
+                                          mr,
+                                          stream);
     return groupby::groups{
       std::move(grouped_keys), std::move(group_offsets_vector), std::move(grouped_values)};
   } else {
@@ -24,12 +24,16 @@
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
+#include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -39,8 +43,13 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <hash/concurrent_unordered_map.cuh>
+#include <hash/concurrent_unordered_row_set.cuh>
 
+#include <rmm/device_scalar.hpp>
+
+#include <algorithm>
 #include <memory>
+#include <set>
 #include <utility>
 
 namespace cudf {
@@ -55,10 +64,12 @@ namespace {
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 7> hash_aggregations{
+constexpr std::array<aggregation::Kind, 11> hash_aggregations{
     aggregation::SUM, aggregation::MIN, aggregation::MAX,
     aggregation::COUNT_VALID, aggregation::COUNT_ALL,
-    aggregation::ARGMIN, aggregation::ARGMAX};
+    aggregation::ARGMIN, aggregation::ARGMAX,
+    aggregation::MEAN, aggregation::VARIANCE, aggregation::STD,
+    aggregation::NUNIQUE};
 
 template <class T, size_t N>
 constexpr bool array_contains(std::array<T, N> const& haystack, T needle) {
@@ -84,7 +95,33 @@ bool constexpr is_hash_aggregation(aggregation::Kind t)
   // return array_contains(hash_aggregations, t);
   return (t == aggregation::SUM) or (t == aggregation::MIN) or (t == aggregation::MAX) or
          (t == aggregation::COUNT_VALID) or (t == aggregation::COUNT_ALL) or
-         (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX);
+         (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX) or (t == aggregation::MEAN) or
+         (t == aggregation::VARIANCE) or (t == aggregation::STD) or (t == aggregation::NUNIQUE);
+}
+
+/**
+ * @brief Indicates whether the specified aggregation operation is computed by
+ * the hash-based implementation from the results of single pass aggregations.
+ */
+bool constexpr is_compound_aggregation(aggregation::Kind t)
+{
+  return (t == aggregation::MEAN) or (t == aggregation::VARIANCE) or (t == aggregation::STD);
+}
+
+/**
+ * @brief Indicates whether the hash-based implementation supports the
+ * aggregation `agg` on the `values` column.
+ *
+ * Compound aggregations are only supported on numeric columns. NUNIQUE, MIN,
+ * MAX, ARGMIN and ARGMAX are supported on fixed-width and string columns; MIN
+ * and MAX of strings gather the rows selected by ARGMIN and ARGMAX.
+ */
+bool is_hash_supported(aggregation const& agg, column_view const& values)
+{
+  if (not is_hash_aggregation(agg.kind)) { return false; }
+  if (is_compound_aggregation(agg.kind)) { return is_numeric(values.type()); }
+  if (agg.kind == aggregation::COUNT_VALID or agg.kind == aggregation::COUNT_ALL) { return true; }
+  return is_fixed_width(values.type()) or values.type().id() == type_id::STRING;
 }
 
 // flatten aggs to filter in single pass aggs
@@ -99,14 +136,27 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests)
     auto const& request = requests[i];
     auto const& agg_v   = request.aggregations;
 
-    auto insert_agg = [&agg_kinds, &columns, &col_ids, &request, i](aggregation::Kind k) {
+    // Compound aggregations of a request can share their single pass parts
+    std::set<aggregation::Kind> inserted_kinds;
+    auto insert_agg = [&agg_kinds, &columns, &col_ids, &inserted_kinds, &request, i](
+                        aggregation::Kind k) {
+      if (not inserted_kinds.insert(k).second) { return; }
       agg_kinds.push_back(k);
       columns.push_back(request.values);
       col_ids.push_back(i);
     };
 
     for (auto&& agg : agg_v) {
-      if (is_hash_aggregation(agg->kind)) {
+      if (agg->kind == aggregation::MEAN) {
+        insert_agg(aggregation::SUM);
+        insert_agg(aggregation::COUNT_VALID);
+      } else if (agg->kind == aggregation::VARIANCE or agg->kind == aggregation::STD) {
+        // Completed by compute_variance_aggs()
+        insert_agg(aggregation::SUM);
+        insert_agg(aggregation::COUNT_VALID);
+      } else if (agg->kind == aggregation::NUNIQUE) {
+        // Computed by compute_nunique_aggs()
+      } else if (is_hash_aggregation(agg->kind)) {
         if (is_fixed_width(request.values.type()) or agg->kind == aggregation::COUNT_VALID or
             agg->kind == aggregation::COUNT_ALL) {
           insert_agg(agg->kind);
@@ -178,9 +228,38 @@ void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
       return std::move(transformed_result->release()[0]);
     };
 
+    // Gathers the single pass part `kind` of a compound aggregation into
+    // `dense_results`, unless it is already there
+    auto dense_part = [dense_results, to_dense_agg_result, i](aggregation::Kind kind) {
+      auto part_agg = std::make_unique<aggregation>(kind);
+      if (not dense_results->has_result(i, *part_agg)) {
+        dense_results->add_result(i, *part_agg, to_dense_agg_result(*part_agg));
+      }
+      return dense_results->get_result(i, *part_agg);
+    };
+
     for (auto&& agg : agg_v) {
       auto const& agg_ref = *agg;
-      if (agg->kind == aggregation::COUNT_VALID or agg->kind == aggregation::COUNT_ALL) {
+      if (dense_results->has_result(i, agg_ref)) { continue; }
+      if (agg->kind == aggregation::MEAN) {
+        auto result =
+          cudf::detail::binary_operation(dense_part(aggregation::SUM),
+                                         dense_part(aggregation::COUNT_VALID),
+                                         binary_operator::DIV,
+                                         cudf::detail::target_type(col.type(), aggregation::MEAN),
+                                         mr,
+                                         stream);
+        dense_results->add_result(i, agg_ref, std::move(result));
+      } else if (agg->kind == aggregation::STD) {
+        auto const& std_agg = static_cast<cudf::detail::std_var_aggregation const&>(agg_ref);
+        auto var_agg        = make_variance_aggregation(std_agg._ddof);
+        if (not dense_results->has_result(i, *var_agg)) {
+          dense_results->add_result(i, *var_agg, to_dense_agg_result(*var_agg));
+        }
+        auto result = cudf::detail::unary_operation(
+          dense_results->get_result(i, *var_agg), unary_op::SQRT, mr, stream);
+        dense_results->add_result(i, agg_ref, std::move(result));
+      } else if (agg->kind == aggregation::COUNT_VALID or agg->kind == aggregation::COUNT_ALL) {
         dense_results->add_result(i, agg_ref, to_dense_agg_result(agg_ref));
       } else if (col.type().id() == type_id::STRING and
                  (agg->kind == aggregation::MAX or agg->kind == aggregation::MIN)) {
@@ -229,10 +308,96 @@ auto create_hash_map(table_device_view const& d_keys,
                           stream);
 }
 
+/**
+ * @brief Number of evenly spaced rows of the keys whose distinct values give the
+ * estimated number of groups
+ */
+constexpr size_type NUM_GROUPS_SAMPLE_SIZE = 4096;
+
+/**
+ * @brief Estimates the number of groups from the number of distinct keys in a
+ * sample of `NUM_GROUPS_SAMPLE_SIZE` rows of the keys
+ *
+ * @param hasher Row hasher of the keys table
+ * @param equality Row equality comparator of the keys table
+ * @param num_rows The number of rows of the keys table, greater than 0
+ * @param row_bitmask Bitmask of the rows to skip, or `nullptr`
+ */
+template <typename Hasher, typename Equality>
+size_type estimate_num_groups(Hasher hasher,
+                              Equality equality,
+                              size_type num_rows,
+                              bitmask_type const* row_bitmask,
+                              cudaStream_t stream)
+{
+  auto const sample_size = std::min(num_rows, NUM_GROUPS_SAMPLE_SIZE);
+  auto const stride      = num_rows / sample_size;
+
+  cudf::detail::concurrent_unordered_row_set<Hasher, Equality> sample_keys(
+    sample_size, hasher, equality, stream);
+  rmm::device_scalar<size_type> num_groups(0, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(0),
+                     sample_size,
+                     [sample_keys = sample_keys.view(),
+                      row_bitmask,
+                      stride,
+                      d_num_groups = num_groups.data()] __device__(size_type i) {
+                       auto const row = i * stride;
+                       if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, row)) {
+                         return;
+                       }
+                       if (sample_keys.insert(row)) { atomicAdd(d_num_groups, size_type{1}); }
+                     });
+
+  return num_groups.value();
+}
+
+/**
+ * @brief Launches `compute_shared_memory_aggs` with enough blocks to fill the
+ * device, or one block per `SHARED_MEMORY_AGGS_BLOCK_SIZE` rows if it is less
+ */
+template <bool skip_rows_with_nulls, typename Map, typename Hasher, typename Equality>
+void launch_shared_memory_aggs(Map& map,
+                               Hasher hasher,
+                               Equality equality,
+                               size_type num_keys,
+                               table_device_view input_values,
+                               mutable_table_device_view output_values,
+                               aggregation::Kind const* aggs,
+                               bitmask_type const* row_bitmask,
+                               cudaStream_t stream)
+{
+  constexpr int block_size{hash::SHARED_MEMORY_AGGS_BLOCK_SIZE};
+  size_t const shared_memory_size{hash::shared_memory_aggs_size(output_values.num_columns())};
+
+  auto const kernel = hash::compute_shared_memory_aggs<skip_rows_with_nulls, Map, Hasher, Equality>;
+
+  int num_blocks{-1};
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &num_blocks, kernel, block_size, shared_memory_size));
+
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+
+  auto const grid_size =
+    std::min(num_blocks * num_sms, util::div_rounding_up_safe(num_keys, block_size));
+  kernel<<<grid_size, block_size, shared_memory_size, stream>>>(
+    map, hasher, equality, num_keys, input_values, output_values, aggs, row_bitmask);
+  CHECK_CUDA(stream);
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
  *
+ * When the estimated number of groups is small, the rows are pre-aggregated in
+ * shared memory by `compute_shared_memory_aggs` to avoid the contention of the
+ * atomic updates of a few elements of the sparse results.
+ *
  * @see groupby_null_templated()
  */
 template <bool keys_have_nulls, typename Map>
@@ -277,8 +442,46 @@ void compute_single_pass_aggs(table_view const& keys,
 
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
 
-  if (skip_key_rows_with_nulls) {
-    auto row_bitmask{bitmask_and(keys, rmm::mr::get_default_resource(), stream)};
+  auto row_bitmask = skip_key_rows_with_nulls
+                       ? bitmask_and(keys, rmm::mr::get_default_resource(), stream)
+                       : rmm::device_buffer{};
+
+  auto const d_row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data());
+
+  auto d_keys = table_device_view::create(keys, stream);
+  row_hasher<default_hash, keys_have_nulls> hasher{*d_keys};
+  row_equality_comparator<keys_have_nulls> rows_equal{
+    *d_keys, *d_keys, include_null_keys == null_policy::INCLUDE};
+
+  bool const use_shared_memory =
+    keys.num_rows() > 0 and not aggs.empty() and
+    hash::shared_memory_aggs_size(aggs.size()) <= hash::SHARED_MEMORY_AGGS_MAX_SIZE and
+    estimate_num_groups(hasher, rows_equal, keys.num_rows(), d_row_bitmask, stream) <=
+      hash::SHARED_MEMORY_AGGS_MAX_GROUPS;
+
+  if (use_shared_memory) {
+    if (skip_key_rows_with_nulls) {
+      launch_shared_memory_aggs<true>(map,
+                                      hasher,
+                                      rows_equal,
+                                      keys.num_rows(),
+                                      *d_values,
+                                      *d_sparse_table,
+                                      d_aggs.data().get(),
+                                      d_row_bitmask,
+                                      stream);
+    } else {
+      launch_shared_memory_aggs<false>(map,
+                                       hasher,
+                                       rows_equal,
+                                       keys.num_rows(),
+                                       *d_values,
+                                       *d_sparse_table,
+                                       d_aggs.data().get(),
+                                       nullptr,
+                                       stream);
+    }
+  } else if (skip_key_rows_with_nulls) {
     thrust::for_each_n(
       rmm::exec_policy(stream)->on(stream),
       thrust::make_counting_iterator(0),
@@ -288,7 +491,7 @@ void compute_single_pass_aggs(table_view const& keys,
                                                 *d_values,
                                                 *d_sparse_table,
                                                 d_aggs.data().get(),
-                                                static_cast<bitmask_type*>(row_bitmask.data())});
+                                                d_row_bitmask});
   } else {
     thrust::for_each_n(
       rmm::exec_policy(stream)->on(stream),
@@ -307,6 +510,212 @@ void compute_single_pass_aggs(table_view const& keys,
   }
 }
 
+/**
+ * @brief Computes all NUNIQUE aggregations from `requests` and stores the
+ * results in `sparse_results`
+ *
+ * The distinct values of each group are found with a hash set of the distinct
+ * rows of the table made of the key columns and the values column.
+ *
+ * @see groupby_null_templated()
+ */
+template <bool keys_have_nulls, typename Map>
+void compute_nunique_aggs(table_view const& keys,
+                          std::vector<aggregation_request> const& requests,
+                          cudf::detail::result_cache* sparse_results,
+                          Map& map,
+                          null_policy include_null_keys,
+                          cudaStream_t stream)
+{
+  bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& values = requests[i].values;
+    for (auto&& agg : requests[i].aggregations) {
+      if (agg->kind != aggregation::NUNIQUE or sparse_results->has_result(i, *agg)) { continue; }
+      auto const& nunique_agg = static_cast<cudf::detail::nunique_aggregation const&>(*agg);
+
+      // Null keys are only counted when they are included as a group, and
+      // null values count as one distinct value, so nulls compare equal
+      std::vector<column_view> columns(keys.begin(), keys.end());
+      columns.push_back(values);
+      auto d_rows = table_device_view::create(table_view(columns), stream);
+
+      using set_type = cudf::detail::concurrent_unordered_row_set<row_hasher<default_hash, true>,
+                                                                  row_equality_comparator<true>>;
+      set_type distinct_rows(keys.num_rows(),
+                             row_hasher<default_hash, true>{*d_rows},
+                             row_equality_comparator<true>{*d_rows, *d_rows, true},
+                             stream);
+
+      auto result = make_fixed_width_column(
+        cudf::detail::target_type(values.type(), aggregation::NUNIQUE),
+        keys.num_rows(),
+        mask_state::UNALLOCATED,
+        stream);
+      auto result_view = result->mutable_view();
+      thrust::fill(rmm::exec_policy(stream)->on(stream),
+                   result_view.begin<size_type>(),
+                   result_view.end<size_type>(),
+                   0);
+
+      rmm::device_buffer row_bitmask{};
+      if (skip_key_rows_with_nulls) {
+        row_bitmask = bitmask_and(keys, rmm::mr::get_default_resource(), stream);
+      }
+      auto d_values = column_device_view::create(values, stream);
+      thrust::for_each_n(
+        rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator(0),
+        keys.num_rows(),
+        hash::count_distinct_values<Map, typename set_type::device_view>{
+          map,
+          distinct_rows.view(),
+          *d_values,
+          result_view.data<size_type>(),
+          skip_key_rows_with_nulls ? static_cast<bitmask_type const*>(row_bitmask.data())
+                                   : nullptr,
+          nunique_agg._null_handling == null_policy::EXCLUDE and values.has_nulls()});
+
+      sparse_results->add_result(i, *agg, std::move(result));
+    }
+  }
+}
+
+/**
+ * @brief Functor computing the sparse variances of the groups of a column for
+ * every `ddof` of `ddofs`
+ *
+ * The squared deviations from the group means are accumulated in double by a
+ * second pass over the rows, so that large values neither overflow nor cancel
+ * out. The sum of the deviations, zero up to the rounding of the means,
+ * corrects the squared deviations as in the corrected two-pass algorithm.
+ */
+struct sparse_variances {
+  template <typename T, typename Map>
+  std::enable_if_t<std::is_arithmetic<T>::value, std::vector<std::unique_ptr<column>>> operator()(
+    column_view const& values,
+    column_view const& sum,
+    column_view const& count,
+    Map map,
+    bitmask_type const* row_bitmask,
+    std::vector<size_type> const& ddofs,
+    cudaStream_t stream)
+  {
+    using SumType    = cudf::detail::target_type_t<T, aggregation::SUM>;
+    using ResultType = cudf::detail::target_type_t<T, aggregation::VARIANCE>;
+
+    rmm::device_vector<double> deviations(values.size(), 0);
+    rmm::device_vector<double> squared_deviations(values.size(), 0);
+
+    auto d_values = column_device_view::create(values, stream);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       hash::accumulate_deviations<T, Map>{map,
+                                                           *d_values,
+                                                           sum.data<SumType>(),
+                                                           count.data<size_type>(),
+                                                           deviations.data().get(),
+                                                           squared_deviations.data().get(),
+                                                           row_bitmask});
+
+    std::vector<std::unique_ptr<column>> variances;
+    for (auto const ddof : ddofs) {
+      auto result      = make_numeric_column(data_type(type_to_id<ResultType>()),
+                                        values.size(),
+                                        mask_state::UNINITIALIZED,
+                                        stream);
+      auto result_view = mutable_column_device_view::create(*result, stream);
+
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator(0),
+                         values.size(),
+                         [d_result             = *result_view,
+                          d_count              = count.data<size_type>(),
+                          d_deviations         = deviations.data().get(),
+                          d_squared_deviations = squared_deviations.data().get(),
+                          ddof] __device__(size_type i) {
+                           size_type group_size = d_count[i];
+                           if (group_size == 0 or group_size - ddof <= 0) {
+                             d_result.set_null(i);
+                             return;
+                           }
+                           ResultType m2 = d_squared_deviations[i] -
+                                           d_deviations[i] * d_deviations[i] / group_size;
+                           // Rounding may leave a tiny negative m2 for constant groups
+                           d_result.element<ResultType>(i) =
+                             (m2 > 0 ? m2 : 0) / (group_size - ddof);
+                           d_result.set_valid(i);
+                         });
+      variances.push_back(std::move(result));
+    }
+    return variances;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!std::is_arithmetic<T>::value, std::vector<std::unique_ptr<column>>> operator()(
+    Args&&... args)
+  {
+    CUDF_FAIL("Only numeric types are supported in std/variance");
+  }
+};
+
+/**
+ * @brief Computes the variances of all VARIANCE and STD aggregations from
+ * `requests` and stores them in `sparse_results`
+ *
+ * The variances are computed from the SUM and COUNT_VALID results of
+ * `compute_single_pass_aggs`, and stored as the VARIANCE aggregation of the
+ * same `ddof`.
+ *
+ * @see groupby_null_templated()
+ */
+template <bool keys_have_nulls, typename Map>
+void compute_variance_aggs(table_view const& keys,
+                           std::vector<aggregation_request> const& requests,
+                           cudf::detail::result_cache* sparse_results,
+                           Map& map,
+                           null_policy include_null_keys,
+                           cudaStream_t stream)
+{
+  bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    std::vector<size_type> ddofs;
+    for (auto&& agg : requests[i].aggregations) {
+      if (agg->kind != aggregation::VARIANCE and agg->kind != aggregation::STD) { continue; }
+      auto const ddof = static_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+      if (not sparse_results->has_result(i, *make_variance_aggregation(ddof)) and
+          std::find(ddofs.begin(), ddofs.end(), ddof) == ddofs.end()) {
+        ddofs.push_back(ddof);
+      }
+    }
+    if (ddofs.empty()) { continue; }
+
+    rmm::device_buffer row_bitmask{};
+    if (skip_key_rows_with_nulls) {
+      row_bitmask = bitmask_and(keys, rmm::mr::get_default_resource(), stream);
+    }
+    auto const sum_agg   = std::make_unique<aggregation>(aggregation::SUM);
+    auto const count_agg = std::make_unique<aggregation>(aggregation::COUNT_VALID);
+    auto variances       = type_dispatcher(
+      requests[i].values.type(),
+      sparse_variances{},
+      requests[i].values,
+      sparse_results->get_result(i, *sum_agg),
+      sparse_results->get_result(i, *count_agg),
+      map,
+      skip_key_rows_with_nulls ? static_cast<bitmask_type const*>(row_bitmask.data()) : nullptr,
+      ddofs,
+      stream);
+
+    for (size_t j = 0; j < ddofs.size(); j++) {
+      sparse_results->add_result(i, *make_variance_aggregation(ddofs[j]), std::move(variances[j]));
+    }
+  }
+}
+
 /**
  * @brief Computes and returns a device vector containing all populated keys in
  * `map`.
@@ -336,6 +745,31 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map m
   return std::make_pair(std::move(populated_keys), map_size);
 }
 
+/**
+ * @brief Finds the hash map entry of the group of every row of the keys, and
+ * the row of every group, from the populated `map`
+ */
+template <typename Map>
+std::unique_ptr<hash_groups> find_hash_groups(Map map, size_type num_keys, cudaStream_t stream)
+{
+  auto groups = std::make_unique<hash_groups>();
+  groups->row_groups.resize(num_keys,
+                            thrust::make_pair(map.get_unused_key(), map.get_unused_element()));
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(0),
+                     num_keys,
+                     [map, row_groups = groups->row_groups.data().get()] __device__(size_type i) {
+                       auto const group = map.find(i);
+                       if (group != map.end()) { row_groups[i] = *group; }
+                     });
+
+  size_type map_size;
+  std::tie(groups->unique_rows, map_size) = extract_populated_keys(map, num_keys, stream);
+  groups->unique_rows.resize(map_size);
+
+  return groups;
+}
+
 /**
  * @brief Computes groupby using hash table.
  *
@@ -362,34 +796,56 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map m
  * results using the aforementioned index vector. Dense results are stored into
  * the in/out parameter `cache`.
  *
+ * The hash map entry of every row and the index vector are returned in
+ * `groups`. If `groups` is already set by a previous call on the same keys,
+ * no hash map is built and the entries of the rows are read from `groups`
+ * instead.
  */
 template <bool keys_have_nulls>
 std::unique_ptr<table> groupby_null_templated(table_view const& keys,
                                               std::vector<aggregation_request> const& requests,
                                               cudf::detail::result_cache* cache,
                                               null_policy include_null_keys,
+                                              std::unique_ptr<hash_groups>& groups,
                                               cudaStream_t stream,
                                               rmm::mr::device_memory_resource* mr)
 {
-  auto d_keys = table_device_view::create(keys);
-  auto map    = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby_hash_aggregate", keys.num_rows());
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
   cudf::detail::result_cache sparse_results(requests.size());
 
-  // Compute all single pass aggs first
-  compute_single_pass_aggs<keys_have_nulls>(
-    keys, requests, &sparse_results, *map, include_null_keys, stream);
+  if (groups) {
+    known_groups_view known_groups{groups->row_groups.data().get()};
 
-  // Now continue with remaining multi-pass aggs
-  // <placeholder>
+    compute_single_pass_aggs<keys_have_nulls>(
+      keys, requests, &sparse_results, known_groups, include_null_keys, stream);
+    compute_nunique_aggs<keys_have_nulls>(
+      keys, requests, &sparse_results, known_groups, include_null_keys, stream);
+    compute_variance_aggs<keys_have_nulls>(
+      keys, requests, &sparse_results, known_groups, include_null_keys, stream);
+  } else {
+    auto d_keys = table_device_view::create(keys);
+    auto map    = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
 
-  // Extract the populated indices from the hash map and create a gather map.
-  // Gathering using this map from sparse results will give dense results.
-  rmm::device_vector<size_type> gather_map;
-  size_type map_size;
-  std::tie(gather_map, map_size) = extract_populated_keys(*map, keys.num_rows(), stream);
+    // Compute all single pass aggs first
+    compute_single_pass_aggs<keys_have_nulls>(
+      keys, requests, &sparse_results, *map, include_null_keys, stream);
+
+    // Now continue with remaining multi-pass aggs
+    compute_nunique_aggs<keys_have_nulls>(
+      keys, requests, &sparse_results, *map, include_null_keys, stream);
+    compute_variance_aggs<keys_have_nulls>(
+      keys, requests, &sparse_results, *map, include_null_keys, stream);
+
+    groups = find_hash_groups(*map, keys.num_rows(), stream);
+  }
+
+  // Gathering using the populated indices of the hash map from sparse results
+  // will give dense results.
+  auto const& gather_map = groups->unique_rows;
+  auto const map_size    = static_cast<size_type>(gather_map.size());
 
   // Compact all results from sparse_results and insert into cache
   sparse_to_dense_results(requests, sparse_results, cache, gather_map, map_size, stream, mr);
@@ -413,8 +869,8 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests)
 {
   return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
-      return is_hash_aggregation(a->kind);
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&r](auto const& a) {
+      return is_hash_supported(*a, r.values);
     });
   });
 }
@@ -424,6 +880,7 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
+  std::unique_ptr<hash_groups>& groups,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -431,11 +888,11 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
 
   std::unique_ptr<table> unique_keys;
   if (has_nulls(keys)) {
-    unique_keys =
-      groupby_null_templated<true>(keys, requests, &cache, include_null_keys, stream, mr);
+    unique_keys = groupby_null_templated<true>(
+      keys, requests, &cache, include_null_keys, groups, stream, mr);
   } else {
-    unique_keys =
-      groupby_null_templated<false>(keys, requests, &cache, include_null_keys, stream, mr);
+    unique_keys = groupby_null_templated<false>(
+      keys, requests, &cache, include_null_keys, groups, stream, mr);
   }
 
   return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
@@ -18,13 +18,33 @@
 
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
 #include <cudf/groupby.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/bit.hpp>
 
 namespace cudf {
 namespace groupby {
 namespace detail {
 namespace hash {
+/**
+ * @brief Device view of the groups found by a previous hash-based groupby on
+ * the same keys, used in place of the hash map by the functors and kernels of
+ * this file
+ *
+ * `insert` returns the hash map entry of the group of a row without hashing
+ * or comparing the keys.
+ */
+struct known_groups_view {
+  thrust::pair<size_type, size_type> const* row_groups;  ///< Hash map entry of each row
+
+  __device__ thrust::pair<thrust::pair<size_type, size_type> const*, bool> insert(
+    thrust::pair<size_type, size_type> const& row) const
+  {
+    return thrust::make_pair(row_groups + row.first, false);
+  }
+};
+
 /**
  * @brief Compute single-pass aggregations and store results into a sparse
  * `output_values` table, and populate `map` with indices of unique keys
@@ -60,7 +80,7 @@ namespace hash {
  * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
  * null values should be skipped. It `true`, it is assumed `row_bitmask` is a
  * bitmask where bit `i` indicates the presence of a null value in row `i`.
- * @tparam Map The type of the hash map
+ * @tparam Map The type of the hash map, or `known_groups_view`
  */
 template <bool skip_rows_with_nulls, typename Map>
 struct compute_single_pass_aggs {
@@ -111,7 +131,430 @@ struct compute_single_pass_aggs {
   }
 };
 
-// TODO (dm): variance kernel
+/**
+ * @brief Count the distinct values of each group into a sparse `output` column
+ *
+ * Every row `i` is inserted into `map` as in `compute_single_pass_aggs` to find
+ * its location in the sparse output, and into `distinct_rows`, a set of the
+ * distinct (key, value) rows. The count of the group is incremented for the
+ * rows that are the first occurrence of their value within the group.
+ *
+ * @tparam Map The type of the hash map, or `known_groups_view`
+ * @tparam Set The type of the device view of the set of distinct rows
+ */
+template <typename Map, typename Set>
+struct count_distinct_values {
+  Map map;
+  Set distinct_rows;
+  column_device_view values;
+  size_type* __restrict__ output;
+  bitmask_type const* __restrict__ row_bitmask;
+  bool skip_null_values;
+
+  /**
+   * @brief Construct a new count_distinct_values functor object
+   *
+   * @param map Hash map object to insert key,value pairs into.
+   * @param distinct_rows Set of the rows of the combined keys and values table
+   * @param values The column whose distinct values are counted
+   * @param output Sparse counts, initialized to zero
+   * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
+   * value in row `i` of input keys, or `nullptr` if no row is skipped
+   * @param skip_null_values Indicates if null values are excluded from the counts
+   */
+  count_distinct_values(Map map,
+                        Set distinct_rows,
+                        column_device_view values,
+                        size_type* output,
+                        bitmask_type const* row_bitmask,
+                        bool skip_null_values)
+    : map(map),
+      distinct_rows(distinct_rows),
+      values(values),
+      output(output),
+      row_bitmask(row_bitmask),
+      skip_null_values(skip_null_values)
+  {
+  }
+
+  __device__ void operator()(size_type i)
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, i)) { return; }
+    if (skip_null_values and values.is_null(i)) { return; }
+
+    auto result = map.insert(thrust::make_pair(i, i));
+    if (distinct_rows.insert(i)) { atomicAdd(output + result.first->second, size_type{1}); }
+  }
+};
+
+/**
+ * @brief Accumulate the deviations of the values of each group from the mean
+ * of the group into sparse `deviations` and `squared_deviations` columns
+ *
+ * Every row `i` is inserted into `map` as in `compute_single_pass_aggs` to find
+ * its location in the sparse outputs, where `sum` and `count` hold the sum and
+ * the count of the valid values of its group. The deviations are accumulated
+ * in double, so that squaring large integers does not overflow.
+ *
+ * @tparam T The type of the values
+ * @tparam Map The type of the hash map, or `known_groups_view`
+ */
+template <typename T, typename Map>
+struct accumulate_deviations {
+  using SumType = cudf::detail::target_type_t<T, aggregation::SUM>;
+
+  Map map;
+  column_device_view values;
+  SumType const* __restrict__ sum;
+  size_type const* __restrict__ count;
+  double* __restrict__ deviations;
+  double* __restrict__ squared_deviations;
+  bitmask_type const* __restrict__ row_bitmask;
+
+  /**
+   * @brief Construct a new accumulate_deviations functor object
+   *
+   * @param map Hash map object to insert key,value pairs into.
+   * @param values The column whose deviations are accumulated
+   * @param sum Sparse sums of the valid values
+   * @param count Sparse counts of the valid values
+   * @param deviations Sparse sums of the deviations, initialized to zero
+   * @param squared_deviations Sparse sums of the squared deviations,
+   * initialized to zero
+   * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
+   * value in row `i` of input keys, or `nullptr` if no row is skipped
+   */
+  accumulate_deviations(Map map,
+                        column_device_view values,
+                        SumType const* sum,
+                        size_type const* count,
+                        double* deviations,
+                        double* squared_deviations,
+                        bitmask_type const* row_bitmask)
+    : map(map),
+      values(values),
+      sum(sum),
+      count(count),
+      deviations(deviations),
+      squared_deviations(squared_deviations),
+      row_bitmask(row_bitmask)
+  {
+  }
+
+  __device__ void operator()(size_type i)
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, i)) { return; }
+    if (values.is_null(i)) { return; }
+
+    auto const target    = map.insert(thrust::make_pair(i, i)).first->second;
+    auto const mean      = static_cast<double>(sum[target]) / count[target];
+    auto const deviation = static_cast<double>(values.element<T>(i)) - mean;
+    atomicAdd(deviations + target, deviation);
+    atomicAdd(squared_deviations + target, deviation * deviation);
+  }
+};
+
+/**
+ * @brief Number of slots of the block-local hash table of
+ * `compute_shared_memory_aggs`
+ */
+constexpr size_type SHARED_MEMORY_AGGS_CAPACITY = 256;
+
+/**
+ * @brief Largest estimated number of groups for which the hash groupby uses
+ * `compute_shared_memory_aggs`
+ */
+constexpr size_type SHARED_MEMORY_AGGS_MAX_GROUPS = SHARED_MEMORY_AGGS_CAPACITY / 2;
+
+/**
+ * @brief Largest dynamic shared memory size of `compute_shared_memory_aggs`
+ */
+constexpr size_t SHARED_MEMORY_AGGS_MAX_SIZE = 48 * 1024;
+
+/**
+ * @brief Threads per block of `compute_shared_memory_aggs`
+ */
+constexpr int SHARED_MEMORY_AGGS_BLOCK_SIZE = 256;
+
+/**
+ * @brief Returns the size in bytes of the block-local hash table of
+ * `compute_shared_memory_aggs` for `num_aggs` aggregations
+ *
+ * Every slot holds a key row index, and for each aggregation an 8 bytes
+ * partial result and its validity.
+ */
+inline size_t shared_memory_aggs_size(size_type num_aggs)
+{
+  return SHARED_MEMORY_AGGS_CAPACITY *
+         (sizeof(size_type) + num_aggs * (sizeof(int64_t) + sizeof(bool)));
+}
+
+/**
+ * @brief Indicates whether the block-local partial result of the aggregation is
+ * the index of the selected row.
+ */
+CUDA_HOST_DEVICE_CALLABLE constexpr bool is_row_index_aggregation(aggregation::Kind k)
+{
+  return (k == aggregation::MIN) or (k == aggregation::MAX) or (k == aggregation::ARGMIN) or
+         (k == aggregation::ARGMAX);
+}
+
+/**
+ * @brief Updates and flushes a block-local partial result of an aggregation
+ *
+ * `update` aggregates an element of `source` into the partial result `target`,
+ * and `flush` aggregates the partial result into an element of the global
+ * `target` column, with the semantics of `update_target_element`. MIN, MAX,
+ * ARGMIN and ARGMAX partial results are the index of the selected row of
+ * `source`, so that they are flushed like a single element of `source`.
+ */
+template <typename Source, aggregation::Kind k, typename Enable = void>
+struct shared_memory_aggregation {
+  __device__ void update(int64_t* target,
+                         bool* target_valid,
+                         column_device_view source,
+                         size_type source_index) const noexcept
+  {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
+
+  __device__ void flush(mutable_column_device_view target,
+                        size_type target_index,
+                        int64_t const* partial,
+                        bool partial_valid,
+                        column_device_view source) const noexcept
+  {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
+};
+
+template <typename Source>
+struct shared_memory_aggregation<Source,
+                                 aggregation::SUM,
+                                 std::enable_if_t<is_fixed_width<Source>()>> {
+  using Target = cudf::detail::target_type_t<Source, aggregation::SUM>;
+
+  __device__ void update(int64_t* target,
+                         bool* target_valid,
+                         column_device_view source,
+                         size_type source_index) const noexcept
+  {
+    if (source.is_null(source_index)) { return; }
+
+    atomicAdd(reinterpret_cast<Target*>(target),
+              static_cast<Target>(source.element<Source>(source_index)));
+    *target_valid = true;
+  }
+
+  __device__ void flush(mutable_column_device_view target,
+                        size_type target_index,
+                        int64_t const* partial,
+                        bool partial_valid,
+                        column_device_view source) const noexcept
+  {
+    if (not partial_valid) { return; }
+
+    atomicAdd(&target.element<Target>(target_index), *reinterpret_cast<Target const*>(partial));
+    if (target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
+template <typename Source, aggregation::Kind k>
+struct shared_memory_aggregation<
+  Source,
+  k,
+  std::enable_if_t<(k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) and
+                   cudf::detail::is_valid_aggregation<Source, k>()>> {
+  __device__ void update(int64_t* target,
+                         bool* target_valid,
+                         column_device_view source,
+                         size_type source_index) const noexcept
+  {
+    if (k == aggregation::COUNT_VALID and source.is_null(source_index)) { return; }
+
+    atomicAdd(reinterpret_cast<size_type*>(target), size_type{1});
+  }
+
+  __device__ void flush(mutable_column_device_view target,
+                        size_type target_index,
+                        int64_t const* partial,
+                        bool partial_valid,
+                        column_device_view source) const noexcept
+  {
+    atomicAdd(&target.element<size_type>(target_index),
+              *reinterpret_cast<size_type const*>(partial));
+  }
+};
+
+template <typename Source, aggregation::Kind k>
+struct shared_memory_aggregation<
+  Source,
+  k,
+  std::enable_if_t<is_row_index_aggregation(k) and
+                   cudf::detail::is_valid_aggregation<Source, k>() and
+                   cudf::is_relationally_comparable<Source, Source>()>> {
+  __device__ void update(int64_t* target,
+                         bool* target_valid,
+                         column_device_view source,
+                         size_type source_index) const noexcept
+  {
+    if (source.is_null(source_index)) { return; }
+
+    auto is_better = [source](size_type lhs, size_type rhs) {
+      return (k == aggregation::MIN or k == aggregation::ARGMIN)
+               ? source.element<Source>(lhs) < source.element<Source>(rhs)
+               : source.element<Source>(lhs) > source.element<Source>(rhs);
+    };
+
+    auto row = reinterpret_cast<size_type*>(target);
+    auto old = atomicCAS(row, cudf::detail::ARGMIN_SENTINEL, source_index);
+    if (old == cudf::detail::ARGMIN_SENTINEL) { return; }
+
+    while (is_better(source_index, old)) { old = atomicCAS(row, old, source_index); }
+  }
+
+  __device__ void flush(mutable_column_device_view target,
+                        size_type target_index,
+                        int64_t const* partial,
+                        bool partial_valid,
+                        column_device_view source) const noexcept
+  {
+    auto row = *reinterpret_cast<size_type const*>(partial);
+    if (row == cudf::detail::ARGMIN_SENTINEL) { return; }
+
+    cudf::detail::update_target_element<Source, k, true, false>{}(
+      target, target_index, source, row);
+  }
+};
+
+/**
+ * @brief Dispatched functor updating a block-local partial result
+ */
+struct shared_memory_aggregator {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(int64_t* target,
+                             bool* target_valid,
+                             column_device_view source,
+                             size_type source_index) const noexcept
+  {
+    shared_memory_aggregation<Source, k>{}.update(target, target_valid, source, source_index);
+  }
+};
+
+/**
+ * @brief Dispatched functor flushing a block-local partial result
+ */
+struct shared_memory_flusher {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             int64_t const* partial,
+                             bool partial_valid,
+                             column_device_view source) const noexcept
+  {
+    shared_memory_aggregation<Source, k>{}.flush(
+      target, target_index, partial, partial_valid, source);
+  }
+};
+
+/**
+ * @brief Compute single-pass aggregations like `compute_single_pass_aggs`, but
+ * pre-aggregate the rows of each block in shared memory
+ *
+ * Each block aggregates its rows into a hash table of
+ * `SHARED_MEMORY_AGGS_CAPACITY` slots, of `shared_memory_aggs_size()` bytes of
+ * dynamic shared memory, before flushing the partial results of every slot
+ * into `output_values` at the location found in `map`. With few distinct keys,
+ * this replaces most of the atomic updates of the same global elements by
+ * atomic updates in shared memory. The rows whose key does not fit in the
+ * block-local table are aggregated into `output_values` directly.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
+ * null values should be skipped. It `true`, it is assumed `row_bitmask` is a
+ * bitmask where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam Map The type of the hash map, or `known_groups_view`
+ * @tparam Hasher Row hasher of the keys table, as used by `map`
+ * @tparam Equality Row equality comparator of the keys table, as used by `map`
+ */
+template <bool skip_rows_with_nulls, typename Map, typename Hasher, typename Equality>
+__global__ void compute_shared_memory_aggs(Map map,
+                                           Hasher hasher,
+                                           Equality equality,
+                                           size_type num_keys,
+                                           table_device_view input_values,
+                                           mutable_table_device_view output_values,
+                                           aggregation::Kind const* __restrict__ aggs,
+                                           bitmask_type const* __restrict__ row_bitmask)
+{
+  constexpr size_type capacity{SHARED_MEMORY_AGGS_CAPACITY};
+  constexpr size_type empty_slot{-1};
+
+  extern __shared__ int64_t shared_memory_aggs_storage[];
+  auto const num_aggs  = output_values.num_columns();
+  int64_t* partials    = shared_memory_aggs_storage;
+  size_type* slot_keys = reinterpret_cast<size_type*>(partials + num_aggs * capacity);
+  bool* partials_valid = reinterpret_cast<bool*>(slot_keys + capacity);
+
+  for (size_type slot = threadIdx.x; slot < capacity; slot += blockDim.x) {
+    slot_keys[slot] = empty_slot;
+    for (auto j = 0; j < num_aggs; ++j) {
+      partials[j * capacity + slot] = 0;
+      if (is_row_index_aggregation(aggs[j])) {
+        *reinterpret_cast<size_type*>(partials + j * capacity + slot) =
+          cudf::detail::ARGMIN_SENTINEL;
+      }
+      partials_valid[j * capacity + slot] = false;
+    }
+  }
+  __syncthreads();
+
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_keys;
+       i += blockDim.x * gridDim.x) {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { continue; }
+
+    size_type slot   = hasher(i) % capacity;
+    size_type probes = 0;
+    for (; probes < capacity; ++probes) {
+      auto const existing = atomicCAS(slot_keys + slot, empty_slot, i);
+      if (existing == empty_slot or equality(existing, i)) { break; }
+      slot = (slot + 1) % capacity;
+    }
+
+    if (probes < capacity) {
+      for (auto j = 0; j < num_aggs; ++j) {
+        cudf::detail::dispatch_type_and_aggregation(input_values.column(j).type(),
+                                                    aggs[j],
+                                                    shared_memory_aggregator{},
+                                                    partials + j * capacity + slot,
+                                                    partials_valid + j * capacity + slot,
+                                                    input_values.column(j),
+                                                    i);
+      }
+    } else {
+      auto result = map.insert(thrust::make_pair(i, i));
+      cudf::detail::aggregate_row<true, true>(
+        output_values, result.first->second, input_values, i, aggs);
+    }
+  }
+  __syncthreads();
+
+  for (size_type slot = threadIdx.x; slot < capacity; slot += blockDim.x) {
+    auto const key = slot_keys[slot];
+    if (key == empty_slot) { continue; }
+
+    auto result = map.insert(thrust::make_pair(key, key));
+    for (auto j = 0; j < num_aggs; ++j) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(j).type(),
+                                                  aggs[j],
+                                                  shared_memory_flusher{},
+                                                  output_values.column(j),
+                                                  result.first->second,
+                                                  partials + j * capacity + slot,
+                                                  partials_valid[j * capacity + slot],
+                                                  input_values.column(j));
+    }
+  }
+}
 
 }  // namespace hash
 }  // namespace detail
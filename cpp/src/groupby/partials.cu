@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/tdigest.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace groupby {
+namespace {
+/// Number of partial state columns of an aggregation
+size_t num_partials(aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::SUM:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::APPROX_NUNIQUE: return 1;
+    case aggregation::MEAN: return 2;
+    case aggregation::VARIANCE:
+    case aggregation::STD: return 3;
+    case aggregation::APPROX_QUANTILE: return 4;
+    default: CUDF_FAIL("Unsupported partial aggregation");
+  }
+}
+
+/// Aggregation merging the partial states of aggregation `k`
+aggregation::Kind merge_kind(aggregation::Kind k)
+{
+  switch (k) {
+    case aggregation::MIN:
+    case aggregation::MAX: return k;
+    default: return aggregation::SUM;
+  }
+}
+
+/// Whether partial state `i` of aggregation `k` is a count
+bool is_count_partial(aggregation::Kind k, size_t i)
+{
+  return k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL or
+         ((k == aggregation::MEAN or k == aggregation::VARIANCE or k == aggregation::STD) and
+          i == 0);
+}
+
+/// Verifies the number of partial state columns of every request
+void verify_partials(std::vector<partial_aggregation_request> const& requests)
+{
+  CUDF_EXPECTS(std::all_of(requests.begin(),
+                           requests.end(),
+                           [](auto const& request) {
+                             size_t expected = 0;
+                             for (auto const& agg : request.aggregations) {
+                               expected += num_partials(*agg);
+                             }
+                             return request.partials.size() == expected;
+                           }),
+               "Mismatch between partial states and aggregations.");
+}
+
+/**
+ * @brief Computes the variance, or standard deviation, of groups from their
+ * count of valid values, sum and sum of squares
+ *
+ * The result is null for the groups with `count - ddof <= 0`.
+ */
+std::unique_ptr<column> variance_from_partials(column_view const& count,
+                                               column_view const& sum,
+                                               column_view const& sum_of_squares,
+                                               size_type ddof,
+                                               bool standard_deviation,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(sum.type().id() == FLOAT64 and sum_of_squares.type().id() == FLOAT64,
+               "Variance partial sums must be FLOAT64");
+  auto result = make_fixed_width_column(
+    data_type(FLOAT64), count.size(), mask_state::UNALLOCATED, stream, mr);
+  if (count.size() == 0) { return result; }
+
+  auto const d_count = count.data<size_type>();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     count.size(),
+                     [d_count,
+                      d_sum            = sum.data<double>(),
+                      d_sum_of_squares = sum_of_squares.data<double>(),
+                      d_result         = result->mutable_view().data<double>(),
+                      ddof,
+                      standard_deviation] __device__(size_type i) {
+                       auto const n = d_count[i];
+                       if (n - ddof <= 0) { return; }
+                       auto const mean     = d_sum[i] / n;
+                       auto const variance = (d_sum_of_squares[i] - mean * d_sum[i]) / (n - ddof);
+                       // Rounding errors may give slightly negative results for constant groups
+                       auto const clamped = variance < 0 ? 0.0 : variance;
+                       d_result[i]        = standard_deviation ? sqrt(clamped) : clamped;
+                     });
+
+  auto null_mask = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(count.size()),
+    [d_count, ddof] __device__(size_type i) { return d_count[i] - ddof > 0; },
+    stream,
+    mr);
+  if (null_mask.second > 0) {
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+  return result;
+}
+
+}  // namespace
+
+// Compute the partial states of aggregation requests
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate_partials(
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+
+  // Every partial state is a plain aggregation of the values, or of their FLOAT64 values and
+  // squares for VARIANCE and STD, computed together by a single aggregate call
+  std::vector<aggregation_request> flat_requests;
+  std::vector<std::unique_ptr<column>> moment_values;
+  std::vector<std::vector<std::pair<size_t, aggregation::Kind>>> partials(requests.size());
+  std::map<std::pair<size_t, aggregation::Kind>, size_t> num_uses;
+  std::vector<aggregation const*> sketch_aggs;
+
+  auto add_partial = [&](size_t i, size_t flat_request, aggregation::Kind k) {
+    auto& aggs = flat_requests[flat_request].aggregations;
+    if (std::none_of(aggs.begin(), aggs.end(), [k](auto const& agg) { return agg->kind == k; })) {
+      aggs.push_back(std::make_unique<aggregation>(k));
+    }
+    partials[i].emplace_back(flat_request, k);
+    ++num_uses[{flat_request, k}];
+  };
+
+  for (size_t i = 0; i < requests.size(); ++i) {
+    auto const& values = requests[i].values;
+    auto const values_request = flat_requests.size();
+    flat_requests.emplace_back();
+    flat_requests.back().values = values;
+
+    size_t moments_request = 0;
+    for (auto const& agg : requests[i].aggregations) {
+      switch (agg->kind) {
+        case aggregation::SUM:
+        case aggregation::MIN:
+        case aggregation::MAX:
+        case aggregation::COUNT_VALID:
+        case aggregation::COUNT_ALL: add_partial(i, values_request, agg->kind); break;
+        case aggregation::MEAN:
+          add_partial(i, values_request, aggregation::COUNT_VALID);
+          add_partial(i, values_request, aggregation::SUM);
+          break;
+        case aggregation::VARIANCE:
+        case aggregation::STD:
+          CUDF_EXPECTS(is_numeric(values.type()), "Invalid type/aggregation combination.");
+          if (moments_request == 0) {
+            moments_request = flat_requests.size();
+            moment_values.push_back(
+              cudf::detail::cast(values, data_type(FLOAT64), rmm::mr::get_default_resource()));
+            moment_values.push_back(cudf::detail::binary_operation(moment_values.back()->view(),
+                                                                   moment_values.back()->view(),
+                                                                   binary_operator::MUL,
+                                                                   data_type(FLOAT64)));
+            flat_requests.emplace_back();
+            flat_requests.back().values = moment_values[moment_values.size() - 2]->view();
+            flat_requests.emplace_back();
+            flat_requests.back().values = moment_values.back()->view();
+          }
+          add_partial(i, values_request, aggregation::COUNT_VALID);
+          add_partial(i, moments_request, aggregation::SUM);
+          add_partial(i, moments_request + 1, aggregation::SUM);
+          break;
+        case aggregation::APPROX_NUNIQUE:
+        case aggregation::APPROX_QUANTILE:
+          partials[i].emplace_back(values_request, agg->kind);
+          sketch_aggs.push_back(agg.get());
+          break;
+        default: CUDF_FAIL("Unsupported partial aggregation");
+      }
+    }
+  }
+
+  // Sketches are built from the groups of the sort helper, creating it first makes the other
+  // partial states use the sort groupby as well, with the same order of the groups
+  if (not sketch_aggs.empty()) { helper(); }
+  auto flat_results = aggregate(flat_requests, mr, stream);
+
+  // Move out the last use of every partial state and copy the others
+  std::vector<aggregation_result> results(requests.size());
+  auto sketch_agg = sketch_aggs.begin();
+  for (size_t i = 0; i < requests.size(); ++i) {
+    for (auto const& partial : partials[i]) {
+      if (partial.second == aggregation::APPROX_NUNIQUE) {
+        auto const& approx_nunique_agg =
+          static_cast<cudf::detail::approx_nunique_aggregation const&>(**sketch_agg++);
+        auto const num_groups = flat_results.first->num_rows();
+        results[i].results.push_back(
+          cudf::detail::hyperloglog_sketches(requests[i].values,
+                                             helper().key_sort_order().data<size_type>(),
+                                             helper().group_labels().data().get(),
+                                             num_groups == 0 ? 0 : helper().num_keys(),
+                                             num_groups,
+                                             approx_nunique_agg._precision,
+                                             approx_nunique_agg._null_handling,
+                                             mr,
+                                             stream));
+        continue;
+      }
+      if (partial.second == aggregation::APPROX_QUANTILE) {
+        auto const& approx_quantile_agg =
+          static_cast<cudf::detail::approx_quantile_aggregation const&>(**sketch_agg++);
+        auto const num_groups = flat_results.first->num_rows();
+        auto digests = cudf::detail::group_tdigests(requests[i].values,
+                                                    helper().key_sort_order().data<size_type>(),
+                                                    helper().group_labels().data().get(),
+                                                    num_groups == 0 ? 0 : helper().num_keys(),
+                                                    num_groups,
+                                                    approx_quantile_agg._compression,
+                                                    mr,
+                                                    stream);
+        auto columns = digests->release();
+        std::move(columns.begin(), columns.end(), std::back_inserter(results[i].results));
+        continue;
+      }
+      auto const& aggs = flat_requests[partial.first].aggregations;
+      auto const index = std::distance(
+        aggs.begin(), std::find_if(aggs.begin(), aggs.end(), [k = partial.second](auto const& agg) {
+          return agg->kind == k;
+        }));
+      auto& flat_result = flat_results.second[partial.first].results[index];
+      if (--num_uses[partial] == 0) {
+        results[i].results.push_back(std::move(flat_result));
+      } else {
+        results[i].results.push_back(std::make_unique<column>(flat_result->view(), stream, mr));
+      }
+    }
+  }
+
+  return std::make_pair(std::move(flat_results.first), std::move(results));
+}
+
+// Merge the partial states of aggregation requests
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> merge_partials(
+  table_view const& keys,
+  std::vector<partial_aggregation_request> const& requests,
+  null_policy include_null_keys,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  verify_partials(requests);
+
+  // Every partial state is merged by its own request: MIN and MAX of the partial minimums and
+  // maximums, and SUM of all the other partial states. HyperLogLog sketches and t-digests are
+  // merged in a single pass over the groups of the sort helper.
+  std::vector<aggregation_request> flat_requests;
+  bool has_sketches = false;
+  for (auto const& request : requests) {
+    auto partial = request.partials.begin();
+    for (auto const& agg : request.aggregations) {
+      if (agg->kind == aggregation::APPROX_NUNIQUE or agg->kind == aggregation::APPROX_QUANTILE) {
+        has_sketches = true;
+        partial += num_partials(*agg);
+        continue;
+      }
+      for (size_t i = 0; i < num_partials(*agg); ++i, ++partial) {
+        flat_requests.emplace_back();
+        flat_requests.back().values = *partial;
+        flat_requests.back().aggregations.push_back(
+          std::make_unique<aggregation>(merge_kind(agg->kind)));
+      }
+    }
+  }
+
+  groupby gb_obj(keys, include_null_keys);
+  // Creating the sort helper first makes the other partial states use the sort groupby as well,
+  // with the same order of the groups
+  if (has_sketches) { gb_obj.helper(); }
+  auto flat_results = gb_obj.aggregate(flat_requests, mr, stream);
+
+  std::vector<aggregation_result> results(requests.size());
+  auto flat_result = flat_results.second.begin();
+  for (size_t r = 0; r < requests.size(); ++r) {
+    auto partial = requests[r].partials.begin();
+    for (auto const& agg : requests[r].aggregations) {
+      if (agg->kind == aggregation::APPROX_NUNIQUE) {
+        auto& helper = gb_obj.helper();
+        results[r].results.push_back(cudf::detail::merge_hyperloglog_sketches(
+          *partial++,
+          helper.key_sort_order(stream).data<size_type>(),
+          helper.group_offsets(stream).data().get(),
+          flat_results.first->num_rows(),
+          static_cast<cudf::detail::approx_nunique_aggregation const&>(*agg)._precision,
+          mr,
+          stream));
+        continue;
+      }
+      if (agg->kind == aggregation::APPROX_QUANTILE) {
+        auto& helper = gb_obj.helper();
+        auto const compression =
+          static_cast<cudf::detail::approx_quantile_aggregation const&>(*agg)._compression;
+        auto const digests =
+          table_view{std::vector<column_view>(partial, partial + num_partials(*agg))};
+        auto merged = cudf::detail::merge_tdigests(digests,
+                                                   helper.key_sort_order(stream).data<size_type>(),
+                                                   helper.group_offsets(stream).data().get(),
+                                                   flat_results.first->num_rows(),
+                                                   compression,
+                                                   mr,
+                                                   stream);
+        auto columns = merged->release();
+        std::move(columns.begin(), columns.end(), std::back_inserter(results[r].results));
+        partial += num_partials(*agg);
+        continue;
+      }
+      for (size_t i = 0; i < num_partials(*agg); ++i, ++flat_result, ++partial) {
+        auto& merged = flat_result->results.front();
+        // Counts are summed as INT64, cast them back to the type of the counts
+        if (is_count_partial(agg->kind, i)) {
+          merged = cudf::detail::cast(
+            merged->view(), data_type(type_to_id<size_type>()), mr, stream);
+        }
+        results[r].results.push_back(std::move(merged));
+      }
+    }
+  }
+
+  return std::make_pair(std::move(flat_results.first), std::move(results));
+}
+
+// Compute aggregation results from their partial states
+std::vector<aggregation_result> finalize_partials(
+  std::vector<partial_aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  verify_partials(requests);
+
+  std::vector<aggregation_result> results(requests.size());
+  for (size_t r = 0; r < requests.size(); ++r) {
+    auto partial = requests[r].partials.begin();
+    for (auto const& agg : requests[r].aggregations) {
+      switch (agg->kind) {
+        case aggregation::MEAN:
+          results[r].results.push_back(cudf::detail::binary_operation(
+            partial[1], partial[0], binary_operator::DIV, data_type(FLOAT64), mr, stream));
+          break;
+        case aggregation::VARIANCE:
+        case aggregation::STD: {
+          auto const& var_agg = static_cast<cudf::detail::std_var_aggregation const&>(*agg);
+          results[r].results.push_back(variance_from_partials(partial[0],
+                                                              partial[1],
+                                                              partial[2],
+                                                              var_agg._ddof,
+                                                              agg->kind == aggregation::STD,
+                                                              mr,
+                                                              stream));
+        } break;
+        case aggregation::APPROX_NUNIQUE: {
+          auto const& approx_nunique_agg =
+            static_cast<cudf::detail::approx_nunique_aggregation const&>(*agg);
+          results[r].results.push_back(cudf::detail::hyperloglog_estimate(
+            *partial, approx_nunique_agg._precision, mr, stream));
+        } break;
+        case aggregation::APPROX_QUANTILE: {
+          auto const& approx_quantile_agg =
+            static_cast<cudf::detail::approx_quantile_aggregation const&>(*agg);
+          results[r].results.push_back(cudf::detail::tdigest_quantiles(
+            table_view{std::vector<column_view>(partial, partial + num_partials(*agg))},
+            approx_quantile_agg._quantiles,
+            mr,
+            stream));
+        } break;
+        default: results[r].results.push_back(std::make_unique<column>(*partial, stream, mr));
+      }
+      partial += num_partials(*agg);
+    }
+  }
+
+  return results;
+}
+
+}  // namespace groupby
+}  // namespace cudf
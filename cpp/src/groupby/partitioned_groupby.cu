@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+/**
+ * @brief Copy of a column in host memory
+ */
+struct host_column {
+  data_type type{EMPTY};
+  size_type size{0};
+  size_type null_count{0};
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> null_mask;
+  std::vector<host_column> children;
+};
+
+/**
+ * @brief Copy of a table in host memory
+ */
+struct host_table {
+  size_type num_rows{0};
+  std::vector<host_column> columns;
+};
+
+namespace {
+/// Copies `size` bytes of device memory to a host vector
+std::vector<uint8_t> to_host(void const* data, size_t size, cudaStream_t stream)
+{
+  std::vector<uint8_t> host_data(size);
+  if (size > 0) {
+    CUDA_TRY(cudaMemcpyAsync(host_data.data(), data, size, cudaMemcpyDeviceToHost, stream));
+  }
+  return host_data;
+}
+
+/**
+ * @brief Copies a column of zero offset, and its children, to host memory
+ *
+ * The copies are asynchronous: `stream` must be synchronized before the column
+ * is modified or the host copy is read.
+ */
+host_column to_host(column_view const& col, cudaStream_t stream)
+{
+  CUDF_EXPECTS(col.offset() == 0, "Unexpected column offset");
+  CUDF_EXPECTS(is_fixed_width(col.type()) or col.type().id() == type_id::STRING,
+               "Unsupported column type in partitioned groupby");
+
+  host_column host_col;
+  host_col.type       = col.type();
+  host_col.size       = col.size();
+  host_col.null_count = col.null_count();
+  if (is_fixed_width(col.type())) {
+    host_col.data = to_host(col.head(), col.size() * size_of(col.type()), stream);
+  }
+  if (col.nullable()) {
+    host_col.null_mask =
+      to_host(col.null_mask(), bitmask_allocation_size_bytes(col.size()), stream);
+  }
+  std::transform(col.child_begin(),
+                 col.child_end(),
+                 std::back_inserter(host_col.children),
+                 [stream](column_view const& child) { return to_host(child, stream); });
+  return host_col;
+}
+
+/// Copies a column from host memory back to a column in device memory
+std::unique_ptr<column> to_device(host_column const& host_col, cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> children;
+  std::transform(host_col.children.begin(),
+                 host_col.children.end(),
+                 std::back_inserter(children),
+                 [stream](host_column const& child) { return to_device(child, stream); });
+  return std::make_unique<column>(
+    host_col.type,
+    host_col.size,
+    rmm::device_buffer{host_col.data.data(), host_col.data.size(), stream},
+    rmm::device_buffer{host_col.null_mask.data(), host_col.null_mask.size(), stream},
+    host_col.null_count,
+    std::move(children));
+}
+
+/// Copies a table from host memory back to a table in device memory
+std::unique_ptr<table> to_device(host_table const& host_tbl, cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> columns;
+  std::transform(host_tbl.columns.begin(),
+                 host_tbl.columns.end(),
+                 std::back_inserter(columns),
+                 [stream](host_column const& col) { return to_device(col, stream); });
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace
+}  // namespace detail
+
+// Constructor
+partitioned_groupby::partitioned_groupby(std::vector<size_type> const& key_columns,
+                                         size_type num_partitions,
+                                         null_policy include_null_keys)
+  : _key_columns{key_columns},
+    _num_partitions{num_partitions},
+    _include_null_keys{include_null_keys},
+    _partitions(num_partitions > 0 ? num_partitions : 0)
+{
+  CUDF_EXPECTS(not key_columns.empty(), "Partitioned groupby requires key columns.");
+  CUDF_EXPECTS(num_partitions > 0, "Partitioned groupby requires at least one partition.");
+}
+
+// Destructor
+// Needs to be in source file because host_table was forward declared
+partitioned_groupby::~partitioned_groupby() = default;
+
+void partitioned_groupby::append(table_view const& batch, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<data_type> column_types(batch.num_columns(), data_type{EMPTY});
+  std::transform(
+    batch.begin(), batch.end(), column_types.begin(), [](auto const& col) { return col.type(); });
+  if (_column_types.empty()) {
+    CUDF_EXPECTS(std::all_of(_key_columns.begin(),
+                             _key_columns.end(),
+                             [&batch](auto i) { return i >= 0 and i < batch.num_columns(); }),
+                 "Key column index out of range.");
+    _column_types = column_types;
+  }
+  CUDF_EXPECTS(column_types == _column_types, "Column types mismatch between batches.");
+
+  if (batch.num_rows() == 0) { return; }
+
+  std::unique_ptr<table> partitioned;
+  std::vector<size_type> offsets;
+  std::tie(partitioned, offsets) = cudf::detail::hash_partition(
+    batch, _key_columns, _num_partitions, rmm::mr::get_default_resource(), stream);
+  offsets.push_back(batch.num_rows());
+
+  for (size_type p = 0; p < _num_partitions; ++p) {
+    auto host_tbl      = std::make_unique<detail::host_table>();
+    host_tbl->num_rows = offsets[p + 1] - offsets[p];
+    if (host_tbl->num_rows > 0) {
+      // Copy the partition to give its columns zero offsets before spilling it
+      auto const rows      = cudf::slice(partitioned->view(), {offsets[p], offsets[p + 1]})[0];
+      auto const partition = std::make_unique<table>(rows, stream);
+      std::transform(partition->view().begin(),
+                     partition->view().end(),
+                     std::back_inserter(host_tbl->columns),
+                     [stream](column_view const& col) { return detail::to_host(col, stream); });
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
+    _partitions[p].push_back(std::move(host_tbl));
+  }
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> partitioned_groupby::aggregate(
+  std::vector<partitioned_aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not _column_types.empty(), "No batch appended to the partitioned groupby.");
+  CUDF_EXPECTS(std::all_of(requests.begin(),
+                           requests.end(),
+                           [this](auto const& request) {
+                             return request.values_column >= 0 and
+                                    request.values_column <
+                                      static_cast<size_type>(_column_types.size());
+                           }),
+               "Request column index out of range.");
+
+  // Aggregates the rows of one partition with a regular groupby
+  auto aggregate_rows = [&](table_view const& rows) {
+    std::vector<aggregation_request> partition_requests(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+      partition_requests[i].values = rows.column(requests[i].values_column);
+      std::transform(requests[i].aggregations.begin(),
+                     requests[i].aggregations.end(),
+                     std::back_inserter(partition_requests[i].aggregations),
+                     [](auto const& agg) { return agg->clone(); });
+    }
+    groupby gb_obj(rows.select(_key_columns), _include_null_keys);
+    return gb_obj.aggregate(partition_requests, rmm::mr::get_default_resource(), stream);
+  };
+
+  std::vector<std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>> results;
+  for (auto const& partition : _partitions) {
+    std::vector<std::unique_ptr<table>> pieces;
+    for (auto const& host_tbl : partition) {
+      if (host_tbl->num_rows > 0) { pieces.push_back(detail::to_device(*host_tbl, stream)); }
+    }
+    if (pieces.empty()) { continue; }
+
+    std::vector<table_view> views;
+    std::transform(pieces.begin(), pieces.end(), std::back_inserter(views), [](auto const& piece) {
+      return piece->view();
+    });
+    if (views.size() == 1) {
+      results.push_back(aggregate_rows(views.front()));
+    } else {
+      auto const rows = cudf::detail::concatenate(views, rmm::mr::get_default_resource(), stream);
+      pieces.clear();
+      results.push_back(aggregate_rows(rows->view()));
+    }
+  }
+
+  if (results.empty()) {
+    std::vector<std::unique_ptr<column>> empty_columns;
+    std::transform(_column_types.begin(),
+                   _column_types.end(),
+                   std::back_inserter(empty_columns),
+                   [](data_type type) { return make_empty_column(type); });
+    table const empty_rows(std::move(empty_columns));
+    auto empty_results = aggregate_rows(empty_rows.view());
+    return std::make_pair(std::make_unique<table>(empty_results.first->view(), stream, mr),
+                          std::move(empty_results.second));
+  }
+
+  // Concatenate the groups of all the partitions
+  std::vector<table_view> keys;
+  std::transform(results.begin(), results.end(), std::back_inserter(keys), [](auto const& r) {
+    return r.first->view();
+  });
+  auto unique_keys = cudf::detail::concatenate(keys, mr, stream);
+
+  std::vector<aggregation_result> aggregation_results(requests.size());
+  for (size_t i = 0; i < requests.size(); ++i) {
+    for (size_t j = 0; j < requests[i].aggregations.size(); ++j) {
+      std::vector<column_view> columns;
+      std::transform(results.begin(),
+                     results.end(),
+                     std::back_inserter(columns),
+                     [i, j](auto const& r) { return r.second[i].results[j]->view(); });
+      aggregation_results[i].results.push_back(cudf::detail::concatenate(columns, mr, stream));
+    }
+  }
+
+  return std::make_pair(std::move(unique_keys), std::move(aggregation_results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_scan_util.cuh>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_count_scan(column_view const& values,
+                                         rmm::device_vector<size_type> const& group_labels,
+                                         column_view const& key_sort_order,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto result = make_fixed_width_column(
+    data_type(type_to_id<size_type>()), values.size(), mask_state::UNALLOCATED, stream, mr);
+  if (values.size() == 0) { return result; }
+
+  auto d_values      = column_device_view::create(values, stream);
+  auto const order   = key_sort_order.data<size_type>();
+  bool const skip    = null_handling == null_policy::EXCLUDE and values.has_nulls();
+  auto sorted_counts = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_values = *d_values, order, skip] __device__(size_type j) -> size_type {
+      return (not skip or d_values.is_valid(order[j])) ? 1 : 0;
+    });
+
+  thrust::inclusive_scan_by_key(
+    rmm::exec_policy(stream)->on(stream),
+    group_labels.begin(),
+    group_labels.end(),
+    sorted_counts,
+    thrust::make_permutation_iterator(result->mutable_view().data<size_type>(), order),
+    thrust::equal_to<size_type>{},
+    thrust::plus<size_type>{});
+
+  // Null values are counted as zero, so only rows outside of any group are null
+  auto null_mask = scan_null_mask(values, key_sort_order, false, mr, stream);
+  if (null_mask.second > 0) {
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+  return result;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_scan_util.cuh>
+
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_rank_scan(column_view const& values,
+                                        rmm::device_vector<size_type> const& group_labels,
+                                        rmm::device_vector<size_type> const& group_offsets,
+                                        column_view const& key_sort_order,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  auto result = make_fixed_width_column(
+    data_type(type_to_id<size_type>()), values.size(), mask_state::UNALLOCATED, stream, mr);
+  if (key_sort_order.size() == 0) {
+    if (values.size() > 0) {
+      result->set_null_mask(create_null_mask(values.size(), mask_state::ALL_NULL, stream, mr),
+                            values.size());
+    }
+    return result;
+  }
+
+  // Sort the grouped values within each group, with the group labels as the major key
+  auto grouped_values = cudf::detail::gather(table_view({values}),
+                                             key_sort_order,
+                                             cudf::detail::out_of_bounds_policy::NULLIFY,
+                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                             rmm::mr::get_default_resource(),
+                                             stream);
+  auto const labels = column_view(
+    data_type(type_to_id<size_type>()), group_labels.size(), group_labels.data().get());
+  auto const value_order = cudf::detail::sorted_order(
+    table_view({labels, grouped_values->get_column(0).view()}),
+    {order::ASCENDING, order::ASCENDING},
+    {null_order::AFTER, null_order::AFTER},
+    rmm::mr::get_default_resource(),
+    stream);
+
+  // Every sorted position starting a run of equal values holds the rank of the whole run
+  auto d_values    = table_device_view::create(grouped_values->view(), stream);
+  auto const order = value_order->view().data<size_type>();
+  auto run_starts  = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [values_equal = row_equality_comparator<true>{*d_values, *d_values, true},
+     labels       = group_labels.data().get(),
+     order] __device__(size_type k) -> size_type {
+      if (k == 0) { return 0; }
+      auto const lhs = order[k - 1];
+      auto const rhs = order[k];
+      return (labels[lhs] != labels[rhs] or not values_equal(lhs, rhs)) ? k : 0;
+    });
+  rmm::device_vector<size_type> ranks(key_sort_order.size());
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         run_starts,
+                         run_starts + ranks.size(),
+                         ranks.begin(),
+                         thrust::maximum<size_type>{});
+
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     ranks.size(),
+                     [d_result    = result->mutable_view().data<size_type>(),
+                      ranks       = ranks.data().get(),
+                      labels      = group_labels.data().get(),
+                      offsets     = group_offsets.data().get(),
+                      key_order   = key_sort_order.data<size_type>(),
+                      value_order = order] __device__(size_type k) {
+                       auto const j           = value_order[k];
+                       d_result[key_order[j]] = ranks[k] - offsets[labels[j]] + 1;
+                     });
+
+  auto null_mask = scan_null_mask(values, key_sort_order, false, mr, stream);
+  if (null_mask.second > 0) {
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+  return result;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <memory>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+/**
+ * @brief Internal API to calculate groupwise cumulative sum
+ *
+ * The result has one element per row of @p values, in the order of @p values.
+ * Rows that are not part of any group, and null values, give null results.
+ *
+ * @param values Ungrouped values to get the cumulative sum of
+ * @param group_labels ID of group that the corresponding value in sorted order belongs to
+ * @param key_sort_order Indices indicating sort order of groupby keys
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_sum_scan(column_view const& values,
+                                       rmm::device_vector<size_type> const& group_labels,
+                                       column_view const& key_sort_order,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to calculate groupwise cumulative minimum value
+ *
+ * @copydetails group_sum_scan
+ */
+std::unique_ptr<column> group_min_scan(column_view const& values,
+                                       rmm::device_vector<size_type> const& group_labels,
+                                       column_view const& key_sort_order,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to calculate groupwise cumulative maximum value
+ *
+ * @copydetails group_sum_scan
+ */
+std::unique_ptr<column> group_max_scan(column_view const& values,
+                                       rmm::device_vector<size_type> const& group_labels,
+                                       column_view const& key_sort_order,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to calculate groupwise running count of values
+ *
+ * The result has one element per row of @p values, in the order of @p values.
+ * Rows that are not part of any group give null results.
+ *
+ * @param values Ungrouped values to count
+ * @param group_labels ID of group that the corresponding value in sorted order belongs to
+ * @param key_sort_order Indices indicating sort order of groupby keys
+ * @param null_handling Exclude null values from the count if null_policy::EXCLUDE,
+ *  include them if null_policy::INCLUDE
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_count_scan(column_view const& values,
+                                         rmm::device_vector<size_type> const& group_labels,
+                                         column_view const& key_sort_order,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to calculate the rank of each value within its group
+ *
+ * Values are ranked in ascending order with nulls last; equal values get the
+ * rank of the first of them. Rows that are not part of any group give null
+ * results.
+ *
+ * @param values Ungrouped values to rank
+ * @param group_labels ID of group that the corresponding value in sorted order belongs to
+ * @param group_offsets Offsets of groups' starting points within the sorted order of the keys
+ * @param key_sort_order Indices indicating sort order of groupby keys
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_rank_scan(column_view const& values,
+                                        rmm::device_vector<size_type> const& group_labels,
+                                        rmm::device_vector<size_type> const& group_offsets,
+                                        column_view const& key_sort_order,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
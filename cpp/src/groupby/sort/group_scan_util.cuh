@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+/**
+ * @brief Computes the null mask of a groupby scan result
+ *
+ * Row `i` of the result is valid if it belongs to a group, i.e. it appears in
+ * @p key_sort_order, and, if @p skip_null_values is true, `values[i]` is valid.
+ *
+ * @return Pair of the null mask and its null count. The mask is empty if there
+ * is no null result.
+ */
+inline std::pair<rmm::device_buffer, size_type> scan_null_mask(column_view const& values,
+                                                               column_view const& key_sort_order,
+                                                               bool skip_null_values,
+                                                               rmm::mr::device_memory_resource* mr,
+                                                               cudaStream_t stream)
+{
+  bool const all_rows_grouped = key_sort_order.size() == values.size();
+  if (all_rows_grouped and not(skip_null_values and values.has_nulls())) {
+    return std::make_pair(rmm::device_buffer{0, stream, mr}, 0);
+  }
+
+  rmm::device_vector<bool> is_valid(values.size(), false);
+  auto d_values = column_device_view::create(values, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     key_sort_order.size(),
+                     [d_values = *d_values,
+                      order    = key_sort_order.data<size_type>(),
+                      is_valid = is_valid.data().get(),
+                      skip_null_values] __device__(size_type j) {
+                       auto const i = order[j];
+                       is_valid[i]  = not skip_null_values or d_values.is_valid(i);
+                     });
+  return cudf::detail::valid_if(
+    is_valid.begin(), is_valid.end(), thrust::identity<bool>{}, stream, mr);
+}
+
+/**
+ * @brief Computes a groupwise inclusive scan of aggregation `K`
+ *
+ * Values are read in the sorted order of the keys and the scan results are
+ * scattered through the same order as they are written, so the results are
+ * in the order of the ungrouped values without any further gather.
+ */
+template <aggregation::Kind K>
+struct scan_functor {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    if (K == aggregation::SUM)
+      return cudf::is_numeric<T>();
+    else if (K == aggregation::MIN or K == aggregation::MAX)
+      return cudf::is_fixed_width<T>() and is_relationally_comparable<T, T>();
+    else
+      return false;
+  }
+
+  template <typename T>
+  std::enable_if_t<is_supported<T>(), std::unique_ptr<column>> operator()(
+    column_view const& values,
+    rmm::device_vector<size_type> const& group_labels,
+    column_view const& key_sort_order,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    using OpType     = cudf::detail::corresponding_operator_t<K>;
+    using ResultType = cudf::detail::target_type_t<T, K>;
+
+    auto result = make_fixed_width_column(
+      data_type(type_to_id<ResultType>()), values.size(), mask_state::UNALLOCATED, stream, mr);
+    if (values.size() == 0) { return result; }
+
+    // Null values contribute the identity of the operator
+    auto d_values       = column_device_view::create(values, stream);
+    auto const order    = key_sort_order.data<size_type>();
+    auto const identity = OpType::template identity<ResultType>();
+    auto sorted_values  = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_values = *d_values, order, identity] __device__(size_type j) -> ResultType {
+        auto const i = order[j];
+        return d_values.is_valid(i) ? static_cast<ResultType>(d_values.element<T>(i)) : identity;
+      });
+    auto scattered_results =
+      thrust::make_permutation_iterator(result->mutable_view().data<ResultType>(), order);
+
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  group_labels.begin(),
+                                  group_labels.end(),
+                                  sorted_values,
+                                  scattered_results,
+                                  thrust::equal_to<size_type>{},
+                                  OpType{});
+
+    auto null_mask = scan_null_mask(values, key_sort_order, true, mr, stream);
+    if (null_mask.second > 0) {
+      result->set_null_mask(std::move(null_mask.first), null_mask.second);
+    }
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&... args)
+  {
+    CUDF_FAIL("Unsupported groupby scan type-agg combination");
+  }
+};
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
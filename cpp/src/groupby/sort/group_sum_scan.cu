@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_scan_util.cuh>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_sum_scan(column_view const& values,
+                                       rmm::device_vector<size_type> const& group_labels,
+                                       column_view const& key_sort_order,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  return type_dispatcher(values.type(),
+                         scan_functor<aggregation::SUM>{},
+                         values,
+                         group_labels,
+                         key_sort_order,
+                         mr,
+                         stream);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -27,6 +27,9 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/tdigest.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/table/table.hpp>
@@ -369,6 +372,53 @@ void store_result_functor::operator()<aggregation::NUNIQUE>(aggregation const& a
   cache.add_result(col_idx, agg, std::move(result));
 };
 
+template <>
+void store_result_functor::operator()<aggregation::APPROX_NUNIQUE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto approx_nunique_agg = static_cast<cudf::detail::approx_nunique_aggregation const&>(agg);
+
+  // Sketches only need the group of each row, the values are neither sorted nor gathered
+  auto const sketches =
+    cudf::detail::hyperloglog_sketches(values,
+                                       helper.key_sort_order().data<size_type>(),
+                                       helper.group_labels().data().get(),
+                                       helper.num_keys(),
+                                       helper.num_groups(),
+                                       approx_nunique_agg._precision,
+                                       approx_nunique_agg._null_handling,
+                                       rmm::mr::get_default_resource(),
+                                       stream);
+  cache.add_result(
+    col_idx,
+    agg,
+    cudf::detail::hyperloglog_estimate(*sketches, approx_nunique_agg._precision, mr, stream));
+};
+
+template <>
+void store_result_functor::operator()<aggregation::APPROX_QUANTILE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto approx_quantile_agg = static_cast<cudf::detail::approx_quantile_aggregation const&>(agg);
+
+  // The t-digests sort the values of the rows of every group as doubles, and keep only a bounded
+  // number of centroids per group
+  auto const digests = cudf::detail::group_tdigests(values,
+                                                    helper.key_sort_order().data<size_type>(),
+                                                    helper.group_labels().data().get(),
+                                                    helper.num_keys(),
+                                                    helper.num_groups(),
+                                                    approx_quantile_agg._compression,
+                                                    rmm::mr::get_default_resource(),
+                                                    stream);
+  cache.add_result(
+    col_idx,
+    agg,
+    cudf::detail::tdigest_quantiles(digests->view(), approx_quantile_agg._quantiles, mr, stream));
+};
+
 template <>
 void store_result_functor::operator()<aggregation::NTH_ELEMENT>(aggregation const& agg)
 {
@@ -410,6 +460,7 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
   // sum and count. std depends on mean and count
   cudf::detail::result_cache cache(requests.size());
 
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby_sort_aggregate", requests.size());
   for (size_t i = 0; i < requests.size(); i++) {
     auto store_functor =
       detail::store_result_functor(i, requests[i].values, helper(), cache, stream, mr);
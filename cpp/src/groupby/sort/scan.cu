@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_scan.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+/// Computes the groupwise scan of one aggregation on the values of a request
+std::unique_ptr<column> scan_aggregation(column_view const& values,
+                                         aggregation const& agg,
+                                         sort::sort_groupby_helper& helper,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto const& group_labels = helper.group_labels(stream);
+  auto const key_order     = helper.key_sort_order(stream);
+  switch (agg.kind) {
+    case aggregation::SUM: return group_sum_scan(values, group_labels, key_order, mr, stream);
+    case aggregation::MIN: return group_min_scan(values, group_labels, key_order, mr, stream);
+    case aggregation::MAX: return group_max_scan(values, group_labels, key_order, mr, stream);
+    case aggregation::COUNT_VALID:
+      return group_count_scan(values, group_labels, key_order, null_policy::EXCLUDE, mr, stream);
+    case aggregation::COUNT_ALL:
+      return group_count_scan(values, group_labels, key_order, null_policy::INCLUDE, mr, stream);
+    case aggregation::RANK:
+      return group_rank_scan(
+        values, group_labels, helper.group_offsets(stream), key_order, mr, stream);
+    default: CUDF_FAIL("Unsupported groupby scan aggregation");
+  }
+}
+}  // namespace
+}  // namespace detail
+
+// Sort-based groupby scan
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort_scan(
+  std::vector<aggregation_request> const& requests,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<aggregation_result> results(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    for (auto const& agg : requests[i].aggregations) {
+      results[i].results.push_back(
+        detail::scan_aggregation(requests[i].values, *agg, helper(), mr, stream));
+    }
+  }
+
+  return std::make_pair(std::make_unique<table>(_keys, stream, mr), std::move(results));
+}
+}  // namespace groupby
+}  // namespace cudf
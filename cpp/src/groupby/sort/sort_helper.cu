@@ -20,15 +20,19 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 
 #include <thrust/binary_search.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/partition.h>
 #include <thrust/scan.h>
 #include <thrust/sequence.h>
 #include <thrust/unique.h>
@@ -43,20 +47,20 @@ namespace {
  * ordered according to a specified permutation map.
  *
  */
-template <bool nullable = true>
+template <typename Comparator>
 struct permuted_row_equality_comparator {
-  cudf::row_equality_comparator<nullable> _comparator;
+  Comparator _comparator;
   cudf::size_type const* _map;
 
   /**
    * @brief Construct a permuted_row_equality_comparator.
    *
-   * @param t The `table` whose rows will be compared
+   * @param comparator The comparator of the rows of the `table`
    * @param map The permutation map that specifies the effective ordering of
    *`t`. Must be the same size as `t.num_rows()`
    */
-  permuted_row_equality_comparator(cudf::table_device_view const& t, cudf::size_type const* map)
-    : _comparator(t, t, true), _map{map}
+  permuted_row_equality_comparator(Comparator comparator, cudf::size_type const* map)
+    : _comparator(comparator), _map{map}
   {
   }
 
@@ -108,12 +112,14 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
 
   if (_key_sorted_order) { return sliced_key_sorted_order(); }
 
-  // TODO (dm): optimization. When keys are pre sorted but ignore nulls is true,
-  //            we still want all rows with nulls in the end. Sort is costly, so
-  //            do a copy_if(counting, sorted_order, {bitmask.is_valid(i)})
+  CUDF_SCOPED_RANGE_PAYLOAD("groupby_sort", _keys.num_rows());
+
   if (_keys_pre_sorted == sorted::YES) {
-    _key_sorted_order = make_numeric_column(
-      data_type(type_to_id<size_type>()), _keys.num_rows(), mask_state::UNALLOCATED, stream);
+    _key_sorted_order = make_numeric_column(data_type(type_to_id<size_type>()),
+                                            _keys.num_rows(),
+                                            mask_state::UNALLOCATED,
+                                            stream,
+                                            _scratch.get());
 
     auto d_key_sorted_order = _key_sorted_order->mutable_view().data<size_type>();
 
@@ -122,16 +128,27 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
                      d_key_sorted_order + _key_sorted_order->size(),
                      0);
 
+    // Dropping the rows with null keys keeps the other rows grouped, so moving them to the
+    // end of the order is enough to exclude them, without sorting.
+    if (num_keys(stream) < _keys.num_rows()) {
+      auto row_bitmask = keys_bitmask_column(stream).null_mask();
+      thrust::stable_partition(
+        rmm::exec_policy(stream)->on(stream),
+        d_key_sorted_order,
+        d_key_sorted_order + _key_sorted_order->size(),
+        [row_bitmask] __device__(size_type i) { return bit_is_set(row_bitmask, i); });
+    }
+
     return sliced_key_sorted_order();
   }
 
   if (_include_null_keys == null_policy::INCLUDE || !cudf::has_nulls(_keys)) {  // SQL style
-    _key_sorted_order =
-      cudf::detail::sorted_order(_keys,
-                                 {},
-                                 std::vector<null_order>(_keys.num_columns(), null_order::AFTER),
-                                 rmm::mr::get_default_resource(),
-                                 stream);
+    _key_sorted_order = cudf::detail::stable_sorted_order(
+      _keys,
+      {},
+      std::vector<null_order>(_keys.num_columns(), null_order::AFTER),
+      _scratch.get(),
+      stream);
   } else {  // Pandas style
     // Temporarily prepend the keys table with a column that indicates the
     // presence of a null value within a row. This allows moving all rows that
@@ -139,11 +156,11 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
 
     auto augmented_keys = table_view({table_view({keys_bitmask_column()}), _keys});
 
-    _key_sorted_order = cudf::detail::sorted_order(
+    _key_sorted_order = cudf::detail::stable_sorted_order(
       augmented_keys,
       {},
       std::vector<null_order>(_keys.num_columns() + 1, null_order::AFTER),
-      rmm::mr::get_default_resource(),
+      _scratch.get(),
       stream);
 
     // All rows with one or more null values are at the end of the resulting sorted order.
@@ -152,32 +169,41 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
   return sliced_key_sorted_order();
 }
 
+bool sort_groupby_helper::is_identity_sort_order(cudaStream_t stream)
+{
+  return _keys_pre_sorted == sorted::YES and num_keys(stream) == _keys.num_rows();
+}
+
 sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(cudaStream_t stream)
 {
   if (_group_offsets) return *_group_offsets;
 
   _group_offsets = std::make_unique<index_vector>(num_keys(stream) + 1);
 
-  auto device_input_table = table_device_view::create(_keys, stream);
-  auto sorted_order       = key_sort_order().data<size_type>();
-  decltype(_group_offsets->begin()) result_end;
-  auto exec = rmm::exec_policy(stream);
+  auto sorted_order = key_sort_order().data<size_type>();
+  auto exec         = rmm::exec_policy(stream);
 
-  if (has_nulls(_keys)) {
-    result_end = thrust::unique_copy(
-      exec->on(stream),
-      thrust::make_counting_iterator<size_type>(0),
-      thrust::make_counting_iterator<size_type>(num_keys(stream)),
-      _group_offsets->begin(),
-      permuted_row_equality_comparator<true>(*device_input_table, sorted_order));
-  } else {
-    result_end = thrust::unique_copy(
-      exec->on(stream),
-      thrust::make_counting_iterator<size_type>(0),
-      thrust::make_counting_iterator<size_type>(num_keys(stream)),
-      _group_offsets->begin(),
-      permuted_row_equality_comparator<false>(*device_input_table, sorted_order));
-  }
+  auto unique_rows = [&](auto row_equal) {
+    return thrust::unique_copy(exec->on(stream),
+                               thrust::make_counting_iterator<size_type>(0),
+                               thrust::make_counting_iterator<size_type>(num_keys(stream)),
+                               _group_offsets->begin(),
+                               row_equal);
+  };
+
+  // Keys in their own order are compared directly, without going through the sort order
+  auto const identity_order = is_identity_sort_order(stream);
+  auto const result_end     = dispatch_row_equality_comparator(
+    _keys,
+    _keys,
+    true,
+    [&](auto row_equal) {
+      using comparator_type = decltype(row_equal);
+      return identity_order ? unique_rows(row_equal)
+                            : unique_rows(permuted_row_equality_comparator<comparator_type>(
+                                row_equal, sorted_order));
+    },
+    stream);
 
   size_type num_groups          = thrust::distance(_group_offsets->begin(), result_end);
   (*_group_offsets)[num_groups] = num_keys(stream);
@@ -214,8 +240,11 @@ column_view sort_groupby_helper::unsorted_keys_labels(cudaStream_t stream)
 {
   if (_unsorted_keys_labels) return _unsorted_keys_labels->view();
 
-  column_ptr temp_labels = make_numeric_column(
-    data_type(type_to_id<size_type>()), _keys.num_rows(), mask_state::ALL_NULL, stream);
+  column_ptr temp_labels = make_numeric_column(data_type(type_to_id<size_type>()),
+                                               _keys.num_rows(),
+                                               mask_state::ALL_NULL,
+                                               stream,
+                                               _scratch.get());
 
   auto group_labels_view = cudf::column_view(
     data_type(type_to_id<size_type>()), group_labels().size(), group_labels().data().get());
@@ -227,7 +256,7 @@ column_view sort_groupby_helper::unsorted_keys_labels(cudaStream_t stream)
                           scatter_map,
                           table_view({temp_labels->view()}),
                           false,
-                          rmm::mr::get_default_resource(),
+                          _scratch.get(),
                           stream);
 
   _unsorted_keys_labels = std::move(t_unsorted_keys_labels->release()[0]);
@@ -239,13 +268,14 @@ column_view sort_groupby_helper::keys_bitmask_column(cudaStream_t stream)
 {
   if (_keys_bitmask_column) return _keys_bitmask_column->view();
 
-  auto row_bitmask = bitmask_and(_keys, rmm::mr::get_default_resource(), stream);
+  auto row_bitmask = bitmask_and(_keys, _scratch.get(), stream);
 
   _keys_bitmask_column = make_numeric_column(data_type(type_id::INT8),
                                              _keys.num_rows(),
                                              std::move(row_bitmask),
                                              cudf::UNKNOWN_NULL_COUNT,
-                                             stream);
+                                             stream,
+                                             _scratch.get());
 
   auto keys_bitmask_view = _keys_bitmask_column->mutable_view();
   using T                = id_to_type<type_id::INT8>;
@@ -283,6 +313,8 @@ sort_groupby_helper::column_ptr sort_groupby_helper::sorted_values(
 sort_groupby_helper::column_ptr sort_groupby_helper::grouped_values(
   column_view const& values, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
+  if (is_identity_sort_order(stream)) { return std::make_unique<column>(values, stream, mr); }
+
   auto gather_map = key_sort_order();
 
   auto grouped_values_table = cudf::detail::gather(table_view({values}),
@@ -310,6 +342,8 @@ std::unique_ptr<table> sort_groupby_helper::unique_keys(rmm::mr::device_memory_r
 std::unique_ptr<table> sort_groupby_helper::sorted_keys(rmm::mr::device_memory_resource* mr,
                                                         cudaStream_t stream)
 {
+  if (is_identity_sort_order(stream)) { return std::make_unique<table>(_keys, stream, mr); }
+
   return cudf::detail::gather(_keys,
                               key_sort_order(),
                               cudf::detail::out_of_bounds_policy::NULLIFY,
@@ -0,0 +1,445 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/pair.h>
+
+#include <cooperative_groups.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Hash map with unique keys using bucketed open addressing, probed by tiles of threads.
+ *
+ * The slots are grouped into buckets of `tile_size` consecutive slots. Every key is inserted or
+ * looked up by a cooperative group of `tile_size` threads of a warp: each thread of the tile
+ * loads one slot of the current bucket, so a bucket is read with one coalesced load, and the
+ * tile votes on whether the key or an empty slot is in the bucket before moving on to the next
+ * bucket. Compared to probing one slot per thread, a probe sequence touches `tile_size` times
+ * fewer cache lines and long probe sequences are shared by the threads of the tile.
+ *
+ * Keys and values are stored in separate arrays, so that buckets of narrow keys fit in fewer
+ * cache lines, and only the key is swapped in atomically: any key and value types are supported
+ * as long as there is an `atomicCAS` for the key type. A value is written after its key, so
+ * `find` must not run concurrently with the `insert` of the same key.
+ *
+ * The map is sized for a number of keys at a load factor when it is created, and can be grown
+ * with `rehash`.
+ *
+ * @tparam Key Type of the keys, e.g. row indices
+ * @tparam Value Type of the values
+ * @tparam Hasher Functor returning the hash value of a key
+ * @tparam KeyEqual Functor comparing two keys that are not `empty_key`
+ * @tparam tile_size Number of threads probing for a key, and of slots per bucket
+ */
+template <typename Key, typename Value, typename Hasher, typename KeyEqual, int tile_size = 4>
+class bucketed_hash_map {
+  static_assert(tile_size > 0 and tile_size <= 32 and (tile_size & (tile_size - 1)) == 0,
+                "The tile size must be a power of two of at most a warp");
+
+ public:
+  using key_type    = Key;
+  using mapped_type = Value;
+  using tile_type   = cooperative_groups::thread_block_tile<tile_size>;
+
+  static constexpr int bucket_size = tile_size;
+
+  /**
+   * @brief Non-owning view of the map, usable in device code
+   */
+  class device_view {
+   public:
+    device_view(Key* keys,
+                Value* values,
+                size_t num_buckets,
+                Key empty_key,
+                Hasher hasher,
+                KeyEqual key_equal)
+      : m_keys{keys},
+        m_values{values},
+        m_num_buckets{num_buckets},
+        m_empty_key{empty_key},
+        m_hasher{hasher},
+        m_key_equal{key_equal}
+    {
+    }
+
+    /**
+     * @brief Inserts a key and its value unless an equal key is already in the map.
+     *
+     * Must be called by all the threads of `tile` with the same key and value. Inserting
+     * `empty_key` is a no-op.
+     *
+     * @returns Pointer to the value of the inserted or equal key, or `nullptr` if the map is
+     * full or `key` is `empty_key`, and whether `key` was inserted
+     */
+    __device__ thrust::pair<Value*, bool> insert(tile_type const& tile,
+                                                 Key const& key,
+                                                 Value const& value) const
+    {
+      if (key == m_empty_key) { return thrust::make_pair(nullptr, false); }
+      auto bucket = m_hasher(key) % m_num_buckets;
+      for (size_t probes = 0; probes < m_num_buckets;) {
+        auto const slot     = bucket * bucket_size + tile.thread_rank();
+        Key const existing  = load_key(slot);
+        auto const is_equal = existing != m_empty_key and m_key_equal(key, existing);
+        if (auto const equal_lanes = tile.ballot(is_equal)) {
+          return thrust::make_pair(value_of(bucket, __ffs(equal_lanes) - 1), false);
+        }
+
+        auto const empty_lanes = tile.ballot(existing == m_empty_key);
+        if (empty_lanes == 0) {
+          bucket = (bucket + 1) % m_num_buckets;
+          ++probes;
+          continue;
+        }
+
+        // The first thread with an empty slot tries to claim it for the whole tile
+        auto const leader = __ffs(empty_lanes) - 1;
+        Key previous      = m_empty_key;
+        if (tile.thread_rank() == leader) {
+          previous = atomicCAS(m_keys + slot, m_empty_key, key);
+          if (previous == m_empty_key) { m_values[slot] = value; }
+        }
+        previous = tile.shfl(previous, leader);
+        if (previous == m_empty_key) { return thrust::make_pair(value_of(bucket, leader), true); }
+        if (m_key_equal(key, previous)) {
+          return thrust::make_pair(value_of(bucket, leader), false);
+        }
+        // Another key took the slot, probe the same bucket again
+      }
+      return thrust::make_pair(nullptr, false);
+    }
+
+    /**
+     * @brief Finds the value of the key equal to `probe`, which can be of another type than the
+     * keys, e.g. the index of a row of another table.
+     *
+     * Must be called by all the threads of `tile` with the same arguments.
+     *
+     * @param probe The key to look up
+     * @param probe_hash Hash value of `probe`, computed like the hash values of the keys
+     * @param probe_equal Functor comparing `probe` with a key of the map
+     * @returns Pointer to the value of the key equal to `probe`, or `nullptr` if there is none
+     */
+    template <typename ProbeKey, typename ProbeEqual>
+    __device__ Value* find(tile_type const& tile,
+                           ProbeKey const& probe,
+                           size_t probe_hash,
+                           ProbeEqual const& probe_equal) const
+    {
+      auto bucket = probe_hash % m_num_buckets;
+      for (size_t probes = 0; probes < m_num_buckets; ++probes) {
+        Key const existing = load_key(bucket * bucket_size + tile.thread_rank());
+        auto const is_equal = existing != m_empty_key and probe_equal(probe, existing);
+        if (auto const equal_lanes = tile.ballot(is_equal)) {
+          return value_of(bucket, __ffs(equal_lanes) - 1);
+        }
+        // A key is never past an empty slot of its probe sequence
+        if (tile.any(existing == m_empty_key)) { return nullptr; }
+        bucket = (bucket + 1) % m_num_buckets;
+      }
+      return nullptr;
+    }
+
+    /**
+     * @brief Finds the value of `key`.
+     *
+     * Must be called by all the threads of `tile` with the same key.
+     *
+     * @returns Pointer to the value of `key`, or `nullptr` if `key` is not in the map
+     */
+    __device__ Value* find(tile_type const& tile, Key const& key) const
+    {
+      if (key == m_empty_key) { return nullptr; }
+      return find(tile, key, m_hasher(key), m_key_equal);
+    }
+
+    /**
+     * @brief Returns the number of slots of the map.
+     */
+    __host__ __device__ size_t capacity() const noexcept { return m_num_buckets * bucket_size; }
+
+   private:
+    __device__ Key load_key(size_t slot) const
+    {
+      return *reinterpret_cast<Key const volatile*>(m_keys + slot);
+    }
+
+    __device__ Value* value_of(size_t bucket, int lane) const
+    {
+      return m_values + bucket * bucket_size + lane;
+    }
+
+    Key* m_keys;
+    Value* m_values;
+    size_t m_num_buckets;
+    Key m_empty_key;
+    Hasher m_hasher;
+    KeyEqual m_key_equal;
+  };
+
+  bucketed_hash_map() = delete;
+
+  /**
+   * @brief Creates an empty map with room for `num_keys` keys at `load_factor`.
+   *
+   * @throws cudf::logic_error if `load_factor` is not in `(0, 1]`
+   *
+   * @param num_keys The number of keys the map is sized for
+   * @param load_factor The ratio of the number of keys to the number of slots
+   * @param empty_key Sentinel of the empty slots, it cannot be inserted
+   * @param empty_value Value of the empty slots
+   * @param hasher Functor returning the hash value of a key
+   * @param key_equal Functor comparing two keys
+   * @param stream CUDA stream used to initialize the slots
+   */
+  bucketed_hash_map(size_type num_keys,
+                    double load_factor,
+                    Key empty_key,
+                    Value empty_value,
+                    Hasher hasher,
+                    KeyEqual key_equal,
+                    cudaStream_t stream = 0)
+    : m_load_factor{load_factor},
+      m_empty_key{empty_key},
+      m_empty_value{empty_value},
+      m_hasher{hasher},
+      m_key_equal{key_equal}
+  {
+    CUDF_EXPECTS(load_factor > 0 and load_factor <= 1, "The load factor must be in (0, 1]");
+    allocate(num_keys, stream);
+  }
+
+  /**
+   * @brief Returns the number of slots of the map.
+   */
+  size_t capacity() const noexcept { return m_keys.size(); }
+
+  /**
+   * @brief Returns the load factor the map is sized with.
+   */
+  double load_factor() const noexcept { return m_load_factor; }
+
+  device_view view()
+  {
+    return device_view{m_keys.data().get(),
+                       m_values.data().get(),
+                       m_keys.size() / bucket_size,
+                       m_empty_key,
+                       m_hasher,
+                       m_key_equal};
+  }
+
+  /**
+   * @brief Inserts `thrust::pair<Key, Value>` elements, keeping the first value inserted for
+   * equal keys.
+   *
+   * @param first Beginning of the pairs to insert
+   * @param last End of the pairs to insert
+   * @param stream CUDA stream used for the insertion kernel
+   */
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last, cudaStream_t stream = 0);
+
+  /**
+   * @brief For each probe key, writes whether an equal key is in the map.
+   *
+   * @param first Beginning of the probe keys
+   * @param last End of the probe keys
+   * @param output Beginning of the `bool` results
+   * @param probe_hasher Functor returning the hash value of a probe key, computed like the hash
+   * values of the keys
+   * @param probe_equal Functor comparing a probe key with a key of the map
+   * @param stream CUDA stream used for the lookup kernel
+   */
+  template <typename InputIt, typename OutputIt, typename ProbeHasher, typename ProbeEqual>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output,
+                ProbeHasher probe_hasher,
+                ProbeEqual probe_equal,
+                cudaStream_t stream = 0);
+
+  /**
+   * @brief Grows the map to hold `num_keys` keys at its load factor, reinserting its keys.
+   *
+   * Does nothing if the map already has at least that many slots.
+   *
+   * @param num_keys The number of keys the map is sized for
+   * @param stream CUDA stream used for the reinsertion kernel
+   */
+  void rehash(size_type num_keys, cudaStream_t stream = 0);
+
+ private:
+  static constexpr int block_size = 128;
+
+  static size_t num_slots(size_type num_keys, double load_factor)
+  {
+    auto const slots = static_cast<size_t>(std::ceil(num_keys / load_factor));
+    return std::max<size_t>(util::round_up_safe<size_t>(slots, bucket_size), bucket_size);
+  }
+
+  static int num_blocks(size_t num_tiles)
+  {
+    return static_cast<int>(
+      std::max<size_t>(util::div_rounding_up_safe<size_t>(num_tiles * tile_size, block_size), 1));
+  }
+
+  void allocate(size_type num_keys, cudaStream_t stream)
+  {
+    auto const slots = num_slots(num_keys, m_load_factor);
+    m_keys           = rmm::device_vector<Key>(slots);
+    m_values         = rmm::device_vector<Value>(slots);
+    thrust::fill(rmm::exec_policy(stream)->on(stream), m_keys.begin(), m_keys.end(), m_empty_key);
+    thrust::fill(
+      rmm::exec_policy(stream)->on(stream), m_values.begin(), m_values.end(), m_empty_value);
+  }
+
+  double m_load_factor;
+  Key m_empty_key;
+  Value m_empty_value;
+  Hasher m_hasher;
+  KeyEqual m_key_equal;
+  rmm::device_vector<Key> m_keys;
+  rmm::device_vector<Value> m_values;
+};
+
+namespace bucketed_hash_map_kernels {
+/**
+ * @brief Inserts the pairs in `[first, first + num_pairs)`, one tile of threads per pair.
+ */
+template <int tile_size, typename View, typename InputIt>
+__global__ void insert(View map, InputIt first, size_t num_pairs)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  auto const tile_index = (static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x) / tile_size;
+  auto const num_tiles  = static_cast<size_t>(gridDim.x) * blockDim.x / tile_size;
+  for (auto i = tile_index; i < num_pairs; i += num_tiles) {
+    auto const pair = *(first + i);
+    map.insert(tile, pair.first, pair.second);
+  }
+}
+
+/**
+ * @brief Writes whether each probe key in `[first, first + num_keys)` is in the map, one tile
+ * of threads per probe key.
+ */
+template <int tile_size,
+          typename View,
+          typename InputIt,
+          typename OutputIt,
+          typename ProbeHasher,
+          typename ProbeEqual>
+__global__ void contains(View map,
+                         InputIt first,
+                         size_t num_keys,
+                         OutputIt output,
+                         ProbeHasher probe_hasher,
+                         ProbeEqual probe_equal)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<tile_size>(cooperative_groups::this_thread_block());
+  auto const tile_index = (static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x) / tile_size;
+  auto const num_tiles  = static_cast<size_t>(gridDim.x) * blockDim.x / tile_size;
+  for (auto i = tile_index; i < num_keys; i += num_tiles) {
+    auto const probe = *(first + i);
+    auto const found = map.find(tile, probe, probe_hasher(probe), probe_equal) != nullptr;
+    if (tile.thread_rank() == 0) { *(output + i) = found; }
+  }
+}
+
+/**
+ * @brief Returns the key and value of a slot as a pair.
+ */
+template <typename Key, typename Value>
+struct slot_to_pair {
+  Key const* keys;
+  Value const* values;
+
+  __device__ thrust::pair<Key, Value> operator()(size_t slot) const
+  {
+    return thrust::make_pair(keys[slot], values[slot]);
+  }
+};
+
+}  // namespace bucketed_hash_map_kernels
+
+template <typename Key, typename Value, typename Hasher, typename KeyEqual, int tile_size>
+template <typename InputIt>
+void bucketed_hash_map<Key, Value, Hasher, KeyEqual, tile_size>::insert(InputIt first,
+                                                                        InputIt last,
+                                                                        cudaStream_t stream)
+{
+  auto const num_pairs = static_cast<size_t>(thrust::distance(first, last));
+  if (num_pairs == 0) { return; }
+  bucketed_hash_map_kernels::insert<tile_size>
+    <<<num_blocks(num_pairs), block_size, 0, stream>>>(view(), first, num_pairs);
+  CHECK_CUDA(stream);
+}
+
+template <typename Key, typename Value, typename Hasher, typename KeyEqual, int tile_size>
+template <typename InputIt, typename OutputIt, typename ProbeHasher, typename ProbeEqual>
+void bucketed_hash_map<Key, Value, Hasher, KeyEqual, tile_size>::contains(
+  InputIt first,
+  InputIt last,
+  OutputIt output,
+  ProbeHasher probe_hasher,
+  ProbeEqual probe_equal,
+  cudaStream_t stream)
+{
+  auto const num_keys = static_cast<size_t>(thrust::distance(first, last));
+  if (num_keys == 0) { return; }
+  bucketed_hash_map_kernels::contains<tile_size><<<num_blocks(num_keys), block_size, 0, stream>>>(
+    view(), first, num_keys, output, probe_hasher, probe_equal);
+  CHECK_CUDA(stream);
+}
+
+template <typename Key, typename Value, typename Hasher, typename KeyEqual, int tile_size>
+void bucketed_hash_map<Key, Value, Hasher, KeyEqual, tile_size>::rehash(size_type num_keys,
+                                                                        cudaStream_t stream)
+{
+  if (num_slots(num_keys, m_load_factor) <= capacity()) { return; }
+  auto const old_keys   = std::move(m_keys);
+  auto const old_values = std::move(m_values);
+  allocate(num_keys, stream);
+  auto const old_pairs = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_t>(0),
+    bucketed_hash_map_kernels::slot_to_pair<Key, Value>{old_keys.data().get(),
+                                                        old_values.data().get()});
+  // The empty slots hold `empty_key`, which is not inserted
+  insert(old_pairs, old_pairs + old_keys.size(), stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+}
+
+}  // namespace detail
+}  // namespace cudf
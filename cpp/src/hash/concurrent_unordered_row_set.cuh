@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/types.hpp>
+#include <hash/helper_functions.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Set of distinct rows of a table, stored as the index of one row per distinct value.
+ *
+ * The set uses open addressing with linear probing, and each slot only holds a row index, so
+ * that inserting duplicate rows does not use any memory and probing never has to skip them.
+ *
+ * @tparam Hasher Functor returning the hash value of a row index of the inserted table
+ * @tparam Equality Functor comparing two row indices of the inserted table
+ */
+template <typename Hasher, typename Equality>
+class concurrent_unordered_row_set {
+ public:
+  static constexpr size_type empty_slot = -1;
+
+  /**
+   * @brief Non-owning view of the set, usable in device code
+   */
+  class device_view {
+   public:
+    device_view(size_type* slots, size_t capacity, Hasher hasher, Equality equality)
+      : m_slots{slots}, m_capacity{capacity}, m_hasher{hasher}, m_equality{equality}
+    {
+    }
+
+    /**
+     * @brief Inserts a row unless an equal row is already in the set.
+     *
+     * @returns Whether the row was inserted
+     */
+    __device__ bool insert(size_type row) const
+    {
+      size_t slot = m_hasher(row) % m_capacity;
+      while (true) {
+        auto const existing = atomicCAS(m_slots + slot, empty_slot, row);
+        if (existing == empty_slot) { return true; }
+        if (m_equality(existing, row)) { return false; }
+        slot = (slot + 1) % m_capacity;
+      }
+    }
+
+    /**
+     * @brief Inserts a row unless an equal row is already in the set.
+     *
+     * @returns The index of the row in the set equal to `row`, which is `row` if it was inserted
+     */
+    __device__ size_type insert_or_find(size_type row) const
+    {
+      size_t slot = m_hasher(row) % m_capacity;
+      while (true) {
+        auto const existing = atomicCAS(m_slots + slot, empty_slot, row);
+        if (existing == empty_slot) { return row; }
+        if (m_equality(existing, row)) { return existing; }
+        slot = (slot + 1) % m_capacity;
+      }
+    }
+
+    /**
+     * @brief Returns whether the set contains a row equal to a row of another table.
+     *
+     * @param probe_row Row index in the probe table
+     * @param probe_hash Hash value of the probe row, computed like the hash of the inserted rows
+     * @param equality Functor comparing a probe row index with an inserted row index
+     */
+    template <typename ProbeEquality>
+    __device__ bool contains(size_type probe_row,
+                             std::size_t probe_hash,
+                             ProbeEquality const& equality) const
+    {
+      size_t slot = probe_hash % m_capacity;
+      while (true) {
+        auto const existing = m_slots[slot];
+        if (existing == empty_slot) { return false; }
+        if (equality(probe_row, existing)) { return true; }
+        slot = (slot + 1) % m_capacity;
+      }
+    }
+
+   private:
+    size_type* m_slots;
+    size_t m_capacity;
+    Hasher m_hasher;
+    Equality m_equality;
+  };
+
+  /**
+   * @brief Creates an empty set sized for `num_rows` rows at the default hash table occupancy.
+   */
+  concurrent_unordered_row_set(size_type num_rows,
+                               Hasher hasher,
+                               Equality equality,
+                               cudaStream_t stream)
+    : m_slots(std::max<size_t>(compute_hash_table_size(num_rows), 1)),
+      m_hasher{hasher},
+      m_equality{equality}
+  {
+    thrust::fill(
+      rmm::exec_policy(stream)->on(stream), m_slots.begin(), m_slots.end(), empty_slot);
+  }
+
+  device_view view()
+  {
+    return device_view{m_slots.data().get(), m_slots.size(), m_hasher, m_equality};
+  }
+
+ private:
+  rmm::device_vector<size_type> m_slots;
+  Hasher m_hasher;
+  Equality m_equality;
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -633,14 +633,25 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
-std::unique_ptr<column> hash(table_view const& input,
-                             std::vector<uint32_t> const& initial_hash,
-                             rmm::mr::device_memory_resource* mr,
-                             cudaStream_t stream)
+namespace {
+/**
+ * @brief Computes the hash value of each row of `input` with `hash_function`.
+ *
+ * The hash values are stored in a signed integer column as wide as the hash values.
+ */
+template <template <typename> class hash_function>
+std::unique_ptr<column> hash_rows(table_view const& input,
+                                  std::vector<uint32_t> const& initial_hash,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
 {
-  // TODO this should be UINT32
-  auto output =
-    make_numeric_column(data_type(INT32), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  using hash_type   = typename row_hasher<hash_function>::result_type;
+  using output_type = std::make_signed_t<hash_type>;
+  auto output       = make_numeric_column(data_type(type_to_id<output_type>()),
+                                    input.num_rows(),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
 
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
@@ -653,46 +664,68 @@ std::unique_ptr<column> hash(table_view const& input,
   if (!initial_hash.empty()) {
     CUDF_EXPECTS(initial_hash.size() == size_t(input.num_columns()),
                  "Expected same size of initial hash values as number of columns");
-    auto device_initial_hash = rmm::device_vector<uint32_t>(initial_hash);
+    using initial_hash_type  = typename row_hasher_initial_values<hash_function>::result_type;
+    auto device_initial_hash =
+      rmm::device_vector<initial_hash_type>(initial_hash.begin(), initial_hash.end());
 
     if (nullable) {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher_initial_values<MurmurHash3_32, true>(
+                       output_view.begin<output_type>(),
+                       output_view.end<output_type>(),
+                       row_hasher_initial_values<hash_function, true>(
                          *device_input, device_initial_hash.data().get()));
     } else {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher_initial_values<MurmurHash3_32, false>(
+                       output_view.begin<output_type>(),
+                       output_view.end<output_type>(),
+                       row_hasher_initial_values<hash_function, false>(
                          *device_input, device_initial_hash.data().get()));
     }
   } else {
     if (nullable) {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, true>(*device_input));
+                       output_view.begin<output_type>(),
+                       output_view.end<output_type>(),
+                       row_hasher<hash_function, true>(*device_input));
     } else {
       thrust::tabulate(rmm::exec_policy(stream)->on(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, false>(*device_input));
+                       output_view.begin<output_type>(),
+                       output_view.end<output_type>(),
+                       row_hasher<hash_function, false>(*device_input));
     }
   }
 
   return output;
 }
 
+}  // namespace
+
+std::unique_ptr<column> hash(table_view const& input,
+                             std::vector<uint32_t> const& initial_hash,
+                             hash_id hash_function,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  // TODO the hash values should be unsigned
+  switch (hash_function) {
+    case hash_id::HASH_MURMUR3: return hash_rows<MurmurHash3_32>(input, initial_hash, mr, stream);
+    case hash_id::HASH_XXHASH64: return hash_rows<XXHash_64>(input, initial_hash, mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      CUDF_EXPECTS(initial_hash.empty(), "Spark hashing does not support initial hash values");
+      return hash_rows<SparkMurmurHash3_32>(input, {}, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function");
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash,
+                             hash_id hash_function,
                              rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::hash(input, initial_hash, mr);
+  return detail::hash(input, initial_hash, hash_function, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/arrow_device.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace cudf {
+namespace {
+/**
+ * @brief Releases an exported Arrow structure and frees it
+ */
+struct release_deleter {
+  template <typename T>
+  void operator()(T* arrow) const
+  {
+    if (arrow->release != nullptr) { arrow->release(arrow); }
+    delete arrow;
+  }
+};
+
+template <typename T>
+using unique_arrow_ptr = std::unique_ptr<T, release_deleter>;
+
+/**
+ * @brief Returns the Arrow format string of a type that is stored as-is.
+ */
+std::string arrow_format(data_type type)
+{
+  switch (type.id()) {
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::BOOL8: return "b";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    // An Arrow decimal scale counts the fractional digits
+    case type_id::DECIMAL32: return "d:9," + std::to_string(-type.scale()) + ",32";
+    case type_id::DECIMAL64: return "d:18," + std::to_string(-type.scale()) + ",64";
+    case type_id::STRING: return "u";
+    case type_id::LIST: return "+l";
+    default: CUDF_FAIL("Unsupported type for the Arrow C data interface");
+  }
+}
+
+/**
+ * @brief Returns the type of the Arrow format string of a non-nested array.
+ */
+data_type to_data_type(std::string const& format)
+{
+  static std::vector<std::pair<std::string, type_id>> const formats{
+    {"c", type_id::INT8},
+    {"s", type_id::INT16},
+    {"i", type_id::INT32},
+    {"l", type_id::INT64},
+    {"C", type_id::UINT8},
+    {"S", type_id::UINT16},
+    {"I", type_id::UINT32},
+    {"L", type_id::UINT64},
+    {"f", type_id::FLOAT32},
+    {"g", type_id::FLOAT64},
+    {"b", type_id::BOOL8},
+    {"u", type_id::STRING},
+    {"tdD", type_id::TIMESTAMP_DAYS},
+    {"tDs", type_id::DURATION_SECONDS},
+    {"tDm", type_id::DURATION_MILLISECONDS},
+    {"tDu", type_id::DURATION_MICROSECONDS},
+    {"tDn", type_id::DURATION_NANOSECONDS}};
+  for (auto const& entry : formats) {
+    if (format == entry.first) { return data_type{entry.second}; }
+  }
+
+  // Timestamps may name a timezone after the colon, which cuDF ignores
+  static std::vector<std::pair<std::string, type_id>> const timestamps{
+    {"tss:", type_id::TIMESTAMP_SECONDS},
+    {"tsm:", type_id::TIMESTAMP_MILLISECONDS},
+    {"tsu:", type_id::TIMESTAMP_MICROSECONDS},
+    {"tsn:", type_id::TIMESTAMP_NANOSECONDS}};
+  for (auto const& entry : timestamps) {
+    if (format.compare(0, entry.first.size(), entry.first) == 0) {
+      return data_type{entry.second};
+    }
+  }
+
+  // Decimals are "d:precision,scale[,bitwidth]" with a default bit width of 128
+  if (format.compare(0, 2, "d:") == 0) {
+    auto const scale_begin = format.find(',');
+    CUDF_EXPECTS(scale_begin != std::string::npos, "Invalid Arrow decimal format");
+    auto const width_begin = format.find(',', scale_begin + 1);
+    auto const scale       = std::stoi(format.substr(scale_begin + 1));
+    auto const width =
+      (width_begin == std::string::npos) ? 128 : std::stoi(format.substr(width_begin + 1));
+    CUDF_EXPECTS(width == 32 || width == 64, "Only 32 and 64-bit Arrow decimals are supported");
+    return data_type{width == 32 ? type_id::DECIMAL32 : type_id::DECIMAL64, -scale};
+  }
+  CUDF_FAIL("Unsupported Arrow format: " + format);
+}
+
+/**
+ * @brief Owns the strings of an exported schema and its child schemas
+ */
+struct exported_schema {
+  std::string format;
+  std::string name;
+  std::vector<unique_arrow_ptr<ArrowSchema>> children;
+  std::vector<ArrowSchema*> child_pointers;
+  unique_arrow_ptr<ArrowSchema> dictionary;
+};
+
+void release_schema(ArrowSchema* schema)
+{
+  delete static_cast<exported_schema*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+unique_arrow_ptr<ArrowSchema> make_schema(std::string format,
+                                          std::string name,
+                                          bool nullable,
+                                          std::vector<unique_arrow_ptr<ArrowSchema>>&& children,
+                                          unique_arrow_ptr<ArrowSchema>&& dictionary = nullptr)
+{
+  auto data =
+    new exported_schema{std::move(format), std::move(name), std::move(children), {}, nullptr};
+  data->dictionary = std::move(dictionary);
+  for (auto const& child : data->children) { data->child_pointers.push_back(child.get()); }
+
+  unique_arrow_ptr<ArrowSchema> schema{new ArrowSchema{}};
+  schema->format       = data->format.c_str();
+  schema->name         = data->name.c_str();
+  schema->metadata     = nullptr;
+  schema->flags        = nullable ? ARROW_FLAG_NULLABLE : 0;
+  schema->n_children   = static_cast<int64_t>(data->children.size());
+  schema->children     = data->child_pointers.data();
+  schema->dictionary   = data->dictionary.get();
+  schema->release      = release_schema;
+  schema->private_data = data;
+  return schema;
+}
+
+unique_arrow_ptr<ArrowSchema> make_column_schema(column_view const& col, std::string name)
+{
+  std::vector<unique_arrow_ptr<ArrowSchema>> children;
+  if (col.type().id() == type_id::DICTIONARY32) {
+    dictionary_column_view const dictionary(col);
+    return make_schema(arrow_format(dictionary.indices().type()),
+                       std::move(name),
+                       col.nullable(),
+                       std::move(children),
+                       make_column_schema(dictionary.keys(), ""));
+  }
+  if (col.type().id() == type_id::LIST) {
+    CUDF_EXPECTS(col.num_children() > 0, "Lists columns without a child cannot be exported");
+    children.push_back(
+      make_column_schema(col.child(lists_column_view::child_column_index), "item"));
+  }
+  return make_schema(
+    arrow_format(col.type()), std::move(name), col.nullable(), std::move(children));
+}
+
+/**
+ * @brief Keeps the memory of an exported table alive until its arrays are released
+ */
+struct export_owner {
+  std::unique_ptr<table> data;              ///< The exported table, if the array owns it
+  std::vector<rmm::device_buffer> buffers;  ///< Buffers made for the export
+  cudaEvent_t event{};                      ///< Recorded on the stream of the export
+
+  ~export_owner()
+  {
+    if (event != nullptr) { cudaEventDestroy(event); }
+  }
+};
+
+/**
+ * @brief The buffers and children of an exported array
+ *
+ * Arrays moved out of their parent by the consumer keep the owner alive on their own.
+ */
+struct exported_array {
+  std::shared_ptr<export_owner> owner;
+  std::vector<void const*> buffers;
+  std::vector<unique_arrow_ptr<ArrowArray>> children;
+  std::vector<ArrowArray*> child_pointers;
+  unique_arrow_ptr<ArrowArray> dictionary;
+};
+
+void release_array(ArrowArray* array)
+{
+  delete static_cast<exported_array*>(array->private_data);
+  array->release = nullptr;
+}
+
+void fill_array(ArrowArray* array,
+                std::unique_ptr<exported_array>&& data,
+                int64_t length,
+                int64_t null_count,
+                int64_t offset)
+{
+  for (auto const& child : data->children) { data->child_pointers.push_back(child.get()); }
+  array->length       = length;
+  array->null_count   = null_count;
+  array->offset       = offset;
+  array->n_buffers    = static_cast<int64_t>(data->buffers.size());
+  array->n_children   = static_cast<int64_t>(data->children.size());
+  array->buffers      = data->buffers.data();
+  array->children     = data->child_pointers.data();
+  array->dictionary   = data->dictionary.get();
+  array->release      = release_array;
+  array->private_data = data.release();
+}
+
+/**
+ * @brief Returns a device buffer holding a single zero offset
+ */
+void const* zero_offset(export_owner& owner,
+                        rmm::mr::device_memory_resource* mr,
+                        cudaStream_t stream)
+{
+  owner.buffers.emplace_back(sizeof(size_type), stream, mr);
+  CUDA_TRY(cudaMemsetAsync(owner.buffers.back().data(), 0, sizeof(size_type), stream));
+  return owner.buffers.back().data();
+}
+
+unique_arrow_ptr<ArrowArray> export_column(column_view const& col,
+                                           std::shared_ptr<export_owner> const& owner,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  auto data   = std::make_unique<exported_array>();
+  data->owner = owner;
+  data->buffers.push_back(col.null_mask());
+  switch (col.type().id()) {
+    case type_id::BOOL8: {
+      // Arrow booleans are bits and the offset of the array applies to them too, so the
+      // rows before the offset are packed as well
+      column_view const rows{col.type(), col.offset() + col.size(), col.head()};
+      auto packed = cudf::detail::bools_to_mask(rows, mr, stream).first;
+      owner->buffers.push_back(std::move(*packed));
+      data->buffers.push_back(owner->buffers.back().data());
+    } break;
+    case type_id::STRING:
+      if (col.num_children() == 0) {
+        // An empty strings column has no children, but Arrow still needs one offset
+        auto const offsets = zero_offset(*owner, mr, stream);
+        data->buffers.push_back(offsets);
+        data->buffers.push_back(offsets);
+      } else {
+        strings_column_view const strings(col);
+        data->buffers.push_back(strings.offsets().head());
+        data->buffers.push_back(strings.chars().head());
+      }
+      break;
+    case type_id::LIST:
+      CUDF_EXPECTS(col.num_children() > 0, "Lists columns without a child cannot be exported");
+      data->buffers.push_back(col.child(lists_column_view::offsets_column_index).head());
+      data->children.push_back(
+        export_column(col.child(lists_column_view::child_column_index), owner, mr, stream));
+      break;
+    case type_id::DICTIONARY32: {
+      dictionary_column_view const dictionary(col);
+      data->buffers.push_back(dictionary.indices().head());
+      data->dictionary = export_column(dictionary.keys(), owner, mr, stream);
+    } break;
+    default:
+      arrow_format(col.type());  // throws for the types without an Arrow equivalent
+      data->buffers.push_back(col.head());
+      break;
+  }
+
+  unique_arrow_ptr<ArrowArray> array{new ArrowArray{}};
+  fill_array(array.get(), std::move(data), col.size(), col.null_count(), col.offset());
+  return array;
+}
+
+void release_schema_ptr(ArrowSchema* schema) { release_deleter{}(schema); }
+
+void release_device_array(ArrowDeviceArray* array)
+{
+  if (array->array.release != nullptr) { array->array.release(&array->array); }
+  delete array;
+}
+
+unique_device_array_t export_table(table_view const& input,
+                                   std::shared_ptr<export_owner> const& owner,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  auto data   = std::make_unique<exported_array>();
+  data->owner = owner;
+  data->buffers.push_back(nullptr);  // the struct itself has no nulls
+  for (auto const& col : input) { data->children.push_back(export_column(col, owner, mr, stream)); }
+
+  CUDA_TRY(cudaEventCreateWithFlags(&owner->event, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventRecord(owner->event, stream));
+  int device{};
+  CUDA_TRY(cudaGetDevice(&device));
+
+  unique_device_array_t result{new ArrowDeviceArray{}, release_device_array};
+  fill_array(&result->array, std::move(data), input.num_rows(), 0, 0);
+  result->device_id   = device;
+  result->device_type = ARROW_DEVICE_CUDA;
+  result->sync_event  = &owner->event;
+  return result;
+}
+
+/**
+ * @brief Owns the columns an import had to convert
+ */
+struct import_owner {
+  std::vector<std::unique_ptr<column>> columns;
+};
+
+column_view import_column(ArrowSchema const* schema,
+                          ArrowArray const* array,
+                          import_owner& owner,
+                          rmm::mr::device_memory_resource* mr,
+                          cudaStream_t stream)
+{
+  CUDF_EXPECTS(array->offset + array->length <= std::numeric_limits<size_type>::max(),
+               "Arrow array is too large for a column");
+  auto const length     = static_cast<size_type>(array->length);
+  auto const offset     = static_cast<size_type>(array->offset);
+  auto const null_mask  = (array->n_buffers > 0 && array->buffers[0] != nullptr)
+                           ? static_cast<bitmask_type const*>(array->buffers[0])
+                           : nullptr;
+  auto const null_count = (null_mask == nullptr) ? 0
+                          : (array->null_count < 0)
+                            ? UNKNOWN_NULL_COUNT
+                            : static_cast<size_type>(array->null_count);
+  std::string const format{schema->format};
+
+  if (schema->dictionary != nullptr) {
+    auto const indices_type = to_data_type(format);
+    CUDF_EXPECTS(indices_type.id() == type_id::UINT8 || indices_type.id() == type_id::UINT16 ||
+                   indices_type.id() == type_id::INT32,
+                 "Dictionary indices must be uint8, uint16 or int32");
+    auto const keys = import_column(schema->dictionary, array->dictionary, owner, mr, stream);
+    column_view const indices{indices_type, offset + length, array->buffers[1]};
+    return column_view{data_type{type_id::DICTIONARY32},
+                       length,
+                       nullptr,
+                       null_mask,
+                       null_count,
+                       offset,
+                       {indices, keys}};
+  }
+
+  if (format == "+l") {
+    auto const child = import_column(schema->children[0], array->children[0], owner, mr, stream);
+    column_view const offsets{data_type{type_id::INT32}, offset + length + 1, array->buffers[1]};
+    return column_view{
+      data_type{type_id::LIST}, length, nullptr, null_mask, null_count, offset, {offsets, child}};
+  }
+
+  auto const type = to_data_type(format);
+  if (type.id() == type_id::STRING) {
+    if (length == 0) { return column_view{type, 0, nullptr}; }
+    // The size of the chars is the last offset of the array, the only value read here
+    auto const d_offsets = static_cast<size_type const*>(array->buffers[1]);
+    size_type chars_size{};
+    CUDA_TRY(cudaMemcpyAsync(&chars_size,
+                             d_offsets + offset + length,
+                             sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    column_view const offsets{data_type{type_id::INT32}, offset + length + 1, d_offsets};
+    column_view const chars{data_type{type_id::INT8}, chars_size, array->buffers[2]};
+    return column_view{type, length, nullptr, null_mask, null_count, offset, {offsets, chars}};
+  }
+
+  if (type.id() == type_id::BOOL8) {
+    // Unpack the bits up to the end of the array so that the offset still applies
+    auto bools = make_numeric_column(type, offset + length, mask_state::UNALLOCATED, stream, mr);
+    auto const bits = static_cast<bitmask_type const*>(array->buffers[1]);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(offset + length),
+                      bools->mutable_view().begin<bool>(),
+                      [bits] __device__(size_type index) { return bit_is_set(bits, index); });
+    owner.columns.push_back(std::move(bools));
+    return column_view{
+      type, length, owner.columns.back()->view().head(), null_mask, null_count, offset};
+  }
+
+  return column_view{type, length, array->buffers[1], null_mask, null_count, offset};
+}
+
+}  // namespace
+
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<std::string> const& column_names)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(column_names.empty() ||
+                 column_names.size() == static_cast<size_t>(input.num_columns()),
+               "There must be one name per column");
+  std::vector<unique_arrow_ptr<ArrowSchema>> children;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    children.push_back(
+      make_column_schema(input.column(i), column_names.empty() ? "" : column_names[i]));
+  }
+  return unique_schema_t{make_schema("+s", "", false, std::move(children)).release(),
+                         release_schema_ptr};
+}
+
+unique_device_array_t to_arrow_device(table&& input,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  auto owner  = std::make_shared<export_owner>();
+  owner->data = std::make_unique<table>(std::move(input));
+  return export_table(owner->data->view(), owner, mr, stream);
+}
+
+unique_device_array_t to_arrow_device(table_view const& input,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return export_table(input, std::make_shared<export_owner>(), mr, stream);
+}
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray const* input,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(schema != nullptr && input != nullptr, "Missing Arrow schema or array");
+  CUDF_EXPECTS(input->device_type == ARROW_DEVICE_CUDA ||
+                 input->device_type == ARROW_DEVICE_CUDA_HOST ||
+                 input->device_type == ARROW_DEVICE_CUDA_MANAGED,
+               "Arrow array is not accessible from a CUDA device");
+  if (input->device_type == ARROW_DEVICE_CUDA) {
+    int device{};
+    CUDA_TRY(cudaGetDevice(&device));
+    CUDF_EXPECTS(input->device_id == device, "Arrow array is not on the current device");
+  }
+  CUDF_EXPECTS(std::string{schema->format} == "+s", "Arrow schema must be a struct");
+  auto const& array = input->array;
+  CUDF_EXPECTS(schema->n_children == array.n_children, "Arrow schema does not match the array");
+  if (input->sync_event != nullptr) {
+    CUDA_TRY(cudaStreamWaitEvent(stream, *static_cast<cudaEvent_t*>(input->sync_event), 0));
+  }
+
+  auto owner = std::make_shared<import_owner>();
+  std::vector<column_view> columns;
+  for (int64_t i = 0; i < array.n_children; ++i) {
+    // The rows of a struct's children are those of the struct
+    auto child = *array.children[i];
+    child.offset += array.offset;
+    child.length = array.length;
+    columns.push_back(import_column(schema->children[i], &child, *owner, mr, stream));
+  }
+  return unique_table_view_t{new table_view{columns},
+                             [owner](table_view* view) { delete view; }};
+}
+
+}  // namespace cudf
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/sequence.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int block_size = 256;
+// Rows are staged in shared memory in tiles of about this many bytes
+constexpr size_type tile_size = 16 * 1024;
+// Largest row a block can stage
+constexpr size_type max_row_size = 48 * 1024;
+
+/**
+ * @brief Where the values and validity of each column are in a row.
+ */
+struct row_layout {
+  std::vector<size_type> column_offsets;  ///< Offset of the value of each column
+  size_type validity_offset;              ///< Offset of the validity bytes
+  size_type row_size;                     ///< Size of a row, a multiple of 8 bytes
+};
+
+row_layout compute_row_layout(std::vector<data_type> const& types)
+{
+  CUDF_EXPECTS(!types.empty(), "Rows must have at least one column");
+  row_layout layout{};
+  size_type at = 0;
+  for (auto const& type : types) {
+    CUDF_EXPECTS(is_fixed_width(type), "Only fixed-width columns can be converted to rows");
+    auto const size = static_cast<size_type>(size_of(type));
+    at              = util::round_up_safe(at, size);
+    layout.column_offsets.push_back(at);
+    at += size;
+  }
+  layout.validity_offset = at;
+  at += util::div_rounding_up_safe(static_cast<size_type>(types.size()), size_type{8});
+  layout.row_size = util::round_up_safe(at, size_type{8});
+  CUDF_EXPECTS(layout.row_size <= max_row_size, "Rows are too wide to convert");
+  return layout;
+}
+
+/**
+ * @brief A column copied to or from rows.
+ *
+ * Input columns are read through the same structure as output columns; their data
+ * and null mask are never written.
+ */
+struct column_info {
+  int8_t* data;             ///< First value of the column
+  bitmask_type* null_mask;  ///< Validity of the column, or nullptr when all valid
+  size_type mask_offset;    ///< Bit of the first value in `null_mask`
+  size_type size;           ///< Size of a value in bytes
+  size_type offset_in_row;  ///< Offset of the value in a row
+};
+
+/**
+ * @brief Copies a value of `size` bytes, both pointers aligned to `size`.
+ */
+__device__ inline void copy_value(int8_t* dst, int8_t const* src, size_type size)
+{
+  switch (size) {
+    case 1: *dst = *src; break;
+    case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<int16_t const*>(src); break;
+    case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<int32_t const*>(src); break;
+    case 8: *reinterpret_cast<int64_t*>(dst) = *reinterpret_cast<int64_t const*>(src); break;
+    default:
+      for (size_type i = 0; i < size; ++i) { dst[i] = src[i]; }
+  }
+}
+
+/**
+ * @brief Copies `num_rows` rows of the columns, starting at `first_row`, into `output`.
+ *
+ * Each block assembles a tile of `rows_per_tile` rows in shared memory, with consecutive
+ * threads reading consecutive values of a column, and then writes the tile out in 8-byte
+ * words.
+ */
+__global__ void copy_to_rows(column_info const* columns,
+                             size_type num_columns,
+                             size_type first_row,
+                             size_type num_rows,
+                             size_type row_size,
+                             size_type validity_offset,
+                             size_type rows_per_tile,
+                             int8_t* output)
+{
+  extern __shared__ int64_t shared_words[];
+  auto const shared_rows    = reinterpret_cast<int8_t*>(shared_words);
+  auto const validity_bytes = (num_columns + 7) / 8;
+
+  for (size_type tile_start = blockIdx.x * rows_per_tile; tile_start < num_rows;
+       tile_start += gridDim.x * rows_per_tile) {
+    auto const tile_rows  = min(rows_per_tile, num_rows - tile_start);
+    auto const tile_words = tile_rows * row_size / 8;
+    // Padding bytes are zero
+    for (size_type i = threadIdx.x; i < tile_words; i += blockDim.x) { shared_words[i] = 0; }
+    __syncthreads();
+
+    for (size_type i = threadIdx.x; i < tile_rows * num_columns; i += blockDim.x) {
+      auto const row   = i % tile_rows;
+      auto const& info = columns[i / tile_rows];
+      copy_value(shared_rows + row * row_size + info.offset_in_row,
+                 info.data + static_cast<int64_t>(first_row + tile_start + row) * info.size,
+                 info.size);
+    }
+    for (size_type i = threadIdx.x; i < tile_rows * validity_bytes; i += blockDim.x) {
+      auto const row  = i / validity_bytes;
+      auto const byte = i % validity_bytes;
+      uint8_t bits    = 0;
+      for (size_type bit = 0; bit < 8 && byte * 8 + bit < num_columns; ++bit) {
+        auto const& info = columns[byte * 8 + bit];
+        auto const index = info.mask_offset + first_row + tile_start + row;
+        bool const valid = info.null_mask == nullptr || bit_is_set(info.null_mask, index);
+        bits |= static_cast<uint8_t>(valid) << bit;
+      }
+      shared_rows[row * row_size + validity_offset + byte] = bits;
+    }
+    __syncthreads();
+
+    auto const out =
+      reinterpret_cast<int64_t*>(output + static_cast<int64_t>(tile_start) * row_size);
+    for (size_type i = threadIdx.x; i < tile_words; i += blockDim.x) { out[i] = shared_words[i]; }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Copies `num_rows` rows of `input` into the columns.
+ *
+ * Each block loads a tile of `rows_per_tile` rows into shared memory in 8-byte words and
+ * then scatters the values, with consecutive threads writing consecutive values of a
+ * column. The null masks of the columns must start all valid.
+ */
+__global__ void copy_from_rows(column_info const* columns,
+                               size_type num_columns,
+                               size_type num_rows,
+                               size_type row_size,
+                               size_type validity_offset,
+                               size_type rows_per_tile,
+                               int8_t const* input)
+{
+  extern __shared__ int64_t shared_words[];
+  auto const shared_rows = reinterpret_cast<int8_t const*>(shared_words);
+
+  for (size_type tile_start = blockIdx.x * rows_per_tile; tile_start < num_rows;
+       tile_start += gridDim.x * rows_per_tile) {
+    auto const tile_rows  = min(rows_per_tile, num_rows - tile_start);
+    auto const tile_words = tile_rows * row_size / 8;
+    auto const in =
+      reinterpret_cast<int64_t const*>(input + static_cast<int64_t>(tile_start) * row_size);
+    for (size_type i = threadIdx.x; i < tile_words; i += blockDim.x) { shared_words[i] = in[i]; }
+    __syncthreads();
+
+    for (size_type i = threadIdx.x; i < tile_rows * num_columns; i += blockDim.x) {
+      auto const column = i / tile_rows;
+      auto const row    = i % tile_rows;
+      auto const& info  = columns[column];
+      auto const values = shared_rows + row * row_size;
+      copy_value(info.data + static_cast<int64_t>(tile_start + row) * info.size,
+                 values + info.offset_in_row,
+                 info.size);
+      if (!(values[validity_offset + column / 8] & (1 << (column % 8)))) {
+        clear_bit(info.null_mask, tile_start + row);
+      }
+    }
+    __syncthreads();
+  }
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  std::vector<data_type> types;
+  std::vector<column_info> infos;
+  for (auto const& col : input) { types.push_back(col.type()); }
+  auto const layout = compute_row_layout(types);
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const col  = input.column(i);
+    auto const size = static_cast<size_type>(size_of(col.type()));
+    auto const data = col.head<int8_t>() + static_cast<int64_t>(col.offset()) * size;
+    infos.push_back({const_cast<int8_t*>(data),
+                     const_cast<bitmask_type*>(col.null_mask()),
+                     col.offset(),
+                     size,
+                     layout.column_offsets[i]});
+  }
+  rmm::device_vector<column_info> d_infos(infos);
+
+  auto const row_size      = layout.row_size;
+  auto const rows_per_tile = std::max(tile_size / row_size, size_type{1});
+  // Every batch of rows is a lists column whose offsets must fit in size_type
+  auto const max_batch_rows = std::numeric_limits<size_type>::max() / row_size;
+
+  std::vector<std::unique_ptr<column>> results;
+  size_type first_row = 0;
+  do {
+    auto const num_rows = std::min(max_batch_rows, input.num_rows() - first_row);
+    auto offsets = make_numeric_column(
+      data_type{type_id::INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+    auto const d_offsets = offsets->mutable_view();
+    thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                     d_offsets.begin<size_type>(),
+                     d_offsets.end<size_type>(),
+                     0,
+                     row_size);
+    auto rows = make_numeric_column(
+      data_type{type_id::INT8}, num_rows * row_size, mask_state::UNALLOCATED, stream, mr);
+    if (num_rows > 0) {
+      auto const num_tiles = util::div_rounding_up_safe(num_rows, rows_per_tile);
+      copy_to_rows<<<num_tiles, block_size, rows_per_tile * row_size, stream>>>(
+        d_infos.data().get(),
+        input.num_columns(),
+        first_row,
+        num_rows,
+        row_size,
+        layout.validity_offset,
+        rows_per_tile,
+        rows->mutable_view().data<int8_t>());
+    }
+    results.push_back(
+      make_lists_column(num_rows, std::move(offsets), std::move(rows), 0, {}, stream, mr));
+    first_row += num_rows;
+  } while (first_row < input.num_rows());
+
+  CHECK_CUDA(stream);
+  return results;
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto const layout   = compute_row_layout(schema);
+  auto const row_size = layout.row_size;
+  auto const num_rows = input.size();
+  auto const rows     = input.child();
+  CUDF_EXPECTS(rows.type().id() == type_id::INT8, "Rows must be lists of INT8");
+  CUDF_EXPECTS(static_cast<int64_t>(input.offset() + num_rows) * row_size <= rows.size(),
+               "Rows do not match the schema");
+
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<column_info> infos;
+  for (std::size_t i = 0; i < schema.size(); ++i) {
+    columns.push_back(
+      make_fixed_width_column(schema[i], num_rows, mask_state::ALL_VALID, stream, mr));
+    auto col = columns.back()->mutable_view();
+    infos.push_back({col.head<int8_t>(),
+                     col.null_mask(),
+                     0,
+                     static_cast<size_type>(size_of(schema[i])),
+                     layout.column_offsets[i]});
+  }
+  rmm::device_vector<column_info> d_infos(infos);
+
+  if (num_rows > 0) {
+    auto const rows_per_tile = std::max(tile_size / row_size, size_type{1});
+    auto const num_tiles     = util::div_rounding_up_safe(num_rows, rows_per_tile);
+    copy_from_rows<<<num_tiles, block_size, rows_per_tile * row_size, stream>>>(
+      d_infos.data().get(),
+      static_cast<size_type>(schema.size()),
+      num_rows,
+      row_size,
+      layout.validity_offset,
+      rows_per_tile,
+      rows.data<int8_t>() + static_cast<int64_t>(input.offset()) * row_size);
+    CHECK_CUDA(stream);
+  }
+  // The kernel cleared the bits of the null rows
+  for (auto& col : columns) { col->set_null_count(UNKNOWN_NULL_COUNT); }
+
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(input, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, mr);
+}
+
+}  // namespace cudf
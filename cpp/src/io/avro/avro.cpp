@@ -95,34 +95,45 @@ bool container::parse(file_metadata *md, size_t max_num_rows, size_t first_row)
       col.schema_data_idx  = (int32_t)i;
       col.schema_null_idx  = -1;
       col.parent_union_idx = -1;
-      col.name             = md->schema[i].name;
-      if (parent_idx >= 0) {
-        while (parent_idx >= 0) {
-          if (md->schema[parent_idx].kind == type_union) {
-            int pos = parent_idx + 1;
-            for (int num_children = md->schema[parent_idx].num_children; num_children > 0;
-                 --num_children) {
-              int skip = 1;
-              if (pos == i) {
-                col.parent_union_idx = md->schema[parent_idx].num_children - num_children;
-              } else if (md->schema[pos].kind == type_null) {
-                col.schema_null_idx = pos;
-                break;
-              }
-              do {
-                skip = skip + md->schema[pos].num_children - 1;
-                pos++;
-              } while (skip != 0);
+      while (parent_idx >= 0) {
+        if (md->schema[parent_idx].kind == type_union) {
+          int pos = parent_idx + 1;
+          for (int num_children = md->schema[parent_idx].num_children; num_children > 0;
+               --num_children) {
+            int skip = 1;
+            if (pos == i) {
+              col.parent_union_idx = md->schema[parent_idx].num_children - num_children;
+            } else if (md->schema[pos].kind == type_null) {
+              // Use the innermost null: the decoder propagates the nulls of enclosing unions.
+              // Nulls outside of the list apply to the list rather than to its elements.
+              auto &null_idx = (col.schema_array_idx < 0) ? col.schema_null_idx
+                                                          : col.schema_list_null_idx;
+              if (null_idx < 0) { null_idx = pos; }
+              break;
             }
+            do {
+              skip = skip + md->schema[pos].num_children - 1;
+              pos++;
+            } while (skip != 0);
           }
-          // Ignore the root or array entries
-          if ((parent_idx != 0 && md->schema[parent_idx].kind != type_array) ||
-              col.name.length() == 0) {
-            if (col.name.length() > 0) { col.name.insert(0, 1, '.'); }
-            col.name.insert(0, md->schema[parent_idx].name);
-          }
-          parent_idx = md->schema[parent_idx].parent_idx;
+        } else if (md->schema[parent_idx].kind == type_array ||
+                   md->schema[parent_idx].kind == type_map) {
+          if (col.schema_array_idx < 0) { col.schema_array_idx = parent_idx; }
+        }
+        parent_idx = md->schema[parent_idx].parent_idx;
+      }
+      // Name the column after the path of its entries, ignoring the root and the array items;
+      // the entries of a map item are named "key" and "value"
+      for (int idx = static_cast<int>(i); idx > 0; idx = md->schema[idx].parent_idx) {
+        const int parent = md->schema[idx].parent_idx;
+        auto name        = md->schema[idx].name;
+        if (parent >= 0 && md->schema[parent].kind == type_array) {
+          name.clear();
+        } else if (parent >= 0 && md->schema[parent].kind == type_map) {
+          name = (idx == parent + 1) ? "key" : "value";
         }
+        if (name.empty()) { continue; }
+        col.name = col.name.empty() ? name : name + "." + col.name;
       }
       md->columns.emplace_back(std::move(col));
     }
@@ -149,6 +160,7 @@ enum {
   attrtype_fields,
   attrtype_symbols,
   attrtype_items,
+  attrtype_values,
 };
 
 /**
@@ -162,6 +174,8 @@ enum {
 bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &json_str)
 {
   char depthbuf[MAX_SCHEMA_DEPTH];
+  // Whether each object is the type of an entry, e.g. {"name": "a", "type": {"type": "array"...}}
+  bool type_object[MAX_SCHEMA_DEPTH];
   int depth = 0, parent_idx = -1, entry_idx = -1;
   json_state_e state = state_attrname;
   std::string str;
@@ -175,13 +189,21 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
                                                                   {"string", type_string},
                                                                   {"record", type_record},
                                                                   {"enum", type_enum},
-                                                                  {"array", type_array}};
+                                                                  {"array", type_array},
+                                                                  {"map", type_map}};
   const std::unordered_map<std::string, int> attrnames         = {{"type", attrtype_type},
                                                           {"name", attrtype_name},
                                                           {"fields", attrtype_fields},
                                                           {"symbols", attrtype_symbols},
-                                                          {"items", attrtype_items}};
+                                                          {"items", attrtype_items},
+                                                          {"values", attrtype_values}};
   int cur_attr                                                 = attrtype_none;
+  // Maps are decoded as arrays of key/value records, with an implicit string key
+  auto add_map_key = [&](int map_idx) {
+    schema.emplace_back(type_string, map_idx);
+    schema.back().name = "key";
+    schema[map_idx].num_children++;
+  };
   m_base                                                       = json_str.c_str();
   m_cur                                                        = m_base;
   m_end                                                        = m_base + json_str.length();
@@ -200,6 +222,19 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
           auto t   = attrnames.find(str);
           cur_attr = (t == attrnames.end()) ? attrtype_none : t->second;
           state    = state_attrcolon;
+        } else if (state == state_attrvalue &&
+                   (cur_attr == attrtype_items || cur_attr == attrtype_values)) {
+          // Array items or map values of a primitive type
+          auto t = typenames.find(str);
+          if (entry_idx < 0) return false;
+          if (cur_attr == attrtype_values) { add_map_key(entry_idx); }
+          if (t != typenames.end() && t->second < type_record) {
+            schema.emplace_back(t->second, entry_idx);
+            if (cur_attr == attrtype_values) { schema.back().name = "value"; }
+            schema[entry_idx].num_children++;
+          }
+          state    = state_nextattr;
+          cur_attr = attrtype_none;
         } else if (state == state_attrvalue || state == state_attrvalue_last) {
           if (entry_idx < 0) {
             entry_idx = static_cast<int>(schema.size());
@@ -212,7 +247,10 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
             schema[entry_idx].kind = t->second;
           } else if (cur_attr == attrtype_name) {
             if (entry_idx < 0) return false;
-            schema[entry_idx].name = std::move(str);
+            // The name of a field takes precedence over the name of its type
+            if (depth == 0 || !type_object[depth - 1] || schema[entry_idx].name.empty()) {
+              schema[entry_idx].name = std::move(str);
+            }
           }
           if (state == state_attrvalue_last) { entry_idx = -1; }
           state    = state_nextattr;
@@ -233,7 +271,10 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
         }
         break;
       case '{':
+        if (depth >= MAX_SCHEMA_DEPTH) { return false; }
+        type_object[depth] = false;
         if (state == state_attrvalue && cur_attr == attrtype_type) {
+          type_object[depth] = true;
           if (entry_idx < 0) {
             entry_idx = static_cast<int>(schema.size());
             schema.emplace_back(type_record, parent_idx);
@@ -241,8 +282,10 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
           }
           cur_attr = attrtype_none;
           state    = state_attrname;
-        } else if (state == state_attrvalue && cur_attr == attrtype_items && entry_idx >= 0) {
-          // Treat array as a one-field record
+        } else if (state == state_attrvalue &&
+                   (cur_attr == attrtype_items || cur_attr == attrtype_values) && entry_idx >= 0) {
+          // Treat array as a one-field record, and map as a two-field record
+          if (cur_attr == attrtype_values) { add_map_key(entry_idx); }
           parent_idx = entry_idx;
           entry_idx  = -1;
           cur_attr   = attrtype_none;
@@ -254,7 +297,9 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
       case '}':
         if (depth == 0 || state != state_nextattr || depthbuf[depth - 1] != '{') return false;
         --depth;
-        if (entry_idx < 0) {
+        if (type_object[depth]) {
+          // The entry is completed by the enclosing object
+        } else if (entry_idx < 0) {
           parent_idx = (parent_idx >= 0) ? schema[parent_idx].parent_idx : -1;
         } else {
           entry_idx = -1;
@@ -270,7 +315,15 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
         if (cur_attr == attrtype_symbols) {
           state = state_nextsymbol;
           break;
-        } else if (cur_attr == attrtype_type) {
+        } else if (cur_attr == attrtype_type || cur_attr == attrtype_items ||
+                   cur_attr == attrtype_values) {
+          if (cur_attr != attrtype_type) {
+            // Array items or map values of a union type
+            if (entry_idx < 0) return false;
+            if (cur_attr == attrtype_values) { add_map_key(entry_idx); }
+            parent_idx = entry_idx;
+            entry_idx  = -1;
+          }
           if (entry_idx < 0 || schema[entry_idx].kind != type_not_set) {
             entry_idx = static_cast<int>(schema.size());
             schema.emplace_back(type_union, parent_idx);
@@ -299,6 +352,11 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
         } else if (parent_idx >= 0) {
           entry_idx  = parent_idx;
           parent_idx = schema[parent_idx].parent_idx;
+          // Like a record, a union of array items or map values leaves the array or map open
+          if (parent_idx >= 0 && schema[entry_idx].kind == type_union &&
+              (schema[parent_idx].kind == type_array || schema[parent_idx].kind == type_map)) {
+            entry_idx = -1;
+          }
         }
         break;
       case ' ':
@@ -49,10 +49,14 @@ struct schema_entry {
  * @Brief AVRO output column
  */
 struct column_desc {
-  int32_t schema_data_idx  = -1;  // schema index of data column
-  int32_t schema_null_idx  = -1;  // schema index of corresponding null object
-  int32_t parent_union_idx = -1;  // index of this column in parent union (-1 if not a union member)
-  std::string name         = "";
+  int32_t schema_data_idx      = -1;  // schema index of data column
+  int32_t schema_null_idx      = -1;  // schema index of corresponding null object
+  int32_t parent_union_idx     = -1;  // index of this column in parent union (-1 if not a union
+                                      // member)
+  int32_t schema_array_idx     = -1;  // schema index of the innermost enclosing array or map (-1
+                                      // if not a list column)
+  int32_t schema_list_null_idx = -1;  // schema index of the null object of the lists
+  std::string name             = "";
 };
 
 /**
@@ -54,6 +54,7 @@ enum type_kind_e {
   type_record,
   type_union,
   type_array,
+  type_map,
 };
 
 }  // namespace avro
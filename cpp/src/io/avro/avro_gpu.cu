@@ -46,9 +46,66 @@ static inline int64_t __device__ avro_decode_zigzag_varint(const uint8_t *&cur,
   return (int64_t)((u >> 1u) ^ -(int64_t)(u & 1));
 }
 
+/**
+ * @brief Skips over schema entries along with their children
+ *
+ * @param[in] schema Schema description
+ * @param[in] schema_len Number of entries in schema
+ * @param[in] i Index of the first entry to skip
+ * @param[in] skip Number of entries to skip, excluding children
+ *
+ * @return index of the entry following the skipped ones
+ **/
+static inline uint32_t __device__ avro_skip_entries(const schemadesc_s *schema,
+                                                    uint32_t schema_len,
+                                                    uint32_t i,
+                                                    int skip)
+{
+  while (skip > 0 && i < schema_len) {
+    if (schema[i].kind >= type_record) { skip += schema[i].count; }
+    ++i;
+    --skip;
+  }
+  return i;
+}
+
+/**
+ * @brief Sets a row as null in the nullable columns nested in a range of schema entries
+ *
+ * The entries nested in arrays or maps are left out, as the skipped lists have no elements.
+ *
+ * @param[in] schema Schema description
+ * @param[in] schema_g Global schema description, for updating the null counts
+ * @param[in] schema_len Number of entries in schema
+ * @param[in] first Index of the first entry
+ * @param[in] last Index past the last entry
+ * @param[in] row Current row, or current list element within an array or map
+ **/
+static inline void __device__ avro_set_nested_nulls(const schemadesc_s *schema,
+                                                    schemadesc_s *schema_g,
+                                                    uint32_t schema_len,
+                                                    uint32_t first,
+                                                    uint32_t last,
+                                                    size_t row)
+{
+  for (uint32_t k = first; k < last; k++) {
+    uint32_t *dataptr = reinterpret_cast<uint32_t *>(schema[k].dataptr);
+    if (schema[k].kind == type_array || schema[k].kind == type_map) {
+      k = avro_skip_entries(schema, schema_len, k + 1, schema[k].count) - 1;
+    } else if (schema[k].kind == type_null && dataptr) {
+      atomicAnd(dataptr + (row >> 5), ~(1 << (row & 0x1f)));
+      atomicAdd(&schema_g[k].count, 1);
+    }
+  }
+}
+
 /**
  * @brief Decode a row of values given an avro schema
  *
+ * The values nested in an array or map are the elements of a list, and are written at the offset
+ * of the row's list plus their position in it. The offsets of the lists are held by the array or
+ * map entry; in the counting pass, the number of elements of each row is written there instead.
+ *
  * @param[in] schema Schema description
  * @param[in] schema_g Global schema in device mem
  * @param[in] schema_len Number of schema entries
@@ -57,6 +114,8 @@ static inline int64_t __device__ avro_decode_zigzag_varint(const uint8_t *&cur,
  * @param[in] cur Current input data pointer
  * @param[in] end End of input data
  * @param[in] global_Dictionary Global dictionary entries
+ * @param[in] count_list_items Whether to count the list elements of the row instead of decoding
+ * them
  *
  * @return data pointer at the end of the row (start of next row)
  *
@@ -69,34 +128,42 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
                                                  const uint8_t *cur,
                                                  const uint8_t *end,
                                                  const nvstrdesc_s *global_dictionary,
-                                                 uint32_t num_dictionary_entries)
+                                                 uint32_t num_dictionary_entries,
+                                                 bool count_list_items)
 {
   uint32_t array_start = 0, array_repeat_count = 0;
   int array_children = 0;
+  bool array_started = false;
+  size_t array_offset = 0, array_items = 0;
   for (uint32_t i = 0; i < schema_len;) {
     uint32_t kind = schema[i].kind;
     int skip      = 0;
     uint8_t *dataptr;
+    // Position of the value within its column
+    const size_t idx = (array_repeat_count != 0) ? array_offset + array_items : row;
     if (kind == type_union) {
       int skip_after;
+      uint32_t first_member = i + 1;
       if (cur >= end) break;
-      skip       = (*cur++) >> 1;  // NOTE: Assumes 1-byte union member
+      skip       = static_cast<int>(avro_decode_zigzag_varint(cur, end));
       skip_after = schema[i].count - skip - 1;
-      ++i;
-      while (skip > 0 && i < schema_len) {
-        if (schema[i].kind >= type_record) { skip += schema[i].count; }
-        ++i;
-        --skip;
-      }
-      if (i >= schema_len || skip_after < 0) break;
+      if (skip < 0 || skip_after < 0) break;
+      i = avro_skip_entries(schema, schema_len, i + 1, skip);
+      if (i >= schema_len) break;
       kind = schema[i].kind;
       skip = skip_after;
+      if (kind == type_null && row < max_rows) {
+        // The columns nested in the other members are null as well
+        uint32_t end_member = avro_skip_entries(schema, schema_len, i + 1, skip_after);
+        avro_set_nested_nulls(schema, schema_g, schema_len, first_member, i, idx);
+        avro_set_nested_nulls(schema, schema_g, schema_len, i + 1, end_member, idx);
+      }
     }
     dataptr = reinterpret_cast<uint8_t *>(schema[i].dataptr);
     switch (kind) {
       case type_null:
         if (dataptr && row < max_rows) {
-          atomicAnd(reinterpret_cast<uint32_t *>(dataptr) + (row >> 5), ~(1 << (row & 0x1f)));
+          atomicAnd(reinterpret_cast<uint32_t *>(dataptr) + (idx >> 5), ~(1 << (idx & 0x1f)));
           atomicAdd(&schema_g[i].count, 1);
         }
         break;
@@ -109,18 +176,18 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
         int64_t v = avro_decode_zigzag_varint(cur, end);
         if (kind == type_int) {
           if (dataptr && row < max_rows) {
-            reinterpret_cast<int32_t *>(dataptr)[row] = static_cast<int32_t>(v);
+            reinterpret_cast<int32_t *>(dataptr)[idx] = static_cast<int32_t>(v);
           }
         } else if (kind == type_long) {
-          if (dataptr && row < max_rows) { reinterpret_cast<int64_t *>(dataptr)[row] = v; }
+          if (dataptr && row < max_rows) { reinterpret_cast<int64_t *>(dataptr)[idx] = v; }
         } else {  // string or enum
           size_t count    = 0;
           const char *ptr = 0;
           if (kind == type_enum) {  // dictionary
-            size_t idx = schema[i].count + v;
-            if (idx < num_dictionary_entries) {
-              ptr   = global_dictionary[idx].ptr;
-              count = global_dictionary[idx].count;
+            size_t dict_idx = schema[i].count + v;
+            if (dict_idx < num_dictionary_entries) {
+              ptr   = global_dictionary[dict_idx].ptr;
+              count = global_dictionary[dict_idx].count;
             }
           } else if (v >= 0 && cur + v <= end) {  // string
             ptr   = reinterpret_cast<const char *>(cur);
@@ -128,8 +195,8 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
             cur += count;
           }
           if (dataptr && row < max_rows) {
-            reinterpret_cast<nvstrdesc_s *>(dataptr)[row].ptr   = ptr;
-            reinterpret_cast<nvstrdesc_s *>(dataptr)[row].count = count;
+            reinterpret_cast<nvstrdesc_s *>(dataptr)[idx].ptr   = ptr;
+            reinterpret_cast<nvstrdesc_s *>(dataptr)[idx].count = count;
           }
         }
       } break;
@@ -143,7 +210,7 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
           } else {
             v = 0;
           }
-          reinterpret_cast<uint32_t *>(dataptr)[row] = v;
+          reinterpret_cast<uint32_t *>(dataptr)[idx] = v;
         } else {
           cur += 4;
         }
@@ -158,7 +225,7 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
           } else {
             v = 0;
           }
-          reinterpret_cast<uint64_t *>(dataptr)[row] = v;
+          reinterpret_cast<uint64_t *>(dataptr)[idx] = v;
         } else {
           cur += 8;
         }
@@ -167,22 +234,36 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
       case type_boolean:
         if (dataptr && row < max_rows) {
           uint8_t v                                 = (cur < end) ? *cur : 0;
-          reinterpret_cast<uint8_t *>(dataptr)[row] = (v) ? 1 : 0;
+          reinterpret_cast<uint8_t *>(dataptr)[idx] = (v) ? 1 : 0;
         }
         cur++;
         break;
 
-      case type_array: {
+      case type_array:
+      case type_map: {
         int32_t array_block_count = avro_decode_zigzag_varint(cur, end);
         if (array_block_count < 0) {
           avro_decode_zigzag_varint(cur, end);  // block size in bytes, ignored
           array_block_count = -array_block_count;
         }
+        if (!array_started) {
+          // First block of the row's list
+          array_started = true;
+          array_items   = 0;
+          array_offset  = (dataptr && row < max_rows && !count_list_items)
+                           ? reinterpret_cast<int32_t *>(dataptr)[row]
+                           : 0;
+        }
         array_start        = i;
         array_repeat_count = array_block_count;
         array_children     = 1;
         if (array_repeat_count == 0) {
-          skip += schema[i].count;  // Should always be 1
+          // The list ends with an empty block
+          if (dataptr && row < max_rows && count_list_items) {
+            reinterpret_cast<int32_t *>(dataptr)[row] = static_cast<int32_t>(array_items);
+          }
+          array_started = false;
+          skip += schema[i].count;  // Skip the item entries
         }
       } break;
     }
@@ -190,14 +271,10 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
       array_children--;
       if (schema[i].kind >= type_record) { array_children += schema[i].count; }
     }
-    i++;
-    while (skip > 0 && i < schema_len) {
-      if (schema[i].kind >= type_record) { skip += schema[i].count; }
-      ++i;
-      --skip;
-    }
+    i = avro_skip_entries(schema, schema_len, i + 1, skip);
     // If within an array, check if we reached the last item
     if (array_repeat_count != 0 && array_children <= 0 && cur < end) {
+      array_items++;
       if (!--array_repeat_count) {
         i = array_start;  // Restart at the array parent
       } else {
@@ -222,6 +299,8 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
  * @param[in] min_row_size Minimum size in bytes of a row
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
+ * @param[in] count_list_items Whether to count the list elements of every row instead of decoding
+ * the values
  *
  **/
 // blockDim {32,NWARPS,1}
@@ -235,7 +314,8 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
                           uint32_t num_dictionary_entries,
                           uint32_t min_row_size,
                           size_t max_rows,
-                          size_t first_row)
+                          size_t first_row,
+                          bool count_list_items)
 {
   __shared__ __align__(8) schemadesc_s g_shared_schema[MAX_SHARED_SCHEMA_LEN];
   __shared__ __align__(8) block_desc_s blk_g[NWARPS];
@@ -291,7 +371,8 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
                             cur,
                             end,
                             global_dictionary,
-                            num_dictionary_entries);
+                            num_dictionary_entries,
+                            count_list_items);
     }
     if (nrows <= 1) {
       cur = start + SHFL0(static_cast<uint32_t>(cur - start));
@@ -304,6 +385,106 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
   }
 }
 
+/**
+ * @brief Kernel for locating the sync markers that separate the data blocks
+ *
+ * Each thread compares the 16 bytes at a byte position against the marker; the positions of the
+ * matches are appended in no particular order. Matches within the block data are possible, and
+ * are discarded by the caller when following the chain of blocks.
+ *
+ * @param[in] data Raw file data, starting with the sync marker that ends the file header
+ * @param[in] size Size of the data in bytes
+ * @param[in] marker_lo First 8 bytes of the sync marker
+ * @param[in] marker_hi Last 8 bytes of the sync marker
+ * @param[out] positions Byte positions of the matches, or nullptr to only count them
+ * @param[in] max_positions Maximum number of positions to record
+ * @param[in,out] num_positions Number of matches, zero-initialized
+ **/
+// blockDim {256,1,1}
+__global__ void __launch_bounds__(256) gpuFindSyncMarkers(const uint8_t *data,
+                                                          size_t size,
+                                                          uint64_t marker_lo,
+                                                          uint64_t marker_hi,
+                                                          uint64_t *positions,
+                                                          uint32_t max_positions,
+                                                          uint32_t *num_positions)
+{
+  for (size_t pos = static_cast<size_t>(blockIdx.x) * 256 + threadIdx.x; pos + 16 <= size;
+       pos += static_cast<size_t>(gridDim.x) * 256) {
+    bool match = true;
+    for (uint32_t i = 0; i < 16 && match; i++) {
+      uint64_t marker = (i < 8) ? marker_lo : marker_hi;
+      match           = (data[pos + i] == static_cast<uint8_t>(marker >> ((i & 7) * 8)));
+    }
+    if (match) {
+      uint32_t idx = atomicAdd(num_positions, 1);
+      if (positions != nullptr && idx < max_positions) { positions[idx] = pos; }
+    }
+  }
+}
+
+/**
+ * @brief Kernel for parsing the header of the data block following each sync marker
+ *
+ * A block that is incomplete or has an invalid header is returned with zero rows.
+ *
+ * @param[in] data Raw file data
+ * @param[in] size Size of the data in bytes
+ * @param[in] positions Byte positions of the sync markers
+ * @param[in] num_positions Number of sync markers
+ * @param[out] blocks Data block descriptions, with offsets relative to the start of the data
+ **/
+// blockDim {256,1,1}
+__global__ void __launch_bounds__(256) gpuParseBlockHeaders(const uint8_t *data,
+                                                            size_t size,
+                                                            const uint64_t *positions,
+                                                            uint32_t num_positions,
+                                                            block_desc_s *blocks)
+{
+  uint32_t i = blockIdx.x * 256 + threadIdx.x;
+  if (i < num_positions) {
+    const uint8_t *cur   = data + positions[i] + 16;
+    const uint8_t *end   = data + size;
+    int64_t object_count = avro_decode_zigzag_varint(cur, end);
+    int64_t block_size   = avro_decode_zigzag_varint(cur, end);
+    bool valid = (object_count > 0 && block_size > 0 && block_size <= 0xffffffffll &&
+                  block_size + 16 <= end - cur);
+    blocks[i].offset    = cur - data;
+    blocks[i].size      = valid ? static_cast<uint32_t>(block_size) : 0;
+    blocks[i].first_row = 0;
+    blocks[i].num_rows  = valid ? static_cast<uint32_t>(object_count) : 0;
+  }
+}
+
+/**
+ * @brief Kernel for reading the uncompressed length at the start of snappy-compressed blocks
+ *
+ * @param[in] blocks Data block descriptions
+ * @param[in] data Raw block data
+ * @param[in] num_blocks Number of blocks
+ * @param[out] lengths Uncompressed length of each block
+ **/
+// blockDim {256,1,1}
+__global__ void __launch_bounds__(256) gpuGetSnappyBlockLengths(const block_desc_s *blocks,
+                                                                const uint8_t *data,
+                                                                uint32_t num_blocks,
+                                                                uint32_t *lengths)
+{
+  uint32_t i = blockIdx.x * 256 + threadIdx.x;
+  if (i < num_blocks) {
+    // The length is stored as an (unsigned) little-endian varint of up to 5 bytes
+    const uint8_t *cur = data + blocks[i].offset;
+    const uint8_t *end = cur + blocks[i].size;
+    uint32_t len       = 0;
+    for (uint32_t shift = 0; cur < end && shift < 32; shift += 7) {
+      uint32_t c = *cur++;
+      len |= (c & 0x7f) << shift;
+      if (c < 0x80) { break; }
+    }
+    lengths[i] = len;
+  }
+}
+
 /**
  * @brief Launches kernel for decoding column data
  *
@@ -317,6 +498,8 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in] count_list_items Whether to write the number of list elements of every row to the
+ * array and map entries, instead of decoding the values at the list offsets held there
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -331,6 +514,7 @@ cudaError_t __host__ DecodeAvroColumnData(block_desc_s *blocks,
                                           size_t max_rows,
                                           size_t first_row,
                                           uint32_t min_row_size,
+                                          bool count_list_items,
                                           cudaStream_t stream)
 {
   dim3 dim_block(32, NWARPS);  // NWARPS warps per threadblock
@@ -345,7 +529,89 @@ cudaError_t __host__ DecodeAvroColumnData(block_desc_s *blocks,
                                                               num_dictionary_entries,
                                                               min_row_size,
                                                               max_rows,
-                                                              first_row);
+                                                              first_row,
+                                                              count_list_items);
+  return cudaSuccess;
+}
+
+/**
+ * @brief Launches kernel for locating the sync markers that separate the data blocks
+ *
+ * @param[in] data Raw file data, starting with the sync marker that ends the file header
+ * @param[in] size Size of the data in bytes
+ * @param[in] sync_marker Sync marker of the file
+ * @param[out] positions Byte positions of the matches, or nullptr to only count them
+ * @param[in] max_positions Maximum number of positions to record
+ * @param[in,out] num_positions Number of matches, zero-initialized
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t __host__ FindSyncMarkers(const uint8_t *data,
+                                     size_t size,
+                                     const uint64_t sync_marker[2],
+                                     uint64_t *positions,
+                                     uint32_t max_positions,
+                                     uint32_t *num_positions,
+                                     cudaStream_t stream)
+{
+  // Each thread visits several positions on large inputs
+  size_t num_threadblocks = (size + 255) / 256;
+  if (num_threadblocks > 4096) { num_threadblocks = 4096; }
+  if (num_threadblocks > 0) {
+    gpuFindSyncMarkers<<<static_cast<uint32_t>(num_threadblocks), 256, 0, stream>>>(
+      data, size, sync_marker[0], sync_marker[1], positions, max_positions, num_positions);
+  }
+  return cudaSuccess;
+}
+
+/**
+ * @brief Launches kernel for parsing the header of the data block following each sync marker
+ *
+ * @param[in] data Raw file data
+ * @param[in] size Size of the data in bytes
+ * @param[in] positions Byte positions of the sync markers
+ * @param[in] num_positions Number of sync markers
+ * @param[out] blocks Data block descriptions, with offsets relative to the start of the data
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t __host__ ParseBlockHeaders(const uint8_t *data,
+                                       size_t size,
+                                       const uint64_t *positions,
+                                       uint32_t num_positions,
+                                       block_desc_s *blocks,
+                                       cudaStream_t stream)
+{
+  if (num_positions > 0) {
+    gpuParseBlockHeaders<<<(num_positions + 255) / 256, 256, 0, stream>>>(
+      data, size, positions, num_positions, blocks);
+  }
+  return cudaSuccess;
+}
+
+/**
+ * @brief Launches kernel for reading the uncompressed length of snappy-compressed blocks
+ *
+ * @param[in] blocks Data block descriptions
+ * @param[in] data Raw block data
+ * @param[in] num_blocks Number of blocks
+ * @param[out] lengths Uncompressed length of each block
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t __host__ GetSnappyBlockLengths(const block_desc_s *blocks,
+                                           const uint8_t *data,
+                                           uint32_t num_blocks,
+                                           uint32_t *lengths,
+                                           cudaStream_t stream)
+{
+  if (num_blocks > 0) {
+    gpuGetSnappyBlockLengths<<<(num_blocks + 255) / 256, 256, 0, stream>>>(
+      blocks, data, num_blocks, lengths);
+  }
   return cudaSuccess;
 }
 
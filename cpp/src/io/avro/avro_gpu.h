@@ -37,7 +37,8 @@ struct schemadesc_s {
   uint32_t kind;   // avro type kind
   uint32_t count;  // for records/unions: number of following child columns, for nulls: global
                    // null_count, for enums: dictionary ofs
-  void *dataptr;   // Ptr to column data, or null if column not selected
+  void *dataptr;   // Ptr to column data, or null if column not selected. For arrays/maps: list
+                   // offsets, or number of list elements of every row when counting them
 };
 
 /**
@@ -53,6 +54,8 @@ struct schemadesc_s {
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in] count_list_items Whether to write the number of list elements of every row to the
+ * array and map entries, instead of decoding the values at the list offsets held there
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -67,8 +70,72 @@ cudaError_t DecodeAvroColumnData(block_desc_s *blocks,
                                  size_t max_rows       = ~0,
                                  size_t first_row      = 0,
                                  uint32_t min_row_size = 0,
+                                 bool count_list_items = false,
                                  cudaStream_t stream   = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for locating the sync markers that separate the data blocks
+ *
+ * Matches within the block data are possible, and must be discarded by following the chain of
+ * blocks from the marker at the start of the data.
+ *
+ * @param[in] data Raw file data, starting with the sync marker that ends the file header
+ * @param[in] size Size of the data in bytes
+ * @param[in] sync_marker Sync marker of the file
+ * @param[out] positions Byte positions of the matches, in no particular order, or nullptr to only
+ * count them
+ * @param[in] max_positions Maximum number of positions to record
+ * @param[in,out] num_positions Number of matches, zero-initialized
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t FindSyncMarkers(const uint8_t *data,
+                            size_t size,
+                            const uint64_t sync_marker[2],
+                            uint64_t *positions,
+                            uint32_t max_positions,
+                            uint32_t *num_positions,
+                            cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for parsing the header of the data block following each sync marker
+ *
+ * Blocks that are incomplete or have an invalid header are returned with zero rows.
+ *
+ * @param[in] data Raw file data
+ * @param[in] size Size of the data in bytes
+ * @param[in] positions Byte positions of the sync markers
+ * @param[in] num_positions Number of sync markers
+ * @param[out] blocks Data block descriptions, with offsets relative to the start of the data
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t ParseBlockHeaders(const uint8_t *data,
+                              size_t size,
+                              const uint64_t *positions,
+                              uint32_t num_positions,
+                              block_desc_s *blocks,
+                              cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for reading the uncompressed length of snappy-compressed blocks
+ *
+ * @param[in] blocks Data block descriptions
+ * @param[in] data Raw block data
+ * @param[in] num_blocks Number of blocks
+ * @param[out] lengths Uncompressed length of each block
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t GetSnappyBlockLengths(const block_desc_s *blocks,
+                                  const uint8_t *data,
+                                  uint32_t num_blocks,
+                                  uint32_t *lengths,
+                                  cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace gpu
 }  // namespace avro
 }  // namespace io
@@ -22,6 +22,7 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/pinned_host_pool.hpp>
 
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -30,6 +31,12 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <future>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -57,6 +64,51 @@ type_id to_type_id(const avro::schema_entry *col)
   }
 }
 
+/**
+ * @brief Creates a LIST column from the decoded lists and list elements of an array or map column
+ *
+ * @param child_type Data type of the list elements
+ * @param num_rows Number of rows
+ * @param num_elements Number of list elements
+ * @param lists Offsets and null mask of the lists
+ * @param elements Decoded list elements
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ **/
+std::unique_ptr<column> make_list_output(data_type child_type,
+                                         size_type num_rows,
+                                         size_type num_elements,
+                                         column_buffer &lists,
+                                         column_buffer &elements,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  std::vector<std::unique_ptr<column>> children;
+  children.emplace_back(
+    std::make_unique<column>(data_type{type_id::INT32}, num_rows + 1, std::move(lists._data)));
+  children.emplace_back(make_column(child_type, num_elements, elements, stream, mr));
+  return std::make_unique<column>(data_type{type_id::LIST},
+                                  num_rows,
+                                  rmm::device_buffer{},
+                                  std::move(lists._null_mask),
+                                  lists.null_count(),
+                                  std::move(children));
+}
+
+/**
+ * @brief Decodes a zigzag-encoded varint from host memory
+ **/
+int64_t decode_zigzag_varint(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t u = 0;
+  for (uint32_t shift = 0; cur < end && shift < 64; shift += 7) {
+    uint64_t c = *cur++;
+    u |= (c & 0x7f) << shift;
+    if (c < 0x80) { break; }
+  }
+  return static_cast<int64_t>((u >> 1) ^ (~(u & 1) + 1));
+}
+
 }  // namespace
 
 /**
@@ -68,18 +120,100 @@ class metadata : public file_metadata {
   explicit metadata(datasource *const src) : source(src) {}
 
   /**
-   * @brief Initializes the parser and filters down to a subset of rows
+   * @brief Initializes the parser from the file header
    *
+   * Only the header is parsed on the host; the data blocks are located on the device.
+   **/
+  void init()
+  {
+    // Read increasingly large prefixes until one holds the complete header
+    const auto file_size = source->size();
+    for (size_t read_size = std::min(header_read_size, file_size);;
+         read_size        = std::min(read_size * 2, file_size)) {
+      static_cast<file_metadata &>(*this) = file_metadata{};
+
+      const auto buffer = source->host_read(0, read_size);
+      avro::container pod(buffer->data(), buffer->size());
+      // A maximum of zero rows skips the block scan
+      const bool parsed = pod.parse(this, 0, 0);
+      if (read_size == file_size) {
+        CUDF_EXPECTS(parsed, "Cannot parse metadata");
+        break;
+      }
+      if (parsed && metadata_size < read_size) { break; }
+    }
+    // The block data is read along with the sync marker that ends the header
+    CUDF_EXPECTS(metadata_size >= 16, "Cannot parse metadata");
+    total_data_size = file_size - (metadata_size - 16);
+  }
+
+  /**
+   * @brief Filters the data blocks down to a subset of rows
+   *
+   * The blocks are found by following the chain of sync markers from the start of the data, which
+   * discards the marker candidates that are part of the block data.
+   *
+   * @param[in] positions Sorted byte positions of the sync marker candidates
+   * @param[in] blocks Data block following each candidate
    * @param[in,out] row_start Starting row of the selection
    * @param[in,out] row_count Total number of rows selected
    **/
-  void init_and_select_rows(int &row_start, int &row_count)
+  void select_rows(const std::vector<uint64_t> &positions,
+                   const std::vector<block_desc_s> &blocks,
+                   int &row_start,
+                   int &row_count)
   {
-    const auto buffer = source->host_read(0, source->size());
-    avro::container pod(buffer->data(), buffer->size());
-    CUDF_EXPECTS(pod.parse(this, row_count, row_start), "Cannot parse metadata");
-    row_start = skip_rows;
-    row_count = num_rows;
+    const size_t max_num_rows = row_count;
+    size_t first_row          = row_start;
+    size_t total_object_count = 0;
+    size_t next_marker        = 0;
+
+    begin_selection();
+    for (size_t i = 0; i < positions.size() && total_object_count < max_num_rows; i++) {
+      if (positions[i] < next_marker) { continue; }
+      if (positions[i] > next_marker || blocks[i].num_rows == 0) { break; }
+      select_block(blocks[i], first_row, total_object_count);
+      next_marker = blocks[i].offset + blocks[i].size;
+    }
+    end_selection(total_object_count, row_start, row_count);
+  }
+
+  /**
+   * @brief Filters the data blocks down to a subset of rows, reading only the block headers
+   *
+   * The blocks below the selection are skipped using the row counts in their headers, without
+   * reading their data. The offsets of the selected blocks are relative to the start of the file.
+   *
+   * @param[in,out] row_start Starting row of the selection
+   * @param[in,out] row_count Total number of rows selected
+   **/
+  void select_rows_from_headers(int &row_start, int &row_count)
+  {
+    const size_t max_num_rows = row_count;
+    const auto file_size      = source->size();
+    size_t first_row          = row_start;
+    size_t total_object_count = 0;
+
+    begin_selection();
+    for (size_t pos = metadata_size; pos < file_size && total_object_count < max_num_rows;) {
+      const auto buffer  = source->host_read(pos, std::min(max_block_header_size, file_size - pos));
+      const uint8_t *cur = buffer->data();
+      const uint8_t *end = cur + buffer->size();
+      const auto object_count = decode_zigzag_varint(cur, end);
+      const auto block_size   = decode_zigzag_varint(cur, end);
+      const auto data_start   = pos + (cur - buffer->data());
+      if (object_count <= 0 || block_size <= 0 || block_size > 0xffffffffll ||
+          data_start + block_size + 16 > file_size) {
+        break;
+      }
+      const block_desc_s blk(data_start,
+                             static_cast<uint32_t>(block_size),
+                             0,
+                             static_cast<uint32_t>(object_count));
+      select_block(blk, first_row, total_object_count);
+      pos = data_start + block_size + 16;
+    }
+    end_selection(total_object_count, row_start, row_count);
   }
 
   /**
@@ -100,7 +234,8 @@ class metadata : public file_metadata {
         for (int i = 0; i < num_avro_columns; ++i, ++index) {
           if (index >= num_avro_columns) { index = 0; }
           if (columns[index].name == use_name &&
-              type_id::EMPTY != to_type_id(&schema[columns[index].schema_data_idx])) {
+              type_id::EMPTY != to_type_id(&schema[columns[index].schema_data_idx]) &&
+              !in_nested_list(columns[index])) {
             selection.emplace_back(index, columns[index].name);
             index++;
             break;
@@ -109,16 +244,8 @@ class metadata : public file_metadata {
       }
     } else {
       for (int i = 0; i < num_avro_columns; ++i) {
-        // Exclude array columns (unsupported)
-        bool column_in_array = false;
-        for (int parent_idx = schema[columns[i].schema_data_idx].parent_idx; parent_idx > 0;
-             parent_idx     = schema[parent_idx].parent_idx) {
-          if (schema[parent_idx].kind == avro::type_array) {
-            column_in_array = true;
-            break;
-          }
-        }
-        if (!column_in_array) {
+        // Exclude nested array and map columns (unsupported)
+        if (!in_nested_list(columns[i])) {
           auto col_type = to_type_id(&schema[columns[i].schema_data_idx]);
           CUDF_EXPECTS(col_type != type_id::EMPTY, "Unsupported data type");
           selection.emplace_back(i, columns[i].name);
@@ -131,6 +258,72 @@ class metadata : public file_metadata {
   }
 
  private:
+  /**
+   * @brief Returns whether a column is nested in more than one array or map
+   **/
+  bool in_nested_list(const column_desc &col) const
+  {
+    if (col.schema_array_idx < 0) { return false; }
+    for (int parent_idx = schema[col.schema_array_idx].parent_idx; parent_idx > 0;
+         parent_idx     = schema[parent_idx].parent_idx) {
+      if (schema[parent_idx].kind == avro::type_array ||
+          schema[parent_idx].kind == avro::type_map) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Clears the selection of blocks
+   **/
+  void begin_selection()
+  {
+    block_list.clear();
+    skip_rows      = 0;
+    max_block_size = 0;
+  }
+
+  /**
+   * @brief Adds a block to the selection if it holds any of the selected rows
+   *
+   * @param[in] blk Data block
+   * @param[in,out] first_row Number of rows left to skip
+   * @param[in,out] total_object_count Number of rows selected
+   **/
+  void select_block(const block_desc_s &blk, size_t &first_row, size_t &total_object_count)
+  {
+    const auto object_count = blk.num_rows;
+    if (object_count > first_row) {
+      uint32_t block_row = static_cast<uint32_t>(total_object_count);
+      max_block_size     = std::max(max_block_size, blk.size);
+      total_object_count += object_count;
+      if (block_list.empty()) {
+        skip_rows = static_cast<uint32_t>(first_row);
+        total_object_count -= first_row;
+        first_row = 0;
+      }
+      block_list.emplace_back(blk.offset, blk.size, block_row, object_count);
+    } else {
+      first_row -= object_count;
+    }
+  }
+
+  /**
+   * @brief Returns the selected rows
+   **/
+  void end_selection(size_t total_object_count, int &row_start, int &row_count)
+  {
+    num_rows  = total_object_count;
+    row_start = skip_rows;
+    row_count = num_rows;
+  }
+
+  // Size of the first read of the file header
+  static constexpr size_t header_read_size = 64 * 1024;
+  // Maximum size of a block header (two varints)
+  static constexpr size_t max_block_header_size = 20;
+
   datasource *const source;
 };
 
@@ -148,19 +341,23 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
     for (size_t i = 0; i < inflate_in.size(); ++i) { inflate_in[i].dstSize = initial_blk_len; }
   } else if (_metadata->codec == "snappy") {
     // Extract the uncompressed length from the snappy stream
+    rmm::device_buffer block_list(
+      _metadata->block_list.data(), _metadata->block_list.size() * sizeof(block_desc_s), stream);
+    hostdevice_vector<uint32_t> block_lengths(_metadata->block_list.size());
+    CUDA_TRY(gpu::GetSnappyBlockLengths(static_cast<const block_desc_s *>(block_list.data()),
+                                        static_cast<const uint8_t *>(comp_block_data.data()),
+                                        static_cast<uint32_t>(_metadata->block_list.size()),
+                                        block_lengths.device_ptr(),
+                                        stream));
+    CUDA_TRY(cudaMemcpyAsync(block_lengths.host_ptr(),
+                             block_lengths.device_ptr(),
+                             block_lengths.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
     for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->host_read(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
-      uint32_t blk_len   = blk[0];
-      if (blk_len > 0x7f) {
-        blk_len = (blk_len & 0x7f) | (blk[1] << 7);
-        if (blk_len > 0x3fff) {
-          blk_len = (blk_len & 0x3fff) | (blk[2] << 14);
-          if (blk_len > 0x1fffff) { blk_len = (blk_len & 0x1fffff) | (blk[3] << 21); }
-        }
-      }
-      inflate_in[i].dstSize = blk_len;
-      uncompressed_data_size += blk_len;
+      inflate_in[i].dstSize = block_lengths[i];
+      uncompressed_data_size += block_lengths[i];
     }
   } else {
     CUDF_FAIL("Unsupported compression codec\n");
@@ -168,9 +365,8 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
 
   rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
 
-  const auto base_offset = _metadata->block_list[0].offset;
   for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
-    const auto src_pos = _metadata->block_list[i].offset - base_offset;
+    const auto src_pos = _metadata->block_list[i].offset;
 
     inflate_in[i].srcDevice = static_cast<const uint8_t *>(comp_block_data.data()) + src_pos;
     inflate_in[i].srcSize   = _metadata->block_list[i].size;
@@ -237,6 +433,82 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
   return decomp_block_data;
 }
 
+rmm::device_buffer reader::impl::read_block_data(size_t offset, size_t size, cudaStream_t stream)
+{
+  // Read the data in slices, issuing all reads up front so they can proceed in parallel
+  const size_t slice_size = READ_SLICE_SIZE;
+  std::vector<std::future<std::unique_ptr<datasource::buffer>>> reads;
+  for (size_t pos = 0; pos < size; pos += slice_size) {
+    reads.emplace_back(_source->host_read_async(offset + pos, std::min(slice_size, size - pos)));
+  }
+  rmm::device_buffer block_data(size, stream);
+  for (size_t i = 0; i < reads.size(); ++i) {
+    const auto buffer = reads[i].get();
+    const auto pos    = i * slice_size;
+    CUDF_EXPECTS(buffer->size() == std::min(slice_size, size - pos),
+                 "Unexpected end of block data");
+    copy_host_to_device(
+      static_cast<uint8_t *>(block_data.data()) + pos, buffer->data(), buffer->size(), stream);
+  }
+  return block_data;
+}
+
+void reader::impl::find_blocks(const rmm::device_buffer &block_data,
+                               int &row_start,
+                               int &row_count,
+                               cudaStream_t stream)
+{
+  const auto data      = static_cast<const uint8_t *>(block_data.data());
+  const auto data_size = block_data.size();
+
+  // Count the sync marker candidates first, to size the list of positions
+  hostdevice_vector<uint32_t> num_markers(1);
+  CUDA_TRY(cudaMemsetAsync(num_markers.device_ptr(), 0, num_markers.memory_size(), stream));
+  CUDA_TRY(gpu::FindSyncMarkers(
+    data, data_size, _metadata->sync_marker, nullptr, 0, num_markers.device_ptr(), stream));
+  CUDA_TRY(cudaMemcpyAsync(num_markers.host_ptr(),
+                           num_markers.device_ptr(),
+                           num_markers.memory_size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  const auto max_markers = num_markers[0];
+
+  hostdevice_vector<uint64_t> positions(max_markers);
+  hostdevice_vector<block_desc_s> blocks(max_markers);
+  if (max_markers > 0) {
+    CUDA_TRY(cudaMemsetAsync(num_markers.device_ptr(), 0, num_markers.memory_size(), stream));
+    CUDA_TRY(gpu::FindSyncMarkers(data,
+                                  data_size,
+                                  _metadata->sync_marker,
+                                  positions.device_ptr(),
+                                  max_markers,
+                                  num_markers.device_ptr(),
+                                  stream));
+    thrust::sort(rmm::exec_policy(stream)->on(stream),
+                 positions.device_ptr(),
+                 positions.device_ptr() + max_markers);
+    CUDA_TRY(gpu::ParseBlockHeaders(
+      data, data_size, positions.device_ptr(), max_markers, blocks.device_ptr(), stream));
+    CUDA_TRY(cudaMemcpyAsync(positions.host_ptr(),
+                             positions.device_ptr(),
+                             positions.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaMemcpyAsync(blocks.host_ptr(),
+                             blocks.device_ptr(),
+                             blocks.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  const std::vector<uint64_t> h_positions(positions.host_ptr(),
+                                          positions.host_ptr() + max_markers);
+  const std::vector<block_desc_s> h_blocks(blocks.host_ptr(), blocks.host_ptr() + max_markers);
+  _metadata->select_rows(h_positions, h_blocks, row_start, row_count);
+}
+
 void reader::impl::decode_data(const rmm::device_buffer &block_data,
                                const std::vector<std::pair<uint32_t, uint32_t>> &dict,
                                hostdevice_vector<uint8_t> &global_dictionary,
@@ -244,6 +516,8 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
                                size_t num_rows,
                                std::vector<std::pair<int, std::string>> selection,
                                std::vector<column_buffer> &out_buffers,
+                               std::vector<column_buffer> &list_buffers,
+                               bool count_list_items,
                                cudaStream_t stream)
 {
   // Build gpu schema
@@ -259,6 +533,7 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
       switch (kind) {
         case type_union:
         case type_array:
+        case type_map:
           skip_field_cnt = _metadata->schema[i].num_children;
           // fall through
         case type_boolean:
@@ -276,31 +551,60 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
     schema_desc[i].kind    = kind;
     schema_desc[i].count   = (kind == type_enum) ? 0 : (uint32_t)_metadata->schema[i].num_children;
     schema_desc[i].dataptr = nullptr;
-    CUDF_EXPECTS(
-      kind != type_union || _metadata->schema[i].num_children < 2 ||
-        (_metadata->schema[i].num_children == 2 && (_metadata->schema[i + 1].kind == type_null ||
-                                                    _metadata->schema[i + 2].kind == type_null)),
-      "Union with non-null type not currently supported");
+    if (kind == type_union && _metadata->schema[i].num_children >= 2) {
+      // The second member follows the children of the first one
+      size_t second = i + 1;
+      for (int skip = 1; skip != 0; second++) {
+        skip += _metadata->schema[second].num_children - 1;
+      }
+      CUDF_EXPECTS(_metadata->schema[i].num_children == 2 &&
+                     (_metadata->schema[i + 1].kind == type_null ||
+                      _metadata->schema[second].kind == type_null),
+                   "Union with non-null type not currently supported");
+    }
   }
-  std::vector<void *> valid_alias(out_buffers.size(), nullptr);
-  for (size_t i = 0; i < out_buffers.size(); i++) {
-    const auto col_idx  = selection[i].first;
-    int schema_data_idx = _metadata->columns[col_idx].schema_data_idx;
-    int schema_null_idx = _metadata->columns[col_idx].schema_null_idx;
+  // The counting pass decodes the lists of the list columns, and the other pass the values
+  auto decoded_buffer = [&](size_t i) -> column_buffer * {
+    const auto &col = _metadata->columns[selection[i].first];
+    if (!count_list_items) { return &out_buffers[i]; }
+    return (col.schema_array_idx >= 0) ? &list_buffers[i] : nullptr;
+  };
+  auto decoded_null_idx = [&](size_t i) {
+    const auto &col = _metadata->columns[selection[i].first];
+    return count_list_items ? col.schema_list_null_idx : col.schema_null_idx;
+  };
+  std::vector<void *> valid_alias(selection.size(), nullptr);
+  std::vector<void *> offsets_alias(selection.size(), nullptr);
+  for (size_t i = 0; i < selection.size(); i++) {
+    const auto &col = _metadata->columns[selection[i].first];
+    if (col.schema_array_idx >= 0) {
+      // Columns nested in the same array or map share its list offsets
+      auto &offsets = schema_desc[col.schema_array_idx].dataptr;
+      if (!offsets) {
+        offsets = list_buffers[i].data();
+      } else if (count_list_items) {
+        offsets_alias[i] = offsets;
+      }
+    }
+    auto buffer = decoded_buffer(i);
+    if (buffer == nullptr) { continue; }
+    int schema_data_idx = col.schema_data_idx;
+    int schema_null_idx = decoded_null_idx(i);
 
-    schema_desc[schema_data_idx].dataptr = out_buffers[i].data();
+    if (!count_list_items) { schema_desc[schema_data_idx].dataptr = buffer->data(); }
     if (schema_null_idx >= 0) {
       if (!schema_desc[schema_null_idx].dataptr) {
-        schema_desc[schema_null_idx].dataptr = out_buffers[i].null_mask();
+        schema_desc[schema_null_idx].dataptr = buffer->null_mask();
       } else {
         valid_alias[i] = schema_desc[schema_null_idx].dataptr;
       }
     }
-    if (_metadata->schema[schema_data_idx].kind == type_enum) {
+    if (!count_list_items && _metadata->schema[schema_data_idx].kind == type_enum) {
       schema_desc[schema_data_idx].count = dict[i].first;
     }
-    if (out_buffers[i].null_mask_size()) {
-      set_null_mask(out_buffers[i].null_mask(), 0, num_rows, true, stream);
+    // The masks of the list elements are initialized along with their buffers
+    if (buffer->null_mask_size() && (count_list_items || col.schema_array_idx < 0)) {
+      set_null_mask(buffer->null_mask(), 0, num_rows, true, stream);
     }
   }
   rmm::device_buffer block_list(
@@ -322,15 +626,24 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
                               _metadata->num_rows,
                               _metadata->skip_rows,
                               min_row_data_size,
+                              count_list_items,
                               stream));
 
-  // Copy valid bits that are shared between columns
-  for (size_t i = 0; i < out_buffers.size(); i++) {
+  // Copy valid bits and list offsets that are shared between columns
+  for (size_t i = 0; i < selection.size(); i++) {
     if (valid_alias[i] != nullptr) {
-      CUDA_TRY(cudaMemcpyAsync(out_buffers[i].null_mask(),
+      auto buffer = decoded_buffer(i);
+      CUDA_TRY(cudaMemcpyAsync(buffer->null_mask(),
                                valid_alias[i],
-                               out_buffers[i].null_mask_size(),
-                               cudaMemcpyHostToDevice,
+                               buffer->null_mask_size(),
+                               cudaMemcpyDeviceToDevice,
+                               stream));
+    }
+    if (offsets_alias[i] != nullptr) {
+      CUDA_TRY(cudaMemcpyAsync(list_buffers[i].data(),
+                               offsets_alias[i],
+                               list_buffers[i].data_size(),
+                               cudaMemcpyDeviceToDevice,
                                stream));
     }
   }
@@ -340,10 +653,11 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
                            cudaMemcpyDeviceToHost,
                            stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
-  for (size_t i = 0; i < out_buffers.size(); i++) {
-    const auto col_idx          = selection[i].first;
-    const auto schema_null_idx  = _metadata->columns[col_idx].schema_null_idx;
-    out_buffers[i].null_count() = (schema_null_idx >= 0) ? schema_desc[schema_null_idx].count : 0;
+  for (size_t i = 0; i < selection.size(); i++) {
+    auto buffer = decoded_buffer(i);
+    if (buffer == nullptr) { continue; }
+    const auto schema_null_idx = decoded_null_idx(i);
+    buffer->null_count()       = (schema_null_idx >= 0) ? schema_desc[schema_null_idx].count : 0;
   }
 }
 
@@ -361,13 +675,14 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata metadata_out;
 
-  // Select and read partial metadata / schema within the subset of rows
-  _metadata->init_and_select_rows(skip_rows, num_rows);
+  // Read the metadata / schema from the file header
+  _metadata->init();
 
   // Select only columns required by the options
   auto selected_columns = _metadata->select_columns(_columns);
   if (selected_columns.size() != 0) {
-    // Get a list of column data types
+    // Get a list of column data types, which are the types of the list elements for the array
+    // and map columns
     std::vector<data_type> column_types;
     for (const auto &col : selected_columns) {
       auto &col_schema = _metadata->schema[_metadata->columns[col.first].schema_data_idx];
@@ -377,19 +692,31 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
       column_types.emplace_back(col_type);
     }
 
+    rmm::device_buffer block_data;
     if (_metadata->total_data_size > 0) {
-      const auto buffer =
-        _source->host_read(_metadata->block_list[0].offset, _metadata->total_data_size);
-      rmm::device_buffer block_data(buffer->data(), buffer->size(), stream);
+      if (skip_rows > 0 || num_rows >= 0) {
+        // Skip whole blocks using their headers, and only read the selected ones
+        _metadata->select_rows_from_headers(skip_rows, num_rows);
+        auto &blocks = _metadata->block_list;
+        if (!blocks.empty()) {
+          const auto data_offset = blocks.front().offset;
+          block_data             = read_block_data(
+            data_offset, blocks.back().offset + blocks.back().size - data_offset, stream);
+          for (auto &blk : blocks) { blk.offset -= data_offset; }
+        }
+      } else {
+        // Read the block data along with the sync marker that ends the header, and locate the
+        // blocks on the device
+        block_data = read_block_data(
+          _metadata->metadata_size - 16, _metadata->total_data_size, stream);
+        find_blocks(block_data, skip_rows, num_rows, stream);
+      }
+    }
 
+    if (!_metadata->block_list.empty()) {
       if (_metadata->codec != "" && _metadata->codec != "null") {
         auto decomp_block_data = decompress_data(block_data, stream);
         block_data             = std::move(decomp_block_data);
-      } else {
-        auto dst_ofs = _metadata->block_list[0].offset;
-        for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-          _metadata->block_list[i].offset -= dst_ofs;
-        }
       }
 
       size_t total_dictionary_entries = 0;
@@ -429,11 +756,58 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
                                  stream));
       }
 
+      // Decode the lists of the array and map columns first, to size the buffers of their
+      // elements
+      std::vector<column_buffer> list_buffers;
+      std::vector<size_type> num_elements(column_types.size(), 0);
+      bool has_lists = false;
+      for (size_t i = 0; i < column_types.size(); ++i) {
+        const auto &col    = _metadata->columns[selected_columns[i].first];
+        const bool is_list = (col.schema_array_idx >= 0);
+        list_buffers.emplace_back(data_type{type_id::INT32},
+                                  is_list ? num_rows + 1 : 0,
+                                  is_list && col.schema_list_null_idx >= 0,
+                                  stream,
+                                  _mr);
+        has_lists |= is_list;
+      }
+      if (has_lists) {
+        std::vector<column_buffer> no_buffers;
+        decode_data(block_data,
+                    dict,
+                    global_dictionary,
+                    total_dictionary_entries,
+                    num_rows,
+                    selected_columns,
+                    no_buffers,
+                    list_buffers,
+                    true,
+                    stream);
+        for (size_t i = 0; i < column_types.size(); ++i) {
+          if (_metadata->columns[selected_columns[i].first].schema_array_idx < 0) { continue; }
+          // The element counts of the rows become the offsets of their lists
+          auto offsets = static_cast<size_type *>(list_buffers[i].data());
+          thrust::exclusive_scan(
+            rmm::exec_policy(stream)->on(stream), offsets, offsets + num_rows + 1, offsets);
+          CUDA_TRY(cudaMemcpyAsync(&num_elements[i],
+                                   offsets + num_rows,
+                                   sizeof(size_type),
+                                   cudaMemcpyDeviceToHost,
+                                   stream));
+        }
+        CUDA_TRY(cudaStreamSynchronize(stream));
+      }
+
       std::vector<column_buffer> out_buffers;
       for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        bool is_nullable = (_metadata->columns[col_idx].schema_null_idx >= 0);
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        const auto &col    = _metadata->columns[selected_columns[i].first];
+        const bool is_list = (col.schema_array_idx >= 0);
+        bool is_nullable   = (col.schema_null_idx >= 0);
+        const auto size    = is_list ? num_elements[i] : num_rows;
+        out_buffers.emplace_back(column_types[i], size, is_nullable, stream, _mr);
+        if (is_list && is_nullable) {
+          set_null_mask(out_buffers.back().null_mask(), 0, size, true, stream);
+        }
       }
 
       decode_data(block_data,
@@ -443,11 +817,23 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
                   num_rows,
                   selected_columns,
                   out_buffers,
+                  list_buffers,
+                  false,
                   stream);
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        if (_metadata->columns[selected_columns[i].first].schema_array_idx >= 0) {
+          out_columns.emplace_back(make_list_output(column_types[i],
+                                                    num_rows,
+                                                    num_elements[i],
+                                                    list_buffers[i],
+                                                    out_buffers[i],
+                                                    stream,
+                                                    _mr));
+        } else {
+          out_columns.emplace_back(
+            make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        }
       }
     }
   }
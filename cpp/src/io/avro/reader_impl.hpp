@@ -49,6 +49,9 @@ class metadata;
  * @brief Implementation for Avro reader
  */
 class reader::impl {
+  // Size of the block data reads issued in parallel
+  static constexpr size_t READ_SLICE_SIZE = 32 * 1024 * 1024;
+
  public:
   /**
    * @brief Constructor from a dataset source with reader options.
@@ -73,6 +76,30 @@ class reader::impl {
   table_with_metadata read(int skip_rows, int num_rows, cudaStream_t stream);
 
  private:
+  /**
+   * @brief Reads a range of the file into device memory
+   *
+   * @param offset File offset of the range
+   * @param size Size of the range in bytes
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Device buffer holding the data
+   */
+  rmm::device_buffer read_block_data(size_t offset, size_t size, cudaStream_t stream);
+
+  /**
+   * @brief Locates the data blocks on the device and selects the ones holding a subset of rows
+   *
+   * @param block_data Raw block data, starting with the sync marker that ends the file header
+   * @param row_start Starting row of the selection, updated to the rows to skip in the first block
+   * @param row_count Total number of rows to select, updated to the number of rows selected
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void find_blocks(const rmm::device_buffer &block_data,
+                   int &row_start,
+                   int &row_count,
+                   cudaStream_t stream);
+
   /**
    * @brief Decompresses the block data.
    *
@@ -87,11 +114,18 @@ class reader::impl {
   /**
    * @brief Convert the avro row-based block data and outputs to columns
    *
+   * The lists of the array and map columns are decoded by a first pass, which counts the list
+   * elements of every row. The second pass decodes the values, and the list elements at the list
+   * offsets.
+   *
    * @param block_data Uncompressed block data
    * @param dict Dictionary entries
    * @param global_dictionary Dictionary allocation
    * @param total_dictionary_entries Number of dictionary entries
-   * @param out_buffers Output columns' device buffers
+   * @param out_buffers Output columns' device buffers, or the list elements of list columns
+   * @param list_buffers Element counts and null masks of the lists of list columns, which hold
+   * their offsets once counted
+   * @param count_list_items Whether to count the list elements instead of decoding the values
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_data(const rmm::device_buffer &block_data,
@@ -101,6 +135,8 @@ class reader::impl {
                    size_t num_rows,
                    std::vector<std::pair<int, std::string>> columns,
                    std::vector<column_buffer> &out_buffers,
+                   std::vector<column_buffer> &list_buffers,
+                   bool count_list_items,
                    cudaStream_t stream);
 
  private:
@@ -369,6 +369,7 @@ int32_t bz2_decompress_block(unbz_state_s *s)
       if (zvec >= BZ_MAX_ALPHA_SIZE) return BZ_DATA_ERROR;
       nextSym = gSel->perm[zvec];
       if (nextSym > BZ_RUNB) break;
+      if (N >= 2 * 1024 * 1024) return BZ_DATA_ERROR;  // Run longer than any block
       es += N << nextSym;
       N <<= 1;
     }
@@ -525,12 +526,16 @@ static void bzUnRLE(unbz_state_s *s)
   s->out = out;
 }
 
-int32_t cpu_bz2_uncompress(
-  const uint8_t *source, size_t sourceLen, uint8_t *dest, size_t *destLen, uint64_t *block_start)
+int32_t cpu_bz2_uncompress(const uint8_t *source,
+                           size_t sourceLen,
+                           uint8_t *dest,
+                           size_t *destLen,
+                           uint64_t *block_start,
+                           uint64_t block_end)
 {
   unbz_state_s s;
   uint32_t v;
-  int ret;
+  int ret = BZ_OK;
   size_t last_valid_block_in, last_valid_block_out;
 
   if (dest == NULL || destLen == NULL || source == NULL || sourceLen < 12) return BZ_PARAM_ERROR;
@@ -578,6 +583,7 @@ int32_t cpu_bz2_uncompress(
   do {
     last_valid_block_in  = ((s.cur - s.base) << 3) + (s.bitpos);
     last_valid_block_out = s.out - s.outbase;
+    if (last_valid_block_in >= block_end) break;
 
     ret = bz2_decompress_block(&s);
     if (ret == BZ_OK || ret == BZ_STREAM_END) {
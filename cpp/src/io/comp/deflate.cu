@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "deflate_enc.h"
+#include "gpuinflate.h"
+
+namespace cudf {
+namespace io {
+/**
+ * @brief DEFLATE compressor state
+ **/
+struct deflate_state_s {
+  gpu_inflate_input_s in;                               ///< Input parameters
+  lz77::matcher_s matcher;                              ///< Hash table of previous positions
+  lz77::sequence_s seqs[deflate::max_block_sequences];  ///< Sequences of the current block
+  deflate::encoder_workspace_s ws;                      ///< Huffman tables
+  uint32_t crc_table[256];                              ///< CRC32 table for the gzip trailer
+};
+
+/**
+ * @brief DEFLATE compression kernel
+ * See https://tools.ietf.org/html/rfc1951
+ *
+ * The warp clears the hash table and builds the CRC32 table, then the first thread compresses
+ * the chunk, since the blocks of a stream depend on each other through the window.
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] level Compression level, 0 for the default
+ * @param[in] gzip_hdr Whether to add the gzip header and trailer
+ **/
+extern "C" __global__ void __launch_bounds__(32) deflate_kernel(gpu_inflate_input_s *inputs,
+                                                                 gpu_inflate_status_s *outputs,
+                                                                 int level,
+                                                                 int gzip_hdr)
+{
+  __shared__ __align__(16) deflate_state_s state_g;
+
+  deflate_state_s *const s = &state_g;
+  uint32_t t               = threadIdx.x;
+
+  if (t < sizeof(gpu_inflate_input_s) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&s->in)[t] =
+      reinterpret_cast<const uint32_t *>(&inputs[blockIdx.x])[t];
+  }
+  for (uint32_t i = t; i < (1 << lz77::hash_bits) * lz77::max_ways; i += 32) {
+    s->matcher.table[i] = 0;
+  }
+  for (uint32_t i = t; i < 256; i += 32) { s->crc_table[i] = deflate::crc32_table_entry(i); }
+  __syncthreads();
+  if (!t) {
+    size_t len = deflate::compress(&s->matcher,
+                                   s->seqs,
+                                   &s->ws,
+                                   deflate::get_params(level),
+                                   reinterpret_cast<const uint8_t *>(s->in.srcDevice),
+                                   static_cast<uint32_t>(s->in.srcSize),
+                                   reinterpret_cast<uint8_t *>(s->in.dstDevice),
+                                   s->in.dstSize,
+                                   (gzip_hdr) ? s->crc_table : nullptr);
+    outputs[blockIdx.x].bytes_written = len;
+    outputs[blockIdx.x].status        = (len > s->in.dstSize) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_deflate(gpu_inflate_input_s *inputs,
+                                 gpu_inflate_status_s *outputs,
+                                 int count,
+                                 int level,
+                                 int gzip_hdr,
+                                 cudaStream_t stream)
+{
+  dim3 dim_block(32, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    deflate_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, level, gzip_hdr);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
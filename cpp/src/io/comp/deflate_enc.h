@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file deflate_enc.h
+ *
+ * DEFLATE encoding functions shared by the host and GPU compressors
+ *
+ * DEFLATE Compressed Data Format Specification version 1.3
+ * https://tools.ietf.org/html/rfc1951
+ *
+ * Each block of sequences is written with dynamic Huffman codes, or stored when that is not
+ * smaller. The output is raw DEFLATE data, optionally with the gzip header and trailer.
+ **/
+
+#ifndef __IO_DEFLATE_ENC_H__
+#define __IO_DEFLATE_ENC_H__
+
+#include "entropy_enc.h"
+#include "lz77.h"
+
+namespace cudf {
+namespace io {
+namespace deflate {
+constexpr int32_t default_level        = 6;
+constexpr uint32_t max_block_size      = 0xffff;  // Largest stored block
+constexpr uint32_t max_block_sequences = 1024;
+constexpr uint32_t num_litlen_symbols  = 286;
+constexpr uint32_t num_dist_symbols    = 30;
+constexpr uint32_t num_codelen_symbols = 19;
+constexpr uint32_t max_code_bits       = 15;
+constexpr uint32_t max_codelen_bits    = 7;
+
+/**
+ * @brief Encoder tables and scratch memory
+ **/
+struct encoder_workspace_s {
+  uint32_t lit_freq[num_litlen_symbols];
+  uint32_t dist_freq[num_dist_symbols];
+  uint32_t cl_freq[num_codelen_symbols];
+  uint16_t lit_code[num_litlen_symbols];
+  uint16_t dist_code[num_dist_symbols];
+  uint16_t cl_code[num_codelen_symbols];
+  uint8_t lit_len[num_litlen_symbols];
+  uint8_t dist_len[num_dist_symbols];
+  uint8_t cl_len[num_codelen_symbols];
+  uint8_t cl_symbol[num_litlen_symbols + num_dist_symbols];  // Run-length coded code lengths
+  uint8_t cl_extra[num_litlen_symbols + num_dist_symbols];
+  entropy::huffman_scratch_s scratch;
+};
+
+/**
+ * @brief Returns the match finder parameters for a compression level, 0 for the default
+ **/
+CUDA_HOST_DEVICE_CALLABLE lz77::params_s get_params(int32_t level)
+{
+  lz77::params_s p;
+  if (level <= 0) { level = default_level; }
+  p.max_offset = 32768;
+  p.max_match  = 258;
+  p.ways       = (level >= 7) ? 4 : (level >= 4) ? 2 : 1;
+  p.lazy       = (level >= 5);
+  p.skip_log   = (level <= 2) ? 4 : (level <= 3) ? 6 : 0;
+  return p;
+}
+
+/**
+ * @brief Computes one entry of the CRC32 table used by the gzip trailer
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t crc32_table_entry(uint32_t i)
+{
+  uint32_t c = i;
+  for (uint32_t k = 0; k < 8; k++) { c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1; }
+  return c;
+}
+
+/**
+ * @brief Computes the CRC32 of a buffer
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t crc32(const uint32_t *table, const uint8_t *src, size_t len)
+{
+  uint32_t crc = ~0u;
+  for (size_t i = 0; i < len; i++) { crc = table[(crc ^ src[i]) & 0xff] ^ (crc >> 8); }
+  return ~crc;
+}
+
+/**
+ * @brief Returns the length code of a match (without the 257 offset), with its extra bits
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t length_code(uint32_t len, uint32_t *nb_bits, uint32_t *extra)
+{
+  uint32_t l = len - 3;
+  if (len == 258) {
+    *nb_bits = 0;
+    *extra   = 0;
+    return 28;
+  } else if (l < 8) {
+    *nb_bits = 0;
+    *extra   = 0;
+    return l;
+  }
+  uint32_t nb   = entropy::bit_length(l) - 3;
+  uint32_t code = 4 * nb + 4 + ((l >> nb) & 3);
+  *nb_bits      = nb;
+  *extra        = l - ((4 | (code & 3)) << nb);
+  return code;
+}
+
+/**
+ * @brief Returns the distance code of a match, with its extra bits
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t dist_code(uint32_t dist, uint32_t *nb_bits, uint32_t *extra)
+{
+  uint32_t d = dist - 1;
+  if (d < 4) {
+    *nb_bits = 0;
+    *extra   = 0;
+    return d;
+  }
+  uint32_t nb   = entropy::bit_length(d) - 2;
+  uint32_t code = 2 * nb + 2 + ((d >> nb) & 1);
+  *nb_bits      = nb;
+  *extra        = d - ((2 | (code & 1)) << nb);
+  return code;
+}
+
+/**
+ * @brief Assigns the canonical Huffman codes, bit-reversed for the LSB-first bit writer
+ **/
+CUDA_HOST_DEVICE_CALLABLE void build_codes(const uint8_t *lengths,
+                                           uint32_t num_symbols,
+                                           uint16_t *codes)
+{
+  uint32_t next_code[max_code_bits + 2] = {0};
+  for (uint32_t s = 0; s < num_symbols; s++) { next_code[lengths[s] + 1]++; }
+  next_code[1] = 0;
+  for (uint32_t len = 1; len <= max_code_bits; len++) {
+    next_code[len + 1] = (next_code[len] + next_code[len + 1]) << 1;
+  }
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    uint32_t len = lengths[s];
+    if (len == 0) { continue; }
+    uint32_t code = next_code[len]++;
+    uint32_t rev  = 0;
+    for (uint32_t i = 0; i < len; i++, code >>= 1) { rev = (rev << 1) | (code & 1); }
+    codes[s] = static_cast<uint16_t>(rev);
+  }
+}
+
+/**
+ * @brief Makes sure at least two symbols are used, so that the Huffman code is complete
+ **/
+CUDA_HOST_DEVICE_CALLABLE void ensure_two_symbols(uint32_t *freq, uint32_t num_symbols)
+{
+  uint32_t num_used = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) { num_used += (freq[s] != 0); }
+  for (uint32_t s = 0; num_used < 2; s++) {
+    if (freq[s] == 0) {
+      freq[s] = 1;
+      num_used++;
+    }
+  }
+}
+
+/**
+ * @brief Returns the last used symbol + 1, at least min_count
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t used_count(const uint8_t *lengths,
+                                              uint32_t num_symbols,
+                                              uint32_t min_count)
+{
+  while (num_symbols > min_count && lengths[num_symbols - 1] == 0) { num_symbols--; }
+  return num_symbols;
+}
+
+/**
+ * @brief Writes a block of sequences, with dynamic Huffman codes or stored
+ *
+ * @param[in,out] bw Bit writer
+ * @param[in] ws Encoder workspace
+ * @param[in] seqs Sequences of the block
+ * @param[in] num_sequences Number of sequences
+ * @param[in] src Start of the block
+ * @param[in] size Size of the block, up to max_block_size
+ * @param[in] is_last Whether this is the last block of the stream
+ **/
+CUDA_HOST_DEVICE_CALLABLE void write_block(entropy::bit_writer_s *bw,
+                                           encoder_workspace_s *ws,
+                                           const lz77::sequence_s *seqs,
+                                           uint32_t num_sequences,
+                                           const uint8_t *src,
+                                           uint32_t size,
+                                           bool is_last)
+{
+  const uint8_t codelen_order[num_codelen_symbols] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+  uint32_t nb, extra;
+  uint64_t cost = 3 + 5 + 5 + 4;
+  for (uint32_t s = 0; s < num_litlen_symbols; s++) { ws->lit_freq[s] = 0; }
+  for (uint32_t s = 0; s < num_dist_symbols; s++) { ws->dist_freq[s] = 0; }
+  for (uint32_t s = 0; s < num_codelen_symbols; s++) { ws->cl_freq[s] = 0; }
+  for (uint32_t k = 0, pos = 0; k <= num_sequences; k++) {
+    uint32_t len = (k < num_sequences) ? seqs[k].literal_length : size - pos;
+    for (uint32_t i = 0; i < len; i++) { ws->lit_freq[src[pos + i]]++; }
+    if (k < num_sequences) {
+      ws->lit_freq[257 + length_code(seqs[k].match_length, &nb, &extra)]++;
+      cost += nb;
+      ws->dist_freq[dist_code(seqs[k].offset, &nb, &extra)]++;
+      cost += nb;
+      pos += len + seqs[k].match_length;
+    }
+  }
+  ws->lit_freq[256] = 1;
+  ensure_two_symbols(ws->lit_freq, num_litlen_symbols);
+  ensure_two_symbols(ws->dist_freq, num_dist_symbols);
+  entropy::build_huffman_lengths(
+    ws->lit_freq, num_litlen_symbols, max_code_bits, ws->lit_len, &ws->scratch);
+  entropy::build_huffman_lengths(
+    ws->dist_freq, num_dist_symbols, max_code_bits, ws->dist_len, &ws->scratch);
+  for (uint32_t s = 0; s < num_litlen_symbols; s++) { cost += ws->lit_freq[s] * ws->lit_len[s]; }
+  for (uint32_t s = 0; s < num_dist_symbols; s++) { cost += ws->dist_freq[s] * ws->dist_len[s]; }
+
+  // Run-length code the literal/length and distance code lengths as a single sequence
+  uint32_t hlit  = used_count(ws->lit_len, num_litlen_symbols, 257);
+  uint32_t hdist = used_count(ws->dist_len, num_dist_symbols, 1);
+  uint32_t total = hlit + hdist;
+  uint32_t n     = 0;
+  for (uint32_t i = 0; i < total;) {
+    uint32_t v   = (i < hlit) ? ws->lit_len[i] : ws->dist_len[i - hlit];
+    uint32_t run = 1;
+    while (i + run < total && ((i + run < hlit) ? ws->lit_len[i + run]
+                                                : ws->dist_len[i + run - hlit]) == v) {
+      run++;
+    }
+    i += run;
+    if (v == 0 && run >= 3) {
+      while (run >= 3) {
+        uint32_t r        = (run > 138) ? 138 : run;
+        ws->cl_symbol[n]  = (r >= 11) ? 18 : 17;
+        ws->cl_extra[n++] = static_cast<uint8_t>((r >= 11) ? r - 11 : r - 3);
+        run -= r;
+      }
+    } else if (v != 0 && run >= 4) {
+      ws->cl_symbol[n]  = static_cast<uint8_t>(v);
+      ws->cl_extra[n++] = 0;
+      run--;
+      while (run >= 3) {
+        uint32_t r        = (run > 6) ? 6 : run;
+        ws->cl_symbol[n]  = 16;
+        ws->cl_extra[n++] = static_cast<uint8_t>(r - 3);
+        run -= r;
+      }
+    }
+    for (; run > 0; run--) {
+      ws->cl_symbol[n]  = static_cast<uint8_t>(v);
+      ws->cl_extra[n++] = 0;
+    }
+  }
+  for (uint32_t i = 0; i < n; i++) { ws->cl_freq[ws->cl_symbol[i]]++; }
+  ensure_two_symbols(ws->cl_freq, num_codelen_symbols);
+  entropy::build_huffman_lengths(
+    ws->cl_freq, num_codelen_symbols, max_codelen_bits, ws->cl_len, &ws->scratch);
+  uint32_t hclen = num_codelen_symbols;
+  while (hclen > 4 && ws->cl_len[codelen_order[hclen - 1]] == 0) { hclen--; }
+  cost += 3 * hclen;
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t sym = ws->cl_symbol[i];
+    cost += ws->cl_len[sym] + ((sym == 16) ? 2 : (sym == 17) ? 3 : (sym == 18) ? 7 : 0);
+  }
+
+  uint64_t stored_cost = ((bw->bits + 3 + 7) & ~7u) - bw->bits + 32 + 8ull * size;
+  if (stored_cost <= cost) {
+    entropy::put_bits(bw, is_last ? 1 : 0, 3);
+    entropy::align_bits(bw);
+    entropy::put_bits(bw, size, 16);
+    entropy::put_bits(bw, ~size, 16);
+    for (uint32_t i = 0; i < size; i++) { entropy::put_byte(bw, src[i]); }
+    return;
+  }
+
+  build_codes(ws->lit_len, num_litlen_symbols, ws->lit_code);
+  build_codes(ws->dist_len, num_dist_symbols, ws->dist_code);
+  build_codes(ws->cl_len, num_codelen_symbols, ws->cl_code);
+  entropy::put_bits(bw, (is_last ? 1 : 0) | (2 << 1), 3);
+  entropy::put_bits(bw, hlit - 257, 5);
+  entropy::put_bits(bw, hdist - 1, 5);
+  entropy::put_bits(bw, hclen - 4, 4);
+  for (uint32_t i = 0; i < hclen; i++) { entropy::put_bits(bw, ws->cl_len[codelen_order[i]], 3); }
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t sym = ws->cl_symbol[i];
+    entropy::put_bits(bw, ws->cl_code[sym], ws->cl_len[sym]);
+    if (sym >= 16) {
+      entropy::put_bits(bw, ws->cl_extra[i], (sym == 16) ? 2 : (sym == 17) ? 3 : 7);
+    }
+  }
+  for (uint32_t k = 0, pos = 0; k <= num_sequences; k++) {
+    uint32_t len = (k < num_sequences) ? seqs[k].literal_length : size - pos;
+    for (uint32_t i = 0; i < len; i++) {
+      uint32_t sym = src[pos + i];
+      entropy::put_bits(bw, ws->lit_code[sym], ws->lit_len[sym]);
+    }
+    if (k < num_sequences) {
+      uint32_t sym = 257 + length_code(seqs[k].match_length, &nb, &extra);
+      entropy::put_bits(bw, ws->lit_code[sym], ws->lit_len[sym]);
+      entropy::put_bits(bw, extra, nb);
+      sym = dist_code(seqs[k].offset, &nb, &extra);
+      entropy::put_bits(bw, ws->dist_code[sym], ws->dist_len[sym]);
+      entropy::put_bits(bw, extra, nb);
+      pos += len + seqs[k].match_length;
+    }
+  }
+  entropy::put_bits(bw, ws->lit_code[256], ws->lit_len[256]);
+}
+
+/**
+ * @brief Compresses data into a DEFLATE stream
+ *
+ * @param[in] m Hash table, cleared by the caller
+ * @param[in] seqs Sequences of the current block, max_block_sequences entries
+ * @param[in] ws Encoder workspace
+ * @param[in] p Match finder parameters
+ * @param[in] src Uncompressed data
+ * @param[in] src_len Length of the uncompressed data
+ * @param[out] dst Compressed data
+ * @param[in] dst_len Size of the output buffer
+ * @param[in] crc_table CRC32 table to add the gzip header and trailer, nullptr for raw DEFLATE
+ *
+ * @return Size of the compressed data, larger than dst_len if the output did not fit
+ **/
+CUDA_HOST_DEVICE_CALLABLE size_t compress(lz77::matcher_s *m,
+                                          lz77::sequence_s *seqs,
+                                          encoder_workspace_s *ws,
+                                          const lz77::params_s &p,
+                                          const uint8_t *src,
+                                          uint32_t src_len,
+                                          uint8_t *dst,
+                                          size_t dst_len,
+                                          const uint32_t *crc_table)
+{
+  entropy::bit_writer_s bw;
+  uint32_t start  = 0;
+  bool last_block = false;
+  entropy::init_bit_writer(&bw, dst, dst + dst_len);
+  if (crc_table) {
+    // ID1, ID2, CM=8, no flags, no modification time, XFL=0, OS=unknown
+    const uint8_t gzip_header[10] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+    for (uint32_t i = 0; i < 10; i++) { entropy::put_byte(&bw, gzip_header[i]); }
+  }
+  do {
+    uint32_t num_sequences;
+    uint32_t block_end = lz77::parse_block(
+      m, p, src, src_len, start, max_block_size, seqs, max_block_sequences, &num_sequences);
+    last_block = (block_end == src_len);
+    write_block(&bw, ws, seqs, num_sequences, src + start, block_end - start, last_block);
+    start = block_end;
+  } while (!last_block);
+  entropy::align_bits(&bw);
+  if (crc_table) {
+    entropy::put_bits(&bw, crc32(crc_table, src, src_len), 32);
+    entropy::put_bits(&bw, src_len, 32);
+  }
+  return static_cast<size_t>(bw.cur - dst);
+}
+
+}  // namespace deflate
+}  // namespace io
+}  // namespace cudf
+
+#endif  // __IO_DEFLATE_ENC_H__
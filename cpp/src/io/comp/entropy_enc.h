@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file entropy_enc.h
+ *
+ * Entropy coding functions shared by the host and GPU DEFLATE and ZSTD compressors
+ *
+ * Provides a bounded bit writer, length-limited Huffman code construction and the FSE
+ * (tANS) encoder used by ZSTD, which is the exact inverse of the decoder in unzstd.h.
+ **/
+
+#ifndef __IO_ENTROPY_ENC_H__
+#define __IO_ENTROPY_ENC_H__
+
+#include <cudf/types.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+namespace entropy {
+constexpr uint32_t max_huffman_symbols = 288;
+constexpr uint32_t max_fse_symbols     = 64;
+constexpr uint32_t max_fse_log         = 9;
+
+/**
+ * @brief Bit writer, storing the bits of each byte from the least significant one
+ *
+ * Bytes past the end of the buffer are counted but not written.
+ **/
+struct bit_writer_s {
+  uint8_t *cur;
+  uint8_t *end;
+  uint64_t acc;
+  uint32_t bits;
+};
+
+CUDA_HOST_DEVICE_CALLABLE void init_bit_writer(bit_writer_s *bw, uint8_t *dst, uint8_t *end)
+{
+  bw->cur  = dst;
+  bw->end  = end;
+  bw->acc  = 0;
+  bw->bits = 0;
+}
+
+/**
+ * @brief Writes the n (up to 32) lower bits of a value
+ **/
+CUDA_HOST_DEVICE_CALLABLE void put_bits(bit_writer_s *bw, uint32_t value, uint32_t n)
+{
+  bw->acc |= static_cast<uint64_t>(value & static_cast<uint32_t>((1ull << n) - 1)) << bw->bits;
+  bw->bits += n;
+  while (bw->bits >= 8) {
+    if (bw->cur < bw->end) { *bw->cur = static_cast<uint8_t>(bw->acc); }
+    bw->cur++;
+    bw->acc >>= 8;
+    bw->bits -= 8;
+  }
+}
+
+/**
+ * @brief Writes a byte at the current position, which must be byte-aligned
+ **/
+CUDA_HOST_DEVICE_CALLABLE void put_byte(bit_writer_s *bw, uint8_t b)
+{
+  if (bw->cur < bw->end) { *bw->cur = b; }
+  bw->cur++;
+}
+
+/**
+ * @brief Pads the last byte with zero bits
+ **/
+CUDA_HOST_DEVICE_CALLABLE void align_bits(bit_writer_s *bw)
+{
+  if (bw->bits > 0) { put_bits(bw, 0, 8 - bw->bits); }
+}
+
+/**
+ * @brief Returns the number of bits needed to hold values up to v
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t bit_length(uint32_t v)
+{
+  uint32_t n = 0;
+  while (v) {
+    n++;
+    v >>= 1;
+  }
+  return n;
+}
+
+/**
+ * @brief Scratch memory of build_huffman_lengths
+ **/
+struct huffman_scratch_s {
+  uint16_t sorted[max_huffman_symbols];
+  uint32_t weight[max_huffman_symbols * 2];
+  uint16_t parent[max_huffman_symbols * 2];
+  uint8_t depth[max_huffman_symbols * 2];
+};
+
+/**
+ * @brief Computes length-limited Huffman code lengths
+ *
+ * Builds an optimal code with the two-queue method on the symbols sorted by frequency. While
+ * the code is longer than allowed, the frequencies are halved, which flattens the tree.
+ * A single used symbol gets a 1-bit code.
+ *
+ * @param[in] freq Symbol frequencies
+ * @param[in] num_symbols Number of symbols
+ * @param[in] max_bits Maximum code length
+ * @param[out] lengths Code lengths, 0 for unused symbols
+ * @param[in] scratch Scratch memory
+ *
+ * @return Length of the longest code
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t build_huffman_lengths(const uint32_t *freq,
+                                                         uint32_t num_symbols,
+                                                         uint32_t max_bits,
+                                                         uint8_t *lengths,
+                                                         huffman_scratch_s *scratch)
+{
+  uint16_t *sorted = scratch->sorted;
+  uint32_t *weight = scratch->weight;
+  uint16_t *parent = scratch->parent;
+  uint8_t *depth   = scratch->depth;
+  uint32_t n       = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    lengths[s] = 0;
+    if (freq[s] == 0) { continue; }
+    // Insertion sort by increasing frequency
+    uint32_t i = n++;
+    while (i > 0 && freq[sorted[i - 1]] > freq[s]) {
+      sorted[i] = sorted[i - 1];
+      i--;
+    }
+    sorted[i] = static_cast<uint16_t>(s);
+  }
+  if (n == 0) { return 0; }
+  if (n == 1) {
+    lengths[sorted[0]] = 1;
+    return 1;
+  }
+  for (uint32_t i = 0; i < n; i++) { weight[i] = freq[sorted[i]]; }
+  for (;;) {
+    // Leaves are [0, n), internal nodes [n, 2n - 1) in order of creation
+    uint32_t leaf = 0, node = n;
+    for (uint32_t k = n; k < 2 * n - 1; k++) {
+      uint32_t children[2];
+      for (uint32_t c = 0; c < 2; c++) {
+        if (leaf < n && (node >= k || weight[leaf] <= weight[node])) {
+          children[c] = leaf++;
+        } else {
+          children[c] = node++;
+        }
+      }
+      weight[k]           = weight[children[0]] + weight[children[1]];
+      parent[children[0]] = static_cast<uint16_t>(k);
+      parent[children[1]] = static_cast<uint16_t>(k);
+    }
+    uint32_t max_depth = 0;
+    depth[2 * n - 2]   = 0;
+    for (uint32_t k = 2 * n - 2; k-- > 0;) {
+      depth[k] = depth[parent[k]] + 1;
+      if (k < n && depth[k] > max_depth) { max_depth = depth[k]; }
+    }
+    if (max_depth <= max_bits) {
+      for (uint32_t i = 0; i < n; i++) { lengths[sorted[i]] = depth[i]; }
+      return max_depth;
+    }
+    for (uint32_t i = 0; i < n; i++) { weight[i] = (weight[i] >> 1) | 1; }
+  }
+}
+
+/**
+ * @brief FSE encoding table
+ **/
+struct fse_ctable_s {
+  uint16_t state_table[1 << max_fse_log];
+  uint16_t first_state[max_fse_symbols];
+  int32_t delta_find_state[max_fse_symbols];
+  uint32_t delta_nb_bits[max_fse_symbols];
+  uint32_t log;
+};
+
+/**
+ * @brief FSE encoder state
+ **/
+struct fse_state_s {
+  uint32_t value;
+};
+
+/**
+ * @brief Normalizes symbol counts to a sum of 2^log, keeping every used symbol above zero
+ *
+ * @param[out] norm Normalized counts
+ * @param[in] count Symbol counts
+ * @param[in] max_symbol Largest symbol
+ * @param[in] total Sum of the counts
+ * @param[in] log Accuracy log of the table
+ **/
+CUDA_HOST_DEVICE_CALLABLE void normalize_counts(
+  int16_t *norm, const uint32_t *count, uint32_t max_symbol, uint32_t total, uint32_t log)
+{
+  int32_t table_size = 1 << log;
+  int32_t sum        = 0;
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    int32_t v = 0;
+    if (count[s] != 0) {
+      v = static_cast<int32_t>((static_cast<uint64_t>(count[s]) * table_size + total / 2) / total);
+      if (v < 1) { v = 1; }
+    }
+    norm[s] = static_cast<int16_t>(v);
+    sum += v;
+  }
+  // Give the excess to, or take the deficit from, the most probable symbols
+  while (sum != table_size) {
+    uint32_t best = 0;
+    for (uint32_t s = 1; s <= max_symbol; s++) {
+      if (norm[s] > norm[best]) { best = s; }
+    }
+    if (sum < table_size) {
+      norm[best] += static_cast<int16_t>(table_size - sum);
+      sum = table_size;
+    } else {
+      int32_t d = sum - table_size;
+      if (d > norm[best] - 1) { d = norm[best] - 1; }
+      norm[best] -= static_cast<int16_t>(d);
+      sum -= d;
+    }
+  }
+}
+
+/**
+ * @brief Returns the accuracy log to use for a table of the given counts
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t fse_table_log(uint32_t total,
+                                                 uint32_t num_used,
+                                                 uint32_t max_log)
+{
+  uint32_t log = bit_length(total - 1);
+  uint32_t min = bit_length(num_used) + 1;
+  if (log < min) { log = min; }
+  if (log < 5) { log = 5; }
+  return (log > max_log) ? max_log : log;
+}
+
+/**
+ * @brief Writes the description of an FSE table, as read by read_fse_probabilities
+ *
+ * The last symbol must have a nonzero count.
+ **/
+CUDA_HOST_DEVICE_CALLABLE void write_fse_probabilities(bit_writer_s *bw,
+                                                       const int16_t *norm,
+                                                       uint32_t max_symbol,
+                                                       uint32_t log)
+{
+  int32_t table_size = 1 << log;
+  int32_t remaining  = table_size + 1;
+  int32_t threshold  = table_size;
+  uint32_t nb_bits   = log + 1;
+  uint32_t symbol    = 0;
+  bool prev_zero     = false;
+  put_bits(bw, log - 5, 4);
+  while (symbol <= max_symbol && remaining > 1) {
+    if (prev_zero) {
+      // Repeat flags for runs of zero probabilities
+      uint32_t start = symbol;
+      while (symbol <= max_symbol && norm[symbol] == 0) { symbol++; }
+      while (symbol >= start + 3) {
+        put_bits(bw, 3, 2);
+        start += 3;
+      }
+      put_bits(bw, symbol - start, 2);
+    }
+    int32_t count     = norm[symbol++];
+    int32_t max_value = (2 * threshold - 1) - remaining;
+    remaining -= (count < 0) ? -count : count;
+    count++;
+    if (count >= threshold) { count += max_value; }
+    put_bits(bw, count, (count < max_value) ? nb_bits - 1 : nb_bits);
+    prev_zero = (count == 1);
+    while (remaining < threshold) {
+      nb_bits--;
+      threshold >>= 1;
+    }
+  }
+}
+
+/**
+ * @brief Builds an FSE encoding table from normalized counts, spreading the symbols like
+ * build_fse_table
+ **/
+CUDA_HOST_DEVICE_CALLABLE void build_fse_ctable(fse_ctable_s *ct,
+                                                const int16_t *norm,
+                                                uint32_t max_symbol,
+                                                uint32_t log)
+{
+  uint8_t table_symbol[1 << max_fse_log];
+  uint32_t cumul[max_fse_symbols + 1];
+  uint32_t table_size = 1 << log;
+  uint32_t high       = table_size - 1;
+  cumul[0]            = 0;
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    if (norm[s] == -1) {
+      cumul[s + 1]         = cumul[s] + 1;
+      table_symbol[high--] = static_cast<uint8_t>(s);
+    } else {
+      cumul[s + 1] = cumul[s] + norm[s];
+    }
+  }
+  uint32_t step = (table_size >> 1) + (table_size >> 3) + 3;
+  uint32_t mask = table_size - 1;
+  uint32_t pos  = 0;
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    for (int32_t i = 0; i < norm[s]; i++) {
+      table_symbol[pos] = static_cast<uint8_t>(s);
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high);
+    }
+  }
+  for (uint32_t u = 0; u < table_size; u++) {
+    ct->state_table[cumul[table_symbol[u]]++] = static_cast<uint16_t>(table_size + u);
+  }
+  int32_t total = 0;
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    switch (norm[s]) {
+      case 0: ct->delta_nb_bits[s] = ((log + 1) << 16) - table_size; break;
+      case -1:
+      case 1:
+        ct->delta_nb_bits[s]    = (log << 16) - table_size;
+        ct->delta_find_state[s] = total - 1;
+        ct->first_state[s]      = ct->state_table[total];
+        total++;
+        break;
+      default: {
+        uint32_t max_bits_out   = log - bit_length(norm[s] - 1) + 1;
+        uint32_t min_state_plus = static_cast<uint32_t>(norm[s]) << max_bits_out;
+        ct->delta_nb_bits[s]    = (max_bits_out << 16) - min_state_plus;
+        ct->delta_find_state[s] = total - norm[s];
+        ct->first_state[s]      = ct->state_table[total];
+        total += norm[s];
+      }
+    }
+  }
+  ct->log = log;
+}
+
+/**
+ * @brief Initializes an encoder state with the first symbol to encode, without output
+ *
+ * The state is the first one of the symbol in the table, which is decoded with at least one bit
+ * unless the symbol has the whole probability. The Huffman weights decoder relies on this to
+ * detect the end of the stream.
+ **/
+CUDA_HOST_DEVICE_CALLABLE void init_fse_state(fse_state_s *st,
+                                              const fse_ctable_s *ct,
+                                              uint32_t symbol)
+{
+  st->value = ct->first_state[symbol];
+}
+
+/**
+ * @brief Encodes a symbol, writing the bits of the state transition
+ **/
+CUDA_HOST_DEVICE_CALLABLE void encode_fse_symbol(bit_writer_s *bw,
+                                                 fse_state_s *st,
+                                                 const fse_ctable_s *ct,
+                                                 uint32_t symbol)
+{
+  uint32_t nb_bits_out = (st->value + ct->delta_nb_bits[symbol]) >> 16;
+  put_bits(bw, st->value, nb_bits_out);
+  st->value = ct->state_table[(st->value >> nb_bits_out) + ct->delta_find_state[symbol]];
+}
+
+/**
+ * @brief Writes the final state, read first by the decoder
+ **/
+CUDA_HOST_DEVICE_CALLABLE void flush_fse_state(bit_writer_s *bw,
+                                               const fse_state_s *st,
+                                               const fse_ctable_s *ct)
+{
+  put_bits(bw, st->value, ct->log);
+}
+
+}  // namespace entropy
+}  // namespace io
+}  // namespace cudf
+
+#endif  // __IO_ENTROPY_ENC_H__
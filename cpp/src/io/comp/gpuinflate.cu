@@ -46,6 +46,16 @@ Mark Adler    madler@alumni.caltech.edu
 #include <io/utilities/block_utils.cuh>
 #include "gpuinflate.h"
 
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace io {
 #define NUMTHREADS 128  // Threads per block
@@ -1017,23 +1027,22 @@ __device__ int parse_gzip_header(const uint8_t *src, size_t src_size)
 }
 
 /**
- * @brief INFLATE decompression kernel
- *
- * blockDim {NUMTHREADS,1,1}
+ * @brief Decompresses one compressed block with the whole threadblock
  *
+ * @param state Shared decoder state
  * @param inputs Source and destination buffer information per block
  * @param outputs Decompression status buffer per block
+ * @param z Index of the block to decompress
  * @param parse_hdr If nonzero, indicates that the compressed bitstream includes a GZIP header
+ * @param t Thread index
  **/
-__global__ void __launch_bounds__(NUMTHREADS)
-  inflate_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int parse_hdr)
+__device__ void inflate_block(inflate_state_s *state,
+                              gpu_inflate_input_s *inputs,
+                              gpu_inflate_status_s *outputs,
+                              int z,
+                              int parse_hdr,
+                              int t)
 {
-  __shared__ __align__(16) inflate_state_s state_g;
-
-  int t                  = threadIdx.x;
-  int z                  = blockIdx.x;
-  inflate_state_s *state = &state_g;
-
   if (!t) {
     uint8_t *p      = (uint8_t *)inputs[z].srcDevice;
     size_t src_size = inputs[z].srcSize;
@@ -1138,6 +1147,60 @@ __global__ void __launch_bounds__(NUMTHREADS)
   }
 }
 
+/**
+ * @brief INFLATE decompression kernel
+ *
+ * blockDim {NUMTHREADS,1,1}
+ *
+ * @param inputs Source and destination buffer information per block
+ * @param outputs Decompression status buffer per block
+ * @param parse_hdr If nonzero, indicates that the compressed bitstream includes a GZIP header
+ **/
+__global__ void __launch_bounds__(NUMTHREADS)
+  inflate_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int parse_hdr)
+{
+  __shared__ __align__(16) inflate_state_s state_g;
+
+  inflate_block(&state_g, inputs, outputs, blockIdx.x, parse_hdr, threadIdx.x);
+}
+
+/**
+ * @brief INFLATE decompression kernel for a grid of resident threadblocks, each picking the next
+ * block in the given order when done with its previous block
+ *
+ * Ordering the blocks from the largest keeps a large block from being decompressed last, and
+ * threadblocks run through many small blocks without waiting on a new threadblock launch.
+ *
+ * blockDim {NUMTHREADS,1,1}
+ *
+ * @param inputs Source and destination buffer information per block
+ * @param outputs Decompression status buffer per block
+ * @param parse_hdr If nonzero, indicates that the compressed bitstream includes a GZIP header
+ * @param block_order Indices of the blocks, in the order they should be decompressed
+ * @param next_block Position in block_order of the next block to decompress, initially zero
+ * @param count Number of blocks
+ **/
+__global__ void __launch_bounds__(NUMTHREADS)
+  inflate_scheduled_kernel(gpu_inflate_input_s *inputs,
+                           gpu_inflate_status_s *outputs,
+                           int parse_hdr,
+                           const uint32_t *block_order,
+                           uint32_t *next_block,
+                           uint32_t count)
+{
+  __shared__ __align__(16) inflate_state_s state_g;
+  __shared__ uint32_t block_pos_g;
+
+  for (;;) {
+    if (!threadIdx.x) { block_pos_g = atomicAdd(next_block, 1); }
+    __syncthreads();
+    uint32_t block_pos = block_pos_g;
+    if (block_pos >= count) break;
+    inflate_block(&state_g, inputs, outputs, block_order[block_pos], parse_hdr, threadIdx.x);
+    __syncthreads();
+  }
+}
+
 /**
  * @brief Copy a group of buffers
  *
@@ -1201,7 +1264,39 @@ cudaError_t __host__ gpuinflate(gpu_inflate_input_s *inputs,
                                 int parse_hdr,
                                 cudaStream_t stream)
 {
-  if (count > 0) { inflate_kernel<<<count, NUMTHREADS, 0, stream>>>(inputs, outputs, parse_hdr); }
+  if (count <= 0) { return cudaSuccess; }
+  int dev            = 0;
+  int sm_count       = 0;
+  int blocks_per_sm  = 0;
+  int resident_count = 0;
+  if (cudaGetDevice(&dev) == cudaSuccess &&
+      cudaDeviceGetAttribute(&sm_count, cudaDevAttrMultiProcessorCount, dev) == cudaSuccess &&
+      cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &blocks_per_sm, inflate_scheduled_kernel, NUMTHREADS, 0) == cudaSuccess) {
+    resident_count = sm_count * blocks_per_sm;
+  }
+  if (count <= resident_count * 2 || resident_count <= 0) {
+    // All blocks are decompressed in about one wave, so the order makes little difference
+    inflate_kernel<<<count, NUMTHREADS, 0, stream>>>(inputs, outputs, parse_hdr);
+    return cudaSuccess;
+  }
+
+  // Decompress from the largest block, with sizes as a proxy for the time taken by each block
+  rmm::device_buffer schedule((2 * count + 1) * sizeof(uint32_t), stream);
+  uint32_t *block_order = static_cast<uint32_t *>(schedule.data());
+  uint32_t *block_sizes = block_order + count;
+  uint32_t *next_block  = block_sizes + count;
+  auto policy           = rmm::exec_policy(stream)->on(stream);
+  thrust::sequence(policy, block_order, block_order + count);
+  thrust::transform(
+    policy, inputs, inputs + count, block_sizes, [] __device__(const gpu_inflate_input_s &in) {
+      return static_cast<uint32_t>((in.srcSize < UINT32_MAX) ? in.srcSize : UINT32_MAX);
+    });
+  thrust::sort_by_key(
+    policy, block_sizes, block_sizes + count, block_order, thrust::greater<uint32_t>());
+  CUDA_TRY(cudaMemsetAsync(next_block, 0, sizeof(uint32_t), stream));
+  inflate_scheduled_kernel<<<resident_count, NUMTHREADS, 0, stream>>>(
+    inputs, outputs, parse_hdr, block_order, next_block, count);
   return cudaSuccess;
 }
 
@@ -45,6 +45,8 @@ struct gpu_inflate_status_s {
  *
  * Multiple, independent chunks of compressed data can be decompressed by using
  * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * When there are more chunks than resident threadblocks, chunks are decompressed from the
+ * largest one, each threadblock moving on to the next chunk when done.
  *
  * @param[in] inputs List of input argument structures
  * @param[out] outputs List of output status structures
@@ -85,6 +87,23 @@ cudaError_t gpu_unsnap(gpu_inflate_input_s *inputs,
                        int count           = 1,
                        cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for decompressing ZSTD-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Each chunk may hold several frames; dictionaries are not supported.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       int count           = 1,
+                       cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Computes the size of temporary memory for Brotli decompression
  *
@@ -130,6 +149,47 @@ cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      int count           = 1,
                      cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for compressing data with DEFLATE
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * A chunk whose compressed data does not fit in dstSize gets a nonzero status.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] level Compression level from 1 to 9, default 0 for level 6
+ * @param[in] gzip_hdr Whether or not to add the GZIP header and trailer, default false
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_deflate(gpu_inflate_input_s *inputs,
+                        gpu_inflate_status_s *outputs,
+                        int count           = 1,
+                        int level           = 0,
+                        int gzip_hdr        = 0,
+                        cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for compressing data with ZSTD
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Each chunk is compressed into one frame; a chunk whose compressed data does not fit in
+ * dstSize gets a nonzero status.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] level Compression level from 1 to 9, default 0 for level 3
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_zstd(gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     int count           = 1,
+                     int level           = 0,
+                     cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace io
 }  // namespace cudf
 
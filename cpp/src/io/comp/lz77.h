@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file lz77.h
+ *
+ * LZ77 match finder shared by the host and GPU DEFLATE and ZSTD compressors
+ *
+ * Matches are found with a hash table of 4-byte prefixes, where each bucket holds the latest
+ * positions with that hash. The input is parsed into blocks of sequences, each made of a run
+ * of literals followed by a match, which the compressors then entropy code.
+ **/
+
+#ifndef __IO_LZ77_H__
+#define __IO_LZ77_H__
+
+#include <cudf/types.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+namespace lz77 {
+constexpr uint32_t min_match = 4;
+constexpr uint32_t hash_bits = 10;
+constexpr uint32_t max_ways  = 4;
+
+/**
+ * @brief Run of literals followed by a match
+ **/
+struct sequence_s {
+  uint32_t literal_length;
+  uint32_t match_length;
+  uint32_t offset;
+};
+
+/**
+ * @brief Match finder parameters, derived from the compression level
+ **/
+struct params_s {
+  uint32_t max_offset;  // Largest match distance
+  uint32_t max_match;   // Longest match
+  uint32_t ways;        // Number of candidates searched for each position, up to max_ways
+  uint32_t lazy;        // Whether to look for a longer match at the next position
+  uint32_t skip_log;    // Step increase with the length of the literals run, 0 to disable
+};
+
+/**
+ * @brief Hash table of the previous positions, as position + 1 (0 for empty entries)
+ **/
+struct matcher_s {
+  uint32_t table[(1 << hash_bits) * max_ways];
+};
+
+/**
+ * @brief Returns the hash bucket of the 4 bytes at the given position
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t hash4(const uint8_t *p)
+{
+  uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  return (v * 2654435761u) >> (32 - hash_bits);
+}
+
+/**
+ * @brief Inserts a position in the hash table, dropping the oldest position of the bucket
+ **/
+CUDA_HOST_DEVICE_CALLABLE void insert(matcher_s *m,
+                                      const params_s &p,
+                                      const uint8_t *src,
+                                      uint32_t pos)
+{
+  uint32_t *bucket = &m->table[hash4(src + pos) * max_ways];
+  for (uint32_t i = p.ways - 1; i > 0; i--) { bucket[i] = bucket[i - 1]; }
+  bucket[0] = pos + 1;
+}
+
+/**
+ * @brief Finds the longest match for the given position
+ *
+ * @param[in] m Hash table
+ * @param[in] p Match finder parameters
+ * @param[in] src Input data
+ * @param[in] end End of the data usable by the match
+ * @param[in] pos Position to match
+ * @param[out] offset Distance of the match
+ *
+ * @return Length of the match, 0 if no match of at least min_match bytes was found
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t find_match(const matcher_s *m,
+                                              const params_s &p,
+                                              const uint8_t *src,
+                                              uint32_t end,
+                                              uint32_t pos,
+                                              uint32_t *offset)
+{
+  uint32_t best    = 0;
+  uint32_t max_len = end - pos;
+  if (max_len < min_match) { return 0; }
+  if (max_len > p.max_match) { max_len = p.max_match; }
+  const uint32_t *bucket = &m->table[hash4(src + pos) * max_ways];
+  for (uint32_t i = 0; i < p.ways; i++) {
+    // Positions are ordered from the latest, so the remaining ones are farther away
+    if (bucket[i] == 0 || pos - (bucket[i] - 1) > p.max_offset) { break; }
+    const uint8_t *cand = src + bucket[i] - 1;
+    uint32_t len        = 0;
+    while (len < max_len && cand[len] == src[pos + len]) { len++; }
+    if (len > best) {
+      best    = len;
+      *offset = pos - (bucket[i] - 1);
+      if (len == max_len) { break; }
+    }
+  }
+  return (best >= min_match) ? best : 0;
+}
+
+/**
+ * @brief Parses the input into a block of sequences
+ *
+ * The block ends at the end of the input, at `max_size` bytes from the start, or after
+ * `max_sequences` sequences, whichever comes first. The literals following the last sequence,
+ * up to the end of the block, are not part of any sequence.
+ *
+ * @param[in,out] m Hash table
+ * @param[in] p Match finder parameters
+ * @param[in] src Input data
+ * @param[in] src_len Length of the input data
+ * @param[in] start Start of the block
+ * @param[in] max_size Maximum size of the block
+ * @param[out] seqs Sequences of the block
+ * @param[in] max_sequences Maximum number of sequences in the block
+ * @param[out] num_sequences Number of sequences in the block
+ *
+ * @return End of the block
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t parse_block(matcher_s *m,
+                                               const params_s &p,
+                                               const uint8_t *src,
+                                               uint32_t src_len,
+                                               uint32_t start,
+                                               uint32_t max_size,
+                                               sequence_s *seqs,
+                                               uint32_t max_sequences,
+                                               uint32_t *num_sequences)
+{
+  uint32_t end       = (src_len - start > max_size) ? start + max_size : src_len;
+  uint32_t pos       = start;
+  uint32_t lit_start = start;
+  uint32_t n         = 0;
+  while (pos + min_match <= end && n < max_sequences) {
+    uint32_t offset = 0;
+    uint32_t len    = find_match(m, p, src, end, pos, &offset);
+    if (len == 0) {
+      // Take larger steps through runs of literals, which are likely incompressible
+      uint32_t step = (p.skip_log) ? 1 + ((pos - lit_start) >> p.skip_log) : 1;
+      insert(m, p, src, pos);
+      pos += step;
+      continue;
+    }
+    if (p.lazy && pos + 1 + min_match <= end) {
+      uint32_t next_offset = 0;
+      uint32_t next_len    = find_match(m, p, src, end, pos + 1, &next_offset);
+      if (next_len > len) {
+        insert(m, p, src, pos);
+        pos++;
+        len    = next_len;
+        offset = next_offset;
+      }
+    }
+    seqs[n].literal_length = pos - lit_start;
+    seqs[n].match_length   = len;
+    seqs[n].offset         = offset;
+    n++;
+    for (uint32_t i = 0; i < len && pos + i + min_match <= end; i++) { insert(m, p, src, pos + i); }
+    pos += len;
+    lit_start = pos;
+  }
+  *num_sequences = n;
+  return (n == max_sequences) ? pos : end;
+}
+
+}  // namespace lz77
+}  // namespace io
+}  // namespace cudf
+
+#endif  // __IO_LZ77_H__
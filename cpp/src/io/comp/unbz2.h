@@ -83,6 +83,8 @@ namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
 // the end of the last valid block, and block_start will contain the offset in bits of the beginning
 // of the block, so it can be passed in to resume decoding later on.
+// Decoding stops before the first block starting at or after block_end (in bits), with BZ_OK
+// returned and block_start pointing to that block.
 #define BZ_OK 0
 #define BZ_RUN_OK 1
 #define BZ_FLUSH_OK 2
@@ -101,7 +103,8 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t inlen,
                            uint8_t *dst,
                            size_t *dstlen,
-                           uint64_t *block_start = nullptr);
+                           uint64_t *block_start = nullptr,
+                           uint64_t block_end    = ~0ull);
 
 }  // namespace io
 }  // namespace cudf
@@ -19,7 +19,16 @@
 #include <string.h>  // memset
 #include <zlib.h>    // uncompress
 #include "io_uncomp.h"
-#include "unbz2.h"  // bz2 uncompress
+#include "unbz2.h"   // bz2 uncompress
+#include "unzstd.h"  // zstd decoding
+
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include <cudf/utilities/error.hpp>
 
@@ -278,11 +287,274 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+// Minimum size of the compressed data decoded by each host thread
+constexpr size_t min_parallel_range_size = 1 << 20;
+// Largest buffer passed to zlib at once (avail_in and avail_out are 32-bit)
+constexpr size_t max_zlib_buffer_size = 1u << 30;
+// Signature at the start of every bzip2 block (48 bits, not byte-aligned)
+constexpr uint64_t bz2_block_magic = 0x314159265359ull;
+
+/**
+ * @brief Uncompressed data of a range of consecutive gzip members or bzip2 blocks
+ **/
+struct uncomp_range_s {
+  std::vector<char> data;  // Uncompressed data
+  uint64_t start;          // Start of the range (in bytes for gzip, in bits for bzip2)
+  uint64_t end;            // Position at which decoding stopped
+  bool ok;                 // Whether the range was decoded without errors
+};
+
+/**
+ * @brief Grows an output buffer whose uncompressed size is not known in advance
+ **/
+static void grow_uncomp_buffer(std::vector<char> &dst)
+{
+  dst.resize(dst.size() + dst.size() / 2 + (1 << 20));
+}
+
+/**
+ * @brief Returns whether a gzip member header starts at the given offset
+ **/
+static bool is_gz_member(const uint8_t *raw, size_t len, size_t pos)
+{
+  return pos + sizeof(gz_file_header_s) + 8 <= len && raw[pos] == 0x1f && raw[pos + 1] == 0x8b &&
+         raw[pos + 2] == 8 && (raw[pos + 3] & 0xe0) == 0;
+}
+
+/**
+ * @brief Uncompresses consecutive gzip members, from the start of the range until reaching the
+ * limit or data that is not a gzip member
+ *
+ * @param[in] raw Gzip file data
+ * @param[in] len Size of the gzip file data
+ * @param[in] limit Offset at which no further member is decoded
+ * @param[in] size_hint Initial size of the output buffer
+ * @param[in,out] r Range to decode
+ *
+ * @return Whether the members were decoded without errors
+ **/
+static bool gz_uncompress_range(
+  const uint8_t *raw, size_t len, uint64_t limit, size_t size_hint, uncomp_range_s *r)
+{
+  z_stream strm;
+  size_t pos = r->start;
+  size_t out = 0;
+  int zerr   = Z_OK;
+
+  r->data.resize(size_hint);
+  memset(&strm, 0, sizeof(strm));
+  if (inflateInit2(&strm, 16 + 15) != Z_OK) {  // 16 + 15 for a gzip header and trailer
+    return false;
+  }
+  while (pos < limit && is_gz_member(raw, len, pos)) {
+    size_t in_end = pos;
+    inflateReset(&strm);
+    strm.avail_in = 0;
+    do {
+      if (strm.avail_in == 0 && in_end < len) {
+        size_t in_len = std::min(len - in_end, max_zlib_buffer_size);
+        strm.next_in  = const_cast<Bytef *>(raw + in_end);
+        strm.avail_in = in_len;
+        in_end += in_len;
+      }
+      if (out == r->data.size()) { grow_uncomp_buffer(r->data); }
+      size_t out_len = std::min(r->data.size() - out, max_zlib_buffer_size);
+      strm.next_out  = reinterpret_cast<Bytef *>(r->data.data() + out);
+      strm.avail_out = out_len;
+      zerr           = inflate(&strm, Z_NO_FLUSH);
+      out += out_len - strm.avail_out;
+    } while (zerr == Z_OK);
+    if (zerr != Z_STREAM_END) { break; }
+    pos = in_end - strm.avail_in;
+  }
+  inflateEnd(&strm);
+  r->data.resize(out);
+  r->end = pos;
+  return (zerr == Z_OK || zerr == Z_STREAM_END);
+}
+
+/**
+ * @brief Returns whether a bzip2 stream with at least one block starts at the given offset
+ **/
+static bool is_bz2_stream(const uint8_t *raw, size_t len, size_t pos)
+{
+  if (pos + 14 > len || raw[pos] != 'B' || raw[pos + 1] != 'Z' || raw[pos + 2] != 'h' ||
+      raw[pos + 3] < '1' || raw[pos + 3] > '9') {
+    return false;
+  }
+  uint64_t magic = 0;
+  for (int i = 4; i < 10; i++) { magic = (magic << 8) | raw[pos + i]; }
+  return magic == bz2_block_magic;
+}
+
+/**
+ * @brief Uncompresses consecutive bzip2 blocks, from the start of the range until reaching the
+ * limit or the end of the data
+ *
+ * Blocks of any stream concatenated after the first one are decoded with the block size of the
+ * first stream.
+ *
+ * @param[in] raw Bzip2 file data
+ * @param[in] len Size of the bzip2 file data
+ * @param[in] limit Offset in bits at which no further block is decoded
+ * @param[in] size_hint Initial size of the output buffer
+ * @param[in,out] r Range to decode
+ *
+ * @return Whether the blocks were decoded without errors
+ **/
+static bool bz2_uncompress_range(
+  const uint8_t *raw, size_t len, uint64_t limit, size_t size_hint, uncomp_range_s *r)
+{
+  uint64_t pos = r->start;
+  size_t out   = 0;
+  int bz_err   = BZ_OK;
+
+  r->data.resize(size_hint);
+  for (;;) {
+    do {
+      if (bz_err == BZ_OUTBUFF_FULL || out == r->data.size()) { grow_uncomp_buffer(r->data); }
+      size_t dst_len = r->data.size() - out;
+      bz_err         = cpu_bz2_uncompress(
+        raw, len, reinterpret_cast<uint8_t *>(r->data.data()) + out, &dst_len, &pos, limit);
+      out += dst_len;
+    } while (bz_err == BZ_OUTBUFF_FULL);
+    if (bz_err != BZ_OK || pos >= limit) { break; }
+    // End of stream: skip the combined CRC and the padding to the next byte-aligned stream
+    size_t next_stream = static_cast<size_t>((pos + 32 + 7) >> 3);
+    if (!is_bz2_stream(raw, len, next_stream)) { break; }
+    pos = (next_stream + 4) * 8;
+  }
+  r->data.resize(out);
+  r->end = pos;
+  return (bz_err == BZ_OK);
+}
+
+/**
+ * @brief Finds the bit offsets of the bzip2 block signatures starting within a byte range
+ **/
+static void find_bz2_blocks(const uint8_t *raw,
+                            size_t len,
+                            size_t begin,
+                            size_t end,
+                            std::vector<uint64_t> &blocks)
+{
+  uint64_t window = 0;  // Big-endian bytes [i, i + 8)
+  for (size_t i = begin; i < begin + 7; i++) {
+    window = (window << 8) | ((i < len) ? raw[i] : 0);
+  }
+  for (size_t i = begin; i < end; i++) {
+    window = (window << 8) | ((i + 7 < len) ? raw[i + 7] : 0);
+    for (uint32_t bit = 0; bit < 8; bit++) {
+      if (((window >> (16 - bit)) & 0xffffffffffffull) == bz2_block_magic) {
+        blocks.push_back(i * 8 + bit);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Picks the start of the ranges decoded by each host thread among the candidate starts
+ *
+ * @param[in] candidates Sorted positions that likely start a gzip member or a bzip2 block
+ * @param[in] begin Start of the first range
+ * @param[in] end End of the data
+ * @param[in] num_ranges Maximum number of ranges
+ *
+ * @return Start of each range, evenly spaced through the data
+ **/
+static std::vector<uint64_t> split_ranges(const std::vector<uint64_t> &candidates,
+                                          uint64_t begin,
+                                          uint64_t end,
+                                          size_t num_ranges)
+{
+  std::vector<uint64_t> starts{begin};
+  for (size_t i = 1; i < num_ranges; i++) {
+    uint64_t target = begin + (end - begin) * i / num_ranges;
+    auto it         = std::lower_bound(candidates.begin(), candidates.end(), target);
+    if (it != candidates.end() && *it > starts.back()) { starts.push_back(*it); }
+  }
+  return starts;
+}
+
+/**
+ * @brief Uncompresses ranges of gzip members or bzip2 blocks in parallel, then concatenates
+ * them in order
+ *
+ * A candidate start may be a false match within the compressed data. Decoding the previous range
+ * then ends beyond it, and the data from the end of the previous range is decoded again on the
+ * calling thread.
+ *
+ * @param[in] starts Start of each range
+ * @param[in] uncompress_range Functor decoding a range up to the given limit
+ * @param[out] dst Vector containing the uncompressed output
+ **/
+template <typename UncompressRange>
+static void uncompress_ranges(const std::vector<uint64_t> &starts,
+                              UncompressRange uncompress_range,
+                              std::vector<char> &dst)
+{
+  constexpr uint64_t no_limit = std::numeric_limits<uint64_t>::max();
+  std::vector<uncomp_range_s> ranges(starts.size());
+  if (ranges.size() == 1) {
+    ranges[0].start = starts[0];
+    ranges[0].ok    = uncompress_range(no_limit, &ranges[0]);
+  } else {
+    std::vector<std::future<void>> tasks;
+    for (size_t i = 0; i < ranges.size(); i++) {
+      ranges[i].start      = starts[i];
+      const uint64_t limit = (i + 1 < starts.size()) ? starts[i + 1] : no_limit;
+      tasks.emplace_back(std::async(std::launch::async, [&, i, limit]() {
+        ranges[i].ok = uncompress_range(limit, &ranges[i]);
+      }));
+    }
+    for (auto &task : tasks) { task.get(); }
+  }
+
+  // Chain the ranges from the start of the data
+  std::deque<uncomp_range_s> redone;
+  std::vector<uncomp_range_s *> parts;
+  uint64_t pos = starts[0];
+  size_t k     = 0;
+  for (;;) {
+    while (k < ranges.size() && ranges[k].start < pos) { k++; }
+    uncomp_range_s *r = nullptr;
+    uint64_t limit    = no_limit;
+    if (k < ranges.size() && ranges[k].start == pos && ranges[k].ok) {
+      r     = &ranges[k];
+      limit = (k + 1 < starts.size()) ? starts[k + 1] : no_limit;
+    } else {
+      if (k < ranges.size()) {
+        limit = (ranges[k].start > pos) ? ranges[k].start
+                                        : (k + 1 < starts.size()) ? starts[k + 1] : no_limit;
+      }
+      redone.emplace_back();
+      r        = &redone.back();
+      r->start = pos;
+      r->ok    = uncompress_range(limit, r);
+      CUDF_EXPECTS(r->ok, "Decompression: error in stream");
+    }
+    parts.push_back(r);
+    if (r->end < limit) { break; }  // End of the compressed data
+    pos = r->end;
+  }
+
+  size_t total_size = 0;
+  for (auto *part : parts) { total_size += part->data.size(); }
+  dst.resize(total_size);
+  size_t dst_ofs = 0;
+  for (auto *part : parts) {
+    memcpy(dst.data() + dst_ofs, part->data.data(), part->data.size());
+    dst_ofs += part->data.size();
+    std::vector<char>().swap(part->data);
+  }
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
  * The result is allocated and stored in a vector.
  * If the function call fails, the output vector is empty.
+ * Large gzip files with multiple members, and large bzip2 files, are split between host threads.
  *
  * @param src[in] Pointer to the compressed data in system memory
  * @param src_size[in] The size of the compressed data, in bytes
@@ -377,7 +649,31 @@ void io_uncompress_single_h2d(const void *src,
                                        // ~4:1 compression for initial size
   }
 
-  if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP || strm_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
+  // Gzip members and bzip2 blocks are decoded independently on multiple threads
+  const size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  const size_t num_ranges  = std::min(max_threads, src_size / min_parallel_range_size);
+
+  if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP) {
+    std::vector<uint64_t> members;
+    if (num_ranges > 1) {
+      for (const uint8_t *p = raw + 1; p < raw + src_size;) {
+        p = static_cast<const uint8_t *>(memchr(p, 0x1f, raw + src_size - p));
+        if (p == nullptr) { break; }
+        if (is_gz_member(raw, src_size, p - raw)) { members.push_back(p - raw); }
+        p++;
+      }
+    }
+    auto uncompress_members = [&](uint64_t limit, uncomp_range_s *r) {
+      // The size of the last member is the best guess when decoding all members at once, within
+      // the maximum DEFLATE compression ratio in case the trailer is missing
+      const size_t range_size = std::min<uint64_t>(limit, src_size) - r->start;
+      const size_t size_hint  = (range_size == src_size)
+                                 ? std::min<size_t>(uncomp_len, range_size * 1032)
+                                 : range_size * 4 + 4096;
+      return gz_uncompress_range(raw, src_size, limit, size_hint, r);
+    };
+    uncompress_ranges(split_ranges(members, 0, src_size, num_ranges), uncompress_members, dst);
+  } else if (strm_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
     // INFLATE
     dst.resize(uncomp_len);
     int zerr = cpu_inflate_vector(dst, comp_data, comp_len);
@@ -386,30 +682,27 @@ void io_uncompress_single_h2d(const void *src,
       CUDF_EXPECTS(0, "Decompression: error in stream");
     }
   } else if (strm_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    dst.resize(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, ((uint8_t *)dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
+    constexpr uint64_t first_block = 32;  // After the "BZh1".."BZh9" file header
+    std::vector<uint64_t> blocks;
+    if (num_ranges > 1) {
+      std::vector<std::vector<uint64_t>> range_blocks(max_threads);
+      std::vector<std::future<void>> tasks;
+      for (size_t t = 0; t < max_threads; t++) {
+        const size_t begin = src_size * t / max_threads;
+        const size_t end   = src_size * (t + 1) / max_threads;
+        tasks.emplace_back(std::async(std::launch::async, [&, t, begin, end]() {
+          find_bz2_blocks(raw, src_size, begin, end, range_blocks[t]);
+        }));
       }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    if (bz_err != 0) {
-      dst.resize(0);
-      CUDF_EXPECTS(0, "Decompression: error in stream");
+      for (auto &task : tasks) { task.get(); }
+      for (auto &b : range_blocks) { blocks.insert(blocks.end(), b.begin(), b.end()); }
     }
+    auto uncompress_blocks = [&](uint64_t limit, uncomp_range_s *r) {
+      const size_t range_size = (std::min<uint64_t>(limit, src_size * 8) - r->start) / 8;
+      return bz2_uncompress_range(raw, src_size, limit, range_size * 4 + 4096, r);
+    };
+    uncompress_ranges(
+      split_ranges(blocks, first_block, src_size * 8, num_ranges), uncompress_blocks, dst);
   } else {
     CUDF_EXPECTS(0, "Unsupported compressed stream type");
   }
@@ -570,6 +863,147 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief ZSTD host decompressor class
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() : tables(new zstd::tables_s) {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    size_t src_pos = 0, dst_pos = 0;
+
+    if (!dstBytes || srcLen < 1) { return 0; }
+    while (src_pos < srcLen) {
+      zstd::frame_header_s hdr;
+      if (!zstd::parse_frame_header(&hdr, srcBytes + src_pos, srcLen - src_pos)) { return 0; }
+      src_pos += hdr.header_size;
+      if (hdr.is_skippable) { continue; }
+      // Decode the blocks of the frame
+      const size_t frame_start = dst_pos;
+      uint32_t rep[3]          = {1, 4, 8};
+      tables->ll_valid = tables->of_valid = tables->ml_valid = tables->huf_valid = 0;
+      for (bool is_last = false; !is_last;) {
+        if (src_pos + 3 > srcLen) { return 0; }
+        uint32_t block_hdr  = srcBytes[src_pos] | (srcBytes[src_pos + 1] << 8) |
+                             (srcBytes[src_pos + 2] << 16);
+        uint32_t block_size = block_hdr >> 3;
+        src_pos += 3;
+        is_last = (block_hdr & 1);
+        switch ((block_hdr >> 1) & 3) {
+          case zstd::block_raw:
+            if (src_pos + block_size > srcLen || dst_pos + block_size > dstLen) { return 0; }
+            memcpy(dstBytes + dst_pos, srcBytes + src_pos, block_size);
+            src_pos += block_size;
+            dst_pos += block_size;
+            break;
+          case zstd::block_rle:
+            if (src_pos + 1 > srcLen || dst_pos + block_size > dstLen) { return 0; }
+            memset(dstBytes + dst_pos, srcBytes[src_pos], block_size);
+            src_pos += 1;
+            dst_pos += block_size;
+            break;
+          case zstd::block_compressed:
+            if (block_size > zstd::max_block_size || src_pos + block_size > srcLen ||
+                !DecompressBlock(
+                  dstBytes, dstLen, frame_start, dst_pos, srcBytes + src_pos, block_size, rep)) {
+              return 0;
+            }
+            src_pos += block_size;
+            break;
+          default: return 0;
+        }
+      }
+      if (hdr.has_checksum) { src_pos += 4; }
+      if (src_pos > srcLen ||
+          (hdr.content_size != ~0ull && dst_pos - frame_start != hdr.content_size)) {
+        return 0;
+      }
+    }
+    return dst_pos;
+  }
+
+ protected:
+  /**
+   * @Brief Decompresses a compressed block, returns false if error
+   */
+  bool DecompressBlock(uint8_t *dst,
+                       size_t dst_len,
+                       size_t frame_start,
+                       size_t &dst_pos,
+                       const uint8_t *src,
+                       size_t src_len,
+                       uint32_t *rep)
+  {
+    zstd::literals_s lit;
+    const uint8_t *literals;
+    uint32_t lit_size = zstd::decode_literals_header(tables.get(), &lit, src, src_len);
+    if (lit_size == 0) { return false; }
+    if (lit.type == zstd::literals_raw) {
+      literals = lit.data;
+    } else if (lit.type == zstd::literals_rle) {
+      literals_buf.assign(lit.regenerated_size, lit.data[0]);
+      literals = literals_buf.data();
+    } else {
+      literals_buf.resize(lit.regenerated_size);
+      const uint8_t *stream = lit.data;
+      uint8_t *out          = literals_buf.data();
+      for (uint32_t i = 0; i < lit.num_streams; i++) {
+        if (!zstd::decode_huffman_stream(
+              tables.get(), stream, lit.stream_size[i], out, lit.stream_regen_size[i])) {
+          return false;
+        }
+        stream += lit.stream_size[i];
+        out += lit.stream_regen_size[i];
+      }
+      literals = literals_buf.data();
+    }
+
+    uint32_t num_sequences;
+    int32_t seq_hdr_size = zstd::decode_sequences_header(
+      tables.get(), &num_sequences, src + lit_size, src_len - lit_size);
+    if (seq_hdr_size < 0) { return false; }
+    size_t lit_pos = 0;
+    if (num_sequences > 0) {
+      zstd::sequences_s seq;
+      const size_t seq_pos = lit_size + seq_hdr_size;
+      if (seq_pos >= src_len ||
+          !zstd::init_sequences(&seq, tables.get(), src + seq_pos, src_len - seq_pos)) {
+        return false;
+      }
+      for (uint32_t i = 0; i < num_sequences; i++) {
+        uint32_t ll, ml, offset;
+        zstd::decode_sequence(
+          &seq, tables.get(), rep, &ll, &ml, &offset, i + 1 == num_sequences);
+        if (lit_pos + ll > lit.regenerated_size || dst_pos + ll + ml > dst_len ||
+            offset > dst_pos + ll - frame_start) {
+          return false;
+        }
+        memcpy(dst + dst_pos, literals + lit_pos, ll);
+        lit_pos += ll;
+        dst_pos += ll;
+        for (uint32_t k = 0; k < ml; k++, dst_pos++) { dst[dst_pos] = dst[dst_pos - offset]; }
+      }
+      if (seq.bits.bitpos != 0) { return false; }
+    }
+    // Copy the literals following the last sequence
+    size_t last_literals = lit.regenerated_size - lit_pos;
+    if (dst_pos + last_literals > dst_len) { return false; }
+    memcpy(dst + dst_pos, literals + lit_pos, last_literals);
+    dst_pos += last_literals;
+    return true;
+  }
+
+  std::unique_ptr<zstd::tables_s> tables;
+  std::vector<uint8_t> literals_buf;
+};
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Brief CPU decompression class
@@ -587,6 +1021,7 @@ HostDecompressor *HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: decompressor = new HostDecompressor_ZLIB(true); break;
     case IO_UNCOMP_STREAM_TYPE_INFLATE: decompressor = new HostDecompressor_ZLIB(false); break;
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: decompressor = new HostDecompressor_SNAPPY(); break;
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: decompressor = new HostDecompressor_ZSTD(); break;
     default: decompressor = nullptr; break;
   }
   return decompressor;
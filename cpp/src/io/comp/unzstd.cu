@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+#include "unzstd.h"
+
+namespace cudf {
+namespace io {
+#define LOG2_ZSTD_BATCH_SIZE 5
+#define ZSTD_BATCH_SIZE (1 << LOG2_ZSTD_BATCH_SIZE)
+
+#define ZSTD_BLOCK_END 4  // No more blocks, or error
+
+/**
+ * @brief Describes a single decoded sequence (single entry in batch)
+ **/
+struct unzstd_sequence_s {
+  uint32_t literal_length;  ///< Number of literals copied before the match
+  uint32_t match_length;    ///< Number of bytes copied from the window
+  uint32_t offset;          ///< Match distance
+};
+
+/**
+ * @brief zstd decompression state
+ **/
+struct unzstd_state_s {
+  const uint8_t *cur;             ///< Current position in the compressed stream
+  const uint8_t *end;             ///< End of the compressed stream
+  const uint8_t *block;           ///< Data of the current block
+  const uint8_t *literals;        ///< Literals of the current block
+  uint64_t frame_start;           ///< Output position of the current frame
+  uint64_t dst_pos;               ///< Current output position
+  zstd::frame_header_s frame;     ///< Header of the current frame
+  uint32_t in_frame;              ///< Whether a frame is being decoded
+  uint32_t last_block;            ///< Whether the current block is the last of its frame
+  uint32_t block_type;            ///< Type of the current block
+  uint32_t block_size;            ///< Size of the current block (after decompression for RLE)
+  uint32_t rep[3];                ///< Repeat offsets
+  uint32_t num_sequences;         ///< Number of sequences in the current block
+  int32_t error;                  ///< Error status
+  zstd::literals_s lit;           ///< Literals section of the current block
+  zstd::sequences_s seq;          ///< Sequence decoding state
+  gpu_inflate_input_s in;         ///< Input parameters for current block
+  int32_t batch_len[2];           ///< Number of sequences in each batch
+  unzstd_sequence_s batch[2 * ZSTD_BATCH_SIZE];  ///< Sequence batches
+  zstd::tables_s tables;                         ///< Entropy tables of the current frame
+};
+
+/**
+ * @brief Parses the next block header, starting new frames as needed
+ *
+ * Sets the block type to ZSTD_BLOCK_END once the input is consumed or when an error occurs.
+ *
+ * @param s decompression state
+ **/
+__device__ void unzstd_next_block(unzstd_state_s *s)
+{
+  uint32_t type = ZSTD_BLOCK_END;
+  while (!s->error) {
+    if (s->last_block) {
+      // Frame trailer: optional checksum (not verified), then the content size check
+      s->cur += (s->frame.has_checksum) ? 4 : 0;
+      if (s->cur > s->end || (s->frame.content_size != ~0ull &&
+                              s->dst_pos - s->frame_start != s->frame.content_size)) {
+        s->error = 1;
+        break;
+      }
+      s->in_frame   = 0;
+      s->last_block = 0;
+    }
+    if (!s->in_frame) {
+      if (s->cur >= s->end) { break; }
+      if (!zstd::parse_frame_header(&s->frame, s->cur, s->end - s->cur)) {
+        s->error = 1;
+        break;
+      }
+      s->cur += s->frame.header_size;
+      if (s->frame.is_skippable) { continue; }
+      s->in_frame         = 1;
+      s->frame_start      = s->dst_pos;
+      s->rep[0]           = 1;
+      s->rep[1]           = 4;
+      s->rep[2]           = 8;
+      s->tables.ll_valid  = 0;
+      s->tables.of_valid  = 0;
+      s->tables.ml_valid  = 0;
+      s->tables.huf_valid = 0;
+    }
+    if (s->end - s->cur < 3) {
+      s->error = 1;
+      break;
+    }
+    uint32_t hdr     = s->cur[0] | (s->cur[1] << 8) | (s->cur[2] << 16);
+    uint32_t size    = hdr >> 3;
+    uint32_t in_size = 0;
+    s->cur += 3;
+    s->last_block = hdr & 1;
+    type          = (hdr >> 1) & 3;
+    switch (type) {
+      case zstd::block_raw: in_size = size; break;
+      case zstd::block_rle: in_size = 1; break;
+      case zstd::block_compressed: in_size = (size <= zstd::max_block_size) ? size : ~0u; break;
+      default: in_size = ~0u;
+    }
+    if (in_size > static_cast<size_t>(s->end - s->cur) ||
+        (type != zstd::block_compressed && s->dst_pos + size > s->in.dstSize)) {
+      s->error = 1;
+      type     = ZSTD_BLOCK_END;
+      break;
+    }
+    s->block      = s->cur;
+    s->block_size = size;
+    s->cur += in_size;
+    break;
+  }
+  if (s->error) { type = ZSTD_BLOCK_END; }
+  s->block_type = type;
+}
+
+/**
+ * @brief Copies bytes with one warp, loading each chunk before storing it
+ *
+ * Overlapping copies are correct when the source follows the destination, or when the step
+ * does not exceed the distance between the destination and a preceding source.
+ *
+ * @param dst destination
+ * @param src source
+ * @param len number of bytes to copy
+ * @param step number of bytes copied at once, up to 32
+ * @param t warp lane id
+ **/
+inline __device__ void unzstd_warp_copy(
+  uint8_t *dst, const uint8_t *src, uint32_t len, uint32_t step, uint32_t t)
+{
+  for (uint32_t i = 0; i < len; i += step) {
+    bool active = (t < step && i + t < len);
+    uint8_t b   = (active) ? src[i + t] : 0;
+    __syncwarp();
+    if (active) { dst[i + t] = b; }
+    __syncwarp();
+  }
+}
+
+/**
+ * @brief Decodes one batch of sequences (single thread)
+ *
+ * Checks that the literals and matches of each sequence remain within bounds, and that the
+ * literals still to be copied are not overwritten by the output.
+ *
+ * @param s decompression state
+ * @param seq sequence decoding state
+ * @param rep repeat offsets
+ * @param batch_id batch index
+ * @param lit_pos literals consumed so far
+ * @param out_pos output position
+ *
+ * @return nonzero if error
+ **/
+__device__ int unzstd_decode_sequences(unzstd_state_s *s,
+                                       zstd::sequences_s *seq,
+                                       uint32_t *rep,
+                                       uint32_t batch_id,
+                                       uint32_t &lit_pos,
+                                       uint64_t &out_pos)
+{
+  uint32_t first           = batch_id << LOG2_ZSTD_BATCH_SIZE;
+  uint32_t n               = min(s->num_sequences - first, static_cast<uint32_t>(ZSTD_BATCH_SIZE));
+  uint32_t regen_size      = s->lit.regenerated_size;
+  unzstd_sequence_s *batch = &s->batch[(batch_id & 1) * ZSTD_BATCH_SIZE];
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t ll, ml, offset;
+    zstd::decode_sequence(
+      seq, &s->tables, rep, &ll, &ml, &offset, first + i + 1 == s->num_sequences);
+    if (lit_pos + ll > regen_size || offset > out_pos + ll - s->frame_start ||
+        out_pos + ll + ml + (regen_size - lit_pos - ll) > s->in.dstSize) {
+      return 1;
+    }
+    batch[i].literal_length = ll;
+    batch[i].match_length   = ml;
+    batch[i].offset         = offset;
+    lit_pos += ll;
+    out_pos += ll + ml;
+  }
+  if (first + n == s->num_sequences && seq->bits.bitpos != 0) { return 1; }
+  s->batch_len[batch_id & 1] = n;
+  return 0;
+}
+
+/**
+ * @brief Decompresses one compressed block
+ *
+ * Thread 0 decodes the section headers. Literals that are not stored raw are decoded at the end
+ * of the output buffer, where the output only reaches them after they are copied. WARP1 then
+ * decodes batches of sequences while WARP0 copies the literals and matches of the previous batch.
+ *
+ * @param s decompression state
+ * @param t thread id
+ **/
+__device__ void unzstd_decode_block(unzstd_state_s *s, int t)
+{
+  uint8_t *dst = reinterpret_cast<uint8_t *>(s->in.dstDevice);
+
+  if (!t) {
+    const uint8_t *block = s->block;
+    uint32_t block_size  = s->block_size;
+    uint32_t lit_size    = zstd::decode_literals_header(&s->tables, &s->lit, block, block_size);
+    if (lit_size == 0 || s->dst_pos + s->lit.regenerated_size > s->in.dstSize) {
+      s->error = 1;
+    } else {
+      s->literals = (s->lit.type == zstd::literals_raw)
+                      ? s->lit.data
+                      : dst + s->in.dstSize - s->lit.regenerated_size;
+      int32_t hdr_size = zstd::decode_sequences_header(
+        &s->tables, &s->num_sequences, block + lit_size, block_size - lit_size);
+      if (hdr_size < 0) {
+        s->error = 1;
+      } else if (s->num_sequences > 0) {
+        uint32_t pos = lit_size + hdr_size;
+        if (pos >= block_size ||
+            !zstd::init_sequences(&s->seq, &s->tables, block + pos, block_size - pos)) {
+          s->error = 1;
+        }
+      }
+    }
+  }
+  __syncthreads();
+  if (s->error) { return; }
+  // Decode the literals
+  uint8_t *lit_buf = dst + s->in.dstSize - s->lit.regenerated_size;
+  if (s->lit.type == zstd::literals_rle) {
+    for (uint32_t i = t; i < s->lit.regenerated_size; i += blockDim.x) {
+      lit_buf[i] = s->lit.data[0];
+    }
+  } else if (s->lit.type != zstd::literals_raw && static_cast<uint32_t>(t) < s->lit.num_streams) {
+    // One thread per Huffman stream
+    const uint8_t *src = s->lit.data;
+    for (int i = 0; i < t; i++) { src += s->lit.stream_size[i]; }
+    if (!zstd::decode_huffman_stream(&s->tables,
+                                     src,
+                                     s->lit.stream_size[t],
+                                     lit_buf + t * s->lit.stream_regen_size[0],
+                                     s->lit.stream_regen_size[t])) {
+      s->error = 1;
+    }
+  }
+  __syncthreads();
+  if (s->error) { return; }
+  // Decode and execute the sequences
+  const uint8_t *literals = s->literals;
+  uint32_t num_batches    = (s->num_sequences + ZSTD_BATCH_SIZE - 1) >> LOG2_ZSTD_BATCH_SIZE;
+  uint32_t lit_pos        = 0;
+  uint64_t out_pos        = s->dst_pos;
+  zstd::sequences_s seq;
+  uint32_t rep[3];
+  if (t == 32) {
+    seq    = s->seq;
+    rep[0] = s->rep[0];
+    rep[1] = s->rep[1];
+    rep[2] = s->rep[2];
+  }
+  for (uint32_t b = 0; b <= num_batches; b++) {
+    int error = 0;
+    if (t == 32 && b < num_batches) {
+      // WARP1: decode the next batch
+      error = unzstd_decode_sequences(s, &seq, rep, b, lit_pos, out_pos);
+    } else if (t < 32 && b > 0) {
+      // WARP0: copy the literals and matches of the previous batch
+      const unzstd_sequence_s *batch = &s->batch[((b - 1) & 1) * ZSTD_BATCH_SIZE];
+      int32_t n                      = s->batch_len[(b - 1) & 1];
+      for (int i = 0; i < n; i++) {
+        uint32_t ll     = batch[i].literal_length;
+        uint32_t ml     = batch[i].match_length;
+        uint32_t offset = batch[i].offset;
+        unzstd_warp_copy(dst + out_pos, literals + lit_pos, ll, 32, t);
+        lit_pos += ll;
+        out_pos += ll;
+        unzstd_warp_copy(dst + out_pos, dst + out_pos - offset, ml, min(offset, 32u), t);
+        out_pos += ml;
+      }
+    }
+    if (__syncthreads_or(error)) {
+      if (t == 32) { s->error = 1; }
+      return;
+    }
+  }
+  if (t == 32) {
+    s->rep[0] = rep[0];
+    s->rep[1] = rep[1];
+    s->rep[2] = rep[2];
+  } else if (t < 32) {
+    // Copy the literals following the last sequence
+    uint32_t len = s->lit.regenerated_size - lit_pos;
+    unzstd_warp_copy(dst + out_pos, literals + lit_pos, len, 32, t);
+    if (!t) { s->dst_pos = out_pos + len; }
+  }
+}
+
+/**
+ * @brief zstd decompression kernel
+ * See https://tools.ietf.org/html/rfc8878
+ *
+ * blockDim {64,1,1}
+ *
+ * @param[in] inputs Source & destination information per block
+ * @param[out] outputs Decompression status per block
+ **/
+extern "C" __global__ void __launch_bounds__(64)
+  unzstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs)
+{
+  __shared__ __align__(16) unzstd_state_s state_g;
+
+  int t             = threadIdx.x;
+  unzstd_state_s *s = &state_g;
+  int strm_id       = blockIdx.x;
+
+  if (t < sizeof(gpu_inflate_input_s) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&s->in)[t] =
+      reinterpret_cast<const uint32_t *>(&inputs[strm_id])[t];
+    __threadfence_block();
+  }
+  __syncthreads();
+  if (!t) {
+    s->cur        = reinterpret_cast<const uint8_t *>(s->in.srcDevice);
+    s->end        = s->cur + s->in.srcSize;
+    s->dst_pos    = 0;
+    s->in_frame   = 0;
+    s->last_block = 0;
+    s->error      = (s->in.srcSize == 0);
+  }
+  for (;;) {
+    if (!t) { unzstd_next_block(s); }
+    __syncthreads();
+    uint32_t type = s->block_type;
+    if (type == ZSTD_BLOCK_END) { break; }
+    uint8_t *dst = reinterpret_cast<uint8_t *>(s->in.dstDevice) + s->dst_pos;
+    if (type == zstd::block_raw) {
+      for (uint32_t i = t; i < s->block_size; i += blockDim.x) { dst[i] = s->block[i]; }
+    } else if (type == zstd::block_rle) {
+      for (uint32_t i = t; i < s->block_size; i += blockDim.x) { dst[i] = s->block[0]; }
+    } else {
+      unzstd_decode_block(s, t);
+    }
+    __syncthreads();
+    if (!t && type != zstd::block_compressed) { s->dst_pos += s->block_size; }
+  }
+  if (!t) {
+    outputs[strm_id].bytes_written = s->dst_pos;
+    outputs[strm_id].status        = s->error;
+    outputs[strm_id].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_unzstd(gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                int count,
+                                cudaStream_t stream)
+{
+  uint32_t count32 = (count > 0) ? count : 0;
+  dim3 dim_block(64, 1);      // 2 warps per stream, 1 stream per block
+  dim3 dim_grid(count32, 1);  // TODO: Check max grid dimensions vs max expected count
+
+  unzstd_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs);
+
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,852 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file unzstd.h
+ *
+ * Zstandard decoding functions shared by the host and GPU decompressors
+ *
+ * Zstandard Compression and the application/zstd Media Type
+ * https://tools.ietf.org/html/rfc8878
+ *
+ * The functions below decode the frame, block, literals and sequences headers, and the entropy
+ * coded streams, one symbol at a time. Callers drive the decoding and execute the sequences,
+ * which allows the GPU decompressor to spread the copies across threads.
+ *
+ * Dictionaries are not supported, and content checksums are not verified.
+ **/
+
+#ifndef __IO_UNZSTD_H__
+#define __IO_UNZSTD_H__
+
+#include <cudf/types.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+namespace zstd {
+constexpr uint32_t frame_magic           = 0xFD2FB528u;
+constexpr uint32_t skippable_magic       = 0x184D2A50u;  // Low 4 bits are user-defined
+constexpr uint32_t max_block_size        = 128 * 1024;
+constexpr uint32_t max_huffman_bits      = 11;
+constexpr uint32_t max_literals_log      = 9;
+constexpr uint32_t max_match_log         = 9;
+constexpr uint32_t max_offset_log        = 8;
+constexpr uint32_t max_literals_symbol   = 35;
+constexpr uint32_t max_match_symbol      = 52;
+constexpr uint32_t max_offset_symbol     = 31;
+constexpr uint32_t max_huff_weights_log  = 6;
+constexpr uint32_t max_huff_weight_count = 255;
+
+enum block_type_e { block_raw = 0, block_rle = 1, block_compressed = 2, block_reserved = 3 };
+
+enum literals_type_e {
+  literals_raw      = 0,
+  literals_rle      = 1,
+  literals_huf      = 2,
+  literals_treeless = 3
+};
+
+enum table_mode_e { mode_predefined = 0, mode_rle = 1, mode_fse = 2, mode_repeat = 3 };
+
+/**
+ * @brief FSE decoding table entry
+ **/
+struct fse_entry_s {
+  uint16_t new_state;
+  uint8_t symbol;
+  uint8_t nb_bits;
+};
+
+/**
+ * @brief Huffman decoding table entry
+ **/
+struct huf_entry_s {
+  uint8_t symbol;
+  uint8_t nb_bits;
+};
+
+/**
+ * @brief Entropy tables, kept across the blocks of a frame for the repeat and treeless modes
+ **/
+struct tables_s {
+  fse_entry_s ll[1 << max_literals_log];
+  fse_entry_s of[1 << max_offset_log];
+  fse_entry_s ml[1 << max_match_log];
+  huf_entry_s huf[1 << max_huffman_bits];
+  uint8_t ll_log;
+  uint8_t of_log;
+  uint8_t ml_log;
+  uint8_t huf_log;
+  uint8_t ll_valid;
+  uint8_t of_valid;
+  uint8_t ml_valid;
+  uint8_t huf_valid;
+};
+
+/**
+ * @brief Frame header
+ **/
+struct frame_header_s {
+  uint64_t content_size;  // ~0 if unknown
+  uint32_t header_size;   // Size of the header, or of the whole frame for skippable frames
+  uint8_t is_skippable;
+  uint8_t has_checksum;
+};
+
+/**
+ * @brief Literals section of a compressed block
+ **/
+struct literals_s {
+  uint32_t type;
+  uint32_t regenerated_size;
+  uint32_t num_streams;
+  const uint8_t *data;          // Raw literals, RLE byte, or first Huffman stream
+  uint32_t stream_size[4];      // Huffman stream sizes
+  uint32_t stream_regen_size[4];
+};
+
+/**
+ * @brief Reverse bitstream, read from the last bit towards the first
+ **/
+struct bitstream_s {
+  const uint8_t *base;
+  uint32_t size;
+  int32_t bitpos;  // Number of bits not yet read; negative once the stream is overconsumed
+};
+
+/**
+ * @brief Sequence decoding state
+ **/
+struct sequences_s {
+  bitstream_s bits;
+  uint32_t ll_state;
+  uint32_t of_state;
+  uint32_t ml_state;
+};
+
+/**
+ * @brief Returns the index of the most significant set bit
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t highbit32(uint32_t v)
+{
+  uint32_t n = 0;
+  while (v >>= 1) { n++; }
+  return n;
+}
+
+/**
+ * @brief Loads 8 bytes in little-endian order, with the bytes past the end read as zero
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint64_t load_le64(const uint8_t *base, size_t size, size_t pos)
+{
+  uint64_t v = 0;
+  for (uint32_t i = 0; i < 8 && pos + i < size; i++) {
+    v |= static_cast<uint64_t>(base[pos + i]) << (i * 8);
+  }
+  return v;
+}
+
+/**
+ * @brief Initializes a reverse bitstream; the last byte holds a final 1-bit marker
+ *
+ * @return false if the stream is empty or the marker is missing
+ **/
+CUDA_HOST_DEVICE_CALLABLE bool init_bitstream(bitstream_s *bs, const uint8_t *src, size_t size)
+{
+  if (size == 0 || src[size - 1] == 0) { return false; }
+  bs->base   = src;
+  bs->size   = static_cast<uint32_t>(size);
+  bs->bitpos = static_cast<int32_t>((size - 1) * 8 + highbit32(src[size - 1]));
+  return true;
+}
+
+/**
+ * @brief Returns the next n bits (up to 32) of a reverse bitstream without consuming them
+ *
+ * Bits before the start of the stream are read as zero.
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t peek_bits(const bitstream_s *bs, uint32_t n)
+{
+  int32_t pos = bs->bitpos - static_cast<int32_t>(n);
+  uint64_t v;
+  if (n == 0 || pos <= -static_cast<int32_t>(n)) { return 0; }
+  if (pos >= 0) {
+    v = load_le64(bs->base, bs->size, pos >> 3) >> (pos & 7);
+  } else {
+    v = load_le64(bs->base, bs->size, 0) << (-pos);
+  }
+  return static_cast<uint32_t>(v & ((1ull << n) - 1));
+}
+
+/**
+ * @brief Reads the next n bits (up to 32) of a reverse bitstream
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t read_bits(bitstream_s *bs, uint32_t n)
+{
+  uint32_t v = peek_bits(bs, n);
+  bs->bitpos -= static_cast<int32_t>(n);
+  return v;
+}
+
+/**
+ * @brief Parses a frame header
+ *
+ * @param[out] hdr Frame header
+ * @param[in] src Frame data
+ * @param[in] size Size of the remaining data
+ *
+ * @return false if the header is invalid or uses a dictionary
+ **/
+CUDA_HOST_DEVICE_CALLABLE bool parse_frame_header(frame_header_s *hdr,
+                                                  const uint8_t *src,
+                                                  size_t size)
+{
+  if (size < 8) { return false; }
+  uint32_t magic = static_cast<uint32_t>(load_le64(src, 4, 0));
+  if ((magic & ~0xfu) == skippable_magic) {
+    uint64_t frame_size = 8 + (load_le64(src, 8, 0) >> 32);
+    if (frame_size > size) { return false; }
+    hdr->content_size = 0;
+    hdr->header_size  = static_cast<uint32_t>(frame_size);
+    hdr->is_skippable = 1;
+    hdr->has_checksum = 0;
+    return true;
+  }
+  if (magic != frame_magic) { return false; }
+  uint32_t desc           = src[4];
+  uint32_t fcs_flag       = desc >> 6;
+  uint32_t single_segment = (desc >> 5) & 1;
+  uint32_t did_flag       = desc & 3;
+  uint32_t fcs_size       = (fcs_flag == 0) ? single_segment : 1u << fcs_flag;
+  uint32_t pos            = 5 + (single_segment ? 0 : 1);
+  // Dictionaries are not supported; a zero dictionary id is allowed
+  uint32_t did_size = (did_flag == 3) ? 4 : did_flag;
+  if ((desc & 0x08) != 0 || pos + did_size + fcs_size > size) { return false; }
+  if (load_le64(src + pos, did_size, 0) != 0) { return false; }
+  pos += did_size;
+  if (fcs_size != 0) {
+    uint64_t fcs      = load_le64(src + pos, fcs_size, 0);
+    hdr->content_size = (fcs_size == 2) ? fcs + 256 : fcs;
+  } else {
+    hdr->content_size = ~0ull;
+  }
+  hdr->header_size  = pos + fcs_size;
+  hdr->is_skippable = 0;
+  hdr->has_checksum = (desc >> 2) & 1;
+  return true;
+}
+
+/**
+ * @brief Decodes an FSE table description into normalized probabilities
+ *
+ * @param[out] norm Normalized probabilities, -1 for "less than 1"
+ * @param[in,out] max_symbol Maximum allowed symbol on input, last symbol on output
+ * @param[out] log Accuracy log of the table
+ * @param[in] max_log Maximum allowed accuracy log
+ * @param[in] src Table description
+ * @param[in] size Size of the remaining data
+ *
+ * @return Number of bytes consumed, 0 if error
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t read_fse_probabilities(int16_t *norm,
+                                                          uint32_t *max_symbol,
+                                                          uint32_t *log,
+                                                          uint32_t max_log,
+                                                          const uint8_t *src,
+                                                          size_t size)
+{
+  size_t pos = 0;  // Bit position
+  auto peek  = [&](uint32_t n) {
+    return static_cast<uint32_t>(load_le64(src, size, pos >> 3) >> (pos & 7)) & ((1u << n) - 1);
+  };
+  if (size == 0) { return 0; }
+  *log = peek(4) + 5;
+  pos += 4;
+  if (*log > max_log) { return 0; }
+  int32_t remaining = (1 << *log) + 1;
+  int32_t threshold = 1 << *log;
+  uint32_t nb_bits  = *log + 1;
+  uint32_t symbol   = 0;
+  bool prev_zero    = false;
+  while (remaining > 1 && symbol <= *max_symbol) {
+    if (prev_zero) {
+      // Repeat flags for runs of zero probabilities
+      uint32_t n0 = symbol;
+      for (;;) {
+        uint32_t repeat = peek(2);
+        pos += 2;
+        n0 += repeat;
+        if (repeat != 3) { break; }
+      }
+      if (n0 > *max_symbol) { return 0; }
+      while (symbol < n0) { norm[symbol++] = 0; }
+    }
+    int32_t max_value = (2 * threshold - 1) - remaining;
+    int32_t count;
+    uint32_t v = peek(nb_bits);
+    if (static_cast<int32_t>(v & (threshold - 1)) < max_value) {
+      count = v & (threshold - 1);
+      pos += nb_bits - 1;
+    } else {
+      count = v & (2 * threshold - 1);
+      if (count >= threshold) { count -= max_value; }
+      pos += nb_bits;
+    }
+    count--;
+    remaining -= (count < 0) ? -count : count;
+    norm[symbol++] = static_cast<int16_t>(count);
+    prev_zero      = (count == 0);
+    while (remaining < threshold) {
+      nb_bits--;
+      threshold >>= 1;
+    }
+  }
+  if (remaining != 1 || pos > size * 8) { return 0; }
+  *max_symbol = symbol - 1;
+  return static_cast<uint32_t>((pos + 7) >> 3);
+}
+
+/**
+ * @brief Builds an FSE decoding table from normalized probabilities
+ *
+ * @return false if the probabilities are invalid
+ **/
+CUDA_HOST_DEVICE_CALLABLE bool build_fse_table(fse_entry_s *table,
+                                               const int16_t *norm,
+                                               uint32_t max_symbol,
+                                               uint32_t log)
+{
+  uint16_t next_state[max_match_symbol + 1];
+  uint32_t table_size = 1 << log;
+  uint32_t high       = table_size - 1;
+  if (max_symbol > max_match_symbol) { return false; }
+  // Symbols with "less than 1" probability go at the end of the table
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    if (norm[s] == -1) {
+      if (high == 0) { return false; }
+      table[high--].symbol = static_cast<uint8_t>(s);
+      next_state[s]        = 1;
+    } else if (norm[s] < 0) {
+      return false;
+    } else {
+      next_state[s] = norm[s];
+    }
+  }
+  // Spread the other symbols
+  uint32_t step = (table_size >> 1) + (table_size >> 3) + 3;
+  uint32_t mask = table_size - 1;
+  uint32_t pos  = 0;
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    for (int32_t i = 0; i < norm[s]; i++) {
+      table[pos].symbol = static_cast<uint8_t>(s);
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high);
+    }
+  }
+  if (pos != 0) { return false; }
+  for (uint32_t u = 0; u < table_size; u++) {
+    uint32_t x         = next_state[table[u].symbol]++;
+    uint32_t nb_bits   = log - highbit32(x);
+    table[u].nb_bits   = static_cast<uint8_t>(nb_bits);
+    table[u].new_state = static_cast<uint16_t>((x << nb_bits) - table_size);
+  }
+  return true;
+}
+
+/**
+ * @brief Builds a single-symbol FSE table, for the RLE mode
+ **/
+CUDA_HOST_DEVICE_CALLABLE void build_rle_table(fse_entry_s *table, uint8_t symbol)
+{
+  table[0].symbol    = symbol;
+  table[0].nb_bits   = 0;
+  table[0].new_state = 0;
+}
+
+/**
+ * @brief Returns the normalized probabilities of one of the predefined FSE tables
+ *
+ * @param[out] norm Normalized probabilities, with room for max_match_symbol + 1 entries
+ * @param[in] kind 0 for literals lengths, 1 for offsets, 2 for match lengths
+ * @param[out] max_symbol Last symbol of the table
+ *
+ * @return Accuracy log of the table
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t get_predefined_norm(int16_t *norm,
+                                                       uint32_t kind,
+                                                       uint32_t *max_symbol)
+{
+  const int16_t ll_norm[max_literals_symbol + 1] = {4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                                                    2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+                                                    2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1};
+  const int16_t of_norm[29] = {1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+                               1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+  const int16_t ml_norm[max_match_symbol + 1] = {
+    1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+  const int16_t *src;
+  uint32_t log;
+  switch (kind) {
+    case 0:
+      src         = ll_norm;
+      *max_symbol = max_literals_symbol;
+      log         = 6;
+      break;
+    case 1:
+      src         = of_norm;
+      *max_symbol = 28;
+      log         = 5;
+      break;
+    default:
+      src         = ml_norm;
+      *max_symbol = max_match_symbol;
+      log         = 6;
+  }
+  for (uint32_t i = 0; i <= *max_symbol; i++) { norm[i] = src[i]; }
+  return log;
+}
+
+/**
+ * @brief Builds one of the predefined FSE tables
+ *
+ * @param[out] table FSE table
+ * @param[in] kind 0 for literals lengths, 1 for offsets, 2 for match lengths
+ *
+ * @return Accuracy log of the table
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t build_predefined_table(fse_entry_s *table, uint32_t kind)
+{
+  int16_t norm[max_match_symbol + 1];
+  uint32_t max_symbol;
+  uint32_t log = get_predefined_norm(norm, kind, &max_symbol);
+  build_fse_table(table, norm, max_symbol, log);
+  return log;
+}
+
+/**
+ * @brief Decodes a Huffman tree description into the Huffman decoding table
+ *
+ * @param[in,out] t Entropy tables
+ * @param[in] src Tree description
+ * @param[in] size Size of the remaining data
+ *
+ * @return Number of bytes consumed, 0 if error
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t read_huffman_table(tables_s *t, const uint8_t *src, size_t size)
+{
+  uint8_t weights[max_huff_weight_count + 1];
+  uint32_t num_weights = 0;
+  uint32_t consumed;
+  if (size == 0) { return 0; }
+  uint32_t hdr = src[0];
+  if (hdr >= 128) {
+    // Weights stored directly, 4 bits each
+    num_weights = hdr - 127;
+    consumed    = 1 + (num_weights + 1) / 2;
+    if (consumed > size) { return 0; }
+    for (uint32_t i = 0; i < num_weights; i++) {
+      uint32_t b = src[1 + i / 2];
+      weights[i] = static_cast<uint8_t>((i & 1) ? b & 0xf : b >> 4);
+    }
+  } else {
+    // FSE-compressed weights, decoded with two interleaved states
+    int16_t norm[16];
+    fse_entry_s wt[1 << max_huff_weights_log];
+    bitstream_s bs;
+    uint32_t max_symbol = 15, log;
+    consumed            = 1 + hdr;
+    if (hdr == 0 || consumed > size) { return 0; }
+    uint32_t n =
+      read_fse_probabilities(norm, &max_symbol, &log, max_huff_weights_log, src + 1, hdr);
+    if (n == 0 || n >= hdr || !build_fse_table(wt, norm, max_symbol, log) ||
+        !init_bitstream(&bs, src + 1 + n, hdr - n)) {
+      return 0;
+    }
+    uint32_t state1 = read_bits(&bs, log);
+    uint32_t state2 = read_bits(&bs, log);
+    for (;;) {
+      if (num_weights + 2 > max_huff_weight_count) { return 0; }
+      weights[num_weights++] = wt[state1].symbol;
+      state1                 = wt[state1].new_state + read_bits(&bs, wt[state1].nb_bits);
+      if (bs.bitpos < 0) {
+        weights[num_weights++] = wt[state2].symbol;
+        break;
+      }
+      weights[num_weights++] = wt[state2].symbol;
+      state2                 = wt[state2].new_state + read_bits(&bs, wt[state2].nb_bits);
+      if (bs.bitpos < 0) {
+        weights[num_weights++] = wt[state1].symbol;
+        break;
+      }
+    }
+  }
+  // The weight of the last symbol is implied by the sum of the others being a power of 2
+  uint32_t rank_count[max_huffman_bits + 1] = {0};
+  uint32_t total                              = 0;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (weights[i] > max_huffman_bits) { return 0; }
+    rank_count[weights[i]]++;
+    total += (1u << weights[i]) >> 1;
+  }
+  if (total == 0) { return 0; }
+  uint32_t log = highbit32(total) + 1;
+  if (log > max_huffman_bits) { return 0; }
+  uint32_t rest        = (1u << log) - total;
+  uint32_t last_weight = highbit32(rest) + 1;
+  if ((1u << (last_weight - 1)) != rest) { return 0; }
+  weights[num_weights++] = static_cast<uint8_t>(last_weight);
+  rank_count[last_weight]++;
+  if (rank_count[1] < 2 || (rank_count[1] & 1)) { return 0; }
+  // Codes are assigned by increasing weight, then by increasing symbol value
+  uint32_t rank_start[max_huffman_bits + 1];
+  for (uint32_t w = 1, pos = 0; w <= log; w++) {
+    rank_start[w] = pos;
+    pos += rank_count[w] << (w - 1);
+  }
+  for (uint32_t n = 0; n < num_weights; n++) {
+    uint32_t w = weights[n];
+    if (w == 0) { continue; }
+    uint32_t len   = (1u << w) >> 1;
+    uint32_t start = rank_start[w];
+    for (uint32_t i = 0; i < len; i++) {
+      t->huf[start + i].symbol  = static_cast<uint8_t>(n);
+      t->huf[start + i].nb_bits = static_cast<uint8_t>(log + 1 - w);
+    }
+    rank_start[w] += len;
+  }
+  t->huf_log   = static_cast<uint8_t>(log);
+  t->huf_valid = 1;
+  return consumed;
+}
+
+/**
+ * @brief Decodes the header of the literals section, and the Huffman table if present
+ *
+ * @param[in,out] t Entropy tables
+ * @param[out] lit Literals section description
+ * @param[in] src Literals section
+ * @param[in] size Size of the block
+ *
+ * @return Size of the literals section, 0 if error
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t decode_literals_header(tables_s *t,
+                                                          literals_s *lit,
+                                                          const uint8_t *src,
+                                                          size_t size)
+{
+  if (size == 0) { return 0; }
+  uint32_t b0          = src[0];
+  uint32_t size_format = (b0 >> 2) & 3;
+  lit->type            = b0 & 3;
+  if (lit->type == literals_raw || lit->type == literals_rle) {
+    uint32_t hdr_size;
+    switch (size_format) {
+      case 1:
+        hdr_size              = 2;
+        lit->regenerated_size = static_cast<uint32_t>(load_le64(src, 2, 0) >> 4);
+        break;
+      case 3:
+        hdr_size              = 3;
+        lit->regenerated_size = static_cast<uint32_t>(load_le64(src, 3, 0) >> 4);
+        break;
+      default: hdr_size = 1; lit->regenerated_size = b0 >> 3;
+    }
+    uint32_t data_size = (lit->type == literals_raw) ? lit->regenerated_size : 1;
+    if (hdr_size + data_size > size) { return 0; }
+    lit->num_streams = 0;
+    lit->data        = src + hdr_size;
+    return hdr_size + data_size;
+  }
+  // Huffman-compressed literals
+  uint32_t hdr_size, comp_size;
+  uint64_t h = load_le64(src, (size < 5) ? size : 5, 0);
+  switch (size_format) {
+    case 2:
+      hdr_size              = 4;
+      lit->regenerated_size = static_cast<uint32_t>(h >> 4) & 0x3fff;
+      comp_size             = static_cast<uint32_t>(h >> 18) & 0x3fff;
+      break;
+    case 3:
+      hdr_size              = 5;
+      lit->regenerated_size = static_cast<uint32_t>(h >> 4) & 0x3ffff;
+      comp_size             = static_cast<uint32_t>(h >> 22) & 0x3ffff;
+      break;
+    default:
+      hdr_size              = 3;
+      lit->regenerated_size = static_cast<uint32_t>(h >> 4) & 0x3ff;
+      comp_size             = static_cast<uint32_t>(h >> 14) & 0x3ff;
+  }
+  lit->num_streams = (size_format == 0) ? 1 : 4;
+  if (hdr_size + comp_size > size || lit->regenerated_size > max_block_size) { return 0; }
+  const uint8_t *cur = src + hdr_size;
+  uint32_t remaining = comp_size;
+  if (lit->type == literals_huf) {
+    uint32_t tree_size = read_huffman_table(t, cur, remaining);
+    if (tree_size == 0) { return 0; }
+    cur += tree_size;
+    remaining -= tree_size;
+  } else if (!t->huf_valid) {
+    return 0;
+  }
+  if (lit->num_streams == 1) {
+    lit->stream_size[0]       = remaining;
+    lit->stream_regen_size[0] = lit->regenerated_size;
+  } else {
+    // Jump table with the sizes of the first 3 streams
+    if (remaining < 6) { return 0; }
+    uint32_t total         = 6;
+    uint32_t segment_size  = (lit->regenerated_size + 3) / 4;
+    for (uint32_t i = 0; i < 3; i++) {
+      lit->stream_size[i]       = cur[i * 2] | (cur[i * 2 + 1] << 8);
+      lit->stream_regen_size[i] = segment_size;
+      total += lit->stream_size[i];
+    }
+    if (total > remaining || segment_size * 3 > lit->regenerated_size) { return 0; }
+    lit->stream_size[3]       = remaining - total;
+    lit->stream_regen_size[3] = lit->regenerated_size - segment_size * 3;
+    cur += 6;
+  }
+  lit->data = cur;
+  return hdr_size + comp_size;
+}
+
+/**
+ * @brief Decodes one Huffman-coded literals stream
+ *
+ * @return false if the stream is invalid
+ **/
+CUDA_HOST_DEVICE_CALLABLE bool decode_huffman_stream(
+  const tables_s *t, const uint8_t *src, size_t size, uint8_t *dst, size_t count)
+{
+  bitstream_s bs;
+  if (!init_bitstream(&bs, src, size)) { return false; }
+  for (size_t i = 0; i < count; i++) {
+    const huf_entry_s e = t->huf[peek_bits(&bs, t->huf_log)];
+    dst[i]              = e.symbol;
+    bs.bitpos -= e.nb_bits;
+  }
+  return bs.bitpos == 0;
+}
+
+/**
+ * @brief Decodes or selects one of the FSE tables of the sequences section
+ *
+ * @return Number of bytes consumed, or -1 if error
+ **/
+CUDA_HOST_DEVICE_CALLABLE int32_t decode_sequence_table(fse_entry_s *table,
+                                                        uint8_t *log,
+                                                        uint8_t *valid,
+                                                        uint32_t mode,
+                                                        uint32_t kind,
+                                                        uint32_t max_symbol,
+                                                        uint32_t max_log,
+                                                        const uint8_t *src,
+                                                        size_t size)
+{
+  switch (mode) {
+    case mode_predefined:
+      *log   = static_cast<uint8_t>(build_predefined_table(table, kind));
+      *valid = 1;
+      return 0;
+    case mode_rle:
+      if (size < 1 || src[0] > max_symbol) { return -1; }
+      build_rle_table(table, src[0]);
+      *log   = 0;
+      *valid = 1;
+      return 1;
+    case mode_fse: {
+      int16_t norm[max_match_symbol + 1];
+      uint32_t table_log;
+      uint32_t n = read_fse_probabilities(norm, &max_symbol, &table_log, max_log, src, size);
+      if (n == 0 || !build_fse_table(table, norm, max_symbol, table_log)) { return -1; }
+      *log   = static_cast<uint8_t>(table_log);
+      *valid = 1;
+      return static_cast<int32_t>(n);
+    }
+    default: return (*valid) ? 0 : -1;
+  }
+}
+
+/**
+ * @brief Decodes the header of the sequences section and its FSE tables
+ *
+ * @param[in,out] t Entropy tables
+ * @param[out] num_sequences Number of sequences
+ * @param[in] src Sequences section
+ * @param[in] size Size of the sequences section
+ *
+ * @return Size of the header, or -1 if error
+ **/
+CUDA_HOST_DEVICE_CALLABLE int32_t decode_sequences_header(tables_s *t,
+                                                          uint32_t *num_sequences,
+                                                          const uint8_t *src,
+                                                          size_t size)
+{
+  uint32_t pos;
+  if (size == 0) { return -1; }
+  uint32_t b0 = src[0];
+  if (b0 < 128) {
+    *num_sequences = b0;
+    pos            = 1;
+  } else if (b0 < 255) {
+    if (size < 2) { return -1; }
+    *num_sequences = ((b0 - 128) << 8) + src[1];
+    pos            = 2;
+  } else {
+    if (size < 3) { return -1; }
+    *num_sequences = src[1] + (src[2] << 8) + 0x7f00;
+    pos            = 3;
+  }
+  if (*num_sequences == 0) { return static_cast<int32_t>(pos); }
+  if (pos >= size) { return -1; }
+  uint32_t modes = src[pos++];
+  if (modes & 3) { return -1; }
+  int32_t n = decode_sequence_table(
+    t->ll, &t->ll_log, &t->ll_valid, modes >> 6, 0, max_literals_symbol, max_literals_log,
+    src + pos, size - pos);
+  if (n < 0) { return -1; }
+  pos += n;
+  n = decode_sequence_table(t->of, &t->of_log, &t->of_valid, (modes >> 4) & 3, 1,
+                            max_offset_symbol, max_offset_log, src + pos, size - pos);
+  if (n < 0) { return -1; }
+  pos += n;
+  n = decode_sequence_table(t->ml, &t->ml_log, &t->ml_valid, (modes >> 2) & 3, 2,
+                            max_match_symbol, max_match_log, src + pos, size - pos);
+  if (n < 0) { return -1; }
+  pos += n;
+  return static_cast<int32_t>(pos);
+}
+
+/**
+ * @brief Initializes the sequence decoding state from the sequences bitstream
+ *
+ * @return false if the bitstream is invalid
+ **/
+CUDA_HOST_DEVICE_CALLABLE bool init_sequences(sequences_s *seq,
+                                              const tables_s *t,
+                                              const uint8_t *src,
+                                              size_t size)
+{
+  if (!init_bitstream(&seq->bits, src, size)) { return false; }
+  seq->ll_state = read_bits(&seq->bits, t->ll_log);
+  seq->of_state = read_bits(&seq->bits, t->of_log);
+  seq->ml_state = read_bits(&seq->bits, t->ml_log);
+  return true;
+}
+
+/**
+ * @brief Updates the repeat offsets with the offset value of a sequence
+ *
+ * @param[in,out] rep Repeat offsets
+ * @param[in] offset_value Offset value, 1 to 3 for repeat offsets, or offset + 3
+ * @param[in] literal_length Literals length of the sequence
+ *
+ * @return Distance of the match
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t resolve_offset(uint32_t *rep,
+                                                  uint32_t offset_value,
+                                                  uint32_t literal_length)
+{
+  if (offset_value > 3) {
+    rep[2] = rep[1];
+    rep[1] = rep[0];
+    rep[0] = offset_value - 3;
+  } else {
+    // Repeat offsets, shifted by one when there are no literals
+    uint32_t idx = offset_value - 1 + (literal_length == 0 ? 1 : 0);
+    if (idx == 3) {
+      uint32_t o = rep[0] - 1;
+      rep[2]     = rep[1];
+      rep[1]     = rep[0];
+      rep[0]     = (o != 0) ? o : 1;
+    } else if (idx != 0) {
+      uint32_t o = rep[idx];
+      if (idx == 2) { rep[2] = rep[1]; }
+      rep[1] = rep[0];
+      rep[0] = o;
+    }
+  }
+  return rep[0];
+}
+
+/**
+ * @brief Decodes the next sequence, resolving repeat offsets
+ *
+ * @param[in,out] seq Sequence decoding state
+ * @param[in] t Entropy tables
+ * @param[in,out] rep Repeat offsets
+ * @param[out] literal_length Number of literals to copy
+ * @param[out] match_length Number of bytes to copy from the window
+ * @param[out] offset Distance of the match
+ * @param[in] is_last Whether this is the last sequence of the block
+ **/
+CUDA_HOST_DEVICE_CALLABLE void decode_sequence(sequences_s *seq,
+                                               const tables_s *t,
+                                               uint32_t *rep,
+                                               uint32_t *literal_length,
+                                               uint32_t *match_length,
+                                               uint32_t *offset,
+                                               bool is_last)
+{
+  const uint8_t ll_bits[9]   = {1, 1, 1, 1, 2, 2, 3, 3, 4};
+  const uint16_t ll_base[9]  = {16, 18, 20, 22, 24, 28, 32, 40, 48};
+  const uint8_t ml_bits[11]  = {1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5};
+  const uint16_t ml_base[11] = {35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99};
+  uint32_t ll_code           = t->ll[seq->ll_state].symbol;
+  uint32_t of_code           = t->of[seq->of_state].symbol;
+  uint32_t ml_code           = t->ml[seq->ml_state].symbol;
+  uint32_t ll, ml;
+
+  // Extra bits are read in the order offset, match length, literals length
+  uint32_t offset_value = (1u << of_code) + read_bits(&seq->bits, of_code);
+  if (ml_code < 32) {
+    ml = ml_code + 3;
+  } else if (ml_code < 43) {
+    ml = ml_base[ml_code - 32] + read_bits(&seq->bits, ml_bits[ml_code - 32]);
+  } else {
+    ml = (1u << (ml_code - 36)) + 3 + read_bits(&seq->bits, ml_code - 36);
+  }
+  if (ll_code < 16) {
+    ll = ll_code;
+  } else if (ll_code < 25) {
+    ll = ll_base[ll_code - 16] + read_bits(&seq->bits, ll_bits[ll_code - 16]);
+  } else {
+    ll = (1u << (ll_code - 19)) + read_bits(&seq->bits, ll_code - 19);
+  }
+
+  *literal_length = ll;
+  *match_length   = ml;
+  *offset         = resolve_offset(rep, offset_value, ll);
+
+  if (!is_last) {
+    // States are updated in the order literals length, match length, offset
+    const fse_entry_s lle = t->ll[seq->ll_state];
+    const fse_entry_s mle = t->ml[seq->ml_state];
+    const fse_entry_s ofe = t->of[seq->of_state];
+    seq->ll_state         = lle.new_state + read_bits(&seq->bits, lle.nb_bits);
+    seq->ml_state         = mle.new_state + read_bits(&seq->bits, mle.nb_bits);
+    seq->of_state         = ofe.new_state + read_bits(&seq->bits, ofe.nb_bits);
+  }
+}
+
+}  // namespace zstd
+}  // namespace io
+}  // namespace cudf
+
+#endif  // __IO_UNZSTD_H__
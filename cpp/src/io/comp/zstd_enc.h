@@ -0,0 +1,629 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file zstd_enc.h
+ *
+ * Zstandard encoding functions shared by the host and GPU compressors
+ *
+ * Each chunk is compressed into a single-segment frame with the content size and no checksum.
+ * Blocks are Huffman-coded literals with FSE-coded sequences, or raw blocks when that is not
+ * smaller. Repeat offsets are used when a match happens to reuse one, but not searched for.
+ **/
+
+#ifndef __IO_ZSTD_ENC_H__
+#define __IO_ZSTD_ENC_H__
+
+#include "entropy_enc.h"
+#include "lz77.h"
+#include "unzstd.h"
+
+namespace cudf {
+namespace io {
+namespace zstd {
+constexpr int32_t default_level        = 3;
+constexpr uint32_t max_block_sequences = 1024;
+
+/**
+ * @brief Huffman encoding table of the literals
+ **/
+struct huf_ctable_s {
+  uint16_t code[256];
+  uint8_t length[256];
+};
+
+/**
+ * @brief Encoder tables and scratch memory
+ **/
+struct encoder_workspace_s {
+  uint32_t lit_freq[256];
+  uint32_t ll_freq[max_literals_symbol + 1];
+  uint32_t of_freq[max_offset_symbol + 1];
+  uint32_t ml_freq[max_match_symbol + 1];
+  huf_ctable_s huf;
+  entropy::fse_ctable_s ll;
+  entropy::fse_ctable_s of;
+  entropy::fse_ctable_s ml;
+  entropy::huffman_scratch_s scratch;
+};
+
+/**
+ * @brief Returns the match finder parameters for a compression level, 0 for the default
+ **/
+CUDA_HOST_DEVICE_CALLABLE lz77::params_s get_params(int32_t level)
+{
+  lz77::params_s p;
+  if (level <= 0) { level = default_level; }
+  p.max_offset = 1u << 24;
+  p.max_match  = max_block_size;
+  p.ways       = (level >= 7) ? 4 : (level >= 3) ? 2 : 1;
+  p.lazy       = (level >= 5);
+  p.skip_log   = (level <= 1) ? 4 : (level <= 3) ? 6 : 0;
+  return p;
+}
+
+/**
+ * @brief Writes the n lower bytes of a value in little-endian order, if they fit
+ **/
+CUDA_HOST_DEVICE_CALLABLE void put_le(uint8_t *dst, const uint8_t *end, uint64_t v, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++, v >>= 8) {
+    if (dst + i < end) { dst[i] = static_cast<uint8_t>(v); }
+  }
+}
+
+/**
+ * @brief Returns the literals length code of a sequence, with its extra bits
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t literals_length_code(uint32_t ll,
+                                                        uint32_t *nb_bits,
+                                                        uint32_t *extra)
+{
+  const uint8_t ll_bits[9]  = {1, 1, 1, 1, 2, 2, 3, 3, 4};
+  const uint16_t ll_base[9] = {16, 18, 20, 22, 24, 28, 32, 40, 48};
+  if (ll < 16) {
+    *nb_bits = 0;
+    *extra   = 0;
+    return ll;
+  } else if (ll < 64) {
+    uint32_t i = 8;
+    while (ll_base[i] > ll) { i--; }
+    *nb_bits = ll_bits[i];
+    *extra   = ll - ll_base[i];
+    return 16 + i;
+  }
+  uint32_t code = highbit32(ll) + 19;
+  *nb_bits      = code - 19;
+  *extra        = ll - (1u << *nb_bits);
+  return code;
+}
+
+/**
+ * @brief Returns the match length code of a sequence, with its extra bits
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t match_length_code(uint32_t ml,
+                                                     uint32_t *nb_bits,
+                                                     uint32_t *extra)
+{
+  const uint8_t ml_bits[11]  = {1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5};
+  const uint16_t ml_base[11] = {35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99};
+  if (ml < 35) {
+    *nb_bits = 0;
+    *extra   = 0;
+    return ml - 3;
+  } else if (ml < 131) {
+    uint32_t i = 10;
+    while (ml_base[i] > ml) { i--; }
+    *nb_bits = ml_bits[i];
+    *extra   = ml - ml_base[i];
+    return 32 + i;
+  }
+  uint32_t code = highbit32(ml - 3) + 36;
+  *nb_bits      = code - 36;
+  *extra        = ml - 3 - (1u << *nb_bits);
+  return code;
+}
+
+/**
+ * @brief Returns the offset value of a match, using the repeat offsets when possible
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t offset_value(const uint32_t *rep,
+                                                uint32_t offset,
+                                                uint32_t literal_length)
+{
+  if (literal_length != 0) {
+    if (offset == rep[0]) { return 1; }
+    if (offset == rep[1]) { return 2; }
+    if (offset == rep[2]) { return 3; }
+  } else {
+    if (offset == rep[1]) { return 1; }
+    if (offset == rep[2]) { return 2; }
+    if (offset == rep[0] - 1) { return 3; }
+  }
+  return offset + 3;
+}
+
+/**
+ * @brief Writes the header of a raw or RLE literals section
+ *
+ * @return Size of the header
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t write_literals_header(uint8_t *dst,
+                                                         const uint8_t *end,
+                                                         uint32_t type,
+                                                         uint32_t regen_size)
+{
+  if (regen_size < 32) {
+    put_le(dst, end, type | (regen_size << 3), 1);
+    return 1;
+  } else if (regen_size < 4096) {
+    put_le(dst, end, type | (1 << 2) | (regen_size << 4), 2);
+    return 2;
+  }
+  put_le(dst, end, type | (3 << 2) | (regen_size << 4), 3);
+  return 3;
+}
+
+/**
+ * @brief Writes the Huffman codes of the literals [begin, end) of a block, in reverse order
+ *
+ * The literals of a block are the runs of its sequences, followed by the last run up to the
+ * end of the block.
+ **/
+CUDA_HOST_DEVICE_CALLABLE void encode_literals_range(entropy::bit_writer_s *bw,
+                                                     const huf_ctable_s *huf,
+                                                     const lz77::sequence_s *seqs,
+                                                     uint32_t num_sequences,
+                                                     const uint8_t *src,
+                                                     uint32_t size,
+                                                     uint32_t num_literals,
+                                                     uint32_t begin,
+                                                     uint32_t end)
+{
+  uint32_t lit_end = num_literals;
+  uint32_t src_end = size;
+  uint32_t tail    = num_literals;
+  for (uint32_t k = 0; k < num_sequences; k++) { tail -= seqs[k].literal_length; }
+  for (int32_t k = num_sequences; k >= 0; k--) {
+    uint32_t len       = (k == static_cast<int32_t>(num_sequences)) ? tail : seqs[k].literal_length;
+    uint32_t lit_start = lit_end - len;
+    uint32_t src_start = src_end - len;
+    uint32_t lo        = (lit_start > begin) ? lit_start : begin;
+    uint32_t hi        = (lit_end < end) ? lit_end : end;
+    for (uint32_t i = hi; i > lo; i--) {
+      uint32_t sym = src[src_start + i - 1 - lit_start];
+      entropy::put_bits(bw, huf->code[sym], huf->length[sym]);
+    }
+    if (lit_start <= begin || k == 0) { break; }
+    lit_end = lit_start;
+    src_end = src_start - seqs[k - 1].match_length;
+  }
+}
+
+/**
+ * @brief Returns the Huffman weight of a symbol from its code length
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t huffman_weight(uint32_t length, uint32_t max_bits)
+{
+  return (length != 0) ? max_bits + 1 - length : 0;
+}
+
+/**
+ * @brief Writes the description of the Huffman tree, FSE-compressed or direct if smaller
+ *
+ * @param[in] ws Encoder workspace, with the code lengths in huf
+ * @param[in] max_symbol Last used symbol, whose weight is implied
+ * @param[in] max_bits Length of the longest code
+ * @param[out] dst Output buffer
+ * @param[in] end End of the output buffer
+ *
+ * @return Size of the description, 0 if the weights cannot be described
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t write_huffman_tree(encoder_workspace_s *ws,
+                                                      uint32_t max_symbol,
+                                                      uint32_t max_bits,
+                                                      uint8_t *dst,
+                                                      uint8_t *end)
+{
+  const uint8_t *len                          = ws->huf.length;
+  uint32_t weight_count[max_huffman_bits + 1] = {0};
+  uint32_t num_weights                        = max_symbol;
+  uint32_t direct_size = (num_weights <= 128) ? 1 + (num_weights + 1) / 2 : 0;
+  uint32_t max_weight  = 0;
+  uint32_t num_used    = 0;
+  for (uint32_t s = 0; s < num_weights; s++) {
+    uint32_t w = huffman_weight(len[s], max_bits);
+    if (weight_count[w]++ == 0) { num_used++; }
+    if (w > max_weight) { max_weight = w; }
+  }
+  // The decoder detects the end of the weights when the stream is overconsumed, which needs two
+  // distinct weights (see init_fse_state)
+  if (num_weights >= 2 && num_used >= 2) {
+    int16_t norm[max_huffman_bits + 1];
+    entropy::fse_ctable_s *ct = &ws->of;
+    entropy::bit_writer_s bw;
+    uint32_t log = entropy::fse_table_log(num_weights, num_used, max_huff_weights_log);
+    entropy::normalize_counts(norm, weight_count, max_weight, num_weights, log);
+    entropy::build_fse_ctable(ct, norm, max_weight, log);
+    entropy::init_bit_writer(&bw, dst + 1, end);
+    entropy::write_fse_probabilities(&bw, norm, max_weight, log);
+    entropy::align_bits(&bw);
+    // Two interleaved states, the second one holding the last weight
+    entropy::fse_state_s st1, st2;
+    uint32_t i = num_weights;
+    if (num_weights & 1) {
+      entropy::init_fse_state(&st1, ct, huffman_weight(len[--i], max_bits));
+      entropy::init_fse_state(&st2, ct, huffman_weight(len[--i], max_bits));
+      entropy::encode_fse_symbol(&bw, &st1, ct, huffman_weight(len[--i], max_bits));
+    } else {
+      entropy::init_fse_state(&st2, ct, huffman_weight(len[--i], max_bits));
+      entropy::init_fse_state(&st1, ct, huffman_weight(len[--i], max_bits));
+    }
+    while (i > 0) {
+      entropy::encode_fse_symbol(&bw, &st2, ct, huffman_weight(len[--i], max_bits));
+      entropy::encode_fse_symbol(&bw, &st1, ct, huffman_weight(len[--i], max_bits));
+    }
+    entropy::flush_fse_state(&bw, &st2, ct);
+    entropy::flush_fse_state(&bw, &st1, ct);
+    entropy::put_bits(&bw, 1, 1);
+    entropy::align_bits(&bw);
+    uint32_t size = static_cast<uint32_t>(bw.cur - (dst + 1));
+    if (size < 128 && (direct_size == 0 || size + 1 < direct_size)) {
+      put_le(dst, end, size, 1);
+      return size + 1;
+    }
+  }
+  if (direct_size == 0) { return 0; }
+  put_le(dst, end, 127 + num_weights, 1);
+  for (uint32_t s = 0; s < num_weights; s += 2) {
+    uint32_t w2 = (s + 1 < num_weights) ? huffman_weight(len[s + 1], max_bits) : 0;
+    put_le(dst + 1 + s / 2, end, (huffman_weight(len[s], max_bits) << 4) | w2, 1);
+  }
+  return direct_size;
+}
+
+/**
+ * @brief Writes the Huffman-coded literals section of a block
+ *
+ * @return Size of the section, 0 if the literals cannot be Huffman-coded
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t encode_huffman_literals(encoder_workspace_s *ws,
+                                                           const lz77::sequence_s *seqs,
+                                                           uint32_t num_sequences,
+                                                           const uint8_t *src,
+                                                           uint32_t size,
+                                                           uint32_t num_literals,
+                                                           uint32_t max_symbol,
+                                                           uint8_t *dst,
+                                                           uint8_t *end)
+{
+  huf_ctable_s *huf = &ws->huf;
+  uint32_t max_bits = entropy::build_huffman_lengths(
+    ws->lit_freq, max_symbol + 1, max_huffman_bits, huf->length, &ws->scratch);
+  // Codes are assigned by increasing weight, then by increasing symbol value
+  uint32_t rank_start[max_huffman_bits + 2] = {0};
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    uint32_t len = huf->length[s];
+    if (len != 0) { rank_start[max_bits + 1 - len] += 1u << (max_bits - len); }
+  }
+  for (uint32_t w = 1, pos = 0; w <= max_bits; w++) {
+    uint32_t count = rank_start[w];
+    rank_start[w]  = pos;
+    pos += count;
+  }
+  for (uint32_t s = 0; s <= max_symbol; s++) {
+    uint32_t len = huf->length[s];
+    if (len == 0) { continue; }
+    uint32_t w   = max_bits + 1 - len;
+    huf->code[s] = static_cast<uint16_t>(rank_start[w] >> (w - 1));
+    rank_start[w] += 1u << (w - 1);
+  }
+
+  uint32_t num_streams = (num_literals < 1024) ? 1 : 4;
+  uint32_t size_format = (num_literals < 1024) ? 0 : (num_literals < 16384) ? 2 : 3;
+  uint32_t size_bits   = (size_format == 0) ? 10 : (size_format == 2) ? 14 : 18;
+  uint32_t hdr_size    = (size_format == 0) ? 3 : size_format + 2;
+  uint8_t *cur         = dst + hdr_size;
+  uint32_t tree_size   = write_huffman_tree(ws, max_symbol, max_bits, cur, end);
+  if (tree_size == 0) { return 0; }
+  cur += tree_size;
+  uint8_t *jump_table = cur;
+  if (num_streams == 4) { cur += 6; }
+  uint32_t segment_size = (num_streams == 4) ? (num_literals + 3) / 4 : num_literals;
+  for (uint32_t k = 0; k < num_streams; k++) {
+    entropy::bit_writer_s bw;
+    uint32_t begin = k * segment_size;
+    uint32_t last  = (k + 1 < num_streams) ? begin + segment_size : num_literals;
+    entropy::init_bit_writer(&bw, cur, end);
+    encode_literals_range(&bw, huf, seqs, num_sequences, src, size, num_literals, begin, last);
+    entropy::put_bits(&bw, 1, 1);
+    entropy::align_bits(&bw);
+    if (k + 1 < num_streams) {
+      uint32_t stream_size = static_cast<uint32_t>(bw.cur - cur);
+      if (stream_size > 0xffff) { return 0; }
+      put_le(jump_table + k * 2, end, stream_size, 2);
+    }
+    cur = bw.cur;
+  }
+  uint32_t comp_size = static_cast<uint32_t>(cur - (dst + hdr_size));
+  if (comp_size >= (1u << size_bits)) { return 0; }
+  uint64_t hdr = literals_huf | (size_format << 2) | (num_literals << 4) |
+                 (static_cast<uint64_t>(comp_size) << (4 + size_bits));
+  put_le(dst, end, hdr, hdr_size);
+  return hdr_size + comp_size;
+}
+
+/**
+ * @brief Writes the literals section of a block, Huffman-coded, RLE or raw
+ *
+ * @return Size of the section
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t encode_literals(encoder_workspace_s *ws,
+                                                   const lz77::sequence_s *seqs,
+                                                   uint32_t num_sequences,
+                                                   const uint8_t *src,
+                                                   uint32_t size,
+                                                   uint32_t num_literals,
+                                                   uint8_t *dst,
+                                                   uint8_t *end)
+{
+  uint32_t num_used = 0, max_symbol = 0;
+  for (uint32_t s = 0; s < 256; s++) { ws->lit_freq[s] = 0; }
+  for (uint32_t k = 0, pos = 0; k <= num_sequences; k++) {
+    uint32_t len = (k < num_sequences) ? seqs[k].literal_length : size - pos;
+    for (uint32_t i = 0; i < len; i++) { ws->lit_freq[src[pos + i]]++; }
+    if (k < num_sequences) { pos += len + seqs[k].match_length; }
+  }
+  for (uint32_t s = 0; s < 256; s++) {
+    if (ws->lit_freq[s]) {
+      num_used++;
+      max_symbol = s;
+    }
+  }
+  if (num_used == 1) {
+    uint32_t hdr_size = write_literals_header(dst, end, literals_rle, num_literals);
+    put_le(dst + hdr_size, end, max_symbol, 1);
+    return hdr_size + 1;
+  }
+  uint32_t raw_size = write_literals_header(dst, end, literals_raw, num_literals) + num_literals;
+  if (num_used > 1) {
+    uint32_t huf_size = encode_huffman_literals(
+      ws, seqs, num_sequences, src, size, num_literals, max_symbol, dst, end);
+    if (huf_size != 0 && huf_size < raw_size) { return huf_size; }
+  }
+  uint8_t *cur = dst + write_literals_header(dst, end, literals_raw, num_literals);
+  for (uint32_t k = 0, pos = 0; k <= num_sequences; k++) {
+    uint32_t len = (k < num_sequences) ? seqs[k].literal_length : size - pos;
+    for (uint32_t i = 0; i < len; i++, cur++) {
+      if (cur < end) { *cur = src[pos + i]; }
+    }
+    if (k < num_sequences) { pos += len + seqs[k].match_length; }
+  }
+  return raw_size;
+}
+
+/**
+ * @brief Selects the mode of one of the FSE tables of the sequences section, and writes its
+ * description
+ *
+ * @param[out] ct FSE encoding table, unused in RLE mode
+ * @param[out] mode Table mode
+ * @param[in] freq Symbol counts
+ * @param[in] max_allowed Largest symbol of the table
+ * @param[in] num_sequences Number of sequences
+ * @param[in] kind 0 for literals lengths, 1 for offsets, 2 for match lengths
+ * @param[in] max_log Maximum accuracy log
+ * @param[out] dst Output buffer
+ * @param[in] end End of the output buffer
+ *
+ * @return Size of the description
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t write_sequence_table(entropy::fse_ctable_s *ct,
+                                                        uint32_t *mode,
+                                                        const uint32_t *freq,
+                                                        uint32_t max_allowed,
+                                                        uint32_t num_sequences,
+                                                        uint32_t kind,
+                                                        uint32_t max_log,
+                                                        uint8_t *dst,
+                                                        uint8_t *end)
+{
+  int16_t norm[max_match_symbol + 1];
+  uint32_t num_used = 0, max_symbol = 0;
+  for (uint32_t s = 0; s <= max_allowed; s++) {
+    if (freq[s]) {
+      num_used++;
+      max_symbol = s;
+    }
+  }
+  if (num_used == 1) {
+    *mode = mode_rle;
+    put_le(dst, end, max_symbol, 1);
+    return 1;
+  }
+  uint32_t predefined_max;
+  uint32_t predefined_log = get_predefined_norm(norm, kind, &predefined_max);
+  // Small blocks don't make up for the cost of the table description
+  if (num_sequences < 64 && max_symbol <= predefined_max) {
+    *mode = mode_predefined;
+    entropy::build_fse_ctable(ct, norm, predefined_max, predefined_log);
+    return 0;
+  }
+  entropy::bit_writer_s bw;
+  uint32_t log = entropy::fse_table_log(num_sequences, num_used, max_log);
+  entropy::normalize_counts(norm, freq, max_symbol, num_sequences, log);
+  entropy::build_fse_ctable(ct, norm, max_symbol, log);
+  entropy::init_bit_writer(&bw, dst, end);
+  entropy::write_fse_probabilities(&bw, norm, max_symbol, log);
+  entropy::align_bits(&bw);
+  *mode = mode_fse;
+  return static_cast<uint32_t>(bw.cur - dst);
+}
+
+/**
+ * @brief Writes the sequences section of a block
+ *
+ * The sequences are encoded from the last one, with their offsets already converted to offset
+ * values.
+ *
+ * @return Size of the section
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t encode_sequences(encoder_workspace_s *ws,
+                                                    const lz77::sequence_s *seqs,
+                                                    uint32_t num_sequences,
+                                                    uint8_t *dst,
+                                                    uint8_t *end)
+{
+  uint32_t nb, extra, pos;
+  if (num_sequences < 128) {
+    put_le(dst, end, num_sequences, 1);
+    pos = 1;
+  } else {
+    put_le(dst, end, ((num_sequences >> 8) + 128) | ((num_sequences & 0xff) << 8), 2);
+    pos = 2;
+  }
+  if (num_sequences == 0) { return pos; }
+  for (uint32_t s = 0; s <= max_literals_symbol; s++) { ws->ll_freq[s] = 0; }
+  for (uint32_t s = 0; s <= max_offset_symbol; s++) { ws->of_freq[s] = 0; }
+  for (uint32_t s = 0; s <= max_match_symbol; s++) { ws->ml_freq[s] = 0; }
+  for (uint32_t i = 0; i < num_sequences; i++) {
+    ws->ll_freq[literals_length_code(seqs[i].literal_length, &nb, &extra)]++;
+    ws->of_freq[highbit32(seqs[i].offset)]++;
+    ws->ml_freq[match_length_code(seqs[i].match_length, &nb, &extra)]++;
+  }
+  uint32_t ll_mode, of_mode, ml_mode;
+  uint8_t *modes = dst + pos++;
+  pos += write_sequence_table(&ws->ll, &ll_mode, ws->ll_freq, max_literals_symbol,
+                              num_sequences, 0, max_literals_log, dst + pos, end);
+  pos += write_sequence_table(&ws->of, &of_mode, ws->of_freq, max_offset_symbol,
+                              num_sequences, 1, max_offset_log, dst + pos, end);
+  pos += write_sequence_table(&ws->ml, &ml_mode, ws->ml_freq, max_match_symbol,
+                              num_sequences, 2, max_match_log, dst + pos, end);
+  put_le(modes, end, (ll_mode << 6) | (of_mode << 4) | (ml_mode << 2), 1);
+
+  // States are initialized with the last sequence, whose extra bits are read last
+  entropy::bit_writer_s bw;
+  entropy::fse_state_s ll_state, of_state, ml_state;
+  entropy::init_bit_writer(&bw, dst + pos, end);
+  for (int32_t i = num_sequences - 1; i >= 0; i--) {
+    uint32_t ll_nb, ll_extra, ml_nb, ml_extra;
+    uint32_t ll_code = literals_length_code(seqs[i].literal_length, &ll_nb, &ll_extra);
+    uint32_t ml_code = match_length_code(seqs[i].match_length, &ml_nb, &ml_extra);
+    uint32_t of_code = highbit32(seqs[i].offset);
+    if (i == static_cast<int32_t>(num_sequences) - 1) {
+      if (ml_mode != mode_rle) { entropy::init_fse_state(&ml_state, &ws->ml, ml_code); }
+      if (of_mode != mode_rle) { entropy::init_fse_state(&of_state, &ws->of, of_code); }
+      if (ll_mode != mode_rle) { entropy::init_fse_state(&ll_state, &ws->ll, ll_code); }
+    } else {
+      if (of_mode != mode_rle) { entropy::encode_fse_symbol(&bw, &of_state, &ws->of, of_code); }
+      if (ml_mode != mode_rle) { entropy::encode_fse_symbol(&bw, &ml_state, &ws->ml, ml_code); }
+      if (ll_mode != mode_rle) { entropy::encode_fse_symbol(&bw, &ll_state, &ws->ll, ll_code); }
+    }
+    entropy::put_bits(&bw, ll_extra, ll_nb);
+    entropy::put_bits(&bw, ml_extra, ml_nb);
+    entropy::put_bits(&bw, seqs[i].offset - (1u << of_code), of_code);
+  }
+  if (ml_mode != mode_rle) { entropy::flush_fse_state(&bw, &ml_state, &ws->ml); }
+  if (of_mode != mode_rle) { entropy::flush_fse_state(&bw, &of_state, &ws->of); }
+  if (ll_mode != mode_rle) { entropy::flush_fse_state(&bw, &ll_state, &ws->ll); }
+  entropy::put_bits(&bw, 1, 1);
+  entropy::align_bits(&bw);
+  return static_cast<uint32_t>(bw.cur - dst);
+}
+
+/**
+ * @brief Compresses data into a single Zstandard frame
+ *
+ * @param[in] m Hash table, cleared by the caller
+ * @param[in] seqs Sequences of the current block, max_block_sequences entries
+ * @param[in] ws Encoder workspace
+ * @param[in] p Match finder parameters
+ * @param[in] src Uncompressed data
+ * @param[in] src_len Length of the uncompressed data
+ * @param[out] dst Compressed data
+ * @param[in] dst_len Size of the output buffer
+ *
+ * @return Size of the compressed data, larger than dst_len if the output did not fit
+ **/
+CUDA_HOST_DEVICE_CALLABLE size_t compress(lz77::matcher_s *m,
+                                          lz77::sequence_s *seqs,
+                                          encoder_workspace_s *ws,
+                                          const lz77::params_s &p,
+                                          const uint8_t *src,
+                                          uint32_t src_len,
+                                          uint8_t *dst,
+                                          size_t dst_len)
+{
+  uint8_t *end     = dst + dst_len;
+  uint32_t rep[3]  = {1, 4, 8};
+  uint32_t start   = 0;
+  size_t out       = 0;
+  bool last_block  = false;
+  // Single-segment frame header with the content size
+  put_le(dst, end, frame_magic, 4);
+  if (src_len < 256) {
+    put_le(dst + 4, end, 0x20 | (static_cast<uint64_t>(src_len) << 8), 2);
+    out = 6;
+  } else if (src_len < 65536 + 256) {
+    put_le(dst + 4, end, 0x60 | (static_cast<uint64_t>(src_len - 256) << 8), 3);
+    out = 7;
+  } else {
+    put_le(dst + 4, end, 0xa0 | (static_cast<uint64_t>(src_len) << 8), 5);
+    out = 9;
+  }
+  do {
+    uint32_t num_sequences;
+    uint32_t block_end = lz77::parse_block(
+      m, p, src, src_len, start, max_block_size, seqs, max_block_sequences, &num_sequences);
+    uint32_t size        = block_end - start;
+    uint32_t num_literals = size;
+    uint32_t block_rep[3] = {rep[0], rep[1], rep[2]};
+    last_block            = (block_end == src_len);
+    for (uint32_t i = 0; i < num_sequences; i++) {
+      uint32_t ll       = seqs[i].literal_length;
+      uint32_t ov       = offset_value(block_rep, seqs[i].offset, ll);
+      seqs[i].offset = ov;
+      resolve_offset(block_rep, ov, ll);
+      num_literals -= seqs[i].match_length;
+    }
+    uint8_t *block     = dst + out + 3;
+    uint32_t comp_size = 0;
+    if (size != 0) {
+      comp_size = encode_literals(ws, seqs, num_sequences, src + start, size, num_literals,
+                                  block, end);
+      comp_size += encode_sequences(ws, seqs, num_sequences, block + comp_size, end);
+    }
+    if (size != 0 && comp_size < size) {
+      for (uint32_t i = 0; i < 3; i++) { rep[i] = block_rep[i]; }
+      put_le(dst + out, end, (last_block ? 1 : 0) | (block_compressed << 1) | (comp_size << 3), 3);
+    } else {
+      // Raw blocks have no sequences, so they leave the repeat offsets unchanged
+      comp_size = size;
+      put_le(dst + out, end, (last_block ? 1 : 0) | (block_raw << 1) | (size << 3), 3);
+      for (uint32_t i = 0; i < size; i++) {
+        if (block + i < end) { block[i] = src[start + i]; }
+      }
+    }
+    out += 3 + comp_size;
+    start = block_end;
+  } while (!last_block);
+  return out;
+}
+
+}  // namespace zstd
+}  // namespace io
+}  // namespace cudf
+
+#endif  // __IO_ZSTD_ENC_H__
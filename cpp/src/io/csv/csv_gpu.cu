@@ -30,6 +30,12 @@
 
 #include <io/utilities/block_utils.cuh>
 #include <io/utilities/parsing_utils.cuh>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
 #include <type_traits>
 
 using namespace ::cudf::io;
@@ -167,14 +173,131 @@ __device__ __inline__ bool is_floatingpoint(
 }
 
 /*
- * @brief CUDA kernel that parses and converts CSV data into cuDF column data.
+ * @brief Classes of field values found by the dtype detection
+ */
+enum class field_class : uint8_t { null, boolean, integer, floating_point, datetime, string };
+
+/*
+ * @brief Classifies the value of a field for dtype detection.
+ *
+ * @param raw_csv The entire CSV data to read
+ * @param opts A set of parsing options
+ * @param start The start of the field
+ * @param end The end of the field (position of the delimiter or terminator)
+ * @param flags Parsing behavior flags of the field's column
+ *
+ * @return The class of the field value
+ */
+__device__ field_class classify_field(
+  const char *raw_csv, ParseOptions const &opts, long start, long end, column_parse::flags flags)
+{
+  long tempPos   = end - 1;
+  long field_len = end - start;
+
+  if (field_len <= 0 || serializedTrieContains(opts.naValuesTrie, raw_csv + start, field_len)) {
+    return field_class::null;
+  }
+  if (serializedTrieContains(opts.trueValuesTrie, raw_csv + start, field_len) ||
+      serializedTrieContains(opts.falseValuesTrie, raw_csv + start, field_len)) {
+    return field_class::boolean;
+  }
+
+  long countNumber   = 0;
+  long countDecimal  = 0;
+  long countSlash    = 0;
+  long countDash     = 0;
+  long countPlus     = 0;
+  long countColon    = 0;
+  long countString   = 0;
+  long countExponent = 0;
+
+  // Modify start & end to ignore whitespace and quotechars
+  // This could possibly result in additional empty fields
+  trim_field_start_end(raw_csv, &start, &tempPos);
+  field_len = tempPos - start + 1;
+
+  for (long startPos = start; startPos <= tempPos; startPos++) {
+    if (is_digit(raw_csv[startPos])) {
+      countNumber++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types.
+    switch (raw_csv[startPos]) {
+      case '.': countDecimal++; break;
+      case '-': countDash++; break;
+      case '+': countPlus++; break;
+      case '/': countSlash++; break;
+      case ':': countColon++; break;
+      case 'e':
+      case 'E':
+        if (startPos > start && startPos < tempPos) countExponent++;
+        break;
+      default: countString++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  long int_req_number_cnt = field_len;
+  // Off by one if they start with a minus sign
+  if ((raw_csv[start] == '-' || raw_csv[start] == '+') && field_len > 1) { --int_req_number_cnt; }
+
+  if (field_len == 0) {
+    // Ignoring whitespace and quotes can result in empty fields
+    return field_class::null;
+  } else if (flags & column_parse::as_datetime) {
+    // PANDAS uses `object` dtype if the date is unparseable
+    if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
+      return field_class::datetime;
+    }
+    return field_class::string;
+  } else if (countNumber == int_req_number_cnt) {
+    return field_class::integer;
+  } else if (is_floatingpoint(
+               field_len, countNumber, countDecimal, countDash + countPlus, countExponent)) {
+    return field_class::floating_point;
+  }
+  return field_class::string;
+}
+
+/*
+ * @brief Returns whether the detected dtype of a column remains the same if a field value of the
+ * given class is added to the column.
+ *
+ * Follows the selection of the dtype from the column histogram in the reader.
+ *
+ * @param value The class of the field value
+ * @param dtype The dtype detected from the other values of the column
+ *
+ * @return `true` if the value fits the dtype, `false` otherwise
+ */
+__device__ __inline__ bool is_detected_type(field_class value, cudf::data_type dtype)
+{
+  switch (dtype.id()) {
+    case cudf::type_id::STRING: return true;
+    // Only detected for columns of nulls
+    case cudf::type_id::INT8: return value == field_class::null;
+    case cudf::type_id::INT64: return value == field_class::integer;
+    // Integer columns with nulls are detected as floating point
+    case cudf::type_id::FLOAT64:
+      return value == field_class::null || value == field_class::integer ||
+             value == field_class::floating_point;
+    case cudf::type_id::BOOL8:
+      return value != field_class::string && value != field_class::datetime;
+    // Timestamps
+    default: return value != field_class::string;
+  }
+}
+
+/*
+ * @brief CUDA kernel that detects the dtypes of CSV data fields.
  *
  * Data is processed in one row/record at a time, so the number of total
- * threads (tid) is equal to the number of rows.
+ * threads (tid) is equal to the number of sampled rows.
  *
  * @param raw_csv The entire CSV data to read
  * @param opts A set of parsing options
- * @param num_records The number of lines/rows of CSV data
+ * @param num_records The number of sampled lines/rows of CSV data
+ * @param row_stride The distance between sampled rows
  * @param num_columns The number of columns of CSV data
  * @param column_flags Per-column parsing behavior flags
  * @param recStart The start the CSV data of interest
@@ -184,6 +307,7 @@ __global__ void __launch_bounds__(csvparse_block_dim)
   data_type_detection(const char *raw_csv,
                       const ParseOptions opts,
                       size_t num_records,
+                      size_t row_stride,
                       int num_columns,
                       column_parse::flags *flags,
                       const uint64_t *recStart,
@@ -197,8 +321,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
   // the data
   if (rec_id >= num_records) { return; }
 
-  long start = recStart[rec_id];
-  long stop  = recStart[rec_id + 1];
+  long start = recStart[rec_id * row_stride];
+  long stop  = recStart[rec_id * row_stride + 1];
 
   long pos       = start;
   int col        = 0;
@@ -213,74 +337,17 @@ __global__ void __launch_bounds__(csvparse_block_dim)
     // Checking if this is a column that the user wants --- user can filter
     // columns
     if (flags[col] & column_parse::enabled) {
-      long tempPos   = pos - 1;
-      long field_len = pos - start;
-
-      if (field_len <= 0 || serializedTrieContains(opts.naValuesTrie, raw_csv + start, field_len)) {
-        atomicAdd(&d_columnData[actual_col].countNULL, 1);
-      } else if (serializedTrieContains(opts.trueValuesTrie, raw_csv + start, field_len) ||
-                 serializedTrieContains(opts.falseValuesTrie, raw_csv + start, field_len)) {
-        atomicAdd(&d_columnData[actual_col].countBool, 1);
-      } else {
-        long countNumber   = 0;
-        long countDecimal  = 0;
-        long countSlash    = 0;
-        long countDash     = 0;
-        long countPlus     = 0;
-        long countColon    = 0;
-        long countString   = 0;
-        long countExponent = 0;
-
-        // Modify start & end to ignore whitespace and quotechars
-        // This could possibly result in additional empty fields
-        trim_field_start_end(raw_csv, &start, &tempPos);
-        field_len = tempPos - start + 1;
-
-        for (long startPos = start; startPos <= tempPos; startPos++) {
-          if (is_digit(raw_csv[startPos])) {
-            countNumber++;
-            continue;
-          }
-          // Looking for unique characters that will help identify column types.
-          switch (raw_csv[startPos]) {
-            case '.': countDecimal++; break;
-            case '-': countDash++; break;
-            case '+': countPlus++; break;
-            case '/': countSlash++; break;
-            case ':': countColon++; break;
-            case 'e':
-            case 'E':
-              if (startPos > start && startPos < tempPos) countExponent++;
-              break;
-            default: countString++; break;
-          }
-        }
-
-        // Integers have to have the length of the string
-        long int_req_number_cnt = field_len;
-        // Off by one if they start with a minus sign
-        if ((raw_csv[start] == '-' || raw_csv[start] == '+') && field_len > 1) {
-          --int_req_number_cnt;
-        }
-
-        if (field_len == 0) {
-          // Ignoring whitespace and quotes can result in empty fields
-          atomicAdd(&d_columnData[actual_col].countNULL, 1);
-        } else if (flags[col] & column_parse::as_datetime) {
-          // PANDAS uses `object` dtype if the date is unparseable
-          if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
-            atomicAdd(&d_columnData[actual_col].countDateAndTime, 1);
-          } else {
-            atomicAdd(&d_columnData[actual_col].countString, 1);
-          }
-        } else if (countNumber == int_req_number_cnt) {
-          atomicAdd(&d_columnData[actual_col].countInt64, 1);
-        } else if (is_floatingpoint(
-                     field_len, countNumber, countDecimal, countDash + countPlus, countExponent)) {
+      switch (classify_field(raw_csv, opts, start, pos, flags[col])) {
+        case field_class::null: atomicAdd(&d_columnData[actual_col].countNULL, 1); break;
+        case field_class::boolean: atomicAdd(&d_columnData[actual_col].countBool, 1); break;
+        case field_class::integer: atomicAdd(&d_columnData[actual_col].countInt64, 1); break;
+        case field_class::floating_point:
           atomicAdd(&d_columnData[actual_col].countFloat, 1);
-        } else {
-          atomicAdd(&d_columnData[actual_col].countString, 1);
-        }
+          break;
+        case field_class::datetime:
+          atomicAdd(&d_columnData[actual_col].countDateAndTime, 1);
+          break;
+        default: atomicAdd(&d_columnData[actual_col].countString, 1); break;
       }
       actual_col++;
     }
@@ -521,10 +588,12 @@ struct decode_op {
  * @param[in] num_columns The number of columns of CSV data
  * @param[in] column_flags Per-column parsing behavior flags
  * @param[in] recStart The start the CSV data of interest
+ * @param[in] row_indices Input row of each output row; all rows are decoded in order if null
  * @param[in] dtype The data type of the column
  * @param[out] data The output column data
  * @param[out] valid The bitmaps indicating whether column fields are valid
- * @param[out] num_valid The numbers of valid fields in columns
+ * @param[out] type_mismatch Set if a field does not fit the dtype detected for its column; checks
+ * are skipped if null
  **/
 __global__ void __launch_bounds__(csvparse_block_dim)
   convert_csv_to_cudf(const char *raw_csv,
@@ -533,9 +602,11 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       size_t num_columns,
                       const column_parse::flags *flags,
                       const uint64_t *recStart,
+                      const cudf::size_type *row_indices,
                       cudf::data_type *dtype,
                       void **data,
-                      cudf::bitmask_type **valid)
+                      cudf::bitmask_type **valid,
+                      uint32_t *type_mismatch)
 {
   // thread IDs range per block, so also need the block id
   long rec_id =
@@ -546,8 +617,10 @@ __global__ void __launch_bounds__(csvparse_block_dim)
   // the data
   if (rec_id >= num_records) return;
 
-  long start = recStart[rec_id];
-  long stop  = recStart[rec_id + 1];
+  // Rows are compacted into the output when only some of them are decoded
+  const long in_rec_id = (row_indices != nullptr) ? row_indices[rec_id] : rec_id;
+  long start           = recStart[in_rec_id];
+  long stop            = recStart[in_rec_id + 1];
 
   long pos       = start;
   int col        = 0;
@@ -559,6 +632,13 @@ __global__ void __launch_bounds__(csvparse_block_dim)
     pos = cudf::io::gpu::seek_field_end(raw_csv, opts, pos, stop);
 
     if (flags[col] & column_parse::enabled) {
+      // Dtypes detected from a sample of the rows are checked against all values
+      if (type_mismatch != nullptr &&
+          !is_detected_type(classify_field(raw_csv, opts, start, pos, flags[col]),
+                            dtype[actual_col])) {
+        *type_mismatch = 1;
+      }
+
       // check if the entire field is a NaN string - consistent with pandas
       const bool is_na = serializedTrieContains(opts.naValuesTrie, raw_csv + start, pos - start);
 
@@ -939,6 +1019,97 @@ __global__ void __launch_bounds__(rowofs_block_dim) gather_row_offsets_gpu(uint6
   }
 }
 
+/**
+ * @brief Row counts and output contexts of a sequence of character blocks for each possible
+ * input context, with counts wide enough for a whole batch of blocks
+ **/
+struct row_context_span {
+  uint32_t rows[3];  // rows for the NONE, QUOTE and COMMENT input contexts
+  uint32_t out_ctx;  // 2-bit output context id per input context
+
+  __host__ __device__ uint32_t count(uint32_t ctxid) const
+  {
+    return (ctxid == ROW_CTX_EOF) ? 0 : rows[ctxid];
+  }
+
+  __host__ __device__ uint32_t out(uint32_t ctxid) const
+  {
+    return (ctxid == ROW_CTX_EOF) ? ROW_CTX_EOF : (out_ctx >> (ctxid * 2)) & 3;
+  }
+
+  /**
+   * @brief Returns the row context after the blocks, given the context before the blocks
+   **/
+  __host__ __device__ rowctx64_t select(rowctx64_t sel_ctx) const
+  {
+    uint32_t ctxid = static_cast<uint32_t>(sel_ctx & 3);
+    return (sel_ctx & ~3) + (static_cast<rowctx64_t>(count(ctxid)) << 2) + out(ctxid);
+  }
+};
+
+/**
+ * @brief Concatenates the spans of two consecutive sequences of character blocks
+ *
+ * This is the composition of their context transitions, and is therefore associative.
+ **/
+struct merge_row_context_spans {
+  __device__ row_context_span operator()(row_context_span const &first,
+                                         row_context_span const &second) const
+  {
+    row_context_span merged;
+    merged.out_ctx = 0;
+    for (uint32_t ctxid = 0; ctxid < 3; ctxid++) {
+      const uint32_t mid_ctx = first.out(ctxid);
+      merged.rows[ctxid]     = first.count(ctxid) + second.count(mid_ctx);
+      merged.out_ctx         = merged.out_ctx | (second.out(mid_ctx) << (ctxid * 2));
+    }
+    return merged;
+  }
+};
+
+uint64_t __host__ select_row_contexts(uint64_t *row_ctx,
+                                      uint32_t num_blocks,
+                                      uint64_t start_ctx,
+                                      cudaStream_t stream)
+{
+  if (num_blocks == 0) { return start_ctx; }
+
+  rmm::device_vector<row_context_span> spans(num_blocks);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    row_ctx,
+                    row_ctx + num_blocks,
+                    spans.begin(),
+                    [] __device__(packed_rowctx_t packed_ctx) {
+                      row_context_span span;
+                      span.out_ctx = 0;
+                      for (uint32_t ctxid = 0; ctxid < 3; ctxid++) {
+                        const rowctx32_t ctx = get_row_context(packed_ctx, ctxid);
+                        span.rows[ctxid]     = ctx >> 2;
+                        span.out_ctx         = span.out_ctx | ((ctx & 3) << (ctxid * 2));
+                      }
+                      return span;
+                    });
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         spans.begin(),
+                         spans.end(),
+                         spans.begin(),
+                         merge_row_context_spans{});
+  // Replace the packed context of each block with its starting row and context
+  auto d_spans = spans.data().get();
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<uint32_t>(0),
+                   thrust::make_counting_iterator<uint32_t>(num_blocks),
+                   [row_ctx, d_spans, start_ctx] __device__(uint32_t i) {
+                     row_ctx[i] = (i == 0) ? start_ctx : d_spans[i - 1].select(start_ctx);
+                   });
+
+  row_context_span last;
+  CUDA_TRY(cudaMemcpyAsync(
+    &last, d_spans + num_blocks - 1, sizeof(last), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return last.select(start_ctx);
+}
+
 size_t __host__ count_blank_rows(rmm::device_vector<uint64_t> const &row_offsets,
                                  rmm::device_vector<char> const &data,
                                  const cudf::io::ParseOptions &opts,
@@ -983,6 +1154,7 @@ void __host__ remove_blank_rows(rmm::device_vector<uint64_t> &row_offsets,
 cudaError_t __host__ DetectColumnTypes(const char *data,
                                        const uint64_t *row_starts,
                                        size_t num_rows,
+                                       size_t row_stride,
                                        size_t num_columns,
                                        const ParseOptions &options,
                                        column_parse::flags *flags,
@@ -994,13 +1166,14 @@ cudaError_t __host__ DetectColumnTypes(const char *data,
   const int grid_size  = (num_rows + block_size - 1) / block_size;
 
   data_type_detection<<<grid_size, block_size, 0, stream>>>(
-    data, options, num_rows, num_columns, flags, row_starts, stats);
+    data, options, num_rows, row_stride, num_columns, flags, row_starts, stats);
 
   return cudaSuccess;
 }
 
 cudaError_t __host__ DecodeRowColumnData(const char *data,
                                          const uint64_t *row_starts,
+                                         const cudf::size_type *row_indices,
                                          size_t num_rows,
                                          size_t num_columns,
                                          const ParseOptions &options,
@@ -1008,14 +1181,24 @@ cudaError_t __host__ DecodeRowColumnData(const char *data,
                                          cudf::data_type *dtypes,
                                          void **columns,
                                          cudf::bitmask_type **valids,
+                                         uint32_t *type_mismatch,
                                          cudaStream_t stream)
 {
   // Calculate actual block count to use based on records count
   const int block_size = csvparse_block_dim;
   const int grid_size  = (num_rows + block_size - 1) / block_size;
 
-  convert_csv_to_cudf<<<grid_size, block_size, 0, stream>>>(
-    data, options, num_rows, num_columns, flags, row_starts, dtypes, columns, valids);
+  convert_csv_to_cudf<<<grid_size, block_size, 0, stream>>>(data,
+                                                            options,
+                                                            num_rows,
+                                                            num_columns,
+                                                            flags,
+                                                            row_starts,
+                                                            row_indices,
+                                                            dtypes,
+                                                            columns,
+                                                            valids,
+                                                            type_mismatch);
 
   return cudaSuccess;
 }
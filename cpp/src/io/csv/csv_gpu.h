@@ -161,6 +161,25 @@ uint32_t gather_row_offsets(uint64_t *row_ctx,
                             const cudf::io::ParseOptions &options,
                             cudaStream_t stream = 0);
 
+/**
+ * @brief Resolves the parsing context at the start of each character block on the device
+ *
+ * Combines the per-block row contexts of the first phase of gather_row_offsets with a parallel
+ * prefix scan, replacing them with the row count and parsing context at the start of each block
+ * as expected by the second phase.
+ *
+ * @param row_ctx Row parsing context of each character block
+ * @param num_blocks Number of character blocks
+ * @param start_ctx Row count and parsing context at the start of the first block
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Row count and parsing context at the end of the last block
+ **/
+uint64_t select_row_contexts(uint64_t *row_ctx,
+                             uint32_t num_blocks,
+                             uint64_t start_ctx,
+                             cudaStream_t stream = 0);
+
 /**
  * Count the number of blank rows in the given row offset array
  *
@@ -194,7 +213,8 @@ void remove_blank_rows(rmm::device_vector<uint64_t> &row_offsets,
  *
  * @param[in] data The row-column data
  * @param[in] row_starts List of row data start positions (offsets)
- * @param[in] num_rows Number of rows
+ * @param[in] num_rows Number of sampled rows
+ * @param[in] row_stride Distance between sampled rows; `1` to sample all rows
  * @param[in] num_columns Number of columns
  * @param[in] options Options that control individual field data conversion
  * @param[in,out] flags Flags that control individual column parsing
@@ -206,6 +226,7 @@ void remove_blank_rows(rmm::device_vector<uint64_t> &row_offsets,
 cudaError_t DetectColumnTypes(const char *data,
                               const uint64_t *row_starts,
                               size_t num_rows,
+                              size_t row_stride,
                               size_t num_columns,
                               const cudf::io::ParseOptions &options,
                               column_parse::flags *flags,
@@ -217,20 +238,24 @@ cudaError_t DetectColumnTypes(const char *data,
  *
  * @param[in] data The row-column data
  * @param[in] row_starts List of row data start positions (offsets)
- * @param[in] num_rows Number of rows
+ * @param[in] row_indices Input row to decode into each output row, or `nullptr` to decode all
+ * rows in order
+ * @param[in] num_rows Number of rows to decode
  * @param[in] num_columns Number of columns
  * @param[in] options Options that control individual field data conversion
  * @param[in] flags Flags that control individual column parsing
  * @param[in] dtypes List of dtype corresponding to each column
  * @param[out] columns Device memory output of column data
  * @param[out] valids Device memory output of column valids bitmap data
- * @param[out] num_valid Number of valid fields in each column
+ * @param[out] type_mismatch Device memory output set to non-zero if a field does not fit the
+ * detected dtype of its column; `nullptr` to skip the checks
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
  **/
 cudaError_t DecodeRowColumnData(const char *data,
                                 const uint64_t *row_starts,
+                                const cudf::size_type *row_indices,
                                 size_t num_rows,
                                 size_t num_columns,
                                 const cudf::io::ParseOptions &options,
@@ -238,7 +263,8 @@ cudaError_t DecodeRowColumnData(const char *data,
                                 cudf::data_type *dtypes,
                                 void **columns,
                                 cudf::bitmask_type **valids,
-                                cudaStream_t stream = (cudaStream_t)0);
+                                uint32_t *type_mismatch = nullptr,
+                                cudaStream_t stream     = (cudaStream_t)0);
 
 }  // namespace gpu
 }  // namespace csv
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/parse_digits.cuh>
+
 /**
  * @brief Returns location to the first occurrence of a character in a string
  *
@@ -299,6 +301,44 @@ __inline__ __device__ void extractTime(
   }
 }
 
+/**
+ * @brief Extract the fields of an ISO-8601 `YYYY-MM-DD[(T| )HH:MM:SS[.fraction]]` string
+ *
+ * Every field is at a fixed position so the digits are read directly, without searching
+ * for the separators first. The fraction is returned as its integer value, like extractTime.
+ *
+ * @param[in] data Pointer to the data block
+ * @param[in] start Starting index within the data block
+ * @param[in] end Ending index (inclusive) within the data block
+ * @param[out] fields Year, month, day, hour, minute, second and millisecond
+ *
+ * @return 0 if the string is not in the ISO layout, 1 for a date only and 2 for a datetime
+ */
+__inline__ __device__ int extractIsoDateTime(const char *data, long start, long end, int *fields)
+{
+  auto const ptr    = data + start;
+  auto const length = end - start + 1;
+  if ((length != 10 && length < 19) || ptr[4] != '-' || ptr[7] != '-') return 0;
+  fields[0] = cudf::detail::parse_fixed_digits(ptr, 4);
+  fields[1] = cudf::detail::parse_fixed_digits(ptr + 5, 2);
+  fields[2] = cudf::detail::parse_fixed_digits(ptr + 8, 2);
+  if (fields[0] < 0 || fields[1] < 0 || fields[2] < 0) return 0;
+  if (length == 10) return 1;
+
+  if ((ptr[10] != 'T' && ptr[10] != ' ') || ptr[13] != ':' || ptr[16] != ':') return 0;
+  fields[3] = cudf::detail::parse_fixed_digits(ptr + 11, 2);
+  fields[4] = cudf::detail::parse_fixed_digits(ptr + 14, 2);
+  fields[5] = cudf::detail::parse_fixed_digits(ptr + 17, 2);
+  fields[6] = 0;
+  if (fields[3] < 0 || fields[4] < 0 || fields[5] < 0) return 0;
+  if (length == 19) return 2;
+
+  // Fraction digits must run to the end of the field
+  if (ptr[19] != '.' || length == 20 || length > 29) return 0;
+  fields[6] = cudf::detail::parse_fixed_digits(ptr + 20, static_cast<int32_t>(length - 20));
+  return fields[6] < 0 ? 0 : 2;
+}
+
 /**
  * @brief Parse a Date string into a date32, days since epoch
  *
@@ -317,6 +357,11 @@ __inline__ __device__ int32_t parseDateFormat(const char *data,
                                               long end_idx,
                                               bool dayfirst)
 {
+  int fields[7];
+  if (extractIsoDateTime(data, start_idx, end_idx, fields) == 1) {
+    return daysSinceEpoch(fields[0], fields[1], fields[2]);
+  }
+
   int day, month, year;
   int32_t e = -1;
 
@@ -346,6 +391,13 @@ __inline__ __device__ int64_t parseDateTimeFormat(const char *data,
                                                   long end,
                                                   bool dayfirst)
 {
+  int fields[7] = {0};
+  if (extractIsoDateTime(data, start, end, fields) != 0) {
+    auto const seconds =
+      secondsSinceEpoch(fields[0], fields[1], fields[2], fields[3], fields[4], fields[5]);
+    return seconds * 1000 + fields[6];
+  }
+
   int day, month, year;
   int hour, minute, second, millisecond = 0;
   int64_t answer = -1;
@@ -27,14 +27,22 @@
 #include <tuple>
 #include <unordered_map>
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/strings/replace.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/pinned_host_pool.hpp>
+#include <io/utilities/row_filter.hpp>
 #include <io/utilities/type_conversion.cuh>
 
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+
 using std::string;
 using std::vector;
 
@@ -173,16 +181,38 @@ std::vector<std::string> setColumnNames(std::vector<char> const &header,
   return col_names;
 }
 
+/**
+ * @brief Returns the indices of the rows whose boolean mask value is valid and true
+ */
+rmm::device_vector<size_type> matching_rows(column_view const &mask, cudaStream_t stream)
+{
+  rmm::device_vector<size_type> rows(mask.size());
+  auto const d_mask = column_device_view::create(mask, stream);
+  auto const end    = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(mask.size()),
+                                   rows.begin(),
+                                   [mask = *d_mask] __device__(size_type row) {
+                                     return mask.is_valid(row) && mask.element<bool>(row);
+                                   });
+  rows.resize(end - rows.begin());
+  return rows;
+}
+
 table_with_metadata reader::impl::read(size_t range_offset,
                                        size_t range_size,
                                        int skip_rows,
                                        int skip_end_rows,
                                        int num_rows,
+                                       bool chunked,
                                        cudaStream_t stream)
 {
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata metadata;
 
+  // Chunks after the first one reuse its column names and types, and do not contain the header
+  const bool reuse_schema = chunked && has_chunk_schema_;
+
   if (range_offset > 0 || range_size > 0) {
     CUDF_EXPECTS(compression_type_ == "none",
                  "Reading compressed data using `byte range` is unsupported");
@@ -194,11 +224,9 @@ table_with_metadata reader::impl::read(size_t range_offset,
   }
 
   // Support delayed opening of the file if using memory mapping datasource
-  // This allows only mapping of a subset of the file if using byte range
-  if (source_ == nullptr) {
-    assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
-  }
+  // This allows only mapping of a subset of the file if using byte range; the file is mapped
+  // again for every read so that consecutive ranges can be read with the same reader
+  if (!filepath_.empty()) { source_ = datasource::create(filepath_, range_offset, map_range_size); }
 
   // Return an empty dataframe if no data and no column metadata to process
   if (source_->is_empty() && (args_.names.empty() || args_.dtype.empty())) {
@@ -230,12 +258,15 @@ table_with_metadata reader::impl::read(size_t range_offset,
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
                                  skip_end_rows <= 0 && num_rows == -1;
 
-    // With byte range, find the start of the first data row
+    // With byte range, the first data row starts after the first terminator in the range. Rows
+    // are found past the first character so that the row parser also sees the character before
+    // them. The parser assumes that the range does not start within a quoted field.
+    // Chunked ranges always start at a row.
     size_t const data_start_offset =
-      (range_offset != 0) ? find_first_row_start(h_uncomp_data, h_uncomp_size) : 0;
+      (range_offset != 0 && !chunked) ? std::min<size_t>(1, h_uncomp_size) : 0;
 
     // TODO: Allow parsing the header outside the mapped range
-    CUDF_EXPECTS((range_offset == 0 || args_.header < 0),
+    CUDF_EXPECTS((range_offset == 0 || args_.header < 0 || reuse_schema),
                  "byte_range offset with header not supported");
 
     // Gather row offsets
@@ -247,6 +278,11 @@ table_with_metadata reader::impl::read(size_t range_offset,
                        num_rows,
                        load_whole_file,
                        stream);
+    if (chunked) {
+      CUDF_EXPECTS(next_row_pos > 0, "Chunk does not contain a complete row");
+      const bool has_more_rows = range_size != 0 && range_offset + next_row_pos < source_->size();
+      next_chunk_offset_       = has_more_rows ? range_offset + next_row_pos : 0;
+    }
 
     // Exclude the rows that are to be skipped from the end
     if (skip_end_rows > 0 && static_cast<size_t>(skip_end_rows) < row_offsets.size()) {
@@ -257,11 +293,14 @@ table_with_metadata reader::impl::read(size_t range_offset,
     num_records = row_offsets.size();
     num_records -= (num_records > 0);
   } else {
-    num_records = 0;
+    num_records        = 0;
+    next_chunk_offset_ = 0;
   }
 
   // Check if the user gave us a list of column names
-  if (not args_.names.empty()) {
+  if (reuse_schema) {
+    // Column names and flags are kept from the first chunk
+  } else if (not args_.names.empty()) {
     h_column_flags.resize(args_.names.size(), column_parse::enabled);
     col_names = args_.names;
   } else {
@@ -302,7 +341,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
   }
 
   // User can specify which columns should be parsed
-  if (!args_.use_cols_indexes.empty() || !args_.use_cols_names.empty()) {
+  if (!reuse_schema && (!args_.use_cols_indexes.empty() || !args_.use_cols_names.empty())) {
     std::fill(h_column_flags.begin(), h_column_flags.end(), column_parse::disabled);
 
     for (const auto index : args_.use_cols_indexes) {
@@ -320,7 +359,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
   }
 
   // User can specify which columns should be inferred as datetime
-  if (!args_.infer_date_indexes.empty() || !args_.infer_date_names.empty()) {
+  if (!reuse_schema && (!args_.infer_date_indexes.empty() || !args_.infer_date_names.empty())) {
     for (const auto index : args_.infer_date_indexes) {
       h_column_flags[index] |= column_parse::as_datetime;
     }
@@ -333,48 +372,47 @@ table_with_metadata reader::impl::read(size_t range_offset,
     }
   }
 
+  if (chunked) { has_chunk_schema_ = true; }
+
   // Return empty table rather than exception if nothing to load
   if (num_active_cols == 0) {
     return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
   }
 
-  std::vector<data_type> column_types = gather_column_types(stream);
+  // Detect the types from evenly spaced rows if sampling; the decoding checks all values against
+  // the detected types, and the types are detected from all rows if a value does not fit
+  const bool sample_types = !reuse_schema && args_.dtype.empty() && args_.infer_sample_rows > 0 &&
+                            num_records > static_cast<size_t>(args_.infer_sample_rows);
+  const size_t row_stride =
+    sample_types ? (num_records + args_.infer_sample_rows - 1) / args_.infer_sample_rows : 1;
+  std::vector<data_type> column_types =
+    reuse_schema ? chunk_column_types_ : gather_column_types(row_stride, stream);
+  // Replace EMPTY dtype with STRING
+  for (auto &type : column_types) {
+    if (type.id() == type_id::EMPTY) { type = data_type{STRING}; }
+  }
 
-  // Alloc output; columns' data memory is still expected for empty dataframe
-  std::vector<column_buffer> out_buffers;
-  out_buffers.reserve(column_types.size());
-  for (int col = 0, active_col = 0; col < num_actual_cols; ++col) {
+  for (int col = 0; col < num_actual_cols; ++col) {
     if (h_column_flags[col] & column_parse::enabled) {
-      // Replace EMPTY dtype with STRING
-      if (column_types[active_col].id() == type_id::EMPTY) {
-        column_types[active_col] = data_type{STRING};
-      }
-      out_buffers.emplace_back(column_types[active_col], num_records, true, stream, mr_);
       metadata.column_names.emplace_back(col_names[col]);
-      active_col++;
     }
   }
 
   out_columns.reserve(column_types.size());
   if (num_records != 0) {
-    decode_data(column_types, out_buffers, stream);
+    std::vector<column_buffer> out_buffers;
+    size_t num_out_rows = 0;
+    if (!decode_rows(column_types, out_buffers, num_out_rows, sample_types, stream)) {
+      column_types = gather_column_types(1, stream);
+      decode_rows(column_types, out_buffers, num_out_rows, false, stream);
+    }
 
     for (size_t i = 0; i < column_types.size(); ++i) {
-      if (column_types[i].id() == type_id::STRING && opts.quotechar != '\0' &&
-          opts.doublequote == true) {
-        // PANDAS' default behavior of enabling doublequote for two consecutive
-        // quotechars in quoted fields results in reduction to a single quotechar
-        // TODO: Would be much more efficient to perform this operation in-place
-        // during the conversion stage
-        const std::string quotechar(1, opts.quotechar);
-        const std::string dblquotechar(2, opts.quotechar);
-        std::unique_ptr<column> col = make_strings_column(out_buffers[i]._strings, stream);
-        out_columns.emplace_back(
-          cudf::strings::replace(col->view(), dblquotechar, quotechar, -1, mr_));
-      } else {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_records, out_buffers[i], stream, mr_));
-      }
+      // All rows may be filtered out
+      out_columns.emplace_back(
+        num_out_rows != 0
+          ? make_output_column(column_types[i], num_out_rows, out_buffers[i], mr_, stream)
+          : make_empty_column(column_types[i]));
     }
   } else {
     // Create empty columns
@@ -382,18 +420,10 @@ table_with_metadata reader::impl::read(size_t range_offset,
       out_columns.emplace_back(make_empty_column(column_types[i]));
     }
   }
+  if (chunked && !reuse_schema) { chunk_column_types_ = column_types; }
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
 }
 
-size_t reader::impl::find_first_row_start(const char *h_data, size_t h_size)
-{
-  // For now, look for the first terminator (assume the first terminator isn't within a quote)
-  // TODO: Attempt to infer this from the data
-  size_t pos = 0;
-  while (pos < h_size && h_data[pos] != opts.terminator) { ++pos; }
-  return std::min(pos + 1, h_size);
-}
-
 void reader::impl::gather_row_offsets(const char *h_data,
                                       size_t h_size,
                                       size_t range_begin,
@@ -410,7 +440,8 @@ void reader::impl::gather_row_offsets(const char *h_data,
   hostdevice_vector<uint64_t> row_ctx(max_blocks);
   size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), h_size);
   size_t pos         = std::min(range_begin, h_size);
-  size_t header_rows = (args_.header >= 0) ? args_.header + 1 : 0;
+  // Only the first chunk of a chunked read contains the header
+  size_t header_rows = (args_.header >= 0 && !has_chunk_schema_) ? args_.header + 1 : 0;
   uint64_t ctx       = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
@@ -423,7 +454,12 @@ void reader::impl::gather_row_offsets(const char *h_data,
     size_t target_pos = std::min(pos + max_chunk_bytes, h_size);
     size_t chunk_size = target_pos - pos;
 
-    data_.insert(data_.end(), h_data + buffer_pos + data_.size(), h_data + target_pos);
+    size_t const previous_size = data_.size();
+    data_.resize(target_pos - buffer_pos);
+    copy_host_to_device(data_.data().get() + previous_size,
+                        h_data + buffer_pos + previous_size,
+                        data_.size() - previous_size,
+                        stream);
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
@@ -440,30 +476,15 @@ void reader::impl::gather_row_offsets(const char *h_data,
                                                                  0,
                                                                  opts,
                                                                  stream);
-    CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                             row_ctx.device_ptr(),
-                             num_blocks * sizeof(uint64_t),
-                             cudaMemcpyDeviceToHost,
-                             stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
     // Sum up the rows in each character block, selecting the row count that
     // corresponds to the current input context. Also stores the now known input
     // context per character block that will be needed by the second pass.
-    for (uint32_t i = 0; i < num_blocks; i++) {
-      uint64_t ctx_next = cudf::io::csv::gpu::select_row_context(ctx, row_ctx[i]);
-      row_ctx[i]        = ctx;
-      ctx               = ctx_next;
-    }
+    ctx = cudf::io::csv::gpu::select_row_contexts(row_ctx.device_ptr(), num_blocks, ctx, stream);
     size_t total_rows = ctx >> 2;
     if (total_rows > skip_rows) {
       // At least one row in range in this batch
       size_t num_row_offsets = total_rows - skip_rows;
       row_offsets.resize(num_row_offsets);
-      CUDA_TRY(cudaMemcpyAsync(row_ctx.device_ptr(),
-                               row_ctx.host_ptr(),
-                               num_blocks * sizeof(uint64_t),
-                               cudaMemcpyHostToDevice,
-                               stream));
       // Pass 2: Output row offsets
       cudf::io::csv::gpu::gather_row_offsets(row_ctx.device_ptr(),
                                              row_offsets.data().get(),
@@ -518,6 +539,18 @@ void reader::impl::gather_row_offsets(const char *h_data,
     pos = target_pos;
   } while (pos < h_size);
 
+  // The last offset is the start of the row after the gathered rows, or the end of the data
+  next_row_pos = h_size;
+  if (row_offsets.size() != 0) {
+    CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
+                             row_offsets.data().get() + row_offsets.size() - 1,
+                             sizeof(uint64_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    next_row_pos = buffer_pos + row_ctx[0];
+  }
+
   // Eliminate blank rows
   if (row_offsets.size() != 0) {
     cudf::io::csv::gpu::remove_blank_rows(row_offsets, data_, opts, stream);
@@ -543,7 +576,7 @@ void reader::impl::gather_row_offsets(const char *h_data,
   if (num_rows >= 0) { row_offsets.resize(std::min<size_t>(row_offsets.size(), num_rows + 1)); }
 }
 
-std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
+std::vector<data_type> reader::impl::gather_column_types(size_t row_stride, cudaStream_t stream)
 {
   std::vector<data_type> dtypes;
 
@@ -553,11 +586,13 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
     } else {
       d_column_flags = h_column_flags;
 
+      const size_t num_sampled = (num_records + row_stride - 1) / row_stride;
       hostdevice_vector<column_parse::stats> column_stats(num_active_cols);
       CUDA_TRY(cudaMemsetAsync(column_stats.device_ptr(), 0, column_stats.memory_size(), stream));
       CUDA_TRY(cudf::io::csv::gpu::DetectColumnTypes(data_.data().get(),
                                                      row_offsets.data().get(),
-                                                     num_records,
+                                                     num_sampled,
+                                                     row_stride,
                                                      num_actual_cols,
                                                      opts,
                                                      d_column_flags.data().get(),
@@ -574,7 +609,7 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
         unsigned long long countInt = column_stats[col].countInt8 + column_stats[col].countInt16 +
                                       column_stats[col].countInt32 + column_stats[col].countInt64;
 
-        if (column_stats[col].countNULL == num_records) {
+        if (column_stats[col].countNULL == num_sampled) {
           // Entire column is NULL; allocate the smallest amount of memory
           dtypes.emplace_back(cudf::type_id::INT8);
         } else if (column_stats[col].countString > 0L) {
@@ -661,14 +696,112 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
   return dtypes;
 }
 
-void reader::impl::decode_data(const std::vector<data_type> &column_types,
+std::unique_ptr<column> reader::impl::make_output_column(data_type type,
+                                                         size_t num_rows,
+                                                         column_buffer &buffer,
+                                                         rmm::mr::device_memory_resource *mr,
+                                                         cudaStream_t stream)
+{
+  if (type.id() == type_id::STRING && opts.quotechar != '\0' && opts.doublequote == true) {
+    // PANDAS' default behavior of enabling doublequote for two consecutive
+    // quotechars in quoted fields results in reduction to a single quotechar
+    // TODO: Would be much more efficient to perform this operation in-place
+    // during the conversion stage
+    const std::string quotechar(1, opts.quotechar);
+    const std::string dblquotechar(2, opts.quotechar);
+    std::unique_ptr<column> col = make_strings_column(buffer._strings, stream);
+    return cudf::strings::replace(col->view(), dblquotechar, quotechar, -1, mr);
+  }
+  return make_column(type, num_rows, buffer, stream, mr);
+}
+
+bool reader::impl::filter_rows(std::vector<data_type> const &column_types,
+                               rmm::device_vector<size_type> &row_indices,
+                               bool check_types,
+                               cudaStream_t stream)
+{
+  // Only decode the filtered columns, once each
+  std::vector<std::string> filter_names;
+  std::vector<data_type> filter_types;
+  thrust::host_vector<column_parse::flags> filter_flags(num_actual_cols, column_parse::disabled);
+  for (int col = 0, active_col = 0; col < num_actual_cols; ++col) {
+    if (!(h_column_flags[col] & column_parse::enabled)) { continue; }
+    auto const is_filtered =
+      std::any_of(args_.filters.begin(), args_.filters.end(), [&](column_filter const &filter) {
+        return filter.column_name == col_names[col];
+      });
+    if (is_filtered) {
+      filter_flags[col] = h_column_flags[col];
+      filter_names.push_back(col_names[col]);
+      filter_types.push_back(column_types[active_col]);
+    }
+    active_col++;
+  }
+
+  // The filtered columns' data is only needed until the rows are selected
+  std::vector<column_buffer> filter_buffers;
+  filter_buffers.reserve(filter_types.size());
+  for (auto const &type : filter_types) {
+    filter_buffers.emplace_back(type, num_records, true, stream);
+  }
+  if (!decode_data(
+        filter_types, filter_flags, filter_buffers, nullptr, num_records, check_types, stream)) {
+    return false;
+  }
+  std::vector<std::unique_ptr<column>> filter_data;
+  for (size_t i = 0; i < filter_types.size(); ++i) {
+    filter_data.emplace_back(make_output_column(
+      filter_types[i], num_records, filter_buffers[i], rmm::mr::get_default_resource(), stream));
+  }
+
+  table const filter_table(std::move(filter_data));
+  auto const mask = evaluate_filters(
+    filter_table.view(), filter_names, args_.filters, rmm::mr::get_default_resource(), stream);
+  row_indices = matching_rows(mask->view(), stream);
+  return true;
+}
+
+bool reader::impl::decode_rows(std::vector<data_type> const &column_types,
                                std::vector<column_buffer> &out_buffers,
+                               size_t &num_rows,
+                               bool check_types,
                                cudaStream_t stream)
 {
-  thrust::host_vector<void *> h_data(num_active_cols);
-  thrust::host_vector<bitmask_type *> h_valid(num_active_cols);
+  rmm::device_vector<size_type> row_indices;
+  if (!args_.filters.empty() && !filter_rows(column_types, row_indices, check_types, stream)) {
+    return false;
+  }
+  num_rows = args_.filters.empty() ? num_records : row_indices.size();
 
-  for (int i = 0; i < num_active_cols; ++i) {
+  // Alloc output; columns' data memory is still expected for empty dataframe
+  out_buffers.clear();
+  out_buffers.reserve(column_types.size());
+  for (auto const &type : column_types) {
+    out_buffers.emplace_back(type, num_rows, true, stream, mr_);
+  }
+  if (num_rows == 0) { return true; }
+
+  return decode_data(column_types,
+                     h_column_flags,
+                     out_buffers,
+                     args_.filters.empty() ? nullptr : row_indices.data().get(),
+                     num_rows,
+                     check_types,
+                     stream);
+}
+
+bool reader::impl::decode_data(std::vector<data_type> const &column_types,
+                               thrust::host_vector<column_parse::flags> const &column_flags,
+                               std::vector<column_buffer> &out_buffers,
+                               size_type const *row_indices,
+                               size_t num_rows,
+                               bool check_types,
+                               cudaStream_t stream)
+{
+  thrust::host_vector<void *> h_data(out_buffers.size());
+  thrust::host_vector<bitmask_type *> h_valid(out_buffers.size());
+
+  for (size_t i = 0; i < out_buffers.size(); ++i) {
     h_data[i]  = out_buffers[i].data();
     h_valid[i] = out_buffers[i].null_mask();
   }
@@ -676,21 +809,37 @@ void reader::impl::decode_data(const std::vector<data_type> &column_types,
   rmm::device_vector<data_type> d_dtypes(column_types);
   rmm::device_vector<void *> d_data          = h_data;
   rmm::device_vector<bitmask_type *> d_valid = h_valid;
-  d_column_flags                             = h_column_flags;
+  d_column_flags                             = column_flags;
 
+  hostdevice_vector<uint32_t> type_mismatch(1);
+  uint32_t *d_type_mismatch = nullptr;
+  if (check_types) {
+    CUDA_TRY(cudaMemsetAsync(type_mismatch.device_ptr(), 0, type_mismatch.memory_size(), stream));
+    d_type_mismatch = type_mismatch.device_ptr();
+  }
   CUDA_TRY(cudf::io::csv::gpu::DecodeRowColumnData(data_.data().get(),
                                                    row_offsets.data().get(),
-                                                   num_records,
+                                                   row_indices,
+                                                   num_rows,
                                                    num_actual_cols,
                                                    opts,
                                                    d_column_flags.data().get(),
                                                    d_dtypes.data().get(),
                                                    d_data.data().get(),
                                                    d_valid.data().get(),
+                                                   d_type_mismatch,
                                                    stream));
+  if (check_types) {
+    CUDA_TRY(cudaMemcpyAsync(type_mismatch.host_ptr(),
+                             type_mismatch.device_ptr(),
+                             type_mismatch.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
   CUDA_TRY(cudaStreamSynchronize(stream));
 
-  for (int i = 0; i < num_active_cols; ++i) { out_buffers[i].null_count() = UNKNOWN_NULL_COUNT; }
+  for (auto &buffer : out_buffers) { buffer.null_count() = UNKNOWN_NULL_COUNT; }
+  return !check_types || type_mismatch[0] == 0;
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
@@ -727,6 +876,11 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   CUDF_EXPECTS(opts.decimal != opts.delimiter, "Decimal point cannot be the same as the delimiter");
   CUDF_EXPECTS(opts.thousands != opts.delimiter,
                "Thousands separator cannot be the same as the delimiter");
+  for (const auto &filter : args_.filters) {
+    CUDF_EXPECTS(
+      !filter.values.empty() && (filter.op == filter_op::IN || filter.values.size() == 1),
+      "Invalid number of filter values");
+  }
 
   compression_type_ = infer_compression_type(
     args_.compression, filepath, {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
@@ -776,13 +930,25 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read_all(cudaStream_t stream)
 {
-  return _impl->read(0, 0, 0, 0, -1, stream);
+  return _impl->read(0, 0, 0, 0, -1, false, stream);
 }
 
 // Forward to implementation
 table_with_metadata reader::read_byte_range(size_t offset, size_t size, cudaStream_t stream)
 {
-  return _impl->read(offset, size, 0, 0, -1, stream);
+  return _impl->read(offset, size, 0, 0, -1, false, stream);
+}
+
+// Forward to implementation
+table_with_metadata reader::read_chunk(size_t offset,
+                                       size_t size,
+                                       size_type skip_rows,
+                                       size_t &next_offset,
+                                       cudaStream_t stream)
+{
+  auto result = _impl->read(offset, size, skip_rows, 0, -1, true, stream);
+  next_offset = _impl->next_chunk_offset();
+  return result;
 }
 
 // Forward to implementation
@@ -794,7 +960,7 @@ table_with_metadata reader::read_rows(size_type num_skip_header,
   CUDF_EXPECTS(num_rows == -1 || num_skip_footer == 0,
                "Cannot use both `num_rows` and `num_skip_footer`");
 
-  return _impl->read(0, 0, num_skip_header, num_skip_footer, num_rows, stream);
+  return _impl->read(0, 0, num_skip_header, num_skip_footer, num_rows, false, stream);
 }
 
 }  // namespace csv
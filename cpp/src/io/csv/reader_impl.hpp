@@ -88,7 +88,8 @@ class reader::impl {
    * @param skip_rows Number of rows to skip from the start
    * @param skip_rows_end Number of rows to skip from the end
    * @param num_rows Number of rows to read
-   * @param metadata Optional location to return table metadata
+   * @param chunked Whether the range starts at a row and the schema of the first such read is
+   * reused by the subsequent ones
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
@@ -98,8 +99,15 @@ class reader::impl {
                            int skip_rows,
                            int skip_end_rows,
                            int num_rows,
+                           bool chunked,
                            cudaStream_t stream);
 
+  /**
+   * @brief Returns the byte offset of the first row after the last chunked read, or zero if it
+   * included the last row.
+   */
+  size_t next_chunk_offset() const { return next_chunk_offset_; }
+
  private:
   /**
    * @brief Finds row positions within the specified input data.
@@ -127,33 +135,83 @@ class reader::impl {
                           cudaStream_t stream);
 
   /**
-   * @brief Find the start position of the first data row
+   * @brief Returns a detected or parsed list of column dtypes.
    *
-   * @param h_data Uncompressed input data in host memory
-   * @param h_size Number of bytes of uncompressed input data
+   * @param row_stride Distance between the rows sampled to detect the dtypes
+   * @param stream CUDA stream used for device memory operations and kernel launches.
    *
-   * @return Byte position of the first row
+   * @return `std::vector<data_type>` List of column types
    */
-  size_t find_first_row_start(const char *h_data, size_t h_size);
+  std::vector<data_type> gather_column_types(size_t row_stride, cudaStream_t stream);
 
   /**
-   * @brief Returns a detected or parsed list of column dtypes.
+   * @brief Creates an output column from the decoded data of a column.
    *
+   * @param type Column type
+   * @param num_rows Number of decoded rows
+   * @param buffer Column's device buffers
+   * @param mr Device memory resource used to allocate the column's device memory
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
-   * @return `std::vector<data_type>` List of column types
+   * @return `std::unique_ptr<column>` The column
    */
-  std::vector<data_type> gather_column_types(cudaStream_t stream);
+  std::unique_ptr<column> make_output_column(data_type type,
+                                             size_t num_rows,
+                                             column_buffer &buffer,
+                                             rmm::mr::device_memory_resource *mr,
+                                             cudaStream_t stream);
 
   /**
-   * @brief Converts the row-column data and outputs to columns.
+   * @brief Decodes the filtered columns and selects the rows that match all the filters.
+   *
+   * @param column_types Column types
+   * @param row_indices Output indices of the matching rows
+   * @param check_types Whether to check that the filtered columns' values fit the detected types
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return `false` if a value does not fit the detected type of its column, `true` otherwise
+   */
+  bool filter_rows(std::vector<data_type> const &column_types,
+                   rmm::device_vector<size_type> &row_indices,
+                   bool check_types,
+                   cudaStream_t stream);
+
+  /**
+   * @brief Allocates the output buffers and decodes the rows that match the filters into them.
    *
    * @param column_types Column types
    * @param out_buffers Output columns' device buffers
+   * @param num_rows Output number of decoded rows
+   * @param check_types Whether to check that all decoded values fit the detected column types
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return `false` if a value does not fit the detected type of its column, `true` otherwise
    */
-  void decode_data(std::vector<data_type> const &column_types,
+  bool decode_rows(std::vector<data_type> const &column_types,
                    std::vector<column_buffer> &out_buffers,
+                   size_t &num_rows,
+                   bool check_types,
+                   cudaStream_t stream);
+
+  /**
+   * @brief Converts the row-column data and outputs to columns.
+   *
+   * @param column_types Types of the decoded columns
+   * @param column_flags Per-column parsing flags; only the enabled columns are decoded
+   * @param out_buffers Output columns' device buffers
+   * @param row_indices Input row of each output row; `nullptr` to decode all rows in order
+   * @param num_rows Number of rows to decode
+   * @param check_types Whether to check that all values fit the detected column types
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return `false` if a value does not fit the detected type of its column, `true` otherwise
+   */
+  bool decode_data(std::vector<data_type> const &column_types,
+                   thrust::host_vector<column_parse::flags> const &column_flags,
+                   std::vector<column_buffer> &out_buffers,
+                   size_type const *row_indices,
+                   size_t num_rows,
+                   bool check_types,
                    cudaStream_t stream);
 
  private:
@@ -180,6 +238,12 @@ class reader::impl {
   // Intermediate data
   std::vector<std::string> col_names;
   std::vector<char> header;
+  size_t next_row_pos = 0;  // Position of the first row after the gathered rows
+
+  // Chunked read state; the schema is determined by the first chunk
+  bool has_chunk_schema_ = false;
+  std::vector<data_type> chunk_column_types_;
+  size_t next_chunk_offset_ = 0;
 };
 
 }  // namespace csv
@@ -35,9 +35,11 @@
 #include <cudf/strings/replace.hpp>
 
 #include <strings/utilities.cuh>
+#include <io/utilities/pinned_host_pool.hpp>
 
 #include <algorithm>
 #include <cstring>
+#include <future>
 #include <iterator>
 #include <sstream>
 #include <type_traits>
@@ -66,6 +68,11 @@ namespace {  // anonym.
 
 using namespace cudf::strings;
 
+// owned CUDA stream, destroyed with the owner:
+//
+using owned_stream =
+  std::unique_ptr<std::remove_pointer_t<cudaStream_t>, decltype(&cudaStreamDestroy)>;
+
 // predicate to determine if a given string_view contains special characters:
 //{"\"", "\n", <delimiter>}
 //
@@ -420,22 +427,13 @@ void writer::impl::write_chunked(strings_column_view const& str_column_view,
   } else {
     // no device write possible;
     //
-    // copy the bytes to host, too:
-    //
-    thrust::host_vector<char> h_bytes(total_num_bytes);
-    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                             ptr_all_bytes,
-                             total_num_bytes * sizeof(char),
-                             cudaMemcpyDeviceToHost,
-                             stream));
-
-    CUDA_TRY(cudaStreamSynchronize(stream));
-
-    // host algorithm call, where the underlying call
-    // is also host_write taking a host buffer;
+    // stage the bytes through pinned host blocks, writing
+    // each block while the next ones are being copied;
     //
-    char const* ptr_h_bytes = h_bytes.data();
-    out_sink_->host_write(ptr_h_bytes, total_num_bytes);
+    stage_device_to_host(
+      ptr_all_bytes, total_num_bytes * sizeof(char), stream, [&](uint8_t const* data, size_t size) {
+        out_sink_->host_write(data, size);
+      });
     out_sink_->host_write(
       options_.line_terminator().data(),
       options_.line_terminator().size());  // needs newline at the end, to separate from next chunk
@@ -495,6 +493,18 @@ void writer::impl::write(table_view const& table,
       vector_views = cudf::split(table, splits);
     }
 
+    // with several chunks, each one is written out on a separate thread and
+    // stream while the next one is converted:
+    //
+    owned_stream io_stream{nullptr, cudaStreamDestroy};
+    if (vector_views.size() > 1) {
+      cudaStream_t write_stream;
+      CUDA_TRY(cudaStreamCreateWithFlags(&write_stream, cudaStreamNonBlocking));
+      io_stream.reset(write_stream);
+    }
+    std::unique_ptr<column> pending_chunk;
+    std::future<void> pending_write;
+
     // convert each chunk to CSV:
     //
     column_to_strings_fn converter{options_, mr_};
@@ -522,10 +532,28 @@ void writer::impl::write(table_view const& table,
       auto str_concat_col =
         cudf::strings::concatenate(str_table_view, delimiter_str, options_.na_rep(), mr_);
 
-      strings_column_view strings_converted{std::move(*str_concat_col)};
-
-      write_chunked(strings_converted, metadata, stream);
+      if (io_stream) {
+        // the conversion runs on the default stream, which the write stream
+        // does not synchronize with; the previous chunk must be written out
+        // before its strings are released:
+        //
+        CUDA_TRY(cudaStreamSynchronize(0));
+        if (pending_write.valid()) { pending_write.get(); }
+        pending_chunk = std::move(str_concat_col);
+        pending_write = std::async(std::launch::async,
+                                   [this,
+                                    strings_converted = strings_column_view{pending_chunk->view()},
+                                    metadata,
+                                    write_stream = io_stream.get()]() {
+                                     write_chunked(strings_converted, metadata, write_stream);
+                                   });
+      } else {
+        strings_column_view strings_converted{std::move(*str_concat_col)};
+
+        write_chunked(strings_converted, metadata, stream);
+      }
     }
+    if (pending_write.valid()) { pending_write.get(); }
   }
 
   // finalize (no-op, for now, but offers a hook for future extensions):
@@ -14,15 +14,27 @@
  * limitations under the License.
  */
 
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/io/readers.hpp>
 #include <cudf/io/writers.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include "orc/chunked_state.hpp"
 #include "parquet/chunked_state.hpp"
+#include "utilities/row_filter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <numeric>
+#include <thread>
 
 namespace cudf {
 namespace io {
@@ -59,6 +71,9 @@ std::unique_ptr<writer> make_writer(sink_info const& sink,
   if (sink.type == io_type::HOST_BUFFER) {
     return std::make_unique<writer>(cudf::io::data_sink::create(sink.buffer), options, mr);
   }
+  if (sink.type == io_type::DEVICE_BUFFER) {
+    return std::make_unique<writer>(cudf::io::data_sink::create(sink.device_buffer), options, mr);
+  }
   if (sink.type == io_type::VOID) {
     return std::make_unique<writer>(cudf::io::data_sink::create(), options, mr);
   }
@@ -68,10 +83,194 @@ std::unique_ptr<writer> make_writer(sink_info const& sink,
   CUDF_FAIL("Unsupported sink type");
 }
 
+/**
+ * @brief Reads the metadata of every file of a list of sources, on several host threads
+ *
+ * Footer reads are dominated by the source latency, so more threads than cores are used.
+ */
+std::vector<source_metadata> read_sources_metadata(
+  std::vector<source_info> const& sources, source_metadata (*read_metadata)(datasource*))
+{
+  std::vector<std::function<std::unique_ptr<datasource>()>> open_files;
+  for (auto const& source : sources) {
+    if (source.type == io_type::FILEPATH) {
+      for (auto const& path : source.filepaths) {
+        open_files.emplace_back([&path]() { return datasource::create(path); });
+      }
+    } else if (source.type == io_type::HOST_BUFFER) {
+      open_files.emplace_back(
+        [&source]() { return datasource::create(source.buffer.first, source.buffer.second); });
+    } else if (source.type == io_type::ARROW_RANDOM_ACCESS_FILE) {
+      open_files.emplace_back([&source]() { return datasource::create(source.file); });
+    } else if (source.type == io_type::USER_IMPLEMENTED) {
+      open_files.emplace_back([&source]() { return datasource::create(source.user_source); });
+    } else {
+      CUDF_FAIL("Unsupported source type");
+    }
+  }
+
+  std::vector<source_metadata> result(open_files.size());
+  std::atomic<size_t> next_file{0};
+  auto const read_files = [&]() {
+    for (auto i = next_file++; i < open_files.size(); i = next_file++) {
+      result[i] = read_metadata(open_files[i]().get());
+    }
+  };
+  size_t const max_threads = 4 * std::max(std::thread::hardware_concurrency(), 1u);
+  size_t const num_threads = std::min(max_threads, open_files.size());
+  std::vector<std::future<void>> tasks;
+  for (size_t t = 1; t < num_threads; ++t) {
+    tasks.emplace_back(std::async(std::launch::async, read_files));
+  }
+  read_files();
+  for (auto& task : tasks) { task.get(); }
+  return result;
+}
+
+/**
+ * @brief Returns the names of the columns referenced by filters, once each
+ */
+std::vector<std::string> filter_column_names(std::vector<column_filter> const& filters)
+{
+  std::vector<std::string> names;
+  for (auto const& filter : filters) {
+    if (std::find(names.begin(), names.end(), filter.column_name) == names.end()) {
+      names.push_back(filter.column_name);
+    }
+  }
+  return names;
+}
+
+/**
+ * @brief Reads the rows of a selection of row groups (Parquet) or stripes (ORC) that satisfy the
+ * filters, decoding the other columns only for the row groups that contain matching rows
+ *
+ * @param output_options Reader options of the returned columns, including the filters
+ * @param filter_options Reader options decoding only the filtered columns
+ * @param reuse_filter_columns Whether the filtered columns are decoded as in the returned
+ * columns, and are then not decoded twice
+ * @param group_list Indices of the row groups to read; empty for all row groups
+ * @param open_reader Creates a reader of the source with the given options and memory resource
+ * @param filter_groups Returns the index and number of rows of the row groups of a list that may
+ * contain matching rows
+ * @param read_groups Reads a non-empty list of row groups on a stream
+ * @param mr Device memory resource used to allocate the returned columns
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename reader_options, typename open_fn, typename filter_fn, typename read_fn>
+table_with_metadata read_late_materialized(reader_options const& output_options,
+                                           reader_options const& filter_options,
+                                           bool reuse_filter_columns,
+                                           std::vector<size_type> const& group_list,
+                                           open_fn open_reader,
+                                           filter_fn filter_groups,
+                                           read_fn read_groups,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  auto const temp_mr    = rmm::mr::get_default_resource();
+  auto filter_reader    = open_reader(filter_options, temp_mr);
+  auto const candidates = filter_groups(*filter_reader, group_list);
+  if (candidates.empty()) {
+    // The statistics rule out all the row groups; the regular read returns the empty columns
+    auto reader = open_reader(output_options, mr);
+    return group_list.empty() ? reader->read_all(stream)
+                              : read_groups(*reader, group_list, stream);
+  }
+
+  std::vector<size_type> candidate_list;
+  std::vector<size_type> candidate_rows;
+  for (auto const& group : candidates) {
+    candidate_list.push_back(group.first);
+    candidate_rows.push_back(group.second);
+  }
+  auto filtered   = read_groups(*filter_reader, candidate_list, stream);
+  auto const mask = detail::evaluate_filters(
+    filtered.tbl->view(), filtered.metadata.column_names, output_options.filters, temp_mr, stream);
+  auto const has_matches = detail::segments_with_matches(mask->view(), candidate_rows, stream);
+
+  std::vector<size_type> matching_list;
+  std::vector<column_view> matching_masks;
+  for (size_t i = 0, row = 0; i < candidates.size(); row += candidate_rows[i++]) {
+    if (!has_matches[i]) { continue; }
+    matching_list.push_back(candidate_list[i]);
+    auto const begin = static_cast<size_type>(row);
+    matching_masks.push_back(cudf::slice(mask->view(), {begin, begin + candidate_rows[i]})[0]);
+  }
+  if (matching_list.empty()) {
+    // Read the first row group through its all-false mask to return the empty columns
+    matching_list.push_back(candidate_list[0]);
+    matching_masks.push_back(cudf::slice(mask->view(), {0, candidate_rows[0]})[0]);
+  }
+  auto const matching_mask = cudf::concatenate(matching_masks, temp_mr);
+
+  // Only decode the other columns of the row groups that contain matching rows
+  auto rest_options = output_options;
+  rest_options.filters.clear();
+  if (reuse_filter_columns) {
+    auto const& filter_names = filter_options.columns;
+    rest_options.columns.erase(
+      std::remove_if(rest_options.columns.begin(),
+                     rest_options.columns.end(),
+                     [&](std::string const& name) {
+                       return std::find(filter_names.begin(), filter_names.end(), name) !=
+                              filter_names.end();
+                     }),
+      rest_options.columns.end());
+  }
+  table_with_metadata rest;
+  if (!reuse_filter_columns || !rest_options.columns.empty()) {
+    rest = read_groups(*open_reader(rest_options, temp_mr), matching_list, stream);
+  }
+  if (!reuse_filter_columns) {
+    return {cudf::detail::apply_boolean_mask(rest.tbl->view(), matching_mask->view(), mr, stream),
+            std::move(rest.metadata)};
+  }
+
+  // Return the columns in the order of the regular read, PANDAS index columns last
+  auto filter_columns =
+    cudf::detail::apply_boolean_mask(filtered.tbl->view(), mask->view(), mr, stream)->release();
+  std::vector<std::unique_ptr<column>> rest_columns;
+  if (rest.tbl) {
+    rest_columns =
+      cudf::detail::apply_boolean_mask(rest.tbl->view(), matching_mask->view(), mr, stream)
+        ->release();
+  }
+  table_with_metadata result;
+  result.metadata.user_data = rest.tbl ? rest.metadata.user_data : filtered.metadata.user_data;
+  std::vector<std::unique_ptr<column>> out_columns;
+  auto const take_column = [&](std::vector<std::unique_ptr<column>>& columns,
+                               std::vector<std::string> const& names,
+                               size_t index) {
+    if (index >= columns.size() || !columns[index]) { return false; }
+    out_columns.push_back(std::move(columns[index]));
+    result.metadata.column_names.push_back(names[index]);
+    return true;
+  };
+  auto const find_name = [](std::vector<std::string> const& names, std::string const& name) {
+    return static_cast<size_t>(std::find(names.begin(), names.end(), name) - names.begin());
+  };
+  for (auto const& name : output_options.columns) {
+    auto const& rest_names = rest.metadata.column_names;
+    if (!take_column(rest_columns, rest_names, find_name(rest_names, name))) {
+      take_column(filter_columns,
+                  filtered.metadata.column_names,
+                  find_name(filtered.metadata.column_names, name));
+    }
+  }
+  for (size_t i = 0; i < rest_columns.size(); ++i) {
+    take_column(rest_columns, rest.metadata.column_names, i);
+  }
+  result.tbl = std::make_unique<table>(std::move(out_columns));
+  return result;
+}
+
 }  // namespace
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_avro(read_avro_args const& args, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_avro(read_avro_args const& args,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
   namespace avro = cudf::io::detail::avro;
 
@@ -80,35 +279,42 @@ table_with_metadata read_avro(read_avro_args const& args, rmm::mr::device_memory
   auto reader = make_reader<avro::reader>(args.source, options, mr);
 
   if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
+    return reader->read_rows(args.skip_rows, args.num_rows, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory_resource* mr)
+table_with_metadata read_json(read_json_args const& args,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
   namespace json = cudf::io::detail::json;
 
   CUDF_FUNC_RANGE();
-  json::reader_options options{args.lines, args.compression, args.dtype, args.dayfirst};
+  json::reader_options options{args.lines,
+                               args.compression,
+                               args.dtype,
+                               args.dayfirst,
+                               args.infer_sample_rows,
+                               args.use_cols};
   auto reader = make_reader<json::reader>(args.source, options, mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
-    return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
+    return reader->read_byte_range(args.byte_range_offset, args.byte_range_size, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
-// Freeform API wraps the detail reader class API
-table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_resource* mr)
+namespace {
+/**
+ * @brief Translates the CSV read settings to the detail reader options
+ */
+detail::csv::reader_options make_csv_options(read_csv_args const& args)
 {
-  namespace csv = cudf::io::detail::csv;
-
-  CUDF_FUNC_RANGE();
-  csv::reader_options options{};
+  detail::csv::reader_options options{};
   options.compression        = args.compression;
   options.lineterminator     = args.lineterminator;
   options.delimiter          = args.delimiter;
@@ -124,6 +330,7 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   options.infer_date_indexes = args.infer_date_indexes;
   options.names              = args.names;
   options.dtype              = args.dtype;
+  options.infer_sample_rows  = args.infer_sample_rows;
   options.use_cols_indexes   = args.use_cols_indexes;
   options.use_cols_names     = args.use_cols_names;
   options.true_values.insert(
@@ -143,31 +350,114 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   options.quoting          = args.quoting;
   options.doublequote      = args.doublequote;
   options.timestamp_type   = args.timestamp_type;
-  auto reader              = make_reader<csv::reader>(args.source, options, mr);
+  options.filters          = args.filters;
+  return options;
+}
+
+}  // namespace
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_csv(read_csv_args const& args,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  auto reader = make_reader<csv::reader>(args.source, make_csv_options(args), mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
-    return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
+    return reader->read_byte_range(args.byte_range_offset, args.byte_range_size, stream);
   } else if (args.skiprows != -1 || args.skipfooter != -1 || args.nrows != -1) {
-    return reader->read_rows(args.skiprows, args.skipfooter, args.nrows);
+    return reader->read_rows(args.skiprows, args.skipfooter, args.nrows, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
+chunked_csv_reader::chunked_csv_reader(read_csv_args const& args,
+                                       size_t chunk_size,
+                                       rmm::mr::device_memory_resource* mr)
+  : _chunk_size(chunk_size), _skip_rows(std::max(args.skiprows, 0))
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.byte_range_offset == 0 && args.byte_range_size == 0,
+               "Byte ranges are not supported by the chunked reader");
+  CUDF_EXPECTS(args.nrows == -1 && args.skipfooter == -1,
+               "Row selection is not supported by the chunked reader");
+  _reader = make_reader<detail::csv::reader>(args.source, make_csv_options(args), mr);
+}
+
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+bool chunked_csv_reader::has_next() const { return _has_next; }
+
+table_with_metadata chunked_csv_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "No chunks left to read");
+  size_t next_offset = 0;
+  auto result        = _reader->read_chunk(_next_offset, _chunk_size, _skip_rows, next_offset);
+  // Rows are only skipped from the start of the dataset
+  _skip_rows   = 0;
+  _next_offset = next_offset;
+  _has_next    = next_offset != 0;
+  return result;
+}
+
 // Freeform API wraps the detail writer class API
-void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr)
+void write_csv(write_csv_args const& args,
+               rmm::mr::device_memory_resource* mr,
+               cudaStream_t stream)
 {
   using namespace cudf::io::detail;
 
   auto writer = make_writer<csv::writer>(args.sink(), args, mr);
 
-  writer->write_all(args.table(), args.metadata());
+  writer->write_all(args.table(), args.metadata(), stream);
+}
+
+void write_csv_parts(write_csv_args const& args,
+                     std::vector<sink_info> const& sinks,
+                     rmm::mr::device_memory_resource* mr)
+{
+  using namespace cudf::io::detail;
+
+  CUDF_EXPECTS(!sinks.empty(), "No sinks to write the parts to");
+
+  // Split the rows into one contiguous part per sink
+  auto const& table         = args.table();
+  size_type const part_rows = (table.num_rows() + sinks.size() - 1) / sinks.size();
+  std::vector<size_type> splits;
+  for (size_t i = 1; i < sinks.size(); ++i) {
+    splits.push_back(std::min<size_type>(i * part_rows, table.num_rows()));
+  }
+  auto const parts = cudf::split(table, splits);
+
+  // Each part is converted and written by its own writer, on a separate thread
+  std::vector<std::future<void>> tasks;
+  for (size_t i = 0; i < sinks.size(); ++i) {
+    tasks.emplace_back(std::async(std::launch::async, [&, i]() {
+      auto writer = make_writer<csv::writer>(sinks[i], args, mr);
+      writer->write_all(parts[i], args.metadata());
+    }));
+  }
+  for (auto& task : tasks) { task.get(); }
 }
 
 namespace detail_orc = cudf::io::detail::orc;
 
 // Freeform API wraps the detail reader class API
-table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_resource* mr)
+std::vector<source_metadata> read_orc_metadata(std::vector<source_info> const& sources)
+{
+  CUDF_FUNC_RANGE();
+  return read_sources_metadata(sources, detail_orc::read_metadata);
+}
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_orc(read_orc_args const& args,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   detail_orc::reader_options options{args.columns,
@@ -175,28 +465,103 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
                                      args.use_np_dtypes,
                                      args.timestamp_type,
                                      args.decimals_as_float,
-                                     args.forced_decimals_scale};
+                                     args.forced_decimals_scale,
+                                     args.filters,
+                                     args.strings_to_dictionary,
+                                     args.cache_metadata};
+  if (args.late_materialization && !args.filters.empty()) {
+    CUDF_EXPECTS(args.skip_rows == -1 && args.num_rows == -1,
+                 "Late materialization does not support row ranges");
+    auto stripes = args.stripe_list;
+    if (stripes.empty() && args.stripe != -1) {
+      stripes.resize(std::max(args.stripe_count, 1));
+      std::iota(stripes.begin(), stripes.end(), args.stripe);
+    }
+    auto filter_options                  = options;
+    filter_options.columns               = filter_column_names(args.filters);
+    filter_options.strings_to_dictionary = false;
+    return read_late_materialized(
+      options,
+      filter_options,
+      !args.columns.empty() && !args.strings_to_dictionary,
+      stripes,
+      [&](detail_orc::reader_options const& opts, rmm::mr::device_memory_resource* reader_mr) {
+        return make_reader<detail_orc::reader>(args.source, opts, reader_mr);
+      },
+      [](detail_orc::reader& reader, std::vector<size_type> const& list) {
+        return reader.filter_stripes(list);
+      },
+      [](detail_orc::reader& reader, std::vector<size_type> const& list, cudaStream_t s) {
+        return reader.read_stripes(list, s);
+      },
+      mr,
+      stream);
+  }
+
   auto reader = make_reader<detail_orc::reader>(args.source, options, mr);
 
   if (args.stripe_list.size() > 0) {
-    return reader->read_stripes(args.stripe_list);
+    return reader->read_stripes(args.stripe_list, stream);
   } else if (args.stripe != -1) {
-    return reader->read_stripe(args.stripe, std::max(args.stripe_count, 1));
+    return reader->read_stripe(args.stripe, std::max(args.stripe_count, 1), stream);
   } else if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
+    return reader->read_rows(args.skip_rows, args.num_rows, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
+chunked_orc_reader::chunked_orc_reader(read_orc_args const& args,
+                                       size_t chunk_read_limit,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.stripe == -1 && args.stripe_list.empty(),
+               "Stripe selection is not supported by the chunked reader");
+  CUDF_EXPECTS(!args.late_materialization,
+               "Late materialization is not supported by the chunked reader");
+  detail_orc::reader_options options{args.columns,
+                                     args.use_index,
+                                     args.use_np_dtypes,
+                                     args.timestamp_type,
+                                     args.decimals_as_float,
+                                     args.forced_decimals_scale,
+                                     args.filters,
+                                     args.strings_to_dictionary,
+                                     args.cache_metadata};
+  _reader = make_reader<detail_orc::reader>(args.source, options, mr);
+
+  _row_splits = _reader->compute_row_splits(chunk_read_limit, args.skip_rows, args.num_rows);
+  // Always return at least one table, so empty datasets still provide the column schema
+  if (_row_splits.empty()) { _row_splits.emplace_back(std::max(args.skip_rows, 0), -1); }
+}
+
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+bool chunked_orc_reader::has_next() const { return _next_split < _row_splits.size(); }
+
+table_with_metadata chunked_orc_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "No chunks left to read");
+  const auto& split = _row_splits[_next_split++];
+  return _reader->read_rows(split.first, split.second);
+}
+
 // Freeform API wraps the detail writer class API
-void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr)
+void write_orc(write_orc_args const& args,
+               rmm::mr::device_memory_resource* mr,
+               cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   detail_orc::writer_options options{args.compression, args.enable_statistics};
+  options.compression_level = args.compression_level;
+  options.stripe_size_bytes = args.stripe_size_bytes;
+  options.stripe_size_rows  = args.stripe_size_rows;
+  options.row_index_stride  = args.row_index_stride;
   auto writer = make_writer<detail_orc::writer>(args.sink, options, mr);
 
-  writer->write_all(args.table, args.metadata);
+  writer->write_all(args.table, args.metadata, stream);
 }
 
 /**
@@ -204,10 +569,15 @@ void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr)
  *
  **/
 std::shared_ptr<detail_orc::orc_chunked_state> write_orc_chunked_begin(
-  write_orc_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+  write_orc_chunked_args const& args, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   detail_orc::writer_options options{args.compression, args.enable_statistics};
+  options.compression_level = args.compression_level;
+  options.stripe_size_bytes = args.stripe_size_bytes;
+  options.stripe_size_rows  = args.stripe_size_rows;
+  options.row_index_stride  = args.row_index_stride;
+  options.buffer_tables     = args.buffer_tables;
 
   auto state = std::make_shared<detail_orc::orc_chunked_state>();
   state->wp  = make_writer<detail_orc::writer>(args.sink, options, mr);
@@ -218,7 +588,7 @@ std::shared_ptr<detail_orc::orc_chunked_state> write_orc_chunked_begin(
     state->user_metadata_with_nullability = *args.metadata;
     state->user_metadata                  = &state->user_metadata_with_nullability;
   }
-  state->stream = 0;
+  state->stream = stream;
   state->wp->write_chunked_begin(*state);
   return state;
 }
@@ -248,35 +618,155 @@ void write_orc_chunked_end(std::shared_ptr<detail_orc::orc_chunked_state>& state
 using namespace cudf::io::detail::parquet;
 namespace detail_parquet = cudf::io::detail::parquet;
 
+namespace {
+std::unique_ptr<detail_parquet::reader> make_parquet_reader(
+  source_info const& source,
+  detail_parquet::reader_options const& options,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (source.type == io_type::FILEPATH && source.filepaths.size() > 1) {
+    return std::make_unique<detail_parquet::reader>(source.filepaths, options, mr);
+  }
+  return make_reader<detail_parquet::reader>(source, options, mr);
+}
+}  // namespace
+
 // Freeform API wraps the detail reader class API
-table_with_metadata read_parquet(read_parquet_args const& args, rmm::mr::device_memory_resource* mr)
+std::vector<source_metadata> read_parquet_metadata(std::vector<source_info> const& sources)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::reader_options options{
-    args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
-  auto reader = make_reader<detail_parquet::reader>(args.source, options, mr);
+  return read_sources_metadata(sources, detail_parquet::read_metadata);
+}
+
+size_t estimate_read_parquet_memory(read_parquet_args const& args)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filters,
+                                         args.max_read_gap,
+                                         args.strings_to_dictionary,
+                                         args.decimals_as_float};
+  auto reader = make_parquet_reader(args.source, options, rmm::mr::get_default_resource());
+  return reader->estimate_read_memory(args.row_group_list,
+                                      args.row_group,
+                                      std::max(args.row_group_count, 1),
+                                      args.skip_rows,
+                                      args.num_rows);
+}
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_parquet(read_parquet_args const& args,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filters,
+                                         args.max_read_gap,
+                                         args.strings_to_dictionary,
+                                         args.decimals_as_float};
+  if (args.late_materialization && !args.filters.empty()) {
+    CUDF_EXPECTS(args.skip_rows == -1 && args.num_rows == -1,
+                 "Late materialization does not support row ranges");
+    auto row_groups = args.row_group_list;
+    if (row_groups.empty() && args.row_group != -1) {
+      row_groups.resize(std::max(args.row_group_count, 1));
+      std::iota(row_groups.begin(), row_groups.end(), args.row_group);
+    }
+    auto filter_options                   = options;
+    filter_options.columns                = filter_column_names(args.filters);
+    filter_options.use_pandas_metadata    = false;
+    filter_options.strings_to_categorical = false;
+    filter_options.strings_to_dictionary  = false;
+    return read_late_materialized(
+      options,
+      filter_options,
+      !args.columns.empty() && !args.strings_to_categorical && !args.strings_to_dictionary,
+      row_groups,
+      [&](detail_parquet::reader_options const& opts, rmm::mr::device_memory_resource* reader_mr) {
+        return make_parquet_reader(args.source, opts, reader_mr);
+      },
+      [](detail_parquet::reader& reader, std::vector<size_type> const& list) {
+        return reader.filter_row_groups(list);
+      },
+      [](detail_parquet::reader& reader, std::vector<size_type> const& list, cudaStream_t s) {
+        return reader.read_row_groups(list, s);
+      },
+      mr,
+      stream);
+  }
+
+  auto reader = make_parquet_reader(args.source, options, mr);
 
   if (args.row_group_list.size() > 0) {
-    return reader->read_row_groups(args.row_group_list);
+    return reader->read_row_groups(args.row_group_list, stream);
   } else if (args.row_group != -1) {
-    return reader->read_row_group(args.row_group, std::max(args.row_group_count, 1));
+    return reader->read_row_group(args.row_group, std::max(args.row_group_count, 1), stream);
   } else if (args.skip_rows != -1 || args.num_rows != -1) {
-    return reader->read_rows(args.skip_rows, args.num_rows);
+    return reader->read_rows(args.skip_rows, args.num_rows, stream);
   } else {
-    return reader->read_all();
+    return reader->read_all(stream);
   }
 }
 
+chunked_parquet_reader::chunked_parquet_reader(read_parquet_args const& args,
+                                               size_t chunk_read_limit,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.row_group == -1 && args.row_group_list.empty(),
+               "Row group selection is not supported by the chunked reader");
+  CUDF_EXPECTS(!args.late_materialization,
+               "Late materialization is not supported by the chunked reader");
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filters,
+                                         args.max_read_gap,
+                                         args.strings_to_dictionary,
+                                         args.decimals_as_float};
+  _reader = make_parquet_reader(args.source, options, mr);
+
+  _row_splits = _reader->compute_row_splits(chunk_read_limit, args.skip_rows, args.num_rows);
+  // Always return at least one table, so empty datasets still provide the column schema
+  if (_row_splits.empty()) { _row_splits.emplace_back(std::max(args.skip_rows, 0), -1); }
+}
+
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+bool chunked_parquet_reader::has_next() const { return _next_split < _row_splits.size(); }
+
+table_with_metadata chunked_parquet_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "No chunks left to read");
+  const auto& split = _row_splits[_next_split++];
+  return _reader->read_rows(split.first, split.second);
+}
+
 // Freeform API wraps the detail writer class API
 std::unique_ptr<std::vector<uint8_t>> write_parquet(write_parquet_args const& args,
-                                                    rmm::mr::device_memory_resource* mr)
+                                                    rmm::mr::device_memory_resource* mr,
+                                                    cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   detail_parquet::writer_options options{args.compression, args.stats_level};
+  options.compression_level        = args.compression_level;
+  options.column_dictionary_policy = args.column_dictionary_policy;
+  options.use_delta_encoding       = args.use_delta_encoding;
+  options.write_bloom_filters      = args.write_bloom_filters;
+  options.max_batch_size           = args.max_batch_size;
   auto writer = make_writer<detail_parquet::writer>(args.sink, options, mr);
 
   return writer->write_all(
-    args.table, args.metadata, args.return_filemetadata, args.metadata_out_file_path);
+    args.table, args.metadata, args.return_filemetadata, args.metadata_out_file_path, stream);
 }
 
 /**
@@ -295,10 +785,17 @@ std::unique_ptr<std::vector<uint8_t>> merge_rowgroup_metadata(
  *
  **/
 std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(
-  write_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+  write_parquet_chunked_args const& args,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   detail_parquet::writer_options options{args.compression, args.stats_level};
+  options.compression_level        = args.compression_level;
+  options.column_dictionary_policy = args.column_dictionary_policy;
+  options.use_delta_encoding       = args.use_delta_encoding;
+  options.write_bloom_filters      = args.write_bloom_filters;
+  options.max_batch_size           = args.max_batch_size;
 
   auto state = std::make_shared<pq_chunked_state>();
   state->wp  = make_writer<detail_parquet::writer>(args.sink, options, mr);
@@ -309,7 +806,7 @@ std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(
     state->user_metadata_with_nullability = *args.metadata;
     state->user_metadata                  = &state->user_metadata_with_nullability;
   }
-  state->stream = 0;
+  state->stream = stream;
   state->wp->write_chunked_begin(*state);
   return state;
 }
@@ -418,6 +418,190 @@ __device__ __inline__ bool is_like_float(
   return true;
 }
 
+/**
+ * @brief Classes of field values found by the data type detection
+ **/
+enum class field_class : uint8_t { null, boolean, integer, floating_point, datetime, string };
+
+/**
+ * @brief Classifies the value of a field for data type detection.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] opts A set of parsing options
+ * @param[in] field_start The start of the field
+ * @param[in] field_end The end of the field (position of the delimiter or terminator)
+ *
+ * @return The class of the field value
+ **/
+__device__ field_class classify_field(const char *data,
+                                      ParseOptions const &opts,
+                                      long field_start,
+                                      long field_end)
+{
+  long field_data_last = field_end - 1;
+  trim_field_start_end(data, &field_start, &field_data_last);
+  const int field_len = field_data_last - field_start + 1;
+
+  // Checking if the field is empty
+  if (field_start > field_data_last ||
+      serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
+    return field_class::null;
+  }
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
+    return field_class::string;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
+     (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
+      data[field_start + 2] == 'x'));
+  for (long pos = field_start; pos <= field_data_last; pos++) {
+    if (is_digit(data[pos], maybe_hex)) {
+      digit_count++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types
+    switch (data[pos]) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
+        break;
+      default: other_count++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  int int_req_number_cnt = field_len;
+  // Off by one if they start with a minus sign
+  if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
+      serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
+    return field_class::boolean;
+  } else if (digit_count == int_req_number_cnt) {
+    return field_class::integer;
+  } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
+    return field_class::floating_point;
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    return field_class::string;
+  }
+  // A date field can have either one or two '-' or '\'; A legal combination will only have one
+  // of them To simplify the process of auto column detection, we are not covering all the
+  // date-time formation permutations
+  if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+      (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+    return (colon_count <= 2) ? field_class::datetime : field_class::string;
+  }
+  // Default field type is string
+  return field_class::string;
+}
+
+/**
+ * @brief Returns whether the detected data type of a column remains the same if a field value of
+ * the given class is added to the column.
+ *
+ * Follows the selection of the data type from the column information in the reader.
+ *
+ * @param[in] value The class of the field value
+ * @param[in] dtype The data type detected from the other values of the column
+ *
+ * @return `true` if the value fits the data type, `false` otherwise
+ **/
+__device__ __inline__ bool is_detected_type(field_class value, data_type dtype)
+{
+  switch (dtype.id()) {
+    case STRING: return true;
+    // Only detected for columns of nulls
+    case INT8: return value == field_class::null;
+    // Integer columns with nulls are detected as floating point
+    case INT64: return value == field_class::integer || value == field_class::boolean;
+    case FLOAT64: return value != field_class::string && value != field_class::datetime;
+    case BOOL8: return value == field_class::boolean || value == field_class::null;
+    // Timestamps
+    default: return value != field_class::string;
+  }
+}
+
+/**
+ * @brief Finds the start of the next value in a JSON object whose value is not an object.
+ *
+ * Nested objects are flattened: the reader finds their values in order, as the values of the
+ * columns that follow, so the search continues into an object value.
+ *
+ * @param[in] data Pointer to the device buffer containing the data to process
+ * @param[in] opts Parsing options (e.g. delimiter and quotation character)
+ * @param[in] start Offset of the first character in the range
+ * @param[in] stop Offset of the first character after the range
+ *
+ * @return long Position of the first character after the colon that precedes the value
+ **/
+__device__ long seek_leaf_value_start(const char *data,
+                                      const ParseOptions opts,
+                                      long start,
+                                      long stop)
+{
+  while (true) {
+    start    = seek_field_name_end(data, opts, start, stop);
+    long pos = start;
+    while (pos < stop && is_whitespace(data[pos])) { pos++; }
+    if (pos >= stop || data[pos] != '{') { return start; }
+    start = pos + 1;
+  }
+}
+
+/**
+ * @brief Finds the end of a field value, including any nested objects and arrays.
+ *
+ * @param[in] data Pointer to the device buffer containing the data to process
+ * @param[in] opts Parsing options (e.g. delimiter and quotation character)
+ * @param[in] start Offset of the first character of the value
+ * @param[in] stop Offset of the first character after the range
+ *
+ * @return long Position of the delimiter after the value, or of the bracket that closes the
+ * enclosing object or array
+ **/
+__device__ long seek_field_value_end(const char *data,
+                                     const ParseOptions opts,
+                                     long start,
+                                     long stop)
+{
+  bool quotation = false;
+  int depth      = 0;
+  for (auto pos = start; pos < stop; ++pos) {
+    // Ignore escaped quotes
+    if (data[pos] == opts.quotechar && data[pos - 1] != '\\') {
+      quotation = !quotation;
+    } else if (!quotation) {
+      if (data[pos] == '{' || data[pos] == '[') {
+        depth++;
+      } else if (data[pos] == '}' || data[pos] == ']') {
+        if (depth == 0) { return pos; }
+        depth--;
+      } else if (depth == 0 && data[pos] == opts.delimiter) {
+        return pos;
+      }
+    }
+  }
+  return stop;
+}
+
 /**
  * @brief CUDA kernel that parses and converts plain text data into cuDF column data.
  *
@@ -430,9 +614,13 @@ __device__ __inline__ bool is_like_float(
  * @param[in] dtypes The data type of each column
  * @param[in] opts A set of parsing options
  * @param[out] output_columns The output column data
- * @param[in] num_columns The number of columns
+ * @param[in] num_columns The number of columns to scan
+ * @param[in] column_map Output column of each scanned column, negative to skip the column;
+ * `nullptr` if all columns are read
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns
+ * @param[out] type_mismatch Set if a field does not fit the data type detected for its column;
+ * checks are skipped if null
  *
  * @return void
  **/
@@ -444,8 +632,10 @@ __global__ void convert_json_to_columns_kernel(const char *data,
                                                ParseOptions opts,
                                                void *const *output_columns,
                                                int num_columns,
+                                               const cudf::size_type *column_map,
                                                bitmask_type *const *valid_fields,
-                                               cudf::size_type *num_valid_fields)
+                                               cudf::size_type *num_valid_fields,
+                                               uint32_t *type_mismatch)
 {
   const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
   if (rec_id >= num_records) return;
@@ -457,10 +647,21 @@ __global__ void convert_json_to_columns_kernel(const char *data,
   limit_range_to_brackets(data, start, stop);
   const bool is_object = (data[start - 1] == '{');
 
-  for (int col = 0; col < num_columns && start < stop; col++) {
-    if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
-    // field_end is at the next delimiter/newline
-    const long field_end = cudf::io::gpu::seek_field_end(data, opts, start, stop);
+  for (int input_col = 0; input_col < num_columns && start < stop; input_col++) {
+    if (is_object) { start = seek_leaf_value_start(data, opts, start, stop); }
+    // field_end is at the next delimiter, or at the end of the enclosing object
+    const long field_end = seek_field_value_end(data, opts, start, stop);
+    // Fields of the columns that are not read are skipped without parsing
+    const auto col = (column_map != nullptr) ? column_map[input_col] : input_col;
+    if (col < 0) {
+      start = field_end + 1;
+      continue;
+    }
+    // Data types detected from a sample of the records are checked against all values
+    if (type_mismatch != nullptr && dtypes[col].id() != STRING &&
+        !is_detected_type(classify_field(data, opts, start, field_end), dtypes[col])) {
+      *type_mismatch = 1;
+    }
     long field_data_last = field_end - 1;
     // Modify start & end to ignore whitespace and quotechars
     trim_field_start_end(data, &start, &field_data_last, opts.quotechar);
@@ -504,14 +705,17 @@ __global__ void convert_json_to_columns_kernel(const char *data,
  * column types within.
  *
  * Data is processed in one row/record at a time, so the number of total
- * threads (tid) is equal to the number of rows.
+ * threads (tid) is equal to the number of sampled rows.
  *
  * @param[in] data Input data buffer
  * @param[in] data_size Size of the data buffer, in bytes
  * @param[in] opts A set of parsing options
- * @param[in] num_columns The number of columns of input data
+ * @param[in] num_columns The number of columns of input data to scan
+ * @param[in] column_map Output column of each scanned column, negative to skip the column;
+ * `nullptr` if all columns are read
  * @param[in] rec_starts The start the input data of interest
  * @param[in] num_records The number of lines/rows of input data
+ * @param[in] row_stride The distance between sampled rows
  * @param[out] column_infos The count for each column data type
  *
  * @returns void
@@ -520,11 +724,13 @@ __global__ void detect_json_data_types(const char *data,
                                        size_t data_size,
                                        const ParseOptions opts,
                                        int num_columns,
+                                       const cudf::size_type *column_map,
                                        const uint64_t *rec_starts,
                                        cudf::size_type num_records,
+                                       cudf::size_type row_stride,
                                        ColumnInfo *column_infos)
 {
-  long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  const long rec_id = (threadIdx.x + (blockDim.x * blockIdx.x)) * static_cast<long>(row_stride);
   if (rec_id >= num_records) return;
 
   long start = rec_starts[rec_id];
@@ -534,93 +740,24 @@ __global__ void detect_json_data_types(const char *data,
   limit_range_to_brackets(data, start, stop);
   const bool is_object = (data[start - 1] == '{');
 
-  for (int col = 0; col < num_columns; col++) {
-    if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
-    auto field_start     = start;
-    const long field_end = cudf::io::gpu::seek_field_end(data, opts, field_start, stop);
-    long field_data_last = field_end - 1;
-    trim_field_start_end(data, &field_start, &field_data_last);
-    const int field_len = field_data_last - field_start + 1;
-    // Advance the start offset
-    start = field_end + 1;
-
-    // Checking if the field is empty
-    if (field_start > field_data_last ||
-        serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].null_count, 1);
+  for (int input_col = 0; input_col < num_columns; input_col++) {
+    if (is_object) { start = seek_leaf_value_start(data, opts, start, stop); }
+    const long field_end = seek_field_value_end(data, opts, start, stop);
+    const auto col       = (column_map != nullptr) ? column_map[input_col] : input_col;
+    if (col < 0) {
+      start = field_end + 1;
       continue;
     }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
-      atomicAdd(&column_infos[col].string_count, 1);
-      continue;
-    }
-
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
-       (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
-        data[field_start + 2] == 'x'));
-    for (long pos = field_start; pos <= field_data_last; pos++) {
-      if (is_digit(data[pos], maybe_hex)) {
-        digit_count++;
-        continue;
-      }
-      // Looking for unique characters that will help identify column types
-      switch (data[pos]) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
-          break;
-        default: other_count++; break;
-      }
-    }
-
-    // Integers have to have the length of the string
-    int int_req_number_cnt = field_len;
-    // Off by one if they start with a minus sign
-    if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
-        serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      atomicAdd(&column_infos[col].int_count, 1);
-    } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
-      atomicAdd(&column_infos[col].float_count, 1);
-    }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
-      atomicAdd(&column_infos[col].string_count, 1);
-    } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one
-      // of them To simplify the process of auto column detection, we are not covering all the
-      // date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[col].datetime_count, 1);
-        } else {
-          atomicAdd(&column_infos[col].string_count, 1);
-        }
-      } else {
-        // Default field type is string
-        atomicAdd(&column_infos[col].string_count, 1);
-      }
+    switch (classify_field(data, opts, start, field_end)) {
+      case field_class::null: atomicAdd(&column_infos[col].null_count, 1); break;
+      case field_class::boolean: atomicAdd(&column_infos[col].bool_count, 1); break;
+      case field_class::integer: atomicAdd(&column_infos[col].int_count, 1); break;
+      case field_class::floating_point: atomicAdd(&column_infos[col].float_count, 1); break;
+      case field_class::datetime: atomicAdd(&column_infos[col].datetime_count, 1); break;
+      default: atomicAdd(&column_infos[col].string_count, 1); break;
     }
+    // Advance the start offset
+    start = field_end + 1;
   }
 }
 
@@ -635,10 +772,12 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
                              void *const *output_columns,
                              cudf::size_type num_records,
                              cudf::size_type num_columns,
+                             const cudf::size_type *column_map,
                              const uint64_t *rec_starts,
                              bitmask_type *const *valid_fields,
                              cudf::size_type *num_valid_fields,
                              ParseOptions const &opts,
+                             uint32_t *type_mismatch,
                              cudaStream_t stream)
 {
   int block_size;
@@ -657,8 +796,10 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
     opts,
     output_columns,
     num_columns,
+    column_map,
     valid_fields,
-    num_valid_fields);
+    num_valid_fields,
+    type_mismatch);
 
   CUDA_TRY(cudaGetLastError());
 }
@@ -672,19 +813,29 @@ void detect_data_types(ColumnInfo *column_infos,
                        size_t data_size,
                        const ParseOptions &options,
                        int num_columns,
+                       const cudf::size_type *column_map,
                        const uint64_t *rec_starts,
                        cudf::size_type num_records,
+                       cudf::size_type row_stride,
                        cudaStream_t stream)
 {
   int block_size;
   int min_grid_size;
   CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, detect_json_data_types));
 
-  // Calculate actual block count to use based on records count
-  const int grid_size = (num_records + block_size - 1) / block_size;
-
-  detect_json_data_types<<<grid_size, block_size, 0, stream>>>(
-    data, data_size, options, num_columns, rec_starts, num_records, column_infos);
+  // Calculate actual block count to use based on sampled records count
+  const cudf::size_type num_sampled = (num_records + row_stride - 1) / row_stride;
+  const int grid_size               = (num_sampled + block_size - 1) / block_size;
+
+  detect_json_data_types<<<grid_size, block_size, 0, stream>>>(data,
+                                                               data_size,
+                                                               options,
+                                                               num_columns,
+                                                               column_map,
+                                                               rec_starts,
+                                                               num_records,
+                                                               row_stride,
+                                                               column_infos);
 
   CUDA_TRY(cudaGetLastError());
 }
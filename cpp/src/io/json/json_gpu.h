@@ -30,11 +30,15 @@ namespace gpu {
  * @param[in] dtypes The data type of each column
  * @param[out] output_columns The output column data
  * @param[in] num_records The number of lines/rows
- * @param[in] num_columns The number of columns
+ * @param[in] num_columns The number of columns to scan
+ * @param[in] column_map Output column of each scanned column, negative to skip the column;
+ * `nullptr` if all columns are read
  * @param[in] rec_starts The start of each data record
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns
  * @param[in] opts A set of parsing options
+ * @param[out] type_mismatch Device memory output set to non-zero if a field does not fit the
+ * detected data type of its column; `nullptr` to skip the checks
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns void
@@ -44,11 +48,13 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
                              void *const *output_columns,
                              cudf::size_type num_records,
                              cudf::size_type num_columns,
+                             const cudf::size_type *column_map,
                              const uint64_t *rec_starts,
                              bitmask_type *const *valid_fields,
                              cudf::size_type *num_valid_fields,
                              ParseOptions const &opts,
-                             cudaStream_t stream = 0);
+                             uint32_t *type_mismatch = nullptr,
+                             cudaStream_t stream     = 0);
 
 /**
  * @brief Process a buffer of data and determine information about the column types within.
@@ -57,9 +63,12 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
  * @param[in] data Input data buffer
  * @param[in] data_size Size of the data buffer, in bytes
  * @param[in] opts A set of parsing options
- * @param[in] num_columns The number of columns of input data
+ * @param[in] num_columns The number of columns of input data to scan
+ * @param[in] column_map Output column of each scanned column, negative to skip the column;
+ * `nullptr` if all columns are read
  * @param[in] rec_starts The start the input data of interest
  * @param[in] num_records The number of lines/rows of input data
+ * @param[in] row_stride The distance between the sampled lines/rows; `1` to sample all rows
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns void
@@ -69,8 +78,10 @@ void detect_data_types(ColumnInfo *column_infos,
                        size_t data_size,
                        const ParseOptions &options,
                        int num_columns,
+                       const cudf::size_type *column_map,
                        const uint64_t *rec_starts,
                        cudf::size_type num_records,
+                       cudf::size_type row_stride,
                        cudaStream_t stream = 0);
 
 }  // namespace gpu
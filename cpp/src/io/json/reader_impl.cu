@@ -29,6 +29,7 @@
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/pinned_host_pool.hpp>
 #include <io/utilities/type_conversion.cuh>
 
 #include <cudf/table/table.hpp>
@@ -43,6 +44,9 @@ namespace {
 /**
  * @brief Extract value names from a JSON object
  *
+ * Nested objects are flattened: the values of a nested object are named with the name of the
+ * object and their own names, separated with a dot. Arrays are single values.
+ *
  * @param[in] json_obj Host vector containing the JSON object
  * @param[in] opts Parsing options (e.g. delimiter and quotation character)
  *
@@ -51,32 +55,61 @@ namespace {
 std::vector<std::string> get_names_from_json_object(const std::vector<char> &json_obj,
                                                     const ParseOptions &opts)
 {
-  enum class ParseState { preColName, colName, postColName };
+  enum class ParseState { preColName, colName, postColName, preValue, value };
   std::vector<std::string> names;
+  // Dotted names of the nested objects that enclose the current position
+  std::vector<std::string> prefixes;
+  std::string name;
   bool quotation = false;
+  int depth      = 0;  // Nesting depth of arrays and objects within the current value
   auto state     = ParseState::preColName;
   int name_start = 0;
-  for (size_t pos = 0; pos < json_obj.size(); ++pos) {
+  auto pos       = std::find(json_obj.begin(), json_obj.end(), '{') - json_obj.begin() + 1;
+  for (; pos < static_cast<long>(json_obj.size()); ++pos) {
+    const char ch = json_obj[pos];
     if (state == ParseState::preColName) {
-      if (json_obj[pos] == opts.quotechar) {
+      if (ch == opts.quotechar) {
         name_start = pos + 1;
         state      = ParseState::colName;
-        continue;
+      } else if (ch == '}') {
+        if (prefixes.empty()) { break; }
+        prefixes.pop_back();
       }
     } else if (state == ParseState::colName) {
-      if (json_obj[pos] == opts.quotechar && json_obj[pos - 1] != '\\') {
+      if (ch == opts.quotechar && json_obj[pos - 1] != '\\') {
         // if found a non-escaped quote character, it's the end of the column name
-        names.emplace_back(&json_obj[name_start], &json_obj[pos]);
+        name.assign(&json_obj[name_start], &json_obj[pos]);
+        if (!prefixes.empty()) { name = prefixes.back() + "." + name; }
         state = ParseState::postColName;
-        continue;
       }
     } else if (state == ParseState::postColName) {
-      // TODO handle complex data types that might include unquoted commas
-      if (!quotation && json_obj[pos] == opts.delimiter) {
+      if (ch == ':') { state = ParseState::preValue; }
+    } else if (state == ParseState::preValue) {
+      if (ch == '{') {
+        // The values of a nested object are read as separate columns
+        prefixes.push_back(name);
         state = ParseState::preColName;
-        continue;
-      } else if (json_obj[pos] == opts.quotechar) {
+      } else if (ch != ' ' && ch != '\t' && ch != '\r' && ch != '\n') {
+        names.push_back(name);
+        state = ParseState::value;
+      }
+    }
+    if (state == ParseState::value) {
+      if (ch == opts.quotechar && json_obj[pos - 1] != '\\') {
         quotation = !quotation;
+      } else if (!quotation) {
+        if (ch == '[' || ch == '{') {
+          depth++;
+        } else if ((ch == ']' || ch == '}') && depth > 0) {
+          depth--;
+        } else if (ch == '}') {
+          // End of the enclosing object
+          if (prefixes.empty()) { break; }
+          prefixes.pop_back();
+          state = ParseState::preColName;
+        } else if (depth == 0 && ch == opts.delimiter) {
+          state = ParseState::preColName;
+        }
       }
     }
   }
@@ -148,9 +181,11 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
  * Sets the uncomp_data_ and uncomp_size_ data members
  * Loads the data into device memory if byte range parameters are not used
  *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
  * @return void
  **/
-void reader::impl::decompress_input()
+void reader::impl::decompress_input(cudaStream_t stream)
 {
   const auto compression_type = infer_compression_type(
     args_.compression, filepath_, {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
@@ -166,7 +201,7 @@ void reader::impl::decompress_input()
     uncomp_data_ = uncomp_data_owner_.data();
     uncomp_size_ = uncomp_data_owner_.size();
   }
-  if (load_whole_file_) data_ = rmm::device_buffer(uncomp_data_, uncomp_size_);
+  if (load_whole_file_) data_ = upload_to_device(uncomp_data_, uncomp_size_, stream);
 }
 
 /**
@@ -248,9 +283,11 @@ void reader::impl::set_record_starts(cudaStream_t stream)
  * Only rows that need to be parsed are copied, based on the byte range
  * Also updates the array of record starts to match the device data offset.
  *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
  * @return void
  **/
-void reader::impl::upload_data_to_device()
+void reader::impl::upload_data_to_device(cudaStream_t stream)
 {
   size_t start_offset = 0;
   size_t end_offset   = uncomp_size_;
@@ -285,7 +322,7 @@ void reader::impl::upload_data_to_device()
                "Error finding the record within the specified byte range.\n");
 
   // Upload the raw data that is within the rows of interest
-  data_ = rmm::device_buffer(uncomp_data_ + start_offset, bytes_to_upload);
+  data_ = upload_to_device(uncomp_data_ + start_offset, bytes_to_upload, stream);
 }
 
 /**
@@ -329,29 +366,70 @@ void reader::impl::set_column_names(cudaStream_t stream)
   } else {
     int cols_found = 0;
     bool quotation = false;
+    int depth      = 0;  // Nested arrays and objects are single values
     for (size_t pos = 0; pos < first_row.size(); ++pos) {
       // Flip the quotation flag if current character is a quotechar
       if (first_row[pos] == opts_.quotechar) {
         quotation = !quotation;
+      } else if (!quotation && (first_row[pos] == '[' || first_row[pos] == '{')) {
+        depth++;
+      } else if (!quotation && (first_row[pos] == ']' || first_row[pos] == '}')) {
+        depth--;
       }
       // Check if end of a column/row
-      else if (pos == first_row.size() - 1 || (!quotation && first_row[pos] == opts_.delimiter)) {
+      if (pos == first_row.size() - 1 ||
+          (!quotation && depth == 1 && first_row[pos] == opts_.delimiter)) {
         metadata.column_names.emplace_back(std::to_string(cols_found++));
       }
     }
   }
 }
 
+/**
+ * @brief Selects the columns to read
+ *
+ * Sets the num_scanned_columns_ and d_column_map_ data members, and removes the names of the
+ * columns that are not read from the metadata
+ *
+ * @return void
+ **/
+void reader::impl::select_columns()
+{
+  num_scanned_columns_ = metadata.column_names.size();
+  if (args_.use_cols.empty()) { return; }
+
+  // Records are only scanned up to the last column to read
+  std::vector<cudf::size_type> column_map(metadata.column_names.size(), -1);
+  std::vector<std::string> selected_names;
+  for (size_t col = 0; col < metadata.column_names.size(); ++col) {
+    const auto &name = metadata.column_names[col];
+    if (std::find(args_.use_cols.begin(), args_.use_cols.end(), name) != args_.use_cols.end()) {
+      column_map[col] = selected_names.size();
+      selected_names.push_back(name);
+      num_scanned_columns_ = col + 1;
+    }
+  }
+  for (const auto &name : args_.use_cols) {
+    CUDF_EXPECTS(std::find(selected_names.begin(), selected_names.end(), name) !=
+                   selected_names.end(),
+                 "Column to read not found.\n");
+  }
+  column_map.resize(num_scanned_columns_);
+  d_column_map_         = column_map;
+  metadata.column_names = std::move(selected_names);
+}
+
 /**
  * @brief Set the data type array data member
  *
  * If user does not pass the data types, deduces types from the file content
  *
+ * @param[in] row_stride Distance between the records sampled to deduce the types
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return void
  **/
-void reader::impl::set_data_types(cudaStream_t stream)
+void reader::impl::set_data_types(cudf::size_type row_stride, cudaStream_t stream)
 {
   if (!args_.dtype.empty()) {
     CUDF_EXPECTS(args_.dtype.size() == metadata.column_names.size(),
@@ -387,7 +465,8 @@ void reader::impl::set_data_types(cudaStream_t stream)
     }
   } else {
     CUDF_EXPECTS(rec_starts_.size() != 0, "No data available for data type inference.\n");
-    const auto num_columns = metadata.column_names.size();
+    const auto num_columns  = metadata.column_names.size();
+    const auto d_column_map = d_column_map_.empty() ? nullptr : d_column_map_.data().get();
 
     rmm::device_vector<cudf::io::json::ColumnInfo> d_column_infos(num_columns,
                                                                   cudf::io::json::ColumnInfo{});
@@ -395,14 +474,17 @@ void reader::impl::set_data_types(cudaStream_t stream)
                                            static_cast<const char *>(data_.data()),
                                            data_.size(),
                                            opts_,
-                                           num_columns,
+                                           num_scanned_columns_,
+                                           d_column_map,
                                            rec_starts_.data().get(),
                                            rec_starts_.size(),
+                                           row_stride,
                                            stream);
     thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos = d_column_infos;
 
+    const auto num_sampled = (rec_starts_.size() + row_stride - 1) / row_stride;
     for (const auto &cinfo : h_column_infos) {
-      if (cinfo.null_count == static_cast<int>(rec_starts_.size())) {
+      if (cinfo.null_count == static_cast<int>(num_sampled)) {
         // Entire column is NULL; allocate the smallest amount of memory
         dtypes_.push_back(data_type(INT8));
       } else if (cinfo.string_count > 0) {
@@ -425,11 +507,15 @@ void reader::impl::set_data_types(cudaStream_t stream)
 /**
  * @brief Parse the input data and store results a table
  *
+ * If a value does not fit the deduced type of its column, the types are deduced again from all
+ * records and the data is parsed again.
+ *
+ * @param[in] check_types Whether to check that all values fit the deduced column types
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return table_with_metadata struct
  **/
-table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
+table_with_metadata reader::impl::convert_data_to_table(bool check_types, cudaStream_t stream)
 {
   const auto num_columns = dtypes_.size();
   const auto num_records = rec_starts_.size();
@@ -454,20 +540,31 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
   rmm::device_vector<void *> d_data                = h_data;
   rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
   rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
+  rmm::device_vector<uint32_t> d_type_mismatch(check_types ? 1 : 0, 0);
+  const auto d_column_map = d_column_map_.empty() ? nullptr : d_column_map_.data().get();
 
   cudf::io::json::gpu::convert_json_to_columns(data_,
                                                d_dtypes.data().get(),
                                                d_data.data().get(),
                                                num_records,
-                                               num_columns,
+                                               num_scanned_columns_,
+                                               d_column_map,
                                                rec_starts_.data().get(),
                                                d_valid.data().get(),
                                                d_valid_counts.data().get(),
                                                opts_,
+                                               check_types ? d_type_mismatch.data().get() : nullptr,
                                                stream);
   CUDA_TRY(cudaStreamSynchronize(stream));
   CUDA_TRY(cudaGetLastError());
 
+  if (check_types && d_type_mismatch[0] != 0) {
+    // A value does not fit the types deduced from the sample; deduce them from all records
+    dtypes_.clear();
+    set_data_types(1, stream);
+    return convert_data_to_table(false, stream);
+  }
+
   // postprocess columns
   thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
   std::vector<std::unique_ptr<column>> out_columns;
@@ -516,23 +613,31 @@ table_with_metadata reader::impl::read(size_t range_offset, size_t range_size, c
   ingest_raw_input(range_offset, range_size);
   CUDF_EXPECTS(buffer_ != nullptr, "Ingest failed: input data is null.\n");
 
-  decompress_input();
+  decompress_input(stream);
   CUDF_EXPECTS(uncomp_data_ != nullptr, "Ingest failed: uncompressed input data is null.\n");
   CUDF_EXPECTS(uncomp_size_ != 0, "Ingest failed: uncompressed input data has zero size.\n");
 
   set_record_starts(stream);
   CUDF_EXPECTS(!rec_starts_.empty(), "Error enumerating records.\n");
 
-  upload_data_to_device();
+  upload_data_to_device(stream);
   CUDF_EXPECTS(data_.size() != 0, "Error uploading input data to the GPU.\n");
 
   set_column_names(stream);
   CUDF_EXPECTS(!metadata.column_names.empty(), "Error determining column names.\n");
-
-  set_data_types(stream);
+  select_columns();
+
+  // Deduce the types from evenly spaced records if sampling; all values are checked against the
+  // deduced types when converting the data
+  const auto num_records  = static_cast<cudf::size_type>(rec_starts_.size());
+  const bool sample_types = args_.dtype.empty() && args_.infer_sample_rows > 0 &&
+                            num_records > args_.infer_sample_rows;
+  const cudf::size_type row_stride =
+    sample_types ? (num_records + args_.infer_sample_rows - 1) / args_.infer_sample_rows : 1;
+  set_data_types(row_stride, stream);
   CUDF_EXPECTS(!dtypes_.empty(), "Error in data type detection.\n");
 
-  return convert_data_to_table(stream);
+  return convert_data_to_table(sample_types, stream);
 }
 
 // Forward to implementation
@@ -69,6 +69,10 @@ class reader::impl {
   table_metadata metadata;
   std::vector<data_type> dtypes_;
 
+  // Columns to scan in each record, and the output column of each; empty map if all are read
+  cudf::size_type num_scanned_columns_ = 0;
+  rmm::device_vector<cudf::size_type> d_column_map_;
+
   // parsing options
   const bool allow_newlines_in_strings_ = false;
   ParseOptions opts_{',', '\n', '\"', '.'};
@@ -93,9 +97,11 @@ class reader::impl {
    *
    * Sets the uncomp_data_ and uncomp_size_ data members
    *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
    * @return void
    **/
-  void decompress_input();
+  void decompress_input(cudaStream_t stream);
 
   /**
    * @brief Finds all record starts in the file and stores them in rec_starts_
@@ -115,9 +121,11 @@ class reader::impl {
    * Only rows that need to be parsed are copied, based on the byte range
    * Also updates the array of record starts to match the device data offset.
    *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
    * @return void
    **/
-  void upload_data_to_device();
+  void upload_data_to_device(cudaStream_t stream);
 
   /**
    * @brief Parse the first row to set the column name
@@ -130,25 +138,40 @@ class reader::impl {
    **/
   void set_column_names(cudaStream_t stream);
 
+  /**
+   * @brief Selects the columns to read
+   *
+   * Sets the num_scanned_columns_ and d_column_map_ data members, and removes the names of the
+   * columns that are not read from the metadata
+   *
+   * @return void
+   **/
+  void select_columns();
+
   /**
    * @brief Set the data type array data member
    *
    * If user does not pass the data types, deduces types from the file content
    *
+   * @param[in] row_stride Distance between the records sampled to deduce the types
    * @param[in] stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return void
    **/
-  void set_data_types(cudaStream_t stream);
+  void set_data_types(cudf::size_type row_stride, cudaStream_t stream);
 
   /**
    * @brief Parse the input data and store results a table
    *
+   * If a value does not fit the deduced type of its column, the types are deduced again from all
+   * records and the data is parsed again.
+   *
+   * @param[in] check_types Whether to check that all values fit the deduced column types
    * @param[in] stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return table_with_metadata struct
    **/
-  table_with_metadata convert_data_to_table(cudaStream_t stream);
+  table_with_metadata convert_data_to_table(bool check_types, cudaStream_t stream);
 
  public:
   /**
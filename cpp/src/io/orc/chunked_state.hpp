@@ -58,6 +58,10 @@ struct orc_chunked_state {
   /// special parameter only used by detail::write() to indicate that we are guaranteeing
   /// a single table write.  this enables some internal optimizations.
   bool single_write_mode = false;
+  /// tables buffered until they fill a stripe, with their total rows and uncompressed size
+  std::vector<std::unique_ptr<table>> buffered_tables;
+  size_t buffered_rows  = 0;
+  size_t buffered_bytes = 0;
 };
 
 }  // namespace orc
@@ -105,6 +105,68 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct RowIndexEntry {
+  ColumnStatistics statistics;  // Column statistics blob of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;
+};
+
+// Decoded column statistics; the has_* flags mark which optional fields are present
+
+struct IntegerStatistics {
+  int64_t minimum  = 0;
+  int64_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DoubleStatistics {
+  double minimum   = 0.0;
+  double maximum   = 0.0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct StringStatistics {
+  std::string minimum;
+  std::string maximum;
+  int64_t sum      = 0;  // total length of the strings
+  bool has_minimum = false;
+  bool has_maximum = false;
+  bool has_sum     = false;
+};
+
+struct DateStatistics {
+  int32_t minimum  = 0;  // days since UNIX epoch
+  int32_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct TimestampStatistics {
+  int64_t minimumUtc  = 0;  // milliseconds since UNIX epoch
+  int64_t maximumUtc  = 0;
+  bool has_minimumUtc = false;
+  bool has_maximumUtc = false;
+};
+
+struct ColumnStatisticsInfo {
+  uint64_t numberOfValues = 0;  // the number of non-null values
+  IntegerStatistics intStatistics;
+  DoubleStatistics doubleStatistics;
+  StringStatistics stringStatistics;
+  DateStatistics dateStatistics;
+  TimestampStatistics timestampStatistics;
+  bool has_numberOfValues      = false;
+  bool has_intStatistics       = false;
+  bool has_doubleStatistics    = false;
+  bool has_stringStatistics    = false;
+  bool has_dateStatistics      = false;
+  bool has_timestampStatistics = false;
+};
+
 // Minimal protobuf reader for orc metadata
 
 /**
@@ -170,6 +232,14 @@ class ProtobufReader {
   DECL_ORC_STRUCT(ColumnEncoding);
   DECL_ORC_STRUCT(StripeStatistics);
   DECL_ORC_STRUCT(Metadata);
+  DECL_ORC_STRUCT(RowIndexEntry);
+  DECL_ORC_STRUCT(RowIndex);
+  DECL_ORC_STRUCT(IntegerStatistics);
+  DECL_ORC_STRUCT(DoubleStatistics);
+  DECL_ORC_STRUCT(StringStatistics);
+  DECL_ORC_STRUCT(DateStatistics);
+  DECL_ORC_STRUCT(TimestampStatistics);
+  DECL_ORC_STRUCT(ColumnStatisticsInfo);
 #undef DECL_ORC_STRUCT
  protected:
   bool InitSchema(FileFooter *);
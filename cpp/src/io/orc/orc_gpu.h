@@ -95,6 +95,7 @@ struct ColumnDesc {
   uint32_t num_rows;                       // starting row of the stripe
   uint32_t dictionary_start;               // start position in global dictionary
   uint32_t dict_len;                       // length of local dictionary
+  uint32_t column_dict_start;              // start position in the column's stripe dictionaries
   uint32_t null_count;                     // number of null values in this stripe's column
   uint32_t skip_count;                     // number of non-null values to skip
   uint32_t rowgroup_id;                    // row group position
@@ -344,6 +345,7 @@ cudaError_t CompactOrcDataStreams(StripeStream *strm_desc,
  * @param[out] comp_out Per-block compression status
  * @param[in] num_stripe_streams Total number of streams
  * @param[in] compression Type of compression
+ * @param[in] compression_level Compression level of ZLIB and ZSTD, 0 for the default
  * @param[in] num_compressed_blocks Total number of compressed blocks
  * @param[in] stream CUDA stream to use, default 0
  *
@@ -357,6 +359,7 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
                                    uint32_t num_stripe_streams,
                                    uint32_t num_compressed_blocks,
                                    CompressionKind compression,
+                                   int compression_level,
                                    uint32_t comp_blk_size,
                                    cudaStream_t stream = (cudaStream_t)0);
 
@@ -23,16 +23,30 @@
 #include "timezone.h"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/chunk_cache.hpp>
+#include <io/utilities/pinned_host_pool.hpp>
+#include <io/utilities/statistics_filter.hpp>
 
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
+#include <thrust/transform.h>
+
+#include <sys/stat.h>
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <future>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <thread>
 
 namespace cudf {
 namespace io {
@@ -49,7 +63,8 @@ namespace {
 constexpr type_id to_type_id(const orc::SchemaType &schema,
                              bool use_np_dtypes,
                              type_id timestamp_type_id,
-                             bool decimals_as_float)
+                             bool decimals_as_float,
+                             bool strings_to_dictionary)
 {
   switch (schema.kind) {
     case orc::BOOLEAN: return type_id::BOOL8;
@@ -63,8 +78,8 @@ constexpr type_id to_type_id(const orc::SchemaType &schema,
     case orc::BINARY:
     case orc::VARCHAR:
     case orc::CHAR:
-      // Variable-length types can all be mapped to STRING
-      return type_id::STRING;
+      // Variable-length types can all be mapped to STRING or DICTIONARY32
+      return strings_to_dictionary ? type_id::DICTIONARY32 : type_id::STRING;
     case orc::TIMESTAMP:
       return (timestamp_type_id != type_id::EMPTY) ? timestamp_type_id
                                                    : type_id::TIMESTAMP_NANOSECONDS;
@@ -72,14 +87,31 @@ constexpr type_id to_type_id(const orc::SchemaType &schema,
       // There isn't a (DAYS -> np.dtype) mapping
       return (use_np_dtypes) ? type_id::TIMESTAMP_MILLISECONDS : type_id::TIMESTAMP_DAYS;
     case orc::DECIMAL:
-      // There isn't an arbitrary-precision type in cuDF, so map as float or int
-      return (decimals_as_float) ? type_id::FLOAT64 : type_id::INT64;
+      // There isn't an arbitrary-precision type in cuDF, so map as float or fixed-point
+      return (decimals_as_float) ? type_id::FLOAT64 : type_id::DECIMAL64;
     default: break;
   }
 
   return type_id::EMPTY;
 }
 
+/**
+ * @brief Returns the `data_type` of a column of type @p id, which has the scale the
+ * decimals are decoded with for fixed-point types
+ *
+ * @param id The type of the column
+ * @param schema The ORC schema of the column
+ * @param forced_decimals_scale The number of fractional digits of the decoded decimals,
+ * or -1 for the column's own scale
+ **/
+data_type to_data_type(type_id id, const orc::SchemaType &schema, int forced_decimals_scale)
+{
+  if (!is_fixed_point(data_type{id})) { return data_type{id}; }
+  auto const scale = (forced_decimals_scale < 0) ? static_cast<int32_t>(schema.scale)
+                                                 : static_cast<int32_t>(forced_decimals_scale);
+  return data_type{id, -scale};
+}
+
 /**
  * @brief Function that translates cuDF time unit to ORC clock frequency
  **/
@@ -118,8 +150,217 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Returns whether the statistics of a column allow some of its values to satisfy the
+ * filter
+ *
+ * Returns true whenever the statistics are missing or cannot be interpreted for the filter.
+ **/
+bool statistics_may_match(const SchemaType &type,
+                          const ColumnStatisticsInfo &stats,
+                          const column_filter &filter)
+{
+  // No comparison is satisfied by a null, so all-null sections never match
+  if (stats.has_numberOfValues && stats.numberOfValues == 0) { return false; }
+
+  if (type.kind == orc::STRING || type.kind == orc::VARCHAR) {
+    const auto &str_stats = stats.stringStatistics;
+    if (!stats.has_stringStatistics || !str_stats.has_minimum || !str_stats.has_maximum) {
+      return true;
+    }
+    std::vector<std::string> values;
+    for (const auto &literal : filter.values) {
+      CUDF_EXPECTS(literal.type.id() == type_id::STRING,
+                   "Filter literal type does not match the column type");
+      values.emplace_back(literal.string_value);
+    }
+    return range_may_match(filter.op, str_stats.minimum, str_stats.maximum, values);
+  }
+
+  // Integral statistics of dates and timestamps are in days and milliseconds, respectively
+  bool is_integral  = true;
+  int64_t stored_ns = 0;
+  int64_t imin = 0, imax = 0;
+  double fmin = 0.0, fmax = 0.0;
+  switch (type.kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG: {
+      const auto &int_stats = stats.intStatistics;
+      if (!stats.has_intStatistics || !int_stats.has_minimum || !int_stats.has_maximum) {
+        return true;
+      }
+      imin = int_stats.minimum;
+      imax = int_stats.maximum;
+    } break;
+    case orc::DATE: {
+      const auto &date_stats = stats.dateStatistics;
+      if (!stats.has_dateStatistics || !date_stats.has_minimum || !date_stats.has_maximum) {
+        return true;
+      }
+      imin      = date_stats.minimum;
+      imax      = date_stats.maximum;
+      stored_ns = tick_duration_ns(type_id::TIMESTAMP_DAYS);
+    } break;
+    case orc::TIMESTAMP: {
+      const auto &ts_stats = stats.timestampStatistics;
+      if (!stats.has_timestampStatistics || !ts_stats.has_minimumUtc ||
+          !ts_stats.has_maximumUtc) {
+        return true;
+      }
+      // Sub-millisecond values are truncated in the statistics; widen the range to cover them
+      imin      = ts_stats.minimumUtc - 1;
+      imax      = ts_stats.maximumUtc + 1;
+      stored_ns = tick_duration_ns(type_id::TIMESTAMP_MILLISECONDS);
+    } break;
+    case orc::FLOAT:
+    case orc::DOUBLE: {
+      const auto &dbl_stats = stats.doubleStatistics;
+      if (!stats.has_doubleStatistics || !dbl_stats.has_minimum || !dbl_stats.has_maximum) {
+        return true;
+      }
+      fmin        = dbl_stats.minimum;
+      fmax        = dbl_stats.maximum;
+      is_integral = false;
+    } break;
+    default: return true;
+  }
+
+  const bool integral_literals =
+    std::all_of(filter.values.begin(), filter.values.end(), [](const filter_literal &literal) {
+      CUDF_EXPECTS(literal.type.id() != type_id::STRING,
+                   "Filter literal type does not match the column type");
+      return !is_floating_literal(literal);
+    });
+  if (is_integral && integral_literals) {
+    // Timestamp literals and statistics are compared in the finest unit of either
+    int64_t unit_ns = stored_ns;
+    for (const auto &literal : filter.values) {
+      const auto literal_ns = tick_duration_ns(literal.type.id());
+      if (unit_ns != 0 && literal_ns != 0) { unit_ns = std::min(unit_ns, literal_ns); }
+    }
+    if (unit_ns != stored_ns) {
+      imin *= stored_ns / unit_ns;
+      imax *= stored_ns / unit_ns;
+    }
+    std::vector<int64_t> values;
+    for (const auto &literal : filter.values) {
+      const auto literal_ns = tick_duration_ns(literal.type.id());
+      values.emplace_back((unit_ns != 0 && literal_ns != 0)
+                            ? literal.int_value * (literal_ns / unit_ns)
+                            : literal.int_value);
+    }
+    return range_may_match(filter.op, imin, imax, values);
+  }
+
+  if (is_integral) {
+    if (stored_ns != 0) { return true; }
+    fmin = static_cast<double>(imin);
+    fmax = static_cast<double>(imax);
+  }
+  if (std::isnan(fmin) || std::isnan(fmax)) { return true; }
+  std::vector<double> values;
+  for (const auto &literal : filter.values) {
+    values.emplace_back(is_floating_literal(literal) ? literal.float_value
+                                                     : static_cast<double>(literal.int_value));
+  }
+  return range_may_match(filter.op, fmin, fmax, values);
+}
+
+/**
+ * @brief Converts the minimum and maximum values of column statistics to filter literals
+ *
+ * @param[in] type Schema type of the column
+ * @param[in] column_type cuDF type of the column
+ * @param[in] stats Decoded statistics of the column
+ * @param[out] min Minimum value
+ * @param[out] max Maximum value
+ *
+ * @return Whether both values are present and supported
+ **/
+bool decode_statistics(const SchemaType &type,
+                       data_type column_type,
+                       const ColumnStatisticsInfo &stats,
+                       filter_literal &min,
+                       filter_literal &max)
+{
+  switch (type.kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG: {
+      const auto &int_stats = stats.intStatistics;
+      if (!stats.has_intStatistics || !int_stats.has_minimum || !int_stats.has_maximum) {
+        return false;
+      }
+      min = filter_literal{int_stats.minimum, column_type};
+      max = filter_literal{int_stats.maximum, column_type};
+      return true;
+    }
+    case orc::FLOAT:
+    case orc::DOUBLE: {
+      const auto &dbl_stats = stats.doubleStatistics;
+      if (!stats.has_doubleStatistics || !dbl_stats.has_minimum || !dbl_stats.has_maximum) {
+        return false;
+      }
+      min      = filter_literal{dbl_stats.minimum};
+      max      = filter_literal{dbl_stats.maximum};
+      min.type = column_type;
+      max.type = column_type;
+      return true;
+    }
+    case orc::STRING:
+    case orc::VARCHAR: {
+      const auto &str_stats = stats.stringStatistics;
+      if (!stats.has_stringStatistics || !str_stats.has_minimum || !str_stats.has_maximum) {
+        return false;
+      }
+      min = filter_literal{str_stats.minimum};
+      max = filter_literal{str_stats.maximum};
+      return true;
+    }
+    case orc::DATE: {
+      const auto &date_stats = stats.dateStatistics;
+      if (!stats.has_dateStatistics || !date_stats.has_minimum || !date_stats.has_maximum) {
+        return false;
+      }
+      min = filter_literal{int64_t{date_stats.minimum}, data_type{type_id::TIMESTAMP_DAYS}};
+      max = filter_literal{int64_t{date_stats.maximum}, data_type{type_id::TIMESTAMP_DAYS}};
+      return true;
+    }
+    case orc::TIMESTAMP: {
+      const auto &ts_stats = stats.timestampStatistics;
+      if (!stats.has_timestampStatistics || !ts_stats.has_minimumUtc ||
+          !ts_stats.has_maximumUtc) {
+        return false;
+      }
+      min = filter_literal{ts_stats.minimumUtc, data_type{type_id::TIMESTAMP_MILLISECONDS}};
+      max = filter_literal{ts_stats.maximumUtc, data_type{type_id::TIMESTAMP_MILLISECONDS}};
+      return true;
+    }
+    default: return false;
+  }
+}
+
+/**
+ * @brief Minimum number of stripe footers parsed by each host thread
+ **/
+constexpr size_t min_footers_per_thread = 64;
+
 }  // namespace
 
+/**
+ * @brief Parsed metadata of all the stripes of a file, shared between the readers of the file
+ **/
+struct file_metadata {
+  PostScript ps;
+  FileFooter ff;
+  Metadata md;
+  std::vector<StripeFooter> stripefooters;
+  size_t metadata_offset = 0;
+};
+
 /**
  * @brief A helper class for ORC file metadata. Provides some additional
  * convenience methods for initializing and accessing metadata.
@@ -128,6 +369,20 @@ class metadata {
   using OrcStripeInfo = std::pair<const StripeInformation *, const StripeFooter *>;
 
  public:
+  /**
+   * @brief Constructor from previously parsed metadata of the source
+   **/
+  metadata(datasource *const src, std::shared_ptr<const file_metadata> parsed)
+    : ps(parsed->ps),
+      ff(parsed->ff),
+      md(parsed->md),
+      decompressor(std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize)),
+      source(src),
+      metadata_offset(parsed->metadata_offset),
+      shared(std::move(parsed))
+  {
+  }
+
   explicit metadata(datasource *const src) : source(src)
   {
     const auto len         = source->size();
@@ -153,6 +408,192 @@ class metadata {
     pb.init(ff_data, ff_length);
     CUDF_EXPECTS(pb.read(&ff, ff_length), "Cannot read filefooter");
     CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
+
+    // The metadata section immediately precedes the filefooter
+    CUDF_EXPECTS(ps.metadataLength + ps.footerLength + ps_length < len, "Invalid metadata length");
+    metadata_offset = len - ps_length - 1 - ps.footerLength - ps.metadataLength;
+  }
+
+  /**
+   * @brief Reads the stripe-level column statistics from the metadata section
+   **/
+  void read_stripe_statistics()
+  {
+    if (ps.metadataLength == 0) { return; }
+    const auto buffer = source->host_read(metadata_offset, ps.metadataLength);
+    size_t md_length  = 0;
+    auto md_data      = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
+    ProtobufReader pb(md_data, md_length);
+    CUDF_EXPECTS(pb.read(&md, md_length), "Cannot read metadata");
+  }
+
+  /**
+   * @brief Reads and decompresses the stripefooter of a stripe
+   *
+   * @param[in] stripe Stripe information
+   * @param[out] stripefooter Stripefooter of the stripe
+   * @param[in] footer_decompressor Decompressor used for the stripefooter
+   **/
+  void read_stripe_footer(const StripeInformation *stripe,
+                          StripeFooter *stripefooter,
+                          OrcDecompressor &footer_decompressor)
+  {
+    const auto sf_comp_offset = stripe->offset + stripe->indexLength + stripe->dataLength;
+    const auto sf_comp_length = stripe->footerLength;
+    CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(), "Invalid stripe information");
+
+    const auto buffer = source->host_read(sf_comp_offset, sf_comp_length);
+    size_t sf_length  = 0;
+    auto sf_data = footer_decompressor.Decompress(buffer->data(), sf_comp_length, &sf_length);
+    ProtobufReader pb(sf_data, sf_length);
+    CUDF_EXPECTS(pb.read(stripefooter, sf_length), "Cannot read stripefooter");
+  }
+
+  /**
+   * @brief Reads and decompresses the stripefooters of a list of stripes
+   *
+   * Large lists are split between host threads, each with its own decompressor.
+   *
+   * @param[in] stripe_indices Indices of the stripes
+   * @param[out] stripefooters Stripefooters of the stripes
+   **/
+  void read_stripe_footers(const std::vector<size_type> &stripe_indices,
+                           std::vector<StripeFooter> &stripefooters)
+  {
+    stripefooters.resize(stripe_indices.size());
+    const size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const size_t num_threads = std::min(
+      max_threads,
+      (stripe_indices.size() + min_footers_per_thread - 1) / min_footers_per_thread);
+    if (num_threads <= 1) {
+      for (size_t i = 0; i < stripe_indices.size(); ++i) {
+        read_stripe_footer(&ff.stripes[stripe_indices[i]], &stripefooters[i], *decompressor);
+      }
+      return;
+    }
+
+    std::vector<std::future<void>> tasks;
+    for (size_t t = 0; t < num_threads; ++t) {
+      const size_t begin = stripe_indices.size() * t / num_threads;
+      const size_t end   = stripe_indices.size() * (t + 1) / num_threads;
+      tasks.emplace_back(std::async(std::launch::async, [&, begin, end]() {
+        OrcDecompressor footer_decompressor(ps.compression, ps.compressionBlockSize);
+        for (size_t i = begin; i < end; ++i) {
+          read_stripe_footer(
+            &ff.stripes[stripe_indices[i]], &stripefooters[i], footer_decompressor);
+        }
+      }));
+    }
+    for (auto &task : tasks) { task.get(); }
+  }
+
+  /**
+   * @brief Reads the statistics and the stripefooters of all stripes, for sharing with other
+   * readers of the source
+   *
+   * @return The parsed metadata of the source
+   **/
+  std::shared_ptr<const file_metadata> share()
+  {
+    if (shared) { return shared; }
+    if (md.stripeStats.empty()) { read_stripe_statistics(); }
+
+    auto parsed             = std::make_shared<file_metadata>();
+    parsed->ps              = ps;
+    parsed->ff              = ff;
+    parsed->md              = md;
+    parsed->metadata_offset = metadata_offset;
+    std::vector<size_type> stripe_indices(get_num_stripes());
+    std::iota(stripe_indices.begin(), stripe_indices.end(), 0);
+    read_stripe_footers(stripe_indices, parsed->stripefooters);
+    shared = parsed;
+    return shared;
+  }
+
+  /**
+   * @brief Returns the index of the column with the given name, or -1 if not found
+   **/
+  int find_column(const std::string &name)
+  {
+    for (int i = 0; i < get_num_columns(); ++i) {
+      if (ff.GetColumnName(i) == name) { return i; }
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Returns whether the column statistics of a stripe allow some of its rows to satisfy
+   * all the filters
+   *
+   * Requires the stripe statistics to be read first.
+   *
+   * @param[in] stripe_idx Index of the stripe to check
+   * @param[in] filters Predicates that must all be satisfied
+   **/
+  bool stripe_may_match(size_type stripe_idx, const std::vector<column_filter> &filters)
+  {
+    for (const auto &filter : filters) {
+      const auto col = find_column(filter.column_name);
+      if (col < 0) { continue; }
+
+      if (static_cast<size_t>(stripe_idx) < md.stripeStats.size() &&
+          static_cast<size_t>(col) < md.stripeStats[stripe_idx].colStats.size()) {
+        const auto &blob = md.stripeStats[stripe_idx].colStats[col];
+        ColumnStatisticsInfo stats;
+        ProtobufReader pb(blob.data(), blob.size());
+        if (pb.read(&stats, blob.size()) && !statistics_may_match(ff.types[col], stats, filter)) {
+          return false;
+        }
+      }
+      if (!row_index_may_match(stripe_idx, col, filter)) { return false; }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Returns whether the row group statistics of a stripe allow some of the values of a
+   * column to satisfy the filter
+   *
+   * Finer-grained than the stripe statistics: a stripe whose min/max range covers the filter
+   * values may still have none of its row groups match. Returns true if the row index of the
+   * column has no statistics.
+   *
+   * @param[in] stripe_idx Index of the stripe to check
+   * @param[in] col Index of the column to check
+   * @param[in] filter Predicate on the column's values
+   **/
+  bool row_index_may_match(size_type stripe_idx, int col, const column_filter &filter)
+  {
+    if (get_row_index_stride() == 0) { return true; }
+
+    const auto stripe = &ff.stripes[stripe_idx];
+    StripeFooter stripefooter;
+    read_stripe_footer(stripe, &stripefooter);
+
+    // The row index streams are stored first, in the index section of the stripe
+    uint64_t offset = 0;
+    for (const auto &stream : stripefooter.streams) {
+      if (offset + stream.length > stripe->indexLength) { break; }
+      if (stream.kind == orc::ROW_INDEX && stream.column == static_cast<uint32_t>(col)) {
+        const auto buffer = source->host_read(stripe->offset + offset, stream.length);
+        size_t index_length = 0;
+        auto index_data = decompressor->Decompress(buffer->data(), stream.length, &index_length);
+        RowIndex index;
+        ProtobufReader pb(index_data, index_length);
+        if (!pb.read(&index, index_length) || index.entry.empty()) { return true; }
+        for (const auto &entry : index.entry) {
+          ColumnStatisticsInfo stats;
+          pb.init(entry.statistics.data(), entry.statistics.size());
+          if (!pb.read(&stats, entry.statistics.size()) ||
+              statistics_may_match(ff.types[col], stats, filter)) {
+            return true;
+          }
+        }
+        return false;
+      }
+      offset += stream.length;
+    }
+    return true;
   }
 
   /**
@@ -161,24 +602,34 @@ class metadata {
    * @param[in] stripe Index of the stripe to select
    * @param[in] max_stripe_count Number of stripes to select for stripe-based selection
    * @param[in] stripe_indices Indices of individual stripes [max_stripe_count]
-   * @param[in] row_start Starting row of the selection
+   * @param[in] filters Predicates used to skip stripes based on their statistics
+   * @param[in,out] row_start Starting row of the selection
    * @param[in,out] row_count Total number of rows selected
    *
+   * Stripes that cannot satisfy the filters are dropped from the selection; in that case the row
+   * start and count refer to the rows of the remaining stripes.
+   *
    * @return List of stripe info and total number of selected rows
    **/
   auto select_stripes(size_type stripe,
                       size_type max_stripe_count,
                       const size_type *stripe_indices,
+                      const std::vector<column_filter> &filters,
                       size_type &row_start,
                       size_type &row_count)
   {
     std::vector<OrcStripeInfo> selection;
 
+    auto is_selected = [&](size_type stripe_idx) {
+      return filters.empty() || stripe_may_match(stripe_idx, filters);
+    };
+
     if (stripe_indices) {
       size_t stripe_rows = 0;
       for (auto i = 0; i < max_stripe_count; i++) {
         auto stripe_idx = stripe_indices[i];
         CUDF_EXPECTS(stripe_idx >= 0 && stripe_idx < get_num_stripes(), "Invalid stripe index");
+        if (!is_selected(stripe_idx)) { continue; }
         selection.emplace_back(&ff.stripes[stripe_idx], nullptr);
         stripe_rows += ff.stripes[stripe_idx].numberOfRows;
       }
@@ -188,22 +639,33 @@ class metadata {
       size_t stripe_rows = 0;
       do {
         if (row_count >= 0 && stripe_rows >= (size_t)row_count) { break; }
+        if (!is_selected(stripe)) { continue; }
         selection.emplace_back(&ff.stripes[stripe], nullptr);
         stripe_rows += ff.stripes[stripe].numberOfRows;
       } while (--max_stripe_count > 0 && ++stripe < get_num_stripes());
       row_count = (row_count < 0) ? static_cast<size_type>(stripe_rows)
                                   : std::min(row_count, static_cast<size_type>(stripe_rows));
     } else {
+      std::vector<size_type> candidates;
+      size_t total_rows = 0;
+      for (size_type i = 0; i < get_num_stripes(); ++i) {
+        if (is_selected(i)) {
+          candidates.push_back(i);
+          total_rows += ff.stripes[i].numberOfRows;
+        }
+      }
+
       row_start = std::max(row_start, 0);
       if (row_count < 0) {
         row_count = static_cast<size_type>(
-          std::min<size_t>(get_total_rows(), std::numeric_limits<size_type>::max()));
+          std::min<size_t>(total_rows, std::numeric_limits<size_type>::max()));
       }
       CUDF_EXPECTS(row_count >= 0, "Invalid row count");
-      CUDF_EXPECTS(static_cast<size_t>(row_start) <= get_total_rows(), "Invalid row start");
+      CUDF_EXPECTS(static_cast<size_t>(row_start) <= total_rows, "Invalid row start");
 
       size_type stripe_skip_rows = 0;
-      for (size_t i = 0, count = 0; i < ff.stripes.size(); ++i) {
+      size_t count               = 0;
+      for (const auto i : candidates) {
         count += ff.stripes[i].numberOfRows;
         if (count > static_cast<size_t>(row_start)) {
           if (selection.size() == 0) {
@@ -217,24 +679,21 @@ class metadata {
       row_start = stripe_skip_rows;
     }
 
-    // Read each stripe's stripefooter metadata
+    // Read each stripe's stripefooter metadata, unless already parsed
     if (not selection.empty()) {
-      orc::ProtobufReader pb;
-
-      stripefooters.resize(selection.size());
-      for (size_t i = 0; i < selection.size(); ++i) {
-        const auto stripe         = selection[i].first;
-        const auto sf_comp_offset = stripe->offset + stripe->indexLength + stripe->dataLength;
-        const auto sf_comp_length = stripe->footerLength;
-        CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(),
-                     "Invalid stripe information");
-
-        const auto buffer = source->host_read(sf_comp_offset, sf_comp_length);
-        size_t sf_length  = 0;
-        auto sf_data      = decompressor->Decompress(buffer->data(), sf_comp_length, &sf_length);
-        pb.init(sf_data, sf_length);
-        CUDF_EXPECTS(pb.read(&stripefooters[i], sf_length), "Cannot read stripefooter");
-        selection[i].second = &stripefooters[i];
+      std::vector<size_type> stripe_indices;
+      for (const auto &stripe_info : selection) {
+        stripe_indices.push_back(stripe_info.first - ff.stripes.data());
+      }
+      if (shared) {
+        for (size_t i = 0; i < selection.size(); ++i) {
+          selection[i].second = &shared->stripefooters[stripe_indices[i]];
+        }
+      } else {
+        read_stripe_footers(stripe_indices, stripefooters);
+        for (size_t i = 0; i < selection.size(); ++i) {
+          selection[i].second = &stripefooters[i];
+        }
       }
     }
 
@@ -288,13 +747,84 @@ class metadata {
  public:
   PostScript ps;
   FileFooter ff;
+  Metadata md;
   std::vector<StripeFooter> stripefooters;
   std::unique_ptr<OrcDecompressor> decompressor;
 
  private:
   datasource *const source;
+  size_t metadata_offset = 0;
+  std::shared_ptr<const file_metadata> shared;
 };
 
+namespace {
+/**
+ * @brief Process-wide cache of the parsed metadata of recently opened files.
+ *
+ * Entries are keyed on the file path and are only used while the modification time and the size
+ * of the file are unchanged. The least recently used entry is evicted when the cache is full.
+ **/
+class metadata_cache {
+  static constexpr size_t max_entries = 128;
+
+  struct entry {
+    int64_t mtime_ns;
+    size_t size;
+    std::shared_ptr<const file_metadata> parsed;
+  };
+  std::list<std::pair<std::string, entry>> entries;  // most recently used first
+  std::mutex mutex;
+
+ public:
+  static metadata_cache &instance()
+  {
+    static metadata_cache cache;
+    return cache;
+  }
+
+  /**
+   * @brief Returns the metadata of a file, parsing it only if not cached
+   *
+   * @param filepath Path of the file
+   * @param source Dataset source of the file
+   **/
+  std::unique_ptr<metadata> open(const std::string &filepath, datasource *source)
+  {
+    struct stat st;
+    if (stat(filepath.c_str(), &st) != 0) { return std::make_unique<metadata>(source); }
+    const int64_t mtime_ns = st.st_mtim.tv_sec * 1000000000ll + st.st_mtim.tv_nsec;
+    const size_t size      = st.st_size;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = std::find_if(
+        entries.begin(), entries.end(), [&](const auto &e) { return e.first == filepath; });
+      if (it != entries.end()) {
+        if (it->second.mtime_ns == mtime_ns && it->second.size == size) {
+          entries.splice(entries.begin(), entries, it);
+          return std::make_unique<metadata>(source, it->second.parsed);
+        }
+        entries.erase(it);
+      }
+    }
+
+    // Parse outside of the lock; concurrent opens of the same file may both parse it
+    auto file_md = std::make_unique<metadata>(source);
+    entry new_entry{mtime_ns, size, file_md->share()};
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = std::find_if(
+        entries.begin(), entries.end(), [&](const auto &e) { return e.first == filepath; });
+      if (it != entries.end()) { entries.erase(it); }
+      entries.emplace_front(filepath, std::move(new_entry));
+      if (entries.size() > max_entries) { entries.pop_back(); }
+    }
+    return file_md;
+  }
+};
+
+}  // namespace
+
 namespace {
 /**
  * @brief Struct that maps ORC streams to columns
@@ -400,6 +930,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   size_t row_index_stride,
   cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("orc_decompress", num_stripes);
   // Parse the columns' compressed info
   hostdevice_vector<gpu::CompressedStreamInfo> compinfo(0, stream_info.size(), stream);
   for (const auto &info : stream_info) {
@@ -478,6 +1009,10 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
         CUDA_TRY(gpu_unsnap(
           inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
         break;
+      case orc::ZSTD:
+        CUDA_TRY(gpu_unzstd(
+          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
+        break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
   }
@@ -532,16 +1067,20 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   return decomp_data;
 }
 
-void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
-                                      size_t num_dicts,
-                                      size_t skip_rows,
-                                      size_t num_rows,
-                                      const std::vector<int64_t> &timezone_table,
-                                      const rmm::device_vector<gpu::RowGroup> &row_groups,
-                                      size_t row_index_stride,
-                                      std::vector<column_buffer> &out_buffers,
-                                      cudaStream_t stream)
+void reader::impl::decode_stream_data(
+  hostdevice_vector<gpu::ColumnDesc> &chunks,
+  size_t num_dicts,
+  size_t skip_rows,
+  size_t num_rows,
+  const std::vector<int64_t> &timezone_table,
+  const rmm::device_vector<gpu::RowGroup> &row_groups,
+  size_t row_index_stride,
+  std::vector<column_buffer> &out_buffers,
+  const std::vector<bool> &dict_columns,
+  std::vector<rmm::device_vector<column_buffer::str_pair>> &dict_keys,
+  cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("orc_decode", num_rows);
   const auto num_columns = out_buffers.size();
   const auto num_stripes = chunks.size() / out_buffers.size();
 
@@ -590,15 +1129,40 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
       out_buffers[j].null_count() += chunks[i * num_columns + j].null_count;
     }
   }
+
+  // Gather the stripe dictionaries of the columns decoded to indices
+  for (size_t j = 0; j < num_columns; ++j) {
+    if (!dict_columns[j]) { continue; }
+    const auto &last_chunk = chunks[(num_stripes - 1) * num_columns + j];
+    dict_keys[j].resize(last_chunk.column_dict_start + last_chunk.dict_len);
+    for (size_t i = 0; i < num_stripes; ++i) {
+      const auto &chunk = chunks[i * num_columns + j];
+      if (chunk.dict_len == 0) { continue; }
+      const auto dict_data = reinterpret_cast<const char *>(chunk.streams[gpu::CI_DICTIONARY]);
+      const auto entries   = global_dict.begin() + chunk.dictionary_start;
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        entries,
+                        entries + chunk.dict_len,
+                        dict_keys[j].begin() + chunk.column_dict_start,
+                        [dict_data] __device__(const gpu::DictionaryEntry &entry) {
+                          return column_buffer::str_pair(dict_data + entry.pos, entry.len);
+                        });
+    }
+  }
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
+                   std::string const &filepath,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _source(std::move(source)), _mr(mr)
 {
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  if (options.cache_metadata && !filepath.empty()) {
+    _metadata = metadata_cache::instance().open(filepath, _source.get());
+  } else {
+    _metadata = std::make_unique<metadata>(_source.get());
+  }
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, _has_timestamp_column);
@@ -612,9 +1176,24 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Enable or disable the conversion to numpy-compatible dtypes
   _use_np_dtypes = options.use_np_dtypes;
 
+  // Strings may be returned as either string or dictionary columns
+  _strings_to_dictionary = options.strings_to_dictionary;
+
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimals_as_float     = options.decimals_as_float;
   _decimals_as_int_scale = options.forced_decimals_scale;
+
+  // Stripes are skipped using statistics of the filtered columns
+  for (const auto &filter : options.filters) {
+    CUDF_EXPECTS(_metadata->find_column(filter.column_name) >= 0, "Filter column not found");
+    CUDF_EXPECTS(
+      !filter.values.empty() && (filter.op == filter_op::IN || filter.values.size() == 1),
+      "Invalid number of filter values");
+  }
+  _filters = options.filters;
+  if (!_filters.empty() && _metadata->md.stripeStats.empty()) {
+    _metadata->read_stripe_statistics();
+  }
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -629,7 +1208,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
   // Select only stripes required (aka row groups)
   const auto selected_stripes =
-    _metadata->select_stripes(stripe, max_stripe_count, stripe_indices, skip_rows, num_rows);
+    _metadata->select_stripes(
+      stripe, max_stripe_count, stripe_indices, _filters, skip_rows, num_rows);
 
   // Association between each ORC column and its cudf::column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
@@ -637,10 +1217,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   // Get a list of column data types
   std::vector<data_type> column_types;
   for (const auto &col : _selected_columns) {
-    auto col_type = to_type_id(
-      _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float);
+    auto col_type = to_type_id(_metadata->ff.types[col],
+                               _use_np_dtypes,
+                               _timestamp_type.id(),
+                               _decimals_as_float,
+                               _strings_to_dictionary);
     CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-    column_types.emplace_back(col_type);
+    column_types.push_back(
+      to_data_type(col_type, _metadata->ff.types[col], _decimals_as_int_scale));
 
     // Map each ORC column to its column
     orc_col_map[col] = column_types.size() - 1;
@@ -648,10 +1232,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
   // If no rows or stripes to read, return empty columns
   if (num_rows <= 0 || selected_stripes.size() == 0) {
-    std::transform(column_types.cbegin(),
-                   column_types.cend(),
-                   std::back_inserter(out_columns),
-                   [](auto const &dtype) { return make_empty_column(dtype); });
+    for (auto const &dtype : column_types) {
+      if (dtype.id() == type_id::DICTIONARY32) {
+        column_buffer empty_strings(data_type{type_id::STRING}, 0, false, stream, _mr);
+        out_columns.emplace_back(make_dictionary_output(0, empty_strings, nullptr, stream, _mr));
+      } else {
+        out_columns.emplace_back(make_empty_column(dtype));
+      }
+    }
   } else {
     const auto num_columns = _selected_columns.size();
     const auto num_chunks  = selected_stripes.size() * num_columns;
@@ -674,6 +1262,16 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
+    // Host reads of all stripes are issued up front and complete in the background
+    struct pending_read {
+      std::future<std::unique_ptr<datasource::buffer>> buffer;
+      uint8_t *dst;
+      size_t offset;
+      size_t size;
+    };
+    std::vector<pending_read> host_reads;
+    const auto cache_key = _source->cache_key();
+
     size_t stripe_start_row = 0;
     size_t num_dict_entries = 0;
     size_t num_rowgroups    = 0;
@@ -709,9 +1307,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           len += stream_info[stream_count].length;
           stream_count++;
         }
-        const auto buffer = _source->host_read(offset, len);
-        CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
+        if (read_cached_range(cache_key, offset, len, d_dst, stream)) { continue; }
+        if (_source->supports_device_read()) {
+          CUDF_EXPECTS(_source->device_read(offset, len, d_dst) == len,
+                       "Unexpected end of stripe data");
+          cache_range(cache_key, offset, len, d_dst, stream);
+        } else {
+          host_reads.push_back({_source->host_read_async(offset, len), d_dst, offset, len});
+        }
       }
 
       // Update chunks to reference streams pointers
@@ -730,7 +1333,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           chunk.decimal_scale = _decimals_as_int_scale;
         }
         chunk.rowgroup_id = num_rowgroups;
-        chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
+        chunk.dtype_len   = (column_types[j].id() == type_id::STRING ||
+                           column_types[j].id() == type_id::DICTIONARY32)
                             ? sizeof(std::pair<const char *, size_t>)
                             : cudf::size_of(column_types[j]);
         if (chunk.type_kind == orc::TIMESTAMP) {
@@ -749,6 +1353,38 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       }
     }
 
+    // Dictionary columns are decoded to indices into their stripe dictionaries if all their
+    // stripes are dictionary-encoded, otherwise to strings that are encoded afterwards
+    std::vector<bool> dict_columns(num_columns);
+    for (size_t j = 0; j < num_columns; j++) {
+      dict_columns[j] = (column_types[j].id() == type_id::DICTIONARY32);
+    }
+    for (const auto &chunk : chunks) {
+      const auto j = &chunk - chunks.host_ptr();
+      if (chunk.encoding_kind != orc::DICTIONARY && chunk.encoding_kind != orc::DICTIONARY_V2) {
+        dict_columns[j % num_columns] = false;
+      }
+    }
+    std::vector<uint32_t> column_dict_entries(num_columns, 0);
+    for (size_t i = 0; i < selected_stripes.size(); ++i) {
+      for (size_t j = 0; j < num_columns; j++) {
+        auto &chunk = chunks[i * num_columns + j];
+        if (dict_columns[j]) {
+          chunk.dtype_len         = sizeof(int32_t);
+          chunk.column_dict_start = column_dict_entries[j];
+          column_dict_entries[j] += chunk.dict_len;
+        }
+      }
+    }
+
+    // Transfer the stripe data as the reads complete
+    for (auto &read : host_reads) {
+      const auto buffer = read.buffer.get();
+      CUDF_EXPECTS(buffer->size() == read.size, "Unexpected end of stripe data");
+      copy_host_to_device(read.dst, buffer->data(), read.size, stream);
+      cache_range(cache_key, read.offset, read.size, read.dst, stream);
+    }
+
     // Process dataset chunk pages into output columns
     if (stripe_data.size() != 0) {
       // Setup row group descriptors if using indexes
@@ -799,9 +1435,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             break;
           }
         }
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        auto buffer_type = column_types[i];
+        if (buffer_type.id() == type_id::DICTIONARY32) {
+          buffer_type = data_type{dict_columns[i] ? type_id::INT32 : type_id::STRING};
+        }
+        out_buffers.emplace_back(buffer_type, num_rows, is_nullable, stream, _mr);
       }
 
+      std::vector<rmm::device_vector<column_buffer::str_pair>> dict_keys(column_types.size());
       decode_stream_data(chunks,
                          num_dict_entries,
                          skip_rows,
@@ -810,11 +1451,21 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          row_groups,
                          _metadata->get_row_index_stride(),
                          out_buffers,
+                         dict_columns,
+                         dict_keys,
                          stream);
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        if (column_types[i].id() == type_id::DICTIONARY32) {
+          out_columns.emplace_back(make_dictionary_output(num_rows,
+                                                          out_buffers[i],
+                                                          dict_columns[i] ? &dict_keys[i] : nullptr,
+                                                          stream,
+                                                          _mr));
+        } else {
+          out_columns.emplace_back(
+            make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        }
       }
     }
   }
@@ -832,11 +1483,129 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+std::vector<std::pair<size_type, size_type>> reader::impl::filter_stripes(
+  const std::vector<size_type> &stripe_list)
+{
+  std::vector<size_type> candidates(stripe_list);
+  if (candidates.empty()) {
+    candidates.resize(_metadata->get_num_stripes());
+    std::iota(candidates.begin(), candidates.end(), 0);
+  }
+
+  std::vector<std::pair<size_type, size_type>> selection;
+  for (const auto stripe_idx : candidates) {
+    CUDF_EXPECTS(stripe_idx >= 0 && stripe_idx < _metadata->get_num_stripes(),
+                 "Invalid stripe index");
+    if (_filters.empty() || _metadata->stripe_may_match(stripe_idx, _filters)) {
+      selection.emplace_back(
+        stripe_idx, static_cast<size_type>(_metadata->ff.stripes[stripe_idx].numberOfRows));
+    }
+  }
+  return selection;
+}
+
+std::vector<std::pair<size_type, size_type>> reader::impl::compute_row_splits(
+  size_t chunk_read_limit, size_type skip_rows, size_type num_rows)
+{
+  std::vector<std::pair<size_type, size_type>> splits;
+  if (chunk_read_limit == 0) { chunk_read_limit = std::numeric_limits<size_t>::max(); }
+
+  // The selection returns the first row to read relative to the first selected stripe
+  const size_t start_row = std::max(skip_rows, 0);
+  const auto selected_stripes =
+    _metadata->select_stripes(-1, -1, nullptr, _filters, skip_rows, num_rows);
+  if (selected_stripes.empty() || num_rows <= 0) { return splits; }
+  if (_metadata->md.stripeStats.empty()) { _metadata->read_stripe_statistics(); }
+
+  std::vector<data_type> column_types;
+  for (const auto &col : _selected_columns) {
+    auto const col_type = to_type_id(_metadata->ff.types[col],
+                                     _use_np_dtypes,
+                                     _timestamp_type.id(),
+                                     _decimals_as_float,
+                                     _strings_to_dictionary);
+    column_types.push_back(
+      to_data_type(col_type, _metadata->ff.types[col], _decimals_as_int_scale));
+  }
+
+  // Estimates the peak device memory needed to read one stripe
+  auto estimate_read_size = [&](size_t stripe_idx,
+                                const StripeInformation *stripe,
+                                const StripeFooter *stripefooter) {
+    const size_t rows = stripe->numberOfRows;
+    size_t size       = 0;
+    for (size_t i = 0; i < _selected_columns.size(); ++i) {
+      const auto col     = _selected_columns[i];
+      size_t stream_size = 0;
+      bool has_nulls     = false;
+      for (const auto &stream : stripefooter->streams) {
+        if (stream.column != static_cast<uint32_t>(col)) { continue; }
+        stream_size += stream.length;
+        has_nulls |= (stream.kind == orc::PRESENT);
+      }
+
+      size_t output_size = 0;
+      if (column_types[i].id() == type_id::STRING ||
+          column_types[i].id() == type_id::DICTIONARY32) {
+        // Use the total string length from the stripe statistics, if present
+        size_t char_bytes = stream_size;
+        if (stripe_idx < _metadata->md.stripeStats.size() &&
+            static_cast<size_t>(col) < _metadata->md.stripeStats[stripe_idx].colStats.size()) {
+          const auto &blob = _metadata->md.stripeStats[stripe_idx].colStats[col];
+          ColumnStatisticsInfo stats;
+          ProtobufReader pb(blob.data(), blob.size());
+          if (pb.read(&stats, blob.size()) && stats.stringStatistics.has_sum) {
+            char_bytes = std::max<int64_t>(stats.stringStatistics.sum, 0);
+          }
+        }
+        // String descriptors, then the output characters and offsets
+        output_size =
+          rows * sizeof(gpu::nvstrdesc_s) + char_bytes + (rows + 1) * sizeof(size_type);
+      } else {
+        output_size = rows * size_of(column_types[i]);
+      }
+      if (has_nulls) { output_size += bitmask_allocation_size_bytes(rows); }
+
+      // Decompressed streams are assumed to be no larger than the decoded output
+      size += stream_size + output_size;
+      if (_metadata->ps.compression != orc::NONE) { size += std::max(stream_size, output_size); }
+    }
+    return size;
+  };
+
+  const size_t end_row = start_row + static_cast<size_t>(num_rows);
+  size_t stripe_start  = start_row - skip_rows;
+  size_t split_start   = start_row;
+  size_t split_end     = start_row;
+  size_t split_size    = 0;
+  for (const auto &selected : selected_stripes) {
+    const auto stripe         = selected.first;
+    const size_t stripe_idx   = stripe - _metadata->ff.stripes.data();
+    const size_t stripe_begin = std::max(stripe_start, start_row);
+    stripe_start += stripe->numberOfRows;
+    const size_t stripe_end = std::min(stripe_start, end_row);
+    if (stripe_end <= stripe_begin) { continue; }
+    split_end = stripe_end;
+
+    // Stripes are read whole, so a stripe larger than the limit is read by itself
+    const auto stripe_size = estimate_read_size(stripe_idx, stripe, selected.second);
+    if (split_size != 0 && split_size + stripe_size > chunk_read_limit) {
+      splits.emplace_back(split_start, stripe_begin - split_start);
+      split_start = stripe_begin;
+      split_size  = 0;
+    }
+    split_size += stripe_size;
+  }
+  if (split_size != 0) { splits.emplace_back(split_start, split_end - split_start); }
+
+  return splits;
+}
+
 // Forward to implementation
 reader::reader(std::string filepath,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr))
+  : _impl(std::make_unique<impl>(datasource::create(filepath), filepath, options, mr))
 {
 }
 
@@ -844,7 +1613,7 @@ reader::reader(std::string filepath,
 reader::reader(std::unique_ptr<cudf::io::datasource> source,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(std::move(source), options, mr))
+  : _impl(std::make_unique<impl>(std::move(source), std::string{}, options, mr))
 {
 }
 
@@ -873,12 +1642,75 @@ table_with_metadata reader::read_stripes(const std::vector<size_type> &stripe_li
     0, -1, -1, static_cast<size_type>(stripe_list.size()), stripe_list.data(), stream);
 }
 
+// Forward to implementation
+std::vector<std::pair<size_type, size_type>> reader::filter_stripes(
+  const std::vector<size_type> &stripe_list)
+{
+  return _impl->filter_stripes(stripe_list);
+}
+
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream)
 {
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr, stream);
 }
 
+// Forward to implementation
+std::vector<std::pair<size_type, size_type>> reader::compute_row_splits(size_t chunk_read_limit,
+                                                                        size_type skip_rows,
+                                                                        size_type num_rows)
+{
+  return _impl->compute_row_splits(
+    chunk_read_limit, skip_rows, (num_rows != 0) ? num_rows : -1);
+}
+
+source_metadata read_metadata(datasource *source)
+{
+  metadata file_md(source);
+  file_md.read_stripe_statistics();
+  const auto &ff = file_md.ff;
+
+  source_metadata result;
+  result.num_rows = ff.numberOfRows;
+  std::vector<uint32_t> leaf_columns;
+  for (size_t i = 0; i < ff.types.size(); ++i) {
+    if (!ff.types[i].subtypes.empty()) { continue; }
+    leaf_columns.push_back(i);
+    result.column_names.push_back(ff.GetColumnName(i));
+    result.column_types.emplace_back(
+      to_type_id(ff.types[i], true, type_id::EMPTY, true, false));
+  }
+
+  const auto &top_level = ff.types[0].subtypes;
+  for (size_t s = 0; s < ff.stripes.size(); ++s) {
+    const auto &stripe = ff.stripes[s];
+    row_group_metadata stripe_md;
+    stripe_md.num_rows  = stripe.numberOfRows;
+    stripe_md.byte_size = stripe.indexLength + stripe.dataLength + stripe.footerLength;
+    stripe_md.columns.resize(leaf_columns.size());
+    if (s < file_md.md.stripeStats.size()) {
+      const auto &col_stats = file_md.md.stripeStats[s].colStats;
+      for (size_t i = 0; i < leaf_columns.size(); ++i) {
+        const auto col = leaf_columns[i];
+        if (col >= col_stats.size()) { continue; }
+        ColumnStatisticsInfo stats;
+        ProtobufReader pb(col_stats[col].data(), col_stats[col].size());
+        if (!pb.read(&stats, col_stats[col].size())) { continue; }
+        auto &chunk = stripe_md.columns[i];
+        // Nested values are counted per parent row, so null counts are only exact at the top
+        if (stats.has_numberOfValues &&
+            std::find(top_level.begin(), top_level.end(), col) != top_level.end()) {
+          chunk.null_count = stripe.numberOfRows - stats.numberOfValues;
+        }
+        chunk.has_minmax = decode_statistics(
+          ff.types[col], result.column_types[i], stats, chunk.min_value, chunk.max_value);
+      }
+    }
+    result.row_groups.push_back(std::move(stripe_md));
+  }
+  return result;
+}
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
@@ -57,10 +57,12 @@ class reader::impl {
    * @brief Constructor from a dataset source with reader options.
    *
    * @param source Dataset source
+   * @param filepath Path of the dataset file; empty if the source is not a file
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
   explicit impl(std::unique_ptr<datasource> source,
+                std::string const &filepath,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -83,6 +85,35 @@ class reader::impl {
                            const size_type *stripe_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Returns the stripes that may contain rows satisfying the filters
+   *
+   * @param stripe_list Indices of the stripes to check; empty for all stripes
+   *
+   * @return List of (stripe index, number of rows) pairs
+   */
+  std::vector<std::pair<size_type, size_type>> filter_stripes(
+    const std::vector<size_type> &stripe_list);
+
+  /**
+   * @brief Splits a range of rows into consecutive row ranges, each of which can be read within
+   * the given device memory budget
+   *
+   * The estimate for each stripe includes the compressed stream data of the selected columns, the
+   * decompressed stream data and the decoded output columns. Ranges are made of whole stripes, as
+   * the streams of a stripe are decompressed in full; a stripe whose estimate exceeds the budget
+   * makes up a range by itself.
+   *
+   * @param chunk_read_limit Device memory budget in bytes for reading each row range
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; `-1` for all remaining rows
+   *
+   * @return List of row ranges as pairs of (skip_rows, num_rows)
+   */
+  std::vector<std::pair<size_type, size_type>> compute_row_splits(size_t chunk_read_limit,
+                                                                  size_type skip_rows,
+                                                                  size_type num_rows);
+
  private:
   /**
    * @brief Decompresses the stripe data, at stream granularity
@@ -118,6 +149,8 @@ class reader::impl {
    * @param row_groups List of row index descriptors
    * @param row_index_stride Distance between each row index
    * @param out_buffers Output columns' device buffers
+   * @param dict_columns Whether each column is decoded to indices into its stripe dictionaries
+   * @param dict_keys Output concatenated stripe dictionaries of columns decoded to indices
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
@@ -128,6 +161,8 @@ class reader::impl {
                           const rmm::device_vector<gpu::RowGroup> &row_groups,
                           size_t row_index_stride,
                           std::vector<column_buffer> &out_buffers,
+                          const std::vector<bool> &dict_columns,
+                          std::vector<rmm::device_vector<column_buffer::str_pair>> &dict_keys,
                           cudaStream_t stream);
 
  private:
@@ -136,12 +171,14 @@ class reader::impl {
   std::unique_ptr<metadata> _metadata;
 
   std::vector<int> _selected_columns;
-  bool _use_index            = true;
-  bool _use_np_dtypes        = true;
-  bool _has_timestamp_column = false;
-  bool _decimals_as_float    = true;
-  int _decimals_as_int_scale = -1;
+  bool _use_index             = true;
+  bool _use_np_dtypes         = true;
+  bool _has_timestamp_column  = false;
+  bool _decimals_as_float     = true;
+  bool _strings_to_dictionary = false;
+  int _decimals_as_int_scale  = -1;
   data_type _timestamp_type{type_id::EMPTY};
+  std::vector<column_filter> _filters;
 };
 
 }  // namespace orc
@@ -17,6 +17,7 @@
 #include <io/utilities/block_utils.cuh>
 #include "orc_common.h"
 #include "orc_gpu.h"
+#include "timezone.cuh"
 
 #define LOG2_BYTESTREAM_BFRSZ 13  // Must be able to handle 512x 8-byte values
 
@@ -1371,43 +1372,12 @@ static __device__ int64_t ConvertToUTC(const orc_datadec_state_s *s,
                                        const int64_t *table,
                                        int64_t ts)
 {
-  uint32_t num_entries     = s->tz_num_entries;
-  uint32_t dst_cycle       = s->tz_dst_cycle;
-  int64_t first_transition = s->first_tz_transition;
-  int64_t last_transition  = s->last_tz_transition;
-  int64_t tsbase;
-  uint32_t first, last;
-
-  if (ts <= first_transition) {
-    return ts + table[0 * 2 + 2];
-  } else if (ts <= last_transition) {
-    first  = 0;
-    last   = num_entries - 1;
-    tsbase = ts;
-  } else if (!dst_cycle) {
-    return ts + table[(num_entries - 1) * 2 + 2];
-  } else {
-    // Apply 400-year cycle rule
-    const int64_t k400Years = (365 * 400 + (100 - 3)) * 24 * 60 * 60ll;
-    tsbase                  = ts;
-    ts %= k400Years;
-    if (ts < 0) { ts += k400Years; }
-    first = num_entries;
-    last  = num_entries + dst_cycle - 1;
-    if (ts < table[num_entries * 2 + 1]) { return tsbase + table[last * 2 + 2]; }
-  }
-  // Binary search the table from first to last for ts
-  do {
-    uint32_t mid = first + ((last - first + 1) >> 1);
-    int64_t tmid = table[mid * 2 + 1];
-    if (tmid <= ts) {
-      first = mid;
-    } else {
-      if (mid == last) { break; }
-      last = mid;
-    }
-  } while (first < last);
-  return tsbase + table[first * 2 + 2];
+  return ts + GetGmtOffset(table,
+                           s->tz_num_entries,
+                           s->tz_dst_cycle,
+                           s->first_tz_transition,
+                           s->last_tz_transition,
+                           ts);
 }
 
 /**
@@ -1494,10 +1464,10 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
     }
     if (!IS_DICTIONARY(s->chunk.encoding_kind)) { s->chunk.dictionary_start = 0; }
     if (tz_len > 0) {
-      if (tz_len > 800)  // 2 entries/year for 400 years
+      if (tz_len > tz_dst_cycle_entries)  // 2 entries/year for 400 years
       {
-        s->top.data.tz_num_entries = tz_len - 800;
-        s->top.data.tz_dst_cycle   = 800;
+        s->top.data.tz_num_entries = tz_len - tz_dst_cycle_entries;
+        s->top.data.tz_dst_cycle   = tz_dst_cycle_entries;
       } else {
         s->top.data.tz_num_entries = tz_len;
         s->top.data.tz_dst_cycle   = 0;
@@ -1742,6 +1712,13 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
             case BINARY:
             case VARCHAR:
             case CHAR: {
+              if (s->chunk.dtype_len == sizeof(int32_t)) {
+                // Output indices into the column's concatenated stripe dictionaries
+                uint32_t dict_idx = s->vals.u32[t + vals_skipped];
+                reinterpret_cast<int32_t *>(data_out)[row] =
+                  (dict_idx < s->chunk.dict_len) ? s->chunk.column_dict_start + dict_idx : -1;
+                break;
+              }
               nvstrdesc_s *strdesc = &reinterpret_cast<nvstrdesc_s *>(data_out)[row];
               const uint8_t *ptr;
               uint32_t count;
@@ -756,8 +756,8 @@ extern "C" __global__ void __launch_bounds__(512)
           case FLOAT: s->vals.u32[nz_idx] = reinterpret_cast<const uint32_t *>(base)[row]; break;
           case DOUBLE:
           case LONG: s->vals.u64[nz_idx] = reinterpret_cast<const uint64_t *>(base)[row]; break;
-          case SHORT: s->vals.u32[nz_idx] = reinterpret_cast<const uint16_t *>(base)[row]; break;
-          case BOOLEAN:
+          case SHORT: s->vals.i32[nz_idx] = reinterpret_cast<const int16_t *>(base)[row]; break;
+          case BOOLEAN: s->vals.u8[nz_idx] = (base[row] != 0); break;
           case BYTE: s->vals.u8[nz_idx] = reinterpret_cast<const uint8_t *>(base)[row]; break;
           case TIMESTAMP: {
             int64_t ts       = reinterpret_cast<const int64_t *>(base)[row];
@@ -1270,6 +1270,7 @@ cudaError_t CompactOrcDataStreams(StripeStream *strm_desc,
  * @param[in] num_stripe_streams Total number of streams
  * @param[in] num_compressed_blocks Total number of compressed blocks
  * @param[in] compression Type of compression
+ * @param[in] compression_level Compression level of ZLIB and ZSTD, 0 for the default
  * @param[in] comp_blk_size Compression block size
  * @param[in] stream CUDA stream to use, default 0
  *
@@ -1283,6 +1284,7 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
                                    uint32_t num_stripe_streams,
                                    uint32_t num_compressed_blocks,
                                    CompressionKind compression,
+                                   int compression_level,
                                    uint32_t comp_blk_size,
                                    cudaStream_t stream)
 {
@@ -1290,7 +1292,16 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
   dim3 dim_grid(num_stripe_streams, 1);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream>>>(
     strm_desc, chunks, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  switch (compression) {
+    case SNAPPY: gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); break;
+    case ZLIB:
+      gpu_deflate(comp_in, comp_out, num_compressed_blocks, compression_level, 0, stream);
+      break;
+    case ZSTD:
+      gpu_zstd(comp_in, comp_out, num_compressed_blocks, compression_level, stream);
+      break;
+    default: break;
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
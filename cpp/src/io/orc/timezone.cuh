@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Number of entries at the end of a transition table forming the 400-year daylight
+ * savings cycle (2 transitions/year)
+ **/
+constexpr uint32_t tz_dst_cycle_entries = 800;
+
+/**
+ * @brief Device view of a table built with `BuildTimezoneTransitionTable`
+ **/
+struct timezone_table_view {
+  const int64_t *table = nullptr;  // 1st entry = gmtOffset, then (transition, offset) pairs
+  uint32_t num_entries = 0;        // number of transitions before the daylight savings cycle
+  uint32_t dst_cycle   = 0;        // number of transitions in the daylight savings cycle
+
+  timezone_table_view() = default;
+
+  /**
+   * @brief Constructs a view of a device transition table of `len` int64_t values
+   **/
+  timezone_table_view(const int64_t *tz_table, size_t len) : table(tz_table)
+  {
+    auto num_pairs = static_cast<uint32_t>(len >> 1);
+    if (num_pairs > tz_dst_cycle_entries) {
+      num_entries = num_pairs - tz_dst_cycle_entries;
+      dst_cycle   = tz_dst_cycle_entries;
+    } else {
+      num_entries = num_pairs;
+    }
+  }
+};
+
+/**
+ * @brief Returns the offset in seconds from UTC to local time in effect at UTC time `ts`
+ *
+ * @param[in] table Timezone translation table
+ * @param[in] num_entries Number of transitions before the daylight savings cycle
+ * @param[in] dst_cycle Number of transitions in the daylight savings cycle
+ * @param[in] first_transition First transition time in the table
+ * @param[in] last_transition Last transition time before the daylight savings cycle
+ * @param[in] ts UTC time in seconds
+ *
+ * @return Offset in seconds
+ **/
+inline __device__ int64_t GetGmtOffset(const int64_t *table,
+                                       uint32_t num_entries,
+                                       uint32_t dst_cycle,
+                                       int64_t first_transition,
+                                       int64_t last_transition,
+                                       int64_t ts)
+{
+  uint32_t first, last;
+
+  if (ts <= first_transition) {
+    return table[0 * 2 + 2];
+  } else if (ts <= last_transition) {
+    first = 0;
+    last  = num_entries - 1;
+  } else if (!dst_cycle) {
+    return table[(num_entries - 1) * 2 + 2];
+  } else {
+    // Apply 400-year cycle rule
+    const int64_t k400Years = (365 * 400 + (100 - 3)) * 24 * 60 * 60ll;
+    ts %= k400Years;
+    if (ts < 0) { ts += k400Years; }
+    first = num_entries;
+    last  = num_entries + dst_cycle - 1;
+    if (ts < table[num_entries * 2 + 1]) { return table[last * 2 + 2]; }
+  }
+  // Binary search the table from first to last for ts
+  do {
+    uint32_t mid = first + ((last - first + 1) >> 1);
+    int64_t tmid = table[mid * 2 + 1];
+    if (tmid <= ts) {
+      first = mid;
+    } else {
+      if (mid == last) { break; }
+      last = mid;
+    }
+  } while (first < last);
+  return table[first * 2 + 2];
+}
+
+/**
+ * @brief Returns the offset in seconds from UTC to local time in effect at UTC time `ts`
+ *
+ * @param[in] tz Timezone translation table, empty for UTC
+ * @param[in] ts UTC time in seconds
+ *
+ * @return Offset in seconds
+ **/
+inline __device__ int64_t GetGmtOffset(const timezone_table_view &tz, int64_t ts)
+{
+  if (tz.num_entries == 0) { return 0; }
+  return GetGmtOffset(tz.table,
+                      tz.num_entries,
+                      tz.dst_cycle,
+                      tz.table[1],
+                      tz.table[(tz.num_entries - 1) * 2 + 1],
+                      ts);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -21,6 +21,7 @@
 
 #include "writer_impl.hpp"
 
+#include <cudf/concatenate.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -53,11 +54,31 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::GZIP:
+    case compression_type::DEFLATE: return orc::CompressionKind::ZLIB;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
 }
 
+/**
+ * @brief Returns the uncompressed size of a table, estimated as when deciding stripe boundaries
+ **/
+size_t estimate_uncompressed_size(table_view const &table)
+{
+  size_t size = 0;
+  for (auto const &col : table) {
+    if (col.type().id() == type_id::STRING) {
+      size += col.size();
+      if (col.size() > 0) { size += strings_column_view(col).chars_size(); }
+    } else {
+      size += cudf::size_of(col.type()) * col.size();
+    }
+  }
+  return size;
+}
+
 /**
  * @brief Function that translates GDF dtype to ORC datatype
  **/
@@ -926,10 +947,14 @@ void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
   if (length != 0) {
     const auto *stream_in = (compression_kind_ == NONE) ? chunk.streams[strm_desc.strm_type]
                                                         : (compressed_data + strm_desc.bfr_offset);
-    CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    if (out_sink_->supports_device_write()) {
+      out_sink_->device_write(stream_in, length, stream);
+    } else {
+      CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
 
-    out_sink_->host_write(stream_out, length);
+      out_sink_->host_write(stream_out, length);
+    }
   }
   stripe.dataLength += length;
 }
@@ -957,11 +982,21 @@ void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t> &v)
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : compression_kind_(to_orc_compression(options.compression)),
+  : max_stripe_size_(options.stripe_size_bytes),
+    max_stripe_rows_(std::max<size_type>(options.stripe_size_rows, 0)),
+    row_index_stride_(options.row_index_stride),
+    compression_kind_(to_orc_compression(options.compression)),
+    compression_level_(options.compression_level),
     enable_statistics_(options.enable_statistics),
+    buffer_tables_(options.buffer_tables),
     out_sink_(std::move(sink)),
     _mr(mr)
 {
+  CUDF_EXPECTS(options.stripe_size_bytes >= 64 * 1024, "Stripe size must be at least 64KB");
+  CUDF_EXPECTS(options.stripe_size_rows == -1 || options.stripe_size_rows >= 512,
+               "Stripe size must be at least 512 rows");
+  CUDF_EXPECTS(options.row_index_stride >= 512 && options.row_index_stride % 8 == 0,
+               "Row index stride must be a multiple of 8, of at least 512 rows");
 }
 
 void writer::impl::write(table_view const &table,
@@ -985,6 +1020,41 @@ void writer::impl::write_chunked_begin(orc_chunked_state &state)
 }
 
 void writer::impl::write_chunked(table_view const &table, orc_chunked_state &state)
+{
+  if (!buffer_tables_ || state.single_write_mode) {
+    write_table(table, state);
+    return;
+  }
+
+  // Buffer a copy of the table, as the caller may release it before the next call
+  const bool has_strings = std::any_of(
+    table.begin(), table.end(), [](auto const &col) { return col.type().id() == type_id::STRING; });
+  state.buffered_tables.push_back(std::make_unique<cudf::table>(table, state.stream));
+  state.buffered_rows += table.num_rows();
+  state.buffered_bytes += estimate_uncompressed_size(table);
+  if (state.buffered_rows >= get_max_stripe_rows(has_strings) ||
+      state.buffered_bytes >= max_stripe_size_) {
+    flush_buffered_tables(state);
+  }
+}
+
+void writer::impl::flush_buffered_tables(orc_chunked_state &state)
+{
+  if (state.buffered_tables.empty()) { return; }
+
+  std::vector<table_view> views;
+  for (auto const &buffered : state.buffered_tables) { views.push_back(buffered->view()); }
+  if (views.size() == 1) {
+    write_table(views[0], state);
+  } else {
+    write_table(cudf::concatenate(views)->view(), state);
+  }
+  state.buffered_tables.clear();
+  state.buffered_rows  = 0;
+  state.buffered_bytes = 0;
+}
+
+void writer::impl::write_table(table_view const &table, orc_chunked_state &state)
 {
   size_type num_columns = table.num_columns();
   size_type num_rows    = 0;
@@ -1043,8 +1113,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       }
     }
 
-    // Apply rows per stripe limit to limit string dictionaries
-    const size_t max_stripe_rows = !str_col_ids.empty() ? 1000000 : 5000000;
+    const size_t max_stripe_rows = get_max_stripe_rows(!str_col_ids.empty());
     if ((g > stripe_start) && (stripe_size + rowgroup_size > max_stripe_size_ ||
                                (g + 1 - stripe_start) * row_index_stride_ > max_stripe_rows)) {
       stripe_list.push_back(g - stripe_start);
@@ -1139,6 +1208,10 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       }
     }
 
+    // if the writer supports device_write(), we don't need this scratch space
+    if (out_sink_->supports_device_write()) {
+      return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
+    }
     return pinned_buffer<uint8_t>{[](size_t size) {
                                     uint8_t *ptr = nullptr;
                                     CUDA_TRY(cudaMallocHost(&ptr, size));
@@ -1165,6 +1238,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                                          num_stripe_streams,
                                          num_compressed_blocks,
                                          compression_kind_,
+                                         compression_level_,
                                          compression_blocksize_,
                                          state.stream));
     CUDA_TRY(cudaMemcpyAsync(strm_desc.host_ptr(),
@@ -1313,6 +1387,8 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
 
 void writer::impl::write_chunked_end(orc_chunked_state &state)
 {
+  flush_buffered_tables(state);
+
   ProtobufWriter pbw_(&buffer_);
   PostScript ps;
 
@@ -111,6 +111,35 @@ class writer::impl {
   void write_chunked_end(orc_chunked_state& state);
 
  private:
+  /**
+   * @brief Encodes a table as one or more stripes and writes them out.
+   *
+   * @param[in] table The table information to be written
+   * @param[in] orc_chunked_state State information that crosses _begin() / write_chunked() / _end()
+   * boundaries.
+   */
+  void write_table(table_view const& table, orc_chunked_state& state);
+
+  /**
+   * @brief Writes out the tables buffered by write_chunked(), as a single table.
+   *
+   * @param[in] orc_chunked_state State information that crosses _begin() / write_chunked() / _end()
+   * boundaries.
+   */
+  void flush_buffered_tables(orc_chunked_state& state);
+
+  /**
+   * @brief Returns the maximum number of rows in a stripe
+   *
+   * @param has_strings Whether the table has string columns
+   **/
+  size_t get_max_stripe_rows(bool has_strings) const
+  {
+    if (max_stripe_rows_ > 0) { return max_stripe_rows_; }
+    // Limit the size of the string dictionaries
+    return has_strings ? 1000000 : 5000000;
+  }
+
   /**
    * @brief Builds up column dictionaries indices
    *
@@ -329,12 +358,15 @@ class writer::impl {
   rmm::mr::device_memory_resource* _mr = nullptr;
 
   size_t max_stripe_size_           = DEFAULT_STRIPE_SIZE;
+  size_t max_stripe_rows_           = 0;
   size_t row_index_stride_          = DEFAULT_ROW_INDEX_STRIDE;
   size_t compression_blocksize_     = DEFAULT_COMPRESSION_BLOCKSIZE;
   CompressionKind compression_kind_ = CompressionKind::NONE;
+  int compression_level_            = 0;
 
   bool enable_dictionary_ = true;
   bool enable_statistics_ = true;
+  bool buffer_tables_     = false;
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
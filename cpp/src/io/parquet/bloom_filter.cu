@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/utilities/error.hpp>
+#include <io/utilities/block_utils.cuh>
+#include "parquet_gpu.h"
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ull;
+constexpr uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ull;
+
+/**
+ * @brief Salts used to set the 8 bits of a key in a filter block
+ **/
+static __device__ __constant__ uint32_t kBloomFilterSalt[8] = {0x47b6137bu,
+                                                               0x44974d91u,
+                                                               0x8824ad5bu,
+                                                               0xa2b7289du,
+                                                               0x705495c7u,
+                                                               0x2df1424bu,
+                                                               0x9efc4947u,
+                                                               0x5c6bfb31u};
+
+inline __device__ uint64_t rotl64(uint64_t x, uint32_t r) { return (x << r) | (x >> (64 - r)); }
+
+inline __device__ uint64_t load_le64(const uint8_t *p)
+{
+  uint64_t v = 0;
+  for (uint32_t i = 0; i < 8; i++) { v |= static_cast<uint64_t>(p[i]) << (i * 8); }
+  return v;
+}
+
+inline __device__ uint32_t load_le32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline __device__ uint64_t xxh64_round(uint64_t acc, uint64_t input)
+{
+  acc += input * XXH_PRIME64_2;
+  return rotl64(acc, 31) * XXH_PRIME64_1;
+}
+
+inline __device__ uint64_t xxh64_merge_round(uint64_t acc, uint64_t val)
+{
+  acc ^= xxh64_round(0, val);
+  return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/**
+ * @brief Computes the 64-bit xxHash (XXH64) of a byte sequence, with a seed of zero
+ *
+ * @param[in] p The input data
+ * @param[in] len The length of the input data
+ *
+ * @return The hash value
+ **/
+__device__ uint64_t xxhash64(const uint8_t *p, uint32_t len)
+{
+  const uint8_t *end = p + len;
+  uint64_t h;
+
+  if (len >= 32) {
+    uint64_t v1 = XXH_PRIME64_1 + XXH_PRIME64_2;
+    uint64_t v2 = XXH_PRIME64_2;
+    uint64_t v3 = 0;
+    uint64_t v4 = -XXH_PRIME64_1;
+    do {
+      v1 = xxh64_round(v1, load_le64(p));
+      v2 = xxh64_round(v2, load_le64(p + 8));
+      v3 = xxh64_round(v3, load_le64(p + 16));
+      v4 = xxh64_round(v4, load_le64(p + 24));
+      p += 32;
+    } while (p + 32 <= end);
+    h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+    h = xxh64_merge_round(h, v1);
+    h = xxh64_merge_round(h, v2);
+    h = xxh64_merge_round(h, v3);
+    h = xxh64_merge_round(h, v4);
+  } else {
+    h = XXH_PRIME64_5;
+  }
+  h += len;
+  for (; p + 8 <= end; p += 8) {
+    h ^= xxh64_round(0, load_le64(p));
+    h = rotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+  }
+  if (p + 4 <= end) {
+    h ^= load_le32(p) * XXH_PRIME64_1;
+    h = rotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+    p += 4;
+  }
+  for (; p < end; p++) {
+    h ^= (*p) * XXH_PRIME64_5;
+    h = rotl64(h, 11) * XXH_PRIME64_1;
+  }
+  h ^= h >> 33;
+  h *= XXH_PRIME64_2;
+  h ^= h >> 29;
+  h *= XXH_PRIME64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+/**
+ * @brief Returns the hash of a value in its PLAIN encoding, as required by the bloom filter spec
+ **/
+inline __device__ uint64_t hash_plain_value(const EncColumnDesc *col, uint32_t row)
+{
+  const uint8_t *src8 = reinterpret_cast<const uint8_t *>(col->column_data_base);
+  uint8_t buf[8];
+
+  switch (col->physical_type) {
+    case INT32: {
+      int32_t v;
+      if (col->converted_type == INT_8) {
+        v = reinterpret_cast<const int8_t *>(src8)[row];
+      } else if (col->converted_type == INT_16) {
+        v = reinterpret_cast<const int16_t *>(src8)[row];
+      } else {
+        v = reinterpret_cast<const int32_t *>(src8)[row];
+      }
+      for (uint32_t i = 0; i < 4; i++) { buf[i] = v >> (i * 8); }
+      return xxhash64(buf, 4);
+    }
+    case INT64: {
+      int64_t v        = reinterpret_cast<const int64_t *>(src8)[row];
+      int32_t ts_scale = col->ts_scale;
+      if (ts_scale != 0) {
+        if (ts_scale < 0) {
+          v /= -ts_scale;
+        } else {
+          v *= ts_scale;
+        }
+      }
+      for (uint32_t i = 0; i < 8; i++) { buf[i] = v >> (i * 8); }
+      return xxhash64(buf, 8);
+    }
+    case FLOAT: return xxhash64(src8 + row * 4, 4);
+    case DOUBLE: return xxhash64(src8 + row * (size_t)8, 8);
+    default: {  // BYTE_ARRAY
+      const nvstrdesc_s *str = reinterpret_cast<const nvstrdesc_s *>(src8) + row;
+      return xxhash64(reinterpret_cast<const uint8_t *>(str->ptr), str->count);
+    }
+  }
+}
+
+/**
+ * @brief Kernel for inserting the values of column chunks into their split-block bloom filters
+ *
+ * Each thread inserts one row: the upper 32 bits of the hash select a 256-bit block, and the
+ * lower 32 bits set one bit in each of its eight 32-bit words.
+ *
+ * @param[in,out] chunks Bloom filter chunks
+ **/
+// blockDim {256,1,1}
+__global__ void __launch_bounds__(256) gpuBuildBloomFilters(BloomFilterChunk *chunks)
+{
+  __shared__ __align__(8) BloomFilterChunk ck_g;
+
+  uint32_t t = threadIdx.x;
+  uint32_t row;
+
+  if (t < sizeof(BloomFilterChunk) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&ck_g)[t] =
+      reinterpret_cast<const uint32_t *>(&chunks[blockIdx.x])[t];
+  }
+  __syncthreads();
+  if (ck_g.num_blocks == 0 || blockIdx.y * 256 + t >= ck_g.num_rows) { return; }
+  row = ck_g.start_row + blockIdx.y * 256 + t;
+  const EncColumnDesc *col = ck_g.col_desc;
+  const uint32_t *valid    = col->valid_map_base;
+  if (row < col->num_rows && (!valid || ((valid[row >> 5] >> (row & 0x1f)) & 1))) {
+    uint64_t hash  = hash_plain_value(col, row);
+    uint32_t block = static_cast<uint32_t>(((hash >> 32) * ck_g.num_blocks) >> 32);
+    uint32_t key   = static_cast<uint32_t>(hash);
+    for (uint32_t i = 0; i < 8; i++) {
+      atomicOr(&ck_g.bitset[block * 8 + i], 1u << ((key * kBloomFilterSalt[i]) >> 27));
+    }
+  }
+}
+
+/**
+ * @brief Launches kernel for building the bloom filters of column chunks
+ *
+ * @param[in,out] chunks Bloom filter chunks, with zero-initialized bitsets
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] max_rows Maximum number of rows in a chunk
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(BloomFilterChunk *chunks,
+                              uint32_t num_chunks,
+                              uint32_t max_rows,
+                              cudaStream_t stream)
+{
+  dim3 dim_grid(num_chunks, (max_rows + 255) / 256);
+  if (num_chunks > 0 && max_rows > 0) {
+    gpuBuildBloomFilters<<<dim_grid, 256, 0, stream>>>(chunks);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -43,6 +43,10 @@ struct pq_chunked_state {
   cudf::io::parquet::FileMetaData md;
   /// current write position for rowgroups/chunks
   std::size_t current_chunk_offset;
+  /// Per-rowgroup, per-column page locations. Written during write_chunked_end()
+  std::vector<std::vector<cudf::io::parquet::OffsetIndex>> offset_indexes;
+  /// Per-rowgroup, per-column page statistics. Empty for chunks without page-level statistics
+  std::vector<std::vector<cudf::io::parquet::ColumnIndex>> column_indexes;
   /// optional user metadata
   table_metadata_with_nullability user_metadata_with_nullability;
   /// special parameter only used by detail::write() to indicate that we are guaranteeing
@@ -59,6 +59,15 @@ struct page_state_s {
   int32_t dict_pos;     // write position of dictionary indices
   int32_t out_pos;      // read position of final output
   int32_t ts_scale;     // timestamp scale: <0: divide by -ts_scale, >0: multiply by ts_scale
+  const uint8_t *delta_cur;   // DELTA: start of the current miniblock
+  const uint8_t *delta_bits;  // DELTA: bit widths of the miniblocks of the current block
+  int64_t delta_last;         // DELTA: last decoded value
+  int64_t delta_min;          // DELTA: minimum delta of the current block
+  int32_t delta_total;        // DELTA: number of values in the page
+  int32_t delta_mb_count;     // DELTA: number of miniblocks per block
+  int32_t delta_mb_size;      // DELTA: number of values per miniblock
+  int32_t delta_mb;           // DELTA: current miniblock in the block
+  int32_t delta_mb_pos;       // DELTA: number of values decoded in the current miniblock
   uint32_t nz_idx[NZ_BFRSZ];    // circular buffer of non-null row positions
   uint32_t dict_idx[NZ_BFRSZ];  // Dictionary index, boolean, or string offset values
   uint32_t str_len[NZ_BFRSZ];   // String length for plain encoding of strings
@@ -146,6 +155,33 @@ inline __device__ uint32_t get_vlq32(const uint8_t *&cur, const uint8_t *end)
   return v;
 }
 
+/**
+ * @brief Read a 64-bit varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ **/
+inline __device__ uint64_t get_vlq64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t v = 0;
+  for (uint32_t shift = 0; cur < end && shift < 64; shift += 7) {
+    uint64_t c = *cur++;
+    v |= (c & 0x7f) << shift;
+    if (c < 0x80) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Decode a zigzag-encoded signed integer
+ **/
+inline __device__ int64_t zigzag_decode(uint64_t v)
+{
+  return static_cast<int64_t>((v >> 1) ^ (~(v & 1) + 1));
+}
+
 /**
  * @brief Parse the beginning of the level section (definition or repetition),
  * initializes the initial RLE run & value, and returns the section length
@@ -200,6 +236,58 @@ __device__ uint32_t InitLevelSection(
   return (uint32_t)len;
 }
 
+/**
+ * @brief Parse the header of a DELTA_BINARY_PACKED section, initializes the block decoder, and
+ * returns the length of the header, or of the whole section if `skip_blocks` is set
+ *
+ * DELTA_LENGTH_BYTE_ARRAY pages store the string lengths in a DELTA_BINARY_PACKED section followed
+ * by the string data, so the blocks are skipped to find the start of the strings.
+ *
+ * @param[in,out] s The page state
+ * @param[in] cur The current data position
+ * @param[in] end The end of the data
+ * @param[in] skip_blocks Whether to include the blocks in the returned length
+ **/
+__device__ uint32_t InitDeltaSection(page_state_s *s,
+                                     const uint8_t *cur,
+                                     const uint8_t *end,
+                                     bool skip_blocks)
+{
+  const uint8_t *start = cur;
+  uint32_t block_size  = (cur < end) ? get_vlq32(cur, end) : 0;
+  uint32_t mb_count    = (cur < end) ? get_vlq32(cur, end) : 0;
+  uint32_t mb_size     = (mb_count != 0) ? block_size / mb_count : 0;
+  s->delta_total       = (cur < end) ? get_vlq32(cur, end) : 0;
+  s->delta_last        = zigzag_decode(get_vlq64(cur, end));
+  s->delta_mb_count    = mb_count;
+  s->delta_mb_size     = mb_size;
+  s->delta_mb          = mb_count;  // Start with a new block
+  s->delta_mb_pos      = 0;
+  s->delta_min         = 0;
+  s->delta_cur         = cur;
+  s->delta_bits        = cur;
+  // Miniblocks are decoded 32 values at a time
+  if (cur > end || mb_size == 0 || (mb_size & 0x1f) != 0 || s->delta_total < 0) {
+    s->error = 4;
+    return 0;
+  }
+  if (skip_blocks) {
+    int32_t remaining = s->delta_total - 1;  // The first value is stored in the header
+    while (remaining > 0 && cur < end) {
+      const uint8_t *bits;
+      get_vlq64(cur, end);  // Minimum delta
+      bits = cur;
+      cur += mb_count;
+      for (uint32_t i = 0; i < mb_count && remaining > 0 && cur <= end; i++) {
+        cur += (mb_size * bits[i]) >> 3;
+        remaining -= mb_size;
+      }
+    }
+    if (cur > end) { s->error = 4; }
+  }
+  return static_cast<uint32_t>(((cur < end) ? cur : end) - start);
+}
+
 /**
  * @brief Decode definition and repetition levels and outputs row indices
  *
@@ -535,12 +623,129 @@ __device__ void gpuInitStringDescriptors(volatile page_state_s *s, int target_po
   }
 }
 
+/**
+ * @brief Decodes DELTA_BINARY_PACKED values, storing the low and high 32 bits of each value in the
+ * dict_idx and str_len buffers, or for DELTA_LENGTH_BYTE_ARRAY the position and length of each
+ * string
+ *
+ * Each miniblock is decoded 32 values at a time, by unpacking the deltas in parallel and adding
+ * their prefix sum to the last value.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target output position (may exceed this value by up to 31)
+ * @param[in] t Warp1 thread ID (0..31)
+ *
+ * @return The new output position
+ **/
+__device__ int gpuDecodeDeltaValues(volatile page_state_s *s, int target_pos, int t)
+{
+  const uint8_t *end  = s->data_end;
+  const bool is_bytes = (s->page.encoding == DELTA_LENGTH_BYTE_ARRAY);
+  int pos             = s->dict_pos;
+
+  if (s->nz_count > s->delta_total) {
+    // More non-null values than encoded values
+    if (!t) { s->error = 4; }
+    return pos;
+  }
+  target_pos = min(target_pos, s->delta_total);
+  if (pos == 0 && pos < target_pos) {
+    // The first value is stored in the header
+    if (!t) {
+      int64_t v = s->delta_last;
+      if (is_bytes) {
+        int32_t len = static_cast<int32_t>(v);
+        if (len < 0 || len > s->dict_size) { len = 0; }
+        s->dict_idx[0] = 0;
+        s->str_len[0]  = len;
+        s->dict_val    = len;
+      } else {
+        s->dict_idx[0] = static_cast<uint32_t>(v);
+        s->str_len[0]  = static_cast<uint32_t>(static_cast<uint64_t>(v) >> 32);
+      }
+    }
+    SYNCWARP();
+    pos = 1;
+  }
+  while (pos < target_pos && !s->error) {
+    const uint8_t *cur;
+    uint32_t w, bitpos;
+    uint64_t delta = 0;
+    uint64_t v;
+    int batch_len;
+    if (!t) {
+      cur = s->delta_cur;
+      if (s->delta_mb_pos >= s->delta_mb_size) {
+        // Miniblock complete
+        cur += (s->delta_mb_size * s->delta_bits[s->delta_mb]) >> 3;
+        s->delta_mb     = s->delta_mb + 1;
+        s->delta_mb_pos = 0;
+      }
+      if (s->delta_mb >= s->delta_mb_count) {
+        // New block: minimum delta followed by the bit widths of the miniblocks
+        s->delta_min  = zigzag_decode(get_vlq64(cur, end));
+        s->delta_bits = cur;
+        cur += s->delta_mb_count;
+        s->delta_mb = 0;
+      }
+      if (cur > end || s->delta_bits + s->delta_mb >= end || s->delta_bits[s->delta_mb] > 64) {
+        s->error = 4;
+      }
+      s->delta_cur = cur;
+      __threadfence_block();
+    }
+    SYNCWARP();
+    if (s->error) { break; }
+    cur       = s->delta_cur;
+    w         = s->delta_bits[s->delta_mb];
+    bitpos    = (s->delta_mb_pos + t) * w;
+    batch_len = min(min(target_pos - pos, 32), s->delta_mb_size - s->delta_mb_pos);
+    if (w != 0) {
+      const uint8_t *p = cur + (bitpos >> 3);
+      uint32_t shift   = bitpos & 7;
+      for (uint32_t i = 0; i * 8 < w + shift; i++) {
+        uint64_t c = (p + i < end) ? p[i] : 0;
+        delta |= (i == 0) ? c >> shift : c << (i * 8 - shift);
+      }
+      if (w < 64) { delta &= (1ull << w) - 1; }
+    }
+    // Values are the running sum of the deltas
+    v = WarpReducePos32(delta + s->delta_min, t) + s->delta_last;
+    if (is_bytes) {
+      int32_t len = static_cast<int32_t>(v);
+      int32_t ofs;
+      if (len < 0 || t >= batch_len) { len = 0; }
+      ofs = WarpReducePos32(len, t) - len + s->dict_val;
+      if (ofs + len > s->dict_size) { len = 0; }
+      if (t < batch_len) {
+        s->dict_idx[(pos + t) & (NZ_BFRSZ - 1)] = ofs;
+        s->str_len[(pos + t) & (NZ_BFRSZ - 1)]  = len;
+      }
+      ofs = SHFL(ofs + len, batch_len - 1);
+      if (!t) { s->dict_val = ofs; }
+    } else if (t < batch_len) {
+      s->dict_idx[(pos + t) & (NZ_BFRSZ - 1)] = static_cast<uint32_t>(v);
+      s->str_len[(pos + t) & (NZ_BFRSZ - 1)]  = static_cast<uint32_t>(v >> 32);
+    }
+    v = SHFL(v, batch_len - 1);
+    SYNCWARP();
+    if (!t) {
+      s->delta_last   = static_cast<int64_t>(v);
+      s->delta_mb_pos = s->delta_mb_pos + batch_len;
+      __threadfence_block();
+    }
+    SYNCWARP();
+    pos += batch_len;
+  }
+  return pos;
+}
+
 /**
  * @brief Output a string descriptor
  *
  * @param[in,out] s Page state input/output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string descriptor, 32-bit hash or dictionary index)
  **/
 inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, void *dstv)
 {
@@ -549,8 +754,13 @@ inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, vo
 
   if (s->dict_base) {
     // String dictionary
-    uint32_t dict_pos =
-      (s->dict_bits > 0) ? s->dict_idx[src_pos & (NZ_BFRSZ - 1)] * sizeof(nvstrdesc_s) : 0;
+    uint32_t dict_idx = (s->dict_bits > 0) ? s->dict_idx[src_pos & (NZ_BFRSZ - 1)] : 0;
+    if (s->col.dict_index_base >= 0) {
+      // Output dictionary index
+      *reinterpret_cast<uint32_t *>(dstv) = s->col.dict_index_base + dict_idx;
+      return;
+    }
+    uint32_t dict_pos = dict_idx * sizeof(nvstrdesc_s);
     if (dict_pos < (uint32_t)s->dict_size) {
       const nvstrdesc_s *src = reinterpret_cast<const nvstrdesc_s *>(s->dict_base + dict_pos);
       ptr                    = src->ptr;
@@ -587,6 +797,43 @@ inline __device__ void gpuOutputBoolean(volatile page_state_s *s, int src_pos, u
   *dst = s->dict_idx[src_pos & (NZ_BFRSZ - 1)];
 }
 
+/**
+ * @brief Output a DELTA_BINARY_PACKED integer
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst Pointer to row output data
+ * @param[in] dtype_len Length of the output element
+ **/
+inline __device__ void gpuOutputDeltaInt(volatile page_state_s *s,
+                                         int src_pos,
+                                         uint8_t *dst,
+                                         uint32_t dtype_len)
+{
+  uint64_t lo = s->dict_idx[src_pos & (NZ_BFRSZ - 1)];
+  uint64_t hi = s->str_len[src_pos & (NZ_BFRSZ - 1)];
+  int64_t v   = static_cast<int64_t>((hi << 32) | lo);
+
+  if (dtype_len == 8) {
+    // Output to desired clock rate
+    int32_t ts_scale = s->ts_scale;
+    if (ts_scale < 0) {
+      // round towards negative infinity
+      int sign = (v < 0);
+      v        = ((v + sign) / -ts_scale) + sign;
+    } else if (ts_scale > 0) {
+      v *= ts_scale;
+    }
+    *reinterpret_cast<int64_t *>(dst) = v;
+  } else if (dtype_len == 4) {
+    *reinterpret_cast<int32_t *>(dst) = static_cast<int32_t>(v);
+  } else if (dtype_len == 2) {
+    *reinterpret_cast<int16_t *>(dst) = static_cast<int16_t>(v);
+  } else {
+    *dst = static_cast<uint8_t>(v);
+  }
+}
+
 /**
  * @brief Store a 32-bit data element
  *
@@ -970,6 +1217,12 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
     s->num_rows         = 0;
     s->page.valid_count = 0;
     s->error            = 0;
+    if (s->col.max_rep_level > 0) {
+      // Nested columns output every level value of their chunks, indexed by its position in the
+      // column; rows are assembled from the repetition levels afterwards
+      min_row  = 0;
+      num_rows = static_cast<size_t>(INT32_MAX);
+    }
     if (s->page.num_values > 0 && s->page.num_rows > 0) {
       uint8_t *cur           = s->page.page_data;
       uint8_t *end           = cur + s->page.uncompressed_page_size;
@@ -1011,8 +1264,9 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       } else if ((s->col.data_type & 7) == INT32) {
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
-      } else if ((s->col.data_type & 7) == BYTE_ARRAY && dtype_len_out == 4) {
-        s->dtype_len = 4;  // HASH32 output
+      } else if ((s->col.data_type & 7) == BYTE_ARRAY &&
+                 (dtype_len_out == 4 || s->col.dict_index_base >= 0)) {
+        s->dtype_len = 4;  // HASH32 or dictionary index output
       } else if ((s->col.data_type & 7) == INT96) {
         s->dtype_len = 8;  // Convert to 64-bit timestamp
       }
@@ -1035,12 +1289,12 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       if (page_start_row + s->num_rows > min_row + num_rows) {
         s->num_rows = (int32_t)max((int64_t)(min_row + num_rows - page_start_row), INT64_C(0));
       }
+      // Find the compressed size of repetition levels, which precede the definition levels
+      cur +=
+        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       // Find the compressed size of definition levels
       cur +=
         InitLevelSection(s, cur, end, s->page.definition_level_encoding, s->col.def_level_bits, 0);
-      // Find the compressed size of repetition levels
-      cur +=
-        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       s->dict_bits = 0;
       s->dict_base = 0;
       s->dict_size = 0;
@@ -1068,6 +1322,20 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
         case RLE: s->dict_run = 0; break;
+        case DELTA_BINARY_PACKED:
+          if (((s->col.data_type & 7) != INT32 && (s->col.data_type & 7) != INT64) ||
+              s->col.converted_type == DECIMAL) {
+            s->error = 1;
+          }
+          cur += InitDeltaSection(s, cur, end, false);
+          break;
+        case DELTA_LENGTH_BYTE_ARRAY:
+          // String lengths, followed by the string data
+          if ((s->col.data_type & 7) != BYTE_ARRAY) { s->error = 1; }
+          cur += InitDeltaSection(s, cur, end, true);
+          s->dict_size = static_cast<int32_t>(end - cur);
+          s->dict_val  = 0;
+          break;
         default:
           s->error = 1;  // Unsupported encoding
           break;
@@ -1089,8 +1357,10 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   if (s->dict_base) {
     out_thread0 = (s->dict_bits > 0) ? 64 : 32;
   } else {
-    out_thread0 =
-      ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY) ? 64 : 32;
+    out_thread0 = ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY ||
+                   s->page.encoding == DELTA_BINARY_PACKED)
+                    ? 64
+                    : 32;
   }
 
   while (!s->error && (s->value_count < s->num_values || s->out_pos < s->nz_count)) {
@@ -1112,6 +1382,9 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       // WARP1: Decode dictionary indices, booleans or string positions
       if (s->dict_base) {
         target_pos = gpuDecodeDictionaryIndices(s, target_pos, t & 0x1f);
+      } else if (s->page.encoding == DELTA_BINARY_PACKED ||
+                 s->page.encoding == DELTA_LENGTH_BYTE_ARRAY) {
+        target_pos = gpuDecodeDeltaValues(s, target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BOOLEAN) {
         target_pos = gpuDecodeRleBooleans(s, target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BYTE_ARRAY) {
@@ -1128,6 +1401,8 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
         uint8_t *dst       = s->data_out + (size_t)row_idx * dtype_len;
         if (dtype == BYTE_ARRAY)
           gpuOutputString(s, out_pos, dst);
+        else if (s->page.encoding == DELTA_BINARY_PACKED)
+          gpuOutputDeltaInt(s, out_pos, dst, dtype_len);
         else if (dtype == BOOLEAN)
           gpuOutputBoolean(s, out_pos, dst);
         else if (s->col.converted_type == DECIMAL)
@@ -1157,6 +1432,97 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   }
 }
 
+/**
+ * @brief Decodes a run-length/bit-packed hybrid encoded level section
+ *
+ * All the threads of the warp parse the run headers, and output the values of each run in
+ * parallel.
+ *
+ * @param[in] cur Start of the encoded levels, after the section length
+ * @param[in] end End of the encoded levels
+ * @param[in] level_bits Bits per level value
+ * @param[in] num_values Number of level values to decode
+ * @param[out] out Level values output
+ * @param[in] t Thread ID within the warp (0..31)
+ **/
+inline __device__ void gpuDecodeLevelSection(
+  const uint8_t *cur, const uint8_t *end, int level_bits, int32_t num_values, uint8_t *out, int t)
+{
+  int32_t pos = 0;
+  while (pos < num_values && cur < end) {
+    uint32_t run = get_vlq32(cur, end);
+    int32_t len;
+    if (run & 1) {
+      // Literal run of bit-packed groups of 8 values
+      len = min(static_cast<int32_t>(run >> 1) * 8, num_values - pos);
+      for (int i = t; i < len; i += 32) {
+        int bitpos         = i * level_bits;
+        const uint8_t *src = cur + (bitpos >> 3);
+        uint32_t v         = (src < end) ? src[0] : 0;
+        if (src + 1 < end) { v |= src[1] << 8; }
+        out[pos + i] = (v >> (bitpos & 7)) & ((1 << level_bits) - 1);
+      }
+      cur += (run >> 1) * level_bits;
+    } else {
+      // Repeated value
+      len        = min(static_cast<int32_t>(run >> 1), num_values - pos);
+      uint32_t v = (cur < end) ? cur[0] : 0;
+      for (int i = t; i < len; i += 32) { out[pos + i] = v; }
+      cur += (level_bits + 7) >> 3;
+    }
+    if (len <= 0) { break; }
+    pos += len;
+  }
+}
+
+/**
+ * @brief Kernel for decoding the definition and repetition levels of nested columns
+ *
+ * The first warp decodes the repetition levels of the page, and the second warp decodes the
+ * definition levels. Only RLE level encoding is supported; levels are at most 8 bits wide.
+ *
+ * @param[in] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ **/
+// blockDim {64,1,1}
+extern "C" __global__ void __launch_bounds__(64)
+  gpuDecodePageLevels(PageInfo *pages, ColumnChunkDesc *chunks, int32_t num_chunks)
+{
+  const PageInfo *page = &pages[blockIdx.x];
+  int t                = threadIdx.x & 0x1f;
+  int lvl              = threadIdx.x >> 5;  // 0: repetition, 1: definition
+
+  if ((page->flags & PAGEINFO_FLAGS_DICTIONARY) || page->num_values <= 0) { return; }
+  if (static_cast<uint32_t>(page->chunk_idx) >= static_cast<uint32_t>(num_chunks)) { return; }
+  const ColumnChunkDesc *col = &chunks[page->chunk_idx];
+  if (col->max_rep_level == 0 || col->rep_levels_base == nullptr ||
+      col->def_levels_base == nullptr) {
+    return;
+  }
+
+  uint8_t *out = (lvl == 0) ? col->rep_levels_base : col->def_levels_base;
+  out += col->start_row + page->chunk_row;
+
+  // Each level section is prefixed with its length; repetition levels come first
+  const uint8_t *cur  = page->page_data;
+  const uint8_t *end  = cur + page->uncompressed_page_size;
+  const int rep_bits  = col->rep_level_bits;
+  const int def_bits  = col->def_level_bits;
+  const int bits      = (lvl == 0) ? rep_bits : def_bits;
+  auto section_length = [end](const uint8_t *p) -> uint32_t {
+    return (p + 4 <= end) ? p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24) : 0;
+  };
+  if (lvl == 1 && rep_bits > 0) { cur += 4 + section_length(cur); }
+  if (bits == 0) {
+    for (int i = t; i < page->num_values; i += 32) { out[i] = 0; }
+  } else if (cur + 4 <= end) {
+    const uint32_t len = section_length(cur);
+    cur += 4;
+    gpuDecodeLevelSection(cur, min(cur + len, end), bits, page->num_values, out, t);
+  }
+}
+
 cudaError_t __host__ DecodePageData(PageInfo *pages,
                                     int32_t num_pages,
                                     ColumnChunkDesc *chunks,
@@ -1172,6 +1538,18 @@ cudaError_t __host__ DecodePageData(PageInfo *pages,
   return cudaSuccess;
 }
 
+cudaError_t __host__ DecodePageLevels(PageInfo *pages,
+                                      int32_t num_pages,
+                                      ColumnChunkDesc *chunks,
+                                      int32_t num_chunks,
+                                      cudaStream_t stream)
+{
+  dim3 dim_block(64, 1);
+  dim3 dim_grid(num_pages, 1);  // 1 threadblock per page
+  gpuDecodePageLevels<<<dim_grid, dim_block, 0, stream>>>(pages, chunks, num_chunks);
+  return cudaSuccess;
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
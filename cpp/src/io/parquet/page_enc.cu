@@ -41,6 +41,10 @@ struct frag_init_state_s {
 #define RLE_BFRSZ (1 << LOG2_RLE_BFRSZ)
 #define RLE_MAX_LIT_RUN 0xfff8  // Maximum literal run for 2-byte run code
 
+#define DELTA_BLOCK_SIZE 128     // Values per DELTA_BINARY_PACKED block (one per thread)
+#define DELTA_MINIBLOCK_SIZE 32  // Values per miniblock (one per warp)
+#define DELTA_BFRSZ 256
+
 struct page_enc_state_s {
   uint8_t *cur;          //!< current output ptr
   uint8_t *rle_out;      //!< current RLE write ptr
@@ -58,6 +62,10 @@ struct page_enc_state_s {
   gpu_inflate_input_s comp_in;
   gpu_inflate_status_s comp_out;
   uint16_t vals[RLE_BFRSZ];
+  volatile int64_t delta_red[4];
+  uint8_t delta_bits[DELTA_BLOCK_SIZE / DELTA_MINIBLOCK_SIZE];
+  int64_t delta_vals[DELTA_BFRSZ];
+  uint64_t delta_packed[DELTA_BLOCK_SIZE];
 };
 
 /**
@@ -497,6 +505,12 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
           dict_bits_plus1 = dict_bits + 1;
         } else {
           dict_bits_plus1 = 0;
+          if (col_g.delta_encoding) {
+            // Deltas take at most as many bits as the PLAIN values; add the page header, the block
+            // headers and the padding of the last miniblock
+            page_size += 4 * 5 + 10 + (rows_in_page / DELTA_BLOCK_SIZE + 1) * (10 + 4) +
+                         (DELTA_MINIBLOCK_SIZE - 1) * 8;
+          }
         }
         if (!t) {
           uint32_t def_level_bits = col_g.level_bits & 0xf;
@@ -815,6 +829,238 @@ static __device__ void PlainBoolEncode(page_enc_state_s *s,
   }
 }
 
+/**
+ * @brief Variable-length encode a 64-bit zigzag-encoded signed integer
+ **/
+inline __device__ uint8_t *VlqEncodeZigZag(uint8_t *p, int64_t v)
+{
+  uint64_t u = (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+  while (u > 0x7f) {
+    *p++ = (u | 0x80);
+    u >>= 7;
+  }
+  *p++ = u;
+  return p;
+}
+
+/**
+ * @brief Returns the validity of the row of a data page, for a batch of 128 rows
+ **/
+inline __device__ uint32_t IsValidRow(const page_enc_state_s *s, uint32_t cur_row, uint32_t t)
+{
+  const uint32_t *valid = s->col.valid_map_base;
+  uint32_t row          = s->page.start_row + cur_row + t;
+  return (row < s->col.num_rows && cur_row + t < s->page.num_rows)
+           ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
+           : 0;
+}
+
+/**
+ * @brief Returns the integer value of a row to DELTA-encode (the length for strings)
+ **/
+inline __device__ int64_t DeltaInputValue(const page_enc_state_s *s,
+                                          uint32_t dtype,
+                                          uint32_t dtype_len_in,
+                                          uint32_t row)
+{
+  const uint8_t *src8 =
+    reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+  if (dtype == BYTE_ARRAY) {
+    return reinterpret_cast<const nvstrdesc_s *>(src8)->count;
+  } else if (dtype == INT64) {
+    int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+    int32_t ts_scale = s->col.ts_scale;
+    if (ts_scale != 0) {
+      if (ts_scale < 0) {
+        v /= -ts_scale;
+      } else {
+        v *= ts_scale;
+      }
+    }
+    return v;
+  } else if (dtype_len_in == 4) {
+    return *reinterpret_cast<const int32_t *>(src8);
+  } else if (dtype_len_in == 2) {
+    return *reinterpret_cast<const int16_t *>(src8);
+  } else {
+    return *reinterpret_cast<const int8_t *>(src8);
+  }
+}
+
+/**
+ * @brief DELTA_BINARY_PACKED encoder of one block of up to 128 deltas
+ *
+ * Each warp bit-packs one miniblock of 32 deltas, relative to the minimum delta of the block.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] numvals Total count of input values
+ * @param[in] delta_pos Position of the first value of the block
+ * @param[in] is_64bit nonzero if the deltas wrap around at 64 bits rather than 32 bits
+ * @param[in] t thread id (0..127)
+ *
+ * @return The position of the first value of the next block
+ */
+static __device__ uint32_t DeltaEncodeBlock(
+  page_enc_state_s *s, uint32_t numvals, uint32_t delta_pos, uint32_t is_64bit, uint32_t t)
+{
+  uint32_t pos   = delta_pos + t;
+  uint32_t nvals = min(numvals - delta_pos, DELTA_BLOCK_SIZE);
+  int64_t delta  = 0;
+  int64_t min_delta;
+  uint64_t v, mask, zz;
+  uint32_t w, hdr_len, mb_ofs, mb_len;
+  uint8_t *dst;
+
+  if (t < nvals) {
+    uint64_t cur  = s->delta_vals[pos & (DELTA_BFRSZ - 1)];
+    uint64_t prev = s->delta_vals[(pos - 1) & (DELTA_BFRSZ - 1)];
+    delta         = (is_64bit) ? static_cast<int64_t>(cur - prev)
+                       : static_cast<int32_t>(static_cast<uint32_t>(cur - prev));
+  }
+  // Block minimum
+  min_delta = (t < nvals) ? delta : INT64_MAX;
+  for (uint32_t i = 1; i < 32; i <<= 1) {
+    int64_t other = SHFL_XOR(min_delta, i);
+    min_delta     = (other < min_delta) ? other : min_delta;
+  }
+  if (!(t & 0x1f)) { s->delta_red[t >> 5] = min_delta; }
+  __syncthreads();
+  for (uint32_t i = 0; i < 4; i++) {
+    int64_t other = s->delta_red[i];
+    min_delta     = (other < min_delta) ? other : min_delta;
+  }
+  // Miniblock bit widths
+  if (t < nvals) {
+    v = static_cast<uint64_t>(delta) - static_cast<uint64_t>(min_delta);
+    if (!is_64bit) { v = static_cast<uint32_t>(v); }
+  } else {
+    v = 0;
+  }
+  mask = v;
+  for (uint32_t i = 1; i < 32; i <<= 1) { mask |= SHFL_XOR(mask, i); }
+  w = (mask != 0) ? 64 - __clzll(mask) : 0;
+  if (!(t & 0x1f)) { s->delta_bits[t >> 5] = w; }
+  s->delta_packed[t] = v;
+  __syncthreads();
+  // Block header: minimum delta and bit widths, followed by the miniblocks
+  hdr_len = 1 + DELTA_BLOCK_SIZE / DELTA_MINIBLOCK_SIZE;
+  zz      = (static_cast<uint64_t>(min_delta) << 1) ^ static_cast<uint64_t>(min_delta >> 63);
+  for (; zz > 0x7f; zz >>= 7) { hdr_len++; }
+  mb_ofs = 0;
+  mb_len = 0;
+  for (uint32_t i = 0; i < DELTA_BLOCK_SIZE / DELTA_MINIBLOCK_SIZE; i++) {
+    uint32_t len = s->delta_bits[i] * (DELTA_MINIBLOCK_SIZE / 8);
+    mb_ofs += (i < (t >> 5)) ? len : 0;
+    mb_len += len;
+  }
+  dst = s->rle_out;
+  if (!t) {
+    uint8_t *p = VlqEncodeZigZag(dst, min_delta);
+    for (uint32_t i = 0; i < DELTA_BLOCK_SIZE / DELTA_MINIBLOCK_SIZE; i++) {
+      p[i] = s->delta_bits[i];
+    }
+  }
+  // Bit-pack the miniblock, least significant bits first
+  dst += hdr_len + mb_ofs;
+  for (uint32_t i = t & 0x1f; i < w * (DELTA_MINIBLOCK_SIZE / 8); i += 32) {
+    const uint64_t *mb_vals = &s->delta_packed[t & ~0x1f];
+    uint32_t bitpos         = i * 8;
+    uint32_t idx            = bitpos / w;
+    int32_t shift           = idx * w - bitpos;
+    uint64_t b              = 0;
+    for (; shift < 8 && idx < DELTA_MINIBLOCK_SIZE; idx++, shift += w) {
+      b |= (shift >= 0) ? mb_vals[idx] << shift : mb_vals[idx] >> -shift;
+    }
+    dst[i] = static_cast<uint8_t>(b);
+  }
+  __syncthreads();
+  if (!t) { s->rle_out += hdr_len + mb_len; }
+  __syncthreads();
+  return delta_pos + nvals;
+}
+
+/**
+ * @brief DELTA encoder of the page values
+ *
+ * Integers are DELTA_BINARY_PACKED; strings are DELTA_LENGTH_BYTE_ARRAY-encoded, with the
+ * DELTA_BINARY_PACKED lengths followed by the string data.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] dtype Physical type of the column
+ * @param[in] dtype_len_in Length of the input elements
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaEncodePage(page_enc_state_s *s,
+                                       uint32_t dtype,
+                                       uint32_t dtype_len_in,
+                                       uint32_t t)
+{
+  uint32_t num_values = 0, numvals = 0, delta_pos = 1;
+  uint32_t is_64bit   = (dtype == INT64);
+
+  // The header holds the total count of values
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows; cur_row += 128) {
+    num_values += __syncthreads_count(IsValidRow(s, cur_row, t));
+  }
+  if (!t) {
+    uint8_t *dst = VlqEncode(s->cur, DELTA_BLOCK_SIZE);
+    dst          = VlqEncode(dst, DELTA_BLOCK_SIZE / DELTA_MINIBLOCK_SIZE);
+    dst          = VlqEncode(dst, num_values);
+    if (num_values == 0) { *dst++ = 0; }  // First value
+    s->rle_out = dst;
+  }
+  __syncthreads();
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
+    uint32_t nrows       = min(s->page.num_rows - cur_row, 128);
+    uint32_t row         = s->page.start_row + cur_row + t;
+    uint32_t is_valid    = IsValidRow(s, cur_row, t);
+    uint32_t warp_valids = BALLOT(is_valid);
+    uint32_t pos         = __popc(warp_valids & ((1 << (t & 0x1f)) - 1));
+
+    cur_row += nrows;
+    if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
+    __syncthreads();
+    if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+    __syncthreads();
+    pos = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
+    if (is_valid) {
+      s->delta_vals[(numvals + pos) & (DELTA_BFRSZ - 1)] =
+        DeltaInputValue(s, dtype, dtype_len_in, row);
+    }
+    __syncthreads();
+    if (!t && numvals == 0 && s->scratch_red[3] != 0) {
+      // First value
+      s->rle_out = VlqEncodeZigZag(s->rle_out, s->delta_vals[0]);
+    }
+    numvals += s->scratch_red[3];
+    __syncthreads();
+    while (numvals - delta_pos >= DELTA_BLOCK_SIZE ||
+           (cur_row == s->page.num_rows && delta_pos < numvals)) {
+      delta_pos = DeltaEncodeBlock(s, numvals, delta_pos, is_64bit, t);
+    }
+  }
+  if (!t) { s->cur = s->rle_out; }
+  __syncthreads();
+  if (dtype == BYTE_ARRAY) {
+    // String data
+    for (uint32_t cur_row = 0; cur_row < s->page.num_rows; cur_row += 128) {
+      const nvstrdesc_s *str = reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base);
+      uint8_t *dst           = s->cur;
+      uint32_t row           = s->page.start_row + cur_row + t;
+      uint32_t len           = (IsValidRow(s, cur_row, t)) ? (uint32_t)str[row].count : 0;
+      uint32_t pos           = WarpReducePos32(len, t);
+      if ((t & 0x1f) == 0x1f) { s->scratch_red[t >> 5] = pos; }
+      __syncthreads();
+      if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+      __syncthreads();
+      if (t == 0) { s->cur = dst + s->scratch_red[3]; }
+      pos = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0) - len;
+      if (len != 0) { memcpy(dst + pos, str[row].ptr, len); }
+      __syncthreads();
+    }
+  }
+}
+
 // blockDim(128, 1, 1)
 __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
                                                          const EncColumnChunk *chunks,
@@ -828,6 +1074,7 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   uint32_t t                = threadIdx.x;
   uint32_t dtype, dtype_len_in, dtype_len_out;
   int32_t dict_bits;
+  bool is_delta;
 
   if (t < sizeof(EncPage) / sizeof(uint32_t)) {
     reinterpret_cast<uint32_t *>(&s->page)[t] =
@@ -906,7 +1153,9 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     }
   }
   __syncthreads();
-  for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
+  is_delta = (s->page.page_type == DATA_PAGE && dict_bits < 0 && s->col.delta_encoding);
+  if (is_delta) { DeltaEncodePage(s, dtype, dtype_len_in, t); }
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows && !is_delta;) {
     uint32_t nrows = min(s->page.num_rows - cur_row, 128);
     uint32_t row   = s->page.start_row + cur_row + t;
     uint32_t is_valid, warp_valids, len, pos;
@@ -1304,6 +1553,10 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
     int encoding =
       (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN;
 #endif
+    if (encoding == PLAIN && page_type == DATA_PAGE && col_g.delta_encoding) {
+      encoding =
+        (col_g.physical_type == BYTE_ARRAY) ? DELTA_LENGTH_BYTE_ARRAY : DELTA_BINARY_PACKED;
+    }
     CPW_FLD_INT32(1, page_type)
     CPW_FLD_INT32(2, uncompressed_page_size)
     CPW_FLD_INT32(3, compressed_page_size)
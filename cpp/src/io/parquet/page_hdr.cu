@@ -246,6 +246,9 @@ extern "C" __global__ void __launch_bounds__(128)
               bs->page.num_rows = bs->page.num_values;  // Assumes num_rows == num_values
                                                         // Fall-through to V2
             case DATA_PAGE_V2:
+              // Nested columns are decoded one level value at a time, so their pages' row
+              // numbering counts the values
+              if (bs->ck.max_rep_level > 0) { bs->page.num_rows = bs->page.num_values; }
               index_out = num_dict_pages + data_page_count;
               data_page_count++;
               bs->page.flags = 0;
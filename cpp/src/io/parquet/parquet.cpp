@@ -181,6 +181,35 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
       break;                                        \
     }
 
+#define PARQUET_FLD_INT64_LIST(id, m)                                     \
+  case id:                                                                \
+    if (t != ST_FLD_LIST) return false;                                   \
+    {                                                                     \
+      int n;                                                              \
+      c = getb();                                                         \
+      if ((c & 0xf) < ST_FLD_I16 || (c & 0xf) > ST_FLD_I64) return false; \
+      n = c >> 4;                                                         \
+      if (n == 0xf) n = get_u32();                                        \
+      s->m.resize(n);                                                     \
+      for (int32_t i = 0; i < n; i++) s->m[i] = get_i64();                \
+      break;                                                              \
+    }
+
+// Booleans within lists are encoded as one byte each, with 1 for true
+#define PARQUET_FLD_BOOL_LIST(id, m)                                           \
+  case id:                                                                     \
+    if (t != ST_FLD_LIST) return false;                                        \
+    {                                                                          \
+      int n;                                                                   \
+      c = getb();                                                              \
+      if ((c & 0xf) != ST_FLD_TRUE && (c & 0xf) != ST_FLD_FALSE) return false; \
+      n = c >> 4;                                                              \
+      if (n == 0xf) n = get_u32();                                             \
+      s->m.resize(n);                                                          \
+      for (int32_t i = 0; i < n; i++) s->m[i] = (getb() == ST_FLD_TRUE);       \
+      break;                                                                   \
+    }
+
 #define PARQUET_FLD_STRUCT(id, m)                         \
   case id:                                                \
     if (t != ST_FLD_STRUCT || !read(&s->m)) return false; \
@@ -251,6 +280,7 @@ PARQUET_FLD_INT64(9, data_page_offset)
 PARQUET_FLD_INT64(10, index_page_offset)
 PARQUET_FLD_INT64(11, dictionary_page_offset)
 PARQUET_FLD_STRUCT_BLOB(12, statistics_blob)
+PARQUET_FLD_INT64(14, bloom_filter_offset)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(PageHeader)
@@ -266,6 +296,7 @@ PARQUET_FLD_INT32(1, num_values)
 PARQUET_FLD_ENUM(2, encoding, Encoding);
 PARQUET_FLD_ENUM(3, definition_level_encoding, Encoding);
 PARQUET_FLD_ENUM(4, repetition_level_encoding, Encoding);
+PARQUET_FLD_STRUCT(5, statistics)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(DictionaryPageHeader)
@@ -278,6 +309,37 @@ PARQUET_FLD_STRING(1, key)
 PARQUET_FLD_STRING(2, value)
 PARQUET_END_STRUCT()
 
+PARQUET_BEGIN_STRUCT(Statistics)
+PARQUET_FLD_STRING(1, max)
+PARQUET_FLD_STRING(2, min)
+PARQUET_FLD_INT64(3, null_count)
+PARQUET_FLD_INT64(4, distinct_count)
+PARQUET_FLD_STRING(5, max_value)
+PARQUET_FLD_STRING(6, min_value)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(PageLocation)
+PARQUET_FLD_INT64(1, offset)
+PARQUET_FLD_INT32(2, compressed_page_size)
+PARQUET_FLD_INT64(3, first_row_index)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(OffsetIndex)
+PARQUET_FLD_STRUCT_LIST(1, page_locations)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(ColumnIndex)
+PARQUET_FLD_BOOL_LIST(1, null_pages)
+PARQUET_FLD_STRING_LIST(2, min_values)
+PARQUET_FLD_STRING_LIST(3, max_values)
+PARQUET_FLD_ENUM(4, boundary_order, BoundaryOrder)
+PARQUET_FLD_INT64_LIST(5, null_counts)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(BloomFilterHeader)
+PARQUET_FLD_INT32(1, num_bytes)
+PARQUET_END_STRUCT()
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -394,6 +456,22 @@ int CompactProtocolReader::WalkSchema(
   for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
   cur_fld = id;
 
+#define CPW_FLD_INT64_LIST(id, m)                                           \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                       \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_I64)); \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                            \
+  for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
+  cur_fld = id;
+
+#define CPW_FLD_BOOL_LIST(id, m)                                             \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                        \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE)); \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                             \
+  for (auto i = 0; i < s->m.size(); i++) {                                   \
+    putb((s->m[i]) ? ST_FLD_TRUE : ST_FLD_FALSE);                            \
+  }                                                                          \
+  cur_fld = id;
+
 #define CPW_FLD_STRING_LIST(id, m)                                                     \
   put_fldh(id, cur_fld, ST_FLD_LIST);                                                  \
   putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));         \
@@ -503,6 +581,37 @@ CPW_FLD_INT64(9, data_page_offset)
 if (s->index_page_offset != 0) { CPW_FLD_INT64(10, index_page_offset) }
 if (s->dictionary_page_offset != 0) { CPW_FLD_INT64(11, dictionary_page_offset) }
 if (s->statistics_blob.size() != 0) { CPW_FLD_STRUCT_BLOB(12, statistics_blob); }
+if (s->bloom_filter_offset != 0) { CPW_FLD_INT64(14, bloom_filter_offset) }
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(PageLocation)
+CPW_FLD_INT64(1, offset)
+CPW_FLD_INT32(2, compressed_page_size)
+CPW_FLD_INT64(3, first_row_index)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(OffsetIndex)
+CPW_FLD_STRUCT_LIST(1, page_locations)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(ColumnIndex)
+CPW_FLD_BOOL_LIST(1, null_pages)
+CPW_FLD_STRING_LIST(2, min_values)
+CPW_FLD_STRING_LIST(3, max_values)
+CPW_FLD_INT32(4, boundary_order)
+if (s->null_counts.size() != 0) { CPW_FLD_INT64_LIST(5, null_counts) }
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(BloomFilterHeader)
+CPW_FLD_INT32(1, num_bytes)
+// Unions holding the empty SPLIT_BLOCK algorithm, XXHASH hash and UNCOMPRESSED compression structs
+for (int f = 2; f <= 4; f++) {
+  put_fldh(f, cur_fld, ST_FLD_STRUCT);
+  put_fldh(1, 0, ST_FLD_STRUCT);
+  putb(0);  // Empty struct end
+  putb(0);  // Union struct end
+  cur_fld = f;
+}
 CPW_END_STRUCT()
 
 }  // namespace parquet
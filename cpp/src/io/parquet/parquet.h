@@ -86,6 +86,22 @@ struct ColumnMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;       // Byte offset from beginning of file to bloom filter
+};
+
+/**
+ * @brief Thrift-derived struct describing the statistics of a column chunk or page
+ *
+ * Values are stored in their plain encoding, i.e. little-endian for numeric types and as raw
+ * bytes for byte arrays.
+ **/
+struct Statistics {
+  std::string max;              // Deprecated max value, in signed comparison order
+  std::string min;              // Deprecated min value, in signed comparison order
+  int64_t null_count     = -1;  // Count of null values in the column
+  int64_t distinct_count = -1;  // Count of distinct values occurring
+  std::string max_value;        // Max value for the column, ordered according to its logical type
+  std::string min_value;        // Min value for the column, ordered according to its logical type
 };
 
 /**
@@ -154,6 +170,7 @@ struct DataPageHeader {
   Encoding encoding                  = PLAIN;  // Encoding used for this data page
   Encoding definition_level_encoding = PLAIN;  // Encoding used for definition levels
   Encoding repetition_level_encoding = PLAIN;  // Encoding used for repetition levels
+  Statistics statistics;                        // Optional page-level statistics
 };
 
 /**
@@ -181,6 +198,48 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page within the file
+ **/
+struct PageLocation {
+  int64_t offset               = 0;  // Offset of the page header in the file
+  int32_t compressed_page_size = 0;  // Size of the page, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the data page locations of a column chunk
+ *
+ * Page locations are ordered by row index; dictionary pages are not listed.
+ **/
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the per-page statistics of a column chunk
+ *
+ * Each list holds one entry per data page, in the same order as the OffsetIndex. Min/max values
+ * are stored in the same encoding as the Statistics min_value/max_value fields.
+ **/
+struct ColumnIndex {
+  std::vector<bool> null_pages;  // Whether each page contains only null values
+  std::vector<std::string> min_values;
+  std::vector<std::string> max_values;
+  BoundaryOrder boundary_order = UNORDERED;  // Ordering of the min/max values across pages
+  std::vector<int64_t> null_counts;          // Optional count of null values of each page
+};
+
+/**
+ * @brief Thrift-derived struct describing a column chunk's bloom filter, followed by its bitset
+ *
+ * Only the split-block algorithm, xxHash and no compression are defined by the format, so the
+ * corresponding union fields are implied.
+ **/
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  **/
@@ -286,6 +345,11 @@ class CompactProtocolReader {
   DECL_PARQUET_STRUCT(DataPageHeader);
   DECL_PARQUET_STRUCT(DictionaryPageHeader);
   DECL_PARQUET_STRUCT(KeyValue);
+  DECL_PARQUET_STRUCT(Statistics);
+  DECL_PARQUET_STRUCT(PageLocation);
+  DECL_PARQUET_STRUCT(OffsetIndex);
+  DECL_PARQUET_STRUCT(ColumnIndex);
+  DECL_PARQUET_STRUCT(BloomFilterHeader);
 #undef DECL_PARQUET_STRUCT
 
  public:
@@ -357,6 +421,10 @@ class CompactProtocolWriter {
   DECL_CPW_STRUCT(KeyValue);
   DECL_CPW_STRUCT(ColumnChunk);
   DECL_CPW_STRUCT(ColumnMetaData);
+  DECL_CPW_STRUCT(PageLocation);
+  DECL_CPW_STRUCT(OffsetIndex);
+  DECL_CPW_STRUCT(ColumnIndex);
+  DECL_CPW_STRUCT(BloomFilterHeader);
 #undef DECL_CPW_STRUCT
 
  protected:
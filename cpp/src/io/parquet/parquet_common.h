@@ -118,6 +118,15 @@ enum PageType {
   DATA_PAGE_V2    = 3,
 };
 
+/**
+ * @brief Ordering of the page min/max values within a column index
+ **/
+enum BoundaryOrder {
+  UNORDERED  = 0,
+  ASCENDING  = 1,
+  DESCENDING = 2,
+};
+
 /**
  * @brief Thrift compact protocol struct field types
  **/
@@ -96,8 +96,11 @@ struct ColumnChunkDesc {
       max_num_pages(0),
       page_info(nullptr),
       str_dict_index(nullptr),
+      dict_index_base(-1),
       valid_map_base(nullptr),
       column_data_base(nullptr),
+      def_levels_base(nullptr),
+      rep_levels_base(nullptr),
       codec(codec_),
       converted_type(converted_type_),
       decimal_scale(decimal_scale_),
@@ -108,8 +111,8 @@ struct ColumnChunkDesc {
   uint8_t *compressed_data;     // pointer to compressed column chunk data
   size_t compressed_size;       // total compressed data size for this chunk
   size_t num_values;            // total number of values in this column
-  size_t start_row;             // starting row of this chunk
-  uint32_t num_rows;            // number of rows in this chunk
+  size_t start_row;             // starting row of this chunk (level value for nested columns)
+  uint32_t num_rows;            // number of rows in this chunk (level values for nested columns)
   int16_t max_def_level;        // max definition level
   int16_t max_rep_level;        // max repetition level
   uint16_t data_type;           // basic column data type, ((type_length << 3) |
@@ -122,8 +125,12 @@ struct ColumnChunkDesc {
   PageInfo *page_info;          // output page info for up to num_dict_pages +
                                 // num_data_pages (dictionary pages first)
   nvstrdesc_s *str_dict_index;  // index for string dictionary
+  int32_t dict_index_base;      // offset added to string dictionary indices output in place of
+                                // strings (-1 to output strings)
   uint32_t *valid_map_base;     // base pointer of valid bit map for this column
   void *column_data_base;       // base pointer of column data
+  uint8_t *def_levels_base;     // base pointer of decoded definition levels (nested columns)
+  uint8_t *rep_levels_base;     // base pointer of decoded repetition levels (nested columns)
   int8_t codec;                 // compressed codec enum
   int8_t converted_type;        // converted type enum
   int8_t decimal_scale;         // decimal scale pow(10, -decimal_scale)
@@ -140,7 +147,7 @@ struct EncColumnDesc : stats_column_desc {
   uint8_t converted_type;  //!< logical data type
   uint8_t level_bits;  //!< bits to encode max definition (lower nibble) & repetition (upper nibble)
                        //!< levels
-  uint8_t pad;
+  uint8_t delta_encoding;  //!< nonzero to DELTA-encode data pages without a dictionary
 };
 
 #define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows in a page fragment
@@ -184,7 +191,8 @@ constexpr size_t kDictScratchSize    = (1 << kDictHashBits) * sizeof(uint32_t);
 inline size_t __device__ __host__ GetMaxCompressedBfrSize(size_t uncomp_size,
                                                           uint32_t num_pages = 1)
 {
-  return uncomp_size + (uncomp_size >> 7) + num_pages * 8;
+  // Per-page term covers the gzip header and trailer, and the zstd frame header
+  return uncomp_size + (uncomp_size >> 7) + num_pages * 32;
 }
 
 /**
@@ -212,6 +220,17 @@ struct EncColumnChunk {
   uint32_t ck_stat_size;          //!< Size of chunk-level statistics (included in 1st page header)
 };
 
+/**
+ * @brief Struct describing the split-block bloom filter of an encoder column chunk
+ **/
+struct BloomFilterChunk {
+  const EncColumnDesc *col_desc;  //!< Column description
+  uint32_t *bitset;               //!< Filter bitset (8 words per block), zero-initialized
+  uint32_t num_blocks;            //!< Number of 256-bit blocks in the filter
+  uint32_t start_row;             //!< First row of chunk
+  uint32_t num_rows;              //!< Number of rows in chunk
+};
+
 /**
  * @brief Launches kernel for parsing the page headers in the column chunks
  *
@@ -263,6 +282,26 @@ cudaError_t DecodePageData(PageInfo *pages,
                            size_t min_row      = 0,
                            cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for decoding the definition and repetition levels of nested columns
+ *
+ * The levels of each data page are written to the chunk's level outputs, at the page's position
+ * within the column. Chunks without repetition levels or level outputs are skipped.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t DecodePageLevels(PageInfo *pages,
+                             int32_t num_pages,
+                             ColumnChunkDesc *chunks,
+                             int32_t num_chunks,
+                             cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for initializing encoder page fragments
  *
@@ -424,6 +463,23 @@ cudaError_t BuildChunkDictionaries(EncColumnChunk *chunks,
                                    uint32_t num_chunks,
                                    cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for building the bloom filters of column chunks
+ *
+ * Values are hashed in their PLAIN encoding with xxHash64, as required by the Parquet format.
+ *
+ * @param[in,out] chunks Bloom filter chunks, with zero-initialized bitsets
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] max_rows Maximum number of rows in a chunk
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(BloomFilterChunk *chunks,
+                              uint32_t num_chunks,
+                              uint32_t max_rows,
+                              cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -22,7 +22,16 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
-
+#include <io/utilities/chunk_cache.hpp>
+#include <io/utilities/pinned_host_pool.hpp>
+#include <io/utilities/statistics_filter.hpp>
+
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -30,9 +39,22 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <numeric>
 #include <regex>
+#include <string>
 
 namespace cudf {
 namespace io {
@@ -49,7 +71,9 @@ namespace {
 constexpr type_id to_type_id(parquet::Type physical,
                              parquet::ConvertedType logical,
                              bool strings_to_categorical,
+                             bool strings_to_dictionary,
                              type_id timestamp_type_id,
+                             bool decimals_as_float,
                              int32_t decimal_scale)
 {
   // Logical type used for actual data interpretation; the legacy converted type
@@ -67,6 +91,11 @@ constexpr type_id to_type_id(parquet::Type physical,
       return (timestamp_type_id != type_id::EMPTY) ? timestamp_type_id
                                                    : type_id::TIMESTAMP_MILLISECONDS;
     case parquet::DECIMAL:
+      // Integer decimals can be read as fixed-point columns of their representation
+      if (!decimals_as_float) {
+        if (physical == parquet::INT32) { return type_id::DECIMAL32; }
+        if (physical == parquet::INT64) { return type_id::DECIMAL64; }
+      }
       if (decimal_scale != 0 || (physical != parquet::INT32 && physical != parquet::INT64)) {
         return type_id::FLOAT64;
       }
@@ -83,6 +112,9 @@ constexpr type_id to_type_id(parquet::Type physical,
     case parquet::FLOAT: return type_id::FLOAT32;
     case parquet::DOUBLE: return type_id::FLOAT64;
     case parquet::BYTE_ARRAY:
+      // Can be mapped to INT32 (32-bit hash), DICTIONARY32 or STRING
+      if (strings_to_categorical) { return type_id::INT32; }
+      return strings_to_dictionary ? type_id::DICTIONARY32 : type_id::STRING;
     case parquet::FIXED_LEN_BYTE_ARRAY:
       // Can be mapped to INT32 (32-bit hash) or STRING
       return strings_to_categorical ? type_id::INT32 : type_id::STRING;
@@ -95,6 +127,18 @@ constexpr type_id to_type_id(parquet::Type physical,
   return type_id::EMPTY;
 }
 
+/**
+ * @brief Returns the `data_type` of a column of type @p id, which has the scale of the
+ * Parquet decimal for fixed-point types
+ *
+ * A Parquet decimal scale counts the fractional digits, whereas the scale of a cuDF
+ * fixed-point type is the base 10 exponent of the representation.
+ */
+data_type to_data_type(type_id id, int32_t decimal_scale)
+{
+  return is_fixed_point(data_type{id}) ? data_type{id, -decimal_scale} : data_type{id};
+}
+
 /**
  * @brief Function that translates cuDF time unit to Parquet clock frequency
  */
@@ -144,13 +188,506 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+// Overloaded below for the Parquet date/time types
+using cudf::io::detail::tick_duration_ns;
+
+/**
+ * @brief Returns the duration of one tick of a Parquet date/time type in nanoseconds, or 0
+ */
+constexpr int64_t tick_duration_ns(parquet::ConvertedType converted)
+{
+  switch (converted) {
+    case parquet::DATE: return 86400000000000;
+    case parquet::TIMESTAMP_MILLIS: return 1000000;
+    case parquet::TIMESTAMP_MICROS: return 1000;
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Converts an integral filter literal to the representation stored in the file
+ *
+ * @return False if the literal cannot be represented exactly in the stored units
+ */
+bool to_stored_value(const filter_literal &literal,
+                     parquet::ConvertedType converted,
+                     int64_t &value)
+{
+  const auto literal_ns = tick_duration_ns(literal.type.id());
+  const auto stored_ns  = tick_duration_ns(converted);
+  value                 = literal.int_value;
+  if (literal_ns == 0 || stored_ns == 0 || literal_ns == stored_ns) { return true; }
+  if (literal_ns > stored_ns) {
+    value *= literal_ns / stored_ns;
+    return true;
+  }
+  const auto ratio = stored_ns / literal_ns;
+  if (value % ratio != 0) { return false; }
+  value /= ratio;
+  return true;
+}
+
+/**
+ * @brief Decodes a plain-encoded statistics value
+ *
+ * @return False if the value is missing or its size does not match the type
+ */
+template <typename T>
+bool decode_statistics_value(const std::string &blob, T &value)
+{
+  if (blob.size() != sizeof(T)) { return false; }
+  memcpy(&value, blob.data(), sizeof(T));
+  return true;
+}
+
+/**
+ * @brief Returns whether the min/max statistics of a column chunk allow some of its values to
+ * satisfy the filter
+ *
+ * Returns true whenever the statistics are missing or cannot be interpreted for the filter.
+ */
+bool statistics_may_match(const SchemaElement &col_schema,
+                          const Statistics &stats,
+                          const column_filter &filter)
+{
+  // The deprecated min/max fields use signed ordering, only suitable for signed numeric types
+  const bool has_minmax = !stats.max_value.empty();
+  const auto &min_blob  = has_minmax ? stats.min_value : stats.min;
+  const auto &max_blob  = has_minmax ? stats.max_value : stats.max;
+
+  if (col_schema.type == parquet::BYTE_ARRAY) {
+    if (!has_minmax) { return true; }
+    std::vector<std::string> values;
+    for (const auto &literal : filter.values) {
+      CUDF_EXPECTS(literal.type.id() == type_id::STRING,
+                   "Filter literal type does not match the column type");
+      values.emplace_back(literal.string_value);
+    }
+    return range_may_match(filter.op, stats.min_value, stats.max_value, values);
+  }
+
+  // Decode the min/max as integers when possible, otherwise as floating-point values
+  bool is_integral = false;
+  int64_t imin = 0, imax = 0;
+  double fmin = 0.0, fmax = 0.0;
+  if (col_schema.converted_type == parquet::DECIMAL) { return true; }
+  switch (col_schema.type) {
+    case parquet::BOOLEAN: {
+      uint8_t bmin, bmax;
+      if (!decode_statistics_value(min_blob, bmin) || !decode_statistics_value(max_blob, bmax)) {
+        return true;
+      }
+      imin        = bmin;
+      imax        = bmax;
+      is_integral = true;
+    } break;
+    case parquet::INT32:
+      if (col_schema.converted_type == parquet::UINT_8 ||
+          col_schema.converted_type == parquet::UINT_16 ||
+          col_schema.converted_type == parquet::UINT_32) {
+        uint32_t umin, umax;
+        if (!has_minmax || !decode_statistics_value(min_blob, umin) ||
+            !decode_statistics_value(max_blob, umax)) {
+          return true;
+        }
+        imin = umin;
+        imax = umax;
+      } else {
+        int32_t i32min, i32max;
+        if (!decode_statistics_value(min_blob, i32min) ||
+            !decode_statistics_value(max_blob, i32max)) {
+          return true;
+        }
+        imin = i32min;
+        imax = i32max;
+      }
+      is_integral = true;
+      break;
+    case parquet::INT64:
+      if (col_schema.converted_type == parquet::UINT_64 ||
+          !decode_statistics_value(min_blob, imin) || !decode_statistics_value(max_blob, imax)) {
+        return true;
+      }
+      is_integral = true;
+      break;
+    case parquet::FLOAT: {
+      float f32min, f32max;
+      if (!decode_statistics_value(min_blob, f32min) ||
+          !decode_statistics_value(max_blob, f32max)) {
+        return true;
+      }
+      fmin = f32min;
+      fmax = f32max;
+    } break;
+    case parquet::DOUBLE:
+      if (!decode_statistics_value(min_blob, fmin) || !decode_statistics_value(max_blob, fmax)) {
+        return true;
+      }
+      break;
+    default: return true;
+  }
+
+  const bool integral_literals =
+    std::all_of(filter.values.begin(), filter.values.end(), [](const filter_literal &literal) {
+      CUDF_EXPECTS(literal.type.id() != type_id::STRING,
+                   "Filter literal type does not match the column type");
+      return !is_floating_literal(literal);
+    });
+  if (is_integral && integral_literals) {
+    std::vector<int64_t> values;
+    for (const auto &literal : filter.values) {
+      int64_t value;
+      if (!to_stored_value(literal, col_schema.converted_type, value)) { return true; }
+      values.emplace_back(value);
+    }
+    return range_may_match(filter.op, imin, imax, values);
+  }
+
+  if (is_integral) {
+    fmin = static_cast<double>(imin);
+    fmax = static_cast<double>(imax);
+  }
+  if (std::isnan(fmin) || std::isnan(fmax)) { return true; }
+  std::vector<double> values;
+  for (const auto &literal : filter.values) {
+    values.emplace_back(is_floating_literal(literal) ? literal.float_value
+                                                     : static_cast<double>(literal.int_value));
+  }
+  return range_may_match(filter.op, fmin, fmax, values);
+}
+
+/**
+ * @brief Decodes the min/max statistics of a column chunk into literals of the column type
+ *
+ * Unsigned values are returned as INT64 literals.
+ *
+ * @return False if the statistics are missing or cannot be interpreted
+ */
+bool decode_statistics(const SchemaElement &col_schema,
+                       const Statistics &stats,
+                       filter_literal &min,
+                       filter_literal &max)
+{
+  const bool has_minmax = !stats.max_value.empty();
+  const auto &min_blob  = has_minmax ? stats.min_value : stats.min;
+  const auto &max_blob  = has_minmax ? stats.max_value : stats.max;
+  if (col_schema.converted_type == parquet::DECIMAL) { return false; }
+
+  const auto type = data_type{
+    to_type_id(col_schema.type, col_schema.converted_type, false, false, type_id::EMPTY, true, 0)};
+  switch (col_schema.type) {
+    case parquet::BYTE_ARRAY:
+      if (!has_minmax) { return false; }
+      min = filter_literal{stats.min_value};
+      max = filter_literal{stats.max_value};
+      return true;
+    case parquet::BOOLEAN: {
+      uint8_t bmin, bmax;
+      if (!decode_statistics_value(min_blob, bmin) || !decode_statistics_value(max_blob, bmax)) {
+        return false;
+      }
+      min = filter_literal{int64_t{bmin}, type};
+      max = filter_literal{int64_t{bmax}, type};
+    } break;
+    case parquet::INT32:
+      if (col_schema.converted_type == parquet::UINT_8 ||
+          col_schema.converted_type == parquet::UINT_16 ||
+          col_schema.converted_type == parquet::UINT_32) {
+        uint32_t umin, umax;
+        if (!has_minmax || !decode_statistics_value(min_blob, umin) ||
+            !decode_statistics_value(max_blob, umax)) {
+          return false;
+        }
+        min = filter_literal{int64_t{umin}};
+        max = filter_literal{int64_t{umax}};
+      } else {
+        int32_t i32min, i32max;
+        if (!decode_statistics_value(min_blob, i32min) ||
+            !decode_statistics_value(max_blob, i32max)) {
+          return false;
+        }
+        min = filter_literal{int64_t{i32min}, type};
+        max = filter_literal{int64_t{i32max}, type};
+      }
+      break;
+    case parquet::INT64: {
+      int64_t imin, imax;
+      if (col_schema.converted_type == parquet::UINT_64 ||
+          !decode_statistics_value(min_blob, imin) || !decode_statistics_value(max_blob, imax)) {
+        return false;
+      }
+      min = filter_literal{imin, type};
+      max = filter_literal{imax, type};
+    } break;
+    case parquet::FLOAT: {
+      float f32min, f32max;
+      if (!decode_statistics_value(min_blob, f32min) ||
+          !decode_statistics_value(max_blob, f32max)) {
+        return false;
+      }
+      min      = filter_literal{static_cast<double>(f32min)};
+      max      = filter_literal{static_cast<double>(f32max)};
+      min.type = max.type = type;
+    } break;
+    case parquet::DOUBLE: {
+      double fmin, fmax;
+      if (!decode_statistics_value(min_blob, fmin) || !decode_statistics_value(max_blob, fmax)) {
+        return false;
+      }
+      min = filter_literal{fmin};
+      max = filter_literal{fmax};
+    } break;
+    default: return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the range of data pages of a column chunk that overlap a range of rows
+ *
+ * @param page_locations Data page locations from the chunk's offset index
+ * @param min_row First row to read, relative to the row group
+ * @param max_row Row after the last row to read, relative to the row group
+ *
+ * @return Index of the first page and index after the last page to read
+ */
+std::pair<size_t, size_t> select_data_pages(const std::vector<PageLocation> &page_locations,
+                                            int64_t min_row,
+                                            int64_t max_row)
+{
+  size_t first = 0, last = page_locations.size();
+  while (first + 1 < last && page_locations[first + 1].first_row_index <= min_row) { first++; }
+  while (last > first + 1 && page_locations[last - 1].first_row_index >= max_row) { last--; }
+  return {first, last};
+}
+
+/**
+ * @brief Returns whether the page locations are consistent with the byte range of their chunk
+ */
+bool is_valid_offset_index(const OffsetIndex &offset_index,
+                           int64_t chunk_offset,
+                           int64_t chunk_size,
+                           int64_t chunk_rows)
+{
+  const auto &locations = offset_index.page_locations;
+  if (locations.empty() || locations[0].first_row_index != 0) { return false; }
+  for (size_t i = 0; i < locations.size(); ++i) {
+    const auto &page    = locations[i];
+    const bool is_last  = (i + 1 == locations.size());
+    const auto end      = is_last ? chunk_offset + chunk_size : locations[i + 1].offset;
+    const auto next_row = is_last ? chunk_rows : locations[i + 1].first_row_index;
+    if (page.offset < chunk_offset || page.compressed_page_size <= 0 ||
+        page.offset + page.compressed_page_size > end || page.first_row_index >= next_row) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Functor returning the index of the first level value of a row, or the number of level
+ * values for the rows past the end
+ */
+struct row_start_value {
+  const size_type *row_starts;
+  size_type num_rows;
+  size_type num_values;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return (row < num_rows) ? row_starts[row] : num_values;
+  }
+};
+
+/**
+ * @brief Creates a LIST column from the decoded data of a nested column
+ *
+ * The leaf values are decoded one per level value. A repetition level of zero starts a new row,
+ * and the values whose definition level reaches `element_level` are the list elements.
+ *
+ * @param child_type Data type of the list elements
+ * @param first_row Index of the first output row among the decoded rows
+ * @param num_rows Number of output rows
+ * @param buffer Decoded leaf values, one per level value
+ * @param rep_levels Decoded repetition levels
+ * @param def_levels Decoded definition levels
+ * @param element_level Minimum definition level of the list elements
+ * @param list_level Minimum definition level of the non-null lists
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_list_output(data_type child_type,
+                                         size_type first_row,
+                                         size_type num_rows,
+                                         column_buffer &buffer,
+                                         const rmm::device_vector<uint8_t> &rep_levels,
+                                         const rmm::device_vector<uint8_t> &def_levels,
+                                         int element_level,
+                                         int list_level,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  const auto num_values = static_cast<size_type>(rep_levels.size());
+  const auto rep        = rep_levels.data().get();
+  const auto def        = def_levels.data().get();
+  auto policy           = rmm::exec_policy(stream)->on(stream);
+
+  // Locate the first level value of every decoded row
+  rmm::device_vector<size_type> row_starts(num_values);
+  const auto num_decoded_rows = static_cast<size_type>(
+    thrust::copy_if(policy,
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_values),
+                    row_starts.begin(),
+                    [rep] __device__(size_type i) { return rep[i] == 0; }) -
+    row_starts.begin());
+  CUDF_EXPECTS(first_row + num_rows <= num_decoded_rows, "Mismatched number of nested rows");
+  const row_start_value row_start{row_starts.data().get(), num_decoded_rows, num_values};
+
+  // Number of list elements preceding every level value
+  rmm::device_vector<size_type> element_counts(num_values + 1);
+  auto is_element = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [def, element_level, num_values] __device__(size_type i) {
+      return (i < num_values && def[i] >= element_level) ? 1 : 0;
+    });
+  thrust::exclusive_scan(policy, is_element, is_element + num_values + 1, element_counts.begin());
+
+  // Offsets of the selected rows, relative to their first element
+  auto offsets = std::make_unique<column>(data_type{type_id::INT32},
+                                          num_rows + 1,
+                                          rmm::device_buffer((num_rows + 1) * sizeof(size_type),
+                                                             stream,
+                                                             mr));
+  const auto counts = element_counts.data().get();
+  thrust::transform(policy,
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows + 1),
+                    offsets->mutable_view().data<size_type>(),
+                    [counts, row_start, first_row] __device__(size_type row) {
+                      return counts[row_start(first_row + row)] - counts[row_start(first_row)];
+                    });
+
+  // Null lists are those whose definition level doesn't reach the list
+  rmm::device_buffer null_mask{};
+  size_type null_count = 0;
+  if (list_level > 0) {
+    auto valid =
+      cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                             thrust::make_counting_iterator<size_type>(num_rows),
+                             [def, row_start, first_row, list_level] __device__(size_type row) {
+                               return def[row_start(first_row + row)] >= list_level;
+                             },
+                             stream,
+                             mr);
+    null_mask  = std::move(valid.first);
+    null_count = valid.second;
+  }
+
+  // Gather the elements of the selected rows into the child column
+  std::array<size_type, 2> value_range{num_values, num_values};
+  if (first_row < num_decoded_rows) {
+    CUDA_TRY(cudaMemcpyAsync(&value_range[0],
+                             row_starts.data().get() + first_row,
+                             sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  if (first_row + num_rows < num_decoded_rows) {
+    CUDA_TRY(cudaMemcpyAsync(&value_range[1],
+                             row_starts.data().get() + first_row + num_rows,
+                             sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  rmm::device_vector<size_type> gather_map(value_range[1] - value_range[0]);
+  auto is_element_value   = [def, element_level] __device__(size_type i) {
+    return def[i] >= element_level;
+  };
+  const auto num_elements = static_cast<size_type>(
+    thrust::copy_if(policy,
+                    thrust::make_counting_iterator<size_type>(value_range[0]),
+                    thrust::make_counting_iterator<size_type>(value_range[1]),
+                    gather_map.begin(),
+                    is_element_value) -
+    gather_map.begin());
+  auto values = make_column(child_type, num_values, buffer, stream);
+  column_view map_view(data_type{type_id::INT32}, num_elements, gather_map.data().get());
+  auto child = std::move(cudf::detail::gather(table_view{{values->view()}},
+                                              map_view,
+                                              cudf::detail::out_of_bounds_policy::NULLIFY,
+                                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                              mr,
+                                              stream)
+                           ->release()
+                           .front());
+
+  std::vector<std::unique_ptr<column>> children;
+  children.emplace_back(std::move(offsets));
+  children.emplace_back(std::move(child));
+  return std::make_unique<column>(data_type{type_id::LIST},
+                                  num_rows,
+                                  rmm::device_buffer{},
+                                  std::move(null_mask),
+                                  null_count,
+                                  std::move(children));
+}
+
+/**
+ * @brief Creates an empty LIST column
+ *
+ * @param child_type Data type of the list elements
+ */
+std::unique_ptr<column> make_empty_list_output(data_type child_type)
+{
+  std::vector<std::unique_ptr<column>> children;
+  children.emplace_back(make_empty_column(data_type{type_id::INT32}));
+  children.emplace_back(make_empty_column(child_type));
+  return std::make_unique<column>(data_type{type_id::LIST},
+                                  0,
+                                  rmm::device_buffer{},
+                                  rmm::device_buffer{},
+                                  0,
+                                  std::move(children));
+}
+
 }  // namespace
 
 /**
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource *source)
+  /**
+   * @brief Parses the metadata of one or more files sharing the same schema
+   *
+   * The row groups of all the files are concatenated, in the order of the sources.
+   *
+   * @param sources Dataset sources
+   */
+  explicit metadata(std::vector<datasource *> sources) : sources(std::move(sources))
+  {
+    CUDF_EXPECTS(!this->sources.empty(), "No data source");
+    for (size_t i = 0; i < this->sources.size(); ++i) {
+      if (i == 0) {
+        parse_file_metadata(this->sources[i], *this);
+      } else {
+        FileMetaData file_md;
+        parse_file_metadata(this->sources[i], file_md);
+        CUDF_EXPECTS(is_same_schema(file_md.schema), "Mismatched schemas across data sources");
+        num_rows += file_md.num_rows;
+        row_groups.insert(row_groups.end(),
+                          std::make_move_iterator(file_md.row_groups.begin()),
+                          std::make_move_iterator(file_md.row_groups.end()));
+      }
+      row_group_sources.resize(row_groups.size(), i);
+    }
+  }
+
+  /**
+   * @brief Reads and parses the file-level metadata of a single file
+   */
+  static void parse_file_metadata(datasource *source, FileMetaData &md)
   {
     constexpr auto header_len = sizeof(file_header_s);
     constexpr auto ender_len  = sizeof(file_ender_s);
@@ -168,32 +705,131 @@ struct metadata : public FileMetaData {
 
     const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
     CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
-    CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+    CUDF_EXPECTS(cp.read(&md), "Cannot parse metadata");
+    CUDF_EXPECTS(cp.InitSchema(&md), "Cannot initialize schema");
+  }
+
+  /**
+   * @brief Returns whether another file's schema matches this one, so that its schema indexes,
+   * types and definition/repetition levels apply to both
+   */
+  bool is_same_schema(const std::vector<SchemaElement> &other) const
+  {
+    return std::equal(
+      schema.begin(),
+      schema.end(),
+      other.begin(),
+      other.end(),
+      [](const SchemaElement &a, const SchemaElement &b) {
+        return a.name == b.name && a.type == b.type && a.type_length == b.type_length &&
+               a.repetition_type == b.repetition_type && a.converted_type == b.converted_type &&
+               a.num_children == b.num_children && a.decimal_scale == b.decimal_scale &&
+               a.decimal_precision == b.decimal_precision;
+      });
+  }
+
+  /**
+   * @brief Returns the source containing a row group
+   */
+  datasource *get_source(size_type row_group) const
+  {
+    return sources[row_group_sources[row_group]];
+  }
+
+  /**
+   * @brief Reads and parses a page index structure (ColumnIndex or OffsetIndex) of a column chunk
+   *
+   * @param row_group Index of the row group containing the column chunk
+   * @param offset File offset of the structure
+   * @param length Size of the structure, in bytes
+   * @param index Structure to populate
+   *
+   * @return True if the structure was found and parsed successfully, false otherwise
+   */
+  template <typename T>
+  bool read_page_index(size_type row_group, int64_t offset, int32_t length, T &index)
+  {
+    auto source = get_source(row_group);
+    if (offset <= 0 || length <= 0 || static_cast<size_t>(offset + length) > source->size()) {
+      return false;
+    }
+    const auto buffer = source->host_read(offset, length);
+    CompactProtocolReader cp(buffer->data(), buffer->size());
+    return cp.read(&index);
   }
 
   inline int64_t get_total_rows() const { return num_rows; }
   inline int get_num_row_groups() const { return row_groups.size(); }
   inline int get_num_columns() const { return row_groups[0].columns.size(); }
 
-  std::string get_column_name(const std::vector<std::string> &path_in_schema)
+  std::string get_column_name(const std::vector<std::string> &path_in_schema,
+                              size_t depth = std::numeric_limits<size_t>::max())
   {
-    std::string s = (path_in_schema.size() > 0) ? path_in_schema[0] : "";
-    for (size_t i = 1; i < path_in_schema.size(); i++) { s += "." + path_in_schema[i]; }
+    depth         = std::min(depth, path_in_schema.size());
+    std::string s = (depth > 0) ? path_in_schema[0] : "";
+    for (size_t i = 1; i < depth; i++) { s += "." + path_in_schema[i]; }
     return s;
   }
 
+  /**
+   * @brief Returns the name of the column of a column chunk
+   *
+   * Nested columns are named after their list node, e.g. `a` rather than `a.list.element`.
+   */
+  std::string get_column_name(const ColumnChunk &chunk)
+  {
+    const auto list_node = get_list_node(chunk.schema_idx);
+    if (list_node < 0) { return get_column_name(chunk.meta_data.path_in_schema); }
+    size_t depth = 0;
+    for (int node = list_node; node > 0; node = schema[node].parent_idx) { depth++; }
+    return get_column_name(chunk.meta_data.path_in_schema, depth);
+  }
+
   std::vector<std::string> get_column_names()
   {
     std::vector<std::string> all_names;
     if (row_groups.size() != 0) {
       for (const auto &chunk : row_groups[0].columns) {
-        all_names.emplace_back(get_column_name(chunk.meta_data.path_in_schema));
+        all_names.emplace_back(get_column_name(chunk));
       }
     }
     return all_names;
   }
 
+  /**
+   * @brief Returns the schema node that maps to the output LIST column of a nested leaf
+   *
+   * A single level of nesting is supported, either as the standard three-level structure
+   * (`<list-repetition> group <name> (LIST) { repeated group list { <element> } }`) or as a bare
+   * repeated field.
+   *
+   * @param leaf_idx Schema index of the leaf
+   *
+   * @return Schema index of the list node, or -1 if the leaf is not in a supported nested column
+   */
+  int get_list_node(int leaf_idx) const
+  {
+    if (leaf_idx < 0 || schema[leaf_idx].max_repetition_level != 1) { return -1; }
+    const int repeated = get_repeated_node(leaf_idx);
+    if (repeated == leaf_idx) { return repeated; }
+    // Lists of structs are not supported
+    if (schema[leaf_idx].parent_idx != repeated || schema[repeated].num_children != 1) {
+      return -1;
+    }
+    const int parent = schema[repeated].parent_idx;
+    return (parent > 0 && schema[parent].converted_type == LIST) ? parent : repeated;
+  }
+
+  /**
+   * @brief Returns the repeated schema node of a leaf with a single repetition level
+   */
+  int get_repeated_node(int leaf_idx) const
+  {
+    int node = leaf_idx;
+    while (node > 0 && schema[node].repetition_type != REPEATED) { node = schema[node].parent_idx; }
+    return node;
+  }
+
   /**
    * @brief Extracts the pandas "index_columns" section
    *
@@ -254,12 +890,87 @@ struct metadata : public FileMetaData {
     }
   }
 
+  /**
+   * @brief Returns whether the column chunk statistics of a row group allow some of its rows to
+   * satisfy all the filters
+   *
+   * @param row_group_idx Index of the row group to check
+   * @param filters Predicates that must all be satisfied
+   */
+  bool row_group_may_match(size_type row_group_idx, const std::vector<column_filter> &filters)
+  {
+    const auto &row_group = row_groups[row_group_idx];
+    for (const auto &filter : filters) {
+      const auto chunk = std::find_if(
+        row_group.columns.begin(), row_group.columns.end(), [&](const ColumnChunk &col) {
+          return get_column_name(col) == filter.column_name;
+        });
+      if (chunk == row_group.columns.end()) { continue; }
+
+      if (!chunk->meta_data.statistics_blob.empty()) {
+        // The blob excludes the struct terminator; restore it so the last field can be parsed
+        std::vector<uint8_t> blob(chunk->meta_data.statistics_blob);
+        blob.push_back(0);
+        Statistics stats;
+        CompactProtocolReader cp(blob.data(), blob.size());
+        if (cp.read(&stats)) {
+          // No comparison is satisfied by a null, so all-null chunks never match
+          if (chunk->meta_data.num_values > 0 && stats.null_count == chunk->meta_data.num_values) {
+            return false;
+          }
+          if (!statistics_may_match(schema[chunk->schema_idx], stats, filter)) { return false; }
+        }
+      }
+      if (!column_index_may_match(row_group_idx, *chunk, filter)) { return false; }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Returns whether the page statistics of a column chunk allow some of its values to
+   * satisfy the filter
+   *
+   * Finer-grained than the chunk statistics: a chunk whose min/max range covers the filter values
+   * may still have none of its pages match. Returns true if the chunk has no column index.
+   *
+   * @param row_group_idx Index of the row group containing the column chunk
+   * @param chunk Column chunk to check
+   * @param filter Predicate on the column chunk's values
+   */
+  bool column_index_may_match(size_type row_group_idx,
+                              const ColumnChunk &chunk,
+                              const column_filter &filter)
+  {
+    ColumnIndex column_index;
+    if (!read_page_index(
+          row_group_idx, chunk.column_index_offset, chunk.column_index_length, column_index)) {
+      return true;
+    }
+    const auto num_pages = column_index.null_pages.size();
+    if (column_index.min_values.size() != num_pages ||
+        column_index.max_values.size() != num_pages) {
+      return true;
+    }
+    for (size_t i = 0; i < num_pages; ++i) {
+      if (column_index.null_pages[i]) { continue; }
+      Statistics page_stats;
+      page_stats.min_value = column_index.min_values[i];
+      page_stats.max_value = column_index.max_values[i];
+      if (statistics_may_match(schema[chunk.schema_idx], page_stats, filter)) { return true; }
+    }
+    return false;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
+   * Row groups that cannot satisfy the filters are dropped from the selection; in that case the
+   * row start and count refer to the rows of the remaining row groups.
+   *
    * @param row_group Index of the row group to select
    * @param max_rowgroup_count Max number of consecutive row groups if > 0
    * @param row_group_indices Arbitrary rowgroup list[max_rowgroup_count] if non-null
+   * @param filters Predicates used to skip row groups based on their statistics
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
    *
@@ -268,17 +979,23 @@ struct metadata : public FileMetaData {
   auto select_row_groups(size_type row_group,
                          size_type max_rowgroup_count,
                          const size_type *row_group_indices,
+                         const std::vector<column_filter> &filters,
                          size_type &row_start,
                          size_type &row_count)
   {
     std::vector<std::pair<size_type, size_t>> selection;
 
+    auto is_selected = [&](size_type rowgroup_idx) {
+      return filters.empty() || row_group_may_match(rowgroup_idx, filters);
+    };
+
     if (row_group_indices) {
       row_count = 0;
       for (size_type i = 0; i < max_rowgroup_count; i++) {
         auto rowgroup_idx = row_group_indices[i];
         CUDF_EXPECTS(rowgroup_idx >= 0 && rowgroup_idx < get_num_row_groups(),
                      "Invalid rowgroup index");
+        if (!is_selected(rowgroup_idx)) { continue; }
         selection.emplace_back(rowgroup_idx, row_count);
         row_count += row_groups[rowgroup_idx].num_rows;
       }
@@ -286,19 +1003,30 @@ struct metadata : public FileMetaData {
       CUDF_EXPECTS(row_group < get_num_row_groups(), "Non-existent row group");
       row_count = 0;
       do {
+        if (!is_selected(row_group)) { continue; }
         selection.emplace_back(row_group, row_start + row_count);
         row_count += row_groups[row_group].num_rows;
       } while (--max_rowgroup_count > 0 && ++row_group < get_num_row_groups());
     } else {
+      std::vector<size_type> candidates;
+      int64_t total_rows = 0;
+      for (size_type i = 0; i < get_num_row_groups(); ++i) {
+        if (is_selected(i)) {
+          candidates.push_back(i);
+          total_rows += row_groups[i].num_rows;
+        }
+      }
+
       row_start = std::max(row_start, 0);
       if (row_count < 0) {
         row_count = static_cast<size_type>(
-          std::min<int64_t>(get_total_rows(), std::numeric_limits<size_type>::max()));
+          std::min<int64_t>(total_rows, std::numeric_limits<size_type>::max()));
       }
       CUDF_EXPECTS(row_count >= 0, "Invalid row count");
-      CUDF_EXPECTS(row_start <= get_total_rows(), "Invalid row start");
+      CUDF_EXPECTS(row_start <= total_rows, "Invalid row start");
 
-      for (size_t i = 0, count = 0; i < row_groups.size(); ++i) {
+      size_t count = 0;
+      for (const auto i : candidates) {
         size_t chunk_start_row = count;
         count += row_groups[i].num_rows;
         if (count > static_cast<size_t>(row_start) || count == 0) {
@@ -342,46 +1070,195 @@ struct metadata : public FileMetaData {
 
     return selection;
   }
+
+  std::vector<datasource *> const sources;  // Dataset sources, in the order of their row groups
+  std::vector<size_t> row_group_sources;     // Index of the source of each row group
 };
 
-void reader::impl::read_column_chunks(std::vector<rmm::device_buffer> &page_data,
-                                      hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                                      size_t begin_chunk,
-                                      size_t end_chunk,
-                                      const std::vector<size_t> &column_chunk_offsets,
-                                      cudaStream_t stream)
-{
-  // Transfer chunk data, coalescing adjacent chunks
-  for (size_t chunk = begin_chunk; chunk < end_chunk;) {
-    const size_t io_offset   = column_chunk_offsets[chunk];
-    size_t io_size           = chunks[chunk].compressed_size;
-    size_t next_chunk        = chunk + 1;
+void reader::impl::read_column_chunks(
+  std::vector<rmm::device_buffer> &page_data,
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  const std::vector<datasource *> &chunk_sources,
+  const std::vector<size_t> &column_chunk_offsets,
+  const std::vector<std::pair<size_t, size_t>> &dictionary_ranges,
+  cudaStream_t stream)
+{
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet_read_column_chunks", chunks.size());
+  // A single buffer filled from one or more file byte ranges, holding one or more chunks
+  struct read_request {
+    datasource *source;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    std::vector<std::pair<size_t, size_t>> chunks;  // Chunk index and position within the buffer
+    std::vector<bool> is_cached;  // Whether each range is in the chunk cache
+    std::string cache_key;
+    size_t size         = 0;
+    uint8_t *device_dst = nullptr;  // Destination of direct device reads, if any
+  };
+
+  // Coalesce chunks that are close together in the file, in file order. Compressed and
+  // uncompressed chunks aren't mixed, so that compressed buffers can be freed immediately after
+  // the decompression stage to limit peak memory requirements
+  std::vector<size_t> order(chunks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return std::make_pair(chunk_sources[a], column_chunk_offsets[a]) <
+           std::make_pair(chunk_sources[b], column_chunk_offsets[b]);
+  });
+  std::vector<read_request> requests;
+  std::vector<bool> is_ready(chunks.size(), false);
+  for (const auto chunk : order) {
+    const size_t offset      = column_chunk_offsets[chunk];
+    const size_t size        = chunks[chunk].compressed_size;
+    const auto &dictionary   = dictionary_ranges[chunk];
+    const bool is_separate   = (dictionary.second != 0);
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
-      const size_t next_offset = column_chunk_offsets[next_chunk];
-      const bool is_next_compressed =
-        (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
-        // Can't merge if not contiguous or mixing compressed and uncompressed
-        // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
-        // freed earlier (immediately after decompression stage) to limit peak memory requirements
-        break;
-      }
-      io_size += chunks[next_chunk].compressed_size;
-      next_chunk++;
-    }
-    if (io_size != 0) {
-      auto buffer         = _source->host_read(io_offset, io_size);
-      page_data[chunk]    = rmm::device_buffer(buffer->data(), buffer->size(), stream);
-      uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
+    if (size == 0) {
+      is_ready[chunk] = true;
+      continue;
+    }
+    if (!requests.empty() && !is_separate) {
+      auto &prev             = requests.back();
+      const auto &prev_chunk = chunks[prev.chunks.back().first];
+      const size_t prev_end  = prev.ranges.back().first + prev.ranges.back().second;
+      if (prev.source == chunk_sources[chunk] && prev.ranges.size() == 1 && offset >= prev_end &&
+          offset - prev_end <= _max_read_gap &&
+          (prev_chunk.codec != parquet::Compression::UNCOMPRESSED) == is_compressed) {
+        prev.chunks.emplace_back(chunk, offset - prev.ranges[0].first);
+        prev.ranges[0].second = offset + size - prev.ranges[0].first;
+        prev.size             = prev.ranges[0].second;
+        continue;
+      }
+    }
+    read_request request;
+    request.source = chunk_sources[chunk];
+    if (is_separate) {
+      // The dictionary page isn't adjacent to the selected data pages; read both separately
+      request.ranges.push_back(dictionary);
+      request.ranges.emplace_back(offset, size - dictionary.second);
+    } else {
+      request.ranges.emplace_back(offset, size);
+    }
+    request.chunks.emplace_back(chunk, 0);
+    request.size = size;
+    requests.push_back(std::move(request));
+  }
+
+  // Ranges found in the chunk cache are copied from there instead of read from the source
+  for (auto &request : requests) {
+    request.cache_key = request.source->cache_key();
+    for (const auto &range : request.ranges) {
+      request.is_cached.push_back(is_range_cached(request.cache_key, range.first, range.second));
+    }
+  }
+
+  // Sources that support it read straight into device memory, without a host buffer. Let the
+  // other sources know about all the reads up front, since only a few are in flight at a time
+  for (auto &request : requests) {
+    if (request.source->supports_device_read()) {
+      const auto first_chunk = request.chunks.front().first;
+      page_data[first_chunk] = rmm::device_buffer(request.size, stream);
+      request.device_dst     = static_cast<uint8_t *>(page_data[first_chunk].data());
     } else {
-      chunk = next_chunk;
+      for (size_t r = 0; r < request.ranges.size(); ++r) {
+        if (!request.is_cached[r]) {
+          request.source->prefetch(request.ranges[r].first, request.ranges[r].second);
+        }
+      }
     }
   }
+
+  // Issue the reads of each range asynchronously, keeping a bounded number of requests in flight
+  using range_reads = std::vector<std::future<std::unique_ptr<datasource::buffer>>>;
+  auto fetch        = [](const read_request &request) {
+    range_reads range_buffers;
+    size_t pos = 0;
+    for (size_t r = 0; r < request.ranges.size(); ++r) {
+      const auto &range = request.ranges[r];
+      if (request.is_cached[r]) {
+        range_buffers.emplace_back();
+      } else if (request.device_dst != nullptr) {
+        const auto dst = request.device_dst + pos;
+        range_buffers.emplace_back(std::async(std::launch::async, [&request, range, dst]() {
+          CUDF_EXPECTS(request.source->device_read(range.first, range.second, dst) == range.second,
+                       "Unexpected end of column chunk data");
+          return std::unique_ptr<datasource::buffer>{};
+        }));
+      } else {
+        range_buffers.emplace_back(request.source->host_read_async(range.first, range.second));
+      }
+      pos += range.second;
+    }
+    return range_buffers;
+  };
+  std::deque<range_reads> reads;
+  size_t next_request = 0;
+  auto issue_reads    = [&]() {
+    while (next_request < requests.size() && reads.size() < MAX_CONCURRENT_READS) {
+      reads.emplace_back(fetch(requests[next_request++]));
+    }
+  };
+
+  // Transfer each buffer as soon as it arrives, and start counting the page headers of the
+  // leading chunks whose data is on the device while the remaining reads are in progress
+  size_t first_pending     = 0;
+  auto count_ready_headers = [&]() {
+    size_t end = first_pending;
+    while (end < chunks.size() && is_ready[end]) { end++; }
+    if (end == first_pending) { return; }
+    CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(first_pending),
+                             &chunks[first_pending],
+                             (end - first_pending) * sizeof(gpu::ColumnChunkDesc),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(gpu::DecodePageHeaders(chunks.device_ptr(first_pending), end - first_pending, stream));
+    first_pending = end;
+  };
+  issue_reads();
+  count_ready_headers();
+  for (const auto &request : requests) {
+    auto range_buffers = std::move(reads.front());
+    reads.pop_front();
+    issue_reads();
+
+    const auto first_chunk = request.chunks.front().first;
+    if (request.device_dst == nullptr) {
+      page_data[first_chunk] = rmm::device_buffer(request.size, stream);
+    }
+    auto d_compdata = reinterpret_cast<uint8_t *>(page_data[first_chunk].data());
+    size_t pos      = 0;
+    for (size_t r = 0; r < request.ranges.size(); ++r) {
+      const auto offset = request.ranges[r].first;
+      const auto len    = request.ranges[r].second;
+      const auto dst    = d_compdata + pos;
+      pos += len;
+      if (request.is_cached[r] && read_cached_range(request.cache_key, offset, len, dst, stream)) {
+        continue;
+      }
+      if (request.is_cached[r]) {
+        // Evicted since the lookup; read the range now
+        if (request.device_dst != nullptr) {
+          CUDF_EXPECTS(request.source->device_read(offset, len, dst) == len,
+                       "Unexpected end of column chunk data");
+        } else {
+          const auto buffer = request.source->host_read(offset, len);
+          CUDF_EXPECTS(buffer->size() == len, "Unexpected end of column chunk data");
+          copy_host_to_device(dst, buffer->data(), len, stream);
+        }
+      } else {
+        const auto buffer = range_buffers[r].get();
+        if (buffer != nullptr) {
+          CUDF_EXPECTS(buffer->size() == len, "Unexpected end of column chunk data");
+          copy_host_to_device(dst, buffer->data(), len, stream);
+        }
+      }
+      cache_range(request.cache_key, offset, len, dst, stream);
+    }
+    for (const auto &chunk : request.chunks) {
+      chunks[chunk.first].compressed_data = d_compdata + chunk.second;
+      is_ready[chunk.first]               = true;
+    }
+    count_ready_headers();
+  }
 }
 
 size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -389,9 +1266,6 @@ size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc>
 {
   size_t total_pages = 0;
 
-  CUDA_TRY(cudaMemcpyAsync(
-    chunks.device_ptr(), chunks.host_ptr(), chunks.memory_size(), cudaMemcpyHostToDevice, stream));
-  CUDA_TRY(gpu::DecodePageHeaders(chunks.device_ptr(), chunks.size(), stream));
   CUDA_TRY(cudaMemcpyAsync(
     chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
@@ -424,13 +1298,39 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &
 rmm::device_buffer reader::impl::decompress_page_data(
   hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
   hostdevice_vector<gpu::PageInfo> &pages,
+  size_t min_row,
+  size_t total_rows,
   cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet_decompress", pages.size());
+  // Exclude compressed data pages that lie entirely outside of the selected rows, so that reading
+  // a small range of a large row group only needs to decompress the pages it consumes. Nested
+  // columns are decoded in full, as their pages don't map to rows
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    if (chunks[c].codec != parquet::Compression::UNCOMPRESSED && chunks[c].max_rep_level == 0) {
+      for (int k = 0; k < chunks[c].max_num_pages; k++) {
+        auto &page = pages[page_count + k];
+        if (!(page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY)) {
+          const size_t page_start_row = chunks[c].start_row + page.chunk_row;
+          if (page_start_row >= min_row + total_rows || page_start_row + page.num_rows <= min_row) {
+            page.num_rows = 0;
+          }
+        }
+      }
+    }
+    page_count += chunks[c].max_num_pages;
+  }
+
   auto for_each_codec_page = [&](parquet::Compression codec, const std::function<void(size_t)> &f) {
     for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
       const auto page_stride = chunks[c].max_num_pages;
       if (chunks[c].codec == codec) {
-        for (int k = 0; k < page_stride; k++) { f(page_count + k); }
+        for (int k = 0; k < page_stride; k++) {
+          const auto &page = pages[page_count + k];
+          if ((page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) || page.num_rows > 0) {
+            f(page_count + k);
+          }
+        }
       }
       page_count += page_stride;
     }
@@ -442,9 +1342,10 @@ rmm::device_buffer reader::impl::decompress_page_data(
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
+  std::array<std::pair<parquet::Compression, size_t>, 4> codecs{std::make_pair(parquet::GZIP, 0),
                                                                 std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+                                                                std::make_pair(parquet::BROTLI, 0),
+                                                                std::make_pair(parquet::ZSTD, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -516,6 +1417,12 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          CUDA_TRY(gpu_unzstd(inflate_in.device_ptr(start_pos),
+                              inflate_out.device_ptr(start_pos),
+                              argc - start_pos,
+                              stream));
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -535,25 +1442,34 @@ rmm::device_buffer reader::impl::decompress_page_data(
   return decomp_pages;
 }
 
-void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                                    hostdevice_vector<gpu::PageInfo> &pages,
-                                    size_t min_row,
-                                    size_t total_rows,
-                                    const std::vector<int> &chunk_map,
-                                    std::vector<column_buffer> &out_buffers,
-                                    cudaStream_t stream)
+void reader::impl::decode_page_data(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  size_t min_row,
+  size_t total_rows,
+  const std::vector<int> &chunk_map,
+  std::vector<column_buffer> &out_buffers,
+  const std::vector<bool> &dict_columns,
+  std::vector<rmm::device_vector<column_buffer::str_pair>> &dict_keys,
+  cudaStream_t stream)
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("parquet_decode", total_rows);
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc &chunk) {
     return (chunk.data_type & 0x7) == BYTE_ARRAY && chunk.num_dict_pages > 0;
   };
 
-  // Count the number of string dictionary entries
+  // Count the number of string dictionary entries, keeping those of each column contiguous
   // NOTE: Assumes first page in the chunk is always the dictionary page
-  size_t total_str_dict_indexes = 0;
+  std::vector<size_t> column_dict_offsets(out_buffers.size() + 1, 0);
   for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
-    if (is_dict_chunk(chunks[c])) { total_str_dict_indexes += pages[page_count].num_values; }
+    if (is_dict_chunk(chunks[c])) {
+      column_dict_offsets[chunk_map[c] + 1] += pages[page_count].num_values;
+    }
     page_count += chunks[c].max_num_pages;
   }
+  std::partial_sum(
+    column_dict_offsets.begin(), column_dict_offsets.end(), column_dict_offsets.begin());
+  const size_t total_str_dict_indexes = column_dict_offsets.back();
 
   // Build index for string dictionaries since they can't be indexed
   // directly due to variable-sized elements
@@ -561,10 +1477,17 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   if (total_str_dict_indexes > 0) { str_dict_index.resize(total_str_dict_indexes); }
 
   // Update chunks with pointers to column data
-  for (size_t c = 0, page_count = 0, str_ofs = 0; c < chunks.size(); c++) {
+  auto str_ofs = column_dict_offsets;
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    const auto col = chunk_map[c];
     if (is_dict_chunk(chunks[c])) {
-      chunks[c].str_dict_index = str_dict_index.data().get() + str_ofs;
-      str_ofs += pages[page_count].num_values;
+      chunks[c].str_dict_index  = str_dict_index.data().get() + str_ofs[col];
+      chunks[c].dict_index_base = -1;
+      if (dict_columns[col]) {
+        // Output indices into the concatenated dictionaries of the column's chunks
+        chunks[c].dict_index_base = static_cast<int32_t>(str_ofs[col] - column_dict_offsets[col]);
+      }
+      str_ofs[col] += pages[page_count].num_values;
     }
     chunks[c].column_data_base = out_buffers[chunk_map[c]].data();
     chunks[c].valid_map_base   = out_buffers[chunk_map[c]].null_mask();
@@ -583,6 +1506,27 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
                                total_rows,
                                min_row,
                                stream));
+  if (std::any_of(chunks.host_ptr(), chunks.host_ptr() + chunks.size(), [](const auto &chunk) {
+        return chunk.rep_levels_base != nullptr;
+      })) {
+    CUDA_TRY(gpu::DecodePageLevels(
+      pages.device_ptr(), pages.size(), chunks.device_ptr(), chunks.size(), stream));
+  }
+
+  // Return the dictionary entries of the columns decoded to indices
+  for (size_t i = 0; i < out_buffers.size(); ++i) {
+    if (dict_columns[i]) {
+      dict_keys[i].resize(column_dict_offsets[i + 1] - column_dict_offsets[i]);
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        str_dict_index.begin() + column_dict_offsets[i],
+                        str_dict_index.begin() + column_dict_offsets[i + 1],
+                        dict_keys[i].begin(),
+                        [] __device__(const gpu::nvstrdesc_s &entry) {
+                          return column_buffer::str_pair{entry.ptr,
+                                                         static_cast<size_type>(entry.count)};
+                        });
+    }
+  }
   CUDA_TRY(cudaMemcpyAsync(
     pages.host_ptr(), pages.device_ptr(), pages.memory_size(), cudaMemcpyDeviceToHost, stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
@@ -597,13 +1541,40 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   }
 }
 
-reader::impl::impl(std::unique_ptr<datasource> source,
+std::vector<data_type> reader::impl::get_column_types()
+{
+  std::vector<data_type> column_types;
+  if (_metadata->row_groups.size() != 0) {
+    for (const auto &col : _selected_columns) {
+      const auto schema_idx = _metadata->row_groups[0].columns[col.first].schema_idx;
+      auto &col_schema      = _metadata->schema[schema_idx];
+      const bool is_nested  = (col_schema.max_repetition_level != 0);
+      CUDF_EXPECTS(!is_nested || _metadata->get_list_node(schema_idx) >= 0,
+                   "Unsupported nested column");
+      // The elements of nested string columns are not dictionary-encoded
+      auto col_type = to_type_id(col_schema.type,
+                                 col_schema.converted_type,
+                                 _strings_to_categorical,
+                                 _strings_to_dictionary && !is_nested,
+                                 _timestamp_type.id(),
+                                 _decimals_as_float,
+                                 col_schema.decimal_scale);
+      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
+      column_types.push_back(to_data_type(col_type, col_schema.decimal_scale));
+    }
+  }
+  return column_types;
+}
+
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> sources,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : _source(std::move(source)), _mr(mr)
+  : _sources(std::move(sources)), _mr(mr)
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  // Open and parse the metadata of every source dataset
+  std::vector<datasource *> source_ptrs;
+  for (auto const &source : _sources) { source_ptrs.push_back(source.get()); }
+  _metadata = std::make_unique<metadata>(source_ptrs);
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, options.use_pandas_metadata);
@@ -611,8 +1582,24 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Override output timestamp resolution if requested
   if (options.timestamp_type.id() != EMPTY) { _timestamp_type = options.timestamp_type; }
 
-  // Strings may be returned as either string or categorical columns
+  // Strings may be returned as either string, categorical or dictionary columns
+  CUDF_EXPECTS(!options.strings_to_categorical || !options.strings_to_dictionary,
+               "Strings cannot be returned as both categorical and dictionary columns");
   _strings_to_categorical = options.strings_to_categorical;
+  _strings_to_dictionary  = options.strings_to_dictionary;
+  _decimals_as_float      = options.decimals_as_float;
+
+  // Row groups are skipped using statistics of the filtered columns
+  const auto names = _metadata->get_column_names();
+  for (const auto &filter : options.filters) {
+    CUDF_EXPECTS(std::find(names.begin(), names.end(), filter.column_name) != names.end(),
+                 "Filter column not found");
+    CUDF_EXPECTS(
+      !filter.values.empty() && (filter.op == filter_op::IN || filter.values.size() == 1),
+      "Invalid number of filter values");
+  }
+  _filters      = options.filters;
+  _max_read_gap = options.max_read_gap;
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -627,24 +1614,19 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
   // Select only row groups required
   const auto selected_row_groups = _metadata->select_row_groups(
-    row_group, max_rowgroup_count, row_group_indices, skip_rows, num_rows);
+    row_group, max_rowgroup_count, row_group_indices, _filters, skip_rows, num_rows);
 
   // Get a list of column data types
-  std::vector<data_type> column_types;
-  if (_metadata->row_groups.size() != 0) {
-    for (const auto &col : _selected_columns) {
-      auto &col_schema = _metadata->schema[_metadata->row_groups[0].columns[col.first].schema_idx];
-      auto col_type    = to_type_id(col_schema.type,
-                                 col_schema.converted_type,
-                                 _strings_to_categorical,
-                                 _timestamp_type.id(),
-                                 col_schema.decimal_scale);
-      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
-    }
-  }
+  const auto column_types = get_column_types();
   out_columns.reserve(column_types.size());
 
+  // Schema index of the leaf node of each column
+  std::vector<int> leaf_schema_idx;
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    const auto &chunk = _metadata->row_groups[0].columns[_selected_columns[i].first];
+    leaf_schema_idx.push_back(chunk.schema_idx);
+  }
+
   if (selected_row_groups.size() != 0 && column_types.size() != 0) {
     // Descriptors for all the chunks that make up the selected columns
     const auto num_columns = _selected_columns.size();
@@ -660,6 +1642,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Keep track of column chunk file offsets
     std::vector<size_t> column_chunk_offsets(num_chunks);
 
+    // Dictionary pages read separately from the selected data pages of a chunk
+    std::vector<std::pair<size_t, size_t>> dictionary_ranges(num_chunks);
+
+    // Source file of each column chunk
+    std::vector<datasource *> chunk_sources(num_chunks);
+
+    // Nested columns are decoded one value per level value, over whole row groups
+    std::vector<size_t> nested_num_values(num_columns, 0);
+
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
     auto remaining_rows            = num_rows;
@@ -667,7 +1658,6 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       const auto &row_group = _metadata->row_groups[rg.first];
       auto row_group_start  = rg.second;
       auto row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto io_chunk_idx     = chunks.size();
 
       for (size_t i = 0; i < num_columns; ++i) {
         auto col         = _selected_columns[i];
@@ -676,7 +1666,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
         // Spec requires each row group to contain exactly one chunk for every
         // column. If there are too many or too few, continue with best effort
-        if (col.second != _metadata->get_column_name(col_meta.path_in_schema)) {
+        if (col.second != _metadata->get_column_name(row_group.columns[col.first])) {
           std::cerr << "Detected mismatched column chunk" << std::endl;
           continue;
         }
@@ -695,18 +1685,67 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                           col_schema.converted_type,
                           col_schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        size_t chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
+        size_t chunk_size       = col_meta.total_compressed_size;
+        size_t chunk_num_values = col_meta.num_values;
+        size_t chunk_start_row  = row_group_start;
+        uint32_t chunk_num_rows = row_group_rows;
+
+        // With an offset index, read only the data pages that overlap the selected rows. Page row
+        // counts are only known for flat columns, where values map one-to-one to rows
+        const int64_t min_row = std::max<int64_t>(skip_rows - row_group_start, 0);
+        const int64_t max_row = std::min<int64_t>(
+          static_cast<int64_t>(skip_rows) + num_rows - row_group_start, row_group.num_rows);
+        const auto &col_chunk = row_group.columns[col.first];
+        OffsetIndex offset_index;
+        if (col_schema.max_repetition_level == 0 && col_chunk.offset_index_length > 0 &&
+            (min_row > 0 || max_row < row_group.num_rows) &&
+            _metadata->read_page_index(rg.first,
+                                       col_chunk.offset_index_offset,
+                                       col_chunk.offset_index_length,
+                                       offset_index) &&
+            is_valid_offset_index(offset_index, chunk_offset, chunk_size, row_group.num_rows)) {
+          const auto &locations = offset_index.page_locations;
+          const auto page_range = select_data_pages(locations, min_row, max_row);
+          if (page_range.first != 0 || page_range.second != locations.size()) {
+            const auto &first_page = locations[page_range.first];
+            const auto &last_page  = locations[page_range.second - 1];
+            const size_t data_end  = last_page.offset + last_page.compressed_page_size;
+            const size_t dict_size = locations[0].offset - chunk_offset;
+            const int64_t end_row  = (page_range.second < locations.size())
+                                      ? locations[page_range.second].first_row_index
+                                      : row_group.num_rows;
+            size_t dict_read_size = 0;
+            if (page_range.first != 0) {
+              // Any dictionary page precedes the first data page, away from the selected pages
+              if (dict_size != 0) { dictionary_ranges[chunks.size()] = {chunk_offset, dict_size}; }
+              dict_read_size = dict_size;
+              chunk_offset   = first_page.offset;
+            }
+            chunk_size       = dict_read_size + (data_end - chunk_offset);
+            chunk_num_values = end_row - first_page.first_row_index;
+            chunk_start_row  = row_group_start + first_page.first_row_index;
+            chunk_num_rows   = chunk_num_values;
+          }
+        }
+        if (col_schema.max_repetition_level > 0) {
+          chunk_start_row = nested_num_values[i];
+          chunk_num_rows  = chunk_num_values;
+          nested_num_values[i] += chunk_num_values;
+        }
+        column_chunk_offsets[chunks.size()] = chunk_offset;
+        chunk_sources[chunks.size()]        = _metadata->get_source(rg.first);
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           chunk_num_values,
                                            col_schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           chunk_start_row,
+                                           chunk_num_rows,
                                            col_schema.max_definition_level,
                                            col_schema.max_repetition_level,
                                            required_bits(col_schema.max_definition_level),
@@ -723,14 +1762,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
       }
-      // Read compressed chunk data to device memory
-      read_column_chunks(
-        page_data, chunks, io_chunk_idx, chunks.size(), column_chunk_offsets, stream);
-
       remaining_rows -= row_group.num_rows;
     }
     assert(remaining_rows <= 0);
 
+    // Read compressed chunk data to device memory
+    read_column_chunks(
+      page_data, chunks, chunk_sources, column_chunk_offsets, dictionary_ranges, stream);
+
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks, stream);
     if (total_pages > 0) {
@@ -739,7 +1778,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
       decode_page_headers(chunks, pages, stream);
       if (total_decompressed_size > 0) {
-        decomp_page_data = decompress_page_data(chunks, pages, stream);
+        decomp_page_data = decompress_page_data(chunks, pages, skip_rows, num_rows, stream);
         // Free compressed data
         for (size_t c = 0; c < chunks.size(); c++) {
           if (chunks[c].codec != parquet::Compression::UNCOMPRESSED && page_data[c].size() != 0) {
@@ -749,29 +1788,101 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         }
       }
 
+      // Dictionary columns are decoded to indices into their chunks' string dictionaries if all
+      // their data pages are dictionary-encoded, otherwise to strings that are encoded afterwards
+      std::vector<bool> dict_columns(column_types.size());
+      for (size_t i = 0; i < column_types.size(); ++i) {
+        dict_columns[i] = (column_types[i].id() == type_id::DICTIONARY32);
+      }
+      for (size_t c = 0; c < chunks.size(); c++) {
+        if (chunks[c].num_dict_pages == 0) { dict_columns[chunk_map[c]] = false; }
+      }
+      for (size_t i = 0; i < pages.size(); i++) {
+        const size_t c = pages[i].chunk_idx;
+        if (c < chunks.size() && !(pages[i].flags & gpu::PAGEINFO_FLAGS_DICTIONARY) &&
+            pages[i].encoding != Encoding::PLAIN_DICTIONARY &&
+            pages[i].encoding != Encoding::RLE_DICTIONARY) {
+          dict_columns[chunk_map[c]] = false;
+        }
+      }
+
       std::vector<column_buffer> out_buffers;
       out_buffers.reserve(column_types.size());
+      std::vector<rmm::device_vector<uint8_t>> rep_levels(column_types.size());
+      std::vector<rmm::device_vector<uint8_t>> def_levels(column_types.size());
       for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col = _selected_columns[i];
-        auto &col_schema =
-          _metadata->schema
-            [_metadata->row_groups[selected_row_groups[0].first].columns[col.first].schema_idx];
+        auto &col_schema = _metadata->schema[leaf_schema_idx[i]];
         bool is_nullable = (col_schema.max_definition_level != 0);
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        auto buffer_type = column_types[i];
+        if (buffer_type.id() == type_id::DICTIONARY32) {
+          buffer_type = data_type{dict_columns[i] ? type_id::INT32 : type_id::STRING};
+        }
+        if (col_schema.max_repetition_level > 0) {
+          rep_levels[i].resize(nested_num_values[i]);
+          def_levels[i].resize(nested_num_values[i]);
+          out_buffers.emplace_back(buffer_type, nested_num_values[i], is_nullable, stream, _mr);
+        } else {
+          out_buffers.emplace_back(buffer_type, num_rows, is_nullable, stream, _mr);
+        }
+      }
+      for (size_t c = 0; c < chunks.size(); c++) {
+        if (chunks[c].max_rep_level > 0) {
+          chunks[c].rep_levels_base = rep_levels[chunk_map[c]].data().get();
+          chunks[c].def_levels_base = def_levels[chunk_map[c]].data().get();
+        }
       }
 
-      decode_page_data(chunks, pages, skip_rows, num_rows, chunk_map, out_buffers, stream);
-
+      std::vector<rmm::device_vector<column_buffer::str_pair>> dict_keys(column_types.size());
+      decode_page_data(chunks,
+                       pages,
+                       skip_rows,
+                       num_rows,
+                       chunk_map,
+                       out_buffers,
+                       dict_columns,
+                       dict_keys,
+                       stream);
+
+      const auto first_row = static_cast<size_type>(skip_rows - selected_row_groups[0].second);
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        if (_metadata->schema[leaf_schema_idx[i]].max_repetition_level > 0) {
+          const auto &repeated =
+            _metadata->schema[_metadata->get_repeated_node(leaf_schema_idx[i])];
+          out_columns.emplace_back(
+            make_list_output(column_types[i],
+                             first_row,
+                             num_rows,
+                             out_buffers[i],
+                             rep_levels[i],
+                             def_levels[i],
+                             repeated.max_definition_level,
+                             _metadata->schema[repeated.parent_idx].max_definition_level,
+                             stream,
+                             _mr));
+        } else if (column_types[i].id() == type_id::DICTIONARY32) {
+          out_columns.emplace_back(make_dictionary_output(num_rows,
+                                                          out_buffers[i],
+                                                          dict_columns[i] ? &dict_keys[i] : nullptr,
+                                                          stream,
+                                                          _mr));
+        } else {
+          out_columns.emplace_back(
+            make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        }
       }
     }
   }
 
   // Create empty columns as needed
   for (size_t i = out_columns.size(); i < column_types.size(); ++i) {
-    out_columns.emplace_back(make_empty_column(column_types[i]));
+    if (_metadata->schema[leaf_schema_idx[i]].max_repetition_level > 0) {
+      out_columns.emplace_back(make_empty_list_output(column_types[i]));
+    } else if (column_types[i].id() == type_id::DICTIONARY32) {
+      column_buffer empty_strings(data_type{type_id::STRING}, 0, false, stream, _mr);
+      out_columns.emplace_back(make_dictionary_output(0, empty_strings, nullptr, stream, _mr));
+    } else {
+      out_columns.emplace_back(make_empty_column(column_types[i]));
+    }
   }
 
   // Return column names (must match order of returned columns)
@@ -787,11 +1898,137 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+std::vector<std::pair<size_type, size_type>> reader::impl::filter_row_groups(
+  const std::vector<size_type> &row_group_list)
+{
+  std::vector<size_type> candidates(row_group_list);
+  if (candidates.empty()) {
+    candidates.resize(_metadata->get_num_row_groups());
+    std::iota(candidates.begin(), candidates.end(), 0);
+  }
+
+  std::vector<std::pair<size_type, size_type>> selection;
+  for (const auto rowgroup_idx : candidates) {
+    CUDF_EXPECTS(rowgroup_idx >= 0 && rowgroup_idx < _metadata->get_num_row_groups(),
+                 "Invalid rowgroup index");
+    if (_filters.empty() || _metadata->row_group_may_match(rowgroup_idx, _filters)) {
+      selection.emplace_back(
+        rowgroup_idx, static_cast<size_type>(_metadata->row_groups[rowgroup_idx].num_rows));
+    }
+  }
+  return selection;
+}
+
+size_t reader::impl::estimate_read_size(const RowGroup &row_group,
+                                        const std::vector<data_type> &column_types)
+{
+  size_t size = 0;
+  for (size_t i = 0; i < _selected_columns.size(); ++i) {
+    const auto &chunk    = row_group.columns[_selected_columns[i].first];
+    const auto &col_meta = chunk.meta_data;
+    const size_t rows    = row_group.num_rows;
+    size += col_meta.total_compressed_size;
+    if (col_meta.codec != Compression::UNCOMPRESSED) { size += col_meta.total_uncompressed_size; }
+    if (column_types[i].id() == type_id::STRING ||
+        column_types[i].id() == type_id::DICTIONARY32) {
+      // String descriptors, then the output characters and offsets
+      size += rows * sizeof(gpu::nvstrdesc_s) + col_meta.total_uncompressed_size +
+              (rows + 1) * sizeof(size_type);
+    } else {
+      size += rows * size_of(column_types[i]);
+    }
+    if (_metadata->schema[chunk.schema_idx].max_definition_level != 0) {
+      size += bitmask_allocation_size_bytes(rows);
+    }
+  }
+  return size;
+}
+
+std::vector<std::pair<size_type, size_type>> reader::impl::compute_row_splits(
+  size_t chunk_read_limit, size_type skip_rows, size_type num_rows)
+{
+  std::vector<std::pair<size_type, size_type>> splits;
+  if (chunk_read_limit == 0) { chunk_read_limit = std::numeric_limits<size_t>::max(); }
+
+  const auto selected_row_groups =
+    _metadata->select_row_groups(-1, -1, nullptr, _filters, skip_rows, num_rows);
+  const auto column_types = get_column_types();
+  if (selected_row_groups.empty() || column_types.empty()) { return splits; }
+
+  const size_t end_row = static_cast<size_t>(skip_rows) + static_cast<size_t>(num_rows);
+  size_t split_start   = skip_rows;
+  size_t split_end     = skip_rows;
+  size_t split_size    = 0;
+  for (const auto &rg : selected_row_groups) {
+    const auto &row_group = _metadata->row_groups[rg.first];
+    const size_t rg_start = std::max<size_t>(rg.second, skip_rows);
+    const size_t rg_end   = std::min<size_t>(rg.second + row_group.num_rows, end_row);
+    if (rg_end <= rg_start) { continue; }
+    split_end = rg_end;
+
+    const auto rg_size = estimate_read_size(row_group, column_types);
+    if (split_size != 0 && split_size + rg_size > chunk_read_limit) {
+      splits.emplace_back(split_start, rg_start - split_start);
+      split_start = rg_start;
+      split_size  = 0;
+    }
+    if (rg_size > chunk_read_limit) {
+      // Divide the row group into row ranges; each range only decodes the pages it overlaps
+      const size_t num_pieces = (rg_size + chunk_read_limit - 1) / chunk_read_limit;
+      const size_t piece_rows =
+        std::max<size_t>((rg_end - rg_start + num_pieces - 1) / num_pieces, 1);
+      for (size_t row = rg_start; row < rg_end; row += piece_rows) {
+        splits.emplace_back(row, std::min(piece_rows, rg_end - row));
+      }
+      split_start = rg_end;
+    } else {
+      split_size += rg_size;
+    }
+  }
+  if (split_size != 0) { splits.emplace_back(split_start, split_end - split_start); }
+
+  return splits;
+}
+
+size_t reader::impl::estimate_read_memory(size_type skip_rows,
+                                          size_type num_rows,
+                                          size_type row_group,
+                                          size_type max_rowgroup_count,
+                                          const size_type *row_group_indices)
+{
+  const auto selected_row_groups = _metadata->select_row_groups(
+    row_group, max_rowgroup_count, row_group_indices, _filters, skip_rows, num_rows);
+  const auto column_types = get_column_types();
+
+  // All the selected row groups are read to device memory at once
+  size_t size = 0;
+  for (const auto &rg : selected_row_groups) {
+    size += estimate_read_size(_metadata->row_groups[rg.first], column_types);
+  }
+  return size;
+}
+
+namespace {
+std::vector<std::unique_ptr<datasource>> make_datasources(std::vector<std::string> const &filepaths)
+{
+  std::vector<std::unique_ptr<datasource>> sources;
+  for (auto const &filepath : filepaths) { sources.emplace_back(datasource::create(filepath)); }
+  return sources;
+}
+
+std::vector<std::unique_ptr<datasource>> make_datasources(std::unique_ptr<datasource> source)
+{
+  std::vector<std::unique_ptr<datasource>> sources;
+  sources.emplace_back(std::move(source));
+  return sources;
+}
+}  // namespace
+
 // Forward to implementation
 reader::reader(std::string filepath,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr))
+  : _impl(std::make_unique<impl>(make_datasources(datasource::create(filepath)), options, mr))
 {
 }
 
@@ -799,7 +2036,23 @@ reader::reader(std::string filepath,
 reader::reader(std::unique_ptr<cudf::io::datasource> source,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(std::move(source), options, mr))
+  : _impl(std::make_unique<impl>(make_datasources(std::move(source)), options, mr))
+{
+}
+
+// Forward to implementation
+reader::reader(std::vector<std::string> const &filepaths,
+               reader_options const &options,
+               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(make_datasources(filepaths), options, mr))
+{
+}
+
+// Forward to implementation
+reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> sources,
+               reader_options const &options,
+               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(std::move(sources), options, mr))
 {
 }
 
@@ -828,12 +2081,93 @@ table_with_metadata reader::read_row_groups(const std::vector<size_type> &row_gr
     0, -1, -1, static_cast<size_type>(row_group_list.size()), row_group_list.data(), stream);
 }
 
+// Forward to implementation
+std::vector<std::pair<size_type, size_type>> reader::filter_row_groups(
+  const std::vector<size_type> &row_group_list)
+{
+  return _impl->filter_row_groups(row_group_list);
+}
+
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream)
 {
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr, stream);
 }
 
+// Forward to implementation
+std::vector<std::pair<size_type, size_type>> reader::compute_row_splits(size_t chunk_read_limit,
+                                                                        size_type skip_rows,
+                                                                        size_type num_rows)
+{
+  return _impl->compute_row_splits(
+    chunk_read_limit, std::max(skip_rows, 0), (num_rows != 0) ? num_rows : -1);
+}
+
+// Forward to implementation
+size_t reader::estimate_read_memory(const std::vector<size_type> &row_group_list,
+                                    size_type row_group,
+                                    size_type row_group_count,
+                                    size_type skip_rows,
+                                    size_type num_rows)
+{
+  if (!row_group_list.empty()) {
+    return _impl->estimate_read_memory(
+      0, -1, -1, static_cast<size_type>(row_group_list.size()), row_group_list.data());
+  } else if (row_group != -1) {
+    return _impl->estimate_read_memory(0, -1, row_group, row_group_count, nullptr);
+  }
+  return _impl->estimate_read_memory(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr);
+}
+
+source_metadata read_metadata(datasource *source)
+{
+  metadata md({source});
+  source_metadata result;
+  result.num_rows = md.get_total_rows();
+  if (md.get_num_row_groups() != 0) {
+    for (const auto &chunk : md.row_groups[0].columns) {
+      const auto &col_schema = md.schema[chunk.schema_idx];
+      result.column_names.emplace_back(md.get_column_name(chunk));
+      result.column_types.push_back(
+        (col_schema.max_repetition_level != 0)
+          ? data_type{type_id::LIST}
+          : to_data_type(to_type_id(col_schema.type,
+                                    col_schema.converted_type,
+                                    false,
+                                    false,
+                                    type_id::EMPTY,
+                                    true,
+                                    col_schema.decimal_scale),
+                         col_schema.decimal_scale));
+    }
+  }
+
+  for (const auto &row_group : md.row_groups) {
+    row_group_metadata row_group_md;
+    row_group_md.num_rows  = row_group.num_rows;
+    row_group_md.byte_size = row_group.total_byte_size;
+    for (const auto &chunk : row_group.columns) {
+      column_chunk_metadata chunk_md;
+      chunk_md.compressed_size = chunk.meta_data.total_compressed_size;
+      if (!chunk.meta_data.statistics_blob.empty()) {
+        // The blob excludes the struct terminator; restore it so the last field can be parsed
+        std::vector<uint8_t> blob(chunk.meta_data.statistics_blob);
+        blob.push_back(0);
+        Statistics stats;
+        CompactProtocolReader cp(blob.data(), blob.size());
+        if (cp.read(&stats)) {
+          chunk_md.null_count = stats.null_count;
+          chunk_md.has_minmax = decode_statistics(
+            md.schema[chunk.schema_idx], stats, chunk_md.min_value, chunk_md.max_value);
+        }
+      }
+      row_group_md.columns.emplace_back(std::move(chunk_md));
+    }
+    result.row_groups.emplace_back(std::move(row_group_md));
+  }
+  return result;
+}
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
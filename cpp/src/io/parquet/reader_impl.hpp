@@ -49,15 +49,18 @@ class metadata;
  * @brief Implementation for Parquet reader
  */
 class reader::impl {
+  // Max number of column chunk reads in flight
+  static constexpr size_t MAX_CONCURRENT_READS = 8;
+
  public:
   /**
-   * @brief Constructor from a dataset source with reader options.
+   * @brief Constructor from dataset sources with reader options.
    *
-   * @param source Dataset source
+   * @param sources Dataset sources, one per file; all the files must share the same schema
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
-  explicit impl(std::unique_ptr<datasource> source,
+  explicit impl(std::vector<std::unique_ptr<datasource>> sources,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -80,28 +83,97 @@ class reader::impl {
                            const size_type *row_group_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Returns the row groups that may contain rows satisfying the filters
+   *
+   * @param row_group_list Indices of the row groups to check; empty for all row groups
+   *
+   * @return List of (row group index, number of rows) pairs
+   */
+  std::vector<std::pair<size_type, size_type>> filter_row_groups(
+    const std::vector<size_type> &row_group_list);
+
+  /**
+   * @brief Splits a range of rows into consecutive row ranges, each of which can be read within
+   * the given device memory budget
+   *
+   * The estimate for each row group includes the compressed column chunk data, the decompressed
+   * page data and the decoded output columns. Row groups whose estimate exceeds the budget are
+   * divided into equally-sized row ranges; only the pages overlapping a range are decompressed
+   * and decoded when that range is read.
+   *
+   * @param chunk_read_limit Device memory budget in bytes for reading each row range
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; `-1` for all remaining rows
+   *
+   * @return List of row ranges as pairs of (skip_rows, num_rows)
+   */
+  std::vector<std::pair<size_type, size_type>> compute_row_splits(size_t chunk_read_limit,
+                                                                  size_type skip_rows,
+                                                                  size_type num_rows);
+
+  /**
+   * @brief Estimates the peak device memory used by `read()` from the file metadata only
+   *
+   * The row groups are selected like `read()` does; the estimate of each of them is the one used
+   * by `compute_row_splits()`.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group Row group index to select
+   * @param max_rowgroup_count Max number of consecutive row groups if greater than 0
+   * @param row_group_indices if non-null, indices of rowgroups to read [max_rowgroup_count]
+   *
+   * @return Estimated number of bytes
+   */
+  size_t estimate_read_memory(size_type skip_rows,
+                              size_type num_rows,
+                              size_type row_group,
+                              size_type max_rowgroup_count,
+                              const size_type *row_group_indices);
+
  private:
+  /**
+   * @brief Estimates the peak device memory needed to read one row group
+   *
+   * The estimate includes the compressed column chunk data, the decompressed page data and the
+   * decoded output columns.
+   *
+   * @param row_group Metadata of the row group
+   * @param column_types Output data types of the selected columns
+   *
+   * @return Estimated number of bytes
+   */
+  size_t estimate_read_size(const RowGroup &row_group, const std::vector<data_type> &column_types);
+
   /**
    * @brief Reads compressed page data to device memory
    *
+   * Column chunks that are close together in the file are fetched with a single read, and reads
+   * are issued concurrently. The page headers of the chunks are counted on the device as soon as
+   * their data has been transferred; see `count_page_headers()`.
+   *
    * @param page_data Buffers to hold compressed page data for each chunk
    * @param chunks List of column chunk descriptors
-   * @param begin_chunk Index of first column chunk to read
-   * @param end_chunk Index after the last column chunk to read
+   * @param chunk_sources Source file of each chunk
    * @param column_chunk_offsets File offset for all chunks
+   * @param dictionary_ranges File offset and size of the dictionary page of the chunks that only
+   * read a subset of their data pages, size 0 for other chunks
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
   void read_column_chunks(std::vector<rmm::device_buffer> &page_data,
                           hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                          size_t begin_chunk,
-                          size_t end_chunk,
+                          const std::vector<datasource *> &chunk_sources,
                           const std::vector<size_t> &column_chunk_offsets,
+                          const std::vector<std::pair<size_t, size_t>> &dictionary_ranges,
                           cudaStream_t stream);
 
   /**
    * @brief Returns the number of total pages from the given column chunks
    *
+   * Expects the page headers to have been counted on the device by `read_column_chunks()`.
+   *
    * @param chunks List of column chunk descriptors
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
@@ -123,14 +195,21 @@ class reader::impl {
   /**
    * @brief Decompresses the page data, at page granularity.
    *
+   * Data pages that do not overlap the selected rows are not decompressed; their row count is
+   * reset to zero so that the decode stage skips them.
+   *
    * @param chunks List of column chunk descriptors
    * @param pages List of page information
+   * @param min_row Minimum number of rows from start
+   * @param total_rows Number of rows to output
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Device buffer to decompressed page data
    */
   rmm::device_buffer decompress_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
                                           hostdevice_vector<gpu::PageInfo> &pages,
+                                          size_t min_row,
+                                          size_t total_rows,
                                           cudaStream_t stream);
 
   /**
@@ -142,6 +221,8 @@ class reader::impl {
    * @param total_rows Number of rows to output
    * @param chunk_map Mapping between chunk and column
    * @param out_buffers Output columns' device buffers
+   * @param dict_columns Whether each column is decoded to indices into its string dictionaries
+   * @param dict_keys Concatenated string dictionaries of the columns decoded to indices
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -150,15 +231,26 @@ class reader::impl {
                         size_t total_rows,
                         const std::vector<int> &chunk_map,
                         std::vector<column_buffer> &out_buffers,
+                        const std::vector<bool> &dict_columns,
+                        std::vector<rmm::device_vector<column_buffer::str_pair>> &dict_keys,
                         cudaStream_t stream);
 
+  /**
+   * @brief Returns the output data types of the selected columns
+   */
+  std::vector<data_type> get_column_types();
+
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
-  std::unique_ptr<datasource> _source;
+  std::vector<std::unique_ptr<datasource>> _sources;
   std::unique_ptr<metadata> _metadata;
 
   std::vector<std::pair<int, std::string>> _selected_columns;
+  std::vector<column_filter> _filters;
+  size_t _max_read_gap         = 0;
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
+  bool _decimals_as_float      = true;
   data_type _timestamp_type{type_id::EMPTY};
 };
 
@@ -25,7 +25,10 @@
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <future>
+#include <type_traits>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -45,6 +48,70 @@ namespace {
 template <typename T>
 using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
 
+/**
+ * @brief Helper for an owned CUDA stream
+ **/
+using owned_stream =
+  std::unique_ptr<std::remove_pointer_t<cudaStream_t>, decltype(&cudaStreamDestroy)>;
+
+/**
+ * @brief Returns the dictionary encoding policy of a column
+ **/
+dictionary_policy get_dictionary_policy(const std::vector<dictionary_policy> &policies,
+                                        size_t column)
+{
+  return (column < policies.size()) ? policies[column] : dictionary_policy::ADAPTIVE;
+}
+
+/**
+ * @brief Returns the number of bits per dictionary index, as written by the page encoder
+ **/
+uint32_t get_dictionary_index_bits(uint32_t num_dict_entries)
+{
+  if (num_dict_entries <= 2) {
+    return 1;
+  } else if (num_dict_entries <= 4) {
+    return 2;
+  } else if (num_dict_entries <= 16) {
+    return 4;
+  } else if (num_dict_entries <= 256) {
+    return 8;
+  } else if (num_dict_entries <= 4096) {
+    return 12;
+  }
+  return 16;
+}
+
+/**
+ * @brief Estimates the size of dictionary-encoded values, including the dictionary itself
+ *
+ * @param dict_size Size of the dictionary entries in bytes
+ * @param num_dict_entries Number of dictionary entries
+ * @param num_values Number of non-null values
+ **/
+size_t get_dictionary_encoded_size(size_t dict_size, uint32_t num_dict_entries, size_t num_values)
+{
+  return dict_size + (num_values * get_dictionary_index_bits(num_dict_entries) + 7) / 8;
+}
+
+constexpr double bloom_filter_fpp      = 0.01;     // Target false positive probability
+constexpr size_t min_bloom_filter_size = 32;       // One 256-bit block
+constexpr size_t max_bloom_filter_size = 1 << 20;  // 1MB
+
+/**
+ * @brief Returns the bitset size of a split-block bloom filter for a number of distinct values
+ *
+ * The size is rounded up to a power of two, so that blocks are selected without bias.
+ **/
+size_t get_bloom_filter_size(size_t num_distinct_values)
+{
+  auto const num_bits =
+    -8.0 * num_distinct_values / std::log(1.0 - std::pow(bloom_filter_fpp, 1.0 / 8));
+  size_t num_bytes = min_bloom_filter_size;
+  while (num_bytes < max_bloom_filter_size && num_bytes * 8 < num_bits) { num_bytes *= 2; }
+  return num_bytes;
+}
+
 /**
  * @brief Function that translates GDF compression to parquet compression
  **/
@@ -53,6 +120,9 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::GZIP:
+    case compression_type::DEFLATE: return parquet::Compression::GZIP;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -313,6 +383,7 @@ void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk
 
 void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                                             hostdevice_vector<gpu::EncColumnDesc> &col_desc,
+                                            const hostdevice_vector<gpu::PageFragment> &fragments,
                                             uint32_t num_rowgroups,
                                             uint32_t num_columns,
                                             uint32_t num_dictionaries,
@@ -327,6 +398,32 @@ void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChun
                                        dict_scratch_size,
                                        num_rowgroups * num_columns,
                                        stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Now that the dictionaries are known, fall back to PLAIN encoding if it's not larger than the
+  // dictionary-encoded data of the fragments that use the dictionary
+  for (size_t c = 0; c < num_rowgroups * num_columns; c++) {
+    auto &ck = chunks[c];
+    if (!ck.has_dictionary ||
+        get_dictionary_policy(dictionary_policies_, c % num_columns) !=
+          dictionary_policy::ADAPTIVE) {
+      continue;
+    }
+    size_t plain_size = 0;
+    size_t num_values = 0;
+    for (uint32_t j = 0; j < ck.num_dict_fragments; j++) {
+      plain_size += fragments[ck.first_fragment + j].fragment_data_size;
+      num_values += fragments[ck.first_fragment + j].non_nulls;
+    }
+    if (get_dictionary_encoded_size(ck.dictionary_size, ck.total_dict_entries, num_values) >=
+        plain_size) {
+      ck.has_dictionary = 0;
+    }
+  }
+  CUDA_TRY(cudaMemcpyAsync(
+    chunks.device_ptr(), chunks.host_ptr(), chunks.memory_size(), cudaMemcpyHostToDevice, stream));
   CUDA_TRY(gpu::InitEncoderPages(chunks.device_ptr(),
                                  nullptr,
                                  col_desc.device_ptr(),
@@ -396,6 +493,12 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
     case parquet::Compression::SNAPPY:
       CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
       break;
+    case parquet::Compression::GZIP:
+      CUDA_TRY(gpu_deflate(comp_in, comp_out, pages_in_batch, compression_level_, 1, stream));
+      break;
+    case parquet::Compression::ZSTD:
+      CUDA_TRY(gpu_zstd(comp_in, comp_out, pages_in_batch, compression_level_, stream));
+      break;
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -426,12 +529,155 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
   CUDA_TRY(cudaStreamSynchronize(stream));
 }
 
+void writer::impl::write_bloom_filters(const hostdevice_vector<gpu::EncColumnChunk> &chunks,
+                                       const hostdevice_vector<gpu::PageFragment> &fragments,
+                                       uint32_t num_rowgroups,
+                                       uint32_t num_columns,
+                                       uint32_t fragment_size,
+                                       size_t global_rowgroup_base,
+                                       pq_chunked_state &state)
+{
+  const uint32_t num_chunks = num_rowgroups * num_columns;
+  hostdevice_vector<gpu::BloomFilterChunk> filters(num_chunks);
+  std::vector<size_t> filter_sizes(num_chunks);
+  size_t total_size = 0;
+  uint32_t max_rows = 0;
+  for (uint32_t c = 0; c < num_chunks; c++) {
+    const auto &ck   = chunks[c];
+    const auto &meta = state.md.row_groups[global_rowgroup_base + c / num_columns]
+                         .columns[c % num_columns]
+                         .meta_data;
+    if (meta.type == BOOLEAN || ck.num_rows == 0) { continue; }
+    // Size the filter for the number of distinct values if all the chunk is dictionary-encoded,
+    // otherwise for the number of values
+    size_t num_distinct_values;
+    if (ck.has_dictionary && ck.num_dict_fragments * fragment_size >= ck.num_rows) {
+      num_distinct_values = ck.total_dict_entries;
+    } else {
+      num_distinct_values = 0;
+      for (uint32_t j = 0; j * fragment_size < ck.num_rows; j++) {
+        num_distinct_values += fragments[ck.first_fragment + j].non_nulls;
+      }
+    }
+    filter_sizes[c] = get_bloom_filter_size(num_distinct_values);
+    max_rows        = std::max(max_rows, ck.num_rows);
+    total_size += filter_sizes[c];
+  }
+  if (total_size == 0) { return; }
+
+  rmm::device_buffer bitsets(total_size, state.stream);
+  auto d_bitsets = static_cast<uint8_t *>(bitsets.data());
+  CUDA_TRY(cudaMemsetAsync(bitsets.data(), 0, total_size, state.stream));
+  for (size_t c = 0, offset = 0; c < num_chunks; offset += filter_sizes[c++]) {
+    filters[c].col_desc   = chunks[c].col_desc;
+    filters[c].bitset     = reinterpret_cast<uint32_t *>(d_bitsets + offset);
+    filters[c].num_blocks = static_cast<uint32_t>(filter_sizes[c] / 32);
+    filters[c].start_row  = chunks[c].start_row;
+    filters[c].num_rows   = chunks[c].num_rows;
+  }
+  CUDA_TRY(cudaMemcpyAsync(filters.device_ptr(),
+                           filters.host_ptr(),
+                           filters.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           state.stream));
+  CUDA_TRY(gpu::BuildBloomFilters(filters.device_ptr(), num_chunks, max_rows, state.stream));
+  std::vector<uint8_t> h_bitsets(total_size);
+  CUDA_TRY(cudaMemcpyAsync(
+    h_bitsets.data(), bitsets.data(), total_size, cudaMemcpyDeviceToHost, state.stream));
+  CUDA_TRY(cudaStreamSynchronize(state.stream));
+
+  // Each filter is written as its header followed by the bitset
+  CompactProtocolWriter cpw(&buffer_);
+  for (size_t c = 0, offset = 0; c < num_chunks; offset += filter_sizes[c++]) {
+    if (filter_sizes[c] == 0) { continue; }
+    BloomFilterHeader header;
+    header.num_bytes = static_cast<int32_t>(filter_sizes[c]);
+    buffer_.resize(0);
+    cpw.write(&header);
+    state.md.row_groups[global_rowgroup_base + c / num_columns]
+      .columns[c % num_columns]
+      .meta_data.bloom_filter_offset = state.current_chunk_offset;
+    out_sink_->host_write(buffer_.data(), buffer_.size());
+    out_sink_->host_write(h_bitsets.data() + offset, filter_sizes[c]);
+    state.current_chunk_offset += buffer_.size() + filter_sizes[c];
+  }
+}
+
+void writer::impl::build_page_index(const gpu::EncColumnChunk &ck,
+                                    const gpu::EncPage *pages,
+                                    const uint8_t *chunk_data,
+                                    size_t chunk_offset,
+                                    bool is_byte_array,
+                                    OffsetIndex &offset_index,
+                                    ColumnIndex &column_index,
+                                    cudaStream_t stream)
+{
+  const bool has_page_stats = (stats_granularity_ == statistics_freq::STATISTICS_PAGE);
+  std::vector<uint8_t> headers;
+  std::vector<size_t> header_pos;
+
+  // Pages are laid out back to back, dictionary page first
+  size_t page_offset = 0;
+  for (uint32_t p = 0; p < ck.num_pages; p++) {
+    const auto &page     = pages[p];
+    const auto page_size = page.hdr_size + page.max_data_size;
+    if (page.page_type == DATA_PAGE) {
+      PageLocation location;
+      location.offset               = chunk_offset + page_offset;
+      location.compressed_page_size = page_size;
+      location.first_row_index      = page.start_row - ck.start_row;
+      offset_index.page_locations.push_back(location);
+      if (has_page_stats) {
+        header_pos.push_back(headers.size());
+        headers.resize(headers.size() + page.hdr_size);
+        CUDA_TRY(cudaMemcpyAsync(headers.data() + header_pos.back(),
+                                 chunk_data + page_offset,
+                                 page.hdr_size,
+                                 cudaMemcpyDeviceToHost,
+                                 stream));
+      }
+    }
+    page_offset += page_size;
+  }
+  if (!has_page_stats) { return; }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Collect the page-level statistics from the encoded data page headers
+  for (uint32_t p = 0, k = 0; p < ck.num_pages; p++) {
+    const auto &page = pages[p];
+    if (page.page_type != DATA_PAGE) { continue; }
+    PageHeader header;
+    CompactProtocolReader cp(headers.data() + header_pos[k], page.hdr_size);
+    k++;
+    const auto &stats = header.data_page_header.statistics;
+    if (!cp.read(&header)) {
+      column_index = ColumnIndex{};
+      return;
+    }
+    const bool is_null_page = (page.num_rows != 0 && stats.null_count == page.num_rows);
+    if (!is_null_page && !is_byte_array && stats.min_value.empty() && stats.max_value.empty()) {
+      // Min/max are missing (e.g. NaN-only float pages): the column index can't represent that
+      column_index = ColumnIndex{};
+      return;
+    }
+    column_index.null_pages.push_back(is_null_page);
+    column_index.min_values.push_back(is_null_page ? std::string{} : stats.min_value);
+    column_index.max_values.push_back(is_null_page ? std::string{} : stats.max_value);
+    column_index.null_counts.push_back(std::max<int64_t>(stats.null_count, 0));
+  }
+}
+
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr),
+    max_batch_size_(options.max_batch_size != 0 ? options.max_batch_size : DEFAULT_BATCH_MAXSIZE),
     compression_(to_parquet_compression(options.compression)),
+    compression_level_(options.compression_level),
     stats_granularity_(options.stats_granularity),
+    dictionary_policies_(options.column_dictionary_policy),
+    use_delta_encoding_(options.use_delta_encoding),
+    write_bloom_filters_(options.write_bloom_filters),
     out_sink_(std::move(sink))
 {
 }
@@ -559,7 +805,8 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     desc->valid_map_base   = col.nulls();
     desc->stats_dtype      = col.stats_type();
     desc->ts_scale         = col.ts_scale();
-    if (state.md.schema[1 + i].type != BOOLEAN && state.md.schema[1 + i].type != UNDEFINED_TYPE) {
+    if (state.md.schema[1 + i].type != BOOLEAN && state.md.schema[1 + i].type != UNDEFINED_TYPE &&
+        get_dictionary_policy(dictionary_policies_, i) != dictionary_policy::NEVER) {
       col.alloc_dictionary(num_rows);
       desc->dict_index = col.get_dict_index();
       desc->dict_data  = col.get_dict_data();
@@ -571,6 +818,9 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     desc->physical_type  = static_cast<uint8_t>(state.md.schema[1 + i].type);
     desc->converted_type = static_cast<uint8_t>(state.md.schema[1 + i].converted_type);
     desc->level_bits     = (state.md.schema[1 + i].repetition_type == OPTIONAL) ? 1 : 0;
+    desc->delta_encoding = use_delta_encoding_ && (desc->physical_type == INT32 ||
+                                                   desc->physical_type == INT64 ||
+                                                   desc->physical_type == BYTE_ARRAY);
   }
 
   // Init page fragments
@@ -662,17 +912,21 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       ck->dictionary_id  = num_dictionaries;
       ck->ck_stat_size   = 0;
       if (col_desc[i].dict_data) {
+        // Skip building the dictionary if even the fragments' own dictionaries, which include
+        // the entries they have in common, suggest that PLAIN encoding is smaller
         const gpu::PageFragment *ck_frag = &fragments[i * num_fragments + f];
         size_t plain_size                = 0;
         size_t dict_size                 = 1;
+        size_t num_values                = 0;
         uint32_t num_dict_vals           = 0;
         for (uint32_t j = 0; j < fragments_in_chunk && num_dict_vals < 65536; j++) {
           plain_size += ck_frag[j].fragment_data_size;
-          dict_size +=
-            ck_frag[j].dict_data_size + ((num_dict_vals > 256) ? 2 : 1) * ck_frag[j].non_nulls;
+          dict_size += ck_frag[j].dict_data_size;
+          num_values += ck_frag[j].non_nulls;
           num_dict_vals += ck_frag[j].num_dict_vals;
         }
-        if (dict_size < plain_size) {
+        if (get_dictionary_policy(dictionary_policies_, i) == dictionary_policy::ALWAYS ||
+            get_dictionary_encoded_size(dict_size, num_dict_vals, num_values) < plain_size) {
           parquet_columns[i].use_dictionary(true);
           dict_enable = true;
           num_dictionaries++;
@@ -681,9 +935,6 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       ck->has_dictionary                                           = dict_enable;
       state.md.row_groups[global_r].columns[i].meta_data.type      = state.md.schema[1 + i].type;
       state.md.row_groups[global_r].columns[i].meta_data.encodings = {PLAIN, RLE};
-      if (dict_enable) {
-        state.md.row_groups[global_r].columns[i].meta_data.encodings.push_back(PLAIN_DICTIONARY);
-      }
       state.md.row_groups[global_r].columns[i].meta_data.path_in_schema = {
         state.md.schema[1 + i].name};
       state.md.row_groups[global_r].columns[i].meta_data.codec = UNCOMPRESSED;
@@ -700,13 +951,25 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   // Build chunk dictionaries and count pages
   if (num_chunks != 0) {
     build_chunk_dictionaries(
-      chunks, col_desc, num_rowgroups, num_columns, num_dictionaries, state.stream);
+      chunks, col_desc, fragments, num_rowgroups, num_columns, num_dictionaries, state.stream);
+  }
+  for (uint32_t r = 0, global_r = global_rowgroup_base; r < num_rowgroups; r++, global_r++) {
+    for (int i = 0; i < num_columns; i++) {
+      auto const &ck = chunks[r * num_columns + i];
+      auto &encodings = state.md.row_groups[global_r].columns[i].meta_data.encodings;
+      if (ck.has_dictionary) { encodings.push_back(PLAIN_DICTIONARY); }
+      // Pages past the dictionary fragments are DELTA-encoded
+      if (col_desc[i].delta_encoding &&
+          (!ck.has_dictionary || ck.num_dict_fragments * fragment_size < ck.num_rows)) {
+        encodings.push_back((col_desc[i].physical_type == BYTE_ARRAY) ? DELTA_LENGTH_BYTE_ARRAY
+                                                                      : DELTA_BINARY_PACKED);
+      }
+    }
   }
 
   // Initialize batches of rowgroups to encode (mainly to limit peak memory usage)
   std::vector<uint32_t> batch_list;
   uint32_t num_pages          = 0;
-  size_t max_bytes_in_batch   = 1024 * 1024 * 1024;  // 1GB - TBD: Tune this
   size_t max_uncomp_bfr_size  = 0;
   size_t max_chunk_bfr_size   = 0;
   uint32_t max_pages_in_batch = 0;
@@ -726,7 +989,7 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     }
     // TBD: We may want to also shorten the batch if we have enough pages (not just based on size)
     if ((r == num_rowgroups) ||
-        (groups_in_batch != 0 && bytes_in_batch + rowgroup_size > max_bytes_in_batch)) {
+        (groups_in_batch != 0 && bytes_in_batch + rowgroup_size > max_batch_size_)) {
       max_uncomp_bfr_size = std::max(max_uncomp_bfr_size, bytes_in_batch);
       max_pages_in_batch  = std::max(max_pages_in_batch, pages_in_batch);
       if (groups_in_batch != 0) {
@@ -749,15 +1012,22 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     (compression_ != parquet::Compression::UNCOMPRESSED) ? max_pages_in_batch : 0;
   uint32_t num_stats_bfr =
     (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_pages + num_chunks : 0;
-  rmm::device_buffer uncomp_bfr(max_uncomp_bfr_size, state.stream);
-  rmm::device_buffer comp_bfr(max_comp_bfr_size, state.stream);
+  // Consecutive batches alternate between two sets of buffers, so that a batch can be encoded
+  // while the previous one is being written out
+  const int num_bfr_sets = (batch_list.size() > 1) ? 2 : 1;
+  std::vector<rmm::device_buffer> uncomp_bfr;
+  std::vector<rmm::device_buffer> comp_bfr;
+  for (int i = 0; i < num_bfr_sets; i++) {
+    uncomp_bfr.emplace_back(max_uncomp_bfr_size, state.stream);
+    comp_bfr.emplace_back(max_comp_bfr_size, state.stream);
+  }
   rmm::device_vector<gpu_inflate_input_s> comp_in(max_comp_pages);
   rmm::device_vector<gpu_inflate_status_s> comp_out(max_comp_pages);
   rmm::device_vector<gpu::EncPage> pages(num_pages);
   rmm::device_vector<statistics_chunk> page_stats(num_stats_bfr);
   for (uint32_t b = 0, r = 0; b < (uint32_t)batch_list.size(); b++) {
-    uint8_t *bfr   = reinterpret_cast<uint8_t *>(uncomp_bfr.data());
-    uint8_t *bfr_c = reinterpret_cast<uint8_t *>(comp_bfr.data());
+    uint8_t *bfr   = reinterpret_cast<uint8_t *>(uncomp_bfr[b % num_bfr_sets].data());
+    uint8_t *bfr_c = reinterpret_cast<uint8_t *>(comp_bfr[b % num_bfr_sets].data());
     for (uint32_t j = 0; j < batch_list[b]; j++, r++) {
       for (int i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
@@ -796,29 +1066,16 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     }
   }();
 
-  // Encode row groups in batches
-  for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
-       b++) {
-    // Count pages in this batch
-    uint32_t rnext               = r + batch_list[b];
-    uint32_t first_page_in_batch = chunks[r * num_columns].first_page;
-    uint32_t first_page_in_next_batch =
-      (rnext < num_rowgroups) ? chunks[rnext * num_columns].first_page : num_pages;
-    uint32_t pages_in_batch = first_page_in_next_batch - first_page_in_batch;
-    encode_pages(
-      chunks,
-      pages.data().get(),
-      num_columns,
-      pages_in_batch,
-      first_page_in_batch,
-      batch_list[b],
-      r,
-      comp_in.data().get(),
-      comp_out.data().get(),
-      (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data().get() : nullptr,
-      (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
-                                                               : nullptr,
-      state.stream);
+  state.offset_indexes.resize(state.md.row_groups.size(), std::vector<OffsetIndex>(num_columns));
+  state.column_indexes.resize(state.md.row_groups.size(), std::vector<ColumnIndex>(num_columns));
+
+  // Writes out the encoded chunks of a batch of rowgroups
+  auto write_batch = [&](uint32_t r,
+                         uint32_t rnext,
+                         uint32_t global_r,
+                         uint32_t first_page_in_batch,
+                         const std::vector<gpu::EncPage> &host_pages,
+                         cudaStream_t stream) {
     for (; r < rnext; r++, global_r++) {
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
@@ -832,7 +1089,7 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
 
         if (out_sink_->supports_device_write()) {
           // let the writer do what it wants to retrieve the data from the gpu.
-          out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, state.stream);
+          out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, stream);
           // we still need to do a (much smaller) memcpy for the statistics.
           if (ck->ck_stat_size != 0) {
             state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
@@ -842,8 +1099,8 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
               dev_bfr,
               ck->ck_stat_size,
               cudaMemcpyDeviceToHost,
-              state.stream));
-            CUDA_TRY(cudaStreamSynchronize(state.stream));
+              stream));
+            CUDA_TRY(cudaStreamSynchronize(stream));
           }
         } else {
           // copy the full data
@@ -851,8 +1108,8 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                                    dev_bfr,
                                    ck->ck_stat_size + ck->compressed_size,
                                    cudaMemcpyDeviceToHost,
-                                   state.stream));
-          CUDA_TRY(cudaStreamSynchronize(state.stream));
+                                   stream));
+          CUDA_TRY(cudaStreamSynchronize(stream));
           out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
           if (ck->ck_stat_size != 0) {
             state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
@@ -862,6 +1119,14 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                    ck->ck_stat_size);
           }
         }
+        build_page_index(*ck,
+                         &host_pages[ck->first_page - first_page_in_batch],
+                         dev_bfr + ck->ck_stat_size,
+                         state.current_chunk_offset,
+                         state.md.row_groups[global_r].columns[i].meta_data.type == BYTE_ARRAY,
+                         state.offset_indexes[global_r][i],
+                         state.column_indexes[global_r][i],
+                         stream);
         state.md.row_groups[global_r].total_byte_size += ck->compressed_size;
         state.md.row_groups[global_r].columns[i].meta_data.data_page_offset =
           state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
@@ -873,6 +1138,74 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         state.current_chunk_offset += ck->compressed_size;
       }
     }
+  };
+
+  // With several batches, each one is written out on a separate thread and stream while the next
+  // one is encoded
+  owned_stream io_stream{nullptr, cudaStreamDestroy};
+  if (num_bfr_sets > 1) {
+    cudaStream_t stream;
+    CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+    io_stream.reset(stream);
+  }
+  std::vector<gpu::EncPage> host_pages[2];
+  std::future<void> pending_write;
+
+  // Encode row groups in batches
+  for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
+       b++) {
+    // Count pages in this batch
+    uint32_t rnext               = r + batch_list[b];
+    uint32_t first_page_in_batch = chunks[r * num_columns].first_page;
+    uint32_t first_page_in_next_batch =
+      (rnext < num_rowgroups) ? chunks[rnext * num_columns].first_page : num_pages;
+    uint32_t pages_in_batch = first_page_in_next_batch - first_page_in_batch;
+    encode_pages(
+      chunks,
+      pages.data().get(),
+      num_columns,
+      pages_in_batch,
+      first_page_in_batch,
+      batch_list[b],
+      r,
+      comp_in.data().get(),
+      comp_out.data().get(),
+      (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data().get() : nullptr,
+      (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
+                                                               : nullptr,
+      state.stream);
+    // Retrieve the final page sizes to record the page locations of each chunk
+    auto &batch_pages = host_pages[b % num_bfr_sets];
+    batch_pages.resize(pages_in_batch);
+    CUDA_TRY(cudaMemcpyAsync(batch_pages.data(),
+                             pages.data().get() + first_page_in_batch,
+                             pages_in_batch * sizeof(gpu::EncPage),
+                             cudaMemcpyDeviceToHost,
+                             state.stream));
+    CUDA_TRY(cudaStreamSynchronize(state.stream));
+
+    // The previous batch must be written out before its buffers are reused by the next one
+    if (pending_write.valid()) { pending_write.get(); }
+    if (num_bfr_sets > 1) {
+      pending_write = std::async(std::launch::async,
+                                 write_batch,
+                                 r,
+                                 rnext,
+                                 global_r,
+                                 first_page_in_batch,
+                                 std::cref(batch_pages),
+                                 io_stream.get());
+    } else {
+      write_batch(r, rnext, global_r, first_page_in_batch, batch_pages, state.stream);
+    }
+    global_r += rnext - r;
+    r = rnext;
+  }
+  if (pending_write.valid()) { pending_write.get(); }
+
+  if (write_bloom_filters_ && num_chunks != 0) {
+    write_bloom_filters(
+      chunks, fragments, num_rowgroups, num_columns, fragment_size, global_rowgroup_base, state);
   }
 }
 
@@ -881,6 +1214,33 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::write_chunked_end(
 {
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
+
+  // Write the page indexes of all the chunks between the last rowgroup and the footer
+  for (size_t r = 0; r < state.column_indexes.size(); r++) {
+    for (size_t i = 0; i < state.column_indexes[r].size(); i++) {
+      const auto &column_index = state.column_indexes[r][i];
+      if (column_index.null_pages.empty()) { continue; }
+      buffer_.resize(0);
+      auto &col               = state.md.row_groups[r].columns[i];
+      col.column_index_offset = state.current_chunk_offset;
+      col.column_index_length = static_cast<int32_t>(cpw.write(&column_index));
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      state.current_chunk_offset += buffer_.size();
+    }
+  }
+  for (size_t r = 0; r < state.offset_indexes.size(); r++) {
+    for (size_t i = 0; i < state.offset_indexes[r].size(); i++) {
+      const auto &offset_index = state.offset_indexes[r][i];
+      if (offset_index.page_locations.empty()) { continue; }
+      buffer_.resize(0);
+      auto &col               = state.md.row_groups[r].columns[i];
+      col.offset_index_offset = state.current_chunk_offset;
+      col.offset_index_length = static_cast<int32_t>(cpw.write(&offset_index));
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      state.current_chunk_offset += buffer_.size();
+    }
+  }
+
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(&state.md));
   fendr.magic      = PARQUET_MAGIC;
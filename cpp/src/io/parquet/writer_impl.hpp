@@ -59,6 +59,10 @@ class writer::impl {
   // rowgroups are divided into pages
   static constexpr uint32_t DEFAULT_TARGET_PAGE_SIZE = 512 * 1024;
 
+  // Batches of rowgroups are double-buffered, so each of the two in flight gets half of the
+  // memory budget
+  static constexpr size_t DEFAULT_BATCH_MAXSIZE = 512 * 1024 * 1024;  // 512MB - TBD: Tune this
+
  public:
   /**
    * @brief Constructor with writer options.
@@ -158,8 +162,12 @@ class writer::impl {
   /**
    * @brief Build per-chunk dictionaries and count data pages
    *
+   * Chunks of columns with the `ADAPTIVE` dictionary policy fall back to PLAIN encoding if their
+   * dictionary-encoded data would not be smaller.
+   *
    * @param chunks column chunk array
    * @param col_desc column description array
+   * @param fragments page fragment array
    * @param num_rowgroups Total number of rowgroups
    * @param num_columns Total number of columns
    * @param num_dictionaries Total number of dictionaries
@@ -167,6 +175,7 @@ class writer::impl {
    **/
   void build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChunk>& chunks,
                                 hostdevice_vector<gpu::EncColumnDesc>& col_desc,
+                                const hostdevice_vector<gpu::PageFragment>& fragments,
                                 uint32_t num_rowgroups,
                                 uint32_t num_columns,
                                 uint32_t num_dictionaries,
@@ -221,6 +230,45 @@ class writer::impl {
                     const statistics_chunk* page_stats,
                     const statistics_chunk* chunk_stats,
                     cudaStream_t stream);
+  /**
+   * @brief Build the split-block bloom filters of column chunks and write them out after the
+   * chunks, recording their offsets in the rowgroup metadata
+   *
+   * @param chunks column chunk array
+   * @param fragments page fragment array
+   * @param num_rowgroups Total number of rowgroups
+   * @param num_columns Total number of columns
+   * @param fragment_size Number of rows per page fragment
+   * @param global_rowgroup_base Index of the first rowgroup in the file metadata
+   * @param state chunked writer state
+   **/
+  void write_bloom_filters(const hostdevice_vector<gpu::EncColumnChunk>& chunks,
+                           const hostdevice_vector<gpu::PageFragment>& fragments,
+                           uint32_t num_rowgroups,
+                           uint32_t num_columns,
+                           uint32_t fragment_size,
+                           size_t global_rowgroup_base,
+                           pq_chunked_state& state);
+  /**
+   * @brief Build the page index of an encoded column chunk
+   *
+   * @param ck column chunk
+   * @param pages host copy of the encoded pages of the chunk
+   * @param chunk_data device pointer to the first page header of the chunk
+   * @param chunk_offset file offset of the chunk
+   * @param is_byte_array whether the column is of BYTE_ARRAY physical type
+   * @param offset_index data page locations to populate
+   * @param column_index data page statistics to populate if page-level statistics are enabled
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void build_page_index(const gpu::EncColumnChunk& ck,
+                        const gpu::EncPage* pages,
+                        const uint8_t* chunk_data,
+                        size_t chunk_offset,
+                        bool is_byte_array,
+                        OffsetIndex& offset_index,
+                        ColumnIndex& column_index,
+                        cudaStream_t stream);
 
  private:
   // TODO : figure out if we want to keep this. It is currently unused.
@@ -229,8 +277,13 @@ class writer::impl {
   size_t max_rowgroup_size_          = DEFAULT_ROWGROUP_MAXSIZE;
   size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
   size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
+  size_t max_batch_size_             = DEFAULT_BATCH_MAXSIZE;
   Compression compression_           = Compression::UNCOMPRESSED;
+  int compression_level_             = 0;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
+  std::vector<dictionary_policy> dictionary_policies_;
+  bool use_delta_encoding_  = false;
+  bool write_bloom_filters_ = false;
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "column_stats.h"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace {
+/**
+ * @brief Returns the statistics type of a column type, with timestamps in their own units
+ */
+statistics_dtype to_statistics_dtype(data_type type)
+{
+  switch (type.id()) {
+    case type_id::BOOL8: return dtype_bool;
+    case type_id::INT8: return dtype_int8;
+    case type_id::INT16: return dtype_int16;
+    case type_id::INT32:
+    case type_id::TIMESTAMP_DAYS:
+    case type_id::DURATION_DAYS: return dtype_int32;
+    case type_id::INT64: return dtype_int64;
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS:
+    case type_id::DURATION_SECONDS:
+    case type_id::DURATION_MILLISECONDS:
+    case type_id::DURATION_MICROSECONDS:
+    case type_id::DURATION_NANOSECONDS: return dtype_timestamp64;
+    case type_id::FLOAT32: return dtype_float32;
+    case type_id::FLOAT64: return dtype_float64;
+    case type_id::STRING: return dtype_string;
+    default: return dtype_none;
+  }
+}
+
+/**
+ * @brief Returns a bitmask of the given validity of each row
+ */
+rmm::device_buffer make_null_mask(std::vector<bool> const &is_valid,
+                                  cudaStream_t stream,
+                                  rmm::mr::device_memory_resource *mr)
+{
+  std::vector<bitmask_type> mask(num_bitmask_words(is_valid.size()), 0);
+  for (size_t i = 0; i < is_valid.size(); ++i) {
+    if (is_valid[i]) { mask[i / 32] |= 1u << (i % 32); }
+  }
+  rmm::device_buffer null_mask(mask.data(), mask.size() * sizeof(bitmask_type), stream, mr);
+  return null_mask;
+}
+
+/**
+ * @brief Creates a fixed-width column from host data and validity
+ */
+std::unique_ptr<column> make_host_column(data_type type,
+                                         std::vector<uint8_t> const &data,
+                                         std::vector<bool> const &is_valid,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  auto const size       = static_cast<size_type>(is_valid.size());
+  auto const null_count = static_cast<size_type>(std::count(is_valid.begin(), is_valid.end(), 0));
+  auto col              = make_fixed_width_column(
+    type,
+    size,
+    (null_count != 0) ? make_null_mask(is_valid, stream, mr) : rmm::device_buffer{0, stream, mr},
+    null_count,
+    stream,
+    mr);
+  CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head(),
+                           data.data(),
+                           data.size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return col;
+}
+
+/**
+ * @brief Creates the min or max column of a column from the statistics of its chunks
+ */
+std::unique_ptr<column> make_minmax_column(data_type type,
+                                           statistics_dtype dtype,
+                                           statistics_chunk const *chunks,
+                                           size_t num_chunks,
+                                           bool is_min,
+                                           cudaStream_t stream,
+                                           rmm::mr::device_memory_resource *mr)
+{
+  std::vector<bool> is_valid(num_chunks);
+  for (size_t i = 0; i < num_chunks; ++i) { is_valid[i] = (chunks[i].has_minmax != 0); }
+  if (type.id() == type_id::STRING) {
+    // The strings point into the character data of the column
+    std::vector<thrust::pair<const char *, size_type>> strings(num_chunks, {nullptr, 0});
+    for (size_t i = 0; i < num_chunks; ++i) {
+      if (!is_valid[i]) { continue; }
+      auto const &value = is_min ? chunks[i].min_value.str_val : chunks[i].max_value.str_val;
+      strings[i]        = {value.ptr, static_cast<size_type>(value.length)};
+    }
+    return make_strings_column(rmm::device_vector<thrust::pair<const char *, size_type>>(strings),
+                               stream,
+                               mr);
+  }
+
+  std::vector<uint8_t> data(num_chunks * size_of(type), 0);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    if (!is_valid[i]) { continue; }
+    auto const &value = is_min ? chunks[i].min_value : chunks[i].max_value;
+    auto const dst    = data.data() + i * size_of(type);
+    if (dtype == dtype_float64) {
+      std::memcpy(dst, &value.fp_val, sizeof(double));
+    } else if (dtype == dtype_float32) {
+      auto const fp_val = static_cast<float>(value.fp_val);
+      std::memcpy(dst, &fp_val, sizeof(float));
+    } else {
+      // Integer-like values are little-endian; keep the low bytes of the 64-bit value
+      std::memcpy(dst, &value.i_val, size_of(type));
+    }
+  }
+  return make_host_column(type, data, is_valid, stream, mr);
+}
+
+/**
+ * @brief Creates the sum column of a column from the statistics of its chunks
+ */
+std::unique_ptr<column> make_sum_column(statistics_dtype dtype,
+                                        statistics_chunk const *chunks,
+                                        size_t num_chunks,
+                                        cudaStream_t stream,
+                                        rmm::mr::device_memory_resource *mr)
+{
+  auto const is_float = (dtype == dtype_float32 || dtype == dtype_float64);
+  std::vector<bool> is_valid(num_chunks);
+  std::vector<uint8_t> data(num_chunks * sizeof(int64_t), 0);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    is_valid[i] = (chunks[i].has_sum != 0);
+    if (is_float) {
+      std::memcpy(data.data() + i * sizeof(double), &chunks[i].sum.fp_val, sizeof(double));
+    } else {
+      std::memcpy(data.data() + i * sizeof(int64_t), &chunks[i].sum.i_val, sizeof(int64_t));
+    }
+  }
+  auto const type = data_type{is_float ? type_id::FLOAT64 : type_id::INT64};
+  return make_host_column(type, data, is_valid, stream, mr);
+}
+
+}  // namespace
+
+std::vector<column_statistics> compute_column_statistics(table_view const &table,
+                                                         size_type rows_per_chunk,
+                                                         rmm::mr::device_memory_resource *mr,
+                                                         cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(rows_per_chunk > 0, "Invalid number of rows per chunk");
+  auto const num_rows   = table.num_rows();
+  auto const num_cols   = table.num_columns();
+  size_t const per_col  = (num_rows + rows_per_chunk - 1) / rows_per_chunk;
+  size_t const num_srcs = per_col * num_cols;
+
+  // Bitmasks are copied to start at the first row of sliced columns, and strings are described by
+  // their pointer and length
+  hostdevice_vector<stats_column_desc> desc(num_cols);
+  std::vector<rmm::device_buffer> null_masks;
+  std::vector<rmm::device_vector<nvstrdesc_s>> strings;
+  for (size_type i = 0; i < num_cols; ++i) {
+    auto const &col = table.column(i);
+    desc[i].stats_dtype      = to_statistics_dtype(col.type());
+    desc[i].num_rows         = num_rows;
+    desc[i].ts_scale         = 0;
+    desc[i].valid_map_base   = nullptr;
+    desc[i].column_data_base = nullptr;
+    if (col.nullable()) {
+      if (col.offset() == 0) {
+        desc[i].valid_map_base = col.null_mask();
+      } else {
+        null_masks.emplace_back(copy_bitmask(col, stream));
+        desc[i].valid_map_base = static_cast<uint32_t const *>(null_masks.back().data());
+      }
+    }
+    if (desc[i].stats_dtype == dtype_string && num_rows > 0) {
+      strings_column_view view{col};
+      strings.emplace_back(num_rows);
+      auto const d_strings = strings.back().data().get();
+      auto const offsets   = view.offsets().data<size_type>() + view.offset();
+      auto const chars     = view.chars().data<char>();
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         num_rows,
+                         [d_strings, offsets, chars] __device__(size_type row) {
+                           d_strings[row].ptr   = chars + offsets[row];
+                           d_strings[row].count = offsets[row + 1] - offsets[row];
+                         });
+      desc[i].column_data_base = d_strings;
+    } else if (desc[i].stats_dtype != dtype_none && desc[i].stats_dtype != dtype_string) {
+      desc[i].column_data_base = col.head<uint8_t>() + col.offset() * size_of(col.type());
+    }
+  }
+  CUDA_TRY(cudaMemcpyAsync(
+    desc.device_ptr(), desc.host_ptr(), desc.memory_size(), cudaMemcpyHostToDevice, stream));
+
+  // Chunks of columns of unsupported types are left empty by the kernel
+  hostdevice_vector<statistics_group> groups(num_srcs);
+  for (size_type i = 0; i < num_cols; ++i) {
+    for (size_t c = 0; c < per_col; ++c) {
+      auto &group     = groups[i * per_col + c];
+      group.col       = desc.device_ptr(i);
+      group.start_row = c * rows_per_chunk;
+      group.num_rows  = std::min<size_t>(rows_per_chunk, num_rows - c * rows_per_chunk);
+    }
+  }
+  hostdevice_vector<statistics_chunk> chunks(num_srcs);
+  if (num_srcs > 0) {
+    CUDA_TRY(cudaMemcpyAsync(groups.device_ptr(),
+                             groups.host_ptr(),
+                             groups.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(GatherColumnStatistics(chunks.device_ptr(), groups.device_ptr(), num_srcs, stream));
+    CUDA_TRY(cudaMemcpyAsync(chunks.host_ptr(),
+                             chunks.device_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<column_statistics> stats(num_cols);
+  for (size_type i = 0; i < num_cols; ++i) {
+    auto const &col       = table.column(i);
+    auto const dtype      = desc[i].stats_dtype;
+    auto const col_chunks = chunks.host_ptr() + i * per_col;
+
+    std::vector<int32_t> null_counts(per_col, 0);
+    if (dtype != dtype_none) {
+      for (size_t c = 0; c < per_col; ++c) { null_counts[c] = col_chunks[c].null_count; }
+    } else if (col.nullable()) {
+      std::vector<size_type> indices;
+      for (size_t c = 0; c < per_col; ++c) {
+        indices.push_back(col.offset() + groups[i * per_col + c].start_row);
+        indices.push_back(indices.back() + groups[i * per_col + c].num_rows);
+      }
+      auto const counts = segmented_count_unset_bits(col.null_mask(), indices);
+      std::copy(counts.begin(), counts.end(), null_counts.begin());
+    }
+    std::vector<uint8_t> null_count_data(per_col * sizeof(int32_t));
+    std::memcpy(null_count_data.data(), null_counts.data(), null_count_data.size());
+    stats[i].null_count = make_host_column(
+      data_type{type_id::INT32}, null_count_data, std::vector<bool>(per_col, true), stream, mr);
+    if (dtype != dtype_none) {
+      stats[i].min = make_minmax_column(col.type(), dtype, col_chunks, per_col, true, stream, mr);
+      stats[i].max = make_minmax_column(col.type(), dtype, col_chunks, per_col, false, stream, mr);
+    }
+    stats[i].sum = make_sum_column(dtype, col_chunks, per_col, stream, mr);
+  }
+  return stats;
+}
+
+}  // namespace io
+}  // namespace cudf
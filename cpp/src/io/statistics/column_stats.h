@@ -34,11 +34,17 @@ enum statistics_dtype {
   dtype_string,
 };
 
+// FIXME: Use native libcudf string type
+struct nvstrdesc_s {
+  const char *ptr;  //!< ptr to character data, null for null strings
+  size_t count;     //!< length of string
+};
+
 struct stats_column_desc {
   statistics_dtype stats_dtype;    //!< physical data type of column
   uint32_t num_rows;               //!< number of rows in column
   const uint32_t *valid_map_base;  //!< base of valid bit map for this column (null if not present)
-  const void *column_data_base;    //!< base ptr to column data
+  const void *column_data_base;    //!< base ptr to column data (nvstrdesc_s for strings)
   int32_t ts_scale;  //!< timestamp scale (>0: multiply by scale, <0: divide by -scale)
 };
 
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/chunk_cache.hpp>
+#include <io/utilities/pinned_host_pool.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the cache size requested through the environment, zero by default
+ */
+size_t get_cache_size()
+{
+  auto const env_size = std::getenv("LIBCUDF_CHUNK_CACHE_SIZE");
+  return env_size != nullptr ? std::strtoull(env_size, nullptr, 10) : 0;
+}
+
+/**
+ * @brief Returns whether the environment requests the cached data to be held in host memory
+ */
+bool use_host_memory()
+{
+  auto const env_memory = std::getenv("LIBCUDF_CHUNK_CACHE_MEMORY");
+  return env_memory != nullptr && std::strcmp(env_memory, "host") == 0;
+}
+
+/**
+ * @brief Copy of a range of source data, with an event marking the completion of its last copy.
+ */
+struct cached_range {
+  std::tuple<std::string, size_t, size_t> key;  // Source key, offset and size
+  rmm::device_buffer device_data;
+  std::vector<uint8_t> host_data;
+  cudaEvent_t event{};
+
+  void const *data() const
+  {
+    return host_data.empty() ? device_data.data() : static_cast<void const *>(host_data.data());
+  }
+};
+
+/**
+ * @brief Process-wide cache of source data ranges, in least recently used order.
+ */
+class chunk_cache {
+  using range_list = std::list<std::unique_ptr<cached_range>>;
+
+  size_t byte_limit   = 0;
+  size_t cached_bytes = 0;
+  bool host_memory    = false;
+  rmm::mr::device_memory_resource *upstream = nullptr;
+  range_list ranges;  // Most recently used first
+  std::map<std::tuple<std::string, size_t, size_t>, range_list::iterator> index;
+  std::mutex mutex;
+
+  chunk_cache();
+
+  /**
+   * @brief Removes least recently used ranges until at most `max_bytes` remain cached
+   *
+   * Must be called with the mutex held. The removed ranges are returned so that their memory can
+   * be released once the mutex is unlocked.
+   */
+  std::vector<std::unique_ptr<cached_range>> remove_ranges(size_t max_bytes)
+  {
+    std::vector<std::unique_ptr<cached_range>> removed;
+    while (cached_bytes > max_bytes && !ranges.empty()) {
+      auto range = std::move(ranges.back());
+      ranges.pop_back();
+      index.erase(range->key);
+      cached_bytes -= std::get<2>(range->key);
+      removed.push_back(std::move(range));
+    }
+    return removed;
+  }
+
+  /**
+   * @brief Releases the memory of removed ranges once the copies from them have completed
+   */
+  static void release_ranges(std::vector<std::unique_ptr<cached_range>> &&removed)
+  {
+    for (auto &range : removed) {
+      cudaEventSynchronize(range->event);
+      cudaEventDestroy(range->event);
+    }
+    removed.clear();
+  }
+
+ public:
+  static chunk_cache &instance()
+  {
+    // Never destroyed, since cached device memory can't be freed after the CUDA runtime shutdown
+    static chunk_cache *cache = new chunk_cache;
+    return *cache;
+  }
+
+  bool is_enabled() const { return byte_limit != 0; }
+
+  bool contains(std::tuple<std::string, size_t, size_t> const &key)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.find(key) != index.end();
+  }
+
+  bool read(std::tuple<std::string, size_t, size_t> const &key, void *dst, cudaStream_t stream)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const it = index.find(key);
+    if (it == index.end()) { return false; }
+    ranges.splice(ranges.begin(), ranges, it->second);
+    auto &range = *it->second;
+    if (host_memory) {
+      copy_host_to_device(dst, range->data(), std::get<2>(key), stream);
+    } else {
+      CUDA_TRY(cudaStreamWaitEvent(stream, range->event, 0));
+      CUDA_TRY(
+        cudaMemcpyAsync(dst, range->data(), std::get<2>(key), cudaMemcpyDeviceToDevice, stream));
+    }
+    CUDA_TRY(cudaEventRecord(range->event, stream));
+    return true;
+  }
+
+  void insert(std::tuple<std::string, size_t, size_t> const &key,
+              void const *src,
+              cudaStream_t stream)
+  {
+    auto const size = std::get<2>(key);
+    if (size > byte_limit || contains(key)) { return; }
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      auto removed = remove_ranges(byte_limit - size);
+      lock.unlock();
+      release_ranges(std::move(removed));
+    }
+
+    // Allocate outside of the lock, since a failed device allocation evicts ranges
+    auto range = std::make_unique<cached_range>();
+    range->key = key;
+    try {
+      if (host_memory) {
+        range->host_data.resize(size);
+      } else {
+        range->device_data = rmm::device_buffer(size, stream, upstream);
+      }
+    } catch (std::bad_alloc const &) {
+      return;
+    }
+    CUDA_TRY(cudaEventCreateWithFlags(&range->event, cudaEventDisableTiming));
+    if (host_memory) {
+      copy_device_to_host(range->host_data.data(), src, size, stream);
+    } else {
+      CUDA_TRY(
+        cudaMemcpyAsync(range->device_data.data(), src, size, cudaMemcpyDeviceToDevice, stream));
+    }
+    CUDA_TRY(cudaEventRecord(range->event, stream));
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (index.find(key) != index.end()) {
+      // Cached by another read in the meantime
+      lock.unlock();
+      std::vector<std::unique_ptr<cached_range>> unused;
+      unused.push_back(std::move(range));
+      release_ranges(std::move(unused));
+      return;
+    }
+    ranges.push_front(std::move(range));
+    index.emplace(key, ranges.begin());
+    cached_bytes += size;
+    auto removed = remove_ranges(byte_limit);
+    lock.unlock();
+    release_ranges(std::move(removed));
+  }
+
+  /**
+   * @brief Evicts least recently used ranges to free at least `bytes` of device memory
+   *
+   * @return Whether any range was evicted
+   */
+  bool evict(size_t bytes)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (ranges.empty()) { return false; }
+    auto removed = remove_ranges((cached_bytes > bytes) ? cached_bytes - bytes : 0);
+    lock.unlock();
+    release_ranges(std::move(removed));
+    return true;
+  }
+};
+
+/**
+ * @brief Device memory resource that evicts cached ranges and retries when an allocation fails.
+ */
+class evicting_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit evicting_resource(rmm::mr::device_memory_resource *upstream) : upstream_(upstream) {}
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return upstream_->supports_get_mem_info();
+  }
+
+ private:
+  void *do_allocate(size_t bytes, cudaStream_t stream) override
+  {
+    for (;;) {
+      try {
+        return upstream_->allocate(bytes, stream);
+      } catch (std::bad_alloc const &) {
+        if (!chunk_cache::instance().evict(bytes)) { throw; }
+      }
+    }
+  }
+
+  void do_deallocate(void *p, size_t bytes, cudaStream_t stream) override
+  {
+    upstream_->deallocate(p, bytes, stream);
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return upstream_->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource *upstream_;
+};
+
+chunk_cache::chunk_cache() : byte_limit(get_cache_size()), host_memory(use_host_memory())
+{
+  if (byte_limit != 0 && !host_memory) {
+    // Cached ranges are allocated from the upstream resource, bypassing the eviction
+    upstream = rmm::mr::get_default_resource();
+    rmm::mr::set_default_resource(new evicting_resource(upstream));
+  }
+}
+
+}  // namespace
+
+bool is_range_cached(std::string const &source_key, size_t offset, size_t size)
+{
+  auto &cache = chunk_cache::instance();
+  if (!cache.is_enabled() || source_key.empty()) { return false; }
+  return cache.contains(std::make_tuple(source_key, offset, size));
+}
+
+bool read_cached_range(
+  std::string const &source_key, size_t offset, size_t size, void *dst, cudaStream_t stream)
+{
+  auto &cache = chunk_cache::instance();
+  if (!cache.is_enabled() || source_key.empty()) { return false; }
+  return cache.read(std::make_tuple(source_key, offset, size), dst, stream);
+}
+
+void cache_range(std::string const &source_key,
+                 size_t offset,
+                 size_t size,
+                 void const *src,
+                 cudaStream_t stream)
+{
+  auto &cache = chunk_cache::instance();
+  if (!cache.is_enabled() || source_key.empty() || size == 0) { return; }
+  cache.insert(std::make_tuple(source_key, offset, size), src, stream);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file chunk_cache.hpp
+ * @brief cuDF-IO process-wide cache of the raw column chunk and stripe data read from sources
+ *
+ * Repeated reads of the same files, e.g. with different column selections, copy the cached byte
+ * ranges instead of reading them from the source again. Ranges are keyed by the cache key of
+ * their source (see `datasource::cache_key()`), their offset and their size, and the least
+ * recently used ranges are evicted first.
+ *
+ * The byte budget of the cache is read from the `LIBCUDF_CHUNK_CACHE_SIZE` environment variable
+ * on first use; the default of zero disables the cache. The data is held in device memory, or
+ * in host memory if `LIBCUDF_CHUNK_CACHE_MEMORY` is set to `host`. A device cache wraps the
+ * default RMM resource so that it can free cached ranges when an allocation fails.
+ */
+
+#pragma once
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Returns whether a range of source data is in the cache.
+ *
+ * The range may still be evicted before it is read.
+ *
+ * @param[in] source_key Cache key of the source; empty keys are never cached
+ * @param[in] offset Offset of the range in the source
+ * @param[in] size Size of the range in bytes
+ */
+bool is_range_cached(std::string const &source_key, size_t offset, size_t size);
+
+/**
+ * @brief Copies a range of source data from the cache to device memory.
+ *
+ * @param[in] source_key Cache key of the source; empty keys are never cached
+ * @param[in] offset Offset of the range in the source
+ * @param[in] size Size of the range in bytes
+ * @param[in] dst Device memory destination
+ * @param[in] stream CUDA stream used for the copy
+ *
+ * @return Whether the range was in the cache and has been copied
+ */
+bool read_cached_range(
+  std::string const &source_key, size_t offset, size_t size, void *dst, cudaStream_t stream);
+
+/**
+ * @brief Adds a copy of a range of source data to the cache.
+ *
+ * Does nothing if the cache is disabled, the key is empty or the range is larger than the cache.
+ *
+ * @param[in] source_key Cache key of the source
+ * @param[in] offset Offset of the range in the source
+ * @param[in] size Size of the range in bytes
+ * @param[in] src Device memory holding the range data
+ * @param[in] stream CUDA stream used for the copy, after which `src` holds the data
+ */
+void cache_range(std::string const &source_key,
+                 size_t offset,
+                 size_t size,
+                 void const *src,
+                 cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -22,6 +22,8 @@
 #pragma once
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -29,6 +31,8 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -126,6 +130,86 @@ std::unique_ptr<column> make_column(
   }
 }
 
+/**
+ * @brief Maps the decoded indices into the column chunk dictionaries to the unique keys
+ *
+ * @param indices Decoded indices into the concatenated dictionary entries
+ * @param size Number of rows
+ * @param entry_keys Position in the unique keys of each dictionary entry
+ * @param num_entries Number of dictionary entries
+ * @param output Indices of the rows in the unique keys
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename IndexType>
+void remap_dictionary_indices(int32_t const* indices,
+                              size_type size,
+                              int32_t const* entry_keys,
+                              size_type num_entries,
+                              IndexType* output,
+                              cudaStream_t stream)
+{
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    indices,
+                    indices + size,
+                    output,
+                    [entry_keys, num_entries] __device__(int32_t idx) {
+                      auto const key = (idx >= 0 && idx < num_entries) ? entry_keys[idx] : 0;
+                      return static_cast<IndexType>(key);
+                    });
+}
+
+/**
+ * @brief Creates a DICTIONARY32 column from the decoded data of a string column
+ *
+ * @param size Number of rows
+ * @param buffer Decoded strings, or indices into `keys` if `keys` is not null
+ * @param keys Concatenated string dictionaries of the column chunks or stripes, which may hold
+ * duplicates
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_dictionary_output(
+  size_type size,
+  column_buffer& buffer,
+  const rmm::device_vector<column_buffer::str_pair>* keys,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (keys == nullptr) {
+    auto strings = make_column(data_type{type_id::STRING}, size, buffer, stream);
+    return cudf::dictionary::detail::encode(strings->view(), data_type{type_id::EMPTY}, mr, stream);
+  }
+
+  // Sort and deduplicate the dictionary entries, then map the indices to the unique keys
+  auto entries           = make_strings_column(*keys, stream);
+  auto encoded           = cudf::dictionary::detail::encode(
+    entries->view(), data_type{type_id::INT32}, mr, stream);
+  auto contents          = encoded->release();
+  const auto num_entries = entries->size();
+  const auto entry_keys  = contents.children[0]->view().data<int32_t>();
+  const auto indices     = static_cast<int32_t const*>(buffer._data.data());
+
+  // the mapped indices are written in the narrowest type for the unique keys
+  auto const indices_type = cudf::dictionary::detail::get_indices_type_for_size(
+    contents.children[1]->size());
+  auto indices_column =
+    make_numeric_column(indices_type, size, mask_state::UNALLOCATED, stream, mr);
+  auto output = indices_column->mutable_view();
+  auto remap  = [&](auto d_output) {
+    remap_dictionary_indices(indices, size, entry_keys, num_entries, d_output, stream);
+  };
+  switch (indices_type.id()) {
+    case type_id::UINT8: remap(output.data<uint8_t>()); break;
+    case type_id::UINT16: remap(output.data<uint16_t>()); break;
+    default: remap(output.data<int32_t>()); break;
+  }
+
+  return cudf::make_dictionary_column(std::move(contents.children[1]),
+                                      std::move(indices_column),
+                                      std::move(buffer._null_mask),
+                                      buffer._null_count);
+}
+
 }  // namespace
 
 }  // namespace detail
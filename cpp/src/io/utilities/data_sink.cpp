@@ -14,38 +14,316 @@
  * limitations under the License.
  */
 
-#include <fstream>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace cudf {
 namespace io {
+namespace {
+constexpr size_t sink_buffer_size    = 4 << 20;  // Multiple of the direct I/O alignment
+constexpr size_t sink_buffer_count   = 8;
+constexpr size_t sink_writer_count   = 4;
+constexpr size_t direct_io_alignment = 4096;
+
+/**
+ * @brief Returns whether the user requests file sinks to bypass the page cache
+ */
+bool is_direct_io_enabled()
+{
+  auto const policy = std::getenv("LIBCUDF_FILE_SINK_DIRECT");
+  return policy != nullptr && std::string(policy) == "ON";
+}
+
+/**
+ * @brief Writes the whole buffer at the given file offset
+ *
+ * @return int Zero on success, the error number otherwise
+ */
+int write_fully(int fd, uint8_t const* data, size_t offset, size_t size)
+{
+  while (size != 0) {
+    auto const written = pwrite(fd, data, size, offset);
+    if (written < 0) {
+      if (errno == EINTR) { continue; }
+      return errno;
+    }
+    data += written;
+    offset += written;
+    size -= written;
+  }
+  return 0;
+}
+}  // namespace
+
 /**
  * @brief Implementation class for storing data into a local file.
  *
+ * The data is gathered into a ring of pinned host buffers, and full buffers are written at their
+ * file offsets by background threads while the next ones are filled. Device writes copy straight
+ * into the buffers. With `LIBCUDF_FILE_SINK_DIRECT=ON`, full buffers are written with O_DIRECT
+ * where the file system supports it; the partial tail written on flush goes through the page
+ * cache and is rewritten with the rest of its buffer once filled.
+ *
+ * When GPUDirect Storage is available, device writes transfer the data
+ * directly from device memory into the file through cuFile.
  */
 class file_sink : public data_sink {
+  struct write_buffer {
+    uint8_t* data      = nullptr;
+    size_t file_offset = 0;
+    size_t size        = 0;
+  };
+
  public:
   explicit file_sink(std::string const& filepath)
   {
-    outfile_.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
-    CUDF_EXPECTS(outfile_.is_open(), "Cannot open output file");
+    fd_ = open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    CUDF_EXPECTS(fd_ != -1, "Cannot open output file");
+    if (is_direct_io_enabled()) { direct_fd_ = open(filepath.c_str(), O_WRONLY | O_DIRECT); }
+    cufile_out_ = detail::make_cufile_output(filepath);
+
+    buffers_.resize(sink_buffer_count);
+    for (auto& buffer : buffers_) {
+      // Pinned memory is page-aligned; fall back to aligned pageable memory without a device
+      void* ptr = nullptr;
+      if (cudaMallocHost(&ptr, sink_buffer_size) != cudaSuccess) {
+        cudaGetLastError();
+        is_pinned_ = false;
+        break;
+      }
+      buffer.data = static_cast<uint8_t*>(ptr);
+    }
+    if (!is_pinned_) {
+      for (auto& buffer : buffers_) {
+        if (buffer.data != nullptr) { cudaFreeHost(buffer.data); }
+        void* ptr = nullptr;
+        if (posix_memalign(&ptr, direct_io_alignment, sink_buffer_size) != 0) { ptr = nullptr; }
+        buffer.data = static_cast<uint8_t*>(ptr);
+      }
+    }
+    for (auto& buffer : buffers_) {
+      if (buffer.data == nullptr) {
+        release_resources();
+        CUDF_FAIL("Cannot allocate the output file buffers");
+      }
+      free_buffers_.push_back(&buffer);
+    }
+    for (size_t i = 0; i < sink_writer_count; ++i) {
+      writers_.emplace_back([this]() { write_buffers(); });
+    }
   }
 
-  virtual ~file_sink() { flush(); }
+  virtual ~file_sink()
+  {
+    try {
+      flush();
+    } catch (...) {
+      // Errors are reported by explicit flushes only
+    }
+    release_resources();
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    outfile_.write(reinterpret_cast<char const*>(data), size);
+    auto src = static_cast<uint8_t const*>(data);
+    while (size != 0) {
+      auto const len = reserve(size);
+      std::memcpy(current_->data + current_->size, src, len);
+      commit(len);
+      src += len;
+      size -= len;
+    }
   }
 
-  void flush() override { outfile_.flush(); }
+  bool supports_device_write() const override { return true; }
 
-  size_t bytes_written() override { return outfile_.tellp(); }
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override
+  {
+    if (cufile_out_ != nullptr) {
+      // Preceding host writes must reach the file first, and the device data must be ready
+      flush();
+      release_current();
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      cufile_out_->write(gpu_data, bytes_written_, size);
+      bytes_written_ += size;
+      return;
+    }
+    // Each transfer overlaps with the background writes of the previously filled buffers
+    auto src = static_cast<uint8_t const*>(gpu_data);
+    while (size != 0) {
+      auto const len = reserve(size);
+      CUDA_TRY(cudaMemcpyAsync(
+        current_->data + current_->size, src, len, cudaMemcpyDeviceToHost, stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      commit(len);
+      src += len;
+      size -= len;
+    }
+  }
+
+  /**
+   * @brief Waits until all the data written so far has reached the file.
+   *
+   * The partially filled buffer is written as well, but kept for the following writes.
+   */
+  void flush() override
+  {
+    if (current_ != nullptr && current_->size != 0) {
+      CUDF_EXPECTS(write_to_file(*current_) == 0, "Cannot write to output file");
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    buffer_written_.wait(lock,
+                         [&]() { return pending_buffers_.empty() && writes_in_flight_ == 0; });
+    CUDF_EXPECTS(write_error_ == 0, "Cannot write to output file");
+  }
+
+  size_t bytes_written() override { return bytes_written_; }
 
  private:
-  std::ofstream outfile_;
+  /**
+   * @brief Makes a buffer current if needed and returns how many of `size` bytes fit into it
+   */
+  size_t reserve(size_t size)
+  {
+    if (current_ == nullptr) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      buffer_written_.wait(lock, [&]() { return !free_buffers_.empty() || write_error_ != 0; });
+      CUDF_EXPECTS(write_error_ == 0, "Cannot write to output file");
+      current_ = free_buffers_.front();
+      free_buffers_.pop_front();
+      current_->file_offset = bytes_written_;
+      current_->size        = 0;
+    }
+    return std::min(size, sink_buffer_size - current_->size);
+  }
+
+  /**
+   * @brief Appends `size` bytes copied to the end of the current buffer, queueing it once full
+   */
+  void commit(size_t size)
+  {
+    current_->size += size;
+    bytes_written_ += size;
+    if (current_->size == sink_buffer_size) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_buffers_.push_back(current_);
+      }
+      current_ = nullptr;
+      buffer_ready_.notify_one();
+    }
+  }
+
+  /**
+   * @brief Returns the current buffer to the free list; its data must already be in the file
+   */
+  void release_current()
+  {
+    if (current_ == nullptr) { return; }
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_buffers_.push_back(current_);
+    current_ = nullptr;
+  }
+
+  /**
+   * @brief Writes a buffer at its file offset, with direct I/O if it is suitably aligned
+   *
+   * @return int Zero on success, the error number otherwise
+   */
+  int write_to_file(write_buffer const& buffer) const
+  {
+    auto const is_aligned = buffer.file_offset % direct_io_alignment == 0 &&
+                            buffer.size % direct_io_alignment == 0;
+    if (direct_fd_ != -1 && is_aligned) {
+      auto const error = write_fully(direct_fd_, buffer.data, buffer.file_offset, buffer.size);
+      // Some file systems only reject direct I/O on the first write
+      if (error != EINVAL) { return error; }
+    }
+    return write_fully(fd_, buffer.data, buffer.file_offset, buffer.size);
+  }
+
+  /**
+   * @brief Background thread loop, writing queued buffers until the sink is destroyed
+   */
+  void write_buffers()
+  {
+    for (;;) {
+      write_buffer* buffer = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        buffer_ready_.wait(lock, [&]() { return stop_ || !pending_buffers_.empty(); });
+        if (pending_buffers_.empty()) { return; }
+        buffer = pending_buffers_.front();
+        pending_buffers_.pop_front();
+        writes_in_flight_++;
+      }
+      auto const error = write_to_file(*buffer);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (write_error_ == 0) { write_error_ = error; }
+        free_buffers_.push_back(buffer);
+        writes_in_flight_--;
+      }
+      buffer_written_.notify_all();
+    }
+  }
+
+  void release_resources()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    buffer_ready_.notify_all();
+    for (auto& writer : writers_) { writer.join(); }
+    for (auto& buffer : buffers_) {
+      if (buffer.data == nullptr) { continue; }
+      if (is_pinned_) {
+        cudaFreeHost(buffer.data);
+      } else {
+        free(buffer.data);
+      }
+    }
+    if (direct_fd_ != -1) { close(direct_fd_); }
+    close(fd_);
+  }
+
+  int fd_               = -1;
+  int direct_fd_        = -1;
+  bool is_pinned_       = true;
+  size_t bytes_written_ = 0;
+  std::unique_ptr<detail::cufile_output> cufile_out_;
+
+  std::vector<write_buffer> buffers_;
+  write_buffer* current_ = nullptr;  // Buffer being filled, owned by the writing thread
+  std::deque<write_buffer*> free_buffers_;
+  std::deque<write_buffer*> pending_buffers_;
+  size_t writes_in_flight_ = 0;
+  int write_error_         = 0;
+  bool stop_               = false;
+  std::vector<std::thread> writers_;
+  std::mutex mutex_;
+  std::condition_variable buffer_ready_;    // Signals pending buffers and the shutdown
+  std::condition_variable buffer_written_;  // Signals written and released buffers
 };
 
 /**
@@ -72,6 +350,107 @@ class host_buffer_sink : public data_sink {
   std::vector<char>* buffer_;
 };
 
+/**
+ * @brief Implementation class for storing data into preallocated host memory.
+ */
+class fixed_host_buffer_sink : public data_sink {
+ public:
+  explicit fixed_host_buffer_sink(void* buffer, size_t size)
+    : buffer_(static_cast<uint8_t*>(buffer)), size_(size)
+  {
+  }
+
+  virtual ~fixed_host_buffer_sink() {}
+
+  void host_write(void const* data, size_t size) override
+  {
+    std::memcpy(reserve(size), data, size);
+  }
+
+  bool supports_device_write() const override { return true; }
+
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override
+  {
+    auto const dst = reserve(size);
+    CUDA_TRY(cudaMemcpyAsync(dst, gpu_data, size, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  void flush() override {}
+
+  size_t bytes_written() override { return bytes_written_; }
+
+ private:
+  /**
+   * @brief Returns the address of the next `size` bytes and counts them as written
+   */
+  uint8_t* reserve(size_t size)
+  {
+    CUDF_EXPECTS(size <= size_ - bytes_written_, "Output buffer is too small");
+    auto const dst = buffer_ + bytes_written_;
+    bytes_written_ += size;
+    return dst;
+  }
+
+  uint8_t* const buffer_;
+  size_t const size_;
+  size_t bytes_written_ = 0;
+};
+
+/**
+ * @brief Implementation class for storing data into a device buffer.
+ *
+ * The buffer capacity grows geometrically, while its size always matches the data written.
+ */
+class device_buffer_sink : public data_sink {
+ public:
+  explicit device_buffer_sink(rmm::device_buffer* buffer) : buffer_(buffer) {}
+
+  virtual ~device_buffer_sink() {}
+
+  void host_write(void const* data, size_t size) override
+  {
+    auto const dst = reserve(size);
+    CUDA_TRY(cudaMemcpyAsync(dst, data, size, cudaMemcpyHostToDevice, stream_));
+    CUDA_TRY(cudaStreamSynchronize(stream_));
+  }
+
+  bool supports_device_write() const override { return true; }
+
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override
+  {
+    stream_        = stream;
+    auto const dst = reserve(size);
+    CUDA_TRY(cudaMemcpyAsync(dst, gpu_data, size, cudaMemcpyDeviceToDevice, stream_));
+  }
+
+  void flush() override { CUDA_TRY(cudaStreamSynchronize(stream_)); }
+
+  size_t bytes_written() override { return buffer_->size(); }
+
+ private:
+  /**
+   * @brief Appends `size` uninitialized bytes to the buffer and returns their address
+   */
+  uint8_t* reserve(size_t size)
+  {
+    auto const offset = buffer_->size();
+    if (offset + size > buffer_->capacity()) {
+      rmm::device_buffer grown(std::max(offset + size, 2 * buffer_->capacity()), stream_);
+      CUDA_TRY(cudaMemcpyAsync(
+        grown.data(), buffer_->data(), offset, cudaMemcpyDeviceToDevice, stream_));
+      // The previous allocation must not be reused before the copy from it completes
+      CUDA_TRY(cudaStreamSynchronize(stream_));
+      *buffer_ = std::move(grown);
+    }
+    buffer_->resize(offset + size);
+    return static_cast<uint8_t*>(buffer_->data()) + offset;
+  }
+
+  rmm::device_buffer* buffer_;
+  cudaStream_t stream_ = 0;
+};
+
 /**
  * @brief Implementation class for voiding data (no io performed)
  *
@@ -134,6 +513,16 @@ std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
   return std::make_unique<host_buffer_sink>(buffer);
 }
 
+std::unique_ptr<data_sink> data_sink::create(rmm::device_buffer* buffer)
+{
+  return std::make_unique<device_buffer_sink>(buffer);
+}
+
+std::unique_ptr<data_sink> data_sink::create(void* buffer, size_t size)
+{
+  return std::make_unique<fixed_host_buffer_sink>(buffer, size);
+}
+
 std::unique_ptr<data_sink> data_sink::create() { return std::make_unique<void_sink>(); }
 
 std::unique_ptr<data_sink> data_sink::create(cudf::io::data_sink* const user_sink)
@@ -22,6 +22,9 @@
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
 
 namespace cudf {
 namespace io {
@@ -76,6 +79,9 @@ class arrow_io_source : public datasource {
  *
  * Unlike Arrow's memory mapped IO class, this implementation allows memory
  * mapping a subset of the file where the starting offset may not be zero.
+ *
+ * When GPUDirect Storage is available, device reads transfer the file data
+ * directly into device memory through cuFile.
  */
 class memory_mapped_source : public datasource {
   struct file_wrapper {
@@ -94,8 +100,18 @@ class memory_mapped_source : public datasource {
     const uint8_t *data() const override { return _data; }
   };
 
+  class device_buffer : public buffer {
+    rmm::device_buffer _buffer;
+
+   public:
+    explicit device_buffer(rmm::device_buffer &&buffer) : _buffer(std::move(buffer)) {}
+    size_t size() const override { return _buffer.size(); }
+    const uint8_t *data() const override { return static_cast<const uint8_t *>(_buffer.data()); }
+  };
+
  public:
   explicit memory_mapped_source(const char *filepath, size_t offset, size_t size)
+    : cufile_in_(detail::make_cufile_input(filepath))
   {
     auto const file = file_wrapper(filepath);
     CUDF_EXPECTS(file.fd != -1, "Cannot open file");
@@ -104,6 +120,11 @@ class memory_mapped_source : public datasource {
     CUDF_EXPECTS(fstat(file.fd, &st) != -1, "Cannot query file size");
     file_size_ = static_cast<size_t>(st.st_size);
 
+    // The file identity and modification time change whenever the cached contents would be stale
+    cache_key_ = std::string(filepath) + ':' + std::to_string(st.st_dev) + ':' +
+                 std::to_string(st.st_ino) + ':' + std::to_string(st.st_size) + ':' +
+                 std::to_string(st.st_mtim.tv_sec) + '.' + std::to_string(st.st_mtim.tv_nsec);
+
     if (file_size_ != 0) { map(file.fd, offset, size); }
   }
 
@@ -135,8 +156,49 @@ class memory_mapped_source : public datasource {
     return read_size;
   }
 
+  std::future<std::unique_ptr<buffer>> host_read_async(size_t offset, size_t size) override
+  {
+    // Mapped reads don't copy any data; the pages are loaded when the buffer is accessed
+    std::promise<std::unique_ptr<buffer>> read;
+    read.set_value(host_read(offset, size));
+    return read.get_future();
+  }
+
+  void prefetch(size_t offset, size_t size) override
+  {
+    if (offset < map_offset_ || offset - map_offset_ >= map_size_) { return; }
+
+    // Address for `madvise()` must be page aligned
+    auto const page_offset = (offset - map_offset_) & ~(sysconf(_SC_PAGESIZE) - 1);
+    auto const end_offset  = std::min(map_size_, offset - map_offset_ + size);
+    madvise(static_cast<uint8_t *>(map_addr_) + page_offset,
+            end_offset - page_offset,
+            MADV_WILLNEED);
+  }
+
+  bool supports_device_read() const override { return cufile_in_ != nullptr; }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    rmm::device_buffer out_data(std::min(size, file_size_ - std::min(offset, file_size_)));
+    out_data.resize(device_read(offset, out_data.size(), static_cast<uint8_t *>(out_data.data())));
+    return std::make_unique<device_buffer>(std::move(out_data));
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    CUDF_EXPECTS(supports_device_read(), "Device reads are not supported for this file");
+    CUDF_EXPECTS(offset <= file_size_, "Requested offset is past end of file");
+
+    // Clamp length to available data in the file
+    auto const read_size = std::min(size, file_size_ - offset);
+    return cufile_in_->read(offset, read_size, dst);
+  }
+
   size_t size() const override { return file_size_; }
 
+  std::string cache_key() const override { return cache_key_; }
+
  private:
   void map(int fd, size_t offset, size_t size)
   {
@@ -167,6 +229,92 @@ class memory_mapped_source : public datasource {
   void *map_addr_    = nullptr;
   size_t map_size_   = 0;
   size_t map_offset_ = 0;
+  std::string cache_key_;
+  std::unique_ptr<detail::cufile_input> cufile_in_;
+};
+
+/**
+ * @brief Implementation class for reading from host memory without copies.
+ *
+ * Host reads return views of the memory, and device reads transfer straight from it into
+ * device memory, which is fastest when the host memory is pinned.
+ */
+class host_buffer_source : public datasource {
+  class non_owning_buffer : public buffer {
+    uint8_t const *_data = nullptr;
+    size_t _size         = 0;
+
+   public:
+    non_owning_buffer(uint8_t const *data, size_t size) : _data(data), _size(size) {}
+    size_t size() const override { return _size; }
+    const uint8_t *data() const override { return _data; }
+  };
+
+  class device_buffer : public buffer {
+    rmm::device_buffer _buffer;
+
+   public:
+    explicit device_buffer(rmm::device_buffer &&buffer) : _buffer(std::move(buffer)) {}
+    size_t size() const override { return _buffer.size(); }
+    const uint8_t *data() const override { return static_cast<const uint8_t *>(_buffer.data()); }
+  };
+
+ public:
+  host_buffer_source(const char *data, size_t size)
+    : data_(reinterpret_cast<uint8_t const *>(data)), size_(size)
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = clamp(offset, size);
+    return std::make_unique<non_owning_buffer>(data_ + offset, read_size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    auto const read_size = clamp(offset, size);
+    std::memcpy(dst, data_ + offset, read_size);
+    return read_size;
+  }
+
+  std::future<std::unique_ptr<buffer>> host_read_async(size_t offset, size_t size) override
+  {
+    std::promise<std::unique_ptr<buffer>> read;
+    read.set_value(host_read(offset, size));
+    return read.get_future();
+  }
+
+  bool supports_device_read() const override { return true; }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    rmm::device_buffer out_data(clamp(offset, size));
+    device_read(offset, out_data.size(), static_cast<uint8_t *>(out_data.data()));
+    return std::make_unique<device_buffer>(std::move(out_data));
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    auto const read_size = clamp(offset, size);
+    CUDA_TRY(cudaMemcpy(dst, data_ + offset, read_size, cudaMemcpyHostToDevice));
+    return read_size;
+  }
+
+  size_t size() const override { return size_; }
+
+ private:
+  /**
+   * @brief Returns the number of bytes of a read that are within the memory
+   */
+  size_t clamp(size_t offset, size_t size) const
+  {
+    CUDF_EXPECTS(offset <= size_, "Requested offset is past end of buffer");
+    return std::min(size, size_ - offset);
+  }
+
+  uint8_t const *const data_;
+  size_t const size_;
 };
 
 /**
@@ -190,6 +338,13 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  std::future<std::unique_ptr<buffer>> host_read_async(size_t offset, size_t size) override
+  {
+    return source->host_read_async(offset, size);
+  }
+
+  void prefetch(size_t offset, size_t size) override { source->prefetch(offset, size); }
+
   bool supports_device_read() const override { return source->supports_device_read(); }
 
   size_t device_read(size_t offset, size_t size, uint8_t *dst) override
@@ -204,6 +359,8 @@ class user_datasource_wrapper : public datasource {
 
   size_t size() const override { return source->size(); }
 
+  std::string cache_key() const override { return source->cache_key(); }
+
  private:
   datasource *const source;  ///< A non-owning pointer to the user-implemented datasource
 };
@@ -218,9 +375,7 @@ std::unique_ptr<datasource> datasource::create(const std::string &filepath,
 
 std::unique_ptr<datasource> datasource::create(const char *data, size_t size)
 {
-  // Use Arrow IO buffer class for zero-copy reads of host memory
-  return std::make_unique<arrow_io_source>(
-    std::make_shared<arrow::io::BufferReader>(reinterpret_cast<const uint8_t *>(data), size));
+  return std::make_unique<host_buffer_source>(data, size);
 }
 
 std::unique_ptr<datasource> datasource::create(std::shared_ptr<arrow::io::RandomAccessFile> file)
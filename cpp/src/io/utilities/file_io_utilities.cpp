@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#ifdef CUFILE_FOUND
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cufile.h>
+
+#include <cstdlib>
+#endif
+
+namespace cudf {
+namespace io {
+namespace detail {
+#ifdef CUFILE_FOUND
+namespace {
+/**
+ * @brief Returns whether the user allows cuFile to be used
+ */
+bool is_cufile_enabled()
+{
+  auto const policy = std::getenv("LIBCUDF_CUFILE_POLICY");
+  return policy == nullptr || std::string(policy) != "OFF";
+}
+
+/**
+ * @brief Opens the cuFile driver on first use and closes it at exit.
+ */
+class cufile_driver {
+  bool is_open = false;
+
+  cufile_driver() { is_open = (cuFileDriverOpen().err == CU_FILE_SUCCESS); }
+
+ public:
+  ~cufile_driver()
+  {
+    if (is_open) { cuFileDriverClose(); }
+  }
+
+  static bool is_available()
+  {
+    static cufile_driver driver;
+    return driver.is_open;
+  }
+};
+
+/**
+ * @brief File descriptor registered with the cuFile driver.
+ */
+class cufile_file {
+  int fd = -1;
+  CUfileHandle_t handle{};
+
+ public:
+  cufile_file(std::string const &filepath, int flags)
+  {
+    // Direct IO bypasses the page cache; cuFile falls back to buffered IO if it's not supported
+    fd = open(filepath.c_str(), flags | O_DIRECT);
+    if (fd == -1) { fd = open(filepath.c_str(), flags); }
+    CUDF_EXPECTS(fd != -1, "Cannot open file");
+
+    CUfileDescr_t desc{};
+    desc.handle.fd = fd;
+    desc.type      = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    if (cuFileHandleRegister(&handle, &desc).err != CU_FILE_SUCCESS) {
+      close(fd);
+      CUDF_FAIL("Cannot register file handle with cuFile");
+    }
+  }
+
+  ~cufile_file()
+  {
+    cuFileHandleDeregister(handle);
+    close(fd);
+  }
+
+  CUfileHandle_t get() const { return handle; }
+};
+
+class cufile_input_impl : public cufile_input {
+ public:
+  explicit cufile_input_impl(std::string const &filepath) : file(filepath, O_RDONLY) {}
+
+  size_t read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    auto const bytes_read = cuFileRead(file.get(), dst, size, offset, 0);
+    CUDF_EXPECTS(bytes_read >= 0, "cuFile error reading from a file");
+    return bytes_read;
+  }
+
+ private:
+  cufile_file const file;
+};
+
+class cufile_output_impl : public cufile_output {
+ public:
+  explicit cufile_output_impl(std::string const &filepath) : file(filepath, O_WRONLY) {}
+
+  void write(void const *data, size_t offset, size_t size) override
+  {
+    CUDF_EXPECTS(cuFileWrite(file.get(), data, size, offset, 0) == static_cast<ssize_t>(size),
+                 "cuFile error writing to a file");
+  }
+
+ private:
+  cufile_file const file;
+};
+}  // namespace
+#endif
+
+std::unique_ptr<cufile_input> make_cufile_input(std::string const &filepath)
+{
+#ifdef CUFILE_FOUND
+  if (is_cufile_enabled() && cufile_driver::is_available()) {
+    try {
+      return std::make_unique<cufile_input_impl>(filepath);
+    } catch (cudf::logic_error const &) {
+      // Not supported for this file; use host reads
+    }
+  }
+#endif
+  return nullptr;
+}
+
+std::unique_ptr<cufile_output> make_cufile_output(std::string const &filepath)
+{
+#ifdef CUFILE_FOUND
+  if (is_cufile_enabled() && cufile_driver::is_available()) {
+    try {
+      return std::make_unique<cufile_output_impl>(filepath);
+    } catch (cudf::logic_error const &) {
+      // Not supported for this file; use host writes
+    }
+  }
+#endif
+  return nullptr;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file file_io_utilities.hpp
+ * @brief cuDF-IO utilities for direct file transfers between storage and device memory
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Interface class for reading file data directly into device memory.
+ */
+class cufile_input {
+ public:
+  virtual ~cufile_input() {}
+
+  /**
+   * @brief Reads a selected range of the file into a preallocated device buffer.
+   *
+   * @param[in] offset Bytes from the start of the file
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   *
+   * @return The number of bytes read
+   */
+  virtual size_t read(size_t offset, size_t size, uint8_t *dst) = 0;
+};
+
+/**
+ * @brief Interface class for writing device memory directly into a file.
+ */
+class cufile_output {
+ public:
+  virtual ~cufile_output() {}
+
+  /**
+   * @brief Writes device memory to a selected location of the file.
+   *
+   * @param[in] data Address of the device memory to write
+   * @param[in] offset Bytes from the start of the file
+   * @param[in] size Bytes to write
+   */
+  virtual void write(void const *data, size_t offset, size_t size) = 0;
+};
+
+/**
+ * @brief Opens a file for direct reads into device memory through cuFile (GPUDirect Storage).
+ *
+ * cuFile is not used if libcudf was built without it, if the cuFile driver cannot be opened, or
+ * if the `LIBCUDF_CUFILE_POLICY` environment variable is set to `OFF`.
+ *
+ * @param[in] filepath Path to the file to read
+ *
+ * @return The file reader, or nullptr if cuFile cannot be used
+ */
+std::unique_ptr<cufile_input> make_cufile_input(std::string const &filepath);
+
+/**
+ * @brief Opens a file for direct writes from device memory through cuFile (GPUDirect Storage).
+ *
+ * The file must already exist; its content is not truncated. cuFile is used under the same
+ * conditions as for `make_cufile_input`.
+ *
+ * @param[in] filepath Path to the file to write
+ *
+ * @return The file writer, or nullptr if cuFile cannot be used
+ */
+std::unique_ptr<cufile_output> make_cufile_output(std::string const &filepath);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/io/types.hpp>
 
@@ -159,6 +160,10 @@ parse_numeric(const char* data, long start, long end, ParseOptions const& opts)
 
   // Handle the whole part of the number
   long index = start;
+  // The leading digits of integers are parsed eight at a time
+  if (base == 10 && std::is_integral<T>::value && !std::is_same<T, bool>::value) {
+    index = cudf::detail::parse_digits(data + index, data + end + 1, value) - data;
+  }
   while (index <= end) {
     if (data[index] == opts.decimal) {
       ++index;
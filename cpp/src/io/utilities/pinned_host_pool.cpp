@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/pinned_host_pool.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+constexpr size_t default_pool_size = 64 << 20;
+constexpr size_t max_block_size    = 4 << 20;
+
+/**
+ * @brief Returns the pool size requested through the environment, or the default size
+ */
+size_t get_pool_size()
+{
+  auto const env_size = std::getenv("LIBCUDF_PINNED_POOL_SIZE");
+  return env_size != nullptr ? std::strtoull(env_size, nullptr, 10) : default_pool_size;
+}
+
+/**
+ * @brief Returns whether the host memory is page-locked
+ */
+bool is_pinned(void const *ptr)
+{
+  cudaPointerAttributes attrib{};
+  if (cudaPointerGetAttributes(&attrib, ptr) != cudaSuccess) {
+    // Pageable memory is not known to the runtime on older CUDA versions; clear the error
+    cudaGetLastError();
+    return false;
+  }
+  return attrib.type == cudaMemoryTypeHost;
+}
+
+/**
+ * @brief Block of pinned host memory with an event marking the completion of its last transfer.
+ */
+struct pinned_block {
+  uint8_t *data = nullptr;
+  cudaEvent_t event{};
+};
+
+/**
+ * @brief Process-wide pool of pinned host memory blocks.
+ *
+ * Blocks are allocated on demand, up to the configured pool size, and reused in the order they
+ * were released so that the oldest transfers are the most likely to have completed.
+ */
+class pinned_host_pool {
+  size_t block_size = 0;
+  size_t max_blocks = 0;
+  std::vector<pinned_block *> blocks;
+  std::deque<pinned_block *> free_blocks;
+  std::mutex mutex;
+  std::condition_variable block_released;
+
+  pinned_host_pool()
+  {
+    auto const pool_size = get_pool_size();
+    block_size           = std::min(pool_size, max_block_size);
+    max_blocks           = (block_size != 0) ? pool_size / block_size : 0;
+  }
+
+  /**
+   * @brief Allocates a new block; returns nullptr if pinned memory cannot be allocated
+   */
+  pinned_block *allocate_block()
+  {
+    auto block = new pinned_block;
+    if (cudaMallocHost(&block->data, block_size) != cudaSuccess) {
+      cudaGetLastError();
+      delete block;
+      // Do not retry with a smaller pool
+      max_blocks = blocks.size();
+      return nullptr;
+    }
+    auto const error = cudaEventCreateWithFlags(&block->event, cudaEventDisableTiming);
+    if (error != cudaSuccess) {
+      cudaFreeHost(block->data);
+      delete block;
+      CUDA_TRY(error);
+    }
+    blocks.push_back(block);
+    return block;
+  }
+
+  /**
+   * @brief Returns a free block, or nullptr if none is free and no block can be allocated
+   *
+   * Must be called with the mutex held.
+   */
+  pinned_block *try_pop_block()
+  {
+    if (!free_blocks.empty()) {
+      auto block = free_blocks.front();
+      free_blocks.pop_front();
+      return block;
+    }
+    if (blocks.size() < max_blocks) { return allocate_block(); }
+    return nullptr;
+  }
+
+ public:
+  ~pinned_host_pool()
+  {
+    // The CUDA context may already be destroyed at exit; ignore any errors
+    for (auto block : blocks) {
+      cudaEventDestroy(block->event);
+      cudaFreeHost(block->data);
+      delete block;
+    }
+  }
+
+  static pinned_host_pool &instance()
+  {
+    static pinned_host_pool pool;
+    return pool;
+  }
+
+  size_t get_block_size() const { return block_size; }
+
+  /**
+   * @brief Returns whether any block is available to the pool
+   */
+  bool is_enabled()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return max_blocks != 0;
+  }
+
+  /**
+   * @brief Returns a block whose previous transfer has completed, waiting for a block to be
+   * released if all are in use
+   *
+   * Returns nullptr if the pool has no blocks at all.
+   */
+  pinned_block *acquire()
+  {
+    pinned_block *block = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      block_released.wait(lock, [&] {
+        block = try_pop_block();
+        return block != nullptr || blocks.empty();
+      });
+    }
+    if (block != nullptr) { CUDA_TRY(cudaEventSynchronize(block->event)); }
+    return block;
+  }
+
+  /**
+   * @brief Returns a block whose previous transfer has completed, or nullptr if all are in use
+   */
+  pinned_block *try_acquire()
+  {
+    pinned_block *block = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      block = try_pop_block();
+    }
+    if (block != nullptr) { CUDA_TRY(cudaEventSynchronize(block->event)); }
+    return block;
+  }
+
+  /**
+   * @brief Returns a block to the pool; pending transfers must be recorded in its event
+   */
+  void release(pinned_block *block)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      free_blocks.push_back(block);
+    }
+    block_released.notify_one();
+  }
+};
+
+}  // namespace
+
+void copy_host_to_device(void *dst, void const *src, size_t size, cudaStream_t stream)
+{
+  if (size == 0) { return; }
+
+  auto &pool = pinned_host_pool::instance();
+  if (!pool.is_enabled() || is_pinned(src)) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyHostToDevice, stream));
+    return;
+  }
+
+  auto const block_size = pool.get_block_size();
+  auto d_dst            = static_cast<uint8_t *>(dst);
+  auto h_src            = static_cast<uint8_t const *>(src);
+  for (size_t offset = 0; offset < size; offset += block_size) {
+    auto const len = std::min(block_size, size - offset);
+    auto block     = pool.acquire();
+    if (block == nullptr) {
+      // No pinned memory could be allocated; copy the remaining data directly
+      CUDA_TRY(cudaMemcpyAsync(
+        d_dst + offset, h_src + offset, size - offset, cudaMemcpyHostToDevice, stream));
+      return;
+    }
+    memcpy(block->data, h_src + offset, len);
+    auto const error =
+      cudaMemcpyAsync(d_dst + offset, block->data, len, cudaMemcpyHostToDevice, stream);
+    if (error == cudaSuccess) { cudaEventRecord(block->event, stream); }
+    pool.release(block);
+    CUDA_TRY(error);
+  }
+}
+
+rmm::device_buffer upload_to_device(void const *src,
+                                    size_t size,
+                                    cudaStream_t stream,
+                                    rmm::mr::device_memory_resource *mr)
+{
+  rmm::device_buffer buffer(size, stream, mr);
+  copy_host_to_device(buffer.data(), src, size, stream);
+  return buffer;
+}
+
+void stage_device_to_host(void const *src,
+                          size_t size,
+                          cudaStream_t stream,
+                          std::function<void(uint8_t const *, size_t)> const &consume)
+{
+  if (size == 0) { return; }
+
+  auto &pool = pinned_host_pool::instance();
+  if (!pool.is_enabled()) {
+    std::vector<uint8_t> h_data(size);
+    CUDA_TRY(cudaMemcpyAsync(h_data.data(), src, size, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    consume(h_data.data(), size);
+    return;
+  }
+
+  struct staged_block {
+    pinned_block *block;
+    size_t len;
+  };
+  std::deque<staged_block> in_flight;
+  auto release_all = [&]() {
+    cudaStreamSynchronize(stream);
+    for (auto &staged : in_flight) { pool.release(staged.block); }
+    in_flight.clear();
+  };
+
+  auto const block_size = pool.get_block_size();
+  auto d_src            = static_cast<uint8_t const *>(src);
+  size_t offset         = 0;
+  try {
+    while (offset < size || !in_flight.empty()) {
+      // Keep as many transfers in flight as there are free blocks; only wait for a block when
+      // there is nothing else to do, so that callers holding blocks cannot deadlock each other
+      while (offset < size) {
+        auto block = in_flight.empty() ? pool.acquire() : pool.try_acquire();
+        if (block == nullptr) { break; }
+        auto const len = std::min(block_size, size - offset);
+        in_flight.push_back({block, len});
+        CUDA_TRY(
+          cudaMemcpyAsync(block->data, d_src + offset, len, cudaMemcpyDeviceToHost, stream));
+        CUDA_TRY(cudaEventRecord(block->event, stream));
+        offset += len;
+      }
+      if (in_flight.empty()) {
+        // No pinned memory could be allocated; transfer the remaining data through pageable memory
+        std::vector<uint8_t> h_data(size - offset);
+        CUDA_TRY(cudaMemcpyAsync(
+          h_data.data(), d_src + offset, h_data.size(), cudaMemcpyDeviceToHost, stream));
+        CUDA_TRY(cudaStreamSynchronize(stream));
+        consume(h_data.data(), h_data.size());
+        return;
+      }
+
+      auto const staged = in_flight.front();
+      CUDA_TRY(cudaEventSynchronize(staged.block->event));
+      consume(staged.block->data, staged.len);
+      in_flight.pop_front();
+      pool.release(staged.block);
+    }
+  } catch (...) {
+    release_all();
+    throw;
+  }
+}
+
+void copy_device_to_host(void *dst, void const *src, size_t size, cudaStream_t stream)
+{
+  if (size == 0) { return; }
+
+  if (is_pinned(dst)) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    return;
+  }
+
+  auto h_dst = static_cast<uint8_t *>(dst);
+  stage_device_to_host(src, size, stream, [&](uint8_t const *data, size_t len) {
+    memcpy(h_dst, data, len);
+    h_dst += len;
+  });
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
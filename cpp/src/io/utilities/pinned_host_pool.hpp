@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file pinned_host_pool.hpp
+ * @brief cuDF-IO utilities for staging host/device transfers through pinned host memory
+ *
+ * Transfers from pageable host memory run at a fraction of the PCIe bandwidth. These utilities
+ * copy the data in blocks through a process-wide pool of pinned host buffers instead, overlapping
+ * the host-side copies with the asynchronous transfers of the previous blocks.
+ *
+ * The total size of the pool is read from the `LIBCUDF_PINNED_POOL_SIZE` environment variable,
+ * in bytes, on first use; the default is 64MB. A size of zero disables the staging.
+ */
+
+#pragma once
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Copies host memory to device memory through the pinned buffer pool.
+ *
+ * Pageable source memory can be released once the function returns, while the transfers may still
+ * be in progress on `stream`. Pinned source memory is copied directly and must remain valid until
+ * the transfers complete.
+ *
+ * @param[in] dst Device memory destination
+ * @param[in] src Host memory source
+ * @param[in] size Bytes to copy
+ * @param[in] stream CUDA stream used for the transfers
+ */
+void copy_host_to_device(void *dst, void const *src, size_t size, cudaStream_t stream);
+
+/**
+ * @brief Creates a device buffer holding a copy of host memory, staged through the pinned buffer
+ * pool.
+ *
+ * @param[in] src Host memory source
+ * @param[in] size Bytes to copy
+ * @param[in] stream CUDA stream used for the allocation and the transfers
+ * @param[in] mr Device memory resource used to allocate the returned buffer
+ *
+ * @return The device buffer
+ */
+rmm::device_buffer upload_to_device(
+  void const *src,
+  size_t size,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Transfers device memory to the host in blocks of pinned memory, passing each block to a
+ * consumer once its transfer completes.
+ *
+ * The next blocks are transferred while the consumer processes the current one, so that e.g. a
+ * data sink can write the data without an intermediate host copy.
+ *
+ * @param[in] src Device memory source
+ * @param[in] size Bytes to transfer
+ * @param[in] stream CUDA stream used for the transfers
+ * @param[in] consume Function called in order with the host address and size of each block
+ */
+void stage_device_to_host(void const *src,
+                          size_t size,
+                          cudaStream_t stream,
+                          std::function<void(uint8_t const *, size_t)> const &consume);
+
+/**
+ * @brief Copies device memory to host memory through the pinned buffer pool.
+ *
+ * The copy is complete when the function returns.
+ *
+ * @param[in] dst Host memory destination
+ * @param[in] src Device memory source
+ * @param[in] size Bytes to copy
+ * @param[in] stream CUDA stream used for the transfers
+ */
+void copy_device_to_host(void *dst, void const *src, size_t size, cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
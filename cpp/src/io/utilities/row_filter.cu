@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/row_filter.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Functor for converting a filter literal to a scalar of the literal's type
+ */
+struct literal_to_scalar {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()> * = nullptr>
+  std::unique_ptr<scalar> operator()(filter_literal const &literal, cudaStream_t stream)
+  {
+    const T value = std::is_floating_point<T>::value ? static_cast<T>(literal.float_value)
+                                                     : static_cast<T>(literal.int_value);
+    return std::make_unique<numeric_scalar<T>>(value, true, stream);
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_timestamp<T>()> * = nullptr>
+  std::unique_ptr<scalar> operator()(filter_literal const &literal, cudaStream_t stream)
+  {
+    return std::make_unique<timestamp_scalar<T>>(
+      static_cast<typename T::rep>(literal.int_value), true, stream);
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::string_view>::value> * = nullptr>
+  std::unique_ptr<scalar> operator()(filter_literal const &literal, cudaStream_t stream)
+  {
+    return std::make_unique<string_scalar>(literal.string_value, true, stream);
+  }
+
+  template <typename T,
+            std::enable_if_t<!cudf::is_numeric<T>() && !cudf::is_timestamp<T>() &&
+                             !std::is_same<T, cudf::string_view>::value> * = nullptr>
+  std::unique_ptr<scalar> operator()(filter_literal const &literal, cudaStream_t stream)
+  {
+    CUDF_FAIL("Unsupported filter literal type");
+  }
+};
+
+/**
+ * @brief Returns the binary operator comparing a value with a filter literal
+ *
+ * `IN` filters are evaluated as the disjunction of `EQUAL` comparisons.
+ */
+binary_operator to_binary_operator(filter_op op)
+{
+  switch (op) {
+    case filter_op::LESS: return binary_operator::LESS;
+    case filter_op::LESS_EQUAL: return binary_operator::LESS_EQUAL;
+    case filter_op::GREATER: return binary_operator::GREATER;
+    case filter_op::GREATER_EQUAL: return binary_operator::GREATER_EQUAL;
+    default: return binary_operator::EQUAL;
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<column> evaluate_filters(table_view const &table,
+                                         std::vector<std::string> const &column_names,
+                                         std::vector<column_filter> const &filters,
+                                         rmm::mr::device_memory_resource *mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(!filters.empty(), "No filter to evaluate");
+
+  // Combine the comparisons with the literals into a single boolean mask
+  std::unique_ptr<column> mask;
+  auto const combine = [&](std::unique_ptr<column> &result,
+                           std::unique_ptr<column> &&other,
+                           binary_operator op) {
+    result = result ? cudf::detail::binary_operation(
+                        result->view(), other->view(), op, data_type{BOOL8}, mr, stream)
+                    : std::move(other);
+  };
+  for (auto const &filter : filters) {
+    auto const col = std::find(column_names.begin(), column_names.end(), filter.column_name);
+    CUDF_EXPECTS(col != column_names.end(), "Filter column not found");
+    CUDF_EXPECTS(!filter.values.empty(), "Filter has no literal");
+    auto const values = table.column(std::distance(column_names.begin(), col));
+    CUDF_EXPECTS((values.type().id() == type_id::STRING) ==
+                   (filter.values.front().type.id() == type_id::STRING),
+                 "Filter literal type does not match the column type");
+    std::unique_ptr<column> matches;
+    for (auto const &literal : filter.values) {
+      auto const value = type_dispatcher(literal.type, literal_to_scalar{}, literal, stream);
+      combine(matches,
+              cudf::detail::binary_operation(
+                values, *value, to_binary_operator(filter.op), data_type{BOOL8}, mr, stream),
+              binary_operator::LOGICAL_OR);
+    }
+    combine(mask, std::move(matches), binary_operator::LOGICAL_AND);
+  }
+  return mask;
+}
+
+std::vector<bool> segments_with_matches(column_view const &mask,
+                                        std::vector<size_type> const &segment_sizes,
+                                        cudaStream_t stream)
+{
+  std::vector<size_type> offsets(segment_sizes.size() + 1, 0);
+  std::partial_sum(segment_sizes.begin(), segment_sizes.end(), offsets.begin() + 1);
+  CUDF_EXPECTS(offsets.back() == mask.size(), "Segment sizes do not match the mask size");
+  if (segment_sizes.empty()) { return {}; }
+
+  rmm::device_vector<size_type> d_offsets(offsets);
+  rmm::device_vector<int32_t> d_matches(segment_sizes.size(), 0);
+  auto const d_mask    = column_device_view::create(mask, stream);
+  auto const d_begin   = d_offsets.data().get();
+  auto const d_end     = d_begin + d_offsets.size();
+  auto const d_results = d_matches.data().get();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     mask.size(),
+                     [mask = *d_mask, d_begin, d_end, d_results] __device__(size_type row) {
+                       if (mask.is_valid(row) && mask.element<bool>(row)) {
+                         // Concurrent stores all write the same value
+                         auto const it = thrust::upper_bound(thrust::seq, d_begin, d_end, row);
+                         d_results[it - d_begin - 1] = 1;
+                       }
+                     });
+
+  std::vector<int32_t> h_matches(segment_sizes.size());
+  CUDA_TRY(cudaMemcpyAsync(h_matches.data(),
+                           d_results,
+                           h_matches.size() * sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return std::vector<bool>(h_matches.begin(), h_matches.end());
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
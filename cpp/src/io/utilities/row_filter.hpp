@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file row_filter.hpp
+ * @brief cuDF-IO evaluation of reader filter predicates on decoded columns
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Evaluates filter predicates on the rows of a table.
+ *
+ * Each literal is compared with the column values as a scalar of the literal's own type; `IN`
+ * filters are evaluated as the disjunction of `EQUAL` comparisons. Comparisons with a null value
+ * are not satisfied.
+ *
+ * @param[in] table Columns referenced by the filters
+ * @param[in] column_names Names of the columns of the table
+ * @param[in] filters Predicates that must all hold
+ * @param[in] mr Device memory resource used to allocate the returned column
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return BOOL8 column that is true for the rows satisfying all the filters, and false or null
+ * otherwise
+ *
+ * @throw cudf::logic_error if a filter column is not in the table or a literal does not match
+ * the type of its column
+ */
+std::unique_ptr<column> evaluate_filters(table_view const &table,
+                                         std::vector<std::string> const &column_names,
+                                         std::vector<column_filter> const &filters,
+                                         rmm::mr::device_memory_resource *mr,
+                                         cudaStream_t stream = 0);
+
+/**
+ * @brief Returns which consecutive row ranges of a boolean mask have any true value.
+ *
+ * @param[in] mask BOOL8 column; null elements count as false
+ * @param[in] segment_sizes Number of rows of each range, summing up to the size of the mask
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Whether each range has a true value
+ */
+std::vector<bool> segments_with_matches(column_view const &mask,
+                                        std::vector<size_type> const &segment_sizes,
+                                        cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
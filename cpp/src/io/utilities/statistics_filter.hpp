@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file statistics_filter.hpp
+ * @brief cuDF-IO helpers to evaluate reader filter predicates on file statistics
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Returns the duration of one tick of a timestamp type in nanoseconds, or 0 for other types
+ */
+constexpr int64_t tick_duration_ns(type_id id)
+{
+  switch (id) {
+    case type_id::TIMESTAMP_DAYS: return 86400000000000;
+    case type_id::TIMESTAMP_SECONDS: return 1000000000;
+    case type_id::TIMESTAMP_MILLISECONDS: return 1000000;
+    case type_id::TIMESTAMP_MICROSECONDS: return 1000;
+    case type_id::TIMESTAMP_NANOSECONDS: return 1;
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Returns whether a filter literal holds a floating-point value
+ */
+inline bool is_floating_literal(filter_literal const &literal)
+{
+  return literal.type.id() == type_id::FLOAT32 || literal.type.id() == type_id::FLOAT64;
+}
+
+/**
+ * @brief Returns whether some value within [min, max] can satisfy the comparison
+ *
+ * @param op The comparison of the filter
+ * @param min The minimum of the values, e.g. of a row group or stripe
+ * @param max The maximum of the values
+ * @param values The filter literals, converted to the type of `min` and `max`
+ */
+template <typename T>
+bool range_may_match(filter_op op, T const &min, T const &max, std::vector<T> const &values)
+{
+  switch (op) {
+    case filter_op::LESS: return min < values[0];
+    case filter_op::LESS_EQUAL: return !(values[0] < min);
+    case filter_op::GREATER: return values[0] < max;
+    case filter_op::GREATER_EQUAL: return !(max < values[0]);
+    default:
+      return std::any_of(
+        values.begin(), values.end(), [&](T const &v) { return !(v < min) && !(max < v); });
+  }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
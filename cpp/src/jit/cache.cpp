@@ -26,6 +26,8 @@
 
 #include <cuda.h>
 
+#include <chrono>
+
 namespace cudf {
 namespace jit {
 // Get the directory in home to use for storing the cache
@@ -85,6 +87,39 @@ boost::filesystem::path getCacheDir()
   return kernel_cache_path;
 }
 
+// Default `LIBCUDF_KERNEL_BUNDLE_PATH` to none. This definition can be overridden at
+// compile time by specifying a `-DLIBCUDF_KERNEL_BUNDLE_PATH=/kernel/bundle/path`
+// CMake argument. This path is used in the `getBundleDir()` function below.
+#if !defined(LIBCUDF_KERNEL_BUNDLE_PATH)
+#define LIBCUDF_KERNEL_BUNDLE_PATH ""
+#endif
+
+/**
+ * @brief Get the string path to the read-only directory of precompiled JITIFY kernels.
+ *
+ * This path can be overridden at runtime by defining an environment variable
+ * named `LIBCUDF_KERNEL_BUNDLE_PATH`.
+ *
+ * Returns an empty path if no bundle path is configured or the directory
+ * `$LIBCUDF_KERNEL_BUNDLE_PATH/$CUDF_VERSION` does not exist.
+ **/
+boost::filesystem::path getBundleDir()
+{
+  auto kernel_bundle_path_env = std::getenv("LIBCUDF_KERNEL_BUNDLE_PATH");
+  auto kernel_bundle_path     = boost::filesystem::path(
+    kernel_bundle_path_env != nullptr ? kernel_bundle_path_env : LIBCUDF_KERNEL_BUNDLE_PATH);
+
+  if (not kernel_bundle_path.empty()) {
+    kernel_bundle_path /= std::string{CUDF_STRINGIFY(CUDF_VERSION)};
+    boost::system::error_code ec;
+    // the bundle is never created here, it is read-only
+    if (not boost::filesystem::is_directory(kernel_bundle_path, ec)) {
+      return boost::filesystem::path();
+    }
+  }
+  return kernel_bundle_path;
+}
+
 cudfJitCache::cudfJitCache() {}
 
 cudfJitCache::~cudfJitCache() {}
@@ -99,40 +134,65 @@ named_prog<jitify::experimental::Program> cudfJitCache::getProgram(
   std::vector<std::string> const& given_options,
   jitify::experimental::file_callback_type file_callback)
 {
-  // Lock for thread safety
-  std::lock_guard<std::mutex> lock(_program_cache_mutex);
-
-  return getCached(prog_name, program_map, [&]() {
+  return getCached(prog_name, program_map, _program_cache_mutex, [&]() {
     CUDF_EXPECTS(not cuda_source.empty(), "Program not found in cache, Needs source string.");
     return jitify::experimental::Program(cuda_source, given_headers, given_options, file_callback);
   });
 }
 
+namespace {
+// Make instance name e.g. "prog_binop.kernel_v_v_int_int_long int_Add"
+std::string get_kernel_instantiation_name(std::string const& prog_name,
+                                          std::string const& kern_name,
+                                          std::vector<std::string> const& arguments)
+{
+  std::string kern_inst_name = prog_name + '.' + kern_name;
+  for (auto&& arg : arguments) kern_inst_name += '_' + arg;
+  return kern_inst_name;
+}
+
+}  // namespace
+
 named_prog<jitify::experimental::KernelInstantiation> cudfJitCache::getKernelInstantiation(
   std::string const& kern_name,
   named_prog<jitify::experimental::Program> const& named_program,
   std::vector<std::string> const& arguments)
 {
-  // Lock for thread safety
-  std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
-
   std::string prog_name                  = std::get<0>(named_program);
   jitify::experimental::Program& program = *std::get<1>(named_program);
 
-  // Make instance name e.g. "prog_binop.kernel_v_v_int_int_long int_Add"
-  std::string kern_inst_name = prog_name + '.' + kern_name;
-  for (auto&& arg : arguments) kern_inst_name += '_' + arg;
+  std::string kern_inst_name = get_kernel_instantiation_name(prog_name, kern_name, arguments);
 
   CUcontext c;
   cuCtxGetCurrent(&c);
 
-  auto& kernel_inst_map = kernel_inst_context_map[c];
+  // References to unordered_map elements stay valid while other contexts are added
+  auto& kernel_inst_map = [&]() -> auto& {
+    std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+    return kernel_inst_context_map[c];
+  }();
 
-  return getCached(kern_inst_name, kernel_inst_map, [&]() {
+  return getCached(kern_inst_name, kernel_inst_map, _kernel_cache_mutex, [&]() {
     return program.kernel(kern_name).instantiate(arguments);
   });
 }
 
+bool cudfJitCache::isKernelInstantiationCached(std::string const& kern_name,
+                                               std::string const& prog_name,
+                                               std::vector<std::string> const& arguments)
+{
+  CUcontext c;
+  cuCtxGetCurrent(&c);
+
+  std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+  auto const context = kernel_inst_context_map.find(c);
+  if (context == kernel_inst_context_map.end()) { return false; }
+  auto const kernel =
+    context->second.find(get_kernel_instantiation_name(prog_name, kern_name, arguments));
+  return kernel != context->second.end() &&
+         kernel->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
 // Another overload for getKernelInstantiation which might be useful to get
 // kernel instantiations in one step
 // ------------------------------------------------------------------------
@@ -160,8 +220,8 @@ cudfJitCache::cacheFile::~cacheFile() {}
 
 std::string cudfJitCache::cacheFile::read()
 {
-  // Open file (duh)
-  int fd = open(_file_name.c_str(), O_RDWR);
+  // Open file (duh). Read-only so that files in a read-only kernel bundle can be read
+  int fd = open(_file_name.c_str(), O_RDONLY);
   if (fd == -1) {
     successful_read = false;
     return std::string();
@@ -195,7 +255,6 @@ std::string cudfJitCache::cacheFile::read()
   if (fread(buffer, file_size, 1, fp) != 1) {
     successful_read = false;
     fclose(fp);
-    free(buffer);
     return std::string();
   }
   fclose(fp);
@@ -20,6 +20,7 @@
 #include <boost/filesystem.hpp>
 #include <cudf/utilities/error.hpp>
 #include <jitify.hpp>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -44,6 +45,22 @@ using named_prog = std::pair<std::string, std::shared_ptr<Tv>>;
  **/
 boost::filesystem::path getCacheDir();
 
+/**
+ * @brief Get the string path to the read-only directory of precompiled JITIFY kernels.
+ *
+ * A kernel bundle is a kernel cache directory generated ahead of time, e.g. by running
+ * `cudf::precompile_binary_operations` with `LIBCUDF_KERNEL_CACHE_PATH` pointing at it,
+ * and shipped with the application. It is searched when a kernel is not found in the
+ * cache directory returned by `getCacheDir()` and is never written to.
+ *
+ * This path can be overridden at runtime by defining an environment variable
+ * named `LIBCUDF_KERNEL_BUNDLE_PATH`.
+ *
+ * Returns an empty path if no bundle path is configured or the directory
+ * `$LIBCUDF_KERNEL_BUNDLE_PATH/$CUDF_VERSION` does not exist.
+ **/
+boost::filesystem::path getBundleDir();
+
 class cudfJitCache {
  public:
   /**
@@ -77,6 +94,21 @@ class cudfJitCache {
     named_prog<jitify::experimental::Program> const& program,
     std::vector<std::string> const& arguments);
 
+  /**
+   * @brief Check whether a kernel instantiation is ready in the in-memory cache
+   *
+   * Only the cache of the current CUDA context is searched. A kernel that another thread
+   * is still compiling is not ready.
+   *
+   * @param kern_name  name of the kernel
+   * @param prog_name  name of the program containing the kernel
+   * @param arguments  template arguments for kernel in vector of strings
+   * @return true if `getKernelInstantiation` would return without loading or compiling
+   **/
+  bool isKernelInstantiationCached(std::string const& kern_name,
+                                   std::string const& prog_name,
+                                   std::vector<std::string> const& arguments);
+
   /**
    * @brief Get the Jitify preprocessed Program object
    *
@@ -99,20 +131,22 @@ class cudfJitCache {
     jitify::experimental::file_callback_type file_callback = nullptr);
 
  private:
+  // Each entry is ready once its object was loaded or compiled by the thread that inserted it
   template <typename Tv>
-  using umap_str_shptr = std::unordered_map<std::string, std::shared_ptr<Tv>>;
+  using umap_str_shfut = std::unordered_map<std::string, std::shared_future<std::shared_ptr<Tv>>>;
 
-  std::unordered_map<CUcontext, umap_str_shptr<jitify::experimental::KernelInstantiation>>
+  std::unordered_map<CUcontext, umap_str_shfut<jitify::experimental::KernelInstantiation>>
     kernel_inst_context_map;
-  umap_str_shptr<jitify::experimental::Program> program_map;
+  umap_str_shfut<jitify::experimental::Program> program_map;
 
   /*
-    Even though this class can be used as a non-singleton, the file cache
-    access should remain limited to one thread per process. The lockf locks can
-    prevent multiple processes from accessing the file but are ineffective in
-    preventing multiple threads from doing so as the lock is shared by the
-    entire process.
-    Therefore the mutexes are static.
+    The mutexes only guard the maps. A name is loaded or compiled by the one
+    thread that inserted it, so each cache file is accessed by at most one
+    thread per process. The fcntl locks are shared by the entire process and
+    cannot serialize threads, but they keep multiple processes from accessing
+    the same file.
+    Even though this class can be used as a non-singleton, the mutexes are
+    static so that this holds across instances.
     */
   static std::mutex _kernel_cache_mutex;
   static std::mutex _program_cache_mutex;
@@ -163,13 +197,24 @@ class cudfJitCache {
 
  private:
   template <typename T, typename FallbackFunc>
-  named_prog<T> getCached(std::string const& name, umap_str_shptr<T>& map, FallbackFunc func)
+  named_prog<T> getCached(std::string const& name,
+                          umap_str_shfut<T>& map,
+                          std::mutex& map_mutex,
+                          FallbackFunc func)
   {
-    // Find memory cached T object
+    // Find memory cached T object, waiting without the lock if another thread is compiling it
+    std::unique_lock<std::mutex> lock(map_mutex);
     auto it = map.find(name);
     if (it != map.end()) {
-      return std::make_pair(name, it->second);
-    } else {  // Find file cached T object
+      auto cached = it->second;
+      lock.unlock();
+      return std::make_pair(name, cached.get());
+    }
+    std::promise<std::shared_ptr<T>> promise;
+    map[name] = promise.get_future().share();
+    lock.unlock();
+
+    try {  // Find file cached T object
       bool successful_read = false;
       std::string serialized;
 #if defined(JITIFY_USE_CACHE)
@@ -180,6 +225,16 @@ class cudfJitCache {
         serialized      = file.read();
         successful_read = file.is_read_successful();
       }
+      // Fall back to the precompiled kernel bundle, if any
+      if (not successful_read) {
+        boost::filesystem::path bundle_dir = getBundleDir();
+        if (not bundle_dir.empty()) {
+          boost::filesystem::path file_name = bundle_dir / name;
+          cacheFile file{file_name.string()};
+          serialized      = file.read();
+          successful_read = file.is_read_successful();
+        }
+      }
 #endif
       if (not successful_read) {
         // JIT compile and write to file if possible
@@ -194,8 +249,14 @@ class cudfJitCache {
       }
       // Add deserialized T to cache and return
       auto program = std::make_shared<T>(T::deserialize(serialized));
-      map[name]    = program;
+      promise.set_value(program);
       return std::make_pair(name, program);
+    } catch (...) {
+      // Waiting threads see the failure and later calls compile again
+      promise.set_exception(std::current_exception());
+      std::lock_guard<std::mutex> erase_lock(map_mutex);
+      map.erase(name);
+      throw;
     }
   }
 };
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @file kernel_bundle.cpp
+ * @brief Generates a bundle of precompiled binary operation kernels.
+ *
+ * Run with `LIBCUDF_KERNEL_CACHE_PATH` set to the bundle directory. Every kernel compiled
+ * here is written to `$LIBCUDF_KERNEL_CACHE_PATH/$CUDF_VERSION` and can be loaded later
+ * through `LIBCUDF_KERNEL_BUNDLE_PATH` on GPUs of the same architecture.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+int main()
+{
+  using cudf::binary_operator;
+
+  std::vector<cudf::type_id> const types{
+    cudf::type_id::INT32, cudf::type_id::INT64, cudf::type_id::FLOAT32, cudf::type_id::FLOAT64};
+  std::vector<binary_operator> const arithmetic_ops{
+    binary_operator::ADD, binary_operator::SUB, binary_operator::MUL, binary_operator::DIV};
+  std::vector<binary_operator> const comparison_ops{binary_operator::EQUAL,
+                                                    binary_operator::NOT_EQUAL,
+                                                    binary_operator::LESS,
+                                                    binary_operator::GREATER,
+                                                    binary_operator::LESS_EQUAL,
+                                                    binary_operator::GREATER_EQUAL};
+
+  std::vector<cudf::binary_operation_signature> signatures;
+  for (auto const type : types) {
+    cudf::data_type const data_type{type};
+    for (auto const op : arithmetic_ops) {
+      signatures.push_back({op, data_type, data_type, data_type});
+    }
+    for (auto const op : comparison_ops) {
+      signatures.push_back({op, data_type, data_type, cudf::data_type{cudf::type_id::BOOL8}});
+    }
+  }
+  cudf::data_type const bool_type{cudf::type_id::BOOL8};
+  signatures.push_back({binary_operator::LOGICAL_AND, bool_type, bool_type, bool_type});
+  signatures.push_back({binary_operator::LOGICAL_OR, bool_type, bool_type, bool_type});
+
+  cudf::precompile_binary_operations(signatures);
+  return 0;
+}
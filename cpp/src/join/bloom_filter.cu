@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <join/join_common_utils.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int MAX_BLOOM_FILTER_HASHES = 16;
+
+/**
+ * @brief Computes the bits of a bloom filter set for each row of a table.
+ *
+ * The bits are derived from the row hash by double hashing, so each row is hashed only once.
+ */
+struct bloom_filter_bits {
+  row_hash hasher;
+  std::size_t num_bits;
+  int num_hashes;
+
+  template <typename BitOp>
+  __device__ void for_each_bit(size_type row, BitOp&& op) const
+  {
+    // The two halves of the 64-bit row hash are independent hash values
+    auto const hash          = hasher(row);
+    hash_value_type const h1 = static_cast<hash_value_type>(hash);
+    hash_value_type const h2 = static_cast<hash_value_type>(hash >> 32) | 1;
+    for (int i = 0; i < num_hashes; ++i) {
+      op(static_cast<std::size_t>(h1 + i * h2) % num_bits);
+    }
+  }
+};
+
+}  // namespace
+
+}  // namespace detail
+
+bloom_filter::bloom_filter(table_view const& keys,
+                           double false_positive_rate,
+                           rmm::mr::device_memory_resource* mr,
+                           cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(keys.num_columns() > 0, "Bloom filter keys have no column");
+  CUDF_EXPECTS(false_positive_rate > 0 && false_positive_rate < 1,
+               "Bloom filter false positive rate must be between 0 and 1");
+  std::transform(keys.begin(), keys.end(), std::back_inserter(_key_types), [](auto const& col) {
+    return col.type();
+  });
+
+  // Optimal number of bits and hashes for the target false positive rate
+  double const num_keys = std::max(keys.num_rows(), 1);
+  double const ln2      = std::log(2.0);
+  double const bits     = -num_keys * std::log(false_positive_rate) / (ln2 * ln2);
+  auto const num_words  = std::max<std::size_t>(std::ceil(bits / 32), 1);
+  auto const num_hashes = static_cast<int>(std::round(bits / num_keys * ln2));
+  _num_hashes           = std::min(std::max(num_hashes, 1), detail::MAX_BLOOM_FILTER_HASHES);
+  _bits                 = rmm::device_buffer(num_words * sizeof(uint32_t), stream, mr);
+  CUDA_TRY(cudaMemsetAsync(_bits.data(), 0, _bits.size(), stream));
+
+  if (keys.num_rows() > 0) {
+    auto const d_keys  = table_device_view::create(keys, stream);
+    auto const d_words = static_cast<uint32_t*>(_bits.data());
+    detail::bloom_filter_bits const key_bits{detail::row_hash{*d_keys}, num_bits(), _num_hashes};
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       keys.num_rows(),
+                       [key_bits, d_words] __device__(size_type row) {
+                         key_bits.for_each_bit(row, [d_words](std::size_t bit) {
+                           atomicOr(d_words + bit / 32, uint32_t{1} << (bit % 32));
+                         });
+                       });
+  }
+}
+
+std::unique_ptr<column> bloom_filter_contains(bloom_filter const& filter,
+                                              table_view const& probe,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(std::equal(probe.begin(),
+                          probe.end(),
+                          filter.key_types().begin(),
+                          filter.key_types().end(),
+                          [](auto const& col, auto const& type) { return col.type() == type; }),
+               "Mismatch between the probe column types and the bloom filter key types");
+  auto result = make_numeric_column(
+    data_type{BOOL8}, probe.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (probe.num_rows() == 0) { return result; }
+
+  auto const d_probe = table_device_view::create(probe, stream);
+  auto const d_words = static_cast<uint32_t const*>(filter.bits().data());
+  detail::bloom_filter_bits const bits{
+    detail::row_hash{*d_probe}, filter.num_bits(), filter.num_hashes()};
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(probe.num_rows()),
+                    result->mutable_view().begin<bool>(),
+                    [bits, d_words] __device__(size_type row) {
+                      bool contained = true;
+                      bits.for_each_bit(row, [&contained, d_words](std::size_t bit) {
+                        contained = contained && (d_words[bit / 32] & (uint32_t{1} << (bit % 32)));
+                      });
+                      return contained;
+                    });
+  return result;
+}
+
+}  // namespace cudf
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <join/join_common_utils.hpp>
+#include <join/sort_merge_join.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Maximum number of candidate row pairs evaluated at once by a conditional join
+ */
+constexpr size_type DEFAULT_CONDITIONAL_JOIN_PAIRS = 1 << 26;
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the row indices of the pairs of rows of `left` and `right`
+ * satisfying all the join conditions.
+ *
+ * The candidate pairs are enumerated by blocks of consecutive left rows, and
+ * the conditions are evaluated on each block with the binary operations, so
+ * that the full product of the tables is never materialized.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param conditions Comparisons that joined rows must all satisfy
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+VectorPair get_conditional_join_indices(table_view const& left,
+                                        table_view const& right,
+                                        std::vector<join_condition> const& conditions,
+                                        cudaStream_t stream)
+{
+  auto const mr                  = rmm::mr::get_default_resource();
+  size_type const right_num_rows = right.num_rows();
+  if ((left.num_rows() == 0) || (right_num_rows == 0)) { return VectorPair{}; }
+
+  size_type const block_rows = std::max(DEFAULT_CONDITIONAL_JOIN_PAIRS / right_num_rows, 1);
+  std::vector<VectorPair> block_indices;
+  size_type join_size = 0;
+  for (size_type block_start = 0; block_start < left.num_rows(); block_start += block_rows) {
+    size_type const num_pairs =
+      std::min(block_rows, left.num_rows() - block_start) * right_num_rows;
+
+    rmm::device_vector<size_type> left_candidates(num_pairs);
+    rmm::device_vector<size_type> right_candidates(num_pairs);
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     left_candidates.begin(),
+                     left_candidates.end(),
+                     [block_start, right_num_rows] __device__(size_type pair) {
+                       return block_start + pair / right_num_rows;
+                     });
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     right_candidates.begin(),
+                     right_candidates.end(),
+                     [right_num_rows] __device__(size_type pair) { return pair % right_num_rows; });
+
+    // Combine the comparisons of the candidate pairs into a single boolean mask
+    std::unique_ptr<column> mask;
+    for (auto const& condition : conditions) {
+      table_view const left_column{{left.column(condition.left_column)}};
+      table_view const right_column{{right.column(condition.right_column)}};
+      auto const left_values = detail::gather(
+        left_column, left_candidates.begin(), left_candidates.end(), false, mr, stream);
+      auto const right_values = detail::gather(
+        right_column, right_candidates.begin(), right_candidates.end(), false, mr, stream);
+
+      auto matches = detail::binary_operation(left_values->get_column(0),
+                                              right_values->get_column(0),
+                                              condition.op,
+                                              data_type{BOOL8},
+                                              mr,
+                                              stream);
+      mask = mask ? detail::binary_operation(
+                      *mask, *matches, binary_operator::LOGICAL_AND, data_type{BOOL8}, mr, stream)
+                  : std::move(matches);
+    }
+
+    VectorPair indices;
+    indices.first.resize(num_pairs);
+    indices.second.resize(num_pairs);
+    auto const d_mask = column_device_view::create(*mask, stream);
+    auto const end    = thrust::copy_if(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(left_candidates.begin(), right_candidates.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(left_candidates.end(), right_candidates.end())),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_zip_iterator(thrust::make_tuple(indices.first.begin(), indices.second.begin())),
+      [mask = *d_mask] __device__(size_type pair) {
+        return mask.is_valid(pair) && mask.element<bool>(pair);
+      });
+    size_type const num_matches =
+      thrust::distance(indices.first.begin(), thrust::get<0>(end.get_iterator_tuple()));
+    indices.first.resize(num_matches);
+    indices.second.resize(num_matches);
+    join_size += num_matches;
+    block_indices.push_back(std::move(indices));
+  }
+
+  VectorPair joined_indices;
+  joined_indices.first.resize(join_size);
+  joined_indices.second.resize(join_size);
+  size_type offset = 0;
+  for (auto const& indices : block_indices) {
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 indices.first.begin(),
+                 indices.first.end(),
+                 joined_indices.first.begin() + offset);
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 indices.second.begin(),
+                 indices.second.end(),
+                 joined_indices.second.begin() + offset);
+    offset += indices.first.size();
+  }
+  return joined_indices;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the row indices of the band join of `left` and `right`,
+ * matching `left[i]` with `right[j]` when
+ * `right[j] + lower <= left[i] <= right[j] + upper`.
+ *
+ * `right` is sorted, and the range of right values `[left[i] - upper,
+ * left[i] - lower]` of every left row is located by binary search. Null values
+ * do not match anything.
+ *
+ * @param left The left column
+ * @param right The right column
+ * @param lower Lower bound of the difference `left - right`
+ * @param upper Upper bound of the difference `left - right`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+VectorPair get_band_join_indices(column_view const& left,
+                                 column_view const& right,
+                                 scalar const& lower,
+                                 scalar const& upper,
+                                 cudaStream_t stream)
+{
+  CUDF_EXPECTS(lower.is_valid() && upper.is_valid(), "Band bounds must be valid");
+  auto const mr = rmm::mr::get_default_resource();
+
+  // Nulls are sorted first and left out of the searched rows
+  std::vector<order> const column_order{order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::BEFORE};
+  table_view const right_table{{right}};
+  auto const right_order =
+    detail::sorted_order(right_table, column_order, null_precedence, mr, stream);
+  auto const sorted_right = detail::gather(right_table,
+                                           right_order->view(),
+                                           out_of_bounds_policy::IGNORE,
+                                           negative_index_policy::NOT_ALLOWED,
+                                           mr,
+                                           stream);
+  size_type const right_nulls = right.null_count();
+
+  auto const valid_right =
+    cudf::slice(sorted_right->view(), {right_nulls, right.size()}).front();
+
+  // Null left values give null bounds, which find an empty range before the valid right rows
+  auto const range_begin =
+    detail::binary_operation(left, upper, binary_operator::SUB, right.type(), mr, stream);
+  auto const range_end =
+    detail::binary_operation(left, lower, binary_operator::SUB, right.type(), mr, stream);
+
+  auto const begin = detail::lower_bound(
+    valid_right, table_view{{*range_begin}}, column_order, null_precedence, mr, stream);
+  auto const end = detail::upper_bound(
+    valid_right, table_view{{*range_end}}, column_order, null_precedence, mr, stream);
+
+  return expand_sorted_matches(begin->view().data<size_type>(),
+                               end->view().data<size_type>(),
+                               left.size(),
+                               right_order->view().data<size_type>() + right_nulls,
+                               false,
+                               stream);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> conditional_inner_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<join_condition> const& conditions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(!conditions.empty(), "No join condition");
+  auto const joined_indices = detail::get_conditional_join_indices(left, right, conditions, stream);
+  return std::make_pair(detail::indices_to_column(joined_indices.first, mr, stream),
+                        detail::indices_to_column(joined_indices.second, mr, stream));
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> band_inner_join_indices(
+  column_view const& left,
+  column_view const& right,
+  scalar const& lower,
+  scalar const& upper,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const joined_indices = detail::get_band_join_indices(left, right, lower, upper, stream);
+  return std::make_pair(detail::indices_to_column(joined_indices.first, mr, stream),
+                        detail::indices_to_column(joined_indices.second, mr, stream));
+}
+
+}  // namespace cudf
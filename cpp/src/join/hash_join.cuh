@@ -15,7 +15,9 @@
  */
 #pragma once
 
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/scratch_arena.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table.hpp>
@@ -25,17 +27,19 @@
 #include <join/join_common_utils.hpp>
 #include <join/join_kernels.cuh>
 
+#include <functional>
+#include <memory>
+
 namespace cudf {
 namespace detail {
 /* --------------------------------------------------------------------------*/
 /**
- * @brief  Gives an estimate of the size of the join output produced when
- * joining two tables together.
+ * @brief  Computes the exact size of the join output produced when joining
+ * two tables together.
  *
- * If the two tables are of relatively equal size, then the returned output
- * size will be the exact output size. However, if the probe table is
- * significantly larger than the build table, then we attempt to estimate the
- * output size by using only a subset of the rows in the probe table.
+ * Every row of the probe table is looked up in the hash table once and its
+ * matches are counted, so that the join output can be allocated with its
+ * final size before it is written.
  *
  * @throws cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
  *
@@ -43,29 +47,28 @@ namespace detail {
  * @param probe_table The left hand table
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the temporary output size counter
  *
- * @returns An estimate of the size of the output of the join operation
+ * @returns The size of the output of the join operation
  */
 /* ----------------------------------------------------------------------------*/
 template <join_kind JoinKind, typename multimap_type>
-size_type estimate_join_output_size(table_device_view build_table,
-                                    table_device_view probe_table,
-                                    multimap_type const& hash_table,
-                                    cudaStream_t stream)
+size_type get_join_output_size(
+  table_device_view build_table,
+  table_device_view probe_table,
+  multimap_type const& hash_table,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
 {
+  CUDF_SCOPED_RANGE_PAYLOAD("join_build", build_table.num_rows());
+
   const size_type build_table_num_rows{build_table.num_rows()};
   const size_type probe_table_num_rows{probe_table.num_rows()};
 
-  // If the probe table is significantly larger (5x) than the build table,
-  // then we attempt to only use a subset of the probe table rows to compute an
-  // estimate of the join output size.
-  size_type probe_to_build_ratio{0};
-  if (build_table_num_rows > 0) {
-    probe_to_build_ratio = static_cast<size_type>(
-      std::ceil(static_cast<float>(probe_table_num_rows) / build_table_num_rows));
-  } else {
-    // If the build table is empty, we know exactly how large the output
-    // will be for the different types of joins and can return immediately
+  // If the build table is empty, we know exactly how large the output
+  // will be for the different types of joins and can return immediately
+  if (build_table_num_rows == 0) {
     switch (JoinKind) {
       // Inner join with an empty table will have no output
       case join_kind::INNER_JOIN: return 0;
@@ -77,14 +80,10 @@ size_type estimate_join_output_size(table_device_view build_table,
       default: CUDF_FAIL("Unsupported join type");
     }
   }
-
-  size_type sample_probe_num_rows{probe_table_num_rows};
-  constexpr size_type MAX_RATIO{5};
-  if (probe_to_build_ratio > MAX_RATIO) { sample_probe_num_rows = build_table_num_rows; }
+  if (probe_table_num_rows == 0) { return 0; }
 
   // Allocate storage for the counter used to get the size of the join output
-  size_type h_size_estimate{0};
-  rmm::device_scalar<size_type> size_estimate(0, stream);
+  rmm::device_scalar<size_type> output_size(0, stream, mr);
 
   CHECK_CUDA(stream);
 
@@ -100,55 +99,21 @@ size_type estimate_join_output_size(table_device_view build_table,
   int num_sms{-1};
   CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
 
-  // Continue probing with a subset of the probe table until either:
-  // a non-zero output size estimate is found OR
-  // all of the rows in the probe table have been sampled
-  do {
-    sample_probe_num_rows = std::min(sample_probe_num_rows, probe_table_num_rows);
-
-    size_estimate.set_value(0);
-
-    row_hash hash_probe{probe_table};
-    row_equality equality{probe_table, build_table};
-    // Probe the hash table without actually building the output to simply
-    // find what the size of the output will be.
-    compute_join_output_size<JoinKind, multimap_type, block_size>
-      <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
-                                                       build_table,
-                                                       probe_table,
-                                                       hash_probe,
-                                                       equality,
-                                                       sample_probe_num_rows,
-                                                       size_estimate.data());
-    CHECK_CUDA(stream);
-
-    // Only in case subset of probe table is chosen,
-    // increase the estimated output size by a factor of the ratio between the
-    // probe and build tables
-    if (sample_probe_num_rows < probe_table_num_rows) {
-      h_size_estimate = size_estimate.value() * probe_to_build_ratio;
-    } else {
-      h_size_estimate = size_estimate.value();
-    }
-
-    // If the size estimate is non-zero, then we have a valid estimate and can break
-    // If sample_probe_num_rows >= probe_table_num_rows, then we've sampled the entire
-    // probe table, in which case the estimate is exact and we can break
-    if ((h_size_estimate > 0) || (sample_probe_num_rows >= probe_table_num_rows)) { break; }
-
-    // If the size estimate is zero, then double the number of sampled rows in the probe
-    // table. Reduce the ratio of the number of probe rows sampled to the number of rows
-    // in the build table by the same factor
-    if (0 == h_size_estimate) {
-      constexpr size_type GROW_RATIO{2};
-      sample_probe_num_rows *= GROW_RATIO;
-      probe_to_build_ratio =
-        static_cast<size_type>(std::ceil(static_cast<float>(probe_to_build_ratio) / GROW_RATIO));
-    }
-
-  } while (true);
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table};
+  // Probe the hash table without actually building the output to simply
+  // find what the size of the output will be.
+  compute_join_output_size<JoinKind, multimap_type, block_size>
+    <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
+                                                     build_table,
+                                                     probe_table,
+                                                     hash_probe,
+                                                     equality,
+                                                     probe_table_num_rows,
+                                                     output_size.data());
+  CHECK_CUDA(stream);
 
-  return h_size_estimate;
+  return output_size.value();
 }
 
 /* --------------------------------------------------------------------------*/
@@ -178,6 +143,131 @@ get_trivial_left_join_indices(table_view const& left, cudaStream_t stream)
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
+/**
+ * @brief Returns the number of slots of the hash table built on `num_rows` rows
+ */
+inline size_t join_hash_table_size(size_type num_rows)
+{
+  // An odd capacity spreads the rows of hash partitioned build tables, whose hash values all
+  // share their low bits, over every slot of the table
+  return compute_hash_table_size(num_rows) | 1;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Builds the hash table mapping the hash value of every row of the
+ * build table to the index of that row.
+ *
+ * @throws cudf::logic_error if the hash table insertion fails
+ *
+ * @param build_table Table of the columns to hash
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the hash table
+ *
+ * @returns Hash table of the rows of `build_table`
+ */
+/* ----------------------------------------------------------------------------*/
+inline std::unique_ptr<multimap_type, std::function<void(multimap_type*)>> build_join_hash_table(
+  table_device_view build_table,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+{
+  const size_type build_table_num_rows{build_table.num_rows()};
+  multimap_type::allocator_type allocator{};
+  allocator.mr = mr;
+
+  auto hash_table = multimap_type::create(join_hash_table_size(build_table_num_rows),
+                                          true,
+                                          multimap_type::hasher(),
+                                          multimap_type::key_equal(),
+                                          allocator,
+                                          stream);
+
+  // build the hash table
+  if (build_table_num_rows > 0) {
+    row_hash hash_build{build_table};
+    rmm::device_scalar<int> failure(0, stream, mr);
+    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+    detail::grid_1d config(build_table_num_rows, block_size);
+    build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      *hash_table, hash_build, build_table_num_rows, failure.data());
+    // Check error code from the kernel
+    if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
+  }
+
+  return hash_table;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Probes a hash table built on the build table with the rows of the
+ * probe table and returns the output indices of both tables.
+ *
+ * @param build_table Table of right columns the hash table was built on
+ * @param probe_table Table of left columns to probe with
+ * @param hash_table Hash table built on `build_table` by `build_join_hash_table`
+ * @param flip_join_indices Flag that indicates whether the left and right
+ * tables have been flipped, meaning the output indices should also be flipped.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param scratch_mr Device memory resource used to allocate the temporary counters
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+probe_join_hash_table(table_device_view build_table,
+                      table_device_view probe_table,
+                      multimap_type const& hash_table,
+                      bool flip_join_indices,
+                      cudaStream_t stream,
+                      rmm::mr::device_memory_resource* scratch_mr = rmm::mr::get_default_resource())
+{
+  CUDF_SCOPED_RANGE_PAYLOAD("join_probe", probe_table.num_rows());
+
+  size_type const join_size = get_join_output_size<JoinKind, multimap_type>(
+    build_table, probe_table, hash_table, stream, scratch_mr);
+
+  // If the output size is zero, return immediately
+  if (join_size == 0) {
+    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
+  }
+
+  // The output size is exact, so the indices are written in a single pass
+  rmm::device_scalar<size_type> write_index(0, stream, scratch_mr);
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  detail::grid_1d config(probe_table.num_rows(), block_size);
+
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table};
+  probe_hash_table<JoinKind,
+                   multimap_type,
+                   join_hash_value_type,
+                   block_size,
+                   DEFAULT_JOIN_CACHE_SIZE>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(hash_table,
+                                                                     build_table,
+                                                                     probe_table,
+                                                                     hash_probe,
+                                                                     equality,
+                                                                     probe_table.num_rows(),
+                                                                     left_indices.data().get(),
+                                                                     right_indices.data().get(),
+                                                                     write_index.data(),
+                                                                     join_size,
+                                                                     flip_join_indices);
+
+  CHECK_CUDA(stream);
+
+  CUDF_EXPECTS(write_index.value() == join_size, "Mismatch in the join output size");
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  Computes the join operation between two tables and returns the
@@ -211,84 +301,21 @@ get_base_hash_join_indices(table_view const& left,
     return get_trivial_left_join_indices(left, stream);
   }
 
+  // The hash table and the counters of the build and probe kernels are carved out of one
+  // workspace, which must outlive them
+  scratch_arena arena(
+    scratch_arena::aligned_size(join_hash_table_size(right.num_rows()) *
+                                sizeof(multimap_type::value_type)) +
+    3 * scratch_arena::alignment);
+
   auto build_table = table_device_view::create(right, stream);
-  const size_type build_table_num_rows{build_table->num_rows()};
+  auto hash_table  = build_join_hash_table(*build_table, stream, &arena);
 
   // Probe with the left table
   auto probe_table = table_device_view::create(left, stream);
 
-  size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
-
-  auto hash_table = multimap_type::create(hash_table_size,
-                                          true,
-                                          multimap_type::hasher(),
-                                          multimap_type::key_equal(),
-                                          multimap_type::allocator_type(),
-                                          stream);
-
-  // build the hash table
-  if (build_table_num_rows > 0) {
-    row_hash hash_build{*build_table};
-    rmm::device_scalar<int> failure(0, stream);
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(build_table_num_rows, block_size);
-    build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-      *hash_table, hash_build, build_table_num_rows, failure.data());
-    // Check error code from the kernel
-    if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
-  }
-
-  size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    *build_table, *probe_table, *hash_table, stream);
-
-  // If the estimated output size is zero, return immediately
-  if (estimated_size == 0) {
-    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
-  }
-
-  // Because we are approximating the number of joined elements, our approximation
-  // might be incorrect and we might have underestimated the number of joined elements.
-  // As such we will need to de-allocate memory and re-allocate memory to ensure
-  // that the final output is correct.
-  rmm::device_scalar<size_type> write_index(0, stream);
-  size_type join_size{0};
-
-  rmm::device_vector<size_type> left_indices;
-  rmm::device_vector<size_type> right_indices;
-  auto current_estimated_size = estimated_size;
-  do {
-    left_indices.resize(estimated_size);
-    right_indices.resize(estimated_size);
-
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(probe_table->num_rows(), block_size);
-    write_index.set_value(0);
-
-    row_hash hash_probe{*probe_table};
-    row_equality equality{*probe_table, *build_table};
-    probe_hash_table<JoinKind, multimap_type, hash_value_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(*hash_table,
-                                                                       *build_table,
-                                                                       *probe_table,
-                                                                       hash_probe,
-                                                                       equality,
-                                                                       probe_table->num_rows(),
-                                                                       left_indices.data().get(),
-                                                                       right_indices.data().get(),
-                                                                       write_index.data(),
-                                                                       estimated_size,
-                                                                       flip_join_indices);
-
-    CHECK_CUDA(stream);
-
-    join_size              = write_index.value();
-    current_estimated_size = estimated_size;
-    estimated_size *= 2;
-  } while ((current_estimated_size < join_size));
-
-  left_indices.resize(join_size);
-  right_indices.resize(join_size);
-  return std::make_pair(std::move(left_indices), std::move(right_indices));
+  return probe_join_hash_table<JoinKind>(
+    *build_table, *probe_table, *hash_table, flip_join_indices, stream, &arena);
 }
 
 }  // namespace detail
@@ -13,11 +13,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/memory_estimate.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -25,6 +27,10 @@
 
 #include <join/hash_join.cuh>
 #include <join/join_common_utils.hpp>
+#include <join/partitioned_hash_join.hpp>
+#include <join/sort_merge_join.hpp>
+
+#include <functional>
 
 namespace cudf {
 namespace detail {
@@ -191,6 +197,7 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
  * @param left  Table of left columns to join
  * @param right Table of right  columns to join
  * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param algorithm Algorithm used to compute the join indices
  * @tparam join_kind The type of join to be performed
  *
  * @returns Join output indices vector pair
@@ -198,7 +205,10 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
 /* ----------------------------------------------------------------------------*/
 template <join_kind JoinKind>
 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base_join_indices(
-  table_view const& left, table_view const& right, cudaStream_t stream)
+  table_view const& left,
+  table_view const& right,
+  cudaStream_t stream,
+  join_algorithm algorithm = join_algorithm::HASH)
 {
   CUDF_EXPECTS(0 != left.num_columns(), "Selected left dataset is empty");
   CUDF_EXPECTS(0 != right.num_columns(), "Selected right dataset is empty");
@@ -211,6 +221,12 @@ std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base
 
   constexpr join_kind BaseJoinKind =
     (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
+  if (algorithm == join_algorithm::SORT_MERGE) {
+    return get_sort_merge_join_indices(left, right, BaseJoinKind, stream);
+  }
+  if (algorithm == join_algorithm::PARTITIONED_HASH) {
+    return get_partitioned_hash_join_indices(left, right, BaseJoinKind, stream);
+  }
   return get_base_hash_join_indices<BaseJoinKind>(left, right, false, stream);
 }
 
@@ -440,6 +456,73 @@ std::unique_ptr<table> join_call_compute_df(
     left, right, joined_indices, columns_in_common, mr, stream);
 }
 
+std::unique_ptr<column> indices_to_column(rmm::device_vector<size_type> const& indices,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  return std::make_unique<column>(
+    data_type{type_id::INT32},
+    static_cast<size_type>(indices.size()),
+    rmm::device_buffer{indices.data().get(), indices.size() * sizeof(size_type), stream, mr});
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the row indices of `left` and `right` joined on the
+ * columns given in `left_on` and `right_on`, without gathering any column.
+ *
+ * @throws cudf::logic_error
+ * If number of elements in `left_on` or `right_on` mismatch.
+ * If number of columns in either `left` or `right` table is 0 or exceeds
+ * MAX_JOIN_SIZE
+ * If type mismatch between joining columns
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_on The column's indices from `left` to join on.
+ * @param right_on The column's indices from `right` to join on.
+ * @param algorithm Algorithm used to compute the join indices
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Pair of INT32 columns of row indices into `left` and `right`, where
+ * JoinNoneValue marks the rows without a match
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> join_call_compute_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS(right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  VectorPair joined_indices;
+  if (!is_trivial_join(left, right, left_on, right_on, JoinKind)) {
+    joined_indices = get_base_join_indices<JoinKind>(
+      left.select(left_on), right.select(right_on), stream, algorithm);
+    if (JoinKind == join_kind::FULL_JOIN) {
+      auto complement_indices = get_left_join_indices_complement(
+        joined_indices.second, left.num_rows(), right.num_rows(), stream);
+      joined_indices = concatenate_vector_pairs(complement_indices, joined_indices);
+    }
+  }
+
+  return std::make_pair(indices_to_column(joined_indices.first, mr, stream),
+                        indices_to_column(joined_indices.second, mr, stream));
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> inner_join(
@@ -448,11 +531,12 @@ std::unique_ptr<table> inner_join(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::INNER_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, mr, stream);
 }
 
 std::unique_ptr<table> left_join(
@@ -461,11 +545,12 @@ std::unique_ptr<table> left_join(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::LEFT_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, mr, stream);
 }
 
 std::unique_ptr<table> full_join(
@@ -474,11 +559,267 @@ std::unique_ptr<table> full_join(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::FULL_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::detail::join_kind::INNER_JOIN>(
+    left, right, left_on, right_on, algorithm, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::detail::join_kind::LEFT_JOIN>(
+    left, right, left_on, right_on, algorithm, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::detail::join_kind::FULL_JOIN>(
+    left, right, left_on, right_on, algorithm, mr, stream);
+}
+
+std::size_t estimate_join_memory(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_type type,
+  size_type num_distinct_keys)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  // Rows of the join, before the unmatched rows of `right` are added by a full join
+  auto const left_rows  = static_cast<double>(left.num_rows());
+  auto const right_rows = static_cast<double>(right.num_rows());
+  auto const distinct_keys =
+    static_cast<double>(std::max(num_distinct_keys > 0 ? num_distinct_keys : right.num_rows(), 1));
+  auto base_rows = std::min(left_rows * right_rows / distinct_keys, left_rows * right_rows);
+  if (type != join_type::INNER) { base_rows = std::max(base_rows, left_rows); }
+  auto const max_rows    = static_cast<double>(detail::MAX_JOIN_SIZE);
+  auto const output_rows = static_cast<size_type>(
+    std::min(base_rows + (type == join_type::FULL ? right_rows : 0), max_rows));
+  auto const indices_size = [](double rows) {
+    return 2 * sizeof(size_type) * static_cast<std::size_t>(rows);
+  };
+
+  // Probing holds the hash table of `right` and the row indices of the matches
+  std::size_t probe_size = 0;
+  if (left.num_rows() != 0 && right.num_rows() != 0) {
+    probe_size = detail::join_hash_table_size(right.num_rows()) *
+                   sizeof(detail::multimap_type::value_type) +
+                 indices_size(base_rows);
+  }
+  // A full join appends the complement of the matched rows of `right` to a copy of the indices
+  if (type == join_type::FULL) {
+    probe_size += indices_size(right_rows) + indices_size(output_rows);
+  }
+
+  // Gathering holds the row indices and the output columns
+  std::vector<size_type> right_common_col(columns_in_common.size());
+  std::transform(columns_in_common.begin(),
+                 columns_in_common.end(),
+                 right_common_col.begin(),
+                 [](auto const& c) { return c.second; });
+  auto const nullable = type != join_type::INNER;
+  auto gather_size =
+    indices_size(output_rows) + detail::estimate_gathered_size(left, output_rows, nullable) +
+    detail::estimate_gathered_size(
+      right.select(detail::non_common_column_indices(right.num_columns(), right_common_col)),
+      output_rows,
+      nullable);
+  // The common columns of a full join are gathered from both tables before being concatenated
+  if (type == join_type::FULL) {
+    gather_size +=
+      detail::estimate_gathered_size(right.select(right_common_col), output_rows, true);
+  }
+
+  return std::max(probe_size, gather_size);
+}
+
+/**
+ * @brief Hash table built on the join columns of a build table, probed by `hash_join`
+ */
+class hash_join::impl {
+ public:
+  impl(table_view const& build, std::vector<size_type> const& build_on, cudaStream_t stream)
+    : _build_selected(select_build_columns(build, build_on)),
+      _build_table(table_device_view::create(_build_selected, stream)),
+      _hash_table(detail::build_join_hash_table(*_build_table, stream))
+  {
+  }
+
+  /**
+   * @brief Probes the hash table with the `probe_on` columns of `probe`.
+   *
+   * @tparam JoinKind The type of join to be performed
+   *
+   * @returns Pair of columns of row indices into `probe` and into the build table
+   */
+  template <detail::join_kind JoinKind>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> compute_join(
+    table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream) const
+  {
+    auto const probe_selected = select_probe_columns(probe, probe_on);
+
+    constexpr detail::join_kind BaseJoinKind =
+      (JoinKind == detail::join_kind::FULL_JOIN) ? detail::join_kind::LEFT_JOIN : JoinKind;
+    auto joined_indices = [&]() -> detail::VectorPair {
+      if ((BaseJoinKind == detail::join_kind::LEFT_JOIN) && (_build_selected.num_rows() == 0)) {
+        return detail::get_trivial_left_join_indices(probe_selected, stream);
+      }
+      if ((probe.num_rows() == 0) || (_build_selected.num_rows() == 0)) { return {}; }
+      auto probe_table = table_device_view::create(probe_selected, stream);
+      return detail::probe_join_hash_table<BaseJoinKind>(
+        *_build_table, *probe_table, *_hash_table, false, stream);
+    }();
+
+    if (JoinKind == detail::join_kind::FULL_JOIN) {
+      auto complement_indices = detail::get_left_join_indices_complement(
+        joined_indices.second, probe.num_rows(), _build_selected.num_rows(), stream);
+      joined_indices = detail::concatenate_vector_pairs(complement_indices, joined_indices);
+    }
+
+    return std::make_pair(detail::indices_to_column(joined_indices.first, mr, stream),
+                          detail::indices_to_column(joined_indices.second, mr, stream));
+  }
+
+  /**
+   * @brief Computes the exact number of rows of the join of `probe` with the build table.
+   *
+   * @tparam JoinKind The type of join, either INNER_JOIN or LEFT_JOIN
+   */
+  template <detail::join_kind JoinKind>
+  size_type compute_join_size(table_view const& probe,
+                              std::vector<size_type> const& probe_on,
+                              cudaStream_t stream) const
+  {
+    auto const probe_selected = select_probe_columns(probe, probe_on);
+    if (probe.num_rows() == 0) { return 0; }
+    auto probe_table = table_device_view::create(probe_selected, stream);
+    return detail::get_join_output_size<JoinKind>(
+      *_build_table, *probe_table, *_hash_table, stream);
+  }
+
+ private:
+  table_view select_probe_columns(table_view const& probe,
+                                  std::vector<size_type> const& probe_on) const
+  {
+    CUDF_EXPECTS(probe.num_rows() < detail::MAX_JOIN_SIZE, "Probe column size is too big");
+    CUDF_EXPECTS(probe_on.size() == static_cast<size_t>(_build_selected.num_columns()),
+                 "Mismatch in number of columns to be joined on");
+    auto const probe_selected = probe.select(probe_on);
+    CUDF_EXPECTS(std::equal(std::cbegin(probe_selected),
+                            std::cend(probe_selected),
+                            std::cbegin(_build_selected),
+                            std::cend(_build_selected),
+                            [](const auto& l, const auto& r) { return l.type() == r.type(); }),
+                 "Mismatch in joining column data types");
+    return probe_selected;
+  }
+
+  static table_view select_build_columns(table_view const& build,
+                                         std::vector<size_type> const& build_on)
+  {
+    CUDF_EXPECTS(!build_on.empty(), "No column to join on");
+    CUDF_EXPECTS(build.num_rows() < detail::MAX_JOIN_SIZE, "Build column size is too big");
+    return build.select(build_on);
+  }
+
+  table_view _build_selected;
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _build_table;
+  std::unique_ptr<detail::multimap_type, std::function<void(detail::multimap_type*)>> _hash_table;
+};
+
+hash_join::hash_join(table_view const& build,
+                     std::vector<size_type> const& build_on,
+                     cudaStream_t stream)
+  : _impl{std::make_unique<const impl>(build, build_on, stream)}
+{
+  CUDF_FUNC_RANGE();
+}
+
+hash_join::~hash_join() = default;
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::inner_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join<detail::join_kind::INNER_JOIN>(probe, probe_on, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::left_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join<detail::join_kind::LEFT_JOIN>(probe, probe_on, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::full_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join<detail::join_kind::FULL_JOIN>(probe, probe_on, mr, stream);
+}
+
+size_type hash_join::inner_join_size(table_view const& probe,
+                                     std::vector<size_type> const& probe_on,
+                                     cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join_size<detail::join_kind::INNER_JOIN>(probe, probe_on, stream);
+}
+
+size_type hash_join::left_join_size(table_view const& probe,
+                                    std::vector<size_type> const& probe_on,
+                                    cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join_size<detail::join_kind::LEFT_JOIN>(probe, probe_on, stream);
 }
 
 }  // namespace cudf
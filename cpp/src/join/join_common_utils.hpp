@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/column/column.hpp>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
@@ -36,17 +37,25 @@ constexpr size_type JoinNoneValue     = -1;
 
 using VectorPair = std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>;
 
+/**
+ * @brief Type of the row hash values keying the join hash tables.
+ *
+ * The rows are hashed to 64 bits, so that rows of different keys rarely share a hash value
+ * and need to be compared for equality while probing.
+ */
+using join_hash_value_type = XXHash_64<hash_value_type>::result_type;
+
 using multimap_type =
-  concurrent_unordered_multimap<hash_value_type,
+  concurrent_unordered_multimap<join_hash_value_type,
                                 size_type,
                                 size_t,
-                                std::numeric_limits<hash_value_type>::max(),
+                                std::numeric_limits<join_hash_value_type>::max(),
                                 std::numeric_limits<size_type>::max(),
-                                default_hash<hash_value_type>,
-                                equal_to<hash_value_type>,
-                                default_allocator<thrust::pair<hash_value_type, size_type>>>;
+                                XXHash_64<join_hash_value_type>,
+                                equal_to<join_hash_value_type>,
+                                default_allocator<thrust::pair<join_hash_value_type, size_type>>>;
 
-using row_hash = cudf::row_hasher<default_hash>;
+using row_hash = cudf::row_hasher<XXHash_64>;
 
 using row_equality = cudf::row_equality_comparator<true>;
 
@@ -76,6 +85,19 @@ inline bool is_trivial_join(table_view const& left,
   return false;
 }
 
+/**
+ * @brief Copies a vector of row indices into an INT32 column.
+ *
+ * @param indices Row indices to copy
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns Column containing `indices`
+ */
+std::unique_ptr<column> indices_to_column(rmm::device_vector<size_type> const& indices,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream);
+
 }  // namespace detail
 
 }  // namespace cudf
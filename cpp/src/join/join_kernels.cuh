@@ -74,7 +74,7 @@ __global__ void build_hash_table(multimap_type multi_map,
 
   while (i < build_table_num_rows) {
     // Compute the hash value of this row
-    const hash_value_type row_hash_value{hash_build(i)};
+    const join_hash_value_type row_hash_value{hash_build(i)};
 
     // Insert the (row hash value, row index) into the map
     // using the row hash value to determine the location in the
@@ -130,7 +130,7 @@ __global__ void compute_join_output_size(multimap_type multi_map,
 
     // Search the hash map for the hash value of the probe row using the row's
     // hash value to determine the location where to search for the row in the hash map
-    hash_value_type probe_row_hash_value{0};
+    join_hash_value_type probe_row_hash_value{0};
     // Search the hash map for the hash value of the probe row
     probe_row_hash_value = hash_probe(probe_row_index);
     found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
@@ -285,7 +285,7 @@ __global__ void probe_hash_table(multimap_type multi_map,
     // hash value to determine the location where to search for the row in the hash map
 
     // Only probe the hash table if the probe row is valid
-    hash_value_type probe_row_hash_value{0};
+    join_hash_value_type probe_row_hash_value{0};
     // Search the hash map for the hash value of the probe row
     probe_row_hash_value = hash_probe(probe_row_index);
     found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
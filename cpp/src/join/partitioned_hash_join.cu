@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/partitioned_hash_join.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <join/hash_join.cuh>
+
+#include <thrust/copy.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Hash partitions the rows of a table on all of its columns.
+ *
+ * @returns The partitioned table, with the index of every row in `input` appended as its last
+ * column, and the row offset of each partition
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> partition_with_row_indices(
+  table_view const& input, int num_partitions, cudaStream_t stream)
+{
+  auto row_indices     = make_numeric_column(
+    data_type{type_to_id<size_type>()}, input.num_rows(), mask_state::UNALLOCATED, stream);
+  auto mutable_indices = row_indices->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   mutable_indices.begin<size_type>(),
+                   mutable_indices.end<size_type>());
+
+  std::vector<column_view> columns(input.begin(), input.end());
+  columns.push_back(row_indices->view());
+  std::vector<size_type> columns_to_hash(input.num_columns());
+  std::iota(columns_to_hash.begin(), columns_to_hash.end(), 0);
+  return detail::hash_partition(table_view{columns},
+                                columns_to_hash,
+                                num_partitions,
+                                rmm::mr::get_default_resource(),
+                                stream);
+}
+
+/**
+ * @brief Returns the rows of a partition of a table returned by `partition_with_row_indices`
+ */
+table_view get_partition(
+  std::pair<std::unique_ptr<table>, std::vector<size_type>> const& partitions, size_t partition)
+{
+  auto const begin = partitions.second[partition];
+  auto const end   = (partition + 1 < partitions.second.size()) ? partitions.second[partition + 1]
+                                                                : partitions.first->num_rows();
+  return cudf::slice(partitions.first->view(), {begin, end}).front();
+}
+
+template <join_kind JoinKind>
+VectorPair partitioned_hash_join(table_view const& left,
+                                 table_view const& right,
+                                 cudaStream_t stream)
+{
+  // Power-of-two partition counts are computed with a mask instead of a modulo
+  int num_partitions = 1;
+  while (static_cast<int64_t>(num_partitions) * DEFAULT_JOIN_PARTITION_SIZE < right.num_rows()) {
+    num_partitions *= 2;
+  }
+  if (num_partitions == 1) {
+    return get_base_hash_join_indices<JoinKind>(left, right, false, stream);
+  }
+
+  auto const left_partitions  = partition_with_row_indices(left, num_partitions, stream);
+  auto const right_partitions = partition_with_row_indices(right, num_partitions, stream);
+
+  size_type const num_keys = left.num_columns();
+  std::vector<size_type> key_columns(num_keys);
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+
+  std::vector<VectorPair> partition_indices;
+  size_type join_size = 0;
+  for (int partition = 0; partition < num_partitions; ++partition) {
+    auto const left_part  = get_partition(left_partitions, partition);
+    auto const right_part = get_partition(right_partitions, partition);
+    auto indices          = get_base_hash_join_indices<JoinKind>(
+      left_part.select(key_columns), right_part.select(key_columns), false, stream);
+
+    // Map the rows of the partitions back to the rows of the input tables
+    auto const d_left_rows  = left_part.column(num_keys).data<size_type>();
+    auto const d_right_rows = right_part.column(num_keys).data<size_type>();
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      indices.first.begin(),
+                      indices.first.end(),
+                      indices.first.begin(),
+                      [d_left_rows] __device__(size_type row) { return d_left_rows[row]; });
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      indices.second.begin(),
+                      indices.second.end(),
+                      indices.second.begin(),
+                      [d_right_rows] __device__(size_type row) {
+                        return (row == JoinNoneValue) ? JoinNoneValue : d_right_rows[row];
+                      });
+    join_size += indices.first.size();
+    partition_indices.push_back(std::move(indices));
+  }
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+  size_type offset = 0;
+  for (auto const& indices : partition_indices) {
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 indices.first.begin(),
+                 indices.first.end(),
+                 left_indices.begin() + offset);
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 indices.second.begin(),
+                 indices.second.end(),
+                 right_indices.begin() + offset);
+    offset += indices.first.size();
+  }
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+
+VectorPair get_partitioned_hash_join_indices(table_view const& left,
+                                             table_view const& right,
+                                             join_kind kind,
+                                             cudaStream_t stream)
+{
+  switch (kind) {
+    case join_kind::INNER_JOIN:
+      return partitioned_hash_join<join_kind::INNER_JOIN>(left, right, stream);
+    case join_kind::LEFT_JOIN:
+      return partitioned_hash_join<join_kind::LEFT_JOIN>(left, right, stream);
+    default: CUDF_FAIL("Unsupported join type");
+  }
+}
+
+}  // namespace detail
+
+}  // namespace cudf
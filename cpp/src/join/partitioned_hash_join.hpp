@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <join/join_common_utils.hpp>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Number of build rows per partition of a partitioned hash join, so that the hash table
+ * of a partition fits in the L2 cache
+ */
+constexpr size_type DEFAULT_JOIN_PARTITION_SIZE = 1 << 18;
+
+/**
+ * @brief  Computes the join operation between two tables by hash partitioning
+ * both of them on the joined columns and joining each pair of partitions with
+ * its own hash table, and returns the output indices of left and right table.
+ *
+ * Matching rows always fall into the same partition, so only the rows of one
+ * partition pair are probed against each hash table.
+ *
+ * @throws cudf::logic_error if `kind` is not INNER_JOIN or LEFT_JOIN
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join
+ * @param kind The type of join to be performed
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns Join output indices vector pair
+ */
+VectorPair get_partitioned_hash_join_indices(table_view const& left,
+                                             table_view const& right,
+                                             join_kind kind,
+                                             cudaStream_t stream);
+
+}  // namespace detail
+
+}  // namespace cudf
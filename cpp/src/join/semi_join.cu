@@ -22,7 +22,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
-#include <hash/concurrent_unordered_map.cuh>
+#include <hash/bucketed_hash_map.cuh>
 
 #include <join/join_common_utils.hpp>
 
@@ -31,6 +31,19 @@
 
 namespace cudf {
 namespace detail {
+namespace {
+/**
+ * @brief Maps a row index to the pair of itself as key and value.
+ */
+struct row_pair {
+  __device__ thrust::pair<size_type, size_type> operator()(size_type row) const
+  {
+    return thrust::make_pair(row, row);
+  }
+};
+
+}  // namespace
+
 /**
  * @brief  Performs a left semi or anti join on the specified columns of two
  * tables (left, right)
@@ -39,9 +52,9 @@ namespace detail {
  * returns rows that exist in the right table, a left anti join returns rows
  * that do not exist in the right table.
  *
- * The basic approach is to create a hash table containing the contents of the right
- * table and then select only rows that exist (or don't exist) to be included in
- * the return set.
+ * The basic approach is to create a hash set containing the distinct rows of the
+ * right table and then select only rows that exist (or don't exist) to be included
+ * in the return set.
  *
  * @throws cudf::logic_error if number of columns in either `left` or `right` table is 0
  * @throws cudf::logic_error if number of returned columns is 0
@@ -93,12 +106,12 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
     return std::make_unique<table>(left.select(return_columns), stream, mr);
   }
 
-  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
-  using hash_table_type = concurrent_unordered_map<cudf::size_type, bool, row_hash, row_equality>;
+  // Only care about existence, so we'll use a map of the distinct right rows (other joins need a
+  // multimap of every right row)
+  using hash_map_type = bucketed_hash_map<size_type, size_type, row_hash, row_equality>;
 
-  // Create hash table containing all keys found in right table
-  auto right_rows_d            = table_device_view::create(right.select(right_on), stream);
-  size_t const hash_table_size = compute_hash_table_size(right.num_rows());
+  // Create hash map containing all keys found in right table
+  auto right_rows_d = table_device_view::create(right.select(right_on), stream);
   row_hash hash_build{*right_rows_d};
   row_equality equality_build{*right_rows_d, *right_rows_d};
 
@@ -107,24 +120,28 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
   row_hash hash_probe{*left_rows_d};
   row_equality equality_probe{*left_rows_d, *right_rows_d};
 
-  auto hash_table_ptr = hash_table_type::create(hash_table_size,
-                                                std::numeric_limits<bool>::max(),
-                                                std::numeric_limits<cudf::size_type>::max(),
-                                                hash_build,
-                                                equality_build);
-  auto hash_table     = *hash_table_ptr;
-
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     right.num_rows(),
-                     [hash_table] __device__(size_type idx) mutable {
-                       hash_table.insert(thrust::make_pair(idx, true));
-                     });
+  hash_map_type hash_map(right.num_rows(),
+                         DEFAULT_HASH_TABLE_OCCUPANCY / 100.0,
+                         JoinNoneValue,
+                         JoinNoneValue,
+                         hash_build,
+                         equality_build,
+                         stream);
+  auto const right_rows =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), row_pair{});
+  hash_map.insert(right_rows, right_rows + right.num_rows(), stream);
 
   //
-  // Now we have a hash table, we need to iterate over the rows of the left table
-  // and check to see if they are contained in the hash table
+  // Now we have a hash map, we need to iterate over the rows of the left table
+  // and check to see if they are contained in the hash map
   //
+  rmm::device_vector<bool> found(left.num_rows());
+  hash_map.contains(thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left.num_rows()),
+                    found.begin(),
+                    hash_probe,
+                    equality_probe,
+                    stream);
 
   // For semi join we want contains to be true, for anti join we want contains to be false
   bool join_type_boolean = (JoinKind == join_kind::LEFT_SEMI_JOIN);
@@ -132,18 +149,18 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
   rmm::device_vector<size_type> gather_map(left.num_rows());
 
   // gather_map_end will be the end of valid data in gather_map
-  auto gather_map_end = thrust::copy_if(
-    rmm::exec_policy(stream)->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(left.num_rows()),
-    gather_map.begin(),
-    [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
-      auto pos = hash_table.find(idx, hash_probe, equality_probe);
-      return (pos != hash_table.end()) == join_type_boolean;
-    });
+  auto gather_map_end =
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left.num_rows()),
+                    found.begin(),
+                    gather_map.begin(),
+                    [join_type_boolean] __device__(bool is_found) {
+                      return is_found == join_type_boolean;
+                    });
 
   return cudf::detail::gather(
-    left.select(return_columns), gather_map.begin(), gather_map_end, false, mr);
+    left.select(return_columns), gather_map.begin(), gather_map_end, false, mr, stream);
 }
 }  // namespace detail
 
@@ -152,11 +169,12 @@ std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             std::vector<cudf::size_type> const& return_columns,
-                                            rmm::mr::device_memory_resource* mr)
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_SEMI_JOIN>(
-    left, right, left_on, right_on, return_columns, mr, 0);
+    left, right, left_on, right_on, return_columns, mr, stream);
 }
 
 std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
@@ -164,11 +182,12 @@ std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             std::vector<cudf::size_type> const& return_columns,
-                                            rmm::mr::device_memory_resource* mr)
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_ANTI_JOIN>(
-    left, right, left_on, right_on, return_columns, mr, 0);
+    left, right, left_on, right_on, return_columns, mr, stream);
 }
 
 }  // namespace cudf
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/sort_merge_join.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+
+VectorPair expand_sorted_matches(size_type const* d_lower,
+                                 size_type const* d_upper,
+                                 size_type left_num_rows,
+                                 size_type const* d_order,
+                                 bool keep_unmatched,
+                                 cudaStream_t stream)
+{
+  // Output offset of the matches of each left row; left joins keep unmatched rows
+  rmm::device_vector<size_type> offsets(left_num_rows + 1, 0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_lower,
+                    d_lower + left_num_rows,
+                    d_upper,
+                    offsets.begin(),
+                    [keep_unmatched] __device__(size_type begin, size_type end) {
+                      auto const count = (end > begin) ? end - begin : 0;
+                      return (keep_unmatched && (count == 0)) ? 1 : count;
+                    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+  size_type const join_size = offsets.back();
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+  auto const d_offsets       = offsets.data().get();
+  auto const d_left_indices  = left_indices.data().get();
+  auto const d_right_indices = right_indices.data().get();
+  auto write_output_row = [d_offsets, left_num_rows, d_lower, d_upper, d_order, d_left_indices,
+                           d_right_indices] __device__(size_type output_index) {
+    // Last left row whose matches start at or before the output index
+    size_type const row =
+      thrust::upper_bound(thrust::seq, d_offsets, d_offsets + left_num_rows + 1, output_index) -
+      d_offsets - 1;
+    size_type const sorted_index = d_lower[row] + (output_index - d_offsets[row]);
+    d_left_indices[output_index] = row;
+    d_right_indices[output_index] =
+      (sorted_index < d_upper[row]) ? ((d_order != nullptr) ? d_order[sorted_index] : sorted_index)
+                                    : JoinNoneValue;
+  };
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     join_size,
+                     write_output_row);
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+VectorPair get_sort_merge_join_indices(table_view const& left,
+                                       table_view const& right,
+                                       join_kind kind,
+                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS((kind == join_kind::INNER_JOIN) || (kind == join_kind::LEFT_JOIN),
+               "Unsupported join type");
+  auto const mr = rmm::mr::get_default_resource();
+
+  // Sort the right table, unless it is already ordered (e.g. produced by merge or read from a
+  // sorted file), so that the matches of each left row form a contiguous range
+  std::unique_ptr<column> right_order;
+  std::unique_ptr<table> sorted_right_table;
+  table_view sorted_right = right;
+  if (not cudf::is_sorted(right, {}, {})) {
+    right_order        = detail::sorted_order(right, {}, {}, mr, stream);
+    sorted_right_table = detail::gather(right,
+                                        right_order->view(),
+                                        out_of_bounds_policy::IGNORE,
+                                        negative_index_policy::NOT_ALLOWED,
+                                        mr,
+                                        stream);
+    sorted_right       = sorted_right_table->view();
+  }
+
+  auto const lower = detail::lower_bound(sorted_right, left, {}, {}, mr, stream);
+  auto const upper = detail::upper_bound(sorted_right, left, {}, {}, mr, stream);
+
+  return expand_sorted_matches(lower->view().data<size_type>(),
+                               upper->view().data<size_type>(),
+                               left.num_rows(),
+                               right_order ? right_order->view().data<size_type>() : nullptr,
+                               kind == join_kind::LEFT_JOIN,
+                               stream);
+}
+
+}  // namespace detail
+
+}  // namespace cudf
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <join/join_common_utils.hpp>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief  Expands the ranges of sorted right rows matched by every left row into
+ * the output indices of left and right table.
+ *
+ * The right rows matched by left row `i` are the sorted positions
+ * `[d_lower[i], d_upper[i])`; an empty or reversed range matches nothing.
+ *
+ * @param d_lower First matching sorted position of every left row
+ * @param d_upper One past the last matching sorted position of every left row
+ * @param left_num_rows Number of left rows
+ * @param d_order Right row at every sorted position, or nullptr if the right
+ * rows are already sorted
+ * @param keep_unmatched Whether left rows without a match are paired with JoinNoneValue
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns Join output indices vector pair
+ */
+VectorPair expand_sorted_matches(size_type const* d_lower,
+                                 size_type const* d_upper,
+                                 size_type left_num_rows,
+                                 size_type const* d_order,
+                                 bool keep_unmatched,
+                                 cudaStream_t stream);
+
+/**
+ * @brief  Computes the join operation between two tables by binary searching
+ * the rows of `left` in the sorted rows of `right`, and returns the output
+ * indices of left and right table.
+ *
+ * `right` is sorted first unless it is already in ascending order. `left` does
+ * not need to be sorted. Null values compare equal to each other, as in the
+ * hash join.
+ *
+ * @throws cudf::logic_error if `kind` is not INNER_JOIN or LEFT_JOIN
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join
+ * @param kind The type of join to be performed
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns Join output indices vector pair
+ */
+VectorPair get_sort_merge_join_indices(table_view const& left,
+                                       table_view const& right,
+                                       join_kind kind,
+                                       cudaStream_t stream);
+
+}  // namespace detail
+
+}  // namespace cudf
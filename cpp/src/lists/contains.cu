@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <lists/utilities.cuh>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/contains.hpp>
+#include <cudf/lists/list_view.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+namespace {
+template <typename Element>
+constexpr bool is_supported()
+{
+  return !std::is_same<Element, list_view>::value && !std::is_same<Element, dictionary32>::value;
+}
+
+/**
+ * @brief Sets the result of every list holding an element equal to the search key.
+ *
+ * One thread handles each element and finds its list in the offsets, so that
+ * the work does not depend on the lengths of the lists.
+ */
+struct contains_fn {
+  template <typename Element, std::enable_if_t<is_supported<Element>()>* = nullptr>
+  void operator()(lists_column_view const& lists,
+                  scalar const& search_key,
+                  bool* d_results,
+                  cudaStream_t stream)
+  {
+    using ScalarType = cudf::scalar_type_t<Element>;
+    auto const range = element_range(lists, stream);
+    if (range.first == range.second) { return; }
+
+    auto const d_child   = column_device_view::create(lists.child(), stream);
+    auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+    auto const num_rows  = lists.size();
+    auto const key       = static_cast<ScalarType const&>(search_key).value(stream);
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(range.first),
+                     thrust::make_counting_iterator<size_type>(range.second),
+                     [child = *d_child, d_offsets, num_rows, key, d_results] __device__(
+                       size_type idx) {
+                       if (child.is_valid(idx) && child.element<Element>(idx) == key) {
+                         // Concurrent stores all write the same value
+                         auto const ends = d_offsets + 1;
+                         auto const row =
+                           thrust::upper_bound(thrust::seq, ends, ends + num_rows, idx) - ends;
+                         d_results[row] = true;
+                       }
+                     });
+  }
+
+  template <typename Element, std::enable_if_t<!is_supported<Element>()>* = nullptr>
+  void operator()(lists_column_view const&, scalar const&, bool*, cudaStream_t)
+  {
+    CUDF_FAIL("contains is not supported for nested or dictionary elements");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> contains(
+  lists_column_view const& lists,
+  scalar const& search_key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto const num_rows = lists.size();
+  if (num_rows == 0) { return make_empty_column(data_type{BOOL8}); }
+  CUDF_EXPECTS(search_key.type() == lists.child().type(),
+               "Type mismatch between the search key and the list elements");
+  if (!search_key.is_valid()) {
+    return make_fixed_width_column(data_type{BOOL8}, num_rows, mask_state::ALL_NULL, stream, mr);
+  }
+
+  auto results = make_fixed_width_column(data_type{BOOL8},
+                                         num_rows,
+                                         copy_bitmask(lists.parent(), stream, mr),
+                                         lists.null_count(),
+                                         stream,
+                                         mr);
+  auto const d_results = results->mutable_view().data<bool>();
+  thrust::fill_n(rmm::exec_policy(stream)->on(stream), d_results, num_rows, false);
+  type_dispatcher(lists.child().type(), contains_fn{}, lists, search_key, d_results, stream);
+  return results;
+}
+
+}  // namespace detail
+
+// external APIS
+
+std::unique_ptr<column> contains(lists_column_view const& lists,
+                                 scalar const& search_key,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(lists, search_key, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <lists/utilities.cuh>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/lists/detail/concatenate.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  auto const num_rows = std::accumulate(
+    columns.begin(), columns.end(), size_type{0}, [](size_type count, column_view const& col) {
+      return count + col.size();
+    });
+  if (num_rows == 0) { return make_empty_column(data_type{type_id::LIST}); }
+
+  auto offsets = make_numeric_column(
+    data_type{INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = offsets->mutable_view().data<size_type>();
+
+  // Shift the offsets of every input past the elements of the previous ones; the last offset
+  // of one input and the first of the next are the same value so they may overlap
+  std::vector<column_view> children;
+  size_type row_offset     = 0;
+  size_type element_offset = 0;
+  for (auto const& col : columns) {
+    if (col.size() == 0) { continue; }
+    lists_column_view const lists(col);
+    auto const range        = element_range(lists, stream);
+    auto const d_offsets_in = lists.offsets().data<size_type>() + lists.offset();
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      d_offsets_in,
+                      d_offsets_in + lists.size() + 1,
+                      d_offsets + row_offset,
+                      [shift = element_offset - range.first] __device__(size_type offset) {
+                        return offset + shift;
+                      });
+    children.push_back(cudf::slice(lists.child(), {range.first, range.second}).front());
+    row_offset += lists.size();
+    element_offset += range.second - range.first;
+  }
+  auto child = cudf::detail::concatenate(children, mr, stream);
+
+  bool const has_nulls =
+    std::any_of(columns.begin(), columns.end(), [](auto const& col) { return col.has_nulls(); });
+  rmm::device_buffer null_mask{0, stream, mr};
+  size_type null_count = 0;
+  if (has_nulls) {
+    null_mask = create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr);
+    cudf::detail::concatenate_masks(columns, static_cast<bitmask_type*>(null_mask.data()), stream);
+    null_count = std::accumulate(
+      columns.begin(), columns.end(), size_type{0}, [](size_type count, column_view const& col) {
+        return count + col.null_count();
+      });
+  }
+
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(child),
+                           null_count,
+                           std::move(null_mask),
+                           stream,
+                           mr);
+}
+
+}  // namespace detail
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/count_elements.hpp>
+#include <cudf/null_mask.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/functional.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+std::unique_ptr<column> count_elements(
+  lists_column_view const& lists,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto const num_rows = lists.size();
+
+  auto results = make_numeric_column(data_type{INT32},
+                                     num_rows,
+                                     copy_bitmask(lists.parent(), stream, mr),
+                                     lists.null_count(),
+                                     stream,
+                                     mr);
+  if (num_rows == 0) { return results; }
+
+  // The number of elements of each list is the difference of its offsets
+  auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_offsets + 1,
+                    d_offsets + num_rows + 1,
+                    d_offsets,
+                    results->mutable_view().data<size_type>(),
+                    thrust::minus<size_type>());
+  return results;
+}
+
+}  // namespace detail
+
+// external APIS
+
+std::unique_ptr<column> count_elements(lists_column_view const& lists,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_elements(lists, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
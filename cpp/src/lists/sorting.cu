@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <lists/utilities.cuh>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/lists/sorting.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+std::unique_ptr<column> sort_lists(
+  lists_column_view const& lists,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto const num_rows = lists.size();
+  if (num_rows == 0) { return make_empty_column(data_type{type_id::LIST}); }
+  auto const child = lists.child();
+  CUDF_EXPECTS(child.type().id() != type_id::LIST, "Sorting nested lists is not supported");
+
+  // Offsets of the output lists, starting at zero
+  auto const range = element_range(lists, stream);
+  auto offsets     = make_numeric_column(
+    data_type{INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_offsets,
+                    d_offsets + num_rows + 1,
+                    offsets->mutable_view().data<size_type>(),
+                    [first = range.first] __device__(size_type offset) { return offset - first; });
+
+  // A single sort of the elements on their row, then on their value, sorts every list
+  auto const rows     = element_rows(lists, range, stream);
+  auto const elements = cudf::slice(child, {range.first, range.second}).front();
+  column_view const rows_view(
+    data_type{INT32}, static_cast<size_type>(rows.size()), rows.data().get());
+  auto const sorted_order =
+    cudf::detail::stable_sorted_order(table_view{{rows_view, elements}},
+                                      {order::ASCENDING, column_order},
+                                      {null_order::BEFORE, null_precedence},
+                                      rmm::mr::get_default_resource(),
+                                      stream);
+  auto const map = sorted_order->view();
+  auto sorted    = cudf::detail::gather(
+    table_view{{elements}}, map.begin<size_type>(), map.end<size_type>(), false, mr, stream);
+
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(sorted->release().front()),
+                           lists.null_count(),
+                           copy_bitmask(lists.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
+}  // namespace detail
+
+// external APIS
+
+std::unique_ptr<column> sort_lists(lists_column_view const& lists,
+                                   order column_order,
+                                   null_order null_precedence,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_lists(lists, column_order, null_precedence, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/get_value.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <utility>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+/**
+ * @brief Returns the range `[first, last)` of the child elements held by the rows of `lists`
+ *
+ * @param lists Lists instance for this operation.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+inline std::pair<size_type, size_type> element_range(lists_column_view const& lists,
+                                                     cudaStream_t stream = 0)
+{
+  if (lists.size() == 0) { return {0, 0}; }
+  auto const offsets = lists.offsets();
+  return {cudf::detail::get_value<size_type>(offsets, lists.offset(), stream),
+          cudf::detail::get_value<size_type>(offsets, lists.offset() + lists.size(), stream)};
+}
+
+/**
+ * @brief Returns the row of `lists` holding each child element of `range`
+ *
+ * The rows are found with a vectorized binary search of the element indices in the offsets,
+ * so that the work is spread over the elements instead of the rows.
+ *
+ * @param lists Lists instance for this operation.
+ * @param range Range of child elements, as returned by `element_range`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Row of each element of `range`
+ */
+inline rmm::device_vector<size_type> element_rows(lists_column_view const& lists,
+                                                   std::pair<size_type, size_type> range,
+                                                   cudaStream_t stream = 0)
+{
+  rmm::device_vector<size_type> rows(range.second - range.first);
+  if (rows.empty()) { return rows; }
+  auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      d_offsets + 1,
+                      d_offsets + lists.size() + 1,
+                      thrust::make_counting_iterator<size_type>(range.first),
+                      thrust::make_counting_iterator<size_type>(range.second),
+                      rows.begin());
+  return rows;
+}
+
+}  // namespace detail
+}  // namespace lists
+}  // namespace cudf
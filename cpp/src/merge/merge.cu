@@ -14,7 +14,10 @@
  * limitations under the License.
  */
 #include <rmm/thrust_rmm_allocator.h>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
@@ -22,9 +25,15 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/swap.h>
 #include <thrust/tuple.h>
 
 #include <queue>
@@ -380,6 +389,254 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
+/**
+ * @brief Row comparisons of a stable k-way merge of the tables of a concatenation.
+ *
+ * Rows are ordered by `comparator`, and equivalent rows by their table.
+ */
+template <typename Comparator>
+struct kway_merge_order {
+  Comparator comparator;
+  size_type const* table_offsets;
+
+  /**
+   * @brief Returns the number of rows of table `table` merged before row `row` of table
+   * `source`.
+   */
+  __device__ size_type rows_before(size_type table, size_type source, size_type row) const
+  {
+    size_type begin = table_offsets[table];
+    size_type end   = table_offsets[table + 1];
+    while (begin < end) {
+      auto const mid    = begin + (end - begin) / 2;
+      bool const before = table < source ? not comparator(row, mid) : comparator(mid, row);
+      if (before) {
+        begin = mid + 1;
+      } else {
+        end = mid;
+      }
+    }
+    return begin - table_offsets[table];
+  }
+
+  /**
+   * @brief Returns whether the next row of table `lhs` is merged before the next row of table
+   * `rhs`, given the positions of the next rows within their tables.
+   */
+  __device__ bool is_before(size_type lhs, size_type rhs, size_type const* positions) const
+  {
+    auto const lhs_row = table_offsets[lhs] + positions[lhs];
+    auto const rhs_row = table_offsets[rhs] + positions[rhs];
+    if (comparator(lhs_row, rhs_row)) { return true; }
+    return lhs < rhs and not comparator(rhs_row, lhs_row);
+  }
+};
+
+/**
+ * @brief Writes the row of every output position of a k-way merge to `merged_order`.
+ *
+ * This is a merge path over the `k` input tables. Every `splitter_rows`-th row of every table
+ * is a splitter. The cut of a splitter is the number of rows of each table merged before it,
+ * found by one binary search per table. Consecutive splitters in merged order bound a tile of
+ * fewer than `num_tables * splitter_rows` output rows, which one thread merges sequentially
+ * with a binary heap of the next row of every table. Each output row thus costs `O(log k)`
+ * comparisons plus the amortized splitter searches, where pairwise merging touches every row
+ * `O(log k)` times.
+ *
+ * @param merge_order Row comparisons of the merge
+ * @param table_offsets Offsets of the tables in the concatenation, including the end offset
+ * of the last table
+ * @param[out] merged_order The rows of the concatenated tables in merged order
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename Comparator>
+void kway_merged_order(kway_merge_order<Comparator> merge_order,
+                       std::vector<size_type> const& table_offsets,
+                       size_type* merged_order,
+                       cudaStream_t stream)
+{
+  auto const num_tables    = static_cast<size_type>(table_offsets.size()) - 1;
+  auto const splitter_rows = std::max<size_type>(256, 32 * num_tables);
+  auto execpol             = rmm::exec_policy(stream);
+
+  // Rows `splitter_rows`, `2 * splitter_rows`, ... of each table are its splitters
+  std::vector<size_type> splitter_offsets{0};
+  for (size_type i = 0; i < num_tables; ++i) {
+    auto const rows = table_offsets[i + 1] - table_offsets[i];
+    splitter_offsets.push_back(splitter_offsets.back() + std::max(rows - 1, 0) / splitter_rows);
+  }
+  auto const num_splitters = splitter_offsets.back();
+  rmm::device_vector<size_type> d_splitter_offsets(splitter_offsets);
+
+  // Cut 0 is the start of every table, cut `q + 1` is of splitter `q`, and the last cut is the
+  // end of every table
+  rmm::device_vector<size_type> cuts(static_cast<std::size_t>(num_splitters + 2) * num_tables);
+  auto const d_cuts            = cuts.data().get();
+  auto const d_table_offsets   = merge_order.table_offsets;
+  auto const d_splitter_begins = d_splitter_offsets.data().get();
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_tables,
+    [d_cuts, d_table_offsets, num_splitters, num_tables] __device__(size_type table) {
+      d_cuts[table] = 0;
+      d_cuts[static_cast<std::size_t>(num_splitters + 1) * num_tables + table] =
+        d_table_offsets[table + 1] - d_table_offsets[table];
+    });
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<std::size_t>(0),
+    static_cast<std::size_t>(num_splitters) * num_tables,
+    [merge_order, d_cuts, d_table_offsets, d_splitter_begins, num_tables, splitter_rows] __device__(
+      std::size_t idx) {
+      auto const splitter = static_cast<size_type>(idx / num_tables);
+      auto const table    = static_cast<size_type>(idx % num_tables);
+      // Tables without splitters repeat an offset, so take the last table starting at or
+      // before `splitter`
+      auto const source = static_cast<size_type>(
+        thrust::upper_bound(
+          thrust::seq, d_splitter_begins, d_splitter_begins + num_tables + 1, splitter) -
+        d_splitter_begins - 1);
+      auto const position = (splitter - d_splitter_begins[source] + 1) * splitter_rows;
+      auto const row      = d_table_offsets[source] + position;
+      d_cuts[(splitter + 1) * static_cast<std::size_t>(num_tables) + table] =
+        table == source ? position : merge_order.rows_before(table, source, row);
+    });
+
+  // Order the cuts by their merged rank, the number of rows merged before them
+  rmm::device_vector<size_type> ranks(num_splitters);
+  rmm::device_vector<size_type> boundaries(num_splitters + 2);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(1),
+                    thrust::make_counting_iterator<size_type>(num_splitters + 1),
+                    ranks.begin(),
+                    [d_cuts, num_tables] __device__(size_type cut) {
+                      auto const begin = d_cuts + static_cast<std::size_t>(cut) * num_tables;
+                      return thrust::reduce(thrust::seq, begin, begin + num_tables);
+                    });
+  thrust::sequence(execpol->on(stream), boundaries.begin(), boundaries.end(), 0);
+  thrust::sort_by_key(execpol->on(stream), ranks.begin(), ranks.end(), boundaries.begin() + 1);
+
+  // Merge each tile between consecutive cuts, keeping a heap of tables and the position of the
+  // next row in each table per tile
+  auto const num_tiles = num_splitters + 1;
+  rmm::device_vector<size_type> heaps(static_cast<std::size_t>(num_tiles) * num_tables);
+  rmm::device_vector<size_type> positions(static_cast<std::size_t>(num_tiles) * num_tables);
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_tiles,
+    [merge_order,
+     d_cuts,
+     d_table_offsets,
+     d_boundaries = boundaries.data().get(),
+     d_heaps      = heaps.data().get(),
+     d_positions  = positions.data().get(),
+     num_tables,
+     merged_order] __device__(size_type tile) {
+      auto const tile_offset = static_cast<std::size_t>(tile) * num_tables;
+      auto const begin_cut   = d_cuts + static_cast<std::size_t>(d_boundaries[tile]) * num_tables;
+      auto const end_cut = d_cuts + static_cast<std::size_t>(d_boundaries[tile + 1]) * num_tables;
+      auto const heap    = d_heaps + tile_offset;
+      auto const pos     = d_positions + tile_offset;
+
+      auto const sift_down = [&](size_type node, size_type heap_size) {
+        while (2 * node + 1 < heap_size) {
+          auto child = 2 * node + 1;
+          if (child + 1 < heap_size and merge_order.is_before(heap[child + 1], heap[child], pos)) {
+            ++child;
+          }
+          if (not merge_order.is_before(heap[child], heap[node], pos)) { break; }
+          thrust::swap(heap[child], heap[node]);
+          node = child;
+        }
+      };
+
+      size_type heap_size = 0;
+      size_type out       = 0;
+      for (size_type table = 0; table < num_tables; ++table) {
+        pos[table] = begin_cut[table];
+        out += begin_cut[table];
+        if (begin_cut[table] < end_cut[table]) { heap[heap_size++] = table; }
+      }
+      for (size_type node = heap_size / 2 - 1; node >= 0; --node) {
+        sift_down(node, heap_size);
+      }
+      while (heap_size > 0) {
+        auto const table    = heap[0];
+        merged_order[out++] = d_table_offsets[table] + pos[table];
+        if (++pos[table] == end_cut[table]) { heap[0] = heap[--heap_size]; }
+        sift_down(0, heap_size);
+      }
+    });
+}
+
+/**
+ * @brief Merges any number of sorted tables in a single pass.
+ *
+ * The tables are concatenated, the merged order of all their rows is computed at once by
+ * `kway_merged_order` and the rows are gathered into the output. The concatenation is the
+ * only temporary copy of the rows, where merging pairwise materializes an intermediate table
+ * for every level of the merge tree.
+ */
+table_ptr_type kway_merge(std::vector<table_view> const& tables_to_merge,
+                          std::vector<cudf::size_type> const& key_cols,
+                          std::vector<cudf::order> const& column_order,
+                          std::vector<cudf::null_order> const& null_precedence,
+                          rmm::mr::device_memory_resource* mr,
+                          cudaStream_t stream)
+{
+  std::vector<size_type> table_offsets{0};
+  for (auto const& tbl : tables_to_merge) {
+    table_offsets.push_back(table_offsets.back() + tbl.num_rows());
+  }
+  auto const num_rows = table_offsets.back();
+
+  auto const concatenated =
+    cudf::detail::concatenate(tables_to_merge, rmm::mr::get_default_resource(), stream);
+  auto const index_view   = concatenated->view().select(key_cols);
+  auto const d_index_view = table_device_view::create(index_view, stream);
+
+  rmm::device_vector<size_type> d_table_offsets(table_offsets);
+  rmm::device_vector<order> d_column_order(column_order);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+
+  auto merged_order = make_numeric_column(data_type(type_to_id<size_type>()),
+                                          num_rows,
+                                          mask_state::UNALLOCATED,
+                                          stream,
+                                          rmm::mr::get_default_resource());
+  auto const d_merged_order = merged_order->mutable_view().data<size_type>();
+  if (cudf::has_nulls(index_view)) {
+    using comparator_type = row_lexicographic_comparator<true>;
+    kway_merged_order(kway_merge_order<comparator_type>{
+                        comparator_type(*d_index_view,
+                                        *d_index_view,
+                                        d_column_order.data().get(),
+                                        d_null_precedence.data().get()),
+                        d_table_offsets.data().get()},
+                      table_offsets,
+                      d_merged_order,
+                      stream);
+  } else {
+    using comparator_type = row_lexicographic_comparator<false>;
+    kway_merged_order(
+      kway_merge_order<comparator_type>{
+        comparator_type(*d_index_view, *d_index_view, d_column_order.data().get()),
+        d_table_offsets.data().get()},
+      table_offsets,
+      d_merged_order,
+      stream);
+  }
+
+  return detail::gather(concatenated->view(),
+                        merged_order->view(),
+                        out_of_bounds_policy::NULLIFY,
+                        negative_index_policy::NOT_ALLOWED,
+                        mr,
+                        stream);
+}
+
 struct merge_queue_item {
   table_view view;
   table_ptr_type table;
@@ -446,8 +703,12 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   // No inputs have rows, return a table with same columns as the first one
   if (merge_queue.empty()) { return empty_like(first_table); }
 
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
+  // More than two tables are merged in a single pass rather than pairwise
+  if (merge_queue.size() > 2) {
+    return kway_merge(tables_to_merge, key_cols, column_order, null_precedence, mr, stream);
+  }
+
+  // Merge the two remaining tables
   while (merge_queue.size() > 1) {
     // To delete the intermediate table at the end of the block
     auto const left_table = top_and_pop(merge_queue);
@@ -17,14 +17,31 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+
+#include <algorithm>
+#include <array>
 
 namespace cudf {
 namespace {
@@ -38,6 +55,9 @@ constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
 constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
 
+// Number of rows sampled per partition to choose the splitters of range partition
+constexpr size_type RANGE_PARTITION_SAMPLES_PER_PARTITION = 32;
+
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses the modulo operation.
@@ -47,7 +67,12 @@ class modulo_partitioner {
  public:
   modulo_partitioner(size_type num_partitions) : divisor{num_partitions} {}
 
-  __device__ size_type operator()(hash_value_t hash_value) const { return hash_value % divisor; }
+  __device__ size_type operator()(hash_value_t hash_value) const
+  {
+    // Signed hash values are mapped to their positive modulo, like Spark's `Pmod`
+    size_type const remainder = hash_value % static_cast<hash_value_t>(divisor);
+    return remainder < 0 ? remainder + divisor : remainder;
+  }
 
  private:
   const size_type divisor;
@@ -59,6 +84,10 @@ bool is_power_two(T number)
   return (0 == (number & (number - 1)));
 }
 
+// Type of the row hash values computed with `hash_function`
+template <template <typename> class hash_function>
+using hash_result_type = typename row_hasher<hash_function>::result_type;
+
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses a bitwise mask. Only works when num_partitions is a power of 2.
@@ -138,7 +167,7 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   // and compute the partition to which the hash value belongs and increment
   // the shared memory counter for that partition
   while (row_number < num_rows) {
-    const hash_value_type row_hash_value = the_hasher(row_number);
+    auto const row_hash_value = the_hasher(row_number);
 
     const size_type partition_number = the_partitioner(row_hash_value);
 
@@ -394,6 +423,7 @@ struct copy_block_partitions_dispatcher {
                                      size_type const* block_partition_sizes,
                                      size_type const* scanned_block_partition_sizes,
                                      size_type grid_size,
+                                     rmm::device_vector<size_type> const&,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
   {
@@ -415,26 +445,17 @@ struct copy_block_partitions_dispatcher {
 
   template <typename DataType, std::enable_if_t<not is_fixed_width<DataType>()>* = nullptr>
   std::unique_ptr<column> operator()(column_view const& input,
-                                     const size_type num_partitions,
-                                     size_type const* row_partition_numbers,
-                                     size_type const* row_partition_offset,
-                                     size_type const* block_partition_sizes,
-                                     size_type const* scanned_block_partition_sizes,
-                                     size_type grid_size,
+                                     const size_type,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type,
+                                     rmm::device_vector<size_type> const& gather_map,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
   {
-    // Use move_to_output_buffer to create an equivalent gather map
-    auto gather_map = compute_gather_map(input.size(),
-                                         num_partitions,
-                                         row_partition_numbers,
-                                         row_partition_offset,
-                                         block_partition_sizes,
-                                         scanned_block_partition_sizes,
-                                         grid_size,
-                                         stream);
-
-    // Use gather instead for non-fixed width types
+    // Use gather with the gather map shared by all non-fixed-width columns
     return type_dispatcher(input.type(),
                            detail::column_gatherer{},
                            input,
@@ -446,8 +467,115 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
+/**
+ * @brief Computes which partition each row of `table_to_hash` belongs to.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls, typename partitioner_type>
+void compute_partition_numbers(table_device_view const& table_to_hash,
+                               partitioner_type partitioner,
+                               size_type* row_partition_numbers,
+                               cudaStream_t stream)
+{
+  auto const hasher = row_hasher<hash_function, hash_has_nulls>(table_to_hash);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(table_to_hash.num_rows()),
+                    row_partition_numbers,
+                    [hasher, partitioner] __device__(size_type row) {
+                      return partitioner(hasher(row));
+                    });
+}
+
+/**
+ * @brief Hash partitions `input` into more partitions than the shared memory histograms
+ * of `copy_block_partitions` can hold.
+ *
+ * The partition numbers are radix sorted together with the row indices, which only takes
+ * as many passes as there are radix digits in `num_partitions - 1`, e.g. two passes for
+ * 4096 partitions. The sorted row indices are then used to gather every column, and the
+ * partition offsets are found by searching the sorted partition numbers. Unlike per block
+ * histograms, the temporary memory does not grow with the number of partitions times the
+ * number of thread blocks.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> radix_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_rows = table_to_hash.num_rows();
+
+  rmm::device_vector<size_type> row_partition_numbers(num_rows);
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  if (is_power_two(num_partitions)) {
+    compute_partition_numbers<hash_function, hash_has_nulls>(
+      *device_input,
+      bitwise_partitioner<hash_result_type<hash_function>>(num_partitions),
+      row_partition_numbers.data().get(),
+      stream);
+  } else {
+    compute_partition_numbers<hash_function, hash_has_nulls>(
+      *device_input,
+      modulo_partitioner<hash_result_type<hash_function>>(num_partitions),
+      row_partition_numbers.data().get(),
+      stream);
+  }
+
+  // Partition numbers are non-negative, only their low bits need sorting
+  int end_bit = 1;
+  while ((size_type{1} << end_bit) < num_partitions) { ++end_bit; }
+
+  rmm::device_vector<size_type> sorted_partition_numbers(num_rows);
+  rmm::device_vector<size_type> row_indices(num_rows);
+  rmm::device_vector<size_type> gather_map(num_rows);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), row_indices.begin(), row_indices.end());
+
+  size_t temp_storage_bytes = 0;
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(nullptr,
+                                           temp_storage_bytes,
+                                           row_partition_numbers.data().get(),
+                                           sorted_partition_numbers.data().get(),
+                                           row_indices.data().get(),
+                                           gather_map.data().get(),
+                                           num_rows,
+                                           0,
+                                           end_bit,
+                                           stream));
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                           temp_storage_bytes,
+                                           row_partition_numbers.data().get(),
+                                           sorted_partition_numbers.data().get(),
+                                           row_indices.data().get(),
+                                           gather_map.data().get(),
+                                           num_rows,
+                                           0,
+                                           end_bit,
+                                           stream));
+
+  // The first row of each partition in the output
+  rmm::device_vector<size_type> d_partition_offsets(num_partitions);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      sorted_partition_numbers.begin(),
+                      sorted_partition_numbers.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_partitions),
+                      d_partition_offsets.begin());
+  std::vector<size_type> partition_offsets(num_partitions);
+  CUDA_TRY(cudaMemcpyAsync(partition_offsets.data(),
+                           d_partition_offsets.data().get(),
+                           num_partitions * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+
+  auto output = detail::gather(input, gather_map.begin(), gather_map.end(), false, mr, stream);
+  return std::make_pair(std::move(output), std::move(partition_offsets));
+}
+
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
-template <bool hash_has_nulls>
+template <template <typename> class hash_function, bool hash_has_nulls>
 std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   table_view const& input,
   table_view const& table_to_hash,
@@ -457,11 +585,15 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
 {
   auto const num_rows = table_to_hash.num_rows();
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+  // The shared memory histograms of copy_block_partitions can only hold a limited number of
+  // partitions, more partitions are radix sorted instead
+  if (num_partitions > THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL) {
+    return radix_partition_table<hash_function, hash_has_nulls>(
+      input, table_to_hash, num_partitions, mr, stream);
+  }
+
+  auto const block_size     = OPTIMIZED_BLOCK_SIZE;
+  auto const rows_per_block = block_size * OPTIMIZED_ROWS_PER_THREAD;
 
   // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
   auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
@@ -485,14 +617,14 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto row_partition_offset = rmm::device_vector<size_type>(num_rows);
 
   auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input);
+  auto const hasher       = row_hasher<hash_function, hash_has_nulls>(*device_input);
 
   // If the number of partitions is a power of two, we can compute the partition
   // number of each row more efficiently with bitwise operations
   if (is_power_two(num_partitions)) {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = bitwise_partitioner<hash_value_type>;
+    using partitioner_type = bitwise_partitioner<hash_result_type<hash_function>>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -512,7 +644,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   } else {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = modulo_partitioner<hash_value_type>;
+    using partitioner_type = modulo_partitioner<hash_result_type<hash_function>>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -556,69 +688,408 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                            cudaMemcpyDeviceToHost,
                            stream));
 
-  // When the number of partitions is less than a threshold, we can apply an
-  // optimization using shared memory to copy values to the output buffer.
-  // Otherwise, fallback to using scatter.
-  if (use_optimization) {
-    std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
-
-    // NOTE these pointers are non-const to workaround lambda capture bug in
-    // gcc 5.4
-    auto row_partition_numbers_ptr{row_partition_numbers.data().get()};
-    auto row_partition_offset_ptr{row_partition_offset.data().get()};
-    auto block_partition_sizes_ptr{block_partition_sizes.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-
-    // Copy input to output by partition per column
-    std::transform(input.begin(), input.end(), output_cols.begin(), [=](auto const& col) {
-      return cudf::type_dispatcher(col.type(),
-                                   copy_block_partitions_dispatcher{},
-                                   col,
-                                   num_partitions,
-                                   row_partition_numbers_ptr,
-                                   row_partition_offset_ptr,
-                                   block_partition_sizes_ptr,
-                                   scanned_block_partition_sizes_ptr,
-                                   grid_size,
-                                   mr,
-                                   stream);
+  std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
+
+  // NOTE these pointers are non-const to workaround lambda capture bug in
+  // gcc 5.4
+  auto row_partition_numbers_ptr{row_partition_numbers.data().get()};
+  auto row_partition_offset_ptr{row_partition_offset.data().get()};
+  auto block_partition_sizes_ptr{block_partition_sizes.data().get()};
+  auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
+
+  // Columns that are not fixed-width and the bitmasks are gathered with a single gather map
+  // computed by copy_block_partitions, instead of one gather map per column
+  bool const needs_gather_map =
+    has_nulls(input) or std::any_of(input.begin(), input.end(), [](auto const& col) {
+      return not is_fixed_width(col.type());
     });
+  auto const gather_map = needs_gather_map
+                            ? compute_gather_map(num_rows,
+                                                 num_partitions,
+                                                 row_partition_numbers_ptr,
+                                                 row_partition_offset_ptr,
+                                                 block_partition_sizes_ptr,
+                                                 scanned_block_partition_sizes_ptr,
+                                                 grid_size,
+                                                 stream)
+                            : rmm::device_vector<size_type>{};
+
+  // Copy input to output by partition per column
+  std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
+    return cudf::type_dispatcher(col.type(),
+                                 copy_block_partitions_dispatcher{},
+                                 col,
+                                 num_partitions,
+                                 row_partition_numbers_ptr,
+                                 row_partition_offset_ptr,
+                                 block_partition_sizes_ptr,
+                                 scanned_block_partition_sizes_ptr,
+                                 grid_size,
+                                 gather_map,
+                                 mr,
+                                 stream);
+  });
+
+  if (has_nulls(input)) {
+    // Handle bitmask using gather to take advantage of ballot_sync
+    detail::gather_bitmask(
+      input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, mr, stream);
+  }
+
+  auto output{std::make_unique<table>(std::move(output_cols))};
+  return std::make_pair(std::move(output), std::move(partition_offsets));
+}
+
+/**
+ * @brief The partition and output location of every row of a hash partitioned table
+ */
+struct partition_locations {
+  rmm::device_vector<size_type> row_partition_numbers;  ///< Partition of every row
+  rmm::device_vector<size_type> row_output_locations;   ///< Row of every row in the output
+  std::vector<size_type> partition_offsets;  ///< First row of every partition, and the end
+};
+
+/**
+ * @brief Computes the partition and output location of every row of `table_to_hash`.
+ *
+ * Uses the same kernels as the scatter path of `hash_partition_table`.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+partition_locations compute_partition_locations(table_view const& table_to_hash,
+                                                size_type num_partitions,
+                                                cudaStream_t stream)
+{
+  auto const num_rows = table_to_hash.num_rows();
+  auto const grid_size =
+    util::div_rounding_up_safe(num_rows, FALLBACK_BLOCK_SIZE * FALLBACK_ROWS_PER_THREAD);
+
+  partition_locations locations{rmm::device_vector<size_type>(num_rows),
+                                rmm::device_vector<size_type>(num_rows),
+                                std::vector<size_type>(num_partitions + 1)};
+  auto row_partition_offset          = rmm::device_vector<size_type>(num_rows);
+  auto block_partition_sizes         = rmm::device_vector<size_type>(grid_size * num_partitions);
+  auto scanned_block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+  // The extra element becomes the total number of rows after the scan
+  auto global_partition_sizes = rmm::device_vector<size_type>(num_partitions + 1, size_type{0});
+
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<hash_function, hash_has_nulls>(*device_input);
+  auto const compute_partition_numbers = [&](auto partitioner) {
+    compute_row_partition_numbers<<<grid_size,
+                                    FALLBACK_BLOCK_SIZE,
+                                    num_partitions * sizeof(size_type),
+                                    stream>>>(hasher,
+                                              num_rows,
+                                              num_partitions,
+                                              partitioner,
+                                              locations.row_partition_numbers.data().get(),
+                                              row_partition_offset.data().get(),
+                                              block_partition_sizes.data().get(),
+                                              global_partition_sizes.data().get());
+  };
+  if (is_power_two(num_partitions)) {
+    compute_partition_numbers(bitwise_partitioner<hash_result_type<hash_function>>(num_partitions));
+  } else {
+    compute_partition_numbers(modulo_partitioner<hash_result_type<hash_function>>(num_partitions));
+  }
+
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         block_partition_sizes.begin(),
+                         block_partition_sizes.end(),
+                         scanned_block_partition_sizes.begin());
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         global_partition_sizes.begin(),
+                         global_partition_sizes.end(),
+                         global_partition_sizes.begin());
+  CUDA_TRY(cudaMemcpyAsync(locations.partition_offsets.data(),
+                           global_partition_sizes.data().get(),
+                           (num_partitions + 1) * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
 
-    if (has_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               locations.row_partition_numbers.begin(),
+               locations.row_partition_numbers.end(),
+               locations.row_output_locations.begin());
+  compute_row_output_locations<<<grid_size,
+                                 FALLBACK_BLOCK_SIZE,
+                                 num_partitions * sizeof(size_type),
+                                 stream>>>(locations.row_output_locations.data().get(),
+                                           num_rows,
                                            num_partitions,
-                                           row_partition_numbers_ptr,
-                                           row_partition_offset_ptr,
-                                           block_partition_sizes_ptr,
-                                           scanned_block_partition_sizes_ptr,
-                                           grid_size,
-                                           stream);
+                                           scanned_block_partition_sizes.data().get());
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return locations;
+}
 
-      // Handle bitmask using gather to take advantage of ballot_sync
-      detail::gather_bitmask(
-        input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, mr, stream);
+/**
+ * @brief Computes the offset of the characters of every row of a strings column once the
+ * rows are moved to `row_output_locations`.
+ *
+ * @return Offsets of the output rows, including the end offset of the last row
+ */
+rmm::device_vector<size_type> output_chars_offsets(column_view const& input,
+                                                   size_type const* row_output_locations,
+                                                   cudaStream_t stream)
+{
+  rmm::device_vector<size_type> chars_offsets(input.size() + 1, 0);
+  auto const d_input = column_device_view::create(input, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     input.size(),
+                     [d_col         = *d_input,
+                      row_output_locations,
+                      chars_offsets = chars_offsets.data().get()] __device__(size_type row) {
+                       chars_offsets[row_output_locations[row] + 1] =
+                         d_col.is_valid(row) ? d_col.element<string_view>(row).size_bytes() : 0;
+                     });
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         chars_offsets.begin(),
+                         chars_offsets.end(),
+                         chars_offsets.begin());
+  return chars_offsets;
+}
+
+/**
+ * @brief Device pointers to the buffers of one column in every partition buffer
+ */
+struct partition_column_pointers {
+  char* const* data;                ///< Data, or characters of a strings column
+  bitmask_type* const* validity;    ///< Validity masks when the column has nulls
+  size_type* const* offsets;        ///< Offsets of a strings column
+  size_type const* chars_offsets;   ///< Output offsets from `output_chars_offsets`
+};
+
+/**
+ * @brief Copies every row of a column straight into its partition buffer.
+ *
+ * Validity bits are set or cleared atomically since rows of different threads share the
+ * words of a partition's mask.
+ */
+struct scatter_to_partition_buffers_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  partition_locations const& locations,
+                  size_type const* partition_offsets,
+                  partition_column_pointers pointers,
+                  cudaStream_t stream)
+  {
+    auto const d_input      = column_device_view::create(input, stream);
+    auto const has_validity = input.has_nulls();
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [d_col                 = *d_input,
+       row_partition_numbers = locations.row_partition_numbers.data().get(),
+       row_output_locations  = locations.row_output_locations.data().get(),
+       partition_offsets,
+       pointers,
+       has_validity] __device__(size_type row) {
+        auto const partition = row_partition_numbers[row];
+        auto const local_row = row_output_locations[row] - partition_offsets[partition];
+        reinterpret_cast<T*>(pointers.data[partition])[local_row] = d_col.element<T>(row);
+        if (has_validity) {
+          if (d_col.is_valid_nocheck(row)) {
+            set_bit(pointers.validity[partition], local_row);
+          } else {
+            clear_bit(pointers.validity[partition], local_row);
+          }
+        }
+      });
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  void operator()(column_view const& input,
+                  partition_locations const& locations,
+                  size_type const* partition_offsets,
+                  partition_column_pointers pointers,
+                  cudaStream_t stream)
+  {
+    auto const d_input      = column_device_view::create(input, stream);
+    auto const has_validity = input.has_nulls();
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [d_col                 = *d_input,
+       row_partition_numbers = locations.row_partition_numbers.data().get(),
+       row_output_locations  = locations.row_output_locations.data().get(),
+       partition_offsets,
+       pointers,
+       has_validity] __device__(size_type row) {
+        auto const partition   = row_partition_numbers[row];
+        auto const output_row  = row_output_locations[row];
+        auto const local_row   = output_row - partition_offsets[partition];
+        auto const chars_begin = pointers.chars_offsets[partition_offsets[partition]];
+        auto const offset      = pointers.chars_offsets[output_row] - chars_begin;
+        pointers.offsets[partition][local_row] = offset;
+        bool const is_valid = not has_validity or d_col.is_valid_nocheck(row);
+        if (is_valid) {
+          auto const str = d_col.element<string_view>(row);
+          memcpy(pointers.data[partition] + offset, str.data(), str.size_bytes());
+        }
+        if (has_validity) {
+          if (is_valid) {
+            set_bit(pointers.validity[partition], local_row);
+          } else {
+            clear_bit(pointers.validity[partition], local_row);
+          }
+        }
+      });
+
+    // The end offset of every partition, including the empty ones
+    auto const num_partitions = static_cast<size_type>(locations.partition_offsets.size()) - 1;
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_partitions,
+                       [partition_offsets, pointers] __device__(size_type partition) {
+                         auto const begin = partition_offsets[partition];
+                         auto const end   = partition_offsets[partition + 1];
+                         pointers.offsets[partition][end - begin] =
+                           pointers.chars_offsets[end] - pointers.chars_offsets[begin];
+                       });
+  }
+
+  template <typename T,
+            std::enable_if_t<not is_fixed_width<T>() and
+                             not std::is_same<T, string_view>::value>* = nullptr>
+  void operator()(column_view const&,
+                  partition_locations const&,
+                  size_type const*,
+                  partition_column_pointers,
+                  cudaStream_t)
+  {
+    CUDF_FAIL("Only fixed-width and strings columns can be partitioned into buffers");
+  }
+};
+
+// align all column buffers of a partition like `contiguous_split` does
+constexpr size_t partition_buffer_align = 64;
+
+/**
+ * @brief Hash partitions `input` directly into one contiguous buffer per partition.
+ *
+ * Every partition buffer holds the columns in the layout of `contiguous_split`: for each
+ * column its data, or characters, then its validity mask and the offsets of a strings
+ * column, each padded to 64 bytes. The partition and output location of each row is
+ * computed first, then every column is copied once from `input` into the buffers.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::vector<contiguous_split_result> hash_partition_to_buffers_impl(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const locations = compute_partition_locations<hash_function, hash_has_nulls>(
+    table_to_hash, num_partitions, stream);
+  auto const& partition_offsets = locations.partition_offsets;
+  rmm::device_vector<size_type> d_partition_offsets(partition_offsets);
+
+  // Offsets of the characters of the output rows, and of each partition, of strings columns
+  auto const num_columns = input.num_columns();
+  std::vector<rmm::device_vector<size_type>> chars_offsets(num_columns);
+  std::vector<thrust::host_vector<size_type>> partition_chars_offsets(num_columns);
+  for (size_type c = 0; c < num_columns; ++c) {
+    if (input.column(c).type().id() != STRING) { continue; }
+    chars_offsets[c] = output_chars_offsets(
+      input.column(c), locations.row_output_locations.data().get(), stream);
+    rmm::device_vector<size_type> d_partition_chars(num_partitions + 1);
+    thrust::gather(rmm::exec_policy(stream)->on(stream),
+                   d_partition_offsets.begin(),
+                   d_partition_offsets.end(),
+                   chars_offsets[c].begin(),
+                   d_partition_chars.begin());
+    partition_chars_offsets[c] = d_partition_chars;
+  }
+
+  // Lay out and allocate the buffer of every partition
+  std::vector<contiguous_split_result> result;
+  std::vector<std::vector<char*>> data(num_columns, std::vector<char*>(num_partitions));
+  std::vector<std::vector<bitmask_type*>> validity(num_columns,
+                                                   std::vector<bitmask_type*>(num_partitions));
+  std::vector<std::vector<size_type*>> offsets(num_columns,
+                                               std::vector<size_type*>(num_partitions));
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const num_rows = partition_offsets[p + 1] - partition_offsets[p];
+    size_t total_size   = 0;
+    std::vector<std::array<size_t, 3>> layout(num_columns);
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col       = input.column(c);
+      auto const is_strings = col.type().id() == STRING;
+      auto const data_size =
+        is_strings ? static_cast<size_t>(partition_chars_offsets[c][p + 1] -
+                                         partition_chars_offsets[c][p])
+                   : num_rows * size_of(col.type());
+      auto const validity_size =
+        col.has_nulls() ? bitmask_allocation_size_bytes(num_rows, partition_buffer_align) : 0;
+      auto const offsets_size =
+        is_strings ? util::round_up_safe((num_rows + 1) * sizeof(size_type), partition_buffer_align)
+                   : 0;
+      layout[c] = {total_size, validity_size, offsets_size};
+      total_size += util::round_up_safe(data_size, partition_buffer_align) + validity_size +
+                    offsets_size;
     }
 
-    auto output{std::make_unique<table>(std::move(output_cols))};
-    return std::make_pair(std::move(output), std::move(partition_offsets));
-  } else {
-    // Compute a scatter map from input to output such that the output rows are
-    // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
-                                   num_partitions * sizeof(size_type),
-                                   stream>>>(
-      row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
-
-    // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(
-      input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, mr, stream);
-
-    return std::make_pair(std::move(output), std::move(partition_offsets));
+    auto buffer = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
+    auto base   = static_cast<char*>(buffer->data());
+    std::vector<column_view> columns;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col      = input.column(c);
+      auto const begin     = layout[c][0];
+      auto const end       = c + 1 < num_columns ? layout[c + 1][0] : total_size;
+      auto const data_ptr  = base + begin;
+      auto const validity_ptr =
+        layout[c][1] == 0
+          ? nullptr
+          : reinterpret_cast<bitmask_type*>(base + end - layout[c][2] - layout[c][1]);
+      auto const offsets_ptr = reinterpret_cast<size_type*>(base + end - layout[c][2]);
+      auto const null_count  = validity_ptr == nullptr ? 0 : UNKNOWN_NULL_COUNT;
+      data[c][p]             = data_ptr;
+      validity[c][p]         = validity_ptr;
+      offsets[c][p]          = offsets_ptr;
+      if (col.type().id() == STRING) {
+        auto const num_chars = partition_chars_offsets[c][p + 1] - partition_chars_offsets[c][p];
+        columns.emplace_back(col.type(),
+                             num_rows,
+                             nullptr,
+                             validity_ptr,
+                             null_count,
+                             0,
+                             std::vector<column_view>{
+                               column_view{data_type{INT32}, num_rows + 1, offsets_ptr},
+                               column_view{data_type{INT8}, num_chars, data_ptr}});
+      } else if (num_rows == 0) {
+        columns.emplace_back(col.type(), 0, nullptr);
+      } else {
+        columns.emplace_back(col.type(), num_rows, data_ptr, validity_ptr, null_count);
+      }
+    }
+    result.push_back(contiguous_split_result{table_view{columns}, std::move(buffer)});
   }
+
+  // Copy every column into the partition buffers
+  for (size_type c = 0; c < num_columns; ++c) {
+    rmm::device_vector<char*> d_data(data[c]);
+    rmm::device_vector<bitmask_type*> d_validity(validity[c]);
+    rmm::device_vector<size_type*> d_offsets(offsets[c]);
+    partition_column_pointers pointers{d_data.data().get(),
+                                       d_validity.data().get(),
+                                       d_offsets.data().get(),
+                                       chars_offsets[c].data().get()};
+    type_dispatcher(input.column(c).type(),
+                    scatter_to_partition_buffers_fn{},
+                    input.column(c),
+                    locations,
+                    d_partition_offsets.data().get(),
+                    pointers,
+                    stream);
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  return result;
 }
 
 struct dispatch_map_type {
@@ -728,6 +1199,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream = 0)
 {
@@ -738,14 +1210,79 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
     return std::make_pair(empty_like(input), std::vector<size_type>{});
   }
 
-  if (has_nulls(table_to_hash)) {
-    return hash_partition_table<true>(input, table_to_hash, num_partitions, mr, stream);
-  } else {
-    return hash_partition_table<false>(input, table_to_hash, num_partitions, mr, stream);
+  bool const nullable = has_nulls(table_to_hash);
+  switch (hash_function) {
+    case hash_id::HASH_MURMUR3:
+      return nullable ? hash_partition_table<MurmurHash3_32, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_table<MurmurHash3_32, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_XXHASH64:
+      return nullable ? hash_partition_table<XXHash_64, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_table<XXHash_64, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      return nullable ? hash_partition_table<SparkMurmurHash3_32, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_table<SparkMurmurHash3_32, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function");
+  }
+}
+
+std::vector<contiguous_split_result> hash_partition_to_buffers(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return no partition if there are no partitions, and empty ones if there is nothing to hash
+  if (num_partitions <= 0) { return {}; }
+  if (input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    auto const empty = empty_like(input);
+    return cudf::detail::contiguous_split(
+      empty->view(), std::vector<size_type>(num_partitions - 1, 0), mr, stream);
+  }
+
+  bool const nullable = has_nulls(table_to_hash);
+  switch (hash_function) {
+    case hash_id::HASH_MURMUR3:
+      return nullable ? hash_partition_to_buffers_impl<MurmurHash3_32, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_to_buffers_impl<MurmurHash3_32, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_XXHASH64:
+      return nullable ? hash_partition_to_buffers_impl<XXHash_64, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_to_buffers_impl<XXHash_64, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      return nullable ? hash_partition_to_buffers_impl<SparkMurmurHash3_32, true>(
+                          input, table_to_hash, num_partitions, mr, stream)
+                      : hash_partition_to_buffers_impl<SparkMurmurHash3_32, false>(
+                          input, table_to_hash, num_partitions, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function");
   }
 }
 }  // namespace local
 
+std::vector<contiguous_split_result> hash_partition_to_buffers(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  return local::hash_partition_to_buffers(
+    input, columns_to_hash, num_partitions, hash_function, mr, stream);
+}
+
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
   column_view const& partition_map,
@@ -764,6 +1301,66 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, mr, stream);
 }
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  auto const keys = input.select(key_columns);
+
+  // Return empty result if there are no partitions or nothing to partition by
+  if (num_partitions <= 0 || input.num_rows() == 0 || keys.num_columns() == 0) {
+    return std::make_pair(empty_like(input), std::vector<size_type>{});
+  }
+
+  // Sort evenly spaced rows of the keys
+  auto const num_rows    = input.num_rows();
+  auto const sample_size = static_cast<size_type>(
+    std::min<int64_t>(num_rows, int64_t{num_partitions} * RANGE_PARTITION_SAMPLES_PER_PARTITION));
+  auto const sample_map = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), [num_rows, sample_size] __device__(size_type i) {
+      return static_cast<size_type>(int64_t{i} * num_rows / sample_size);
+    });
+  auto const sample = cudf::detail::gather(keys,
+                                           sample_map,
+                                           sample_map + sample_size,
+                                           false,
+                                           rmm::mr::get_default_resource(),
+                                           stream);
+  auto const sample_order = cudf::detail::sorted_order(
+    sample->view(), column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+
+  // The splitters are the sample rows at every `1 / num_partitions` quantile
+  rmm::device_vector<size_type> splitter_map(num_partitions - 1);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(1),
+                    thrust::make_counting_iterator<size_type>(num_partitions),
+                    splitter_map.begin(),
+                    [sample_order = sample_order->view().data<size_type>(),
+                     sample_size,
+                     num_partitions] __device__(size_type p) {
+                      return sample_order[int64_t{p} * sample_size / num_partitions];
+                    });
+  auto const splitters = cudf::detail::gather(sample->view(),
+                                              splitter_map.begin(),
+                                              splitter_map.end(),
+                                              false,
+                                              rmm::mr::get_default_resource(),
+                                              stream);
+
+  // Rows equal to a splitter go to the partition that starts with it
+  auto const partition_map = cudf::detail::upper_bound(splitters->view(),
+                                                       keys,
+                                                       column_order,
+                                                       null_precedence,
+                                                       rmm::mr::get_default_resource(),
+                                                       stream);
+  return partition(input, partition_map->view(), num_partitions, mr, stream);
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -771,10 +1368,38 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::local::hash_partition(input, columns_to_hash, num_partitions, hash_function, mr);
+}
+
+// Partition based on hash values straight into per-partition buffers
+std::vector<contiguous_split_result> hash_partition_to_buffers(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition_to_buffers(
+    input, columns_to_hash, num_partitions, hash_function, mr);
+}
+
+// Partition based on ranges of the keys
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::local::hash_partition(input, columns_to_hash, num_partitions, mr);
+  return detail::range_partition(
+    input, key_columns, num_partitions, column_order, null_precedence, mr);
 }
 
 // Partition based on an explicit partition map
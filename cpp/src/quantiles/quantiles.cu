@@ -22,7 +22,12 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <quantiles/quantiles_util.hpp>
+#include <sort/radix_select.hpp>
+#include <sort/sort_impl.cuh>
 
+#include <thrust/find.h>
+
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -47,6 +52,49 @@ std::unique_ptr<table> quantiles(table_view const& input,
   return detail::gather(input, quantile_idx_iter, quantile_idx_iter + q.size(), false, mr);
 }
 
+/**
+ * @brief Returns the rows of the requested quantiles of `input` without sorting it.
+ *
+ * The rows are packed into sort keys of `key_bits` bits, and the key of every quantile is
+ * found by radix select in a number of passes over the keys that does not depend on the
+ * number of rows.
+ */
+std::unique_ptr<table> selected_quantiles(table_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          std::vector<order> const& column_order,
+                                          std::vector<null_order> const& null_precedence,
+                                          int key_bits,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  auto const num_rows = input.num_rows();
+  auto const keys     = pack_sort_keys(input, column_order, null_precedence, stream);
+
+  std::vector<size_type> counts(q.size());
+  std::transform(q.begin(), q.end(), counts.begin(), [num_rows, interp](double quantile) {
+    quantile_index const idx(num_rows, quantile);
+    switch (interp) {
+      case interpolation::LOWER: return idx.lower + 1;
+      case interpolation::HIGHER: return idx.higher + 1;
+      default: return idx.nearest + 1;
+    }
+  });
+  auto const selections = radix_select(keys.data().get(), num_rows, key_bits, counts, stream);
+
+  // Rows with equal keys are equal, so any of them is the quantile row
+  std::vector<size_type> rows(selections.size());
+  std::transform(
+    selections.begin(), selections.end(), rows.begin(), [&](radix_selection const& selection) {
+      auto const row = thrust::find(
+        rmm::exec_policy(stream)->on(stream), keys.begin(), keys.end(), selection.key);
+      return static_cast<size_type>(thrust::distance(keys.begin(), row));
+    });
+
+  rmm::device_vector<size_type> d_rows(rows);
+  return detail::gather(input, d_rows.begin(), d_rows.end(), false, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> quantiles(table_view const& input,
@@ -68,10 +116,20 @@ std::unique_ptr<table> quantiles(table_view const& input,
 
   if (is_input_sorted == sorted::YES) {
     return detail::quantiles(input, thrust::make_counting_iterator<size_type>(0), q, interp, mr);
-  } else {
-    auto sorted_idx = detail::sorted_order(input, column_order, null_precedence);
-    return detail::quantiles(input, sorted_idx->view().data<size_type>(), q, interp, mr);
   }
+
+  // A few quantiles of keys that pack into 64 bits are selected rather than sorted
+  auto const key_bits    = detail::packed_sort_key_bits(input);
+  auto const num_columns = static_cast<std::size_t>(input.num_columns());
+  if (q.size() <= static_cast<std::size_t>(detail::max_radix_select_ranks) and key_bits > 0 and
+      key_bits <= 64 and (column_order.empty() or column_order.size() == num_columns) and
+      (null_precedence.empty() or null_precedence.size() == num_columns)) {
+    return detail::selected_quantiles(
+      input, q, interp, column_order, null_precedence, key_bits, mr, 0);
+  }
+
+  auto sorted_idx = detail::sorted_order(input, column_order, null_precedence);
+  return detail::quantiles(input, sorted_idx->view().data<size_type>(), q, interp, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,707 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/tdigest.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Functor copying the non-null, non-NaN values of rows of a numeric column as doubles,
+ * with the group of every row.
+ */
+struct grouped_values_as_double {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  void operator()(column_view const& values,
+                  size_type const* row_order,
+                  size_type const* row_groups,
+                  size_type num_rows,
+                  rmm::device_vector<size_type>& groups,
+                  rmm::device_vector<double>& means,
+                  cudaStream_t stream)
+  {
+    auto const d_values = column_device_view::create(values, stream);
+    auto const rows     = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [row_order] __device__(size_type i) { return row_order != nullptr ? row_order[i] : i; });
+    auto const input = thrust::make_zip_iterator(thrust::make_tuple(
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0),
+        [row_groups] __device__(size_type i) { return row_groups != nullptr ? row_groups[i] : 0; }),
+      thrust::make_transform_iterator(rows, [values = *d_values] __device__(size_type row) {
+        return static_cast<double>(values.element<T>(row));
+      })));
+
+    groups.resize(num_rows);
+    means.resize(num_rows);
+    auto const output =
+      thrust::make_zip_iterator(thrust::make_tuple(groups.begin(), means.begin()));
+    auto const end = thrust::copy_if(
+      rmm::exec_policy(stream)->on(stream),
+      input,
+      input + num_rows,
+      rows,
+      output,
+      [values = *d_values] __device__(size_type row) {
+        return values.is_valid(row) and not isnan(static_cast<double>(values.element<T>(row)));
+      });
+    auto const size = thrust::distance(output, end);
+    groups.resize(size);
+    means.resize(size);
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  size_type const*,
+                  size_type const*,
+                  size_type,
+                  rmm::device_vector<size_type>&,
+                  rmm::device_vector<double>&,
+                  cudaStream_t)
+  {
+    CUDF_FAIL("tdigest supports only numeric types");
+  }
+};
+
+/**
+ * @brief Returns the t-digest cluster of a centroid, from the k1 scale function of the quantile
+ * of its center.
+ *
+ * The scale function maps [0, 1] to [0, compression / 2] and is steepest on the tails, so that
+ * clusters hold fewer values near the extreme quantiles.
+ */
+struct centroid_cluster {
+  double compression;
+
+  __device__ int32_t operator()(double cumulative_weight, double weight, double total_weight) const
+  {
+    auto const q = fmin(fmax((cumulative_weight - weight / 2) / total_weight, 0.0), 1.0);
+    return static_cast<int32_t>(floor(compression * (asin(2 * q - 1) / M_PI + 0.5) / 2));
+  }
+};
+
+/**
+ * @brief Sums pairs of a weighted sum of means and a sum of weights.
+ */
+struct sum_centroids {
+  __device__ thrust::tuple<double, double> operator()(thrust::tuple<double, double> lhs,
+                                                      thrust::tuple<double, double> rhs) const
+  {
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs));
+  }
+};
+
+/**
+ * @brief Interpolates a quantile of the values summarized by the centroids of a t-digest.
+ *
+ * Each centroid is located at the cumulative weight of its center, and the minimum and maximum
+ * values at the cumulative weights 0 and the total weight. A t-digest has few centroids, so
+ * they are scanned in order.
+ */
+__device__ double interpolate_quantile(double const* means,
+                                       double const* weights,
+                                       size_type num_centroids,
+                                       double min_value,
+                                       double max_value,
+                                       double q)
+{
+  double total_weight = 0;
+  for (size_type i = 0; i < num_centroids; ++i) { total_weight += weights[i]; }
+  auto const rank = fmin(fmax(q, 0.0), 1.0) * total_weight;
+
+  double lower_position = 0;
+  double lower_value    = min_value;
+  double cumulative     = 0;
+  for (size_type i = 0; i <= num_centroids; ++i) {
+    auto const upper_position = i < num_centroids ? cumulative + weights[i] / 2 : total_weight;
+    auto const upper_value    = i < num_centroids ? means[i] : max_value;
+    if (rank <= upper_position) {
+      if (upper_position <= lower_position) { return upper_value; }
+      auto const fraction = (rank - lower_position) / (upper_position - lower_position);
+      return lower_value + (upper_value - lower_value) * fraction;
+    }
+    if (i < num_centroids) { cumulative += weights[i]; }
+    lower_position = upper_position;
+    lower_value    = upper_value;
+  }
+  return max_value;
+}
+
+/**
+ * @brief Appends the centroids of a t-digest to vectors of means and weights.
+ */
+void append_centroids(table_view const& centroids,
+                      rmm::device_vector<double>& means,
+                      rmm::device_vector<double>& weights)
+{
+  auto const append = [](column_view const& column, rmm::device_vector<double>& vector) {
+    vector.insert(vector.end(),
+                  thrust::device_pointer_cast(column.begin<double>()),
+                  thrust::device_pointer_cast(column.end<double>()));
+  };
+  append(centroids.column(0), means);
+  append(centroids.column(1), weights);
+}
+
+/**
+ * @brief Returns the offsets of the groups of sorted group indices, of size `num_groups + 1`.
+ */
+rmm::device_vector<size_type> offsets_of_groups(rmm::device_vector<size_type> const& groups,
+                                                size_type num_groups,
+                                                cudaStream_t stream)
+{
+  rmm::device_vector<size_type> offsets(num_groups + 1);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      groups.begin(),
+                      groups.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_groups + 1),
+                      offsets.begin());
+  return offsets;
+}
+
+/**
+ * @brief Sorts centroids by group, then by mean.
+ */
+void sort_centroids(rmm::device_vector<size_type>& groups,
+                    rmm::device_vector<double>& means,
+                    rmm::device_vector<double>& weights,
+                    cudaStream_t stream)
+{
+  auto const keys = thrust::make_zip_iterator(thrust::make_tuple(groups.begin(), means.begin()));
+  thrust::sort_by_key(
+    rmm::exec_policy(stream)->on(stream), keys, keys + groups.size(), weights.begin());
+}
+
+/**
+ * @brief Merges the centroids of the same t-digest cluster of every group.
+ *
+ * @param groups Group of every centroid, sorted, replaced with the group of every cluster
+ * @param means Means of the centroids, sorted within groups, replaced with the means of the
+ * clusters
+ * @param weights Weights of the centroids, replaced with the weights of the clusters
+ * @param num_groups Number of groups
+ * @param compression Compression of the t-digests
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void compress(rmm::device_vector<size_type>& groups,
+              rmm::device_vector<double>& means,
+              rmm::device_vector<double>& weights,
+              size_type num_groups,
+              double compression,
+              cudaStream_t stream)
+{
+  auto const policy        = rmm::exec_policy(stream);
+  auto const num_centroids = static_cast<size_type>(weights.size());
+
+  rmm::device_vector<double> cumulative(num_centroids);
+  thrust::inclusive_scan_by_key(
+    policy->on(stream), groups.begin(), groups.end(), weights.begin(), cumulative.begin());
+  // The total weight of a group is the cumulative weight of its last centroid
+  auto const offsets = offsets_of_groups(groups, num_groups, stream);
+  rmm::device_vector<int32_t> clusters(num_centroids);
+  thrust::transform(policy->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_centroids),
+                    clusters.begin(),
+                    [d_groups     = groups.data().get(),
+                     d_weights    = weights.data().get(),
+                     d_cumulative = cumulative.data().get(),
+                     d_offsets    = offsets.data().get(),
+                     cluster      = centroid_cluster{compression}] __device__(size_type i) {
+                      auto const total_weight = d_cumulative[d_offsets[d_groups[i] + 1] - 1];
+                      return cluster(d_cumulative[i], d_weights[i], total_weight);
+                    });
+
+  // The mean of a cluster is the weighted mean of its centroids
+  auto& weighted_means = cumulative;
+  thrust::transform(policy->on(stream),
+                    means.begin(),
+                    means.end(),
+                    weights.begin(),
+                    weighted_means.begin(),
+                    thrust::multiplies<double>{});
+
+  rmm::device_vector<size_type> cluster_groups(num_centroids);
+  rmm::device_vector<double> cluster_sums(num_centroids);
+  rmm::device_vector<double> cluster_weights(num_centroids);
+  auto const keys = thrust::make_zip_iterator(thrust::make_tuple(groups.begin(), clusters.begin()));
+  auto const clusters_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(cluster_sums.begin(), cluster_weights.begin()));
+  auto const clusters_end = thrust::reduce_by_key(
+    policy->on(stream),
+    keys,
+    keys + num_centroids,
+    thrust::make_zip_iterator(thrust::make_tuple(weighted_means.begin(), weights.begin())),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(cluster_groups.begin(), thrust::make_discard_iterator())),
+    clusters_begin,
+    thrust::equal_to<thrust::tuple<size_type, int32_t>>{},
+    sum_centroids{});
+  auto const num_clusters = thrust::distance(clusters_begin, clusters_end.second);
+  cluster_groups.resize(num_clusters);
+  cluster_sums.resize(num_clusters);
+  cluster_weights.resize(num_clusters);
+
+  thrust::transform(policy->on(stream),
+                    cluster_sums.begin(),
+                    cluster_sums.end(),
+                    cluster_weights.begin(),
+                    cluster_sums.begin(),
+                    thrust::divides<double>{});
+  groups  = std::move(cluster_groups);
+  means   = std::move(cluster_sums);
+  weights = std::move(cluster_weights);
+}
+
+/**
+ * @brief Makes the table of the t-digests of groups from their compressed centroids.
+ *
+ * The minimum and maximum of the groups without centroids are set to null.
+ */
+std::unique_ptr<table> make_tdigests(rmm::device_vector<size_type> const& groups,
+                                     rmm::device_vector<double> const& means,
+                                     rmm::device_vector<double> const& weights,
+                                     std::unique_ptr<column>&& min_values,
+                                     std::unique_ptr<column>&& max_values,
+                                     size_type num_groups,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  auto const offsets   = offsets_of_groups(groups, num_groups, stream);
+  auto const make_list = [&](rmm::device_vector<double> const& elements) {
+    auto offsets_column = make_numeric_column(
+      data_type{type_id::INT32}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+    CUDA_TRY(cudaMemcpyAsync(offsets_column->mutable_view().data<size_type>(),
+                             offsets.data().get(),
+                             offsets.size() * sizeof(size_type),
+                             cudaMemcpyDeviceToDevice,
+                             stream));
+    auto child = make_numeric_column(
+      data_type{type_id::FLOAT64}, elements.size(), mask_state::UNALLOCATED, stream, mr);
+    if (not elements.empty()) {
+      CUDA_TRY(cudaMemcpyAsync(child->mutable_view().data<double>(),
+                               elements.data().get(),
+                               elements.size() * sizeof(double),
+                               cudaMemcpyDeviceToDevice,
+                               stream));
+    }
+    return make_lists_column(
+      num_groups, std::move(offsets_column), std::move(child), 0, rmm::device_buffer{}, stream, mr);
+  };
+
+  auto null_mask = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_groups),
+    [d_offsets = offsets.data().get()] __device__(size_type g) {
+      return d_offsets[g + 1] > d_offsets[g];
+    },
+    stream,
+    mr);
+  if (null_mask.second > 0) {
+    min_values->set_null_mask(
+      rmm::device_buffer{null_mask.first.data(), null_mask.first.size(), stream, mr},
+      null_mask.second);
+    max_values->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+
+  std::vector<std::unique_ptr<column>> digests;
+  digests.push_back(make_list(means));
+  digests.push_back(make_list(weights));
+  digests.push_back(std::move(min_values));
+  digests.push_back(std::move(max_values));
+  return std::make_unique<table>(std::move(digests));
+}
+
+/**
+ * @brief Verifies that `digests` is a table of t-digests.
+ */
+void verify_tdigests(table_view const& digests, cudaStream_t stream)
+{
+  CUDF_EXPECTS(digests.num_columns() == 4, "A t-digest has four columns");
+  auto const& means   = digests.column(0);
+  auto const& weights = digests.column(1);
+  CUDF_EXPECTS(means.type().id() == type_id::LIST and weights.type().id() == type_id::LIST and
+                 not means.has_nulls() and not weights.has_nulls(),
+               "t-digest centroids must be lists without nulls");
+  CUDF_EXPECTS(digests.column(2).type().id() == type_id::FLOAT64 and
+                 digests.column(3).type().id() == type_id::FLOAT64,
+               "t-digest minimum and maximum must be FLOAT64");
+  if (digests.num_rows() == 0) { return; }
+
+  lists_column_view const means_lists(means);
+  lists_column_view const weights_lists(weights);
+  CUDF_EXPECTS(means_lists.child().type().id() == type_id::FLOAT64 and
+                 weights_lists.child().type().id() == type_id::FLOAT64,
+               "t-digest centroids must be lists of FLOAT64");
+  CUDF_EXPECTS(
+    thrust::all_of(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(digests.num_rows()),
+                   [d_means   = means_lists.offsets().data<size_type>() + means_lists.offset(),
+                    d_weights = weights_lists.offsets().data<size_type>() +
+                                weights_lists.offset()] __device__(size_type i) {
+                     return d_means[i + 1] - d_means[i] == d_weights[i + 1] - d_weights[i];
+                   }),
+    "t-digest means and weights must have the same sizes");
+}
+
+rmm::device_buffer to_buffer(rmm::device_vector<double> const& vector, cudaStream_t stream)
+{
+  return rmm::device_buffer(vector.data().get(), vector.size() * sizeof(double), stream);
+}
+
+}  // namespace
+
+std::unique_ptr<table> group_tdigests(column_view const& values,
+                                      size_type const* row_order,
+                                      size_type const* row_groups,
+                                      size_type num_rows,
+                                      size_type num_groups,
+                                      double compression,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  rmm::device_vector<size_type> groups;
+  rmm::device_vector<double> means;
+  type_dispatcher(values.type(),
+                  grouped_values_as_double{},
+                  values,
+                  row_order,
+                  row_groups,
+                  num_rows,
+                  groups,
+                  means,
+                  stream);
+  rmm::device_vector<double> weights(means.size(), 1.0);
+  sort_centroids(groups, means, weights, stream);
+
+  // The minimum and maximum of a group are its first and last sorted values
+  auto min_values = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto max_values = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto const offsets = offsets_of_groups(groups, num_groups, stream);
+  auto const d_min   = min_values->mutable_view().data<double>();
+  auto const d_max   = max_values->mutable_view().data<double>();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_groups,
+                     [d_offsets = offsets.data().get(),
+                      d_means   = means.data().get(),
+                      d_min,
+                      d_max] __device__(size_type g) {
+                       if (d_offsets[g + 1] == d_offsets[g]) { return; }
+                       d_min[g] = d_means[d_offsets[g]];
+                       d_max[g] = d_means[d_offsets[g + 1] - 1];
+                     });
+
+  compress(groups, means, weights, num_groups, compression, stream);
+  return make_tdigests(
+    groups, means, weights, std::move(min_values), std::move(max_values), num_groups, mr, stream);
+}
+
+std::unique_ptr<table> merge_tdigests(table_view const& digests,
+                                      size_type const* row_order,
+                                      size_type const* group_offsets,
+                                      size_type num_groups,
+                                      double compression,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  verify_tdigests(digests, stream);
+  auto const policy = rmm::exec_policy(stream);
+  size_type num_rows{0};
+  CUDA_TRY(cudaMemcpyAsync(&num_rows,
+                           group_offsets + num_groups,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Every row copies its centroids after the ones of the previous rows in group order
+  lists_column_view const means_lists(digests.column(0));
+  lists_column_view const weights_lists(digests.column(1));
+  auto const d_mean_offsets   = means_lists.offsets().data<size_type>() + means_lists.offset();
+  auto const d_weight_offsets = weights_lists.offsets().data<size_type>() + weights_lists.offset();
+  rmm::device_vector<size_type> positions(num_rows + 1, 0);
+  auto const sizes = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_mean_offsets, row_order] __device__(size_type j) {
+      return d_mean_offsets[row_order[j] + 1] - d_mean_offsets[row_order[j]];
+    });
+  thrust::inclusive_scan(policy->on(stream), sizes, sizes + num_rows, positions.begin() + 1);
+  size_type const num_centroids = positions.back();
+
+  rmm::device_vector<size_type> groups(num_centroids);
+  rmm::device_vector<double> means(num_centroids);
+  rmm::device_vector<double> weights(num_centroids);
+  thrust::for_each_n(
+    policy->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [d_mean_offsets,
+     d_weight_offsets,
+     d_means_in    = means_lists.child().data<double>(),
+     d_weights_in  = weights_lists.child().data<double>(),
+     d_positions   = positions.data().get(),
+     d_groups      = groups.data().get(),
+     d_means       = means.data().get(),
+     d_weights     = weights.data().get(),
+     row_order,
+     group_offsets,
+     num_groups] __device__(size_type j) {
+      auto const group = static_cast<size_type>(thrust::distance(
+                           group_offsets,
+                           thrust::upper_bound(
+                             thrust::seq, group_offsets, group_offsets + num_groups + 1, j))) -
+                         1;
+      auto const row   = row_order[j];
+      auto const count = d_mean_offsets[row + 1] - d_mean_offsets[row];
+      for (size_type k = 0; k < count; ++k) {
+        d_groups[d_positions[j] + k]  = group;
+        d_means[d_positions[j] + k]   = d_means_in[d_mean_offsets[row] + k];
+        d_weights[d_positions[j] + k] = d_weights_in[d_weight_offsets[row] + k];
+      }
+    });
+
+  auto min_values = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto max_values = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto const d_min_in = column_device_view::create(digests.column(2), stream);
+  auto const d_max_in = column_device_view::create(digests.column(3), stream);
+  thrust::for_each_n(policy->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_groups,
+                     [d_min_in = *d_min_in,
+                      d_max_in = *d_max_in,
+                      d_min    = min_values->mutable_view().data<double>(),
+                      d_max    = max_values->mutable_view().data<double>(),
+                      row_order,
+                      group_offsets] __device__(size_type g) {
+                       auto min_value = std::numeric_limits<double>::infinity();
+                       auto max_value = -std::numeric_limits<double>::infinity();
+                       for (auto j = group_offsets[g]; j < group_offsets[g + 1]; ++j) {
+                         auto const row = row_order[j];
+                         if (d_min_in.is_valid(row)) {
+                           min_value = fmin(min_value, d_min_in.element<double>(row));
+                         }
+                         if (d_max_in.is_valid(row)) {
+                           max_value = fmax(max_value, d_max_in.element<double>(row));
+                         }
+                       }
+                       d_min[g] = min_value;
+                       d_max[g] = max_value;
+                     });
+
+  sort_centroids(groups, means, weights, stream);
+  compress(groups, means, weights, num_groups, compression, stream);
+  return make_tdigests(
+    groups, means, weights, std::move(min_values), std::move(max_values), num_groups, mr, stream);
+}
+
+std::unique_ptr<column> tdigest_quantiles(table_view const& digests,
+                                          std::vector<double> const& quantiles,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  verify_tdigests(digests, stream);
+  auto const num_quantiles = static_cast<size_type>(quantiles.size());
+  auto const size          = digests.num_rows() * num_quantiles;
+  auto result =
+    make_numeric_column(data_type{type_id::FLOAT64}, size, mask_state::UNALLOCATED, stream, mr);
+  if (size == 0) { return result; }
+
+  lists_column_view const means_lists(digests.column(0));
+  lists_column_view const weights_lists(digests.column(1));
+  auto const d_offsets = means_lists.offsets().data<size_type>() + means_lists.offset();
+  rmm::device_vector<double> d_quantiles(quantiles);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    result->mutable_view().begin<double>(),
+    [d_offsets,
+     d_weight_offsets = weights_lists.offsets().data<size_type>() + weights_lists.offset(),
+     d_means          = means_lists.child().data<double>(),
+     d_weights        = weights_lists.child().data<double>(),
+     d_min            = digests.column(2).data<double>(),
+     d_max            = digests.column(3).data<double>(),
+     d_quantiles      = d_quantiles.data().get(),
+     num_quantiles] __device__(size_type i) {
+      auto const digest        = i / num_quantiles;
+      auto const num_centroids = d_offsets[digest + 1] - d_offsets[digest];
+      if (num_centroids == 0) { return 0.0; }
+      return interpolate_quantile(d_means + d_offsets[digest],
+                                  d_weights + d_weight_offsets[digest],
+                                  num_centroids,
+                                  d_min[digest],
+                                  d_max[digest],
+                                  d_quantiles[i % num_quantiles]);
+    });
+
+  auto null_mask = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    [d_offsets, num_quantiles] __device__(size_type i) {
+      auto const digest = i / num_quantiles;
+      return d_offsets[digest + 1] > d_offsets[digest];
+    },
+    stream,
+    mr);
+  if (null_mask.second > 0) {
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+  return result;
+}
+
+}  // namespace detail
+
+tdigest::tdigest(double compression)
+  : _compression{compression},
+    _min{std::numeric_limits<double>::infinity()},
+    _max{-std::numeric_limits<double>::infinity()}
+{
+  CUDF_EXPECTS(compression > 0, "The compression must be positive");
+}
+
+void tdigest::add(column_view const& values)
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+  rmm::device_vector<size_type> groups;
+  rmm::device_vector<double> means;
+  type_dispatcher(values.type(),
+                  detail::grouped_values_as_double{},
+                  values,
+                  nullptr,
+                  nullptr,
+                  values.size(),
+                  groups,
+                  means,
+                  stream);
+  if (means.empty()) { return; }
+
+  auto const extrema =
+    thrust::minmax_element(rmm::exec_policy(stream)->on(stream), means.begin(), means.end());
+  _min = std::min<double>(_min, *extrema.first);
+  _max = std::max<double>(_max, *extrema.second);
+  _count += means.size();
+
+  // The values and the current centroids are compressed as a single group
+  rmm::device_vector<double> weights(means.size(), 1.0);
+  detail::append_centroids(centroids(), means, weights);
+  groups.resize(means.size(), 0);
+  detail::sort_centroids(groups, means, weights, stream);
+  detail::compress(groups, means, weights, 1, _compression, stream);
+  _num_centroids = means.size();
+  _means         = detail::to_buffer(means, stream);
+  _weights       = detail::to_buffer(weights, stream);
+}
+
+void tdigest::merge(tdigest const& other)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(other._compression == _compression,
+               "Cannot merge t-digests of different compression");
+  if (other._count == 0) { return; }
+
+  cudaStream_t stream = 0;
+  rmm::device_vector<double> means;
+  rmm::device_vector<double> weights;
+  detail::append_centroids(centroids(), means, weights);
+  detail::append_centroids(other.centroids(), means, weights);
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+  _count += other._count;
+
+  rmm::device_vector<size_type> groups(means.size(), 0);
+  detail::sort_centroids(groups, means, weights, stream);
+  detail::compress(groups, means, weights, 1, _compression, stream);
+  _num_centroids = means.size();
+  _means         = detail::to_buffer(means, stream);
+  _weights       = detail::to_buffer(weights, stream);
+}
+
+std::unique_ptr<column> tdigest::quantile(std::vector<double> const& q,
+                                          rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  cudaStream_t stream = 0;
+  auto output =
+    make_numeric_column(data_type{FLOAT64}, q.size(), mask_state::UNALLOCATED, stream, mr);
+  if (q.empty()) { return output; }
+
+  if (_num_centroids == 0) {
+    output->set_null_mask(create_null_mask(q.size(), mask_state::ALL_NULL, stream, mr), q.size());
+    return output;
+  }
+
+  rmm::device_vector<double> d_q{q};
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_q.begin(),
+                    d_q.end(),
+                    output->mutable_view().begin<double>(),
+                    [means         = static_cast<double const*>(_means.data()),
+                     weights       = static_cast<double const*>(_weights.data()),
+                     num_centroids = _num_centroids,
+                     min_value     = _min,
+                     max_value     = _max] __device__(double q) {
+                      return detail::interpolate_quantile(
+                        means, weights, num_centroids, min_value, max_value, q);
+                    });
+  return output;
+}
+
+table_view tdigest::centroids() const
+{
+  return table_view{{column_view{data_type{FLOAT64}, _num_centroids, _means.data()},
+                     column_view{data_type{FLOAT64}, _num_centroids, _weights.data()}}};
+}
+
+}  // namespace cudf
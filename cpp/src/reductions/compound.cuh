@@ -69,11 +69,7 @@ std::unique_ptr<scalar> compound_reduction(column_view const& col,
     result = detail::reduce<Op, decltype(it), ResultType>(
       it, col.size(), compound_op, valid_count, ddof, mr, stream);
   }
-  // set scalar is valid
-  if (col.null_count() < col.size())
-    result->set_valid(true, stream);
-  else
-    result->set_valid(false, stream);
+  // the scalar validity is set on device by `detail::reduce`
   return result;
 };
 
@@ -15,16 +15,25 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/hyperloglog.hpp>
+#include <cudf/detail/tdigest.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/quantiles.hpp>
 #include <cudf/sorting.hpp>
 
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/selection.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
 
 namespace cudf {
 namespace detail {
@@ -91,6 +100,38 @@ struct reduce_dispatch_functor {
           stream,
           mr);
       } break;
+      case aggregation::APPROX_NUNIQUE: {
+        auto approx_nunique_agg = static_cast<approx_nunique_aggregation const *>(agg.get());
+        auto const precision    = approx_nunique_agg->_precision;
+        auto const nulls        = approx_nunique_agg->_null_handling;
+        auto const sketch       = hyperloglog_sketches(col,
+                                                       nullptr,
+                                                       nullptr,
+                                                       col.size(),
+                                                       1,
+                                                       precision,
+                                                       nulls,
+                                                       rmm::mr::get_default_resource(),
+                                                       stream);
+        auto const estimate     = hyperloglog_estimate(*sketch, precision, mr, stream);
+        return get_element(*estimate, 0, mr);
+      } break;
+      case aggregation::APPROX_QUANTILE: {
+        auto approx_quantile_agg = static_cast<approx_quantile_aggregation const *>(agg.get());
+        CUDF_EXPECTS(approx_quantile_agg->_quantiles.size() == 1,
+                     "Reduction quantile accepts only one quantile value");
+        auto const digest   = group_tdigests(col,
+                                             nullptr,
+                                             nullptr,
+                                             col.size(),
+                                             1,
+                                             approx_quantile_agg->_compression,
+                                             rmm::mr::get_default_resource(),
+                                             stream);
+        auto const estimate = tdigest_quantiles(
+          digest->view(), approx_quantile_agg->_quantiles, rmm::mr::get_default_resource(), stream);
+        return get_element(*estimate, 0, mr);
+      } break;
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -101,17 +142,147 @@ std::unique_ptr<scalar> reduce(
   std::unique_ptr<aggregation> const &agg,
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+namespace {
+/**
+ * @brief Returns the fixed-point scalar holding the reduction of a fixed-point column's
+ * integer representation.
+ *
+ * SUM, MIN and MAX of the representations are the representations of the results at the
+ * input's scale, so only those reductions are supported. The output may widen the
+ * representation, e.g. a DECIMAL64 sum of a DECIMAL32 column.
+ *
+ * @tparam Rep The representation type of the output
+ */
+template <typename Rep>
+std::unique_ptr<scalar> fixed_point_reduce(column_view const &col,
+                                           std::unique_ptr<aggregation> const &agg,
+                                           data_type output_dtype,
+                                           rmm::mr::device_memory_resource *mr,
+                                           cudaStream_t stream)
+{
+  auto const storage_type = [](data_type type) {
+    return data_type{type.id() == type_id::DECIMAL32 ? type_id::INT32 : type_id::INT64};
+  };
+  column_view const storage{storage_type(col.type()),
+                            col.size(),
+                            col.head(),
+                            col.null_mask(),
+                            col.null_count(),
+                            col.offset()};
+  auto const reduced =
+    reduce(storage, agg, data_type{type_to_id<Rep>()}, rmm::mr::get_default_resource(), stream);
+  auto const &value  = static_cast<numeric_scalar<Rep> const &>(*reduced);
+
+  auto result =
+    std::make_unique<fixed_point_scalar<Rep>>(Rep{0}, output_dtype.scale(), false, stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(
+    result->data(), value.data(), sizeof(Rep), cudaMemcpyDeviceToDevice, stream));
+  CUDA_TRY(cudaMemcpyAsync(result->validity_data(),
+                           value.validity_data(),
+                           sizeof(bool),
+                           cudaMemcpyDeviceToDevice,
+                           stream));
+  return result;
+}
+}  // namespace
+
+std::unique_ptr<scalar> reduce(column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr,
+                               cudaStream_t stream)
+{
+  if (is_fixed_point(col.type())) {
+    CUDF_EXPECTS(agg->kind == aggregation::SUM || agg->kind == aggregation::MIN ||
+                   agg->kind == aggregation::MAX,
+                 "Unsupported reduction operator for fixed-point columns");
+    CUDF_EXPECTS(is_fixed_point(output_dtype) && output_dtype.scale() == col.type().scale(),
+                 "Fixed-point reductions keep the scale of the input");
+    return output_dtype.id() == type_id::DECIMAL32
+             ? fixed_point_reduce<int32_t>(col, agg, output_dtype, mr, stream)
+             : fixed_point_reduce<int64_t>(col, agg, output_dtype, mr, stream);
+  }
+
+  // check if input column is empty; the invalid default scalar is only built in that case so
+  // that a regular reduction does not touch the default stream
+  if (col.size() <= col.null_count()) {
+    std::unique_ptr<scalar> result = make_default_constructed_scalar(output_dtype);
+    result->set_valid(false, stream);
+    return result;
+  }
+
+  return aggregation_dispatcher(
+    agg->kind, reduce_dispatch_functor{col, output_dtype, mr, stream}, agg);
+}
+
+std::unique_ptr<scalar> reduce(
+  chunked_column_view const &col,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
-  std::unique_ptr<scalar> result = make_default_constructed_scalar(output_dtype);
-  result->set_valid(false, stream);
+  if (col.size() <= col.null_count()) {
+    auto result = make_default_constructed_scalar(output_dtype);
+    result->set_valid(false, stream);
+    return result;
+  }
+
+  // Aggregations whose partial results over the chunks are combined by another reduction
+  bool const combinable = agg->kind == aggregation::SUM or agg->kind == aggregation::PRODUCT or
+                          agg->kind == aggregation::MIN or agg->kind == aggregation::MAX or
+                          agg->kind == aggregation::ANY or agg->kind == aggregation::ALL or
+                          agg->kind == aggregation::SUM_OF_SQUARES;
+  if (col.num_chunks() == 1) { return reduce(col.chunk(0), agg, output_dtype, mr, stream); }
+  if (not combinable) {
+    auto const materialized = cudf::concatenate(col.chunks());
+    return reduce(materialized->view(), agg, output_dtype, mr, stream);
+  }
 
-  // check if input column is empty
-  if (col.size() <= col.null_count()) return result;
+  // Partial results of empty or all-null chunks are null and skipped by the combining reduction
+  std::vector<std::unique_ptr<column>> partials;
+  for (auto const &chunk : col.chunks()) {
+    auto const partial = reduce(chunk, agg, output_dtype, rmm::mr::get_default_resource(), stream);
+    partials.push_back(
+      make_column_from_scalar(*partial, 1, rmm::mr::get_default_resource(), stream));
+  }
+  std::vector<column_view> partial_views(partials.size());
+  std::transform(partials.begin(), partials.end(), partial_views.begin(), [](auto const &p) {
+    return p->view();
+  });
+  auto const combined = cudf::concatenate(partial_views);
+  auto const combine_kind =
+    agg->kind == aggregation::SUM_OF_SQUARES ? aggregation::SUM : agg->kind;
+  return reduce(
+    combined->view(), std::make_unique<aggregation>(combine_kind), output_dtype, mr, stream);
+}
 
-  result =
-    aggregation_dispatcher(agg->kind, reduce_dispatch_functor{col, output_dtype, mr, stream}, agg);
-  return result;
+std::unique_ptr<scalar> reduce(
+  column_view const &col,
+  selection const &rows,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  // Masking the unselected rows would count them as nulls
+  bool const counts_nulls =
+    (agg->kind == aggregation::NUNIQUE and
+     static_cast<nunique_aggregation const *>(agg.get())->_null_handling ==
+       null_policy::INCLUDE) or
+    (agg->kind == aggregation::APPROX_NUNIQUE and
+     static_cast<approx_nunique_aggregation const *>(agg.get())->_null_handling ==
+       null_policy::INCLUDE);
+  if (counts_nulls) {
+    auto const selected =
+      apply_selection(table_view{{col}}, rows, rmm::mr::get_default_resource(), stream);
+    return reduce(selected->get_column(0).view(), agg, output_dtype, mr, stream);
+  }
+
+  auto const masked = mask_unselected_rows(col, rows, rmm::mr::get_default_resource(), stream);
+  return reduce(masked.view, agg, output_dtype, mr, stream);
 }
 }  // namespace detail
 
@@ -124,4 +295,23 @@ std::unique_ptr<scalar> reduce(column_view const &col,
   return detail::reduce(col, agg, output_dtype, mr);
 }
 
+std::unique_ptr<scalar> reduce(chunked_column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, agg, output_dtype, mr);
+}
+
+std::unique_ptr<scalar> reduce(column_view const &col,
+                               selection const &rows,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, rows, agg, output_dtype, mr);
+}
+
 }  // namespace cudf
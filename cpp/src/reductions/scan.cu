@@ -7,13 +7,23 @@
 #include <rmm/rmm.h>
 #include <cudf/null_mask.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
 
 namespace cudf {
 namespace detail {
@@ -219,6 +229,207 @@ struct ScanDispatcher {
   }
 };
 
+namespace {
+/**
+ * @brief Functor returning whether row `i` of a presorted column starts a run of equal values
+ *
+ * When the rows are labelled by segment, a run also starts at every segment boundary.
+ */
+struct run_start_fn {
+  row_equality_comparator<true> values_equal;
+  size_type const* labels;  ///< Segment label of every row, or `nullptr` for a single segment
+
+  __device__ bool operator()(size_type i) const
+  {
+    return i == 0 or (labels != nullptr and labels[i] != labels[i - 1]) or
+           not values_equal(i - 1, i);
+  }
+};
+
+/**
+ * @brief Computes the `RANK` or `DENSE_RANK` scan of a presorted column
+ *
+ * Equal consecutive values, nulls included, get the same rank. The rank restarts from one
+ * at every segment boundary.
+ *
+ * @param input Column sorted within every segment
+ * @param labels Segment label of every row, or `nullptr` when `input` is a single segment
+ * @param dense Computes `DENSE_RANK` if true, `RANK` otherwise
+ * @param null_handling Nulls of `input` are nulls of the result if `null_policy::EXCLUDE`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> rank_scan(column_view const& input,
+                                  size_type const* labels,
+                                  bool dense,
+                                  null_policy null_handling,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_fixed_width(input.type()) || input.type().id() == STRING,
+               "Rank scans are only supported for fixed-width and string types");
+  auto result = make_fixed_width_column(
+    data_type(type_to_id<size_type>()), input.size(), mask_state::UNALLOCATED, stream, mr);
+  if (input.size() == 0) { return result; }
+
+  auto const d_input  = table_device_view::create(table_view({input}), stream);
+  auto const is_start = run_start_fn{row_equality_comparator<true>{*d_input, *d_input}, labels};
+  auto const d_result = result->mutable_view().data<size_type>();
+  auto const rows     = thrust::make_counting_iterator<size_type>(0);
+
+  if (dense) {
+    // The dense rank is the number of runs started so far in the segment
+    auto const starts = thrust::make_transform_iterator(
+      rows, [is_start] __device__(size_type i) -> size_type { return is_start(i) ? 1 : 0; });
+    if (labels == nullptr) {
+      thrust::inclusive_scan(
+        rmm::exec_policy(stream)->on(stream), starts, starts + input.size(), d_result);
+    } else {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    labels,
+                                    labels + input.size(),
+                                    starts,
+                                    d_result);
+    }
+  } else {
+    // The rank is the position of the start of the run relative to the start of the segment
+    auto const start_positions = thrust::make_transform_iterator(
+      rows, [is_start] __device__(size_type i) -> size_type { return is_start(i) ? i : 0; });
+    thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           start_positions,
+                           start_positions + input.size(),
+                           d_result,
+                           thrust::maximum<size_type>{});
+    rmm::device_vector<size_type> segment_starts(labels == nullptr ? 0 : input.size());
+    if (labels != nullptr) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    labels,
+                                    labels + input.size(),
+                                    rows,
+                                    segment_starts.begin(),
+                                    thrust::equal_to<size_type>{},
+                                    thrust::minimum<size_type>{});
+    }
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      rows,
+      input.size(),
+      [d_result,
+       segment_starts = labels == nullptr ? nullptr : segment_starts.data().get()] __device__(
+        size_type i) { d_result[i] -= (segment_starts == nullptr ? 0 : segment_starts[i]) - 1; });
+  }
+
+  if (null_handling == null_policy::EXCLUDE && input.nullable()) {
+    result->set_null_mask(copy_bitmask(input, stream, mr), input.null_count());
+  }
+  return result;
+}
+
+/**
+ * @brief Labels every row of a column of `size` rows with the segment it belongs to
+ *
+ * The label of row `i` is the number of offsets not greater than `i`: rows of the same
+ * segment share a label, and rows of different segments do not.
+ */
+rmm::device_vector<size_type> segment_labels(column_view const& offsets,
+                                             size_type size,
+                                             cudaStream_t stream)
+{
+  rmm::device_vector<size_type> labels(size);
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      offsets.begin<size_type>(),
+                      offsets.end<size_type>(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(size),
+                      labels.begin());
+  return labels;
+}
+
+/**
+ * @brief Dispatcher running a scan operation `Op` independently on every segment of a column
+ *
+ * Nulls are handled as by `ScanDispatcher`, the scan restarting at every segment.
+ *
+ * @tparam Op device binary operator
+ */
+template <typename Op>
+struct SegmentedScanDispatcher {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     rmm::device_vector<size_type> const& labels,
+                                     scan_type inclusive,
+                                     null_policy null_handling,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    auto const size = input.size();
+    auto output_column =
+      detail::allocate_like(input, size, mask_allocation_policy::NEVER, mr, stream);
+    auto const d_input = column_device_view::create(input, stream);
+    auto const d_out   = output_column->mutable_view().data<T>();
+    auto const keys    = labels.data().get();
+
+    auto const scan_values = [&](auto values) {
+      if (inclusive == scan_type::INCLUSIVE) {
+        thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                      keys,
+                                      keys + size,
+                                      values,
+                                      d_out,
+                                      thrust::equal_to<size_type>{},
+                                      Op{});
+      } else {
+        thrust::exclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                      keys,
+                                      keys + size,
+                                      values,
+                                      d_out,
+                                      Op::template identity<T>(),
+                                      thrust::equal_to<size_type>{},
+                                      Op{});
+      }
+    };
+    if (input.has_nulls()) {
+      scan_values(make_null_replacement_iterator(*d_input, Op::template identity<T>()));
+    } else {
+      scan_values(d_input->begin<T>());
+    }
+
+    if (null_handling == null_policy::EXCLUDE) {
+      output_column->set_null_mask(copy_bitmask(input, stream, mr), input.null_count());
+    } else if (inclusive == scan_type::INCLUSIVE && input.nullable()) {
+      // A row is null once any row before it in its segment is null
+      rmm::device_vector<bool> valid(size);
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    keys,
+                                    keys + size,
+                                    make_validity_iterator(*d_input),
+                                    valid.begin(),
+                                    thrust::equal_to<size_type>{},
+                                    thrust::logical_and<bool>{});
+      auto null_mask =
+        valid_if(valid.begin(), valid.end(), thrust::identity<bool>{}, stream, mr);
+      output_column->set_null_mask(std::move(null_mask.first), null_mask.second);
+    }
+
+    CHECK_CUDA(stream);
+    return output_column;
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     rmm::device_vector<size_type> const& labels,
+                                     scan_type inclusive,
+                                     null_policy null_handling,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    CUDF_FAIL("Segmented scans other than rank scans are only supported for arithmetic types");
+  }
+};
+
+}  // namespace
+
 std::unique_ptr<column> scan(const column_view& input,
                              std::unique_ptr<aggregation> const& agg,
                              scan_type inclusive,
@@ -226,6 +437,12 @@ std::unique_ptr<column> scan(const column_view& input,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                              cudaStream_t stream                 = 0)
 {
+  if (agg->kind == aggregation::RANK || agg->kind == aggregation::DENSE_RANK) {
+    CUDF_EXPECTS(inclusive == scan_type::INCLUSIVE, "Rank scans must be inclusive");
+    return rank_scan(
+      input, nullptr, agg->kind == aggregation::DENSE_RANK, null_handling, mr, stream);
+  }
+
   CUDF_EXPECTS(is_numeric(input.type()) || is_compound(input.type()),
                "Unexpected non-numeric or non-string type.");
 
@@ -265,6 +482,70 @@ std::unique_ptr<column> scan(const column_view& input,
     default: CUDF_FAIL("Unsupported aggregation operator for scan");
   }
 }
+
+std::unique_ptr<column> segmented_scan(
+  column_view const& input,
+  column_view const& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  scan_type inclusive,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>() and offsets.size() > 0 and
+                 not offsets.has_nulls(),
+               "Segment offsets must be a non-empty INT32 column without nulls");
+  auto const labels = segment_labels(offsets, input.size(), stream);
+
+  switch (agg->kind) {
+    case aggregation::RANK:
+    case aggregation::DENSE_RANK:
+      CUDF_EXPECTS(inclusive == scan_type::INCLUSIVE, "Rank scans must be inclusive");
+      return rank_scan(input,
+                       labels.data().get(),
+                       agg->kind == aggregation::DENSE_RANK,
+                       null_handling,
+                       mr,
+                       stream);
+    case aggregation::SUM:
+      return cudf::type_dispatcher(input.type(),
+                                   SegmentedScanDispatcher<cudf::DeviceSum>(),
+                                   input,
+                                   labels,
+                                   inclusive,
+                                   null_handling,
+                                   mr,
+                                   stream);
+    case aggregation::MIN:
+      return cudf::type_dispatcher(input.type(),
+                                   SegmentedScanDispatcher<cudf::DeviceMin>(),
+                                   input,
+                                   labels,
+                                   inclusive,
+                                   null_handling,
+                                   mr,
+                                   stream);
+    case aggregation::MAX:
+      return cudf::type_dispatcher(input.type(),
+                                   SegmentedScanDispatcher<cudf::DeviceMax>(),
+                                   input,
+                                   labels,
+                                   inclusive,
+                                   null_handling,
+                                   mr,
+                                   stream);
+    case aggregation::PRODUCT:
+      return cudf::type_dispatcher(input.type(),
+                                   SegmentedScanDispatcher<cudf::DeviceProduct>(),
+                                   input,
+                                   labels,
+                                   inclusive,
+                                   null_handling,
+                                   mr,
+                                   stream);
+    default: CUDF_FAIL("Unsupported aggregation operator for segmented scan");
+  }
+}
 }  // namespace detail
 
 std::unique_ptr<column> scan(const column_view& input,
@@ -277,4 +558,15 @@ std::unique_ptr<column> scan(const column_view& input,
   return detail::scan(input, agg, inclusive, null_handling, mr);
 }
 
+std::unique_ptr<column> segmented_scan(column_view const& input,
+                                       column_view const& offsets,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       scan_type inclusive,
+                                       null_policy null_handling,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_scan(input, offsets, agg, inclusive, null_handling, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <cub/cub.cuh>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace reduction {
+namespace {
+/**
+ * @brief Reduces the segments `[d_offsets[i], d_offsets[i+1])` of `d_in` into `d_out[i]`
+ */
+template <typename InputIterator, typename OutputIterator, typename BinaryOp, typename T>
+void device_segmented_reduce(InputIterator d_in,
+                             size_type const* d_offsets,
+                             size_type num_segments,
+                             OutputIterator d_out,
+                             BinaryOp op,
+                             T identity,
+                             cudaStream_t stream)
+{
+  size_t temp_storage_bytes{0};
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                              temp_storage_bytes,
+                                              d_in,
+                                              d_out,
+                                              num_segments,
+                                              d_offsets,
+                                              d_offsets + 1,
+                                              op,
+                                              identity,
+                                              stream));
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                              temp_storage_bytes,
+                                              d_in,
+                                              d_out,
+                                              num_segments,
+                                              d_offsets,
+                                              d_offsets + 1,
+                                              op,
+                                              identity,
+                                              stream));
+}
+
+/**
+ * @brief Segmented reduction for `sum`, `product`, `min` and `max`
+ *
+ * @tparam ElementType  the input column cudf dtype
+ * @tparam ResultType   the output cudf dtype
+ * @tparam Op           the operator of cudf::reduction::op::
+ */
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> simple_segmented_reduction(column_view const& col,
+                                                   column_view const& offsets,
+                                                   data_type const output_dtype,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  size_type const num_segments = offsets.size() - 1;
+  auto result =
+    make_fixed_width_column(output_dtype, num_segments, mask_state::UNALLOCATED, stream, mr);
+  if (num_segments == 0) { return result; }
+
+  auto dcol            = cudf::column_device_view::create(col, stream);
+  auto const d_offsets = offsets.data<size_type>();
+  auto const d_result  = result->mutable_view().data<ResultType>();
+  Op simple_op{};
+
+  if (col.has_nulls()) {
+    auto it =
+      thrust::make_transform_iterator(cudf::detail::make_null_replacement_iterator(
+                                        *dcol, simple_op.template get_identity<ElementType>()),
+                                      simple_op.template get_element_transformer<ResultType>());
+    device_segmented_reduce(it,
+                            d_offsets,
+                            num_segments,
+                            d_result,
+                            simple_op.get_binary_op(),
+                            simple_op.template get_identity<ResultType>(),
+                            stream);
+  } else {
+    auto it = thrust::make_transform_iterator(
+      dcol->begin<ElementType>(), simple_op.template get_element_transformer<ResultType>());
+    device_segmented_reduce(it,
+                            d_offsets,
+                            num_segments,
+                            d_result,
+                            simple_op.get_binary_op(),
+                            simple_op.template get_identity<ResultType>(),
+                            stream);
+  }
+
+  // Segments without any valid element are null
+  rmm::device_vector<size_type> valid_counts(num_segments);
+  if (col.has_nulls()) {
+    auto is_valid = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0), [d_col = *dcol] __device__(size_type i) {
+        return static_cast<size_type>(d_col.is_valid(i));
+      });
+    device_segmented_reduce(
+      is_valid, d_offsets, num_segments, valid_counts.begin(), cudf::DeviceSum{}, 0, stream);
+  }
+  auto null_mask = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_segments),
+    [d_offsets,
+     d_valid_counts = valid_counts.data().get(),
+     has_nulls      = col.has_nulls()] __device__(size_type i) {
+      return has_nulls ? d_valid_counts[i] > 0 : d_offsets[i + 1] > d_offsets[i];
+    },
+    stream,
+    mr);
+  if (null_mask.second > 0) {
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+  return result;
+}
+
+// @brief result type dispatcher for segmented reductions
+template <typename ElementType, typename Op>
+struct result_type_dispatcher {
+  template <typename ResultType>
+  static constexpr bool is_supported_v()
+  {
+    // the available combination of input and output dtypes are any arithmetic dtype,
+    // including bool, to any arithmetic dtype
+    return std::is_arithmetic<ElementType>::value && std::is_arithmetic<ResultType>::value;
+  }
+
+  template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     column_view const& offsets,
+                                     data_type const output_dtype,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    return simple_segmented_reduction<ElementType, ResultType, Op>(
+      col, offsets, output_dtype, mr, stream);
+  }
+
+  template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     column_view const& offsets,
+                                     data_type const output_dtype,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    CUDF_FAIL("Segmented reductions are only supported between arithmetic types");
+  }
+};
+
+// @brief input column element dispatcher for segmented reductions
+template <typename Op>
+struct element_type_dispatcher {
+  template <typename ElementType>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     column_view const& offsets,
+                                     data_type const output_dtype,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    return cudf::type_dispatcher(output_dtype,
+                                 result_type_dispatcher<ElementType, Op>(),
+                                 col,
+                                 offsets,
+                                 output_dtype,
+                                 mr,
+                                 stream);
+  }
+};
+
+template <typename Op>
+std::unique_ptr<column> dispatch_segmented_reduction(column_view const& col,
+                                                     column_view const& offsets,
+                                                     data_type const output_dtype,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  return cudf::type_dispatcher(
+    col.type(), element_type_dispatcher<Op>(), col, offsets, output_dtype, mr, stream);
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_reduce(column_view const& col,
+                                         column_view const& offsets,
+                                         aggregation::Kind kind,
+                                         data_type const output_dtype,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>() and offsets.size() > 0 and
+                 not offsets.has_nulls(),
+               "Segment offsets must be a non-empty INT32 column without nulls");
+  switch (kind) {
+    case aggregation::SUM:
+      return dispatch_segmented_reduction<op::sum>(col, offsets, output_dtype, mr, stream);
+    case aggregation::PRODUCT:
+      return dispatch_segmented_reduction<op::product>(col, offsets, output_dtype, mr, stream);
+    case aggregation::MIN:
+      return dispatch_segmented_reduction<op::min>(col, offsets, output_dtype, mr, stream);
+    case aggregation::MAX:
+      return dispatch_segmented_reduction<op::max>(col, offsets, output_dtype, mr, stream);
+    case aggregation::ANY:
+      CUDF_EXPECTS(output_dtype == data_type(BOOL8),
+                   "any() operation can be applied with output type `bool8` only");
+      return dispatch_segmented_reduction<op::max>(col, offsets, output_dtype, mr, stream);
+    case aggregation::ALL:
+      CUDF_EXPECTS(output_dtype == data_type(BOOL8),
+                   "all() operation can be applied with output type `bool8` only");
+      return dispatch_segmented_reduction<op::min>(col, offsets, output_dtype, mr, stream);
+    default: CUDF_FAIL("Unsupported segmented reduction operator");
+  }
+}
+
+}  // namespace reduction
+
+std::unique_ptr<column> segmented_reduce(column_view const& col,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::segmented_reduce(col, offsets, agg->kind, output_dtype, mr);
+}
+
+}  // namespace cudf
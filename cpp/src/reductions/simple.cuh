@@ -60,8 +60,8 @@ std::unique_ptr<scalar> simple_reduction(column_view const& col,
       dcol->begin<ElementType>(), simple_op.template get_element_transformer<ResultType>());
     result = detail::reduce(it, col.size(), Op{}, mr, stream);
   }
-  // set scalar is valid
-  result->set_valid((col.null_count() < col.size()), stream);
+  // `detail::reduce` returns a valid scalar; only overwrite the validity when it is not
+  if (col.null_count() == col.size()) { result->set_valid(false, stream); }
   return result;
 };
 
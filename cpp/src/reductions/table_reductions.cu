@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cub/cub.cuh>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace reduction {
+namespace {
+/**
+ * @brief Every reduction of an arithmetic column that is computed by one traversal
+ *
+ * The sums and the product are accumulated in `double` for floating-point columns and in
+ * `int64_t` otherwise.
+ */
+template <typename T>
+struct column_summary {
+  using accumulator_type = std::conditional_t<std::is_floating_point<T>::value, double, int64_t>;
+
+  accumulator_type sum;
+  accumulator_type product;
+  accumulator_type sum_of_squares;
+  T min;
+  T max;
+  size_type valid_count;
+  size_type nonzero_count;
+
+  static CUDA_HOST_DEVICE_CALLABLE column_summary identity()
+  {
+    return column_summary{0,
+                          1,
+                          0,
+                          std::numeric_limits<T>::max(),
+                          std::numeric_limits<T>::lowest(),
+                          0,
+                          0};
+  }
+};
+
+/**
+ * @brief Returns the summary of a single row, the identity for a null row
+ */
+template <typename T>
+struct summarize_row {
+  column_device_view col;
+
+  __device__ column_summary<T> operator()(size_type row) const
+  {
+    if (col.is_null(row)) { return column_summary<T>::identity(); }
+    auto const value = col.element<T>(row);
+    auto const acc   = static_cast<typename column_summary<T>::accumulator_type>(value);
+    return column_summary<T>{acc, acc, acc * acc, value, value, 1, value != T{0}};
+  }
+};
+
+/**
+ * @brief Combines the summaries of two ranges of rows
+ */
+template <typename T>
+struct combine_summaries {
+  __device__ column_summary<T> operator()(column_summary<T> const& lhs,
+                                          column_summary<T> const& rhs) const
+  {
+    return column_summary<T>{lhs.sum + rhs.sum,
+                             lhs.product * rhs.product,
+                             lhs.sum_of_squares + rhs.sum_of_squares,
+                             rhs.min < lhs.min ? rhs.min : lhs.min,
+                             lhs.max < rhs.max ? rhs.max : lhs.max,
+                             lhs.valid_count + rhs.valid_count,
+                             lhs.nonzero_count + rhs.nonzero_count};
+  }
+};
+
+/**
+ * @brief Returns the size of the summary of a column, 0 if the column is not arithmetic
+ */
+struct summary_size {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  size_t operator()()
+  {
+    return sizeof(column_summary<T>);
+  }
+
+  template <typename T, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  size_t operator()()
+  {
+    return 0;
+  }
+};
+
+/**
+ * @brief Computes the summary of a column into device memory, without synchronizing
+ */
+struct summarize_column {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  void operator()(column_view const& col, void* d_summary, cudaStream_t stream)
+  {
+    auto const d_col = column_device_view::create(col, stream);
+    auto const input = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                       summarize_row<T>{*d_col});
+    auto const output = static_cast<column_summary<T>*>(d_summary);
+
+    size_t temp_storage_bytes{0};
+    CUDA_TRY(cub::DeviceReduce::Reduce(nullptr,
+                                       temp_storage_bytes,
+                                       input,
+                                       output,
+                                       col.size(),
+                                       combine_summaries<T>{},
+                                       column_summary<T>::identity(),
+                                       stream));
+    rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+    CUDA_TRY(cub::DeviceReduce::Reduce(d_temp_storage.data(),
+                                       temp_storage_bytes,
+                                       input,
+                                       output,
+                                       col.size(),
+                                       combine_summaries<T>{},
+                                       column_summary<T>::identity(),
+                                       stream));
+  }
+
+  template <typename T, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  void operator()(column_view const&, void*, cudaStream_t)
+  {
+    CUDF_FAIL("Only arithmetic columns are summarized");
+  }
+};
+
+/**
+ * @brief Returns a column of a single row holding `value`, or a null row
+ */
+template <typename V>
+std::unique_ptr<column> make_single_row_column(data_type type,
+                                               V value,
+                                               bool valid,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  rmm::device_buffer data(&value, sizeof(V), stream, mr);
+  if (valid) { return std::make_unique<column>(type, 1, std::move(data)); }
+  return std::make_unique<column>(
+    type, 1, std::move(data), create_null_mask(1, mask_state::ALL_NULL, stream, mr), 1);
+}
+
+/**
+ * @brief Returns the reduction of a column by `kind` from its summary, `nullptr` if `kind` is
+ * not computed by the summary
+ */
+struct summary_result {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(void const* h_summary,
+                                     column_view const& col,
+                                     aggregation::Kind kind,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    auto const& summary    = *static_cast<column_summary<T> const*>(h_summary);
+    using accumulator_type = typename column_summary<T>::accumulator_type;
+    auto const acc_type    = data_type{type_to_id<accumulator_type>()};
+    bool const valid       = summary.valid_count > 0;
+    switch (kind) {
+      case aggregation::SUM:
+        return make_single_row_column(acc_type, summary.sum, valid, mr, stream);
+      case aggregation::PRODUCT:
+        return make_single_row_column(acc_type, summary.product, valid, mr, stream);
+      case aggregation::SUM_OF_SQUARES:
+        return make_single_row_column(acc_type, summary.sum_of_squares, valid, mr, stream);
+      case aggregation::MIN:
+        return make_single_row_column(col.type(), summary.min, valid, mr, stream);
+      case aggregation::MAX:
+        return make_single_row_column(col.type(), summary.max, valid, mr, stream);
+      case aggregation::ANY:
+        return make_single_row_column(
+          data_type{BOOL8}, summary.nonzero_count > 0, valid, mr, stream);
+      case aggregation::ALL:
+        return make_single_row_column(
+          data_type{BOOL8}, summary.nonzero_count == summary.valid_count, valid, mr, stream);
+      case aggregation::MEAN:
+        return make_single_row_column(data_type{FLOAT64},
+                                      static_cast<double>(summary.sum) / summary.valid_count,
+                                      valid,
+                                      mr,
+                                      stream);
+      case aggregation::COUNT_VALID:
+        return make_single_row_column(data_type{INT32}, summary.valid_count, true, mr, stream);
+      case aggregation::COUNT_ALL:
+        return make_single_row_column(data_type{INT32}, col.size(), true, mr, stream);
+      default: return nullptr;
+    }
+  }
+
+  template <typename T, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(void const*,
+                                     column_view const&,
+                                     aggregation::Kind,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t)
+  {
+    CUDF_FAIL("Only arithmetic columns are summarized");
+  }
+};
+
+/**
+ * @brief Returns the output type of the reduction of `col` by `kind`
+ */
+data_type reduction_output_type(column_view const& col, aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::MIN:
+    case aggregation::MAX: return col.type();
+    case aggregation::ANY:
+    case aggregation::ALL: return data_type{BOOL8};
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::SUM_OF_SQUARES:
+      return data_type{col.type().id() == FLOAT32 or col.type().id() == FLOAT64 ? FLOAT64 : INT64};
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::NUNIQUE: return data_type{INT32};
+    default: return data_type{FLOAT64};
+  }
+}
+
+/**
+ * @brief Reduces `col` by `agg` with a separate reduction
+ */
+std::unique_ptr<column> reduce_one(column_view const& col,
+                                   std::unique_ptr<aggregation> const& agg,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  if (agg->kind == aggregation::COUNT_VALID or agg->kind == aggregation::COUNT_ALL) {
+    auto const count =
+      agg->kind == aggregation::COUNT_ALL ? col.size() : col.size() - col.null_count();
+    return make_single_row_column(data_type{INT32}, count, true, mr, stream);
+  }
+  auto const result = cudf::reduce(col, agg, reduction_output_type(col, agg->kind), mr);
+  return make_column_from_scalar(*result, 1, mr, stream);
+}
+
+}  // namespace
+
+std::unique_ptr<table> reduce_columns(table_view const& input,
+                                      std::vector<std::unique_ptr<aggregation>> const& aggs,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  // Lay out the summaries of all arithmetic columns in one buffer
+  constexpr size_t summary_alignment = alignof(std::max_align_t);
+  std::vector<size_t> summary_offsets;
+  size_t summary_bytes = 0;
+  for (auto const& col : input) {
+    summary_offsets.push_back(summary_bytes);
+    auto const size = type_dispatcher(col.type(), summary_size{});
+    summary_bytes += (size + summary_alignment - 1) / summary_alignment * summary_alignment;
+  }
+
+  // Each arithmetic column is traversed once, and all summaries are copied back together
+  rmm::device_buffer d_summaries(summary_bytes, stream);
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col = input.column(i);
+    if (is_numeric(col.type())) {
+      type_dispatcher(col.type(),
+                      summarize_column{},
+                      col,
+                      static_cast<int8_t*>(d_summaries.data()) + summary_offsets[i],
+                      stream);
+    }
+  }
+  std::vector<int8_t> h_summaries(summary_bytes);
+  if (summary_bytes > 0) {
+    CUDA_TRY(cudaMemcpyAsync(h_summaries.data(),
+                             d_summaries.data(),
+                             summary_bytes,
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  std::vector<std::unique_ptr<column>> results;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col = input.column(i);
+    for (auto const& agg : aggs) {
+      auto const h_summary = h_summaries.data() + summary_offsets[i];
+      auto result          = is_numeric(col.type())
+                      ? type_dispatcher(
+                          col.type(), summary_result{}, h_summary, col, agg->kind, mr, stream)
+                      : nullptr;
+      results.push_back(result ? std::move(result) : reduce_one(col, agg, mr, stream));
+    }
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
+}  // namespace reduction
+
+std::unique_ptr<table> reduce(table_view const& input,
+                              std::vector<std::unique_ptr<aggregation>> const& aggs,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::reduce_columns(input, aggs, mr);
+}
+
+}  // namespace cudf
@@ -143,24 +143,21 @@ std::unique_ptr<cudf::column> clamp_string_column(strings_column_view const& inp
                              mr);
 }
 
+/**
+ * @brief Writes the clamped values of the fixed-width column `input` into `output`, which
+ * may be `input` itself.
+ */
 template <typename T, typename ScalarIterator>
-std::enable_if_t<cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>> clamper(
-  column_view const& input,
-  ScalarIterator const& lo_itr,
-  ScalarIterator const& lo_replace_itr,
-  ScalarIterator const& hi_itr,
-  ScalarIterator const& hi_replace_itr,
-  rmm::mr::device_memory_resource* mr,
-  cudaStream_t stream)
+void clamp_fixed_width(column_view const& input,
+                       mutable_column_view& output,
+                       ScalarIterator const& lo_itr,
+                       ScalarIterator const& lo_replace_itr,
+                       ScalarIterator const& hi_itr,
+                       ScalarIterator const& hi_replace_itr,
+                       cudaStream_t stream)
 {
-  auto output =
-    detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, mr, stream);
-  // mask will not change
-  if (input.nullable()) { output->set_null_mask(copy_bitmask(input), input.null_count()); }
-
-  auto output_device_view =
-    cudf::mutable_column_device_view::create(output->mutable_view(), stream);
-  auto input_device_view = cudf::column_device_view::create(input, stream);
+  auto output_device_view = cudf::mutable_column_device_view::create(output, stream);
+  auto input_device_view  = cudf::column_device_view::create(input, stream);
   auto scalar_zip_itr =
     thrust::make_zip_iterator(thrust::make_tuple(lo_itr, lo_replace_itr, hi_itr, hi_replace_itr));
 
@@ -196,6 +193,26 @@ std::enable_if_t<cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>> clamp
                       output_device_view->begin<T>(),
                       trans);
   }
+}
+
+template <typename T, typename ScalarIterator>
+std::enable_if_t<cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>> clamper(
+  column_view const& input,
+  ScalarIterator const& lo_itr,
+  ScalarIterator const& lo_replace_itr,
+  ScalarIterator const& hi_itr,
+  ScalarIterator const& hi_replace_itr,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto output =
+    detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, mr, stream);
+  // mask will not change
+  if (input.nullable()) { output->set_null_mask(copy_bitmask(input), input.null_count()); }
+
+  auto output_view = output->mutable_view();
+  clamp_fixed_width<T>(
+    input, output_view, lo_itr, lo_replace_itr, hi_itr, hi_replace_itr, stream);
 
   return output;
 }
@@ -271,6 +288,33 @@ struct dispatch_clamp {
 
     return clamp<T>(input, lo_itr, lo_replace_itr, hi_itr, hi_replace_itr, mr, stream);
   }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_fixed_width<T>()> operator()(mutable_column_view& in_out,
+                                                         scalar const& lo,
+                                                         scalar const& lo_replace,
+                                                         scalar const& hi,
+                                                         scalar const& hi_replace,
+                                                         cudaStream_t stream)
+  {
+    auto lo_itr         = make_pair_iterator<T>(lo);
+    auto hi_itr         = make_pair_iterator<T>(hi);
+    auto lo_replace_itr = make_pair_iterator<T>(lo_replace);
+    auto hi_replace_itr = make_pair_iterator<T>(hi_replace);
+
+    clamp_fixed_width<T>(in_out, in_out, lo_itr, lo_replace_itr, hi_itr, hi_replace_itr, stream);
+  }
+
+  template <typename T>
+  std::enable_if_t<not cudf::is_fixed_width<T>()> operator()(mutable_column_view&,
+                                                             scalar const&,
+                                                             scalar const&,
+                                                             scalar const&,
+                                                             scalar const&,
+                                                             cudaStream_t)
+  {
+    CUDF_FAIL("clamp in-place is only supported for fixed-width types");
+  }
 };
 
 template <>
@@ -287,22 +331,14 @@ std::unique_ptr<column> dispatch_clamp::operator()<cudf::list_view>(
 }
 
 /**
- * @copydoc cudf::clamp(column_view const& input,
-                                      scalar const& lo,
-                                      scalar const& lo_replace,
-                                      scalar const& hi,
-                                      scalar const& hi_replace,
-                                      rmm::mr::device_memory_resource* mr);
- *
- * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @brief Checks the arguments of `clamp` and returns whether it changes any value of `input`.
  */
-std::unique_ptr<column> clamp(column_view const& input,
+bool validate_clamp_arguments(column_view const& input,
                               scalar const& lo,
                               scalar const& lo_replace,
                               scalar const& hi,
                               scalar const& hi_replace,
-                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-                              cudaStream_t stream                 = 0)
+                              cudaStream_t stream)
 {
   CUDF_EXPECTS(lo.type() == hi.type(), "mismatching types of limit scalars");
   CUDF_EXPECTS(lo_replace.type() == hi_replace.type(), "mismatching types of replace scalars");
@@ -310,8 +346,7 @@ std::unique_ptr<column> clamp(column_view const& input,
   CUDF_EXPECTS(lo.type() == input.type(), "mismatching types of scalar and input");
 
   if ((not lo.is_valid(stream) and not hi.is_valid(stream)) or (input.is_empty())) {
-    // There will be no change
-    return std::make_unique<column>(input, stream, mr);
+    return false;
   }
 
   if (lo.is_valid(stream)) {
@@ -320,11 +355,55 @@ std::unique_ptr<column> clamp(column_view const& input,
   if (hi.is_valid(stream)) {
     CUDF_EXPECTS(hi_replace.is_valid(stream), "hi_replace can't be null if hi is not null");
   }
+  return true;
+}
+
+/**
+ * @copydoc cudf::clamp(column_view const& input,
+                                      scalar const& lo,
+                                      scalar const& lo_replace,
+                                      scalar const& hi,
+                                      scalar const& hi_replace,
+                                      rmm::mr::device_memory_resource* mr);
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> clamp(column_view const& input,
+                              scalar const& lo,
+                              scalar const& lo_replace,
+                              scalar const& hi,
+                              scalar const& hi_replace,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream                 = 0)
+{
+  if (not validate_clamp_arguments(input, lo, lo_replace, hi, hi_replace, stream)) {
+    // There will be no change
+    return std::make_unique<column>(input, stream, mr);
+  }
 
   return cudf::type_dispatcher(
     input.type(), dispatch_clamp{}, input, lo, lo_replace, hi, hi_replace, mr, stream);
 }
 
+/**
+ * @copydoc cudf::clamp_in_place(mutable_column_view&, scalar const&, scalar const&,
+ * scalar const&, scalar const&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void clamp_in_place(mutable_column_view& in_out,
+                    scalar const& lo,
+                    scalar const& lo_replace,
+                    scalar const& hi,
+                    scalar const& hi_replace,
+                    cudaStream_t stream = 0)
+{
+  if (not validate_clamp_arguments(in_out, lo, lo_replace, hi, hi_replace, stream)) { return; }
+
+  cudf::type_dispatcher(
+    in_out.type(), dispatch_clamp{}, in_out, lo, lo_replace, hi, hi_replace, stream);
+}
+
 }  // namespace detail
 
 // clamp input at lo and hi with lo_replace and hi_replace
@@ -348,4 +427,22 @@ std::unique_ptr<column> clamp(column_view const& input,
   CUDF_FUNC_RANGE();
   return detail::clamp(input, lo, lo, hi, hi, mr);
 }
+
+// clamp in_out in-place at lo and hi with lo_replace and hi_replace
+void clamp_in_place(mutable_column_view& in_out,
+                    scalar const& lo,
+                    scalar const& lo_replace,
+                    scalar const& hi,
+                    scalar const& hi_replace)
+{
+  CUDF_FUNC_RANGE();
+  detail::clamp_in_place(in_out, lo, lo_replace, hi, hi_replace);
+}
+
+// clamp in_out in-place at lo and hi
+void clamp_in_place(mutable_column_view& in_out, scalar const& lo, scalar const& hi)
+{
+  CUDF_FUNC_RANGE();
+  detail::clamp_in_place(in_out, lo, lo, hi, hi);
+}
 }  // namespace cudf
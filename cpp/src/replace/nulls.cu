@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/replace.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/replace.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief A fixed-width column whose nulls are replaced by `replace_nulls_kernel`.
+ *
+ * Each output row is copied from `replacement` if the input row is null, or from the input
+ * row `gather_map[row]` if there is a gather map. Out-of-bounds gather map rows are skipped.
+ */
+struct fused_column {
+  uint8_t const* input;
+  uint8_t* output;
+  bitmask_type const* null_mask;
+  size_type offset;
+  size_type element_size;
+  uint8_t const* replacement;
+  size_type const* gather_map;
+};
+
+__device__ inline void copy_element(uint8_t* target, uint8_t const* source, size_type size)
+{
+  switch (size) {
+    case 1: *target = *source; break;
+    case 2: *reinterpret_cast<int16_t*>(target) = *reinterpret_cast<int16_t const*>(source); break;
+    case 4: *reinterpret_cast<int32_t*>(target) = *reinterpret_cast<int32_t const*>(source); break;
+    case 8: *reinterpret_cast<int64_t*>(target) = *reinterpret_cast<int64_t const*>(source); break;
+    default:
+      for (size_type i = 0; i < size; ++i) { target[i] = source[i]; }
+  }
+}
+
+/**
+ * @brief Replaces the nulls of the fixed-width columns `columns`, one column per
+ * `blockIdx.y`, in a single launch.
+ */
+__global__ void replace_nulls_kernel(fused_column const* columns, size_type num_rows)
+{
+  auto const& col = columns[blockIdx.y];
+  auto const size = col.element_size;
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < num_rows;
+       row += blockDim.x * gridDim.x) {
+    uint8_t const* source = col.input + static_cast<int64_t>(row) * size;
+    if (col.gather_map != nullptr) {
+      auto const index = col.gather_map[row];
+      if (index < 0 or index >= num_rows) { continue; }
+      source = col.input + static_cast<int64_t>(index) * size;
+    } else if (col.null_mask != nullptr and not bit_is_set(col.null_mask, col.offset + row)) {
+      source = col.replacement;
+    }
+    copy_element(col.output + static_cast<int64_t>(row) * size, source, size);
+  }
+}
+
+/**
+ * @brief Launches `replace_nulls_kernel` over `columns`, at most 65535 columns per launch.
+ */
+void launch_replace_nulls_kernel(std::vector<fused_column> const& columns,
+                                 size_type num_rows,
+                                 cudaStream_t stream)
+{
+  if (columns.empty() or num_rows == 0) { return; }
+  constexpr size_type block_size    = 256;
+  constexpr size_t max_grid_columns = 65535;
+  rmm::device_vector<fused_column> d_columns(columns);
+  cudf::detail::grid_1d grid{num_rows, block_size};
+  for (size_t first = 0; first < columns.size(); first += max_grid_columns) {
+    auto const count = std::min(max_grid_columns, columns.size() - first);
+    dim3 const grid_dim(grid.num_blocks, static_cast<unsigned>(count));
+    replace_nulls_kernel<<<grid_dim, block_size, 0, stream>>>(d_columns.data().get() + first,
+                                                              num_rows);
+  }
+  CHECK_CUDA(stream);
+}
+
+/**
+ * @brief Returns the device pointer to the value of a fixed-width scalar
+ */
+struct scalar_data_pointer {
+  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  uint8_t const* operator()(scalar const& s)
+  {
+    using ScalarType = cudf::scalar_type_t<T>;
+    return reinterpret_cast<uint8_t const*>(static_cast<ScalarType const&>(s).data());
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
+  uint8_t const* operator()(scalar const&)
+  {
+    CUDF_FAIL("Scalar is not fixed width");
+  }
+};
+
+fused_column make_fused_column(column_view const& input, mutable_column_view output)
+{
+  auto const element_size = static_cast<size_type>(size_of(input.type()));
+  return fused_column{input.head<uint8_t>() + static_cast<int64_t>(input.offset()) * element_size,
+                      output.data<uint8_t>(),
+                      input.null_mask(),
+                      input.offset(),
+                      element_size,
+                      nullptr,
+                      nullptr};
+}
+
+/**
+ * @brief Returns whether row `row` of the fused column `col` gathers an existing row
+ */
+struct gathers_valid_row {
+  fused_column const* columns;
+  size_type num_rows;
+
+  __device__ bool operator()(size_type col, size_type row) const
+  {
+    auto const index = columns[col].gather_map[row];
+    return index >= 0 and index < num_rows;
+  }
+};
+
+}  // namespace
+
+void replace_nulls_in_place(mutable_column_view& in_out,
+                            scalar const& replacement,
+                            cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_fixed_width(in_out.type()), "In-place replace_nulls requires fixed-width data");
+  CUDF_EXPECTS(in_out.type() == replacement.type(), "Data type mismatch");
+  if (not in_out.has_nulls() or not replacement.is_valid(stream)) { return; }
+
+  // Each element is read and written by the same thread, so input and output may alias
+  auto fused        = make_fused_column(in_out, in_out);
+  fused.output      = const_cast<uint8_t*>(fused.input);
+  fused.replacement = type_dispatcher(replacement.type(), scalar_data_pointer{}, replacement);
+  launch_replace_nulls_kernel({fused}, in_out.size(), stream);
+
+  set_null_mask(in_out.null_mask(), in_out.offset(), in_out.offset() + in_out.size(), true, stream);
+  in_out.set_null_count(0);
+}
+
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(static_cast<size_type>(replacements.size()) == input.num_columns(),
+               "Number of replacements must match the number of columns");
+
+  std::vector<std::unique_ptr<column>> outputs(input.num_columns());
+  std::vector<fused_column> fused;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col         = input.column(i);
+    auto const& replacement = replacements[i].get();
+    CUDF_EXPECTS(col.type() == replacement.type(), "Data type mismatch");
+    // Columns that cannot be fused, or need no replacement, are handled one by one
+    if (not is_fixed_width(col.type()) or not col.has_nulls() or not replacement.is_valid()) {
+      outputs[i] = replace_nulls(col, replacement, mr, stream);
+      continue;
+    }
+    outputs[i] =
+      make_fixed_width_column(col.type(), col.size(), mask_state::UNALLOCATED, stream, mr);
+    fused.push_back(make_fused_column(col, outputs[i]->mutable_view()));
+    fused.back().replacement =
+      type_dispatcher(replacement.type(), scalar_data_pointer{}, replacement);
+  }
+  launch_replace_nulls_kernel(fused, input.num_rows(), stream);
+  return std::make_unique<table>(std::move(outputs));
+}
+
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     replace_policy policy,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  auto const num_rows = input.num_rows();
+  std::vector<std::unique_ptr<column>> outputs(input.num_columns());
+  std::vector<size_type> nullable_columns;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (input.column(i).has_nulls()) {
+      nullable_columns.push_back(i);
+    } else {
+      outputs[i] = std::make_unique<column>(input.column(i), stream, mr);
+    }
+  }
+  if (nullable_columns.empty()) { return std::make_unique<table>(std::move(outputs)); }
+
+  // Gather maps of all the columns with nulls, one after the other. Each row gathers the
+  // closest valid row before (PRECEDING) or after (FOLLOWING) it, found with one scan over
+  // the validity of all the columns; rows without one gather an out-of-bounds row.
+  auto const nullable  = input.select(nullable_columns);
+  auto const d_input   = table_device_view::create(nullable, stream);
+  auto const total     = static_cast<int64_t>(nullable.num_columns()) * num_rows;
+  auto const preceding = policy == replace_policy::PRECEDING;
+  rmm::device_vector<size_type> gather_maps(total);
+  {
+    auto const sentinel = preceding ? size_type{-1} : num_rows;
+    auto const position = [preceding, total] __device__(int64_t i) {
+      return preceding ? i : total - 1 - i;
+    };
+    auto const keys = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<int64_t>(0),
+      [position, num_rows] __device__(int64_t i) { return position(i) / num_rows; });
+    auto const rows = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<int64_t>(0),
+      [position, num_rows, sentinel, d_input = *d_input] __device__(int64_t i) {
+        auto const col = static_cast<size_type>(position(i) / num_rows);
+        auto const row = static_cast<size_type>(position(i) % num_rows);
+        return d_input.column(col).is_valid_nocheck(row) ? row : sentinel;
+      });
+    if (preceding) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    keys,
+                                    keys + total,
+                                    rows,
+                                    gather_maps.begin(),
+                                    thrust::equal_to<int64_t>{},
+                                    thrust::maximum<size_type>{});
+    } else {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    keys,
+                                    keys + total,
+                                    rows,
+                                    thrust::make_reverse_iterator(gather_maps.end()),
+                                    thrust::equal_to<int64_t>{},
+                                    thrust::minimum<size_type>{});
+    }
+  }
+
+  std::vector<fused_column> fused;
+  std::vector<bitmask_type*> masks;
+  std::vector<column*> fused_outputs;
+  for (size_t k = 0; k < nullable_columns.size(); ++k) {
+    auto const& col = input.column(nullable_columns[k]);
+    auto const map  = gather_maps.data().get() + static_cast<int64_t>(k) * num_rows;
+    auto& output    = outputs[nullable_columns[k]];
+    if (not is_fixed_width(col.type())) {
+      // Other types use their gather, with rows without a valid row nullified
+      auto gathered = gather(table_view{{col}},
+                             column_view{data_type{type_to_id<size_type>()}, num_rows, map},
+                             out_of_bounds_policy::NULLIFY,
+                             negative_index_policy::NOT_ALLOWED,
+                             mr,
+                             stream);
+      output = std::move(gathered->release().front());
+      continue;
+    }
+    output =
+      make_fixed_width_column(col.type(), num_rows, mask_state::UNINITIALIZED, stream, mr);
+    fused.push_back(make_fused_column(col, output->mutable_view()));
+    fused.back().gather_map = map;
+    masks.push_back(output->mutable_view().null_mask());
+    fused_outputs.push_back(output.get());
+  }
+  if (fused.empty()) { return std::make_unique<table>(std::move(outputs)); }
+
+  launch_replace_nulls_kernel(fused, num_rows, stream);
+
+  // Null masks of all the fused columns in one launch
+  constexpr size_type block_size = 256;
+  rmm::device_vector<fused_column> d_fused(fused);
+  rmm::device_vector<bitmask_type*> d_masks(masks);
+  rmm::device_vector<size_type> d_valid_counts(masks.size(), 0);
+  auto counting_it = thrust::make_counting_iterator<size_type>(0);
+  auto kernel =
+    valid_if_n_kernel<decltype(counting_it), decltype(counting_it), gathers_valid_row, block_size>;
+  cudf::detail::grid_1d grid{num_rows, block_size, 1};
+  kernel<<<grid.num_blocks, block_size, 0, stream>>>(
+    counting_it,
+    counting_it,
+    gathers_valid_row{d_fused.data().get(), num_rows},
+    d_masks.data().get(),
+    static_cast<size_type>(masks.size()),
+    num_rows,
+    d_valid_counts.data().get());
+  thrust::host_vector<size_type> valid_counts(d_valid_counts);
+  for (size_t k = 0; k < fused_outputs.size(); ++k) {
+    fused_outputs[k]->set_null_count(num_rows - valid_counts[k]);
+  }
+  return std::make_unique<table>(std::move(outputs));
+}
+
+}  // namespace detail
+
+void replace_nulls_in_place(mutable_column_view& in_out, scalar const& replacement)
+{
+  CUDF_FUNC_RANGE();
+  detail::replace_nulls_in_place(in_out, replacement, 0);
+}
+
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_nulls(input, replacements, mr, 0);
+}
+
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     replace_policy policy,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_nulls(input, policy, mr, 0);
+}
+
+std::unique_ptr<column> replace_nulls(column_view const& input,
+                                      replace_policy policy,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return std::move(detail::replace_nulls(table_view{{input}}, policy, mr, 0)->release().front());
+}
+
+}  // namespace cudf
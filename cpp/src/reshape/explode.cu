@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <lists/utilities.cuh>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+std::unique_ptr<table> explode(table_view const& input_table,
+                               size_type explode_column_idx,
+                               bool include_position,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  lists_column_view const lists{input_table.column(explode_column_idx)};
+  auto const child = lists.child();
+
+  // The rows of the other columns are repeated for every element of their list
+  auto const range = lists::detail::element_range(lists, stream);
+  auto const rows  = lists::detail::element_rows(lists, range, stream);
+  std::vector<size_type> other_columns(input_table.num_columns() - 1);
+  auto const split = other_columns.begin() + explode_column_idx;
+  std::iota(other_columns.begin(), split, 0);
+  std::iota(split, other_columns.end(), explode_column_idx + 1);
+  auto columns =
+    detail::gather(input_table.select(other_columns), rows.begin(), rows.end(), false, mr, stream)
+      ->release();
+
+  auto elements = detail::gather(table_view{{child}},
+                                 thrust::make_counting_iterator<size_type>(range.first),
+                                 thrust::make_counting_iterator<size_type>(range.second),
+                                 false,
+                                 mr,
+                                 stream)
+                    ->release();
+  auto const position = columns.begin() + explode_column_idx;
+  auto const exploded = columns.insert(position, std::move(elements.front()));
+
+  if (include_position) {
+    auto positions = make_numeric_column(data_type{INT32},
+                                         static_cast<size_type>(rows.size()),
+                                         mask_state::UNALLOCATED,
+                                         stream,
+                                         mr);
+    auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(range.first),
+                      thrust::make_counting_iterator<size_type>(range.second),
+                      rows.begin(),
+                      positions->mutable_view().data<size_type>(),
+                      [d_offsets] __device__(size_type idx, size_type row) {
+                        return idx - d_offsets[row];
+                      });
+    columns.insert(exploded, std::move(positions));
+  }
+
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> explode(table_view const& input_table,
+                               size_type explode_column_idx,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode(input_table, explode_column_idx, false, 0, mr);
+}
+
+std::unique_ptr<table> explode_position(table_view const& input_table,
+                                        size_type explode_column_idx,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode(input_table, explode_column_idx, true, 0, mr);
+}
+
+}  // namespace cudf
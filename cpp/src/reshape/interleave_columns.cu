@@ -17,13 +17,42 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/int_fastdiv.h>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
+#include <reshape/wide_copy.cuh>
 #include <strings/utilities.cuh>
 
 namespace cudf {
 namespace detail {
 namespace {
+/**
+ * @brief Cursor of `wide_copy_kernel` over the interleaved rows of the columns of `input`.
+ */
+template <typename T>
+struct interleave_source {
+  table_device_view input;
+  int_fastdiv num_columns;
+  size_type row;
+  size_type col;
+
+  __device__ void seek(size_type idx)
+  {
+    row = idx / num_columns;
+    col = idx - row * num_columns;
+  }
+
+  __device__ T next()
+  {
+    auto const value = input.column(col).element<T>(row);
+    if (++col == num_columns) {
+      col = 0;
+      ++row;
+    }
+    return value;
+  }
+};
+
 struct interleave_columns_functor {
   template <typename T, typename... Args>
   std::enable_if_t<not cudf::is_fixed_width<T>() and not std::is_same<T, cudf::string_view>::value,
@@ -52,6 +81,7 @@ struct interleave_columns_functor {
     auto table       = table_device_view::create(strings_columns, stream);
     auto d_table     = *table;
     auto num_strings = num_columns * strings_count;
+    int_fastdiv const divisor(num_columns);
 
     std::pair<rmm::device_buffer, size_type> valid_mask{{}, 0};
     if (create_mask) {
@@ -59,9 +89,9 @@ struct interleave_columns_functor {
       valid_mask = cudf::detail::valid_if(
         thrust::make_counting_iterator<size_type>(0),
         thrust::make_counting_iterator<size_type>(num_strings),
-        [num_columns, d_table] __device__(size_type idx) {
-          auto source_row_idx = idx % num_columns;
-          auto source_col_idx = idx / num_columns;
+        [divisor, d_table] __device__(size_type idx) {
+          auto source_row_idx = idx % divisor;
+          auto source_col_idx = idx / divisor;
           return !d_table.column(source_row_idx).is_null(source_col_idx);
         },
         stream,
@@ -71,10 +101,10 @@ struct interleave_columns_functor {
     auto const null_count = valid_mask.second;
 
     // Build offsets column by computing sizes of each string in the output
-    auto offsets_transformer = [num_columns, d_table] __device__(size_type idx) {
+    auto offsets_transformer = [divisor, d_table] __device__(size_type idx) {
       // First compute the column and the row this item belongs to
-      auto source_row_idx = idx % num_columns;
-      auto source_col_idx = idx / num_columns;
+      auto source_row_idx = idx % divisor;
+      auto source_col_idx = idx / divisor;
       return d_table.column(source_row_idx).is_valid(source_col_idx)
                ? d_table.column(source_row_idx).element<string_view>(source_col_idx).size_bytes()
                : 0;
@@ -95,9 +125,9 @@ struct interleave_columns_functor {
       rmm::exec_policy(stream)->on(stream),
       thrust::make_counting_iterator<size_type>(0),
       num_strings,
-      [num_columns, d_table, d_results_offsets, d_results_chars] __device__(size_type idx) {
-        auto source_row_idx = idx % num_columns;
-        auto source_col_idx = idx / num_columns;
+      [divisor, d_table, d_results_offsets, d_results_chars] __device__(size_type idx) {
+        auto source_row_idx = idx % divisor;
+        auto source_col_idx = idx / divisor;
 
         // Do not write to buffer if the column value for this row is null
         if (d_table.column(source_row_idx).is_null(source_col_idx)) return;
@@ -128,42 +158,29 @@ struct interleave_columns_functor {
     auto output_size = input.num_columns() * input.num_rows();
     auto output =
       allocate_like(arch_column, output_size, mask_allocation_policy::NEVER, mr, stream);
-    auto device_input  = table_device_view::create(input);
-    auto device_output = mutable_column_device_view::create(*output);
-    auto index_begin   = thrust::make_counting_iterator<size_type>(0);
-    auto index_end     = thrust::make_counting_iterator<size_type>(output_size);
-
-    auto func_value = [input   = *device_input,
-                       divisor = input.num_columns()] __device__(size_type idx) {
-      return input.column(idx % divisor).element<T>(idx / divisor);
-    };
+    auto device_input = table_device_view::create(input, stream);
+    int_fastdiv const divisor(input.num_columns());
 
-    if (not create_mask) {
-      thrust::transform(rmm::exec_policy(stream)->on(stream),
-                        index_begin,
-                        index_end,
-                        device_output->data<T>(),
-                        func_value);
+    // Null rows are copied too: their value is unspecified and the mask hides them
+    launch_wide_copy(output->mutable_view().data<T>(),
+                     output_size,
+                     interleave_source<T>{*device_input, divisor, 0, 0},
+                     stream);
 
-      return output;
-    }
+    if (not create_mask) { return output; }
 
-    auto func_validity = [input   = *device_input,
-                          divisor = input.num_columns()] __device__(size_type idx) {
+    auto func_validity = [input = *device_input, divisor] __device__(size_type idx) {
       return input.column(idx % divisor).is_valid(idx / divisor);
     };
 
-    thrust::transform_if(rmm::exec_policy(stream)->on(stream),
-                         index_begin,
-                         index_end,
-                         device_output->data<T>(),
-                         func_value,
-                         func_validity);
-
     rmm::device_buffer mask;
     size_type null_count;
 
-    std::tie(mask, null_count) = valid_if(index_begin, index_end, func_validity, stream, mr);
+    std::tie(mask, null_count) = valid_if(thrust::make_counting_iterator<size_type>(0),
+                                          thrust::make_counting_iterator<size_type>(output_size),
+                                          func_validity,
+                                          stream,
+                                          mr);
 
     output->set_null_mask(std::move(mask), null_count);
 
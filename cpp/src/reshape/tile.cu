@@ -14,12 +14,19 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reshape.hpp>
+#include <cudf/detail/utilities/int_fastdiv.h>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <reshape/wide_copy.cuh>
 
 #include <memory>
 
@@ -30,10 +37,72 @@
 namespace cudf {
 namespace {
 struct tile_functor {
-  size_type count;
+  int_fastdiv count;
   size_type __device__ operator()(size_type i) { return i % count; }
 };
 
+/**
+ * @brief Cursor of `wide_copy_kernel` over the repeated rows of `input`.
+ */
+template <typename T>
+struct tile_source {
+  column_device_view input;
+  int_fastdiv num_rows;
+  size_type row;
+
+  __device__ void seek(size_type idx) { row = idx % num_rows; }
+
+  __device__ T next()
+  {
+    auto const value = input.element<T>(row);
+    if (++row == num_rows) { row = 0; }
+    return value;
+  }
+};
+
+/**
+ * @brief Tiles a fixed-width column with wide stores instead of a gather.
+ */
+struct tile_fixed_width_functor {
+  template <typename T>
+  std::enable_if_t<is_fixed_width<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    size_type out_num_rows,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto output = detail::allocate_like(
+      input, out_num_rows, mask_allocation_policy::NEVER, mr, stream);
+    auto device_input = column_device_view::create(input, stream);
+    int_fastdiv const in_num_rows(input.size());
+
+    detail::launch_wide_copy(output->mutable_view().data<T>(),
+                             out_num_rows,
+                             tile_source<T>{*device_input, in_num_rows, 0},
+                             stream);
+
+    if (input.nullable()) {
+      auto mask = detail::valid_if(
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(out_num_rows),
+        [input = *device_input, in_num_rows] __device__(size_type idx) {
+          return input.is_valid(idx % in_num_rows);
+        },
+        stream,
+        mr);
+      output->set_null_mask(std::move(mask.first), mask.second);
+    }
+    return output;
+  }
+
+  template <typename T>
+  std::enable_if_t<not is_fixed_width<T>(), std::unique_ptr<column>> operator()(
+    column_view const&, size_type, cudaStream_t, rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Only fixed-width columns are tiled with wide stores");
+  }
+};
+
 }  // anonymous namespace
 
 namespace detail {
@@ -49,10 +118,34 @@ std::unique_ptr<table> tile(const table_view &in,
   if (count == 0 or in_num_rows == 0) { return empty_like(in); }
 
   auto out_num_rows = in_num_rows * count;
-  auto counting_it  = thrust::make_counting_iterator<size_type>(0);
-  auto tiled_it     = thrust::make_transform_iterator(counting_it, tile_functor{in_num_rows});
 
-  return detail::gather(in, tiled_it, tiled_it + out_num_rows, false, mr, stream);
+  // Fixed-width columns are tiled directly, the other columns are gathered together
+  std::vector<std::unique_ptr<column>> columns(in.num_columns());
+  std::vector<column_view> gathered_views;
+  std::vector<size_type> gathered_indices;
+  for (size_type i = 0; i < in.num_columns(); ++i) {
+    auto const& col = in.column(i);
+    if (is_fixed_width(col.type())) {
+      columns[i] =
+        type_dispatcher(col.type(), tile_fixed_width_functor{}, col, out_num_rows, stream, mr);
+    } else {
+      gathered_views.push_back(col);
+      gathered_indices.push_back(i);
+    }
+  }
+
+  if (not gathered_views.empty()) {
+    auto counting_it = thrust::make_counting_iterator<size_type>(0);
+    auto tiled_it    = thrust::make_transform_iterator(counting_it, tile_functor{in_num_rows});
+    auto gathered    = detail::gather(
+      table_view{gathered_views}, tiled_it, tiled_it + out_num_rows, false, mr, stream);
+    auto gathered_columns = gathered->release();
+    for (size_t i = 0; i < gathered_indices.size(); ++i) {
+      columns[gathered_indices[i]] = std::move(gathered_columns[i]);
+    }
+  }
+
+  return std::make_unique<table>(std::move(columns));
 }
 }  // namespace detail
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief The type of the 128-bit stores of `wide_copy_kernel` for elements of type `T`,
+ * or `T` itself for elements of 16 bytes and more.
+ */
+template <typename T>
+using wide_store_t = std::conditional_t<(sizeof(T) < sizeof(uint4)), uint4, T>;
+
+/**
+ * @brief Writes the `size` values produced by `source` into `output`, storing
+ * `sizeof(wide_store_t<T>) / sizeof(T)` consecutive values at once.
+ *
+ * `Source` is a copyable cursor: `seek(idx)` positions it on output row `idx` and `next()`
+ * returns the value of the current row and advances to the following one. Each thread seeks
+ * once per wide store, so the cursor only divides once for a group of consecutive rows.
+ *
+ * @param output The output data, aligned to `alignof(wide_store_t<T>)`
+ * @param size The number of values to write
+ * @param source The cursor producing the values
+ */
+template <typename T, typename Source>
+__global__ void wide_copy_kernel(T* __restrict__ output, size_type size, Source source)
+{
+  using wide_type                      = wide_store_t<T>;
+  constexpr size_type values_per_store = sizeof(wide_type) / sizeof(T);
+
+  auto const num_stores = size / values_per_store;
+  auto const stride     = static_cast<size_type>(blockDim.x * gridDim.x);
+  auto const tid        = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+  for (size_type store = tid; store < num_stores; store += stride) {
+    auto cursor = source;
+    cursor.seek(store * values_per_store);
+    wide_type buffer;
+    auto values = reinterpret_cast<T*>(&buffer);
+#pragma unroll
+    for (size_type i = 0; i < values_per_store; ++i) { values[i] = cursor.next(); }
+    reinterpret_cast<wide_type*>(output)[store] = buffer;
+  }
+
+  // The remaining values do not fill a wide store
+  for (size_type idx = num_stores * values_per_store + tid; idx < size; idx += stride) {
+    auto cursor = source;
+    cursor.seek(idx);
+    output[idx] = cursor.next();
+  }
+}
+
+/**
+ * @brief Launches `wide_copy_kernel` writing `size` values of `source` into `output`.
+ */
+template <typename T, typename Source>
+void launch_wide_copy(T* output, size_type size, Source const& source, cudaStream_t stream)
+{
+  if (size == 0) { return; }
+  constexpr size_type block_size       = 256;
+  constexpr size_type values_per_store = sizeof(wide_store_t<T>) / sizeof(T);
+  grid_1d grid{std::max(size / values_per_store, size_type{1}), block_size};
+  wide_copy_kernel<<<grid.num_blocks, block_size, 0, stream>>>(output, size, source);
+  CHECK_CUDA(stream);
+}
+
+}  // namespace detail
+}  // namespace cudf
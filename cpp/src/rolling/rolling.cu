@@ -25,6 +25,8 @@
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/rolling.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
@@ -42,9 +44,20 @@
 #include <types.hpp.jit>
 
 #include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/transform_scan.h>
 #include <rmm/device_scalar.hpp>
+#include <rmm/thrust_rmm_allocator.h>
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <set>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -275,6 +288,501 @@ __launch_bounds__(block_size) __global__
   if (threadIdx.x == 0) { atomicAdd(output_valid_count, block_valid_count); }
 }
 
+// Average number of rows per window from which the aggregations supported by
+// `large_window_rolling` no longer loop over every window
+constexpr size_type large_window_threshold = 64;
+
+/**
+ * @brief Computes the [start, end) row range of each window, clamped as in `gpu_rolling`.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+struct window_bounds {
+  size_type num_rows;
+  PrecedingWindowIterator preceding_window_begin;
+  FollowingWindowIterator following_window_begin;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type i) const
+  {
+    size_type start = min(num_rows, max(0, i - preceding_window_begin[i] + 1));
+    size_type end   = min(num_rows, max(0, i + following_window_begin[i] + 1));
+    return {min(start, end), max(start, end)};
+  }
+};
+
+/**
+ * @brief Counts the valid rows of a window from the prefix counts of the valid rows.
+ */
+struct window_valid_count {
+  size_type const* prefix_counts;  // nullptr when every row is counted
+
+  __device__ size_type operator()(size_type start, size_type end) const
+  {
+    return prefix_counts == nullptr ? end - start : prefix_counts[end] - prefix_counts[start];
+  }
+};
+
+/**
+ * @brief Returns the `num_rows + 1` prefix counts of the valid rows of a nullable column, or an
+ * empty vector if the column is not nullable.
+ */
+rmm::device_vector<size_type> valid_prefix_counts(column_device_view const& input,
+                                                  cudaStream_t stream)
+{
+  if (not input.nullable()) return {};
+  rmm::device_vector<size_type> counts(input.size() + 1, 0);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.size()),
+    counts.begin() + 1,
+    [input] __device__(size_type i) { return static_cast<size_type>(input.is_valid(i)); },
+    thrust::plus<size_type>());
+  return counts;
+}
+
+/**
+ * @brief Sets the null mask of a rolling window result, a row being valid if its window counts
+ * at least `min_periods` rows.
+ */
+template <typename Bounds>
+void set_window_null_mask(column& output,
+                          Bounds bounds,
+                          window_valid_count count,
+                          size_type min_periods,
+                          rmm::mr::device_memory_resource* mr,
+                          cudaStream_t stream)
+{
+  auto mask = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(output.size()),
+    [bounds, count, min_periods] __device__(size_type i) {
+      auto const window = bounds(i);
+      return count(window.first, window.second) >= min_periods;
+    },
+    stream,
+    mr);
+  output.set_null_mask(std::move(mask.first), mask.second);
+}
+
+/**
+ * @brief Returns true if `large_window_rolling` implements the aggregation `op` of `T` values.
+ *
+ * Floating-point sums are excluded: the difference of two prefix sums does not round like the
+ * sum of the window, while the integral sums are exact modulo 2^64 like the int64 accumulation
+ * of `gpu_rolling`. Means of 64-bit integers are excluded as their sums may overflow.
+ */
+template <typename T, aggregation::Kind op>
+static constexpr bool is_large_window_supported()
+{
+  return (op == aggregation::COUNT_VALID) or (op == aggregation::COUNT_ALL) or
+         ((op == aggregation::MIN or op == aggregation::MAX) and cudf::is_fixed_width<T>()) or
+         (op == aggregation::SUM and std::is_integral<T>::value) or
+         (op == aggregation::MEAN and std::is_integral<T>::value and
+          sizeof(T) <= sizeof(int32_t));
+}
+
+/**
+ * @brief Returns true if the windows average at least `large_window_threshold` rows.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+bool is_large_window(size_type num_rows,
+                     PrecedingWindowIterator preceding_window_begin,
+                     FollowingWindowIterator following_window_begin,
+                     cudaStream_t stream)
+{
+  auto const bounds = window_bounds<PrecedingWindowIterator, FollowingWindowIterator>{
+    num_rows, preceding_window_begin, following_window_begin};
+  auto const total_size = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [bounds] __device__(size_type i) {
+      auto const window = bounds(i);
+      return static_cast<int64_t>(window.second - window.first);
+    },
+    int64_t{0},
+    thrust::plus<int64_t>());
+  return total_size >= static_cast<int64_t>(large_window_threshold) * num_rows;
+}
+
+/**
+ * @brief Computes COUNT_VALID and COUNT_ALL from the prefix counts of the valid rows.
+ */
+template <typename T,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<is_large_window_supported<T, op>() and
+                   (op == aggregation::COUNT_VALID or op == aggregation::COUNT_ALL),
+                 std::unique_ptr<column>>
+large_window_rolling(column_view const& input,
+                     PrecedingWindowIterator preceding_window_begin,
+                     FollowingWindowIterator following_window_begin,
+                     size_type min_periods,
+                     rmm::mr::device_memory_resource* mr,
+                     cudaStream_t stream)
+{
+  auto const bounds  = window_bounds<PrecedingWindowIterator, FollowingWindowIterator>{
+    input.size(), preceding_window_begin, following_window_begin};
+  auto const d_input = column_device_view::create(input, stream);
+  auto const counts  = op == aggregation::COUNT_VALID ? valid_prefix_counts(*d_input, stream)
+                                                      : rmm::device_vector<size_type>{};
+  auto const count   = window_valid_count{counts.empty() ? nullptr : counts.data().get()};
+
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<size_type>()}, input.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    output->mutable_view().begin<size_type>(),
+                    [bounds, count] __device__(size_type i) {
+                      auto const window = bounds(i);
+                      return count(window.first, window.second);
+                    });
+  set_window_null_mask(*output, bounds, count, min_periods, mr, stream);
+  return output;
+}
+
+/**
+ * @brief Computes SUM and MEAN of integral values from their prefix sums.
+ */
+template <typename T,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<is_large_window_supported<T, op>() and
+                   (op == aggregation::SUM or op == aggregation::MEAN),
+                 std::unique_ptr<column>>
+large_window_rolling(column_view const& input,
+                     PrecedingWindowIterator preceding_window_begin,
+                     FollowingWindowIterator following_window_begin,
+                     size_type min_periods,
+                     rmm::mr::device_memory_resource* mr,
+                     cudaStream_t stream)
+{
+  using OutputType   = target_type_t<T, op>;
+  auto const bounds  = window_bounds<PrecedingWindowIterator, FollowingWindowIterator>{
+    input.size(), preceding_window_begin, following_window_begin};
+  auto const d_input = column_device_view::create(input, stream);
+  auto const counts  = valid_prefix_counts(*d_input, stream);
+  auto const count   = window_valid_count{counts.empty() ? nullptr : counts.data().get()};
+
+  // Unsigned prefix sums wrap around, their differences being the exact window sums
+  rmm::device_vector<uint64_t> sums(input.size() + 1, 0);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.size()),
+    sums.begin() + 1,
+    [input = *d_input] __device__(size_type i) {
+      return input.is_valid(i) ? static_cast<uint64_t>(static_cast<int64_t>(input.element<T>(i)))
+                               : uint64_t{0};
+    },
+    thrust::plus<uint64_t>());
+
+  auto output = make_fixed_width_column(
+    target_type(input.type(), op), input.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    output->mutable_view().begin<OutputType>(),
+                    [bounds, count, d_sums = sums.data().get()] __device__(size_type i) {
+                      auto const window = bounds(i);
+                      auto const sum    = static_cast<OutputType>(
+                        static_cast<int64_t>(d_sums[window.second] - d_sums[window.first]));
+                      return op == aggregation::MEAN ? sum / count(window.first, window.second)
+                                                     : sum;
+                    });
+  set_window_null_mask(*output, bounds, count, min_periods, mr, stream);
+  return output;
+}
+
+/**
+ * @brief Computes MIN and MAX from a sparse table of the aggregates of power-of-two row ranges.
+ *
+ * Level `k` of the table holds the aggregate of the `2^k` rows starting at each row, so that a
+ * window of `[2^k, 2^(k+1))` rows is the union of two overlapping entries of level `k`. Windows
+ * are answered level by level while the next level is built from the current one, which costs
+ * O(N log W) for windows of up to W rows while only keeping two levels in memory.
+ */
+template <typename T,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<is_large_window_supported<T, op>() and
+                   (op == aggregation::MIN or op == aggregation::MAX),
+                 std::unique_ptr<column>>
+large_window_rolling(column_view const& input,
+                     PrecedingWindowIterator preceding_window_begin,
+                     FollowingWindowIterator following_window_begin,
+                     size_type min_periods,
+                     rmm::mr::device_memory_resource* mr,
+                     cudaStream_t stream)
+{
+  auto const num_rows = input.size();
+  auto const bounds   = window_bounds<PrecedingWindowIterator, FollowingWindowIterator>{
+    num_rows, preceding_window_begin, following_window_begin};
+  auto const d_input  = column_device_view::create(input, stream);
+  auto const counts   = valid_prefix_counts(*d_input, stream);
+  auto const count    = window_valid_count{counts.empty() ? nullptr : counts.data().get()};
+
+  auto output =
+    make_fixed_width_column(input.type(), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto d_output = output->mutable_view().data<T>();
+  thrust::fill_n(rmm::exec_policy(stream)->on(stream),
+                 d_output,
+                 num_rows,
+                 agg_op::template identity<T>());
+
+  // Null rows hold the identity so that they do not change the aggregates
+  rmm::device_vector<T> level(num_rows);
+  rmm::device_vector<T> next_level(num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    level.begin(),
+                    [input = *d_input] __device__(size_type i) {
+                      return input.is_valid(i) ? input.element<T>(i)
+                                               : agg_op::template identity<T>();
+                    });
+
+  auto const max_window_size = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [bounds] __device__(size_type i) {
+      auto const window = bounds(i);
+      return window.second - window.first;
+    },
+    size_type{0},
+    thrust::maximum<size_type>());
+
+  for (size_type width = 1; width <= max_window_size; width *= 2) {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_rows,
+                       [bounds, width, d_level = level.data().get(), d_output] __device__(
+                         size_type i) {
+                         auto const window = bounds(i);
+                         auto const size   = window.second - window.first;
+                         if (size >= width and size - width < width) {
+                           d_output[i] =
+                             agg_op{}(d_level[window.first], d_level[window.second - width]);
+                         }
+                       });
+    if (width > max_window_size / 2) break;
+
+    // Entries running past the last row only cover the rows up to it
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      next_level.begin(),
+                      [num_rows, width, d_level = level.data().get()] __device__(size_type i) {
+                        return i + width < num_rows ? agg_op{}(d_level[i], d_level[i + width])
+                                                    : d_level[i];
+                      });
+    level.swap(next_level);
+  }
+
+  set_window_null_mask(*output, bounds, count, min_periods, mr, stream);
+  return output;
+}
+
+template <typename T,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<!is_large_window_supported<T, op>(), std::unique_ptr<column>>
+large_window_rolling(column_view const& input,
+                     PrecedingWindowIterator preceding_window_begin,
+                     FollowingWindowIterator following_window_begin,
+                     size_type min_periods,
+                     rmm::mr::device_memory_resource* mr,
+                     cudaStream_t stream)
+{
+  CUDF_FAIL("Aggregation operator and/or input type combination is invalid");
+}
+
+/**
+ * @brief Returns true if `op` selects a row of each window, which is gathered from the input.
+ */
+constexpr bool is_rolling_gather_aggregation(aggregation::Kind op)
+{
+  return (op == aggregation::NTH_ELEMENT) or (op == aggregation::LEAD) or
+         (op == aggregation::LAG);
+}
+
+/**
+ * @brief Computes the VARIANCE or STD of each window with Welford's online algorithm.
+ *
+ * A row is null if its window has fewer than `min_periods` valid rows, or no more valid rows
+ * than the delta degrees of freedom of the aggregation.
+ */
+template <typename T,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<cudf::detail::is_rolling_supported<T, void, op>() and
+                   (op == aggregation::VARIANCE or op == aggregation::STD),
+                 std::unique_ptr<column>>
+rolling_variance(column_view const& input,
+                 PrecedingWindowIterator preceding_window_begin,
+                 FollowingWindowIterator following_window_begin,
+                 size_type min_periods,
+                 std::unique_ptr<aggregation> const& agg,
+                 rmm::mr::device_memory_resource* mr,
+                 cudaStream_t stream)
+{
+  if (input.is_empty()) return make_empty_column(target_type(input.type(), op));
+
+  auto const ddof    = static_cast<std_var_aggregation const*>(agg.get())->_ddof;
+  auto const bounds  = window_bounds<PrecedingWindowIterator, FollowingWindowIterator>{
+    input.size(), preceding_window_begin, following_window_begin};
+  auto const d_input = column_device_view::create(input, stream);
+  auto const counts  = valid_prefix_counts(*d_input, stream);
+  auto const count   = window_valid_count{counts.empty() ? nullptr : counts.data().get()};
+
+  auto output = make_fixed_width_column(
+    target_type(input.type(), op), input.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    output->mutable_view().begin<double>(),
+                    [bounds, input = *d_input, ddof] __device__(size_type i) {
+                      auto const window = bounds(i);
+                      size_type count   = 0;
+                      double mean       = 0;
+                      double m2         = 0;
+                      for (size_type j = window.first; j < window.second; j++) {
+                        if (input.is_valid(j)) {
+                          auto const x     = static_cast<double>(input.element<T>(j));
+                          auto const delta = x - mean;
+                          count++;
+                          mean += delta / count;
+                          m2 += delta * (x - mean);
+                        }
+                      }
+                      auto const variance = m2 / (count - ddof);
+                      return op == aggregation::STD ? sqrt(variance) : variance;
+                    });
+  set_window_null_mask(*output, bounds, count, std::max(min_periods, ddof + 1), mr, stream);
+  return output;
+}
+
+template <typename T,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<!cudf::detail::is_rolling_supported<T, void, op>(), std::unique_ptr<column>>
+rolling_variance(column_view const& input,
+                 PrecedingWindowIterator preceding_window_begin,
+                 FollowingWindowIterator following_window_begin,
+                 size_type min_periods,
+                 std::unique_ptr<aggregation> const& agg,
+                 rmm::mr::device_memory_resource* mr,
+                 cudaStream_t stream)
+{
+  CUDF_FAIL("Aggregation operator and/or input type combination is invalid");
+}
+
+/**
+ * @brief Computes NTH_ELEMENT, LEAD or LAG by gathering the selected row of each window.
+ *
+ * A row is null if its window has fewer than `min_periods` valid rows, if the selected row is
+ * outside of the window, or if the selected row is null.
+ */
+template <typename T,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<cudf::detail::is_rolling_supported<T, void, op>() and
+                   is_rolling_gather_aggregation(op),
+                 std::unique_ptr<column>>
+rolling_gather(column_view const& input,
+               PrecedingWindowIterator preceding_window_begin,
+               FollowingWindowIterator following_window_begin,
+               size_type min_periods,
+               std::unique_ptr<aggregation> const& agg,
+               rmm::mr::device_memory_resource* mr,
+               cudaStream_t stream)
+{
+  if (input.is_empty()) return empty_like(input);
+
+  auto const nth_agg = static_cast<nth_element_aggregation const*>(agg.get());
+  auto const n = op == aggregation::NTH_ELEMENT
+                   ? nth_agg->_n
+                   : static_cast<lead_lag_aggregation const*>(agg.get())->_row_offset;
+  auto const exclude_nulls =
+    op == aggregation::NTH_ELEMENT and nth_agg->_null_handling == null_policy::EXCLUDE;
+
+  auto const bounds  = window_bounds<PrecedingWindowIterator, FollowingWindowIterator>{
+    input.size(), preceding_window_begin, following_window_begin};
+  auto const d_input = column_device_view::create(input, stream);
+  auto const counts  = valid_prefix_counts(*d_input, stream);
+  auto const count   = window_valid_count{counts.empty() ? nullptr : counts.data().get()};
+  // Valid rows are only indexed through their prefix counts when nulls are excluded
+  auto const d_nth_counts = exclude_nulls ? count.prefix_counts : nullptr;
+
+  // Rows without a selected row are out of bounds, which nullifies them in the gather
+  rmm::device_vector<size_type> gather_map(input.size());
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.size()),
+    gather_map.begin(),
+    [bounds, count, min_periods, n, d_nth_counts] __device__(size_type i) -> size_type {
+      auto const window = bounds(i);
+      if (count(window.first, window.second) < min_periods) return -1;
+      if (op != aggregation::NTH_ELEMENT) {
+        auto const row = op == aggregation::LEAD ? static_cast<int64_t>(i) + n
+                                                 : static_cast<int64_t>(i) - n;
+        return row >= window.first and row < window.second ? static_cast<size_type>(row) : -1;
+      }
+      auto const size = d_nth_counts == nullptr ? window.second - window.first
+                                                : count(window.first, window.second);
+      auto const k    = n >= 0 ? n : size + n;
+      if (k < 0 or k >= size) return -1;
+      if (d_nth_counts == nullptr) return window.first + k;
+      // The k-th valid row is the first one after which k + 1 rows of the window are valid
+      auto const row = thrust::lower_bound(thrust::seq,
+                                           d_nth_counts + window.first + 1,
+                                           d_nth_counts + window.second + 1,
+                                           d_nth_counts[window.first] + k + 1);
+      return static_cast<size_type>(row - d_nth_counts - 1);
+    });
+
+  auto const map =
+    column_view(data_type{type_to_id<size_type>()}, input.size(), gather_map.data().get());
+
+  auto output_table = detail::gather(table_view{{input}},
+                                     map,
+                                     detail::out_of_bounds_policy::IGNORE,
+                                     detail::negative_index_policy::NOT_ALLOWED,
+                                     mr,
+                                     stream);
+  return std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
+}
+
+template <typename T,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<!cudf::detail::is_rolling_supported<T, void, op>(), std::unique_ptr<column>>
+rolling_gather(column_view const& input,
+               PrecedingWindowIterator preceding_window_begin,
+               FollowingWindowIterator following_window_begin,
+               size_type min_periods,
+               std::unique_ptr<aggregation> const& agg,
+               rmm::mr::device_memory_resource* mr,
+               cudaStream_t stream)
+{
+  CUDF_FAIL("Aggregation operator and/or input type combination is invalid");
+}
+
 template <typename InputType>
 struct rolling_window_launcher {
   template <typename T,
@@ -350,6 +858,12 @@ struct rolling_window_launcher {
   {
     if (input.is_empty()) return empty_like(input);
 
+    if (is_large_window_supported<T, op>() and
+        is_large_window(input.size(), preceding_window_begin, following_window_begin, stream)) {
+      return large_window_rolling<T, agg_op, op>(
+        input, preceding_window_begin, following_window_begin, min_periods, mr, stream);
+    }
+
     auto output = make_fixed_width_column(
       target_type(input.type(), op), input.size(), mask_state::UNINITIALIZED, stream, mr);
 
@@ -460,7 +974,10 @@ struct rolling_window_launcher {
   template <aggregation::Kind op,
             typename PrecedingWindowIterator,
             typename FollowingWindowIterator>
-  std::enable_if_t<!(op == aggregation::MEAN), std::unique_ptr<column>> operator()(
+  std::enable_if_t<!(op == aggregation::MEAN or op == aggregation::VARIANCE or
+                     op == aggregation::STD or is_rolling_gather_aggregation(op)),
+                   std::unique_ptr<column>>
+  operator()(
     column_view const& input,
     PrecedingWindowIterator preceding_window_begin,
     FollowingWindowIterator following_window_begin,
@@ -493,6 +1010,39 @@ struct rolling_window_launcher {
     return launch<InputType, cudf::DeviceSum, op, PrecedingWindowIterator, FollowingWindowIterator>(
       input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream);
   }
+
+  template <aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<(op == aggregation::VARIANCE or op == aggregation::STD),
+                   std::unique_ptr<column>>
+  operator()(column_view const& input,
+             PrecedingWindowIterator preceding_window_begin,
+             FollowingWindowIterator following_window_begin,
+             size_type min_periods,
+             std::unique_ptr<aggregation> const& agg,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream)
+  {
+    return rolling_variance<InputType, op>(
+      input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream);
+  }
+
+  template <aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<is_rolling_gather_aggregation(op), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    PrecedingWindowIterator preceding_window_begin,
+    FollowingWindowIterator following_window_begin,
+    size_type min_periods,
+    std::unique_ptr<aggregation> const& agg,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    return rolling_gather<InputType, op>(
+      input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream);
+  }
 };
 
 struct dispatch_rolling {
@@ -650,6 +1200,239 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                stream);
 }
 
+
+namespace {
+/**
+ * @brief Returns true if `gpu_rolling_multi` computes the aggregation `k`.
+ */
+bool is_fused_rolling_aggregation(aggregation::Kind k)
+{
+  return (k == aggregation::SUM) or (k == aggregation::MIN) or (k == aggregation::MAX) or
+         (k == aggregation::COUNT_VALID) or (k == aggregation::COUNT_ALL) or
+         (k == aggregation::MEAN);
+}
+
+/**
+ * @brief Outputs of `gpu_rolling_multi`; the aggregations that are not requested are nullptr.
+ */
+template <typename T>
+struct rolling_multi_outputs {
+  target_type_t<T, aggregation::SUM>* sum;
+  T* min;
+  T* max;
+  size_type* count_valid;
+  size_type* count_all;
+  double* mean;
+  bitmask_type* valid_mask;      ///< Rows with at least `min_periods` valid elements
+  bitmask_type* all_valid_mask;  ///< Rows with at least `min_periods` elements
+};
+
+/**
+ * @brief Computes the SUM, MIN, MAX, COUNT_VALID, COUNT_ALL and MEAN of each window in a single
+ * pass over its elements.
+ *
+ * @tparam T Datatype of `input`
+ * @tparam block_size CUDA block size for the kernel
+ * @param input Input column device view
+ * @param outputs Output buffers of the requested aggregations and of the validity masks
+ * @param preceding_window_begin[in] Rolling window size iterator in the backward direction
+ * @param following_window_begin[in] Rolling window size iterator in the forward direction
+ * @param min_periods[in] Minimum number of observations in window required to have a value
+ */
+template <typename T,
+          int block_size,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+__launch_bounds__(block_size) __global__
+  void gpu_rolling_multi(column_device_view input,
+                         rolling_multi_outputs<T> outputs,
+                         PrecedingWindowIterator preceding_window_begin,
+                         FollowingWindowIterator following_window_begin,
+                         size_type min_periods)
+{
+  using SumType = target_type_t<T, aggregation::SUM>;
+
+  size_type i      = blockIdx.x * block_size + threadIdx.x;
+  size_type stride = block_size * gridDim.x;
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  while (i < input.size()) {
+    size_type preceding_window = preceding_window_begin[i];
+    size_type following_window = following_window_begin[i];
+
+    // compute bounds
+    size_type start       = min(input.size(), max(0, i - preceding_window + 1));
+    size_type end         = min(input.size(), max(0, i + following_window + 1));
+    size_type start_index = min(start, end);
+    size_type end_index   = max(start, end);
+
+    // aggregate
+    SumType sum     = DeviceSum::identity<SumType>();
+    T min_value     = DeviceMin::identity<T>();
+    T max_value     = DeviceMax::identity<T>();
+    double mean_sum = DeviceSum::identity<double>();
+    size_type count = 0;
+    for (size_type j = start_index; j < end_index; j++) {
+      if (input.is_valid(j)) {
+        T element = input.element<T>(j);
+        sum       = DeviceSum{}(static_cast<SumType>(element), sum);
+        min_value = DeviceMin{}(element, min_value);
+        max_value = DeviceMax{}(element, max_value);
+        mean_sum  = DeviceSum{}(static_cast<double>(element), mean_sum);
+        count++;
+      }
+    }
+
+    if (outputs.sum != nullptr) { outputs.sum[i] = sum; }
+    if (outputs.min != nullptr) { outputs.min[i] = min_value; }
+    if (outputs.max != nullptr) { outputs.max[i] = max_value; }
+    if (outputs.count_valid != nullptr) { outputs.count_valid[i] = count; }
+    if (outputs.count_all != nullptr) { outputs.count_all[i] = end_index - start_index; }
+    if (outputs.mean != nullptr) {
+      cudf::detail::rolling_store_output_functor<double, true>{}(
+        outputs.mean[i], mean_sum, count);
+    }
+
+    // set the masks, only one thread writes each mask word
+    bitmask_type valid_mask{__ballot_sync(active_threads, count >= min_periods)};
+    bitmask_type all_valid_mask{
+      __ballot_sync(active_threads, end_index - start_index >= min_periods)};
+    if (0 == threadIdx.x % cudf::detail::warp_size) {
+      outputs.valid_mask[cudf::word_index(i)]     = valid_mask;
+      outputs.all_valid_mask[cudf::word_index(i)] = all_valid_mask;
+    }
+
+    // process next element
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < input.size());
+  }
+}
+
+struct dispatch_rolling_multi {
+  template <typename T, typename PrecedingWindowIterator, typename FollowingWindowIterator>
+  std::enable_if_t<cudf::is_numeric<T>(), std::map<aggregation::Kind, std::unique_ptr<column>>>
+  operator()(column_view const& input,
+             PrecedingWindowIterator preceding_window_begin,
+             FollowingWindowIterator following_window_begin,
+             size_type min_periods,
+             std::set<aggregation::Kind> const& kinds,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream)
+  {
+    std::map<aggregation::Kind, std::unique_ptr<column>> results;
+    for (auto kind : kinds) {
+      results[kind] = make_fixed_width_column(
+        target_type(input.type(), kind), input.size(), mask_state::UNALLOCATED, stream, mr);
+    }
+    auto data = [&results](aggregation::Kind kind, auto* type_tag) {
+      using OutputType = std::remove_pointer_t<decltype(type_tag)>;
+      auto result      = results.find(kind);
+      return result == results.end() ? nullptr
+                                     : result->second->mutable_view().template data<OutputType>();
+    };
+
+    auto valid_mask     = create_null_mask(input.size(), mask_state::UNINITIALIZED, stream);
+    auto all_valid_mask = create_null_mask(input.size(), mask_state::UNINITIALIZED, stream);
+    rolling_multi_outputs<T> outputs{
+      data(aggregation::SUM, static_cast<target_type_t<T, aggregation::SUM>*>(nullptr)),
+      data(aggregation::MIN, static_cast<T*>(nullptr)),
+      data(aggregation::MAX, static_cast<T*>(nullptr)),
+      data(aggregation::COUNT_VALID, static_cast<size_type*>(nullptr)),
+      data(aggregation::COUNT_ALL, static_cast<size_type*>(nullptr)),
+      data(aggregation::MEAN, static_cast<double*>(nullptr)),
+      static_cast<bitmask_type*>(valid_mask.data()),
+      static_cast<bitmask_type*>(all_valid_mask.data())};
+
+    constexpr cudf::size_type block_size = 256;
+    cudf::detail::grid_1d grid(input.size(), block_size);
+    auto input_device_view = column_device_view::create(input, stream);
+    gpu_rolling_multi<T, block_size><<<grid.num_blocks, block_size, 0, stream>>>(
+      *input_device_view, outputs, preceding_window_begin, following_window_begin, min_periods);
+
+    // COUNT_ALL is the only aggregation that counts the null elements
+    auto const null_count     = count_unset_bits(outputs.valid_mask, 0, input.size());
+    auto const all_null_count = count_unset_bits(outputs.all_valid_mask, 0, input.size());
+    for (auto& result : results) {
+      auto const& mask = result.first == aggregation::COUNT_ALL ? all_valid_mask : valid_mask;
+      result.second->set_null_mask(rmm::device_buffer{mask.data(), mask.size(), stream, mr},
+                                   result.first == aggregation::COUNT_ALL ? all_null_count
+                                                                          : null_count);
+    }
+    return results;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!cudf::is_numeric<T>(), std::map<aggregation::Kind, std::unique_ptr<column>>>
+  operator()(Args&&... args)
+  {
+    CUDF_FAIL("Multiple rolling aggregations are only fused for numeric columns");
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief Applies several rolling window aggregations to the values in a column.
+ *
+ * The aggregations are computed by a single `gpu_rolling_multi` kernel if they all are fused
+ * aggregations of a numeric column, unless the windows are large enough for
+ * `large_window_rolling`. They are computed one by one otherwise.
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  min_periods = std::max(min_periods, 0);
+
+  auto const is_fused = is_numeric(input.type()) and not input.is_empty() and aggs.size() > 1 and
+                        std::all_of(aggs.begin(), aggs.end(), [](auto const& agg) {
+                          return is_fused_rolling_aggregation(agg->kind);
+                        }) and
+                        not is_large_window(
+                          input.size(), preceding_window_begin, following_window_begin, stream);
+
+  std::vector<std::unique_ptr<column>> results;
+  if (not is_fused) {
+    for (auto const& agg : aggs) {
+      results.push_back(rolling_window(
+        input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream));
+    }
+    return results;
+  }
+
+  std::set<aggregation::Kind> kinds;
+  std::map<aggregation::Kind, size_t> num_uses;
+  for (auto const& agg : aggs) {
+    kinds.insert(agg->kind);
+    num_uses[agg->kind]++;
+  }
+  auto fused_results = type_dispatcher(input.type(),
+                                       dispatch_rolling_multi{},
+                                       input,
+                                       preceding_window_begin,
+                                       following_window_begin,
+                                       min_periods,
+                                       kinds,
+                                       mr,
+                                       stream);
+
+  // Aggregations that are requested several times share the same result
+  for (auto const& agg : aggs) {
+    auto& result = fused_results[agg->kind];
+    results.push_back(--num_uses[agg->kind] == 0 ? std::move(result)
+                                                 : std::make_unique<column>(*result, stream, mr));
+  }
+  return results;
+}
+
 }  // namespace detail
 
 // Applies a fixed-size rolling window function to the values in a column.
@@ -722,6 +1505,77 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
+// Applies several fixed-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+
+  auto const is_udf = [](auto const& agg) {
+    return agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX;
+  };
+  if (input.size() == 0 || std::any_of(aggs.begin(), aggs.end(), is_udf)) {
+    std::vector<std::unique_ptr<column>> results;
+    for (auto const& agg : aggs) {
+      results.push_back(
+        rolling_window(input, preceding_window, following_window, min_periods, agg, mr));
+    }
+    return results;
+  }
+
+  return cudf::detail::rolling_window(input,
+                                      thrust::make_constant_iterator(preceding_window),
+                                      thrust::make_constant_iterator(following_window),
+                                      min_periods,
+                                      aggs,
+                                      mr,
+                                      0);
+}
+
+// Applies several variable-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const is_udf = [](auto const& agg) {
+    return agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX;
+  };
+  if (preceding_window.size() == 0 || following_window.size() == 0 || input.size() == 0 ||
+      std::any_of(aggs.begin(), aggs.end(), is_udf)) {
+    std::vector<std::unique_ptr<column>> results;
+    for (auto const& agg : aggs) {
+      results.push_back(
+        rolling_window(input, preceding_window, following_window, min_periods, agg, mr));
+    }
+    return results;
+  }
+
+  CUDF_EXPECTS(preceding_window.type().id() == INT32 && following_window.type().id() == INT32,
+               "preceding_window/following_window must have INT32 type");
+
+  CUDF_EXPECTS(preceding_window.size() == input.size() && following_window.size() == input.size(),
+               "preceding_window/following_window size must match input size");
+
+  return cudf::detail::rolling_window(input,
+                                      preceding_window.begin<size_type>(),
+                                      following_window.begin<size_type>(),
+                                      min_periods,
+                                      aggs,
+                                      mr,
+                                      0);
+}
+
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
                                                size_type preceding_window,
@@ -843,75 +1697,71 @@ size_t multiplication_factor(cudf::data_type const& data_type)
   }
 }
 
-// Time-range window computation, with
-//   1. no grouping keys specified
-//   2. timetamps in ASCENDING order.
-// Treat as one single group.
-template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_ASC(column_view const& input,
-                                              column_view const& timestamp_column,
-                                              TimestampImpl_t preceding_window,
-                                              TimestampImpl_t following_window,
-                                              size_type min_periods,
-                                              std::unique_ptr<aggregation> const& aggr,
-                                              rmm::mr::device_memory_resource* mr)
-{
-  auto preceding_calculator = [d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               preceding_window] __device__(size_type idx) {
-    auto group_start                = 0;
-    auto lowest_timestamp_in_window = d_timestamps[idx] - preceding_window;
-
-    return ((d_timestamps + idx) - thrust::lower_bound(thrust::seq,
-                                                       d_timestamps + group_start,
-                                                       d_timestamps + idx,
-                                                       lowest_timestamp_in_window)) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
+/// Row range [start, end) of the group of each row; all rows are one group without offsets.
+struct row_group_bounds {
+  size_type num_rows;
+  size_type const* d_group_offsets;
+  size_type const* d_group_labels;
 
-  auto following_calculator = [num_rows     = input.size(),
-                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               following_window] __device__(size_type idx) {
-    auto group_end                   = num_rows;
-    auto highest_timestamp_in_window = d_timestamps[idx] + following_window;
+  __device__ size_type start(size_type idx) const
+  {
+    return d_group_offsets == nullptr ? 0 : d_group_offsets[d_group_labels[idx]];
+  }
 
-    return (thrust::upper_bound(thrust::seq,
-                                d_timestamps + idx,
-                                d_timestamps + group_end,
-                                highest_timestamp_in_window) -
-            (d_timestamps + idx)) -
-           1;
-  };
+  // Cannot fall off the end, since offsets is capped with `num_rows`.
+  __device__ size_type end(size_type idx) const
+  {
+    return d_group_offsets == nullptr ? num_rows : d_group_offsets[d_group_labels[idx] + 1];
+  }
+};
 
-  return cudf::detail::rolling_window(
-    input,
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    preceding_calculator),
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    following_calculator),
-    min_periods,
-    aggr,
-    mr);
+/// Computes the preceding and following window sizes of each row with the given calculators.
+template <typename PrecedingCalculator, typename FollowingCalculator>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_window_size_columns(
+  size_type num_rows,
+  PrecedingCalculator preceding_calculator,
+  FollowingCalculator following_calculator,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto preceding = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto following = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    preceding->mutable_view().begin<size_type>(),
+                    preceding_calculator);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    following->mutable_view().begin<size_type>(),
+                    following_calculator);
+  return {std::move(preceding), std::move(following)};
 }
 
-// Time-range window computation, for timestamps in ASCENDING order.
+// Time-range window sizes computation, for timestamps in ASCENDING order.
+// Without grouping keys (empty `group_offsets`), all rows are treated as one single group.
 template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_ASC(
-  column_view const& input,
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> time_range_window_sizes_ASC(
   column_view const& timestamp_column,
   rmm::device_vector<cudf::size_type> const& group_offsets,
   rmm::device_vector<cudf::size_type> const& group_labels,
   TimestampImpl_t preceding_window,
   TimestampImpl_t following_window,
-  size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
-  auto preceding_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
+  auto const group_bounds = row_group_bounds{
+    timestamp_column.size(),
+    group_offsets.empty() ? nullptr : group_offsets.data().get(),
+    group_offsets.empty() ? nullptr : group_labels.data().get()};
+
+  auto preceding_calculator = [group_bounds,
+                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
                                preceding_window] __device__(size_type idx) {
-    auto group_label                = d_group_labels[idx];
-    auto group_start                = d_group_offsets[group_label];
+    auto group_start                = group_bounds.start(idx);
     auto lowest_timestamp_in_window = d_timestamps[idx] - preceding_window;
 
     return ((d_timestamps + idx) - thrust::lower_bound(thrust::seq,
@@ -921,14 +1771,10 @@ std::unique_ptr<column> time_range_window_ASC(
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto following_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
+  auto following_calculator = [group_bounds,
+                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
                                following_window] __device__(size_type idx) {
-    auto group_label = d_group_labels[idx];
-    auto group_end =
-      d_group_offsets[group_label +
-                      1];  // Cannot fall off the end, since offsets is capped with `input.size()`.
+    auto group_end                   = group_bounds.end(idx);
     auto highest_timestamp_in_window = d_timestamps[idx] + following_window;
 
     return (thrust::upper_bound(thrust::seq,
@@ -939,90 +1785,31 @@ std::unique_ptr<column> time_range_window_ASC(
            1;
   };
 
-  return cudf::detail::rolling_window(
-    input,
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    preceding_calculator),
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    following_calculator),
-    min_periods,
-    aggr,
-    mr);
+  return make_window_size_columns(
+    timestamp_column.size(), preceding_calculator, following_calculator, mr, stream);
 }
 
-// Time-range window computation, with
-//   1. no grouping keys specified
-//   2. timetamps in DESCENDING order.
-// Treat as one single group.
+// Time-range window sizes computation, for timestamps in DESCENDING order.
+// Without grouping keys (empty `group_offsets`), all rows are treated as one single group.
 template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_DESC(column_view const& input,
-                                               column_view const& timestamp_column,
-                                               TimestampImpl_t preceding_window,
-                                               TimestampImpl_t following_window,
-                                               size_type min_periods,
-                                               std::unique_ptr<aggregation> const& aggr,
-                                               rmm::mr::device_memory_resource* mr)
-{
-  auto preceding_calculator = [d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               preceding_window] __device__(size_type idx) {
-    auto group_start                 = 0;
-    auto highest_timestamp_in_window = d_timestamps[idx] + preceding_window;
-
-    return ((d_timestamps + idx) -
-            thrust::lower_bound(thrust::seq,
-                                d_timestamps + group_start,
-                                d_timestamps + idx,
-                                highest_timestamp_in_window,
-                                thrust::greater<decltype(highest_timestamp_in_window)>())) +
-           1;  // Add 1, for `preceding` to account for current row.
-  };
-
-  auto following_calculator = [num_rows     = input.size(),
-                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
-                               following_window] __device__(size_type idx) {
-    auto group_end =
-      num_rows;  // Cannot fall off the end, since offsets is capped with `input.size()`.
-    auto lowest_timestamp_in_window = d_timestamps[idx] - following_window;
-
-    return (thrust::upper_bound(thrust::seq,
-                                d_timestamps + idx,
-                                d_timestamps + group_end,
-                                lowest_timestamp_in_window,
-                                thrust::greater<decltype(lowest_timestamp_in_window)>()) -
-            (d_timestamps + idx)) -
-           1;
-  };
-
-  return cudf::detail::rolling_window(
-    input,
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    preceding_calculator),
-    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                    following_calculator),
-    min_periods,
-    aggr,
-    mr);
-}
-
-// Time-range window computation, for timestamps in DESCENDING order.
-template <typename TimestampImpl_t>
-std::unique_ptr<column> time_range_window_DESC(
-  column_view const& input,
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> time_range_window_sizes_DESC(
   column_view const& timestamp_column,
   rmm::device_vector<cudf::size_type> const& group_offsets,
   rmm::device_vector<cudf::size_type> const& group_labels,
   TimestampImpl_t preceding_window,
   TimestampImpl_t following_window,
-  size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
-  auto preceding_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
+  auto const group_bounds = row_group_bounds{
+    timestamp_column.size(),
+    group_offsets.empty() ? nullptr : group_offsets.data().get(),
+    group_offsets.empty() ? nullptr : group_labels.data().get()};
+
+  auto preceding_calculator = [group_bounds,
+                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
                                preceding_window] __device__(size_type idx) {
-    auto group_label                 = d_group_labels[idx];
-    auto group_start                 = d_group_offsets[group_label];
+    auto group_start                 = group_bounds.start(idx);
     auto highest_timestamp_in_window = d_timestamps[idx] + preceding_window;
 
     return ((d_timestamps + idx) -
@@ -1034,14 +1821,10 @@ std::unique_ptr<column> time_range_window_DESC(
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto following_calculator = [d_group_offsets = group_offsets.data().get(),
-                               d_group_labels  = group_labels.data().get(),
-                               d_timestamps    = timestamp_column.data<TimestampImpl_t>(),
+  auto following_calculator = [group_bounds,
+                               d_timestamps = timestamp_column.data<TimestampImpl_t>(),
                                following_window] __device__(size_type idx) {
-    auto group_label = d_group_labels[idx];
-    auto group_end =
-      d_group_offsets[group_label +
-                      1];  // Cannot fall off the end, since offsets is capped with `input.size()`.
+    auto group_end                  = group_bounds.end(idx);
     auto lowest_timestamp_in_window = d_timestamps[idx] - following_window;
 
     return (thrust::upper_bound(thrust::seq,
@@ -1053,25 +1836,12 @@ std::unique_ptr<column> time_range_window_DESC(
            1;
   };
 
-  if (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX) {
-    CUDF_FAIL("Time ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input,
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                      preceding_calculator),
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
-                                      following_calculator),
-      min_periods,
-      aggr,
-      mr,
-      0);
-  }
+  return make_window_size_columns(
+    timestamp_column.size(), preceding_calculator, following_calculator, mr, stream);
 }
 
 template <typename TimestampImpl_t>
-std::unique_ptr<column> grouped_time_range_rolling_window_impl(
-  column_view const& input,
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_time_range_window_sizes_impl(
   column_view const& timestamp_column,
   cudf::order const& timestamp_ordering,
   rmm::device_vector<cudf::size_type> const& group_offsets,
@@ -1079,54 +1849,76 @@ std::unique_ptr<column> grouped_time_range_rolling_window_impl(
   size_type preceding_window_in_days,  // TODO: Consider taking offset-type as type_id. Assumes days
                                        // for now.
   size_type following_window_in_days,
-  size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   TimestampImpl_t mult_factor{
     static_cast<TimestampImpl_t>(multiplication_factor(timestamp_column.type()))};
 
-  if (timestamp_ordering == cudf::order::ASCENDING) {
-    return (group_offsets.size() == 0)
-             ? time_range_window_ASC(input,
-                                     timestamp_column,
-                                     preceding_window_in_days * mult_factor,
-                                     following_window_in_days * mult_factor,
-                                     min_periods,
-                                     aggr,
-                                     mr)
-             : time_range_window_ASC(input,
-                                     timestamp_column,
-                                     group_offsets,
-                                     group_labels,
-                                     preceding_window_in_days * mult_factor,
-                                     following_window_in_days * mult_factor,
-                                     min_periods,
-                                     aggr,
-                                     mr);
-  } else {
-    return (group_offsets.size() == 0)
-             ? time_range_window_DESC(input,
-                                      timestamp_column,
-                                      preceding_window_in_days * mult_factor,
-                                      following_window_in_days * mult_factor,
-                                      min_periods,
-                                      aggr,
-                                      mr)
-             : time_range_window_DESC(input,
-                                      timestamp_column,
-                                      group_offsets,
-                                      group_labels,
-                                      preceding_window_in_days * mult_factor,
-                                      following_window_in_days * mult_factor,
-                                      min_periods,
-                                      aggr,
-                                      mr);
-  }
+  return timestamp_ordering == cudf::order::ASCENDING
+           ? time_range_window_sizes_ASC(timestamp_column,
+                                         group_offsets,
+                                         group_labels,
+                                         preceding_window_in_days * mult_factor,
+                                         following_window_in_days * mult_factor,
+                                         mr,
+                                         stream)
+           : time_range_window_sizes_DESC(timestamp_column,
+                                          group_offsets,
+                                          group_labels,
+                                          preceding_window_in_days * mult_factor,
+                                          following_window_in_days * mult_factor,
+                                          mr,
+                                          stream);
 }
 
 }  // namespace
 
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_time_range_window_sizes(
+  table_view const& group_keys,
+  column_view const& timestamp_column,
+  cudf::order const& timestamp_order,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == timestamp_column.size()),
+               "Size mismatch between group_keys and timestamp_column.");
+
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  using index_vector        = sort_groupby_helper::index_vector;
+
+  index_vector group_offsets, group_labels;
+  if (group_keys.num_columns() > 0) {
+    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
+    group_offsets = helper.group_offsets();
+    group_labels  = helper.group_labels();
+  }
+
+  // Assumes that `timestamp_column` is actually of a timestamp type.
+  CUDF_EXPECTS(is_supported_range_frame_unit(timestamp_column.type()),
+               "Unsupported data-type for `timestamp`-based rolling window operation!");
+
+  return timestamp_column.type().id() == cudf::TIMESTAMP_DAYS
+           ? grouped_time_range_window_sizes_impl<int32_t>(timestamp_column,
+                                                           timestamp_order,
+                                                           group_offsets,
+                                                           group_labels,
+                                                           preceding_window_in_days,
+                                                           following_window_in_days,
+                                                           mr,
+                                                           0)
+           : grouped_time_range_window_sizes_impl<int64_t>(timestamp_column,
+                                                           timestamp_order,
+                                                           group_offsets,
+                                                           group_labels,
+                                                           preceding_window_in_days,
+                                                           following_window_in_days,
+                                                           mr,
+                                                           0);
+}
+
 std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& group_keys,
                                                           column_view const& timestamp_column,
                                                           cudf::order const& timestamp_order,
@@ -1144,41 +1936,15 @@ std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& grou
 
   CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
 
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
-  using index_vector        = sort_groupby_helper::index_vector;
+  // The window sizes are computed once, with a binary search of the bounds of each window
+  auto const window_sizes = grouped_time_range_window_sizes(group_keys,
+                                                            timestamp_column,
+                                                            timestamp_order,
+                                                            preceding_window_in_days,
+                                                            following_window_in_days);
 
-  index_vector group_offsets, group_labels;
-  if (group_keys.num_columns() > 0) {
-    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
-    group_offsets = helper.group_offsets();
-    group_labels  = helper.group_labels();
-  }
-
-  // Assumes that `timestamp_column` is actually of a timestamp type.
-  CUDF_EXPECTS(is_supported_range_frame_unit(timestamp_column.type()),
-               "Unsupported data-type for `timestamp`-based rolling window operation!");
-
-  return timestamp_column.type().id() == cudf::TIMESTAMP_DAYS
-           ? grouped_time_range_rolling_window_impl<int32_t>(input,
-                                                             timestamp_column,
-                                                             timestamp_order,
-                                                             group_offsets,
-                                                             group_labels,
-                                                             preceding_window_in_days,
-                                                             following_window_in_days,
-                                                             min_periods,
-                                                             aggr,
-                                                             mr)
-           : grouped_time_range_rolling_window_impl<int64_t>(input,
-                                                             timestamp_column,
-                                                             timestamp_order,
-                                                             group_offsets,
-                                                             group_labels,
-                                                             preceding_window_in_days,
-                                                             following_window_in_days,
-                                                             min_periods,
-                                                             aggr,
-                                                             mr);
+  return rolling_window(
+    input, window_sizes.first->view(), window_sizes.second->view(), min_periods, aggr, mr);
 }
 
 }  // namespace cudf
@@ -42,7 +42,9 @@ static constexpr bool is_rolling_supported()
     constexpr bool is_operation_supported =
       (op == aggregation::SUM) or (op == aggregation::MIN) or (op == aggregation::MAX) or
       (op == aggregation::COUNT_VALID) or (op == aggregation::COUNT_ALL) or
-      (op == aggregation::MEAN) or (op == aggregation::ROW_NUMBER);
+      (op == aggregation::MEAN) or (op == aggregation::ROW_NUMBER) or
+      (op == aggregation::VARIANCE) or (op == aggregation::STD) or
+      (op == aggregation::NTH_ELEMENT) or (op == aggregation::LEAD) or (op == aggregation::LAG);
 
     constexpr bool is_valid_numeric_agg =
       (cudf::is_numeric<ColumnType>() or is_comparable_countable_op) and is_operation_supported;
@@ -52,12 +54,15 @@ static constexpr bool is_rolling_supported()
   } else if (cudf::is_timestamp<ColumnType>()) {
     return (op == aggregation::MIN) or (op == aggregation::MAX) or
            (op == aggregation::COUNT_VALID) or (op == aggregation::COUNT_ALL) or
-           (op == aggregation::MEAN) or (op == aggregation::ROW_NUMBER);
+           (op == aggregation::MEAN) or (op == aggregation::ROW_NUMBER) or
+           (op == aggregation::NTH_ELEMENT) or (op == aggregation::LEAD) or
+           (op == aggregation::LAG);
 
   } else if (std::is_same<ColumnType, cudf::string_view>()) {
     return (op == aggregation::MIN) or (op == aggregation::MAX) or
            (op == aggregation::COUNT_VALID) or (op == aggregation::COUNT_ALL) or
-           (op == aggregation::ROW_NUMBER);
+           (op == aggregation::ROW_NUMBER) or (op == aggregation::NTH_ELEMENT) or
+           (op == aggregation::LEAD) or (op == aggregation::LAG);
 
   } else if (std::is_same<ColumnType, cudf::list_view>()) {
     return (op == aggregation::COUNT_VALID) or (op == aggregation::COUNT_ALL) or
@@ -15,9 +15,13 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/search.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/search.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -30,7 +34,13 @@
 #include <cudf/strings/detail/utilities.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/merge.h>
+
+#include <cmath>
 
 namespace cudf {
 namespace {
@@ -66,6 +76,96 @@ void launch_search(DataIterator it_data,
   }
 }
 
+/**
+ * @brief Computes the insertion points of sorted `values` in `t` with a single merge.
+ *
+ * A merge puts the rows of its first range before the equivalent rows of the second one.
+ * With `values` as the first range (lower bound) or the second one (upper bound), the
+ * merged position of value row `i` is `i` plus its insertion point in `t`. This is one
+ * O(N + M) merge path rather than an independent binary search per value.
+ */
+template <bool has_nulls>
+void merge_search(table_device_view const& d_t,
+                  table_device_view const& d_values,
+                  bool find_first,
+                  order const* column_order,
+                  null_order const* null_precedence,
+                  size_type* output,
+                  cudaStream_t stream)
+{
+  using detail::index_type;
+  using detail::side;
+
+  auto const& first  = find_first ? d_values : d_t;
+  auto const& second = find_first ? d_t : d_values;
+  auto left_begin    = thrust::make_zip_iterator(thrust::make_tuple(
+    thrust::make_constant_iterator(side::LEFT), thrust::make_counting_iterator<size_type>(0)));
+  auto right_begin   = thrust::make_zip_iterator(thrust::make_tuple(
+    thrust::make_constant_iterator(side::RIGHT), thrust::make_counting_iterator<size_type>(0)));
+
+  rmm::device_vector<index_type> merged_indices(first.num_rows() + second.num_rows());
+  thrust::merge(rmm::exec_policy(stream)->on(stream),
+                left_begin,
+                left_begin + first.num_rows(),
+                right_begin,
+                right_begin + second.num_rows(),
+                merged_indices.begin(),
+                detail::row_lexicographic_tagged_comparator<has_nulls>(
+                  first, second, column_order, null_precedence));
+
+  auto const values_side = find_first ? side::LEFT : side::RIGHT;
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    merged_indices.size(),
+    [merged = merged_indices.data().get(), values_side, output] __device__(size_type position) {
+      auto const index = merged[position];
+      if (thrust::get<0>(index) == values_side) {
+        auto const row = thrust::get<1>(index);
+        output[row]    = position - row;
+      }
+    });
+}
+
+/**
+ * @brief Searches a single fixed-width column by value rather than with the row comparator
+ */
+struct column_search_fn {
+  template <typename Element>
+  static constexpr bool is_supported()
+  {
+    return is_numeric<Element>() or is_timestamp<Element>();
+  }
+
+  template <typename Element, std::enable_if_t<is_supported<Element>()>* = nullptr>
+  void operator()(column_view const& t,
+                  column_view const& values,
+                  bool find_first,
+                  bool ascending,
+                  size_type* output,
+                  cudaStream_t stream)
+  {
+    auto const comp = [ascending] __device__(Element lhs, Element rhs) {
+      return relational_compare(lhs, rhs) ==
+             (ascending ? weak_ordering::LESS : weak_ordering::GREATER);
+    };
+    launch_search(t.begin<Element>(),
+                  values.begin<Element>(),
+                  t.size(),
+                  values.size(),
+                  output,
+                  comp,
+                  find_first,
+                  stream);
+  }
+
+  template <typename Element, std::enable_if_t<not is_supported<Element>()>* = nullptr>
+  void operator()(column_view const&, column_view const&, bool, bool, size_type*, cudaStream_t)
+  {
+    CUDF_FAIL("Only numeric and timestamp columns are searched by value");
+  }
+};
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
@@ -82,7 +182,8 @@ std::unique_ptr<column> search_ordered(table_view const& t,
 
   // Handle empty inputs
   if (t.num_rows() == 0) {
-    CUDA_TRY(cudaMemset(result_view.data<size_type>(), 0, values.num_rows() * sizeof(size_type)));
+    CUDA_TRY(cudaMemsetAsync(
+      result_view.data<size_type>(), 0, values.num_rows() * sizeof(size_type), stream));
     return result;
   }
 
@@ -96,6 +197,20 @@ std::unique_ptr<column> search_ordered(table_view const& t,
                  "Mismatch between number of columns and null precedence.");
   }
 
+  auto const nullable = has_nulls(t) or has_nulls(values);
+  auto const type     = t.column(0).type();
+  if (t.num_columns() == 1 and not nullable and (is_numeric(type) or is_timestamp(type))) {
+    type_dispatcher(type,
+                    column_search_fn{},
+                    t.column(0),
+                    values.column(0),
+                    find_first,
+                    column_order.empty() or column_order.front() == order::ASCENDING,
+                    result_view.data<size_type>(),
+                    stream);
+    return result;
+  }
+
   auto d_t      = table_device_view::create(t, stream);
   auto d_values = table_device_view::create(values, stream);
   auto count_it = thrust::make_counting_iterator<size_type>(0);
@@ -103,14 +218,32 @@ std::unique_ptr<column> search_ordered(table_view const& t,
   rmm::device_vector<order> d_column_order(column_order.begin(), column_order.end());
   rmm::device_vector<null_order> d_null_precedence(null_precedence.begin(), null_precedence.end());
 
-  if (has_nulls(t) or has_nulls(values)) {
-    auto ineq_op =
-      (find_first)
-        ? row_lexicographic_comparator<true>(
-            *d_t, *d_values, d_column_order.data().get(), d_null_precedence.data().get())
-        : row_lexicographic_comparator<true>(
-            *d_values, *d_t, d_column_order.data().get(), d_null_precedence.data().get());
+  // Sorted values are merged with `t` when that is cheaper than a binary search for each
+  auto const search_cost = values.num_rows() * std::log2(t.num_rows() + 1.0);
+  auto const merge_cost  = 2.0 * (t.num_rows() + values.num_rows());
+  if (search_cost > merge_cost and is_sorted(values, column_order, null_precedence)) {
+    if (nullable) {
+      merge_search<true>(*d_t,
+                         *d_values,
+                         find_first,
+                         d_column_order.data().get(),
+                         d_null_precedence.data().get(),
+                         result_view.data<size_type>(),
+                         stream);
+    } else {
+      merge_search<false>(*d_t,
+                          *d_values,
+                          find_first,
+                          d_column_order.data().get(),
+                          d_null_precedence.data().get(),
+                          result_view.data<size_type>(),
+                          stream);
+    }
+    return result;
+  }
 
+  // The comparator is specialized for single-column keys, such as nullable or strings keys
+  auto const search = [&](auto ineq_op) {
     launch_search(count_it,
                   count_it,
                   t.num_rows(),
@@ -119,22 +252,13 @@ std::unique_ptr<column> search_ordered(table_view const& t,
                   ineq_op,
                   find_first,
                   stream);
+  };
+  if (find_first) {
+    dispatch_row_lexicographic_comparator(
+      t, values, column_order, null_precedence, search, stream);
   } else {
-    auto ineq_op =
-      (find_first)
-        ? row_lexicographic_comparator<false>(
-            *d_t, *d_values, d_column_order.data().get(), d_null_precedence.data().get())
-        : row_lexicographic_comparator<false>(
-            *d_values, *d_t, d_column_order.data().get(), d_null_precedence.data().get());
-
-    launch_search(count_it,
-                  count_it,
-                  t.num_rows(),
-                  values.num_rows(),
-                  result_view.data<size_type>(),
-                  ineq_op,
-                  find_first,
-                  stream);
+    dispatch_row_lexicographic_comparator(
+      values, t, column_order, null_precedence, search, stream);
   }
 
   return result;
@@ -195,6 +319,16 @@ bool contains(column_view const& col,
               rmm::mr::device_memory_resource* mr,
               cudaStream_t stream)
 {
+  if (col.type().id() == type_id::DICTIONARY32) {
+    // search the indices for the index of the value in the keys
+    if (col.size() == 0) { return false; }
+    if (not value.is_valid()) { return col.has_nulls(); }
+    dictionary_column_view dictionary(col);
+    auto const index = dictionary::detail::get_typed_index(dictionary, value, mr, stream);
+    if (not index->is_valid()) { return false; }
+    return contains(dictionary.get_indices_annotated(), *index, mr, stream);
+  }
+
   CUDF_EXPECTS(col.type() == value.type(), "DTYPE mismatch");
 
   if (col.size() == 0) { return false; }
@@ -14,24 +14,94 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/device_scalar.hpp>
 #include <rmm/thrust_rmm_allocator.h>
 
 namespace cudf {
 namespace detail {
+namespace {
+constexpr size_type is_sorted_block_size{256};
+
+/**
+ * @brief Sets `*unsorted` if any row in `[1, num_rows)` is ordered before the row preceding it.
+ *
+ * Every block checks whether a row out of order was found before comparing each tile of rows,
+ * so that the search stops soon after the first such row rather than comparing every row.
+ */
+template <typename Comparator>
+__global__ void find_unsorted_row(Comparator comparator, size_type num_rows, int32_t* unsorted)
+{
+  auto const stride = static_cast<int64_t>(blockDim.x) * gridDim.x;
+  for (int64_t tile = static_cast<int64_t>(blockIdx.x) * blockDim.x + 1; tile < num_rows;
+       tile += stride) {
+    if (__syncthreads_or(*static_cast<int32_t volatile*>(unsorted))) { return; }
+    auto const row = static_cast<size_type>(tile + threadIdx.x);
+    if (tile + threadIdx.x < num_rows and comparator(row, row - 1)) { *unsorted = 1; }
+  }
+}
+
+/**
+ * @brief Returns whether no row in `[1, num_rows)` compares less than the row preceding it
+ */
+template <typename Comparator>
+bool rows_are_sorted(Comparator comparator, size_type num_rows, cudaStream_t stream)
+{
+  rmm::device_scalar<int32_t> unsorted(0, stream);
+  cudf::detail::grid_1d const grid{num_rows - 1, is_sorted_block_size, 4};
+  find_unsorted_row<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+    comparator, num_rows, unsorted.data());
+  CHECK_CUDA(stream);
+  return unsorted.value(stream) == 0;
+}
+
+/**
+ * @brief Checks the order of a single column with a comparator of its element type
+ */
+struct single_column_is_sorted_fn {
+  template <typename T, std::enable_if_t<cudf::is_relationally_comparable<T, T>()>* = nullptr>
+  bool operator()(column_view const& col,
+                  order column_order,
+                  null_order null_precedence,
+                  cudaStream_t stream)
+  {
+    auto const d_col = column_device_view::create(col, stream);
+    if (col.has_nulls()) {
+      return rows_are_sorted(single_column_lexicographic_comparator<T, true>{
+                               *d_col, *d_col, column_order, null_precedence},
+                             col.size(),
+                             stream);
+    }
+    return rows_are_sorted(single_column_lexicographic_comparator<T, false>{
+                             *d_col, *d_col, column_order, null_precedence},
+                           col.size(),
+                           stream);
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_relationally_comparable<T, T>()>* = nullptr>
+  bool operator()(column_view const&, order, null_order, cudaStream_t)
+  {
+    CUDF_FAIL("Column type is not relationally comparable");
+  }
+};
+
 template <bool has_nulls>
-auto is_sorted(cudf::table_view const& in,
-               std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence)
+bool table_is_sorted(cudf::table_view const& in,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     cudaStream_t stream)
 {
-  cudaStream_t stream = 0;
-  auto in_d           = table_device_view::create(in);
+  auto in_d = table_device_view::create(in, stream);
   rmm::device_vector<order> d_column_order(column_order);
   rmm::device_vector<null_order> const d_null_precedence =
     (has_nulls) ? rmm::device_vector<null_order>{null_precedence}
@@ -39,21 +109,16 @@ auto is_sorted(cudf::table_view const& in,
   auto ineq_op = row_lexicographic_comparator<has_nulls>(
     *in_d, *in_d, d_column_order.data().get(), d_null_precedence.data().get());
 
-  auto sorted = thrust::is_sorted(rmm::exec_policy(stream)->on(stream),
-                                  thrust::make_counting_iterator(0),
-                                  thrust::make_counting_iterator(in.num_rows()),
-                                  ineq_op);
-
-  return sorted;
+  return rows_are_sorted(ineq_op, in.num_rows(), stream);
 }
 
-}  // namespace detail
+}  // namespace
 
 bool is_sorted(cudf::table_view const& in,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence)
+               std::vector<null_order> const& null_precedence,
+               cudaStream_t stream)
 {
-  CUDF_FUNC_RANGE();
   if (in.num_columns() == 0 || in.num_rows() == 0) { return true; }
 
   if (not column_order.empty()) {
@@ -67,11 +132,33 @@ bool is_sorted(cudf::table_view const& in,
       "Number of columns in the table doesn't match the vector null_precedence's size .\n");
   }
 
+  if (in.num_rows() == 1) { return true; }
+
+  // A single column is compared without the loop over the columns and the type dispatch
+  if (in.num_columns() == 1) {
+    return type_dispatcher(in.column(0).type(),
+                           single_column_is_sorted_fn{},
+                           in.column(0),
+                           column_order.empty() ? order::ASCENDING : column_order.front(),
+                           null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+                           stream);
+  }
+
   if (has_nulls(in)) {
-    return detail::is_sorted<true>(in, column_order, null_precedence);
+    return table_is_sorted<true>(in, column_order, null_precedence, stream);
   } else {
-    return detail::is_sorted<false>(in, column_order, null_precedence);
+    return table_is_sorted<false>(in, column_order, null_precedence, stream);
   }
 }
 
+}  // namespace detail
+
+bool is_sorted(cudf::table_view const& in,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence)
+{
+  CUDF_FUNC_RANGE();
+  return detail::is_sorted(in, column_order, null_precedence);
+}
+
 }  // namespace cudf
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "radix_select.hpp"
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int radix_bits{8};
+constexpr int radix_buckets{1 << radix_bits};
+
+/**
+ * @brief Counts, for every rank, the keys matching its prefix on the bits of `mask` by their
+ * digit at `shift`
+ *
+ * Each block accumulates its counts in shared memory before adding them to `histograms`, which
+ * holds `radix_buckets` counts per rank.
+ */
+__global__ void radix_select_histogram_kernel(uint64_t const* __restrict__ keys,
+                                              size_type num_keys,
+                                              uint64_t const* __restrict__ prefixes,
+                                              int num_ranks,
+                                              uint64_t mask,
+                                              int shift,
+                                              size_type* __restrict__ histograms)
+{
+  __shared__ size_type block_histograms[max_radix_select_ranks * radix_buckets];
+  auto const num_buckets = num_ranks * radix_buckets;
+  for (int i = threadIdx.x; i < num_buckets; i += blockDim.x) { block_histograms[i] = 0; }
+  __syncthreads();
+
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_keys;
+       i += blockDim.x * gridDim.x) {
+    auto const key   = keys[i];
+    auto const digit = (key >> shift) & (radix_buckets - 1);
+    for (int rank = 0; rank < num_ranks; ++rank) {
+      if ((key & mask) == prefixes[rank]) {
+        atomicAdd(&block_histograms[rank * radix_buckets + digit], 1);
+      }
+    }
+  }
+  __syncthreads();
+
+  for (int i = threadIdx.x; i < num_buckets; i += blockDim.x) {
+    if (block_histograms[i] != 0) { atomicAdd(&histograms[i], block_histograms[i]); }
+  }
+}
+
+}  // namespace
+
+std::vector<radix_selection> radix_select(uint64_t const* keys,
+                                          size_type num_keys,
+                                          int key_bits,
+                                          std::vector<size_type> const& counts,
+                                          cudaStream_t stream)
+{
+  CUDF_EXPECTS(counts.size() <= static_cast<size_t>(max_radix_select_ranks),
+               "Too many ranks to select");
+  CUDF_EXPECTS(std::all_of(counts.begin(),
+                           counts.end(),
+                           [num_keys](size_type count) { return count > 0 and count <= num_keys; }),
+               "Selected rank out of bounds");
+
+  auto const num_ranks = static_cast<int>(counts.size());
+  std::vector<radix_selection> selections(num_ranks);
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    selections[rank] = radix_selection{0, counts[rank], num_keys};
+  }
+  if (num_ranks == 0) { return selections; }
+
+  // Select the digits of the keys from the most significant
+  constexpr size_type block_size{256};
+  detail::grid_1d grid{num_keys, block_size, 16};
+  rmm::device_vector<size_type> histograms(num_ranks * radix_buckets);
+  std::vector<size_type> h_histograms(histograms.size());
+  rmm::device_vector<uint64_t> prefixes(num_ranks);
+  std::vector<uint64_t> h_prefixes(num_ranks, 0);
+  uint64_t mask{0};
+  for (int shift = (key_bits - 1) / radix_bits * radix_bits; shift >= 0; shift -= radix_bits) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream), histograms.begin(), histograms.end(), 0);
+    CUDA_TRY(cudaMemcpyAsync(prefixes.data().get(),
+                             h_prefixes.data(),
+                             num_ranks * sizeof(uint64_t),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    radix_select_histogram_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      keys, num_keys, prefixes.data().get(), num_ranks, mask, shift, histograms.data().get());
+    CUDA_TRY(cudaMemcpyAsync(h_histograms.data(),
+                             histograms.data().get(),
+                             histograms.size() * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    for (int rank = 0; rank < num_ranks; ++rank) {
+      auto const histogram = h_histograms.data() + rank * radix_buckets;
+      auto& selection      = selections[rank];
+      uint64_t bucket      = 0;
+      while (histogram[bucket] < selection.remaining) {
+        selection.remaining -= histogram[bucket++];
+      }
+      h_prefixes[rank] |= bucket << shift;
+      selection.key       = h_prefixes[rank];
+      selection.num_equal = histogram[bucket];
+    }
+    mask |= static_cast<uint64_t>(radix_buckets - 1) << shift;
+  }
+  return selections;
+}
+
+}  // namespace detail
+}  // namespace cudf
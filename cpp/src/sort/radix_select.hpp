@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief The maximum number of ranks `radix_select` selects in one call
+ */
+constexpr int max_radix_select_ranks{8};
+
+/**
+ * @brief A key selected by `radix_select`
+ */
+struct radix_selection {
+  uint64_t key;         ///< The key of the requested rank
+  size_type remaining;  ///< The number of keys equal to `key` within the requested count
+  size_type num_equal;  ///< The number of keys equal to `key`
+};
+
+/**
+ * @brief Finds, for each count `c` of `counts`, the `c`-th smallest of `keys`, without sorting
+ * them.
+ *
+ * The digits of the selected keys are found from the most significant with one histogram
+ * pass over `keys` per 8 bits of `key_bits`, all counts sharing the same passes.
+ *
+ * @throws cudf::logic_error if there are more than `max_radix_select_ranks` counts, or a count is
+ * not in `[1, num_keys]`.
+ *
+ * @param keys The keys to select from, e.g. rows packed by `pack_sort_keys`
+ * @param num_keys The number of keys
+ * @param key_bits The number of low bits of the keys that may be set, at most 64
+ * @param counts The 1-based ranks of the keys to select
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The selected key of every count
+ */
+std::vector<radix_selection> radix_select(uint64_t const* keys,
+                                          size_type num_keys,
+                                          int key_bits,
+                                          std::vector<size_type> const& counts,
+                                          cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -27,6 +28,7 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/sequence.h>
 
 namespace cudf {
@@ -49,37 +51,102 @@ struct unique_comparator {
   Iterator const permute;
 };
 
-// Assign rank from 1 to n unique values. Equal values get same rank value.
-rmm::device_vector<size_type> sorted_dense_rank(column_view input_col,
-                                                column_view sorted_order_view,
-                                                cudaStream_t stream)
+/**
+ * @brief Invokes `scanner` with an iterator over the positions of the sorted `input`, whose
+ * value is 1 at the first position of each group of equal values and 0 elsewhere.
+ */
+template <typename Scanner>
+void scan_group_heads(column_view const &input,
+                      column_view const &sorted_order_view,
+                      Scanner scanner,
+                      cudaStream_t stream)
 {
-  auto device_table     = table_device_view::create(table_view{{input_col}}, stream);
-  auto const input_size = input_col.size();
-  rmm::device_vector<size_type> dense_rank_sorted(input_size);
+  auto device_table       = table_device_view::create(table_view{{input}}, stream);
   auto sorted_index_order = thrust::make_permutation_iterator(
     sorted_order_view.begin<size_type>(), thrust::make_counting_iterator<size_type>(0));
-  if (input_col.has_nulls()) {
+  if (input.has_nulls()) {
     auto conv = unique_comparator<true, size_type, decltype(sorted_index_order)>(
       *device_table, sorted_index_order);
-    auto unique_it =
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv);
-
-    thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
-                           unique_it,
-                           unique_it + input_size,
-                           dense_rank_sorted.data().get());
+    scanner(thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv));
   } else {
     auto conv = unique_comparator<false, size_type, decltype(sorted_index_order)>(
       *device_table, sorted_index_order);
-    auto unique_it =
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv);
+    scanner(thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv));
+  }
+}
+
+/**
+ * @brief Maps a sorted position to its rank if it is the first of its group of equal values,
+ * and to 0 otherwise
+ */
+template <typename HeadIterator>
+struct group_head_rank {
+  HeadIterator heads;
+  __device__ size_type operator()(size_type index) const noexcept
+  {
+    return heads[index] ? index + 1 : 0;
+  }
+};
+
+/**
+ * @brief Writes the dense rank of each sorted position: the number of groups of equal values
+ * up to and including the position.
+ */
+template <typename OutputIterator>
+struct dense_rank_scanner {
+  size_type size;
+  OutputIterator output;
+  cudaStream_t stream;
 
+  template <typename HeadIterator>
+  void operator()(HeadIterator heads) const
+  {
+    thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream), heads, heads + size, output);
+  }
+};
+
+/**
+ * @brief Writes the min rank of each sorted position: the rank of the first position of its
+ * group of equal values.
+ */
+template <typename OutputIterator>
+struct min_rank_scanner {
+  size_type size;
+  OutputIterator output;
+  cudaStream_t stream;
+
+  template <typename HeadIterator>
+  void operator()(HeadIterator heads) const
+  {
+    auto head_ranks = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                      group_head_rank<HeadIterator>{heads});
     thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
-                           unique_it,
-                           unique_it + input_size,
-                           dense_rank_sorted.data().get());
+                           head_ranks,
+                           head_ranks + size,
+                           output,
+                           thrust::maximum<size_type>{});
   }
+};
+
+template <typename OutputIterator>
+dense_rank_scanner<OutputIterator> make_dense_rank_scanner(size_type size,
+                                                           OutputIterator output,
+                                                           cudaStream_t stream)
+{
+  return dense_rank_scanner<OutputIterator>{size, output, stream};
+}
+
+// Assign rank from 1 to n unique values. Equal values get same rank value.
+rmm::device_vector<size_type> sorted_dense_rank(column_view input_col,
+                                                column_view sorted_order_view,
+                                                cudaStream_t stream)
+{
+  rmm::device_vector<size_type> dense_rank_sorted(input_col.size());
+  scan_group_heads(
+    input_col,
+    sorted_order_view,
+    make_dense_rank_scanner(input_col.size(), dense_rank_sorted.data().get(), stream),
+    stream);
   return dense_rank_sorted;
 }
 
@@ -147,35 +214,36 @@ void rank_first(column_view sorted_order_view,
 }
 
 template <typename outputType>
-void rank_dense(rmm::device_vector<size_type> const &dense_rank_sorted,
+void rank_dense(column_view const &input,
                 column_view sorted_order_view,
                 mutable_column_view rank_mutable_view,
                 cudaStream_t stream)
 {
-  // All equal values have same rank and rank always increases by 1 between groups
-  thrust::scatter(rmm::exec_policy(stream)->on(stream),
-                  dense_rank_sorted.begin(),
-                  dense_rank_sorted.end(),
-                  sorted_order_view.begin<size_type>(),
-                  rank_mutable_view.begin<outputType>());
+  // All equal values have same rank and rank always increases by 1 between groups.
+  // The ranks are scanned in sorted order directly into their rows.
+  auto rank_iter = thrust::make_permutation_iterator(rank_mutable_view.begin<outputType>(),
+                                                     sorted_order_view.begin<size_type>());
+  scan_group_heads(input,
+                   sorted_order_view,
+                   make_dense_rank_scanner(input.size(), rank_iter, stream),
+                   stream);
 }
 
 template <typename outputType>
-void rank_min(rmm::device_vector<size_type> const &group_keys,
+void rank_min(column_view const &input,
               column_view sorted_order_view,
               mutable_column_view rank_mutable_view,
               cudaStream_t stream)
 {
   // min of first in the group
   // All equal values have min of ranks among them.
-  // algorithm: reduce_by_key(dense_rank, 1, n, min), scatter
-  tie_break_ranks_transform<size_type>(group_keys,
-                                       thrust::make_counting_iterator<size_type>(1),
-                                       sorted_order_view,
-                                       rank_mutable_view.begin<outputType>(),
-                                       thrust::minimum<size_type>{},
-                                       thrust::identity<outputType>{},
-                                       stream);
+  // algorithm: inclusive_scan(first rank of each group, max), in sorted order into the rows
+  auto rank_iter = thrust::make_permutation_iterator(rank_mutable_view.begin<outputType>(),
+                                                     sorted_order_view.begin<size_type>());
+  scan_group_heads(input,
+                   sorted_order_view,
+                   min_rank_scanner<decltype(rank_iter)>{input.size(), rank_iter, stream},
+                   stream);
 }
 
 template <typename outputType>
@@ -228,14 +296,19 @@ void rank_average(rmm::device_vector<size_type> const &group_keys,
 }  // anonymous namespace
 
 std::unique_ptr<column> rank(column_view const &input,
+                             column_view const &sorted_order_view,
                              rank_method method,
-                             order column_order,
                              null_policy null_handling,
-                             null_order null_precedence,
                              bool percentage,
                              rmm::mr::device_memory_resource *mr,
-                             cudaStream_t stream = 0)
+                             cudaStream_t stream)
 {
+  CUDF_EXPECTS(sorted_order_view.type().id() == type_to_id<size_type>(),
+               "Sorted order must be a column of row indices");
+  CUDF_EXPECTS(sorted_order_view.size() == input.size(),
+               "Sorted order size must match the input size");
+  CUDF_EXPECTS(not sorted_order_view.has_nulls(), "Sorted order must not have nulls");
+
   data_type const output_type = (percentage or method == rank_method::AVERAGE)
                                   ? data_type(FLOAT64)
                                   : data_type(type_to_id<size_type>());
@@ -248,19 +321,13 @@ std::unique_ptr<column> rank(column_view const &input,
       return make_numeric_column(output_type, input.size(), mask_state::UNALLOCATED, stream, mr);
   }();
   auto rank_mutable_view = rank_column->mutable_view();
-
-  std::unique_ptr<column> sorted_order =
-    (method == rank_method::FIRST)
-      ? detail::stable_sorted_order(
-          table_view{{input}}, {column_order}, {null_precedence}, mr, stream)
-      : detail::sorted_order(table_view{{input}}, {column_order}, {null_precedence}, mr, stream);
-  column_view sorted_order_view = sorted_order->view();
+  if (input.size() == 0) { return rank_column; }
 
   // dense: All equal values have same rank and rank always increases by 1 between groups
-  // acts as key for min, max, average to denote equal value groups
+  // acts as key for max, average to denote equal value groups
   rmm::device_vector<size_type> const dense_rank_sorted =
     [&method, &input, &sorted_order_view, &stream] {
-      if (method != rank_method::FIRST)
+      if (method == rank_method::MAX or method == rank_method::AVERAGE)
         return sorted_dense_rank(input, sorted_order_view, stream);
       else
         return rmm::device_vector<size_type>();
@@ -272,10 +339,10 @@ std::unique_ptr<column> rank(column_view const &input,
         rank_first<double>(sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::DENSE:
-        rank_dense<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_dense<double>(input, sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::MIN:
-        rank_min<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_min<double>(input, sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::MAX:
         rank_max<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
@@ -291,10 +358,10 @@ std::unique_ptr<column> rank(column_view const &input,
         rank_first<size_type>(sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::DENSE:
-        rank_dense<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_dense<size_type>(input, sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::MIN:
-        rank_min<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_min<size_type>(input, sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::MAX:
         rank_max<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
@@ -311,18 +378,53 @@ std::unique_ptr<column> rank(column_view const &input,
     auto rank_iter = rank_mutable_view.begin<double>();
     size_type const count =
       (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
-    auto drs            = dense_rank_sorted.data().get();
-    bool const is_dense = (method == rank_method::DENSE);
+    // Dense ranks are divided by the dense rank of the last counted sorted position
+    double divisor = count;
+    if (method == rank_method::DENSE and count > 0) {
+      size_type last_row{};
+      CUDA_TRY(cudaMemcpyAsync(&last_row,
+                               sorted_order_view.data<size_type>() + count - 1,
+                               sizeof(size_type),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      CUDA_TRY(cudaMemcpyAsync(
+        &divisor, rank_iter + last_row, sizeof(double), cudaMemcpyDeviceToHost, stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
     thrust::transform(rmm::exec_policy(stream)->on(stream),
                       rank_iter,
                       rank_iter + input.size(),
                       rank_iter,
-                      [is_dense, drs, count] __device__(double r) -> double {
-                        return is_dense ? r / drs[count - 1] : r / count;
-                      });
+                      [divisor] __device__(double r) -> double { return r / divisor; });
   }
   return rank_column;
 }
+
+std::unique_ptr<column> rank(column_view const &input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             rmm::mr::device_memory_resource *mr,
+                             cudaStream_t stream)
+{
+  // The sorted order is only needed while ranking
+  std::unique_ptr<column> sorted_order =
+    (method == rank_method::FIRST)
+      ? detail::stable_sorted_order(table_view{{input}},
+                                    {column_order},
+                                    {null_precedence},
+                                    rmm::mr::get_default_resource(),
+                                    stream)
+      : detail::sorted_order(table_view{{input}},
+                             {column_order},
+                             {null_precedence},
+                             rmm::mr::get_default_resource(),
+                             stream);
+  return rank(input, sorted_order->view(), method, null_handling, percentage, mr, stream);
+}
 }  // namespace detail
 
 std::unique_ptr<column> rank(column_view const &input,
@@ -333,6 +435,18 @@ std::unique_ptr<column> rank(column_view const &input,
                              bool percentage,
                              rmm::mr::device_memory_resource *mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::rank(input, method, column_order, null_handling, null_precedence, percentage, mr);
 }
+
+std::unique_ptr<column> rank(column_view const &input,
+                             column_view const &sorted_order,
+                             rank_method method,
+                             null_policy null_handling,
+                             bool percentage,
+                             rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rank(input, sorted_order, method, null_handling, percentage, mr);
+}
 }  // namespace cudf
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "sort_impl.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/binary_search.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Checks that `offsets` are valid segment offsets covering all rows of `keys`
+ */
+void validate_segment_offsets(table_view const& keys,
+                              column_view const& offsets,
+                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>() and offsets.size() > 0 and
+                 not offsets.has_nulls(),
+               "Segment offsets must be a non-empty INT32 column without nulls");
+  size_type first{}, last{};
+  CUDA_TRY(cudaMemcpyAsync(
+    &first, offsets.data<size_type>(), sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(&last,
+                           offsets.data<size_type>() + offsets.size() - 1,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_EXPECTS(first == 0 and last == keys.num_rows(),
+               "Segment offsets must cover all rows of the keys");
+}
+
+/**
+ * @brief Sorts each segment of composite keys packed with `pack_sort_key_fn` with
+ * `cub::DeviceSegmentedRadixSort`
+ */
+void segmented_packed_sorted_order(table_view const& keys,
+                                   column_view const& offsets,
+                                   std::vector<order> const& column_order,
+                                   std::vector<null_order> const& null_precedence,
+                                   int key_bits,
+                                   mutable_column_view& indices,
+                                   cudaStream_t stream)
+{
+  auto keys_in = pack_sort_keys(keys, column_order, null_precedence, stream);
+  rmm::device_vector<uint64_t> keys_out(keys.num_rows());
+  rmm::device_vector<size_type> indices_in(keys.num_rows());
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), indices_in.begin(), indices_in.end(), 0);
+
+  auto const d_offsets      = offsets.data<size_type>();
+  auto const num_segments   = offsets.size() - 1;
+  size_t temp_storage_bytes = 0;
+  CUDA_TRY(cub::DeviceSegmentedRadixSort::SortPairs(nullptr,
+                                                    temp_storage_bytes,
+                                                    keys_in.data().get(),
+                                                    keys_out.data().get(),
+                                                    indices_in.data().get(),
+                                                    indices.begin<size_type>(),
+                                                    keys.num_rows(),
+                                                    num_segments,
+                                                    d_offsets,
+                                                    d_offsets + 1,
+                                                    0,
+                                                    key_bits,
+                                                    stream));
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  CUDA_TRY(cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage.data(),
+                                                    temp_storage_bytes,
+                                                    keys_in.data().get(),
+                                                    keys_out.data().get(),
+                                                    indices_in.data().get(),
+                                                    indices.begin<size_type>(),
+                                                    keys.num_rows(),
+                                                    num_segments,
+                                                    d_offsets,
+                                                    d_offsets + 1,
+                                                    0,
+                                                    key_bits,
+                                                    stream));
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(column_order.empty() or
+                 static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or
+                 static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+               "Mismatch between number of columns and null_precedence size.");
+  validate_segment_offsets(keys, segment_offsets, stream);
+
+  if (keys.num_rows() == 0 or keys.num_columns() == 0) {
+    return cudf::make_numeric_column(data_type(type_to_id<size_type>()), 0);
+  }
+
+  // Keys fitting in 64 bits are radix sorted segment by segment
+  auto const key_bits = packed_sort_key_bits(keys);
+  if (key_bits > 0 and key_bits <= 64) {
+    auto sorted_indices = cudf::make_numeric_column(
+      data_type(type_to_id<size_type>()), keys.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto indices_view = sorted_indices->mutable_view();
+    segmented_packed_sorted_order(
+      keys, segment_offsets, column_order, null_precedence, key_bits, indices_view, stream);
+    return sorted_indices;
+  }
+
+  // Otherwise the segment labels become the leading sort key
+  auto segment_ids = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), keys.num_rows(), mask_state::UNALLOCATED, stream);
+  auto const d_offsets = segment_offsets.data<size_type>();
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      d_offsets,
+                      d_offsets + segment_offsets.size(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(keys.num_rows()),
+                      segment_ids->mutable_view().begin<size_type>());
+
+  std::vector<column_view> columns{segment_ids->view()};
+  columns.insert(columns.end(), keys.begin(), keys.end());
+  std::vector<order> labeled_order;
+  if (not column_order.empty()) {
+    labeled_order.push_back(order::ASCENDING);
+    labeled_order.insert(labeled_order.end(), column_order.begin(), column_order.end());
+  }
+  std::vector<null_order> labeled_null_precedence;
+  if (not null_precedence.empty()) {
+    labeled_null_precedence.push_back(null_order::BEFORE);
+    labeled_null_precedence.insert(
+      labeled_null_precedence.end(), null_precedence.begin(), null_precedence.end());
+  }
+  return sorted_order<true>(
+    table_view{columns}, labeled_order, labeled_null_precedence, mr, stream);
+}
+
+std::unique_ptr<table> segmented_sort(table_view const& values,
+                                      column_view const& segment_offsets,
+                                      std::vector<order> const& column_order,
+                                      std::vector<null_order> const& null_precedence,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  auto sorted_order =
+    segmented_sorted_order(values, segment_offsets, column_order, null_precedence, mr, stream);
+
+  return detail::gather(values,
+                        sorted_order->view(),
+                        detail::out_of_bounds_policy::NULLIFY,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        mr,
+                        stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sorted_order(keys, segment_offsets, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> segmented_sort(table_view const& values,
+                                      column_view const& segment_offsets,
+                                      std::vector<order> const& column_order,
+                                      std::vector<null_order> const& null_precedence,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sort(values, segment_offsets, column_order, null_precedence, mr);
+}
+
+}  // namespace cudf
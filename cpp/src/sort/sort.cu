@@ -43,6 +43,11 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
   CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
                "Mismatch in number of rows for values and keys");
 
+  // Sorted keys leave the values in place
+  if (detail::is_sorted(keys, column_order, null_precedence, stream)) {
+    return std::make_unique<table>(values, stream, mr);
+  }
+
   auto sorted_order = detail::sorted_order(keys, column_order, null_precedence, mr, stream);
 
   return detail::gather(values,
@@ -17,16 +17,508 @@
 #pragma once
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/strings/detail/string_prefix.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/device_buffer.hpp>
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <cub/cub.cuh>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace cudf {
 namespace detail {
+/**
+ * @brief Maps a fixed-width element to the key type sorted by `cub::DeviceRadixSort`
+ *
+ * The key preserves the order of `row_lexicographic_comparator`.
+ */
+template <typename T, typename Enable = void>
+struct radix_sort_key {
+  using type = T;
+  __device__ static type convert(T value) { return value; }
+};
+
+template <>
+struct radix_sort_key<bool> {
+  using type = uint8_t;
+  __device__ static type convert(bool value) { return static_cast<type>(value); }
+};
+
+/**
+ * @brief Floating-point keys are canonicalized so that `-0` and `0` compare equivalent
+ * and every `NaN` sorts after `+Inf`, matching `relational_compare`.
+ */
+template <typename T>
+struct radix_sort_key<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  using type = T;
+  __device__ static type convert(T value)
+  {
+    if (isnan(value)) { return std::numeric_limits<T>::quiet_NaN(); }
+    return value == T{0} ? T{0} : value;
+  }
+};
+
+template <typename T>
+struct radix_sort_key<T, std::enable_if_t<cudf::is_timestamp<T>()>> {
+  using type = typename T::rep;
+  __device__ static type convert(T value) { return value.time_since_epoch().count(); }
+};
+
+/**
+ * @brief Computes the sorted order of a single numeric or timestamp column with
+ * `cub::DeviceRadixSort`.
+ *
+ * Null rows are partitioned before or after the valid rows in their original order and
+ * only the valid rows are radix sorted. Radix sorting is stable, so the result is valid
+ * for both `sorted_order` and `stable_sorted_order`.
+ */
+struct radix_sorted_order_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_numeric<T>() or cudf::is_timestamp<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  mutable_column_view& indices,
+                  bool ascending,
+                  null_order null_precedence,
+                  cudaStream_t stream)
+  {
+    using Key              = typename radix_sort_key<T>::type;
+    auto const null_count  = input.null_count();
+    auto const valid_count = input.size() - null_count;
+    // Nulls compare less than any value for `null_order::BEFORE`, which a descending sort
+    // places last
+    auto const nulls_first = (null_precedence == null_order::BEFORE) == ascending;
+    auto const d_input     = column_device_view::create(input, stream);
+    auto const d_col       = *d_input;
+    auto const out         = indices.begin<size_type>();
+    auto const valid_out   = nulls_first ? out + null_count : out;
+
+    rmm::device_vector<size_type> valid_indices(valid_count);
+    if (null_count > 0) {
+      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      nulls_first ? out : out + valid_count,
+                      [d_col] __device__(size_type i) { return d_col.is_null_nocheck(i); });
+      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      valid_indices.begin(),
+                      [d_col] __device__(size_type i) { return d_col.is_valid_nocheck(i); });
+    } else {
+      thrust::sequence(
+        rmm::exec_policy(stream)->on(stream), valid_indices.begin(), valid_indices.end(), 0);
+    }
+    if (valid_count == 0) { return; }
+
+    rmm::device_vector<Key> keys_in(valid_count);
+    rmm::device_vector<Key> keys_out(valid_count);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      valid_indices.begin(),
+                      valid_indices.end(),
+                      keys_in.begin(),
+                      [d_col] __device__(size_type i) {
+                        return radix_sort_key<T>::convert(d_col.element<T>(i));
+                      });
+
+    auto const sort_pairs = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+      if (ascending) {
+        return cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                               temp_storage_bytes,
+                                               keys_in.data().get(),
+                                               keys_out.data().get(),
+                                               valid_indices.data().get(),
+                                               valid_out,
+                                               valid_count,
+                                               0,
+                                               sizeof(Key) * 8,
+                                               stream);
+      }
+      return cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                       temp_storage_bytes,
+                                                       keys_in.data().get(),
+                                                       keys_out.data().get(),
+                                                       valid_indices.data().get(),
+                                                       valid_out,
+                                                       valid_count,
+                                                       0,
+                                                       sizeof(Key) * 8,
+                                                       stream);
+    };
+    size_t temp_storage_bytes = 0;
+    CUDA_TRY(sort_pairs(nullptr, temp_storage_bytes));
+    rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+    CUDA_TRY(sort_pairs(d_temp_storage.data(), temp_storage_bytes));
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  void operator()(column_view const&, mutable_column_view&, bool, null_order, cudaStream_t)
+  {
+    CUDF_FAIL("Radix sort supports only numeric and timestamp columns");
+  }
+};
+
+/**
+ * @brief Maps an unsigned radix sort key to itself
+ */
+template <typename Key, std::enable_if_t<std::is_unsigned<Key>::value>* = nullptr>
+__device__ uint64_t to_ordered_bits(Key key)
+{
+  return key;
+}
+
+/**
+ * @brief Maps a signed integral key to unsigned bits of the same order by flipping the
+ * sign bit
+ */
+template <typename Key,
+          std::enable_if_t<std::is_integral<Key>::value and std::is_signed<Key>::value>* = nullptr>
+__device__ uint64_t to_ordered_bits(Key key)
+{
+  using U = std::make_unsigned_t<Key>;
+  return static_cast<U>(static_cast<U>(key) ^ (U{1} << (sizeof(Key) * 8 - 1)));
+}
+
+/**
+ * @brief Maps a floating-point key to unsigned bits of the same order
+ *
+ * Positive values have the sign bit set and negative values have every bit flipped.
+ */
+template <typename Key, std::enable_if_t<std::is_floating_point<Key>::value>* = nullptr>
+__device__ uint64_t to_ordered_bits(Key key)
+{
+  using U = std::conditional_t<sizeof(Key) == sizeof(uint32_t), uint32_t, uint64_t>;
+  U bits;
+  memcpy(&bits, &key, sizeof(Key));
+  U const sign = U{1} << (sizeof(U) * 8 - 1);
+  return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+}
+
+/**
+ * @brief Returns the number of bits `pack_sort_key_fn` uses for the values of `col`, or 0
+ * if the column cannot be packed
+ */
+inline int packed_value_bits(column_view const& col)
+{
+  if (col.type().id() == BOOL8) { return 1; }
+  if (not is_numeric(col.type()) and not is_timestamp(col.type())) { return 0; }
+  return static_cast<int>(size_of(col.type()) * 8);
+}
+
+/**
+ * @brief Returns the width of the composite key `pack_sort_key_fn` builds for the rows
+ * of `input`, or -1 if a column cannot be packed.
+ *
+ * Each column contributes its value bits plus one null bit when it has nulls.
+ */
+inline int packed_sort_key_bits(table_view const& input)
+{
+  int total_bits = 0;
+  for (auto const& col : input) {
+    auto const value_bits = packed_value_bits(col);
+    if (value_bits == 0) { return -1; }
+    total_bits += value_bits + (col.has_nulls() ? 1 : 0);
+  }
+  return total_bits;
+}
+
+/**
+ * @brief Appends the order-preserving bits of a column to composite 64-bit row keys.
+ *
+ * The existing key bits are shifted left to make room, so columns are packed from the
+ * most to the least significant. A leading null bit places the null rows before or after
+ * the valid rows, and descending columns store the complement of their value bits.
+ */
+struct pack_sort_key_fn {
+  template <typename T, std::enable_if_t<radix_sorted_order_fn::is_supported<T>()>* = nullptr>
+  void operator()(column_view const& col,
+                  bool ascending,
+                  null_order null_precedence,
+                  uint64_t* keys,
+                  cudaStream_t stream)
+  {
+    auto const d_input    = column_device_view::create(col, stream);
+    auto const d_col      = *d_input;
+    auto const value_bits = packed_value_bits(col);
+    auto const nullable   = col.has_nulls();
+    auto const width      = value_bits + (nullable ? 1 : 0);
+    auto const value_mask = value_bits == 64 ? ~uint64_t{0} : (uint64_t{1} << value_bits) - 1;
+    // Nulls compare less than any value for `null_order::BEFORE`, which a descending sort
+    // places last
+    uint64_t const null_bit = (null_precedence == null_order::BEFORE) == ascending ? 0 : 1;
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      col.size(),
+      [d_col, keys, ascending, nullable, width, value_bits, value_mask, null_bit] __device__(
+        size_type i) {
+        uint64_t const prefix = width < 64 ? keys[i] << width : 0;
+        if (nullable and d_col.is_null_nocheck(i)) {
+          keys[i] = prefix | (null_bit << value_bits);
+          return;
+        }
+        uint64_t bits = to_ordered_bits(radix_sort_key<T>::convert(d_col.element<T>(i)));
+        if (not ascending) { bits = ~bits & value_mask; }
+        if (nullable) { bits |= (1 - null_bit) << value_bits; }
+        keys[i] = prefix | bits;
+      });
+  }
+
+  template <typename T, std::enable_if_t<not radix_sorted_order_fn::is_supported<T>()>* = nullptr>
+  void operator()(column_view const&, bool, null_order, uint64_t*, cudaStream_t)
+  {
+    CUDF_FAIL("Only numeric and timestamp columns can be packed into a sort key");
+  }
+};
+
+/**
+ * @brief Packs the rows of `input` into composite keys with `pack_sort_key_fn`
+ */
+inline rmm::device_vector<uint64_t> pack_sort_keys(table_view const& input,
+                                                   std::vector<order> const& column_order,
+                                                   std::vector<null_order> const& null_precedence,
+                                                   cudaStream_t stream)
+{
+  rmm::device_vector<uint64_t> keys(input.num_rows(), 0);
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    type_dispatcher(input.column(i).type(),
+                    pack_sort_key_fn{},
+                    input.column(i),
+                    column_order.empty() or column_order[i] == order::ASCENDING,
+                    null_precedence.empty() ? null_order::BEFORE : null_precedence[i],
+                    keys.data().get(),
+                    stream);
+  }
+  return keys;
+}
+
+/**
+ * @brief Computes the sorted order of the rows of `input` by radix sorting composite
+ * keys packed with `pack_sort_key_fn`.
+ *
+ * @param key_bits The width of the packed keys, at most 64
+ */
+inline void packed_sorted_order(table_view const& input,
+                                std::vector<order> const& column_order,
+                                std::vector<null_order> const& null_precedence,
+                                int key_bits,
+                                mutable_column_view& indices,
+                                cudaStream_t stream)
+{
+  auto keys_in = pack_sort_keys(input, column_order, null_precedence, stream);
+  rmm::device_vector<uint64_t> keys_out(input.num_rows());
+  rmm::device_vector<size_type> indices_in(input.num_rows());
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), indices_in.begin(), indices_in.end(), 0);
+
+  size_t temp_storage_bytes = 0;
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(nullptr,
+                                           temp_storage_bytes,
+                                           keys_in.data().get(),
+                                           keys_out.data().get(),
+                                           indices_in.data().get(),
+                                           indices.begin<size_type>(),
+                                           input.num_rows(),
+                                           0,
+                                           key_bits,
+                                           stream));
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                           temp_storage_bytes,
+                                           keys_in.data().get(),
+                                           keys_out.data().get(),
+                                           indices_in.data().get(),
+                                           indices.begin<size_type>(),
+                                           input.num_rows(),
+                                           0,
+                                           key_bits,
+                                           stream));
+}
+
+/**
+ * @brief Compares rows of a single strings column through their `string_prefix` records,
+ * loading the strings only when the records do not settle the comparison.
+ *
+ * Orders the rows like `row_lexicographic_comparator`.
+ */
+struct string_prefix_comparator {
+  column_device_view d_strings;
+  strings::detail::string_prefix const* prefixes;
+  bool ascending;
+  null_order null_precedence;
+
+  __device__ weak_ordering compare(size_type lhs, size_type rhs) const
+  {
+    if (d_strings.nullable()) {
+      bool const lhs_is_null{d_strings.is_null_nocheck(lhs)};
+      bool const rhs_is_null{d_strings.is_null_nocheck(rhs)};
+      if (lhs_is_null and rhs_is_null) {
+        return weak_ordering::EQUIVALENT;
+      } else if (lhs_is_null) {
+        return (null_precedence == null_order::BEFORE) ? weak_ordering::LESS
+                                                       : weak_ordering::GREATER;
+      } else if (rhs_is_null) {
+        return (null_precedence == null_order::AFTER) ? weak_ordering::LESS
+                                                      : weak_ordering::GREATER;
+      }
+    }
+    auto const settled = prefixes[lhs].compare(prefixes[rhs]);
+    auto const result  = settled.second ? settled.first
+                                        : d_strings.element<string_view>(lhs).compare(
+                                           d_strings.element<string_view>(rhs));
+    return result < 0 ? weak_ordering::LESS
+                      : (result > 0 ? weak_ordering::GREATER : weak_ordering::EQUIVALENT);
+  }
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    return compare(lhs, rhs) == (ascending ? weak_ordering::LESS : weak_ordering::GREATER);
+  }
+};
+
+/**
+ * @brief Computes the sorted order of a single strings column.
+ *
+ * The valid rows are radix sorted on the first 8 bytes of their strings, the `head` of their
+ * `string_prefix` records, with the null rows placed like `radix_sorted_order_fn`. Only the runs
+ * of rows with equal first bytes are then sorted with `string_prefix_comparator`, which orders
+ * by the same `head` first, so most rows never go through a comparison sort.
+ */
+template <bool stable>
+void strings_sorted_order(column_view const& input,
+                          mutable_column_view& indices,
+                          bool ascending,
+                          null_order null_precedence,
+                          cudaStream_t stream)
+{
+  auto const null_count  = input.null_count();
+  auto const valid_count = input.size() - null_count;
+  auto const nulls_first = (null_precedence == null_order::BEFORE) == ascending;
+  auto const d_strings   = column_device_view::create(input, stream);
+  auto const d_col       = *d_strings;
+  auto const out         = indices.begin<size_type>();
+  auto const valid_out   = nulls_first ? out + null_count : out;
+  auto const prefixes    = strings::detail::create_string_prefixes(d_col, stream);
+  auto const d_prefixes  = prefixes.data().get();
+
+  rmm::device_vector<size_type> valid_indices(valid_count);
+  if (null_count > 0) {
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    nulls_first ? out : out + valid_count,
+                    [d_col] __device__(size_type i) { return d_col.is_null_nocheck(i); });
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    valid_indices.begin(),
+                    [d_col] __device__(size_type i) { return d_col.is_valid_nocheck(i); });
+  } else {
+    thrust::sequence(
+      rmm::exec_policy(stream)->on(stream), valid_indices.begin(), valid_indices.end(), 0);
+  }
+  if (valid_count == 0) { return; }
+
+  rmm::device_vector<uint64_t> keys_in(valid_count);
+  rmm::device_vector<uint64_t> keys_out(valid_count);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    valid_indices.begin(),
+                    valid_indices.end(),
+                    keys_in.begin(),
+                    [d_prefixes] __device__(size_type i) { return d_prefixes[i].head; });
+
+  auto const sort_pairs = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+    if (ascending) {
+      return cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                             temp_storage_bytes,
+                                             keys_in.data().get(),
+                                             keys_out.data().get(),
+                                             valid_indices.data().get(),
+                                             valid_out,
+                                             valid_count,
+                                             0,
+                                             64,
+                                             stream);
+    }
+    return cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     keys_in.data().get(),
+                                                     keys_out.data().get(),
+                                                     valid_indices.data().get(),
+                                                     valid_out,
+                                                     valid_count,
+                                                     0,
+                                                     64,
+                                                     stream);
+  };
+  size_t temp_storage_bytes = 0;
+  CUDA_TRY(sort_pairs(nullptr, temp_storage_bytes));
+  {
+    rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+    CUDA_TRY(sort_pairs(d_temp_storage.data(), temp_storage_bytes));
+  }
+
+  // Rows with the same first bytes as a neighbor are not ordered yet
+  auto const d_keys = keys_out.data().get();
+  rmm::device_vector<size_type> tied_positions(valid_count);
+  auto const tied_end =
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(valid_count),
+                    tied_positions.begin(),
+                    [d_keys, valid_count] __device__(size_type pos) {
+                      return (pos > 0 and d_keys[pos] == d_keys[pos - 1]) or
+                             (pos + 1 < valid_count and d_keys[pos] == d_keys[pos + 1]);
+                    });
+  auto const tied_count = thrust::distance(tied_positions.begin(), tied_end);
+  if (tied_count == 0) { return; }
+
+  // The runs stay in place since the comparator orders by the radix key first
+  rmm::device_vector<size_type> tied_rows(tied_count);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 tied_positions.begin(),
+                 tied_end,
+                 valid_out,
+                 tied_rows.begin());
+  auto const comparator = string_prefix_comparator{d_col, d_prefixes, ascending, null_precedence};
+  if (stable) {
+    thrust::stable_sort(
+      rmm::exec_policy(stream)->on(stream), tied_rows.begin(), tied_rows.end(), comparator);
+  } else {
+    thrust::sort(
+      rmm::exec_policy(stream)->on(stream), tied_rows.begin(), tied_rows.end(), comparator);
+  }
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  tied_rows.begin(),
+                  tied_rows.end(),
+                  tied_positions.begin(),
+                  valid_out);
+}
+
 // Create permuted row indices that would materialize sorted order
 template <bool stable = false>
 std::unique_ptr<column> sorted_order(table_view input,
@@ -49,11 +541,68 @@ std::unique_ptr<column> sorted_order(table_view input,
                  "Mismatch between number of columns and null_precedence size.");
   }
 
+  // The keys of a dictionary are sorted, so its rows are in the order of their indices
+  if (std::any_of(input.begin(), input.end(), [](column_view const& col) {
+        return col.type().id() == type_id::DICTIONARY32;
+      })) {
+    std::vector<column_view> columns;
+    std::transform(
+      input.begin(), input.end(), std::back_inserter(columns), [](column_view const& col) {
+        return col.type().id() == type_id::DICTIONARY32
+                 ? dictionary_column_view(col).get_indices_annotated()
+                 : col;
+      });
+    return sorted_order<stable>(table_view(columns), column_order, null_precedence, mr, stream);
+  }
+
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
 
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
 
+  // Rows that are already sorted are in the order of their indices
+  if (detail::is_sorted(input, column_order, null_precedence, stream)) {
+    thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                     mutable_indices_view.begin<size_type>(),
+                     mutable_indices_view.end<size_type>(),
+                     0);
+    return sorted_indices;
+  }
+
+  // A single fixed-width key is sorted directly by value rather than through the
+  // row comparator
+  auto const& first_column = input.column(0);
+  if (input.num_columns() == 1 and
+      (is_numeric(first_column.type()) or is_timestamp(first_column.type()))) {
+    type_dispatcher(first_column.type(),
+                    radix_sorted_order_fn{},
+                    first_column,
+                    mutable_indices_view,
+                    column_order.empty() or column_order.front() == order::ASCENDING,
+                    null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+                    stream);
+    return sorted_indices;
+  }
+
+  // A single strings key is radix sorted on its first bytes, comparing only the ties
+  if (input.num_columns() == 1 and first_column.type().id() == STRING) {
+    strings_sorted_order<stable>(
+      first_column,
+      mutable_indices_view,
+      column_order.empty() or column_order.front() == order::ASCENDING,
+      null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+      stream);
+    return sorted_indices;
+  }
+
+  // Keys that fit in 64 bits together are packed into one radix-sortable integer
+  auto const key_bits = packed_sort_key_bits(input);
+  if (key_bits > 0 and key_bits <= 64) {
+    packed_sorted_order(
+      input, column_order, null_precedence, key_bits, mutable_indices_view, stream);
+    return sorted_indices;
+  }
+
   auto device_table = table_device_view::create(input, stream);
 
   thrust::sequence(rmm::exec_policy(stream)->on(stream),
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "radix_select.hpp"
+#include "sort_impl.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/gather.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Radix-sorts the first `k` rows of `keys` in sorted order without sorting them all.
+ *
+ * The rows are packed into 64-bit keys and the `k`-th smallest key is found by radix
+ * select, one digit per pass from the most significant. The rows ordered before it, and
+ * the first of the rows equal to it, are the only ones radix sorted.
+ */
+std::unique_ptr<column> packed_top_k_order(table_view const& keys,
+                                           size_type k,
+                                           std::vector<order> const& column_order,
+                                           std::vector<null_order> const& null_precedence,
+                                           int key_bits,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  auto const num_rows = keys.num_rows();
+  auto packed_keys    = pack_sort_keys(keys, column_order, null_precedence, stream);
+  auto const d_keys   = packed_keys.data().get();
+
+  // The k-th smallest key, and how many of the keys equal to it are in the top k
+  auto const selection = radix_select(d_keys, num_rows, key_bits, {k}, stream).front();
+  auto const threshold = selection.key;
+  auto const remaining = selection.remaining;
+  auto const num_equal = selection.num_equal;
+
+  // The rows before the threshold, then the first of the rows equal to it
+  rmm::device_vector<size_type> candidates(k);
+  auto const less_end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                        thrust::make_counting_iterator<size_type>(0),
+                                        thrust::make_counting_iterator<size_type>(num_rows),
+                                        candidates.begin(),
+                                        [d_keys, threshold] __device__(size_type i) {
+                                          return d_keys[i] < threshold;
+                                        });
+  rmm::device_vector<size_type> equal(num_equal);
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  equal.begin(),
+                  [d_keys, threshold] __device__(size_type i) { return d_keys[i] == threshold; });
+  thrust::copy(
+    rmm::exec_policy(stream)->on(stream), equal.begin(), equal.begin() + remaining, less_end);
+
+  rmm::device_vector<uint64_t> keys_in(k);
+  rmm::device_vector<uint64_t> keys_out(k);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 candidates.begin(),
+                 candidates.end(),
+                 packed_keys.begin(),
+                 keys_in.begin());
+
+  auto top_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), k, mask_state::UNALLOCATED, stream, mr);
+  auto const d_top_indices  = top_indices->mutable_view().data<size_type>();
+  size_t temp_storage_bytes = 0;
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(nullptr,
+                                           temp_storage_bytes,
+                                           keys_in.data().get(),
+                                           keys_out.data().get(),
+                                           candidates.data().get(),
+                                           d_top_indices,
+                                           k,
+                                           0,
+                                           key_bits,
+                                           stream));
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                           temp_storage_bytes,
+                                           keys_in.data().get(),
+                                           keys_out.data().get(),
+                                           candidates.data().get(),
+                                           d_top_indices,
+                                           k,
+                                           0,
+                                           key_bits,
+                                           stream));
+  return top_indices;
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(k >= 0, "k must be non-negative");
+  CUDF_EXPECTS(column_order.empty() or
+                 static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or
+                 static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+               "Mismatch between number of columns and null_precedence size.");
+
+  if (k == 0 or keys.num_rows() == 0 or keys.num_columns() == 0) {
+    return cudf::make_numeric_column(data_type(type_to_id<size_type>()), 0);
+  }
+  if (k >= keys.num_rows()) {
+    return sorted_order<true>(keys, column_order, null_precedence, mr, stream);
+  }
+
+  auto const key_bits = packed_sort_key_bits(keys);
+  if (key_bits > 0 and key_bits <= 64) {
+    return packed_top_k_order(keys, k, column_order, null_precedence, key_bits, mr, stream);
+  }
+
+  // Keys that cannot be packed are fully sorted
+  auto const sorted = sorted_order<true>(
+    keys, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  auto const top    = cudf::slice(sorted->view(), {0, k}).front();
+  return std::make_unique<column>(top, stream, mr);
+}
+
+std::unique_ptr<table> top_k(table_view const& values,
+                             table_view const& keys,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+
+  auto top_order = top_k_order(keys, k, column_order, null_precedence, mr, stream);
+
+  return detail::gather(values,
+                        top_order->view(),
+                        detail::out_of_bounds_policy::NULLIFY,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        mr,
+                        stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(keys, k, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> top_k(table_view const& values,
+                             table_view const& keys,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(values, keys, k, column_order, null_precedence, mr);
+}
+
+}  // namespace cudf
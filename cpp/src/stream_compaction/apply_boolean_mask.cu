@@ -19,13 +19,20 @@
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 #include <algorithm>
+#include <functional>
 
 namespace {
 // Returns true if the mask is true and valid (non-null) for index i
@@ -50,6 +57,107 @@ struct boolean_mask_filter {
   cudf::column_device_view boolean_mask;
 };
 
+// Device representation of a `cudf::column_predicate`
+struct device_predicate {
+  cudf::column_device_view column;
+  cudf::binary_operator op;
+  void const* value;               // value of a fixed-width scalar, in device memory
+  cudf::string_view string_value;  // value of a string scalar
+};
+
+template <typename T>
+__device__ T predicate_value(device_predicate const& predicate)
+{
+  return *static_cast<T const*>(predicate.value);
+}
+
+template <>
+__device__ cudf::string_view predicate_value<cudf::string_view>(device_predicate const& predicate)
+{
+  return predicate.string_value;
+}
+
+// Compares an element of the column of a predicate with the value of the predicate
+struct compare_with_value {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return (cudf::is_fixed_width<T>() or std::is_same<T, cudf::string_view>::value) and
+           cudf::is_relationally_comparable<T, T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  __device__ bool operator()(device_predicate const& predicate, cudf::size_type i) const
+  {
+    T const lhs = predicate.column.element<T>(i);
+    T const rhs = predicate_value<T>(predicate);
+    switch (predicate.op) {
+      case cudf::binary_operator::EQUAL: return lhs == rhs;
+      case cudf::binary_operator::NOT_EQUAL: return lhs != rhs;
+      case cudf::binary_operator::LESS: return lhs < rhs;
+      case cudf::binary_operator::GREATER: return lhs > rhs;
+      case cudf::binary_operator::LESS_EQUAL: return lhs <= rhs;
+      default: return lhs >= rhs;
+    }
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  __device__ bool operator()(device_predicate const& predicate, cudf::size_type i) const
+  {
+    release_assert(false && "Unsupported predicate type");
+    return false;
+  }
+};
+
+// Returns true if element i satisfies every predicate
+// This is the filter functor for apply_predicates
+template <bool has_nulls = true>
+struct predicates_filter {
+  predicates_filter(device_predicate const* predicates, cudf::size_type num_predicates)
+    : predicates{predicates}, num_predicates{num_predicates}
+  {
+  }
+
+  __device__ inline bool operator()(cudf::size_type i)
+  {
+    for (cudf::size_type p = 0; p < num_predicates; ++p) {
+      auto const& predicate = predicates[p];
+      if (has_nulls and not predicate.column.is_valid(i)) { return false; }
+      if (not cudf::type_dispatcher(
+            predicate.column.type(), compare_with_value{}, predicate, i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ protected:
+  device_predicate const* predicates;
+  cudf::size_type num_predicates;
+};
+
+// Returns the device pointer to the value of a fixed-width scalar
+struct scalar_data_pointer {
+  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  void const* operator()(cudf::scalar const& value)
+  {
+    return static_cast<cudf::scalar_type_t<T> const&>(value).data();
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
+  void const* operator()(cudf::scalar const& value)
+  {
+    return nullptr;
+  }
+};
+
+bool is_comparison(cudf::binary_operator op)
+{
+  return op == cudf::binary_operator::EQUAL or op == cudf::binary_operator::NOT_EQUAL or
+         op == cudf::binary_operator::LESS or op == cudf::binary_operator::GREATER or
+         op == cudf::binary_operator::LESS_EQUAL or op == cudf::binary_operator::GREATER_EQUAL;
+}
+
 }  // namespace
 
 namespace cudf {
@@ -80,6 +188,64 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   }
 }
 
+/*
+ * Filters a table_view using a conjunction of comparisons of its columns with scalars.
+ *
+ * calls copy_if() with the `predicates_filter` functor, which evaluates the comparisons of
+ * every row in the filtering kernels.
+ */
+std::unique_ptr<table> apply_predicates(table_view const& input,
+                                        std::vector<column_predicate> const& predicates,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  CUDF_EXPECTS(not predicates.empty(), "No predicate to apply");
+
+  std::vector<std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>>
+    device_columns;
+  std::vector<device_predicate> h_predicates;
+  bool has_nulls = false;
+  bool is_empty  = input.num_rows() == 0;
+  for (auto const& predicate : predicates) {
+    CUDF_EXPECTS(predicate.column_index >= 0 and predicate.column_index < input.num_columns(),
+                 "Predicate column index out of range");
+    CUDF_EXPECTS(is_comparison(predicate.op), "Predicate operator must be a comparison");
+    auto const& col = input.column(predicate.column_index);
+    CUDF_EXPECTS(col.type() == predicate.value.type(),
+                 "Predicate value must have the type of its column");
+    CUDF_EXPECTS(is_fixed_width(col.type()) or col.type().id() == STRING,
+                 "Predicates are only supported on fixed-width and string columns");
+    // A comparison with a null is never true
+    is_empty  = is_empty or not predicate.value.is_valid(stream);
+    has_nulls = has_nulls or col.has_nulls();
+
+    device_columns.push_back(column_device_view::create(col, stream));
+    auto const string_value =
+      col.type().id() == STRING
+        ? static_cast<string_scalar const&>(predicate.value).value(stream)
+        : string_view{};
+    h_predicates.push_back(
+      device_predicate{*device_columns.back(),
+                       predicate.op,
+                       type_dispatcher(col.type(), scalar_data_pointer{}, predicate.value),
+                       string_value});
+  }
+  if (is_empty) { return empty_like(input); }
+
+  rmm::device_buffer d_predicates(
+    h_predicates.data(), h_predicates.size() * sizeof(device_predicate), stream);
+  auto const d_predicates_ptr = static_cast<device_predicate const*>(d_predicates.data());
+  auto const num_predicates   = static_cast<size_type>(h_predicates.size());
+
+  if (has_nulls) {
+    return detail::copy_if(
+      input, predicates_filter<true>{d_predicates_ptr, num_predicates}, mr, stream);
+  } else {
+    return detail::copy_if(
+      input, predicates_filter<false>{d_predicates_ptr, num_predicates}, mr, stream);
+  }
+}
+
 }  // namespace detail
 
 /*
@@ -92,4 +258,15 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::apply_boolean_mask(input, boolean_mask, mr);
 }
+
+/*
+ * Filters a table_view using a conjunction of comparisons of its columns with scalars.
+ */
+std::unique_ptr<table> apply_predicates(table_view const& input,
+                                        std::vector<column_predicate> const& predicates,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_predicates(input, predicates, mr);
+}
 }  // namespace cudf
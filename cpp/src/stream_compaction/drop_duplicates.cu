@@ -28,7 +28,9 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
+#include <hash/concurrent_unordered_row_set.cuh>
 
+#include <thrust/count.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/logical.h>
@@ -112,72 +114,108 @@ column_view get_unique_ordered_indices(cudf::table_view const& keys,
     keys, std::vector<order>{}, std::vector<null_order>{}, rmm::mr::get_default_resource(), stream);
 
   // extract unique indices
-  auto device_input_table = cudf::table_device_view::create(keys, stream);
+  auto const result_end = dispatch_row_equality_comparator(
+    keys,
+    keys,
+    nulls_equal == null_equality::EQUAL,
+    [&](auto comp) {
+      return unique_copy(rmm::exec_policy(stream)->on(stream),
+                         sorted_indices->view().begin<cudf::size_type>(),
+                         sorted_indices->view().end<cudf::size_type>(),
+                         unique_indices.begin<cudf::size_type>(),
+                         comp,
+                         keep);
+    },
+    stream);
 
-  if (cudf::has_nulls(keys)) {
-    auto comp = row_equality_comparator<true>(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    auto result_end = unique_copy(rmm::exec_policy(stream)->on(stream),
-                                  sorted_indices->view().begin<cudf::size_type>(),
-                                  sorted_indices->view().end<cudf::size_type>(),
-                                  unique_indices.begin<cudf::size_type>(),
-                                  comp,
-                                  keep);
+  return cudf::detail::slice(column_view(unique_indices),
+                             0,
+                             thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
+}
 
-    return cudf::detail::slice(
-      column_view(unique_indices),
-      0,
-      thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
-  } else {
-    auto comp = row_equality_comparator<false>(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    auto result_end = unique_copy(rmm::exec_policy(stream)->on(stream),
-                                  sorted_indices->view().begin<cudf::size_type>(),
-                                  sorted_indices->view().end<cudf::size_type>(),
-                                  unique_indices.begin<cudf::size_type>(),
-                                  comp,
-                                  keep);
+/**
+ * @brief Flags one row of every set of equal rows of `keys`
+ *
+ * Every row is inserted in a hash set of distinct rows, and the rows whose insertion succeeded are
+ * flagged. No sort is needed, but which row of a set of equal rows is flagged is unspecified.
+ *
+ * @param[in] d_keys      table_device_view of the rows to compare
+ * @param[in] nulls_equal flag to denote nulls are equal if null_equality::EQUAL,
+ *                        nulls are not equal if null_equality::UNEQUAL
+ * @param[in] stream      CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return `true` for the flagged rows, `false` for the other rows
+ */
+template <bool has_nulls>
+rmm::device_vector<bool> flag_distinct_rows(table_device_view const& d_keys,
+                                            null_equality nulls_equal,
+                                            cudaStream_t stream)
+{
+  using hasher_type   = row_hasher<default_hash, has_nulls>;
+  using equality_type = row_equality_comparator<has_nulls>;
+  concurrent_unordered_row_set<hasher_type, equality_type> distinct_rows(
+    d_keys.num_rows(),
+    hasher_type{d_keys},
+    equality_type{d_keys, d_keys, nulls_equal == null_equality::EQUAL},
+    stream);
 
-    return cudf::detail::slice(
-      column_view(unique_indices),
-      0,
-      thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
-  }
+  rmm::device_vector<bool> is_distinct(d_keys.num_rows());
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     d_keys.num_rows(),
+                     [set = distinct_rows.view(), flags = is_distinct.data().get()] __device__(
+                       size_type i) { flags[i] = set.insert(i); });
+  return is_distinct;
+}
+
+rmm::device_vector<bool> flag_distinct_rows(table_view const& keys,
+                                            null_equality nulls_equal,
+                                            cudaStream_t stream)
+{
+  auto const d_keys = table_device_view::create(keys, stream);
+  return cudf::has_nulls(keys) ? flag_distinct_rows<true>(*d_keys, nulls_equal, stream)
+                               : flag_distinct_rows<false>(*d_keys, nulls_equal, stream);
+}
+
+/**
+ * @brief Create a column_view of the indices of one row of every set of equal rows of `keys`
+ *
+ * The indices are in ascending order, so that the rows keep their relative order in the input.
+ *
+ * @param[in] keys            table_view to identify duplicate rows
+ * @param[out] unique_indices Column to store the index with unique rows
+ * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL,
+ *                            nulls are not equal if null_equality::UNEQUAL
+ * @param[in] stream          CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return column_view column_view of unique row index, this is actually slice of
+ * `unique_indices`.
+ */
+column_view get_unique_hashed_indices(cudf::table_view const& keys,
+                                      cudf::mutable_column_view& unique_indices,
+                                      null_equality nulls_equal,
+                                      cudaStream_t stream = 0)
+{
+  auto const is_distinct = flag_distinct_rows(keys, nulls_equal, stream);
+  auto const result_end  = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                          thrust::make_counting_iterator<size_type>(0),
+                                          thrust::make_counting_iterator(keys.num_rows()),
+                                          is_distinct.begin(),
+                                          unique_indices.begin<cudf::size_type>(),
+                                          thrust::identity<bool>{});
+  return cudf::detail::slice(column_view(unique_indices),
+                             0,
+                             thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
 }
 
 cudf::size_type unique_count(table_view const& keys,
                              null_equality nulls_equal = null_equality::EQUAL,
                              cudaStream_t stream       = 0)
 {
-  // sort only indices
-  auto sorted_indices = sorted_order(
-    keys, std::vector<order>{}, std::vector<null_order>{}, rmm::mr::get_default_resource(), stream);
-
-  // count unique elements
-  auto sorted_row_index   = sorted_indices->view().data<cudf::size_type>();
-  auto device_input_table = cudf::table_device_view::create(keys, stream);
-
-  if (cudf::has_nulls(keys)) {
-    row_equality_comparator<true> comp(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
-  } else {
-    row_equality_comparator<false> comp(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
-  }
+  // counting does not need the rows to be ordered, so hash them instead of sorting them
+  auto const is_distinct = flag_distinct_rows(keys, nulls_equal, stream);
+  return thrust::count(
+    rmm::exec_policy(stream)->on(stream), is_distinct.begin(), is_distinct.end(), true);
 }
 
 std::unique_ptr<table> drop_duplicates(table_view const& input,
@@ -199,8 +237,12 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
   auto mutable_unique_indices_view = unique_indices->mutable_view();
   // This is just slice of `unique_indices` but with different size as per the
   // keys_view has been processed in `get_unique_ordered_indices`
-  auto unique_indices_view = detail::get_unique_ordered_indices(
-    keys_view, mutable_unique_indices_view, keep, nulls_equal, stream);
+  auto unique_indices_view =
+    keep == duplicate_keep_option::KEEP_ANY
+      ? detail::get_unique_hashed_indices(
+          keys_view, mutable_unique_indices_view, nulls_equal, stream)
+      : detail::get_unique_ordered_indices(
+          keys_view, mutable_unique_indices_view, keep, nulls_equal, stream);
 
   // run gather operation to establish new order
   return detail::gather(input,
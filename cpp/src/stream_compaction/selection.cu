@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/selection.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/selection.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+selection::selection(column_view const& rows)
+  : _rows{rows}, _kind{rows.type().id() == BOOL8 ? kind::BOOLEAN_MASK : kind::INDICES}
+{
+  CUDF_EXPECTS(rows.type().id() == BOOL8 or rows.type().id() == type_to_id<size_type>(),
+               "Selection must be an INT32 column of indices or a BOOL8 mask");
+  CUDF_EXPECTS(_kind == kind::BOOLEAN_MASK or not rows.has_nulls(),
+               "Selection indices must not have nulls");
+}
+
+namespace detail {
+namespace {
+// Returns true if row i is non-null and true in a boolean mask
+struct boolean_mask_selected {
+  column_device_view mask;
+
+  __device__ bool operator()(size_type i) const
+  {
+    return mask.is_valid(i) and mask.element<bool>(i);
+  }
+};
+
+// Returns true if row i is flagged
+struct flag_selected {
+  bool const* flags;
+
+  __device__ bool operator()(size_type i) const { return flags[i]; }
+};
+
+/**
+ * @brief Builds the null mask of `input` where the rows that are not selected are also null
+ *
+ * The mask is indexed like the null mask of `input`: row `i` is the bit `input.offset() + i`, so
+ * that it can replace the null mask of `input` in a view of the same data.
+ */
+template <typename IsSelected>
+rmm::device_buffer selected_null_mask(column_view const& input,
+                                      IsSelected is_selected,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  auto const begin_bit = input.offset();
+  auto const end_bit   = input.offset() + input.size();
+  rmm::device_buffer null_mask(bitmask_allocation_size_bytes(end_bit), stream, mr);
+  auto const d_input = column_device_view::create(input, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_bitmask_words(end_bit),
+    [mask = static_cast<bitmask_type*>(null_mask.data()),
+     d_input = *d_input,
+     is_selected,
+     begin_bit,
+     end_bit] __device__(size_type word_index) {
+      bitmask_type word = 0;
+      for (size_type b = 0; b < static_cast<size_type>(size_in_bits<bitmask_type>()); ++b) {
+        auto const bit = word_index * static_cast<size_type>(size_in_bits<bitmask_type>()) + b;
+        if (bit >= begin_bit and bit < end_bit and d_input.is_valid(bit - begin_bit) and
+            is_selected(bit - begin_bit)) {
+          word |= bitmask_type{1} << b;
+        }
+      }
+      mask[word_index] = word;
+    });
+  return null_mask;
+}
+
+}  // namespace
+
+selected_column mask_unselected_rows(column_view const& input,
+                                     selection const& rows,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  rmm::device_buffer null_mask;
+  if (rows.type() == selection::kind::BOOLEAN_MASK) {
+    CUDF_EXPECTS(rows.rows().size() == input.size(), "Selection mask and input size mismatch");
+    auto const d_rows = column_device_view::create(rows.rows(), stream);
+    null_mask         = selected_null_mask(input, boolean_mask_selected{*d_rows}, mr, stream);
+  } else {
+    // Flag the selected rows first, so that every word of the mask is built by one thread
+    rmm::device_vector<bool> flags(input.size(), false);
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       rows.rows().begin<size_type>(),
+                       rows.rows().size(),
+                       [flags = flags.data().get(), size = input.size()] __device__(size_type i) {
+                         if (i >= 0 and i < size) { flags[i] = true; }
+                       });
+    null_mask = selected_null_mask(input, flag_selected{flags.data().get()}, mr, stream);
+  }
+
+  auto const view = column_view(input.type(),
+                                input.size(),
+                                input.head(),
+                                static_cast<bitmask_type const*>(null_mask.data()),
+                                UNKNOWN_NULL_COUNT,
+                                input.offset(),
+                                std::vector<column_view>(input.child_begin(), input.child_end()));
+  return selected_column{std::move(null_mask), view};
+}
+
+std::unique_ptr<table> apply_selection(table_view const& input,
+                                       selection const& rows,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  if (rows.type() == selection::kind::BOOLEAN_MASK) {
+    CUDF_EXPECTS(rows.rows().size() == input.num_rows(), "Selection mask and input size mismatch");
+    return detail::apply_boolean_mask(input, rows.rows(), mr, stream);
+  }
+  return detail::gather(input,
+                        rows.rows(),
+                        out_of_bounds_policy::NULLIFY,
+                        negative_index_policy::NOT_ALLOWED,
+                        mr,
+                        stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> apply_selection(table_view const& input,
+                                       selection const& rows,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_selection(input, rows, mr);
+}
+
+}  // namespace cudf
@@ -33,30 +33,28 @@ namespace strings {
 namespace detail {
 namespace {
 /**
- * @brief Used as template parameter to divide size calculation from
- * the actual string operation within a function.
+ * @brief Largest ratio of the size in bytes of a converted character to its own size.
  *
- * Useful when most of the logic is identical for both passes.
+ * Reached by the special case mappings, such as U+0390 whose 2 bytes convert
+ * to 3 characters of 2 bytes each. Other mappings at most change 2 bytes to 3.
  */
-enum TwoPass {
-  SizeOnly = 0,  ///< calculate the size only
-  ExecuteOp      ///< run the string operation
-};
+constexpr size_type max_case_conversion_expansion{3};
 
 /**
  * @brief Per string logic for case conversion functions.
  *
- * @tparam Pass Determines if size calculation or output write is begin performed.
+ * Only the size of each output string is computed while `d_chars` is null;
+ * otherwise the string is also written. Both return the size in bytes.
  */
-template <TwoPass Pass = SizeOnly>
 struct upper_lower_fn {
   const column_device_view d_column;
   character_flags_table_type case_flag;  // flag to check with on each character
   const character_flags_table_type* d_flags;
   const character_cases_table_type* d_case_table;
   const special_case_mapping* d_special_case_mapping;
-  const int32_t* d_offsets{};
-  char* d_chars{};
+  bool const ascii;  // all characters are ASCII
+  const int32_t* d_offsets{};  // these are null when
+  char* d_chars{};             // only computing size
 
   __device__ special_case_mapping get_special_case_mapping(uint32_t code_point)
   {
@@ -74,7 +72,7 @@ struct upper_lower_fn {
     auto const count  = IS_LOWER(flag) ? m.num_upper_chars : m.num_lower_chars;
     auto const* chars = IS_LOWER(flag) ? m.upper : m.lower;
     for (uint16_t idx = 0; idx < count; idx++) {
-      if (Pass == SizeOnly) {
+      if (d_buffer == nullptr) {
         bytes += detail::bytes_in_char_utf8(detail::codepoint_to_utf8(chars[idx]));
       } else {
         bytes += detail::from_char_utf8(detail::codepoint_to_utf8(chars[idx]), d_buffer + bytes);
@@ -90,7 +88,19 @@ struct upper_lower_fn {
     string_view d_str = d_column.template element<string_view>(idx);
     int32_t bytes     = 0;
     char* d_buffer    = nullptr;
-    if (Pass == ExecuteOp) d_buffer = d_chars + d_offsets[idx];
+    if (d_chars) d_buffer = d_chars + d_offsets[idx];
+    if (ascii) {
+      // ASCII characters have no special case mapping and convert to ASCII characters,
+      // so the bytes are converted in place of the characters
+      if (d_buffer) {
+        auto const d_bytes = reinterpret_cast<unsigned char const*>(d_str.data());
+        for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+          auto const byte = d_bytes[i];
+          d_buffer[i] = static_cast<char>((d_flags[byte] & case_flag) ? d_case_table[byte] : byte);
+        }
+      }
+      return d_str.size_bytes();
+    }
     for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
       uint32_t code_point                     = detail::utf8_to_codepoint(*itr);
       detail::character_flags_table_type flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
@@ -102,16 +112,16 @@ struct upper_lower_fn {
       if (IS_SPECIAL(flag) && ((flag & case_flag) || !IS_UPPER_OR_LOWER(flag))) {
         bytes += handle_special_case_bytes(code_point, d_buffer, case_flag);
       } else if (flag & case_flag) {
-        if (Pass == SizeOnly)
-          bytes += detail::bytes_in_char_utf8(detail::codepoint_to_utf8(d_case_table[code_point]));
-        else
-          d_buffer +=
-            detail::from_char_utf8(detail::codepoint_to_utf8(d_case_table[code_point]), d_buffer);
+        auto const chr = detail::codepoint_to_utf8(d_case_table[code_point]);
+        auto const chr_bytes =
+          d_buffer ? detail::from_char_utf8(chr, d_buffer) : detail::bytes_in_char_utf8(chr);
+        if (d_buffer) d_buffer += chr_bytes;
+        bytes += chr_bytes;
       } else {
-        if (Pass == SizeOnly)
-          bytes += detail::bytes_in_char_utf8(*itr);
-        else
-          d_buffer += detail::from_char_utf8(*itr, d_buffer);
+        auto const chr_bytes =
+          d_buffer ? detail::from_char_utf8(*itr, d_buffer) : detail::bytes_in_char_utf8(*itr);
+        if (d_buffer) d_buffer += chr_bytes;
+        bytes += chr_bytes;
       }
     }
     return bytes;
@@ -136,7 +146,6 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
   auto strings_count = strings.size();
   if (strings_count == 0) return detail::make_empty_strings_column(mr, stream);
 
-  auto execpol         = rmm::exec_policy(stream);
   auto strings_column  = column_device_view::create(strings.parent(), stream);
   auto d_column        = *strings_column;
   size_type null_count = strings.null_count();
@@ -148,33 +157,30 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
 
   auto d_case_table           = get_character_cases_table();
   auto d_special_case_mapping = get_special_case_mapping_table();
-
-  // build offsets column -- calculate the size of each output string
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0),
-    upper_lower_fn<SizeOnly>{d_column, case_flag, d_flags, d_case_table, d_special_case_mapping});
-  auto offsets_column = detail::make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
-  auto offsets_view  = offsets_column->view();
-  auto d_new_offsets = offsets_view.data<int32_t>();
-
-  // build the chars column -- convert characters based on case_flag parameter
-  size_type bytes = thrust::device_pointer_cast(d_new_offsets)[strings_count];
-  auto chars_column =
-    strings::detail::create_chars_child_column(strings_count, null_count, bytes, mr, stream);
-  auto chars_view = chars_column->mutable_view();
-  auto d_chars    = chars_view.data<char>();
-
-  thrust::for_each_n(
-    execpol->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    strings_count,
-    upper_lower_fn<ExecuteOp>{
-      d_column, case_flag, d_flags, d_case_table, d_special_case_mapping, d_new_offsets, d_chars});
+  auto const ascii            = is_ascii(strings, stream);
+
+  upper_lower_fn converter{
+    d_column, case_flag, d_flags, d_case_table, d_special_case_mapping, ascii};
+  // converting ASCII strings keeps their sizes, so computing them is cheap;
+  // other strings are converted once, into space for the largest expansion
+  auto children =
+    ascii ? make_strings_children(converter, strings_count, null_count, mr, stream)
+          : make_strings_children(
+              converter,
+              [d_column] __device__(size_type idx) {
+                return d_column.is_null(idx)
+                         ? 0
+                         : max_case_conversion_expansion *
+                             d_column.element<string_view>(idx).size_bytes();
+              },
+              strings_count,
+              null_count,
+              mr,
+              stream);
   //
   return make_strings_column(strings_count,
-                             std::move(offsets_column),
-                             std::move(chars_column),
+                             std::move(children.first),
+                             std::move(children.second),
                              null_count,
                              std::move(null_mask),
                              stream,
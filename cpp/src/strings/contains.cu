@@ -18,14 +18,18 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/regex/dfa.cuh>
 #include <strings/regex/regex.cuh>
 #include <strings/utilities.hpp>
 
+#include <algorithm>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -55,13 +59,72 @@ struct contains_fn {
     u_char data1[stack_size], data2[stack_size];
     prog.set_stack_mem(data1, data2);
     string_view d_str = d_strings.element<string_view>(idx);
-    int32_t begin     = 0;
-    int32_t end       = bmatch ? 1  // match only the beginning of the string;
-                         : -1;      // this handles empty strings too
+    if (!prog.may_match(d_str)) return false;
+    int32_t begin = 0;
+    int32_t end   = bmatch ? 1  // match only the beginning of the string;
+                     : -1;      // this handles empty strings too
     return static_cast<bool>(prog.find(idx, d_str, begin, end));
   }
 };
 
+/**
+ * @brief Evaluates a regex DFA on each string of an ASCII strings column.
+ *
+ * Each block first copies the transition table into shared memory when it fits.
+ *
+ * @param dfa DFA of the regex pattern.
+ * @param d_strings Strings to evaluate.
+ * @param use_shared_memory Whether the dynamic shared memory holds the transition table.
+ * @param d_results Whether the pattern matches each string.
+ */
+__global__ void dfa_contains_kernel(redfa_device const dfa,
+                                    column_device_view const d_strings,
+                                    bool use_shared_memory,
+                                    bool* d_results)
+{
+  extern __shared__ uint16_t shared_transitions[];
+  auto table = dfa.transitions;
+  if (use_shared_memory) {
+    for (std::size_t idx = threadIdx.x; idx < dfa.transitions_count; idx += blockDim.x)
+      shared_transitions[idx] = dfa.transitions[idx];
+    __syncthreads();
+    table = shared_transitions;
+  }
+  for (size_type idx = threadIdx.x + blockIdx.x * blockDim.x; idx < d_strings.size();
+       idx += blockDim.x * gridDim.x)
+    d_results[idx] =
+      !d_strings.is_null(idx) && dfa.is_match(d_strings.element<string_view>(idx), table);
+}
+
+/**
+ * @brief Fills `d_results` by evaluating a regex DFA on each string.
+ */
+void dfa_contains(redfa_device const& dfa,
+                  column_device_view const& d_strings,
+                  bool* d_results,
+                  cudaStream_t stream)
+{
+  constexpr int block_size{256};
+  constexpr std::size_t max_shared_memory_size{48 * 1024};
+  auto const table_size        = dfa.transitions_count * sizeof(uint16_t);
+  bool const use_shared_memory = table_size <= max_shared_memory_size;
+  std::size_t const shared_memory_size{use_shared_memory ? table_size : 0};
+
+  int num_blocks{-1};
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &num_blocks, dfa_contains_kernel, block_size, shared_memory_size));
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+  // fewer blocks than strings amortize copying the table
+  auto const grid_size =
+    std::min(num_blocks * num_sms, util::div_rounding_up_safe(d_strings.size(), block_size));
+  dfa_contains_kernel<<<grid_size, block_size, shared_memory_size, stream>>>(
+    dfa, d_strings, use_shared_memory, d_results);
+  CHECK_CUDA(stream);
+}
+
 //
 std::unique_ptr<column> contains_util(
   strings_column_view const& strings,
@@ -74,10 +137,6 @@ std::unique_ptr<column> contains_util(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
-
   // create the output column
   auto results   = make_numeric_column(data_type{BOOL8},
                                      strings_count,
@@ -87,27 +146,40 @@ std::unique_ptr<column> contains_util(
                                      mr);
   auto d_results = results->mutable_view().data<bool>();
 
+  // ASCII strings are evaluated with a DFA when the pattern compiles into one
+  if ((strings_count > 0) && is_ascii(strings, stream)) {
+    auto const dfa = redfa::create(pattern, get_character_flags_table(), beginning_only, stream);
+    if (dfa) {
+      dfa_contains(dfa->view(), d_column, d_results, stream);
+      results->set_null_count(strings.null_count());
+      return results;
+    }
+  }
+
+  // compile regex into device object
+  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+  auto d_prog = *prog;
+
   // fill the output column
-  auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
   if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_results,
+                   contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only},
+                   stream);
   else if (regex_insts <= RX_MEDIUM_INSTS)
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_results,
+                   contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only},
+                   stream);
   else
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_results,
+                   contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only},
+                   stream);
 
   results->set_null_count(strings.null_count());
   return results;
@@ -169,7 +241,8 @@ struct count_fn {
     u_char data1[stack_size], data2[stack_size];
     prog.set_stack_mem(data1, data2);
     if (d_strings.is_null(idx)) return 0;
-    string_view d_str  = d_strings.element<string_view>(idx);
+    string_view d_str = d_strings.element<string_view>(idx);
+    if (!prog.may_match(d_str)) return 0;
     int32_t find_count = 0;
     size_type nchars   = d_str.length();
     size_type begin    = 0;
@@ -209,26 +282,25 @@ std::unique_ptr<column> count_re(
   auto d_results = results->mutable_view().data<int32_t>();
 
   // fill the output column
-  auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
   if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      count_fn<RX_STACK_SMALL>{d_prog, d_column});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_results,
+                   count_fn<RX_STACK_SMALL>{d_prog, d_column},
+                   stream);
   else if (regex_insts <= RX_MEDIUM_INSTS)
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      count_fn<RX_STACK_MEDIUM>{d_prog, d_column});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_results,
+                   count_fn<RX_STACK_MEDIUM>{d_prog, d_column},
+                   stream);
   else
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      count_fn<RX_STACK_LARGE>{d_prog, d_column});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_results,
+                   count_fn<RX_STACK_LARGE>{d_prog, d_column},
+                   stream);
 
   results->set_null_count(strings.null_count());
   return results;
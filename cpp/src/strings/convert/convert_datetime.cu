@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -29,6 +30,7 @@
 #include <strings/utilities.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -91,6 +93,19 @@ struct alignas(4) format_item {
   }
 };
 
+/**
+ * @brief Byte positions of the timestamp components in a fixed-width format.
+ *
+ * Formats such as `%Y-%m-%d %H:%M:%S` have each component at the same position in every
+ * string so they can be read directly instead of walking the format_items.
+ */
+struct fixed_format {
+  int16_t offsets[TP_ARRAYSIZE]{};  // position of each component
+  int8_t lengths[TP_ARRAYSIZE]{};   // zero if the component is not in the format
+  int16_t bytes{};                  // total size of the format
+  bool two_digit_year{false};       // year is %y
+};
+
 /**
  * @brief The format_compiler parses a timestamp format string into a vector of
  * format_items.
@@ -118,11 +133,13 @@ struct format_compiler {
                                               {'p', 2},
                                               {'j', 3}};
 
+  std::vector<format_item> items;
+
   format_compiler(const char* format, timestamp_units units) : format(format), units(units) {}
 
   format_item const* compile_to_device()
   {
-    std::vector<format_item> items;
+    items.clear();
     const char* str = format.c_str();
     auto length     = format.length();
     while (length > 0) {
@@ -167,6 +184,47 @@ struct format_compiler {
   size_type template_bytes() const { return static_cast<size_type>(template_string.size()); }
   size_type items_count() const { return static_cast<size_type>(d_items.size()); }
   int8_t subsecond_precision() const { return specifier_lengths.at('f'); }
+
+  /**
+   * @brief Computes the position of each component if the format only has literals and
+   * fixed-width numeric specifiers.
+   *
+   * @param[out] fixed The component positions.
+   * @return false if the format has other specifiers.
+   */
+  bool fixed_positions(fixed_format& fixed) const
+  {
+    fixed              = fixed_format{};
+    size_type position = 0;
+    for (auto const& item : items) {
+      if (item.item_type == format_char_type::specifier) {
+        int component = -1;
+        switch (item.value) {
+          case 'Y':
+          case 'y': component = TP_YEAR; break;
+          case 'm': component = TP_MONTH; break;
+          case 'd': component = TP_DAY; break;
+          case 'j': component = TP_DAY_OF_YEAR; break;
+          case 'H':
+          case 'I': component = TP_HOUR; break;
+          case 'M': component = TP_MINUTE; break;
+          case 'S': component = TP_SECOND; break;
+          case 'f': component = TP_SUBSECOND; break;
+          case 'Z': break;  // skipped
+          default: return false;
+        }
+        if (component >= 0) {
+          fixed.offsets[component] = static_cast<int16_t>(position);
+          fixed.lengths[component] = item.length;
+          if (component == TP_YEAR) fixed.two_digit_year = (item.value == 'y');
+        }
+      }
+      position += item.length;
+    }
+    if (position > std::numeric_limits<int16_t>::max()) return false;
+    fixed.bytes = static_cast<int16_t>(position);
+    return true;
+  }
 };
 
 // this parses date/time characters into a timestamp integer
@@ -311,6 +369,37 @@ struct parse_datetime {
   }
 };
 
+/**
+ * @brief Parses date/time strings with a fixed-width format into timestamp integers.
+ *
+ * Each component is read from its fixed position. Strings with a component that is not all
+ * digits are parsed with the general format_items walk instead to produce the same result.
+ */
+template <typename T>  // timestamp type
+struct parse_fixed_datetime {
+  parse_datetime<T> parser;
+  fixed_format format;
+
+  __device__ T operator()(size_type idx)
+  {
+    if (parser.d_strings.is_null(idx)) return 0;
+    string_view d_str = parser.d_strings.element<string_view>(idx);
+    if (d_str.size_bytes() < format.bytes) return 0;  // too short for the format; also empty
+    //
+    int32_t timeparts[TP_ARRAYSIZE] = {0, 1, 1};  // month and day are 1-based
+    for (int component = 0; component < TP_ARRAYSIZE; ++component) {
+      if (format.lengths[component] == 0) continue;
+      auto const value = cudf::detail::parse_fixed_digits(d_str.data() + format.offsets[component],
+                                                          format.lengths[component]);
+      if (value < 0) return parser(idx);
+      timeparts[component] = value;
+    }
+    if (format.two_digit_year) timeparts[TP_YEAR] += 1900;
+    //
+    return static_cast<T>(parser.timestamp_from_parts(timeparts, parser.units));
+  }
+};
+
 // convert cudf type to timestamp units
 struct dispatch_timestamp_to_units_fn {
   template <typename T>
@@ -360,6 +449,15 @@ struct dispatch_to_timestamps_fn {
     auto d_results = results_view.data<T>();
     parse_datetime<T> pfn{
       d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision()};
+    fixed_format fixed;
+    if (compiler.fixed_positions(fixed)) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(results_view.size()),
+                        d_results,
+                        parse_fixed_datetime<T>{pfn, fixed});
+      return;
+    }
     thrust::transform(rmm::exec_policy(stream)->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(results_view.size()),
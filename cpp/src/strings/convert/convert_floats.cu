@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -64,7 +65,18 @@ __device__ inline double stod(string_view const& d_str)
   unsigned long digits       = 0;
   int exp_off                = 0;
   bool decimal               = false;
+  // digits that cannot reach max_mantissa are consumed eight at a time
+  unsigned long const max_chunk_digits = (max_mantissa - 99999999) / 100000000;
   while (in_ptr < end) {
+    if ((digits <= max_chunk_digits) && (end - in_ptr >= 8)) {
+      auto const chars = cudf::detail::load_eight_chars(in_ptr);
+      if (cudf::detail::is_eight_digits(chars)) {
+        digits = (digits * 100000000L) + cudf::detail::parse_eight_digits(chars);
+        exp_off -= 8 * (int)decimal;
+        in_ptr += 8;
+        continue;
+      }
+    }
     char ch = *in_ptr;
     if (ch == '.') {
       decimal = true;
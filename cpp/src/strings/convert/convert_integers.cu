@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/parse_digits.cuh>
 #include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -51,6 +52,7 @@ struct string_to_integer_fn {
    * The string is expected to contain base-10 [0-9] characters only.
    * Any other character will end the parse.
    * Overflow of the int64 type is not detected.
+   * The digits are parsed eight at a time where possible.
    */
   __device__ int64_t string_to_integer(string_view const& d_str)
   {
@@ -64,11 +66,7 @@ struct string_to_integer_fn {
       ++ptr;
       --bytes;
     }
-    for (size_type idx = 0; idx < bytes; ++idx) {
-      char chr = *ptr++;
-      if (chr < '0' || chr > '9') break;
-      value = (value * 10) + static_cast<int64_t>(chr - '0');
-    }
+    cudf::detail::parse_digits(ptr, ptr + bytes, value);
     return value * static_cast<int64_t>(sign);
   }
 
@@ -247,16 +245,19 @@ struct integer_to_string_fn {
     }
     bool is_negative = std::is_signed<IntegerType>::value ? (value < 0) : false;
     //
-    constexpr IntegerType base = 10;
-    constexpr int MAX_DIGITS   = 20;  // largest 64-bit integer is 20 digits
-    char digits[MAX_DIGITS];          // place-holder for digit chars
+    constexpr IntegerType base = 100;  // two digits per division
+    constexpr int MAX_DIGITS   = 20;   // largest 64-bit integer is 20 digits
+    char digits[MAX_DIGITS];           // place-holder for digit chars
     int digits_idx = 0;
     while (value != 0) {
       assert(digits_idx < MAX_DIGITS);
-      digits[digits_idx++] = '0' + cudf::util::absolute_value(value % base);
-      // next digit
+      auto const pair      = cudf::util::absolute_value(value % base);
+      digits[digits_idx++] = '0' + (pair % 10);
+      digits[digits_idx++] = '0' + (pair / 10);
+      // next two digits
       value = value / base;
     }
+    if (digits[digits_idx - 1] == '0') --digits_idx;  // no leading zero
     char* ptr = d_buffer;
     if (is_negative) *ptr++ = '-';
     // digits are backwards, reverse the string into the output
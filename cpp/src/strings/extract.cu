@@ -52,6 +52,7 @@ struct extract_fn {
     if (d_strings.is_null(idx)) return string_index_pair{nullptr, 0};
     string_view d_str = d_strings.element<string_view>(idx);
     string_index_pair result{nullptr, 0};
+    if (!prog.may_match(d_str)) return result;
     int32_t begin = 0;
     int32_t end   = -1;  // handles empty strings automatically
     if ((prog.find(idx, d_str, begin, end) > 0) &&
@@ -86,30 +87,29 @@ std::unique_ptr<table> extract(
 
   // build a result column for each group
   std::vector<std::unique_ptr<column>> results;
-  auto execpol     = rmm::exec_policy(stream);
   auto regex_insts = d_prog.insts_counts();
   for (int32_t column_index = 0; column_index < groups; ++column_index) {
     rmm::device_vector<string_index_pair> indices(strings_count);
     string_index_pair* d_indices = indices.data().get();
 
     if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        extract_fn<RX_STACK_SMALL>{d_prog, d_strings, column_index});
+      transform_rows(d_prog,
+                     strings_count,
+                     d_indices,
+                     extract_fn<RX_STACK_SMALL>{d_prog, d_strings, column_index},
+                     stream);
     else if (regex_insts <= RX_MEDIUM_INSTS)
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        extract_fn<RX_STACK_MEDIUM>{d_prog, d_strings, column_index});
+      transform_rows(d_prog,
+                     strings_count,
+                     d_indices,
+                     extract_fn<RX_STACK_MEDIUM>{d_prog, d_strings, column_index},
+                     stream);
     else
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        extract_fn<RX_STACK_LARGE>{d_prog, d_strings, column_index});
+      transform_rows(d_prog,
+                     strings_count,
+                     d_indices,
+                     extract_fn<RX_STACK_LARGE>{d_prog, d_strings, column_index},
+                     stream);
     //
     results.emplace_back(make_strings_column(indices, stream, mr));
   }
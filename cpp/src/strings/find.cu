@@ -23,6 +23,8 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <strings/utilities.cuh>
+#include <strings/warp_utilities.cuh>
 
 #include <thrust/transform.h>
 
@@ -30,12 +32,62 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+/**
+ * @brief Kernel locating `d_target` in each string of a strings column using
+ * one warp per string.
+ *
+ * The positions have the same semantics as `string_view::find` and
+ * `string_view::rfind` with `start` and `stop` clamped as in `find` and `rfind`.
+ *
+ * @tparam forward Return the first match if true, the last one otherwise.
+ *
+ * @param d_strings Strings to search.
+ * @param d_target Non-empty string to search for.
+ * @param start First character position to start the search.
+ * @param stop Last character position (exclusive) to end the search.
+ * @param ascii Whether the strings are known to be ASCII.
+ * @param d_results Character position of the match within each string, or -1.
+ */
+template <bool forward>
+__global__ void find_warp_parallel_fn(column_device_view const d_strings,
+                                      string_view const d_target,
+                                      size_type start,
+                                      size_type stop,
+                                      bool ascii,
+                                      int32_t* d_results)
+{
+  auto const idx = static_cast<size_type>((threadIdx.x + blockIdx.x * blockDim.x) /
+                                          cudf::detail::warp_size);
+  if (idx >= d_strings.size()) return;
+  auto const lane = threadIdx.x % cudf::detail::warp_size;
+  if (d_strings.is_null(idx)) {
+    if (lane == 0) d_results[idx] = -1;
+    return;
+  }
+  auto const d_str  = d_strings.element<string_view>(idx);
+  auto const length = ascii ? d_str.size_bytes() : warp_count_characters(d_str, d_str.size_bytes());
+  auto const begin  = (start > length) ? length : start;
+  auto end          = (stop < 0) || (stop > length) ? length : stop;
+  // a negative count searches to the end of the string in string_view::find
+  if (forward && (end < begin)) end = length;
+  auto const spos = ascii ? begin : warp_byte_offset(d_str, begin);
+  auto const epos = ascii ? end : warp_byte_offset(d_str, end);
+  auto const position =
+    forward ? warp_find(d_str, d_target, spos, epos) : warp_rfind(d_str, d_target, spos, epos);
+  auto const result =
+    (position < 0) || ascii ? position : warp_count_characters(d_str, position);
+  if (lane == 0) d_results[idx] = static_cast<int32_t>(result);
+}
+
 /**
  * @brief Utility to return integer column indicating the postion of
  * target string within each string in a strings column.
  *
  * Null string entries return corresponding null output column entries.
  *
+ * Columns of long strings are searched with a warp per string.
+ *
+ * @tparam forward Whether `pfn` finds the first match rather than the last one.
  * @tparam FindFunction Returns integer character position value given a string and target.
  *
  * @param strings Strings column to search for target.
@@ -47,7 +99,7 @@ namespace {
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New integer column with character position values.
  */
-template <typename FindFunction>
+template <bool forward, typename FindFunction>
 std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 string_scalar const& target,
                                 size_type start,
@@ -64,6 +116,7 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
   auto strings_count  = strings.size();
+  auto const ascii    = is_ascii(strings, stream);
   // create output column
   auto results      = make_numeric_column(data_type{INT32},
                                      strings_count,
@@ -73,16 +126,26 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
+  if ((strings_count > 0) && (target.size() > 0) &&
+      (average_string_bytes(strings, stream) >= warp_per_string_threshold)) {
+    constexpr size_type block_size{256};
+    constexpr size_type warps_per_block{block_size / cudf::detail::warp_size};
+    auto const num_blocks = (strings_count + warps_per_block - 1) / warps_per_block;
+    find_warp_parallel_fn<forward><<<num_blocks, block_size, 0, stream>>>(
+      d_strings, d_target, start, stop, ascii, d_results);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
   // set the position values by evaluating the passed function
   thrust::transform(rmm::exec_policy(stream)->on(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(strings_count),
                     d_results,
-                    [d_strings, pfn, d_target, start, stop] __device__(size_type idx) {
+                    [d_strings, pfn, d_target, start, stop, ascii] __device__(size_type idx) {
                       int32_t position = -1;
                       if (!d_strings.is_null(idx))
                         position = static_cast<int32_t>(
-                          pfn(d_strings.element<string_view>(idx), d_target, start, stop));
+                          pfn(string_at(d_strings, idx, ascii), d_target, start, stop));
                       return position;
                     });
   results->set_null_count(strings.null_count());
@@ -107,7 +170,7 @@ std::unique_ptr<column> find(strings_column_view const& strings,
     return d_string.find(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn<true>(strings, target, start, stop, pfn, mr, stream);
 }
 
 std::unique_ptr<column> rfind(strings_column_view const& strings,
@@ -126,7 +189,7 @@ std::unique_ptr<column> rfind(strings_column_view const& strings,
     return d_string.rfind(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn<false>(strings, target, start, stop, pfn, mr, stream);
 }
 
 }  // namespace detail
@@ -155,6 +218,64 @@ std::unique_ptr<column> rfind(strings_column_view const& strings,
 
 namespace detail {
 namespace {
+/**
+ * @brief Kernel checking for `d_target` in each string of a strings column
+ * using one warp per string.
+ *
+ * @param d_strings Strings to search.
+ * @param d_target Non-empty string to search for.
+ * @param d_results Whether each string contains the target.
+ */
+__global__ void contains_warp_parallel_fn(column_device_view const d_strings,
+                                          string_view const d_target,
+                                          bool* d_results)
+{
+  auto const idx = static_cast<size_type>((threadIdx.x + blockIdx.x * blockDim.x) /
+                                          cudf::detail::warp_size);
+  if (idx >= d_strings.size()) return;
+  auto const lane = threadIdx.x % cudf::detail::warp_size;
+  if (d_strings.is_null(idx)) {
+    if (lane == 0) d_results[idx] = false;
+    return;
+  }
+  auto const d_str  = d_strings.element<string_view>(idx);
+  auto const result = warp_find(d_str, d_target, 0, d_str.size_bytes()) >= 0;
+  if (lane == 0) d_results[idx] = result;
+}
+
+/**
+ * @brief Returns a bool column indicating the presence of a non-empty target
+ * string in a strings column, searching each string with a warp.
+ *
+ * @param strings Column of strings to check for target.
+ * @param target Non-empty UTF-8 encoded string to check in strings column.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New BOOL column.
+ */
+std::unique_ptr<column> contains_warp_parallel(strings_column_view const& strings,
+                                               string_scalar const& target,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  auto const strings_count  = strings.size();
+  auto const d_target       = string_view(target.data(), target.size());
+  auto const strings_column = column_device_view::create(strings.parent(), stream);
+  auto results = make_numeric_column(data_type{BOOL8},
+                                     strings_count,
+                                     copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  constexpr size_type block_size{256};
+  constexpr size_type warps_per_block{block_size / cudf::detail::warp_size};
+  auto const num_blocks = (strings_count + warps_per_block - 1) / warps_per_block;
+  contains_warp_parallel_fn<<<num_blocks, block_size, 0, stream>>>(
+    *strings_column, d_target, results->mutable_view().data<bool>());
+  results->set_null_count(strings.null_count());
+  return results;
+}
+
 /**
  * @brief Utility to return a bool column indicating the presence of
  * a given target string in a strings column.
@@ -192,6 +313,7 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
   auto d_target       = string_view(target.data(), target.size());
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
+  auto const ascii    = is_ascii(strings, stream);
   // create output column
   auto results      = make_numeric_column(data_type{BOOL8},
                                      strings_count,
@@ -207,9 +329,9 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
     thrust::make_counting_iterator<size_type>(0),
     thrust::make_counting_iterator<size_type>(strings_count),
     d_results,
-    [d_strings, pfn, d_target] __device__(size_type idx) {
+    [d_strings, pfn, d_target, ascii] __device__(size_type idx) {
       if (!d_strings.is_null(idx))
-        return static_cast<bool>(pfn(d_strings.element<string_view>(idx), d_target));
+        return static_cast<bool>(pfn(string_at(d_strings, idx, ascii), d_target));
       return false;
     });
   results->set_null_count(strings.null_count());
@@ -224,6 +346,9 @@ std::unique_ptr<column> contains(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0)
 {
+  if ((strings.size() > 0) && target.is_valid() && (target.size() > 0) &&
+      (average_string_bytes(strings, stream) >= warp_per_string_threshold))
+    return contains_warp_parallel(strings, target, mr, stream);
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,10 @@
 
 #include <thrust/transform.h>
 
+#include <limits>
+#include <queue>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -66,6 +70,175 @@ std::unique_ptr<column> find_multiple(
   return results;
 }
 
+namespace {
+/**
+ * @brief Aho-Corasick automaton matching a set of targets, laid out as a full
+ * transition table over byte classes.
+ *
+ * Each byte appearing in the targets has its own class and all other bytes
+ * share class 0, so the table has one row per trie node and one column per class.
+ */
+struct aho_corasick_automaton {
+  std::vector<int32_t> byte_classes = std::vector<int32_t>(256, 0);  ///< class of each byte
+  int32_t num_classes{1};            ///< number of byte classes
+  std::vector<int32_t> transitions;  ///< next state for each state and byte class
+  std::vector<int32_t> matches;  ///< index of the target matched on reaching a state, or -1
+};
+
+/**
+ * @brief Builds the automaton of a set of targets on the host.
+ *
+ * The match of a state is the longest target ending there: the one spelled
+ * by the state itself or else the match of its failure state. Duplicate
+ * targets match the smallest index.
+ *
+ * @param h_offsets Offsets of the targets within `h_chars`.
+ * @param h_chars Characters of the targets.
+ */
+aho_corasick_automaton build_automaton(std::vector<int32_t> const& h_offsets,
+                                       std::vector<char> const& h_chars)
+{
+  aho_corasick_automaton automaton;
+  auto& classes = automaton.byte_classes;
+  for (auto const chr : h_chars) {
+    auto const byte = static_cast<uint8_t>(chr);
+    if (classes[byte] == 0) classes[byte] = automaton.num_classes++;
+  }
+  auto const num_classes = automaton.num_classes;
+  auto& transitions      = automaton.transitions;
+  auto& matches          = automaton.matches;
+
+  // trie of the targets; -1 marks a missing edge
+  transitions.assign(num_classes, -1);
+  matches.assign(1, -1);
+  int32_t num_states = 1;
+  for (size_t target = 0; target + 1 < h_offsets.size(); ++target) {
+    int32_t state = 0;
+    for (auto idx = h_offsets[target]; idx < h_offsets[target + 1]; ++idx) {
+      auto& next = transitions[state * num_classes + classes[static_cast<uint8_t>(h_chars[idx])]];
+      if (next < 0) {
+        next = num_states++;
+        CUDF_EXPECTS(static_cast<int64_t>(num_states) * num_classes <=
+                       std::numeric_limits<size_type>::max(),
+                     "Search targets are too large for the automaton");
+        transitions.resize(num_states * num_classes, -1);
+        matches.push_back(-1);
+      }
+      state = transitions[state * num_classes + classes[static_cast<uint8_t>(h_chars[idx])]];
+    }
+    if (matches[state] < 0) matches[state] = static_cast<int32_t>(target);
+  }
+
+  // replace the missing edges with the transitions of the failure states, level by level
+  std::vector<int32_t> failures(num_states, 0);
+  std::queue<int32_t> states;
+  for (int32_t cls = 0; cls < num_classes; ++cls) {
+    auto& next = transitions[cls];
+    if (next < 0)
+      next = 0;
+    else
+      states.push(next);
+  }
+  while (!states.empty()) {
+    auto const state = states.front();
+    states.pop();
+    if (matches[state] < 0) matches[state] = matches[failures[state]];
+    for (int32_t cls = 0; cls < num_classes; ++cls) {
+      auto const fallback = transitions[failures[state] * num_classes + cls];
+      auto& next          = transitions[state * num_classes + cls];
+      if (next < 0) {
+        next = fallback;
+      } else {
+        failures[next] = fallback;
+        states.push(next);
+      }
+    }
+  }
+  return automaton;
+}
+
+/**
+ * @brief Returns the index of the first target found in each string by
+ * running an Aho-Corasick automaton over its bytes.
+ */
+struct contains_multiple_fn {
+  column_device_view const d_strings;
+  int32_t const* d_byte_classes;
+  int32_t const* d_transitions;
+  int32_t const* d_matches;
+  int32_t const num_classes;
+
+  __device__ int32_t operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return -1;
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const ptr   = reinterpret_cast<uint8_t const*>(d_str.data());
+    int32_t state    = 0;
+    auto match       = d_matches[state];
+    for (size_type pos = 0; (match < 0) && (pos < d_str.size_bytes()); ++pos) {
+      state = d_transitions[state * num_classes + d_byte_classes[ptr[pos]]];
+      match = d_matches[state];
+    }
+    return match;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> contains_multiple(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto strings_count = strings.size();
+  if (strings_count == 0) return make_empty_column(data_type{INT32});
+  auto targets_count = targets.size();
+  CUDF_EXPECTS(targets_count > 0, "Must include at least one search target");
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+
+  // copy the targets to the host to build the automaton
+  std::vector<int32_t> h_offsets(targets_count + 1);
+  CUDA_TRY(cudaMemcpyAsync(h_offsets.data(),
+                           targets.offsets().data<int32_t>() + targets.offset(),
+                           h_offsets.size() * sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  std::vector<char> h_chars(h_offsets.back() - h_offsets.front());
+  CUDA_TRY(cudaMemcpyAsync(h_chars.data(),
+                           targets.chars().data<char>() + h_offsets.front(),
+                           h_chars.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  auto const first_offset = h_offsets.front();
+  for (auto& offset : h_offsets) offset -= first_offset;
+  auto const automaton = build_automaton(h_offsets, h_chars);
+  rmm::device_vector<int32_t> byte_classes(automaton.byte_classes);
+  rmm::device_vector<int32_t> transitions(automaton.transitions);
+  rmm::device_vector<int32_t> matches(automaton.matches);
+
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto results        = make_numeric_column(data_type{INT32},
+                                     strings_count,
+                                     copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    results->mutable_view().data<int32_t>(),
+                    contains_multiple_fn{*strings_column,
+                                         byte_classes.data().get(),
+                                         transitions.data().get(),
+                                         matches.data().get(),
+                                         automaton.num_classes});
+  results->set_null_count(strings.null_count());
+  return results;
+}
+
 }  // namespace detail
 
 // external API
@@ -77,5 +250,13 @@ std::unique_ptr<column> find_multiple(strings_column_view const& strings,
   return detail::find_multiple(strings, targets, mr);
 }
 
+std::unique_ptr<column> contains_multiple(strings_column_view const& strings,
+                                          strings_column_view const& targets,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_multiple(strings, targets, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
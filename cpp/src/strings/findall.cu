@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -27,6 +28,8 @@
 #include <strings/utilities.hpp>
 
 #include <thrust/extrema.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/scan.h>
 
 namespace cudf {
 namespace strings {
@@ -105,6 +108,44 @@ struct findall_count_fn : public findall_fn<stack_size> {
   }
 };
 
+/**
+ * @brief This functor stores the positions of all the matches within each string.
+ *
+ * The number of matches in each string is known from findall_count_fn and
+ * is given by `d_offsets`.
+ */
+template <size_t stack_size>
+struct findall_pairs_fn {
+  column_device_view const d_strings;
+  reprog_device prog;
+  int32_t const* d_offsets;
+  string_index_pair* d_tokens;
+
+  __device__ size_type operator()(size_type idx)
+  {
+    auto const count = d_offsets[idx + 1] - d_offsets[idx];
+    if (count == 0) return 0;
+    u_char data1[stack_size];
+    u_char data2[stack_size];
+    prog.set_stack_mem(data1, data2);
+    string_view d_str   = d_strings.element<string_view>(idx);
+    auto d_output       = d_tokens + d_offsets[idx];
+    auto nchars         = d_str.length();
+    size_type spos      = 0;
+    size_type epos      = nchars;
+    size_type token_idx = 0;
+    while (token_idx < count) {
+      if (prog.find(idx, d_str, spos, epos) <= 0) break;  // no more matches found
+      auto const bspos      = d_str.byte_offset(spos);
+      auto const bepos      = d_str.byte_offset(epos);
+      d_output[token_idx++] = string_index_pair{d_str.data() + bspos, (bepos - bspos)};
+      spos                  = epos > spos ? epos : spos + 1;
+      epos                  = nchars;
+    }
+    return token_idx;
+  }
+};
+
 }  // namespace
 
 //
@@ -129,23 +170,23 @@ std::unique_ptr<table> findall_re(
   auto d_find_counts = find_counts.data().get();
 
   if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_find_counts,
-                      findall_count_fn<RX_STACK_SMALL>{d_strings, d_prog});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_find_counts,
+                   findall_count_fn<RX_STACK_SMALL>{d_strings, d_prog},
+                   stream);
   else if (regex_insts <= RX_MEDIUM_INSTS)
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_find_counts,
-                      findall_count_fn<RX_STACK_MEDIUM>{d_strings, d_prog});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_find_counts,
+                   findall_count_fn<RX_STACK_MEDIUM>{d_strings, d_prog},
+                   stream);
   else
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_find_counts,
-                      findall_count_fn<RX_STACK_LARGE>{d_strings, d_prog});
+    transform_rows(d_prog,
+                   strings_count,
+                   d_find_counts,
+                   findall_count_fn<RX_STACK_LARGE>{d_strings, d_prog},
+                   stream);
 
   std::vector<std::unique_ptr<column>> results;
 
@@ -165,30 +206,105 @@ std::unique_ptr<table> findall_re(
     string_index_pair* d_indices = indices.data().get();
 
     if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        findall_fn<RX_STACK_SMALL>{d_strings, d_prog, column_index, d_find_counts});
+      transform_rows(d_prog,
+                     strings_count,
+                     d_indices,
+                     findall_fn<RX_STACK_SMALL>{d_strings, d_prog, column_index, d_find_counts},
+                     stream);
     else if (regex_insts <= RX_MEDIUM_INSTS)
-      thrust::transform(
-        execpol->on(stream),
-        thrust::make_counting_iterator<size_type>(0),
-        thrust::make_counting_iterator<size_type>(strings_count),
-        d_indices,
-        findall_fn<RX_STACK_MEDIUM>{d_strings, d_prog, column_index, d_find_counts});
+      transform_rows(d_prog,
+                     strings_count,
+                     d_indices,
+                     findall_fn<RX_STACK_MEDIUM>{d_strings, d_prog, column_index, d_find_counts},
+                     stream);
     else
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        findall_fn<RX_STACK_LARGE>{d_strings, d_prog, column_index, d_find_counts});
+      transform_rows(d_prog,
+                     strings_count,
+                     d_indices,
+                     findall_fn<RX_STACK_LARGE>{d_strings, d_prog, column_index, d_find_counts},
+                     stream);
     //
     results.emplace_back(make_strings_column(indices, stream, mr));
   }
   return std::make_unique<table>(std::move(results));
 }
 
+//
+std::unique_ptr<column> findall_record(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+
+  auto d_flags = detail::get_character_flags_table();
+  // compile regex into device object
+  auto prog       = reprog_device::create(pattern, d_flags, strings_count, stream);
+  auto d_prog     = *prog;
+  auto execpol    = rmm::exec_policy(stream);
+  int regex_insts = prog->insts_counts();
+
+  // count the matches in each string and convert the counts into offsets
+  auto offsets   = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    transform_rows(d_prog,
+                   strings_count,
+                   d_offsets,
+                   findall_count_fn<RX_STACK_SMALL>{d_strings, d_prog},
+                   stream);
+  else if (regex_insts <= RX_MEDIUM_INSTS)
+    transform_rows(d_prog,
+                   strings_count,
+                   d_offsets,
+                   findall_count_fn<RX_STACK_MEDIUM>{d_strings, d_prog},
+                   stream);
+  else
+    transform_rows(d_prog,
+                   strings_count,
+                   d_offsets,
+                   findall_count_fn<RX_STACK_LARGE>{d_strings, d_prog},
+                   stream);
+  CUDA_TRY(cudaMemsetAsync(d_offsets + strings_count, 0, sizeof(int32_t), stream));
+  thrust::exclusive_scan(execpol->on(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+  auto const total_matches =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+
+  // locate all the matches and build the child strings column from them
+  rmm::device_vector<string_index_pair> matches(total_matches);
+  auto d_matches = matches.data().get();
+  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    transform_rows(d_prog,
+                   strings_count,
+                   thrust::make_discard_iterator(),
+                   findall_pairs_fn<RX_STACK_SMALL>{d_strings, d_prog, d_offsets, d_matches},
+                   stream);
+  else if (regex_insts <= RX_MEDIUM_INSTS)
+    transform_rows(d_prog,
+                   strings_count,
+                   thrust::make_discard_iterator(),
+                   findall_pairs_fn<RX_STACK_MEDIUM>{d_strings, d_prog, d_offsets, d_matches},
+                   stream);
+  else
+    transform_rows(d_prog,
+                   strings_count,
+                   thrust::make_discard_iterator(),
+                   findall_pairs_fn<RX_STACK_LARGE>{d_strings, d_prog, d_offsets, d_matches},
+                   stream);
+
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           make_strings_column(matches, stream, mr),
+                           strings.null_count(),
+                           copy_bitmask(strings.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -201,5 +317,13 @@ std::unique_ptr<table> findall_re(strings_column_view const& strings,
   return detail::findall_re(strings, pattern, mr);
 }
 
+std::unique_ptr<column> findall_record(strings_column_view const& strings,
+                                       std::string const& pattern,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall_record(strings, pattern, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
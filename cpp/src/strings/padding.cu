@@ -32,11 +32,12 @@ struct compute_pad_output_length_fn {
   column_device_view d_strings;
   size_type width;
   size_type fill_char_size;
+  bool ascii;
 
   __device__ size_type operator()(size_type idx)
   {
     if (d_strings.is_null(idx)) return 0;
-    string_view d_str = d_strings.element<string_view>(idx);
+    string_view d_str = string_at(d_strings, idx, ascii);
     size_type bytes   = d_str.size_bytes();
     size_type length  = d_str.length();
     if (width > length)                            // no truncating
@@ -64,14 +65,15 @@ std::unique_ptr<column> pad(strings_column_view const& strings,
   auto execpol        = rmm::exec_policy(stream);
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
+  auto const ascii    = is_ascii(strings, stream);
 
   // create null_mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
 
   // build offsets column
-  auto offsets_transformer_itr =
-    thrust::make_transform_iterator(thrust::make_counting_iterator<int32_t>(0),
-                                    compute_pad_output_length_fn{d_strings, width, fill_char_size});
+  auto offsets_transformer_itr = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<int32_t>(0),
+    compute_pad_output_length_fn{d_strings, width, fill_char_size, ascii});
   auto offsets_column = make_offsets_child_column(
     offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
   auto d_offsets = offsets_column->view().data<int32_t>();
@@ -87,9 +89,9 @@ std::unique_ptr<column> pad(strings_column_view const& strings,
       execpol->on(stream),
       thrust::make_counting_iterator<cudf::size_type>(0),
       strings_count,
-      [d_strings, width, d_fill_char, d_offsets, d_chars] __device__(size_type idx) {
+      [d_strings, width, d_fill_char, ascii, d_offsets, d_chars] __device__(size_type idx) {
         if (d_strings.is_null(idx)) return;
-        string_view d_str = d_strings.element<string_view>(idx);
+        string_view d_str = string_at(d_strings, idx, ascii);
         auto length       = d_str.length();
         char* ptr         = d_chars + d_offsets[idx];
         while (length++ < width) ptr += from_char_utf8(d_fill_char, ptr);
@@ -100,9 +102,9 @@ std::unique_ptr<column> pad(strings_column_view const& strings,
       execpol->on(stream),
       thrust::make_counting_iterator<cudf::size_type>(0),
       strings_count,
-      [d_strings, width, d_fill_char, d_offsets, d_chars] __device__(size_type idx) {
+      [d_strings, width, d_fill_char, ascii, d_offsets, d_chars] __device__(size_type idx) {
         if (d_strings.is_null(idx)) return;
-        string_view d_str = d_strings.element<string_view>(idx);
+        string_view d_str = string_at(d_strings, idx, ascii);
         auto length       = d_str.length();
         char* ptr         = d_chars + d_offsets[idx];
         ptr               = copy_string(ptr, d_str);
@@ -113,9 +115,9 @@ std::unique_ptr<column> pad(strings_column_view const& strings,
       execpol->on(stream),
       thrust::make_counting_iterator<cudf::size_type>(0),
       strings_count,
-      [d_strings, width, d_fill_char, d_offsets, d_chars] __device__(size_type idx) {
+      [d_strings, width, d_fill_char, ascii, d_offsets, d_chars] __device__(size_type idx) {
         if (d_strings.is_null(idx)) return;
-        string_view d_str = d_strings.element<string_view>(idx);
+        string_view d_str = string_at(d_strings, idx, ascii);
         char* ptr         = d_chars + d_offsets[idx];
         int32_t pad       = static_cast<int32_t>(width - d_str.length());
         auto right_pad    = (width & 1) ? pad / 2 : (pad - pad / 2);  // odd width = right-justify
@@ -151,6 +153,7 @@ std::unique_ptr<column> zfill(strings_column_view const& strings,
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
+  auto const ascii    = is_ascii(strings, stream);
 
   // copy bitmask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
@@ -158,7 +161,7 @@ std::unique_ptr<column> zfill(strings_column_view const& strings,
   // build offsets column
   auto offsets_transformer_itr = thrust::make_transform_iterator(
     thrust::make_counting_iterator<int32_t>(0),
-    compute_pad_output_length_fn{d_strings, width, 1});  // fillchar is 1 byte
+    compute_pad_output_length_fn{d_strings, width, 1, ascii});  // fillchar is 1 byte
   auto offsets_column = make_offsets_child_column(
     offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
   auto d_offsets = offsets_column->view().data<int32_t>();
@@ -172,9 +175,9 @@ std::unique_ptr<column> zfill(strings_column_view const& strings,
   thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
                      thrust::make_counting_iterator<cudf::size_type>(0),
                      strings_count,
-                     [d_strings, width, d_offsets, d_chars] __device__(size_type idx) {
+                     [d_strings, width, ascii, d_offsets, d_chars] __device__(size_type idx) {
                        if (d_strings.is_null(idx)) return;
-                       string_view d_str = d_strings.element<string_view>(idx);
+                       string_view d_str = string_at(d_strings, idx, ascii);
                        auto length       = d_str.length();
                        char* out_ptr     = d_chars + d_offsets[idx];
                        while (length++ < width) *out_ptr++ = '0';  // prepend zero char
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <strings/char_types/is_flags.h>
+#include <strings/regex/dfa.cuh>
+#include <strings/regex/regcomp.h>
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+/**
+ * @brief Kind of the character before a position, as seen by the `^`, `\b` and `\B` assertions.
+ */
+enum previous_char : int32_t {
+  START = 0,  ///< beginning of the string
+  NEWLINE,    ///< a newline character
+  WORD,       ///< an alpha-numeric character
+  OTHER       ///< any other character
+};
+
+/**
+ * @brief Builds the DFA of a regex program by subset construction.
+ */
+class dfa_builder {
+ public:
+  dfa_builder(reprog& prog, std::vector<uint8_t> const& flags, bool anchored)
+    : _prog(prog), _flags(flags), _anchored(anchored)
+  {
+    for (auto const* id = prog.starts_data(); *id >= 0; ++id) _starts.push_back(*id);
+    std::sort(_starts.begin(), _starts.end());
+  }
+
+  /**
+   * @brief Returns whether every instruction of the program can be evaluated by a DFA.
+   */
+  bool is_supported()
+  {
+    if (_prog.insts_count() == 0) return false;
+    for (int32_t id = 0; id < _prog.insts_count(); ++id) {
+      switch (_prog.inst_at(id).type) {
+        case CHAR:
+        case ANY:
+        case ANYNL:
+        case CCLASS:
+        case NCCLASS:
+        case LBRA:
+        case RBRA:
+        case OR:
+        case BOL:
+        case EOL:
+        case END: break;
+        case BOW:
+        case NBOW: _word_boundaries = true; break;
+        default: return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Groups the ASCII characters no instruction tells apart into the same class.
+   *
+   * Class 0 holds the null character which, like the end of the string, ends the evaluation.
+   */
+  void build_classes()
+  {
+    std::map<std::vector<bool>, uint8_t> signatures;
+    _byte_classes.assign(128, 0);
+    _class_chars.assign(1, 0);
+    for (char32_t ch = 1; ch < 128; ++ch) {
+      std::vector<bool> signature{ch == '\n', _word_boundaries && IS_ALPHANUM(_flags[ch])};
+      for (int32_t id = 0; id < _prog.insts_count(); ++id)
+        if (is_consuming(_prog.inst_at(id).type)) signature.push_back(consumes(id, ch));
+      auto const cls = signatures.emplace(signature, static_cast<uint8_t>(_class_chars.size()));
+      if (cls.second) _class_chars.push_back(ch);
+      _byte_classes[ch] = cls.first->second;
+    }
+  }
+
+  /**
+   * @brief Builds the transition table; returns false if it needs more than `max_dfa_states`.
+   */
+  bool build_transitions()
+  {
+    auto const num_classes = static_cast<int32_t>(_class_chars.size());
+    state_id(_starts, START);
+    for (size_t state = 0; state < _states.size(); ++state) {
+      auto const ids  = _states[state].first;
+      auto const prev = _states[state].second;
+      for (int32_t cls = 0; cls < num_classes; ++cls) {
+        auto const ch     = _class_chars[cls];
+        auto const result = closure(ids, prev, ch);
+        uint16_t next     = redfa_device::dead_state;
+        if (cls > 0) {
+          std::vector<int32_t> next_ids(_anchored ? std::vector<int32_t>{} : _starts);
+          for (auto const id : result.first)
+            if (consumes(id, ch)) next_ids.push_back(_prog.inst_at(id).u2.next_id);
+          std::sort(next_ids.begin(), next_ids.end());
+          next_ids.erase(std::unique(next_ids.begin(), next_ids.end()), next_ids.end());
+          if (!next_ids.empty()) {
+            auto const kind = (ch == '\n') ? NEWLINE
+                              : (_word_boundaries && IS_ALPHANUM(_flags[ch])) ? WORD
+                                                                               : OTHER;
+            auto const id = state_id(next_ids, kind);
+            if (id < 0) return false;
+            next = static_cast<uint16_t>(id);
+          }
+        }
+        if (result.second) next |= redfa_device::accept_bit;
+        _transitions.push_back(next);
+      }
+    }
+    return true;
+  }
+
+  std::vector<uint8_t> const& byte_classes() const { return _byte_classes; }
+  std::vector<uint16_t> const& transitions() const { return _transitions; }
+  int32_t num_classes() const { return static_cast<int32_t>(_class_chars.size()); }
+
+ private:
+  static bool is_consuming(int32_t type)
+  {
+    return (type == CHAR) || (type == ANY) || (type == ANYNL) || (type == CCLASS) ||
+           (type == NCCLASS);
+  }
+
+  /**
+   * @brief Host version of `reclass_device::is_match` for ASCII characters.
+   */
+  bool class_matches(reclass const& cls, char32_t ch) const
+  {
+    for (size_t idx = 0; idx + 1 < cls.literals.size(); idx += 2)
+      if ((ch >= cls.literals[idx]) && (ch <= cls.literals[idx + 1])) return true;
+    auto const fl = _flags[ch];
+    return ((cls.builtins & 1) && ((ch == '_') || IS_ALPHANUM(fl))) ||        // \w
+           ((cls.builtins & 2) && IS_SPACE(fl)) ||                             // \s
+           ((cls.builtins & 4) && IS_DIGIT(fl)) ||                             // \d
+           ((cls.builtins & 8) && ((ch != '\n') && (ch != '_') && !IS_ALPHANUM(fl))) ||  // \W
+           ((cls.builtins & 16) && !IS_SPACE(fl)) ||                           // \S
+           ((cls.builtins & 32) && ((ch != '\n') && !IS_DIGIT(fl)));           // \D
+  }
+
+  /**
+   * @brief Returns whether the consuming instruction `id` accepts the character `ch`.
+   */
+  bool consumes(int32_t id, char32_t ch)
+  {
+    auto const& inst = _prog.inst_at(id);
+    switch (inst.type) {
+      case CHAR: return inst.u1.c == ch;
+      case ANY: return ch != '\n';
+      case ANYNL: return true;
+      case CCLASS: return class_matches(_prog.class_at(inst.u1.cls_id), ch);
+      case NCCLASS: return !class_matches(_prog.class_at(inst.u1.cls_id), ch);
+      default: return false;
+    }
+  }
+
+  /**
+   * @brief Follows the non-consuming instructions from `ids` at a position
+   * between a character of kind `prev` and the character `ch` (0 at the end).
+   *
+   * @return The consuming instructions reached and whether END was reached.
+   */
+  std::pair<std::vector<int32_t>, bool> closure(std::vector<int32_t> const& ids,
+                                                int32_t prev,
+                                                char32_t ch)
+  {
+    std::vector<int32_t> stack(ids);
+    std::vector<bool> visited(_prog.insts_count(), false);
+    std::vector<int32_t> consuming;
+    bool accept = false;
+    while (!stack.empty()) {
+      auto const id = stack.back();
+      stack.pop_back();
+      if (visited[id]) continue;
+      visited[id]      = true;
+      auto const& inst = _prog.inst_at(id);
+      switch (inst.type) {
+        case END: accept = true; break;
+        case LBRA:
+        case RBRA: stack.push_back(inst.u2.next_id); break;
+        case OR:
+          stack.push_back(inst.u1.right_id);
+          stack.push_back(inst.u2.left_id);
+          break;
+        case BOL:
+          if ((prev == START) || ((inst.u1.c == '^') && (prev == NEWLINE)))
+            stack.push_back(inst.u2.next_id);
+          break;
+        case EOL:
+          if ((ch == 0) || ((inst.u1.c == '$') && (ch == '\n'))) stack.push_back(inst.u2.next_id);
+          break;
+        case BOW:
+        case NBOW: {
+          bool const boundary = (IS_ALPHANUM(_flags[ch]) != 0) != (prev == WORD);
+          if (boundary == (inst.type == BOW)) stack.push_back(inst.u2.next_id);
+          break;
+        }
+        default: consuming.push_back(id);
+      }
+    }
+    std::sort(consuming.begin(), consuming.end());
+    return {consuming, accept};
+  }
+
+  /**
+   * @brief Returns the id of the state, adding it if new, or -1 if there are too many states.
+   */
+  int32_t state_id(std::vector<int32_t> const& ids, int32_t prev)
+  {
+    auto const key = std::make_pair(ids, prev);
+    auto const itr = _state_ids.find(key);
+    if (itr != _state_ids.end()) return itr->second;
+    if (static_cast<int32_t>(_states.size()) >= max_dfa_states) return -1;
+    auto const id = static_cast<int32_t>(_states.size());
+    _state_ids.emplace(key, id);
+    _states.push_back(key);
+    return id;
+  }
+
+  reprog& _prog;
+  std::vector<uint8_t> const& _flags;
+  bool const _anchored;
+  bool _word_boundaries{false};
+  std::vector<int32_t> _starts;
+  std::vector<uint8_t> _byte_classes;
+  std::vector<char32_t> _class_chars;  // one character of each class
+  std::vector<std::pair<std::vector<int32_t>, int32_t>> _states;
+  std::map<std::pair<std::vector<int32_t>, int32_t>, int32_t> _state_ids;
+  std::vector<uint16_t> _transitions;
+};
+
+}  // namespace
+
+std::unique_ptr<redfa> redfa::create(std::string const& pattern,
+                                     uint8_t const* codepoint_flags,
+                                     bool anchored,
+                                     cudaStream_t stream)
+{
+  std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
+  reprog h_prog                   = reprog::create_from(pattern32.data());
+  std::vector<uint8_t> h_flags(128);
+  CUDA_TRY(cudaMemcpyAsync(
+    h_flags.data(), codepoint_flags, h_flags.size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  dfa_builder builder(h_prog, h_flags, anchored);
+  if (!builder.is_supported()) return nullptr;
+  builder.build_classes();
+  if (!builder.build_transitions()) return nullptr;
+
+  std::unique_ptr<redfa> dfa(new redfa);
+  dfa->_byte_classes = builder.byte_classes();
+  dfa->_transitions  = builder.transitions();
+  dfa->_num_classes  = builder.num_classes();
+  return dfa;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
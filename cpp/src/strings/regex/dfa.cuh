@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/strings/string_view.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Largest number of states of a DFA compiled from a regex pattern.
+ *
+ * Patterns needing more states are evaluated with the instructions of `reprog_device`.
+ */
+constexpr int32_t max_dfa_states = 1024;
+
+/**
+ * @brief Regex DFA stored on the device, evaluating a pattern on ASCII strings.
+ *
+ * Entry `state * num_classes + class` of the transition table holds the state
+ * reached by reading a character of that class, with `accept_bit` set if the
+ * pattern matches at the position of that character. Class 0 stands for the
+ * end of the string.
+ */
+struct redfa_device {
+  static constexpr uint16_t accept_bit = 0x8000;  ///< pattern matches before this character
+  static constexpr uint16_t dead_state = 0x7fff;  ///< no match is possible past this state
+
+  uint8_t const* byte_classes{};    ///< class of each ASCII character
+  uint16_t const* transitions{};    ///< transition table in device memory
+  int32_t num_classes{};            ///< number of character classes
+  std::size_t transitions_count{};  ///< number of entries of the transition table
+
+  /**
+   * @brief Returns true if the pattern is found in the ASCII string `d_str`.
+   *
+   * @param d_str String to evaluate.
+   * @param table Transition table, either `transitions` or a copy of it.
+   */
+  __device__ bool is_match(string_view const& d_str, uint16_t const* table) const
+  {
+    auto const ptr = reinterpret_cast<uint8_t const*>(d_str.data());
+    uint16_t state = 0;
+    for (size_type idx = 0; idx < d_str.size_bytes(); ++idx) {
+      auto const cls = byte_classes[ptr[idx]];
+      if (cls == 0) break;  // regexec also stops at a null character
+      auto const next = table[state * num_classes + cls];
+      if (next & accept_bit) return true;
+      if (next == dead_state) return false;
+      state = next;
+    }
+    return table[state * num_classes] & accept_bit;
+  }
+};
+
+/**
+ * @brief Regex DFA compiled from a pattern, owning the device memory of `redfa_device`.
+ */
+class redfa {
+ public:
+  /**
+   * @brief Compiles a regex pattern into a DFA over ASCII characters.
+   *
+   * The DFA has the same matches as `reprog_device::find` on ASCII strings.
+   * Each state is the set of instructions pending before a character,
+   * together with the kind of the previous character for the `^`, `\b`
+   * and `\B` assertions.
+   *
+   * @param pattern The regex pattern to compile.
+   * @param codepoint_flags The code-point lookup table for character types, in device memory.
+   * @param anchored Only match at the beginning of the strings, as `matches_re`.
+   * @param stream CUDA stream used for device memory operations.
+   * @return The DFA, or null if it would need more than `max_dfa_states` states.
+   */
+  static std::unique_ptr<redfa> create(std::string const& pattern,
+                                       uint8_t const* codepoint_flags,
+                                       bool anchored,
+                                       cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the device object evaluating the DFA.
+   */
+  redfa_device view() const
+  {
+    return redfa_device{_byte_classes.data().get(),
+                        _transitions.data().get(),
+                        _num_classes,
+                        _transitions.size()};
+  }
+
+ private:
+  rmm::device_vector<uint8_t> _byte_classes;
+  rmm::device_vector<uint16_t> _transitions;
+  int32_t _num_classes{};
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -905,6 +905,44 @@ void reprog::optimize2()
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+// find the longest run of characters that every match must contain
+std::u32string reprog::required_literal() const
+{
+  // returns true if END can be reached from the start without executing skip_id
+  auto const end_reachable_without = [this](int32_t skip_id) {
+    std::vector<bool> visited(_insts.size(), false);
+    std::vector<int32_t> stack{_startinst_id};
+    while (!stack.empty()) {
+      int32_t const id = stack.back();
+      stack.pop_back();
+      if (id == skip_id || visited[id]) continue;
+      visited[id]        = true;
+      reinst const& inst = _insts[id];
+      if (inst.type == END) return true;
+      if (inst.type == OR) stack.push_back(inst.u1.right_id);
+      stack.push_back(inst.u2.next_id);
+    }
+    return false;
+  };
+
+  std::u32string result;
+  for (int32_t id = 0; id < insts_count(); ++id) {
+    if (_insts[id].type != CHAR || end_reachable_without(id)) continue;
+    // every match executes this instruction so the characters chained directly after it
+    // are matched contiguously; group brackets do not break the run
+    std::u32string literal;
+    int32_t next_id = id;
+    while ((_insts[next_id].type == CHAR) && (literal.size() < _insts.size())) {
+      literal.push_back(_insts[next_id].u1.c);
+      next_id = _insts[next_id].u2.next_id;
+      while (_insts[next_id].type == LBRA || _insts[next_id].type == RBRA)
+        next_id = _insts[next_id].u2.next_id;
+    }
+    if (literal.size() > result.size()) result = literal;
+  }
+  return result;
+}
+
 void reprog::print()
 {
   printf("Instructions:\n");
@@ -20,6 +20,19 @@
 namespace cudf {
 namespace strings {
 namespace detail {
+/**
+ * @brief Converts UTF-8 string into fixed-width 32-bit character vector.
+ *
+ * No character conversion occurs.
+ * Each UTF-8 character is promoted into a 32-bit value.
+ * The last entry in the returned vector will be a 0 value.
+ * The fixed-width vector makes it easier to compile and faster to execute.
+ *
+ * @param pattern Regular expression encoded with UTF-8.
+ * @return Fixed-width 32-bit character vector.
+ */
+std::vector<char32_t> string_to_char32_vector(std::string const& pattern);
+
 /**
  * @brief Actions and Tokens (regex instruction types)
  *
@@ -113,6 +126,15 @@ class reprog {
 
   void optimize1();
   void optimize2();
+
+  /**
+   * @brief Returns the longest sequence of characters that must appear in any match.
+   *
+   * Strings that do not contain this literal cannot match the pattern.
+   * An empty string is returned if the pattern has no such literal.
+   */
+  std::u32string required_literal() const;
+
   void print();  // for debugging
 
  private:
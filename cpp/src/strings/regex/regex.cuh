@@ -16,7 +16,18 @@
 #pragma once
 
 #include <cuda_runtime.h>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/strings/detail/concatenate.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <strings/regex/regcomp.h>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
 #include <functional>
 #include <memory>
 
@@ -87,6 +98,14 @@ class reprog_device {
    */
   __host__ __device__ int32_t insts_counts() const { return _insts_count; }
 
+  /**
+   * @brief Returns the number of strings this program can evaluate in a single kernel launch.
+   *
+   * Programs that keep their state in global memory only allocate it for a bounded number of
+   * strings. Larger columns must be evaluated in tiles of at most this many rows.
+   */
+  __host__ __device__ int32_t working_memory_rows() const { return _relists_rows; }
+
   /**
    * @brief Returns true if this is an empty program.
    */
@@ -119,6 +138,17 @@ class reprog_device {
    */
   __device__ inline int32_t* startinst_ids() const;
 
+  /**
+   * @brief Returns false if the string cannot match the expression.
+   *
+   * This is a byte scan for the literal characters required by every match of the pattern.
+   * It can be used to reject strings before running the more expensive find or extract.
+   *
+   * @param d_str The string to check.
+   * @return Returns true if the string contains the required literal or if there is none.
+   */
+  __device__ inline bool may_match(string_view const& d_str) const;
+
   /**
    * @brief Does a find evaluation using the compiled expression on the given string.
    *
@@ -157,10 +187,13 @@ class reprog_device {
  private:
   int32_t _startinst_id, _num_capturing_groups;
   int32_t _insts_count, _starts_count, _classes_count;
+  int32_t _literal_bytes{};           // size of the required literal in bytes
+  int32_t _relists_rows{};            // number of strings the relist memory can hold
   const uint8_t* _codepoint_flags{};  // table of character types
   reinst* _insts{};                   // array of regex instructions
   int32_t* _startinst_ids{};          // array of start instruction ids
   reclass_device* _classes{};         // array of regex classes
+  const char* _literal{};             // UTF-8 literal required by every match
   void* _relists_mem{};               // runtime relist memory for regexec
   u_char* _stack_mem1{};              // memory for relist object 1
   u_char* _stack_mem2{};              // memory for relist object 2
@@ -193,6 +226,89 @@ constexpr int32_t RX_SMALL_INSTS  = (RX_STACK_SMALL / 11);
 constexpr int32_t RX_MEDIUM_INSTS = (RX_STACK_MEDIUM / 11);
 constexpr int32_t RX_LARGE_INSTS  = (RX_STACK_LARGE / 11);
 
+// Upper bound on the global memory holding the state data of programs over MAX_STACK_INSTS.
+// Columns with more strings than fit are evaluated in tiles of rows.
+constexpr size_t RX_MAX_WORKING_MEMORY = 256 * 1024 * 1024;
+
+/**
+ * @brief Returns the name of the state memory tier used to evaluate a regex program.
+ *
+ * The evaluation functions annotate their kernels with an NVTX range of this name.
+ *
+ * @param insts_count Number of instructions in the regex program.
+ */
+inline const char* regex_tier_name(int32_t insts_count)
+{
+  if (insts_count > MAX_STACK_INSTS) return "regex_global_memory";
+  if (insts_count <= RX_SMALL_INSTS) return "regex_stack_small";
+  if (insts_count <= RX_MEDIUM_INSTS) return "regex_stack_medium";
+  return "regex_stack_large";
+}
+
+/**
+ * @brief Applies a regex function to each row index and stores the results in `output`.
+ *
+ * The rows are processed in tiles of `prog.working_memory_rows()` so the function may be
+ * used with programs whose state data is held in global memory.
+ *
+ * @param prog The regex program used by `fn`.
+ * @param strings_count Number of rows to evaluate.
+ * @param output Iterator for the results of each row.
+ * @param fn Function called with each row index.
+ * @param stream CUDA stream used for kernel launches.
+ */
+template <typename OutputIterator, typename Function>
+void transform_rows(reprog_device const& prog,
+                    int32_t strings_count,
+                    OutputIterator output,
+                    Function fn,
+                    cudaStream_t stream)
+{
+  cudf::thread_range tier_range{regex_tier_name(prog.insts_counts())};
+  auto const tile_rows = prog.working_memory_rows();
+  for (int32_t begin = 0, end = 0; begin < strings_count; begin = end) {
+    end = begin + std::min(tile_rows, strings_count - begin);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<int32_t>(begin),
+                      thrust::make_counting_iterator<int32_t>(end),
+                      output + begin,
+                      fn);
+  }
+}
+
+/**
+ * @brief Builds a strings column by evaluating `fn` on tiles of rows and concatenating the
+ * results.
+ *
+ * This is used by the functions that produce strings columns when the working memory of the
+ * regex program cannot hold all the strings at once.
+ *
+ * @param strings Strings column to evaluate.
+ * @param tile_rows Maximum number of rows in each tile.
+ * @param fn Function returning a strings column for a `strings_column_view` tile.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New strings column with the results of all the tiles.
+ */
+template <typename Function>
+std::unique_ptr<column> transform_tiles(strings_column_view const& strings,
+                                        int32_t tile_rows,
+                                        Function fn,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<column_view> views;
+  for (int32_t begin = 0, end = 0; begin < strings_count; begin = end) {
+    end = begin + std::min(tile_rows, strings_count - begin);
+    auto const tile = cudf::detail::slice(strings.parent(), begin, end);
+    results.emplace_back(fn(strings_column_view(tile)));
+    views.push_back(results.back()->view());
+  }
+  return concatenate(views, mr, stream);
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -369,6 +369,20 @@ __device__ inline int32_t reprog_device::regexec(
   return match;
 }
 
+__device__ inline bool reprog_device::may_match(string_view const& dstr) const
+{
+  if (_literal_bytes == 0) return true;
+  const char* data = dstr.data();
+  size_type last   = dstr.size_bytes() - _literal_bytes;
+  for (size_type pos = 0; pos <= last; ++pos) {
+    if (data[pos] != _literal[0]) continue;  // check first byte before comparing the rest
+    size_type idx = 1;
+    while ((idx < _literal_bytes) && (data[pos + idx] == _literal[idx])) ++idx;
+    if (idx == _literal_bytes) return true;
+  }
+  return false;
+}
+
 __device__ inline int32_t reprog_device::find(int32_t idx,
                                               string_view const& dstr,
                                               int32_t& begin,
@@ -410,7 +424,7 @@ __device__ inline int32_t reprog_device::call_regexec(
 
   auto relists_size = relist::alloc_size(_insts_count);
   u_char* drel      = reinterpret_cast<u_char*>(_relists_mem);  // beginning of relist buffer;
-  drel += (idx * relists_size * 2);                             // two relist ptrs in reljunk:
+  drel += ((idx % _relists_rows) * relists_size * 2);           // two relist ptrs in reljunk:
   jnk.list1 = reinterpret_cast<relist*>(drel);                  // - first one
   jnk.list2 = reinterpret_cast<relist*>(drel + relists_size);   // - second one
   jnk.list1->set_data(static_cast<int16_t>(_insts_count));      // essentially this is
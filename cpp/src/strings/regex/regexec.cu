@@ -22,21 +22,16 @@
 #include <rmm/rmm_api.h>
 #include <rmm/rmm.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 namespace cudf {
 namespace strings {
 namespace detail {
-namespace {
-/**
- * @brief Converts UTF-8 string into fixed-width 32-bit character vector.
- *
- * No character conversion occurs.
- * Each UTF-8 character is promoted into a 32-bit value.
- * The last entry in the returned vector will be a 0 value.
- * The fixed-width vector makes it easier to compile and faster to execute.
- *
- * @param pattern Regular expression encoded with UTF-8.
- * @return Fixed-width 32-bit character vector.
- */
+//
 std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
 {
   size_type size  = static_cast<size_type>(pattern.size());
@@ -55,8 +50,6 @@ std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
   return result;
 }
 
-}  // namespace
-
 // Copy reprog primitive values
 reprog_device::reprog_device(reprog& prog)
   : _startinst_id{prog.get_start_inst()},
@@ -70,6 +63,96 @@ reprog_device::reprog_device(reprog& prog)
 {
 }
 
+namespace {
+/**
+ * @brief Compiled regex program data held in the program cache.
+ */
+struct cached_program {
+  std::unique_ptr<reprog_device> prog;            // host copy of the device program
+  std::unique_ptr<rmm::device_buffer> d_buffer;   // instructions, classes and literal
+  std::unique_ptr<rmm::device_buffer> d_relists;  // working memory for large programs
+  cudaStream_t relists_stream{};                  // stream that last used d_relists
+  bool relists_in_use{false};
+};
+
+/**
+ * @brief Least-recently-used cache of compiled regex programs.
+ *
+ * Programs are keyed by the pattern and the code-point flags table.
+ * The working memory of large programs is kept with the program and reused by later
+ * calls on the same stream that need no more memory than was last allocated.
+ */
+class program_cache {
+ public:
+  static program_cache& instance()
+  {
+    // never destroyed so the cached device memory is not freed after RMM is finalized
+    static program_cache* cache = new program_cache;
+    return *cache;
+  }
+
+  std::shared_ptr<cached_program> find(std::string const& key)
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    auto itr = _entries.find(key);
+    if (itr == _entries.end()) return nullptr;
+    _lru.splice(_lru.begin(), _lru, itr->second);  // move to front
+    return itr->second->second;
+  }
+
+  void insert(std::string const& key, std::shared_ptr<cached_program> entry)
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (_entries.find(key) != _entries.end()) return;  // another thread added it
+    _lru.emplace_front(key, std::move(entry));
+    _entries[key] = _lru.begin();
+    if (_lru.size() > max_entries) {
+      _entries.erase(_lru.back().first);
+      _lru.pop_back();
+    }
+  }
+
+  // returns the cached working memory if it is available and large enough
+  void* reuse_relists(cached_program& entry, size_t size, cudaStream_t stream)
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (entry.relists_in_use || !entry.d_relists || (entry.relists_stream != stream) ||
+        (entry.d_relists->size() < size))
+      return nullptr;
+    entry.relists_in_use = true;
+    return entry.d_relists->data();
+  }
+
+  // keeps the new working memory with the program if no other call is using the cached one;
+  // a cached buffer last used on another stream is kept since work there may still read it
+  bool adopt_relists(cached_program& entry,
+                     std::unique_ptr<rmm::device_buffer>& d_relists,
+                     cudaStream_t stream)
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (entry.relists_in_use || (entry.d_relists && (entry.relists_stream != stream)))
+      return false;
+    entry.d_relists      = std::move(d_relists);
+    entry.relists_stream = stream;
+    entry.relists_in_use = true;
+    return true;
+  }
+
+  void release_relists(cached_program& entry)
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    entry.relists_in_use = false;
+  }
+
+ private:
+  static constexpr size_t max_entries = 64;
+  std::mutex _mutex;
+  std::list<std::pair<std::string, std::shared_ptr<cached_program>>> _lru;
+  std::unordered_map<std::string, decltype(_lru)::iterator> _entries;
+};
+
+}  // namespace
+
 // Create instance of the reprog that can be passed into a device kernel
 std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
   std::string const& pattern,
@@ -77,98 +160,139 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   size_type strings_count,
   cudaStream_t stream)
 {
-  std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
-  // compile pattern into host object
-  reprog h_prog = reprog::create_from(pattern32.data());
-  // compute size to hold all the member data
-  auto insts_count   = h_prog.insts_count();
-  auto classes_count = h_prog.classes_count();
-  auto starts_count  = h_prog.starts_count();
-  // compute size of each section; make sure each is aligned appropriately
-  auto insts_size =
-    cudf::util::round_up_safe<size_t>(insts_count * sizeof(_insts[0]), sizeof(size_t));
-  auto startids_size =
-    cudf::util::round_up_safe<size_t>(starts_count * sizeof(_startinst_ids[0]), sizeof(size_t));
-  auto classes_size =
-    cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
-  for (int32_t idx = 0; idx < classes_count; ++idx)
-    classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
-  size_t memsize  = insts_size + startids_size + classes_size;
-  size_t rlm_size = 0;
-  // check memory size needed for executing regex
-  if (insts_count > MAX_STACK_INSTS) {
-    auto relist_alloc_size = relist::alloc_size(insts_count);
-    rlm_size               = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
-    size_t freeSize        = 0;
-    size_t totalSize       = 0;
-    rmmGetInfo(&freeSize, &totalSize, stream);
-    if (rlm_size + memsize > freeSize)  // do not allocate more than we have
-    {                                   // otherwise, this is unrecoverable
-      std::ostringstream message;
-      message << "cuDF failure at: " __FILE__ ":" << __LINE__ << ": ";
-      message << "number of instructions (" << insts_count << ") ";
-      message << "and number of strings (" << strings_count << ") ";
-      message << "exceeds available memory";
-      throw cudf::logic_error(message.str());
+  auto& cache = program_cache::instance();
+  // the flags table pointer is appended to keep programs for each device distinct
+  std::string key = pattern;
+  key.append(reinterpret_cast<const char*>(&codepoint_flags), sizeof(codepoint_flags));
+  auto entry = cache.find(key);
+  if (!entry) {
+    entry = std::make_shared<cached_program>();
+    std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
+    // compile pattern into host object
+    reprog h_prog = reprog::create_from(pattern32.data());
+    // compute size to hold all the member data
+    auto insts_count   = h_prog.insts_count();
+    auto classes_count = h_prog.classes_count();
+    auto starts_count  = h_prog.starts_count();
+    // compute size of each section; make sure each is aligned appropriately
+    auto insts_size =
+      cudf::util::round_up_safe<size_t>(insts_count * sizeof(_insts[0]), sizeof(size_t));
+    auto startids_size =
+      cudf::util::round_up_safe<size_t>(starts_count * sizeof(_startinst_ids[0]), sizeof(size_t));
+    auto classes_size =
+      cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
+    for (int32_t idx = 0; idx < classes_count; ++idx)
+      classes_size +=
+        static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
+    // the literal required by all matches is stored as UTF-8 for a byte-wise scan
+    std::string literal;
+    for (auto const chr : h_prog.required_literal()) {
+      char buffer[sizeof(char_utf8)];
+      literal.append(buffer, from_char_utf8(chr, buffer));
     }
-  }
+    auto literal_size = cudf::util::round_up_safe<size_t>(literal.size(), sizeof(size_t));
+    size_t memsize    = insts_size + startids_size + classes_size + literal_size;
+
+    // allocate memory to store prog data
+    std::vector<u_char> h_buffer(memsize);
+    u_char* h_ptr   = h_buffer.data();  // running pointer
+    entry->d_buffer = std::make_unique<rmm::device_buffer>(memsize, stream);
+    u_char* d_ptr   = reinterpret_cast<u_char*>(entry->d_buffer->data());  // running device pointer
+    // put everything into a flat host buffer first
+    entry->prog.reset(new reprog_device(h_prog));
+    reprog_device* d_prog = entry->prog.get();
+    // copy the instructions array first (fixed-size structs)
+    reinst* insts = reinterpret_cast<reinst*>(h_ptr);
+    memcpy(insts, h_prog.insts_data(), insts_size);
+    h_ptr += insts_size;  // next section
+    d_prog->_insts = reinterpret_cast<reinst*>(d_ptr);
+    d_ptr += insts_size;
+    // copy the startinst_ids next (ints)
+    int32_t* startinst_ids = reinterpret_cast<int32_t*>(h_ptr);
+    memcpy(startinst_ids, h_prog.starts_data(), startids_size);
+    h_ptr += startids_size;  // next section
+    d_prog->_startinst_ids = reinterpret_cast<int32_t*>(d_ptr);
+    d_ptr += startids_size;
+    // copy classes into flat memory: [class1,class2,...][char32 arrays]
+    reclass_device* classes = reinterpret_cast<reclass_device*>(h_ptr);
+    d_prog->_classes        = reinterpret_cast<reclass_device*>(d_ptr);
+    // get pointer to the end to handle variable length data
+    u_char* h_end = h_ptr + (classes_count * sizeof(reclass_device));
+    u_char* d_end = d_ptr + (classes_count * sizeof(reclass_device));
+    // place each class and append the variable length data
+    for (int32_t idx = 0; idx < classes_count; ++idx) {
+      reclass& h_class = h_prog.class_at(idx);
+      reclass_device d_class;
+      d_class.builtins = h_class.builtins;
+      d_class.count    = h_class.literals.size() / 2;
+      d_class.literals = reinterpret_cast<char32_t*>(d_end);
+      memcpy(classes++, &d_class, sizeof(d_class));
+      memcpy(h_end, h_class.literals.c_str(), h_class.literals.size() * sizeof(char32_t));
+      h_end += h_class.literals.size() * sizeof(char32_t);
+      d_end += h_class.literals.size() * sizeof(char32_t);
+    }
+    // copy the required literal last
+    auto literal_offset = memsize - literal_size;
+    memcpy(h_buffer.data() + literal_offset, literal.data(), literal.size());
+    d_prog->_literal = reinterpret_cast<const char*>(entry->d_buffer->data()) + literal_offset;
 
-  // allocate memory to store prog data
-  std::vector<u_char> h_buffer(memsize);
-  u_char* h_ptr  = h_buffer.data();  // running pointer
-  auto* d_buffer = new rmm::device_buffer(memsize, stream);
-  u_char* d_ptr  = reinterpret_cast<u_char*>(d_buffer->data());  // running device pointer
-  // put everything into a flat host buffer first
-  reprog_device* d_prog = new reprog_device(h_prog);
-  // copy the instructions array first (fixed-size structs)
-  reinst* insts = reinterpret_cast<reinst*>(h_ptr);
-  memcpy(insts, h_prog.insts_data(), insts_size);
-  h_ptr += insts_size;  // next section
-  d_prog->_insts = reinterpret_cast<reinst*>(d_ptr);
-  d_ptr += insts_size;
-  // copy the startinst_ids next (ints)
-  int32_t* startinst_ids = reinterpret_cast<int32_t*>(h_ptr);
-  memcpy(startinst_ids, h_prog.starts_data(), startids_size);
-  h_ptr += startids_size;  // next section
-  d_prog->_startinst_ids = reinterpret_cast<int32_t*>(d_ptr);
-  d_ptr += startids_size;
-  // copy classes into flat memory: [class1,class2,...][char32 arrays]
-  reclass_device* classes = reinterpret_cast<reclass_device*>(h_ptr);
-  d_prog->_classes        = reinterpret_cast<reclass_device*>(d_ptr);
-  // get pointer to the end to handle variable length data
-  u_char* h_end = h_ptr + (classes_count * sizeof(reclass_device));
-  u_char* d_end = d_ptr + (classes_count * sizeof(reclass_device));
-  // place each class and append the variable length data
-  for (int32_t idx = 0; idx < classes_count; ++idx) {
-    reclass& h_class = h_prog.class_at(idx);
-    reclass_device d_class;
-    d_class.builtins = h_class.builtins;
-    d_class.count    = h_class.literals.size() / 2;
-    d_class.literals = reinterpret_cast<char32_t*>(d_end);
-    memcpy(classes++, &d_class, sizeof(d_class));
-    memcpy(h_end, h_class.literals.c_str(), h_class.literals.size() * sizeof(char32_t));
-    h_end += h_class.literals.size() * sizeof(char32_t);
-    d_end += h_class.literals.size() * sizeof(char32_t);
+    // initialize the rest of the elements
+    d_prog->_literal_bytes   = static_cast<int32_t>(literal.size());
+    d_prog->_insts_count     = insts_count;
+    d_prog->_starts_count    = starts_count;
+    d_prog->_classes_count   = classes_count;
+    d_prog->_codepoint_flags = codepoint_flags;
+
+    // copy flat prog to device memory; the cached program may be used next on another stream
+    CUDA_TRY(cudaMemcpyAsync(
+      entry->d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    cache.insert(key, entry);
   }
-  // initialize the rest of the elements
-  d_prog->_insts_count     = insts_count;
-  d_prog->_starts_count    = starts_count;
-  d_prog->_classes_count   = classes_count;
-  d_prog->_codepoint_flags = codepoint_flags;
+
+  reprog_device* d_prog = new reprog_device(*entry->prog);
+  auto insts_count      = d_prog->_insts_count;
+  d_prog->_relists_rows = std::numeric_limits<int32_t>::max();  // state data is on the stack
   // allocate execute memory if needed
   rmm::device_buffer* d_relists{};
-  if (rlm_size > 0) {
-    d_relists            = new rmm::device_buffer(rlm_size, stream);
-    d_prog->_relists_mem = d_relists->data();
+  bool cached_relists = false;
+  if (insts_count > MAX_STACK_INSTS) {
+    auto relist_alloc_size = relist::alloc_size(insts_count);
+    // bound the memory by evaluating large columns in tiles of rows
+    size_t max_rows       = RX_MAX_WORKING_MEMORY / (relist_alloc_size * 2L);
+    d_prog->_relists_rows = static_cast<int32_t>(
+      std::max<size_t>(1, std::min<size_t>(max_rows, static_cast<size_t>(strings_count))));
+    // reljunk has 2 relist ptrs
+    size_t rlm_size      = relist_alloc_size * 2L * d_prog->_relists_rows;
+    d_prog->_relists_mem = cache.reuse_relists(*entry, rlm_size, stream);
+    cached_relists       = (d_prog->_relists_mem != nullptr);
+    if (!cached_relists) {
+      // check memory size needed for executing regex
+      size_t freeSize  = 0;
+      size_t totalSize = 0;
+      rmmGetInfo(&freeSize, &totalSize, stream);
+      if (rlm_size > freeSize)  // do not allocate more than we have
+      {                         // otherwise, this is unrecoverable
+        delete d_prog;
+        std::ostringstream message;
+        message << "cuDF failure at: " __FILE__ ":" << __LINE__ << ": ";
+        message << "number of instructions (" << insts_count << ") ";
+        message << "and number of strings (" << strings_count << ") ";
+        message << "exceeds available memory";
+        throw cudf::logic_error(message.str());
+      }
+      auto buffer          = std::make_unique<rmm::device_buffer>(rlm_size, stream);
+      d_prog->_relists_mem = buffer->data();
+      cached_relists       = cache.adopt_relists(*entry, buffer, stream);
+      d_relists            = buffer.release();  // null if the cache took it
+    }
   }
 
-  // copy flat prog to device memory
-  CUDA_TRY(cudaMemcpy(d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice));
   //
-  auto deleter = [d_buffer, d_relists](reprog_device* t) {
+  auto deleter = [entry, d_relists, cached_relists](reprog_device* t) {
     t->destroy();
-    delete d_buffer;
     delete d_relists;
+    if (cached_relists) program_cache::instance().release_relists(*entry);
   };
   return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
 }
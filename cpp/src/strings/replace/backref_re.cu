@@ -97,6 +97,21 @@ std::unique_ptr<column> replace_with_backrefs(
   auto d_prog = *prog;
   auto regex_insts = d_prog.insts_counts();
 
+  // columns too large for the working memory of the program are replaced in tiles
+  auto const tile_rows = d_prog.working_memory_rows();
+  if (tile_rows < strings_count) {
+    prog.reset();  // each tile gets the compiled program from the cache
+    return transform_tiles(
+      strings,
+      tile_rows,
+      [&](strings_column_view const& tile) {
+        return replace_with_backrefs(tile, pattern, repl, rmm::mr::get_default_resource(), stream);
+      },
+      mr,
+      stream);
+  }
+  cudf::thread_range tier_range{regex_tier_name(regex_insts)};
+
   // parse the repl string for backref indicators
   std::vector<backref_type> h_backrefs;
   std::string repl_template = parse_backrefs(repl, h_backrefs);
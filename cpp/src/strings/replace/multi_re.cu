@@ -145,17 +145,33 @@ std::unique_ptr<column> replace_re(
   auto d_flags        = get_character_flags_table();
   // compile regexes into device objects
   size_type regex_insts = 0;
+  size_type tile_rows   = strings_count;
   std::vector<std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>> h_progs;
   rmm::device_vector<reprog_device> progs;
   for (auto itr = patterns.begin(); itr != patterns.end(); ++itr) {
     auto prog  = reprog_device::create(*itr, d_flags, strings_count, stream);
     auto insts = prog->insts_counts();
     if (insts > regex_insts) regex_insts = insts;
+    tile_rows = std::min(tile_rows, prog->working_memory_rows());
     progs.push_back(*prog);
     h_progs.emplace_back(std::move(prog));
   }
   auto d_progs = progs.data().get();
 
+  // columns too large for the working memory of the programs are replaced in tiles
+  if (tile_rows < strings_count) {
+    h_progs.clear();  // each tile gets the compiled programs from the cache
+    return transform_tiles(
+      strings,
+      tile_rows,
+      [&](strings_column_view const& tile) {
+        return replace_re(tile, patterns, repls, rmm::mr::get_default_resource(), stream);
+      },
+      mr,
+      stream);
+  }
+  cudf::thread_range tier_range{regex_tier_name(regex_insts)};
+
   // copy null mask
   auto null_mask  = copy_bitmask(strings.parent());
   auto null_count = strings.null_count();
@@ -23,6 +23,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
+#include <strings/warp_utilities.cuh>
 
 namespace cudf {
 namespace strings {
@@ -75,7 +76,7 @@ struct replace_fn {
         out_ptr = copy_string(out_ptr, d_repl);                                         // copy repl
         last_pos = curr_pos + d_target.size_bytes();
       }
-      position = d_str.find(d_target, position + d_target.size_bytes());
+      position = d_str.find(d_target, position + d_target.length());
       --max_n;
     }
     if (Pass == two_pass::EXECUTE_OP)  // copy whats left (or right depending on your point of view)
@@ -84,6 +85,77 @@ struct replace_fn {
   }
 };
 
+/**
+ * @brief Kernel for the replace API using one warp per string.
+ *
+ * The warp tests 32 consecutive byte positions per step and keeps the leftmost
+ * non-overlapping matches, which every lane derives from the same ballot.
+ * Each lane then writes its own byte to the position shifted by the size
+ * difference of the replacements before it.
+ *
+ * @tparam Pass Compute the output sizes only or fill in the output characters.
+ *
+ * @param d_strings Strings to replace within.
+ * @param d_target Non-empty string to replace.
+ * @param d_repl Replacement string.
+ * @param max_repl Maximum number of replacements per string; all if negative.
+ * @param d_sizes Output size in bytes of each string for `SIZE_ONLY`.
+ * @param d_offsets Output offsets for `EXECUTE_OP`.
+ * @param d_chars Output characters for `EXECUTE_OP`.
+ */
+template <two_pass Pass>
+__global__ void replace_warp_parallel_fn(column_device_view const d_strings,
+                                         string_view const d_target,
+                                         string_view const d_repl,
+                                         int32_t max_repl,
+                                         size_type* d_sizes,
+                                         int32_t const* d_offsets,
+                                         char* d_chars)
+{
+  auto const idx = static_cast<size_type>((threadIdx.x + blockIdx.x * blockDim.x) /
+                                          cudf::detail::warp_size);
+  if (idx >= d_strings.size()) return;
+  auto const lane = threadIdx.x % cudf::detail::warp_size;
+  if (d_strings.is_null(idx)) {
+    if ((Pass == two_pass::SIZE_ONLY) && (lane == 0)) d_sizes[idx] = 0;
+    return;
+  }
+  auto const d_str     = d_strings.element<string_view>(idx);
+  auto const bytes     = d_str.size_bytes();
+  auto const tgt_bytes = d_target.size_bytes();
+  auto const delta     = d_repl.size_bytes() - tgt_bytes;
+  char* out_ptr        = nullptr;
+  if (Pass == two_pass::EXECUTE_OP) out_ptr = d_chars + d_offsets[idx];
+  size_type count    = 0;  // replacements before this step
+  size_type next_pos = 0;  // matches may not start before the end of the previous one
+  for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+    auto const pos = base + static_cast<size_type>(lane);
+    auto const more = (max_repl < 0) || (count < max_repl);
+    auto matches    = __ballot_sync(
+      full_warp_mask, more && (pos >= next_pos) && is_match_at(d_str, pos, d_target));
+    uint32_t selected = 0;
+    while (matches && ((max_repl < 0) || (count + __popc(selected) < max_repl))) {
+      auto const bit = __ffs(matches) - 1;
+      selected |= 1u << bit;
+      auto const end = bit + tgt_bytes;  // drop the matches overlapping this one
+      matches &= (end < cudf::detail::warp_size) ? (full_warp_mask << end) : 0;
+    }
+    if ((Pass == two_pass::EXECUTE_OP) && (pos < bytes)) {
+      auto const prior = selected & ((2u << lane) - 1);  // matches at or before this byte
+      auto const n     = count + __popc(prior);
+      auto const start = prior ? base + 31 - __clz(prior) : 0;  // last of those matches
+      if (prior && (pos == start))
+        copy_string(out_ptr + pos + (n - 1) * delta, d_repl);
+      else if ((pos >= next_pos) && (!prior || (pos >= start + tgt_bytes)))
+        out_ptr[pos + n * delta] = d_str.data()[pos];
+    }
+    if (selected) next_pos = base + 31 - __clz(selected) + tgt_bytes;
+    count += __popc(selected);
+    if ((Pass == two_pass::SIZE_ONLY) && (max_repl >= 0) && (count >= max_repl)) break;
+  }
+  if ((Pass == two_pass::SIZE_ONLY) && (lane == 0)) d_sizes[idx] = bytes + count * delta;
+}
+
 }  // namespace
 
 //
@@ -109,12 +181,25 @@ std::unique_ptr<column> replace(
 
   // copy the null mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
+  // long strings are processed with a warp per string
+  bool const warp_parallel = average_string_bytes(strings, stream) >= warp_per_string_threshold;
+  constexpr size_type block_size{256};
+  constexpr size_type warps_per_block{block_size / cudf::detail::warp_size};
+  auto const num_blocks = (strings_count + warps_per_block - 1) / warps_per_block;
   // build offsets column
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<int32_t>(0),
-    replace_fn<two_pass::SIZE_ONLY>{d_strings, d_target, d_repl, maxrepl});
-  auto offsets_column = make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
+  std::unique_ptr<column> offsets_column;
+  if (warp_parallel) {
+    rmm::device_vector<size_type> sizes(strings_count);
+    replace_warp_parallel_fn<two_pass::SIZE_ONLY><<<num_blocks, block_size, 0, stream>>>(
+      d_strings, d_target, d_repl, maxrepl, sizes.data().get(), nullptr, nullptr);
+    offsets_column = make_offsets_child_column(sizes.begin(), sizes.end(), mr, stream);
+  } else {
+    auto offsets_transformer_itr = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<int32_t>(0),
+      replace_fn<two_pass::SIZE_ONLY>{d_strings, d_target, d_repl, maxrepl});
+    offsets_column = make_offsets_child_column(
+      offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
+  }
   auto d_offsets = offsets_column->view().data<int32_t>();
 
   // build chars column
@@ -122,11 +207,16 @@ std::unique_ptr<column> replace(
   auto chars_column =
     create_chars_child_column(strings_count, strings.null_count(), bytes, mr, stream);
   auto d_chars = chars_column->mutable_view().data<char>();
-  thrust::for_each_n(
-    rmm::exec_policy(stream)->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    strings_count,
-    replace_fn<two_pass::EXECUTE_OP>{d_strings, d_target, d_repl, maxrepl, d_offsets, d_chars});
+  if (warp_parallel) {
+    replace_warp_parallel_fn<two_pass::EXECUTE_OP><<<num_blocks, block_size, 0, stream>>>(
+      d_strings, d_target, d_repl, maxrepl, nullptr, d_offsets, d_chars);
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      replace_fn<two_pass::EXECUTE_OP>{d_strings, d_target, d_repl, maxrepl, d_offsets, d_chars});
+  }
   //
   return make_strings_column(strings_count,
                              std::move(offsets_column),
@@ -27,6 +27,8 @@
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
+#include <limits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -95,6 +97,28 @@ struct replace_regex_fn {
   }
 };
 
+/**
+ * @brief Upper bound of the size of each string output by `replace_regex_fn`.
+ *
+ * Each of the matches, no more than `maxrepl` nor one per byte of the
+ * string, may add the bytes of the replacement.
+ */
+struct replace_regex_bound_fn {
+  column_device_view const d_strings;
+  size_type const repl_bytes;
+  size_type const maxrepl;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return 0;
+    int64_t const bytes   = d_strings.element<string_view>(idx).size_bytes();
+    int64_t const matches = ((maxrepl < 0) || (maxrepl > bytes)) ? bytes : maxrepl;
+    int64_t const bound   = bytes + matches * repl_bytes;
+    int64_t constexpr max_bytes{std::numeric_limits<size_type>::max()};
+    return static_cast<size_type>(bound < max_bytes ? bound : max_bytes);
+  }
+};
+
 }  // namespace
 
 //
@@ -119,10 +143,30 @@ std::unique_ptr<column> replace_re(
   auto d_prog = *prog;
   auto regex_insts = d_prog.insts_counts();
 
+  // columns too large for the working memory of the program are replaced in tiles
+  auto const tile_rows = d_prog.working_memory_rows();
+  if (tile_rows < strings_count) {
+    prog.reset();  // each tile gets the compiled program from the cache
+    return transform_tiles(
+      strings,
+      tile_rows,
+      [&](strings_column_view const& tile) {
+        return replace_re(tile, pattern, repl, maxrepl, rmm::mr::get_default_resource(), stream);
+      },
+      mr,
+      stream);
+  }
+  cudf::thread_range tier_range{regex_tier_name(regex_insts)};
+
   // copy null mask
   auto null_mask  = copy_bitmask(strings.parent());
   auto null_count = strings.null_count();
 
+  // the strings are written in one pass into space for their largest possible size
+  // while that is within twice the input size, e.g. for short or empty replacements
+  auto const bound_fn          = replace_regex_bound_fn{d_strings, d_repl.size_bytes(), maxrepl};
+  auto const max_scratch_bytes = 2 * static_cast<std::size_t>(strings.chars_size());
+
   // create child columns
   std::pair<std::unique_ptr<column>, std::unique_ptr<column>> children(nullptr, nullptr);
   // Each invocation is predicated on the stack size which is dependent on the number of regex
@@ -130,24 +174,30 @@ std::unique_ptr<column> replace_re(
   if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
     children =
       make_strings_children(replace_regex_fn<RX_STACK_SMALL>{d_strings, d_prog, d_repl, maxrepl},
+                            bound_fn,
                             strings_count,
                             null_count,
                             mr,
-                            stream);
+                            stream,
+                            max_scratch_bytes);
   else if (regex_insts <= RX_MEDIUM_INSTS)
     children =
       make_strings_children(replace_regex_fn<RX_STACK_MEDIUM>{d_strings, d_prog, d_repl, maxrepl},
+                            bound_fn,
                             strings_count,
                             null_count,
                             mr,
-                            stream);
+                            stream,
+                            max_scratch_bytes);
   else
     children =
       make_strings_children(replace_regex_fn<RX_STACK_LARGE>{d_strings, d_prog, d_repl, maxrepl},
+                            bound_fn,
                             strings_count,
                             null_count,
                             mr,
-                            stream);
+                            stream,
+                            max_scratch_bytes);
   //
   return make_strings_column(strings_count,
                              std::move(children.first),
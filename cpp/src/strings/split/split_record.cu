@@ -16,12 +16,16 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/split/split.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/transform.h>
 #include <vector>
 
@@ -388,7 +392,164 @@ struct whitespace_token_copier_fn {
   }
 };
 
-// Generic split function used by split_record and rsplit_record
+using string_index_pair = thrust::pair<const char*, size_type>;
+
+/**
+ * @brief Locate the tokens of the `idx'th` string element of `d_strings` and store
+ * their positions in `d_tokens`.
+ *
+ * The number of tokens for each string is known from `token_reader_fn` and is
+ * given by `d_offsets`.
+ */
+template <Dir dir>
+struct token_pairs_fn {
+  column_device_view const d_strings;  // strings to split
+  string_view const d_delimiter;       // delimiter for split
+  int32_t const* d_offsets{};          // token index offsets for each string
+  string_index_pair* d_tokens{};       // token positions
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto const token_count = d_offsets[idx + 1] - d_offsets[idx];
+    if (token_count == 0) { return; }
+    auto const d_str     = d_strings.element<string_view>(idx);
+    auto const d_output  = d_tokens + d_offsets[idx];
+    size_type token_idx  = 0;
+    size_type start_pos  = 0;               // updates only if moving forward
+    auto end_pos         = d_str.length();  // updates only if moving backward
+    auto const add_token = [&](size_type begin, size_type end) {
+      auto const spos = d_str.byte_offset(begin);
+      auto const epos = d_str.byte_offset(end);
+      auto const out  = dir == Dir::FORWARD ? token_idx : token_count - 1 - token_idx;
+      d_output[out]   = string_index_pair{d_str.data() + spos, epos - spos};
+      ++token_idx;
+    };
+    while (token_idx < token_count - 1) {
+      auto const delimiter_pos = dir == Dir::FORWARD ? d_str.find(d_delimiter, start_pos)
+                                                     : d_str.rfind(d_delimiter, start_pos, end_pos);
+      if (dir == Dir::FORWARD) {
+        add_token(start_pos, delimiter_pos);
+        start_pos = delimiter_pos + d_delimiter.length();
+      } else {
+        add_token(delimiter_pos + d_delimiter.length(), end_pos);
+        end_pos = delimiter_pos;
+      }
+    }
+    add_token(start_pos, end_pos);
+  }
+};
+
+/**
+ * @brief Locate the whitespace-delimited tokens of the `idx'th` string element of
+ * `d_strings` and store their positions in `d_tokens`.
+ *
+ * The number of tokens for each string is known from `whitespace_token_reader_fn`
+ * and is given by `d_offsets`.
+ */
+template <Dir dir>
+struct whitespace_token_pairs_fn {
+  column_device_view const d_strings;  // strings to split
+  size_type const max_tokens = std::numeric_limits<size_type>::max();
+  int32_t const* d_offsets{};     // token index offsets for each string
+  string_index_pair* d_tokens{};  // token positions
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto const token_count = d_offsets[idx + 1] - d_offsets[idx];
+    if (token_count == 0) { return; }
+    auto const d_str       = d_strings.element<string_view>(idx);
+    auto const d_output    = d_tokens + d_offsets[idx];
+    size_type token_idx     = 0;
+    auto spaces             = true;
+    auto reached_max_tokens = false;
+    size_type to_token_pos  = 0;
+    auto const add_token    = [&](size_type begin, size_type end) {
+      auto const spos = d_str.byte_offset(begin);
+      auto const epos = d_str.byte_offset(end);
+      auto const out  = dir == Dir::FORWARD ? token_idx : token_count - 1 - token_idx;
+      d_output[out]   = string_index_pair{d_str.data() + spos, epos - spos};
+      ++token_idx;
+    };
+    for (size_type i = 0; i < d_str.length(); ++i) {
+      auto const cur_pos = dir == Dir::FORWARD ? i : d_str.length() - 1 - i;
+      auto const ch      = d_str[cur_pos];
+      if (spaces != (ch <= ' ')) {
+        if (spaces) {  // from whitespace(s) to a new token
+          to_token_pos = cur_pos;
+        } else {  // from a token to whitespace(s)
+          if (token_idx < max_tokens - 1) {
+            if (dir == Dir::FORWARD) {
+              add_token(to_token_pos, cur_pos);
+            } else {
+              add_token(cur_pos + 1, to_token_pos + 1);
+            }
+          } else {
+            reached_max_tokens = true;
+            break;
+          }
+        }
+        spaces = !spaces;
+      }
+    }
+    // the last token includes the remainder of the string
+    if (reached_max_tokens || !spaces) {
+      if (dir == Dir::FORWARD) {
+        add_token(to_token_pos, d_str.length());
+      } else {
+        add_token(0, to_token_pos + 1);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Generic split function used by split_record and rsplit_record
+ *
+ * The tokens of all the strings are gathered into a single strings column and
+ * the token counts become the offsets of the LIST column rows.
+ */
+template <typename TokenReader, typename TokenPairs>
+std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
+                                        TokenReader reader,
+                                        TokenPairs pairs,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto execpol             = rmm::exec_policy(stream);
+
+  // count the tokens in each string and convert the counts into offsets
+  auto offsets   = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    d_offsets,
+                    [reader] __device__(size_type idx) { return thrust::get<0>(reader(idx)); });
+  CUDA_TRY(cudaMemsetAsync(d_offsets + strings_count, 0, sizeof(int32_t), stream));
+  thrust::exclusive_scan(execpol->on(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+  auto const total_tokens =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+
+  // locate the tokens in place and build the child strings column from them
+  rmm::device_vector<string_index_pair> tokens(total_tokens);
+  pairs.d_offsets = d_offsets;
+  pairs.d_tokens  = tokens.data().get();
+  thrust::for_each_n(
+    execpol->on(stream), thrust::make_counting_iterator<size_type>(0), strings_count, pairs);
+  auto child = make_strings_column(tokens, stream, mr);
+
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(child),
+                           strings.null_count(),
+                           copy_bitmask(strings.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
+// Generic split function used by contiguous_split_record and contiguous_rsplit_record
 template <typename TokenReader, typename TokenCopier>
 contiguous_split_record_result contiguous_split_record_fn(strings_column_view const& strings,
                                                           TokenReader reader,
@@ -509,10 +670,61 @@ contiguous_split_record_result contiguous_split_record(
   }
 }
 
+template <Dir dir>
+std::unique_ptr<column> split_record(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+
+  // makes consistent with Pandas
+  size_type max_tokens = maxsplit > 0 ? maxsplit + 1 : std::numeric_limits<size_type>::max();
+  auto has_validity    = strings.parent().nullable();
+
+  auto d_strings_column_ptr = column_device_view::create(strings.parent(), stream);
+  if (delimiter.size() == 0) {
+    return split_record_fn(
+      strings,
+      whitespace_token_reader_fn<dir>{*d_strings_column_ptr, max_tokens, has_validity},
+      whitespace_token_pairs_fn<dir>{*d_strings_column_ptr, max_tokens},
+      mr,
+      stream);
+  } else {
+    string_view d_delimiter(delimiter.data(), delimiter.size());
+    return split_record_fn(
+      strings,
+      token_reader_fn<dir>{*d_strings_column_ptr, d_delimiter, max_tokens, has_validity},
+      token_pairs_fn<dir>{*d_strings_column_ptr, d_delimiter},
+      mr,
+      stream);
+  }
+}
+
 }  // namespace detail
 
 // external APIs
 
+std::unique_ptr<column> split_record(strings_column_view const& strings,
+                                     string_scalar const& delimiter,
+                                     size_type maxsplit,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_record<detail::Dir::FORWARD>(strings, delimiter, maxsplit, mr, 0);
+}
+
+std::unique_ptr<column> rsplit_record(strings_column_view const& strings,
+                                      string_scalar const& delimiter,
+                                      size_type maxsplit,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_record<detail::Dir::BACKWARD>(strings, delimiter, maxsplit, mr, 0);
+}
+
 contiguous_split_record_result contiguous_split_record(strings_column_view const& strings,
                                                        string_scalar const& delimiter,
                                                        size_type maxsplit,
@@ -54,16 +54,54 @@ namespace {
 struct substring_fn {
   const column_device_view d_column;
   numeric_scalar_device_view<size_type> d_start, d_stop, d_step;
+  bool const ascii;
   const int32_t* d_offsets{};
   char* d_chars{};
 
+  /**
+   * @brief Substring of an ASCII string, whose character positions are its byte offsets.
+   */
+  __device__ cudf::size_type ascii_substring(string_view const& d_str,
+                                             size_type step,
+                                             char* d_buffer)
+  {
+    auto const length = d_str.size_bytes();
+    auto const begin  = [&] {  // always inclusive
+      if (!d_start.is_valid()) return (step > 0) ? 0 : (length - 1);
+      auto start = d_start.value();
+      if (start >= 0) return (start < length) ? start : length + (step < 0 ? -1 : 0);
+      auto adjust = length + start;
+      return (adjust >= 0) ? adjust : (step < 0 ? -1 : 0);
+    }();
+    auto const end = [&] {  // always exclusive
+      if (!d_stop.is_valid()) return step > 0 ? length : -1;
+      auto stop = d_stop.value();
+      if (stop >= 0) return (stop < length) ? stop : length;
+      auto adjust = length + stop;
+      return (adjust >= 0) ? adjust : -1;
+    }();
+    if (step > 0 ? begin >= end : end >= begin) return 0;
+
+    size_type const bytes =
+      step > 0 ? (end - begin + step - 1) / step : (begin - end - step - 1) / -step;
+    if (d_buffer) {
+      if (step == 1) {
+        memcpy(d_buffer, d_str.data() + begin, bytes);
+      } else {
+        for (size_type i = 0; i < bytes; ++i) d_buffer[i] = d_str.data()[begin + i * step];
+      }
+    }
+    return bytes;
+  }
+
   __device__ cudf::size_type operator()(size_type idx)
   {
     if (d_column.is_null(idx)) return 0;  // null string
     string_view d_str = d_column.template element<string_view>(idx);
+    size_type const step = d_step.is_valid() ? d_step.value() : 1;
+    if (ascii) return ascii_substring(d_str, step, d_chars ? d_chars + d_offsets[idx] : nullptr);
     auto const length = d_str.length();
     if (length == 0) return 0;  // empty string
-    size_type const step = d_step.is_valid() ? d_step.value() : 1;
     auto const begin     = [&] {  // always inclusive
       // when invalid, default depends on step
       if (!d_start.is_valid()) return (step > 0) ? d_str.begin() : (d_str.end() - 1);
@@ -122,13 +160,15 @@ std::unique_ptr<column> slice_strings(
   auto d_start        = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(start));
   auto d_stop         = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(stop));
   auto d_step         = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(step));
+  auto const ascii    = is_ascii(strings, stream);
 
   // copy the null mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
 
   // build offsets column
   auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<int32_t>(0), substring_fn{d_column, d_start, d_stop, d_step});
+    thrust::make_counting_iterator<int32_t>(0),
+    substring_fn{d_column, d_start, d_stop, d_step, ascii});
   auto offsets_column = make_offsets_child_column(
     offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
   auto d_new_offsets = offsets_column->view().data<int32_t>();
@@ -138,10 +178,11 @@ std::unique_ptr<column> slice_strings(
   auto chars_column = strings::detail::create_chars_child_column(
     strings_count, strings.null_count(), bytes, mr, stream);
   auto d_chars = chars_column->mutable_view().data<char>();
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     strings_count,
-                     substring_fn{d_column, d_start, d_stop, d_step, d_new_offsets, d_chars});
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    substring_fn{d_column, d_start, d_stop, d_step, ascii, d_new_offsets, d_chars});
   //
   return make_strings_column(strings_count,
                              std::move(offsets_column),
@@ -173,6 +214,7 @@ struct substring_from_fn {
   const column_device_view d_column;
   const PositionType* starts;
   const PositionType* stops;
+  bool const ascii;
   const int32_t* d_offsets{};
   char* d_chars{};
 
@@ -183,7 +225,7 @@ struct substring_from_fn {
   __device__ size_type operator()(size_type idx)
   {
     if (d_column.is_null(idx)) return 0;  // null string
-    string_view d_str = d_column.template element<string_view>(idx);
+    string_view d_str = string_at(d_column, idx, ascii);
     size_type length  = d_str.length();
     size_type start   = static_cast<size_type>(starts[idx]);
     if (start >= length) return 0;  // empty string
@@ -207,6 +249,7 @@ struct compute_substrings_from_fn {
   template <typename PositionType>
   std::unique_ptr<column> operator()(column_device_view const& d_column,
                                      size_type null_count,
+                                     bool ascii,
                                      PositionType const* starts,
                                      PositionType const* stops,
                                      rmm::mr::device_memory_resource* mr,
@@ -221,9 +264,9 @@ struct compute_substrings_from_fn {
         d_column.null_mask(), cudf::bitmask_allocation_size_bytes(strings_count), stream, mr);
 
     // Build offsets column
-    auto offsets_transformer_itr =
-      thrust::make_transform_iterator(thrust::make_counting_iterator<PositionType>(0),
-                                      substring_from_fn<PositionType>{d_column, starts, stops});
+    auto offsets_transformer_itr = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<PositionType>(0),
+      substring_from_fn<PositionType>{d_column, starts, stops, ascii});
     auto offsets_column = cudf::strings::detail::make_offsets_child_column(
       offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
     auto offsets_view  = offsets_column->view();
@@ -239,7 +282,8 @@ struct compute_substrings_from_fn {
       rmm::exec_policy(stream)->on(stream),
       thrust::make_counting_iterator<cudf::size_type>(0),
       strings_count,
-      substring_from_fn<PositionType, ExecuteOp>{d_column, starts, stops, d_new_offsets, d_chars});
+      substring_from_fn<PositionType, ExecuteOp>{
+        d_column, starts, stops, ascii, d_new_offsets, d_chars});
 
     return make_strings_column(strings_count,
                                std::move(offsets_column),
@@ -259,6 +303,7 @@ struct compute_substrings {
             std::enable_if_t<std::is_integral<PositionType>::value>* = nullptr>
   std::unique_ptr<column> operator()(column_device_view const& d_column,
                                      size_type null_count,
+                                     bool ascii,
                                      column_view const& starts_column,
                                      column_view const& stops_column,
                                      rmm::mr::device_memory_resource* mr,
@@ -266,6 +311,7 @@ struct compute_substrings {
   {
     return compute_substrings_from_fn{}(d_column,
                                         null_count,
+                                        ascii,
                                         starts_column.data<PositionType>(),
                                         stops_column.data<PositionType>(),
                                         mr,
@@ -276,6 +322,7 @@ struct compute_substrings {
             std::enable_if_t<not std::is_integral<PositionType>::value>* = nullptr>
   std::unique_ptr<column> operator()(column_device_view const& d_column,
                                      size_type null_count,
+                                     bool ascii,
                                      column_view const& starts_column,
                                      column_view const& stops_column,
                                      rmm::mr::device_memory_resource* mr,
@@ -377,6 +424,7 @@ std::unique_ptr<column> slice_strings(
                                compute_substrings{},
                                d_column,
                                strings.null_count(),
+                               is_ascii(strings, stream),
                                starts_column,
                                stops_column,
                                mr,
@@ -411,8 +459,13 @@ std::unique_ptr<column> slice_strings(strings_column_view const& strings,
   }
 
   // Extract the substrings using the indices next
-  return compute_substrings_from_fn{}(
-    d_column, strings.null_count(), start_char_pos, end_char_pos, mr, stream);
+  return compute_substrings_from_fn{}(d_column,
+                                      strings.null_count(),
+                                      is_ascii(strings, stream),
+                                      start_char_pos,
+                                      end_char_pos,
+                                      mr,
+                                      stream);
 }
 
 }  // namespace detail
@@ -27,6 +27,7 @@
 #include <rmm/rmm.h>
 #include <rmm/rmm_api.h>
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/logical.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
 #include <mutex>
@@ -113,6 +114,32 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(
   return chars_column;
 }
 
+//
+bool is_ascii(strings_column_view const& strings, cudaStream_t stream)
+{
+  if (strings.size() == 0) return true;
+  auto const d_offsets = thrust::device_pointer_cast(strings.offsets().data<int32_t>()) +
+                         strings.offset();
+  int32_t const begin  = d_offsets[0];
+  int32_t const end    = d_offsets[strings.size()];
+  auto const d_chars   = reinterpret_cast<uint8_t const*>(strings.chars().data<char>());
+  return thrust::all_of(rmm::exec_policy(stream)->on(stream),
+                        d_chars + begin,
+                        d_chars + end,
+                        [] __device__(uint8_t byte) { return byte < 0x80; });
+}
+
+//
+size_type average_string_bytes(strings_column_view const& strings, cudaStream_t stream)
+{
+  if (strings.size() == 0) return 0;
+  auto const d_offsets = thrust::device_pointer_cast(strings.offsets().data<int32_t>()) +
+                         strings.offset();
+  int32_t const begin  = d_offsets[0];
+  int32_t const end    = d_offsets[strings.size()];
+  return (end - begin) / strings.size();
+}
+
 //
 std::unique_ptr<column> create_chars_child_column(cudf::size_type strings_count,
                                                   cudf::size_type null_count,
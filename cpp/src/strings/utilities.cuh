@@ -15,12 +15,18 @@
  */
 #pragma once
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/string_view.cuh>
 
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
 #include <cstring>
+#include <limits>
 
 namespace cudf {
 namespace strings {
@@ -53,6 +59,23 @@ __device__ inline char* copy_string(char* buffer, const string_view& d_string)
   return copy_and_increment(buffer, d_string.data(), d_string.size_bytes());
 }
 
+/**
+ * @brief Returns the string of a non-null row of a strings column.
+ *
+ * @param d_strings Strings column
+ * @param idx Row of the string
+ * @param ascii Whether the strings are known to be ASCII, in which case the
+ * character positions of the string are its byte offsets
+ * @return The string of row `idx`
+ */
+__device__ inline string_view string_at(column_device_view const& d_strings,
+                                        size_type idx,
+                                        bool ascii)
+{
+  auto const d_str = d_strings.element<string_view>(idx);
+  return ascii ? string_view::from_ascii(d_str.data(), d_str.size_bytes()) : d_str;
+}
+
 /**
  * @brief Creates child offsets and chars columns by applying the template function that
  * can be used for computing the output size of each string as well as create the output.
@@ -94,6 +117,89 @@ auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
   return std::make_pair(std::move(offsets_column), std::move(chars_column));
 }
 
+/**
+ * @brief Creates child offsets and chars columns by applying the template function once,
+ * writing each string into space reserved from an upper bound of its size.
+ *
+ * The strings are written into a scratch buffer laid out by the bounds and
+ * then compacted into the chars column, so `size_and_exec_fn` runs only once
+ * instead of once for the sizes and again for the output. This pays off for
+ * transforms more expensive than the copy, when their output size can be
+ * bounded from the input. Falls back to the two passes of
+ * `make_strings_children` if the bounds add up to more than `max_scratch_bytes`.
+ *
+ * @tparam SizeAndExecuteFunction Function as for `make_strings_children`, which
+ *         must also return the size of the string it writes.
+ * @tparam BoundFunction Function returning an upper bound of the output size
+ *         in bytes of the string at a given index.
+ *
+ * @param size_and_exec_fn Function computing and writing each output string.
+ * @param bound_fn Upper bound of the size of each output string.
+ * @param strings_count Number of strings.
+ * @param null_count Number of nulls in the strings column.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param max_scratch_bytes Largest scratch buffer to write into.
+ * @return offsets child column and chars child column for a strings column
+ */
+template <typename SizeAndExecuteFunction, typename BoundFunction>
+auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
+                           BoundFunction bound_fn,
+                           size_type strings_count,
+                           size_type null_count,
+                           rmm::mr::device_memory_resource* mr,
+                           cudaStream_t stream,
+                           std::size_t max_scratch_bytes = std::numeric_limits<size_type>::max())
+{
+  auto execpol = rmm::exec_policy(stream);
+  auto bounds =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), bound_fn);
+  std::size_t const scratch_bytes = thrust::transform_reduce(
+    execpol->on(stream),
+    bounds,
+    bounds + strings_count,
+    [] __device__(size_type bytes) { return static_cast<std::size_t>(bytes); },
+    std::size_t{0},
+    thrust::plus<std::size_t>());
+  if (scratch_bytes >
+      std::min<std::size_t>(max_scratch_bytes, std::numeric_limits<size_type>::max()))
+    return make_strings_children(size_and_exec_fn, strings_count, null_count, mr, stream);
+
+  // write each string at the offset of its bound
+  rmm::device_vector<int32_t> scratch_offsets(strings_count + 1, 0);
+  thrust::inclusive_scan(
+    execpol->on(stream), bounds, bounds + strings_count, scratch_offsets.begin() + 1);
+  rmm::device_buffer scratch(scratch_bytes, stream);
+  size_and_exec_fn.d_offsets = scratch_offsets.data().get();
+  size_and_exec_fn.d_chars   = static_cast<char*>(scratch.data());
+  rmm::device_vector<size_type> sizes(strings_count);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    sizes.begin(),
+                    size_and_exec_fn);
+
+  // compact the strings into the chars column
+  auto offsets_column = make_offsets_child_column(sizes.begin(), sizes.end(), mr, stream);
+  auto d_offsets      = offsets_column->view().template data<int32_t>();
+  auto const bytes    = thrust::device_pointer_cast(d_offsets)[strings_count];
+  auto chars_column   = create_chars_child_column(strings_count, null_count, bytes, mr, stream);
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    bytes,
+    [d_offsets,
+     d_scratch_offsets = scratch_offsets.data().get(),
+     strings_count,
+     d_scratch = static_cast<char const*>(scratch.data()),
+     d_chars   = chars_column->mutable_view().template data<char>()] __device__(size_type idx) {
+      auto const itr = thrust::upper_bound(thrust::seq, d_offsets, d_offsets + strings_count, idx);
+      auto const row = static_cast<size_type>(thrust::distance(d_offsets, itr) - 1);
+      d_chars[idx] = d_scratch[d_scratch_offsets[row] + idx - d_offsets[row]];
+    });
+  return std::make_pair(std::move(offsets_column), std::move(chars_column));
+}
+
 /**
  * @brief Converts a single UTF-8 character into a code-point value that
  * can be used for lookup in the character flags or the character case tables.
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/strings/string_view.cuh>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Average number of bytes per string above which functions searching
+ * the strings map a warp rather than a thread to each string.
+ *
+ * A thread per string leaves most of the warp idle on the longest string and
+ * reads memory a byte per lane; a warp reads 32 consecutive bytes per step.
+ */
+constexpr size_type warp_per_string_threshold{64};
+
+/**
+ * @brief Mask of the lanes of a warp that are all active.
+ */
+constexpr uint32_t full_warp_mask{0xffffffff};
+
+/**
+ * @brief Returns whether `d_target` is found in `d_str` starting at byte `pos`.
+ *
+ * @param d_str String to search.
+ * @param pos Byte position of the candidate match.
+ * @param d_target Non-empty string to match.
+ */
+__device__ inline bool is_match_at(string_view const& d_str,
+                                   size_type pos,
+                                   string_view const& d_target)
+{
+  auto const bytes = d_target.size_bytes();
+  if ((pos < 0) || (pos + bytes > d_str.size_bytes())) return false;
+  auto const ptr = d_str.data() + pos;
+  auto const tgt = d_target.data();
+  for (size_type idx = 0; idx < bytes; ++idx)
+    if (ptr[idx] != tgt[idx]) return false;
+  return true;
+}
+
+/**
+ * @brief Returns the number of characters within the first `bytes` bytes of `d_str`.
+ *
+ * Must be called by all the lanes of a warp with the same arguments;
+ * every lane returns the result.
+ *
+ * @param d_str String to count.
+ * @param bytes Number of bytes from the start of the string to count.
+ */
+__device__ inline size_type warp_count_characters(string_view const& d_str, size_type bytes)
+{
+  auto const lane = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const ptr  = d_str.data();
+  size_type count = 0;
+  for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+    auto const pos = base + lane;
+    count += __popc(__ballot_sync(full_warp_mask, (pos < bytes) && is_begin_utf8_char(ptr[pos])));
+  }
+  return count;
+}
+
+/**
+ * @brief Returns the byte offset of character `pos` within `d_str`.
+ *
+ * Positions past the last character return the size of the string in bytes.
+ * Must be called by all the lanes of a warp with the same arguments;
+ * every lane returns the result.
+ *
+ * @param d_str String to search.
+ * @param pos Character position.
+ */
+__device__ inline size_type warp_byte_offset(string_view const& d_str, size_type pos)
+{
+  auto const lane  = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const ptr   = d_str.data();
+  auto const bytes = d_str.size_bytes();
+  size_type count  = 0;
+  for (size_type base = 0; base < bytes; base += cudf::detail::warp_size) {
+    auto const idx = base + lane;
+    auto begins    = __ballot_sync(full_warp_mask, (idx < bytes) && is_begin_utf8_char(ptr[idx]));
+    auto const n   = __popc(begins);
+    if (count + n > pos) {
+      // drop the characters before `pos` to land on its first byte
+      for (auto skip = pos - count; skip > 0; --skip) begins &= begins - 1;
+      return base + __ffs(begins) - 1;
+    }
+    count += n;
+  }
+  return bytes;
+}
+
+/**
+ * @brief Returns the byte position of the first match of `d_target` within bytes
+ * `[begin, end)` of `d_str`, or -1 if there is none.
+ *
+ * Lanes test consecutive candidate positions so the warp reads the string in
+ * coalesced 32-byte steps. Must be called by all the lanes of a warp with the
+ * same arguments; every lane returns the result.
+ *
+ * @param d_str String to search.
+ * @param d_target Non-empty string to find.
+ * @param begin First byte a match may start at.
+ * @param end Byte position where any match must end by.
+ */
+__device__ inline size_type warp_find(string_view const& d_str,
+                                      string_view const& d_target,
+                                      size_type begin,
+                                      size_type end)
+{
+  auto const lane = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const last = end - d_target.size_bytes();  // last possible match position
+  for (size_type base = begin; base <= last; base += cudf::detail::warp_size) {
+    auto const pos     = base + lane;
+    auto const matches =
+      __ballot_sync(full_warp_mask, (pos <= last) && is_match_at(d_str, pos, d_target));
+    if (matches) return base + __ffs(matches) - 1;
+  }
+  return -1;
+}
+
+/**
+ * @brief Returns the byte position of the last match of `d_target` within bytes
+ * `[begin, end)` of `d_str`, or -1 if there is none.
+ *
+ * Must be called by all the lanes of a warp with the same arguments;
+ * every lane returns the result.
+ *
+ * @param d_str String to search.
+ * @param d_target Non-empty string to find.
+ * @param begin First byte a match may start at.
+ * @param end Byte position where any match must end by.
+ */
+__device__ inline size_type warp_rfind(string_view const& d_str,
+                                       string_view const& d_target,
+                                       size_type begin,
+                                       size_type end)
+{
+  auto const lane = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  for (size_type top = end - d_target.size_bytes(); top >= begin;
+       top -= cudf::detail::warp_size) {
+    auto const pos     = top - lane;
+    auto const matches =
+      __ballot_sync(full_warp_mask, (pos >= begin) && is_match_at(d_str, pos, d_target));
+    if (matches) return top - __ffs(matches) + 1;
+  }
+  return -1;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
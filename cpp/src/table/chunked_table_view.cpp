@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace cudf {
+namespace {
+/**
+ * @brief Returns the row offsets of chunks of the given sizes followed by the total size
+ */
+template <typename SizeIterator>
+std::vector<size_type> chunk_offsets_of(SizeIterator begin, SizeIterator end)
+{
+  std::vector<size_type> offsets{0};
+  std::for_each(begin, end, [&offsets](size_type size) {
+    CUDF_EXPECTS(static_cast<int64_t>(offsets.back()) + size <=
+                   std::numeric_limits<size_type>::max(),
+                 "Total number of rows exceeds size_type range");
+    offsets.push_back(offsets.back() + size);
+  });
+  return offsets;
+}
+
+}  // namespace
+
+chunked_column_view::chunked_column_view(std::vector<column_view> const& chunks)
+  : _chunks{chunks}
+{
+  if (not _chunks.empty()) {
+    _type = _chunks.front().type();
+    CUDF_EXPECTS(std::all_of(_chunks.begin(),
+                             _chunks.end(),
+                             [this](column_view const& c) { return c.type() == _type; }),
+                 "Type mismatch in chunks");
+  }
+  std::vector<size_type> sizes(_chunks.size());
+  std::transform(
+    _chunks.begin(), _chunks.end(), sizes.begin(), [](column_view const& c) { return c.size(); });
+  _offsets = chunk_offsets_of(sizes.begin(), sizes.end());
+}
+
+size_type chunked_column_view::null_count() const
+{
+  return std::accumulate(_chunks.begin(), _chunks.end(), size_type{0}, [](auto n, auto const& c) {
+    return n + c.null_count();
+  });
+}
+
+chunked_table_view::chunked_table_view(std::vector<table_view> const& chunks) : _chunks{chunks}
+{
+  if (not _chunks.empty()) {
+    auto const& first = _chunks.front();
+    CUDF_EXPECTS(std::all_of(_chunks.begin(),
+                             _chunks.end(),
+                             [&first](table_view const& t) {
+                               return t.num_columns() == first.num_columns() and
+                                      std::equal(t.begin(),
+                                                 t.end(),
+                                                 first.begin(),
+                                                 [](column_view const& a, column_view const& b) {
+                                                   return a.type() == b.type();
+                                                 });
+                             }),
+                 "Schema mismatch in chunks");
+  }
+  std::vector<size_type> sizes(_chunks.size());
+  std::transform(_chunks.begin(), _chunks.end(), sizes.begin(), [](table_view const& t) {
+    return t.num_rows();
+  });
+  _offsets = chunk_offsets_of(sizes.begin(), sizes.end());
+}
+
+chunked_column_view chunked_table_view::column(size_type column_index) const
+{
+  CUDF_EXPECTS(column_index >= 0 and column_index < num_columns(), "Column index out of bounds");
+  std::vector<column_view> chunks(_chunks.size());
+  std::transform(_chunks.begin(), _chunks.end(), chunks.begin(), [column_index](auto const& t) {
+    return t.column(column_index);
+  });
+  return chunked_column_view{chunks};
+}
+
+}  // namespace cudf
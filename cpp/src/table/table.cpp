@@ -14,11 +14,14 @@
  * limitations under the License.
  */
 
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <functional>
+
 namespace cudf {
 
 // Copy the columns from another table
@@ -57,6 +60,7 @@ table::table(table_view view, cudaStream_t stream, rmm::mr::device_memory_resour
 // Create immutable view
 table_view table::view() const
 {
+  update_null_counts();
   std::vector<column_view> views;
   views.reserve(_columns.size());
   for (auto const& c : _columns) { views.push_back(c->view()); }
@@ -79,6 +83,31 @@ std::vector<std::unique_ptr<column>> table::release()
   return std::move(_columns);
 }
 
+// Count the unknown null counts of all the columns at once
+void table::update_null_counts() const
+{
+  std::vector<column*> unknown;
+  std::function<void(column&)> collect = [&](column& col) {
+    if (col._null_count <= UNKNOWN_NULL_COUNT and col._null_mask.size() > 0) {
+      unknown.push_back(&col);
+    }
+    for (auto const& child : col._children) { collect(*child); }
+  };
+  for (auto const& c : _columns) { collect(*c); }
+  // A single count costs the same through the column
+  if (unknown.size() < 2) { return; }
+
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> begin_bits, end_bits;
+  for (auto c : unknown) {
+    masks.push_back(static_cast<bitmask_type const*>(c->_null_mask.data()));
+    begin_bits.push_back(0);
+    end_bits.push_back(c->size());
+  }
+  auto const counts = detail::batch_count_unset_bits(masks, begin_bits, end_bits);
+  for (std::size_t i = 0; i < unknown.size(); ++i) { unknown[i]->_null_count = counts[i]; }
+}
+
 // Returns a table_view with set of specified columns
 table_view table::select(std::vector<cudf::size_type> const& column_indices) const
 {
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/device_view_cache.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -23,6 +24,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 namespace cudf {
@@ -50,6 +52,21 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
       std::accumulate(source_view.begin(), source_view.end(), 0, [](std::size_t init, auto col) {
         return init + ColumnDeviceView::extent(col);
       });
+    // The descriptors of immutable views are shared by the tables viewed several times by an
+    // API call
+    bool const cacheable =
+      std::is_same<HostTableView, table_view>::value and device_view_cache_active();
+    device_view_key key;
+    if (cacheable) {
+      key = make_device_view_key(
+        std::vector<column_view>(source_view.begin(), source_view.end()), true, stream);
+      auto cached = find_cached_device_view(key);
+      if (cached) {
+        _columns            = reinterpret_cast<ColumnDeviceView*>(cached->data());
+        _descendant_storage = new std::shared_ptr<rmm::device_buffer>(std::move(cached));
+        return;
+      }
+    }
     // A buffer of CPU memory is allocated to hold the ColumnDeviceView
     // objects. Once filled, the CPU memory is then copied to device memory
     // and the pointer is set in the _columns member.
@@ -62,8 +79,9 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
     // We need this pointer in order to pass it down when creating the
     // ColumnDeviceViews so the column can set the pointer(s) for any
     // of its child objects.
-    _descendant_storage = new rmm::device_buffer(views_size_bytes, stream);
-    _columns            = reinterpret_cast<ColumnDeviceView*>(_descendant_storage->data());
+    _descendant_storage = new std::shared_ptr<rmm::device_buffer>(
+      std::make_shared<rmm::device_buffer>(views_size_bytes, stream));
+    _columns = reinterpret_cast<ColumnDeviceView*>((*_descendant_storage)->data());
     // The beginning of the memory must be the fixed-sized ColumnDeviceView
     // objects in order for _columns to be used as an array. Therefore,
     // any child data is assigned to the end of this array (h_end/d_end).
@@ -86,6 +104,7 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
     CUDA_TRY(
       cudaMemcpyAsync(_columns, h_buffer.data(), views_size_bytes, cudaMemcpyDefault, stream));
     CUDA_TRY(cudaStreamSynchronize(stream));
+    if (cacheable) { cache_device_view(std::move(key), *_descendant_storage); }
   }
 }
 
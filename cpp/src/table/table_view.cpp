@@ -15,6 +15,8 @@
  */
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -87,4 +89,30 @@ mutable_table_view::mutable_table_view(std::vector<mutable_table_view> const& vi
 {
 }
 
+// Returns the null counts, counting the unknown ones with a single kernel launch
+std::vector<size_type> null_count(table_view const& view)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<size_type> counts(view.num_columns());
+  std::vector<size_type> unknown;
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> begin_bits, end_bits;
+  for (size_type i = 0; i < view.num_columns(); ++i) {
+    auto const& col = view.column(i);
+    if (col.has_known_null_count() or not col.nullable()) {
+      counts[i] = col.null_count();
+    } else {
+      unknown.push_back(i);
+      masks.push_back(col.null_mask());
+      begin_bits.push_back(col.offset());
+      end_bits.push_back(col.offset() + col.size());
+    }
+  }
+  if (unknown.empty()) { return counts; }
+
+  auto const unknown_counts = detail::batch_count_unset_bits(masks, begin_bits, end_bits);
+  for (std::size_t i = 0; i < unknown.size(); ++i) { counts[unknown[i]] = unknown_counts[i]; }
+  return counts;
+}
+
 }  // namespace cudf
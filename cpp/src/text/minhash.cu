@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the byte position of the character after the one at `pos`.
+ */
+__device__ cudf::size_type next_character(char const* data,
+                                          cudf::size_type pos,
+                                          cudf::size_type size)
+{
+  do {
+    ++pos;
+  } while (pos < size && (static_cast<uint8_t>(data[pos]) & 0xC0) == 0x80);
+  return pos;
+}
+
+/**
+ * @brief Calls `fn` with each window of `width` characters in `d_str`.
+ *
+ * A non-empty string with fewer than `width` characters is passed as a single window.
+ */
+template <typename Function>
+__device__ void for_each_character_ngram(cudf::string_view const& d_str,
+                                         cudf::size_type width,
+                                         Function fn)
+{
+  auto const data = d_str.data();
+  auto const size = d_str.size_bytes();
+  if (size == 0) return;
+  cudf::size_type begin = 0;
+  cudf::size_type end   = 0;
+  for (cudf::size_type n = 0; n < width && end < size; ++n) end = next_character(data, end, size);
+  fn(cudf::string_view(data, end));
+  while (end < size) {
+    begin = next_character(data, begin, size);
+    end   = next_character(data, end, size);
+    fn(cudf::string_view(data + begin, end - begin));
+  }
+}
+
+/**
+ * @brief Hashes the character ngrams of each string.
+ *
+ * This is called twice: once to count the ngrams of each string and once more,
+ * with `d_offsets` set, to write their hashes into `d_hashes`.
+ */
+struct character_ngram_hash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type width;
+  int32_t const* d_offsets{};
+  uint32_t* d_hashes{};
+
+  __device__ int32_t operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return 0;
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    auto d_output    = d_offsets ? d_hashes + d_offsets[idx] : nullptr;
+    int32_t count    = 0;
+    cudf::detail::MurmurHash3_32<cudf::string_view> hasher;
+    for_each_character_ngram(d_str, width, [&](cudf::string_view const& ngram) {
+      if (d_output) d_output[count] = hasher(ngram);
+      ++count;
+    });
+    return count;
+  }
+};
+
+/**
+ * @brief Computes the minhash value of one string for one seed.
+ *
+ * The output position `idx` is the string row times the number of seeds plus the seed index.
+ */
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  uint32_t const* d_seeds;
+  cudf::size_type seeds_count;
+  cudf::size_type width;
+  uint32_t* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const str_idx = idx / seeds_count;
+    uint32_t result    = std::numeric_limits<uint32_t>::max();
+    if (d_strings.is_valid(str_idx)) {
+      cudf::detail::MurmurHash3_32<cudf::string_view> const hasher(d_seeds[idx % seeds_count]);
+      for_each_character_ngram(d_strings.element<cudf::string_view>(str_idx),
+                               width,
+                               [&](cudf::string_view const& ngram) {
+                                 result = thrust::min(result, hasher(ngram));
+                               });
+    }
+    d_hashes[idx] = result;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> hash_character_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 5,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+  auto const strings_count = strings.size();
+  auto execpol             = rmm::exec_policy(stream);
+  auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
+
+  // the ngram counts become the offsets of the output lists
+  auto offsets = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                    d_offsets + 1,
+                    character_ngram_hash_fn{*strings_column, ngrams});
+  CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(int32_t), stream));
+  thrust::inclusive_scan(
+    execpol->on(stream), d_offsets + 1, d_offsets + strings_count + 1, d_offsets + 1);
+  cudf::size_type const total_ngrams = thrust::device_pointer_cast(d_offsets)[strings_count];
+
+  // compute the hashes directly into the child column
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          total_ngrams,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    character_ngram_hash_fn{
+      *strings_column, ngrams, d_offsets, hashes->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  CUDF_EXPECTS(!seeds.is_empty(), "Parameter seeds cannot be empty");
+  CUDF_EXPECTS(seeds.type().id() == cudf::type_id::UINT32, "Parameter seeds must be UINT32");
+  CUDF_EXPECTS(!seeds.has_nulls(), "Parameter seeds cannot contain nulls");
+  CUDF_EXPECTS(width > 1, "Parameter width should be an integer value of 2 or greater");
+  auto const strings_count = strings.size();
+  auto const seeds_count   = seeds.size();
+  auto execpol             = rmm::exec_policy(stream);
+  auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
+
+  // every row holds one value per seed
+  auto offsets = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::sequence(execpol->on(stream), d_offsets, d_offsets + strings_count + 1, 0, seeds_count);
+
+  auto const total_hashes = strings_count * seeds_count;
+
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          total_hashes,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     total_hashes,
+                     minhash_fn{*strings_column,
+                                seeds.data<uint32_t>(),
+                                seeds_count,
+                                width,
+                                hashes->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_character_ngrams(strings, ngrams, mr);
+}
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seeds, width, mr);
+}
+
+}  // namespace nvtext
@@ -22,12 +22,16 @@
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/char_types/is_flags.h>
 #include <strings/utilities.cuh>
+#include <strings/utilities.hpp>
 
+#include <nvtext/detail/normalize.hpp>
 #include <nvtext/normalize.hpp>
 #include <text/utilities/tokenize_ops.cuh>
 
 #include <thrust/for_each.h>
+#include <thrust/scan.h>
 
 namespace nvtext {
 namespace detail {
@@ -72,13 +76,270 @@ struct normalize_spaces_fn {
   }
 };
 
+/**
+ * @brief Base letters of the U+00C0 to U+017F characters that decompose into an ASCII
+ * letter followed by combining accents.
+ *
+ * Zero entries are characters without such a decomposition, like 'æ' or 'ø'.
+ */
+static const __device__ __constant__ char kAccentBaseLetters[193] =
+  "AAAAAA\0CEEEEIIII\0NOOOOO\0\0UUUUY\0\0aaaaaa\0ceeeeiiii\0nooooo\0\0uuuuy\0y"
+  "AaAaAaCcCcCcCcDd\0\0EeEeEeEeEeGgGgGgGgHh\0\0IiIiIiIiI\0\0\0JjKk\0LlLlLl\0\0\0\0NnNnNn\0\0\0"
+  "OoOoOo\0\0RrRrRrSsSsSsSsTtTt\0\0UuUuUuUuUuUuWwYyYZzZzZz\0";
+
+__device__ inline uint32_t strip_accent(uint32_t code_point)
+{
+  if (code_point < 0x00C0 || code_point > 0x017F) return code_point;
+  auto const base = kAccentBaseLetters[code_point - 0x00C0];
+  return base ? static_cast<uint32_t>(base) : code_point;
+}
+
+// control characters and the replacement character are removed
+__device__ inline bool is_control(uint32_t code_point)
+{
+  return (code_point < ' ' && code_point != '\t' && code_point != '\n' && code_point != '\r') ||
+         (code_point >= 0x007F && code_point <= 0x009F) ||
+         (code_point >= 0x200B && code_point <= 0x200F) || code_point == 0xFEFF ||
+         code_point == 0xFFFD;
+}
+
+// ASCII symbols and the general and CJK punctuation blocks
+__device__ inline bool is_punctuation(uint32_t code_point)
+{
+  return (code_point >= 33 && code_point <= 47) || (code_point >= 58 && code_point <= 64) ||
+         (code_point >= 91 && code_point <= 96) || (code_point >= 123 && code_point <= 126) ||
+         (code_point >= 0x2010 && code_point <= 0x206F) ||
+         (code_point >= 0x3000 && code_point <= 0x303F);
+}
+
+// CJK ideographs are each treated as a separate word
+__device__ inline bool is_cjk(uint32_t code_point)
+{
+  return (code_point >= 0x4E00 && code_point <= 0x9FFF) ||
+         (code_point >= 0x3400 && code_point <= 0x4DBF) ||
+         (code_point >= 0xF900 && code_point <= 0xFAFF) ||
+         (code_point >= 0x20000 && code_point <= 0x2FA1F);
+}
+
+/**
+ * @brief Normalizes the characters of a string for subword tokenizing.
+ *
+ * Control characters are removed, whitespace becomes a single space and spaces are
+ * added around punctuation and CJK characters. With `do_lower_case`, characters are
+ * also converted to lower case and their accents are removed.
+ */
+struct character_normalizer {
+  cudf::strings::detail::character_flags_table_type const* d_flags;
+  cudf::strings::detail::character_cases_table_type const* d_case_table;
+  bool do_lower_case;
+
+  /**
+   * @brief Calls `fn` with each code point of the normalized string.
+   */
+  template <typename Function>
+  __device__ void operator()(cudf::string_view const& d_str, Function fn) const
+  {
+    for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
+      auto code_point = cudf::strings::detail::utf8_to_codepoint(*itr);
+      auto const flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+      if (is_control(code_point)) continue;
+      if (code_point <= ' ' || IS_SPACE(flag)) {
+        fn(' ');
+      } else if (is_punctuation(code_point) || is_cjk(code_point)) {
+        fn(' ');
+        fn(code_point);
+        fn(' ');
+      } else if (!do_lower_case) {
+        fn(code_point);
+      } else if (code_point < 0x0300 || code_point > 0x036F) {  // combining accents are removed
+        if (IS_UPPER(flag)) code_point = d_case_table[code_point];
+        fn(strip_accent(code_point));
+      }
+    }
+  }
+
+  /**
+   * @brief Calls `on_char` with each code point of each token of the normalized string
+   * and `on_token` after the last code point of each token.
+   *
+   * The tokens are separated by the spaces of the normalized string.
+   */
+  template <typename CharFunction, typename TokenFunction>
+  __device__ void tokens(cudf::string_view const& d_str,
+                         CharFunction on_char,
+                         TokenFunction on_token) const
+  {
+    bool in_token = false;
+    (*this)(d_str, [&](uint32_t code_point) {
+      if (code_point != ' ') {
+        on_char(code_point);
+      } else if (in_token) {
+        on_token();
+      }
+      in_token = code_point != ' ';
+    });
+    if (in_token) on_token();
+  }
+};
+
+/**
+ * @brief Normalize the characters of a strings column for subword tokenizing.
+ *
+ * This functor can be called to compute the output size in bytes
+ * of each string and then called again to fill in the allocated buffer.
+ */
+struct normalize_characters_fn {
+  cudf::column_device_view const d_strings;  // strings to normalize
+  character_normalizer const normalizer;
+  int32_t const* d_offsets{};  // offsets into d_buffer
+  char* d_buffer{};            // output buffer for characters
+
+  __device__ int32_t operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) return 0;
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    char* optr       = d_offsets ? d_buffer + d_offsets[idx] : nullptr;
+    int32_t nbytes   = 0;  // holds the number of bytes per output string
+    normalizer(d_str, [&](uint32_t code_point) {
+      auto const chr = cudf::strings::detail::codepoint_to_utf8(code_point);
+      nbytes += cudf::strings::detail::bytes_in_char_utf8(chr);
+      if (optr) optr += cudf::strings::detail::from_char_utf8(chr, optr);
+    });
+    return nbytes;
+  }
+};
+
+/**
+ * @brief MurmurHash3_32 computed one byte at a time.
+ *
+ * This produces the same value as `MurmurHash3_32<string_view>` over the same bytes
+ * without needing them in memory.
+ */
+struct murmur_hash_stream {
+  uint32_t hash{0};
+  uint32_t block{0};
+  int32_t length{0};
+
+  __device__ static uint32_t mix(uint32_t k)
+  {
+    k *= 0xcc9e2d51;
+    k = (k << 15) | (k >> 17);
+    return k * 0x1b873593;
+  }
+
+  __device__ void add(uint8_t byte)
+  {
+    block |= static_cast<uint32_t>(byte) << (8 * (length & 3));
+    if ((++length & 3) == 0) {
+      hash ^= mix(block);
+      hash  = (hash << 13) | (hash >> 19);
+      hash  = hash * 5 + 0xe6546b64;
+      block = 0;
+    }
+  }
+
+  __device__ uint32_t finish() const
+  {
+    auto h = hash;
+    if (length & 3) h ^= mix(block);
+    h ^= static_cast<uint32_t>(length);
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+  }
+};
+
+/**
+ * @brief Counts the tokens and token bytes of each normalized string.
+ */
+struct normalized_token_sizes_fn {
+  cudf::column_device_view const d_strings;
+  character_normalizer const normalizer;
+  int32_t* d_token_counts;
+  int32_t* d_byte_counts{};
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    int32_t tokens = 0;
+    int32_t bytes  = 0;
+    if (d_strings.is_valid(idx)) {
+      normalizer.tokens(
+        d_strings.element<cudf::string_view>(idx),
+        [&](uint32_t code_point) {
+          bytes += cudf::strings::detail::bytes_in_char_utf8(
+            cudf::strings::detail::codepoint_to_utf8(code_point));
+        },
+        [&] { ++tokens; });
+    }
+    d_token_counts[idx] = tokens;
+    if (d_byte_counts) d_byte_counts[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Writes the tokens of each normalized string and their offsets.
+ */
+struct normalized_tokens_fn {
+  cudf::column_device_view const d_strings;
+  character_normalizer const normalizer;
+  int32_t const* d_token_offsets;  // first token of each string
+  int32_t const* d_byte_offsets;   // first byte of each string
+  int32_t* d_offsets;              // offsets of the output tokens, after the first
+  char* d_chars;                   // output buffer for characters
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) return;
+    auto byte_offset = d_byte_offsets[idx];
+    auto d_output    = d_offsets + d_token_offsets[idx];  // the end of each token is written
+    normalizer.tokens(
+      d_strings.element<cudf::string_view>(idx),
+      [&](uint32_t code_point) {
+        byte_offset += cudf::strings::detail::from_char_utf8(
+          cudf::strings::detail::codepoint_to_utf8(code_point), d_chars + byte_offset);
+      },
+      [&] { *(++d_output) = byte_offset; });
+  }
+};
+
+/**
+ * @brief Writes the MurmurHash3_32 values of the tokens of each normalized string.
+ */
+struct normalized_token_hashes_fn {
+  cudf::column_device_view const d_strings;
+  character_normalizer const normalizer;
+  int32_t const* d_offsets;  // first token of each string
+  uint32_t* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) return;
+    auto d_output = d_hashes + d_offsets[idx];
+    murmur_hash_stream hasher;
+    normalizer.tokens(
+      d_strings.element<cudf::string_view>(idx),
+      [&](uint32_t code_point) {
+        char bytes[4];
+        auto const size = cudf::strings::detail::from_char_utf8(
+          cudf::strings::detail::codepoint_to_utf8(code_point), bytes);
+        for (cudf::size_type i = 0; i < size; ++i) hasher.add(static_cast<uint8_t>(bytes[i]));
+      },
+      [&] {
+        *d_output++ = hasher.finish();
+        hasher      = murmur_hash_stream{};
+      });
+  }
+};
+
 }  // namespace
 
 // details API
-std::unique_ptr<cudf::column> normalize_spaces(
-  cudf::strings_column_view const& strings,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-  cudaStream_t stream                 = 0)
+std::unique_ptr<cudf::column> normalize_spaces(cudf::strings_column_view const& strings,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
 {
   cudf::size_type strings_count = strings.size();
   if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::STRING});
@@ -119,6 +380,177 @@ std::unique_ptr<cudf::column> normalize_spaces(
                                    mr);
 }
 
+std::unique_ptr<cudf::column> normalize_characters(cudf::strings_column_view const& strings,
+                                                   bool do_lower_case,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  cudf::size_type strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::STRING});
+
+  // create device column
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  character_normalizer const normalizer{cudf::strings::detail::get_character_flags_table(),
+                                        cudf::strings::detail::get_character_cases_table(),
+                                        do_lower_case};
+  // copy bitmask
+  rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
+
+  // create offsets by calculating size of each string for output
+  auto offsets_transformer_itr = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<int32_t>(0), normalize_characters_fn{d_strings, normalizer});
+  auto offsets_column = cudf::strings::detail::make_offsets_child_column(
+    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
+  auto d_offsets = offsets_column->view().data<int32_t>();
+
+  // build the chars column
+  cudf::size_type bytes = thrust::device_pointer_cast(d_offsets)[strings_count];
+  auto chars_column     = cudf::strings::detail::create_chars_child_column(
+    strings_count, strings.null_count(), bytes, mr, stream);
+  auto d_chars = chars_column->mutable_view().data<char>();
+
+  // write the normalized characters to the chars buffer
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     normalize_characters_fn{d_strings, normalizer, d_offsets, d_chars});
+  chars_column->set_null_count(0);  // reset null count for child column
+  //
+  return cudf::make_strings_column(strings_count,
+                                   std::move(offsets_column),
+                                   std::move(chars_column),
+                                   strings.null_count(),
+                                   std::move(null_mask),
+                                   stream,
+                                   mr);
+}
+
+std::unique_ptr<cudf::column> normalize_count_tokens(cudf::strings_column_view const& strings,
+                                                     bool do_lower_case,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
+  character_normalizer const normalizer{cudf::strings::detail::get_character_flags_table(),
+                                        cudf::strings::detail::get_character_cases_table(),
+                                        do_lower_case};
+  auto token_counts = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, strings_count, cudf::mask_state::UNALLOCATED, stream, mr);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    normalized_token_sizes_fn{
+      *strings_column, normalizer, token_counts->mutable_view().data<int32_t>()});
+  return token_counts;
+}
+
+std::unique_ptr<cudf::column> normalize_tokenize(cudf::strings_column_view const& strings,
+                                                 bool do_lower_case,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::STRING});
+  auto execpol        = rmm::exec_policy(stream);
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  character_normalizer const normalizer{cudf::strings::detail::get_character_flags_table(),
+                                        cudf::strings::detail::get_character_cases_table(),
+                                        do_lower_case};
+
+  // count the tokens and their bytes for each string
+  rmm::device_vector<int32_t> token_offsets(strings_count + 1, 0);
+  rmm::device_vector<int32_t> byte_offsets(strings_count + 1, 0);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     normalized_token_sizes_fn{*strings_column,
+                                               normalizer,
+                                               token_offsets.data().get() + 1,
+                                               byte_offsets.data().get() + 1});
+  thrust::inclusive_scan(
+    execpol->on(stream), token_offsets.begin() + 1, token_offsets.end(), token_offsets.begin() + 1);
+  thrust::inclusive_scan(
+    execpol->on(stream), byte_offsets.begin() + 1, byte_offsets.end(), byte_offsets.begin() + 1);
+  cudf::size_type const tokens_count = token_offsets.back();
+  cudf::size_type const bytes        = byte_offsets.back();
+
+  // write the tokens directly into the output column
+  auto offsets_column = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, tokens_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets_column->mutable_view().data<int32_t>();
+  CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(int32_t), stream));
+  auto chars_column =
+    cudf::strings::detail::create_chars_child_column(tokens_count, 0, bytes, mr, stream);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     normalized_tokens_fn{*strings_column,
+                                          normalizer,
+                                          token_offsets.data().get(),
+                                          byte_offsets.data().get(),
+                                          d_offsets,
+                                          chars_column->mutable_view().data<char>()});
+  chars_column->set_null_count(0);
+
+  return cudf::make_strings_column(tokens_count,
+                                   std::move(offsets_column),
+                                   std::move(chars_column),
+                                   0,
+                                   rmm::device_buffer{0, stream, mr},
+                                   stream,
+                                   mr);
+}
+
+std::unique_ptr<cudf::column> normalize_hash_tokens(cudf::strings_column_view const& strings,
+                                                    bool do_lower_case,
+                                                    rmm::mr::device_memory_resource* mr,
+                                                    cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto execpol             = rmm::exec_policy(stream);
+  auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
+  character_normalizer const normalizer{cudf::strings::detail::get_character_flags_table(),
+                                        cudf::strings::detail::get_character_cases_table(),
+                                        do_lower_case};
+
+  // the token counts become the offsets of the output lists
+  auto offsets = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(int32_t), stream));
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     normalized_token_sizes_fn{*strings_column, normalizer, d_offsets + 1});
+  thrust::inclusive_scan(
+    execpol->on(stream), d_offsets + 1, d_offsets + strings_count + 1, d_offsets + 1);
+  cudf::size_type const tokens_count = thrust::device_pointer_cast(d_offsets)[strings_count];
+
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          tokens_count,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     normalized_token_hashes_fn{*strings_column,
+                                                normalizer,
+                                                d_offsets,
+                                                hashes->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -130,4 +562,37 @@ std::unique_ptr<cudf::column> normalize_spaces(cudf::strings_column_view const&
   return detail::normalize_spaces(strings, mr);
 }
 
+std::unique_ptr<cudf::column> normalize_characters(cudf::strings_column_view const& strings,
+                                                   bool do_lower_case,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::normalize_characters(strings, do_lower_case, mr);
+}
+
+
+std::unique_ptr<cudf::column> normalize_count_tokens(cudf::strings_column_view const& strings,
+                                                     bool do_lower_case,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::normalize_count_tokens(strings, do_lower_case, mr);
+}
+
+std::unique_ptr<cudf::column> normalize_tokenize(cudf::strings_column_view const& strings,
+                                                 bool do_lower_case,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::normalize_tokenize(strings, do_lower_case, mr);
+}
+
+std::unique_ptr<cudf::column> normalize_hash_tokens(cudf::strings_column_view const& strings,
+                                                    bool do_lower_case,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::normalize_hash_tokens(strings, do_lower_case, mr);
+}
+
 }  // namespace nvtext
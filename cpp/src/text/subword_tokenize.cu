@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/detail/normalize.hpp>
+#include <nvtext/detail/subword_tokenize.hpp>
+#include <nvtext/detail/tokenize.hpp>
+#include <nvtext/subword_tokenize.hpp>
+#include <text/utilities/vocabulary_table.cuh>
+
+#include <thrust/binary_search.h>
+#include <thrust/find.h>
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <fstream>
+#include <tuple>
+
+namespace nvtext {
+namespace detail {
+namespace {
+/**
+ * @brief Splits each word into the longest vocabulary pieces from its start.
+ *
+ * This is called twice: once to count the pieces of each word and once more,
+ * with `d_offsets` set, to write their token ids into `d_ids`.
+ */
+struct wordpiece_fn {
+  cudf::column_device_view const d_words;
+  vocabulary_table_fn const vocabulary;
+  uint32_t unknown_token_id;
+  int32_t const* d_offsets{};
+  uint32_t* d_ids{};
+
+  __device__ int32_t operator()(cudf::size_type idx) const
+  {
+    auto const d_word = d_words.element<cudf::string_view>(idx);
+    auto const data    = d_word.data();
+    auto const length  = d_word.size_bytes();
+    uint32_t* d_output = d_offsets ? d_ids + d_offsets[idx] : nullptr;
+
+    int32_t count         = 0;
+    cudf::size_type start = 0;
+    while (start < length) {
+      auto end   = length;
+      int32_t id = empty_vocabulary_slot;
+      while (end > start) {
+        id = vocabulary.find(cudf::string_view(data + start, end - start), start > 0);
+        if (id != empty_vocabulary_slot) break;
+        // back up to the previous character boundary
+        do {
+          --end;
+        } while (end > start && (static_cast<uint8_t>(data[end]) & 0xC0) == 0x80);
+      }
+      if (id == empty_vocabulary_slot) {
+        // the whole word is unknown
+        if (d_output) d_output[0] = unknown_token_id;
+        return 1;
+      }
+      if (d_output) d_output[count] = static_cast<uint32_t>(id);
+      ++count;
+      start = end;
+    }
+    return count;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary(cudf::strings_column_view const& vocabulary,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(vocabulary.null_count() == 0, "Vocabulary must not contain nulls");
+  auto const vocabulary_size = vocabulary.size();
+
+  auto result    = std::make_unique<wordpiece_vocabulary>();
+  result->tokens = std::make_unique<cudf::column>(vocabulary.parent(), stream, mr);
+
+  std::tie(result->table, result->table_size) =
+    build_vocabulary_table(result->tokens->view(), true, mr, stream);
+
+  auto d_tokens      = cudf::column_device_view::create(result->tokens->view(), stream);
+  auto execpol       = rmm::exec_policy(stream);
+  auto const unknown =
+    thrust::find_if(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(vocabulary_size),
+                    [d_tokens = *d_tokens] __device__(cudf::size_type row) {
+                      return d_tokens.element<cudf::string_view>(row) ==
+                             cudf::string_view("[UNK]", 5);
+                    });
+  CUDF_EXPECTS(*unknown < vocabulary_size, "Vocabulary must contain the [UNK] token");
+  result->unknown_token_id = static_cast<uint32_t>(*unknown);
+  return result;
+}
+
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary_file(std::string const& filename,
+                                                           rmm::mr::device_memory_resource* mr,
+                                                           cudaStream_t stream)
+{
+  std::ifstream file(filename);
+  CUDF_EXPECTS(file.is_open(), "Could not open vocabulary file: " + filename);
+
+  std::vector<char> chars;
+  std::vector<cudf::size_type> offsets{0};
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    chars.insert(chars.end(), line.begin(), line.end());
+    offsets.push_back(static_cast<cudf::size_type>(chars.size()));
+  }
+  auto const tokens = cudf::make_strings_column(chars, offsets, {}, 0, stream);
+  return load_vocabulary(cudf::strings_column_view(tokens->view()), mr, stream);
+}
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  wordpiece_vocabulary const& vocabulary,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(max_sequence_length > 0, "max_sequence_length must be greater than 0");
+  CUDF_EXPECTS(stride > 0 && stride <= max_sequence_length,
+               "stride must be greater than 0 and not greater than max_sequence_length");
+  auto const strings_count = strings.size();
+  auto execpol             = rmm::exec_policy(stream);
+
+  // split the normalized strings into words
+  auto const normalized = normalize_characters(
+    strings, do_lower_case, rmm::mr::get_default_resource(), stream);
+  auto const words = tokenize_record(cudf::strings_column_view(normalized->view()),
+                                     cudf::string_scalar(""),
+                                     rmm::mr::get_default_resource(),
+                                     stream);
+  auto const d_word_offsets = words->view().child(0).data<int32_t>();
+  auto const words_view     = words->view().child(1);
+  auto const words_count    = words_view.size();
+
+  // split the words into token ids
+  auto d_words = cudf::column_device_view::create(words_view, stream);
+  auto d_vocab = cudf::column_device_view::create(vocabulary.tokens->view(), stream);
+  vocabulary_table_fn table_fn{*d_vocab,
+                               static_cast<int32_t*>(const_cast<void*>(vocabulary.table.data())),
+                               static_cast<uint32_t>(vocabulary.table_size - 1),
+                               true};
+  wordpiece_fn pieces_fn{*d_words, table_fn, vocabulary.unknown_token_id};
+  rmm::device_vector<int32_t> piece_offsets(words_count + 1, 0);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(words_count),
+                    piece_offsets.begin() + 1,
+                    pieces_fn);
+  thrust::inclusive_scan(
+    execpol->on(stream), piece_offsets.begin() + 1, piece_offsets.end(), piece_offsets.begin() + 1);
+  auto const d_piece_offsets = piece_offsets.data().get();
+  rmm::device_vector<uint32_t> token_ids(piece_offsets.back());
+  pieces_fn.d_offsets = d_piece_offsets;
+  pieces_fn.d_ids     = token_ids.data().get();
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     words_count,
+                     [pieces_fn] __device__(cudf::size_type idx) { pieces_fn(idx); });
+
+  // number of tensor rows for each string
+  rmm::device_vector<int32_t> row_offsets(strings_count + 1, 0);
+  thrust::transform(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+    row_offsets.begin() + 1,
+    [d_word_offsets, d_piece_offsets, max_sequence_length, stride, do_truncate] __device__(
+      cudf::size_type idx) {
+      auto const tokens = static_cast<uint32_t>(d_piece_offsets[d_word_offsets[idx + 1]] -
+                                                d_piece_offsets[d_word_offsets[idx]]);
+      if (do_truncate || tokens <= max_sequence_length) return 1;
+      return static_cast<int32_t>(1 + (tokens - max_sequence_length + stride - 1) / stride);
+    });
+  thrust::inclusive_scan(
+    execpol->on(stream), row_offsets.begin() + 1, row_offsets.end(), row_offsets.begin() + 1);
+  uint32_t const nrows_tensor = row_offsets.back();
+
+  // build the tensors
+  auto const tensor_size = static_cast<cudf::size_type>(nrows_tensor * max_sequence_length);
+  auto token_ids_column  = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                                    tensor_size,
+                                                    cudf::mask_state::UNALLOCATED,
+                                                    stream,
+                                                    mr);
+  auto mask_column      = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                               tensor_size,
+                                               cudf::mask_state::UNALLOCATED,
+                                               stream,
+                                               mr);
+  auto metadata_column  = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                                   static_cast<cudf::size_type>(nrows_tensor * 3),
+                                                   cudf::mask_state::UNALLOCATED,
+                                                   stream,
+                                                   mr);
+  auto const d_rows_begin = row_offsets.data().get();
+  auto const d_rows_end   = d_rows_begin + row_offsets.size();
+  auto const d_token_ids  = token_ids.data().get();
+  auto d_tensor_ids       = token_ids_column->mutable_view().data<uint32_t>();
+  auto d_tensor_mask      = mask_column->mutable_view().data<uint32_t>();
+  auto d_tensor_metadata  = metadata_column->mutable_view().data<uint32_t>();
+  // returns the string, the position of the row within the string and its token range
+  auto locate = [d_rows_begin, d_rows_end, d_word_offsets, d_piece_offsets] __device__(
+                  uint32_t row, uint32_t& first, uint32_t& last) {
+    auto const idx = static_cast<cudf::size_type>(
+      thrust::upper_bound(thrust::seq, d_rows_begin, d_rows_end, static_cast<int32_t>(row)) -
+      d_rows_begin - 1);
+    first = static_cast<uint32_t>(d_piece_offsets[d_word_offsets[idx]]);
+    last  = static_cast<uint32_t>(d_piece_offsets[d_word_offsets[idx + 1]]);
+    return idx;
+  };
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    tensor_size,
+    [locate, d_rows_begin, d_token_ids, d_tensor_ids, d_tensor_mask, max_sequence_length, stride]
+      __device__(cudf::size_type idx) {
+        auto const row = static_cast<uint32_t>(idx) / max_sequence_length;
+        uint32_t first = 0;
+        uint32_t last  = 0;
+        auto const str = locate(row, first, last);
+        auto const pos = first + (row - d_rows_begin[str]) * stride + idx % max_sequence_length;
+        bool const is_token = pos < last;
+        d_tensor_ids[idx]   = is_token ? d_token_ids[pos] : 0;
+        d_tensor_mask[idx]  = is_token ? 1 : 0;
+      });
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<uint32_t>(0),
+    nrows_tensor,
+    [locate, d_rows_begin, d_tensor_metadata, max_sequence_length, stride] __device__(
+      uint32_t row) {
+      uint32_t first = 0;
+      uint32_t last  = 0;
+      auto const str   = locate(row, first, last);
+      auto const start = (row - d_rows_begin[str]) * stride;
+      auto const end   = thrust::min(last - first, start + max_sequence_length);
+      d_tensor_metadata[row * 3]     = static_cast<uint32_t>(str);
+      d_tensor_metadata[row * 3 + 1] = start;
+      d_tensor_metadata[row * 3 + 2] = end > start ? end - 1 : start;
+    });
+
+  return tokenizer_result{nrows_tensor,
+                          max_sequence_length,
+                          std::move(token_ids_column),
+                          std::move(mask_column),
+                          std::move(metadata_column)};
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary(cudf::strings_column_view const& vocabulary,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_vocabulary(vocabulary, mr);
+}
+
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary_file(std::string const& filename,
+                                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_vocabulary_file(filename, mr);
+}
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  wordpiece_vocabulary const& vocabulary,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize(
+    strings, vocabulary, max_sequence_length, stride, do_lower_case, do_truncate, mr);
+}
+
+}  // namespace nvtext
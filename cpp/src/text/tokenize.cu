@@ -19,16 +19,20 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <nvtext/detail/tokenize.hpp>
 #include <nvtext/tokenize.hpp>
 #include <text/utilities/tokenize_ops.cuh>
+#include <text/utilities/vocabulary_table.cuh>
 
 #include <thrust/count.h>
 #include <thrust/transform.h>
 
+#include <tuple>
+
 namespace nvtext {
 namespace detail {
 namespace {
@@ -52,12 +56,13 @@ std::unique_ptr<cudf::column> token_count_fn(cudf::size_type strings_count,
   return token_counts;
 }
 
-// common pattern for tokenize functions
+// common pattern for locating the tokens of each string
+// -- the token-index offsets of each string are stored in d_token_offsets
 template <typename Tokenizer>
-std::unique_ptr<cudf::column> tokenize_fn(cudf::size_type strings_count,
-                                          Tokenizer tokenizer,
-                                          rmm::mr::device_memory_resource* mr,
-                                          cudaStream_t stream)
+rmm::device_vector<string_index_pair> token_positions_fn(cudf::size_type strings_count,
+                                                         Tokenizer tokenizer,
+                                                         int32_t* d_token_offsets,
+                                                         cudaStream_t stream)
 {
   auto execpol = rmm::exec_policy(stream);
   // get the number of tokens in each string
@@ -65,26 +70,73 @@ std::unique_ptr<cudf::column> tokenize_fn(cudf::size_type strings_count,
     token_count_fn(strings_count, tokenizer, rmm::mr::get_default_resource(), stream);
   auto d_token_counts = token_counts->view();
   // create token-index offsets from the counts
-  rmm::device_vector<int32_t> token_offsets(strings_count + 1);
   thrust::inclusive_scan(execpol->on(stream),
                          d_token_counts.template begin<int32_t>(),
                          d_token_counts.template end<int32_t>(),
-                         token_offsets.begin() + 1);
-  CUDA_TRY(cudaMemsetAsync(token_offsets.data().get(), 0, sizeof(int32_t), stream));
-  auto const total_tokens = token_offsets.back();
+                         d_token_offsets + 1);
+  CUDA_TRY(cudaMemsetAsync(d_token_offsets, 0, sizeof(int32_t), stream));
+  auto const total_tokens = cudf::detail::get_value<int32_t>(
+    cudf::column_view(cudf::data_type{cudf::INT32}, strings_count + 1, d_token_offsets),
+    strings_count,
+    stream);
   // build a list of pointers to each token
   rmm::device_vector<string_index_pair> tokens(total_tokens);
   // now go get the tokens
-  tokenizer.d_offsets = token_offsets.data().get();
+  tokenizer.d_offsets = d_token_offsets;
   tokenizer.d_tokens  = tokens.data().get();
   thrust::for_each_n(execpol->on(stream),
                      thrust::make_counting_iterator<cudf::size_type>(0),
                      strings_count,
                      tokenizer);
+  return tokens;
+}
+
+// common pattern for tokenize functions
+// -- the token-index offsets of each string are stored in d_token_offsets
+template <typename Tokenizer>
+std::unique_ptr<cudf::column> tokenize_fn(cudf::size_type strings_count,
+                                          Tokenizer tokenizer,
+                                          int32_t* d_token_offsets,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  auto const tokens = token_positions_fn(strings_count, tokenizer, d_token_offsets, stream);
   // create the strings column using the tokens pointers
   return cudf::make_strings_column(tokens, stream, mr);
 }
 
+template <typename Tokenizer>
+std::unique_ptr<cudf::column> tokenize_fn(cudf::size_type strings_count,
+                                          Tokenizer tokenizer,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  rmm::device_vector<int32_t> token_offsets(strings_count + 1);
+  return tokenize_fn(strings_count, tokenizer, token_offsets.data().get(), mr, stream);
+}
+
+// common pattern for tokenize_record functions
+// -- the token-index offsets become the offsets of the output lists
+template <typename Tokenizer>
+std::unique_ptr<cudf::column> tokenize_record_fn(cudf::strings_column_view const& strings,
+                                                 Tokenizer tokenizer,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto offsets             = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto tokens = tokenize_fn(
+    strings_count, tokenizer, offsets->mutable_view().data<int32_t>(), mr, stream);
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(tokens),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
 }  // namespace
 
 // detail APIs
@@ -133,6 +185,37 @@ std::unique_ptr<cudf::column> tokenize(cudf::strings_column_view const& strings,
     stream);
 }
 
+// zero or more character tokenizer into lists
+std::unique_ptr<cudf::column> tokenize_record(cudf::strings_column_view const& strings,
+                                              cudf::string_scalar const& delimiter,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  return tokenize_record_fn(strings, strings_tokenizer{*strings_column, d_delimiter}, mr, stream);
+}
+
+// one or more string delimiter tokenizer into lists
+std::unique_ptr<cudf::column> tokenize_record(cudf::strings_column_view const& strings,
+                                              cudf::strings_column_view const& delimiters,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(delimiters.size() > 0, "Parameter delimiters must not be empty");
+  CUDF_EXPECTS(!delimiters.has_nulls(), "Parameter delimiters must not have nulls");
+  auto strings_column    = cudf::column_device_view::create(strings.parent(), stream);
+  auto delimiters_column = cudf::column_device_view::create(delimiters.parent(), stream);
+  return tokenize_record_fn(
+    strings,
+    multi_delimiter_strings_tokenizer{*strings_column,
+                                      delimiters_column->begin<cudf::string_view>(),
+                                      delimiters_column->end<cudf::string_view>()},
+    mr,
+    stream);
+}
+
 // one or more string delimiter token counter
 std::unique_ptr<cudf::column> count_tokens(cudf::strings_column_view const& strings,
                                            cudf::strings_column_view const& delimiters,
@@ -214,6 +297,68 @@ std::unique_ptr<cudf::column> character_tokenize(cudf::strings_column_view const
                                    mr);
 }
 
+// tokens to vocabulary ids
+std::unique_ptr<token_vocabulary> load_token_vocabulary(
+  cudf::strings_column_view const& vocabulary,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(vocabulary.null_count() == 0, "Vocabulary must not contain nulls");
+  auto result    = std::make_unique<token_vocabulary>();
+  result->tokens = std::make_unique<cudf::column>(vocabulary.parent(), stream, mr);
+  std::tie(result->table, result->table_size) =
+    build_vocabulary_table(result->tokens->view(), false, mr, stream);
+  return result;
+}
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       token_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr,
+                                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+  auto const strings_count = strings.size();
+  auto strings_column      = cudf::column_device_view::create(strings.parent(), stream);
+
+  // locate the tokens without building the token strings
+  auto offsets = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto const tokens = token_positions_fn(strings_count,
+                                         strings_tokenizer{*strings_column, d_delimiter},
+                                         offsets->mutable_view().data<int32_t>(),
+                                         stream);
+
+  // look up each token in the vocabulary
+  auto const tokens_count = static_cast<cudf::size_type>(tokens.size());
+  auto ids                = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, tokens_count, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_vocabulary = cudf::column_device_view::create(vocabulary.tokens->view(), stream);
+  vocabulary_table_fn const table_fn{
+    *d_vocabulary,
+    static_cast<int32_t*>(const_cast<void*>(vocabulary.table.data())),
+    static_cast<uint32_t>(vocabulary.table_size - 1),
+    false};
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    tokens.begin(),
+                    tokens.end(),
+                    ids->mutable_view().data<int32_t>(),
+                    [table_fn, default_id] __device__(string_index_pair const& token) {
+                      auto const id = table_fn.find(cudf::string_view(token.first, token.second));
+                      return id == empty_vocabulary_slot ? default_id : id;
+                    });
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(ids),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -234,6 +379,22 @@ std::unique_ptr<cudf::column> tokenize(cudf::strings_column_view const& strings,
   return detail::tokenize(strings, delimiters, mr);
 }
 
+std::unique_ptr<cudf::column> tokenize_record(cudf::strings_column_view const& strings,
+                                              cudf::string_scalar const& delimiter,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_record(strings, delimiter, mr);
+}
+
+std::unique_ptr<cudf::column> tokenize_record(cudf::strings_column_view const& strings,
+                                              cudf::strings_column_view const& delimiters,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_record(strings, delimiters, mr);
+}
+
 std::unique_ptr<cudf::column> count_tokens(cudf::strings_column_view const& strings,
                                            cudf::string_scalar const& delimiter,
                                            rmm::mr::device_memory_resource* mr)
@@ -257,4 +418,22 @@ std::unique_ptr<cudf::column> character_tokenize(cudf::strings_column_view const
   return detail::character_tokenize(strings, 0, mr);
 }
 
+
+std::unique_ptr<token_vocabulary> load_token_vocabulary(cudf::strings_column_view const& vocabulary,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_token_vocabulary(vocabulary, mr);
+}
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       token_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_with_vocabulary(strings, vocabulary, delimiter, default_id, mr);
+}
+
 }  // namespace nvtext
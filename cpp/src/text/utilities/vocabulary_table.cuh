@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+
+#include <utility>
+
+namespace nvtext {
+namespace detail {
+constexpr int32_t empty_vocabulary_slot = -1;
+constexpr uint32_t continuation_salt    = 0x9E3779B9;
+
+/**
+ * @brief Device view of an open addressing hash table of vocabulary rows.
+ *
+ * Each slot holds the row of a vocabulary token, which is also its id.
+ *
+ * With `wordpieces` set, tokens starting with `##` are continuation pieces. They
+ * are keyed without the prefix and hash to different slots than word starts
+ * with the same characters.
+ */
+struct vocabulary_table_fn {
+  cudf::column_device_view const d_tokens;
+  int32_t* d_table;
+  uint32_t table_mask;
+  bool wordpieces;
+
+  __device__ uint32_t hash(cudf::string_view const& key, bool continuation) const
+  {
+    auto const hash = cudf::detail::MurmurHash3_32<cudf::string_view>{}(key);
+    return continuation ? hash ^ continuation_salt : hash;
+  }
+
+  __device__ cudf::string_view key(cudf::size_type row, bool& continuation) const
+  {
+    auto const d_token = d_tokens.element<cudf::string_view>(row);
+    continuation       = wordpieces && d_token.size_bytes() > 2 && d_token.data()[0] == '#' &&
+                   d_token.data()[1] == '#';
+    return continuation ? cudf::string_view(d_token.data() + 2, d_token.size_bytes() - 2)
+                        : d_token;
+  }
+
+  __device__ bool matches(cudf::size_type row,
+                          cudf::string_view const& key,
+                          bool continuation) const
+  {
+    bool row_continuation = false;
+    auto const row_key    = this->key(row, row_continuation);
+    return (row_continuation == continuation) && (row_key == key);
+  }
+
+  /**
+   * @brief Inserts a vocabulary row; the lowest row wins for duplicate tokens.
+   */
+  __device__ void insert(cudf::size_type row) const
+  {
+    bool continuation = false;
+    auto const d_key  = key(row, continuation);
+    auto slot         = hash(d_key, continuation) & table_mask;
+    while (true) {
+      auto const existing = atomicCAS(d_table + slot, empty_vocabulary_slot, row);
+      if (existing == empty_vocabulary_slot) return;
+      if (matches(existing, d_key, continuation)) {
+        atomicMin(d_table + slot, row);
+        return;
+      }
+      slot = (slot + 1) & table_mask;
+    }
+  }
+
+  /**
+   * @brief Returns the token id of the key or -1 if it is not in the vocabulary.
+   */
+  __device__ int32_t find(cudf::string_view const& key, bool continuation = false) const
+  {
+    auto slot = hash(key, continuation) & table_mask;
+    while (true) {
+      auto const row = d_table[slot];
+      if (row == empty_vocabulary_slot || matches(row, key, continuation)) return row;
+      slot = (slot + 1) & table_mask;
+    }
+  }
+};
+
+/**
+ * @brief Builds the hash table of the rows of a vocabulary strings column.
+ *
+ * The table has a power of 2 number of slots, at least twice the vocabulary size.
+ *
+ * @param tokens Vocabulary strings without nulls.
+ * @param wordpieces Key `##` tokens as continuation pieces.
+ * @param mr Device memory resource used to allocate the table.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The table and its number of slots.
+ */
+inline std::pair<rmm::device_buffer, cudf::size_type> build_vocabulary_table(
+  cudf::column_view const& tokens,
+  bool wordpieces,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  cudf::size_type table_size = 2;
+  while (table_size < 2 * tokens.size()) table_size *= 2;
+  rmm::device_buffer table(table_size * sizeof(int32_t), stream, mr);
+  auto d_table = static_cast<int32_t*>(table.data());
+  auto execpol = rmm::exec_policy(stream);
+  thrust::fill_n(execpol->on(stream), d_table, table_size, empty_vocabulary_slot);
+
+  auto d_tokens = cudf::column_device_view::create(tokens, stream);
+  vocabulary_table_fn table_fn{
+    *d_tokens, d_table, static_cast<uint32_t>(table_size - 1), wordpieces};
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     tokens.size(),
+                     [table_fn] __device__(cudf::size_type row) { table_fn.insert(row); });
+  return std::make_pair(std::move(table), table_size);
+}
+
+}  // namespace detail
+}  // namespace nvtext
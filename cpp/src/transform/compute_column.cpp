@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <jit/cache.h>
+#include <jit/launcher.h>
+#include <jit/type.h>
+#include "expression_interpreter.hpp"
+#include "jit/code/code.h"
+
+#include <bit.hpp.jit>
+#include <jit/common_headers.hpp>
+#include <types.hpp.jit>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+namespace {
+const std::vector<std::string> expression_header_names{cudf_types_hpp, cudf_utilities_bit_hpp};
+
+std::istream* expression_headers_code(std::string filename, std::iostream& stream)
+{
+  auto it = cudf::jit::stringified_headers.find(filename);
+  if (it != cudf::jit::stringified_headers.end()) {
+    return cudf::jit::send_stringified_header(stream, it->second);
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Largest table evaluated by the interpreter when no compiled kernel is cached
+ *
+ * Compiling an expression takes a few hundred milliseconds, far longer than interpreting
+ * it over this many rows.
+ */
+constexpr size_type max_interpreted_rows = 1 << 18;
+
+bool is_floating(data_type type)
+{
+  return type.id() == type_id::FLOAT32 || type.id() == type_id::FLOAT64;
+}
+
+bool is_unsigned(data_type type)
+{
+  switch (type.id()) {
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::UINT32:
+    case type_id::UINT64: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns the type both operands of a binary operator are converted to
+ *
+ * Follows the C++ usual arithmetic conversions without promoting small integers
+ * to `int`, so that e.g. `INT8 + INT8` stays `INT8` like in `binary_operation`.
+ */
+data_type common_type(data_type lhs, data_type rhs)
+{
+  if (lhs == rhs) { return lhs; }
+  if (is_floating(lhs) || is_floating(rhs)) {
+    return (lhs.id() == type_id::FLOAT64 || rhs.id() == type_id::FLOAT64)
+             ? data_type{type_id::FLOAT64}
+             : data_type{type_id::FLOAT32};
+  }
+  if (lhs.id() == type_id::BOOL8) { return rhs; }
+  if (rhs.id() == type_id::BOOL8) { return lhs; }
+  if (size_of(lhs) != size_of(rhs)) { return size_of(lhs) > size_of(rhs) ? lhs : rhs; }
+  return is_unsigned(lhs) ? lhs : rhs;
+}
+
+/**
+ * @brief The type the operands of an operation are converted to and the type of its result
+ */
+struct operation_types {
+  data_type operands;
+  data_type output;
+};
+
+operation_types get_operation_types(ast::ast_operator op, data_type lhs, data_type rhs)
+{
+  auto const common    = common_type(lhs, rhs);
+  auto const bool_type = data_type{type_id::BOOL8};
+  switch (op) {
+    case ast::ast_operator::TRUE_DIV: {
+      auto const type = common.id() == type_id::FLOAT32 ? common : data_type{type_id::FLOAT64};
+      return {type, type};
+    }
+    case ast::ast_operator::EQUAL:
+    case ast::ast_operator::NOT_EQUAL:
+    case ast::ast_operator::LESS:
+    case ast::ast_operator::GREATER:
+    case ast::ast_operator::LESS_EQUAL:
+    case ast::ast_operator::GREATER_EQUAL:
+    case ast::ast_operator::NULL_EQUALS: return {common, bool_type};
+    case ast::ast_operator::BITWISE_AND:
+    case ast::ast_operator::BITWISE_OR:
+    case ast::ast_operator::BITWISE_XOR:
+      CUDF_EXPECTS(not is_floating(common), "Bitwise operators require integer operands");
+      return {common, common};
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::LOGICAL_OR:
+    case ast::ast_operator::NOT: return {bool_type, bool_type};
+    case ast::ast_operator::NEGATE: return {lhs, lhs};
+    case ast::ast_operator::IS_NULL: return {lhs, bool_type};
+    default: return {common, common};
+  }
+}
+
+/**
+ * @brief Returns whether an operation may be null when its operands may be null
+ */
+bool is_nullable(ast::ast_operator op, bool lhs_nullable, bool rhs_nullable)
+{
+  switch (op) {
+    case ast::ast_operator::NULL_EQUALS:
+    case ast::ast_operator::IS_NULL: return false;
+    case ast::ast_operator::COALESCE: return lhs_nullable && rhs_nullable;
+    default: return lhs_nullable || rhs_nullable;
+  }
+}
+
+bool is_unary(ast::ast_operator op)
+{
+  return op == ast::ast_operator::NOT || op == ast::ast_operator::NEGATE ||
+         op == ast::ast_operator::IS_NULL;
+}
+
+/**
+ * @brief Translates an expression tree for the JIT compiler and the interpreter
+ *
+ * For the JIT compiler, every node is evaluated into a value `n<k>` and a validity
+ * `v<k>` of the generated kernel. Column data, masks and literals are passed through
+ * the `inputs` array so that the source only depends on the structure and the types
+ * of the expression, not on the data. It is used as the key of the JIT cache.
+ *
+ * For the interpreter, the nodes are emitted as a postfix program using the same inputs.
+ */
+class expression_compiler {
+ public:
+  struct node_info {
+    std::string name;  // suffix of the value and validity variables
+    data_type type;
+    bool nullable;  // whether any row may be null
+  };
+
+  expression_compiler(table_view const& table, cudaStream_t stream)
+    : _table{table}, _stream{stream}
+  {
+  }
+
+  node_info compile(ast::expression const& expr)
+  {
+    switch (expr.kind()) {
+      case ast::expression::node_kind::COLUMN_REFERENCE: return compile_column(expr);
+      case ast::expression::node_kind::LITERAL: return compile_literal(expr);
+      default: return compile_operation(expr);
+    }
+  }
+
+  /**
+   * @brief Returns the source of the kernel writing the value of `root` to each row
+   */
+  std::string kernel_source(node_info const& root) const
+  {
+    std::ostringstream source;
+    source << code::expression_kernel_header;
+    source << "\n__global__ void kernel(cudf::size_type size, "
+           << cudf::jit::get_type_name(root.type) << "* out_data, cudf::bitmask_type* out_mask, "
+           << "void const* const* inputs, cudf::size_type const* offsets) {\n"
+           << _prologue.str()
+           << "  int start = threadIdx.x + blockIdx.x * blockDim.x;\n"
+           << "  int step = blockDim.x * gridDim.x;\n"
+           << "  for (cudf::size_type i = start; i < size; i += step) {\n"
+           << _body.str() << "    out_data[i] = n" << root.name << ";\n"
+           << "    if (out_mask != nullptr && !v" << root.name
+           << ") { cudf::clear_bit(out_mask, i); }\n"
+           << "  }\n}\n";
+    return source.str();
+  }
+
+  std::vector<void const*> const& inputs() const noexcept { return _inputs; }
+  std::vector<size_type> const& offsets() const noexcept { return _offsets; }
+  std::vector<interpreter::instruction> const& program() const noexcept { return _program; }
+  size_type max_stack_depth() const noexcept { return _max_stack_depth; }
+
+ private:
+  // Adds the data and validity pointers of an input and returns its slot
+  size_type add_input(void const* data, void const* validity, size_type offset)
+  {
+    auto const slot = static_cast<size_type>(_offsets.size());
+    _inputs.push_back(data);
+    _inputs.push_back(validity);
+    _offsets.push_back(offset);
+    return slot;
+  }
+
+  void emit(interpreter::instruction const& ins)
+  {
+    _program.push_back(ins);
+    if (ins.code == interpreter::opcode::LOAD_COLUMN ||
+        ins.code == interpreter::opcode::LOAD_LITERAL) {
+      _max_stack_depth = std::max(_max_stack_depth, ++_stack_depth);
+    } else if (ins.code == interpreter::opcode::OPERATION && not is_unary(ins.op)) {
+      --_stack_depth;
+    }
+  }
+
+  // Converts the value `depth` below the top of the interpreter stack
+  void emit_cast(data_type from, data_type to, size_type depth)
+  {
+    if (from != to) { emit({interpreter::opcode::CAST, {}, to, from, depth}); }
+  }
+
+  std::string next_name() { return std::to_string(_num_nodes++); }
+
+  node_info compile_column(ast::expression const& expr)
+  {
+    auto const index = expr.column_index();
+    CUDF_EXPECTS(index < _table.num_columns(), "Column reference out of range");
+    // Each column is read once per row by the JIT kernel, however often it is referenced
+    auto const found = _columns.find(index);
+    if (found != _columns.end()) {
+      emit({interpreter::opcode::LOAD_COLUMN, {}, found->second.type, {}, _slots[index]});
+      return found->second;
+    }
+
+    auto const& col = _table.column(index);
+    CUDF_EXPECTS(is_numeric(col.type()), "Expression columns must be of a numeric type");
+    auto const slot = add_input(cudf::jit::get_data_ptr(col), col.null_mask(), col.offset());
+    auto const type = cudf::jit::get_type_name(col.type());
+    auto const name = next_name();
+    _prologue << "  auto const d" << slot << " = static_cast<" << type << " const*>(inputs["
+              << 2 * slot << "]);\n"
+              << "  auto const m" << slot << " = static_cast<cudf::bitmask_type const*>(inputs["
+              << 2 * slot + 1 << "]);\n"
+              << "  auto const o" << slot << " = offsets[" << slot << "];\n";
+    _body << "    bool const v" << name << " = m" << slot << " == nullptr || cudf::bit_is_set(m"
+          << slot << ", o" << slot << " + i);\n"
+          << "    " << type << " const n" << name << " = d" << slot << "[i];\n";
+    emit({interpreter::opcode::LOAD_COLUMN, {}, col.type(), {}, slot});
+    node_info info{name, col.type(), col.nullable()};
+    _columns.emplace(index, info);
+    _slots.emplace(index, slot);
+    return info;
+  }
+
+  node_info compile_literal(ast::expression const& expr)
+  {
+    auto const& value = expr.literal_value();
+    auto const slot   = add_input(cudf::jit::get_data_ptr(value), value.validity_data(), 0);
+    auto const type   = cudf::jit::get_type_name(value.type());
+    auto const name   = next_name();
+    // Literals are loaded once, before the loop over the rows
+    _prologue << "  " << type << " const n" << name << " = *static_cast<" << type
+              << " const*>(inputs[" << 2 * slot << "]);\n"
+              << "  bool const v" << name << " = *static_cast<bool const*>(inputs["
+              << 2 * slot + 1 << "]);\n";
+    emit({interpreter::opcode::LOAD_LITERAL, {}, value.type(), {}, slot});
+    return {name, value.type(), not value.is_valid(_stream)};
+  }
+
+  node_info compile_operation(ast::expression const& expr)
+  {
+    auto const op    = expr.op();
+    auto const lhs   = compile(expr.child(0));
+    auto const rhs   = is_unary(op) ? lhs : compile(expr.child(1));
+    auto const types = get_operation_types(op, lhs.type, rhs.type);
+    auto const name  = next_name();
+
+    if (is_unary(op)) {
+      emit_cast(lhs.type, types.operands, 0);
+    } else {
+      emit_cast(lhs.type, types.operands, 1);
+      emit_cast(rhs.type, types.operands, 0);
+    }
+    emit({interpreter::opcode::OPERATION, op, types.operands, {}, 0});
+
+    auto const operand_type = cudf::jit::get_type_name(types.operands);
+    auto const a            = "static_cast<" + operand_type + ">(n" + lhs.name + ")";
+    auto const b            = "static_cast<" + operand_type + ">(n" + rhs.name + ")";
+    auto const valid_lhs  = "v" + lhs.name;
+    auto const valid_rhs  = "v" + rhs.name;
+    auto const valid_both = valid_lhs + " && " + valid_rhs;
+
+    auto const value = [&]() -> std::string {
+      switch (op) {
+        case ast::ast_operator::ADD: return a + " + " + b;
+        case ast::ast_operator::SUB: return a + " - " + b;
+        case ast::ast_operator::MUL: return a + " * " + b;
+        case ast::ast_operator::DIV:
+        case ast::ast_operator::TRUE_DIV: return a + " / " + b;
+        case ast::ast_operator::MOD:
+          if (not is_floating(types.operands)) { return a + " % " + b; }
+          return (types.operands.id() == type_id::FLOAT32 ? "fmodf(" : "fmod(") + a + ", " + b +
+                 ")";
+        case ast::ast_operator::EQUAL: return a + " == " + b;
+        case ast::ast_operator::NOT_EQUAL: return a + " != " + b;
+        case ast::ast_operator::LESS: return a + " < " + b;
+        case ast::ast_operator::GREATER: return a + " > " + b;
+        case ast::ast_operator::LESS_EQUAL: return a + " <= " + b;
+        case ast::ast_operator::GREATER_EQUAL: return a + " >= " + b;
+        case ast::ast_operator::BITWISE_AND: return a + " & " + b;
+        case ast::ast_operator::BITWISE_OR: return a + " | " + b;
+        case ast::ast_operator::BITWISE_XOR: return a + " ^ " + b;
+        case ast::ast_operator::LOGICAL_AND: return a + " && " + b;
+        case ast::ast_operator::LOGICAL_OR: return a + " || " + b;
+        case ast::ast_operator::NULL_EQUALS:
+          return "(" + valid_both + ") ? (" + a + " == " + b + ") : (!" + valid_lhs + " && !" +
+                 valid_rhs + ")";
+        case ast::ast_operator::COALESCE: return valid_lhs + " ? " + a + " : " + b;
+        case ast::ast_operator::NOT: return "!" + a;
+        case ast::ast_operator::NEGATE: return "-" + a;
+        case ast::ast_operator::IS_NULL: return "!" + valid_lhs;
+        default: CUDF_FAIL("Unsupported expression operator");
+      }
+    }();
+    auto const validity = [&]() -> std::string {
+      switch (op) {
+        case ast::ast_operator::NULL_EQUALS:
+        case ast::ast_operator::IS_NULL: return "true";
+        case ast::ast_operator::COALESCE: return valid_lhs + " || " + valid_rhs;
+        default: return is_unary(op) ? valid_lhs : valid_both;
+      }
+    }();
+
+    _body << "    bool const v" << name << " = " << validity << ";\n"
+          << "    " << cudf::jit::get_type_name(types.output) << " const n" << name << " = "
+          << value << ";\n";
+    return {name, types.output, is_nullable(op, lhs.nullable, rhs.nullable)};
+  }
+
+  table_view const& _table;
+  cudaStream_t _stream;
+  std::ostringstream _prologue;
+  std::ostringstream _body;
+  std::vector<void const*> _inputs;
+  std::vector<size_type> _offsets;
+  std::map<size_type, node_info> _columns;
+  std::map<size_type, size_type> _slots;
+  std::vector<interpreter::instruction> _program;
+  size_type _stack_depth{0};
+  size_type _max_stack_depth{0};
+  size_type _num_nodes{0};
+};
+
+}  // namespace
+}  // namespace jit
+}  // namespace transformation
+
+namespace detail {
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       ast::evaluation_strategy strategy,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  transformation::jit::expression_compiler compiler{table, stream};
+  auto const root = compiler.compile(expr);
+
+  auto const size = table.num_rows();
+  auto output     = make_fixed_width_column(
+    root.type, size, root.nullable ? mask_state::ALL_VALID : mask_state::UNALLOCATED, stream, mr);
+  if (size == 0) { return output; }
+
+  // Expressions of the same structure and types share the source and its compiled kernel
+  auto const source = compiler.kernel_source(root);
+  auto const hash   = "prog_ast" + std::to_string(std::hash<std::string>{}(source));
+
+  auto const interpretable =
+    compiler.max_stack_depth() <= transformation::interpreter::max_stack_depth;
+  CUDF_EXPECTS(interpretable || strategy != ast::evaluation_strategy::INTERPRETER,
+               "Expression too deep for the interpreter");
+  auto const interpret =
+    strategy == ast::evaluation_strategy::INTERPRETER ||
+    (strategy == ast::evaluation_strategy::AUTO && interpretable &&
+     size <= transformation::jit::max_interpreted_rows &&
+     not cudf::jit::cudfJitCache::Instance().isKernelInstantiationCached("kernel", hash, {}));
+
+  // Copy the input pointers, then the offsets, into one device buffer
+  auto const& inputs      = compiler.inputs();
+  auto const& offsets     = compiler.offsets();
+  auto const inputs_bytes = inputs.size() * sizeof(void const*);
+  rmm::device_buffer d_inputs(inputs_bytes + offsets.size() * sizeof(size_type), stream);
+  auto const d_offsets = reinterpret_cast<size_type*>(static_cast<char*>(d_inputs.data()) +
+                                                      inputs_bytes);
+  CUDA_TRY(cudaMemcpyAsync(
+    d_inputs.data(), inputs.data(), inputs_bytes, cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaMemcpyAsync(d_offsets,
+                           offsets.data(),
+                           offsets.size() * sizeof(size_type),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  auto const d_input_ptrs = static_cast<void const* const*>(d_inputs.data());
+
+  mutable_column_view output_view = *output;
+  if (interpret) {
+    transformation::interpreter::evaluate(
+      output_view, compiler.program(), d_input_ptrs, d_offsets, stream);
+    return output;
+  }
+
+  cudf::jit::launcher(hash,
+                      source,
+                      transformation::jit::expression_header_names,
+                      cudf::jit::compiler_flags,
+                      transformation::jit::expression_headers_code,
+                      stream)
+    .set_kernel_inst("kernel", {})
+    .launch(size,
+            cudf::jit::get_data_ptr(output_view),
+            output_view.null_mask(),
+            d_input_ptrs,
+            static_cast<size_type const*>(d_offsets));
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       ast::expression const& expr,
+                                       ast::evaluation_strategy strategy,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, strategy, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <transform/expression_interpreter.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <cmath>
+#include <type_traits>
+
+namespace cudf {
+namespace transformation {
+namespace interpreter {
+namespace {
+/**
+ * @brief Storage of one stack value, large enough for any numeric type
+ */
+using stack_value = int64_t;
+
+template <typename T>
+__device__ T& value_as(stack_value& value)
+{
+  return *reinterpret_cast<T*>(&value);
+}
+
+/**
+ * @brief Reads the element `row` of typed input data into a stack value
+ */
+struct load_fn {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  __device__ void operator()(void const* data, size_type row, stack_value& value)
+  {
+    value_as<T>(value) = static_cast<T const*>(data)[row];
+  }
+
+  template <typename T, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  __device__ void operator()(void const*, size_type, stack_value&)
+  {
+    release_assert(false && "Expression inputs must be numeric");
+  }
+};
+
+/**
+ * @brief Writes a stack value to the element `row` of the output column
+ */
+struct store_fn {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  __device__ void operator()(mutable_column_device_view output, size_type row, stack_value& value)
+  {
+    output.element<T>(row) = value_as<T>(value);
+  }
+
+  template <typename T, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  __device__ void operator()(mutable_column_device_view, size_type, stack_value&)
+  {
+    release_assert(false && "Expression output must be numeric");
+  }
+};
+
+template <typename From>
+struct cast_to_fn {
+  template <typename To, std::enable_if_t<is_numeric<To>()>* = nullptr>
+  __device__ void operator()(stack_value& value)
+  {
+    From const from     = value_as<From>(value);
+    value_as<To>(value) = static_cast<To>(from);
+  }
+
+  template <typename To, std::enable_if_t<not is_numeric<To>()>* = nullptr>
+  __device__ void operator()(stack_value&)
+  {
+    release_assert(false && "Expression values must be numeric");
+  }
+};
+
+/**
+ * @brief Converts a stack value between numeric types
+ */
+struct cast_fn {
+  template <typename From, std::enable_if_t<is_numeric<From>()>* = nullptr>
+  __device__ void operator()(data_type to, stack_value& value)
+  {
+    type_dispatcher(to, cast_to_fn<From>{}, value);
+  }
+
+  template <typename From, std::enable_if_t<not is_numeric<From>()>* = nullptr>
+  __device__ void operator()(data_type, stack_value&)
+  {
+    release_assert(false && "Expression values must be numeric");
+  }
+};
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ T modulo(T lhs, T rhs)
+{
+  return fmod(lhs, rhs);
+}
+
+template <typename T, std::enable_if_t<not std::is_floating_point<T>::value>* = nullptr>
+__device__ T modulo(T lhs, T rhs)
+{
+  return lhs % rhs;
+}
+
+template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+__device__ T bitwise(ast::ast_operator op, T lhs, T rhs)
+{
+  switch (op) {
+    case ast::ast_operator::BITWISE_AND: return lhs & rhs;
+    case ast::ast_operator::BITWISE_OR: return lhs | rhs;
+    default: return lhs ^ rhs;
+  }
+}
+
+template <typename T, std::enable_if_t<not std::is_integral<T>::value>* = nullptr>
+__device__ T bitwise(ast::ast_operator, T, T)
+{
+  release_assert(false && "Bitwise operators require integer operands");
+  return T{};
+}
+
+/**
+ * @brief Applies an operator to two stack values of the same type
+ *
+ * The result and its validity replace the lhs. Unary operators only use the lhs.
+ */
+struct operation_fn {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  __device__ void operator()(ast::ast_operator op,
+                             stack_value& lhs,
+                             stack_value rhs,
+                             bool& lhs_valid,
+                             bool rhs_valid)
+  {
+    T const a        = value_as<T>(lhs);
+    T const b        = value_as<T>(rhs);
+    bool const valid = lhs_valid && rhs_valid;
+    switch (op) {
+      case ast::ast_operator::ADD: value_as<T>(lhs) = a + b; break;
+      case ast::ast_operator::SUB: value_as<T>(lhs) = a - b; break;
+      case ast::ast_operator::MUL: value_as<T>(lhs) = a * b; break;
+      case ast::ast_operator::DIV:
+      case ast::ast_operator::TRUE_DIV: value_as<T>(lhs) = a / b; break;
+      case ast::ast_operator::MOD: value_as<T>(lhs) = modulo(a, b); break;
+      case ast::ast_operator::EQUAL: value_as<bool>(lhs) = a == b; break;
+      case ast::ast_operator::NOT_EQUAL: value_as<bool>(lhs) = a != b; break;
+      case ast::ast_operator::LESS: value_as<bool>(lhs) = a < b; break;
+      case ast::ast_operator::GREATER: value_as<bool>(lhs) = a > b; break;
+      case ast::ast_operator::LESS_EQUAL: value_as<bool>(lhs) = a <= b; break;
+      case ast::ast_operator::GREATER_EQUAL: value_as<bool>(lhs) = a >= b; break;
+      case ast::ast_operator::BITWISE_AND:
+      case ast::ast_operator::BITWISE_OR:
+      case ast::ast_operator::BITWISE_XOR: value_as<T>(lhs) = bitwise(op, a, b); break;
+      case ast::ast_operator::LOGICAL_AND: value_as<bool>(lhs) = a && b; break;
+      case ast::ast_operator::LOGICAL_OR: value_as<bool>(lhs) = a || b; break;
+      case ast::ast_operator::NULL_EQUALS:
+        value_as<bool>(lhs) = valid ? a == b : (!lhs_valid && !rhs_valid);
+        lhs_valid           = true;
+        return;
+      case ast::ast_operator::COALESCE:
+        value_as<T>(lhs) = lhs_valid ? a : b;
+        lhs_valid        = lhs_valid || rhs_valid;
+        return;
+      case ast::ast_operator::NOT: value_as<bool>(lhs) = !a; break;
+      case ast::ast_operator::NEGATE: value_as<T>(lhs) = -a; break;
+      case ast::ast_operator::IS_NULL:
+        value_as<bool>(lhs) = !lhs_valid;
+        lhs_valid           = true;
+        return;
+      default: release_assert(false && "Unsupported expression operator");
+    }
+    lhs_valid = valid;
+  }
+
+  template <typename T, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  __device__ void operator()(ast::ast_operator, stack_value&, stack_value, bool&, bool)
+  {
+    release_assert(false && "Expression values must be numeric");
+  }
+};
+
+__device__ bool is_unary(ast::ast_operator op)
+{
+  return op == ast::ast_operator::NOT || op == ast::ast_operator::NEGATE ||
+         op == ast::ast_operator::IS_NULL;
+}
+
+/**
+ * @brief Runs the expression program for every row
+ *
+ * All threads run the same instructions, so the interpreter loop does not diverge. Each warp
+ * evaluates 32 consecutive rows and writes their validity as one word of the output mask.
+ */
+__global__ void evaluate_kernel(mutable_column_device_view output,
+                                instruction const* program,
+                                size_type program_size,
+                                void const* const* inputs,
+                                size_type const* offsets)
+{
+  stack_value stack[max_stack_depth];
+  bool valid[max_stack_depth];
+
+  auto const lane_id{threadIdx.x % cudf::detail::warp_size};
+  size_type row    = threadIdx.x + blockIdx.x * blockDim.x;
+  auto active_mask = __ballot_sync(0xFFFF'FFFF, row < output.size());
+  while (row < output.size()) {
+    size_type top = 0;
+    for (size_type pc = 0; pc < program_size; ++pc) {
+      instruction const ins = program[pc];
+      switch (ins.code) {
+        case opcode::LOAD_COLUMN: {
+          auto const mask = static_cast<bitmask_type const*>(inputs[2 * ins.operand + 1]);
+          valid[top] = mask == nullptr || bit_is_set(mask, offsets[ins.operand] + row);
+          type_dispatcher(ins.type, load_fn{}, inputs[2 * ins.operand], row, stack[top]);
+          ++top;
+          break;
+        }
+        case opcode::LOAD_LITERAL:
+          valid[top] = *static_cast<bool const*>(inputs[2 * ins.operand + 1]);
+          type_dispatcher(ins.type, load_fn{}, inputs[2 * ins.operand], 0, stack[top]);
+          ++top;
+          break;
+        case opcode::CAST:
+          type_dispatcher(ins.source_type, cast_fn{}, ins.type, stack[top - 1 - ins.operand]);
+          break;
+        default:
+          if (is_unary(ins.op)) {
+            type_dispatcher(ins.type,
+                            operation_fn{},
+                            ins.op,
+                            stack[top - 1],
+                            stack[top - 1],
+                            valid[top - 1],
+                            true);
+          } else {
+            type_dispatcher(ins.type,
+                            operation_fn{},
+                            ins.op,
+                            stack[top - 2],
+                            stack[top - 1],
+                            valid[top - 2],
+                            valid[top - 1]);
+            --top;
+          }
+      }
+    }
+    type_dispatcher(output.type(), store_fn{}, output, row, stack[0]);
+    if (output.nullable()) {
+      bitmask_type const validity = __ballot_sync(active_mask, valid[0]);
+      if (lane_id == 0) { output.null_mask()[word_index(row)] = validity; }
+    }
+    row += blockDim.x * gridDim.x;
+    active_mask = __ballot_sync(active_mask, row < output.size());
+  }
+}
+
+}  // namespace
+
+void evaluate(mutable_column_view output,
+              std::vector<instruction> const& program,
+              void const* const* inputs,
+              size_type const* offsets,
+              cudaStream_t stream)
+{
+  CUDF_EXPECTS(!program.empty(), "Empty expression program");
+  CUDF_EXPECTS(!output.nullable() || output.offset() == 0,
+               "Nullable output column must not be offset");
+  if (output.size() == 0) { return; }
+
+  rmm::device_vector<instruction> d_program(program);
+  auto d_output = mutable_column_device_view::create(output, stream);
+
+  // The block size is a multiple of the warp size, so every warp starts at a mask word
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d grid{output.size(), block_size};
+  evaluate_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+    *d_output, d_program.data().get(), static_cast<size_type>(program.size()), inputs, offsets);
+  CHECK_CUDA(stream);
+}
+
+}  // namespace interpreter
+}  // namespace transformation
+}  // namespace cudf
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace transformation {
+namespace interpreter {
+/**
+ * @brief Maximum number of values on the stack of the expression interpreter
+ */
+constexpr size_type max_stack_depth = 32;
+
+/**
+ * @brief Kinds of instructions of an interpreted expression
+ */
+enum class opcode : int8_t {
+  LOAD_COLUMN,   ///< Push the row's value of the column in input slot `operand`
+  LOAD_LITERAL,  ///< Push the literal in input slot `operand`
+  CAST,          ///< Convert the value `operand` below the top from `source_type` to `type`
+  OPERATION      ///< Pop the operands of `op`, all of `type`, and push the result
+};
+
+/**
+ * @brief One step of an expression program in postfix order
+ */
+struct instruction {
+  opcode code;            ///< Kind of the instruction
+  ast::ast_operator op;   ///< Operator of an `OPERATION`
+  data_type type;         ///< Type of the loaded or converted value, or of the operands
+  data_type source_type;  ///< Type converted from by a `CAST`
+  size_type operand;      ///< Input slot of a load, stack position of a `CAST`
+};
+
+/**
+ * @brief Evaluates an expression program on every row with a precompiled kernel
+ *
+ * The inputs are laid out as by the expression JIT compiler: input slot `s` has its data at
+ * `inputs[2 * s]`, its null mask or literal validity at `inputs[2 * s + 1]` and its mask
+ * offset at `offsets[s]`.
+ *
+ * @param output The column receiving the program's value in each row. If it has a null mask,
+ * which must not be offset, it is overwritten with the validity of every row.
+ * @param program The instructions, leaving one value on the stack
+ * @param inputs Device array of the input data and validity pointers
+ * @param offsets Device array of the input mask offsets
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void evaluate(mutable_column_view output,
+              std::vector<instruction> const& program,
+              void const* const* inputs,
+              size_type const* offsets,
+              cudaStream_t stream);
+
+}  // namespace interpreter
+}  // namespace transformation
+}  // namespace cudf
@@ -22,6 +22,9 @@ namespace jit {
 namespace code {
 extern const char* kernel_header;
 extern const char* kernel;
+extern const char* multi_input_kernel_header;
+extern const char* multi_input_kernel;
+extern const char* expression_kernel_header;
 extern const char* traits;
 extern const char* operation;
 
@@ -46,6 +46,48 @@ const char* kernel =
     }
   )***";
 
+const char* multi_input_kernel_header =
+  R"***(
+    #include <cudf/types.hpp>
+    #include <cudf/utilities/bit.hpp>
+    #include <simt/limits>
+
+    #include <cudf/wrappers/timestamps.hpp>
+  )***";
+
+// TRANSFORM_INPUTS_* are defined by the host for the types and the number of the inputs
+const char* multi_input_kernel =
+  R"***(
+    template <typename TypeOut>
+    __global__
+    void multi_input_kernel(cudf::size_type size,
+                    TypeOut* out_data, cudf::bitmask_type* out_mask,
+                    void const* const* inputs, cudf::size_type const* offsets) {
+        TRANSFORM_INPUTS_PROLOGUE
+
+        int tid = threadIdx.x;
+        int blkid = blockIdx.x;
+        int blksz = blockDim.x;
+        int gridsz = gridDim.x;
+
+        int start = tid + blkid * blksz;
+        int step = blksz * gridsz;
+
+        for (cudf::size_type i=start; i<size; i+=step) {
+          TRANSFORM_INPUTS_LOAD(i)
+          bool valid = TRANSFORM_INPUTS_VALID;
+          GENERIC_TRANSFORM_OP(&out_data[i], &valid, TRANSFORM_INPUTS_ARGS(i));
+          if (!valid) { cudf::clear_bit(out_mask, i); }
+        }
+    }
+  )***";
+
+const char* expression_kernel_header =
+  R"***(
+    #include <cudf/types.hpp>
+    #include <cudf/utilities/bit.hpp>
+  )***";
+
 }  // namespace code
 }  // namespace jit
 }  // namespace transformation
@@ -19,6 +19,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -27,16 +28,23 @@
 #include <jit/type.h>
 #include "jit/code/code.h"
 
+#include <bit.hpp.jit>
 #include <jit/common_headers.hpp>
 #include <timestamps.hpp.jit>
 #include <types.hpp.jit>
 
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <sstream>
+
 namespace cudf {
 namespace transformation {
 //! Jit functions
 namespace jit {
 
-const std::vector<std::string> header_names{cudf_types_hpp, cudf_wrappers_timestamps_hpp};
+const std::vector<std::string> header_names{
+  cudf_types_hpp, cudf_utilities_bit_hpp, cudf_wrappers_timestamps_hpp};
 
 std::istream* headers_code(std::string filename, std::iostream& stream)
 {
@@ -78,6 +86,86 @@ void unary_operation(mutable_column_view output,
     .launch(output.size(), cudf::jit::get_data_ptr(output), cudf::jit::get_data_ptr(input));
 }
 
+/**
+ * @brief Returns the definitions of the `TRANSFORM_INPUTS_*` macros of the multi-input kernel
+ *
+ * Input `k` is read from `inputs[2k]`, its null mask from `inputs[2k + 1]` at the bit offset
+ * `offsets[k]`. Each input is passed to the UDF as its value followed by its validity.
+ */
+std::string multi_input_macros(table_view const& inputs)
+{
+  std::ostringstream prologue, load, valid, args;
+  valid << "true";
+  for (size_type k = 0; k < inputs.num_columns(); ++k) {
+    auto const type = cudf::jit::get_type_name(inputs.column(k).type());
+    prologue << " auto const d" << k << " = static_cast<" << type << " const*>(inputs[" << 2 * k
+             << "]); auto const m" << k << " = static_cast<cudf::bitmask_type const*>(inputs["
+             << 2 * k + 1 << "]); auto const o" << k << " = offsets[" << k << "];";
+    load << " bool const v" << k << " = m" << k << " == nullptr || cudf::bit_is_set(m" << k
+         << ", o" << k << " + i);";
+    valid << " && v" << k;
+    args << (k == 0 ? "" : ", ") << "d" << k << "[i], v" << k;
+  }
+  return "\n#define TRANSFORM_INPUTS_PROLOGUE" + prologue.str() +
+         "\n#define TRANSFORM_INPUTS_LOAD(i)" + load.str() +
+         "\n#define TRANSFORM_INPUTS_VALID (" + valid.str() + ")" +
+         "\n#define TRANSFORM_INPUTS_ARGS(i) " + args.str() + "\n";
+}
+
+void multi_input_operation(mutable_column_view output,
+                           table_view const& inputs,
+                           const std::string& udf,
+                           bool is_ptx,
+                           cudaStream_t stream)
+{
+  std::string cuda_source = code::multi_input_kernel_header + multi_input_macros(inputs);
+  if (is_ptx) {
+    // The output value and validity are the only pointer parameters
+    cuda_source += cudf::jit::parse_single_function_ptx(
+                     udf, "GENERIC_TRANSFORM_OP", cudf::jit::get_type_name(output.type()), {0, 1}) +
+                   code::multi_input_kernel;
+  } else {
+    cuda_source +=
+      cudf::jit::parse_single_function_cuda(udf, "GENERIC_TRANSFORM_OP") + code::multi_input_kernel;
+  }
+  // The source depends on the input types as well as on the UDF
+  std::string hash =
+    "prog_transform_multi" + std::to_string(std::hash<std::string>{}(cuda_source));
+
+  // Copy the input pointers, then the mask offsets, into one device buffer
+  std::vector<void const*> input_ptrs;
+  std::vector<size_type> offsets;
+  for (auto const& col : inputs) {
+    input_ptrs.push_back(cudf::jit::get_data_ptr(col));
+    input_ptrs.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+  auto const inputs_bytes = input_ptrs.size() * sizeof(void const*);
+  rmm::device_buffer d_inputs(inputs_bytes + offsets.size() * sizeof(size_type), stream);
+  auto const d_offsets =
+    reinterpret_cast<size_type*>(static_cast<char*>(d_inputs.data()) + inputs_bytes);
+  CUDA_TRY(cudaMemcpyAsync(
+    d_inputs.data(), input_ptrs.data(), inputs_bytes, cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaMemcpyAsync(d_offsets,
+                           offsets.data(),
+                           offsets.size() * sizeof(size_type),
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  cudf::jit::launcher(hash,
+                      cuda_source,
+                      header_names,
+                      cudf::jit::compiler_flags,
+                      headers_code,
+                      stream)
+    .set_kernel_inst("multi_input_kernel", {cudf::jit::get_type_name(output.type())})
+    .launch(output.size(),
+            cudf::jit::get_data_ptr(output),
+            output.null_mask(),
+            static_cast<void const* const*>(d_inputs.data()),
+            static_cast<size_type const*>(d_offsets));
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -104,6 +192,33 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(inputs.num_columns() > 0, "Transform requires at least one input column.");
+  CUDF_EXPECTS(std::all_of(inputs.begin(),
+                           inputs.end(),
+                           [](column_view const& col) { return is_fixed_width(col.type()); }),
+               "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(is_fixed_width(output_type), "Unexpected non-fixed-width output type.");
+
+  // The UDF clears the bits of the null rows
+  std::unique_ptr<column> output =
+    make_fixed_width_column(output_type, inputs.num_rows(), mask_state::ALL_VALID, stream, mr);
+
+  if (inputs.num_rows() == 0) { return output; }
+
+  mutable_column_view output_view = *output;
+
+  transformation::jit::multi_input_operation(output_view, inputs, udf, is_ptx, stream);
+
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -116,4 +231,14 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, mr);
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(inputs, udf, output_type, is_ptx, mr);
+}
+
 }  // namespace cudf
@@ -13,20 +13,134 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/nvtx_utils.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
+namespace {
+constexpr size_type tile_dim  = 32;  // Tiles are tile_dim x tile_dim elements
+constexpr size_type tile_rows = 8;   // Each block has tile_dim x tile_rows threads
+
+/**
+ * @brief Transposes the fixed-width values of `input` into `output` one tile at a time.
+ *
+ * A tile is read with consecutive threads reading consecutive rows of a column and written
+ * with consecutive threads writing consecutive columns of an output row, so both sides are
+ * coalesced. The validity of each output row of the tile is gathered into a single word with
+ * a warp ballot and or-ed into the null mask of `output`, which must start all null.
+ */
+template <typename T, bool has_nulls>
+__global__ void transpose_tiles(table_device_view input, mutable_column_device_view output)
+{
+  // The extra column keeps the column-wise reads of the tile free of bank conflicts
+  __shared__ T tile[tile_dim][tile_dim + 1];
+  __shared__ bool tile_valid[tile_dim][tile_dim + 1];
+
+  auto const num_rows    = input.num_rows();
+  auto const num_columns = input.num_columns();
+  for (size_type row_tile = blockIdx.x * tile_dim; row_tile < num_rows;
+       row_tile += gridDim.x * tile_dim) {
+    for (size_type column_tile = blockIdx.y * tile_dim; column_tile < num_columns;
+         column_tile += gridDim.y * tile_dim) {
+      auto const row = row_tile + threadIdx.x;
+      for (size_type k = threadIdx.y; k < tile_dim; k += tile_rows) {
+        auto const column = column_tile + k;
+        if (row < num_rows && column < num_columns) {
+          auto const& source         = input.column(column);
+          tile[k][threadIdx.x]       = source.element<T>(row);
+          tile_valid[k][threadIdx.x] = has_nulls && source.is_valid(row);
+        }
+      }
+      __syncthreads();
+
+      // Each value of threadIdx.y is a warp, so the ballot covers a tile row
+      auto const column = column_tile + threadIdx.x;
+      for (size_type k = threadIdx.y; k < tile_dim; k += tile_rows) {
+        auto const out_row   = row_tile + k;
+        auto const in_bounds = out_row < num_rows && column < num_columns;
+        auto const index     = out_row * num_columns + column;
+        if (in_bounds) { output.element<T>(index) = tile[threadIdx.x][k]; }
+        if (has_nulls) {
+          auto const bits = __ballot_sync(0xffffffff, in_bounds && tile_valid[threadIdx.x][k]);
+          if (threadIdx.x == 0 && bits != 0) {
+            auto const first = out_row * num_columns + column_tile;
+            auto const mask  = output.null_mask();
+            auto const shift = intra_word_index(first);
+            auto const word  = word_index(first);
+            atomicOr(mask + word, bits << shift);
+            if (shift > 0 && (bits >> (32 - shift)) != 0) {
+              atomicOr(mask + word + 1, bits >> (32 - shift));
+            }
+          }
+        }
+      }
+      __syncthreads();
+    }
+  }
+}
+
+/**
+ * @brief Transposes a table of fixed-width columns into a single column, moving the
+ * values as `T`, an integer of the same size as the column type.
+ */
+template <typename T>
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto const nullable = has_nulls(input);
+  auto output         = make_fixed_width_column(input.column(0).type(),
+                                        input.num_rows() * input.num_columns(),
+                                        nullable ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+  auto const d_input  = table_device_view::create(input, stream);
+  auto const d_output = mutable_column_device_view::create(output->mutable_view(), stream);
+
+  dim3 const block(tile_dim, tile_rows);
+  dim3 const grid(util::div_rounding_up_safe(input.num_rows(), tile_dim),
+                  std::min(util::div_rounding_up_safe(input.num_columns(), tile_dim), 65535));
+  if (nullable) {
+    transpose_tiles<T, true><<<grid, block, 0, stream>>>(*d_input, *d_output);
+    output->set_null_count(UNKNOWN_NULL_COUNT);
+  } else {
+    transpose_tiles<T, false><<<grid, block, 0, stream>>>(*d_input, *d_output);
+  }
+  CHECK_CUDA(stream);
+  return output;
+}
+
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  switch (size_of(input.column(0).type())) {
+    case 1: return transpose_fixed_width<int8_t>(input, mr, stream);
+    case 2: return transpose_fixed_width<int16_t>(input, mr, stream);
+    case 4: return transpose_fixed_width<int32_t>(input, mr, stream);
+    case 8: return transpose_fixed_width<int64_t>(input, mr, stream);
+    default: return cudf::interleave_columns(input, mr);
+  }
+}
+
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::mr::device_memory_resource* mr,
                                                          cudaStream_t stream)
@@ -45,13 +159,17 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
 
   nvtx::range_push("CUDF_TRANSPOSE", nvtx::color::GREEN);
 
-  auto output_column = cudf::interleave_columns(input, mr);
+  // Other types are transposed by interleaving the columns
+  auto output_column = is_fixed_width(dtype)
+                         ? transpose_fixed_width(input, mr, stream)
+                         : cudf::interleave_columns(input, mr);
   auto one_iter      = thrust::make_counting_iterator<size_type>(1);
   auto splits_iter   = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
   auto splits = std::vector<size_type>(splits_iter, splits_iter + input.num_rows() - 1);
   auto output_column_views = cudf::split(output_column->view(), splits);
 
+  nvtx::range_pop();
   return std::make_pair(std::move(output_column), table_view(output_column_views));
 }
 }  // namespace detail
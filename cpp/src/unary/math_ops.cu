@@ -249,6 +249,12 @@ struct MathOpDispatcher {
     return launch<T, F>(input, op, mr, stream);
   }
 
+  template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(cudf::mutable_column_view& in_out, cudaStream_t stream)
+  {
+    cudf::unary::launcher<T, T, F>::launch(in_out, stream);
+  }
+
   template <typename T, typename std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
   std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
                                            cudf::unary_op op,
@@ -257,6 +263,12 @@ struct MathOpDispatcher {
   {
     CUDF_FAIL("Unsupported datatype for operation");
   }
+
+  template <typename T, typename std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(cudf::mutable_column_view& in_out, cudaStream_t stream)
+  {
+    CUDF_FAIL("Unsupported datatype for operation");
+  }
 };
 
 template <typename F>
@@ -270,6 +282,12 @@ struct BitwiseOpDispatcher {
     return launch<T, F>(input, op, mr, stream);
   }
 
+  template <typename T, typename std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  void operator()(cudf::mutable_column_view& in_out, cudaStream_t stream)
+  {
+    cudf::unary::launcher<T, T, F>::launch(in_out, stream);
+  }
+
   template <typename T, typename std::enable_if_t<!std::is_integral<T>::value>* = nullptr>
   std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
                                            cudf::unary_op op,
@@ -278,6 +296,12 @@ struct BitwiseOpDispatcher {
   {
     CUDF_FAIL("Unsupported datatype for operation");
   }
+
+  template <typename T, typename std::enable_if_t<!std::is_integral<T>::value>* = nullptr>
+  void operator()(cudf::mutable_column_view& in_out, cudaStream_t stream)
+  {
+    CUDF_FAIL("Unsupported datatype for operation");
+  }
 };
 
 template <typename F>
@@ -310,86 +334,113 @@ struct LogicalOpDispatcher {
   {
     CUDF_FAIL("Unsupported datatype for operation");
   }
+
+  // The result is only written in place into a column of the output type
+  template <typename T, typename std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+  void operator()(cudf::mutable_column_view& in_out, cudaStream_t stream)
+  {
+    cudf::unary::launcher<T, bool, F>::launch(in_out, stream);
+  }
+
+  template <typename T, typename std::enable_if_t<!std::is_same<T, bool>::value>* = nullptr>
+  void operator()(cudf::mutable_column_view& in_out, cudaStream_t stream)
+  {
+    CUDF_FAIL("Unsupported datatype for in-place operation");
+  }
 };
 
-std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
-                                              cudf::unary_op op,
-                                              rmm::mr::device_memory_resource* mr,
-                                              cudaStream_t stream)
+// Dispatch `args` to the functor of `op` for the data type `type`
+template <typename... Args>
+decltype(auto) dispatch_unary_operation(cudf::unary_op op, cudf::data_type type, Args&&... args)
 {
   switch (op) {
     case cudf::unary_op::SIN:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceSin>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceSin>{}, std::forward<Args>(args)...);
     case cudf::unary_op::COS:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceCos>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceCos>{}, std::forward<Args>(args)...);
     case cudf::unary_op::TAN:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceTan>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceTan>{}, std::forward<Args>(args)...);
     case cudf::unary_op::ARCSIN:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceArcSin>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceArcSin>{}, std::forward<Args>(args)...);
     case cudf::unary_op::ARCCOS:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceArcCos>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceArcCos>{}, std::forward<Args>(args)...);
     case cudf::unary_op::ARCTAN:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceArcTan>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceArcTan>{}, std::forward<Args>(args)...);
     case cudf::unary_op::SINH:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceSinH>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceSinH>{}, std::forward<Args>(args)...);
     case cudf::unary_op::COSH:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceCosH>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceCosH>{}, std::forward<Args>(args)...);
     case cudf::unary_op::TANH:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceTanH>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceTanH>{}, std::forward<Args>(args)...);
     case cudf::unary_op::ARCSINH:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceArcSinH>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceArcSinH>{}, std::forward<Args>(args)...);
     case cudf::unary_op::ARCCOSH:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceArcCosH>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceArcCosH>{}, std::forward<Args>(args)...);
     case cudf::unary_op::ARCTANH:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceArcTanH>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceArcTanH>{}, std::forward<Args>(args)...);
     case cudf::unary_op::EXP:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceExp>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceExp>{}, std::forward<Args>(args)...);
     case cudf::unary_op::LOG:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceLog>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceLog>{}, std::forward<Args>(args)...);
     case cudf::unary_op::SQRT:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceSqrt>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceSqrt>{}, std::forward<Args>(args)...);
     case cudf::unary_op::CBRT:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceCbrt>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceCbrt>{}, std::forward<Args>(args)...);
     case cudf::unary_op::CEIL:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceCeil>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceCeil>{}, std::forward<Args>(args)...);
     case cudf::unary_op::FLOOR:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceFloor>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceFloor>{}, std::forward<Args>(args)...);
     case cudf::unary_op::ABS:
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceAbs>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceAbs>{}, std::forward<Args>(args)...);
     case cudf::unary_op::RINT:
-      CUDF_EXPECTS((input.type().id() == FLOAT32) or (input.type().id() == FLOAT64),
+      CUDF_EXPECTS((type.id() == FLOAT32) or (type.id() == FLOAT64),
                    "rint expects floating point values");
       return cudf::type_dispatcher(
-        input.type(), detail::MathOpDispatcher<detail::DeviceRInt>{}, input, op, mr, stream);
+        type, detail::MathOpDispatcher<detail::DeviceRInt>{}, std::forward<Args>(args)...);
     case cudf::unary_op::BIT_INVERT:
       return cudf::type_dispatcher(
-        input.type(), detail::BitwiseOpDispatcher<detail::DeviceInvert>{}, input, op, mr, stream);
+        type, detail::BitwiseOpDispatcher<detail::DeviceInvert>{}, std::forward<Args>(args)...);
     case cudf::unary_op::NOT:
       return cudf::type_dispatcher(
-        input.type(), detail::LogicalOpDispatcher<detail::DeviceNot>{}, input, op, mr, stream);
+        type, detail::LogicalOpDispatcher<detail::DeviceNot>{}, std::forward<Args>(args)...);
     default: CUDF_FAIL("Undefined unary operation");
   }
 }
 
+std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
+                                              cudf::unary_op op,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  return dispatch_unary_operation(op, input.type(), input, op, mr, stream);
+}
+
+void unary_operation_in_place(cudf::mutable_column_view& in_out,
+                              cudf::unary_op op,
+                              cudaStream_t stream)
+{
+  dispatch_unary_operation(op, in_out.type(), in_out, stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -400,4 +451,10 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   return detail::unary_operation(input, op, mr);
 }
 
+void unary_operation_in_place(cudf::mutable_column_view& in_out, cudf::unary_op op)
+{
+  CUDF_FUNC_RANGE();
+  detail::unary_operation_in_place(in_out, op, 0);
+}
+
 }  // namespace cudf
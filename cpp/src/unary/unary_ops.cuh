@@ -72,6 +72,19 @@ struct launcher {
 
     return output;
   }
+
+  static void launch(cudf::mutable_column_view& in_out, cudaStream_t stream = 0)
+  {
+    if (in_out.size() == 0) return;
+
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      in_out.begin<T>(),
+                      in_out.end<T>(),
+                      in_out.begin<Tout>(),
+                      F{});
+
+    CHECK_CUDA(stream);
+  }
 };
 
 }  // namespace unary
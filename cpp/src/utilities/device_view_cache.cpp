@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/device_view_cache.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Most descriptors cached by one API call
+ *
+ * Bounds the memory held by the cache and the cost of its linear lookups.
+ */
+constexpr std::size_t max_cached_device_views = 32;
+
+struct device_view_cache {
+  int depth{0};  ///< Number of nested scopes
+  std::vector<std::pair<device_view_key, std::shared_ptr<rmm::device_buffer>>> entries;
+};
+
+thread_local device_view_cache current_cache;
+
+void append_column_key(column_view const& col, device_view_key& key)
+{
+  key.push_back(static_cast<int64_t>(col.type().id()));
+  key.push_back(col.type().scale());
+  key.push_back(col.size());
+  key.push_back(reinterpret_cast<int64_t>(col.head()));
+  key.push_back(reinterpret_cast<int64_t>(col.null_mask()));
+  key.push_back(col.offset());
+  key.push_back(col.num_children());
+  for (size_type i = 0; i < col.num_children(); ++i) { append_column_key(col.child(i), key); }
+}
+
+}  // namespace
+
+device_view_key make_device_view_key(std::vector<column_view> const& columns,
+                                     bool is_table,
+                                     cudaStream_t stream)
+{
+  int device{-1};
+  CUDA_TRY(cudaGetDevice(&device));
+  device_view_key key{is_table ? 1 : 0, device, reinterpret_cast<int64_t>(stream)};
+  for (auto const& col : columns) { append_column_key(col, key); }
+  return key;
+}
+
+bool device_view_cache_active() noexcept { return current_cache.depth > 0; }
+
+std::shared_ptr<rmm::device_buffer> find_cached_device_view(device_view_key const& key)
+{
+  auto const& entries = current_cache.entries;
+  auto const entry    = std::find_if(
+    entries.begin(), entries.end(), [&key](auto const& entry) { return entry.first == key; });
+  return entry == entries.end() ? nullptr : entry->second;
+}
+
+void cache_device_view(device_view_key key, std::shared_ptr<rmm::device_buffer> storage)
+{
+  auto& cache = current_cache;
+  if (cache.depth == 0 || cache.entries.size() >= max_cached_device_views) { return; }
+  cache.entries.emplace_back(std::move(key), std::move(storage));
+}
+
+void enter_device_view_cache() noexcept { ++current_cache.depth; }
+
+void exit_device_view_cache() noexcept
+{
+  auto& cache = current_cache;
+  if (--cache.depth == 0) { cache.entries.clear(); }
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/detail/utilities/memory_estimate.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <numeric>
+
+
+namespace cudf {
+namespace detail {
+std::size_t estimate_gathered_size(column_view const& input, size_type num_rows, bool nullable)
+{
+  if (num_rows == 0) { return 0; }
+  std::size_t size = (nullable || input.nullable()) ? bitmask_allocation_size_bytes(num_rows) : 0;
+  if (is_fixed_width(input.type())) { return size + size_of(input.type()) * num_rows; }
+  if (input.num_children() == 0) { return size; }
+
+  switch (input.type().id()) {
+    case type_id::STRING:
+    case type_id::LIST: {
+      // The offsets cover every row of the parent, also the rows outside of a sliced view
+      auto const parent_rows = input.child(0).size() - 1;
+      size += (static_cast<std::size_t>(num_rows) + 1) * sizeof(size_type);
+      auto const& elements = input.child(1);
+      auto const element_rows =
+        (parent_rows > 0) ? static_cast<size_type>(static_cast<double>(elements.size()) *
+                                                   num_rows / parent_rows)
+                          : 0;
+      return size + estimate_gathered_size(elements, element_rows);
+    }
+    case type_id::DICTIONARY32: {
+      auto const& keys = input.child(1);
+      return size + estimate_gathered_size(input.child(0), num_rows) +
+             estimate_gathered_size(keys, keys.size());
+    }
+    default:
+      for (size_type i = 0; i < input.num_children(); ++i) {
+        size += estimate_gathered_size(input.child(i), num_rows);
+      }
+      return size;
+  }
+}
+
+std::size_t estimate_gathered_size(table_view const& input, size_type num_rows, bool nullable)
+{
+  return std::accumulate(input.begin(),
+                         input.end(),
+                         std::size_t{0},
+                         [num_rows, nullable](std::size_t sum, column_view const& col) {
+                           return sum + estimate_gathered_size(col, num_rows, nullable);
+                         });
+}
+
+}  // namespace detail
+}  // namespace cudf
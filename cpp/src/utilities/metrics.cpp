@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+namespace cudf {
+namespace detail {
+std::atomic<bool> metrics_enabled{false};
+
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * @brief A completed API call whose GPU time is not computed yet
+ */
+struct completed_operation {
+  std::string name;
+  double wall_time_ms;
+  cudaEvent_t start;  ///< Null if the events could not be created
+  cudaEvent_t stop;
+  int64_t output_bytes;
+  int64_t peak_bytes;
+};
+
+/**
+ * @brief The outermost API call measured on a thread
+ */
+struct active_operation {
+  int depth{0};  ///< Number of nested `begin_operation` not ended yet
+  char const* name{nullptr};
+  clock_type::time_point start_time;
+  cudaEvent_t start{nullptr};
+  int64_t current_bytes{0};
+  int64_t peak_bytes{0};
+};
+
+thread_local active_operation current_operation;
+
+std::mutex& completed_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<completed_operation>& completed_operations()
+{
+  static std::vector<completed_operation> operations;
+  return operations;
+}
+
+}  // namespace
+
+void begin_operation(char const* name) noexcept
+{
+  auto& op = current_operation;
+  if (op.depth++ > 0) { return; }
+  op.name          = name;
+  op.current_bytes = 0;
+  op.peak_bytes    = 0;
+  op.start         = nullptr;
+  // The GPU time is only measured when the events can be created; errors are not thrown from
+  // the destructors that end the operations
+  if (cudaEventCreate(&op.start) != cudaSuccess || cudaEventRecord(op.start, 0) != cudaSuccess) {
+    if (op.start != nullptr) { cudaEventDestroy(op.start); }
+    op.start = nullptr;
+    cudaGetLastError();
+  }
+  op.start_time = clock_type::now();
+}
+
+void end_operation() noexcept
+{
+  auto& op = current_operation;
+  if (--op.depth > 0) { return; }
+  auto const wall_time =
+    std::chrono::duration<double, std::milli>(clock_type::now() - op.start_time).count();
+  cudaEvent_t stop = nullptr;
+  if (op.start != nullptr &&
+      (cudaEventCreate(&stop) != cudaSuccess || cudaEventRecord(stop, 0) != cudaSuccess)) {
+    if (stop != nullptr) { cudaEventDestroy(stop); }
+    cudaEventDestroy(op.start);
+    op.start = stop = nullptr;
+    cudaGetLastError();
+  }
+  try {
+    std::lock_guard<std::mutex> lock(completed_mutex());
+    completed_operations().push_back(
+      {op.name, wall_time, op.start, stop, op.current_bytes, op.peak_bytes});
+  } catch (...) {
+    if (op.start != nullptr) {
+      cudaEventDestroy(op.start);
+      cudaEventDestroy(stop);
+    }
+  }
+}
+
+void track_allocation(int64_t bytes) noexcept
+{
+  auto& op = current_operation;
+  if (op.depth == 0) { return; }
+  op.current_bytes += bytes;
+  op.peak_bytes = std::max(op.peak_bytes, op.current_bytes);
+}
+
+}  // namespace detail
+
+namespace metrics {
+void enable() { detail::metrics_enabled = true; }
+
+void disable() { detail::metrics_enabled = false; }
+
+bool is_enabled() { return detail::metrics_enabled; }
+
+std::vector<operation_metrics> collect()
+{
+  std::vector<detail::completed_operation> completed;
+  {
+    std::lock_guard<std::mutex> lock(detail::completed_mutex());
+    completed.swap(detail::completed_operations());
+  }
+
+  // Every event is released before reporting the first error
+  cudaError_t error = cudaSuccess;
+  std::vector<operation_metrics> result;
+  result.reserve(completed.size());
+  for (auto& op : completed) {
+    float gpu_time = 0;
+    if (op.start != nullptr) {
+      auto const status = cudaEventSynchronize(op.stop) == cudaSuccess
+                            ? cudaEventElapsedTime(&gpu_time, op.start, op.stop)
+                            : cudaGetLastError();
+      if (error == cudaSuccess) { error = status; }
+      cudaEventDestroy(op.start);
+      cudaEventDestroy(op.stop);
+    }
+    auto const output_bytes = std::max<int64_t>(op.output_bytes, 0);
+    result.push_back({std::move(op.name),
+                      op.wall_time_ms,
+                      gpu_time,
+                      op.output_bytes,
+                      std::max<int64_t>(op.peak_bytes - output_bytes, 0)});
+  }
+  CUDA_TRY(error);
+  return result;
+}
+
+void* metrics_resource_adaptor::do_allocate(std::size_t bytes, cudaStream_t stream)
+{
+  auto const p = _upstream->allocate(bytes, stream);
+  detail::track_allocation(static_cast<int64_t>(bytes));
+  return p;
+}
+
+void metrics_resource_adaptor::do_deallocate(void* p, std::size_t bytes, cudaStream_t stream)
+{
+  _upstream->deallocate(p, bytes, stream);
+  detail::track_allocation(-static_cast<int64_t>(bytes));
+}
+
+}  // namespace metrics
+}  // namespace cudf
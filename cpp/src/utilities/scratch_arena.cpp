@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/detail/utilities/scratch_arena.hpp>
+
+namespace cudf {
+namespace detail {
+scratch_arena::scratch_arena(std::size_t capacity, rmm::mr::device_memory_resource* upstream)
+  : _upstream{upstream}, _capacity{aligned_size(capacity)}
+{
+}
+
+scratch_arena::~scratch_arena()
+{
+  if (_workspace != nullptr) { _upstream->deallocate(_workspace, _capacity, _stream); }
+}
+
+void* scratch_arena::do_allocate(std::size_t bytes, cudaStream_t stream)
+{
+  auto const size = aligned_size(bytes);
+  if (size == 0 || _capacity - _top < size) { return _upstream->allocate(bytes, stream); }
+  if (_workspace == nullptr) {
+    _workspace = static_cast<char*>(_upstream->allocate(_capacity, stream));
+    _stream    = stream;
+  }
+  _buffers.emplace_back(_top, true);
+  auto const p = _workspace + _top;
+  _top += size;
+  return p;
+}
+
+void scratch_arena::do_deallocate(void* p, std::size_t bytes, cudaStream_t stream)
+{
+  auto const ptr = static_cast<char*>(p);
+  if (_workspace == nullptr || ptr < _workspace || ptr >= _workspace + _capacity) {
+    _upstream->deallocate(p, bytes, stream);
+    return;
+  }
+  auto const offset = static_cast<std::size_t>(ptr - _workspace);
+  auto buffer       = _buffers.rbegin();
+  while (buffer->first != offset) { ++buffer; }
+  buffer->second = false;
+  // Reclaim the released buffers at the top of the stack
+  while (!_buffers.empty() && !_buffers.back().second) {
+    _top = _buffers.back().first;
+    _buffers.pop_back();
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
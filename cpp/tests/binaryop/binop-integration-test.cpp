@@ -45,6 +45,28 @@ TEST_F(BinaryOperationIntegrationTest, Add_Scalar_Vector_SI32_FP32_SI64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ADD());
 }
 
+TEST_F(BinaryOperationIntegrationTest, Add_Precompiled_SI32_FP32_SI64)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = float;
+  using TypeRhs = int64_t;
+
+  using ADD = cudf::library::operation::Add<TypeOut, TypeLhs, TypeRhs>;
+
+  cudf::precompile_binary_operations({{cudf::binary_operator::ADD,
+                                       data_type(type_to_id<TypeLhs>()),
+                                       data_type(type_to_id<TypeRhs>()),
+                                       data_type(type_to_id<TypeOut>())}});
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(10000);
+  auto rhs = make_random_wrapped_column<TypeRhs>(10000);
+
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ADD());
+}
+
 TEST_F(BinaryOperationIntegrationTest, Add_Vector_Vector_SI32_FP32_FP32)
 {
   using TypeOut = int32_t;
@@ -1822,6 +1844,61 @@ TEST_F(BinaryOperationIntegrationTest, ATan2_Vector_Vector_FP64_FP32_FP64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ATAN2(), NearEqualComparator<TypeOut>{2});
 }
 
+TEST_F(BinaryOperationIntegrationTest, Add_Vector_Vector_durationD_durationD)
+{
+  using TypeOut = cudf::duration_D;
+
+  auto lhs = fixed_width_column_wrapper<cudf::duration_D>{{3, -7, 0, 100}, {1, 1, 1, 0}};
+  auto rhs = fixed_width_column_wrapper<cudf::duration_D>{{4, 7, -2, 1}};
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, data_type(type_to_id<TypeOut>()));
+
+  expect_columns_equal(
+    *out, fixed_width_column_wrapper<cudf::duration_D>{{7, 0, -2, 0}, {1, 1, 1, 0}});
+}
+
+TEST_F(BinaryOperationIntegrationTest, Sub_Scalar_Vector_durationS_durationS)
+{
+  using TypeOut = cudf::duration_s;
+
+  auto lhs = cudf::scalar_type_t<cudf::duration_s>(10);
+  auto rhs = fixed_width_column_wrapper<cudf::duration_s>{{4, 12, 10}};
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::SUB, data_type(type_to_id<TypeOut>()));
+
+  expect_columns_equal(*out, fixed_width_column_wrapper<cudf::duration_s>{{6, -2, 0}});
+}
+
+TEST_F(BinaryOperationIntegrationTest, Less_Vector_Scalar_B8_durationMS_durationMS)
+{
+  using TypeOut = bool;
+
+  auto lhs = fixed_width_column_wrapper<cudf::duration_ms>{{-5, 1000, 999, 1001}, {1, 1, 0, 1}};
+  auto rhs = cudf::scalar_type_t<cudf::duration_ms>(1000);
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::LESS, data_type(type_to_id<TypeOut>()));
+
+  expect_columns_equal(
+    *out, fixed_width_column_wrapper<bool>{{true, false, true, false}, {1, 1, 0, 1}});
+}
+
+TEST_F(BinaryOperationIntegrationTest, Mod_Scalar_Vector_SI32)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  using MOD = cudf::library::operation::Mod<TypeOut, TypeLhs, TypeRhs>;
+
+  // The scalar is the dividend, exercising the reversed operand order
+  auto lhs = make_random_wrapped_scalar<TypeLhs>();
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::MOD, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, MOD());
+}
+
 TEST_F(BinaryOperationIntegrationTest, ATan2_Vector_Vector_FP64_SI32_SI64)
 {
   using TypeOut = double;
@@ -1840,6 +1917,37 @@ TEST_F(BinaryOperationIntegrationTest, ATan2_Vector_Vector_FP64_SI32_SI64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ATAN2(), NearEqualComparator<TypeOut>{2});
 }
 
+TEST_F(BinaryOperationIntegrationTest, Add_Vector_Vector_SI32_InPlace)
+{
+  auto column = fixed_width_column_wrapper<int32_t>{{3, -7, 0, 100}, {1, 1, 1, 1}}.release();
+  auto rhs    = fixed_width_column_wrapper<int32_t>{{4, 7, -2, 1}, {1, 0, 1, 1}};
+  auto in_out = column->mutable_view();
+  cudf::binary_operation(in_out, column->view(), rhs, cudf::binary_operator::ADD);
+
+  EXPECT_EQ(column->null_count(), 1);
+  expect_columns_equivalent(*column,
+                            fixed_width_column_wrapper<int32_t>{{7, 0, -2, 101}, {1, 0, 1, 1}});
+}
+
+TEST_F(BinaryOperationIntegrationTest, Mul_Vector_Scalar_SI64_InPlace)
+{
+  auto column = fixed_width_column_wrapper<int64_t>{{3, -7, 0, 100}}.release();
+  auto rhs    = cudf::scalar_type_t<int64_t>(2);
+  auto in_out = column->mutable_view();
+  cudf::binary_operation(in_out, column->view(), rhs, cudf::binary_operator::MUL);
+
+  expect_columns_equal(*column, fixed_width_column_wrapper<int64_t>{{6, -14, 0, 200}});
+}
+
+TEST_F(BinaryOperationIntegrationTest, Sub_Scalar_Vector_SI32_NotNullableOutput)
+{
+  auto column = fixed_width_column_wrapper<int32_t>{{4, 12, 10}}.release();
+  auto lhs    = cudf::scalar_type_t<int32_t>(10, false);
+  auto in_out = column->mutable_view();
+  EXPECT_THROW(cudf::binary_operation(in_out, lhs, column->view(), cudf::binary_operator::SUB),
+               cudf::logic_error);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
@@ -53,6 +53,18 @@ TEST_F(BinopVerifyInputTest, Vector_Vector_ErrorSecondOperandVectorZeroSize)
     cudf::logic_error);
 }
 
+TEST_F(BinopVerifyInputTest, Precompile_ErrorUnsupportedSignature)
+{
+  auto const int_type = data_type(type_id::INT32);
+
+  EXPECT_THROW(cudf::precompile_binary_operations(
+                 {{cudf::binary_operator::GENERIC_BINARY, int_type, int_type, int_type}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::precompile_binary_operations(
+                 {{cudf::binary_operator::ADD, data_type(type_id::STRING), int_type, int_type}}),
+               cudf::logic_error);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
@@ -16,6 +16,7 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -496,4 +497,74 @@ TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorDiscontiguous)
     concatenated_bitmask.data(), gold_mask.data(), num_elements / CHAR_BIT);
 }
 
+TEST_F(CopyBitmaskTest, TestOffsetWithinFirstWord)
+{
+  thrust::host_vector<int> validity_bit(1000);
+  for (auto &m : validity_bit) { m = this->generate(); }
+  auto input_mask = cudf::test::detail::make_null_mask(validity_bit.begin(), validity_bit.end());
+
+  int begin_bit         = 5;
+  int end_bit           = 998;
+  auto gold_splice_mask = cudf::test::detail::make_null_mask(validity_bit.begin() + begin_bit,
+                                                             validity_bit.begin() + end_bit);
+
+  auto splice_mask = cudf::copy_bitmask(
+    static_cast<const cudf::bitmask_type *>(input_mask.data()), begin_bit, end_bit);
+
+  cleanEndWord(splice_mask, begin_bit, end_bit);
+  auto number_of_bits = end_bit - begin_bit;
+  cudf::test::expect_equal_buffers(
+    gold_splice_mask.data(), splice_mask.data(), number_of_bits / CHAR_BIT);
+}
+
+struct BitmaskBinopTest : public cudf::test::BaseFixture,
+                          cudf::test::UniformRandomGenerator<int> {
+  BitmaskBinopTest() : cudf::test::UniformRandomGenerator<int>{0, 1} {}
+};
+
+TEST_F(BitmaskBinopTest, AndOrWithOffsets)
+{
+  cudf::data_type t{cudf::type_id::INT32};
+  cudf::size_type num_elements = 1001;
+  thrust::host_vector<int> lhs_bits(num_elements);
+  thrust::host_vector<int> rhs_bits(num_elements);
+  for (auto &m : lhs_bits) { m = this->generate(); }
+  for (auto &m : rhs_bits) { m = this->generate(); }
+  cudf::column lhs{t,
+                   num_elements,
+                   rmm::device_buffer{num_elements * sizeof(int)},
+                   cudf::test::detail::make_null_mask(lhs_bits.begin(), lhs_bits.end())};
+  cudf::column rhs{t,
+                   num_elements,
+                   rmm::device_buffer{num_elements * sizeof(int)},
+                   cudf::test::detail::make_null_mask(rhs_bits.begin(), rhs_bits.end())};
+
+  // Rows [3, 903) of lhs against rows [37, 937) of rhs
+  cudf::size_type const size = 900;
+  auto const lhs_slice       = cudf::slice(lhs, {3, 3 + size}).front();
+  auto const rhs_slice       = cudf::slice(rhs, {37, 37 + size}).front();
+  thrust::host_vector<int> gold_and(size), gold_or(size);
+  for (cudf::size_type i = 0; i < size; ++i) {
+    gold_and[i] = lhs_bits[3 + i] && rhs_bits[37 + i];
+    gold_or[i]  = lhs_bits[3 + i] || rhs_bits[37 + i];
+  }
+  auto gold_and_mask = cudf::test::detail::make_null_mask(gold_and.begin(), gold_and.end());
+  auto gold_or_mask  = cudf::test::detail::make_null_mask(gold_or.begin(), gold_or.end());
+
+  auto and_mask = cudf::bitmask_and(cudf::table_view{{lhs_slice, rhs_slice}});
+  auto or_mask  = cudf::bitmask_or(cudf::table_view{{lhs_slice, rhs_slice}});
+  cleanEndWord(and_mask, 0, size);
+  cleanEndWord(or_mask, 0, size);
+  cudf::test::expect_equal_buffers(gold_and_mask.data(), and_mask.data(), size / CHAR_BIT);
+  cudf::test::expect_equal_buffers(gold_or_mask.data(), or_mask.data(), size / CHAR_BIT);
+}
+
+TEST_F(BitmaskBinopTest, OrWithNonNullableColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> nullable({1, 2, 3}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> non_nullable({1, 2, 3});
+  auto or_mask = cudf::bitmask_or(cudf::table_view{{nullable, non_nullable}});
+  EXPECT_EQ(0, static_cast<int>(or_mask.size()));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_statistics.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thread>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+
+struct ColumnStatisticsTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+int32_t value_of(std::shared_ptr<cudf::scalar const> const& s)
+{
+  return static_cast<cudf::numeric_scalar<int32_t> const*>(s.get())->value();
+}
+}  // namespace
+
+TEST_F(ColumnStatisticsTest, MinMax)
+{
+  auto col = fixed_width_column_wrapper<int32_t>({5, 1, 9, 3, 7}, {1, 0, 1, 1, 1}).release();
+  EXPECT_EQ(col->statistics().min, nullptr);
+
+  auto const min_max = cudf::column_min_max(*col);
+  EXPECT_EQ(value_of(min_max.first), 3);
+  EXPECT_EQ(value_of(min_max.second), 9);
+  EXPECT_EQ(col->statistics().min, min_max.first);
+  EXPECT_EQ(col->statistics().max, min_max.second);
+}
+
+TEST_F(ColumnStatisticsTest, SetStatistics)
+{
+  auto col = fixed_width_column_wrapper<int32_t>({5, 1, 9, 3, 7}).release();
+
+  // Statistics set from elsewhere are trusted
+  cudf::column_statistics statistics;
+  statistics.min = std::make_shared<cudf::numeric_scalar<int32_t>>(0);
+  statistics.max = std::make_shared<cudf::numeric_scalar<int32_t>>(10);
+  statistics.is_sorted[{cudf::order::ASCENDING, cudf::null_order::BEFORE}] = true;
+  statistics.approx_distinct                                               = 2;
+  col->set_statistics(statistics);
+  EXPECT_EQ(value_of(cudf::column_min_max(*col).first), 0);
+  EXPECT_EQ(value_of(cudf::column_min_max(*col).second), 10);
+  EXPECT_TRUE(cudf::column_is_sorted(*col));
+  EXPECT_EQ(cudf::column_approx_distinct(*col), 2);
+
+  // Copies share the statistics
+  cudf::column copy(*col);
+  EXPECT_EQ(copy.statistics().min, col->statistics().min);
+
+  statistics.max = std::make_shared<cudf::numeric_scalar<int64_t>>(10);
+  EXPECT_THROW(col->set_statistics(statistics), cudf::logic_error);
+}
+
+TEST_F(ColumnStatisticsTest, MutationClears)
+{
+  auto col = fixed_width_column_wrapper<int32_t>({5, 1, 9, 3, 7}).release();
+  EXPECT_FALSE(cudf::column_is_sorted(*col));
+  EXPECT_EQ(cudf::column_approx_distinct(*col), 5);
+  cudf::column_min_max(*col);
+  EXPECT_EQ(col->statistics().is_sorted.size(), 1u);
+
+  col->mutable_view();
+  EXPECT_EQ(col->statistics().min, nullptr);
+  EXPECT_EQ(col->statistics().max, nullptr);
+  EXPECT_TRUE(col->statistics().is_sorted.empty());
+  EXPECT_LT(col->statistics().approx_distinct, 0);
+
+  cudf::column_min_max(*col);
+  col->set_null_mask(rmm::device_buffer{}, 0);
+  EXPECT_EQ(col->statistics().min, nullptr);
+}
+
+TEST_F(ColumnStatisticsTest, ConcurrentFill)
+{
+  auto col = fixed_width_column_wrapper<int32_t>({5, 1, 9, 3, 7}, {1, 0, 1, 1, 1}).release();
+
+  // Threads filling the cache of the same column see the same statistics
+  std::vector<std::shared_ptr<cudf::scalar const>> mins(4);
+  std::vector<int> sorted(4);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < mins.size(); ++i) {
+    threads.emplace_back([&, i] {
+      mins[i]   = cudf::column_min_max(*col).first;
+      sorted[i] = cudf::column_is_sorted(*col, cudf::order::DESCENDING);
+      cudf::column_approx_distinct(*col);
+    });
+  }
+  for (auto& t : threads) { t.join(); }
+  for (size_t i = 0; i < mins.size(); ++i) {
+    EXPECT_EQ(mins[i], col->statistics().min);
+    EXPECT_FALSE(sorted[i]);
+  }
+  EXPECT_EQ(value_of(col->statistics().min), 3);
+  EXPECT_EQ(col->statistics().is_sorted.size(), 1u);
+  EXPECT_EQ(cudf::column_approx_distinct(*col), 4);
+}
@@ -26,6 +26,9 @@
 
 #include <thrust/sequence.h>
 
+#include <algorithm>
+#include <string>
+
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
 
@@ -237,6 +240,44 @@ TEST_F(TableTest, ConcatenateTablesWithOffsets)
   }
 }
 
+TEST_F(TableTest, ConcatenateManyTablesMatchesColumnConcatenate)
+{
+  // Many small, sliced and empty tables of several fixed-width columns, mixed with strings
+  constexpr cudf::size_type num_tables{40};
+  std::vector<std::unique_ptr<Table>> owners;
+  std::vector<TView> tables;
+  for (cudf::size_type t = 0; t < num_tables; ++t) {
+    auto const rows  = (t * 7) % 45;
+    auto const begin =
+      cudf::test::make_counting_transform_iterator(0, [t](auto i) { return i + t; });
+    auto const valid = cudf::test::make_counting_transform_iterator(0, [t](auto i) {
+      return t % 4 != 0 or i % 5 != 1;
+    });
+    std::vector<std::string> strings(rows + 1);
+    std::transform(begin, begin + rows + 1, strings.begin(), [](auto i) {
+      return std::to_string(i);
+    });
+    CVector cols;
+    cols.push_back(column_wrapper<int8_t>(begin, begin + rows + 1).release());
+    cols.push_back(column_wrapper<int64_t>(begin, begin + rows + 1, valid).release());
+    cols.push_back(s_col_wrapper(strings.begin(), strings.end(), valid).release());
+    cols.push_back(column_wrapper<double>(begin, begin + rows + 1, valid).release());
+    cols.push_back(column_wrapper<int32_t>(begin, begin + rows + 1).release());
+    owners.push_back(std::make_unique<Table>(std::move(cols)));
+    tables.push_back(cudf::slice(owners.back()->view(), {1, rows + 1}).front());
+  }
+
+  auto const concatenated = cudf::concatenate(tables);
+  ASSERT_EQ(concatenated->num_columns(), tables.front().num_columns());
+  for (cudf::size_type c = 0; c < concatenated->num_columns(); ++c) {
+    std::vector<column_view> columns;
+    std::transform(tables.begin(), tables.end(), std::back_inserter(columns), [c](auto const& t) {
+      return t.column(c);
+    });
+    cudf::test::expect_columns_equal(*cudf::concatenate(columns), concatenated->get_column(c));
+  }
+}
+
 TEST_F(TableTest, ConcatenateTablesWithOffsetsAndNulls)
 {
   cudf::test::fixed_width_column_wrapper<int32_t> col1_1{{5, 4, 3, 5, 8, 5, 6},
@@ -17,6 +17,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/transform.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
@@ -191,6 +192,33 @@ TYPED_TEST(CopyTest, CopyIfElseTestLong)
   cudf::test::expect_columns_equal(out->view(), expected_w);
 }
 
+TYPED_TEST(CopyTest, CopyIfElseTestBitmaskCondition)
+{
+  using T = TypeParam;
+
+  // span several mask words, with nulls in the condition and in both inputs
+  int num_els = 100;
+
+  std::vector<bool> mask(num_els), mask_v(num_els), lhs_v(num_els), rhs_v(num_els);
+  std::vector<int32_t> lhs(num_els, 5), rhs(num_els, 6);
+  for (int i = 0; i < num_els; ++i) {
+    mask[i]   = (i % 3) != 0;
+    mask_v[i] = (i % 11) != 0;
+    lhs_v[i]  = (i % 5) != 0;
+    rhs_v[i]  = (i % 7) != 0;
+  }
+  cudf::test::fixed_width_column_wrapper<bool> mask_w(mask.begin(), mask.end(), mask_v.begin());
+  wrapper<T> lhs_w(lhs.begin(), lhs.end(), lhs_v.begin());
+  wrapper<T> rhs_w(rhs.begin(), rhs.end(), rhs_v.begin());
+
+  auto condition      = cudf::bools_to_mask(mask_w);
+  auto condition_data = static_cast<cudf::bitmask_type const*>(condition.first->data());
+
+  auto expected = cudf::copy_if_else(lhs_w, rhs_w, mask_w);
+  auto out      = cudf::copy_if_else(lhs_w, rhs_w, condition_data);
+  cudf::test::expect_columns_equal(out->view(), expected->view());
+}
+
 TYPED_TEST(CopyTest, CopyIfElseTestEmptyInputs)
 {
   using T = TypeParam;
@@ -336,6 +364,30 @@ TYPED_TEST(CopyTestNumeric, CopyIfElseTestColumnScalar)
   cudf::test::expect_columns_equal(out->view(), expected_w);
 }
 
+TYPED_TEST(CopyTestNumeric, CopyIfElseTestScalarColumnBitmaskCondition)
+{
+  using T = TypeParam;
+
+  int num_els = 4;
+
+  bool mask[] = {1, 0, 0, 1};
+  cudf::test::fixed_width_column_wrapper<bool> mask_w(mask, mask + num_els);
+  auto condition = cudf::bools_to_mask(mask_w);
+
+  cudf::numeric_scalar<T> lhs_w(5);
+
+  T rhs[]      = {6, 6, 6, 6};
+  bool rhs_v[] = {1, 0, 1, 1};
+  wrapper<T> rhs_w(rhs, rhs + num_els, rhs_v);
+
+  T expected[] = {5, 6, 6, 5};
+  wrapper<T> expected_w(expected, expected + num_els, rhs_v);
+
+  auto out = cudf::copy_if_else(
+    lhs_w, rhs_w, static_cast<cudf::bitmask_type const*>(condition.first->data()));
+  cudf::test::expect_columns_equal(out->view(), expected_w);
+}
+
 TYPED_TEST(CopyTestNumeric, CopyIfElseTestScalarScalar)
 {
   using T = TypeParam;
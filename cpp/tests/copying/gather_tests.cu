@@ -12,6 +12,10 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <algorithm>
+#include <numeric>
+#include <string>
+
 template <typename T>
 class GatherTest : public cudf::test::BaseFixture {
 };
@@ -371,6 +375,48 @@ TEST_F(GatherTestStr, GatherIgnoreOutOfBounds)
   cudf::test::expect_columns_equal(results->view().column(0), expected);
 }
 
+// Gathers skewed string lengths along with empty and null rows, both with short strings on
+// average, copied per string, and with long strings on average, copied per byte
+TEST_F(GatherTestStr, GatherSkewedLengths)
+{
+  const std::string long_string(5000, 'x');
+  const std::string medium_string(300, 'y');
+  std::vector<std::string> h_strings{"a", "", "bc", long_string, "", "def", medium_string, "g"};
+  std::vector<int32_t> h_valids{1, 1, 1, 1, 0, 1, 1, 0};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), h_valids.begin());
+  cudf::table_view source_table({strings});
+
+  auto gather_and_check = [&](std::vector<int32_t> const& h_map) {
+    cudf::test::fixed_width_column_wrapper<int32_t> gather_map(h_map.begin(), h_map.end());
+    auto results = cudf::detail::gather(source_table,
+                                        gather_map,
+                                        cudf::detail::out_of_bounds_policy::NULLIFY,
+                                        cudf::detail::negative_index_policy::NOT_ALLOWED);
+
+    std::vector<std::string> h_expected;
+    std::vector<int32_t> expected_validity;
+    for (auto index : h_map) {
+      const bool in_bounds = (0 <= index) && (index < static_cast<int32_t>(h_strings.size()));
+      const bool valid     = in_bounds && h_valids[index];
+      h_expected.push_back(valid ? h_strings[index] : "");
+      expected_validity.push_back(valid);
+    }
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(), h_expected.end(), expected_validity.begin());
+    cudf::test::expect_columns_equal(results->view().column(0), expected);
+  };
+
+  // Mostly short strings, with a few long ones and out-of-bounds rows
+  const std::vector<int32_t> short_rows{0, 1, 2, 4, 5, 7};
+  std::vector<int32_t> short_map;
+  for (int i = 0; i < 200; ++i) { short_map.push_back(short_rows[(i * 5) % short_rows.size()]); }
+  short_map.insert(short_map.end(), {3, 8, 6, -1});
+  gather_and_check(short_map);
+
+  // Mostly long strings, with short, empty, null and out-of-bounds rows in between
+  gather_and_check({3, 0, 1, 3, 4, 6, 2, 3, 7, 9, 5, 3, 1, 6});
+}
+
 TEST_F(GatherTestStr, GatherZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -379,3 +425,88 @@ TEST_F(GatherTestStr, GatherZeroSizeStringsColumn)
     cudf::table_view({zero_size_strings_column}), gather_map.begin(), gather_map.end(), true);
   cudf::test::expect_strings_empty(results->get_column(0).view());
 }
+
+class GatherTestWide : public cudf::test::BaseFixture {
+};
+
+// Gathers a sliced table of interleaved fixed-width and strings columns, so that the columns
+// gathered together in one pass are not adjacent in the table
+TEST_F(GatherTestWide, MixedColumnTypesWithOffsetAndNulls)
+{
+  constexpr cudf::size_type num_rows{100};
+  constexpr cudf::size_type num_columns{24};
+  auto const source_value = [](cudf::size_type row, cudf::size_type col) {
+    return row * num_columns + col;
+  };
+  auto const source_valid = [](cudf::size_type row) { return row % 3 != 0; };
+
+  // Columns `col % 3 == 1` are not nullable in the source table
+  auto const make_column = [&](cudf::size_type col,
+                               std::vector<cudf::size_type> const& rows,
+                               std::vector<bool> const& valids,
+                               bool nullable) -> std::unique_ptr<cudf::column> {
+    std::vector<int64_t> wide_values;
+    std::vector<int8_t> narrow_values;
+    std::vector<std::string> strings;
+    for (auto row : rows) {
+      wide_values.push_back(source_value(row, col));
+      narrow_values.push_back(static_cast<int8_t>(source_value(row, col)));
+      strings.push_back(std::to_string(source_value(row, col)));
+    }
+    switch (col % 3) {
+      case 0:
+        return cudf::test::fixed_width_column_wrapper<int64_t>(
+                 wide_values.begin(), wide_values.end(), valids.begin())
+          .release();
+      case 1:
+        return nullable ? cudf::test::fixed_width_column_wrapper<int8_t>(
+                            narrow_values.begin(), narrow_values.end(), valids.begin())
+                            .release()
+                        : cudf::test::fixed_width_column_wrapper<int8_t>(narrow_values.begin(),
+                                                                         narrow_values.end())
+                            .release();
+      default:
+        return cudf::test::strings_column_wrapper(strings.begin(), strings.end(), valids.begin())
+          .release();
+    }
+  };
+
+  std::vector<cudf::size_type> source_rows(num_rows);
+  std::iota(source_rows.begin(), source_rows.end(), 0);
+  std::vector<bool> source_valids(num_rows);
+  std::transform(source_rows.begin(), source_rows.end(), source_valids.begin(), source_valid);
+  std::vector<std::unique_ptr<cudf::column>> source_columns;
+  for (cudf::size_type col = 0; col < num_columns; ++col) {
+    source_columns.push_back(make_column(col, source_rows, source_valids, col % 3 != 1));
+  }
+  cudf::table source_table(std::move(source_columns));
+  auto const sliced = cudf::slice(source_table.view(), {1, num_rows}).front();
+
+  // Not a whole number of warps, with every tenth index out of bounds
+  std::vector<cudf::size_type> h_map(70);
+  for (size_t i = 0; i < h_map.size(); ++i) {
+    h_map[i] = (i % 10 == 0) ? 150 : (i * 7) % sliced.num_rows();
+  }
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> gather_map(h_map.begin(), h_map.end());
+
+  auto const result = cudf::detail::gather(sliced,
+                                           gather_map,
+                                           cudf::detail::out_of_bounds_policy::IGNORE,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED);
+
+  std::vector<cudf::size_type> expected_rows;
+  std::vector<bool> in_bounds;
+  std::vector<bool> expected_valids;
+  for (auto index : h_map) {
+    bool const valid_index = index < sliced.num_rows();
+    expected_rows.push_back(valid_index ? index + 1 : 0);
+    in_bounds.push_back(valid_index);
+    expected_valids.push_back(valid_index && source_valid(index + 1));
+  }
+  for (cudf::size_type col = 0; col < num_columns; ++col) {
+    // Only the out of bounds rows are null in columns without nulls in the source
+    auto const expected =
+      make_column(col, expected_rows, col % 3 == 1 ? in_bounds : expected_valids, true);
+    cudf::test::expect_columns_equal(expected->view(), result->view().column(col));
+  }
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ipc.hpp>
+#include <cudf/table/table.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+class IpcTableTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// Environment variable passing the hex encoded handle to the importing child process
+constexpr char const* handle_variable = "CUDF_TEST_IPC_HANDLE";
+
+std::unique_ptr<cudf::table> make_shared_table()
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  cudf::test::strings_column_wrapper col1({"a", "bc", "", "def", "ghij"}, {1, 1, 0, 1, 1});
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(col0.release());
+  columns.push_back(col1.release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+std::string to_hex(std::vector<uint8_t> const& bytes)
+{
+  std::string hex;
+  for (auto byte : bytes) {
+    char digits[3];
+    std::snprintf(digits, sizeof(digits), "%02x", byte);
+    hex += digits;
+  }
+  return hex;
+}
+
+std::vector<uint8_t> from_hex(std::string const& hex)
+{
+  std::vector<uint8_t> bytes;
+  for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+    bytes.push_back(static_cast<uint8_t>(std::stoi(hex.substr(i, 2), nullptr, 16)));
+  }
+  return bytes;
+}
+}  // namespace
+
+TEST_F(IpcTableTest, ExportKeepsPackedData)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4}, {1, 0, 1, 1});
+  cudf::test::strings_column_wrapper col1({"a", "bc", "", "def"});
+  cudf::table_view input({col0, col1});
+
+  auto const exported = cudf::export_ipc(input);
+  EXPECT_FALSE(exported.handle.empty());
+  ASSERT_NE(exported.gpu_data, nullptr);
+  EXPECT_GT(exported.gpu_data->size(), 0u);
+}
+
+TEST_F(IpcTableTest, EmptyTable)
+{
+  auto const exported = cudf::export_ipc(cudf::table_view{});
+  EXPECT_EQ(exported.gpu_data->size(), 0u);
+
+  auto const imported = cudf::import_ipc(exported.handle);
+  EXPECT_EQ(imported->view().num_columns(), 0);
+}
+
+TEST_F(IpcTableTest, ImportInExportingProcess)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+  cudf::table_view input({col});
+
+  auto const exported = cudf::export_ipc(input);
+  EXPECT_THROW(cudf::import_ipc(exported.handle), cudf::cuda_error);
+}
+
+TEST_F(IpcTableTest, InvalidHandle)
+{
+  EXPECT_THROW(cudf::import_ipc({}), cudf::logic_error);
+  EXPECT_THROW(cudf::import_ipc(std::vector<uint8_t>(128, 0)), cudf::logic_error);
+}
+
+TEST_F(IpcTableTest, ImportInChildProcess)
+{
+  auto const expected = make_shared_table();
+  auto const exported = cudf::export_ipc(expected->view());
+
+  // The child runs the test below in a new process image, so it gets its own CUDA context
+  std::string const variable = std::string{handle_variable} + "=" + to_hex(exported.handle);
+  std::vector<char*> child_env;
+  for (char** var = environ; *var != nullptr; ++var) { child_env.push_back(*var); }
+  child_env.push_back(const_cast<char*>(variable.c_str()));
+  child_env.push_back(nullptr);
+  char const* child_args[] = {"/proc/self/exe",
+                              "--gtest_also_run_disabled_tests",
+                              "--gtest_filter=IpcTableTest.DISABLED_ImportedInChildProcess",
+                              nullptr};
+
+  pid_t const child = fork();
+  ASSERT_GE(child, 0) << "Fork failed";
+  if (child == 0) {
+    execve(child_args[0], const_cast<char* const*>(child_args), child_env.data());
+    _exit(127);
+  }
+
+  // The exported memory stays alive until the child is done with it
+  int status = 0;
+  ASSERT_EQ(waitpid(child, &status, 0), child);
+  ASSERT_TRUE(WIFEXITED(status)) << "Child did not exit normally";
+  EXPECT_EQ(WEXITSTATUS(status), 0) << "The child process could not import the table";
+}
+
+// Only run by ImportInChildProcess, in the child process
+TEST_F(IpcTableTest, DISABLED_ImportedInChildProcess)
+{
+  auto const hex = std::getenv(handle_variable);
+  ASSERT_NE(hex, nullptr);
+
+  auto const imported = cudf::import_ipc(from_hex(hex));
+  auto const expected = make_shared_table();
+  cudf::test::expect_tables_equal(expected->view(), imported->view());
+
+  // Importing the handle again shares the mapping
+  auto const again = cudf::import_ipc(from_hex(hex));
+  cudf::test::expect_tables_equal(expected->view(), again->view());
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+using offsets_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+std::unique_ptr<cudf::column> make_lists(offsets_wrapper offsets,
+                                         std::unique_ptr<cudf::column> child,
+                                         std::vector<bool> const& validity = {})
+{
+  auto const num_rows = cudf::column_view(offsets).size() - 1;
+  if (validity.empty()) {
+    return cudf::make_lists_column(num_rows, offsets.release(), std::move(child), 0, {});
+  }
+  auto const null_count = std::count(validity.begin(), validity.end(), false);
+  return cudf::make_lists_column(
+    num_rows,
+    offsets.release(),
+    std::move(child),
+    null_count,
+    cudf::test::detail::make_null_mask(validity.begin(), validity.end()));
+}
+
+void expect_lists_equal(cudf::column_view const& lhs,
+                        cudf::column_view const& offsets,
+                        cudf::column_view const& child)
+{
+  cudf::lists_column_view const lists(lhs);
+  cudf::test::expect_columns_equal(lists.offsets(), offsets);
+  cudf::test::expect_columns_equal(lists.child(), child);
+}
+
+}  // namespace
+
+struct ListsCopyingTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ListsCopyingTest, Gather)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> elements{1, 2, 3, 4, 5, 6};
+  auto lists = make_lists({0, 2, 3, 3, 6}, elements.release(), {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> map{3, 0, 2, 3};
+
+  auto results = cudf::gather(cudf::table_view{{lists->view()}}, map);
+
+  auto const& gathered = results->get_column(0);
+  EXPECT_EQ(gathered.null_count(), 1);
+  expect_lists_equal(gathered,
+                     offsets_wrapper{0, 3, 5, 5, 8},
+                     cudf::test::fixed_width_column_wrapper<int32_t>{4, 5, 6, 1, 2, 4, 5, 6});
+}
+
+TEST_F(ListsCopyingTest, GatherNestedStrings)
+{
+  cudf::test::strings_column_wrapper strings{"a", "b", "c", "d"};
+  auto inner = make_lists({0, 1, 3, 3, 4}, strings.release());
+  auto outer = make_lists({0, 2, 4}, std::move(inner));
+  cudf::test::fixed_width_column_wrapper<int32_t> map{1, 0, 1};
+
+  auto results = cudf::gather(cudf::table_view{{outer->view()}}, map);
+
+  cudf::lists_column_view const gathered(results->get_column(0));
+  cudf::test::expect_columns_equal(gathered.offsets(), offsets_wrapper{0, 2, 4, 6});
+  expect_lists_equal(gathered.child(),
+                     offsets_wrapper{0, 0, 1, 2, 4, 4, 5},
+                     cudf::test::strings_column_wrapper{"d", "a", "b", "c", "d"});
+}
+
+TEST_F(ListsCopyingTest, Scatter)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source_elements{7, 8, 9};
+  auto source = make_lists({0, 1, 3}, source_elements.release());
+  cudf::test::fixed_width_column_wrapper<int32_t> target_elements{1, 2, 3, 4};
+  auto target = make_lists({0, 2, 2, 4}, target_elements.release());
+  cudf::test::fixed_width_column_wrapper<int32_t> map{2, 0};
+
+  auto results = cudf::scatter(
+    cudf::table_view{{source->view()}}, map, cudf::table_view{{target->view()}});
+
+  expect_lists_equal(results->get_column(0),
+                     offsets_wrapper{0, 2, 2, 3},
+                     cudf::test::fixed_width_column_wrapper<int32_t>{8, 9, 7});
+}
+
+TEST_F(ListsCopyingTest, Concatenate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> elements1{1, 2, 3, 4};
+  auto lists1 = make_lists({0, 2, 4}, elements1.release(), {1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> elements2{5, 6, 7};
+  auto lists2  = make_lists({0, 0, 1, 3}, elements2.release());
+  auto sliced1 = cudf::slice(lists1->view(), {1, 2}).front();
+
+  auto results = cudf::concatenate({sliced1, lists2->view()});
+
+  EXPECT_EQ(results->size(), 4);
+  EXPECT_EQ(results->null_count(), 1);
+  expect_lists_equal(*results,
+                     offsets_wrapper{0, 2, 2, 3, 5},
+                     cudf::test::fixed_width_column_wrapper<int32_t>{3, 4, 5, 6, 7});
+}
+
+TEST_F(ListsCopyingTest, ContiguousSplit)
+{
+  cudf::test::strings_column_wrapper strings{"a", "b", "c", "d", "e"};
+  auto lists = make_lists({0, 1, 3, 3, 5}, strings.release(), {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> ids{1, 2, 3, 4};
+
+  auto results = cudf::contiguous_split(cudf::table_view{{lists->view(), ids}}, {1});
+
+  ASSERT_EQ(results.size(), 2u);
+  expect_lists_equal(results[0].table.column(0),
+                     offsets_wrapper{0, 1},
+                     cudf::test::strings_column_wrapper{"a"});
+  expect_lists_equal(results[1].table.column(0),
+                     offsets_wrapper{0, 2, 2, 4},
+                     cudf::test::strings_column_wrapper{"b", "c", "d", "e"});
+  EXPECT_EQ(results[1].table.column(0).null_count(), 1);
+  cudf::test::expect_columns_equal(results[1].table.column(1),
+                                   cudf::test::fixed_width_column_wrapper<int32_t>{2, 3, 4});
+}
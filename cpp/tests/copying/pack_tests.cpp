@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/copying.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <vector>
+
+class PackUnpackTest : public cudf::test::BaseFixture {
+};
+
+template <typename T>
+struct PackUnpackTypedTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(PackUnpackTypedTest, cudf::test::FixedWidthTypes);
+
+/**
+ * @brief Expects the device memory of every column of `unpacked` to point into `packed`.
+ */
+void expect_views_into(cudf::column_view const& unpacked, rmm::device_buffer const& packed)
+{
+  auto const begin = static_cast<uint8_t const*>(packed.data());
+  auto const end   = begin + packed.size();
+  auto const head  = static_cast<uint8_t const*>(unpacked.head());
+  auto const mask  = reinterpret_cast<uint8_t const*>(unpacked.null_mask());
+  if (head != nullptr) { EXPECT_TRUE(head >= begin and head < end); }
+  if (mask != nullptr) { EXPECT_TRUE(mask >= begin and mask < end); }
+  for (cudf::size_type i = 0; i < unpacked.num_children(); ++i) {
+    expect_views_into(unpacked.child(i), packed);
+  }
+}
+
+void run_pack_unpack_test(cudf::table_view const& input)
+{
+  auto const packed   = cudf::pack(input);
+  auto const unpacked = cudf::unpack(packed);
+  cudf::test::expect_tables_equal(input, unpacked);
+  for (auto const& col : unpacked) { expect_views_into(col, *packed.gpu_data); }
+
+  // Metadata copied elsewhere, e.g. after being sent along with the device buffer
+  std::vector<uint8_t> const metadata(packed.metadata_->data(),
+                                      packed.metadata_->data() + packed.metadata_->size());
+  auto const received =
+    cudf::unpack(metadata.data(), static_cast<uint8_t const*>(packed.gpu_data->data()));
+  cudf::test::expect_tables_equal(input, received);
+}
+
+TYPED_TEST(PackUnpackTypedTest, FixedWidth)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  cudf::test::fixed_width_column_wrapper<TypeParam> col2({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                                         {1, 0, 1, 1, 0, 1, 1, 1, 0, 1});
+  run_pack_unpack_test(cudf::table_view({col1, col2}));
+}
+
+TEST_F(PackUnpackTest, MixedColumnTypes)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> integers({10, 20, 30, 40, 50});
+  cudf::test::strings_column_wrapper strings({"this", "", "is", "a", "test"},
+                                             {1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.5, 2.5, 3.5, 4.5, 5.5},
+                                                         {1, 0, 1, 0, 1});
+  run_pack_unpack_test(cudf::table_view({integers, strings, doubles}));
+}
+
+TEST_F(PackUnpackTest, SlicedInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4, 5, 6, 7, 8},
+                                                           {1, 1, 0, 1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  auto const sliced = cudf::slice(cudf::table_view({integers, strings}), {3, 7});
+  run_pack_unpack_test(sliced.front());
+}
+
+TEST_F(PackUnpackTest, EmptyTables)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> integers({});
+  cudf::test::strings_column_wrapper strings({});
+  run_pack_unpack_test(cudf::table_view({integers, strings}));
+
+  auto const packed = cudf::pack(cudf::table_view{});
+  EXPECT_EQ(0, cudf::unpack(packed).num_columns());
+}
+
+TEST_F(PackUnpackTest, InvalidMetadata)
+{
+  std::vector<uint8_t> const metadata(16, 0);
+  EXPECT_THROW(cudf::unpack(metadata.data(), nullptr), cudf::logic_error);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/spill.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <new>
+
+class SpillManagerTest : public cudf::test::BaseFixture {
+ protected:
+  cudf::test::fixed_width_column_wrapper<int32_t> integers{{1, 2, 3, 4, 5, 6},
+                                                           {1, 0, 1, 1, 0, 1}};
+  cudf::test::strings_column_wrapper strings{"this", "is", "a", "table", "to", "spill"};
+  cudf::table_view input{{integers, strings}};
+};
+
+/**
+ * @brief Device memory resource that fails allocations beyond a fixed capacity
+ */
+class limited_memory_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit limited_memory_resource(size_t capacity) : capacity(capacity) {}
+
+  bool supports_streams() const noexcept override { return upstream->supports_streams(); }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(size_t bytes, cudaStream_t stream) override
+  {
+    if (allocated + bytes > capacity) { throw std::bad_alloc{}; }
+    allocated += bytes;
+    return upstream->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* p, size_t bytes, cudaStream_t stream) override
+  {
+    allocated -= bytes;
+    upstream->deallocate(p, bytes, stream);
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(cudaStream_t) const override { return {0, 0}; }
+
+  rmm::mr::device_memory_resource* upstream = rmm::mr::get_default_resource();
+  size_t capacity;
+  size_t allocated = 0;
+};
+
+TEST_F(SpillManagerTest, AcquireAndRelease)
+{
+  cudf::spill_manager manager;
+  auto const handle = manager.add(input);
+  EXPECT_FALSE(manager.is_spilled(handle));
+  EXPECT_GT(manager.device_bytes(), 0u);
+  EXPECT_EQ(0u, manager.host_bytes());
+
+  cudf::test::expect_tables_equal(input, manager.acquire(handle));
+  manager.release(handle);
+  EXPECT_THROW(manager.release(handle), cudf::logic_error);
+  EXPECT_THROW(manager.acquire(handle + 1), cudf::logic_error);
+}
+
+TEST_F(SpillManagerTest, SpillAndUnspill)
+{
+  cudf::spill_manager manager;
+  auto const handle = manager.add(input);
+  auto const size   = manager.device_bytes();
+
+  manager.spill(handle);
+  EXPECT_TRUE(manager.is_spilled(handle));
+  EXPECT_EQ(0u, manager.device_bytes());
+  EXPECT_EQ(size, manager.host_bytes());
+
+  // Spilling twice does nothing
+  manager.spill(handle);
+  EXPECT_EQ(size, manager.host_bytes());
+
+  cudf::test::expect_tables_equal(input, manager.acquire(handle));
+  EXPECT_FALSE(manager.is_spilled(handle));
+  EXPECT_EQ(size, manager.device_bytes());
+  EXPECT_EQ(0u, manager.host_bytes());
+  manager.release(handle);
+}
+
+TEST_F(SpillManagerTest, AcquiredTablesAreNotSpilled)
+{
+  cudf::spill_manager manager;
+  auto const handle = manager.add(input);
+  auto const view   = manager.acquire(handle);
+
+  EXPECT_THROW(manager.spill(handle), cudf::logic_error);
+  EXPECT_THROW(manager.remove(handle), cudf::logic_error);
+  EXPECT_EQ(0u, manager.spill_least_recently_used(1));
+  cudf::test::expect_tables_equal(input, view);
+
+  manager.release(handle);
+  EXPECT_EQ(manager.device_bytes(), manager.spill_least_recently_used(1));
+  EXPECT_TRUE(manager.is_spilled(handle));
+}
+
+TEST_F(SpillManagerTest, LeastRecentlyUsedFirst)
+{
+  cudf::spill_manager manager;
+  auto const first  = manager.add(input);
+  auto const second = manager.add(input);
+  auto const third  = manager.add(input);
+  manager.acquire(first);
+  manager.release(first);
+
+  manager.spill_least_recently_used(1);
+  EXPECT_FALSE(manager.is_spilled(first));
+  EXPECT_TRUE(manager.is_spilled(second));
+  EXPECT_FALSE(manager.is_spilled(third));
+
+  manager.spill_least_recently_used(manager.device_bytes());
+  EXPECT_TRUE(manager.is_spilled(first));
+  EXPECT_TRUE(manager.is_spilled(third));
+}
+
+TEST_F(SpillManagerTest, Remove)
+{
+  cudf::spill_manager manager;
+  auto const handle = manager.add(input);
+  manager.spill(handle);
+
+  auto const packed = manager.remove(handle);
+  cudf::test::expect_tables_equal(input, cudf::unpack(packed));
+  EXPECT_EQ(0u, manager.device_bytes());
+  EXPECT_EQ(0u, manager.host_bytes());
+  EXPECT_THROW(manager.is_spilled(handle), cudf::logic_error);
+}
+
+TEST_F(SpillManagerTest, SpillOnAllocationFailure)
+{
+  limited_memory_resource limited(4096);
+  cudf::spill_manager manager(&limited);
+  auto const first  = manager.add(input);
+  auto const second = manager.add(input);
+  auto const used   = manager.device_bytes();
+
+  // Does not fit next to both tables, so the least recently used one is spilled
+  rmm::device_buffer buffer(4096 - used + 1, 0, manager.spilling_resource());
+  EXPECT_TRUE(manager.is_spilled(first));
+  EXPECT_FALSE(manager.is_spilled(second));
+
+  // Does not fit at all
+  EXPECT_THROW(rmm::device_buffer(8192, 0, manager.spilling_resource()), std::bad_alloc);
+  EXPECT_TRUE(manager.is_spilled(second));
+}
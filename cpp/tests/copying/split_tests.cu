@@ -678,3 +678,40 @@ TEST_F(ContiguousSplitTableCornerCases, MixedColumnTypes)
     cudf::test::expect_tables_equivalent(expected[index], result[index].table);
   }
 }
+
+TEST_F(ContiguousSplitTableCornerCases, ManySplitsMixedColumnTypes)
+{
+  cudf::size_type const num_rows = 100000;
+  auto valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 3; });
+
+  auto ints = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int64_t> c0(ints, ints + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<int8_t> c1(ints, ints + num_rows);
+
+  std::vector<std::string> strings(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) { strings[i] = std::to_string(i % 1000); }
+  cudf::test::strings_column_wrapper c2(strings.begin(), strings.end(), valids);
+  cudf::test::strings_column_wrapper c3(strings.begin(), strings.end());
+
+  auto tbl = cudf::table_view({c0, c1, c2, c3});
+
+  // Irregular split points so that most splits start in the middle of a mask word
+  std::vector<cudf::size_type> many_splits;
+  for (cudf::size_type split = 0; split < num_rows; split += 97 + many_splits.size() % 13) {
+    many_splits.push_back(split);
+  }
+  many_splits.push_back(num_rows);
+  // Splits large enough that their buffers are copied in several chunks
+  std::vector<cudf::size_type> large_splits{num_rows / 3 + 5};
+
+  for (auto const& splits : {many_splits, large_splits}) {
+    auto result   = cudf::contiguous_split(tbl, splits);
+    auto expected = cudf::split(tbl, splits);
+
+    EXPECT_EQ(expected.size(), result.size());
+    for (unsigned long index = 0; index < expected.size(); index++) {
+      cudf::test::expect_tables_equal(expected[index], result[index].table);
+    }
+  }
+}
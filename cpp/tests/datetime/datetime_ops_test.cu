@@ -23,9 +23,12 @@
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/timestamp_utilities.cuh>
 #include <tests/utilities/type_lists.hpp>
 
+#include <fstream>
+
 template <typename T>
 struct NonTimestampTest : public cudf::test::BaseFixture {
   cudf::data_type type() { return cudf::data_type{cudf::type_to_id<T>()}; }
@@ -54,6 +57,9 @@ TYPED_TEST(NonTimestampTest, TestThrowsOnNonTimestamp)
   EXPECT_THROW(extract_second(col), cudf::logic_error);
   EXPECT_THROW(last_day_of_month(col), cudf::logic_error);
   EXPECT_THROW(day_of_year(col), cudf::logic_error);
+  EXPECT_THROW(extract_datetime_components(col, {datetime_component::YEAR}), cudf::logic_error);
+  EXPECT_THROW(truncate_timestamps(col, datetime_component::DAY), cudf::logic_error);
+  EXPECT_THROW(convert_timezone(col, "UTC", "UTC"), cudf::logic_error);
 }
 
 struct BasicDatetimeOpsTest : public cudf::test::BaseFixture {
@@ -248,6 +254,126 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponen
   expect_columns_equal(*extract_second(timestamps), expected_seconds);
 }
 
+TYPED_TEST(TypedDatetimeOpsTest, TestExtractingMultipleDatetimeComponents)
+{
+  using T = TypeParam;
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace simt::std::chrono;
+
+  auto start = milliseconds(-2500000000000);  // Sat, 11 Oct 1890 19:33:20 GMT
+  auto stop_ = milliseconds(2500000000000);   // Mon, 22 Mar 2049 04:26:40 GMT
+  auto timestamps =
+    generate_timestamps<T, true>(this->size(), time_point_ms(start), time_point_ms(stop_));
+
+  auto const components = extract_datetime_components(timestamps,
+                                                       {datetime_component::SECOND,
+                                                        datetime_component::YEAR,
+                                                        datetime_component::WEEKDAY,
+                                                        datetime_component::MONTH,
+                                                        datetime_component::HOUR,
+                                                        datetime_component::DAY,
+                                                        datetime_component::MINUTE});
+  ASSERT_EQ(components->num_columns(), 7);
+  expect_columns_equal(components->get_column(0), *extract_second(timestamps));
+  expect_columns_equal(components->get_column(1), *extract_year(timestamps));
+  expect_columns_equal(components->get_column(2), *extract_weekday(timestamps));
+  expect_columns_equal(components->get_column(3), *extract_month(timestamps));
+  expect_columns_equal(components->get_column(4), *extract_hour(timestamps));
+  expect_columns_equal(components->get_column(5), *extract_day(timestamps));
+  expect_columns_equal(components->get_column(6), *extract_minute(timestamps));
+
+  EXPECT_EQ(extract_datetime_components(timestamps, {})->num_columns(), 0);
+  EXPECT_THROW(extract_datetime_components(timestamps, {datetime_component::INVALID}),
+               cudf::logic_error);
+
+  cudf::column empty{this->type(), 0, rmm::device_buffer{0}};
+  auto const empty_components =
+    extract_datetime_components(empty, {datetime_component::YEAR, datetime_component::SECOND});
+  ASSERT_EQ(empty_components->num_columns(), 2);
+  EXPECT_EQ(empty_components->get_column(0).size(), 0);
+  EXPECT_EQ(empty_components->get_column(0).type().id(), cudf::type_id::INT16);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestTruncateTimestamps)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace simt::std::chrono;
+
+  auto timestamps_s = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {
+      -131968728,  // 1965-10-26 14:01:12 GMT
+      1530705600,  // 2018-07-04 12:00:00 GMT
+      1674631932,  // 2023-01-25 07:32:12 GMT
+      0,           // Random nullable field
+    },
+    {true, true, true, false}};
+  auto const validity = std::vector<bool>{true, true, true, false};
+
+  expect_columns_equal(*truncate_timestamps(timestamps_s, datetime_component::YEAR),
+                       fixed_width_column_wrapper<cudf::timestamp_s>{
+                         {-157766400, 1514764800, 1672531200, 0}, validity.begin()},
+                       true);
+  expect_columns_equal(*truncate_timestamps(timestamps_s, datetime_component::MONTH),
+                       fixed_width_column_wrapper<cudf::timestamp_s>{
+                         {-134179200, 1530403200, 1672531200, 0}, validity.begin()},
+                       true);
+  expect_columns_equal(*truncate_timestamps(timestamps_s, datetime_component::DAY),
+                       fixed_width_column_wrapper<cudf::timestamp_s>{
+                         {-132019200, 1530662400, 1674604800, 0}, validity.begin()},
+                       true);
+  expect_columns_equal(*truncate_timestamps(timestamps_s, datetime_component::HOUR),
+                       fixed_width_column_wrapper<cudf::timestamp_s>{
+                         {-131968800, 1530705600, 1674630000, 0}, validity.begin()},
+                       true);
+  expect_columns_equal(*truncate_timestamps(timestamps_s, datetime_component::MINUTE),
+                       fixed_width_column_wrapper<cudf::timestamp_s>{
+                         {-131968740, 1530705600, 1674631920, 0}, validity.begin()},
+                       true);
+  expect_columns_equal(*truncate_timestamps(timestamps_s, datetime_component::SECOND),
+                       timestamps_s);
+
+  // Truncating to a finer unit keeps the dates
+  auto timestamps_D = fixed_width_column_wrapper<cudf::timestamp_D>{-1528, 17716, 19382};
+  expect_columns_equal(*truncate_timestamps(timestamps_D, datetime_component::HOUR),
+                       timestamps_D);
+  expect_columns_equal(*truncate_timestamps(timestamps_D, datetime_component::MONTH),
+                       fixed_width_column_wrapper<cudf::timestamp_D>{-1553, 17713, 19358});
+
+  EXPECT_THROW(truncate_timestamps(timestamps_s, datetime_component::WEEKDAY), cudf::logic_error);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_ms = fixed_width_column_wrapper<cudf::timestamp_ms>{
+    {
+      1530705600000,  // 2018-07-04 12:00:00.000 GMT
+      1674631932929,  // 2023-01-25 07:32:12.929 GMT
+      0,              // Random nullable field
+    },
+    {true, true, false}};
+
+  expect_columns_equal(*convert_timezone(timestamps_ms, "UTC", ""), timestamps_ms);
+  EXPECT_THROW(convert_timezone(timestamps_ms, "Not/A_Timezone", "UTC"), cudf::logic_error);
+
+  if (!std::ifstream("/usr/share/zoneinfo/America/Los_Angeles")) { return; }
+  auto const expected_ms = fixed_width_column_wrapper<cudf::timestamp_ms>{
+    {
+      1530680400000,  // 2018-07-04 05:00:00.000 PDT
+      1674603132929,  // 2023-01-24 23:32:12.929 PST
+      0,
+    },
+    {true, true, false}};
+  auto const local = convert_timezone(timestamps_ms, "UTC", "America/Los_Angeles");
+  expect_columns_equal(*local, expected_ms, true);
+  expect_columns_equal(
+    *convert_timezone(*local, "America/Los_Angeles", "UTC"), timestamps_ms, true);
+}
+
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
 {
   using namespace cudf::test;
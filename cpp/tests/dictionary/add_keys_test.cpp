@@ -43,8 +43,8 @@ TEST_F(DictionaryAddKeysTest, StringsColumn)
   cudf::test::strings_column_wrapper keys_expected(h_keys.begin(), h_keys.end());
   cudf::test::expect_columns_equal(view.keys(), keys_expected);
 
-  std::vector<int32_t> h_expected{5, 0, 3, 1, 2, 2, 2, 5, 0};
-  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected(h_expected.begin(),
+  std::vector<uint8_t> h_expected{5, 0, 3, 1, 2, 2, 2, 5, 0};
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected(h_expected.begin(),
                                                                    h_expected.end());
   cudf::test::expect_columns_equal(view.indices(), indices_expected);
 }
@@ -62,7 +62,7 @@ TEST_F(DictionaryAddKeysTest, FloatColumn)
   cudf::test::fixed_width_column_wrapper<float> keys_expected{-11.75, 0.5, 4.25, 5.0, 7.125};
   cudf::test::expect_columns_equal(view.keys(), keys_expected);
 
-  cudf::test::fixed_width_column_wrapper<int32_t> expected{2, 4, 1, 0, 4, 1};
+  cudf::test::fixed_width_column_wrapper<uint8_t> expected{2, 4, 1, 0, 4, 1};
   cudf::test::expect_columns_equal(view.indices(), expected);
 }
 
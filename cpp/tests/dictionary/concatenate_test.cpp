@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+struct DictionaryConcatenateTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DictionaryConcatenateTest, StringsColumn)
+{
+  cudf::test::strings_column_wrapper strings1({"ddd", "aaa", "ccc", "ccc"});
+  cudf::test::strings_column_wrapper strings2({"bbb", "ccc", "bbb"});
+  auto dictionary1 = cudf::dictionary::encode(strings1);
+  auto dictionary2 = cudf::dictionary::encode(strings2);
+
+  auto result = cudf::concatenate(
+    std::vector<cudf::column_view>{dictionary1->view(), dictionary2->view()});
+  cudf::dictionary_column_view view(result->view());
+
+  cudf::test::strings_column_wrapper keys_expected({"aaa", "bbb", "ccc", "ddd"});
+  cudf::test::expect_columns_equal(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected{3, 0, 2, 2, 1, 2, 1};
+  cudf::test::expect_columns_equal(view.indices(), indices_expected);
+}
+
+TEST_F(DictionaryConcatenateTest, WithNullsAndOffsets)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> input1{{555, 0, 333, 111, 222, 555},
+                                                         {1, 1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int64_t> input2{{444, 0, 777, 0}, {1, 0, 1, 1}};
+  auto dictionary1 = cudf::dictionary::encode(input1);
+  auto dictionary2 = cudf::dictionary::encode(input2);
+
+  auto sliced1 = cudf::slice(dictionary1->view(), {1, 5}).front();
+  auto sliced2 = cudf::slice(dictionary2->view(), {1, 4}).front();
+  auto result  = cudf::concatenate(std::vector<cudf::column_view>{sliced1, sliced2});
+  EXPECT_EQ(result->null_count(), 2);
+
+  auto decoded = cudf::dictionary::decode(result->view());
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{{0, 333, 111, 222, 0, 777, 0},
+                                                           {1, 1, 0, 1, 0, 1, 1}};
+  cudf::test::expect_columns_equal(decoded->view(), expected);
+}
+
+TEST_F(DictionaryConcatenateTest, KeysTypeMismatch)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input1{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> input2{1, 2, 3};
+  auto dictionary1 = cudf::dictionary::encode(input1);
+  auto dictionary2 = cudf::dictionary::encode(input2);
+
+  EXPECT_THROW(cudf::concatenate(
+                 std::vector<cudf::column_view>{dictionary1->view(), dictionary2->view()}),
+               cudf::logic_error);
+}
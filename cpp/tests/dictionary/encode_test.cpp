@@ -20,6 +20,9 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
 #include <vector>
 
 struct DictionaryEncodeTest : public cudf::test::BaseFixture {
@@ -37,8 +40,8 @@ TEST_F(DictionaryEncodeTest, EncodeStringColumn)
   cudf::test::strings_column_wrapper keys_expected(h_keys.begin(), h_keys.end());
   cudf::test::expect_columns_equal(view.keys(), keys_expected);
 
-  std::vector<int32_t> h_expected{4, 0, 3, 1, 2, 2, 2, 4, 0};
-  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected(h_expected.begin(),
+  std::vector<uint8_t> h_expected{4, 0, 3, 1, 2, 2, 2, 4, 0};
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected(h_expected.begin(),
                                                                    h_expected.end());
   cudf::test::expect_columns_equal(view.indices(), indices_expected);
 }
@@ -53,7 +56,7 @@ TEST_F(DictionaryEncodeTest, EncodeFloat)
   cudf::test::fixed_width_column_wrapper<float> keys_expected{-11.75, 0.5, 4.25, 7.125};
   cudf::test::expect_columns_equal(view.keys(), keys_expected);
 
-  cudf::test::fixed_width_column_wrapper<int32_t> expected{2, 3, 1, 0, 3, 1};
+  cudf::test::fixed_width_column_wrapper<uint8_t> expected{2, 3, 1, 0, 3, 1};
   cudf::test::expect_columns_equal(view.indices(), expected);
 }
 
@@ -68,8 +71,46 @@ TEST_F(DictionaryEncodeTest, EncodeWithNull)
   cudf::test::fixed_width_column_wrapper<int64_t> keys_expected{0, 111, 222, 333, 444};
   cudf::test::expect_columns_equal(view.keys(), keys_expected);
 
-  cudf::test::fixed_width_column_wrapper<int32_t> expected{4, 0, 3, 1, 2, 5, 2, 4, 0};
+  cudf::test::fixed_width_column_wrapper<uint8_t> expected{4, 0, 3, 1, 2, 5, 2, 4, 0};
+  cudf::test::expect_columns_equal(view.indices(), expected);
+}
+
+TEST_F(DictionaryEncodeTest, EncodeStringsWithNull)
+{
+  cudf::test::strings_column_wrapper strings{{"ddd", "", "bbb", "ddd", "zzz", "bbb", ""},
+                                             {1, 1, 1, 0, 1, 1, 0}};
+
+  auto dictionary = cudf::dictionary::encode(strings);
+  cudf::dictionary_column_view view(dictionary->view());
+
+  cudf::test::strings_column_wrapper keys_expected{"", "bbb", "ddd", "zzz"};
+  cudf::test::expect_columns_equal(view.keys(), keys_expected);
+
+  cudf::test::fixed_width_column_wrapper<uint8_t> expected{2, 0, 1, 4, 3, 1, 4};
   cudf::test::expect_columns_equal(view.indices(), expected);
+  EXPECT_EQ(view.null_count(), 2);
+}
+
+TEST_F(DictionaryEncodeTest, NullIndexFitsIndicesType)
+{
+  // 256 keys fit UINT8 indices, but the null rows are indexed by the 257th value
+  auto begin = thrust::make_counting_iterator<int32_t>(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> full(begin, begin + 256);
+  auto full_dictionary = cudf::dictionary::encode(full);
+  EXPECT_EQ(cudf::dictionary_column_view(full_dictionary->view()).indices().type().id(),
+            cudf::type_id::UINT8);
+
+  auto valids = thrust::make_transform_iterator(begin, [](auto row) { return row < 256; });
+  cudf::test::fixed_width_column_wrapper<int32_t> input(begin, begin + 257, valids);
+  auto dictionary = cudf::dictionary::encode(input);
+  cudf::dictionary_column_view view(dictionary->view());
+  EXPECT_EQ(view.keys_size(), 256);
+  cudf::test::fixed_width_column_wrapper<uint16_t> expected(begin, begin + 257);
+  cudf::test::expect_columns_equal(view.indices(), expected);
+  cudf::test::expect_columns_equal(cudf::dictionary::decode(view)->view(), input);
+
+  EXPECT_THROW(cudf::dictionary::encode(input, cudf::data_type{cudf::type_id::UINT8}),
+               cudf::logic_error);
 }
 
 TEST_F(DictionaryEncodeTest, InvalidEncode)
@@ -79,3 +120,26 @@ TEST_F(DictionaryEncodeTest, InvalidEncode)
   EXPECT_THROW(cudf::dictionary::encode(input, cudf::data_type{cudf::type_id::INT16}),
                cudf::logic_error);
 }
+
+TEST_F(DictionaryEncodeTest, IndicesType)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{429, 111, 213, 111, 213, 429, 213};
+
+  auto dictionary = cudf::dictionary::encode(input, cudf::data_type{cudf::type_id::INT32});
+  cudf::dictionary_column_view view(dictionary->view());
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{2, 0, 1, 0, 1, 2, 1};
+  cudf::test::expect_columns_equal(view.indices(), expected);
+
+  // more than 256 keys need 16-bit indices
+  auto begin = thrust::make_counting_iterator<int32_t>(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> wide_input(begin, begin + 300);
+  auto wide_dictionary = cudf::dictionary::encode(wide_input);
+  cudf::dictionary_column_view wide_view(wide_dictionary->view());
+  EXPECT_EQ(wide_view.indices().type().id(), cudf::type_id::UINT16);
+  cudf::test::fixed_width_column_wrapper<uint16_t> wide_expected(begin, begin + 300);
+  cudf::test::expect_columns_equal(wide_view.indices(), wide_expected);
+  cudf::test::expect_columns_equal(cudf::dictionary::decode(wide_view)->view(), wide_input);
+
+  EXPECT_THROW(cudf::dictionary::encode(wide_input, cudf::data_type{cudf::type_id::UINT8}),
+               cudf::logic_error);
+}
@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include <cudf/binaryop.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/dictionary/search.hpp>
+#include <cudf/search.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
@@ -78,3 +80,33 @@ TEST_F(DictionarySearchTest, Errors)
   EXPECT_THROW(cudf::dictionary::get_index(cudf::dictionary_column_view(dictionary->view()), key),
                cudf::logic_error);
 }
+
+TEST_F(DictionarySearchTest, ContainsScalar)
+{
+  cudf::test::strings_column_wrapper strings({"fff", "aaa", "", "bbb", "aaa"}, {1, 1, 0, 1, 1});
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  EXPECT_TRUE(cudf::contains(dictionary->view(), cudf::string_scalar("bbb")));
+  EXPECT_FALSE(cudf::contains(dictionary->view(), cudf::string_scalar("ccc")));
+  EXPECT_TRUE(cudf::contains(dictionary->view(), cudf::string_scalar("", false)));
+}
+
+TEST_F(DictionarySearchTest, EqualToScalar)
+{
+  cudf::test::strings_column_wrapper strings({"fff", "aaa", "", "bbb", "aaa"}, {1, 1, 0, 1, 1});
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  auto result = cudf::binary_operation(dictionary->view(),
+                                       cudf::string_scalar("aaa"),
+                                       cudf::binary_operator::EQUAL,
+                                       cudf::data_type{cudf::type_id::BOOL8});
+  cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 0, 0, 1}, {1, 1, 0, 1, 1});
+  cudf::test::expect_columns_equal(*result, expected);
+
+  result = cudf::binary_operation(cudf::string_scalar("ccc"),
+                                  dictionary->view(),
+                                  cudf::binary_operator::NOT_EQUAL,
+                                  cudf::data_type{cudf::type_id::BOOL8});
+  cudf::test::fixed_width_column_wrapper<bool> expected_all({1, 1, 0, 1, 1}, {1, 1, 0, 1, 1});
+  cudf::test::expect_columns_equal(*result, expected_all);
+}
@@ -368,4 +368,82 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
 
+TYPED_TEST(DLPackNumericTests, ToDlpackView1D)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4});
+  cudf::table_view input({col});
+  unique_managed_tensor result(cudf::to_dlpack_view(input));
+
+  // The tensor aliases the column
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(input.column(0).head(), tensor.data);
+}
+
+TYPED_TEST(DLPackNumericTests, ContiguousSplitToDlpack)
+{
+  using T         = TypeParam;
+  auto const col1 = cudf::test::make_type_param_vector<T>({1, 2, 3, 4, 5});
+  auto const col2 = cudf::test::make_type_param_vector<T>({4, 5, 6, 7, 8});
+  fixed_width_column_wrapper<T> c1(col1.cbegin(), col1.cend());
+  fixed_width_column_wrapper<T> c2(col2.cbegin(), col2.cend());
+  cudf::table_view input({c1, c2});
+
+  auto splits = cudf::contiguous_split(input, {});
+  ASSERT_EQ(1u, splits.size());
+  auto const data = splits[0].table.column(0).head();
+
+  // The view and the owning tensor both alias the columns of the split
+  unique_managed_tensor view(cudf::to_dlpack_view(splits[0].table));
+  EXPECT_EQ(data, view->dl_tensor.data);
+  EXPECT_EQ(2, view->dl_tensor.ndim);
+  EXPECT_EQ(1, view->dl_tensor.strides[0]);
+  EXPECT_LE(view->dl_tensor.shape[0], view->dl_tensor.strides[1]);
+  view.reset();
+
+  unique_managed_tensor result(cudf::to_dlpack(std::move(splits[0])));
+  EXPECT_EQ(data, result->dl_tensor.data);
+  auto const tensor_view = cudf::from_dlpack_view(result.get());
+  EXPECT_EQ(data, tensor_view.column(0).head());
+  expect_tables_equal(input, tensor_view);
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackViewNotEvenlySpaced)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<TypeParam> col2({4, 5, 6, 7});
+  // The third column starts where the first does
+  cudf::table_view input({col1, col2, col1});
+  EXPECT_THROW(cudf::to_dlpack_view(input), cudf::logic_error);
+}
+
+TYPED_TEST(DLPackNumericTests, FromDlpackView2D)
+{
+  using T         = TypeParam;
+  auto const col1 = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const col2 = cudf::test::make_type_param_vector<T>({4, 5, 6, 7});
+  fixed_width_column_wrapper<T> c1(col1.cbegin(), col1.cend());
+  fixed_width_column_wrapper<T> c2(col2.cbegin(), col2.cend());
+  cudf::table_view input({c1, c2});
+  unique_managed_tensor tensor(cudf::to_dlpack(input));
+
+  auto const result = cudf::from_dlpack_view(tensor.get());
+  expect_tables_equal(input, result);
+  EXPECT_EQ(tensor->dl_tensor.data, result.column(0).head());
+}
+
+TEST_F(DLPackUntypedTests, CpuTensorFromDlpackView)
+{
+  std::vector<int32_t> data{1, 2, 3};
+  int64_t shape[] = {3};
+  DLManagedTensor tensor{};
+  tensor.dl_tensor.ctx.device_type = kDLCPU;
+  tensor.dl_tensor.dtype           = get_dtype<int32_t>();
+  tensor.dl_tensor.ndim            = 1;
+  tensor.dl_tensor.shape           = shape;
+  tensor.dl_tensor.data            = data.data();
+  EXPECT_THROW(cudf::from_dlpack_view(&tensor), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+
+using cudf::data_type;
+using cudf::type_id;
+
+struct FixedPointColumnTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// Views the integer representations of a wrapper as a fixed-point column of `type`
+cudf::column_view as_fixed_point(cudf::column_view const& col, data_type type)
+{
+  return cudf::column_view{
+    type, col.size(), col.head(), col.null_mask(), col.null_count(), col.offset()};
+}
+}  // namespace
+
+TEST_F(FixedPointColumnTest, DataType)
+{
+  data_type const decimal32{type_id::DECIMAL32, -2};
+  EXPECT_TRUE(cudf::is_fixed_point(decimal32));
+  EXPECT_FALSE(cudf::is_fixed_point(data_type{type_id::INT32}));
+  EXPECT_EQ(decimal32.scale(), -2);
+  EXPECT_EQ(cudf::size_of(decimal32), sizeof(int32_t));
+  EXPECT_EQ(cudf::size_of(data_type{type_id::DECIMAL64, 3}), sizeof(int64_t));
+  EXPECT_TRUE(decimal32 == (data_type{type_id::DECIMAL32, -2}));
+  EXPECT_FALSE(decimal32 == (data_type{type_id::DECIMAL32, -3}));
+  EXPECT_FALSE(decimal32 == (data_type{type_id::DECIMAL64, -2}));
+}
+
+TEST_F(FixedPointColumnTest, AddRescales)
+{
+  // 1.00, 2.50, null + 0.5, 1.0, 3.0
+  cudf::test::fixed_width_column_wrapper<int32_t> lhs({100, 250, 0}, {1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> rhs{5, 10, 30};
+  data_type const output_type{type_id::DECIMAL32, -2};
+  EXPECT_EQ(cudf::binary_operation_fixed_point_scale(cudf::binary_operator::ADD, -2, -1), -2);
+
+  auto const result =
+    cudf::binary_operation(as_fixed_point(lhs, data_type{type_id::DECIMAL32, -2}),
+                           as_fixed_point(rhs, data_type{type_id::DECIMAL32, -1}),
+                           cudf::binary_operator::ADD,
+                           output_type);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({150, 350, 0}, {1, 1, 0});
+  EXPECT_EQ(result->type(), output_type);
+  cudf::test::expect_columns_equal(as_fixed_point(expected, output_type), result->view());
+}
+
+TEST_F(FixedPointColumnTest, MultiplyAddsScales)
+{
+  // 1.00, 2.50 * 0.5, 1.0
+  cudf::test::fixed_width_column_wrapper<int64_t> lhs{100, 250};
+  cudf::test::fixed_width_column_wrapper<int64_t> rhs{5, 10};
+  data_type const output_type{type_id::DECIMAL64, -3};
+
+  auto const result =
+    cudf::binary_operation(as_fixed_point(lhs, data_type{type_id::DECIMAL64, -2}),
+                           as_fixed_point(rhs, data_type{type_id::DECIMAL64, -1}),
+                           cudf::binary_operator::MUL,
+                           output_type);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{500, 2500};
+  cudf::test::expect_columns_equal(as_fixed_point(expected, output_type), result->view());
+}
+
+TEST_F(FixedPointColumnTest, CompareWithScalar)
+{
+  // 1.50, 2.00, 2.50 < 2
+  cudf::test::fixed_width_column_wrapper<int32_t> lhs{150, 200, 250};
+  cudf::fixed_point_scalar<int32_t> rhs(2, 0);
+
+  auto const result = cudf::binary_operation(as_fixed_point(lhs, data_type{type_id::DECIMAL32, -2}),
+                                             rhs,
+                                             cudf::binary_operator::LESS,
+                                             data_type{type_id::BOOL8});
+  cudf::test::fixed_width_column_wrapper<bool> expected{true, false, false};
+  cudf::test::expect_columns_equal(expected, result->view());
+}
+
+TEST_F(FixedPointColumnTest, BinaryOpErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{100, 250};
+  auto const lhs = as_fixed_point(col, data_type{type_id::DECIMAL32, -2});
+  auto const rhs = as_fixed_point(col, data_type{type_id::DECIMAL32, -1});
+
+  // The output scale must be the scale of the result
+  EXPECT_THROW(
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, data_type{type_id::DECIMAL32, -1}),
+    cudf::logic_error);
+  EXPECT_THROW(cudf::binary_operation(
+                 lhs, rhs, cudf::binary_operator::POW, data_type{type_id::DECIMAL32, -2}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::binary_operation(lhs,
+                                      as_fixed_point(col, data_type{type_id::DECIMAL64, -2}),
+                                      cudf::binary_operator::ADD,
+                                      data_type{type_id::DECIMAL32, -2}),
+               cudf::logic_error);
+}
+
+TEST_F(FixedPointColumnTest, Reduction)
+{
+  // 1.00, 2.50, null, -0.50
+  cudf::test::fixed_width_column_wrapper<int32_t> values({100, 250, 7, -50}, {1, 1, 0, 1});
+  data_type const type{type_id::DECIMAL32, -2};
+  auto const col = as_fixed_point(values, type);
+
+  auto const sum = cudf::reduce(col, cudf::make_sum_aggregation(), type);
+  EXPECT_EQ(sum->type(), type);
+  EXPECT_EQ(static_cast<cudf::fixed_point_scalar<int32_t> const*>(sum.get())->value(), 300);
+
+  auto const max = cudf::reduce(col, cudf::make_max_aggregation(), type);
+  EXPECT_EQ(static_cast<cudf::fixed_point_scalar<int32_t> const*>(max.get())->value(), 250);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> nulls({1, 2}, {0, 0});
+  auto const empty = cudf::reduce(as_fixed_point(nulls, type), cudf::make_sum_aggregation(), type);
+  EXPECT_EQ(empty->type(), type);
+  EXPECT_FALSE(empty->is_valid());
+
+  EXPECT_THROW(cudf::reduce(col, cudf::make_product_aggregation(), type), cudf::logic_error);
+  EXPECT_THROW(
+    cudf::reduce(col, cudf::make_sum_aggregation(), data_type{type_id::DECIMAL32, -1}),
+    cudf::logic_error);
+}
+
+TEST_F(FixedPointColumnTest, Sort)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> values{250, -50, 100};
+  auto const col = as_fixed_point(values, data_type{type_id::DECIMAL64, -2});
+
+  auto const order = cudf::sorted_order(cudf::table_view{{col}});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{1, 2, 0};
+  cudf::test::expect_columns_equal(expected, order->view());
+}
+
+TEST_F(FixedPointColumnTest, GroupbySum)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 1, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> values{100, 250, -50};
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = as_fixed_point(values, data_type{type_id::DECIMAL32, -2});
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation());
+  cudf::groupby::groupby gb(cudf::table_view{{keys}});
+  auto const result = gb.aggregate(requests);
+
+  data_type const sum_type{type_id::DECIMAL64, -2};
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_sum{300};
+  cudf::test::expect_columns_equal(as_fixed_point(expected_sum, sum_type),
+                                   result.second[0].results[0]->view());
+
+  data_type const max_type{type_id::DECIMAL32, -2};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_max{250};
+  cudf::test::expect_columns_equal(as_fixed_point(expected_max, max_type),
+                                   result.second[0].results[1]->view());
+}
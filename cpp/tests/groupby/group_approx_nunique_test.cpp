@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_approx_nunique_test : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(groupby_approx_nunique_test, cudf::test::NumericTypes);
+
+// With 2^16 registers, sketches of a few values are exact
+// clang-format off
+TYPED_TEST(groupby_approx_nunique_test, basic)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_NUNIQUE>;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<R> expect_vals { 3, 4, 3 };
+    fixed_width_column_wrapper<R> expect_bool_vals { 2, 1, 1 };
+
+    auto agg = cudf::make_approx_nunique_aggregation(16);
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg));
+    else
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_nunique_test, empty_cols)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_NUNIQUE>;
+
+    fixed_width_column_wrapper<K> keys        { };
+    fixed_width_column_wrapper<V> vals        { };
+
+    fixed_width_column_wrapper<K> expect_keys { };
+    fixed_width_column_wrapper<R> expect_vals { };
+
+    auto agg = cudf::make_approx_nunique_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_nunique_test, null_keys_and_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_NUNIQUE>;
+
+    fixed_width_column_wrapper<K> keys({ 1, 2, 3, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                       { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals({ 0, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                       { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+
+    fixed_width_column_wrapper<K> expect_keys({ 1, 2, 3, 4}, all_valid());
+    fixed_width_column_wrapper<R> expect_vals_exclude { 1, 4, 3, 0 };
+    fixed_width_column_wrapper<R> expect_vals_include { 2, 4, 3, 1 };
+    fixed_width_column_wrapper<R> expect_bool_vals_exclude { 1, 1, 1, 0 };
+    fixed_width_column_wrapper<R> expect_bool_vals_include { 2, 1, 1, 1 };
+
+    auto const is_bool = std::is_same<V, bool>();
+    test_single_agg(keys, vals, expect_keys,
+                    is_bool ? expect_bool_vals_exclude : expect_vals_exclude,
+                    cudf::make_approx_nunique_aggregation(16));
+    test_single_agg(keys, vals, expect_keys,
+                    is_bool ? expect_bool_vals_include : expect_vals_include,
+                    cudf::make_approx_nunique_aggregation(16, null_policy::INCLUDE));
+}
+// clang-format on
+
+struct groupby_approx_nunique_accuracy_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_approx_nunique_accuracy_test, large_cardinality)
+{
+  constexpr size_type num_rows   = 200000;
+  constexpr size_type num_groups = 4;
+  auto keys_begin                = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), [](auto i) { return i % num_groups; });
+  // Every value appears twice in its group
+  auto vals_begin = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                    [](auto i) { return i / (2 * num_groups); });
+  fixed_width_column_wrapper<int32_t> keys(keys_begin, keys_begin + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(vals_begin, vals_begin + num_rows);
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_approx_nunique_aggregation(14));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  auto const estimates = to_host<size_type>(*result.second[0].results[0]).first;
+  ASSERT_EQ(static_cast<size_t>(num_groups), estimates.size());
+  // The relative standard error for 2^14 registers is 0.8%
+  double const expected = num_rows / (2.0 * num_groups);
+  for (auto const estimate : estimates) { EXPECT_NEAR(expected, estimate, 0.05 * expected); }
+}
+
+TEST_F(groupby_approx_nunique_accuracy_test, invalid_precision)
+{
+  EXPECT_THROW(cudf::make_approx_nunique_aggregation(3), cudf::logic_error);
+  EXPECT_THROW(cudf::make_approx_nunique_aggregation(17), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
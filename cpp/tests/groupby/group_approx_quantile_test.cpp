@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_approx_quantile_test : public cudf::test::BaseFixture {
+};
+
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_approx_quantile_test, supported_types);
+
+// Below the compression, every value is its own centroid and medians are exact
+// clang-format off
+TYPED_TEST(groupby_approx_quantile_test, basic)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+                                          //  { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,       2,          3      };
+                                          //  { 0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+    fixed_width_column_wrapper<R> expect_vals({ 0, 3, 6, 1,  4.5, 9, 2, 7, 8}, all_valid());
+
+    auto agg = cudf::make_approx_quantile_aggregation({0, 0.5, 1});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_quantile_test, empty_cols)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { };
+    fixed_width_column_wrapper<V> vals        { };
+
+    fixed_width_column_wrapper<K> expect_keys { };
+    fixed_width_column_wrapper<R> expect_vals { };
+
+    auto agg = cudf::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_quantile_test, null_keys_and_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys(       { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                              { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals(       { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                              { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+                                          //  { 1, 1,     2, 2, 2,   3, 3,    4}
+    fixed_width_column_wrapper<K> expect_keys({ 1,        2,         3,       4}, all_valid());
+                                          //  { 3, 6,     1, 4, 9,   2, 8,    -}
+    fixed_width_column_wrapper<R> expect_vals({ 4.5,      4,         5,       0},
+                                              { 1,        1,         1,       0});
+
+    auto agg = cudf::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+// clang-format on
+
+struct groupby_approx_quantile_accuracy_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_approx_quantile_accuracy_test, large_groups)
+{
+  constexpr size_type num_rows   = 200000;
+  constexpr size_type num_groups = 4;
+  auto keys_begin                = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), [](auto i) { return i % num_groups; });
+  // Every group holds a permutation of 0 to num_rows / num_groups - 1
+  auto vals_begin = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [](auto i) { return ((i / num_groups) * 7919) % (num_rows / num_groups); });
+  fixed_width_column_wrapper<int32_t> keys(keys_begin, keys_begin + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(vals_begin, vals_begin + num_rows);
+
+  std::vector<double> const quantiles{0.01, 0.25, 0.5, 0.99};
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_approx_quantile_aggregation(quantiles));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  auto const estimates = to_host<double>(*result.second[0].results[0]).first;
+  ASSERT_EQ(num_groups * quantiles.size(), estimates.size());
+  double const group_size = num_rows / num_groups;
+  for (size_t i = 0; i < estimates.size(); ++i) {
+    double const expected = quantiles[i % quantiles.size()] * (group_size - 1);
+    EXPECT_NEAR(expected, estimates[i], 0.01 * group_size);
+  }
+}
+
+TEST_F(groupby_approx_quantile_accuracy_test, invalid_compression)
+{
+  EXPECT_THROW(cudf::make_approx_quantile_aggregation({0.5}, 0), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
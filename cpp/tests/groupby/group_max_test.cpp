@@ -167,6 +167,23 @@ TEST_F(groupby_max_string_test, zero_valid_values)
     auto agg2 = cudf::make_max_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
+
+TEST_F(groupby_max_string_test, string_keys_and_null_values)
+{
+    strings_column_wrapper keys       ({ "b", "a", "z", "b", "c", "a", "c"},
+                                       {   1,   1,   0,   1,   1,   1,   1});
+    strings_column_wrapper vals       ({ "x", "y", "z", "w", "q", "a", "r"},
+                                       {   1,   1,   1,   0,   1,   1,   0});
+
+    strings_column_wrapper expect_keys({ "a", "b", "c"}, all_valid());
+    strings_column_wrapper expect_vals({ "y", "x", "q" });
+
+    auto agg = cudf::make_max_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_max_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
 // clang-format on
 
 }  // namespace test
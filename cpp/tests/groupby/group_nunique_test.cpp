@@ -196,6 +196,33 @@ TYPED_TEST(groupby_nunique_test, include_nulls)
     else 
         test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
+
+TYPED_TEST(groupby_nunique_test, null_keys_included)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::NUNIQUE>;
+
+    fixed_width_column_wrapper<K> keys({ 1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                       { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                       { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+                                          //  { 1, 1,     2, 2, 2,   3, 3,    4,   -}
+    fixed_width_column_wrapper<K> expect_keys({ 1,        2,         3,       4,   0},
+                                              { 1,        1,         1,       1,   0});
+                // all unique values only //  { 3, 6,     1, 4, 9,   2, 8,    -,   7}
+    fixed_width_column_wrapper<R> expect_vals { 2,        3,         2,       0,   1};
+    fixed_width_column_wrapper<R> expect_bool_vals { 1, 1, 1, 0, 1};
+
+    auto agg = cudf::make_nunique_aggregation();
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg),
+                        force_use_sort_impl::NO, null_policy::INCLUDE);
+    else
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+                        force_use_sort_impl::NO, null_policy::INCLUDE);
+}
 // clang-format on
 
 }  // namespace test
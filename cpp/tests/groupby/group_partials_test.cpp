@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_partials_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::vector<std::unique_ptr<aggregation>> make_partial_aggregations()
+{
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(make_sum_aggregation());
+  aggs.push_back(make_count_aggregation());
+  aggs.push_back(make_mean_aggregation());
+  aggs.push_back(make_variance_aggregation());
+  return aggs;
+}
+
+/// Aggregates every batch separately, then merges and finalizes the partial states
+std::unique_ptr<table> sorted_aggregate_by_partials(std::vector<table_view> const& batches)
+{
+  std::vector<table_view> keys;
+  std::vector<std::vector<column_view>> partials;
+  std::vector<std::unique_ptr<table>> batch_keys;
+  std::vector<groupby::aggregation_result> batch_partials;
+  for (auto const& batch : batches) {
+    groupby::groupby gb_obj(table_view({batch.column(0)}));
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values       = batch.column(1);
+    requests[0].aggregations = make_partial_aggregations();
+    auto result              = gb_obj.aggregate_partials(requests);
+
+    keys.push_back(result.first->view());
+    partials.resize(result.second[0].results.size());
+    for (size_t i = 0; i < partials.size(); ++i) {
+      partials[i].push_back(result.second[0].results[i]->view());
+    }
+    batch_keys.push_back(std::move(result.first));
+    batch_partials.push_back(std::move(result.second[0]));
+  }
+
+  auto const all_keys = concatenate(keys);
+  std::vector<std::unique_ptr<column>> all_partials;
+  std::vector<groupby::partial_aggregation_request> requests(1);
+  for (auto const& partial : partials) {
+    all_partials.push_back(concatenate(partial));
+    requests[0].partials.push_back(all_partials.back()->view());
+  }
+  requests[0].aggregations = make_partial_aggregations();
+  auto merged              = groupby::merge_partials(all_keys->view(), requests);
+
+  requests[0].partials.clear();
+  for (auto const& partial : merged.second[0].results) {
+    requests[0].partials.push_back(partial->view());
+  }
+  auto const results = groupby::finalize_partials(requests);
+
+  auto const sort_order = sorted_order(merged.first->view());
+  return gather(table_view({merged.first->get_column(0),
+                            *results[0].results[0],
+                            *results[0].results[1],
+                            *results[0].results[2],
+                            *results[0].results[3]}),
+                *sort_order);
+}
+}  // namespace
+
+// clang-format off
+TEST_F(groupby_partials_test, basic)
+{
+    using K = int32_t;
+    using V = int32_t;
+    using S = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using C = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+    using M = cudf::detail::target_type_t<V, aggregation::MEAN>;
+    using R = cudf::detail::target_type_t<V, aggregation::VARIANCE>;
+
+    fixed_width_column_wrapper<K> keys0  { 1, 2, 1, 2};
+    fixed_width_column_wrapper<V> vals0  { 1, 2, 3, 4};
+    fixed_width_column_wrapper<K> keys1  { 2, 1, 3};
+    fixed_width_column_wrapper<V> vals1  { 6, 5, 7};
+
+    fixed_width_column_wrapper<K> expect_keys { 1,  2, 3};
+    fixed_width_column_wrapper<S> expect_sum  { 9, 12, 7};
+    fixed_width_column_wrapper<C> expect_cnt  { 3,  3, 1};
+    fixed_width_column_wrapper<M> expect_mean { 3,  4, 7};
+    fixed_width_column_wrapper<R> expect_var  ({4,  4, 0}, {1, 1, 0});
+
+    auto const result = sorted_aggregate_by_partials(
+      {table_view({keys0, vals0}), table_view({keys1, vals1})});
+    expect_tables_equal(
+      table_view({expect_keys, expect_sum, expect_cnt, expect_mean, expect_var}), *result);
+}
+
+TEST_F(groupby_partials_test, null_values)
+{
+    using K = int32_t;
+    using V = int32_t;
+    using S = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using C = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+    using M = cudf::detail::target_type_t<V, aggregation::MEAN>;
+    using R = cudf::detail::target_type_t<V, aggregation::VARIANCE>;
+
+    fixed_width_column_wrapper<K> keys0  { 1, 2, 1};
+    fixed_width_column_wrapper<V> vals0  ({ 1, 2, 3}, {1, 0, 1});
+    fixed_width_column_wrapper<K> keys1  { 2, 1};
+    fixed_width_column_wrapper<V> vals1  ({ 6, 5}, {0, 1});
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2};
+    fixed_width_column_wrapper<S> expect_sum  ({9, 0}, {1, 0});
+    fixed_width_column_wrapper<C> expect_cnt  { 3, 0};
+    fixed_width_column_wrapper<M> expect_mean ({3, 0}, {1, 0});
+    fixed_width_column_wrapper<R> expect_var  ({4, 0}, {1, 0});
+
+    auto const result = sorted_aggregate_by_partials(
+      {table_view({keys0, vals0}), table_view({keys1, vals1})});
+    expect_tables_equal(
+      table_view({expect_keys, expect_sum, expect_cnt, expect_mean, expect_var}), *result);
+}
+// clang-format on
+
+TEST_F(groupby_partials_test, approx_nunique)
+{
+  fixed_width_column_wrapper<int32_t> keys0{1, 2, 1, 2, 3, 1};
+  fixed_width_column_wrapper<int32_t> vals0{1, 2, 3, 4, 5, 3};
+  fixed_width_column_wrapper<int32_t> keys1{2, 1, 3, 3};
+  fixed_width_column_wrapper<int32_t> vals1{2, 7, 8, 5};
+  fixed_width_column_wrapper<int32_t> all_keys{1, 2, 1, 2, 3, 1, 2, 1, 3, 3};
+  fixed_width_column_wrapper<int32_t> all_vals{1, 2, 3, 4, 5, 3, 2, 7, 8, 5};
+  constexpr int precision = 6;
+
+  // Merging sketches gives the sketch of all the rows, so the estimates are the same
+  std::vector<table_view> keys;
+  std::vector<column_view> sketches;
+  std::vector<std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>>> batches;
+  for (auto const& batch : {table_view({keys0, vals0}), table_view({keys1, vals1})}) {
+    groupby::groupby gb_obj(table_view({batch.column(0)}));
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = batch.column(1);
+    requests[0].aggregations.push_back(make_approx_nunique_aggregation(precision));
+    batches.push_back(gb_obj.aggregate_partials(requests));
+    keys.push_back(batches.back().first->view());
+    ASSERT_EQ(batches.back().second[0].results.size(), 1u);
+    sketches.push_back(batches.back().second[0].results[0]->view());
+    EXPECT_EQ(sketches.back().type().id(), type_id::LIST);
+  }
+
+  auto const merged_keys     = concatenate(keys);
+  auto const merged_sketches = concatenate(sketches);
+  std::vector<groupby::partial_aggregation_request> requests(1);
+  requests[0].partials.push_back(merged_sketches->view());
+  requests[0].aggregations.push_back(make_approx_nunique_aggregation(precision));
+  auto merged = groupby::merge_partials(merged_keys->view(), requests);
+
+  requests[0].partials.clear();
+  for (auto const& partial : merged.second[0].results) {
+    requests[0].partials.push_back(partial->view());
+  }
+  auto const results    = groupby::finalize_partials(requests);
+  auto const sort_order = sorted_order(merged.first->view());
+  auto const result =
+    gather(table_view({merged.first->get_column(0), *results[0].results[0]}), *sort_order);
+
+  std::vector<groupby::aggregation_request> direct_requests(1);
+  direct_requests[0].values = all_vals;
+  direct_requests[0].aggregations.push_back(make_approx_nunique_aggregation(precision));
+  groupby::groupby gb_obj(table_view({all_keys}));
+  auto const expected    = gb_obj.aggregate(direct_requests);
+  auto const expect_view = table_view({expected.first->get_column(0),
+                                       *expected.second[0].results[0]});
+  expect_tables_equal(*gather(expect_view, *sorted_order(expected.first->view())), *result);
+}
+
+TEST_F(groupby_partials_test, approx_quantile)
+{
+  fixed_width_column_wrapper<int32_t> keys0{1, 2, 1, 2, 3, 1};
+  fixed_width_column_wrapper<int32_t> vals0{1, 2, 3, 4, 5, 3};
+  fixed_width_column_wrapper<int32_t> keys1{2, 1, 3, 3};
+  fixed_width_column_wrapper<int32_t> vals1{2, 7, 8, 5};
+  fixed_width_column_wrapper<int32_t> all_keys{1, 2, 1, 2, 3, 1, 2, 1, 3, 3};
+  fixed_width_column_wrapper<int32_t> all_vals{1, 2, 3, 4, 5, 3, 2, 7, 8, 5};
+  std::vector<double> const quantiles{0, 0.5, 1};
+
+  // Below the compression, merging t-digests keeps every value, so the estimates are the same
+  std::vector<table_view> keys;
+  std::vector<std::vector<column_view>> digests(4);
+  std::vector<std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>>> batches;
+  for (auto const& batch : {table_view({keys0, vals0}), table_view({keys1, vals1})}) {
+    groupby::groupby gb_obj(table_view({batch.column(0)}));
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = batch.column(1);
+    requests[0].aggregations.push_back(make_approx_quantile_aggregation(quantiles));
+    batches.push_back(gb_obj.aggregate_partials(requests));
+    keys.push_back(batches.back().first->view());
+    ASSERT_EQ(batches.back().second[0].results.size(), digests.size());
+    for (size_t i = 0; i < digests.size(); ++i) {
+      digests[i].push_back(batches.back().second[0].results[i]->view());
+    }
+  }
+
+  auto const merged_keys = concatenate(keys);
+  std::vector<std::unique_ptr<column>> merged_digests;
+  std::vector<groupby::partial_aggregation_request> requests(1);
+  for (auto const& partials : digests) {
+    merged_digests.push_back(concatenate(partials));
+    requests[0].partials.push_back(merged_digests.back()->view());
+  }
+  requests[0].aggregations.push_back(make_approx_quantile_aggregation(quantiles));
+  auto merged = groupby::merge_partials(merged_keys->view(), requests);
+
+  requests[0].partials.clear();
+  for (auto const& partial : merged.second[0].results) {
+    requests[0].partials.push_back(partial->view());
+  }
+  auto const results = groupby::finalize_partials(requests);
+
+  // Quantiles of a group are contiguous, so compare the groups in key order
+  auto const key_order = to_host<size_type>(*sorted_order(merged.first->view())).first;
+  auto const estimates = to_host<double>(*results[0].results[0]).first;
+
+  std::vector<groupby::aggregation_request> direct_requests(1);
+  direct_requests[0].values = all_vals;
+  direct_requests[0].aggregations.push_back(make_approx_quantile_aggregation(quantiles));
+  groupby::groupby gb_obj(table_view({all_keys}));
+  auto const expected           = gb_obj.aggregate(direct_requests);
+  auto const expected_key_order = to_host<size_type>(*sorted_order(expected.first->view())).first;
+  auto const expected_estimates = to_host<double>(*expected.second[0].results[0]).first;
+
+  ASSERT_EQ(key_order.size(), expected_key_order.size());
+  ASSERT_EQ(estimates.size(), expected_estimates.size());
+  for (size_t g = 0; g < key_order.size(); ++g) {
+    for (size_t j = 0; j < quantiles.size(); ++j) {
+      EXPECT_EQ(expected_estimates[expected_key_order[g] * quantiles.size() + j],
+                estimates[key_order[g] * quantiles.size() + j]);
+    }
+  }
+}
+
+TEST_F(groupby_partials_test, unsupported_aggregation)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_median_aggregation());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate_partials(requests), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_scan_test : public cudf::test::BaseFixture {
+};
+
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_scan_test, supported_types);
+
+// clang-format off
+TYPED_TEST(groupby_scan_test, basic)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using C = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2,  2, 1, 3,  3,  2};
+    fixed_width_column_wrapper<V> vals        { 5, 8, 1, 0, 2,  9, 3, 7,  4,  6};
+
+    fixed_width_column_wrapper<R> expect_sum  { 5, 8, 1, 5, 10, 19, 8, 8, 12, 25};
+    fixed_width_column_wrapper<V> expect_min  { 5, 8, 1, 0, 2,  2, 0, 1,  1,  2};
+    fixed_width_column_wrapper<V> expect_max  { 5, 8, 1, 5, 8,  9, 5, 7,  7,  9};
+    fixed_width_column_wrapper<C> expect_cnt  { 1, 1, 1, 2, 2,  3, 3, 2,  3,  4};
+    fixed_width_column_wrapper<C> expect_rank { 3, 3, 1, 1, 1,  4, 2, 3,  2,  2};
+
+    test_single_scan(keys, vals, expect_sum, cudf::make_sum_aggregation());
+    test_single_scan(keys, vals, expect_min, cudf::make_min_aggregation());
+    test_single_scan(keys, vals, expect_max, cudf::make_max_aggregation());
+    test_single_scan(keys, vals, expect_cnt, cudf::make_count_aggregation());
+    test_single_scan(keys, vals, expect_rank, cudf::make_rank_aggregation());
+}
+
+TYPED_TEST(groupby_scan_test, empty_cols)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    fixed_width_column_wrapper<K> keys        { };
+    fixed_width_column_wrapper<V> vals        { };
+
+    fixed_width_column_wrapper<R> expect_vals { };
+
+    test_single_scan(keys, vals, expect_vals, cudf::make_sum_aggregation());
+}
+
+TYPED_TEST(groupby_scan_test, null_keys_and_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using C = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+
+    fixed_width_column_wrapper<K> keys(       { 1, 2, 3, 1, 2,  2, 1, 3, 3, 2},
+                                              { 1, 1, 1, 1, 1,  1, 1, 0, 1, 1});
+    fixed_width_column_wrapper<V> vals(       { 5, 8, 1, 0, 2,  9, 3, 7, 4, 6},
+                                              { 1, 1, 1, 0, 1,  0, 1, 1, 1, 1});
+
+    fixed_width_column_wrapper<R> expect_sum( { 5, 8, 1, 0, 10, 0, 8, 0, 5, 16},
+                                              { 1, 1, 1, 0, 1,  0, 1, 0, 1, 1});
+    fixed_width_column_wrapper<C> expect_cnt( { 1, 1, 1, 1, 2,  2, 2, 0, 2, 3},
+                                              { 1, 1, 1, 1, 1,  1, 1, 0, 1, 1});
+    fixed_width_column_wrapper<C> expect_all( { 1, 1, 1, 2, 2,  3, 3, 0, 2, 4},
+                                              { 1, 1, 1, 1, 1,  1, 1, 0, 1, 1});
+    fixed_width_column_wrapper<C> expect_rank({ 2, 3, 1, 3, 1,  4, 1, 0, 2, 2},
+                                              { 1, 1, 1, 1, 1,  1, 1, 0, 1, 1});
+
+    test_single_scan(keys, vals, expect_sum, cudf::make_sum_aggregation());
+    test_single_scan(keys, vals, expect_cnt, cudf::make_count_aggregation());
+    test_single_scan(keys, vals, expect_all, cudf::make_count_aggregation(null_policy::INCLUDE));
+    test_single_scan(keys, vals, expect_rank, cudf::make_rank_aggregation());
+}
+
+TYPED_TEST(groupby_scan_test, rank_ties)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::RANK>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 1, 1, 1, 2, 2};
+    fixed_width_column_wrapper<V> vals        { 3, 1, 3, 1, 5, 5};
+
+    fixed_width_column_wrapper<R> expect_vals { 3, 1, 3, 1, 1, 1};
+
+    test_single_scan(keys, vals, expect_vals, cudf::make_rank_aggregation());
+}
+// clang-format on
+
+}  // namespace test
+}  // namespace cudf
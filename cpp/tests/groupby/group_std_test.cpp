@@ -140,6 +140,45 @@ TYPED_TEST(groupby_std_test, ddof_non_default)
     auto agg = cudf::make_std_aggregation(2);
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
+
+TYPED_TEST(groupby_std_test, with_mean_and_variance)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using M = cudf::detail::target_type_t<V, aggregation::MEAN>;
+    using R = cudf::detail::target_type_t<V, aggregation::STD>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+                                          //  { 1, 1, 1,  2, 2, 2, 2,  3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,        2,           3      };
+                                          //  { 0, 3, 6,  1, 4, 5, 9,  2, 7, 8}
+    fixed_width_column_wrapper<M> expect_means({  3.,       19./4,       17./3  }, all_valid());
+    fixed_width_column_wrapper<R> expect_vars ({  9.,       131./12,     31./3  }, all_valid());
+    fixed_width_column_wrapper<R> expect_stds ({  3.,   sqrt(131./12),sqrt(31./3)}, all_valid());
+
+    // The three aggregations share the sum and the count of each group
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation());
+    requests[0].aggregations.push_back(cudf::make_variance_aggregation());
+    requests[0].aggregations.push_back(cudf::make_std_aggregation());
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    auto const& results    = result.second[0].results;
+    auto const sort_order  = sorted_order(result.first->view());
+    auto const sorted_keys = gather(result.first->view(), *sort_order);
+    auto const sorted_vals = gather(
+      table_view({results[0]->view(), results[1]->view(), results[2]->view()}), *sort_order);
+
+    expect_tables_equal(table_view({expect_keys}), *sorted_keys);
+    expect_columns_equivalent(expect_means, sorted_vals->get_column(0), true);
+    expect_columns_equivalent(expect_vars, sorted_vals->get_column(1), true);
+    expect_columns_equivalent(expect_stds, sorted_vals->get_column(2), true);
+}
 // clang-format on
 
 }  // namespace test
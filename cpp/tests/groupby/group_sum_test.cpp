@@ -134,5 +134,55 @@ TYPED_TEST(groupby_sum_test, null_keys_and_values)
 }
 // clang-format on
 
+struct groupby_sum_shared_memory_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_sum_shared_memory_test, few_keys_many_rows)
+{
+  // Every block pre-aggregates rows of all the groups before flushing them
+  constexpr int32_t num_rows{1 << 20};
+  constexpr int32_t num_keys{100};
+
+  auto keys_iter = make_counting_transform_iterator(0, [](auto i) { return i % num_keys; });
+  auto vals_iter = make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  fixed_width_column_wrapper<int32_t> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(vals_iter, vals_iter + num_rows);
+
+  std::vector<int64_t> sums(num_keys, 0);
+  for (int32_t i = 0; i < num_rows; ++i) { sums[i % num_keys] += i % 7; }
+  auto expect_keys_iter = make_counting_transform_iterator(0, [](auto i) { return i; });
+  fixed_width_column_wrapper<int32_t> expect_keys(expect_keys_iter, expect_keys_iter + num_keys);
+  fixed_width_column_wrapper<int64_t> expect_vals(sums.begin(), sums.end());
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+}
+
+TEST_F(groupby_sum_shared_memory_test, keys_missed_by_the_sample)
+{
+  // The sampled rows all have the key 0, but every other row has its own key,
+  // so the block-local tables overflow
+  constexpr int32_t num_rows{1 << 20};
+  constexpr int32_t stride{num_rows / 4096};
+
+  auto keys_iter =
+    make_counting_transform_iterator(0, [](auto i) { return i % stride == 0 ? 0 : i; });
+  auto vals_iter = make_counting_transform_iterator(0, [](auto i) { return 1; });
+  fixed_width_column_wrapper<int32_t> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(vals_iter, vals_iter + num_rows);
+
+  std::vector<int32_t> unique_keys{0};
+  std::vector<int64_t> sums{num_rows / stride};
+  for (int32_t i = 0; i < num_rows; ++i) {
+    if (i % stride != 0) {
+      unique_keys.push_back(i);
+      sums.push_back(1);
+    }
+  }
+  fixed_width_column_wrapper<int32_t> expect_keys(unique_keys.begin(), unique_keys.end());
+  fixed_width_column_wrapper<int64_t> expect_vals(sums.begin(), sums.end());
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -140,6 +140,46 @@ TYPED_TEST(groupby_var_test, ddof_non_default)
     auto agg = cudf::make_variance_aggregation(2);
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
+
+struct groupby_var_accuracy_test : public cudf::test::BaseFixture {
+};
+
+// The hash and the sort implementations give the same variances
+TEST_F(groupby_var_accuracy_test, large_magnitude_values)
+{
+    using R = cudf::detail::target_type_t<double, aggregation::VARIANCE>;
+
+    fixed_width_column_wrapper<int32_t> keys  { 1, 2, 1, 2, 1, 2, 1, 2};
+    fixed_width_column_wrapper<double> vals   { 1e9 + 4, 1e9 + 1, 1e9 + 7,  1e9 + 2,
+                                                1e9 + 13, 1e9 + 3, 1e9 + 16, 1e9 + 6};
+
+    fixed_width_column_wrapper<int32_t> expect_keys { 1,     2     };
+                                                //  { 4, 7, 13, 16, 1, 2, 3, 6} + 1e9
+    fixed_width_column_wrapper<R> expect_vals      ({ 30.,   14./3 }, all_valid());
+
+    test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_variance_aggregation());
+    test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_variance_aggregation(),
+                    force_use_sort_impl::YES);
+}
+
+TEST_F(groupby_var_accuracy_test, overflowing_squares)
+{
+    using R = cudf::detail::target_type_t<int32_t, aggregation::VARIANCE>;
+
+    // The sums of squares of both groups overflow int64_t
+    fixed_width_column_wrapper<int32_t> keys  { 1, 1, 1, 1, 1, 2, 2};
+    fixed_width_column_wrapper<int32_t> vals  { 2000000000, -2000000000, 2000000000,
+                                                -2000000000, 2000000000,
+                                                2147483647, -2147483647};
+
+    fixed_width_column_wrapper<int32_t> expect_keys { 1,        2                       };
+    fixed_width_column_wrapper<R> expect_vals      ({ 4.8e18,   2. * 2147483647. * 2147483647.},
+                                                    all_valid());
+
+    test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_variance_aggregation());
+    test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_variance_aggregation(),
+                    force_use_sort_impl::YES);
+}
 // clang-format on
 
 }  // namespace test
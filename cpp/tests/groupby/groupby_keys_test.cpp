@@ -122,6 +122,24 @@ TYPED_TEST(groupby_keys_test, pre_sorted_keys)
         force_use_sort_impl::YES, null_policy::EXCLUDE, sorted::YES);
 }
 
+TYPED_TEST(groupby_keys_test, pre_grouped_keys)
+{
+    using K = TypeParam;
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    fixed_width_column_wrapper<K> keys(       { 3, 3, 1, 1, 1, 4, 2, 2},
+                                              { 1, 1, 1, 0, 1, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7};
+
+    fixed_width_column_wrapper<K> expect_keys({ 3,    1,       4, 2   }, all_valid());
+    fixed_width_column_wrapper<R> expect_vals { 1,    6,       5, 13  };
+
+    auto agg = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+        force_use_sort_impl::YES, null_policy::EXCLUDE, sorted::YES);
+}
+
 TYPED_TEST(groupby_keys_test, pre_sorted_keys_descending)
 {
     using K = TypeParam;
@@ -177,6 +195,41 @@ TYPED_TEST(groupby_keys_test, pre_sorted_keys_nulls_before_include_nulls)
         force_use_sort_impl::YES, null_policy::INCLUDE, sorted::YES); 
 }
 
+TYPED_TEST(groupby_keys_test, groups_reused_across_calls)
+{
+    using K = TypeParam;
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+    fixed_width_column_wrapper<K> keys(       { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2},
+                                              { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1});
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    fixed_width_column_wrapper<V> vals2(      { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+                                              { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1});
+
+    fixed_width_column_wrapper<R> expect_sum  { 9, 19, 10};
+    fixed_width_column_wrapper<R> expect_sum2 { 18, 17, 1};
+
+    groupby::groupby gb_obj(table_view({keys}));
+
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    auto const result = gb_obj.aggregate(requests);
+
+    requests[0].values = vals2;
+    auto const result2 = gb_obj.aggregate(requests);
+
+    // The groups found by the first call are returned in the same order
+    expect_tables_equal(result.first->view(), result2.first->view());
+
+    auto const sort_order  = sorted_order(result.first->view());
+    auto const sorted_sum  = gather(table_view({result.second[0].results[0]->view()}), *sort_order);
+    auto const sorted_sum2 = gather(table_view({result2.second[0].results[0]->view()}), *sort_order);
+    expect_columns_equivalent(expect_sum, sorted_sum->get_column(0), true);
+    expect_columns_equivalent(expect_sum2, sorted_sum2->get_column(0), true);
+}
+
 struct groupby_string_keys_test : public cudf::test::BaseFixture {};
 
 TEST_F(groupby_string_keys_test, basic)
@@ -195,5 +248,36 @@ TEST_F(groupby_string_keys_test, basic)
 }
 // clang-format on
 
+struct groupby_memory_estimate_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_memory_estimate_test, basic)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto make_requests = [&](std::unique_ptr<aggregation>&& agg) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(std::move(agg));
+    return requests;
+  };
+  auto const sum_requests    = make_requests(cudf::make_sum_aggregation());
+  auto const median_requests = make_requests(cudf::make_median_aggregation());
+
+  groupby::groupby gb(table_view({keys}));
+  // Keys and sums of the 3 groups
+  auto const sum_estimate = gb.estimate_aggregate_memory(sum_requests, 3);
+  EXPECT_GE(sum_estimate, 3 * (sizeof(int32_t) + sizeof(int64_t)));
+  EXPECT_GE(gb.estimate_aggregate_memory(sum_requests), sum_estimate);
+  // The sort-based groupby also holds the sorted values
+  EXPECT_GE(gb.estimate_aggregate_memory(median_requests, 3), 10 * sizeof(int32_t));
+
+  fixed_width_column_wrapper<int32_t> short_vals{0, 1, 2};
+  auto mismatched      = make_requests(cudf::make_sum_aggregation());
+  mismatched[0].values = short_vals;
+  EXPECT_THROW(gb.estimate_aggregate_memory(mismatched), cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
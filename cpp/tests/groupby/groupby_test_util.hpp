@@ -98,6 +98,26 @@ inline void test_single_agg(column_view const& keys,
   }
 }
 
+inline void test_single_scan(column_view const& keys,
+                             column_view const& values,
+                             column_view const& expect_vals,
+                             std::unique_ptr<aggregation>&& agg,
+                             null_policy include_null_keys = null_policy::EXCLUDE)
+{
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back(groupby::aggregation_request());
+  requests[0].values = values;
+
+  requests[0].aggregations.push_back(std::move(agg));
+
+  groupby::groupby gb_obj(table_view({keys}), include_null_keys);
+
+  auto result = gb_obj.scan(requests);
+
+  expect_tables_equal(table_view({keys}), result.first->view());
+  expect_columns_equivalent(expect_vals, *result.second[0].results[0], true);
+}
+
 inline auto all_valid()
 {
   auto all_valid = make_counting_transform_iterator(0, [](auto i) { return true; });
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+namespace cudf {
+namespace test {
+struct partitioned_groupby_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+/// Aggregates the batches and returns the keys and results sorted by keys
+std::unique_ptr<table> sorted_partitioned_aggregate(std::vector<table_view> const& batches,
+                                                    size_type num_partitions,
+                                                    null_policy include_null_keys)
+{
+  groupby::partitioned_groupby gb_obj({0}, num_partitions, include_null_keys);
+  for (auto const& batch : batches) { gb_obj.append(batch); }
+
+  std::vector<groupby::partitioned_aggregation_request> requests(1);
+  requests[0].values_column = 1;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  requests[0].aggregations.push_back(make_count_aggregation());
+  auto result = gb_obj.aggregate(requests);
+
+  auto const sort_order = sorted_order(result.first->view(), {}, {null_order::AFTER});
+  return gather(table_view({result.first->get_column(0),
+                            *result.second[0].results[0],
+                            *result.second[0].results[1]}),
+                *sort_order);
+}
+}  // namespace
+
+// clang-format off
+TEST_F(partitioned_groupby_test, basic)
+{
+    using K = int32_t;
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using C = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+
+    fixed_width_column_wrapper<K> keys0  { 1, 2, 3, 1, 2};
+    fixed_width_column_wrapper<V> vals0  { 0, 1, 2, 3, 4};
+    fixed_width_column_wrapper<K> keys1  { 2, 1, 3, 3, 2, 5};
+    fixed_width_column_wrapper<V> vals1  { 5, 6, 7, 8, 9, 1};
+
+    fixed_width_column_wrapper<K> expect_keys { 1,  2,  3, 5};
+    fixed_width_column_wrapper<R> expect_sum  { 9, 19, 17, 1};
+    fixed_width_column_wrapper<C> expect_cnt  { 3,  4,  3, 1};
+
+    for (size_type num_partitions : {1, 3, 16}) {
+      auto const result = sorted_partitioned_aggregate(
+        {table_view({keys0, vals0}), table_view({keys1, vals1})}, num_partitions,
+        null_policy::EXCLUDE);
+      expect_tables_equal(table_view({expect_keys, expect_sum, expect_cnt}), *result);
+    }
+}
+
+TEST_F(partitioned_groupby_test, string_keys_and_nulls)
+{
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using C = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+
+    strings_column_wrapper        keys0( { "a", "b", "c", "a"}, { 1, 1, 0, 1});
+    fixed_width_column_wrapper<V> vals0( {  0,   1,   2,   3 }, { 1, 0, 1, 1});
+    strings_column_wrapper        keys1( { "b", "c", "d"},      { 1, 1, 1});
+    fixed_width_column_wrapper<V> vals1  {  4,   5,   6 };
+
+    strings_column_wrapper        expect_keys{ "a", "b", "c", "d"};
+    fixed_width_column_wrapper<R> expect_sum { 3,    4,   5,   6 };
+    fixed_width_column_wrapper<C> expect_cnt { 2,    1,   1,   1 };
+
+    auto const result = sorted_partitioned_aggregate(
+      {table_view({keys0, vals0}), table_view({keys1, vals1})}, 4, null_policy::EXCLUDE);
+    expect_tables_equal(table_view({expect_keys, expect_sum, expect_cnt}), *result);
+
+    strings_column_wrapper        expect_keys_nulls({ "a", "b", "c", "d", ""}, { 1, 1, 1, 1, 0});
+    fixed_width_column_wrapper<R> expect_sum_nulls  { 3,    4,   5,   6,   2 };
+    fixed_width_column_wrapper<C> expect_cnt_nulls  { 2,    1,   1,   1,   1 };
+
+    auto const result_nulls = sorted_partitioned_aggregate(
+      {table_view({keys0, vals0}), table_view({keys1, vals1})}, 4, null_policy::INCLUDE);
+    expect_tables_equal(table_view({expect_keys_nulls, expect_sum_nulls, expect_cnt_nulls}),
+                        *result_nulls);
+}
+
+TEST_F(partitioned_groupby_test, empty_batches)
+{
+    using K = int32_t;
+    using V = int32_t;
+    using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using C = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+
+    fixed_width_column_wrapper<K> keys { };
+    fixed_width_column_wrapper<V> vals { };
+
+    fixed_width_column_wrapper<K> expect_keys { };
+    fixed_width_column_wrapper<R> expect_sum  { };
+    fixed_width_column_wrapper<C> expect_cnt  { };
+
+    auto const result = sorted_partitioned_aggregate({table_view({keys, vals})}, 4,
+                                                     null_policy::EXCLUDE);
+    expect_tables_equal(table_view({expect_keys, expect_sum, expect_cnt}), *result);
+}
+// clang-format on
+
+}  // namespace test
+}  // namespace cudf
@@ -663,6 +663,32 @@ TEST_F(GroupedRollingTestStrings, StringsUnsupportedOperators)
     cudf::logic_error);
 }
 
+class GroupedRollingWindowFunctionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GroupedRollingWindowFunctionTest, VarianceLeadLag)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 2, 3, 4, 5});
+  fixed_width_column_wrapper<int32_t> keys({0, 0, 0, 1, 1});
+  const cudf::table_view key_cols{std::vector<cudf::column_view>{keys}};
+
+  // the windows cover the whole groups
+  auto got_var =
+    cudf::grouped_rolling_window(key_cols, input, 3, 2, 1, cudf::make_variance_aggregation());
+  auto got_lead =
+    cudf::grouped_rolling_window(key_cols, input, 3, 2, 1, cudf::make_lead_aggregation(1));
+  auto got_lag =
+    cudf::grouped_rolling_window(key_cols, input, 3, 2, 1, cudf::make_lag_aggregation(1));
+
+  fixed_width_column_wrapper<double> expected_var({1, 1, 1, 0.5, 0.5});
+  fixed_width_column_wrapper<int32_t> expected_lead({2, 3, 0, 5, 0}, {1, 1, 0, 1, 0});
+  fixed_width_column_wrapper<int32_t> expected_lag({0, 1, 2, 0, 4}, {0, 1, 1, 0, 1});
+
+  cudf::test::expect_columns_equivalent(expected_var, got_var->view());
+  cudf::test::expect_columns_equal(expected_lead, got_lead->view());
+  cudf::test::expect_columns_equal(expected_lag, got_lag->view());
+}
+
 template <typename T>
 class GroupedTimeRangeRollingTest : public cudf::test::BaseFixture {
  protected:
@@ -1234,3 +1260,32 @@ TYPED_TEST(GroupedTimeRangeRollingTest, SimplePartitionedStaticWindowsWithNoGrou
 }
 
 CUDF_TEST_PROGRAM_MAIN()
+
+class GroupedTimeRangeWindowSizesTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GroupedTimeRangeWindowSizesTest, ReusedWindowSizes)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 1, 1, 1, 1, 2, 2, 2, 2});
+  std::vector<int32_t> timestamp_days_vec{1, 2, 3, 7, 7, 1, 1, 2, 4};
+  fixed_width_column_wrapper<cudf::timestamp_D> timestamps(timestamp_days_vec.begin(),
+                                                           timestamp_days_vec.end());
+  fixed_width_column_wrapper<int32_t> input({10, 20, 10, 50, 60, 20, 30, 80, 40});
+  const cudf::table_view key_cols{std::vector<cudf::column_view>{keys}};
+
+  auto sizes =
+    cudf::grouped_time_range_window_sizes(key_cols, timestamps, cudf::order::ASCENDING, 1, 1);
+
+  fixed_width_column_wrapper<size_type> expected_preceding({1, 2, 2, 1, 2, 1, 2, 3, 1});
+  fixed_width_column_wrapper<size_type> expected_following({1, 1, 0, 1, 0, 2, 1, 0, 0});
+  cudf::test::expect_columns_equal(expected_preceding, sizes.first->view());
+  cudf::test::expect_columns_equal(expected_following, sizes.second->view());
+
+  for (auto const& make_agg : {cudf::make_sum_aggregation, cudf::make_max_aggregation}) {
+    auto expected = cudf::grouped_time_range_rolling_window(
+      key_cols, timestamps, cudf::order::ASCENDING, input, 1, 1, 1, make_agg());
+    auto got =
+      cudf::rolling_window(input, sizes.first->view(), sizes.second->view(), 1, make_agg());
+    cudf::test::expect_columns_equal(*expected, *got);
+  }
+}
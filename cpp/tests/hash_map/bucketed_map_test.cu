@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/types.hpp>
+#include <hash/bucketed_hash_map.cuh>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <gtest/gtest.h>
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/logical.h>
+
+#include <limits>
+
+struct key_to_pair {
+  __device__ thrust::pair<int32_t, int32_t> operator()(int32_t key) const
+  {
+    return thrust::make_pair(key, key * 2);
+  }
+};
+
+struct BucketedHashMapTest : public cudf::test::BaseFixture {
+  using map_type = cudf::detail::
+    bucketed_hash_map<int32_t, int32_t, MurmurHash3_32<int32_t>, thrust::equal_to<int32_t>>;
+
+  static constexpr int32_t empty = std::numeric_limits<int32_t>::max();
+
+  map_type make_map(cudf::size_type num_keys, double load_factor = 0.5)
+  {
+    return map_type(num_keys,
+                    load_factor,
+                    empty,
+                    empty,
+                    MurmurHash3_32<int32_t>{},
+                    thrust::equal_to<int32_t>{});
+  }
+
+  rmm::device_vector<bool> contains(map_type& map, int32_t first_key, int32_t last_key)
+  {
+    rmm::device_vector<bool> found(last_key - first_key);
+    map.contains(thrust::make_counting_iterator(first_key),
+                 thrust::make_counting_iterator(last_key),
+                 found.begin(),
+                 MurmurHash3_32<int32_t>{},
+                 thrust::equal_to<int32_t>{});
+    return found;
+  }
+
+  void insert(map_type& map, int32_t first_key, int32_t last_key)
+  {
+    auto const pairs = thrust::make_transform_iterator(thrust::make_counting_iterator(first_key),
+                                                       key_to_pair{});
+    map.insert(pairs, pairs + (last_key - first_key));
+  }
+
+  static bool all_of(rmm::device_vector<bool> const& flags, bool value)
+  {
+    return thrust::all_of(
+      flags.begin(), flags.end(), [value] __device__(bool flag) { return flag == value; });
+  }
+};
+
+TEST_F(BucketedHashMapTest, InsertAndFind)
+{
+  auto map = make_map(10000);
+  EXPECT_GE(map.capacity(), 20000u);
+  EXPECT_EQ(map.capacity() % map_type::bucket_size, 0u);
+
+  insert(map, 0, 10000);
+  EXPECT_TRUE(all_of(contains(map, 0, 10000), true));
+  EXPECT_TRUE(all_of(contains(map, 10000, 20000), false));
+}
+
+TEST_F(BucketedHashMapTest, DuplicateKeys)
+{
+  auto map = make_map(1000);
+  insert(map, 0, 1000);
+  insert(map, 500, 1500);
+  EXPECT_TRUE(all_of(contains(map, 0, 1500), true));
+  EXPECT_TRUE(all_of(contains(map, 1500, 2000), false));
+}
+
+TEST_F(BucketedHashMapTest, FullLoadFactor)
+{
+  auto map = make_map(1024, 1.0);
+  EXPECT_EQ(map.capacity(), 1024u);
+  insert(map, 0, 1024);
+  EXPECT_TRUE(all_of(contains(map, 0, 1024), true));
+}
+
+TEST_F(BucketedHashMapTest, Rehash)
+{
+  auto map = make_map(100);
+  insert(map, 0, 100);
+  map.rehash(10000);
+  EXPECT_GE(map.capacity(), 20000u);
+  EXPECT_TRUE(all_of(contains(map, 0, 100), true));
+
+  insert(map, 100, 10000);
+  EXPECT_TRUE(all_of(contains(map, 0, 10000), true));
+  EXPECT_TRUE(all_of(contains(map, 10000, 10100), false));
+}
+
+TEST_F(BucketedHashMapTest, InvalidLoadFactor)
+{
+  EXPECT_THROW(make_map(100, 0.0), cudf::logic_error);
+  EXPECT_THROW(make_map(100, 1.5), cudf::logic_error);
+}
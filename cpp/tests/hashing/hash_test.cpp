@@ -112,6 +112,88 @@ TEST_F(HashTest, MultiValueNulls)
   expect_columns_equal(output1->view(), output2->view());
 }
 
+TEST_F(HashTest, XXHash64)
+{
+  // The rows of a single column hash to the xxHash64 of the value combined with a zero seed
+  strings_column_wrapper const strings_col({"", "abc"});
+  fixed_width_column_wrapper<int32_t> const ints_col({1, 1});
+  auto const strings_output =
+    cudf::hash(cudf::table_view({strings_col}), {}, cudf::hash_id::HASH_XXHASH64);
+  auto const ints_output =
+    cudf::hash(cudf::table_view({ints_col}), {}, cudf::hash_id::HASH_XXHASH64);
+
+  fixed_width_column_wrapper<int64_t> const expected_strings(
+    {-8251064074018527826, -2093146130496780882});
+  fixed_width_column_wrapper<int64_t> const expected_ints(
+    {-7897328330681757850, -7897328330681757850});
+  expect_columns_equal(strings_output->view(), expected_strings);
+  expect_columns_equal(ints_output->view(), expected_ints);
+}
+
+TEST_F(HashTest, XXHash64MultiValueNulls)
+{
+  // Nulls with different values should be equal, strings longer than 32 bytes are hashed
+  // in stripes
+  strings_column_wrapper const strings_col1({"",
+                                             "The quick brown fox",
+                                             "jumps over the lazy dog.",
+                                             "All work and no play makes Jack a dull boy"},
+                                            {0, 1, 1, 1});
+  strings_column_wrapper const strings_col2({"different but null",
+                                             "The quick brown fox",
+                                             "jumps over the lazy dog.",
+                                             "All work and no play makes Jack a dull boy"},
+                                            {0, 1, 1, 1});
+  fixed_width_column_wrapper<double> const doubles_col1({0.0, 1.5, -2.5, 1e300}, {1, 0, 1, 1});
+  fixed_width_column_wrapper<double> const doubles_col2({-0.0, 7.0, -2.5, 1e300}, {1, 0, 1, 1});
+
+  auto const input1 = cudf::table_view({strings_col1, doubles_col1});
+  auto const input2 = cudf::table_view({strings_col2, doubles_col2});
+
+  auto const output1 = cudf::hash(input1, {}, cudf::hash_id::HASH_XXHASH64);
+  auto const output2 = cudf::hash(input2, {}, cudf::hash_id::HASH_XXHASH64);
+
+  EXPECT_EQ(input1.num_rows(), output1->size());
+  EXPECT_EQ(cudf::data_type{cudf::INT64}, output1->type());
+  expect_columns_equal(output1->view(), output2->view());
+
+  // Initial hash values change the hash of every row
+  auto const seeded = cudf::hash(input1, {1, 2}, cudf::hash_id::HASH_XXHASH64);
+  auto const hashes        = cudf::test::to_host<int64_t>(output1->view()).first;
+  auto const seeded_hashes = cudf::test::to_host<int64_t>(seeded->view()).first;
+  for (size_t i = 0; i < hashes.size(); ++i) { EXPECT_NE(hashes[i], seeded_hashes[i]); }
+}
+
+TEST_F(HashTest, SparkMurmur3)
+{
+  // Expected values are the results of Spark's `hash` function
+  auto const spark_hash = [](std::vector<cudf::column_view> const& columns) {
+    return cudf::hash(cudf::table_view(columns), {}, cudf::hash_id::HASH_SPARK_MURMUR3);
+  };
+
+  fixed_width_column_wrapper<int32_t> const ints_col({1, 2, 0}, {1, 1, 0});
+  fixed_width_column_wrapper<int64_t> const longs_col({1});
+  fixed_width_column_wrapper<float> const floats_col({-0.0f, 0.0f});
+  strings_column_wrapper const strings_col({"abc"});
+  expect_columns_equal(spark_hash({ints_col})->view(),
+                       fixed_width_column_wrapper<int32_t>({-559580957, 1765031574, 42}));
+  expect_columns_equal(spark_hash({longs_col})->view(),
+                       fixed_width_column_wrapper<int32_t>({-1712319331}));
+  expect_columns_equal(spark_hash({floats_col})->view(),
+                       fixed_width_column_wrapper<int32_t>({933211791, 933211791}));
+  expect_columns_equal(spark_hash({strings_col})->view(),
+                       fixed_width_column_wrapper<int32_t>({1322437556}));
+
+  // Each column is hashed with the hash of the previous columns as seed, nulls are skipped
+  fixed_width_column_wrapper<int32_t> const firsts({1, 0}, {1, 0});
+  fixed_width_column_wrapper<int32_t> const seconds({2, 2});
+  expect_columns_equal(spark_hash({firsts, seconds})->view(),
+                       fixed_width_column_wrapper<int32_t>({-222940379, 1765031574}));
+
+  EXPECT_THROW(cudf::hash(cudf::table_view({ints_col}), {0}, cudf::hash_id::HASH_SPARK_MURMUR3),
+               cudf::logic_error);
+}
+
 template <typename T>
 class HashTestTyped : public cudf::test::BaseFixture {
 };
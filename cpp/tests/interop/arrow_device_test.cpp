@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/arrow_device.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <string>
+
+struct ArrowDeviceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ArrowDeviceTest, Schema)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> ints({1, 2}, {1, 0});
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms> times{1, 2};
+  cudf::test::strings_column_wrapper strings{"a", "b"};
+  cudf::table_view const input{{ints, times, strings}};
+
+  auto const schema = cudf::to_arrow_schema(input, {"ints", "times", "strings"});
+  EXPECT_EQ(std::string(schema->format), "+s");
+  ASSERT_EQ(schema->n_children, 3);
+  EXPECT_EQ(std::string(schema->children[0]->format), "l");
+  EXPECT_EQ(std::string(schema->children[0]->name), "ints");
+  EXPECT_EQ(schema->children[0]->flags, ARROW_FLAG_NULLABLE);
+  EXPECT_EQ(std::string(schema->children[1]->format), "tsm:");
+  EXPECT_EQ(std::string(schema->children[2]->format), "u");
+  EXPECT_EQ(schema->children[2]->flags, 0);
+}
+
+TEST_F(ArrowDeviceTest, FixedWidthRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4}, {1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles{0.5, 1.5, 2.5, 3.5};
+  cudf::table_view const input{{ints, doubles}};
+
+  auto const schema = cudf::to_arrow_schema(input);
+  auto const array  = cudf::to_arrow_device(input);
+  EXPECT_EQ(array->device_type, ARROW_DEVICE_CUDA);
+  EXPECT_NE(array->sync_event, nullptr);
+  EXPECT_EQ(array->array.length, 4);
+  EXPECT_EQ(array->array.children[0]->null_count, 1);
+
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  cudf::test::expect_tables_equal(input, *result);
+  // The buffers are shared rather than copied
+  EXPECT_EQ(result->column(0).head(), input.column(0).head());
+  EXPECT_EQ(result->column(0).null_mask(), input.column(0).null_mask());
+  EXPECT_EQ(result->column(1).head(), input.column(1).head());
+}
+
+TEST_F(ArrowDeviceTest, StringsRoundTrip)
+{
+  cudf::test::strings_column_wrapper strings({"", "this", "is", "a", "string"}, {1, 1, 0, 1, 1});
+  cudf::table_view const input{{strings}};
+
+  auto const schema = cudf::to_arrow_schema(input);
+  auto const array  = cudf::to_arrow_device(input);
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  cudf::test::expect_tables_equal(input, *result);
+  EXPECT_EQ(cudf::strings_column_view(result->column(0)).chars().head(),
+            cudf::strings_column_view(input.column(0)).chars().head());
+}
+
+TEST_F(ArrowDeviceTest, BooleansRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<bool> bools({true, false, true, true, false},
+                                                     {1, 1, 0, 1, 1});
+  cudf::table_view const input{{bools}};
+
+  auto const schema = cudf::to_arrow_schema(input);
+  auto const array  = cudf::to_arrow_device(input);
+  EXPECT_EQ(std::string(schema->children[0]->format), "b");
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  cudf::test::expect_tables_equal(input, *result);
+}
+
+TEST_F(ArrowDeviceTest, SlicedRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> ints({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  cudf::test::strings_column_wrapper strings{"a", "bb", "ccc", "dddd", "eeeee"};
+  cudf::test::fixed_width_column_wrapper<bool> bools{true, false, true, false, true};
+  auto const sliced = cudf::slice(cudf::table_view{{ints, strings, bools}}, {1, 4}).front();
+
+  auto const schema = cudf::to_arrow_schema(sliced);
+  auto const array  = cudf::to_arrow_device(sliced);
+  EXPECT_EQ(array->array.children[0]->offset, 1);
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  cudf::test::expect_tables_equal(sliced, *result);
+}
+
+TEST_F(ArrowDeviceTest, ListsRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 2, 2, 5};
+  cudf::test::fixed_width_column_wrapper<int64_t> elements{1, 2, 3, 4, 5};
+  auto const lists = cudf::make_lists_column(3, offsets.release(), elements.release(), 0, {});
+  cudf::table_view const input{{lists->view()}};
+
+  auto const schema = cudf::to_arrow_schema(input);
+  EXPECT_EQ(std::string(schema->children[0]->format), "+l");
+  EXPECT_EQ(std::string(schema->children[0]->children[0]->format), "l");
+  auto const array  = cudf::to_arrow_device(input);
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+
+  cudf::lists_column_view const expected(input.column(0));
+  cudf::lists_column_view const actual(result->column(0));
+  cudf::test::expect_columns_equal(expected.offsets(), actual.offsets());
+  cudf::test::expect_columns_equal(expected.child(), actual.child());
+}
+
+TEST_F(ArrowDeviceTest, OwnedTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3}, {1, 0, 1});
+  cudf::table_view const expected{{ints}};
+  cudf::table input{expected};
+  auto const data = input.view().column(0).head();
+
+  auto const schema = cudf::to_arrow_schema(input.view());
+  auto array        = cudf::to_arrow_device(std::move(input));
+  auto const result = cudf::from_arrow_device(schema.get(), array.get());
+  EXPECT_EQ(result->column(0).head(), data);
+  cudf::test::expect_tables_equal(expected, *result);
+
+  // A consumer may release the array itself
+  array->array.release(&array->array);
+  EXPECT_EQ(array->array.release, nullptr);
+}
+
+TEST_F(ArrowDeviceTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<cudf::duration_D> days{1, 2};
+  cudf::table_view const input{{days}};
+  EXPECT_THROW(cudf::to_arrow_schema(input), cudf::logic_error);
+  EXPECT_THROW(cudf::to_arrow_device(input), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2};
+  cudf::table_view const valid{{ints}};
+  EXPECT_THROW(cudf::to_arrow_schema(valid, {"a", "b"}), cudf::logic_error);
+  auto const schema = cudf::to_arrow_schema(valid);
+  auto array        = cudf::to_arrow_device(valid);
+
+  array->device_type = ARROW_DEVICE_CPU;
+  EXPECT_THROW(cudf::from_arrow_device(schema.get(), array.get()), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/row_conversion.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <vector>
+
+struct RowConversionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RowConversionTest, Layout)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> bytes({1, 2}, {1, 0});
+  cudf::test::fixed_width_column_wrapper<double> doubles{3.0, 4.0};
+  cudf::table_view const input{{bytes, doubles}};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  cudf::lists_column_view const view(*rows.front());
+  EXPECT_EQ(view.size(), 2);
+  // INT8 at 0, FLOAT64 at 8, validity at 16, padded to 24 bytes
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_offsets{0, 24, 48};
+  cudf::test::expect_columns_equal(view.offsets(), expected_offsets);
+  EXPECT_EQ(view.child().size(), 48);
+}
+
+TEST_F(RowConversionTest, RoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> bytes({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int64_t> longs({10, 20, 30, 40, 50}, {1, 1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int16_t> shorts{-1, -2, -3, -4, -5};
+  cudf::test::fixed_width_column_wrapper<float> floats({1.5, 2.5, 3.5, 4.5, 5.5}, {0, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<bool> bools{true, false, true, false, true};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms> times{1, 2, 3, 4, 5};
+  cudf::table_view const input{{bytes, longs, shorts, floats, bools, times}};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : input) { schema.push_back(col.type()); }
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view(*rows.front()), schema);
+
+  cudf::test::expect_tables_equal(input, result->view());
+}
+
+TEST_F(RowConversionTest, ManyColumnsAndRows)
+{
+  auto const num_rows = 10000;
+  auto const iter     = thrust::make_counting_iterator(0);
+  auto const valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  std::vector<cudf::test::fixed_width_column_wrapper<int32_t>> wrappers;
+  std::vector<cudf::column_view> views;
+  for (int i = 0; i < 20; ++i) { wrappers.emplace_back(iter, iter + num_rows, valid); }
+  for (auto const& wrapper : wrappers) { views.push_back(wrapper); }
+  cudf::table_view const input{views};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  std::vector<cudf::data_type> schema(views.size(), cudf::data_type{cudf::type_id::INT32});
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view(*rows.front()), schema);
+
+  cudf::test::expect_tables_equal(input, result->view());
+}
+
+TEST_F(RowConversionTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{};
+  cudf::table_view const input{{ints}};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_EQ(rows.front()->size(), 0);
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view(*rows.front()),
+                                              {cudf::data_type{cudf::type_id::INT32}});
+  EXPECT_EQ(result->num_rows(), 0);
+}
+
+TEST_F(RowConversionTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings{"a", "b"};
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view{{strings}}), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2};
+  auto const rows = cudf::convert_to_rows(cudf::table_view{{ints}});
+  cudf::lists_column_view const view(*rows.front());
+  EXPECT_THROW(cudf::convert_from_rows(view, {cudf::data_type{cudf::type_id::STRING}}),
+               cudf::logic_error);
+  std::vector<cudf::data_type> const wide(3, cudf::data_type{cudf::type_id::INT64});
+  EXPECT_THROW(cudf::convert_from_rows(view, wide), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+using int32_wrapper   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int64_wrapper   = cudf::test::fixed_width_column_wrapper<int64_t>;
+using float64_wrapper = cudf::test::fixed_width_column_wrapper<double>;
+using strings_wrapper = cudf::test::strings_column_wrapper;
+
+// Base test fixture for tests
+struct AvroReaderTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// Appends the zigzag varint encoding of an Avro int or long
+void put_long(std::vector<uint8_t>& buf, int64_t value)
+{
+  auto u = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  for (; u >= 0x80; u >>= 7) { buf.push_back(static_cast<uint8_t>(u | 0x80)); }
+  buf.push_back(static_cast<uint8_t>(u));
+}
+
+void put_string(std::vector<uint8_t>& buf, std::string const& str)
+{
+  put_long(buf, str.size());
+  buf.insert(buf.end(), str.begin(), str.end());
+}
+
+void put_double(std::vector<uint8_t>& buf, double value)
+{
+  uint8_t bytes[sizeof(double)];
+  std::memcpy(bytes, &value, sizeof(double));
+  buf.insert(buf.end(), bytes, bytes + sizeof(double));
+}
+
+// Builds an uncompressed Avro file holding a single data block
+std::vector<uint8_t> make_avro_file(std::string const& schema,
+                                    int64_t num_rows,
+                                    std::vector<uint8_t> const& block_data)
+{
+  const std::vector<uint8_t> sync_marker{
+    0x5a, 0x1e, 0x7c, 0x03, 0x91, 0x6d, 0xb2, 0x48, 0xe5, 0x0f, 0x36, 0xc4, 0x8a, 0x27, 0xd9, 0x60};
+  std::vector<uint8_t> file{'O', 'b', 'j', 0x01};
+  put_long(file, 1);
+  put_string(file, "avro.schema");
+  put_string(file, schema);
+  put_long(file, 0);
+  file.insert(file.end(), sync_marker.begin(), sync_marker.end());
+  put_long(file, num_rows);
+  put_long(file, block_data.size());
+  file.insert(file.end(), block_data.begin(), block_data.end());
+  file.insert(file.end(), sync_marker.begin(), sync_marker.end());
+  return file;
+}
+
+cudf_io::read_avro_args make_read_args(std::vector<uint8_t> const& file)
+{
+  return cudf_io::read_avro_args{
+    cudf_io::source_info{reinterpret_cast<const char*>(file.data()), file.size()}};
+}
+}  // namespace
+
+TEST_F(AvroReaderTest, ArrayColumns)
+{
+  const std::string schema =
+    R"({"type": "record", "name": "root", "fields": [)"
+    R"({"name": "a", "type": {"type": "array", "items": "int"}},)"
+    R"({"name": "b", "type": ["null", {"type": "array", "items": ["null", "long"]}]},)"
+    R"({"name": "c", "type": "int"}]})";
+
+  std::vector<uint8_t> data;
+  // Row 0: a = [1, 2, 3], b = [10, null], c = 7
+  for (int64_t v : {3, 1, 2, 3, 0}) { put_long(data, v); }
+  for (int64_t v : {1, 2, 1, 10, 0, 0}) { put_long(data, v); }
+  put_long(data, 7);
+  // Row 1: a = [], b = null, c = 8
+  for (int64_t v : {0, 0, 8}) { put_long(data, v); }
+  // Row 2: a = [4, 5] in two blocks, the second one with its size in bytes, b = [], c = 9
+  for (int64_t v : {1, 4, -1, 1, 5, 0}) { put_long(data, v); }
+  for (int64_t v : {1, 0, 9}) { put_long(data, v); }
+  const auto file = make_avro_file(schema, 3, data);
+
+  auto result = cudf_io::read_avro(make_read_args(file));
+  ASSERT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+  EXPECT_EQ(result.metadata.column_names[1], "b");
+  EXPECT_EQ(result.metadata.column_names[2], "c");
+
+  const auto a = result.tbl->get_column(0).view();
+  ASSERT_EQ(a.type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.null_count(), 0);
+  cudf::test::expect_columns_equal(a.child(0), int32_wrapper{0, 3, 3, 5});
+  cudf::test::expect_columns_equal(a.child(1), int32_wrapper{1, 2, 3, 4, 5});
+
+  const auto b = result.tbl->get_column(1).view();
+  ASSERT_EQ(b.type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_EQ(b.null_count(), 1);
+  cudf::test::expect_columns_equal(b.child(0), int32_wrapper{0, 2, 2, 2});
+  cudf::test::expect_columns_equal(b.child(1), int64_wrapper({10, 0}, {1, 0}));
+
+  cudf::test::expect_columns_equal(result.tbl->get_column(2), int32_wrapper{7, 8, 9});
+
+  // Row ranges return the elements of the selected rows only
+  auto rows_args      = make_read_args(file);
+  rows_args.columns   = {"a"};
+  rows_args.skip_rows = 1;
+  rows_args.num_rows  = 2;
+  auto rows_result    = cudf_io::read_avro(rows_args);
+  ASSERT_EQ(rows_result.tbl->num_columns(), 1);
+  const auto rows_a = rows_result.tbl->get_column(0).view();
+  EXPECT_EQ(rows_a.size(), 2);
+  cudf::test::expect_columns_equal(rows_a.child(0), int32_wrapper{0, 0, 2});
+  cudf::test::expect_columns_equal(rows_a.child(1), int32_wrapper{4, 5});
+}
+
+TEST_F(AvroReaderTest, MapAndRecordArrayColumns)
+{
+  const std::string schema =
+    R"({"type": "record", "name": "root", "fields": [)"
+    R"({"name": "m", "type": {"type": "map", "values": "double"}},)"
+    R"({"name": "r", "type": {"type": "array", "items": {"type": "record", "name": "item",)"
+    R"( "fields": [{"name": "x", "type": "int"}, {"name": "y", "type": "string"}]}}}]})";
+
+  std::vector<uint8_t> data;
+  // Row 0: m = {"a": 1.5, "b": -2}, r = [{1, "p"}]
+  put_long(data, 2);
+  put_string(data, "a");
+  put_double(data, 1.5);
+  put_string(data, "b");
+  put_double(data, -2);
+  put_long(data, 0);
+  put_long(data, 1);
+  put_long(data, 1);
+  put_string(data, "p");
+  put_long(data, 0);
+  // Row 1: m = {}, r = [{2, "q"}, {3, ""}]
+  put_long(data, 0);
+  put_long(data, 2);
+  put_long(data, 2);
+  put_string(data, "q");
+  put_long(data, 3);
+  put_string(data, "");
+  put_long(data, 0);
+  const auto file = make_avro_file(schema, 2, data);
+
+  auto result = cudf_io::read_avro(make_read_args(file));
+  ASSERT_EQ(result.tbl->num_columns(), 4);
+  const std::vector<std::string> expected_names{"m.key", "m.value", "r.x", "r.y"};
+  EXPECT_EQ(result.metadata.column_names, expected_names);
+
+  // The keys and values of a map are lists with the same offsets
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(result.tbl->get_column(i).type().id(), cudf::type_id::LIST);
+    EXPECT_EQ(result.tbl->get_column(i).size(), 2);
+  }
+  const auto keys   = result.tbl->get_column(0).view();
+  const auto values = result.tbl->get_column(1).view();
+  cudf::test::expect_columns_equal(keys.child(0), int32_wrapper{0, 2, 2});
+  cudf::test::expect_columns_equal(keys.child(1), strings_wrapper{"a", "b"});
+  cudf::test::expect_columns_equal(values.child(0), int32_wrapper{0, 2, 2});
+  cudf::test::expect_columns_equal(values.child(1), float64_wrapper{1.5, -2});
+
+  const auto x = result.tbl->get_column(2).view();
+  const auto y = result.tbl->get_column(3).view();
+  cudf::test::expect_columns_equal(x.child(0), int32_wrapper{0, 1, 3});
+  cudf::test::expect_columns_equal(x.child(1), int32_wrapper{1, 2, 3});
+  cudf::test::expect_columns_equal(y.child(0), int32_wrapper{0, 1, 3});
+  cudf::test::expect_columns_equal(y.child(1), strings_wrapper{"p", "q", ""});
+
+  // A single map column can be selected by name
+  auto value_args    = make_read_args(file);
+  value_args.columns = {"m.value"};
+  auto value_result  = cudf_io::read_avro(value_args);
+  ASSERT_EQ(value_result.tbl->num_columns(), 1);
+  const auto selected = value_result.tbl->get_column(0).view();
+  cudf::test::expect_columns_equal(selected.child(0), int32_wrapper{0, 2, 2});
+  cudf::test::expect_columns_equal(selected.child(1), float64_wrapper{1.5, -2});
+}
+
+CUDF_TEST_PROGRAM_MAIN()
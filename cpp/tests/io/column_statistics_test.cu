@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table_view.hpp>
+
+namespace cudf_io = cudf::io;
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+struct ColumnStatisticsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ColumnStatisticsTest, IntegersWithNulls)
+{
+  column_wrapper<int32_t> col{{5, -3, 8, 1, 7, 2, 9, 4, 6, 0}, {1, 1, 0, 1, 0, 0, 0, 0, 1, 1}};
+  auto const stats = cudf_io::compute_column_statistics(cudf::table_view{{col}}, 4);
+  ASSERT_EQ(stats.size(), 1u);
+
+  // The second chunk has no valid values, so neither min/max nor sum
+  cudf::test::expect_columns_equal(*stats[0].null_count, column_wrapper<int32_t>{1, 4, 0});
+  cudf::test::expect_columns_equal(*stats[0].min, column_wrapper<int32_t>{{-3, 0, 0}, {1, 0, 1}});
+  cudf::test::expect_columns_equal(*stats[0].max, column_wrapper<int32_t>{{5, 0, 6}, {1, 0, 1}});
+  cudf::test::expect_columns_equal(*stats[0].sum, column_wrapper<int64_t>{{3, 0, 6}, {1, 0, 1}});
+}
+
+TEST_F(ColumnStatisticsTest, Strings)
+{
+  cudf::test::strings_column_wrapper col{{"pear", "apple", "fig", "", "kiwi"}, {1, 1, 1, 1, 0}};
+  auto const stats = cudf_io::compute_column_statistics(cudf::table_view{{col}}, 3);
+
+  cudf::test::expect_columns_equal(*stats[0].null_count, column_wrapper<int32_t>{0, 1});
+  cudf::test::expect_columns_equal(*stats[0].min, cudf::test::strings_column_wrapper{"apple", ""});
+  cudf::test::expect_columns_equal(*stats[0].max, cudf::test::strings_column_wrapper{"pear", ""});
+  cudf::test::expect_columns_equal(*stats[0].sum, column_wrapper<int64_t>{12, 0});
+}
+
+TEST_F(ColumnStatisticsTest, SlicedTimestamps)
+{
+  column_wrapper<cudf::timestamp_ms> col{{1000, 4000, 3000, 2000, 6000, 5000},
+                                         {1, 1, 1, 0, 1, 1}};
+  auto const sliced = cudf::slice(col, {1, 6})[0];
+  auto const stats  = cudf_io::compute_column_statistics(cudf::table_view{{sliced}}, 2);
+
+  // Timestamps keep their units
+  cudf::test::expect_columns_equal(*stats[0].null_count, column_wrapper<int32_t>{0, 1, 0});
+  cudf::test::expect_columns_equal(*stats[0].min,
+                                   column_wrapper<cudf::timestamp_ms>{3000, 6000, 5000});
+  cudf::test::expect_columns_equal(*stats[0].max,
+                                   column_wrapper<cudf::timestamp_ms>{4000, 6000, 5000});
+}
+
+CUDF_TEST_PROGRAM_MAIN()
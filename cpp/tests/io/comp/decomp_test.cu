@@ -15,8 +15,12 @@
  */
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
 #include <tests/utilities/base_fixture.hpp>
 
+#include <zlib.h>
+
+#include <string>
 #include <vector>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -123,6 +127,16 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for ZSTD decompression
+ **/
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  cudaError_t dispatch()
+  {
+    return cudf::io::gpu_unzstd(d_inf_args.data().get(), d_inf_stat.data().get(), 1);
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -171,4 +185,73 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(ZstdDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x0,  0x58, 0x59, 0x0,  0x0,  0x68,
+                                    0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+  EXPECT_EQ(inf_stat->status, 0u);
+}
+
+TEST_F(ZstdDecompressTest, RepeatedMatches)
+{
+  constexpr char uncompressed[]  = "Hello hello hello hello hello world, world, world, world!";
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x39, 0xb5, 0x0,  0x0,  0x70, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x20,
+    0x68, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x2c, 0x21, 0x2,  0x0,  0x2a, 0x74, 0x49, 0x5d, 0x8c};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+  EXPECT_EQ(inf_stat->status, 0u);
+}
+
+/**
+ * @brief Compresses the input into a single gzip member
+ **/
+std::vector<char> gzip_member(const std::string& input)
+{
+  z_stream strm{};
+  EXPECT_EQ(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + 15, 8, Z_DEFAULT_STRATEGY),
+            Z_OK);
+  std::vector<char> output(deflateBound(&strm, input.size()));
+  strm.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+  strm.avail_in  = input.size();
+  strm.next_out  = reinterpret_cast<Bytef*>(output.data());
+  strm.avail_out = output.size();
+  EXPECT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  output.resize(strm.total_out);
+  deflateEnd(&strm);
+  return output;
+}
+
+TEST(HostDecompressTest, GzipMultiMember)
+{
+  // Large enough for the members to be split between host threads
+  std::string expected;
+  std::vector<char> compressed;
+  uint32_t seed = 1;
+  for (int member = 0; member < 8; member++) {
+    std::string input;
+    for (int row = 0; row < 100000; row++) {
+      seed = seed * 1103515245 + 12345;
+      input += std::to_string(row) + "," + std::to_string(seed) + "\n";
+    }
+    auto gz = gzip_member(input);
+    compressed.insert(compressed.end(), gz.begin(), gz.end());
+    expected += input;
+  }
+
+  std::vector<char> output;
+  cudf::io::io_uncompress_single_h2d(
+    compressed.data(), compressed.size(), cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP, output);
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -722,6 +722,118 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, ByteRangeQuotedTerminator)
+{
+  // The first row of the range holds a quoted field with a terminator
+  std::string input = "1,\"a\nb\"\n2,c\n3,d\n";
+  cudf_io::read_csv_args in_args{cudf_io::source_info{input.c_str(), input.size()}};
+  in_args.names             = {"A", "B"};
+  in_args.dtype             = {"int32", "str"};
+  in_args.header            = -1;
+  in_args.byte_range_offset = 1;
+  auto result               = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  expect_column_data_equal(std::vector<int32_t>{2, 3}, view.column(0));
+  expect_column_data_equal(std::vector<std::string>{"c", "d"}, view.column(1));
+}
+
+TEST_F(CsvReaderTest, ChunkedReader)
+{
+  auto filepath = temp_env->get_temp_dir() + "ChunkedReader.csv";
+  std::vector<int64_t> expected_a;
+  std::vector<std::string> expected_b;
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "A,B\n";
+    // Quoted terminators make the rows straddle the chunks at different positions
+    for (int i = 0; i < 50; ++i) {
+      expected_a.push_back(i * 3);
+      expected_b.push_back("s" + std::to_string(i) + "\nt");
+      outfile << i * 3 << ",\"" << expected_b.back() << "\"\n";
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  cudf_io::chunked_csv_reader reader(in_args, 32);
+
+  std::vector<int64_t> values_a;
+  std::vector<std::string> values_b;
+  int num_chunks = 0;
+  while (reader.has_next()) {
+    auto result     = reader.read_chunk();
+    const auto view = result.tbl->view();
+    ASSERT_EQ(2, view.num_columns());
+    ASSERT_EQ(cudf::type_id::INT64, view.column(0).type().id());
+    ASSERT_EQ(cudf::type_id::STRING, view.column(1).type().id());
+    EXPECT_EQ(std::vector<std::string>({"A", "B"}), result.metadata.column_names);
+
+    auto const a = cudf::test::to_host<int64_t>(view.column(0)).first;
+    auto const b = cudf::test::to_host<std::string>(view.column(1)).first;
+    values_a.insert(values_a.end(), a.begin(), a.end());
+    values_b.insert(values_b.end(), b.begin(), b.end());
+    ++num_chunks;
+  }
+  EXPECT_GT(num_chunks, 1);
+  EXPECT_EQ(expected_a, values_a);
+  EXPECT_EQ(expected_b, values_b);
+  EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, SampledTypeInference)
+{
+  // Only the first column holds a value that does not fit the type inferred from the sample
+  std::string buffer = "A,B\n";
+  for (int i = 0; i < 10; ++i) {
+    buffer += ((i == 3) ? std::string{"3.5"} : std::to_string(i)) + "," + std::to_string(i * 2) +
+              "\n";
+  }
+  cudf_io::read_csv_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.infer_sample_rows = 2;
+  auto result               = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  ASSERT_EQ(cudf::type_id::FLOAT64, view.column(0).type().id());
+  ASSERT_EQ(cudf::type_id::INT64, view.column(1).type().id());
+
+  expect_column_data_equal(std::vector<double>{0, 1, 2, 3.5, 4, 5, 6, 7, 8, 9}, view.column(0));
+  expect_column_data_equal(std::vector<int64_t>{0, 2, 4, 6, 8, 10, 12, 14, 16, 18},
+                           view.column(1));
+}
+
+TEST_F(CsvReaderTest, FilteredRows)
+{
+  std::string buffer = "A,B,C\n";
+  for (int i = 0; i < 10; ++i) {
+    buffer += std::to_string(i) + "," + std::to_string(i * 0.5) + ",s" + std::to_string(i) + "\n";
+  }
+  cudf_io::read_csv_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.dtype   = {"int32", "float64", "str"};
+  in_args.filters = {
+    {"A", cudf_io::filter_op::GREATER_EQUAL, {cudf_io::filter_literal(3)}},
+    {"C",
+     cudf_io::filter_op::IN,
+     {cudf_io::filter_literal(std::string("s2")),
+      cudf_io::filter_literal(std::string("s4")),
+      cudf_io::filter_literal(std::string("s7"))}}};
+  auto result = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(3, view.num_columns());
+  expect_column_data_equal(std::vector<int32_t>{4, 7}, view.column(0));
+  expect_column_data_equal(std::vector<double>{2.0, 3.5}, view.column(1));
+  cudf::test::expect_columns_equal(view.column(2), cudf::test::strings_column_wrapper{"s4", "s7"});
+
+  in_args.filters = {{"A", cudf_io::filter_op::LESS, {cudf_io::filter_literal(0)}}};
+  result          = cudf_io::read_csv(in_args);
+  EXPECT_EQ(0, result.tbl->num_rows());
+
+  in_args.filters = {{"D", cudf_io::filter_op::EQUAL, {cudf_io::filter_literal(0)}}};
+  EXPECT_THROW(cudf_io::read_csv(in_args), cudf::logic_error);
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
@@ -1106,6 +1218,32 @@ TEST_F(CsvReaderTest, StringsWithWriterSimple)
   check_string_column(input_table.column(1), result_table.column(1));
 }
 
+TEST_F(CsvReaderTest, PartsWithWriter)
+{
+  constexpr auto num_rows = 50;
+
+  auto sequence   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto int_column = column_wrapper<int32_t>(sequence, sequence + num_rows);
+  cudf::table_view input_table(std::vector<cudf::column_view>{int_column});
+
+  // Several chunks per part, written while the next chunk is converted
+  std::vector<char> expected;
+  cudf_io::write_csv_args write_args{cudf_io::sink_info{&expected}, input_table, "null", false, 8};
+  cudf_io::write_csv(write_args);
+
+  std::vector<std::vector<char>> buffers(3);
+  std::vector<cudf_io::sink_info> sinks;
+  for (auto& buffer : buffers) { sinks.emplace_back(&buffer); }
+  cudf_io::write_csv_parts(write_args, sinks);
+
+  std::vector<char> combined;
+  for (auto const& buffer : buffers) {
+    EXPECT_FALSE(buffer.empty());
+    combined.insert(combined.end(), buffer.begin(), buffer.end());
+  }
+  EXPECT_EQ(expected, combined);
+}
+
 TEST_F(CsvReaderTest, EmptyFileWithWriter)
 {
   auto filepath = temp_env->get_temp_dir() + "EmptyFileWithWriter.csv";
@@ -546,4 +546,79 @@ TEST_F(JsonReaderTest, StringInference)
   EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::STRING);
 }
 
+TEST_F(JsonReaderTest, SampledTypeInference)
+{
+  // Only the first column holds a value that does not fit the type inferred from the sample
+  std::string buffer;
+  for (int i = 0; i < 10; ++i) {
+    buffer += "[" + ((i == 3) ? std::string{"3.5"} : std::to_string(i)) + ", " +
+              std::to_string(i * 2) + "]\n";
+  }
+  cudf_io::read_json_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.lines             = true;
+  in_args.infer_sample_rows = 2;
+  auto result               = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::FLOAT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::INT64);
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::expect_columns_equal(
+    result.tbl->get_column(0),
+    float64_wrapper{{0.0, 1.0, 2.0, 3.5, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0}, validity});
+  cudf::test::expect_columns_equal(
+    result.tbl->get_column(1), int64_wrapper{{0, 2, 4, 6, 8, 10, 12, 14, 16, 18}, validity});
+}
+
+TEST_F(JsonReaderTest, NestedObjectsAndArrays)
+{
+  std::string buffer =
+    "{\"a\": 1, \"b\": {\"c\": 2.5, \"d\": {\"e\": \"x,y\"}}, \"f\": [1, [2, 3]]}\n"
+    "{\"a\": 2, \"b\": {\"c\": 3.5, \"d\": {\"e\": \"z\"}}, \"f\": [4]}\n";
+  cudf_io::read_json_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.lines = true;
+  auto result   = cudf_io::read_json(in_args);
+
+  // Nested objects are flattened, and arrays are read as strings
+  ASSERT_EQ(result.tbl->num_columns(), 4);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+  EXPECT_EQ(result.metadata.column_names[1], "b.c");
+  EXPECT_EQ(result.metadata.column_names[2], "b.d.e");
+  EXPECT_EQ(result.metadata.column_names[3], "f");
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), int64_wrapper{{1, 2}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(1),
+                                   float64_wrapper{{2.5, 3.5}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(2),
+                                   cudf::test::strings_column_wrapper({"x,y", "z"}));
+  cudf::test::expect_columns_equal(result.tbl->get_column(3),
+                                   cudf::test::strings_column_wrapper({"[1, [2, 3]]", "[4]"}));
+}
+
+TEST_F(JsonReaderTest, UseCols)
+{
+  std::string buffer =
+    "{\"a\": 1, \"b\": \"x\", \"c\": 1.5, \"d\": true}\n"
+    "{\"a\": 2, \"b\": \"y\", \"c\": 2.5, \"d\": false}\n";
+  cudf_io::read_json_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.lines    = true;
+  in_args.use_cols = {"c", "a"};
+  auto result      = cudf_io::read_json(in_args);
+
+  // Columns are returned in their order in the data
+  ASSERT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+  EXPECT_EQ(result.metadata.column_names[1], "c");
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), int64_wrapper{{1, 2}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(1),
+                                   float64_wrapper{{1.5, 2.5}, validity});
+
+  in_args.use_cols = {"e"};
+  EXPECT_THROW(cudf_io::read_json(in_args), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,9 @@
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -112,6 +115,10 @@ struct OrcChunkedWriterNumericTypeTest : public OrcChunkedWriterTest {
 // Declare typed test cases
 TYPED_TEST_CASE(OrcChunkedWriterNumericTypeTest, SupportedTypes);
 
+// Base test fixture for chunked reader tests
+struct OrcChunkedReaderTest : public cudf::test::BaseFixture {
+};
+
 namespace {
 // Generates a vector of uniform random values of type T
 template <typename T>
@@ -359,6 +366,41 @@ TEST_F(OrcWriterTest, MultiColumnWithNulls)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, NegativeShortsAndNonCanonicalBools)
+{
+  constexpr auto num_rows = 1000;
+
+  // Shorts over the whole int16 range, most of them negative
+  auto shorts = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int16_t>((i * 7919) % 65536 - 32768); });
+  auto shorts_mask =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i % 7 != 0); });
+  column_wrapper<int16_t> col0{shorts, shorts + num_rows, shorts_mask};
+
+  // Bool8 values other than 0 and 1 are true
+  auto bytes = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<uint8_t>(i * 37); });
+  auto bools = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<uint8_t>(i * 37) != 0; });
+  column_wrapper<uint8_t> bytes_col{bytes, bytes + num_rows};
+  column_wrapper<bool> expected_bools{bools, bools + num_rows};
+  auto const bytes_view = static_cast<cudf::column_view>(bytes_col);
+  cudf::column_view col1{
+    cudf::data_type{cudf::type_id::BOOL8}, num_rows, bytes_view.data<uint8_t>()};
+
+  auto filepath = temp_env->get_temp_filepath("OrcNegativeShortsAndNonCanonicalBools.orc");
+  cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, table_view{{col0, col1}}};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  in_args.use_index = false;
+  auto result       = cudf_io::read_orc(in_args);
+
+  ASSERT_EQ(2, result.tbl->num_columns());
+  cudf::test::expect_columns_equal(col0, result.tbl->get_column(0));
+  cudf::test::expect_columns_equal(expected_bools, result.tbl->get_column(1));
+}
+
 TEST_F(OrcWriterTest, Strings)
 {
   std::vector<const char*> strings{
@@ -427,6 +469,40 @@ TEST_F(OrcWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, Compression)
+{
+  constexpr auto num_rows = 10000;
+  auto col1_data = random_values<double>(num_rows);
+  auto sequence  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i / 8; });
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 37, 'a' + i % 26); });
+  auto validity  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<int> col0(sequence, sequence + num_rows, validity);
+  column_wrapper<double> col1(col1_data.begin(), col1_data.end(), validity);
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, validity);
+  cudf::table_view expected({col0, col1, col2});
+
+  auto write_table = [&](cudf_io::compression_type compression, int level) {
+    std::vector<char> out_buffer;
+    cudf_io::write_orc_args out_args{
+      cudf_io::sink_info(&out_buffer), expected, nullptr, compression};
+    out_args.compression_level = level;
+    cudf_io::write_orc(out_args);
+
+    cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    in_args.use_index = false;
+    const auto result = cudf_io::read_orc(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  auto uncompressed_size = write_table(cudf_io::compression_type::NONE, 0);
+  for (auto compression : {cudf_io::compression_type::DEFLATE, cudf_io::compression_type::ZSTD}) {
+    for (int level : {0, 1, 9}) { EXPECT_LT(write_table(compression, level), uncompressed_size); }
+  }
+}
+
 TEST_F(OrcChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -613,6 +689,252 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, ReadStripesWithFilters)
+{
+  constexpr auto num_rows = 1000;
+  auto low_values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto high_values =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 5000; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(1, 'a' + i % 26); });
+  column_wrapper<int> col0_low(low_values, low_values + num_rows);
+  column_wrapper<int> col0_high(high_values, high_values + num_rows);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows);
+  cudf::table_view table1({col0_low, col1});
+  cudf::table_view table2({col0_high, col1});
+
+  // Each chunk is written as a separate stripe with its own statistics
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripesFilters.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(table1, state);
+  cudf_io::write_orc_chunked(table2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  auto read_filtered = [&](cudf_io::column_filter const& filter) {
+    cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+    read_args.filters = {filter};
+    return cudf_io::read_orc(read_args);
+  };
+
+  auto result = read_filtered(
+    {"_col0", cudf_io::filter_op::GREATER_EQUAL, {cudf_io::filter_literal(int32_t{5000})}});
+  expect_tables_equal(*result.tbl, table2);
+
+  result = read_filtered(
+    {"_col0", cudf_io::filter_op::IN, {cudf_io::filter_literal(3), cudf_io::filter_literal(7)}});
+  expect_tables_equal(*result.tbl, table1);
+
+  result = read_filtered(
+    {"_col1", cudf_io::filter_op::LESS, {cudf_io::filter_literal(std::string("a"))}});
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.filters = {{"missing", cudf_io::filter_op::EQUAL, {cudf_io::filter_literal(0)}}};
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+}
+
+TEST_F(OrcChunkedWriterTest, ReadStripesLateMaterialization)
+{
+  constexpr auto num_rows = 1000;
+  auto low_values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto high_values =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 5000; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(1, 'a' + i % 26); });
+  column_wrapper<int> col0_low(low_values, low_values + num_rows);
+  column_wrapper<int> col0_high(high_values, high_values + num_rows);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows);
+  cudf::table_view table1({col0_low, col1});
+  cudf::table_view table2({col0_high, col1});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripesLateMaterialization.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(table1, state);
+  cudf_io::write_orc_chunked(table2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  // Only the rows of the second stripe matching both filters are returned
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.late_materialization = true;
+
+  read_args.filters = {
+    {"_col0", cudf_io::filter_op::GREATER_EQUAL, {cudf_io::filter_literal(int32_t{5100})}},
+    {"_col1", cudf_io::filter_op::EQUAL, {cudf_io::filter_literal(std::string("c"))}}};
+  auto result = cudf_io::read_orc(read_args);
+
+  // Rows 106, 132, ..., 990 of the second stripe
+  constexpr auto num_expected = 35;
+  auto expected_values =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return 5106 + 26 * i; });
+  column_wrapper<int> expected_col0(expected_values, expected_values + num_expected);
+  std::vector<std::string> expected_strings(num_expected, "c");
+  cudf::test::strings_column_wrapper expected_col1(expected_strings.begin(),
+                                                   expected_strings.end());
+  expect_tables_equal(*result.tbl, cudf::table_view{{expected_col0, expected_col1}});
+
+  read_args.columns = {"_col0"};
+  result            = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, cudf::table_view{{expected_col0}});
+}
+
+TEST_F(OrcChunkedWriterTest, ReadMetadata)
+{
+  constexpr auto num_rows = 1000;
+  auto low_values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto high_values =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 5000; });
+  column_wrapper<int> col0_low(low_values, low_values + num_rows);
+  column_wrapper<int> col0_high(high_values, high_values + num_rows);
+  cudf::table_view table1({col0_low});
+  cudf::table_view table2({col0_high});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadMetadata.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(table1, state);
+  cudf_io::write_orc_chunked(table2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  auto result = cudf_io::read_orc_metadata({cudf_io::source_info{filepath}});
+  ASSERT_EQ(result.size(), 1u);
+  EXPECT_EQ(result[0].num_rows, 2 * num_rows);
+  EXPECT_EQ(result[0].column_names, (std::vector<std::string>{"_col0"}));
+  EXPECT_EQ(result[0].column_types[0].id(), cudf::type_id::INT32);
+  ASSERT_EQ(result[0].row_groups.size(), 2u);
+
+  auto const& stripe = result[0].row_groups[1];
+  EXPECT_EQ(stripe.num_rows, num_rows);
+  EXPECT_GT(stripe.byte_size, 0);
+  ASSERT_EQ(stripe.columns.size(), 1u);
+  EXPECT_EQ(stripe.columns[0].null_count, 0);
+  ASSERT_TRUE(stripe.columns[0].has_minmax);
+  EXPECT_EQ(stripe.columns[0].min_value.int_value, 5000);
+  EXPECT_EQ(stripe.columns[0].max_value.int_value, 5000 + num_rows - 1);
+}
+
+TEST_F(OrcChunkedWriterTest, ReadStringsToDictionary)
+{
+  std::vector<const char*> h_strings1{"alpha", "beta", "gamma"};
+  std::vector<const char*> h_strings2{"delta", "beta", "alpha"};
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto strings1 = cudf::test::make_counting_transform_iterator(
+    0, [&h_strings1](auto i) { return h_strings1[i % h_strings1.size()]; });
+  auto strings2 = cudf::test::make_counting_transform_iterator(
+    0, [&h_strings2](auto i) { return h_strings2[i % h_strings2.size()]; });
+
+  // Each stripe has its own dictionary, with some strings in common
+  cudf::test::strings_column_wrapper col1(strings1, strings1 + 1000, valids);
+  cudf::test::strings_column_wrapper col2(strings2, strings2 + 1500, valids);
+  cudf::table_view tbl1({col1});
+  cudf::table_view tbl2({col2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStringsToDictionary.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(tbl1, state);
+  cudf_io::write_orc_chunked(tbl2, state);
+  cudf_io::write_orc_chunked_end(state);
+  auto expected = cudf::concatenate({tbl1, tbl2});
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.strings_to_dictionary = true;
+  auto result                     = cudf_io::read_orc(read_args);
+
+  ASSERT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::DICTIONARY32);
+  cudf::dictionary_column_view dictionary(result.tbl->get_column(0));
+  cudf::test::strings_column_wrapper expected_keys({"alpha", "beta", "delta", "gamma"});
+  cudf::test::expect_columns_equal(dictionary.keys(), expected_keys);
+  auto decoded = cudf::dictionary::decode(dictionary);
+  cudf::test::expect_columns_equal(*decoded, expected->get_column(0));
+
+  // Rows spanning both stripes
+  cudf_io::read_orc_args rows_args{cudf_io::source_info{filepath}};
+  rows_args.strings_to_dictionary = true;
+  rows_args.skip_rows             = 900;
+  rows_args.num_rows              = 200;
+  auto rows_result                = cudf_io::read_orc(rows_args);
+  auto rows_decoded =
+    cudf::dictionary::decode(cudf::dictionary_column_view(rows_result.tbl->get_column(0)));
+  auto rows_expected = cudf::slice(expected->get_column(0), {900, 1100});
+  cudf::test::expect_columns_equal(*rows_decoded, rows_expected[0]);
+}
+
+TEST_F(OrcChunkedWriterTest, ReadWithMetadataCache)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedMetadataCache.orc");
+  auto write    = [&](std::vector<table_view> const& tables) {
+    cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+    auto state = cudf_io::write_orc_chunked_begin(args);
+    for (auto const& table : tables) { cudf_io::write_orc_chunked(table, state); }
+    cudf_io::write_orc_chunked_end(state);
+  };
+  write({*table1, *table2});
+
+  // The second read uses the cached stripe footers
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.cache_metadata = true;
+  auto result              = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*table1, *table2}));
+  read_args.stripe_list = {1, 0};
+  result                = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*table2, *table1}));
+
+  // A modified file is parsed again
+  write({*table2, *table1, *table2});
+  read_args.stripe_list.clear();
+  result = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*table2, *table1, *table2}));
+}
+
+TEST_F(OrcChunkedWriterTest, BufferedTables)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<table_view> table_views;
+  for (int i = 0; i < 10; ++i) {
+    tables.push_back(create_random_fixed_table<int>(3, 1000, true));
+    table_views.push_back(*tables.back());
+  }
+  auto full_table = cudf::concatenate(table_views);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedBufferedTables.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  args.stripe_size_rows = 5000;
+  args.row_index_stride = 1000;
+  args.buffer_tables    = true;
+  auto state            = cudf_io::write_orc_chunked_begin(args);
+  for (auto const& table : table_views) { cudf_io::write_orc_chunked(table, state); }
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *full_table);
+
+  // Every five tables fill a stripe
+  read_args.stripe = 1;
+  result           = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, cudf::slice(*full_table, {5000, 10000})[0]);
+  read_args.stripe = 2;
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+}
+
+TEST_F(OrcChunkedWriterTest, InvalidStripeSizes)
+{
+  auto filepath = temp_env->get_temp_filepath("ChunkedInvalidStripeSizes.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  args.row_index_stride = 1001;
+  EXPECT_THROW(cudf_io::write_orc_chunked_begin(args), cudf::logic_error);
+  args.row_index_stride  = 10000;
+  args.stripe_size_bytes = 1024;
+  EXPECT_THROW(cudf_io::write_orc_chunked_begin(args), cudf::logic_error);
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -709,4 +1031,97 @@ TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize2)
   expect_tables_equal(*result.tbl, *expected);
 }
 
+namespace {
+// Writes one stripe per table and returns the tables
+std::vector<std::unique_ptr<cudf::table>> write_stripes(std::string const& filepath,
+                                                        int num_stripes)
+{
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  for (int i = 0; i < num_stripes; ++i) {
+    tables.push_back(create_random_fixed_table<int>(3, 1000, true));
+    cudf_io::write_orc_chunked(*tables.back(), state);
+  }
+  cudf_io::write_orc_chunked_end(state);
+  return tables;
+}
+
+std::unique_ptr<cudf::table> read_all_chunks(cudf_io::read_orc_args const& args,
+                                             size_t chunk_read_limit,
+                                             int* num_chunks)
+{
+  cudf_io::chunked_orc_reader reader(args, chunk_read_limit);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  std::vector<table_view> chunk_views;
+  while (reader.has_next()) {
+    chunks.push_back(reader.read_chunk().tbl);
+    chunk_views.push_back(*chunks.back());
+  }
+  *num_chunks = chunks.size();
+  return cudf::concatenate(chunk_views);
+}
+
+}  // namespace
+
+TEST_F(OrcChunkedReaderTest, SingleChunk)
+{
+  srand(31337);
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadSingle.orc");
+  auto tables   = write_stripes(filepath, 3);
+  auto expected = cudf::concatenate({*tables[0], *tables[1], *tables[2]});
+
+  int num_chunks = 0;
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  auto result = read_all_chunks(in_args, 0, &num_chunks);
+
+  EXPECT_EQ(num_chunks, 1);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(OrcChunkedReaderTest, ChunkPerStripe)
+{
+  srand(31337);
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadStripes.orc");
+  auto tables   = write_stripes(filepath, 3);
+  auto expected = cudf::concatenate({*tables[0], *tables[1], *tables[2]});
+
+  // Stripes are never split, even when the limit is smaller than a stripe
+  int num_chunks = 0;
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  auto result = read_all_chunks(in_args, 1, &num_chunks);
+
+  EXPECT_EQ(num_chunks, 3);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(OrcChunkedReaderTest, SkipRows)
+{
+  srand(31337);
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadSkipRows.orc");
+  auto tables   = write_stripes(filepath, 3);
+  auto full     = cudf::concatenate({*tables[0], *tables[1], *tables[2]});
+  auto expected = cudf::slice(*full, {500, 2200})[0];
+
+  int num_chunks = 0;
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  in_args.skip_rows = 500;
+  in_args.num_rows  = 1700;
+  auto result       = read_all_chunks(in_args, 1, &num_chunks);
+
+  EXPECT_EQ(num_chunks, 3);
+  expect_tables_equal(*result, expected);
+}
+
+TEST_F(OrcChunkedReaderTest, StripeSelection)
+{
+  srand(31337);
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadStripeSelection.orc");
+  write_stripes(filepath, 1);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  in_args.stripe_list = {0};
+  EXPECT_THROW(cudf_io::chunked_orc_reader(in_args, 0), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -20,15 +20,27 @@
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <io/parquet/parquet.h>
+
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <rmm/device_buffer.hpp>
+
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <future>
+#include <thread>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -134,6 +146,14 @@ struct ParquetChunkedWriterNumericTypeTest : public ParquetChunkedWriterTest {
 // Declare typed test cases
 TYPED_TEST_CASE(ParquetChunkedWriterNumericTypeTest, SupportedTypes);
 
+// Base test fixture for reader tests
+struct ParquetReaderTest : public cudf::test::BaseFixture {
+};
+
+// Base test fixture for chunked reader tests
+struct ParquetChunkedReaderTest : public cudf::test::BaseFixture {
+};
+
 namespace {
 // Generates a vector of uniform random values of type T
 template <typename T>
@@ -504,6 +524,139 @@ TEST_F(ParquetWriterTest, NonNullable)
   expect_tables_equal(*result.tbl, *expected);
 }
 
+TEST_F(ParquetWriterTest, DictionaryPolicy)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto low_cardinality =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto unique = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int> col0(low_cardinality, low_cardinality + num_rows);
+  column_wrapper<int> col1(unique, unique + num_rows);
+  cudf::table_view expected({col0, col1});
+
+  auto write_with_policy = [&](std::vector<cudf_io::dictionary_policy> policies) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{
+      cudf_io::sink_info(&out_buffer), expected, nullptr, cudf_io::compression_type::NONE};
+    out_args.column_dictionary_policy = std::move(policies);
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_parquet(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  // The adaptive policy only uses a dictionary for the low-cardinality column
+  const auto adaptive_size = write_with_policy({});
+  const auto never_size =
+    write_with_policy({cudf_io::dictionary_policy::NEVER, cudf_io::dictionary_policy::NEVER});
+  const auto always_size =
+    write_with_policy({cudf_io::dictionary_policy::ALWAYS, cudf_io::dictionary_policy::ALWAYS});
+  EXPECT_LT(adaptive_size, never_size);
+  EXPECT_LT(adaptive_size, always_size);
+}
+
+TEST_F(ParquetWriterTest, DeltaEncoding)
+{
+  constexpr auto num_rows = 10000;
+  auto sorted    = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto col1_data = random_values<int64_t>(num_rows);
+  auto col2_data = random_values<int16_t>(num_rows);
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 37, 'a' + i % 26); });
+  auto validity  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<int> col0(sorted, sorted + num_rows, validity);
+  column_wrapper<int64_t> col1(col1_data.begin(), col1_data.end());
+  column_wrapper<int16_t> col2(col2_data.begin(), col2_data.end(), validity);
+  cudf::test::strings_column_wrapper col3(strings, strings + num_rows, validity);
+  cudf::table_view expected({col0, col1, col2, col3});
+
+  auto write_table = [&](cudf::table_view const& table, bool use_delta_encoding) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{
+      cudf_io::sink_info(&out_buffer), table, nullptr, cudf_io::compression_type::NONE};
+    out_args.column_dictionary_policy = std::vector<cudf_io::dictionary_policy>(
+      table.num_columns(), cudf_io::dictionary_policy::NEVER);
+    out_args.use_delta_encoding = use_delta_encoding;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_parquet(in_args);
+    expect_tables_equal(table, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  write_table(expected, true);
+  // Sorted values are stored in a few bits per value
+  cudf::table_view sorted_table({col0});
+  EXPECT_LT(write_table(sorted_table, true) * 4, write_table(sorted_table, false));
+}
+
+TEST_F(ParquetWriterTest, Compression)
+{
+  constexpr auto num_rows = 10000;
+  auto col1_data = random_values<double>(num_rows);
+  auto sequence  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i / 8; });
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 37, 'a' + i % 26); });
+  auto validity  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<int> col0(sequence, sequence + num_rows, validity);
+  column_wrapper<double> col1(col1_data.begin(), col1_data.end(), validity);
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, validity);
+  cudf::table_view expected({col0, col1, col2});
+
+  auto write_table = [&](cudf_io::compression_type compression, int level) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{
+      cudf_io::sink_info(&out_buffer), expected, nullptr, compression};
+    out_args.compression_level = level;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_parquet(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  auto uncompressed_size = write_table(cudf_io::compression_type::NONE, 0);
+  for (auto compression : {cudf_io::compression_type::GZIP, cudf_io::compression_type::ZSTD}) {
+    for (int level : {0, 1, 9}) { EXPECT_LT(write_table(compression, level), uncompressed_size); }
+  }
+}
+
+TEST_F(ParquetWriterTest, BloomFilters)
+{
+  constexpr auto num_rows = 10000;
+  auto col0_data = random_values<int32_t>(num_rows);
+  auto col1_data = random_values<double>(num_rows);
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 13, 'a' + i % 26); });
+  auto validity  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int32_t> col0(col0_data.begin(), col0_data.end(), validity);
+  column_wrapper<double> col1(col1_data.begin(), col1_data.end());
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, validity);
+  cudf::table_view expected({col0, col1, col2});
+
+  auto write_table = [&](bool write_bloom_filters) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer), expected};
+    out_args.write_bloom_filters = write_bloom_filters;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_parquet(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  // Each of the three column chunks carries at least a 32-byte filter
+  EXPECT_GE(write_table(true), write_table(false) + 3 * 32);
+}
+
 // custom data sink that supports device writes. uses plain file io.
 class custom_test_data_sink : public cudf::io::data_sink {
  public:
@@ -594,6 +747,87 @@ TEST_F(ParquetWriterTest, DeviceWriteLargeishFile)
   expect_tables_equal(custom_tbl.tbl->view(), expected->view());
 }
 
+TEST_F(ParquetWriterTest, SeveralBatches)
+{
+  // Three row groups of 1M rows, each encoded in its own batch
+  constexpr auto num_rows = 3 * 1000 * 1000;
+  auto sequence =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return int64_t{i} * 3 - i % 11; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 7, 'a' + i % 26); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 13; });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows, validity);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows);
+  cudf::table_view expected({col0, col1});
+
+  for (auto compression : {cudf_io::compression_type::NONE, cudf_io::compression_type::AUTO}) {
+    std::vector<char> out_buffer;
+    cudf_io::write_parquet_args out_args{
+      cudf_io::sink_info(&out_buffer), expected, nullptr, compression};
+    out_args.max_batch_size = 1;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_parquet(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+  }
+
+  // Batches written with device writes
+  auto filepath = temp_env->get_temp_filepath("SeveralBatches.parquet");
+  custom_test_data_sink custom_sink(filepath);
+  cudf_io::write_parquet_args args{cudf_io::sink_info{&custom_sink}, expected};
+  args.max_batch_size = 1;
+  cudf_io::write_parquet(args);
+
+  cudf_io::read_parquet_args custom_args{cudf_io::source_info{filepath}};
+  auto custom_tbl = cudf_io::read_parquet(custom_args);
+  expect_tables_equal(expected, custom_tbl.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, DeviceBufferSink)
+{
+  namespace cudf_io = cudf::io;
+
+  // exercises multiple rowgroups, growing the buffer several times
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 2 * 1024 * 1024, true);
+
+  rmm::device_buffer device_sink;
+  cudf_io::write_parquet_args args{cudf_io::sink_info{&device_sink}, *expected};
+  cudf_io::write_parquet(args);
+
+  std::vector<char> host_buf(device_sink.size());
+  CUDA_TRY(cudaMemcpy(
+    host_buf.data(), device_sink.data(), device_sink.size(), cudaMemcpyDeviceToHost));
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{host_buf.data(), host_buf.size()}};
+  auto result = cudf_io::read_parquet(read_args);
+  expect_tables_equal(result.tbl->view(), expected->view());
+}
+
+TEST_F(ParquetWriterTest, FixedHostBufferSink)
+{
+  namespace cudf_io = cudf::io;
+
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 64 * 1024, true);
+
+  std::vector<char> host_buf(8 * 1024 * 1024);
+  auto sink = cudf_io::data_sink::create(host_buf.data(), host_buf.size());
+  cudf_io::write_parquet_args args{cudf_io::sink_info{sink.get()}, *expected};
+  cudf_io::write_parquet(args);
+  ASSERT_GT(sink->bytes_written(), 0u);
+
+  cudf_io::read_parquet_args read_args{
+    cudf_io::source_info{host_buf.data(), sink->bytes_written()}};
+  auto result = cudf_io::read_parquet(read_args);
+  expect_tables_equal(result.tbl->view(), expected->view());
+
+  // Writes past the end of the memory fail
+  auto small_sink = cudf_io::data_sink::create(host_buf.data(), 16);
+  cudf_io::write_parquet_args small_args{cudf_io::sink_info{small_sink.get()}, *expected};
+  EXPECT_THROW(cudf_io::write_parquet(small_args), cudf::logic_error);
+}
+
 TEST_F(ParquetChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -912,6 +1146,957 @@ class custom_test_memmap_sink : public cudf::io::data_sink {
   std::unique_ptr<data_sink> mm_writer;
 };
 
+namespace {
+// Reads all the chunks of a file and concatenates them into a single table
+std::unique_ptr<cudf::table> read_all_chunks(cudf_io::read_parquet_args const& args,
+                                             size_t chunk_read_limit,
+                                             int* num_chunks)
+{
+  cudf_io::chunked_parquet_reader reader(args, chunk_read_limit);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  std::vector<table_view> chunk_views;
+  while (reader.has_next()) {
+    chunks.push_back(reader.read_chunk().tbl);
+    chunk_views.push_back(*chunks.back());
+  }
+  *num_chunks = chunks.size();
+  return cudf::concatenate(chunk_views);
+}
+
+}  // namespace
+
+TEST_F(ParquetChunkedReaderTest, SingleChunk)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 1000, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadSingle.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  cudf_io::write_parquet(out_args);
+
+  int num_chunks = 0;
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = read_all_chunks(in_args, 0, &num_chunks);
+
+  EXPECT_EQ(num_chunks, 1);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, RowGroups)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<table>> tables;
+  std::vector<table_view> table_views;
+  for (int idx = 0; idx < 8; idx++) {
+    tables.push_back(create_random_fixed_table<int>(4, 1000, true));
+    table_views.push_back(*tables.back());
+  }
+  auto expected = cudf::concatenate(table_views);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadRowGroups.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& tbl : table_views) { cudf_io::write_parquet_chunked(tbl, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  // Roughly two row groups of output per chunk
+  int num_chunks = 0;
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = read_all_chunks(in_args, 2 * 4 * 1000 * (sizeof(int) * 3), &num_chunks);
+
+  EXPECT_GT(num_chunks, 1);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, SplitRowGroup)
+{
+  std::vector<const char*> h_strings{"four", "score", "and", "seven", "years", "ago", "abcdefgh"};
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [&h_strings](auto i) { return h_strings[i % h_strings.size()]; });
+  auto valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+
+  constexpr auto num_rows = 100000;
+  cudf::test::strings_column_wrapper col0(strings, strings + num_rows, valids);
+  column_wrapper<int64_t> col1(sequence, sequence + num_rows, valids);
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadSplitRowGroup.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  out_args.compression = cudf_io::compression_type::SNAPPY;
+  cudf_io::write_parquet(out_args);
+
+  int num_chunks = 0;
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = read_all_chunks(in_args, 256 * 1024, &num_chunks);
+
+  EXPECT_GT(num_chunks, 1);
+  expect_tables_equal(*result, *expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, SkipRows)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(2, 1000, true);
+  auto table2 = create_random_fixed_table<int>(2, 1000, true);
+  auto full_table = cudf::concatenate({*table1, *table2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadSkipRows.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(*table1, state);
+  cudf_io::write_parquet_chunked(*table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  int num_chunks = 0;
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.skip_rows = 500;
+  in_args.num_rows  = 1000;
+  auto result       = read_all_chunks(in_args, 1024, &num_chunks);
+
+  auto expected = cudf::slice(*full_table, {500, 1500});
+  EXPECT_GT(num_chunks, 1);
+  expect_tables_equal(*result, expected[0]);
+}
+
+TEST_F(ParquetChunkedReaderTest, RowGroupSelectionError)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(2, 10, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadRowGroupError.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.row_group_list = {0};
+  EXPECT_THROW(cudf_io::chunked_parquet_reader(in_args, 0), cudf::logic_error);
+}
+
+namespace {
+// Writes one row group per table, the i-th row group holding the values [100 * i, 100 * i + 99]
+std::vector<std::unique_ptr<cudf::table>> write_sequence_row_groups(std::string const& filepath,
+                                                                    int num_row_groups)
+{
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (int rg = 0; rg < num_row_groups; ++rg) {
+    auto values = cudf::test::make_counting_transform_iterator(
+      0, [rg](auto i) { return static_cast<int64_t>(rg * 100 + i); });
+    auto strings = cudf::test::make_counting_transform_iterator(
+      0, [rg](auto i) { return std::string(1, static_cast<char>('a' + rg)); });
+    column_wrapper<int64_t> col0(values, values + 100);
+    cudf::test::strings_column_wrapper col1(strings, strings + 100);
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+    cudf_io::write_parquet_chunked(*tables.back(), state);
+  }
+  cudf_io::write_parquet_chunked_end(state);
+  return tables;
+}
+
+}  // namespace
+
+TEST_F(ParquetReaderTest, FilterRange)
+{
+  auto filepath = temp_env->get_temp_filepath("FilterRange.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 8);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.filters = {cudf_io::column_filter{"_col0",
+                                            cudf_io::filter_op::GREATER_EQUAL,
+                                            {cudf_io::filter_literal{550}}},
+                     cudf_io::column_filter{
+                       "_col0", cudf_io::filter_op::LESS, {cudf_io::filter_literal{700}}}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  auto expected = cudf::concatenate({*tables[5], *tables[6]});
+  expect_tables_equal(*result.tbl, *expected);
+}
+
+TEST_F(ParquetReaderTest, FilterIn)
+{
+  auto filepath = temp_env->get_temp_filepath("FilterIn.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 8);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.filters = {cudf_io::column_filter{
+    "_col0",
+    cudf_io::filter_op::IN,
+    {cudf_io::filter_literal{10}, cudf_io::filter_literal{350}, cudf_io::filter_literal{5000}}}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  auto expected = cudf::concatenate({*tables[0], *tables[3]});
+  expect_tables_equal(*result.tbl, *expected);
+}
+
+TEST_F(ParquetReaderTest, FilterStrings)
+{
+  auto filepath = temp_env->get_temp_filepath("FilterStrings.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 4);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.filters = {cudf_io::column_filter{
+    "_col1", cudf_io::filter_op::EQUAL, {cudf_io::filter_literal{std::string("c")}}}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(*result.tbl, *tables[2]);
+}
+
+TEST_F(ParquetReaderTest, MemoryEstimate)
+{
+  auto filepath = temp_env->get_temp_filepath("MemoryEstimate.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 8);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto const full_estimate = cudf_io::estimate_read_parquet_memory(in_args);
+  // At least the decoded values of 800 rows
+  EXPECT_GE(full_estimate, 800 * sizeof(int64_t));
+
+  // The estimate follows the row group selection, also through the filters
+  in_args.row_group_list   = {0, 1};
+  auto const list_estimate = cudf_io::estimate_read_parquet_memory(in_args);
+  EXPECT_LT(list_estimate, full_estimate);
+
+  in_args.row_group_list.clear();
+  in_args.filters = {cudf_io::column_filter{
+    "_col0", cudf_io::filter_op::LESS, {cudf_io::filter_literal{200}}}};
+  EXPECT_EQ(cudf_io::estimate_read_parquet_memory(in_args), list_estimate);
+}
+
+TEST_F(ParquetReaderTest, FilterNoMatch)
+{
+  auto filepath = temp_env->get_temp_filepath("FilterNoMatch.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 4);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.filters = {
+    cudf_io::column_filter{"_col0", cudf_io::filter_op::LESS, {cudf_io::filter_literal{0}}}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+}
+
+TEST_F(ParquetReaderTest, FilterSkipRows)
+{
+  auto filepath = temp_env->get_temp_filepath("FilterSkipRows.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 4);
+
+  // skip_rows and num_rows count the rows of the row groups that pass the filter
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.filters   = {cudf_io::column_filter{
+    "_col0", cudf_io::filter_op::GREATER_EQUAL, {cudf_io::filter_literal{200}}}};
+  in_args.skip_rows = 50;
+  in_args.num_rows  = 100;
+  auto result       = cudf_io::read_parquet(in_args);
+
+  auto full_table = cudf::concatenate({*tables[2], *tables[3]});
+  auto expected   = cudf::slice(*full_table, {50, 150});
+  expect_tables_equal(*result.tbl, expected[0]);
+}
+
+TEST_F(ParquetReaderTest, FilterLateMaterialization)
+{
+  auto filepath = temp_env->get_temp_filepath("FilterLateMaterialization.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 8);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.late_materialization = true;
+
+  in_args.filters = {cudf_io::column_filter{"_col0",
+                                            cudf_io::filter_op::GREATER_EQUAL,
+                                            {cudf_io::filter_literal{250}}},
+                     cudf_io::column_filter{
+                       "_col0", cudf_io::filter_op::LESS, {cudf_io::filter_literal{270}}}};
+  auto result     = cudf_io::read_parquet(in_args);
+  auto expected   = cudf::slice(*tables[2], {50, 70});
+  expect_tables_equal(*result.tbl, expected[0]);
+
+  // Filtered columns are only returned if selected
+  in_args.columns = {"_col1"};
+  result          = cudf_io::read_parquet(in_args);
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), expected[0].column(1));
+
+  in_args.columns = {"_col1", "_col0"};
+  in_args.filters = {cudf_io::column_filter{
+    "_col0", cudf_io::filter_op::IN, {cudf_io::filter_literal{5}, cudf_io::filter_literal{705}}}};
+
+  result         = cudf_io::read_parquet(in_args);
+  auto first     = cudf::slice(*tables[0], {5, 6});
+  auto last      = cudf::slice(*tables[7], {5, 6});
+  auto matches   = cudf::concatenate({first[0], last[0]});
+  auto reordered = cudf::table_view{{matches->get_column(1), matches->get_column(0)}};
+  expect_tables_equal(*result.tbl, reordered);
+  EXPECT_EQ(result.metadata.column_names, in_args.columns);
+
+  // The statistics of the first row group allow a match, but none of its rows do
+  in_args.filters = {
+    cudf_io::column_filter{"_col0", cudf_io::filter_op::GREATER, {cudf_io::filter_literal{50}}},
+    cudf_io::column_filter{"_col0", cudf_io::filter_op::LESS, {cudf_io::filter_literal{51}}}};
+  result          = cudf_io::read_parquet(in_args);
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+}
+
+TEST_F(ParquetReaderTest, FilterErrors)
+{
+  auto filepath = temp_env->get_temp_filepath("FilterErrors.parquet");
+  auto tables   = write_sequence_row_groups(filepath, 2);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.filters = {
+    cudf_io::column_filter{"missing", cudf_io::filter_op::EQUAL, {cudf_io::filter_literal{0}}}};
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+
+  in_args.filters = {cudf_io::column_filter{"_col0", cudf_io::filter_op::EQUAL, {}}};
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+
+  in_args.filters = {cudf_io::column_filter{
+    "_col1", cudf_io::filter_op::EQUAL, {cudf_io::filter_literal{0}}}};
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, ReadMetadata)
+{
+  auto filepath1 = temp_env->get_temp_filepath("ReadMetadata1.parquet");
+  auto filepath2 = temp_env->get_temp_filepath("ReadMetadata2.parquet");
+  write_sequence_row_groups(filepath1, 4);
+  write_sequence_row_groups(filepath2, 2);
+
+  auto result = cudf_io::read_parquet_metadata(
+    {cudf_io::source_info{std::vector<std::string>{filepath1, filepath2}}});
+  ASSERT_EQ(result.size(), 2u);
+  EXPECT_EQ(result[0].num_rows, 400);
+  EXPECT_EQ(result[1].num_rows, 200);
+  EXPECT_EQ(result[0].column_names, (std::vector<std::string>{"_col0", "_col1"}));
+  EXPECT_EQ(result[0].column_types[0].id(), cudf::type_id::INT64);
+  EXPECT_EQ(result[0].column_types[1].id(), cudf::type_id::STRING);
+  ASSERT_EQ(result[0].row_groups.size(), 4u);
+  ASSERT_EQ(result[1].row_groups.size(), 2u);
+
+  auto const& rg = result[0].row_groups[3];
+  EXPECT_EQ(rg.num_rows, 100);
+  ASSERT_EQ(rg.columns.size(), 2u);
+  EXPECT_EQ(rg.columns[0].null_count, 0);
+  EXPECT_GT(rg.columns[0].compressed_size, 0);
+  ASSERT_TRUE(rg.columns[0].has_minmax);
+  EXPECT_EQ(rg.columns[0].min_value.int_value, 300);
+  EXPECT_EQ(rg.columns[0].max_value.int_value, 399);
+  ASSERT_TRUE(rg.columns[1].has_minmax);
+  EXPECT_EQ(rg.columns[1].min_value.string_value, "d");
+  EXPECT_EQ(rg.columns[1].max_value.string_value, "d");
+}
+
+namespace {
+// Datasource that keeps track of the number of bytes read from the underlying file; reads may be
+// issued concurrently
+class counting_datasource : public cudf::io::datasource {
+ public:
+  explicit counting_datasource(std::string const& filepath)
+    : _source(cudf::io::datasource::create(filepath))
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    _bytes_read += size;
+    return _source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    _bytes_read += size;
+    return _source->host_read(offset, size, dst);
+  }
+
+  size_t size() const override { return _source->size(); }
+
+  size_t bytes_read() const { return _bytes_read; }
+
+ private:
+  std::unique_ptr<cudf::io::datasource> _source;
+  std::atomic<size_t> _bytes_read{0};
+};
+
+// Writes a single row group spanning many pages, with a dictionary-encoded string column
+std::unique_ptr<cudf::table> write_multi_page_table(std::string const& filepath,
+                                                    cudf_io::statistics_freq stats_level)
+{
+  std::vector<const char*> h_strings{"four", "score", "and", "seven", "years", "ago"};
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [&h_strings](auto i) { return h_strings[i % h_strings.size()]; });
+  auto valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+
+  constexpr auto num_rows = 400000;
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows, valids);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows, valids);
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, *expected};
+  out_args.compression = cudf_io::compression_type::SNAPPY;
+  out_args.stats_level = stats_level;
+  cudf_io::write_parquet(out_args);
+  return expected;
+}
+
+// Datasource that serves the column chunk reads directly into device memory
+class device_read_datasource : public cudf::io::datasource {
+ public:
+  explicit device_read_datasource(std::string const& filepath)
+    : _source(cudf::io::datasource::create(filepath))
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    return _source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return _source->host_read(offset, size, dst);
+  }
+
+  bool supports_device_read() const override { return true; }
+
+  size_t device_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const buffer = _source->host_read(offset, size);
+    CUDA_TRY(cudaMemcpy(dst, buffer->data(), buffer->size(), cudaMemcpyHostToDevice));
+    _device_bytes_read += buffer->size();
+    return buffer->size();
+  }
+
+  size_t size() const override { return _source->size(); }
+
+  size_t device_bytes_read() const { return _device_bytes_read; }
+
+ private:
+  std::unique_ptr<cudf::io::datasource> _source;
+  std::atomic<size_t> _device_bytes_read{0};
+};
+
+// Datasource that records the prefetch hints and serves asynchronous reads on its own threads
+class async_datasource : public cudf::io::datasource {
+ public:
+  explicit async_datasource(std::string const& filepath)
+    : _source(cudf::io::datasource::create(filepath))
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    return _source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return _source->host_read(offset, size, dst);
+  }
+
+  std::future<std::unique_ptr<buffer>> host_read_async(size_t offset, size_t size) override
+  {
+    _async_bytes_read += size;
+    return std::async(std::launch::async, [this, offset, size]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      return _source->host_read(offset, size);
+    });
+  }
+
+  void prefetch(size_t offset, size_t size) override { _bytes_prefetched += size; }
+
+  size_t size() const override { return _source->size(); }
+
+  size_t async_bytes_read() const { return _async_bytes_read; }
+  size_t bytes_prefetched() const { return _bytes_prefetched; }
+
+ private:
+  std::unique_ptr<cudf::io::datasource> _source;
+  std::atomic<size_t> _async_bytes_read{0};
+  std::atomic<size_t> _bytes_prefetched{0};
+};
+
+}  // namespace
+
+TEST_F(ParquetReaderTest, PageIndexSkipRows)
+{
+  auto filepath = temp_env->get_temp_filepath("PageIndexSkipRows.parquet");
+  auto expected = write_multi_page_table(filepath, cudf_io::statistics_freq::STATISTICS_ROWGROUP);
+
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> ranges{
+    {0, 10}, {123456, 100}, {399990, 10}, {150000, 100000}};
+  for (auto const& range : ranges) {
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    in_args.skip_rows = range.first;
+    in_args.num_rows  = range.second;
+    auto result       = cudf_io::read_parquet(in_args);
+
+    auto slice = cudf::slice(*expected, {range.first, range.first + range.second});
+    expect_tables_equal(*result.tbl, slice[0]);
+  }
+}
+
+TEST_F(ParquetReaderTest, PageIndexReadsOverlappingPages)
+{
+  auto filepath = temp_env->get_temp_filepath("PageIndexOverlappingPages.parquet");
+  write_multi_page_table(filepath, cudf_io::statistics_freq::STATISTICS_ROWGROUP);
+
+  counting_datasource full_source(filepath);
+  cudf_io::read_parquet_args full_args{cudf_io::source_info{&full_source}};
+  cudf_io::read_parquet(full_args);
+
+  counting_datasource source(filepath);
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{&source}};
+  in_args.skip_rows = 200000;
+  in_args.num_rows  = 10;
+  cudf_io::read_parquet(in_args);
+
+  EXPECT_LT(source.bytes_read() * 2, full_source.bytes_read());
+}
+
+TEST_F(ParquetReaderTest, PageIndexFilterPageStatistics)
+{
+  auto filepath = temp_env->get_temp_filepath("PageIndexFilterPageStats.parquet");
+  auto expected = write_multi_page_table(filepath, cudf_io::statistics_freq::STATISTICS_PAGE);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.filters = {cudf_io::column_filter{
+    "_col0", cudf_io::filter_op::EQUAL, {cudf_io::filter_literal{int64_t{234567}}}}};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(*result.tbl, *expected);
+
+  in_args.filters = {cudf_io::column_filter{
+    "_col0", cudf_io::filter_op::GREATER, {cudf_io::filter_literal{int64_t{400000}}}}};
+  result = cudf_io::read_parquet(in_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+}
+
+TEST_F(ParquetReaderTest, CoalescedReads)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<table>> tables;
+  for (int idx = 0; idx < 4; idx++) {
+    tables.push_back(create_random_fixed_table<int>(6, 10000, true));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("CoalescedReads.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& tbl : tables) { cudf_io::write_parquet_chunked(*tbl, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto full_table = cudf::concatenate({*tables[0], *tables[1], *tables[2], *tables[3]});
+  auto expected   = full_table->select({1, 2, 4});
+
+  // Reading with gaps between the column chunks returns the same data, at the cost of more IO
+  counting_datasource exact_source(filepath);
+  cudf_io::read_parquet_args exact_args{cudf_io::source_info{&exact_source}};
+  exact_args.columns      = {"_col1", "_col2", "_col4"};
+  exact_args.max_read_gap = 0;
+  auto exact_result       = cudf_io::read_parquet(exact_args);
+  expect_tables_equal(*exact_result.tbl, expected);
+
+  counting_datasource merged_source(filepath);
+  cudf_io::read_parquet_args merged_args{cudf_io::source_info{&merged_source}};
+  merged_args.columns      = {"_col1", "_col2", "_col4"};
+  merged_args.max_read_gap = size_t{1} << 30;
+  auto merged_result       = cudf_io::read_parquet(merged_args);
+  expect_tables_equal(*merged_result.tbl, expected);
+
+  EXPECT_GT(merged_source.bytes_read(), exact_source.bytes_read());
+}
+
+TEST_F(ParquetReaderTest, DeviceReadDatasource)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 10000, true);
+
+  auto filepath = temp_env->get_temp_filepath("DeviceReadDatasource.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, *expected};
+  out_args.compression = cudf_io::compression_type::SNAPPY;
+  cudf_io::write_parquet(out_args);
+
+  device_read_datasource source(filepath);
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{&source}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(*result.tbl, *expected);
+  EXPECT_GT(source.device_bytes_read(), 0);
+}
+
+TEST_F(ParquetReaderTest, AsyncDatasource)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 10000, true);
+
+  auto filepath = temp_env->get_temp_filepath("AsyncDatasource.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, *expected};
+  out_args.compression = cudf_io::compression_type::SNAPPY;
+  cudf_io::write_parquet(out_args);
+
+  async_datasource source(filepath);
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{&source}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(*result.tbl, *expected);
+  EXPECT_GT(source.async_bytes_read(), 0);
+  EXPECT_EQ(source.bytes_prefetched(), source.async_bytes_read());
+}
+
+TEST_F(ParquetReaderTest, MultiFileRead)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<table>> tables;
+  std::vector<std::string> filepaths;
+  for (int idx = 0; idx < 3; idx++) {
+    tables.push_back(create_random_fixed_table<int>(4, 5000 + 1000 * idx, true));
+    filepaths.push_back(
+      temp_env->get_temp_filepath("MultiFileRead" + std::to_string(idx) + ".parquet"));
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepaths.back()}, *tables.back()};
+    cudf_io::write_parquet(out_args);
+  }
+  auto expected = cudf::concatenate({*tables[0], *tables[1], *tables[2]});
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepaths}};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(*result.tbl, *expected);
+
+  // Row group indices are global across the files
+  cudf_io::read_parquet_args rg_args{cudf_io::source_info{filepaths}};
+  rg_args.row_group_list = {2, 0};
+  auto rg_result         = cudf_io::read_parquet(rg_args);
+  auto rg_expected       = cudf::concatenate({*tables[2], *tables[0]});
+  expect_tables_equal(*rg_result.tbl, *rg_expected);
+
+  // Row ranges may span file boundaries
+  cudf_io::read_parquet_args rows_args{cudf_io::source_info{filepaths}};
+  rows_args.skip_rows = 4000;
+  rows_args.num_rows  = 8000;
+  auto rows_result    = cudf_io::read_parquet(rows_args);
+  auto rows_expected  = cudf::slice(*expected, {4000, 12000});
+  expect_tables_equal(*rows_result.tbl, rows_expected[0]);
+}
+
+TEST_F(ParquetReaderTest, MultiFileSchemaMismatch)
+{
+  srand(31337);
+  auto filepath1 = temp_env->get_temp_filepath("MultiFileSchemaMismatch1.parquet");
+  auto table1    = create_random_fixed_table<int>(4, 1000, false);
+  cudf_io::write_parquet_args args1{cudf_io::sink_info{filepath1}, *table1};
+  cudf_io::write_parquet(args1);
+
+  auto filepath2 = temp_env->get_temp_filepath("MultiFileSchemaMismatch2.parquet");
+  auto table2    = create_random_fixed_table<float>(4, 1000, false);
+  cudf_io::write_parquet_args args2{cudf_io::sink_info{filepath2}, *table2};
+  cudf_io::write_parquet(args2);
+
+  std::vector<std::string> filepaths{filepath1, filepath2};
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepaths}};
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionary)
+{
+  std::vector<const char*> h_strings1{"beta", "alpha", "gamma", "alpha"};
+  std::vector<const char*> h_strings2{"gamma", "delta", "delta"};
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+
+  auto strings1 = cudf::test::make_counting_transform_iterator(
+    0, [&h_strings1](auto i) { return h_strings1[i % h_strings1.size()]; });
+  auto strings2 = cudf::test::make_counting_transform_iterator(
+    0, [&h_strings2](auto i) { return h_strings2[i % h_strings2.size()]; });
+
+  // Each row group has its own dictionary, with some strings in common
+  cudf::test::strings_column_wrapper col1(strings1, strings1 + 1000, valids);
+  cudf::test::strings_column_wrapper col2(strings2, strings2 + 1500, valids);
+  cudf::table_view tbl1({col1});
+  cudf::table_view tbl2({col2});
+
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionary.parquet");
+  cudf_io::write_parquet_chunked_args out_args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(out_args);
+  cudf_io::write_parquet_chunked(tbl1, state);
+  cudf_io::write_parquet_chunked(tbl2, state);
+  cudf_io::write_parquet_chunked_end(state);
+  auto expected = cudf::concatenate({tbl1, tbl2});
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.strings_to_dictionary = true;
+  auto result                   = cudf_io::read_parquet(in_args);
+
+  ASSERT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::DICTIONARY32);
+  cudf::dictionary_column_view dictionary(result.tbl->get_column(0));
+  cudf::test::strings_column_wrapper expected_keys({"alpha", "beta", "delta", "gamma"});
+  cudf::test::expect_columns_equal(dictionary.keys(), expected_keys);
+  auto decoded = cudf::dictionary::decode(dictionary);
+  cudf::test::expect_columns_equal(*decoded, expected->get_column(0));
+
+  // Row ranges within a row group
+  cudf_io::read_parquet_args rows_args{cudf_io::source_info{filepath}};
+  rows_args.strings_to_dictionary = true;
+  rows_args.skip_rows             = 900;
+  rows_args.num_rows              = 200;
+  auto rows_result                = cudf_io::read_parquet(rows_args);
+  auto rows_decoded =
+    cudf::dictionary::decode(cudf::dictionary_column_view(rows_result.tbl->get_column(0)));
+  auto rows_expected = cudf::slice(expected->get_column(0), {900, 1100});
+  cudf::test::expect_columns_equal(*rows_decoded, rows_expected[0]);
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionaryAndCategorical)
+{
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionaryAndCategorical.parquet");
+  cudf::test::strings_column_wrapper col0({"a", "b", "a"});
+  cudf::table_view expected({col0});
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.strings_to_categorical = true;
+  in_args.strings_to_dictionary  = true;
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, ListColumn)
+{
+  namespace pq = cudf::io::parquet;
+
+  // Rows [1, 2, 3], null, [], [4, null] of an optional list of optional INT32 elements
+  const std::vector<uint8_t> rep_levels{2, 0, 4, 1, 6, 0, 2, 1};
+  const std::vector<uint8_t> def_levels{6, 3, 2, 0, 2, 1, 2, 3, 2, 2};
+  const std::vector<int32_t> values{1, 2, 3, 4};
+  std::vector<uint8_t> page_data;
+  auto put_levels = [&](const std::vector<uint8_t>& levels) {
+    const uint32_t size = levels.size();
+    page_data.insert(page_data.end(),
+                     reinterpret_cast<const uint8_t*>(&size),
+                     reinterpret_cast<const uint8_t*>(&size + 1));
+    page_data.insert(page_data.end(), levels.begin(), levels.end());
+  };
+  put_levels(rep_levels);
+  put_levels(def_levels);
+  page_data.insert(page_data.end(),
+                   reinterpret_cast<const uint8_t*>(values.data()),
+                   reinterpret_cast<const uint8_t*>(values.data() + values.size()));
+
+  std::vector<uint8_t> file{'P', 'A', 'R', '1'};
+  pq::CompactProtocolWriter cpw(&file);
+  cpw.put_fldh(1, 0, pq::ST_FLD_I32);
+  cpw.put_int(pq::DATA_PAGE);
+  cpw.put_fldh(2, 1, pq::ST_FLD_I32);
+  cpw.put_int(page_data.size());
+  cpw.put_fldh(3, 2, pq::ST_FLD_I32);
+  cpw.put_int(page_data.size());
+  cpw.put_fldh(5, 3, pq::ST_FLD_STRUCT);
+  cpw.put_fldh(1, 0, pq::ST_FLD_I32);
+  cpw.put_int(7);
+  cpw.put_fldh(2, 1, pq::ST_FLD_I32);
+  cpw.put_int(pq::PLAIN);
+  cpw.put_fldh(3, 2, pq::ST_FLD_I32);
+  cpw.put_int(pq::RLE);
+  cpw.put_fldh(4, 3, pq::ST_FLD_I32);
+  cpw.put_int(pq::RLE);
+  cpw.putb(0);
+  cpw.putb(0);
+  const int64_t chunk_size = file.size() - 4 + page_data.size();
+  file.insert(file.end(), page_data.begin(), page_data.end());
+
+  pq::FileMetaData md;
+  md.version  = 1;
+  md.num_rows = 4;
+  md.schema.resize(4);
+  md.schema[0].name            = "schema";
+  md.schema[0].num_children    = 1;
+  md.schema[1].name            = "a";
+  md.schema[1].repetition_type = pq::OPTIONAL;
+  md.schema[1].converted_type  = pq::LIST;
+  md.schema[1].num_children    = 1;
+  md.schema[2].name            = "list";
+  md.schema[2].repetition_type = pq::REPEATED;
+  md.schema[2].num_children    = 1;
+  md.schema[3].name            = "element";
+  md.schema[3].type            = pq::INT32;
+  md.schema[3].repetition_type = pq::OPTIONAL;
+
+  md.row_groups.resize(1);
+  md.row_groups[0].num_rows        = 4;
+  md.row_groups[0].total_byte_size = chunk_size;
+  md.row_groups[0].columns.resize(1);
+  auto& chunk                             = md.row_groups[0].columns[0];
+  chunk.file_offset                       = 4;
+  chunk.meta_data.type                    = pq::INT32;
+  chunk.meta_data.encodings               = {pq::PLAIN, pq::RLE};
+  chunk.meta_data.path_in_schema          = {"a", "list", "element"};
+  chunk.meta_data.num_values              = 7;
+  chunk.meta_data.total_uncompressed_size = chunk_size;
+  chunk.meta_data.total_compressed_size   = chunk_size;
+  chunk.meta_data.data_page_offset        = 4;
+  const uint32_t footer_size = cpw.write(&md);
+  file.insert(file.end(),
+              reinterpret_cast<const uint8_t*>(&footer_size),
+              reinterpret_cast<const uint8_t*>(&footer_size + 1));
+  file.insert(file.end(), {'P', 'A', 'R', '1'});
+
+  cudf_io::read_parquet_args in_args{
+    cudf_io::source_info{reinterpret_cast<const char*>(file.data()), file.size()}};
+  auto result = cudf_io::read_parquet(in_args);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+
+  const auto list = result.tbl->get_column(0).view();
+  ASSERT_EQ(list.type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(list.size(), 4);
+  EXPECT_EQ(list.null_count(), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 3, 3, 3, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_elements({1, 2, 3, 4, 0},
+                                                                    {1, 1, 1, 1, 0});
+  cudf::test::expect_columns_equal(list.child(0), expected_offsets);
+  cudf::test::expect_columns_equal(list.child(1), expected_elements);
+
+  // Row ranges return the elements of the selected rows only
+  cudf_io::read_parquet_args rows_args{
+    cudf_io::source_info{reinterpret_cast<const char*>(file.data()), file.size()}};
+  rows_args.skip_rows  = 2;
+  rows_args.num_rows   = 2;
+  auto rows_result     = cudf_io::read_parquet(rows_args);
+  const auto rows_list = rows_result.tbl->get_column(0).view();
+  EXPECT_EQ(rows_list.size(), 2);
+  EXPECT_EQ(rows_list.null_count(), 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_rows_offsets{0, 0, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_rows_elements({4, 0}, {1, 0});
+  cudf::test::expect_columns_equal(rows_list.child(0), expected_rows_offsets);
+  cudf::test::expect_columns_equal(rows_list.child(1), expected_rows_elements);
+}
+
+TEST_F(ParquetReaderTest, IntegerDecimals)
+{
+  namespace pq = cudf::io::parquet;
+
+  // Single required decimal column of the given physical type, written with PLAIN encoding
+  auto make_decimal_file = [](pq::Type physical,
+                              const std::vector<uint8_t>& page_data,
+                              int32_t num_values,
+                              int32_t scale,
+                              int32_t precision) {
+    std::vector<uint8_t> file{'P', 'A', 'R', '1'};
+    pq::CompactProtocolWriter cpw(&file);
+    cpw.put_fldh(1, 0, pq::ST_FLD_I32);
+    cpw.put_int(pq::DATA_PAGE);
+    cpw.put_fldh(2, 1, pq::ST_FLD_I32);
+    cpw.put_int(page_data.size());
+    cpw.put_fldh(3, 2, pq::ST_FLD_I32);
+    cpw.put_int(page_data.size());
+    cpw.put_fldh(5, 3, pq::ST_FLD_STRUCT);
+    cpw.put_fldh(1, 0, pq::ST_FLD_I32);
+    cpw.put_int(num_values);
+    cpw.put_fldh(2, 1, pq::ST_FLD_I32);
+    cpw.put_int(pq::PLAIN);
+    cpw.put_fldh(3, 2, pq::ST_FLD_I32);
+    cpw.put_int(pq::RLE);
+    cpw.put_fldh(4, 3, pq::ST_FLD_I32);
+    cpw.put_int(pq::RLE);
+    cpw.putb(0);
+    cpw.putb(0);
+    const int64_t chunk_size = file.size() - 4 + page_data.size();
+    file.insert(file.end(), page_data.begin(), page_data.end());
+
+    pq::FileMetaData md;
+    md.version  = 1;
+    md.num_rows = num_values;
+    md.schema.resize(2);
+    md.schema[0].name              = "schema";
+    md.schema[0].num_children      = 1;
+    md.schema[1].name              = "d";
+    md.schema[1].type              = physical;
+    md.schema[1].converted_type    = pq::DECIMAL;
+    md.schema[1].decimal_scale     = scale;
+    md.schema[1].decimal_precision = precision;
+
+    md.row_groups.resize(1);
+    md.row_groups[0].num_rows        = num_values;
+    md.row_groups[0].total_byte_size = chunk_size;
+    md.row_groups[0].columns.resize(1);
+    auto& chunk                             = md.row_groups[0].columns[0];
+    chunk.file_offset                       = 4;
+    chunk.meta_data.type                    = physical;
+    chunk.meta_data.encodings               = {pq::PLAIN, pq::RLE};
+    chunk.meta_data.path_in_schema          = {"d"};
+    chunk.meta_data.num_values              = num_values;
+    chunk.meta_data.total_uncompressed_size = chunk_size;
+    chunk.meta_data.total_compressed_size   = chunk_size;
+    chunk.meta_data.data_page_offset        = 4;
+    const uint32_t footer_size = cpw.write(&md);
+    file.insert(file.end(),
+                reinterpret_cast<const uint8_t*>(&footer_size),
+                reinterpret_cast<const uint8_t*>(&footer_size + 1));
+    file.insert(file.end(), {'P', 'A', 'R', '1'});
+    return file;
+  };
+  auto read_decimals = [](const std::vector<uint8_t>& file, bool decimals_as_float) {
+    cudf_io::read_parquet_args in_args{
+      cudf_io::source_info{reinterpret_cast<const char*>(file.data()), file.size()}};
+    in_args.decimals_as_float = decimals_as_float;
+    return cudf_io::read_parquet(in_args);
+  };
+
+  // 123.45, -1.00, 0.07 as INT32 with 2 fractional digits
+  const std::vector<int32_t> values32{12345, -100, 7};
+  const auto file32 = make_decimal_file(
+    pq::INT32,
+    std::vector<uint8_t>(reinterpret_cast<const uint8_t*>(values32.data()),
+                         reinterpret_cast<const uint8_t*>(values32.data() + values32.size())),
+    values32.size(),
+    2,
+    9);
+
+  const auto float_result = read_decimals(file32, true);
+  cudf::test::fixed_width_column_wrapper<double> expected_floats{123.45, -1.0, 0.07};
+  cudf::test::expect_columns_equivalent(float_result.tbl->get_column(0), expected_floats);
+
+  const auto decimal_result = read_decimals(file32, false);
+  const auto decimals       = decimal_result.tbl->get_column(0).view();
+  EXPECT_EQ(decimals.type(), (cudf::data_type{cudf::type_id::DECIMAL32, -2}));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_reps(values32.begin(),
+                                                                values32.end());
+  cudf::test::expect_columns_equal(
+    cudf::column_view{cudf::data_type{cudf::type_id::INT32}, decimals.size(), decimals.head()},
+    expected_reps);
+
+  // Decimals of scale 0 are read as integers unless read as fixed-point
+  const std::vector<int64_t> values64{5, -6};
+  const auto file64 = make_decimal_file(
+    pq::INT64,
+    std::vector<uint8_t>(reinterpret_cast<const uint8_t*>(values64.data()),
+                         reinterpret_cast<const uint8_t*>(values64.data() + values64.size())),
+    values64.size(),
+    0,
+    18);
+
+  const auto int_result = read_decimals(file64, true);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_ints(values64.begin(), values64.end());
+  cudf::test::expect_columns_equal(int_result.tbl->get_column(0), expected_ints);
+
+  const auto decimal64_result = read_decimals(file64, false);
+  const auto decimals64       = decimal64_result.tbl->get_column(0).view();
+  EXPECT_EQ(decimals64.type(), (cudf::data_type{cudf::type_id::DECIMAL64, 0}));
+  cudf::test::expect_columns_equal(
+    cudf::column_view{cudf::data_type{cudf::type_id::INT64}, decimals64.size(), decimals64.head()},
+    expected_ints);
+}
+
 TEST_F(ParquetWriterStressTest, LargeTableWeakCompression)
 {
   std::vector<char> mm_buf;
@@ -16,6 +16,10 @@
 
 #include "jit-cache-test.hpp"
 
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace cudf {
 namespace test {
 TEST_F(JitCacheTest, CacheExceptionTest)
@@ -76,6 +80,35 @@ TEST_F(JitCacheTest, MemoryCacheProgramTest)
   cudf::test::expect_columns_equal(expect, column);
 }
 
+// Test that threads requesting the same kernel share one instantiation
+TEST_F(JitCacheTest, ConcurrentKernelTest)
+{
+  auto program = getProgram("MemoryCacheTestProg");
+
+  std::vector<cudf::jit::named_prog<jitify::experimental::KernelInstantiation>> kernels(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    threads.emplace_back([&, i] {
+      // make the device's primary context current in this thread
+      cudaFree(0);
+      kernels[i] = getKernelInstantiation("my_kernel", program, {std::to_string(5 + i % 2), "int"});
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  for (size_t i = 2; i < kernels.size(); ++i) {
+    EXPECT_EQ(std::get<1>(kernels[i]), std::get<1>(kernels[i % 2]));
+  }
+
+  auto column = cudf::test::fixed_width_column_wrapper<int>{{2, 0}};
+  auto expect = cudf::test::fixed_width_column_wrapper<int>{{64, 0}};
+  (*std::get<1>(kernels[1]))
+    .configure(grid, block)
+    .launch(column.operator cudf::mutable_column_view().data<int>());
+
+  cudf::test::expect_columns_equal(expect, column);
+}
+
 // Test the file caching ability
 #if defined(JITIFY_USE_CACHE)
 TEST_F(JitCacheTest, FileCacheProgramTest)
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+struct ConditionalJoinTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::unique_ptr<cudf::table> sorted_indices(
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> const& result)
+{
+  cudf::table_view indices({result.first->view(), result.second->view()});
+  return cudf::gather(indices, *cudf::sorted_order(indices));
+}
+}  // namespace
+
+TEST_F(ConditionalJoinTest, IntervalConditions)
+{
+  column_wrapper<int32_t> ts{{1, 5, 9, 3}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> start{0, 4, 2};
+  column_wrapper<int32_t> end{6, 8, 9};
+  cudf::table_view left({ts});
+  cudf::table_view right({start, end});
+
+  std::vector<cudf::join_condition> conditions{{0, cudf::binary_operator::GREATER_EQUAL, 0},
+                                               {0, cudf::binary_operator::LESS_EQUAL, 1}};
+  auto result = cudf::conditional_inner_join_indices(left, right, conditions);
+
+  column_wrapper<int32_t> gold_left{0, 1, 1, 1, 2};
+  column_wrapper<int32_t> gold_right{0, 0, 1, 2, 2};
+  cudf::table_view gold({gold_left, gold_right});
+  cudf::test::expect_tables_equal(gold, *sorted_indices(result));
+
+  EXPECT_THROW(cudf::conditional_inner_join_indices(left, right, {}), cudf::logic_error);
+}
+
+TEST_F(ConditionalJoinTest, EmptyRight)
+{
+  column_wrapper<int32_t> ts{1, 5, 9};
+  column_wrapper<int32_t> start{};
+  cudf::table_view left({ts});
+  cudf::table_view right({start});
+
+  auto result = cudf::conditional_inner_join_indices(
+    left, right, {{0, cudf::binary_operator::LESS, 0}});
+  EXPECT_EQ(0, result.first->size());
+  EXPECT_EQ(0, result.second->size());
+}
+
+TEST_F(ConditionalJoinTest, BandJoin)
+{
+  column_wrapper<int32_t> left{{1, 5, 9, 4, 7}, {1, 1, 1, 0, 1}};
+  column_wrapper<int32_t> right{{8, 4, 6, 2}, {1, 1, 1, 0}};
+
+  cudf::numeric_scalar<int32_t> lower(-1);
+  cudf::numeric_scalar<int32_t> upper(2);
+  auto result = cudf::band_inner_join_indices(left, right, lower, upper);
+
+  // right + lower <= left <= right + upper
+  column_wrapper<int32_t> gold_left{1, 1, 2, 4, 4};
+  column_wrapper<int32_t> gold_right{1, 2, 0, 0, 2};
+  cudf::table_view gold({gold_left, gold_right});
+  cudf::test::expect_tables_equal(gold, *sorted_indices(result));
+
+  // Same pairs through the generic conditional join
+  auto const lower_values = cudf::binary_operation(
+    right, lower, cudf::binary_operator::ADD, cudf::data_type{cudf::INT32});
+  auto const upper_values = cudf::binary_operation(
+    right, upper, cudf::binary_operator::ADD, cudf::data_type{cudf::INT32});
+  auto conditional = cudf::conditional_inner_join_indices(
+    cudf::table_view({left}),
+    cudf::table_view({*lower_values, *upper_values}),
+    {{0, cudf::binary_operator::GREATER_EQUAL, 0}, {0, cudf::binary_operator::LESS_EQUAL, 1}});
+  cudf::test::expect_tables_equal(gold, *sorted_indices(conditional));
+}
@@ -683,4 +683,216 @@ TEST_F(JoinTest, InnerJoinCornerCase)
   cudf::test::expect_tables_equal(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, HashJoinProbeMultipleTimes)
+{
+  column_wrapper<int32_t> probe_col{{3, 1, 2, 0, 3}};
+  column_wrapper<int32_t> build_col{{2, 2, 0, 4, 3}};
+  cudf::table_view probe({probe_col});
+  cudf::table_view build({build_col});
+
+  cudf::hash_join hash_join(build, {0});
+
+  auto sorted_indices = [](auto const& result) {
+    cudf::table_view indices({result.first->view(), result.second->view()});
+    return cudf::gather(indices, *cudf::sorted_order(indices));
+  };
+
+  column_wrapper<int32_t> inner_probe{{0, 2, 2, 3, 4}};
+  column_wrapper<int32_t> inner_build{{4, 0, 1, 2, 4}};
+  cudf::table_view inner_gold({inner_probe, inner_build});
+  cudf::test::expect_tables_equal(inner_gold, *sorted_indices(hash_join.inner_join(probe, {0})));
+
+  column_wrapper<int32_t> left_probe{{0, 1, 2, 2, 3, 4}};
+  column_wrapper<int32_t> left_build{{4, -1, 0, 1, 2, 4}};
+  cudf::table_view left_gold({left_probe, left_build});
+  cudf::test::expect_tables_equal(left_gold, *sorted_indices(hash_join.left_join(probe, {0})));
+
+  column_wrapper<int32_t> full_probe{{-1, 0, 1, 2, 2, 3, 4}};
+  column_wrapper<int32_t> full_build{{3, 4, -1, 0, 1, 2, 4}};
+  cudf::table_view full_gold({full_probe, full_build});
+  cudf::test::expect_tables_equal(full_gold, *sorted_indices(hash_join.full_join(probe, {0})));
+
+  EXPECT_EQ(5, hash_join.inner_join_size(probe, {0}));
+  EXPECT_EQ(6, hash_join.left_join_size(probe, {0}));
+
+  // Probing again reuses the same hash table
+  cudf::test::expect_tables_equal(inner_gold, *sorted_indices(hash_join.inner_join(probe, {0})));
+
+  column_wrapper<int64_t> mismatched_col{{3, 1, 2, 0, 3}};
+  cudf::table_view mismatched({mismatched_col});
+  EXPECT_THROW(hash_join.inner_join(mismatched, {0}), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinEmptyBuild)
+{
+  column_wrapper<int32_t> probe_col{{3, 1, 2}};
+  column_wrapper<int32_t> build_col{};
+  cudf::table_view probe({probe_col});
+  cudf::table_view build({build_col});
+
+  cudf::hash_join hash_join(build, {0});
+
+  EXPECT_EQ(0, hash_join.inner_join(probe, {0}).first->size());
+  EXPECT_EQ(0, hash_join.inner_join_size(probe, {0}));
+  EXPECT_EQ(3, hash_join.left_join_size(probe, {0}));
+
+  auto result = hash_join.left_join(probe, {0});
+  column_wrapper<int32_t> left_probe{{0, 1, 2}};
+  column_wrapper<int32_t> left_build{{-1, -1, -1}};
+  cudf::test::expect_columns_equal(left_probe, *result.first);
+  cudf::test::expect_columns_equal(left_build, *result.second);
+}
+
+struct JoinIndicesTest : public JoinTest,
+                         public ::testing::WithParamInterface<cudf::join_algorithm> {
+};
+
+INSTANTIATE_TEST_CASE_P(JoinAlgorithms,
+                        JoinIndicesTest,
+                        ::testing::Values(cudf::join_algorithm::HASH,
+                                          cudf::join_algorithm::SORT_MERGE,
+                                          cudf::join_algorithm::PARTITIONED_HASH));
+
+TEST_P(JoinIndicesTest, JoinIndices)
+{
+  auto const algorithm = GetParam();
+
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 3}};
+  strcol_wrapper col0_1({"s0", "s1", "s2", "s4", "s0"});
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper col1_1({"s2", "s1", "s4", "s2", "s0"});
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1});
+
+  auto sorted_indices = [](auto const& result) {
+    cudf::table_view indices({result.first->view(), result.second->view()});
+    return cudf::gather(indices, *cudf::sorted_order(indices));
+  };
+
+  column_wrapper<int32_t> inner_left{{0, 2, 3, 4}};
+  column_wrapper<int32_t> inner_right{{4, 0, 2, 4}};
+  cudf::table_view inner_gold({inner_left, inner_right});
+  cudf::test::expect_tables_equal(
+    inner_gold, *sorted_indices(cudf::inner_join_indices(t0, t1, {0, 1}, {0, 1}, algorithm)));
+
+  column_wrapper<int32_t> left_left{{0, 1, 2, 3, 4}};
+  column_wrapper<int32_t> left_right{{4, -1, 0, 2, 4}};
+  cudf::table_view left_gold({left_left, left_right});
+  cudf::test::expect_tables_equal(
+    left_gold, *sorted_indices(cudf::left_join_indices(t0, t1, {0, 1}, {0, 1}, algorithm)));
+
+  column_wrapper<int32_t> full_left{{-1, -1, 0, 1, 2, 3, 4}};
+  column_wrapper<int32_t> full_right{{1, 3, 4, -1, 0, 2, 4}};
+  cudf::table_view full_gold({full_left, full_right});
+  cudf::test::expect_tables_equal(
+    full_gold, *sorted_indices(cudf::full_join_indices(t0, t1, {0, 1}, {0, 1}, algorithm)));
+}
+
+TEST_P(JoinIndicesTest, SortedRightWithNulls)
+{
+  auto const algorithm = GetParam();
+
+  column_wrapper<int32_t> col0_0{{2, 5, 1, 0, 2}, {1, 1, 1, 0, 1}};
+  column_wrapper<int32_t> col1_0{{0, 1, 2, 2, 3}, {0, 1, 1, 1, 1}};
+  cudf::table_view t0({col0_0});
+  cudf::table_view t1({col1_0});
+
+  auto sorted_indices = [](auto const& result) {
+    cudf::table_view indices({result.first->view(), result.second->view()});
+    return cudf::gather(indices, *cudf::sorted_order(indices));
+  };
+
+  column_wrapper<int32_t> left_left{{0, 0, 1, 2, 3, 4, 4}};
+  column_wrapper<int32_t> left_right{{2, 3, -1, 1, 0, 2, 3}};
+  cudf::table_view left_gold({left_left, left_right});
+  cudf::test::expect_tables_equal(
+    left_gold, *sorted_indices(cudf::left_join_indices(t0, t1, {0}, {0}, algorithm)));
+}
+
+TEST_P(JoinIndicesTest, MultiplePartitions)
+{
+  auto const algorithm = GetParam();
+
+  // Enough build rows to be split into several partitions by the partitioned hash join
+  constexpr int32_t num_build_rows = 600000;
+  auto left_it  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i * 7919) % (num_build_rows + 1000); });
+  auto right_it = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return num_build_rows - 1 - i; });
+  column_wrapper<int32_t> col0_0(left_it, left_it + 5000);
+  column_wrapper<int32_t> col1_0(right_it, right_it + num_build_rows);
+  cudf::table_view t0({col0_0});
+  cudf::table_view t1({col1_0});
+
+  auto sorted_indices = [](auto const& result) {
+    cudf::table_view indices({result.first->view(), result.second->view()});
+    return cudf::gather(indices, *cudf::sorted_order(indices));
+  };
+
+  auto const expected = sorted_indices(
+    cudf::left_join_indices(t0, t1, {0}, {0}, cudf::join_algorithm::HASH));
+  cudf::test::expect_tables_equal(
+    *expected, *sorted_indices(cudf::left_join_indices(t0, t1, {0}, {0}, algorithm)));
+}
+
+TEST_F(JoinTest, BloomFilter)
+{
+  constexpr int32_t num_keys = 1000;
+
+  auto key_it = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  column_wrapper<int32_t> keys(key_it, key_it + num_keys);
+  column_wrapper<int32_t> probe(thrust::make_counting_iterator(0),
+                                thrust::make_counting_iterator(2 * num_keys));
+
+  cudf::bloom_filter filter(cudf::table_view({keys}), 0.01);
+  EXPECT_GT(filter.num_hashes(), 1);
+  EXPECT_EQ(0u, filter.num_bits() % 32);
+
+  auto const result   = cudf::bloom_filter_contains(filter, cudf::table_view({probe}));
+  auto const h_result = cudf::test::to_host<bool>(*result).first;
+  int false_positives = 0;
+  for (int32_t i = 0; i < 2 * num_keys; ++i) {
+    if (i % 2 == 0) {
+      EXPECT_TRUE(h_result[i]);
+    } else if (h_result[i]) {
+      ++false_positives;
+    }
+  }
+  EXPECT_LT(false_positives, num_keys / 20);
+
+  column_wrapper<int64_t> mismatched{1, 2, 3};
+  EXPECT_THROW(cudf::bloom_filter_contains(filter, cudf::table_view({mismatched})),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, MemoryEstimate)
+{
+  auto key_it = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<int32_t> col0_0(key_it, key_it + 1000);
+  column_wrapper<int32_t> col0_1(thrust::make_counting_iterator(0),
+                                 thrust::make_counting_iterator(1000));
+  column_wrapper<int32_t> col1_0(thrust::make_counting_iterator(0),
+                                 thrust::make_counting_iterator(100));
+  column_wrapper<int64_t> col1_1(thrust::make_counting_iterator(0),
+                                 thrust::make_counting_iterator(100));
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1});
+
+  auto const inner = cudf::estimate_join_memory(t0, t1, {0}, {0}, {{0, 0}});
+  auto const left  = cudf::estimate_join_memory(t0, t1, {0}, {0}, {{0, 0}}, cudf::join_type::LEFT);
+  auto const full  = cudf::estimate_join_memory(t0, t1, {0}, {0}, {{0, 0}}, cudf::join_type::FULL);
+
+  // Output columns and join indices of the 1000 joined rows
+  auto const result = cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  EXPECT_EQ(1000, result->num_rows());
+  EXPECT_GE(inner, 1000 * (sizeof(int32_t) * 2 + sizeof(int64_t) + 2 * sizeof(cudf::size_type)));
+  EXPECT_GE(left, inner);
+  EXPECT_GT(full, left);
+
+  // Fewer distinct keys give more joined rows
+  EXPECT_GT(cudf::estimate_join_memory(t0, t1, {0}, {0}, {{0, 0}}, cudf::join_type::INNER, 10),
+            inner);
+  EXPECT_THROW(cudf::estimate_join_memory(t0, t1, {0}, {0, 1}, {}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -691,3 +691,27 @@ TEST_F(JoinTest, LeftAntiJoin_empty_right_table)
   expect_columns_equal(join_table->get_column(2), expect_2);
   expect_columns_equal(join_table->get_column(3), expect_3);
 }
+
+TEST_F(JoinTest, LeftSemiAntiJoin_duplicate_right_keys)
+{
+  column_wrapper<int32_t> a_0{1, 2, 3, 4, 2, 5};
+  column_wrapper<int32_t> a_1{10, 20, 30, 40, 50, 60};
+
+  // Every right key is repeated many times
+  auto b_iter =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return 2 + 2 * (i % 2); });
+  column_wrapper<int32_t> b_0(b_iter, b_iter + 1000);
+
+  cudf::table_view table_a({a_0, a_1});
+  cudf::table_view table_b({b_0});
+
+  column_wrapper<int32_t> semi_0{2, 4, 2};
+  column_wrapper<int32_t> semi_1{20, 40, 50};
+  auto semi_result = cudf::left_semi_join(table_a, table_b, {0}, {0}, {0, 1});
+  cudf::test::expect_tables_equal(cudf::table_view({semi_0, semi_1}), *semi_result);
+
+  column_wrapper<int32_t> anti_0{1, 3, 5};
+  column_wrapper<int32_t> anti_1{10, 30, 60};
+  auto anti_result = cudf::left_anti_join(table_a, table_b, {0}, {0}, {0, 1});
+  cudf::test::expect_tables_equal(cudf::table_view({anti_0, anti_1}), *anti_result);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/lists/contains.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+#include <vector>
+
+struct ListsContainsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ListsContainsTest, Basic)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 3, 3, 3, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> elements({1, 2, 3, 4, 2}, {1, 1, 1, 1, 0});
+  std::vector<bool> validity{1, 1, 0, 1};
+  auto lists = cudf::make_lists_column(4,
+                                       offsets.release(),
+                                       elements.release(),
+                                       1,
+                                       cudf::test::detail::make_null_mask(validity.begin(),
+                                                                          validity.end()));
+  cudf::lists_column_view const view{lists->view()};
+
+  auto results = cudf::lists::contains(view, cudf::numeric_scalar<int32_t>(2));
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0}, validity.begin());
+  cudf::test::expect_columns_equal(*results, expected);
+
+  results = cudf::lists::contains(view, cudf::numeric_scalar<int32_t>(4));
+  cudf::test::fixed_width_column_wrapper<bool> expected_four({0, 0, 0, 1}, validity.begin());
+  cudf::test::expect_columns_equal(*results, expected_four);
+}
+
+TEST_F(ListsContainsTest, Strings)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 2, 3};
+  cudf::test::strings_column_wrapper elements{"a", "bc", "de"};
+  auto lists = cudf::make_lists_column(2, offsets.release(), elements.release(), 0, {});
+
+  auto results =
+    cudf::lists::contains(cudf::lists_column_view(lists->view()), cudf::string_scalar("de"));
+
+  cudf::test::fixed_width_column_wrapper<bool> expected{0, 1};
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(ListsContainsTest, NullSearchKey)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 1, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> elements{1, 2};
+  auto lists = cudf::make_lists_column(2, offsets.release(), elements.release(), 0, {});
+
+  auto results = cudf::lists::contains(cudf::lists_column_view(lists->view()),
+                                       cudf::numeric_scalar<int32_t>(1, false));
+
+  cudf::test::fixed_width_column_wrapper<bool> expected({0, 0}, {0, 0});
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(ListsContainsTest, TypeMismatch)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> elements{1};
+  auto lists = cudf::make_lists_column(1, offsets.release(), elements.release(), 0, {});
+
+  EXPECT_THROW(cudf::lists::contains(cudf::lists_column_view(lists->view()),
+                                     cudf::numeric_scalar<float>(1)),
+               cudf::logic_error);
+}
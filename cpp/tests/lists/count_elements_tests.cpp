@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/count_elements.hpp>
+
+#include <vector>
+
+struct ListsCountElementsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ListsCountElementsTest, Basic)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 3, 3, 3, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> elements{1, 2, 3, 4, 2};
+  std::vector<bool> validity{1, 1, 0, 1};
+  auto lists = cudf::make_lists_column(4,
+                                       offsets.release(),
+                                       elements.release(),
+                                       1,
+                                       cudf::test::detail::make_null_mask(validity.begin(),
+                                                                          validity.end()));
+
+  auto results = cudf::lists::count_elements(cudf::lists_column_view(lists->view()));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({3, 0, 0, 2}, validity.begin());
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(ListsCountElementsTest, SlicedLists)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 1, 4, 4, 6};
+  cudf::test::fixed_width_column_wrapper<int32_t> elements{1, 2, 3, 4, 5, 6};
+  auto lists = cudf::make_lists_column(4, offsets.release(), elements.release(), 0, {});
+  auto sliced = cudf::slice(lists->view(), {1, 4}).front();
+
+  auto results = cudf::lists::count_elements(cudf::lists_column_view(sliced));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{3, 0, 2};
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(ListsCountElementsTest, NotAListsColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+  EXPECT_THROW(cudf::lists_column_view{input}, cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/sorting.hpp>
+
+#include <vector>
+
+struct ListsSortTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ListsSortTest, Basic)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 3, 3, 3, 6};
+  cudf::test::fixed_width_column_wrapper<int32_t> elements({3, 1, 2, 5, 0, 4}, {1, 1, 1, 1, 0, 1});
+  std::vector<bool> validity{1, 1, 0, 1};
+  auto lists = cudf::make_lists_column(4,
+                                       offsets.release(),
+                                       elements.release(),
+                                       1,
+                                       cudf::test::detail::make_null_mask(validity.begin(),
+                                                                          validity.end()));
+
+  auto results = cudf::lists::sort_lists(
+    cudf::lists_column_view(lists->view()), cudf::order::ASCENDING, cudf::null_order::AFTER);
+  cudf::lists_column_view const sorted{results->view()};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 3, 3, 3, 6};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_elements({1, 2, 3, 4, 5, 0},
+                                                                    {1, 1, 1, 1, 1, 0});
+  cudf::test::expect_columns_equal(sorted.offsets(), expected_offsets);
+  cudf::test::expect_columns_equal(sorted.child(), expected_elements);
+  EXPECT_EQ(results->null_count(), 1);
+}
+
+TEST_F(ListsSortTest, DescendingSlicedLists)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 2, 5, 7};
+  cudf::test::fixed_width_column_wrapper<int32_t> elements{9, 8, 1, 3, 2, 6, 7};
+  auto lists  = cudf::make_lists_column(3, offsets.release(), elements.release(), 0, {});
+  auto sliced = cudf::slice(lists->view(), {1, 3}).front();
+
+  auto results = cudf::lists::sort_lists(
+    cudf::lists_column_view(sliced), cudf::order::DESCENDING, cudf::null_order::AFTER);
+  cudf::lists_column_view const sorted{results->view()};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 3, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_elements{3, 2, 1, 7, 6};
+  cudf::test::expect_columns_equal(sorted.offsets(), expected_offsets);
+  cudf::test::expect_columns_equal(sorted.child(), expected_elements);
+}
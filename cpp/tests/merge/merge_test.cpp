@@ -702,4 +702,91 @@ TYPED_TEST(MergeTest_, NMerge1KeyColumns)
   cudf::test::expect_columns_equal(expected_column_view2, output_column_view2);
 }
 
+class MergeTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MergeTest, NMergeWithNullsAndEmptyTables)
+{
+  using keyT   = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using valueT = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+  keyT keys0({1, 3, 0}, {1, 1, 0});
+  valueT values0{{0, 1, 2}};
+  keyT keys1{};
+  valueT values1{};
+  keyT keys2{{2, 3}};
+  valueT values2{{3, 4}};
+  keyT keys3({0}, {0});
+  valueT values3{{5}};
+  keyT keys4{{0, 3, 4}};
+  valueT values4{{6, 7, 8}};
+
+  std::vector<cudf::table_view> tables{cudf::table_view{{keys0, values0}},
+                                       cudf::table_view{{keys1, values1}},
+                                       cudf::table_view{{keys2, values2}},
+                                       cudf::table_view{{keys3, values3}},
+                                       cudf::table_view{{keys4, values4}}};
+
+  auto p_outputTable =
+    cudf::merge(tables, {0}, {cudf::order::ASCENDING}, {cudf::null_order::AFTER});
+
+  // Equivalent keys keep the order of their tables
+  keyT expected_keys({0, 1, 2, 3, 3, 3, 4, 0, 0}, {1, 1, 1, 1, 1, 1, 1, 0, 0});
+  valueT expected_values{{6, 0, 3, 1, 4, 7, 8, 2, 5}};
+
+  cudf::test::expect_columns_equal(expected_keys, p_outputTable->view().column(0));
+  cudf::test::expect_columns_equal(expected_values, p_outputTable->view().column(1));
+}
+
+TEST_F(MergeTest, NMergeManyTiles)
+{
+  using keyT   = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using valueT = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+  // Tables large enough to be split into many tiles, with keys repeated within and across
+  // tables, of different sizes and one empty
+  std::vector<cudf::size_type> const sizes{3000, 0, 5000, 1, 700, 4096};
+  std::vector<std::pair<int32_t, int64_t>> expected;
+  std::vector<keyT> keys;
+  std::vector<valueT> values;
+  std::vector<cudf::table_view> tables;
+  for (std::size_t t = 0; t < sizes.size(); ++t) {
+    std::vector<int32_t> table_keys(sizes[t]);
+    for (cudf::size_type row = 0; row < sizes[t]; ++row) {
+      table_keys[row] = (row * static_cast<int32_t>(t + 3)) % 997;
+    }
+    std::sort(table_keys.begin(), table_keys.end());
+    std::vector<int64_t> table_values(sizes[t]);
+    for (cudf::size_type row = 0; row < sizes[t]; ++row) {
+      table_values[row] = static_cast<int64_t>(t) * 10000 + row;
+      expected.emplace_back(table_keys[row], table_values[row]);
+    }
+    keys.emplace_back(table_keys.begin(), table_keys.end());
+    values.emplace_back(table_values.begin(), table_values.end());
+  }
+  for (std::size_t t = 0; t < sizes.size(); ++t) {
+    tables.push_back(cudf::table_view{{keys[t], values[t]}});
+  }
+
+  // A stable sort of the concatenated rows keeps equivalent keys in the order of their tables
+  std::stable_sort(expected.begin(), expected.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.first < rhs.first;
+  });
+  std::vector<int32_t> expected_keys(expected.size());
+  std::vector<int64_t> expected_values(expected.size());
+  std::transform(expected.begin(), expected.end(), expected_keys.begin(), [](auto const& p) {
+    return p.first;
+  });
+  std::transform(expected.begin(), expected.end(), expected_values.begin(), [](auto const& p) {
+    return p.second;
+  });
+
+  auto p_outputTable = cudf::merge(tables, {0}, {cudf::order::ASCENDING}, {});
+
+  cudf::test::expect_columns_equal(keyT(expected_keys.begin(), expected_keys.end()),
+                                   p_outputTable->view().column(0));
+  cudf::test::expect_columns_equal(valueT(expected_values.begin(), expected_values.end()),
+                                   p_outputTable->view().column(1));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/sorting.hpp>
@@ -23,6 +24,8 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <algorithm>
+
 using cudf::test::expect_columns_equal;
 using cudf::test::expect_table_properties_equal;
 using cudf::test::expect_tables_equal;
@@ -182,6 +185,61 @@ TEST_F(HashPartition, ColumnsToHash)
   expect_columns_equal(first_result->get_column(0).view(), second_result->get_column(0).view());
 }
 
+TEST_F(HashPartition, XXHash64)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 1, 2, 3, 1, 2});
+  fixed_width_column_wrapper<int32_t> values({0, 1, 2, 3, 4, 5, 6, 7});
+  auto input = cudf::table_view({keys, values});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0});
+
+  for (cudf::size_type const num_partitions : {3, 4, 2000}) {
+    std::unique_ptr<cudf::table> output1, output2;
+    std::vector<cudf::size_type> offsets1, offsets2;
+    std::tie(output1, offsets1) = cudf::hash_partition(
+      input, columns_to_hash, num_partitions, cudf::hash_id::HASH_XXHASH64);
+    std::tie(output2, offsets2) = cudf::hash_partition(
+      input, columns_to_hash, num_partitions, cudf::hash_id::HASH_XXHASH64);
+
+    // Expect deterministic result from hashing the same input
+    EXPECT_EQ(offsets1, offsets2);
+    expect_tables_equal(output1->view(), output2->view());
+
+    // Expect equal keys in the same partition
+    auto const output_keys  = cudf::test::to_host<int32_t>(output1->get_column(0)).first;
+    auto const partition_of = [&offsets1](cudf::size_type row) {
+      return std::upper_bound(offsets1.begin(), offsets1.end(), row) - offsets1.begin();
+    };
+    for (cudf::size_type i = 0; i < input.num_rows(); ++i) {
+      for (cudf::size_type j = 0; j < input.num_rows(); ++j) {
+        if (output_keys[i] == output_keys[j]) { EXPECT_EQ(partition_of(i), partition_of(j)); }
+      }
+    }
+  }
+}
+
+TEST_F(HashPartition, SparkMurmur3)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4, 5, 6, 7, 8});
+  auto input = cudf::table_view({keys});
+
+  // Spark's `HashPartitioning` assigns each row to the positive modulo of its `Murmur3Hash`
+  auto const check = [&](cudf::size_type num_partitions, std::vector<int32_t> const& expected) {
+    std::unique_ptr<cudf::table> output;
+    std::vector<cudf::size_type> offsets;
+    std::tie(output, offsets) =
+      cudf::hash_partition(input, {0}, num_partitions, cudf::hash_id::HASH_SPARK_MURMUR3);
+    auto const output_keys = cudf::test::to_host<int32_t>(output->get_column(0)).first;
+    for (cudf::size_type row = 0; row < input.num_rows(); ++row) {
+      auto const partition =
+        std::upper_bound(offsets.begin(), offsets.end(), row) - offsets.begin() - 1;
+      EXPECT_EQ(expected[output_keys[row] - 1], partition);
+    }
+  };
+  check(3, {1, 0, 0, 0, 0, 1, 0, 0});
+  check(4, {3, 2, 3, 2, 2, 1, 3, 3});
+}
+
 template <typename T>
 class HashPartitionFixedWidth : public cudf::test::BaseFixture {
 };
@@ -285,4 +343,75 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, true);
 }
 
+void expect_buffers_match_hash_partition(cudf::table_view const& input,
+                                         std::vector<cudf::size_type> const& columns_to_hash,
+                                         cudf::size_type num_partitions)
+{
+  std::unique_ptr<cudf::table> expected;
+  std::vector<cudf::size_type> offsets;
+  std::tie(expected, offsets) = cudf::hash_partition(input, columns_to_hash, num_partitions);
+  offsets.push_back(input.num_rows());
+
+  auto const result = cudf::hash_partition_to_buffers(input, columns_to_hash, num_partitions);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), result.size());
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    auto const expected_partition = cudf::slice(expected->view(), {offsets[p], offsets[p + 1]});
+    // Rows within a partition may be ordered differently by the two implementations
+    expect_tables_equal(cudf::sort(expected_partition.front())->view(),
+                        cudf::sort(result[p].table)->view());
+  }
+}
+
+TEST_F(HashPartition, ToBuffersMixedColumnTypes)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f},
+                                           {1, 0, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int16_t> integers({1, 2, 3, 4, 5, 6, 7, 8});
+  strings_column_wrapper strings({"a", "bb", "", "d", "ee", "fff", "gg", "hhhh"},
+                                 {1, 1, 1, 0, 1, 1, 0, 1});
+  auto input = cudf::table_view({floats, integers, strings});
+
+  expect_buffers_match_hash_partition(input, {0, 2}, 3);
+  expect_buffers_match_hash_partition(input, {1}, 4);
+  expect_buffers_match_hash_partition(input, {1}, 20);
+}
+
+TEST_F(HashPartition, ManyPartitionsStringKeys)
+{
+  std::vector<std::string> keys(5000);
+  std::vector<int32_t> values(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i]   = "key" + std::to_string(i % 3000);
+    values[i] = static_cast<int32_t>(i);
+  }
+  strings_column_wrapper strings(keys.begin(), keys.end());
+  fixed_width_column_wrapper<int32_t> integers(values.begin(), values.end());
+  auto input = cudf::table_view({strings, integers});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::hash_partition(input, {0}, 4096);
+  EXPECT_EQ(4096u, offsets.size());
+  expect_table_properties_equal(input, output->view());
+
+  // Both results assign rows to partitions independently of each other
+  expect_buffers_match_hash_partition(input, {0}, 4096);
+  expect_buffers_match_hash_partition(input, {0, 1}, 1500);
+}
+
+TEST_F(HashPartition, ToBuffersZeroRows)
+{
+  fixed_width_column_wrapper<int32_t> integers({});
+  strings_column_wrapper strings({});
+  auto input = cudf::table_view({integers, strings});
+
+  auto const result = cudf::hash_partition_to_buffers(input, {0}, 3);
+  ASSERT_EQ(3u, result.size());
+  for (auto const& partition : result) {
+    EXPECT_EQ(input.num_columns(), partition.table.num_columns());
+    EXPECT_EQ(0, partition.table.num_rows());
+  }
+  EXPECT_TRUE(cudf::hash_partition_to_buffers(input, {0}, 0).empty());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
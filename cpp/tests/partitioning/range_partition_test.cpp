@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <random>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+class RangePartition : public cudf::test::BaseFixture {
+};
+
+/**
+ * @brief Verifies that the partitions of `result` are ordered ranges of `input`.
+ *
+ * Sorting every partition and concatenating them must give the fully sorted input.
+ */
+void expect_ordered_partitions(
+  cudf::table_view const& input,
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>> const& result,
+  cudf::size_type num_partitions,
+  std::vector<cudf::order> const& column_order         = {},
+  std::vector<cudf::null_order> const& null_precedence = {})
+{
+  auto const& offsets = result.second;
+  ASSERT_EQ(static_cast<size_t>(num_partitions + 1), offsets.size());
+  EXPECT_EQ(0, offsets.front());
+  EXPECT_EQ(input.num_rows(), offsets.back());
+
+  std::vector<std::unique_ptr<cudf::table>> sorted_partitions;
+  std::vector<cudf::table_view> views;
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    auto const partition = cudf::slice(result.first->view(), {offsets[p], offsets[p + 1]});
+    sorted_partitions.push_back(cudf::sort(partition.front(), column_order, null_precedence));
+    views.push_back(sorted_partitions.back()->view());
+  }
+  cudf::test::expect_tables_equal(cudf::sort(input, column_order, null_precedence)->view(),
+                                  cudf::concatenate(views)->view());
+}
+
+TEST_F(RangePartition, ZeroPartitionsOrRows)
+{
+  fixed_width_column_wrapper<int32_t> keys({3, 1, 2});
+  fixed_width_column_wrapper<int32_t> empty_keys({});
+
+  auto result = cudf::range_partition(cudf::table_view({keys}), {0}, 0);
+  EXPECT_TRUE(result.second.empty());
+  EXPECT_EQ(0, result.first->num_rows());
+
+  result = cudf::range_partition(cudf::table_view({empty_keys}), {0}, 3);
+  EXPECT_TRUE(result.second.empty());
+  EXPECT_EQ(0, result.first->num_rows());
+}
+
+TEST_F(RangePartition, InvalidKeyColumns)
+{
+  fixed_width_column_wrapper<int32_t> keys({3, 1, 2});
+  EXPECT_THROW(cudf::range_partition(cudf::table_view({keys}), {1}, 2), std::out_of_range);
+}
+
+TEST_F(RangePartition, SmallInput)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 1, 8, 3, 9, 2, 7, 4, 6, 0});
+  strings_column_wrapper values({"5", "1", "8", "3", "9", "2", "7", "4", "6", "0"});
+  auto input = cudf::table_view({keys, values});
+
+  auto const result = cudf::range_partition(input, {0}, 2);
+  EXPECT_EQ((std::vector<cudf::size_type>{0, 5, 10}), result.second);
+  expect_ordered_partitions(input, result, 2);
+}
+
+TEST_F(RangePartition, DuplicateKeys)
+{
+  fixed_width_column_wrapper<int32_t> keys({7, 7, 7, 7, 7, 7});
+  auto input = cudf::table_view({keys});
+
+  // Every row equals every splitter and lands in the last partition
+  auto const result = cudf::range_partition(input, {0}, 3);
+  EXPECT_EQ((std::vector<cudf::size_type>{0, 0, 0, 6}), result.second);
+  expect_ordered_partitions(input, result, 3);
+}
+
+TEST_F(RangePartition, DescendingWithNulls)
+{
+  fixed_width_column_wrapper<int32_t> keys({4, 1, 1, 3, 0, 2, 4, 3, 0, 2, 1, 4},
+                                           {1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1});
+  strings_column_wrapper names({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l"});
+  auto input = cudf::table_view({keys, names});
+
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER,
+                                                      cudf::null_order::AFTER};
+  auto const result = cudf::range_partition(input, {0, 1}, 4, column_order, null_precedence);
+  expect_ordered_partitions(input, result, 4, column_order, null_precedence);
+}
+
+TEST_F(RangePartition, LargeInput)
+{
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+  std::vector<int64_t> values(5000);
+  std::generate(values.begin(), values.end(), [&]() { return dist(engine); });
+  fixed_width_column_wrapper<int64_t> keys(values.begin(), values.end());
+  auto input = cudf::table_view({keys});
+
+  auto const result = cudf::range_partition(input, {0}, 7);
+  expect_ordered_partitions(input, result, 7);
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/comms/shuffle.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+namespace {
+/**
+ * @brief Messages in flight between the ranks of a `thread_communicator` group
+ */
+struct mailboxes {
+  std::mutex mutex;
+  std::condition_variable arrived;
+  std::map<std::pair<int, int>, std::deque<rmm::device_buffer>> messages;
+};
+
+/**
+ * @brief Communicator between ranks running on threads of the same process and GPU
+ *
+ * Sends are copied eagerly into the mailbox of the destination; receives are completed by
+ * `waitall`.
+ */
+class thread_communicator : public cudf::comms::communicator {
+ public:
+  thread_communicator(int rank, int size, mailboxes& boxes)
+    : _rank{rank}, _size{size}, _boxes{boxes}
+  {
+  }
+
+  int rank() const override { return _rank; }
+  int size() const override { return _size; }
+
+  void isend(void const* data, size_t size, int peer, cudaStream_t stream) override
+  {
+    rmm::device_buffer message(data, size, stream);
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    std::lock_guard<std::mutex> lock(_boxes.mutex);
+    _boxes.messages[{_rank, peer}].push_back(std::move(message));
+    _boxes.arrived.notify_all();
+  }
+
+  void irecv(void* data, size_t size, int peer, cudaStream_t) override
+  {
+    _pending.push_back({data, size, peer});
+  }
+
+  void waitall(cudaStream_t stream) override
+  {
+    for (auto const& recv : _pending) {
+      std::unique_lock<std::mutex> lock(_boxes.mutex);
+      auto& queue = _boxes.messages[{recv.peer, _rank}];
+      _boxes.arrived.wait(lock, [&queue] { return !queue.empty(); });
+      auto message = std::move(queue.front());
+      queue.pop_front();
+      lock.unlock();
+      CUDF_EXPECTS(message.size() == recv.size, "Received message size mismatch");
+      CUDA_TRY(cudaMemcpyAsync(recv.data, message.data(), recv.size, cudaMemcpyDefault, stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
+    _pending.clear();
+  }
+
+ private:
+  struct pending_recv {
+    void* data;
+    size_t size;
+    int peer;
+  };
+
+  int _rank;
+  int _size;
+  mailboxes& _boxes;
+  std::vector<pending_recv> _pending;
+};
+
+}  // namespace
+
+class ShuffleTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ShuffleTest, AllToAll)
+{
+  int const num_ranks = 3;
+  fixed_width_column_wrapper<int32_t> keys0({1, 2, 3, 4, 5, 6, 7});
+  strings_column_wrapper strings0({"a", "bb", "ccc", "d", "ee", "fff", "g"});
+  fixed_width_column_wrapper<int32_t> keys1({8, 9, 10, 11}, {1, 0, 1, 1});
+  strings_column_wrapper strings1({"hh", "i", "jjj", "k"}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<int32_t> keys2({12, 13, 14, 15, 16, 17, 18, 19, 20});
+  strings_column_wrapper strings2({"l", "m", "nn", "o", "pp", "q", "r", "ss", "t"});
+  std::vector<cudf::table_view> inputs{cudf::table_view{{keys0, strings0}},
+                                       cudf::table_view{{keys1, strings1}},
+                                       cudf::table_view{{keys2, strings2}}};
+  std::vector<cudf::size_type> const columns_to_hash{0};
+
+  mailboxes boxes;
+  std::vector<std::unique_ptr<cudf::table>> results(num_ranks);
+  std::vector<std::thread> ranks;
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    ranks.emplace_back([&, rank] {
+      // Every rank shuffles on its own stream
+      cudaStream_t stream;
+      CUDA_TRY(cudaStreamCreate(&stream));
+      thread_communicator comm(rank, num_ranks, boxes);
+      results[rank] = cudf::comms::all_to_all_shuffle(inputs[rank],
+                                                      columns_to_hash,
+                                                      comm,
+                                                      cudf::hash_id::HASH_MURMUR3,
+                                                      rmm::mr::get_default_resource(),
+                                                      stream);
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      CUDA_TRY(cudaStreamDestroy(stream));
+    });
+  }
+  for (auto& rank : ranks) { rank.join(); }
+
+  // Every rank holds the rows of its hash partition of the whole input
+  auto const whole    = cudf::concatenate(inputs);
+  auto const expected = cudf::hash_partition(*whole, columns_to_hash, num_ranks);
+  auto offsets        = expected.second;
+  offsets.push_back(whole->num_rows());
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    ASSERT_NE(results[rank], nullptr);
+    auto const slice =
+      cudf::slice(expected.first->view(), {offsets[rank], offsets[rank + 1]}).front();
+    auto const expected_sorted = cudf::sort(slice);
+    auto const result_sorted   = cudf::sort(results[rank]->view());
+    cudf::test::expect_tables_equal(*expected_sorted, *result_sorted);
+  }
+}
@@ -27,6 +27,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/quantiles.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/utilities/error.hpp>
 
 using namespace cudf;
@@ -173,3 +174,53 @@ TYPED_TEST(QuantilesTest, TestMultiColumnAssumedSorted)
 
   expect_tables_equal(expected, actual->view());
 }
+
+template <typename T>
+struct QuantilesSelectionTest : public BaseFixture {
+};
+
+TYPED_TEST_CASE(QuantilesSelectionTest, NumericTypes);
+
+TYPED_TEST(QuantilesSelectionTest, TestMatchesSortedQuantiles)
+{
+  using T = TypeParam;
+
+  auto input_a = fixed_width_column_wrapper<T>({5, 3, 1, 4, 1, 0, 2, 5, 3, 4, 2, 0, 1},
+                                               {1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+  auto input   = table_view({input_a});
+
+  std::vector<double> q{0.0, 0.25, 0.5, 0.7, 1.0};
+  for (auto interp : {interpolation::LOWER, interpolation::HIGHER, interpolation::NEAREST}) {
+    for (auto column_order : {order::ASCENDING, order::DESCENDING}) {
+      for (auto null_precedence : {null_order::BEFORE, null_order::AFTER}) {
+        auto actual = quantiles(input, q, interp, sorted::NO, {column_order}, {null_precedence});
+        auto sorted = sort(input, {column_order}, {null_precedence});
+        auto expected = quantiles(sorted->view(), q, interp, sorted::YES);
+        expect_tables_equal(expected->view(), actual->view());
+      }
+    }
+  }
+}
+
+struct QuantilesSelectionMultiColumnTest : public BaseFixture {
+};
+
+TEST_F(QuantilesSelectionMultiColumnTest, TestPackedKeys)
+{
+  auto input_a = fixed_width_column_wrapper<int16_t>({3, 1, 2, 1, 3, 2, 1, 3, 2, 1});
+  auto input_b = fixed_width_column_wrapper<int8_t>({0, 5, 2, -1, 3, 2, 5, -4, 1, 0},
+                                                    {1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+  auto input   = table_view({input_a, input_b});
+
+  auto actual = quantiles(input,
+                          {0.0, 0.4, 0.5, 1.0},
+                          interpolation::NEAREST,
+                          sorted::NO,
+                          {order::ASCENDING, order::DESCENDING},
+                          {null_order::AFTER, null_order::AFTER});
+
+  auto expected_a = fixed_width_column_wrapper<int16_t>({1, 2, 2, 3});
+  auto expected_b = fixed_width_column_wrapper<int8_t>({5, 2, 2, -4});
+
+  expect_tables_equal(table_view({expected_a, expected_b}), actual->view());
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/quantiles.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace cudf::test;
+
+struct TDigestTest : public BaseFixture {
+  static void expect_near(cudf::column_view const& estimates,
+                          std::vector<double> const& expected,
+                          double tolerance)
+  {
+    auto const host = to_host<double>(estimates).first;
+    ASSERT_EQ(host.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) { EXPECT_NEAR(host[i], expected[i], tolerance); }
+  }
+
+  static fixed_width_column_wrapper<int32_t> sequence(int32_t begin, int32_t end)
+  {
+    return fixed_width_column_wrapper<int32_t>(thrust::make_counting_iterator(begin),
+                                               thrust::make_counting_iterator(end));
+  }
+};
+
+TEST_F(TDigestTest, FewValues)
+{
+  cudf::tdigest digest;
+  digest.add(fixed_width_column_wrapper<int32_t>({1, 2, 0, 3}, {1, 1, 0, 1}));
+  digest.add(fixed_width_column_wrapper<double>({4, 5, std::nan("")}));
+  EXPECT_EQ(digest.count(), 5);
+
+  auto const result = digest.quantile({0, 0.5, 1});
+  expect_columns_equal(*result, fixed_width_column_wrapper<double>({1, 3, 5}));
+}
+
+TEST_F(TDigestTest, Batches)
+{
+  cudf::tdigest digest;
+  int32_t const batch_size  = 10000;
+  int32_t const num_batches = 10;
+  for (int32_t batch = 0; batch < num_batches; ++batch) {
+    // Sorted batches, so that the centroids of earlier batches are merged with larger values
+    digest.add(sequence(batch * batch_size, (batch + 1) * batch_size));
+  }
+  EXPECT_EQ(digest.count(), batch_size * num_batches);
+  EXPECT_LE(digest.centroids().num_rows(), digest.compression() / 2 + 1);
+
+  auto const max = batch_size * num_batches - 1;
+  auto const q   = std::vector<double>{0, 0.01, 0.25, 0.5, 0.75, 0.99, 1};
+  std::vector<double> expected;
+  for (auto quantile : q) { expected.push_back(quantile * max); }
+  expect_near(*digest.quantile(q), expected, 0.01 * max);
+}
+
+TEST_F(TDigestTest, Merge)
+{
+  cudf::tdigest lower;
+  cudf::tdigest upper;
+  lower.add(sequence(0, 50000));
+  upper.add(sequence(50000, 100000));
+  lower.merge(upper);
+  EXPECT_EQ(lower.count(), 100000);
+  EXPECT_LE(lower.centroids().num_rows(), lower.compression() / 2 + 1);
+
+  expect_near(*lower.quantile({0, 0.1, 0.5, 0.9, 1}),
+              {0, 0.1 * 99999, 0.5 * 99999, 0.9 * 99999, 99999},
+              0.01 * 99999);
+
+  cudf::tdigest other(200);
+  EXPECT_THROW(lower.merge(other), cudf::logic_error);
+}
+
+TEST_F(TDigestTest, Empty)
+{
+  cudf::tdigest digest;
+  digest.add(fixed_width_column_wrapper<float>({1, 2}, {0, 0}));
+  EXPECT_EQ(digest.count(), 0);
+
+  auto const result = digest.quantile({0, 0.5});
+  expect_columns_equal(*result, fixed_width_column_wrapper<double>({0, 0}, {0, 0}));
+  EXPECT_EQ(digest.quantile({})->size(), 0);
+}
+
+TEST_F(TDigestTest, Errors)
+{
+  EXPECT_THROW(cudf::tdigest(0), cudf::logic_error);
+
+  cudf::tdigest digest;
+  EXPECT_THROW(digest.add(strings_column_wrapper({"a", "b"})), cudf::logic_error);
+}
@@ -18,11 +18,14 @@
 #include <vector>
 
 #include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/selection.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
 #include <thrust/device_vector.h>
@@ -847,6 +850,54 @@ TYPED_TEST(ReductionTest, Quantile)
                        cudf::make_quantile_aggregation({1}, interp));
 }
 
+TYPED_TEST(ReductionTest, ApproxQuantile)
+{
+  using T = TypeParam;
+  //{-20, -14, -13,  0, 6, 13, 45, 64/None}
+  std::vector<int> int_values({6, -14, 13, 64, 0, -13, -20, 45});
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 1});
+  std::vector<T> v = convert_values<T>(int_values);
+
+  // Below the compression, every value is its own centroid and the estimates are exact
+  // test without nulls
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  double expected_value0 = std::is_same<T, bool>::value || std::is_unsigned<T>::value ? v[4] : v[6];
+  this->reduction_test(
+    col, expected_value0, this->ret_non_arithmetic, cudf::make_approx_quantile_aggregation({0.0}));
+  double expected_median = [] {
+    if (std::is_same<T, bool>::value) return 1.0;
+    if (std::is_signed<T>::value) return 3.0;
+    return 13.5;
+  }();
+  this->reduction_test(
+    col, expected_median, this->ret_non_arithmetic, cudf::make_approx_quantile_aggregation({0.5}));
+  double expected_value1 = v[3];
+  this->reduction_test(
+    col, expected_value1, this->ret_non_arithmetic, cudf::make_approx_quantile_aggregation({1.0}));
+
+  // test with nulls
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  double expected_null_median                         = [] {
+    if (std::is_same<T, bool>::value) return 1.0;
+    if (std::is_signed<T>::value) return 0.0;
+    return 13.0;
+  }();
+  double expected_null_value1 = v[7];
+
+  this->reduction_test(col_nulls,
+                       expected_null_median,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_quantile_aggregation({0.5}));
+  this->reduction_test(col_nulls,
+                       expected_null_value1,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_quantile_aggregation({1.0}));
+
+  auto const quartiles = cudf::make_approx_quantile_aggregation({0.25, 0.75});
+  EXPECT_THROW(cudf::reduce(col, quartiles, cudf::data_type{cudf::type_id::FLOAT64}),
+               cudf::logic_error);
+}
+
 TYPED_TEST(ReductionTest, UniqueCount)
 {
   using T = TypeParam;
@@ -881,4 +932,155 @@ TYPED_TEST(ReductionTest, UniqueCount)
                        cudf::make_nunique_aggregation(cudf::null_policy::EXCLUDE));
 }
 
+// With 2^16 registers, sketches of a few values are exact
+TYPED_TEST(ReductionTest, ApproxUniqueCount)
+{
+  using T = TypeParam;
+  std::vector<int> int_values({1, -3, 1, 2, 0, 2, -4, 45});  // 6 unique values
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 1});
+  std::vector<T> v = convert_values<T>(int_values);
+
+  // test without nulls
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  cudf::size_type expected_value = std::is_same<T, bool>::value ? 2 : 6;
+  this->reduction_test(col,
+                       expected_value,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_nunique_aggregation(16, cudf::null_policy::EXCLUDE));
+
+  // test with nulls
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  cudf::size_type expected_null_value0                = std::is_same<T, bool>::value ? 3 : 7;
+  cudf::size_type expected_null_value1                = std::is_same<T, bool>::value ? 2 : 6;
+
+  this->reduction_test(col_nulls,
+                       expected_null_value0,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_nunique_aggregation(16, cudf::null_policy::INCLUDE));
+  this->reduction_test(col_nulls,
+                       expected_null_value1,
+                       this->ret_non_arithmetic,
+                       cudf::make_approx_nunique_aggregation(16, cudf::null_policy::EXCLUDE));
+}
+
+struct TableReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TableReductionTest, MatchesColumnReductions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({5, -2, 0, 7, 3}, {1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.5, 2.5, -4., 0.25, 8.});
+  cudf::test::fixed_width_column_wrapper<bool> bools({true, false, true, true, false},
+                                                     {1, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int8_t> nulls({1, 2, 3, 4, 5}, {0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s> times({10, 30, 20, 0, 5},
+                                                                  {1, 1, 1, 0, 1});
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::EXCLUDE));
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+  auto const arithmetic_aggs = aggs.size();
+  aggs.push_back(cudf::make_product_aggregation());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation());
+  aggs.push_back(cudf::make_any_aggregation());
+  aggs.push_back(cudf::make_all_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_variance_aggregation());
+
+  // Only min, max and the counts are applied to the timestamp column, and the logical
+  // reductions in addition to those to the boolean column
+  auto const min_max_and_counts = [&aggs, arithmetic_aggs](bool with_logical) {
+    std::vector<std::unique_ptr<aggregation>> subset;
+    for (size_t j = 1; j < arithmetic_aggs; ++j) {
+      subset.push_back(std::make_unique<aggregation>(aggs[j]->kind));
+    }
+    if (with_logical) {
+      subset.push_back(cudf::make_any_aggregation());
+      subset.push_back(cudf::make_all_aggregation());
+    }
+    return subset;
+  };
+  auto const time_aggs = min_max_and_counts(false);
+  auto const bool_aggs = min_max_and_counts(true);
+
+  auto const check = [](cudf::column_view const& col,
+                        std::vector<std::unique_ptr<aggregation>> const& aggs) {
+    auto const result = cudf::reduce(cudf::table_view{{col}}, aggs);
+    ASSERT_EQ(result->num_columns(), static_cast<cudf::size_type>(aggs.size()));
+    for (size_t j = 0; j < aggs.size(); ++j) {
+      auto const& got = result->get_column(j);
+      ASSERT_EQ(got.size(), 1);
+      auto const kind = aggs[j]->kind;
+      if (kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL) {
+        cudf::test::fixed_width_column_wrapper<cudf::size_type> expected(
+          {kind == aggregation::COUNT_ALL ? col.size() : col.size() - col.null_count()});
+        cudf::test::expect_columns_equivalent(expected, got);
+        continue;
+      }
+      auto const expected =
+        cudf::make_column_from_scalar(*cudf::reduce(col, aggs[j], got.type()), 1);
+      cudf::test::expect_columns_equivalent(*expected, got);
+    }
+  };
+  check(ints, aggs);
+  check(doubles, aggs);
+  check(nulls, aggs);
+  check(bools, bool_aggs);
+  check(times, time_aggs);
+
+  // Column `i * aggs.size() + j` is the reduction of column `i` by `aggs[j]`
+  auto const result = cudf::reduce(cudf::table_view{{ints, doubles}}, aggs);
+  ASSERT_EQ(result->num_columns(), static_cast<cudf::size_type>(2 * aggs.size()));
+  EXPECT_EQ(result->get_column(1).type(), cudf::data_type{cudf::INT32});
+  EXPECT_EQ(result->get_column(aggs.size()).type(), cudf::data_type{cudf::FLOAT64});
+  EXPECT_EQ(result->get_column(0).type(), cudf::data_type{cudf::INT64});
+  EXPECT_EQ(result->get_column(arithmetic_aggs - 1).type(), cudf::data_type{cudf::INT32});
+}
+
+struct SelectionReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SelectionReductionTest, Selection)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4, 5, 6, 7, 8},
+                                                      {1, 1, 0, 1, 1, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> indices({6, 0, 2, 3});
+  cudf::test::fixed_width_column_wrapper<bool> mask({1, 0, 1, 1, 0, 0, 1, 1},
+                                                    {1, 1, 1, 1, 1, 1, 0, 1});
+  auto const output_dtype = cudf::data_type{cudf::INT64};
+
+  for (auto const& rows : {cudf::selection{indices}, cudf::selection{mask}}) {
+    auto const selected = cudf::apply_selection(cudf::table_view{{col}}, rows);
+    auto const aggs     = {cudf::make_sum_aggregation(),
+                       cudf::make_min_aggregation(),
+                       cudf::make_max_aggregation()};
+    for (auto const& agg : aggs) {
+      auto const expected = cudf::reduce(selected->get_column(0), agg, output_dtype);
+      auto const result   = cudf::reduce(col, rows, agg, output_dtype);
+      ASSERT_EQ(result->is_valid(), expected->is_valid());
+      using ScalarType = cudf::scalar_type_t<int64_t>;
+      EXPECT_EQ(static_cast<ScalarType*>(result.get())->value(),
+                static_cast<ScalarType*>(expected.get())->value());
+    }
+
+    // The null rows of the selection are counted, the unselected rows are not
+    auto const nunique  = cudf::make_nunique_aggregation(cudf::null_policy::INCLUDE);
+    auto const expected = cudf::reduce(selected->get_column(0), nunique, output_dtype);
+    auto const result   = cudf::reduce(col, rows, nunique, output_dtype);
+    using CountType     = cudf::scalar_type_t<cudf::size_type>;
+    EXPECT_EQ(static_cast<CountType*>(result.get())->value(),
+              static_cast<CountType*>(expected.get())->value());
+  }
+
+  cudf::test::fixed_width_column_wrapper<bool> short_mask({1, 0});
+  EXPECT_THROW(cudf::reduce(col, cudf::selection{short_mask}, cudf::make_sum_aggregation(),
+                            output_dtype),
+               cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<float> floats({1, 2});
+  EXPECT_THROW(cudf::selection{floats}, cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
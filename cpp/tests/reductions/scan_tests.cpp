@@ -469,3 +469,120 @@ TYPED_TEST(ScanTest, EmptyColumnskip_nulls)
   cudf::test::expect_column_properties_equal(expected_col_out2, col_out->view());
   cudf::test::expect_columns_equal(expected_col_out2, col_out->view());
 }
+
+template <typename T>
+struct SegmentedScanTest : public cudf::test::BaseFixture {
+};
+
+using SegmentedScanTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+TYPED_TEST_CASE(SegmentedScanTest, SegmentedScanTypes);
+
+// clang-format off
+TYPED_TEST(SegmentedScanTest, SumMin)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T>               input  ({1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                                  {1, 1, 1, 0, 1, 1, 0, 0, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 3, 3, 6, 9};
+
+  cudf::test::fixed_width_column_wrapper<T> expect_sum          ({1, 3, 6, 0, 5, 11, 0, 0, 9},
+                                                                 {1, 1, 1, 0, 1,  1, 0, 0, 1});
+  cudf::test::fixed_width_column_wrapper<T> expect_sum_nulls    ({1, 3, 6, 0, 0,  0, 0, 0, 0},
+                                                                 {1, 1, 1, 0, 0,  0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<T> expect_exclusive_sum({0, 1, 3, 0, 0,  5, 0, 0, 0},
+                                                                 {1, 1, 1, 0, 1,  1, 0, 0, 1});
+  cudf::test::fixed_width_column_wrapper<T> expect_min          ({1, 1, 1, 0, 5,  5, 0, 0, 9},
+                                                                 {1, 1, 1, 0, 1,  1, 0, 0, 1});
+
+  cudf::test::expect_columns_equal(
+    expect_sum,
+    *cudf::segmented_scan(input, offsets, cudf::make_sum_aggregation(), scan_type::INCLUSIVE));
+  cudf::test::expect_columns_equal(
+    expect_sum_nulls,
+    *cudf::segmented_scan(
+      input, offsets, cudf::make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE));
+  cudf::test::expect_columns_equal(
+    expect_exclusive_sum,
+    *cudf::segmented_scan(input, offsets, cudf::make_sum_aggregation(), scan_type::EXCLUSIVE));
+  cudf::test::expect_columns_equal(
+    expect_min,
+    *cudf::segmented_scan(input, offsets, cudf::make_min_aggregation(), scan_type::INCLUSIVE));
+}
+// clang-format on
+
+TYPED_TEST(SegmentedScanTest, SingleSegmentMatchesScan)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T> input({5, 1, 4, 2, 3, 6}, {1, 0, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 6};
+
+  for (auto null_handling : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+    cudf::test::expect_columns_equal(
+      *cudf::scan(input, cudf::make_max_aggregation(), scan_type::INCLUSIVE, null_handling),
+      *cudf::segmented_scan(
+        input, offsets, cudf::make_max_aggregation(), scan_type::INCLUSIVE, null_handling));
+  }
+}
+
+struct RankScanTest : public cudf::test::BaseFixture {
+};
+
+// clang-format off
+TEST_F(RankScanTest, SortedIntegers)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t>         input  ({1, 1, 2, 3, 3, 5, 5, 6, 0, 0},
+                                                                  {1, 1, 1, 1, 1, 1, 1, 1, 0, 0});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 5, 10};
+
+  using ranks = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+  ranks expect_rank                {1, 1, 3, 4, 4, 6, 6, 8, 9, 9};
+  ranks expect_dense_rank          {1, 1, 2, 3, 3, 4, 4, 5, 6, 6};
+  ranks expect_segmented_rank      {1, 1, 3, 4, 4, 1, 1, 3, 4, 4};
+  ranks expect_segmented_dense_rank({1, 1, 2, 3, 3, 1, 1, 2, 3, 3},
+                                    {1, 1, 1, 1, 1, 1, 1, 1, 0, 0});
+
+  cudf::test::expect_columns_equal(
+    expect_rank,
+    *cudf::scan(input, cudf::make_rank_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE));
+  cudf::test::expect_columns_equal(
+    expect_dense_rank,
+    *cudf::scan(
+      input, cudf::make_dense_rank_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE));
+  cudf::test::expect_columns_equal(
+    expect_segmented_rank,
+    *cudf::segmented_scan(
+      input, offsets, cudf::make_rank_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE));
+  cudf::test::expect_columns_equal(
+    expect_segmented_dense_rank,
+    *cudf::segmented_scan(
+      input, offsets, cudf::make_dense_rank_aggregation(), scan_type::INCLUSIVE));
+
+  CUDF_EXPECT_THROW_MESSAGE(
+    cudf::scan(input, cudf::make_rank_aggregation(), scan_type::EXCLUSIVE),
+    "Rank scans must be inclusive");
+}
+// clang-format on
+
+TEST_F(RankScanTest, SortedStrings)
+{
+  cudf::test::strings_column_wrapper input{"a", "a", "b", "a", "c", "c"};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 3, 6};
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_rank{1, 1, 3, 4, 5, 5};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_segmented_rank{1, 1, 3, 1, 2, 2};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_segmented_dense_rank{
+    1, 1, 2, 1, 2, 2};
+
+  cudf::test::expect_columns_equal(
+    expect_rank, *cudf::scan(input, cudf::make_rank_aggregation(), scan_type::INCLUSIVE));
+  cudf::test::expect_columns_equal(
+    expect_segmented_rank,
+    *cudf::segmented_scan(input, offsets, cudf::make_rank_aggregation(), scan_type::INCLUSIVE));
+  cudf::test::expect_columns_equal(
+    expect_segmented_dense_rank,
+    *cudf::segmented_scan(
+      input, offsets, cudf::make_dense_rank_aggregation(), scan_type::INCLUSIVE));
+}
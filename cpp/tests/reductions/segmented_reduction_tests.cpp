@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/reduction.hpp>
+
+using cudf::size_type;
+using cudf::test::fixed_width_column_wrapper;
+
+template <typename T>
+struct SegmentedReductionTest : public cudf::test::BaseFixture {
+};
+
+using SegmentedReductionTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+TYPED_TEST_CASE(SegmentedReductionTest, SegmentedReductionTypes);
+
+// clang-format off
+TYPED_TEST(SegmentedReductionTest, SumMinMax)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T>         input   ({1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                 {1, 1, 1, 0, 1, 1, 0, 0, 1});
+  fixed_width_column_wrapper<size_type> offsets {0, 3, 3, 6, 8, 9};
+
+  fixed_width_column_wrapper<int64_t> expect_sum({ 6, 0, 11, 0, 9}, {1, 0, 1, 0, 1});
+  fixed_width_column_wrapper<T>       expect_min({ 1, 0,  5, 0, 9}, {1, 0, 1, 0, 1});
+  fixed_width_column_wrapper<T>       expect_max({ 3, 0,  6, 0, 9}, {1, 0, 1, 0, 1});
+
+  auto const dtype = cudf::column_view(input).type();
+  cudf::test::expect_columns_equal(
+    expect_sum,
+    *cudf::segmented_reduce(input, offsets, cudf::make_sum_aggregation(),
+                            cudf::data_type(cudf::INT64)));
+  cudf::test::expect_columns_equal(
+    expect_min, *cudf::segmented_reduce(input, offsets, cudf::make_min_aggregation(), dtype));
+  cudf::test::expect_columns_equal(
+    expect_max, *cudf::segmented_reduce(input, offsets, cudf::make_max_aggregation(), dtype));
+}
+
+TYPED_TEST(SegmentedReductionTest, ProductWithoutNulls)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T>         input   {1, 2, 3, 4, 5, 1};
+  fixed_width_column_wrapper<size_type> offsets {0, 2, 5, 5, 6};
+
+  fixed_width_column_wrapper<int64_t> expect({ 2, 60, 0, 1}, {1, 1, 0, 1});
+
+  cudf::test::expect_columns_equal(
+    expect,
+    *cudf::segmented_reduce(input, offsets, cudf::make_product_aggregation(),
+                            cudf::data_type(cudf::INT64)));
+}
+// clang-format on
+
+struct SegmentedReductionAnyAllTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReductionAnyAllTest, AnyAll)
+{
+  fixed_width_column_wrapper<bool> input({true, false, false, true, true, false, true},
+                                         {1, 1, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<size_type> offsets{0, 2, 3, 5, 6, 7};
+
+  fixed_width_column_wrapper<bool> expect_any({true, false, true, false, false}, {1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<bool> expect_all({false, false, true, false, false}, {1, 1, 1, 1, 0});
+
+  auto const bool_type = cudf::data_type(cudf::BOOL8);
+  cudf::test::expect_columns_equal(
+    expect_any, *cudf::segmented_reduce(input, offsets, cudf::make_any_aggregation(), bool_type));
+  cudf::test::expect_columns_equal(
+    expect_all, *cudf::segmented_reduce(input, offsets, cudf::make_all_aggregation(), bool_type));
+}
+
+struct SegmentedReductionErrorTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReductionErrorTest, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+  fixed_width_column_wrapper<size_type> offsets{0, 1, 3};
+  fixed_width_column_wrapper<int64_t> wide_offsets{0, 1, 3};
+
+  EXPECT_THROW(cudf::segmented_reduce(
+                 input, wide_offsets, cudf::make_sum_aggregation(), cudf::data_type(cudf::INT64)),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_reduce(
+                 input, offsets, cudf::make_mean_aggregation(), cudf::data_type(cudf::FLOAT64)),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_reduce(
+                 input, offsets, cudf::make_any_aggregation(), cudf::data_type(cudf::INT32)),
+               cudf::logic_error);
+}
@@ -277,6 +277,52 @@ TYPED_TEST(ClampTestNumeric, InputNulliWithReplace)
   cudf::test::expect_columns_equal(expected, got->view());
 }
 
+struct ClampInPlaceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ClampInPlaceTest, WithReplace)
+{
+  auto lo         = cudf::make_fixed_width_scalar<int32_t>(2);
+  auto lo_replace = cudf::make_fixed_width_scalar<int32_t>(16);
+  auto hi         = cudf::make_fixed_width_scalar<int32_t>(8);
+  auto hi_replace = cudf::make_fixed_width_scalar<int32_t>(32);
+
+  auto column = cudf::test::fixed_width_column_wrapper<int32_t>(
+                  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0})
+                  .release();
+  auto in_out = column->mutable_view();
+  cudf::clamp_in_place(in_out, *lo, *lo_replace, *hi, *hi_replace);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({0, 16, 2, 3, 4, 5, 6, 7, 8, 32, 10},
+                                                           {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0});
+  cudf::test::expect_columns_equivalent(expected, column->view());
+}
+
+TEST_F(ClampInPlaceTest, LowerNull)
+{
+  auto lo = cudf::make_fixed_width_scalar<int32_t>(2);
+  lo->set_valid(false);
+  auto hi = cudf::make_fixed_width_scalar<int32_t>(8);
+
+  auto column =
+    cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}).release();
+  auto in_out = column->mutable_view();
+  cudf::clamp_in_place(in_out, *lo, *hi);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 8});
+  cudf::test::expect_columns_equal(expected, column->view());
+}
+
+TEST_F(ClampInPlaceTest, StringColumn)
+{
+  auto lo = cudf::make_string_scalar("B");
+  auto hi = cudf::make_string_scalar("e");
+
+  auto column = cudf::test::strings_column_wrapper({"A", "b", "c"}).release();
+  auto in_out = column->mutable_view();
+  EXPECT_THROW(cudf::clamp_in_place(in_out, *lo, *hi), cudf::logic_error);
+}
+
 template <typename T>
 struct ClampFloatTest : public cudf::test::BaseFixture {
 };
@@ -26,6 +26,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/cudf_gtest.hpp>
+#include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
 struct ReplaceErrorTest : public cudf::test::BaseFixture {
@@ -243,6 +244,28 @@ TYPED_TEST(ReplaceNullsTest, ReplaceScalar)
                                   expectedColumn.begin(), expectedColumn.end()));
 }
 
+TYPED_TEST(ReplaceNullsTest, ReplaceScalarInPlace)
+{
+  std::vector<TypeParam> inputColumn =
+    cudf::test::make_type_param_vector<TypeParam>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  std::vector<cudf::valid_type> inputValid{0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  std::vector<TypeParam> expectedColumn =
+    cudf::test::make_type_param_vector<TypeParam>({1, 1, 1, 1, 1, 5, 6, 7, 8, 9});
+  cudf::numeric_scalar<TypeParam> replacement(1);
+
+  auto column = cudf::test::fixed_width_column_wrapper<TypeParam>(
+                  inputColumn.begin(), inputColumn.end(), inputValid.begin())
+                  .release();
+  auto in_out = column->mutable_view();
+  cudf::replace_nulls_in_place(in_out, replacement);
+
+  EXPECT_EQ(column->null_count(), 0);
+  cudf::test::expect_columns_equivalent(
+    *column,
+    cudf::test::fixed_width_column_wrapper<TypeParam>(expectedColumn.begin(),
+                                                      expectedColumn.end()));
+}
+
 TYPED_TEST(ReplaceNullsTest, ReplacementHasNulls)
 {
   using T = TypeParam;
@@ -297,4 +320,82 @@ TYPED_TEST(ReplaceNullsTest, LargeScaleScalar)
                                   expectedColumn.begin(), expectedColumn.end()));
 }
 
+TYPED_TEST(ReplaceNullsTest, ReplaceTableScalars)
+{
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T> col0({1, 2, 3, 4}, {1, 0, 0, 1});
+  cudf::test::fixed_width_column_wrapper<T> col1({5, 6, 7, 8});
+  cudf::test::strings_column_wrapper col2({"a", "", "c", ""}, {1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<T> col3({1, 2, 3, 4}, {0, 1, 1, 0});
+  cudf::numeric_scalar<T> replacement0(9);
+  cudf::numeric_scalar<T> replacement1(9);
+  cudf::string_scalar replacement2("z");
+  cudf::numeric_scalar<T> replacement3(9, false);
+
+  auto const result = cudf::replace_nulls(cudf::table_view{{col0, col1, col2, col3}},
+                                          {replacement0, replacement1, replacement2, replacement3});
+
+  cudf::test::fixed_width_column_wrapper<T> expected0({1, 9, 9, 4});
+  cudf::test::strings_column_wrapper expected2({"a", "z", "c", "z"});
+  cudf::test::expect_columns_equal(result->get_column(0), expected0);
+  cudf::test::expect_columns_equal(result->get_column(1), col1);
+  cudf::test::expect_columns_equal(result->get_column(2), expected2);
+  cudf::test::expect_columns_equal(result->get_column(3), col3);
+
+  EXPECT_THROW(cudf::replace_nulls(cudf::table_view{{col0, col1}}, {replacement0}),
+               cudf::logic_error);
+}
+
+TYPED_TEST(ReplaceNullsTest, ReplaceTablePolicy)
+{
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T> col0({1, 2, 3, 4, 5}, {1, 0, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<T> col1({1, 2, 3, 4, 5});
+  cudf::test::strings_column_wrapper col2({"", "b", "", "", "e"}, {0, 1, 0, 0, 1});
+  cudf::table_view input({col0, col1, col2});
+
+  auto const preceding = cudf::replace_nulls(input, cudf::replace_policy::PRECEDING);
+  cudf::test::expect_tables_equivalent(
+    *preceding,
+    cudf::table_view{{cudf::test::fixed_width_column_wrapper<T>({1, 1, 1, 4, 4}),
+                      col1,
+                      cudf::test::strings_column_wrapper({"", "b", "b", "b", "e"},
+                                                         {0, 1, 1, 1, 1})}});
+
+  auto const following = cudf::replace_nulls(input, cudf::replace_policy::FOLLOWING);
+  cudf::test::expect_tables_equivalent(
+    *following,
+    cudf::table_view{{cudf::test::fixed_width_column_wrapper<T>({1, 4, 4, 4, 5}, {1, 1, 1, 1, 0}),
+                      col1,
+                      cudf::test::strings_column_wrapper({"b", "b", "e", "e", "e"})}});
+
+  cudf::test::expect_columns_equivalent(
+    *cudf::replace_nulls(col0, cudf::replace_policy::PRECEDING),
+    cudf::test::fixed_width_column_wrapper<T>({1, 1, 1, 4, 4}));
+}
+
+TYPED_TEST(ReplaceNullsTest, LargeScalePolicy)
+{
+  std::vector<TypeParam> inputColumn(10000);
+  for (size_t i = 0; i < inputColumn.size(); i++) inputColumn[i] = i % 100;
+  std::vector<cudf::valid_type> inputValid(10000);
+  for (size_t i = 0; i < inputValid.size(); i++) inputValid[i] = (i % 7) == 1;
+  std::vector<TypeParam> expectedColumn(10000);
+  std::vector<cudf::valid_type> expectedValid(10000);
+  for (size_t i = 0; i < expectedColumn.size(); i++) {
+    auto const source = i - (i + 6) % 7;
+    expectedColumn[i] = i == 0 ? 0 : source % 100;
+    expectedValid[i]  = i > 0;
+  }
+
+  auto const result = cudf::replace_nulls(
+    cudf::test::fixed_width_column_wrapper<TypeParam>(
+      inputColumn.begin(), inputColumn.end(), inputValid.begin()),
+    cudf::replace_policy::PRECEDING);
+  cudf::test::expect_columns_equal(
+    *result,
+    cudf::test::fixed_width_column_wrapper<TypeParam>(
+      expectedColumn.begin(), expectedColumn.end(), expectedValid.begin()));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+
+#include <vector>
+
+using namespace cudf::test;
+
+struct ExplodeTest : public BaseFixture {
+};
+
+TEST_F(ExplodeTest, Basic)
+{
+  fixed_width_column_wrapper<int32_t> offsets{0, 2, 2, 5};
+  fixed_width_column_wrapper<int64_t> elements{1, 2, 3, 4, 5};
+  auto lists = cudf::make_lists_column(3, offsets.release(), elements.release(), 0, {});
+  strings_column_wrapper names{"a", "b", "c"};
+  fixed_width_column_wrapper<int32_t> ids{10, 20, 30};
+  cudf::table_view input{{names, lists->view(), ids}};
+
+  auto results = cudf::explode(input, 1);
+
+  strings_column_wrapper expected_names{"a", "a", "c", "c", "c"};
+  fixed_width_column_wrapper<int64_t> expected_elements{1, 2, 3, 4, 5};
+  fixed_width_column_wrapper<int32_t> expected_ids{10, 10, 30, 30, 30};
+  cudf::table_view expected{{expected_names, expected_elements, expected_ids}};
+  expect_tables_equal(results->view(), expected);
+}
+
+TEST_F(ExplodeTest, Position)
+{
+  fixed_width_column_wrapper<int32_t> offsets{0, 1, 1, 4};
+  strings_column_wrapper elements({"x", "y", "", "z"}, {1, 1, 0, 1});
+  auto lists = cudf::make_lists_column(3, offsets.release(), elements.release(), 0, {});
+  fixed_width_column_wrapper<int32_t> ids{1, 2, 3};
+  cudf::table_view input{{lists->view(), ids}};
+
+  auto results = cudf::explode_position(input, 0);
+
+  fixed_width_column_wrapper<int32_t> expected_positions{0, 0, 1, 2};
+  strings_column_wrapper expected_elements({"x", "y", "", "z"}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<int32_t> expected_ids{1, 3, 3, 3};
+  cudf::table_view expected{{expected_positions, expected_elements, expected_ids}};
+  expect_tables_equal(results->view(), expected);
+}
+
+TEST_F(ExplodeTest, NotAListsColumn)
+{
+  fixed_width_column_wrapper<int32_t> ids{1, 2, 3};
+  EXPECT_THROW(cudf::explode(cudf::table_view{{ids}}, 0), cudf::logic_error);
+}
@@ -163,6 +163,32 @@ TYPED_TEST(InterleaveColumnsTest, ThreeColumnsNullable)
   cudf::test::expect_columns_equal(expected, actual->view());
 }
 
+TYPED_TEST(InterleaveColumnsTest, ThreeColumnsLarge)
+{
+  using T = TypeParam;
+
+  // The output size is not a multiple of any wide store width
+  cudf::size_type const num_rows = 1001;
+  std::vector<std::vector<int32_t>> values(3, std::vector<int32_t>(num_rows));
+  std::vector<int32_t> expected_values(3 * num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    for (cudf::size_type j = 0; j < 3; ++j) {
+      values[j][i]               = (i + j) % 100;
+      expected_values[3 * i + j] = (i + j) % 100;
+    }
+  }
+  fixed_width_column_wrapper<T> a(values[0].begin(), values[0].end());
+  fixed_width_column_wrapper<T> b(values[1].begin(), values[1].end());
+  fixed_width_column_wrapper<T> c(values[2].begin(), values[2].end());
+
+  cudf::table_view in(std::vector<cudf::column_view>{a, b, c});
+
+  auto expected = fixed_width_column_wrapper<T>(expected_values.begin(), expected_values.end());
+  auto actual   = cudf::interleave_columns(in);
+
+  cudf::test::expect_columns_equal(expected, actual->view());
+}
+
 TYPED_TEST(InterleaveColumnsTest, MismatchedDtypes)
 {
   using T = TypeParam;
@@ -89,6 +89,37 @@ TYPED_TEST(TileTest, OneColumnNullable)
   cudf::test::expect_tables_equal(expected, actual->view());
 }
 
+TYPED_TEST(TileTest, OneColumnLarge)
+{
+  using T = TypeParam;
+
+  // The output size is not a multiple of any wide store width
+  cudf::size_type const num_rows = 1001;
+  std::vector<int32_t> values(num_rows);
+  std::vector<bool> validity(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    values[i]   = i % 100;
+    validity[i] = i % 7 != 0;
+  }
+  std::vector<int32_t> expected_values;
+  std::vector<bool> expected_validity;
+  for (int k = 0; k < 3; ++k) {
+    expected_values.insert(expected_values.end(), values.begin(), values.end());
+    expected_validity.insert(expected_validity.end(), validity.begin(), validity.end());
+  }
+
+  fixed_width_column_wrapper<T> in_a(values.begin(), values.end(), validity.begin());
+  cudf::table_view in(std::vector<cudf::column_view>{in_a});
+
+  fixed_width_column_wrapper<T> expected_a(
+    expected_values.begin(), expected_values.end(), expected_validity.begin());
+  cudf::table_view expected(std::vector<cudf::column_view>{expected_a});
+
+  auto actual = cudf::tile(in, 3);
+
+  cudf::test::expect_tables_equal(expected, actual->view());
+}
+
 TYPED_TEST(TileTest, OneColumnNegativeCount)
 {
   using T = TypeParam;
@@ -117,3 +148,23 @@ TYPED_TEST(TileTest, OneColumnZeroCount)
 
   cudf::test::expect_tables_equal(expected, actual->view());
 }
+
+struct TileMixedTest : public BaseFixture {
+};
+
+TEST_F(TileMixedTest, FixedWidthAndStrings)
+{
+  fixed_width_column_wrapper<int16_t> in_a({1, 2, 3}, {1, 0, 1});
+  strings_column_wrapper in_b({"a", "", "ccc"}, {1, 1, 0});
+  fixed_width_column_wrapper<double> in_c({0.5, 1.5, 2.5});
+  cudf::table_view in(std::vector<cudf::column_view>{in_a, in_b, in_c});
+
+  fixed_width_column_wrapper<int16_t> expected_a({1, 2, 3, 1, 2, 3}, {1, 0, 1, 1, 0, 1});
+  strings_column_wrapper expected_b({"a", "", "ccc", "a", "", "ccc"}, {1, 1, 0, 1, 1, 0});
+  fixed_width_column_wrapper<double> expected_c({0.5, 1.5, 2.5, 0.5, 1.5, 2.5});
+  cudf::table_view expected(std::vector<cudf::column_view>{expected_a, expected_b, expected_c});
+
+  auto actual = cudf::tile(in, 2);
+
+  cudf::test::expect_tables_equal(expected, actual->view());
+}
@@ -28,6 +28,7 @@
 
 #include <thrust/iterator/constant_iterator.h>
 
+#include <cmath>
 #include <vector>
 
 using cudf::bitmask_type;
@@ -137,6 +138,87 @@ TEST_F(RollingStringTest, ZeroWindowSize)
   cudf::test::expect_columns_equal(expected_count, got_count->view());
 }
 
+class RollingWindowFunctionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RollingWindowFunctionTest, VarianceStd)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 2, 4, 8, 16}, {1, 1, 0, 1, 1});
+
+  // windows [i, i + 1]
+  auto got_var       = cudf::rolling_window(input, 1, 1, 1, cudf::make_variance_aggregation());
+  auto got_std       = cudf::rolling_window(input, 1, 1, 1, cudf::make_std_aggregation());
+  auto got_var_ddof0 = cudf::rolling_window(input, 1, 1, 1, cudf::make_variance_aggregation(0));
+
+  fixed_width_column_wrapper<double> expected_var({0.5, 0, 0, 32, 0}, {1, 0, 0, 1, 0});
+  fixed_width_column_wrapper<double> expected_std({std::sqrt(0.5), 0, 0, std::sqrt(32.), 0},
+                                                  {1, 0, 0, 1, 0});
+  fixed_width_column_wrapper<double> expected_var_ddof0({0.25, 0, 0, 16, 0}, {1, 1, 1, 1, 1});
+
+  cudf::test::expect_columns_equivalent(expected_var, got_var->view());
+  cudf::test::expect_columns_equivalent(expected_std, got_std->view());
+  cudf::test::expect_columns_equivalent(expected_var_ddof0, got_var_ddof0->view());
+}
+
+TEST_F(RollingWindowFunctionTest, NthElement)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 2, 4, 8, 16}, {1, 1, 0, 1, 1});
+
+  // windows [i - 1, i + 1]
+  auto nth = [&input](size_type n, cudf::null_policy null_handling) {
+    return cudf::rolling_window(
+      input, 2, 1, 1, cudf::make_nth_element_aggregation(n, null_handling));
+  };
+
+  fixed_width_column_wrapper<int32_t> expected_first({1, 1, 2, 0, 8}, {1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<int32_t> expected_last({2, 0, 8, 16, 16}, {1, 0, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> expected_first_valid({1, 1, 2, 8, 8}, {1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> expected_last_valid({2, 2, 8, 16, 16}, {1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> expected_third({0, 0, 8, 16, 0}, {0, 0, 1, 1, 0});
+
+  cudf::test::expect_columns_equal(expected_first, nth(0, cudf::null_policy::INCLUDE)->view());
+  cudf::test::expect_columns_equal(expected_last, nth(-1, cudf::null_policy::INCLUDE)->view());
+  cudf::test::expect_columns_equal(expected_first_valid,
+                                   nth(0, cudf::null_policy::EXCLUDE)->view());
+  cudf::test::expect_columns_equal(expected_last_valid,
+                                   nth(-1, cudf::null_policy::EXCLUDE)->view());
+  cudf::test::expect_columns_equal(expected_third, nth(2, cudf::null_policy::INCLUDE)->view());
+}
+
+TEST_F(RollingWindowFunctionTest, LeadLag)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 2, 4, 8, 16}, {1, 1, 0, 1, 1});
+
+  // windows [i - 1, i + 1]
+  auto got_lead = cudf::rolling_window(input, 2, 1, 1, cudf::make_lead_aggregation(1));
+  auto got_lag  = cudf::rolling_window(input, 2, 1, 1, cudf::make_lag_aggregation(1));
+  auto got_lag2 = cudf::rolling_window(input, 2, 1, 1, cudf::make_lag_aggregation(2));
+
+  fixed_width_column_wrapper<int32_t> expected_lead({2, 0, 8, 16, 0}, {1, 0, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> expected_lag({0, 1, 2, 0, 8}, {0, 1, 1, 0, 1});
+  fixed_width_column_wrapper<int32_t> expected_lag2({0, 0, 0, 0, 0}, {0, 0, 0, 0, 0});
+
+  cudf::test::expect_columns_equal(expected_lead, got_lead->view());
+  cudf::test::expect_columns_equal(expected_lag, got_lag->view());
+  cudf::test::expect_columns_equal(expected_lag2, got_lag2->view());
+
+  EXPECT_THROW(cudf::make_lead_aggregation(-1), cudf::logic_error);
+}
+
+TEST_F(RollingWindowFunctionTest, StringLeadLag)
+{
+  cudf::test::strings_column_wrapper input({"a", "b", "c", "d"}, {1, 1, 0, 1});
+
+  auto got_lead = cudf::rolling_window(input, 1, 1, 1, cudf::make_lead_aggregation(1));
+  auto got_lag  = cudf::rolling_window(input, 2, 0, 1, cudf::make_lag_aggregation(1));
+
+  cudf::test::strings_column_wrapper expected_lead({"b", "", "d", ""}, {1, 0, 1, 0});
+  cudf::test::strings_column_wrapper expected_lag({"", "a", "b", ""}, {0, 1, 1, 0});
+
+  cudf::test::expect_columns_equal(expected_lead, got_lead->view());
+  cudf::test::expect_columns_equal(expected_lag, got_lag->view());
+}
+
 template <typename T>
 class RollingTest : public cudf::test::BaseFixture {
  protected:
@@ -712,6 +794,107 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// random input data, static parameters, windows large enough to avoid the per-row window loop
+TYPED_TEST(RollingTest, RandomStaticLargeWindow)
+{
+  size_type num_rows = 10000;
+
+  // random input with nulls
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  std::vector<size_type> preceding_window({700});
+  std::vector<size_type> following_window({300});
+
+  this->run_test_col_agg(input, preceding_window, following_window, 1);
+  this->run_test_col_agg(input, preceding_window, following_window, 450);
+}
+
+// random input data, dynamic parameters, windows large enough to avoid the per-row window loop
+TYPED_TEST(RollingTest, RandomDynamicLargeWindow)
+{
+  size_type num_rows        = 10000;
+  size_type max_window_size = 1000;
+
+  // random input with nulls
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  // random parameters
+  cudf::test::UniformRandomGenerator<size_type> window_rng(0, max_window_size);
+  auto generator = [&]() { return window_rng.generate(); };
+
+  std::vector<size_type> preceding_window(num_rows);
+  std::vector<size_type> following_window(num_rows);
+
+  std::generate(preceding_window.begin(), preceding_window.end(), generator);
+  std::generate(following_window.begin(), following_window.end(), generator);
+
+  this->run_test_col_agg(input, preceding_window, following_window, 1);
+}
+
+// several aggregations at once give the results of each aggregation on its own
+TYPED_TEST(RollingTest, MultipleAggregations)
+{
+  size_type num_rows        = 1000;
+  size_type max_window_size = 10;
+
+  // random input with nulls
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  // random parameters
+  cudf::test::UniformRandomGenerator<size_type> window_rng(0, max_window_size);
+  auto generator = [&]() { return window_rng.generate(); };
+
+  std::vector<size_type> preceding_vec(num_rows);
+  std::vector<size_type> following_vec(num_rows);
+  std::generate(preceding_vec.begin(), preceding_vec.end(), generator);
+  std::generate(following_vec.begin(), following_vec.end(), generator);
+  fixed_width_column_wrapper<size_type> preceding_window(preceding_vec.begin(),
+                                                         preceding_vec.end());
+  fixed_width_column_wrapper<size_type> following_window(following_vec.begin(),
+                                                         following_vec.end());
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+  if (not cudf::is_timestamp(static_cast<cudf::column_view>(input).type())) {
+    aggs.push_back(cudf::make_sum_aggregation());
+  }
+
+  auto static_results  = cudf::rolling_window(input, 5, 3, 2, aggs);
+  auto dynamic_results = cudf::rolling_window(input, preceding_window, following_window, 2, aggs);
+  ASSERT_EQ(static_results.size(), aggs.size());
+  ASSERT_EQ(dynamic_results.size(), aggs.size());
+  for (size_t i = 0; i < aggs.size(); i++) {
+    cudf::test::expect_columns_equal(*cudf::rolling_window(input, 5, 3, 2, aggs[i]),
+                                     *static_results[i]);
+    cudf::test::expect_columns_equal(
+      *cudf::rolling_window(input, preceding_window, following_window, 2, aggs[i]),
+      *dynamic_results[i]);
+  }
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
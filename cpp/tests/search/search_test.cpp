@@ -20,6 +20,8 @@
 
 #include "cudf/search.hpp"
 
+#include <limits>
+
 struct SearchTest : public cudf::test::BaseFixture {
 };
 
@@ -1815,4 +1817,50 @@ TEST_F(SearchTest, multi_contains_empty_input_set_string)
   expect_columns_equal(*result, expect);
 }
 
+TEST_F(SearchTest, sorted_values_with_nulls)
+{
+  using element_type = int32_t;
+
+  // Enough sorted values for them to be merged with the column
+  fixed_width_column_wrapper<element_type> column({0, 1, 3, 3, 5, 7, 9}, {0, 1, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<element_type> values(
+    {0, 0, 0, 1, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<size_type> expect_lower{
+    0, 0, 1, 1, 1, 2, 2, 2, 4, 4, 5, 5, 6, 6, 7, 7};
+  fixed_width_column_wrapper<size_type> expect_upper{
+    1, 1, 1, 2, 2, 2, 4, 4, 4, 5, 5, 6, 6, 7, 7, 7};
+
+  auto lower = cudf::lower_bound({cudf::table_view{{column}}},
+                                 {cudf::table_view{{values}}},
+                                 {cudf::order::ASCENDING},
+                                 {cudf::null_order::BEFORE});
+  auto upper = cudf::upper_bound({cudf::table_view{{column}}},
+                                 {cudf::table_view{{values}}},
+                                 {cudf::order::ASCENDING},
+                                 {cudf::null_order::BEFORE});
+
+  expect_columns_equal(*lower, expect_lower);
+  expect_columns_equal(*upper, expect_upper);
+}
+
+TEST_F(SearchTest, floating_point_nan_descending)
+{
+  using element_type = double;
+
+  auto const nan = std::numeric_limits<element_type>::quiet_NaN();
+  fixed_width_column_wrapper<element_type> column{nan, 2.0, 1.0};
+  fixed_width_column_wrapper<element_type> values{0.5, 2.0, nan};
+  fixed_width_column_wrapper<size_type> expect_lower{3, 1, 0};
+  fixed_width_column_wrapper<size_type> expect_upper{3, 2, 1};
+
+  auto lower = cudf::lower_bound(
+    {cudf::table_view{{column}}}, {cudf::table_view{{values}}}, {cudf::order::DESCENDING}, {});
+  auto upper = cudf::upper_bound(
+    {cudf::table_view{{column}}}, {cudf::table_view{{values}}}, {cudf::order::DESCENDING}, {});
+
+  expect_columns_equal(*lower, expect_lower);
+  expect_columns_equal(*upper, expect_upper);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
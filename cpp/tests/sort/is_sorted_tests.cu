@@ -24,6 +24,10 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_list_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
 #include <vector>
 
 using namespace cudf::test;
@@ -426,6 +430,30 @@ TYPED_TEST(IsSortedTest, NullOrderArgsTooMany)
   EXPECT_THROW(cudf::is_sorted(in, order, null_precedence), cudf::logic_error);
 }
 
+struct IsSortedLargeTest : public BaseFixture {
+};
+
+TEST_F(IsSortedLargeTest, RowOutOfOrder)
+{
+  cudf::size_type const num_rows = 100000;
+  auto const sequence            = thrust::make_counting_iterator<int32_t>(0);
+  std::vector<int32_t> values(sequence, sequence + num_rows);
+  cudf::test::fixed_width_column_wrapper<int32_t> sorted(values.begin(), values.end());
+  std::swap(values[num_rows - 2], values[num_rows - 1]);
+  cudf::test::fixed_width_column_wrapper<int32_t> unsorted(values.begin(), values.end());
+
+  EXPECT_TRUE(cudf::is_sorted(cudf::table_view{{sorted}}, {}, {}));
+  EXPECT_FALSE(cudf::is_sorted(cudf::table_view{{unsorted}}, {}, {}));
+  EXPECT_FALSE(cudf::is_sorted(cudf::table_view{{sorted}}, {cudf::order::DESCENDING}, {}));
+
+  // The second column only breaks the ties of the first
+  std::vector<int32_t> halves(num_rows);
+  std::transform(sequence, sequence + num_rows, halves.begin(), [](auto i) { return i / 2; });
+  cudf::test::fixed_width_column_wrapper<int32_t> ties(halves.begin(), halves.end());
+  EXPECT_TRUE(cudf::is_sorted(cudf::table_view{{ties, sorted}}, {}, {}));
+  EXPECT_FALSE(cudf::is_sorted(cudf::table_view{{ties, unsorted}}, {}, {}));
+}
+
 template <typename T>
 struct IsSortedFixedWidthOnly : public cudf::test::BaseFixture {
 };
@@ -49,6 +49,14 @@ void run_rank_test(table_view input,
       std::cout << "\n";
     }
     expect_columns_equal(expected.column(i), got_rank_column->view());
+
+    // Rank from a precomputed sorted order
+    auto const sorted =
+      (method == rank_method::FIRST)
+        ? cudf::stable_sorted_order(table_view{{input_column}}, {column_order}, {null_precedence})
+        : cudf::sorted_order(table_view{{input_column}}, {column_order}, {null_precedence});
+    auto got_from_order = cudf::rank(input_column, *sorted, method, null_handling, percentage);
+    expect_columns_equal(expected.column(i), got_from_order->view());
     i++;
   }
 }
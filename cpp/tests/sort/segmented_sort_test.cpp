@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+void run_segmented_sort_test(table_view input,
+                             column_view offsets,
+                             column_view expected_sorted_indices,
+                             std::vector<order> column_order         = {},
+                             std::vector<null_order> null_precedence = {})
+{
+  auto got = segmented_sorted_order(input, offsets, column_order, null_precedence);
+  expect_columns_equal(expected_sorted_indices, got->view());
+
+  auto got_sorted_table      = segmented_sort(input, offsets, column_order, null_precedence);
+  auto expected_sorted_table = gather(input, expected_sorted_indices);
+  expect_tables_equal(expected_sorted_table->view(), got_sorted_table->view());
+}
+
+template <typename T>
+struct SegmentedSort : public BaseFixture {
+};
+
+TYPED_TEST_CASE(SegmentedSort, NumericTypes);
+
+TYPED_TEST(SegmentedSort, SingleColumn)
+{
+  using T = TypeParam;
+  using R = int32_t;
+
+  fixed_width_column_wrapper<T> col1{{2, 1, 0, 1, 0, 1}};
+  fixed_width_column_wrapper<R> offsets{{0, 3, 6}};
+
+  fixed_width_column_wrapper<R> expected =
+    std::is_same<T, bool>::value ? fixed_width_column_wrapper<R>{{2, 0, 1, 4, 3, 5}}
+                                 : fixed_width_column_wrapper<R>{{2, 1, 0, 4, 3, 5}};
+
+  run_segmented_sort_test(table_view{{col1}}, offsets, expected);
+}
+
+struct SegmentedSortTest : public BaseFixture {
+};
+
+TEST_F(SegmentedSortTest, PackedKeysWithNulls)
+{
+  fixed_width_column_wrapper<int32_t> col1{{1, 1, 0, 2, 2, 2, 1}};
+  fixed_width_column_wrapper<int16_t> col2({5, 6, 7, 1, 3, 2, 9}, {1, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int32_t> offsets{{0, 3, 6, 7}};
+
+  fixed_width_column_wrapper<int32_t> expected{{2, 1, 0, 4, 5, 3, 6}};
+
+  run_segmented_sort_test(table_view{{col1, col2}},
+                          offsets,
+                          expected,
+                          {order::ASCENDING, order::DESCENDING},
+                          {null_order::BEFORE, null_order::AFTER});
+}
+
+TEST_F(SegmentedSortTest, StringsWithEmptySegment)
+{
+  strings_column_wrapper col1({"b", "a", "", "d", "c"}, {1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int32_t> offsets{{0, 0, 3, 5}};
+
+  fixed_width_column_wrapper<int32_t> expected{{1, 0, 2, 4, 3}};
+
+  run_segmented_sort_test(
+    table_view{{col1}}, offsets, expected, {order::ASCENDING}, {null_order::AFTER});
+}
+
+TEST_F(SegmentedSortTest, InvalidOffsets)
+{
+  fixed_width_column_wrapper<int32_t> col1{{3, 1, 2}};
+  table_view input{{col1}};
+
+  fixed_width_column_wrapper<int32_t> short_offsets{{0, 2}};
+  fixed_width_column_wrapper<int32_t> nonzero_offsets{{1, 3}};
+  fixed_width_column_wrapper<int64_t> wide_offsets{{0, 3}};
+  fixed_width_column_wrapper<int32_t> no_offsets{};
+
+  EXPECT_THROW(segmented_sorted_order(input, short_offsets), logic_error);
+  EXPECT_THROW(segmented_sorted_order(input, nonzero_offsets), logic_error);
+  EXPECT_THROW(segmented_sorted_order(input, wide_offsets), logic_error);
+  EXPECT_THROW(segmented_sort(input, no_offsets), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
+
+CUDF_TEST_PROGRAM_MAIN()
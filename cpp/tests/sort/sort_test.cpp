@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -25,6 +26,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
+#include <limits>
 #include <vector>
 
 namespace cudf {
@@ -211,6 +213,49 @@ TYPED_TEST(Sort, Stable)
   expect_columns_equal(expected, got->view());
 }
 
+TYPED_TEST(Sort, SingleColumnStable)
+{
+  using T = TypeParam;
+  using R = int32_t;
+
+  fixed_width_column_wrapper<T> col1({5, 4, 3, 5, 8, 5, 0}, {1, 1, 0, 1, 1, 1, 1});
+  table_view input{{col1}};
+
+  auto const is_bool = std::is_same<T, bool>::value;
+  fixed_width_column_wrapper<R> expected_descending =
+    is_bool ? fixed_width_column_wrapper<R>{{0, 1, 3, 4, 5, 6, 2}}
+            : fixed_width_column_wrapper<R>{{4, 0, 3, 5, 1, 6, 2}};
+  fixed_width_column_wrapper<R> expected_ascending =
+    is_bool ? fixed_width_column_wrapper<R>{{2, 6, 0, 1, 3, 4, 5}}
+            : fixed_width_column_wrapper<R>{{2, 6, 1, 0, 3, 5, 4}};
+
+  auto got = stable_sorted_order(input, {order::DESCENDING}, {null_order::BEFORE});
+  expect_columns_equal(expected_descending, got->view());
+
+  got = stable_sorted_order(input, {order::ASCENDING}, {null_order::BEFORE});
+  expect_columns_equal(expected_ascending, got->view());
+}
+
+TYPED_TEST(Sort, FixedWidthKeys)
+{
+  using T = TypeParam;
+  using R = int32_t;
+
+  fixed_width_column_wrapper<T> col1{{3, 1, 3, 1, 2, 3}};
+  fixed_width_column_wrapper<int16_t> col2({5, 7, 6, 7, 1, 5}, {1, 1, 1, 0, 1, 1});
+  table_view input{{col1, col2}};
+
+  // Keys narrower than 64 bits are packed together, wider ones use the row comparator
+  fixed_width_column_wrapper<R> expected =
+    std::is_same<T, bool>::value ? fixed_width_column_wrapper<R>{{3, 1, 2, 0, 5, 4}}
+                                 : fixed_width_column_wrapper<R>{{3, 1, 4, 2, 0, 5}};
+
+  auto got = stable_sorted_order(
+    input, {order::ASCENDING, order::DESCENDING}, {null_order::AFTER, null_order::AFTER});
+
+  expect_columns_equal(expected, got->view());
+}
+
 TYPED_TEST(Sort, MisMatchInColumnOrderSize)
 {
   using T = TypeParam;
@@ -264,6 +309,88 @@ TYPED_TEST(Sort, ZeroSizedColumns)
   run_sort_test(input, expected, column_order);
 }
 
+struct SortFloatingPoint : public BaseFixture {
+};
+
+TEST_F(SortFloatingPoint, NanAndSignedZero)
+{
+  using T = double;
+
+  auto const nan = std::numeric_limits<T>::quiet_NaN();
+  auto const inf = std::numeric_limits<T>::infinity();
+  fixed_width_column_wrapper<T> col1{{nan, 1.0, -0.0, -inf, 0.0, -nan, inf}};
+  table_view input{{col1}};
+
+  fixed_width_column_wrapper<int32_t> expected_ascending{{3, 2, 4, 1, 6, 0, 5}};
+  fixed_width_column_wrapper<int32_t> expected_descending{{0, 5, 6, 1, 2, 4, 3}};
+
+  auto got = stable_sorted_order(input, {order::ASCENDING});
+  expect_columns_equal(expected_ascending, got->view());
+
+  got = stable_sorted_order(input, {order::DESCENDING});
+  expect_columns_equal(expected_descending, got->view());
+}
+
+struct SortStrings : public BaseFixture {
+};
+
+TEST_F(SortStrings, SharedPrefixes)
+{
+  strings_column_wrapper col1({"abcdefghijklmnop",
+                               "abcdefghijkl",
+                               "abcdefghijklmno",
+                               "",
+                               "abcdefghijk",
+                               "",
+                               "abcdefghijklmnoa",
+                               "b",
+                               "abcdefghijklZ",
+                               "abcdefgh",
+                               "\xc3\xa9"},
+                              {1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+  table_view input{{col1}};
+
+  fixed_width_column_wrapper<int32_t> expected_ascending{{5, 3, 9, 4, 1, 8, 2, 6, 0, 7, 10}};
+  fixed_width_column_wrapper<int32_t> expected_descending{{5, 10, 7, 0, 6, 2, 8, 1, 4, 9, 3}};
+
+  auto got = sorted_order(input, {order::ASCENDING}, {null_order::BEFORE});
+  expect_columns_equal(expected_ascending, got->view());
+  run_sort_test(input, expected_ascending, {order::ASCENDING}, {null_order::BEFORE});
+
+  got = stable_sorted_order(input, {order::DESCENDING}, {null_order::AFTER});
+  expect_columns_equal(expected_descending, got->view());
+  run_sort_test(input, expected_descending, {order::DESCENDING}, {null_order::AFTER});
+}
+
+TEST_F(SortStrings, StableDuplicates)
+{
+  strings_column_wrapper col1({"same", "other", "same", "sam", "same", "sam\x01"});
+  table_view input{{col1}};
+
+  fixed_width_column_wrapper<int32_t> expected_ascending{{1, 3, 5, 0, 2, 4}};
+  fixed_width_column_wrapper<int32_t> expected_descending{{0, 2, 4, 5, 3, 1}};
+
+  auto got = stable_sorted_order(input, {order::ASCENDING});
+  expect_columns_equal(expected_ascending, got->view());
+  got = stable_sorted_order(input, {order::DESCENDING});
+  expect_columns_equal(expected_descending, got->view());
+}
+
+TEST_F(SortStrings, DictionaryKeys)
+{
+  strings_column_wrapper strings({"ccc", "aaa", "", "bbb", "aaa", "ddd"}, {1, 1, 0, 1, 1, 1});
+  auto dictionary = cudf::dictionary::encode(strings);
+  table_view input{{dictionary->view()}};
+
+  fixed_width_column_wrapper<int32_t> expected_ascending{{2, 1, 4, 3, 0, 5}};
+  fixed_width_column_wrapper<int32_t> expected_descending{{5, 0, 3, 1, 4, 2}};
+
+  auto got = stable_sorted_order(input, {order::ASCENDING}, {null_order::BEFORE});
+  expect_columns_equal(expected_ascending, got->view());
+  got = stable_sorted_order(input, {order::DESCENDING}, {null_order::BEFORE});
+  expect_columns_equal(expected_descending, got->view());
+}
+
 struct SortByKey : public BaseFixture {
 };
 
@@ -282,6 +409,23 @@ TEST_F(SortByKey, ValueKeysSizeMismatch)
   EXPECT_THROW(sort_by_key(values, keys), logic_error);
 }
 
+TEST_F(SortByKey, SortedKeys)
+{
+  fixed_width_column_wrapper<int32_t> key_col{{1, 1, 2, 3, 3}, {0, 1, 1, 1, 1}};
+  strings_column_wrapper value_col({"d", "e", "a", "d", "k"});
+  table_view keys{{key_col}};
+  table_view values{{value_col}};
+
+  fixed_width_column_wrapper<int32_t> expected_order{{0, 1, 2, 3, 4}};
+  expect_columns_equal(expected_order, sorted_order(keys)->view());
+  expect_columns_equal(expected_order, stable_sorted_order(keys)->view());
+  expect_tables_equal(values, sort_by_key(values, keys)->view());
+
+  fixed_width_column_wrapper<int32_t> expected_descending{{3, 4, 2, 1, 0}};
+  auto const got = stable_sorted_order(keys, {order::DESCENDING}, {null_order::BEFORE});
+  expect_columns_equal(expected_descending, got->view());
+}
+
 }  // namespace test
 }  // namespace cudf
 
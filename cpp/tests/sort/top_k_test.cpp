@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace test {
+void run_top_k_test(table_view keys,
+                    std::vector<size_type> const& ks,
+                    std::vector<order> column_order         = {},
+                    std::vector<null_order> null_precedence = {})
+{
+  auto const sorted = stable_sorted_order(keys, column_order, null_precedence);
+  for (auto k : ks) {
+    auto const expected = slice(sorted->view(), {0, std::min(k, keys.num_rows())}).front();
+    auto got            = top_k_order(keys, k, column_order, null_precedence);
+    expect_columns_equal(expected, got->view());
+  }
+}
+
+template <typename T>
+struct TopK : public BaseFixture {
+};
+
+TYPED_TEST_CASE(TopK, NumericTypes);
+
+TYPED_TEST(TopK, SingleColumnWithNulls)
+{
+  using T = TypeParam;
+
+  auto data     = make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 11; });
+  auto validity = make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  fixed_width_column_wrapper<T> col1(data, data + 100, validity);
+  table_view keys{{col1}};
+
+  std::vector<size_type> ks{1, 10, 50, 99, 100, 150};
+  run_top_k_test(keys, ks, {order::ASCENDING}, {null_order::AFTER});
+  run_top_k_test(keys, ks, {order::DESCENDING}, {null_order::AFTER});
+}
+
+struct TopKTest : public BaseFixture {
+};
+
+TEST_F(TopKTest, MultiColumnKeys)
+{
+  auto data1 = make_counting_transform_iterator(0, [](auto i) { return (i * 5) % 3; });
+  auto data2 = make_counting_transform_iterator(0, [](auto i) { return (i * 31) % 17 - 8; });
+  auto valid = make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  fixed_width_column_wrapper<int16_t> col1(data1, data1 + 60);
+  fixed_width_column_wrapper<int32_t> col2(data2, data2 + 60, valid);
+  strings_column_wrapper col3({"e", "b", "d", "a", "c", "a"});
+
+  run_top_k_test(table_view{{col1, col2}},
+                 {1, 7, 30, 59},
+                 {order::DESCENDING, order::ASCENDING},
+                 {null_order::BEFORE, null_order::AFTER});
+  run_top_k_test(table_view{{col3}}, {0, 2, 4});
+}
+
+TEST_F(TopKTest, Values)
+{
+  fixed_width_column_wrapper<int32_t> keys{{5, 1, 4, 2, 3}};
+  strings_column_wrapper values({"five", "one", "four", "two", "three"});
+
+  strings_column_wrapper expected({"five", "four"});
+
+  auto got = top_k(table_view{{values}}, table_view{{keys}}, 2, {order::DESCENDING});
+  expect_columns_equal(expected, got->view().column(0));
+}
+
+TEST_F(TopKTest, Errors)
+{
+  fixed_width_column_wrapper<int32_t> keys{{5, 1, 4}};
+  fixed_width_column_wrapper<int32_t> values{{5, 1}};
+
+  EXPECT_THROW(top_k_order(table_view{{keys}}, -1), logic_error);
+  EXPECT_THROW(top_k(table_view{{values}}, table_view{{keys}}, 1), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
+
+CUDF_TEST_PROGRAM_MAIN()
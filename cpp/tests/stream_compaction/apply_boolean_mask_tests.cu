@@ -15,6 +15,7 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -170,4 +171,57 @@ TEST_F(ApplyBooleanMask, NoNullInput)
   cudf::test::expect_tables_equal(expected, got->view());
 }
 
+struct ApplyPredicates : public cudf::test::BaseFixture {
+};
+
+TEST_F(ApplyPredicates, ConjunctionOfComparisons)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3, 4, 5, 6}, {1, 1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper col2({"a", "b", "c", "b", "d", "a"});
+  cudf::test::fixed_width_column_wrapper<float> col3({1, 2, 3, 4, 5, 6});
+  cudf::table_view input({col1, col2, col3});
+
+  cudf::numeric_scalar<int32_t> three(3);
+  cudf::string_scalar b("b");
+  cudf::numeric_scalar<float> six(6);
+  auto got = cudf::apply_predicates(input,
+                                    {{0, cudf::binary_operator::GREATER_EQUAL, three},
+                                     {1, cudf::binary_operator::NOT_EQUAL, b},
+                                     {2, cudf::binary_operator::LESS, six}});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected({3, 5}, {1, 1});
+  cudf::test::strings_column_wrapper col2_expected({"c", "d"});
+  cudf::test::fixed_width_column_wrapper<float> col3_expected({3, 5});
+  cudf::table_view expected({col1_expected, col2_expected, col3_expected});
+  cudf::test::expect_tables_equal(expected, got->view());
+}
+
+TEST_F(ApplyPredicates, NullValueFiltersEveryRow)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+  cudf::table_view input({col});
+
+  cudf::numeric_scalar<int32_t> null_value(0, false);
+  auto got = cudf::apply_predicates(input, {{0, cudf::binary_operator::NOT_EQUAL, null_value}});
+  EXPECT_EQ(0, got->num_rows());
+}
+
+TEST_F(ApplyPredicates, InvalidPredicates)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+  cudf::table_view input({col});
+
+  cudf::numeric_scalar<int64_t> wrong_type(1);
+  cudf::numeric_scalar<int32_t> one(1);
+  CUDF_EXPECT_THROW_MESSAGE(
+    (cudf::apply_predicates(input, {{0, cudf::binary_operator::EQUAL, wrong_type}})),
+    "Predicate value must have the type of its column");
+  CUDF_EXPECT_THROW_MESSAGE(
+    (cudf::apply_predicates(input, {{0, cudf::binary_operator::ADD, one}})),
+    "Predicate operator must be a comparison");
+  CUDF_EXPECT_THROW_MESSAGE(
+    (cudf::apply_predicates(input, {{1, cudf::binary_operator::EQUAL, one}})),
+    "Predicate column index out of range");
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <ctgmath>
 #include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -314,3 +315,30 @@ TEST_F(DropDuplicate, EmptyKeys)
 
   cudf::test::expect_tables_equal(cudf::table_view{{empty_col}}, got->view());
 }
+
+TEST_F(DropDuplicate, KeepAny)
+{
+  // Duplicate keys have the same payload, so that the result does not depend on the kept row
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{1, 1, 2, 1, 3, 2, 4, 5}};
+  cudf::test::fixed_width_column_wrapper<int32_t> key{{20, 20, 19, 20, 9, 19, 0, 0},
+                                                      {1, 1, 1, 1, 1, 1, 0, 0}};
+  cudf::table_view input{{col, key}};
+  std::vector<cudf::size_type> keys{1};
+
+  // Only nulls are unequal, one row is kept per equal key, then the rows are sorted to compare
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col{{4, 5, 3, 2, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key{{0, 0, 9, 19, 20}, {0, 0, 1, 1, 1}};
+  auto got =
+    drop_duplicates(input, keys, cudf::duplicate_keep_option::KEEP_ANY, null_equality::UNEQUAL);
+  auto const sorted = cudf::sort_by_key(got->view(),
+                                        cudf::table_view{{got->get_column(1), got->get_column(0)}},
+                                        {},
+                                        {cudf::null_order::BEFORE, cudf::null_order::BEFORE});
+  cudf::test::expect_tables_equal(cudf::table_view{{exp_col, exp_key}}, sorted->view());
+
+  // With equal nulls, one of the two null keys is kept
+  auto got_equal_nulls =
+    drop_duplicates(input, keys, cudf::duplicate_keep_option::KEEP_ANY, null_equality::EQUAL);
+  EXPECT_EQ(4, got_equal_nulls->num_rows());
+  EXPECT_EQ(4, cudf::unique_count(key, null_policy::INCLUDE, nan_policy::NAN_IS_VALID));
+}
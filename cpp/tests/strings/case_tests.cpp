@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/capitalize.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -95,6 +96,22 @@ TEST_F(StringsCaseTest, Swapcase)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsCaseTest, AsciiRows)
+{
+  cudf::test::strings_column_wrapper strings({"Éxamples", "aBc 12", "", "dEf", "tést"},
+                                             {1, 1, 0, 1, 1});
+  // The sliced rows are all ASCII
+  auto const sliced       = cudf::slice(strings, {1, 4}).front();
+  auto const strings_view = cudf::strings_column_view(sliced);
+
+  cudf::test::strings_column_wrapper expected_upper({"ABC 12", "", "DEF"}, {1, 0, 1});
+  cudf::test::expect_columns_equal(*cudf::strings::to_upper(strings_view), expected_upper);
+  cudf::test::strings_column_wrapper expected_lower({"abc 12", "", "def"}, {1, 0, 1});
+  cudf::test::expect_columns_equal(*cudf::strings::to_lower(strings_view), expected_lower);
+  cudf::test::strings_column_wrapper expected_swapped({"AbC 12", "", "DeF"}, {1, 0, 1});
+  cudf::test::expect_columns_equal(*cudf::strings::swapcase(strings_view), expected_swapped);
+}
+
 TEST_F(StringsCaseTest, EmptyStringsColumn)
 {
   cudf::column_view zero_size_strings_column(cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -160,6 +177,24 @@ TEST_F(StringsCaseTest, MultiCharUpper)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsCaseTest, MultiCharUpperWithNulls)
+{
+  // U+0390 has the largest expansion, 2 bytes to 6
+  cudf::test::strings_column_wrapper strings(
+    {"\u0390\u0390", "", "ab\u0390", "\u00e9", "\u1f52x"}, {1, 0, 1, 1, 1});
+  cudf::test::strings_column_wrapper expected({"\u0399\u0308\u0301\u0399\u0308\u0301",
+                                               "",
+                                               "AB\u0399\u0308\u0301",
+                                               "\u00c9",
+                                               "\u03a5\u0313\u0300X"},
+                                              {1, 0, 1, 1, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::to_upper(strings_view);
+
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
 TEST_F(StringsCaseTest, MultiCharLower)
 {
   // there's only one of these
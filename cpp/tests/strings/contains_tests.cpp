@@ -372,3 +372,111 @@ TEST_F(StringsContainsTests, LargeRegex)
     cudf::test::expect_columns_equal(*results, expected);
   }
 }
+
+TEST_F(StringsContainsTests, AsciiDfaTest)
+{
+  std::vector<const char*> h_strings{"abc\ndef", "the fox", "foxes", "a1b22", "", nullptr, "xyz"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+
+  std::vector<std::string> patterns{"^def", "abc$", "\\bfox\\b", "\\d\\d", "fox|def"};
+  bool h_expecteds[] = {true,  false, false, false, false, false, false,   // ^def
+                        true,  false, false, false, false, false, false,   // abc$
+                        false, true,  false, false, false, false, false,   // \bfox\b
+                        false, false, false, true,  false, false, false,   // \d\d
+                        true,  true,  true,  false, false, false, false};  // fox|def
+  for (std::size_t idx = 0; idx < patterns.size(); ++idx) {
+    auto results    = cudf::strings::contains_re(strings_view, patterns[idx]);
+    auto h_expected = h_expecteds + (idx * h_strings.size());
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results      = cudf::strings::matches_re(strings_view, "a\\d");
+    bool h_expected[] = {false, false, false, true, false, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    // non-ASCII columns are evaluated with the regex NFA
+    cudf::test::strings_column_wrapper utf8_strings({"the fóx", "foxes", "fox"});
+    auto results = cudf::strings::contains_re(cudf::strings_column_view(utf8_strings), "\\bf.x\\b");
+    cudf::test::fixed_width_column_wrapper<bool> expected({true, false, true});
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, RequiredLiteralTest)
+{
+  std::vector<const char*> h_strings{
+    "ERROR  42 é", "error 42 é", "WARN: ERRORS 7", "é ERROR", nullptr, "ERROR 7é", "ERRO ERROR 1"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  {
+    auto results      = cudf::strings::contains_re(strings_view, "ERROR\\s+\\d+");
+    bool h_expected[] = {true, false, false, false, false, true, true};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results         = cudf::strings::count_re(strings_view, "(E|W)R*\\w*");
+    int32_t h_expected[] = {1, 0, 2, 1, 0, 1, 2};
+    cudf::test::fixed_width_column_wrapper<int32_t> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, RepeatedLargeRegex)
+{
+  // over 1000 instructions so the regex working memory is allocated in device memory
+  std::string pattern;
+  for (int idx = 0; idx < 275; ++idx) pattern += "abcd";
+  std::string const other = "x" + pattern.substr(1);
+
+  // the compiled program is reused across calls; the working memory grows as needed
+  for (auto const repeat : {1, 3, 1}) {
+    std::vector<std::string> h_strings;
+    std::vector<int32_t> h_expected;
+    for (int idx = 0; idx < repeat; ++idx) {
+      h_strings.insert(h_strings.end(), {pattern + pattern, other, "abcd"});
+      h_expected.insert(h_expected.end(), {2, 0, 0});
+    }
+    cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+    auto results = cudf::strings::count_re(cudf::strings_column_view(strings), pattern);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected(h_expected.begin(), h_expected.end());
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, LargeRegexTiles)
+{
+  // the working memory of this program holds fewer strings than the column so it is
+  // evaluated in tiles of rows
+  std::string pattern;
+  for (int idx = 0; idx < 275; ++idx) pattern += "abcd";
+  cudf::size_type const strings_count = 25000;
+  std::vector<std::string> h_strings(strings_count, "abcd");
+  std::vector<int32_t> h_expected(strings_count, 0);
+  for (cudf::size_type idx = 0; idx < strings_count; idx += 7) {
+    h_strings[idx]  = "x" + pattern;
+    h_expected[idx] = 1;
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  auto results = cudf::strings::count_re(cudf::strings_column_view(strings), pattern);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(h_expected.begin(), h_expected.end());
+  cudf::test::expect_columns_equal(*results, expected);
+}
@@ -116,6 +116,18 @@ TEST_F(StringsDatetimeTest, ToTimestampTimezone)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsDatetimeTest, ToTimestampFixedFormat)
+{
+  // rows with non-digit fields go through the general parser
+  cudf::test::strings_column_wrapper strings{
+    "2019-07-17", "2019-07-1x", "2020-02-29 12:00", "2019-7-17", ""};
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results =
+    cudf::strings::to_timestamps(strings_view, cudf::data_type{cudf::TIMESTAMP_DAYS}, "%Y-%m-%d");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_D> expected{18094, 18078, 18321, 0, 0};
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
 TEST_F(StringsDatetimeTest, FromTimestamp)
 {
   std::vector<cudf::timestamp_s> h_timestamps{131246625, 1563399277, 0, 1553085296, 1582934400};
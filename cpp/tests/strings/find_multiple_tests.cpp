@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -51,6 +52,29 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, ContainsMultiple)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"abcd", "xbc", "", "bcd", "", "héllo wörld", "no match here"}, {1, 1, 1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper targets({"cd", "abc", "bc", "wö", "llo", "ll", "cd"});
+  auto results = cudf::strings::contains_multiple(cudf::strings_column_view(strings),
+                                                  cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 2, -1, 2, -1, 5, -1},
+                                                           {1, 1, 1, 1, 0, 1, 1});
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, ContainsMultipleSlicedTargets)
+{
+  cudf::test::strings_column_wrapper strings({"the quick brown fox", "lazy dog", "jumps over"});
+  cudf::test::strings_column_wrapper targets({"the", "dog", "fox", "over"});
+  auto const sliced = cudf::slice(targets, {1, 4}).front();
+  auto results      = cudf::strings::contains_multiple(cudf::strings_column_view(strings),
+                                                       cudf::strings_column_view(sliced));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 0, 2});
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -75,4 +99,7 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
 
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
+
+  EXPECT_THROW(cudf::strings::contains_multiple(strings_view, empty_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::contains_multiple(strings_view, strings_view), cudf::logic_error);
 }
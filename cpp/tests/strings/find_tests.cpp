@@ -25,6 +25,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <string>
 #include <vector>
 
 struct StringsFindTest : public cudf::test::BaseFixture {
@@ -99,6 +100,56 @@ TEST_F(StringsFindTest, Find)
   }
 }
 
+TEST_F(StringsFindTest, LongStrings)
+{
+  auto repeat = [](std::string const& str, int count) {
+    std::string result;
+    while (count-- > 0) result += str;
+    return result;
+  };
+  // long enough to be searched with a warp per string
+  std::vector<std::string> h_strings{
+    std::string(100, 'a') + "needle" + std::string(50, 'b') + "needle",
+    repeat("é", 80) + "needle" + repeat("é", 10),
+    std::string(200, 'x'),
+    "",
+    "needle" + std::string(70, 'c')};
+  std::vector<bool> validity{1, 1, 1, 0, 1};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity.begin());
+  auto strings_view = cudf::strings_column_view(strings);
+  auto const target = cudf::string_scalar("needle");
+
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({100, 80, -1, 0, 0},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::find(strings_view, target);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({156, -1, -1, 0, -1},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::find(strings_view, target, 101);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({156, 80, -1, 0, 0},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::rfind(strings_view, target);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({100, 80, -1, 0, 0},
+                                                             {1, 1, 1, 0, 1});
+    auto results = cudf::strings::rfind(strings_view, target, 0, 150);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 0, 0, 1}, {1, 1, 1, 0, 1});
+    auto results = cudf::strings::contains(strings_view, target);
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
 TEST_F(StringsFindTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
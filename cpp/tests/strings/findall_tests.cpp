@@ -75,6 +75,25 @@ TEST_F(StringsFindallTests, FindallTest)
   cudf::test::expect_tables_equal(*results, expected);
 }
 
+TEST_F(StringsFindallTests, FindallRecord)
+{
+  std::vector<const char*> h_strings{"bunny", "rabbit", nullptr, ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results      = cudf::strings::findall_record(strings_view, "[ab]");
+  EXPECT_EQ(results->type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(results->null_count(), 1);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 1, 4, 4, 4};
+  cudf::test::strings_column_wrapper expected_matches{"b", "a", "b", "b"};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_matches);
+}
+
 TEST_F(StringsFindallTests, MediumRegex)
 {
   // This results in 15 regex instructions and falls in the 'medium' range.
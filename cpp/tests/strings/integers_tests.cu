@@ -72,6 +72,40 @@ TEST_F(StringsConvertTest, FromInteger)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsConvertTest, Integers64)
+{
+  int64_t minint = std::numeric_limits<int64_t>::min();
+  int64_t maxint = std::numeric_limits<int64_t>::max();
+  std::vector<int64_t> h_integers{
+    1, -10, 99, 100, 12345678, -123456789012345678, 1000000000000000000, maxint, minint};
+  std::vector<const char*> h_expected{"1",
+                                      "-10",
+                                      "99",
+                                      "100",
+                                      "12345678",
+                                      "-123456789012345678",
+                                      "1000000000000000000",
+                                      "9223372036854775807",
+                                      "-9223372036854775808"};
+  cudf::test::fixed_width_column_wrapper<int64_t> integers(h_integers.begin(), h_integers.end());
+  auto results = cudf::strings::from_integers(integers);
+  cudf::test::strings_column_wrapper expected(h_expected.begin(), h_expected.end());
+  cudf::test::expect_columns_equal(*results, expected);
+
+  results = cudf::strings::to_integers(cudf::strings_column_view(expected),
+                                       cudf::data_type{cudf::INT64});
+  cudf::test::expect_columns_equal(*results, integers);
+
+  // digits are parsed eight at a time up to the first non-digit character
+  cudf::test::strings_column_wrapper strings(
+    {"+12345678901", "1234567890123x45", "12345678.9", "000000000000000042", "9876543 21"});
+  results = cudf::strings::to_integers(cudf::strings_column_view(strings),
+                                       cudf::data_type{cudf::INT64});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_integers(
+    {12345678901, 1234567890123, 12345678, 42, 9876543});
+  cudf::test::expect_columns_equal(*results, expected_integers);
+}
+
 TEST_F(StringsConvertTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_column(cudf::data_type{cudf::INT32}, 0, nullptr, nullptr, 0);
@@ -241,3 +241,23 @@ TEST_F(StringsReplaceTests, LargeReplaceRegex)
     thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
   cudf::test::expect_columns_equal(*results, expected);
 }
+
+TEST_F(StringsReplaceTests, LargeReplaceRegexTiles)
+{
+  // the working memory of this program holds fewer strings than the column so the
+  // strings are replaced in tiles of rows
+  std::string pattern;
+  for (int idx = 0; idx < 275; ++idx) pattern += "abcd";
+  cudf::size_type const strings_count = 25000;
+  std::vector<std::string> h_strings(strings_count, "abcd");
+  std::vector<std::string> h_expected(strings_count, "abcd");
+  for (cudf::size_type idx = 0; idx < strings_count; idx += 7) {
+    h_strings[idx]  = "x" + pattern;
+    h_expected[idx] = "xX";
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  auto results = cudf::strings::replace_re(
+    cudf::strings_column_view(strings), pattern, cudf::string_scalar("X"));
+  cudf::test::strings_column_wrapper expected(h_expected.begin(), h_expected.end());
+  cudf::test::expect_columns_equal(*results, expected);
+}
@@ -23,6 +23,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include "./utilities.h"
 
+#include <string>
 #include <vector>
 
 struct StringsReplaceTest : public cudf::test::BaseFixture {
@@ -220,6 +221,52 @@ TEST_F(StringsReplaceTest, ReplaceNulls)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceLongStrings)
+{
+  auto repeat = [](std::string const& str, int count) {
+    std::string result;
+    while (count-- > 0) result += str;
+    return result;
+  };
+  // long enough to be replaced with a warp per string
+  std::vector<std::string> h_strings{repeat("the cat sat on the mat ", 6),
+                                     repeat("é", 70),
+                                     "",
+                                     repeat("abcab", 20)};
+  std::vector<bool> validity{1, 1, 0, 1};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity.begin());
+  auto strings_view = cudf::strings_column_view(strings);
+
+  {
+    auto results = cudf::strings::replace(
+      strings_view, cudf::string_scalar("at"), cudf::string_scalar("og"));
+    std::vector<std::string> h_expected{
+      repeat("the cog sog on the mog ", 6), repeat("é", 70), "", repeat("abcab", 20)};
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(), h_expected.end(), validity.begin());
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    // matches do not overlap and are limited by maxrepl
+    auto results = cudf::strings::replace(
+      strings_view, cudf::string_scalar("bab"), cudf::string_scalar("-"), 3);
+    std::vector<std::string> h_expected{
+      h_strings[0], h_strings[1], "", "abca-ca-ca-cab" + repeat("abcab", 16)};
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(), h_expected.end(), validity.begin());
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::replace(
+      strings_view, cudf::string_scalar("é"), cudf::string_scalar("e"));
+    std::vector<std::string> h_expected{
+      h_strings[0], std::string(70, 'e'), "", h_strings[3]};
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(), h_expected.end(), validity.begin());
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
 TEST_F(StringsReplaceTest, EmptyStringsColumn)
 {
   cudf::column_view zero_size_strings_column(cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
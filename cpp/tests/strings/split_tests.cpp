@@ -605,6 +605,57 @@ TEST_F(StringsSplitTest, ContiguousSplitRecordZeroSizeStringsColumns)
   EXPECT_TRUE(rsplit_record_result.column_views.size() == 0);
 }
 
+TEST_F(StringsSplitTest, SplitRecord)
+{
+  std::vector<const char*> h_strings{"Héllo thesé", nullptr, "are some", "tést String", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  auto result = cudf::strings::split_record(strings_view, cudf::string_scalar(" "));
+  EXPECT_EQ(result->type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(result->size(), 5);
+  EXPECT_EQ(result->null_count(), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 2, 2, 4, 6, 7};
+  cudf::test::strings_column_wrapper expected_tokens{
+    "Héllo", "thesé", "are", "some", "tést", "String", ""};
+  cudf::test::expect_columns_equal(result->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(result->view().child(1), expected_tokens);
+}
+
+TEST_F(StringsSplitTest, SplitRecordWhitespace)
+{
+  cudf::test::strings_column_wrapper strings{"a  b c ", "", "d", "   "};
+  cudf::strings_column_view strings_view(strings);
+
+  auto result = cudf::strings::split_record(strings_view);
+  EXPECT_EQ(result->null_count(), 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 3, 3, 4, 4};
+  cudf::test::strings_column_wrapper expected_tokens{"a", "b", "c", "d"};
+  cudf::test::expect_columns_equal(result->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(result->view().child(1), expected_tokens);
+}
+
+TEST_F(StringsSplitTest, RSplitRecordWithMaxSplit)
+{
+  cudf::test::strings_column_wrapper strings{" a b  c ", "d", "   ", "e_f_g"};
+  cudf::strings_column_view strings_view(strings);
+
+  auto result = cudf::strings::rsplit_record(strings_view, cudf::string_scalar(""), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 2, 3, 3, 4};
+  cudf::test::strings_column_wrapper expected_tokens{" a b", "c", "d", "e_f_g"};
+  cudf::test::expect_columns_equal(result->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(result->view().child(1), expected_tokens);
+
+  result = cudf::strings::rsplit_record(strings_view, cudf::string_scalar("_"), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_delimiter_offsets{0, 1, 2, 3, 5};
+  cudf::test::strings_column_wrapper expected_delimiter_tokens{" a b  c ", "d", "   ", "e_f", "g"};
+  cudf::test::expect_columns_equal(result->view().child(0), expected_delimiter_offsets);
+  cudf::test::expect_columns_equal(result->view().child(1), expected_delimiter_tokens);
+}
+
 TEST_F(StringsSplitTest, Partition)
 {
   std::vector<const char*> h_strings{
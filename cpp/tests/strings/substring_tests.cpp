@@ -148,6 +148,37 @@ INSTANTIATE_TEST_CASE_P(StringsSubstringsTest,
                         SubstringParmsTest,
                         testing::ValuesIn(std::array<cudf::size_type, 3>{1, 2, 3}));
 
+TEST_F(StringsSubstringsTest, AsciiSteps)
+{
+  cudf::test::strings_column_wrapper strings({"abcdefgh", "xyz", "", "", "0123456789"},
+                                             {1, 1, 1, 0, 1});
+  auto strings_column = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::slice_strings(strings_column,
+                                              cudf::numeric_scalar<cudf::size_type>(1),
+                                              cudf::numeric_scalar<cudf::size_type>(-1),
+                                              cudf::numeric_scalar<cudf::size_type>(2));
+  cudf::test::strings_column_wrapper expected_forward({"bdf", "y", "", "", "1357"},
+                                                      {1, 1, 1, 0, 1});
+  cudf::test::expect_columns_equal(*results, expected_forward);
+
+  results = cudf::strings::slice_strings(strings_column,
+                                         cudf::numeric_scalar<cudf::size_type>(0, false),
+                                         cudf::numeric_scalar<cudf::size_type>(0, false),
+                                         cudf::numeric_scalar<cudf::size_type>(-1));
+  cudf::test::strings_column_wrapper expected_reversed(
+    {"hgfedcba", "zyx", "", "", "9876543210"}, {1, 1, 1, 0, 1});
+  cudf::test::expect_columns_equal(*results, expected_reversed);
+
+  results = cudf::strings::slice_strings(strings_column,
+                                         cudf::numeric_scalar<cudf::size_type>(6),
+                                         cudf::numeric_scalar<cudf::size_type>(1),
+                                         cudf::numeric_scalar<cudf::size_type>(-2));
+  cudf::test::strings_column_wrapper expected_backward({"gec", "z", "", "", "642"},
+                                                       {1, 1, 1, 0, 1});
+  cudf::test::expect_columns_equal(*results, expected_backward);
+}
+
 TEST_F(StringsSubstringsTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/binaryop.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <algorithm>
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+struct ChunkedTableViewTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ChunkedTableViewTest, ChunkOffsets)
+{
+  column_wrapper<int32_t> c0{{1, 2, 3}, {1, 0, 1}};
+  column_wrapper<int32_t> c1{};
+  column_wrapper<int32_t> c2{{4, 5}, {0, 1}};
+  cudf::chunked_column_view chunked({c0, c1, c2});
+
+  EXPECT_EQ(chunked.size(), 5);
+  EXPECT_EQ(chunked.num_chunks(), 3);
+  EXPECT_EQ(chunked.null_count(), 2);
+  EXPECT_EQ(chunked.type(), cudf::data_type{cudf::INT32});
+  EXPECT_EQ(chunked.chunk_offsets(), (std::vector<cudf::size_type>{0, 3, 3, 5}));
+
+  column_wrapper<int64_t> other{{6}};
+  EXPECT_THROW(cudf::chunked_column_view({c0, other}), cudf::logic_error);
+  EXPECT_THROW(cudf::chunked_table_view({cudf::table_view{{c0}}, cudf::table_view{{other}}}),
+               cudf::logic_error);
+}
+
+TEST_F(ChunkedTableViewTest, GatherMatchesConcatenated)
+{
+  column_wrapper<int16_t> a0{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  column_wrapper<int16_t> a1{{5, 6, 7}};
+  column_wrapper<double> b0{{.5, 1.5, 2.5, 3.5}};
+  column_wrapper<double> b1{{4.5, 5.5, 6.5}, {0, 1, 1}};
+  cudf::test::strings_column_wrapper s0{{"a", "bb", "ccc", "dddd"}, {1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper s1{"e", "ff", "ggg"};
+  column_wrapper<int16_t> e{};
+  column_wrapper<double> f{};
+  cudf::test::strings_column_wrapper g{};
+  // Sliced chunks exercise the chunk offsets, the empty chunk the chunk lookup
+  auto const sliced = cudf::slice(cudf::table_view{{a0, b0, s0}}, {1, 4}).front();
+  cudf::chunked_table_view chunked(
+    {sliced, cudf::table_view{{e, f, g}}, cudf::table_view{{a1, b1, s1}}});
+  auto const concatenated = cudf::concatenate(chunked);
+
+  // Negative indices wrap
+  column_wrapper<int32_t> gather_map{{5, 0, -1, 3, 2, -6, 4}};
+  auto const expected = cudf::gather(concatenated->view(), gather_map);
+  auto const result   = cudf::gather(chunked, gather_map);
+  cudf::test::expect_tables_equal(expected->view(), result->view());
+
+  cudf::test::expect_tables_equal(cudf::gather(concatenated->view(), gather_map, true)->view(),
+                                  cudf::gather(chunked, gather_map, true)->view());
+
+  // Out of bounds indices are nullified, or rejected when checking bounds
+  column_wrapper<int32_t> out_of_bounds_map{{4, 9}};
+  auto const nullified = cudf::gather(chunked, out_of_bounds_map);
+  for (auto const& col : nullified->view()) {
+    EXPECT_EQ(col.null_count(), 1);
+  }
+  EXPECT_THROW(cudf::gather(chunked, out_of_bounds_map, true), cudf::logic_error);
+}
+
+TEST_F(ChunkedTableViewTest, ReduceMatchesConcatenated)
+{
+  column_wrapper<int32_t> c0{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  column_wrapper<int32_t> c1{{5}, {0}};
+  column_wrapper<int32_t> c2{{6, 7}};
+  cudf::chunked_column_view chunked({c0, c1, c2});
+  auto const concatenated = cudf::concatenate(chunked);
+
+  auto const check = [&](std::unique_ptr<cudf::aggregation> const& agg, cudf::data_type type) {
+    auto const expected = cudf::reduce(concatenated->view(), agg, type);
+    auto const result   = cudf::reduce(chunked, agg, type);
+    ASSERT_TRUE(result->is_valid());
+    if (type.id() == cudf::FLOAT64) {
+      EXPECT_DOUBLE_EQ(static_cast<cudf::numeric_scalar<double>*>(expected.get())->value(),
+                       static_cast<cudf::numeric_scalar<double>*>(result.get())->value());
+    } else {
+      EXPECT_EQ(static_cast<cudf::numeric_scalar<int64_t>*>(expected.get())->value(),
+                static_cast<cudf::numeric_scalar<int64_t>*>(result.get())->value());
+    }
+  };
+  auto const int64 = cudf::data_type{cudf::INT64};
+  check(cudf::make_sum_aggregation(), int64);
+  check(cudf::make_product_aggregation(), int64);
+  check(cudf::make_min_aggregation(), int64);
+  check(cudf::make_max_aggregation(), int64);
+  check(cudf::make_sum_of_squares_aggregation(), int64);
+  check(cudf::make_mean_aggregation(), cudf::data_type{cudf::FLOAT64});
+
+  // All-null chunked column
+  cudf::chunked_column_view nulls({c1, c1});
+  EXPECT_FALSE(cudf::reduce(nulls, cudf::make_sum_aggregation(), int64)->is_valid());
+}
+
+TEST_F(ChunkedTableViewTest, BinaryOperationSlicesAtChunkBoundaries)
+{
+  column_wrapper<int32_t> l0{{1, 2, 3}, {1, 0, 1}};
+  column_wrapper<int32_t> l1{{4, 5, 6, 7}};
+  column_wrapper<int32_t> r0{{10, 20}};
+  column_wrapper<int32_t> r1{{30, 40, 50, 60, 70}, {1, 1, 0, 1, 1}};
+  cudf::chunked_column_view lhs({l0, l1});
+  cudf::chunked_column_view rhs({r0, r1});
+
+  auto const results = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::ADD, cudf::data_type{cudf::INT32});
+  // Boundaries at rows 0, 2, 3 and 7
+  ASSERT_EQ(results.size(), 3u);
+  std::vector<cudf::column_view> views(results.size());
+  std::transform(
+    results.begin(), results.end(), views.begin(), [](auto const& c) { return c->view(); });
+  auto const expected = cudf::binary_operation(cudf::concatenate(lhs)->view(),
+                                               cudf::concatenate(rhs)->view(),
+                                               cudf::binary_operator::ADD,
+                                               cudf::data_type{cudf::INT32});
+  cudf::test::expect_columns_equal(expected->view(), cudf::concatenate(views)->view());
+
+  column_wrapper<int32_t> shorter{{1}};
+  EXPECT_THROW(cudf::binary_operation(lhs,
+                                      cudf::chunked_column_view({shorter}),
+                                      cudf::binary_operator::ADD,
+                                      cudf::data_type{cudf::INT32}),
+               cudf::logic_error);
+}
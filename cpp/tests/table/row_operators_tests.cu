@@ -23,6 +23,12 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <rmm/thrust_rmm_allocator.h>
+
 #include <vector>
 
 struct RowOperatorTestForNAN : public cudf::test::BaseFixture {
@@ -66,3 +72,65 @@ TEST_F(RowOperatorTestForNAN, NANSorting)
 
   cudf::test::expect_columns_equal(expected2, got2->view());
 }
+
+/**
+ * @brief Compares each row of a table with the next one, wrapping around
+ */
+struct compare_with_next_row {
+  template <typename Comparator>
+  thrust::host_vector<bool> operator()(Comparator comparator) const
+  {
+    rmm::device_vector<bool> results(num_rows);
+    thrust::transform(thrust::device,
+                      thrust::make_counting_iterator<cudf::size_type>(0),
+                      thrust::make_counting_iterator<cudf::size_type>(num_rows),
+                      results.begin(),
+                      next_row_fn<Comparator>{comparator, num_rows});
+    return thrust::host_vector<bool>(results);
+  }
+
+  template <typename Comparator>
+  struct next_row_fn {
+    Comparator comparator;
+    cudf::size_type num_rows;
+    __device__ bool operator()(cudf::size_type i) { return comparator(i, (i + 1) % num_rows); }
+  };
+
+  cudf::size_type num_rows;
+};
+
+template <typename T>
+struct RowOperatorDispatchTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(RowOperatorDispatchTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(RowOperatorDispatchTest, MatchesRowComparators)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam, int32_t> nullable{{1, 1, 0, 0, 1, 1},
+                                                                      {1, 0, 0, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<TypeParam, int32_t> non_nullable{1, 1, 0, 0, 1, 0};
+  std::vector<cudf::table_view> tables{cudf::table_view{{nullable}},
+                                       cudf::table_view{{non_nullable}},
+                                       cudf::table_view{{nullable, non_nullable}}};
+  compare_with_next_row const compare{6};
+
+  for (auto const& input : tables) {
+    auto const d_input = cudf::table_device_view::create(input);
+    auto const equal   = cudf::dispatch_row_equality_comparator(input, input, true, compare);
+    EXPECT_EQ(equal, compare(cudf::row_equality_comparator<true>{*d_input, *d_input, true}));
+
+    std::vector<cudf::order> const column_order(input.num_columns(), cudf::order::DESCENDING);
+    std::vector<cudf::null_order> const null_precedence(input.num_columns(),
+                                                        cudf::null_order::AFTER);
+    rmm::device_vector<cudf::order> d_column_order(column_order);
+    rmm::device_vector<cudf::null_order> d_null_precedence(null_precedence);
+    auto const less = cudf::dispatch_row_lexicographic_comparator(
+      input, input, column_order, null_precedence, compare);
+    EXPECT_EQ(less,
+              compare(cudf::row_lexicographic_comparator<true>{*d_input,
+                                                               *d_input,
+                                                               d_column_order.data().get(),
+                                                               d_null_precedence.data().get()}));
+  }
+}
@@ -150,4 +150,33 @@ TEST_F(TableTest, CreateFromViewVectorEmptyTables)
   EXPECT_EQ(final_view.num_columns(), 0);
 }
 
+TEST_F(TableTest, NullCountsOfUnknownColumns)
+{
+  CVector cols;
+  cols.push_back(column_wrapper<int32_t>{{1, 2, 3, 4, 5}, {1, 0, 1, 0, 0}}.release());
+  cols.push_back(column_wrapper<int64_t>{{1, 2, 3, 4, 5}, {1, 1, 1, 1, 0}}.release());
+  cols.push_back(column_wrapper<int8_t>{{1, 2, 3, 4, 5}}.release());
+  for (auto& c : cols) { c->set_null_count(cudf::UNKNOWN_NULL_COUNT); }
+  Table t(std::move(cols));
+
+  auto const view = t.view();
+  EXPECT_EQ(3, view.column(0).null_count());
+  EXPECT_EQ(1, view.column(1).null_count());
+  EXPECT_EQ(0, view.column(2).null_count());
+  EXPECT_EQ(3, t.get_column(0).null_count());
+  EXPECT_EQ(1, t.get_column(1).null_count());
+}
+
+TEST_F(TableTest, NullCountsOfSlicedTable)
+{
+  column_wrapper<int32_t> col1{{1, 2, 3, 4, 5, 6, 7}, {1, 0, 1, 0, 0, 1, 1}};
+  column_wrapper<int16_t> col2{{1, 2, 3, 4, 5, 6, 7}, {0, 0, 0, 1, 1, 1, 0}};
+  column_wrapper<int8_t> col3{{1, 2, 3, 4, 5, 6, 7}};
+  TView t{{col1, col2, col3}};
+
+  auto const sliced = cudf::slice(t, {1, 6}).front();
+  EXPECT_EQ(cudf::null_count(sliced), (std::vector<cudf::size_type>{3, 2, 0}));
+  EXPECT_EQ(cudf::null_count(t), (std::vector<cudf::size_type>{3, 4, 0}));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/device_view_cache.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -135,3 +136,34 @@ TEST_F(TableViewTest, SelectNoColumns)
   cudf::table_view selected = t.select({});
   EXPECT_EQ(selected.num_columns(), 0);
 }
+
+TEST_F(TableViewTest, DeviceViewCache)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3}};
+  cudf::test::strings_column_wrapper col2{"a", "b", "c"};
+  cudf::table_view input{{col1, col2}};
+  auto const key = cudf::detail::make_device_view_key({col1, col2}, true, 0);
+
+  // Descriptors are not cached outside of a scope
+  cudf::table_device_view::create(input);
+  EXPECT_EQ(cudf::detail::find_cached_device_view(key), nullptr);
+
+  {
+    cudf::detail::device_view_cache_scope const scope;
+    auto const view1  = cudf::table_device_view::create(input);
+    auto const cached = cudf::detail::find_cached_device_view(key);
+    ASSERT_NE(cached, nullptr);
+    {
+      cudf::detail::device_view_cache_scope const nested_scope;
+      auto const view2 = cudf::table_device_view::create(input);
+      EXPECT_EQ(cudf::detail::find_cached_device_view(key), cached);
+    }
+    // The children of a column with the same views are not the same descriptors
+    auto const children_key = cudf::detail::make_device_view_key({col1, col2}, false, 0);
+    EXPECT_EQ(cudf::detail::find_cached_device_view(children_key), nullptr);
+    EXPECT_EQ(cudf::detail::find_cached_device_view(key), cached);
+  }
+
+  // The cache is cleared when the outermost scope ends
+  EXPECT_EQ(cudf::detail::find_cached_device_view(key), nullptr);
+}
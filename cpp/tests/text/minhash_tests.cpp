@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <nvtext/minhash.hpp>
+
+#include <limits>
+#include <vector>
+
+struct TextMinHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TextMinHashTest, HashCharacterNgrams)
+{
+  std::vector<const char*> h_strings{"doc", "hello", nullptr, "é ab", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  auto results = nvtext::hash_character_ngrams(strings_view, 3);
+  EXPECT_EQ(results->type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(results->null_count(), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 1, 4, 4, 6, 6};
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_hashes{
+    3584054563u, 4121571398u, 497549031u, 1477398172u, 2992354305u, 3534924162u};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_hashes);
+}
+
+TEST_F(TextMinHashTest, MinHash)
+{
+  std::vector<const char*> h_strings{"doc", "hello", nullptr, "é ab", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds{0, 7};
+  auto results = nvtext::minhash(strings_view, seeds, 3);
+  EXPECT_EQ(results->null_count(), 1);
+  auto const max_hash = std::numeric_limits<uint32_t>::max();
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 2, 4, 6, 8, 10};
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_hashes{3584054563u,
+                                                                   1119228049u,
+                                                                   497549031u,
+                                                                   1104380749u,
+                                                                   max_hash,
+                                                                   max_hash,
+                                                                   2992354305u,
+                                                                   1751998466u,
+                                                                   max_hash,
+                                                                   max_hash};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_hashes);
+}
+
+TEST_F(TextMinHashTest, ErrorsTest)
+{
+  cudf::test::strings_column_wrapper strings{"this string intentionally left blank"};
+  cudf::strings_column_view strings_view(strings);
+  EXPECT_THROW(nvtext::hash_character_ngrams(strings_view, 1), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds{0};
+  EXPECT_THROW(nvtext::minhash(strings_view, seeds, 1), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<uint32_t> empty_seeds{};
+  EXPECT_THROW(nvtext::minhash(strings_view, empty_seeds), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<int32_t> int_seeds{1, 2};
+  EXPECT_THROW(nvtext::minhash(strings_view, int_seeds), cudf::logic_error);
+}
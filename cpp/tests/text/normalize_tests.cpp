@@ -71,3 +71,41 @@ TEST_F(TextNormalizeTest, NormalizeEmptyTest)
   EXPECT_EQ(results->size(), 0);
   EXPECT_EQ(results->has_nulls(), false);
 }
+
+TEST_F(TextNormalizeTest, NormalizeTokenize)
+{
+  std::vector<const char*> h_strings{"Héllo, Wörld!", nullptr, "", "THE\tfox"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  auto results = nvtext::normalize_tokenize(strings_view, true);
+  cudf::test::strings_column_wrapper expected{"hello", ",", "world", "!", "the", "fox"};
+  cudf::test::expect_columns_equal(*results, expected);
+  results = nvtext::normalize_tokenize(strings_view, false);
+  cudf::test::strings_column_wrapper expected_cased{"Héllo", ",", "Wörld", "!", "THE", "fox"};
+  cudf::test::expect_columns_equal(*results, expected_cased);
+
+  results = nvtext::normalize_count_tokens(strings_view, true);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_counts{4, 0, 0, 2};
+  cudf::test::expect_columns_equal(*results, expected_counts);
+
+  results = nvtext::normalize_hash_tokens(strings_view, true);
+  EXPECT_EQ(results->null_count(), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 4, 4, 4, 6};
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_hashes{
+    613153351u, 3417188605u, 4220927227u, 1919294708u, 3162218338u, 2673099881u};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_hashes);
+}
+
+TEST_F(TextNormalizeTest, NormalizeTokenizeEmptyTest)
+{
+  auto strings = cudf::make_empty_column(cudf::data_type{cudf::STRING});
+  cudf::strings_column_view strings_view(strings->view());
+  EXPECT_EQ(nvtext::normalize_tokenize(strings_view, true)->size(), 0);
+  EXPECT_EQ(nvtext::normalize_count_tokens(strings_view, true)->size(), 0);
+  EXPECT_EQ(nvtext::normalize_hash_tokens(strings_view, true)->size(), 0);
+}
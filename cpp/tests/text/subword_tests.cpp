@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <nvtext/normalize.hpp>
+#include <nvtext/subword_tokenize.hpp>
+
+#include <vector>
+
+struct TextSubwordTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::unique_ptr<nvtext::wordpiece_vocabulary> create_vocabulary()
+{
+  cudf::test::strings_column_wrapper vocabulary{
+    "[PAD]", "[UNK]", "hello", "world", "##s", "un", "##aff", "##able", ",", "!"};
+  return nvtext::load_vocabulary(cudf::strings_column_view(vocabulary));
+}
+
+cudf::test::strings_column_wrapper create_input()
+{
+  std::vector<const char*> h_strings{"Hello worlds!", "unaffable, xyz", nullptr};
+  return cudf::test::strings_column_wrapper(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+}
+}  // namespace
+
+TEST_F(TextSubwordTest, NormalizeCharacters)
+{
+  std::vector<const char*> h_strings{"Héllo,\tWörld!", "ÀÉÎÕÜ ç", nullptr, "", "abc"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  std::vector<const char*> h_expected{"hello ,  world ! ", "aeiou c", nullptr, "", "abc"};
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(),
+    h_expected.end(),
+    thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+  auto results = nvtext::normalize_characters(strings_view, true);
+  cudf::test::expect_columns_equal(*results, expected);
+
+  std::vector<const char*> h_cased{"Héllo ,  Wörld ! ", "ÀÉÎÕÜ ç", nullptr, "", "abc"};
+  cudf::test::strings_column_wrapper cased(
+    h_cased.begin(),
+    h_cased.end(),
+    thrust::make_transform_iterator(h_cased.begin(), [](auto str) { return str != nullptr; }));
+  results = nvtext::normalize_characters(strings_view, false);
+  cudf::test::expect_columns_equal(*results, cased);
+}
+
+TEST_F(TextSubwordTest, TokenizeTruncate)
+{
+  auto vocabulary = create_vocabulary();
+  EXPECT_EQ(vocabulary->unknown_token_id, 1u);
+  auto strings = create_input();
+  auto results =
+    nvtext::subword_tokenize(cudf::strings_column_view(strings), *vocabulary, 4, 4, true, true);
+  EXPECT_EQ(results.nrows_tensor, 3u);
+  EXPECT_EQ(results.sequence_length, 4u);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_ids{2, 3, 4, 9, 5, 6, 7, 8, 0, 0, 0, 0};
+  cudf::test::expect_columns_equal(*results.tensor_token_ids, expected_ids);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_mask{
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0};
+  cudf::test::expect_columns_equal(*results.tensor_attention_mask, expected_mask);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata{0, 0, 3, 1, 0, 3, 2, 0, 0};
+  cudf::test::expect_columns_equal(*results.tensor_metadata, expected_metadata);
+}
+
+TEST_F(TextSubwordTest, TokenizeStride)
+{
+  auto vocabulary = create_vocabulary();
+  auto strings    = create_input();
+  auto results =
+    nvtext::subword_tokenize(cudf::strings_column_view(strings), *vocabulary, 4, 2, true, false);
+  EXPECT_EQ(results.nrows_tensor, 4u);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_ids{
+    2, 3, 4, 9, 5, 6, 7, 8, 7, 8, 1, 0, 0, 0, 0, 0};
+  cudf::test::expect_columns_equal(*results.tensor_token_ids, expected_ids);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_mask{
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+  cudf::test::expect_columns_equal(*results.tensor_attention_mask, expected_mask);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata{
+    0, 0, 3, 1, 0, 3, 1, 2, 4, 2, 0, 0};
+  cudf::test::expect_columns_equal(*results.tensor_metadata, expected_metadata);
+}
+
+TEST_F(TextSubwordTest, ErrorTest)
+{
+  cudf::test::strings_column_wrapper vocabulary{"[PAD]", "hello"};
+  EXPECT_THROW(nvtext::load_vocabulary(cudf::strings_column_view(vocabulary)), cudf::logic_error);
+  auto vocab   = create_vocabulary();
+  auto strings = create_input();
+  EXPECT_THROW(
+    nvtext::subword_tokenize(cudf::strings_column_view(strings), *vocab, 4, 5, true, false),
+    cudf::logic_error);
+  EXPECT_THROW(
+    nvtext::subword_tokenize(cudf::strings_column_view(strings), *vocab, 0, 0, true, false),
+    cudf::logic_error);
+}
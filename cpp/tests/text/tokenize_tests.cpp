@@ -59,6 +59,59 @@ TEST_F(TextTokenizeTest, Tokenize)
   cudf::test::expect_columns_equal(*results, expected_counts);
 }
 
+TEST_F(TextTokenizeTest, TokenizeRecord)
+{
+  std::vector<const char*> h_strings{"the fox jumped", nullptr, "", "  over the dog "};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  auto results = nvtext::tokenize_record(strings_view);
+  EXPECT_EQ(results->type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(results->null_count(), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 3, 3, 3, 6};
+  cudf::test::strings_column_wrapper expected_tokens{"the", "fox", "jumped", "over", "the", "dog"};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_tokens);
+
+  cudf::test::strings_column_wrapper delimiters{"o", " "};
+  results = nvtext::tokenize_record(strings_view, cudf::strings_column_view(delimiters));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_multi_offsets{0, 4, 4, 4, 8};
+  cudf::test::strings_column_wrapper expected_multi_tokens{
+    "the", "f", "x", "jumped", "ver", "the", "d", "g"};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_multi_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_multi_tokens);
+}
+
+TEST_F(TextTokenizeTest, TokenizeWithVocabulary)
+{
+  std::vector<const char*> h_strings{"the fox jumped", nullptr, "", "  over the dog "};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  cudf::test::strings_column_wrapper vocabulary{"the", "fox", "dog", "jumped", "the", "over"};
+  auto vocab = nvtext::load_token_vocabulary(cudf::strings_column_view(vocabulary));
+
+  auto results = nvtext::tokenize_with_vocabulary(strings_view, *vocab);
+  EXPECT_EQ(results->type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(results->null_count(), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 3, 3, 3, 6};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ids{0, 1, 3, 5, 0, 2};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_ids);
+
+  results = nvtext::tokenize_with_vocabulary(strings_view, *vocab, cudf::string_scalar("o"), 99);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_delimited_offsets{0, 2, 2, 2, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_delimited_ids{99, 99, 99, 99, 99};
+  cudf::test::expect_columns_equal(results->view().child(0), expected_delimited_offsets);
+  cudf::test::expect_columns_equal(results->view().child(1), expected_delimited_ids);
+}
+
 TEST_F(TextTokenizeTest, TokenizeMulti)
 {
   std::vector<const char*> h_strings{"the fox jumped over the dog",
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+using cudf::ast::ast_operator;
+
+struct ComputeColumnTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ComputeColumnTest, FusedArithmeticComparison)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> b{5, 6, 7, 8};
+  cudf::test::fixed_width_column_wrapper<int32_t> c{1, -15, 0, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> d{5, 0, 22, 34};
+  cudf::table_view table{{a, b, c, d}};
+
+  // a * b + c > d
+  auto expr = cudf::ast::operation(
+    ast_operator::GREATER,
+    cudf::ast::operation(ast_operator::ADD,
+                         cudf::ast::operation(ast_operator::MUL,
+                                              cudf::ast::column_reference(0),
+                                              cudf::ast::column_reference(1)),
+                         cudf::ast::column_reference(2)),
+    cudf::ast::column_reference(3));
+  auto result = cudf::compute_column(table, expr);
+
+  cudf::test::fixed_width_column_wrapper<bool> expected{true, false, false, false};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ComputeColumnTest, LiteralAndTypePromotion)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3};
+  cudf::table_view table{{a}};
+  cudf::numeric_scalar<double> half{0.5};
+
+  auto expr = cudf::ast::operation(
+    ast_operator::MUL, cudf::ast::column_reference(0), cudf::ast::literal(half));
+  auto result = cudf::compute_column(table, expr);
+
+  cudf::test::fixed_width_column_wrapper<double> expected{0.5, 1.0, 1.5};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ComputeColumnTest, RepeatedColumnReference)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> a{1, -2, 3};
+  cudf::table_view table{{a}};
+
+  auto col  = cudf::ast::column_reference(0);
+  auto expr = cudf::ast::operation(ast_operator::SUB,
+                                   cudf::ast::operation(ast_operator::MUL, col, col),
+                                   cudf::ast::operation(ast_operator::NEGATE, col));
+  auto result = cudf::compute_column(table, expr);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{2, 2, 12};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ComputeColumnTest, NullsPropagate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4}, {1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> b({5, 6, 7, 8}, {1, 1, 0, 1});
+  cudf::table_view table{{a, b}};
+
+  auto expr = cudf::ast::operation(
+    ast_operator::ADD, cudf::ast::column_reference(0), cudf::ast::column_reference(1));
+  auto result = cudf::compute_column(table, expr);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({6, 0, 0, 12}, {1, 0, 0, 1});
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ComputeColumnTest, NullOperators)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4}, {1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> b({1, 6, 7, 8}, {1, 1, 0, 0});
+  cudf::table_view table{{a, b}};
+  auto lhs = cudf::ast::column_reference(0);
+  auto rhs = cudf::ast::column_reference(1);
+
+  auto is_null = cudf::compute_column(table, cudf::ast::operation(ast_operator::IS_NULL, lhs));
+  cudf::test::fixed_width_column_wrapper<bool> expected_is_null{false, true, false, true};
+  cudf::test::expect_columns_equal(expected_is_null, *is_null);
+
+  auto null_equals =
+    cudf::compute_column(table, cudf::ast::operation(ast_operator::NULL_EQUALS, lhs, rhs));
+  cudf::test::fixed_width_column_wrapper<bool> expected_null_equals{true, false, false, true};
+  cudf::test::expect_columns_equal(expected_null_equals, *null_equals);
+
+  auto coalesce =
+    cudf::compute_column(table, cudf::ast::operation(ast_operator::COALESCE, lhs, rhs));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_coalesce({1, 6, 3, 0}, {1, 1, 1, 0});
+  cudf::test::expect_columns_equal(expected_coalesce, *coalesce);
+}
+
+TEST_F(ComputeColumnTest, InterpreterFusedArithmeticComparison)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> b{5, 6, 7, 8};
+  cudf::test::fixed_width_column_wrapper<int32_t> c{1, -15, 0, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> d{5, 0, 22, 34};
+  cudf::table_view table{{a, b, c, d}};
+
+  // a * b + c > d
+  auto expr = cudf::ast::operation(
+    ast_operator::GREATER,
+    cudf::ast::operation(ast_operator::ADD,
+                         cudf::ast::operation(ast_operator::MUL,
+                                              cudf::ast::column_reference(0),
+                                              cudf::ast::column_reference(1)),
+                         cudf::ast::column_reference(2)),
+    cudf::ast::column_reference(3));
+  auto result = cudf::compute_column(table, expr, cudf::ast::evaluation_strategy::INTERPRETER);
+
+  cudf::test::fixed_width_column_wrapper<bool> expected{true, false, false, false};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ComputeColumnTest, InterpreterMatchesJit)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> a({-3, 2, 100, 4, 7}, {1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<float> b({0.5, 6, -7.25, 8, 1}, {1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<uint16_t> c{1, 15, 0, 2, 65535};
+  cudf::table_view table{{a, b, c}};
+  cudf::numeric_scalar<int64_t> three{3};
+  cudf::numeric_scalar<double> null_literal{0, false};
+
+  auto col_a = cudf::ast::column_reference(0);
+  auto col_b = cudf::ast::column_reference(1);
+  auto col_c = cudf::ast::column_reference(2);
+  std::vector<cudf::ast::expression> expressions{
+    cudf::ast::operation(
+      ast_operator::GREATER,
+      cudf::ast::operation(
+        ast_operator::ADD, cudf::ast::operation(ast_operator::MUL, col_a, col_b), col_c),
+      cudf::ast::literal(three)),
+    cudf::ast::operation(ast_operator::MOD,
+                         cudf::ast::operation(ast_operator::COALESCE, col_a, col_c),
+                         cudf::ast::literal(three)),
+    cudf::ast::operation(ast_operator::NULL_EQUALS, col_a, cudf::ast::literal(null_literal)),
+    cudf::ast::operation(ast_operator::NOT,
+                         cudf::ast::operation(ast_operator::LESS, col_a, col_b)),
+    cudf::ast::operation(ast_operator::TRUE_DIV,
+                         cudf::ast::operation(ast_operator::NEGATE, col_c),
+                         col_a),
+    cudf::ast::operation(ast_operator::BITWISE_XOR, col_a, col_c),
+    cudf::ast::operation(ast_operator::ADD, col_a, col_a)};
+
+  for (auto const& expr : expressions) {
+    auto jit = cudf::compute_column(table, expr, cudf::ast::evaluation_strategy::JIT);
+    auto interpreted =
+      cudf::compute_column(table, expr, cudf::ast::evaluation_strategy::INTERPRETER);
+    cudf::test::expect_columns_equal(*jit, *interpreted);
+  }
+}
+
+TEST_F(ComputeColumnTest, InterpreterNullsOverManyWords)
+{
+  constexpr cudf::size_type num_rows = 1000;
+  auto values  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto a_valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto b_valid = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  cudf::test::fixed_width_column_wrapper<int32_t> a(values, values + num_rows + 7, a_valid);
+  cudf::test::fixed_width_column_wrapper<int32_t> b(values, values + num_rows, b_valid);
+  // The rows of `a` start at bit 7 of its mask
+  auto const a_rows = cudf::slice(a, {7, num_rows + 7}).front();
+  cudf::table_view table{{a_rows, b}};
+
+  auto expr   = cudf::ast::operation(
+    ast_operator::ADD, cudf::ast::column_reference(0), cudf::ast::column_reference(1));
+  auto result = cudf::compute_column(table, expr, cudf::ast::evaluation_strategy::INTERPRETER);
+
+  auto sums =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return 2 * i + 7; });
+  auto sums_valid = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i + 7) % 3 != 0 && i % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(sums, sums + num_rows, sums_valid);
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ComputeColumnTest, InvalidExpressions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3};
+  cudf::test::strings_column_wrapper s{"a", "b", "c"};
+  cudf::test::fixed_width_column_wrapper<float> f{1, 2, 3};
+  cudf::table_view table{{a, s, f}};
+
+  EXPECT_THROW(cudf::compute_column(table, cudf::ast::column_reference(3)), cudf::logic_error);
+  EXPECT_THROW(cudf::compute_column(table, cudf::ast::column_reference(1)), cudf::logic_error);
+  EXPECT_THROW(cudf::compute_column(table,
+                                    cudf::ast::operation(ast_operator::BITWISE_AND,
+                                                         cudf::ast::column_reference(0),
+                                                         cudf::ast::column_reference(2))),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::ast::operation(ast_operator::NOT,
+                                    cudf::ast::column_reference(0),
+                                    cudf::ast::column_reference(0)),
+               cudf::logic_error);
+}
@@ -17,9 +17,11 @@
  * limitations under the License.
  */
 
+#include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include "assert-unary.h"
 
@@ -221,6 +223,42 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, Transform_MultiInput_NullPropagation)
+{
+  const char cuda[] =
+    R"***(
+__device__ inline void f(double* out, bool* out_valid, int a, bool a_valid, float b, bool b_valid)
+{
+  *out = a * b;
+}
+)***";
+
+  auto a   = fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  auto b   = fixed_width_column_wrapper<float>{{0.5f, 1.5f, 2.5f, 3.5f}, {1, 0, 1, 1}};
+  auto out = cudf::transform(cudf::table_view{{a, b}}, cuda, data_type(type_id::FLOAT64), false);
+
+  expect_columns_equal(*out, fixed_width_column_wrapper<double>{{0.5, 3, 7.5, 14}, {1, 0, 0, 1}});
+}
+
+TEST_F(UnaryOperationIntegrationTest, Transform_MultiInput_NullAware)
+{
+  // Null b are read as zero, the output is null where a is
+  const char cuda[] =
+    R"***(
+__device__ inline void f(double* out, bool* out_valid, int a, bool a_valid, float b, bool b_valid)
+{
+  *out = a + (b_valid ? b : 0.f);
+  *out_valid = a_valid;
+}
+)***";
+
+  auto a   = fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  auto b   = fixed_width_column_wrapper<float>{{0.5f, 1.5f, 2.5f, 3.5f}, {1, 0, 1, 0}};
+  auto out = cudf::transform(cudf::table_view{{a, b}}, cuda, data_type(type_id::FLOAT64), false);
+
+  expect_columns_equal(*out, fixed_width_column_wrapper<double>{{1.5, 2, 5.5, 4}, {1, 1, 0, 1}});
+}
+
 }  // namespace transformation
 }  // namespace test
 }  // namespace cudf
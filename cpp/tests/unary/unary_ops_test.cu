@@ -211,6 +211,16 @@ TYPED_TEST(cudf_math_test, SimpleCBRTWithNullMask)
   cudf::test::expect_columns_equal(expected, output->view());
 }
 
+TYPED_TEST(cudf_math_test, SimpleSQRTInPlace)
+{
+  auto column =
+    cudf::test::fixed_width_column_wrapper<TypeParam>{{1, 4, 9, 16}, {1, 1, 0, 1}}.release();
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected{{1, 2, 9, 4}, {1, 1, 0, 1}};
+  auto in_out = column->mutable_view();
+  cudf::unary_operation_in_place(in_out, cudf::unary_op::SQRT);
+  cudf::test::expect_columns_equivalent(expected, column->view());
+}
+
 TYPED_TEST(cudf_math_test, EmptyABS)
 {
   cudf::test::fixed_width_column_wrapper<TypeParam> input{};
@@ -367,6 +377,13 @@ TYPED_TEST(cudf_math_with_char_test, LogicalOpTypeFail)
   EXPECT_THROW(auto output = cudf::unary_operation(input, cudf::unary_op::NOT), cudf::logic_error);
 }
 
+TYPED_TEST(cudf_math_with_char_test, LogicalOpInPlaceTypeFail)
+{
+  auto column = cudf::test::fixed_width_column_wrapper<TypeParam>{'h'}.release();
+  auto in_out = column->mutable_view();
+  EXPECT_THROW(cudf::unary_operation_in_place(in_out, cudf::unary_op::NOT), cudf::logic_error);
+}
+
 template <typename T>
 struct IsNull : public cudf::test::BaseFixture {
 };
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/metrics.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <memory>
+
+struct MetricsTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    cudf::metrics::collect();
+    cudf::metrics::enable();
+  }
+
+  void TearDown() override { cudf::metrics::disable(); }
+};
+
+namespace {
+std::unique_ptr<cudf::column> two_sequences(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const init = cudf::numeric_scalar<int32_t>(0);
+  auto first      = cudf::sequence(1000, init, mr);
+  return cudf::sequence(100, init, mr);
+}
+
+}  // namespace
+
+TEST_F(MetricsTest, RecordsApiCalls)
+{
+  cudf::metrics::metrics_resource_adaptor mr(rmm::mr::get_default_resource());
+  auto const result = cudf::sequence(100, cudf::numeric_scalar<int32_t>(0), &mr);
+
+  auto const metrics = cudf::metrics::collect();
+  ASSERT_EQ(1u, metrics.size());
+  EXPECT_EQ("sequence", metrics[0].name);
+  EXPECT_GE(metrics[0].wall_time_ms, 0);
+  EXPECT_GE(metrics[0].gpu_time_ms, 0);
+  EXPECT_GE(metrics[0].output_bytes, static_cast<int64_t>(100 * sizeof(int32_t)));
+  EXPECT_TRUE(cudf::metrics::collect().empty());
+}
+
+TEST_F(MetricsTest, AttributesNestedCallsToTheOutermost)
+{
+  cudf::metrics::metrics_resource_adaptor mr(rmm::mr::get_default_resource());
+  auto const result = two_sequences(&mr);
+
+  auto const metrics = cudf::metrics::collect();
+  ASSERT_EQ(1u, metrics.size());
+  EXPECT_EQ("two_sequences", metrics[0].name);
+  // The first sequence is freed before returning
+  EXPECT_GE(metrics[0].output_bytes, static_cast<int64_t>(100 * sizeof(int32_t)));
+  EXPECT_LT(metrics[0].output_bytes, static_cast<int64_t>(1000 * sizeof(int32_t)));
+  EXPECT_GE(metrics[0].peak_temporary_bytes, static_cast<int64_t>(1000 * sizeof(int32_t)));
+}
+
+TEST_F(MetricsTest, DisabledRecordsNothing)
+{
+  cudf::metrics::disable();
+  EXPECT_FALSE(cudf::metrics::is_enabled());
+  auto const result = cudf::sequence(100, cudf::numeric_scalar<int32_t>(0));
+  EXPECT_TRUE(cudf::metrics::collect().empty());
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/detail/utilities/scratch_arena.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+
+struct ScratchArenaTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScratchArenaTest, CarvesBuffersFromTheWorkspace)
+{
+  cudf::detail::scratch_arena arena(3 * cudf::detail::scratch_arena::alignment);
+  EXPECT_EQ(3 * cudf::detail::scratch_arena::alignment, arena.capacity());
+  EXPECT_EQ(0u, arena.used());
+
+  rmm::device_buffer first(100, 0, &arena);
+  rmm::device_buffer second(300, 0, &arena);
+  EXPECT_EQ(3 * cudf::detail::scratch_arena::alignment, arena.used());
+  EXPECT_EQ(static_cast<char const*>(first.data()) + cudf::detail::scratch_arena::alignment,
+            static_cast<char const*>(second.data()));
+
+  // Buffers that do not fit are allocated upstream
+  rmm::device_buffer overflow(100, 0, &arena);
+  EXPECT_EQ(3 * cudf::detail::scratch_arena::alignment, arena.used());
+}
+
+TEST_F(ScratchArenaTest, ReleasesLikeAStack)
+{
+  cudf::detail::scratch_arena arena(4 * cudf::detail::scratch_arena::alignment);
+  auto first  = std::make_unique<rmm::device_buffer>(10, 0, &arena);
+  auto second = std::make_unique<rmm::device_buffer>(10, 0, &arena);
+  auto third  = std::make_unique<rmm::device_buffer>(10, 0, &arena);
+  EXPECT_EQ(3 * cudf::detail::scratch_arena::alignment, arena.used());
+
+  // The memory of a buffer is reclaimed once the buffers carved after it are released
+  second.reset();
+  EXPECT_EQ(3 * cudf::detail::scratch_arena::alignment, arena.used());
+  third.reset();
+  EXPECT_EQ(cudf::detail::scratch_arena::alignment, arena.used());
+
+  auto const reused = static_cast<char const*>(first->data()) +
+                      cudf::detail::scratch_arena::alignment;
+  rmm::device_buffer fourth(10, 0, &arena);
+  EXPECT_EQ(reused, static_cast<char const*>(fourth.data()));
+  first.reset();
+  EXPECT_EQ(2 * cudf::detail::scratch_arena::alignment, arena.used());
+}
@@ -0,0 +1,219 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+package ai.rapids.cudf;
+
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * A small plan of column operations that is executed with a single native call.
+ * <p>
+ * Every input and every operation of the batch gets a slot, returned when it is added, that
+ * later operations use to refer to it. Only the slots passed to {@link #execute(int...)} are
+ * returned; all other intermediate results stay in native memory and are freed before
+ * {@link #execute(int...)} returns. This avoids a JNI crossing, and the creation of a
+ * ColumnVector, per operation per column.
+ * <pre>
+ *   ColumnOpBatch batch = new ColumnOpBatch();
+ *   int a = batch.input(cvA);
+ *   int b = batch.input(cvB);
+ *   int sum = batch.binaryOp(BinaryOp.ADD, a, b, DType.INT64);
+ *   int filled = batch.replaceNulls(sum, zero);
+ *   ColumnVector[] results = batch.execute(filled);
+ * </pre>
+ * The batch does not take ownership of its inputs or scalars, which must stay open until
+ * {@link #execute(int...)} returns.
+ */
+public final class ColumnOpBatch {
+  static {
+    NativeDepsLoader.loadNativeDeps();
+  }
+
+  /**
+   * Operations of a batch. These must be kept in sync with op_code in ColumnOpBatchJni.cpp.
+   */
+  private enum OpCode {
+    UNARY(0),
+    BINARY_VV(1),
+    BINARY_VS(2),
+    IS_NULL(3),
+    IS_NOT_NULL(4),
+    CAST(5),
+    REPLACE_NULLS(6);
+
+    final int nativeId;
+
+    OpCode(int nativeId) {
+      this.nativeId = nativeId;
+    }
+  }
+
+  private final List<ColumnVector> inputs = new ArrayList<>();
+  private final List<Scalar> scalars = new ArrayList<>();
+  // Every operation is encoded as {op code, arg0, arg1, param0, param1}
+  private final List<int[]> ops = new ArrayList<>();
+
+  private int numSlots() {
+    return inputs.size() + ops.size();
+  }
+
+  private int checkSlot(int slot) {
+    if (slot < 0 || slot >= numSlots()) {
+      throw new IllegalArgumentException("Invalid slot " + slot);
+    }
+    return slot;
+  }
+
+  private int addScalar(Scalar scalar) {
+    scalars.add(scalar);
+    return scalars.size() - 1;
+  }
+
+  private int addOp(OpCode op, int arg0, int arg1, int param0, int param1) {
+    ops.add(new int[]{op.nativeId, arg0, arg1, param0, param1});
+    return numSlots() - 1;
+  }
+
+  /**
+   * Add an input column to the batch. Inputs must be added before any operation.
+   * @param column the input column
+   * @return the slot of the input
+   */
+  public int input(ColumnVector column) {
+    if (!ops.isEmpty()) {
+      throw new IllegalStateException("Inputs must be added before any operation");
+    }
+    inputs.add(column);
+    return inputs.size() - 1;
+  }
+
+  /**
+   * Add a unary operation, see {@link ColumnVector#unaryOp(UnaryOp)}.
+   * @return the slot of the result
+   */
+  public int unaryOp(UnaryOp op, int input) {
+    return addOp(OpCode.UNARY, checkSlot(input), 0, op.nativeId, 0);
+  }
+
+  /**
+   * Add a binary operation between two columns, see
+   * {@link ColumnVector#binaryOp(BinaryOp, BinaryOperable, DType)}.
+   * @return the slot of the result
+   */
+  public int binaryOp(BinaryOp op, int lhs, int rhs, DType outType) {
+    return addOp(OpCode.BINARY_VV, checkSlot(lhs), checkSlot(rhs), op.nativeId,
+        outType.nativeId);
+  }
+
+  /**
+   * Add a binary operation between a column and a scalar, see
+   * {@link ColumnVector#binaryOp(BinaryOp, BinaryOperable, DType)}.
+   * @return the slot of the result
+   */
+  public int binaryOp(BinaryOp op, int lhs, Scalar rhs, DType outType) {
+    return addOp(OpCode.BINARY_VS, checkSlot(lhs), addScalar(rhs), op.nativeId,
+        outType.nativeId);
+  }
+
+  /**
+   * Add an operation returning whether each row is null, see {@link ColumnVector#isNull()}.
+   * @return the slot of the result
+   */
+  public int isNull(int input) {
+    return addOp(OpCode.IS_NULL, checkSlot(input), 0, 0, 0);
+  }
+
+  /**
+   * Add an operation returning whether each row is not null, see
+   * {@link ColumnVector#isNotNull()}.
+   * @return the slot of the result
+   */
+  public int isNotNull(int input) {
+    return addOp(OpCode.IS_NOT_NULL, checkSlot(input), 0, 0, 0);
+  }
+
+  /**
+   * Add a cast between fixed-width types. Casts from or to strings are not supported in a
+   * batch, use {@link ColumnVector#castTo(DType)} instead.
+   * @return the slot of the result
+   */
+  public int castTo(int input, DType type) {
+    if (type == DType.STRING) {
+      throw new IllegalArgumentException("Casts to strings are not supported in a batch");
+    }
+    return addOp(OpCode.CAST, checkSlot(input), 0, type.nativeId, 0);
+  }
+
+  /**
+   * Add an operation replacing nulls with a scalar, see
+   * {@link ColumnVector#replaceNulls(Scalar)}.
+   * @return the slot of the result
+   */
+  public int replaceNulls(int input, Scalar scalar) {
+    return addOp(OpCode.REPLACE_NULLS, checkSlot(input), addScalar(scalar), 0, 0);
+  }
+
+  /**
+   * Execute the batch in a single native call.
+   * @param outputs the slots to return. Slots of inputs, or slots returned more than once,
+   *                are returned as copies.
+   * @return the columns of the slots, in order. The caller must close them.
+   */
+  public ColumnVector[] execute(int... outputs) {
+    for (int slot : outputs) {
+      checkSlot(slot);
+    }
+    long[] inputHandles = new long[inputs.size()];
+    for (int i = 0; i < inputHandles.length; i++) {
+      inputHandles[i] = inputs.get(i).getNativeView();
+    }
+    long[] scalarHandles = new long[scalars.size()];
+    for (int i = 0; i < scalarHandles.length; i++) {
+      scalarHandles[i] = scalars.get(i).getScalarHandle();
+    }
+    int[] encodedOps = new int[ops.size() * 5];
+    for (int i = 0; i < ops.size(); i++) {
+      System.arraycopy(ops.get(i), 0, encodedOps, i * 5, 5);
+    }
+
+    long[] handles = executeNative(inputHandles, scalarHandles, encodedOps, outputs);
+    ColumnVector[] results = new ColumnVector[handles.length];
+    try {
+      for (int i = 0; i < handles.length; i++) {
+        results[i] = new ColumnVector(handles[i]);
+        handles[i] = 0;
+      }
+    } catch (Throwable t) {
+      for (ColumnVector cv : results) {
+        if (cv != null) {
+          cv.close();
+        }
+      }
+      for (long handle : handles) {
+        if (handle != 0) {
+          ColumnVector.deleteCudfColumn(handle);
+        }
+      }
+      throw t;
+    }
+    return results;
+  }
+
+  private static native long[] executeNative(long[] inputs, long[] scalars, int[] ops,
+                                             int[] outputs) throws CudfException;
+}
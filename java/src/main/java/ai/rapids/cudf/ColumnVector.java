@@ -24,6 +24,7 @@ import ai.rapids.cudf.WindowOptions.FrameType;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
+import java.util.Objects;
 import java.util.Optional;
 import java.util.function.Consumer;
 
@@ -258,6 +259,23 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable {
    * Copy the data to the host.
    */
   public HostColumnVector copyToHost() {
+    return copyToHost(null);
+  }
+
+  /**
+   * Copy the data to the host asynchronously on a stream. The host buffers come from the
+   * {@link PinnedMemoryPool} when it has room, so the copy overlaps with work on other
+   * streams. The copy may not have completed when this returns: the data of the returned
+   * column must not be read, and this column must stay open and unchanged, until the stream
+   * has reached the copy, e.g. by synchronizing on a {@link Cuda.Event} recorded on it.
+   * @param stream the stream to copy on
+   * @return the column on the host
+   */
+  public HostColumnVector copyToHostAsync(Cuda.Stream stream) {
+    return copyToHost(Objects.requireNonNull(stream));
+  }
+
+  private HostColumnVector copyToHost(Cuda.Stream stream) {
     try (NvtxRange toHost = new NvtxRange("ensureOnHost", NvtxColor.BLUE)) {
       HostMemoryBuffer hostDataBuffer = null;
       HostMemoryBuffer hostValidityBuffer = null;
@@ -272,17 +290,14 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable {
         getNullCount();
 
         if (valid != null) {
-          hostValidityBuffer = HostMemoryBuffer.allocate(valid.getLength());
-          hostValidityBuffer.copyFromDeviceBuffer(valid);
+          hostValidityBuffer = allocateHostFor(valid, stream);
         }
         if (offsets != null) {
-          hostOffsetsBuffer = HostMemoryBuffer.allocate(offsets.length);
-          hostOffsetsBuffer.copyFromDeviceBuffer(offsets);
+          hostOffsetsBuffer = allocateHostFor(offsets, stream);
         }
         // If a strings column is all null values there is no data buffer allocated
         if (data != null) {
-          hostDataBuffer = HostMemoryBuffer.allocate(data.length);
-          hostDataBuffer.copyFromDeviceBuffer(data);
+          hostDataBuffer = allocateHostFor(data, stream);
         }
         HostColumnVector ret = new HostColumnVector(type, rows, nullCount,
             hostDataBuffer, hostValidityBuffer, hostOffsetsBuffer);
@@ -304,6 +319,24 @@ public final class ColumnVector implements AutoCloseable, BinaryOperable {
     }
   }
 
+  private static HostMemoryBuffer allocateHostFor(BaseDeviceMemoryBuffer src,
+                                                  Cuda.Stream stream) {
+    // Copies into pageable memory would not be asynchronous
+    HostMemoryBuffer dst = stream == null ? HostMemoryBuffer.allocate(src.getLength()) :
+        HostMemoryBuffer.allocate(src.getLength(), true);
+    try {
+      if (stream == null) {
+        dst.copyFromDeviceBuffer(src);
+      } else {
+        dst.copyFromDeviceBufferAsync(src, stream);
+      }
+    } catch (Throwable t) {
+      dst.close();
+      throw t;
+    }
+    return dst;
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // RAW DATA ACCESS
   /////////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@ import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
 import java.nio.charset.StandardCharsets;
+import java.util.Objects;
 import java.util.Optional;
 import java.util.function.Consumer;
 
@@ -209,6 +210,23 @@ public final class HostColumnVector implements AutoCloseable {
    * Copy the data to the device.
    */
   public ColumnVector copyToDevice() {
+    return copyToDevice(null);
+  }
+
+  /**
+   * Copy the data to the device asynchronously on a stream. The copy may not have completed
+   * when this returns, so this column must stay open, and its data unchanged, until the stream
+   * has reached the copy, e.g. by recording a {@link Cuda.Event} on it. The returned column can
+   * be used right away by work on the same stream. Copies from pinned host memory overlap with
+   * work on other streams; copies from pageable memory are staged by CUDA.
+   * @param stream the stream to copy on
+   * @return the column on the device
+   */
+  public ColumnVector copyToDeviceAsync(Cuda.Stream stream) {
+    return copyToDevice(Objects.requireNonNull(stream));
+  }
+
+  private ColumnVector copyToDevice(Cuda.Stream stream) {
     if (rows == 0) {
       return new ColumnVector(type, 0, Optional.of(0L), null, null, null);
     }
@@ -230,23 +248,25 @@ public final class HostColumnVector implements AutoCloseable {
           }
         }
         data = DeviceMemoryBuffer.allocate(dataLen);
-        data.copyFromHostBuffer(hdata, 0, dataLen);
+        copyFromHost(data, hdata, dataLen, stream);
       }
       HostMemoryBuffer hvalid = this.offHeap.valid;
       if (hvalid != null) {
         long validLen = ColumnVector.getNativeValidPointerSize((int)rows);
         valid = DeviceMemoryBuffer.allocate(validLen);
-        valid.copyFromHostBuffer(hvalid, 0 , validLen);
+        copyFromHost(valid, hvalid, validLen, stream);
       }
 
       HostMemoryBuffer hoff = this.offHeap.offsets;
       if (hoff != null) {
         long offsetsLen = OFFSET_SIZE * (rows + 1);
         offsets = DeviceMemoryBuffer.allocate(offsetsLen);
-        offsets.copyFromHostBuffer(hoff, 0 , offsetsLen);
+        copyFromHost(offsets, hoff, offsetsLen, stream);
       }
 
-      ColumnVector ret = new ColumnVector(type, rows, nullCount, data, valid, offsets);
+      // A null count computed later on the device could race with the asynchronous copy
+      Optional<Long> knownNullCount = stream == null ? nullCount : Optional.of(getNullCount());
+      ColumnVector ret = new ColumnVector(type, rows, knownNullCount, data, valid, offsets);
       data = null;
       valid = null;
       offsets = null;
@@ -264,6 +284,15 @@ public final class HostColumnVector implements AutoCloseable {
     }
   }
 
+  private static void copyFromHost(DeviceMemoryBuffer dst, HostMemoryBuffer src, long length,
+                                   Cuda.Stream stream) {
+    if (stream == null) {
+      dst.copyFromHostBuffer(src, 0, length);
+    } else {
+      dst.copyFromHostBufferAsync(0, src, 0, length, stream);
+    }
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // DATA ACCESS
   /////////////////////////////////////////////////////////////////////////////
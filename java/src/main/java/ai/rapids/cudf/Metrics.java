@@ -0,0 +1,71 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+package ai.rapids.cudf;
+
+/**
+ * Records the time and the device memory used by each call of a cudf API, to find performance
+ * regressions and bad plans without attaching a profiler.
+ *
+ * A call made by another cudf API is attributed to the outermost call. The GPU time is measured
+ * with events on the default stream.
+ */
+public final class Metrics {
+  static {
+    NativeDepsLoader.loadNativeDeps();
+  }
+
+  private Metrics() {}
+
+  /**
+   * Start recording the metrics of the cudf API calls.
+   * @param trackAllocations if true the device memory allocated through RMM is attributed to
+   *                         the calls. The RMM default resource is wrapped until
+   *                         {@link #disable()}, which must be called before RMM is shut down.
+   */
+  public static synchronized void enable(boolean trackAllocations) {
+    enableNative(trackAllocations);
+  }
+
+  /**
+   * Stop recording the metrics of the cudf API calls. The metrics recorded so far are kept
+   * until the next {@link #collect()}.
+   */
+  public static synchronized void disable() {
+    disableNative();
+  }
+
+  /**
+   * Is recording the metrics of the cudf API calls enabled.
+   */
+  public static native boolean isEnabled();
+
+  /**
+   * Get the metrics recorded since the last call and clear them. This waits for the recorded
+   * GPU work to complete.
+   * @return the metrics of the completed calls in completion order
+   */
+  public static OperationMetrics[] collect() {
+    return collectNative();
+  }
+
+  private static native void enableNative(boolean trackAllocations);
+
+  private static native void disableNative();
+
+  private static native OperationMetrics[] collectNative();
+}
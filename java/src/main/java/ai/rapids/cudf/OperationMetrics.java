@@ -0,0 +1,65 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+package ai.rapids.cudf;
+
+/**
+ * Measurements of one call of a cudf API, as recorded by {@link Metrics}.
+ */
+public final class OperationMetrics {
+  /**
+   * name of the native API function
+   */
+  public final String name;
+  /**
+   * host time from the entry to the return of the call in milliseconds
+   */
+  public final double wallTimeMs;
+  /**
+   * time between events recorded on the default stream at the entry and the exit of the call
+   * in milliseconds
+   */
+  public final float gpuTimeMs;
+  /**
+   * net device memory allocated by the call in bytes, e.g. the size of its result
+   */
+  public final long outputBytes;
+  /**
+   * peak device memory allocated during the call beyond outputBytes
+   */
+  public final long peakTemporaryBytes;
+
+  OperationMetrics(String name, double wallTimeMs, float gpuTimeMs, long outputBytes,
+      long peakTemporaryBytes) {
+    this.name = name;
+    this.wallTimeMs = wallTimeMs;
+    this.gpuTimeMs = gpuTimeMs;
+    this.outputBytes = outputBytes;
+    this.peakTemporaryBytes = peakTemporaryBytes;
+  }
+
+  @Override
+  public String toString() {
+    return "OperationMetrics{" +
+        "name='" + name + '\'' +
+        ", wallTimeMs=" + wallTimeMs +
+        ", gpuTimeMs=" + gpuTimeMs +
+        ", outputBytes=" + outputBytes +
+        ", peakTemporaryBytes=" + peakTemporaryBytes +
+        '}';
+  }
+}
@@ -271,6 +271,29 @@ public final class Table implements AutoCloseable {
    */
   private static native void writeParquetEnd(long handle);
 
+  /**
+   * Write a table as parquet formatted data into host memory, in a single call.
+   * @param columnNames     names that correspond to the table columns
+   * @param nullable        true if the column can have nulls else false
+   * @param metadataKeys    Metadata key names to place in the Parquet file
+   * @param metadataValues  Metadata values corresponding to metadataKeys
+   * @param compression     native compression codec ID
+   * @param statsFreq       native statistics frequency ID
+   * @param table           the table to write out.
+   * @param address         address of the output host memory.
+   * @param length          size of the output host memory in bytes.
+   * @return the number of bytes written.
+   */
+  private static native long writeParquetToBuffer(String[] columnNames,
+                                                  boolean[] nullable,
+                                                  String[] metadataKeys,
+                                                  String[] metadataValues,
+                                                  int compression,
+                                                  int statsFreq,
+                                                  long table,
+                                                  long address,
+                                                  long length) throws CudfException;
+
   /**
    * Read in ORC formatted data.
    * @param filterColumnNames name of the columns to read, or an empty array if we want to read
@@ -334,6 +357,27 @@ public final class Table implements AutoCloseable {
    */
   private static native void writeORCEnd(long handle);
 
+  /**
+   * Write a table as ORC formatted data into host memory, in a single call.
+   * @param columnNames     names that correspond to the table columns
+   * @param nullable        true if the column can have nulls else false
+   * @param metadataKeys    Metadata key names to place in the ORC file
+   * @param metadataValues  Metadata values corresponding to metadataKeys
+   * @param compression     native compression codec ID
+   * @param table           the table to write out.
+   * @param address         address of the output host memory.
+   * @param length          size of the output host memory in bytes.
+   * @return the number of bytes written.
+   */
+  private static native long writeORCToBuffer(String[] columnNames,
+                                              boolean[] nullable,
+                                              String[] metadataKeys,
+                                              String[] metadataValues,
+                                              int compression,
+                                              long table,
+                                              long address,
+                                              long length) throws CudfException;
+
   private static native long[] groupByAggregate(long inputTable, int[] keyIndices, int[] aggColumnsIndices,
                                                 int[] aggTypes, boolean ignoreNullKeys) throws CudfException;
 
@@ -731,6 +775,27 @@ public final class Table implements AutoCloseable {
     }
   }
 
+  /**
+   * Writes this table as parquet formatted data straight into host memory, with no
+   * intermediate copies. The device data is copied directly into the buffer, so pinned
+   * buffers are the fastest.
+   * @param options parameters for the writer
+   * @param buffer where to write the data, starting at offset 0
+   * @return the number of bytes written
+   * @throws CudfException if the data does not fit in the buffer
+   */
+  public long writeParquet(ParquetWriterOptions options, HostMemoryBuffer buffer) {
+    return writeParquetToBuffer(options.getColumnNames(),
+        options.getColumnNullability(),
+        options.getMetadataKeys(),
+        options.getMetadataValues(),
+        options.getCompressionType().nativeId,
+        options.getStatisticsFrequency().nativeId,
+        nativeHandle,
+        buffer.getAddress(),
+        buffer.getLength());
+  }
+
   private static class ORCTableWriter implements TableWriter {
     private long handle;
     HostBufferConsumer consumer;
@@ -819,6 +884,26 @@ public final class Table implements AutoCloseable {
     }
   }
 
+  /**
+   * Writes this table as ORC formatted data straight into host memory, with no intermediate
+   * copies. The device data is copied directly into the buffer, so pinned buffers are the
+   * fastest.
+   * @param options parameters for the writer
+   * @param buffer where to write the data, starting at offset 0
+   * @return the number of bytes written
+   * @throws CudfException if the data does not fit in the buffer
+   */
+  public long writeORC(ORCWriterOptions options, HostMemoryBuffer buffer) {
+    return writeORCToBuffer(options.getColumnNames(),
+        options.getColumnNullability(),
+        options.getMetadataKeys(),
+        options.getMetadataValues(),
+        options.getCompressionType().nativeId,
+        nativeHandle,
+        buffer.getAddress(),
+        buffer.getLength());
+  }
+
   /**
    * Concatenate multiple tables together to form a single table.
    * The schema of each table (i.e.: number of columns and types of each column) must be equal
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/replace.hpp>
+#include <cudf/unary.hpp>
+
+#include "jni_utils.hpp"
+
+namespace {
+
+/**
+ * Operations of a batch. These must be kept in sync with ColumnOpBatch.OpCode.
+ */
+enum class op_code : jint {
+  UNARY = 0,
+  BINARY_VV = 1,
+  BINARY_VS = 2,
+  IS_NULL = 3,
+  IS_NOT_NULL = 4,
+  CAST = 5,
+  REPLACE_NULLS = 6
+};
+
+// Every operation is encoded as {op_code, arg0, arg1, param0, param1}
+constexpr int OP_WIDTH = 5;
+
+/**
+ * @brief The columns of a batch: its inputs followed by the result of each operation.
+ */
+class batch_slots {
+  std::vector<cudf::column_view> views;
+  std::vector<std::unique_ptr<cudf::column>> owned;
+
+public:
+  explicit batch_slots(cudf::jni::native_jpointerArray<cudf::column_view> const &inputs) {
+    for (int i = 0; i < inputs.size(); ++i) {
+      CUDF_EXPECTS(inputs[i] != nullptr, "input column is null");
+      views.push_back(*inputs[i]);
+      owned.emplace_back();
+    }
+  }
+
+  cudf::column_view const &view(jint slot) const {
+    CUDF_EXPECTS(slot >= 0 && slot < static_cast<jint>(views.size()), "invalid column slot");
+    return views[slot];
+  }
+
+  void add(std::unique_ptr<cudf::column> &&result) {
+    views.push_back(result->view());
+    owned.push_back(std::move(result));
+  }
+
+  /**
+   * @brief Takes the column of a slot. Inputs, and results already taken, are copied.
+   */
+  std::unique_ptr<cudf::column> take(jint slot) {
+    auto const &v = view(slot);
+    if (owned[slot]) {
+      return std::move(owned[slot]);
+    }
+    return std::make_unique<cudf::column>(v);
+  }
+};
+
+cudf::scalar const &get_scalar(cudf::jni::native_jpointerArray<cudf::scalar> const &scalars,
+                               jint index) {
+  CUDF_EXPECTS(index >= 0 && index < scalars.size(), "invalid scalar index");
+  CUDF_EXPECTS(scalars[index] != nullptr, "scalar is null");
+  return *scalars[index];
+}
+
+std::unique_ptr<cudf::column>
+execute_op(jint const *op, batch_slots const &slots,
+           cudf::jni::native_jpointerArray<cudf::scalar> const &scalars) {
+  switch (static_cast<op_code>(op[0])) {
+    case op_code::UNARY:
+      return cudf::unary_operation(slots.view(op[1]), static_cast<cudf::unary_op>(op[3]));
+    case op_code::BINARY_VV:
+      return cudf::binary_operation(slots.view(op[1]), slots.view(op[2]),
+                                    static_cast<cudf::binary_operator>(op[3]),
+                                    cudf::data_type(static_cast<cudf::type_id>(op[4])));
+    case op_code::BINARY_VS:
+      return cudf::binary_operation(slots.view(op[1]), get_scalar(scalars, op[2]),
+                                    static_cast<cudf::binary_operator>(op[3]),
+                                    cudf::data_type(static_cast<cudf::type_id>(op[4])));
+    case op_code::IS_NULL: return cudf::is_null(slots.view(op[1]));
+    case op_code::IS_NOT_NULL: return cudf::is_valid(slots.view(op[1]));
+    case op_code::CAST:
+      return cudf::cast(slots.view(op[1]), cudf::data_type(static_cast<cudf::type_id>(op[3])));
+    case op_code::REPLACE_NULLS:
+      return cudf::replace_nulls(slots.view(op[1]), get_scalar(scalars, op[2]));
+    default: CUDF_FAIL("unsupported batch operation");
+  }
+}
+
+} // anonymous namespace
+
+extern "C" {
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_ColumnOpBatch_executeNative(
+    JNIEnv *env, jclass, jlongArray j_inputs, jlongArray j_scalars, jintArray j_ops,
+    jintArray j_outputs) {
+  JNI_NULL_CHECK(env, j_inputs, "input columns are null", NULL);
+  JNI_NULL_CHECK(env, j_ops, "operations are null", NULL);
+  JNI_NULL_CHECK(env, j_outputs, "outputs are null", NULL);
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jpointerArray<cudf::column_view> inputs(env, j_inputs);
+    cudf::jni::native_jpointerArray<cudf::scalar> scalars(env, j_scalars);
+    cudf::jni::native_jintArray ops(env, j_ops);
+    cudf::jni::native_jintArray outputs(env, j_outputs);
+    JNI_ARG_CHECK(env, ops.size() % OP_WIDTH == 0, "malformed operations", NULL);
+
+    // Intermediate results never leave native memory, they are freed when slots goes away
+    batch_slots slots(inputs);
+    for (int i = 0; i < ops.size(); i += OP_WIDTH) {
+      slots.add(execute_op(ops.data() + i, slots, scalars));
+    }
+
+    // The results stay owned until the whole batch has succeeded, so none leaks on a throw
+    std::vector<std::unique_ptr<cudf::column>> results;
+    for (int i = 0; i < outputs.size(); ++i) {
+      results.push_back(slots.take(outputs[i]));
+    }
+    cudf::jni::native_jlongArray result_handles(env, outputs.size());
+    for (int i = 0; i < outputs.size(); ++i) {
+      result_handles[i] = reinterpret_cast<jlong>(results[i].get());
+    }
+    auto const j_results = result_handles.get_jArray();
+    for (auto &result : results) {
+      result.release();
+    }
+    return j_results;
+  }
+  CATCH_STD(env, NULL);
+}
+
+} // extern "C"
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/metrics.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include "jni_utils.hpp"
+
+namespace {
+
+constexpr char const *OPERATION_METRICS_CLASS = "ai/rapids/cudf/OperationMetrics";
+
+/** Adaptor installed as the default resource while allocations are tracked */
+std::unique_ptr<cudf::metrics::metrics_resource_adaptor> Metrics_memory_resource{};
+
+void install_metrics_resource() {
+  if (Metrics_memory_resource) {
+    return;
+  }
+  auto resource = rmm::mr::get_default_resource();
+  Metrics_memory_resource.reset(new cudf::metrics::metrics_resource_adaptor(resource));
+  auto replaced_resource = rmm::mr::set_default_resource(Metrics_memory_resource.get());
+  if (resource != replaced_resource) {
+    rmm::mr::set_default_resource(replaced_resource);
+    Metrics_memory_resource.reset(nullptr);
+    throw std::runtime_error("Concurrent modification detected while installing memory resource");
+  }
+}
+
+void remove_metrics_resource() {
+  if (!Metrics_memory_resource) {
+    return;
+  }
+  auto metrics_resource = Metrics_memory_resource.get();
+  auto old_resource = rmm::mr::set_default_resource(metrics_resource->get_upstream());
+  if (old_resource != metrics_resource) {
+    rmm::mr::set_default_resource(old_resource);
+    throw std::runtime_error("Concurrent modification detected while removing memory resource");
+  }
+  Metrics_memory_resource.reset(nullptr);
+}
+
+} // anonymous namespace
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Metrics_enableNative(JNIEnv *env, jclass,
+                                                                jboolean track_allocations) {
+  try {
+    if (track_allocations) {
+      install_metrics_resource();
+    }
+    cudf::metrics::enable();
+  }
+  CATCH_STD(env, );
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Metrics_disableNative(JNIEnv *env, jclass) {
+  try {
+    cudf::metrics::disable();
+    remove_metrics_resource();
+  }
+  CATCH_STD(env, );
+}
+
+JNIEXPORT jboolean JNICALL Java_ai_rapids_cudf_Metrics_isEnabled(JNIEnv *env, jclass) {
+  try {
+    return cudf::metrics::is_enabled();
+  }
+  CATCH_STD(env, false);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_ai_rapids_cudf_Metrics_collectNative(JNIEnv *env, jclass) {
+  try {
+    cudf::jni::auto_set_device(env);
+    auto const metrics = cudf::metrics::collect();
+
+    jclass metrics_class = env->FindClass(OPERATION_METRICS_CLASS);
+    if (metrics_class == NULL) {
+      return NULL;
+    }
+    jmethodID ctor_id = env->GetMethodID(metrics_class, "<init>", "(Ljava/lang/String;DFJJ)V");
+    if (ctor_id == NULL) {
+      return NULL;
+    }
+
+    jobjectArray result = env->NewObjectArray(metrics.size(), metrics_class, NULL);
+    if (result == NULL) {
+      return NULL;
+    }
+    for (std::size_t i = 0; i < metrics.size(); ++i) {
+      jstring name = env->NewStringUTF(metrics[i].name.c_str());
+      if (name == NULL) {
+        return NULL;
+      }
+      jobject op = env->NewObject(metrics_class, ctor_id, name, metrics[i].wall_time_ms,
+                                  metrics[i].gpu_time_ms,
+                                  static_cast<jlong>(metrics[i].output_bytes),
+                                  static_cast<jlong>(metrics[i].peak_temporary_bytes));
+      if (op == NULL) {
+        return NULL;
+      }
+      env->SetObjectArrayElement(result, i, op);
+      env->DeleteLocalRef(op);
+      env->DeleteLocalRef(name);
+    }
+    return result;
+  }
+  CATCH_STD(env, NULL);
+}
+
+} // extern "C"
@@ -616,6 +616,50 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_Table_writeParquetEnd(JNIEnv *env, jc
   CATCH_STD(env, )
 }
 
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_writeParquetToBuffer(
+    JNIEnv *env, jclass, jobjectArray j_col_names, jbooleanArray j_col_nullability,
+    jobjectArray j_metadata_keys, jobjectArray j_metadata_values, jint j_compression,
+    jint j_stats_freq, jlong j_table, jlong buffer, jlong buffer_length) {
+  JNI_NULL_CHECK(env, j_col_names, "null columns", 0);
+  JNI_NULL_CHECK(env, j_col_nullability, "null nullability", 0);
+  JNI_NULL_CHECK(env, j_metadata_keys, "null metadata keys", 0);
+  JNI_NULL_CHECK(env, j_metadata_values, "null metadata values", 0);
+  JNI_NULL_CHECK(env, j_table, "null table", 0);
+  JNI_NULL_CHECK(env, buffer, "null buffer", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    using namespace cudf::io;
+    cudf::jni::native_jstringArray col_names(env, j_col_names);
+    cudf::jni::native_jbooleanArray col_nullability(env, j_col_nullability);
+    cudf::jni::native_jstringArray meta_keys(env, j_metadata_keys);
+    cudf::jni::native_jstringArray meta_values(env, j_metadata_values);
+    cudf::table_view *tview = reinterpret_cast<cudf::table_view *>(j_table);
+
+    auto d = col_nullability.data();
+    std::vector<bool> nullability(d, d + col_nullability.size());
+    table_metadata_with_nullability metadata;
+    metadata.column_nullable = nullability;
+    metadata.column_names = col_names.as_cpp_vector();
+    for (size_t i = 0; i < meta_keys.size(); ++i) {
+      metadata.user_data[meta_keys[i].get()] = meta_values[i].get();
+    }
+
+    // The writer copies the encoded data straight into the caller's memory
+    std::unique_ptr<data_sink> host_sink =
+        data_sink::create(reinterpret_cast<void *>(buffer), buffer_length);
+    sink_info sink{host_sink.get()};
+    compression_type compression{static_cast<compression_type>(j_compression)};
+    statistics_freq stats{static_cast<statistics_freq>(j_stats_freq)};
+
+    write_parquet_chunked_args args(sink, &metadata, compression, stats);
+    std::shared_ptr<detail::parquet::pq_chunked_state> state = write_parquet_chunked_begin(args);
+    write_parquet_chunked(*tview, state);
+    write_parquet_chunked_end(state);
+    return static_cast<jlong>(host_sink->bytes_written());
+  }
+  CATCH_STD(env, 0)
+}
+
 JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_readORC(
     JNIEnv *env, jclass j_class_object, jobjectArray filter_col_names, jstring inputfilepath,
     jlong buffer, jlong buffer_length, jboolean usingNumPyTypes, jint unit) {
@@ -776,6 +820,49 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_Table_writeORCEnd(JNIEnv *env, jclass
   CATCH_STD(env, )
 }
 
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_writeORCToBuffer(
+    JNIEnv *env, jclass, jobjectArray j_col_names, jbooleanArray j_col_nullability,
+    jobjectArray j_metadata_keys, jobjectArray j_metadata_values, jint j_compression,
+    jlong j_table, jlong buffer, jlong buffer_length) {
+  JNI_NULL_CHECK(env, j_col_names, "null columns", 0);
+  JNI_NULL_CHECK(env, j_col_nullability, "null nullability", 0);
+  JNI_NULL_CHECK(env, j_metadata_keys, "null metadata keys", 0);
+  JNI_NULL_CHECK(env, j_metadata_values, "null metadata values", 0);
+  JNI_NULL_CHECK(env, j_table, "null table", 0);
+  JNI_NULL_CHECK(env, buffer, "null buffer", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    using namespace cudf::io;
+    cudf::jni::native_jstringArray col_names(env, j_col_names);
+    cudf::jni::native_jbooleanArray col_nullability(env, j_col_nullability);
+    cudf::jni::native_jstringArray meta_keys(env, j_metadata_keys);
+    cudf::jni::native_jstringArray meta_values(env, j_metadata_values);
+    cudf::table_view *tview = reinterpret_cast<cudf::table_view *>(j_table);
+
+    auto d = col_nullability.data();
+    std::vector<bool> nullability(d, d + col_nullability.size());
+    table_metadata_with_nullability metadata;
+    metadata.column_nullable = nullability;
+    metadata.column_names = col_names.as_cpp_vector();
+    for (size_t i = 0; i < meta_keys.size(); ++i) {
+      metadata.user_data[meta_keys[i].get()] = meta_values[i].get();
+    }
+
+    // The writer copies the encoded data straight into the caller's memory
+    std::unique_ptr<data_sink> host_sink =
+        data_sink::create(reinterpret_cast<void *>(buffer), buffer_length);
+    sink_info sink{host_sink.get()};
+    compression_type compression{static_cast<compression_type>(j_compression)};
+
+    write_orc_chunked_args args(sink, &metadata, compression, true);
+    std::shared_ptr<detail::orc::orc_chunked_state> state = write_orc_chunked_begin(args);
+    write_orc_chunked(*tview, state);
+    write_orc_chunked_end(state);
+    return static_cast<jlong>(host_sink->bytes_written());
+  }
+  CATCH_STD(env, 0)
+}
+
 JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_leftJoin(JNIEnv *env, jclass clazz,
                                                                 jlong left_table,
                                                                 jintArray left_col_join_indices,
@@ -0,0 +1,89 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import org.junit.jupiter.api.Test;
+
+import static ai.rapids.cudf.TableTest.assertColumnsAreEqual;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+
+public class ColumnOpBatchTest extends CudfTestBase {
+  @Test
+  void testChainedOps() {
+    try (ColumnVector a = ColumnVector.fromBoxedInts(1, 2, null, 4);
+         ColumnVector b = ColumnVector.fromBoxedInts(10, null, 30, 40);
+         Scalar two = Scalar.fromInt(2);
+         Scalar zero = Scalar.fromInt(0);
+         ColumnVector expectedSum = ColumnVector.fromBoxedInts(22, 0, 0, 88);
+         ColumnVector expectedNulls = ColumnVector.fromBoxedBooleans(false, false, true, false)) {
+      ColumnOpBatch batch = new ColumnOpBatch();
+      int lhs = batch.input(a);
+      int rhs = batch.input(b);
+      int sum = batch.binaryOp(BinaryOp.ADD, lhs, rhs, DType.INT32);
+      int doubled = batch.binaryOp(BinaryOp.MUL, sum, two, DType.INT32);
+      int filled = batch.replaceNulls(doubled, zero);
+      int nulls = batch.isNull(lhs);
+      ColumnVector[] results = batch.execute(filled, nulls);
+      try {
+        assertEquals(2, results.length);
+        assertColumnsAreEqual(expectedSum, results[0]);
+        assertColumnsAreEqual(expectedNulls, results[1]);
+      } finally {
+        for (ColumnVector cv : results) {
+          cv.close();
+        }
+      }
+    }
+  }
+
+  @Test
+  void testCastAndUnary() {
+    try (ColumnVector a = ColumnVector.fromBoxedInts(-1, 2, null);
+         ColumnVector expectedAbs = ColumnVector.fromBoxedLongs(1L, 2L, null);
+         ColumnVector expectedValid = ColumnVector.fromBoxedBooleans(true, true, false)) {
+      ColumnOpBatch batch = new ColumnOpBatch();
+      int input = batch.input(a);
+      int abs = batch.unaryOp(UnaryOp.ABS, batch.castTo(input, DType.INT64));
+      int valid = batch.isNotNull(input);
+      ColumnVector[] results = batch.execute(abs, valid, input);
+      try {
+        assertColumnsAreEqual(expectedAbs, results[0]);
+        assertColumnsAreEqual(expectedValid, results[1]);
+        assertColumnsAreEqual(a, results[2]);
+      } finally {
+        for (ColumnVector cv : results) {
+          cv.close();
+        }
+      }
+    }
+  }
+
+  @Test
+  void testInvalidSlot() {
+    try (ColumnVector a = ColumnVector.fromInts(1, 2)) {
+      ColumnOpBatch batch = new ColumnOpBatch();
+      int input = batch.input(a);
+      assertThrows(IllegalArgumentException.class, () -> batch.isNull(input + 1));
+      batch.isNull(input);
+      assertThrows(IllegalStateException.class, () -> batch.input(a));
+      assertThrows(IllegalArgumentException.class, () -> batch.execute(5));
+    }
+  }
+}
@@ -91,6 +91,29 @@ public class ColumnVectorTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testAsyncCopies() {
+    try (Cuda.Stream stream = new Cuda.Stream(true);
+         HostColumnVector hostInts = HostColumnVector.fromBoxedInts(1, null, 3, 4);
+         HostColumnVector hostStrings = HostColumnVector.fromStrings("a", null, "ccc");
+         ColumnVector expectedInts = ColumnVector.fromBoxedInts(1, null, 3, 4);
+         ColumnVector expectedStrings = ColumnVector.fromStrings("a", null, "ccc");
+         ColumnVector ints = hostInts.copyToDeviceAsync(stream);
+         ColumnVector strings = hostStrings.copyToDeviceAsync(stream)) {
+      stream.sync();
+      assertColumnsAreEqual(expectedInts, ints);
+      assertColumnsAreEqual(expectedStrings, strings);
+      try (HostColumnVector backInts = ints.copyToHostAsync(stream);
+           HostColumnVector backStrings = strings.copyToHostAsync(stream)) {
+        stream.sync();
+        assertEquals(1, backInts.getNullCount());
+        assertEquals(3, backInts.getInt(2));
+        assertTrue(backStrings.isNull(1));
+        assertEquals("ccc", backStrings.getJavaString(2));
+      }
+    }
+  }
+
   @Test
   void testClampDouble() {
     try (ColumnVector cv = ColumnVector.fromDoubles(2.33d, 32.12d, -121.32d, 0.0d, 0.00001d,
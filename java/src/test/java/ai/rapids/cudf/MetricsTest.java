@@ -0,0 +1,52 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class MetricsTest extends CudfTestBase {
+  @Test
+  void testRecordsApiCalls() {
+    Metrics.collect();
+    Metrics.enable(true);
+    try {
+      assertTrue(Metrics.isEnabled());
+      try (Scalar zero = Scalar.fromInt(0);
+           ColumnVector seq = ColumnVector.sequence(zero, 1000)) {
+        OperationMetrics[] metrics = Metrics.collect();
+        assertEquals(1, metrics.length);
+        assertEquals("sequence", metrics[0].name);
+        assertTrue(metrics[0].wallTimeMs >= 0);
+        assertTrue(metrics[0].gpuTimeMs >= 0);
+        assertTrue(metrics[0].outputBytes >= 1000 * 4);
+      }
+    } finally {
+      Metrics.disable();
+    }
+    assertFalse(Metrics.isEnabled());
+    try (Scalar zero = Scalar.fromInt(0);
+         ColumnVector seq = ColumnVector.sequence(zero, 10)) {
+      assertEquals(0, Metrics.collect().length);
+    }
+  }
+}
@@ -2744,6 +2744,18 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testParquetWriteToHostBuffer() {
+    try (Table table0 = getExpectedFileTable();
+         HostMemoryBuffer buffer = HostMemoryBuffer.allocate(10 * 1024 * 1024)) {
+      long written = table0.writeParquet(ParquetWriterOptions.DEFAULT, buffer);
+      assertTrue(written > 0);
+      try (Table table1 = Table.readParquet(ParquetOptions.DEFAULT, buffer, 0, written)) {
+        assertTablesAreEqual(table0, table1);
+      }
+    }
+  }
+
   @Test
   void testParquetWriteToFileWithNames() throws IOException {
     File tempFile = File.createTempFile("test-names", ".parquet");
@@ -2804,6 +2816,18 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testORCWriteToHostBuffer() {
+    try (Table table0 = getExpectedFileTable();
+         HostMemoryBuffer buffer = HostMemoryBuffer.allocate(10 * 1024 * 1024)) {
+      long written = table0.writeORC(ORCWriterOptions.DEFAULT, buffer);
+      assertTrue(written > 0);
+      try (Table table1 = Table.readORC(ORCOptions.DEFAULT, buffer, 0, written)) {
+        assertTablesAreEqual(table0, table1);
+      }
+    }
+  }
+
   @Test
   void testORCWriteToBufferChunked() {
     try (Table table0 = getExpectedFileTable();
@@ -29,6 +29,8 @@ cdef extern from "cudf/io/types.hpp" \
         BROTLI "cudf::io::compression_type::BROTLI"
         ZIP "cudf::io::compression_type::ZIP"
         XZ "cudf::io::compression_type::XZ"
+        ZSTD "cudf::io::compression_type::ZSTD"
+        DEFLATE "cudf::io::compression_type::DEFLATE"
 
     ctypedef enum io_type:
         FILEPATH "cudf::io::io_type::FILEPATH"